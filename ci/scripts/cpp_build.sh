@@ -99,6 +99,7 @@ cmake -G "${CMAKE_GENERATOR:-Ninja}" \
       -DARROW_WITH_LZ4=${ARROW_WITH_LZ4:-OFF} \
       -DARROW_WITH_SNAPPY=${ARROW_WITH_SNAPPY:-OFF} \
       -DARROW_WITH_UTF8PROC=${ARROW_WITH_UTF8PROC:-ON} \
+      -DARROW_WITH_RE2=${ARROW_WITH_RE2:-ON} \
       -DARROW_WITH_ZLIB=${ARROW_WITH_ZLIB:-OFF} \
       -DARROW_WITH_ZSTD=${ARROW_WITH_ZSTD:-OFF} \
       -DAWSSDK_SOURCE=${AWSSDK_SOURCE:-} \
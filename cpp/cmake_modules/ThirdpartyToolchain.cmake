@@ -254,8 +254,9 @@ if(ARROW_S3)
 endif()
 
 if(NOT ARROW_COMPUTE)
-  # utf8proc is only potentially used in kernels for now
+  # utf8proc and re2 are only potentially used in kernels for now
   set(ARROW_WITH_UTF8PROC OFF)
+  set(ARROW_WITH_RE2 OFF)
 endif()
 
 # ----------------------------------------------------------------------
@@ -2089,7 +2090,7 @@ macro(build_re2)
   list(APPEND ARROW_BUNDLED_STATIC_LIBS RE2::re2)
 endmacro()
 
-if(ARROW_GANDIVA)
+if(ARROW_WITH_RE2 OR ARROW_GANDIVA)
   resolve_dependency(RE2)
 
   # TODO: Don't use global includes but rather target_include_directories
@@ -2097,6 +2098,10 @@ if(ARROW_GANDIVA)
   include_directories(SYSTEM ${RE2_INCLUDE_DIR})
 endif()
 
+if(ARROW_WITH_RE2)
+  add_definitions(-DARROW_WITH_RE2)
+endif()
+
 macro(build_bzip2)
   message(STATUS "Building BZip2 from source")
   set(BZIP2_PREFIX "${CMAKE_CURRENT_BINARY_DIR}/bzip2_ep-install")
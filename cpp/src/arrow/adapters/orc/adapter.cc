@@ -19,6 +19,7 @@
 #include "arrow/adapters/orc/adapter_util.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <list>
 #include <memory>
@@ -32,6 +33,7 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/table_builder.h"
@@ -42,7 +44,9 @@
 #include "arrow/util/decimal.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/range.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/visibility.h"
 
 #include "orc/Exceptions.hh"
@@ -116,6 +120,80 @@ struct StripeInformation {
 // The number of rows to read in a ColumnVectorBatch
 constexpr int64_t kReadRowsBatch = 1000;
 
+// Convert the statistics of a column to scalars of its Arrow type, leaving min
+// and max unset if they are missing or of an unsupported type
+Status GetColumnStatistics(const liborc::Type* type,
+                           const liborc::ColumnStatistics* statistics,
+                           ORCColumnStatistics* out) {
+  *out = ORCColumnStatistics();
+  if (statistics == nullptr) {
+    return Status::OK();
+  }
+  std::shared_ptr<DataType> arrow_type;
+  RETURN_NOT_OK(GetArrowType(type, &arrow_type));
+  out->has_null = statistics->hasNull();
+  if (statistics->getNumberOfValues() == 0) {
+    if (statistics->hasNull()) {
+      out->min = out->max = MakeNullScalar(arrow_type);
+    }
+    return Status::OK();
+  }
+
+  switch (type->getKind()) {
+    case liborc::BOOLEAN: {
+      const auto* stats =
+          dynamic_cast<const liborc::BooleanColumnStatistics*>(statistics);
+      if (stats != nullptr && stats->hasCount()) {
+        out->min = MakeScalar(stats->getFalseCount() == 0);
+        out->max = MakeScalar(stats->getTrueCount() != 0);
+      }
+      break;
+    }
+    case liborc::BYTE:
+    case liborc::SHORT:
+    case liborc::INT:
+    case liborc::LONG: {
+      const auto* stats =
+          dynamic_cast<const liborc::IntegerColumnStatistics*>(statistics);
+      if (stats != nullptr && stats->hasMinimum() && stats->hasMaximum()) {
+        ARROW_ASSIGN_OR_RAISE(out->min, MakeScalar(arrow_type, stats->getMinimum()));
+        ARROW_ASSIGN_OR_RAISE(out->max, MakeScalar(arrow_type, stats->getMaximum()));
+      }
+      break;
+    }
+    case liborc::FLOAT:
+    case liborc::DOUBLE: {
+      const auto* stats = dynamic_cast<const liborc::DoubleColumnStatistics*>(statistics);
+      if (stats != nullptr && stats->hasMinimum() && stats->hasMaximum() &&
+          !std::isnan(stats->getMinimum()) && !std::isnan(stats->getMaximum())) {
+        ARROW_ASSIGN_OR_RAISE(out->min, MakeScalar(arrow_type, stats->getMinimum()));
+        ARROW_ASSIGN_OR_RAISE(out->max, MakeScalar(arrow_type, stats->getMaximum()));
+      }
+      break;
+    }
+    case liborc::STRING:
+    case liborc::VARCHAR: {
+      const auto* stats = dynamic_cast<const liborc::StringColumnStatistics*>(statistics);
+      if (stats != nullptr && stats->hasMinimum() && stats->hasMaximum()) {
+        out->min = MakeScalar(stats->getMinimum());
+        out->max = MakeScalar(stats->getMaximum());
+      }
+      break;
+    }
+    case liborc::DATE: {
+      const auto* stats = dynamic_cast<const liborc::DateColumnStatistics*>(statistics);
+      if (stats != nullptr && stats->hasMinimum() && stats->hasMaximum()) {
+        ARROW_ASSIGN_OR_RAISE(out->min, MakeScalar(arrow_type, stats->getMinimum()));
+        ARROW_ASSIGN_OR_RAISE(out->max, MakeScalar(arrow_type, stats->getMaximum()));
+      }
+      break;
+    }
+    default:
+      break;
+  }
+  return Status::OK();
+}
+
 class OrcStripeReader : public RecordBatchReader {
  public:
   OrcStripeReader(std::unique_ptr<liborc::RowReader> row_reader,
@@ -180,6 +258,7 @@ class ORCFileReader::Impl {
     pool_ = pool;
     reader_ = std::move(liborc_reader);
     current_row_ = 0;
+    use_threads_ = false;
 
     return Init();
   }
@@ -202,6 +281,10 @@ class ORCFileReader::Impl {
 
   int64_t NumberOfRows() { return reader_->getNumberOfRows(); }
 
+  int64_t RowIndexStride() { return reader_->getRowIndexStride(); }
+
+  void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
+
   Status ReadSchema(std::shared_ptr<Schema>* out) {
     const liborc::Type& type = reader_->getType();
     return GetArrowSchema(type, out);
@@ -290,6 +373,85 @@ class ORCFileReader::Impl {
     return ReadBatch(opts, schema, stripes_[stripe].num_rows, out);
   }
 
+  Status ReadStripe(int64_t stripe, const std::vector<std::string>& include_names,
+                    const std::vector<int>& row_groups,
+                    std::shared_ptr<RecordBatch>* out) {
+    liborc::RowReaderOptions opts;
+    opts.include(std::list<std::string>(include_names.begin(), include_names.end()));
+    RETURN_NOT_OK(SelectStripe(&opts, stripe));
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(ReadSchema(opts, &schema));
+
+    // Coalesce the row groups into ranges of rows of the stripe
+    const StripeInformation& info = stripes_[stripe];
+    const int64_t num_rows = static_cast<int64_t>(info.num_rows);
+    std::vector<std::pair<int64_t, int64_t>> ranges;
+    if (row_groups.empty()) {
+      ranges.emplace_back(0, num_rows);
+    } else {
+      const int64_t stride = RowIndexStride();
+      ARROW_RETURN_IF(stride == 0, Status::Invalid("The file has no row index"));
+      for (int row_group : row_groups) {
+        const int64_t start = row_group * stride;
+        ARROW_RETURN_IF(row_group < 0 || start >= num_rows ||
+                            (!ranges.empty() && start < ranges.back().second),
+                        Status::Invalid("Out of bounds or unordered row group: ",
+                                        row_group));
+        const int64_t stop = std::min(start + stride, num_rows);
+        if (!ranges.empty() && ranges.back().second == start) {
+          ranges.back().second = stop;
+        } else {
+          ranges.emplace_back(start, stop);
+        }
+      }
+    }
+    return ReadRanges(opts, schema, static_cast<int64_t>(info.first_row_of_stripe),
+                      ranges, out);
+  }
+
+  Status ReadStripeStatistics(int64_t stripe, std::vector<ORCColumnStatistics>* out,
+                              std::vector<std::vector<ORCColumnStatistics>>* row_groups) {
+    ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
+                    Status::Invalid("Out of bounds stripe: ", stripe));
+    const liborc::Type& type = reader_->getType();
+    const uint64_t num_fields = type.getSubtypeCount();
+    out->assign(num_fields, ORCColumnStatistics());
+    if (row_groups != nullptr) {
+      row_groups->clear();
+    }
+    if (static_cast<uint64_t>(stripe) >= reader_->getNumberOfStripeStatistics()) {
+      // Statistics are optional
+      return Status::OK();
+    }
+
+    std::unique_ptr<liborc::StripeStatistics> statistics;
+    try {
+      statistics = reader_->getStripeStatistics(stripe);
+    } catch (const liborc::ParseError& e) {
+      return Status::IOError(e.what());
+    }
+    for (uint64_t i = 0; i < num_fields; ++i) {
+      const liborc::Type* field_type = type.getSubtype(i);
+      const auto column_id = static_cast<uint32_t>(field_type->getColumnId());
+      RETURN_NOT_OK(GetColumnStatistics(
+          field_type, statistics->getColumnStatistics(column_id), &(*out)[i]));
+      if (row_groups == nullptr || RowIndexStride() == 0) {
+        continue;
+      }
+      const uint32_t num_row_groups = statistics->getNumberOfRowIndexStats(column_id);
+      if (row_groups->size() < num_row_groups) {
+        row_groups->resize(num_row_groups,
+                           std::vector<ORCColumnStatistics>(num_fields));
+      }
+      for (uint32_t j = 0; j < num_row_groups; ++j) {
+        RETURN_NOT_OK(GetColumnStatistics(field_type,
+                                          statistics->getRowIndexStatistics(column_id, j),
+                                          &(*row_groups)[j][i]));
+      }
+    }
+    return Status::OK();
+  }
+
   Status SelectStripe(liborc::RowReaderOptions* opts, int64_t stripe) {
     ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
                     Status::Invalid("Out of bounds stripe: ", stripe));
@@ -328,12 +490,17 @@ class ORCFileReader::Impl {
 
   Status ReadTable(const liborc::RowReaderOptions& row_opts,
                    const std::shared_ptr<Schema>& schema, std::shared_ptr<Table>* out) {
-    liborc::RowReaderOptions opts(row_opts);
-    std::vector<std::shared_ptr<RecordBatch>> batches(stripes_.size());
-    for (size_t stripe = 0; stripe < stripes_.size(); stripe++) {
-      opts.range(stripes_[stripe].offset, stripes_[stripe].length);
-      RETURN_NOT_OK(ReadBatch(opts, schema, stripes_[stripe].num_rows, &batches[stripe]));
-    }
+    const int num_stripes = static_cast<int>(stripes_.size());
+    std::vector<std::shared_ptr<RecordBatch>> batches(num_stripes);
+    // Each stripe is decoded by its own row reader.  Don't wait on other tasks
+    // from a task of the CPU thread pool.
+    const bool use_threads = use_threads_ && num_stripes > 1 &&
+                             !internal::GetCpuThreadPool()->OwnsThisThread();
+    RETURN_NOT_OK(internal::OptionalParallelFor(use_threads, num_stripes, [&](int i) {
+      liborc::RowReaderOptions opts(row_opts);
+      opts.range(stripes_[i].offset, stripes_[i].length);
+      return ReadBatch(opts, schema, stripes_[i].num_rows, &batches[i]);
+    }));
     return Table::FromRecordBatches(schema, std::move(batches)).Value(out);
   }
 
@@ -365,6 +532,55 @@ class ORCFileReader::Impl {
     return Status::OK();
   }
 
+  // Read ranges of rows, relative to the first row of a stripe selected by the options
+  Status ReadRanges(const liborc::RowReaderOptions& opts,
+                    const std::shared_ptr<Schema>& schema, int64_t first_row,
+                    const std::vector<std::pair<int64_t, int64_t>>& ranges,
+                    std::shared_ptr<RecordBatch>* out) {
+    int64_t nrows = 0;
+    for (const auto& range : ranges) {
+      nrows += range.second - range.first;
+    }
+    std::unique_ptr<liborc::RowReader> row_reader;
+    std::unique_ptr<liborc::ColumnVectorBatch> batch;
+    try {
+      row_reader = reader_->createRowReader(opts);
+      batch = row_reader->createRowBatch(std::min(nrows, kReadRowsBatch));
+    } catch (const liborc::ParseError& e) {
+      return Status::Invalid(e.what());
+    }
+    std::unique_ptr<RecordBatchBuilder> builder;
+    RETURN_NOT_OK(RecordBatchBuilder::Make(schema, pool_, nrows, &builder));
+
+    // The top-level type must be a struct to read into an arrow table
+    const auto& struct_batch = checked_cast<liborc::StructVectorBatch&>(*batch);
+
+    const liborc::Type& type = row_reader->getSelectedType();
+    for (const auto& range : ranges) {
+      int64_t remaining = range.second - range.first;
+      try {
+        row_reader->seekToRow(first_row + range.first);
+      } catch (const liborc::ParseError& e) {
+        return Status::Invalid(e.what());
+      }
+      while (remaining > 0 && row_reader->next(*batch)) {
+        const int64_t length =
+            std::min(remaining, static_cast<int64_t>(batch->numElements));
+        for (int i = 0; i < builder->num_fields(); i++) {
+          RETURN_NOT_OK(AppendBatch(type.getSubtype(i), struct_batch.fields[i], 0,
+                                    length, builder->GetField(i)));
+        }
+        remaining -= length;
+      }
+    }
+    if (schema->num_fields() == 0) {
+      // No builder to count the rows
+      *out = RecordBatch::Make(schema, nrows, ArrayVector{});
+      return Status::OK();
+    }
+    return builder->Flush(out);
+  }
+
   Status Seek(int64_t row_number) {
     ARROW_RETURN_IF(row_number >= NumberOfRows(),
                     Status::Invalid("Out of bounds row number: ", row_number));
@@ -411,6 +627,7 @@ class ORCFileReader::Impl {
   std::unique_ptr<liborc::Reader> reader_;
   std::vector<StripeInformation> stripes_;
   int64_t current_row_;
+  bool use_threads_;
 };
 
 ORCFileReader::ORCFileReader() { impl_.reset(new ORCFileReader::Impl()); }
@@ -469,10 +686,29 @@ Status ORCFileReader::NextStripeReader(int64_t batch_size,
   return impl_->NextStripeReader(batch_size, include_indices, out);
 }
 
+Status ORCFileReader::ReadStripe(int64_t stripe,
+                                 const std::vector<std::string>& include_names,
+                                 const std::vector<int>& row_groups,
+                                 std::shared_ptr<RecordBatch>* out) {
+  return impl_->ReadStripe(stripe, include_names, row_groups, out);
+}
+
+Status ORCFileReader::ReadStripeStatistics(
+    int64_t stripe, std::vector<ORCColumnStatistics>* out,
+    std::vector<std::vector<ORCColumnStatistics>>* row_groups) {
+  return impl_->ReadStripeStatistics(stripe, out, row_groups);
+}
+
+void ORCFileReader::set_use_threads(bool use_threads) {
+  impl_->set_use_threads(use_threads);
+}
+
 int64_t ORCFileReader::NumberOfStripes() { return impl_->NumberOfStripes(); }
 
 int64_t ORCFileReader::NumberOfRows() { return impl_->NumberOfRows(); }
 
+int64_t ORCFileReader::RowIndexStride() { return impl_->RowIndexStride(); }
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
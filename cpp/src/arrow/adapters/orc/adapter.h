@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "arrow/io/interfaces.h"
@@ -34,6 +35,18 @@ namespace adapters {
 
 namespace orc {
 
+/// \brief Statistics of a top-level field in a stripe or row group of an ORC file
+struct ARROW_EXPORT ORCColumnStatistics {
+  /// The smallest and largest values of the field, as scalars of its Arrow type.
+  /// Both are null scalars if the field only contains nulls, and null pointers if
+  /// unknown: only boolean, integer, floating-point, string and date fields are
+  /// summarized.
+  std::shared_ptr<Scalar> min, max;
+
+  /// Whether the field contains nulls
+  bool has_null = true;
+};
+
 /// \class ORCFileReader
 /// \brief Read an Arrow Table or RecordBatch from an ORC file.
 class ARROW_EXPORT ORCFileReader {
@@ -130,12 +143,48 @@ class ARROW_EXPORT ORCFileReader {
   Status NextStripeReader(int64_t batch_size, const std::vector<int>& include_indices,
                           std::shared_ptr<RecordBatchReader>* out);
 
+  /// \brief Read some row groups and top-level fields of a stripe as a RecordBatch
+  ///
+  /// Row groups are the units of the row index of the file, of RowIndexStride()
+  /// rows each.  The reader seeks directly to the selected row groups.
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[in] include_names the names of the selected top-level fields
+  /// \param[in] row_groups the indices of the selected row groups in the stripe,
+  ///            in increasing order, or empty to read the whole stripe
+  /// \param[out] out the returned RecordBatch
+  Status ReadStripe(int64_t stripe, const std::vector<std::string>& include_names,
+                    const std::vector<int>& row_groups,
+                    std::shared_ptr<RecordBatch>* out);
+
+  /// \brief Read the statistics of the top-level fields in a stripe, and
+  ///        optionally in each of its row groups
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[out] out the statistics of each top-level field in the stripe
+  /// \param[out] row_groups if not null, the statistics of each top-level field in
+  ///             each row group of the stripe, or empty if the file has no row
+  ///             index
+  Status ReadStripeStatistics(
+      int64_t stripe, std::vector<ORCColumnStatistics>* out,
+      std::vector<std::vector<ORCColumnStatistics>>* row_groups = NULLPTR);
+
+  /// \brief Set whether to decode stripes in parallel on the CPU thread pool
+  ///
+  /// This applies to the methods reading the file as a Table, and is off by
+  /// default.
+  void set_use_threads(bool use_threads);
+
   /// \brief The number of stripes in the file
   int64_t NumberOfStripes();
 
   /// \brief The number of rows in the file
   int64_t NumberOfRows();
 
+  /// \brief The number of rows in each row group of the row index, or 0 if the
+  ///        file has no row index
+  int64_t RowIndexStride();
+
  private:
   class Impl;
   std::unique_ptr<Impl> impl_;
@@ -20,6 +20,10 @@
 #include "arrow/adapters/orc/adapter.h"
 #include "arrow/array.h"
 #include "arrow/io/api.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/checked_cast.h"
 
 #include <gtest/gtest.h>
 #include <orc/OrcFile.hh>
@@ -28,6 +32,8 @@ namespace liborc = orc;
 
 namespace arrow {
 
+using internal::checked_cast;
+
 constexpr int DEFAULT_MEM_STREAM_SIZE = 100 * 1024 * 1024;
 
 class MemoryOutputStream : public liborc::OutputStream {
@@ -60,12 +66,13 @@ class MemoryOutputStream : public liborc::OutputStream {
 
 std::unique_ptr<liborc::Writer> CreateWriter(uint64_t stripe_size,
                                              const liborc::Type& type,
-                                             liborc::OutputStream* stream) {
+                                             liborc::OutputStream* stream,
+                                             uint64_t row_index_stride = 0) {
   liborc::WriterOptions options;
   options.setStripeSize(stripe_size);
   options.setCompressionBlockSize(1024);
   options.setMemoryPool(liborc::getDefaultPool());
-  options.setRowIndexStride(0);
+  options.setRowIndexStride(row_index_stride);
   return liborc::createWriter(type, stream, options);
 }
 
@@ -157,4 +164,100 @@ TEST(TestAdapter, readIntAndStringFileMultipleStripes) {
     EXPECT_TRUE(stripe_reader->ReadNext(&record_batch).ok());
   }
 }
+
+class TestAdapterStatistics : public ::testing::Test {
+ public:
+  static constexpr uint64_t kStripeCount = 4;
+  static constexpr uint64_t kStripeRowCount = 5000;
+  static constexpr uint64_t kRowIndexStride = 1000;
+
+  // Write stripes of (col1: the row number, col2: the row number halved)
+  void SetUp() override {
+    mem_stream_.reset(new MemoryOutputStream(DEFAULT_MEM_STREAM_SIZE));
+    ORC_UNIQUE_PTR<liborc::Type> type(
+        liborc::Type::buildTypeFromString("struct<col1:int,col2:double>"));
+    auto writer = CreateWriter(/*stripe_size=*/1024, *type, mem_stream_.get(),
+                               kRowIndexStride);
+    auto batch = writer->createRowBatch(kStripeRowCount);
+    auto struct_batch = dynamic_cast<liborc::StructVectorBatch*>(batch.get());
+    auto long_batch = dynamic_cast<liborc::LongVectorBatch*>(struct_batch->fields[0]);
+    auto double_batch = dynamic_cast<liborc::DoubleVectorBatch*>(struct_batch->fields[1]);
+    int64_t row = 0;
+    for (uint64_t j = 0; j < kStripeCount; ++j) {
+      for (uint64_t i = 0; i < kStripeRowCount; ++i, ++row) {
+        long_batch->data[i] = row;
+        double_batch->data[i] = row / 2.0;
+      }
+      struct_batch->numElements = long_batch->numElements = double_batch->numElements =
+          kStripeRowCount;
+      writer->add(*batch);
+    }
+    writer->close();
+
+    std::shared_ptr<io::RandomAccessFile> in_stream(new io::BufferReader(
+        std::make_shared<Buffer>(reinterpret_cast<const uint8_t*>(mem_stream_->getData()),
+                                 static_cast<int64_t>(mem_stream_->getLength()))));
+    ASSERT_OK(
+        adapters::orc::ORCFileReader::Open(in_stream, default_memory_pool(), &reader_));
+    ASSERT_EQ(kStripeCount, reader_->NumberOfStripes());
+  }
+
+ protected:
+  std::unique_ptr<MemoryOutputStream> mem_stream_;
+  std::unique_ptr<adapters::orc::ORCFileReader> reader_;
+};
+
+constexpr uint64_t TestAdapterStatistics::kStripeCount;
+constexpr uint64_t TestAdapterStatistics::kStripeRowCount;
+constexpr uint64_t TestAdapterStatistics::kRowIndexStride;
+
+TEST_F(TestAdapterStatistics, StripeAndRowGroupStatistics) {
+  std::vector<adapters::orc::ORCColumnStatistics> statistics;
+  std::vector<std::vector<adapters::orc::ORCColumnStatistics>> row_groups;
+  ASSERT_OK(reader_->ReadStripeStatistics(1, &statistics, &row_groups));
+  ASSERT_EQ(statistics.size(), 2);
+  AssertScalarsEqual(Int32Scalar(5000), *statistics[0].min);
+  AssertScalarsEqual(Int32Scalar(9999), *statistics[0].max);
+  AssertScalarsEqual(DoubleScalar(2500), *statistics[1].min);
+  AssertScalarsEqual(DoubleScalar(4999.5), *statistics[1].max);
+  ASSERT_FALSE(statistics[0].has_null);
+
+  ASSERT_EQ(kRowIndexStride, reader_->RowIndexStride());
+  ASSERT_EQ(row_groups.size(), kStripeRowCount / kRowIndexStride);
+  AssertScalarsEqual(Int32Scalar(7000), *row_groups[2][0].min);
+  AssertScalarsEqual(Int32Scalar(7999), *row_groups[2][0].max);
+
+  ASSERT_RAISES(Invalid, reader_->ReadStripeStatistics(kStripeCount, &statistics));
+}
+
+TEST_F(TestAdapterStatistics, ReadRowGroups) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader_->ReadStripe(2, {"col1"}, {1, 2, 4}, &batch));
+  ASSERT_EQ(batch->num_columns(), 1);
+  ASSERT_EQ(batch->schema()->field(0)->name(), "col1");
+  ASSERT_EQ(batch->num_rows(), 3 * kRowIndexStride);
+  const auto& values = checked_cast<const Int32Array&>(*batch->column(0));
+  EXPECT_EQ(values.Value(0), 11000);
+  EXPECT_EQ(values.Value(1999), 12999);
+  EXPECT_EQ(values.Value(2000), 14000);
+  EXPECT_EQ(values.Value(2999), 14999);
+
+  // No selected field
+  ASSERT_OK(reader_->ReadStripe(0, std::vector<std::string>{}, {}, &batch));
+  ASSERT_EQ(batch->num_columns(), 0);
+  ASSERT_EQ(batch->num_rows(), kStripeRowCount);
+
+  ASSERT_RAISES(Invalid, reader_->ReadStripe(0, {"col1"}, {5}, &batch));
+  ASSERT_RAISES(Invalid, reader_->ReadStripe(0, {"col1"}, {2, 1}, &batch));
+}
+
+TEST_F(TestAdapterStatistics, ReadInParallel) {
+  std::shared_ptr<Table> serial, parallel;
+  ASSERT_OK(reader_->Read(&serial));
+  reader_->set_use_threads(true);
+  ASSERT_OK(reader_->Read(&parallel));
+  ASSERT_EQ(parallel->num_rows(), kStripeCount * kStripeRowCount);
+  AssertTablesEqual(*serial, *parallel);
+}
+
 }  // namespace arrow
@@ -35,6 +35,11 @@ namespace {
 template <typename StringArrayType>
 Status ValidateStringData(const StringArrayType& array) {
   util::InitializeUTF8();
+  if (array.length() == 0 ||
+      util::ValidateUTF8Offsets(array.raw_data(), array.raw_value_offsets(),
+                                array.length())) {
+    return Status::OK();
+  }
   for (int64_t i = 0; i < array.length(); ++i) {
     if (!array.IsNull(i) && !util::ValidateUTF8(array.GetView(i))) {
       return Status::Invalid("Invalid UTF8 sequence at string index ", i);
@@ -39,6 +39,7 @@
 #include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_decimal.h"
 #include "arrow/array/builder_dict.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/array/data.h"
 #include "arrow/array/util.h"
 #include "arrow/buffer.h"
@@ -210,6 +211,40 @@ TEST_F(TestArray, TestEquality) {
   ASSERT_FALSE(timestamp_us_array->RangeEquals(0, 1, 0, timestamp_ns_array));
 }
 
+TEST_F(TestArray, TestRangeEqualsRandom) {
+  // Ranges are compared by runs of non-null slots: check against the
+  // comparison of each slot
+  auto rag = random::RandomArrayGenerator(0x5eed);
+  for (const auto& type :
+       {boolean(), int8(), int32(), float64(), date32(), utf8(), large_binary(),
+        fixed_size_binary(3)}) {
+    for (double null_probability : {0.0, 0.2, 0.9}) {
+      SCOPED_TRACE(type->ToString());
+      auto array = rag.ArrayOf(type, 300, null_probability);
+      auto other = rag.ArrayOf(type, 300, null_probability);
+      // Differs from `array` at position 150 at most
+      ASSERT_OK_AND_ASSIGN(auto unequal_array,
+                           Concatenate({array->Slice(0, 150), other->Slice(150, 1),
+                                        array->Slice(151)},
+                                       pool_));
+      for (int64_t start : {0, 1, 100, 150, 151, 299}) {
+        for (int64_t end : {start, start + 1, int64_t(151), int64_t(300)}) {
+          if (end < start) continue;
+          bool expected = true;
+          for (int64_t i = start; i < end; ++i) {
+            expected = expected && array->RangeEquals(i, i + 1, i, unequal_array);
+          }
+          ASSERT_EQ(array->RangeEquals(start, end, start, unequal_array), expected);
+          ASSERT_EQ(array->Slice(start)->RangeEquals(0, end - start, 0,
+                                                     unequal_array->Slice(start)),
+                    expected);
+          ASSERT_TRUE(array->RangeEquals(start, end, start, array));
+        }
+      }
+    }
+  }
+}
+
 TEST_F(TestArray, TestNullArrayEquality) {
   auto array_1 = std::make_shared<NullArray>(10);
   auto array_2 = std::make_shared<NullArray>(10);
@@ -399,6 +434,91 @@ TEST_F(TestArray, TestMakeArrayOfNullUnion) {
   }
 }
 
+void CheckAppendArraySlice(const std::shared_ptr<Array>& array) {
+  SCOPED_TRACE(array->type()->ToString());
+  // A slice with non-zero offset, appended in two steps
+  auto sliced = array->Slice(1);
+  const int64_t half = sliced->length() / 2;
+  std::unique_ptr<ArrayBuilder> builder;
+  ASSERT_OK(MakeBuilder(default_memory_pool(), array->type(), &builder));
+  ASSERT_OK(builder->AppendArraySlice(*sliced->data(), 0, half));
+  ASSERT_OK(builder->AppendArraySlice(*sliced->data(), half, sliced->length() - half));
+  ASSERT_OK(builder->AppendArraySlice(*sliced->data(), 0, 0));
+  ASSERT_EQ(builder->length(), sliced->length());
+  ASSERT_OK_AND_ASSIGN(auto actual, builder->Finish());
+  ASSERT_OK(actual->ValidateFull());
+  AssertArraysEqual(*sliced, *actual, /*verbose=*/true);
+}
+
+TEST_F(TestArray, TestAppendArraySlice) {
+  auto rag = random::RandomArrayGenerator(0xdeadbeef);
+  std::shared_ptr<DataType> types[] = {
+      // clang-format off
+      boolean(),
+      int8(),
+      uint16(),
+      int32(),
+      uint64(),
+      float64(),
+      timestamp(TimeUnit::MILLI),
+      binary(),
+      large_binary(),
+      utf8(),
+      large_utf8(),
+      fixed_size_binary(3),
+      // clang-format on
+  };
+  for (const auto& type : types) {
+    for (double null_probability : {0.0, 0.3, 1.0}) {
+      CheckAppendArraySlice(rag.ArrayOf(type, 100, null_probability));
+    }
+  }
+
+  CheckAppendArraySlice(std::make_shared<NullArray>(10));
+  CheckAppendArraySlice(ArrayFromJSON(decimal(10, 2), R"(["1.23", null, "-4.56"])"));
+  CheckAppendArraySlice(
+      ArrayFromJSON(list(utf8()), R"([["a"], null, [], ["b", null, "c"], ["d"]])"));
+  CheckAppendArraySlice(
+      ArrayFromJSON(large_list(int32()), "[[1], [2, 3], null, [], [4, 5, 6]]"));
+  CheckAppendArraySlice(
+      ArrayFromJSON(fixed_size_list(int16(), 2), "[[1, 2], null, [3, null], [4, 5]]"));
+  CheckAppendArraySlice(ArrayFromJSON(map(utf8(), int32()),
+                                      R"([[["a", 1]], null, [["b", 2], ["c", null]],
+                                          [], [["d", 4]]])"));
+  CheckAppendArraySlice(
+      ArrayFromJSON(struct_({field("a", int32()), field("b", utf8())}),
+                    R"([{"a": 1, "b": "x"}, null, {"a": null, "b": "y"},
+                        {"a": 4, "b": null}, {"a": 5, "b": "z"}])"));
+  for (auto type : {sparse_union({field("a", int32()), field("b", utf8())}, {2, 5}),
+                    dense_union({field("a", int32()), field("b", utf8())}, {2, 5})}) {
+    CheckAppendArraySlice(
+        ArrayFromJSON(type, R"([[2, 1], [5, "x"], [2, null], [5, "y"], [2, 3]])"));
+  }
+  CheckAppendArraySlice(DictArrayFromJSON(dictionary(int8(), utf8()),
+                                          "[0, 1, null, 2, 1, 0]", R"(["a", "b", "c"])"));
+}
+
+TEST_F(TestArray, TestAppendArraySliceDictionary) {
+  // The dictionary of the appended arrays is merged into the builder's memo
+  StringDictionaryBuilder builder;
+  ASSERT_OK(builder.Append("z"));
+  auto first = DictArrayFromJSON(dictionary(int8(), utf8()), "[0, null, 1, 1]",
+                                 R"(["a", "z"])");
+  auto second = DictArrayFromJSON(dictionary(int32(), utf8()), "[1, 0, 0]",
+                                  R"(["b", null])");
+  ASSERT_OK(builder.AppendArraySlice(*first->data(), 1, 3));
+  ASSERT_OK(builder.AppendArraySlice(*second->data(), 0, 3));
+  // Dense arrays of the value type are accepted too
+  auto dense = ArrayFromJSON(utf8(), R"(["b", "c", null])");
+  ASSERT_OK(builder.AppendArraySlice(*dense->data(), 1, 2));
+  ASSERT_OK_AND_ASSIGN(auto actual, builder.Finish());
+  ASSERT_OK(actual->ValidateFull());
+  AssertArraysEqual(*DictArrayFromJSON(dictionary(int8(), utf8()),
+                                       "[0, null, 0, 0, null, 2, 2, 3, null]",
+                                       R"(["z", "a", "b", "c"])"),
+                    *actual, /*verbose=*/true);
+}
+
 TEST_F(TestArray, TestMakeArrayFromScalar) {
   ASSERT_OK_AND_ASSIGN(auto null_array, MakeArrayFromScalar(NullScalar(), 5));
   ASSERT_OK(null_array->ValidateFull());
@@ -593,6 +713,36 @@ TEST_F(TestBuilder, TestResizeDownsize) {
   ASSERT_EQ(500, builder.length());
 }
 
+TEST_F(TestBuilder, TestLazyNullBitmap) {
+  Int32Builder builder(pool_);
+
+  // No validity bitmap when all values are valid
+  ASSERT_OK(builder.AppendValues({1, 2, 3}));
+  ASSERT_OK(builder.AppendValues({4, 5}, std::vector<bool>{true, true}));
+  ASSERT_OK_AND_ASSIGN(auto array, builder.Finish());
+  ASSERT_OK(array->ValidateFull());
+  ASSERT_EQ(nullptr, array->null_bitmap());
+  ASSERT_EQ(0, array->null_count());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 2, 3, 4, 5]"), *array);
+
+  // The validity bitmap is allocated on the first null, with the preceding
+  // values valid
+  ASSERT_OK(builder.AppendValues({1, 2}));
+  ASSERT_OK(builder.AppendValues({3, 4, 5}, std::vector<bool>{true, false, true}));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.Append(7));
+  ASSERT_OK_AND_ASSIGN(array, builder.Finish());
+  ASSERT_OK(array->ValidateFull());
+  ASSERT_NE(nullptr, array->null_bitmap());
+  ASSERT_EQ(2, array->null_count());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 2, 3, null, 5, null, 7]"), *array);
+
+  // The builder starts over without a bitmap
+  ASSERT_OK(builder.Append(8));
+  ASSERT_OK_AND_ASSIGN(array, builder.Finish());
+  ASSERT_EQ(nullptr, array->null_bitmap());
+}
+
 template <typename Attrs>
 class TestPrimitiveBuilder : public TestBuilder {
  public:
@@ -1108,6 +1258,36 @@ TYPED_TEST(TestPrimitiveBuilder, TestAppendValues) {
   this->Check(this->builder_nn_, false);
 }
 
+TYPED_TEST(TestPrimitiveBuilder, TestAppendValuesBitmap) {
+  DECL_T();
+
+  int64_t size = 10000;
+  this->RandomData(size);
+
+  std::vector<T>& draws = this->draws_;
+  std::vector<uint8_t>& valid_bytes = this->valid_bytes_;
+
+  // The validity bitmap, with the first value at bit offset 3
+  const int64_t bitmap_offset = 3;
+  std::vector<uint8_t> bitmap(BitUtil::BytesForBits(size + bitmap_offset));
+  for (int64_t i = 0; i < size; ++i) {
+    BitUtil::SetBitTo(bitmap.data(), bitmap_offset + i, valid_bytes[i] != 0);
+  }
+
+  int64_t K = 1000;
+  ASSERT_OK(
+      this->builder_->AppendValues(draws.data(), K, bitmap.data(), bitmap_offset));
+  ASSERT_OK(this->builder_->AppendValues(draws.data() + K, size - K, bitmap.data(),
+                                         bitmap_offset + K));
+  ASSERT_OK(this->builder_nn_->AppendValues(draws.data(), size, nullptr, 0));
+
+  ASSERT_EQ(size, this->builder_->length());
+  ASSERT_EQ(size, this->builder_nn_->length());
+
+  this->Check(this->builder_, true);
+  this->Check(this->builder_nn_, false);
+}
+
 TYPED_TEST(TestPrimitiveBuilder, TestTypedFinish) {
   DECL_T();
 
@@ -1351,6 +1531,20 @@ TEST(TestBooleanBuilder, AppendNullsAdvanceBuilder) {
   ASSERT_TRUE(barr.Value(3));
 }
 
+TEST(TestBooleanBuilder, AppendValuesBitmap) {
+  BooleanBuilder builder;
+  const std::vector<uint8_t> values = {1, 0, 0, 1, 1};
+  // Bits 2 to 6 of 0b01101100 are 1, 1, 0, 1, 1
+  const uint8_t bitmap[] = {0x6c};
+  ASSERT_OK(builder.AppendValues(values.data(), 5, bitmap, /*bitmap_offset=*/2));
+  ASSERT_OK(builder.AppendValues(values.data(), 2, nullptr, 0));
+  ASSERT_OK_AND_ASSIGN(auto actual, builder.Finish());
+  ASSERT_OK(actual->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, false, null, true, true, true, "
+                                              "false]"),
+                    *actual, /*verbose=*/true);
+}
+
 TEST(TestBooleanBuilder, TestStdBoolVectorAppend) {
   BooleanBuilder builder;
   BooleanBuilder builder_nn;
@@ -17,7 +17,9 @@
 
 #include "arrow/array/builder_base.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 #include "arrow/array/array_base.h"
@@ -62,6 +64,9 @@ Status ArrayBuilder::TrimBuffer(const int64_t bytes_filled, ResizableBuffer* buf
 
 Status ArrayBuilder::AppendToBitmap(bool is_valid) {
   RETURN_NOT_OK(Reserve(1));
+  if (!is_valid) {
+    RETURN_NOT_OK(EnsureNullBitmap());
+  }
   UnsafeAppendToBitmap(is_valid);
   return Status::OK();
 }
@@ -74,13 +79,30 @@ Status ArrayBuilder::AppendToBitmap(const uint8_t* valid_bytes, int64_t length)
 
 Status ArrayBuilder::AppendToBitmap(int64_t num_bits, bool value) {
   RETURN_NOT_OK(Reserve(num_bits));
+  if (!value && num_bits > 0) {
+    RETURN_NOT_OK(EnsureNullBitmap());
+  }
   UnsafeAppendToBitmap(num_bits, value);
   return Status::OK();
 }
 
+Status ArrayBuilder::AppendToBitmap(const uint8_t* bitmap, int64_t offset,
+                                    int64_t length) {
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(bitmap, offset, length);
+  return Status::OK();
+}
+
+Status ArrayBuilder::AppendArraySlice(const ArrayData&, int64_t, int64_t) {
+  return Status::NotImplemented("AppendArraySlice for builder of type ", *type());
+}
+
 Status ArrayBuilder::Resize(int64_t capacity) {
   RETURN_NOT_OK(CheckCapacity(capacity));
   capacity_ = capacity;
+  if (!null_bitmap_allocated_) {
+    return Status::OK();
+  }
   return null_bitmap_builder_.Resize(capacity);
 }
 
@@ -89,9 +111,35 @@ Status ArrayBuilder::Advance(int64_t elements) {
     return Status::Invalid("Builder must be expanded");
   }
   length_ += elements;
+  if (!null_bitmap_allocated_) {
+    return Status::OK();
+  }
   return null_bitmap_builder_.Advance(elements);
 }
 
+Status ArrayBuilder::AllocateNullBitmap() {
+  DCHECK(!null_bitmap_allocated_);
+  RETURN_NOT_OK(null_bitmap_builder_.Resize(std::max(capacity_, length_)));
+  null_bitmap_builder_.UnsafeAppend(length_, true);
+  null_bitmap_allocated_ = true;
+  return Status::OK();
+}
+
+Status ArrayBuilder::FinishNullBitmap(std::shared_ptr<Buffer>* out) {
+  if (!null_bitmap_status_.ok()) {
+    return std::move(null_bitmap_status_);
+  }
+  if (null_count_ == 0) {
+    // All values are valid: no bitmap is needed
+    null_bitmap_builder_.Reset();
+    *out = nullptr;
+  } else {
+    RETURN_NOT_OK(null_bitmap_builder_.Finish(out));
+  }
+  null_bitmap_allocated_ = false;
+  return Status::OK();
+}
+
 Status ArrayBuilder::Finish(std::shared_ptr<Array>* out) {
   std::shared_ptr<ArrayData> internal_data;
   RETURN_NOT_OK(FinishInternal(&internal_data));
@@ -108,6 +156,8 @@ Result<std::shared_ptr<Array>> ArrayBuilder::Finish() {
 void ArrayBuilder::Reset() {
   capacity_ = length_ = null_count_ = 0;
   null_bitmap_builder_.Reset();
+  null_bitmap_allocated_ = false;
+  null_bitmap_status_ = Status::OK();
 }
 
 Status ArrayBuilder::SetNotNull(int64_t length) {
@@ -124,13 +174,17 @@ void ArrayBuilder::UnsafeAppendToBitmap(const std::vector<bool>& is_valid) {
 
 void ArrayBuilder::UnsafeSetNotNull(int64_t length) {
   length_ += length;
-  null_bitmap_builder_.UnsafeAppend(length, true);
+  if (null_bitmap_allocated_) {
+    null_bitmap_builder_.UnsafeAppend(length, true);
+  }
 }
 
 void ArrayBuilder::UnsafeSetNull(int64_t length) {
+  if (length > 0 && UnsafeEnsureNullBitmap()) {
+    null_bitmap_builder_.UnsafeAppend(length, false);
+  }
   length_ += length;
   null_count_ += length;
-  null_bitmap_builder_.UnsafeAppend(length, false);
 }
 
 }  // namespace arrow
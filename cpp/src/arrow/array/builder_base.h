@@ -100,6 +100,20 @@ class ARROW_EXPORT ArrayBuilder {
   virtual Status AppendNull() = 0;
   virtual Status AppendNulls(int64_t length) = 0;
 
+  /// \brief Append a range of values from an array
+  ///
+  /// The array must be of the builder's type.  Buffers are copied in bulk,
+  /// offsets being rebased on the data already appended, and child values
+  /// of nested arrays are appended by their own builders.
+  ///
+  /// \param[in] array the array data to append from
+  /// \param[in] offset the index of the first value to append, relative to
+  /// the offset of the array
+  /// \param[in] length the number of values to append
+  /// \return Status
+  virtual Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                                  int64_t length);
+
   /// For cases where raw data was memcpy'd into the internal buffers, allows us
   /// to advance the length of the builder. It is your responsibility to use
   /// this function responsibly.
@@ -141,6 +155,10 @@ class ARROW_EXPORT ArrayBuilder {
   /// Uniform append.  Append N times the same validity bit.
   Status AppendToBitmap(int64_t num_bits, bool value);
 
+  /// Bitmap append.  Append length bits of a validity bitmap, starting at
+  /// bit offset.  If bitmap is null assume all of length bits are valid.
+  Status AppendToBitmap(const uint8_t* bitmap, int64_t offset, int64_t length);
+
   /// Set the next length bits to not null (i.e. valid).
   Status SetNotNull(int64_t length);
 
@@ -150,20 +168,34 @@ class ARROW_EXPORT ArrayBuilder {
 
   // Append to null bitmap, update the length
   void UnsafeAppendToBitmap(bool is_valid) {
-    null_bitmap_builder_.UnsafeAppend(is_valid);
+    if (is_valid) {
+      if (null_bitmap_allocated_) {
+        null_bitmap_builder_.UnsafeAppend(true);
+      }
+    } else {
+      if (UnsafeEnsureNullBitmap()) {
+        null_bitmap_builder_.UnsafeAppend(false);
+      }
+      ++null_count_;
+    }
     ++length_;
-    if (!is_valid) ++null_count_;
   }
 
   // Vector append. Treat each zero byte as a nullzero. If valid_bytes is null
   // assume all of length bits are valid.
   void UnsafeAppendToBitmap(const uint8_t* valid_bytes, int64_t length) {
-    if (valid_bytes == NULLPTR) {
+    if (valid_bytes == NULLPTR ||
+        (!null_bitmap_allocated_ &&
+         std::find(valid_bytes, valid_bytes + length, 0) == valid_bytes + length)) {
       return UnsafeSetNotNull(length);
     }
-    null_bitmap_builder_.UnsafeAppend(valid_bytes, length);
+    if (UnsafeEnsureNullBitmap()) {
+      null_bitmap_builder_.UnsafeAppend(valid_bytes, length);
+      null_count_ = null_bitmap_builder_.false_count();
+    } else {
+      null_count_ += std::count(valid_bytes, valid_bytes + length, 0);
+    }
     length_ += length;
-    null_count_ = null_bitmap_builder_.false_count();
   }
 
   // Append the same validity value a given number of times.
@@ -175,6 +207,52 @@ class ARROW_EXPORT ArrayBuilder {
     }
   }
 
+  // Bitmap append, starting at bit offset. If bitmap is null assume all of
+  // length bits are valid.
+  void UnsafeAppendToBitmap(const uint8_t* bitmap, int64_t offset, int64_t length) {
+    if (bitmap == NULLPTR) {
+      return UnsafeSetNotNull(length);
+    }
+    if (!null_bitmap_allocated_) {
+      const int64_t num_nulls = length - internal::CountSetBits(bitmap, offset, length);
+      if (num_nulls == 0 || !UnsafeEnsureNullBitmap()) {
+        length_ += length;
+        null_count_ += num_nulls;
+        return;
+      }
+    }
+    null_bitmap_builder_.UnsafeAppend(bitmap, offset, length);
+    length_ += length;
+    null_count_ = null_bitmap_builder_.false_count();
+  }
+
+  // Append length validity bits returned by a generator
+  template <typename Generator>
+  void UnsafeAppendGeneratedToBitmap(int64_t length, Generator&& gen) {
+    if (!null_bitmap_allocated_) {
+      // Skip the leading valid bits, up to the first null
+      int64_t num_valid = 0;
+      while (num_valid < length && gen()) {
+        ++num_valid;
+      }
+      length_ += num_valid;
+      if (num_valid == length) {
+        return;
+      }
+      UnsafeSetNull(1);
+      length -= num_valid + 1;
+    }
+    if (null_bitmap_allocated_) {
+      null_bitmap_builder_.UnsafeAppend<true>(length, std::forward<Generator>(gen));
+      null_count_ = null_bitmap_builder_.false_count();
+    } else {
+      for (int64_t i = 0; i < length; ++i) {
+        null_count_ += !gen();
+      }
+    }
+    length_ += length;
+  }
+
   void UnsafeAppendToBitmap(const std::vector<bool>& is_valid);
 
   // Set the next validity bits to not null (i.e. valid).
@@ -183,6 +261,27 @@ class ARROW_EXPORT ArrayBuilder {
   // Set the next validity bits to null (i.e. invalid).
   void UnsafeSetNull(int64_t length);
 
+  // The null bitmap is only allocated when the first null is appended: until
+  // then, all values appended are valid and no validity bit is written.
+  // Allocate it, if not done yet, with the validity bits of the values
+  // appended so far.
+  Status EnsureNullBitmap() {
+    return null_bitmap_allocated_ ? Status::OK() : AllocateNullBitmap();
+  }
+
+  // Same as above from an unsafe append, which has no status to return: an
+  // allocation failure is reported by FinishNullBitmap().  Return whether
+  // the null bitmap can be appended to.
+  bool UnsafeEnsureNullBitmap() {
+    if (ARROW_PREDICT_FALSE(!null_bitmap_allocated_)) {
+      null_bitmap_status_ &= AllocateNullBitmap();
+    }
+    return null_bitmap_allocated_;
+  }
+
+  /// \brief Finish the null bitmap, or return null if all values are valid
+  Status FinishNullBitmap(std::shared_ptr<Buffer>* out);
+
   static Status TrimBuffer(const int64_t bytes_filled, ResizableBuffer* buffer);
 
   /// \brief Finish to an array of the specified ArrayType
@@ -218,6 +317,9 @@ class ARROW_EXPORT ArrayBuilder {
   MemoryPool* pool_;
 
   TypedBufferBuilder<bool> null_bitmap_builder_;
+  // Whether null_bitmap_builder_ holds the validity of the values appended
+  bool null_bitmap_allocated_ = false;
+  Status null_bitmap_status_;
   int64_t null_count_ = 0;
 
   // Array length, so far. Also, the index of the next element to be added
@@ -228,6 +330,8 @@ class ARROW_EXPORT ArrayBuilder {
   std::vector<std::shared_ptr<ArrayBuilder>> children_;
 
  private:
+  Status AllocateNullBitmap();
+
   ARROW_DISALLOW_COPY_AND_ASSIGN(ArrayBuilder);
 };
 
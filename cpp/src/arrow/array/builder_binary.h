@@ -224,6 +224,30 @@ class BaseBinaryBuilder : public ArrayBuilder {
     return Status::OK();
   }
 
+  /// \brief Append a range of values from a binary array of the same type
+  ///
+  /// Offsets are rebased on the data already appended and the value data is
+  /// copied in one block.
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override {
+    const offset_type* offsets = array.GetValues<offset_type>(1) + offset;
+    const offset_type first_offset = length > 0 ? offsets[0] : 0;
+    const int64_t num_bytes = length > 0 ? offsets[length] - first_offset : 0;
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    ARROW_RETURN_NOT_OK(ReserveData(num_bytes));
+    const auto adjustment =
+        static_cast<offset_type>(value_data_builder_.length() - first_offset);
+    for (int64_t i = 0; i < length; ++i) {
+      offsets_builder_.UnsafeAppend(static_cast<offset_type>(offsets[i] + adjustment));
+    }
+    if (num_bytes > 0) {
+      value_data_builder_.UnsafeAppend(array.GetValues<uint8_t>(2, first_offset),
+                                       num_bytes);
+    }
+    UnsafeAppendToBitmap(array.GetValues<uint8_t>(0, 0), array.offset + offset, length);
+    return Status::OK();
+  }
+
   void Reset() override {
     ArrayBuilder::Reset();
     offsets_builder_.Reset();
@@ -269,7 +293,7 @@ class BaseBinaryBuilder : public ArrayBuilder {
     std::shared_ptr<Buffer> offsets, value_data, null_bitmap;
     ARROW_RETURN_NOT_OK(offsets_builder_.Finish(&offsets));
     ARROW_RETURN_NOT_OK(value_data_builder_.Finish(&value_data));
-    ARROW_RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+    ARROW_RETURN_NOT_OK(FinishNullBitmap(&null_bitmap));
 
     *out = ArrayData::Make(type(), length_, {null_bitmap, offsets, value_data},
                            null_count_, 0);
@@ -436,6 +460,9 @@ class ARROW_EXPORT FixedSizeBinaryBuilder : public ArrayBuilder {
   Status AppendValues(const uint8_t* data, int64_t length,
                       const uint8_t* valid_bytes = NULLPTR);
 
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override;
+
   Status AppendNull() final;
 
   Status AppendNulls(int64_t length) final;
@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <memory>
 #include <type_traits>
+#include <vector>
 
 #include "arrow/array/array_base.h"
 #include "arrow/array/array_binary.h"
@@ -32,6 +33,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/macros.h"
@@ -64,6 +66,16 @@ struct DictionaryValue<T, enable_if_fixed_size_binary<T>> {
   using PhysicalType = BinaryType;
 };
 
+// Whether DictionaryMemoTable can look up values of type T
+template <typename T>
+struct DictionaryValueIsMemoizable
+    : std::integral_constant<bool, is_boolean_type<T>::value ||
+                                       is_integer_type<T>::value ||
+                                       std::is_same<T, FloatType>::value ||
+                                       std::is_same<T, DoubleType>::value ||
+                                       is_base_binary_type<T>::value ||
+                                       is_fixed_size_binary_type<T>::value> {};
+
 class ARROW_EXPORT DictionaryMemoTable {
  public:
   DictionaryMemoTable(MemoryPool* pool, const std::shared_ptr<DataType>& type);
@@ -310,6 +322,16 @@ class DictionaryBuilderBase : public ArrayBuilder {
     return Status::OK();
   }
 
+  /// \brief Append a range of values from a dense array of the value type,
+  /// or from a dictionary array of the value type
+  ///
+  /// The dictionary of a dictionary array is inserted in the memo once, then
+  /// the indices are appended after transposition to the memo indices.
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override {
+    return AppendArraySliceImpl<T>(array, offset, length);
+  }
+
   void Reset() override {
     // Perform a partial reset. Call ResetFull to also reset the accumulated
     // dictionary values
@@ -380,6 +402,73 @@ class DictionaryBuilderBase : public ArrayBuilder {
     return Status::OK();
   }
 
+  template <typename T1>
+  enable_if_t<!DictionaryValueIsMemoizable<T1>::value, Status> AppendArraySliceImpl(
+      const ArrayData& array, int64_t offset, int64_t length) {
+    return ArrayBuilder::AppendArraySlice(array, offset, length);
+  }
+
+  template <typename T1>
+  enable_if_t<DictionaryValueIsMemoizable<T1>::value, Status> AppendArraySliceImpl(
+      const ArrayData& array, int64_t offset, int64_t length) {
+    if (array.type->id() != Type::DICTIONARY) {
+      return AppendArray(*MakeArray(array.Slice(offset, length)));
+    }
+    using ArrayType = typename TypeTraits<T1>::ArrayType;
+    const auto dictionary = MakeArray(array.dictionary);
+    const auto& dictionary_values = static_cast<const ArrayType&>(*dictionary);
+    // The memo index of each dictionary value, -1 for nulls
+    std::vector<int32_t> memo_indices(static_cast<size_t>(dictionary->length()), -1);
+    for (int64_t i = 0; i < dictionary->length(); ++i) {
+      if (dictionary->IsValid(i)) {
+        ARROW_RETURN_NOT_OK(
+            memo_table_->GetOrInsert<T1>(dictionary_values.GetView(i), &memo_indices[i]));
+      }
+    }
+    const int32_t* memo = memo_indices.data();
+    const auto& dict_type = checked_cast<const DictionaryType&>(*array.type);
+    switch (dict_type.index_type()->id()) {
+      case Type::INT8:
+        return AppendTransposedIndices<int8_t>(array, offset, length, memo);
+      case Type::UINT8:
+        return AppendTransposedIndices<uint8_t>(array, offset, length, memo);
+      case Type::INT16:
+        return AppendTransposedIndices<int16_t>(array, offset, length, memo);
+      case Type::UINT16:
+        return AppendTransposedIndices<uint16_t>(array, offset, length, memo);
+      case Type::INT32:
+        return AppendTransposedIndices<int32_t>(array, offset, length, memo);
+      case Type::UINT32:
+        return AppendTransposedIndices<uint32_t>(array, offset, length, memo);
+      case Type::INT64:
+        return AppendTransposedIndices<int64_t>(array, offset, length, memo);
+      case Type::UINT64:
+        return AppendTransposedIndices<uint64_t>(array, offset, length, memo);
+      default:
+        return Status::TypeError("Invalid index type: ", *dict_type.index_type());
+    }
+  }
+
+  template <typename IndexCType>
+  Status AppendTransposedIndices(const ArrayData& array, int64_t offset, int64_t length,
+                                 const int32_t* memo_indices) {
+    const IndexCType* indices = array.GetValues<IndexCType>(1) + offset;
+    const uint8_t* bitmap = array.GetValues<uint8_t>(0, 0);
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    for (int64_t i = 0; i < length; ++i) {
+      const bool is_valid =
+          bitmap == NULLPTR || BitUtil::GetBit(bitmap, array.offset + offset + i);
+      if (is_valid && memo_indices[indices[i]] >= 0) {
+        ARROW_RETURN_NOT_OK(indices_builder_.Append(memo_indices[indices[i]]));
+      } else {
+        ARROW_RETURN_NOT_OK(indices_builder_.AppendNull());
+        ++null_count_;
+      }
+    }
+    length_ += length;
+    return Status::OK();
+  }
+
   std::unique_ptr<DictionaryMemoTable> memo_table_;
 
   // The size of the dictionary memo at last invocation of Finish, to use in
@@ -437,6 +526,10 @@ class DictionaryBuilderBase<BuilderType, NullType> : public ArrayBuilder {
     return indices_builder_.AppendNulls(length);
   }
 
+  Status AppendArraySlice(const ArrayData&, int64_t, int64_t length) override {
+    return AppendNulls(length);
+  }
+
   /// \brief Append a whole dense array to the builder
   Status AppendArray(const Array& array) {
 #ifndef NDEBUG
@@ -97,6 +97,16 @@ Status MapBuilder::AppendValues(const int32_t* offsets, int64_t length,
   return Status::OK();
 }
 
+Status MapBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                    int64_t length) {
+  DCHECK_EQ(item_builder_->length(), key_builder_->length());
+  RETURN_NOT_OK(AdjustStructBuilderLength());
+  RETURN_NOT_OK(list_builder_->AppendArraySlice(array, offset, length));
+  length_ = list_builder_->length();
+  null_count_ = list_builder_->null_count();
+  return Status::OK();
+}
+
 Status MapBuilder::Append() {
   DCHECK_EQ(item_builder_->length(), key_builder_->length());
   RETURN_NOT_OK(AdjustStructBuilderLength());
@@ -170,6 +180,15 @@ Status FixedSizeListBuilder::AppendValues(int64_t length, const uint8_t* valid_b
   return Status::OK();
 }
 
+Status FixedSizeListBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                              int64_t length) {
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(array.GetValues<uint8_t>(0, 0), array.offset + offset, length);
+  return value_builder_->AppendArraySlice(*array.child_data[0],
+                                          (array.offset + offset) * list_size_,
+                                          length * list_size_);
+}
+
 Status FixedSizeListBuilder::AppendNull() {
   RETURN_NOT_OK(Reserve(1));
   UnsafeAppendToBitmap(false);
@@ -210,7 +229,7 @@ Status FixedSizeListBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   RETURN_NOT_OK(value_builder_->FinishInternal(&items));
 
   std::shared_ptr<Buffer> null_bitmap;
-  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+  RETURN_NOT_OK(FinishNullBitmap(&null_bitmap));
   *out = ArrayData::Make(type(), length_, {null_bitmap}, {std::move(items)}, null_count_);
   Reset();
   return Status::OK();
@@ -241,9 +260,20 @@ Status StructBuilder::AppendNulls(int64_t length) {
   return Status::OK();
 }
 
+Status StructBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                       int64_t length) {
+  for (size_t i = 0; i < children_.size(); ++i) {
+    RETURN_NOT_OK(children_[i]->AppendArraySlice(*array.child_data[i],
+                                                 array.offset + offset, length));
+  }
+  RETURN_NOT_OK(Reserve(length));
+  UnsafeAppendToBitmap(array.GetValues<uint8_t>(0, 0), array.offset + offset, length);
+  return Status::OK();
+}
+
 Status StructBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   std::shared_ptr<Buffer> null_bitmap;
-  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+  RETURN_NOT_OK(FinishNullBitmap(&null_bitmap));
 
   std::vector<std::shared_ptr<ArrayData>> child_data(children_.size());
   for (size_t i = 0; i < children_.size(); ++i) {
@@ -86,6 +86,27 @@ class BaseListBuilder : public ArrayBuilder {
     return Status::OK();
   }
 
+  /// \brief Append a range of lists from a list array of the same type
+  ///
+  /// Offsets are rebased on the values already appended, and the values
+  /// spanned by the lists are appended to the value builder.
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override {
+    const offset_type* offsets = array.GetValues<offset_type>(1) + offset;
+    const offset_type first_offset = length > 0 ? offsets[0] : 0;
+    const int64_t num_values = length > 0 ? offsets[length] - first_offset : 0;
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    ARROW_RETURN_NOT_OK(ValidateOverflow(num_values));
+    const auto adjustment =
+        static_cast<offset_type>(value_builder_->length() - first_offset);
+    for (int64_t i = 0; i < length; ++i) {
+      offsets_builder_.UnsafeAppend(static_cast<offset_type>(offsets[i] + adjustment));
+    }
+    UnsafeAppendToBitmap(array.GetValues<uint8_t>(0, 0), array.offset + offset, length);
+    return value_builder_->AppendArraySlice(*array.child_data[0], first_offset,
+                                            num_values);
+  }
+
   /// \brief Start a new variable-length list slot
   ///
   /// This function should be called before beginning to append elements to the
@@ -115,7 +136,7 @@ class BaseListBuilder : public ArrayBuilder {
     // Offset padding zeroed by BufferBuilder
     std::shared_ptr<Buffer> offsets, null_bitmap;
     ARROW_RETURN_NOT_OK(offsets_builder_.Finish(&offsets));
-    ARROW_RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+    ARROW_RETURN_NOT_OK(FinishNullBitmap(&null_bitmap));
 
     if (value_builder_->length() == 0) {
       // Try to make sure we get a non-null values buffer (ARROW-2744)
@@ -248,6 +269,9 @@ class ARROW_EXPORT MapBuilder : public ArrayBuilder {
   Status AppendValues(const int32_t* offsets, int64_t length,
                       const uint8_t* valid_bytes = NULLPTR);
 
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override;
+
   /// \brief Start a new variable-length map slot
   ///
   /// This function should be called before beginning to append elements to the
@@ -339,6 +363,11 @@ class ARROW_EXPORT FixedSizeListBuilder : public ArrayBuilder {
   /// XXX this restriction is confusing, should this method be omitted?
   Status AppendValues(int64_t length, const uint8_t* valid_bytes = NULLPTR);
 
+  /// \brief Append a range of lists from a fixed size list array of the same
+  /// type, along with their values
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override;
+
   /// \brief Append a null fixed length list.
   ///
   /// The child array builder will have the appropriate number of nulls appended
@@ -423,6 +452,11 @@ class ARROW_EXPORT StructBuilder : public ArrayBuilder {
   /// child builder.
   Status AppendNulls(int64_t length) final;
 
+  /// \brief Append a range of values from a struct array of the same type.
+  /// Automatically appends the fields to each child builder.
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override;
+
   void Reset() override;
 
   ArrayBuilder* field_builder(int i) const { return children_[i].get(); }
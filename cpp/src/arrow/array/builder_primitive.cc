@@ -66,7 +66,7 @@ Status BooleanBuilder::Resize(int64_t capacity) {
 
 Status BooleanBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   std::shared_ptr<Buffer> null_bitmap, data;
-  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+  RETURN_NOT_OK(FinishNullBitmap(&null_bitmap));
   RETURN_NOT_OK(data_builder_.Finish(&data));
 
   *out = ArrayData::Make(boolean(), length_, {null_bitmap, data}, null_count_);
@@ -97,6 +97,16 @@ Status BooleanBuilder::AppendValues(const uint8_t* values, int64_t length,
   return Status::OK();
 }
 
+Status BooleanBuilder::AppendValues(const uint8_t* values, int64_t length,
+                                    const uint8_t* bitmap, int64_t bitmap_offset) {
+  RETURN_NOT_OK(Reserve(length));
+  int64_t i = 0;
+  data_builder_.UnsafeAppend<false>(length,
+                                    [values, &i]() -> bool { return values[i++] != 0; });
+  ArrayBuilder::UnsafeAppendToBitmap(bitmap, bitmap_offset, length);
+  return Status::OK();
+}
+
 Status BooleanBuilder::AppendValues(const std::vector<uint8_t>& values,
                                     const std::vector<bool>& is_valid) {
   return AppendValues(values.data(), static_cast<int64_t>(values.size()), is_valid);
@@ -135,4 +145,14 @@ Status BooleanBuilder::AppendValues(int64_t length, bool value) {
   return Status::OK();
 }
 
+Status BooleanBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                        int64_t length) {
+  RETURN_NOT_OK(Reserve(length));
+  data_builder_.UnsafeAppend(array.GetValues<uint8_t>(1, 0), array.offset + offset,
+                             length);
+  ArrayBuilder::UnsafeAppendToBitmap(array.GetValues<uint8_t>(0, 0),
+                                     array.offset + offset, length);
+  return Status::OK();
+}
+
 }  // namespace arrow
@@ -48,6 +48,10 @@ class ARROW_EXPORT NullBuilder : public ArrayBuilder {
 
   Status Append(std::nullptr_t) { return AppendNull(); }
 
+  Status AppendArraySlice(const ArrayData&, int64_t, int64_t length) override {
+    return AppendNulls(length);
+  }
+
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
 
   /// \cond FALSE
@@ -132,6 +136,22 @@ class NumericBuilder : public ArrayBuilder {
     return Status::OK();
   }
 
+  /// \brief Append a sequence of elements in one shot
+  /// \param[in] values a contiguous C array of values
+  /// \param[in] length the number of values to append
+  /// \param[in] bitmap a validity bitmap of at least bitmap_offset + length
+  /// bits, or null if all values are valid
+  /// \param[in] bitmap_offset the bit offset of the first value in bitmap
+  /// \return Status
+  Status AppendValues(const value_type* values, int64_t length, const uint8_t* bitmap,
+                      int64_t bitmap_offset) {
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    data_builder_.UnsafeAppend(values, length);
+    // length_ is update by these
+    ArrayBuilder::UnsafeAppendToBitmap(bitmap, bitmap_offset, length);
+    return Status::OK();
+  }
+
   /// \brief Append a sequence of elements in one shot
   /// \param[in] values a contiguous C array of values
   /// \param[in] length the number of values to append
@@ -164,9 +184,15 @@ class NumericBuilder : public ArrayBuilder {
     return AppendValues(values.data(), static_cast<int64_t>(values.size()));
   }
 
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override {
+    return AppendValues(array.GetValues<value_type>(1) + offset, length,
+                        array.GetValues<uint8_t>(0, 0), array.offset + offset);
+  }
+
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override {
     std::shared_ptr<Buffer> data, null_bitmap;
-    ARROW_RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+    ARROW_RETURN_NOT_OK(FinishNullBitmap(&null_bitmap));
     ARROW_RETURN_NOT_OK(data_builder_.Finish(&data));
     *out = ArrayData::Make(type(), length_, {null_bitmap, data}, null_count_);
     capacity_ = length_ = null_count_ = 0;
@@ -208,10 +234,8 @@ class NumericBuilder : public ArrayBuilder {
     int64_t length = static_cast<int64_t>(std::distance(values_begin, values_end));
     ARROW_RETURN_NOT_OK(Reserve(length));
     data_builder_.UnsafeAppend(values_begin, values_end);
-    null_bitmap_builder_.UnsafeAppend<true>(
-        length, [&valid_begin]() -> bool { return *valid_begin++; });
-    length_ = null_bitmap_builder_.length();
-    null_count_ = null_bitmap_builder_.false_count();
+    UnsafeAppendGeneratedToBitmap(length,
+                                  [&valid_begin]() -> bool { return *valid_begin++; });
     return Status::OK();
   }
 
@@ -226,10 +250,8 @@ class NumericBuilder : public ArrayBuilder {
     if (valid_begin == NULLPTR) {
       UnsafeSetNotNull(length);
     } else {
-      null_bitmap_builder_.UnsafeAppend<true>(
+      UnsafeAppendGeneratedToBitmap(
           length, [&valid_begin]() -> bool { return *valid_begin++; });
-      length_ = null_bitmap_builder_.length();
-      null_count_ = null_bitmap_builder_.false_count();
     }
 
     return Status::OK();
@@ -337,6 +359,16 @@ class ARROW_EXPORT BooleanBuilder : public ArrayBuilder {
   Status AppendValues(const uint8_t* values, int64_t length,
                       const std::vector<bool>& is_valid);
 
+  /// \brief Append a sequence of elements in one shot
+  /// \param[in] values a contiguous array of bytes (non-zero is 1)
+  /// \param[in] length the number of values to append
+  /// \param[in] bitmap a validity bitmap of at least bitmap_offset + length
+  /// bits, or null if all values are valid
+  /// \param[in] bitmap_offset the bit offset of the first value in bitmap
+  /// \return Status
+  Status AppendValues(const uint8_t* values, int64_t length, const uint8_t* bitmap,
+                      int64_t bitmap_offset);
+
   /// \brief Append a sequence of elements in one shot
   /// \param[in] values a std::vector of bytes
   /// \param[in] is_valid an std::vector<bool> indicating valid (1) or null
@@ -395,10 +427,8 @@ class ARROW_EXPORT BooleanBuilder : public ArrayBuilder {
 
     data_builder_.UnsafeAppend<false>(
         length, [&values_begin]() -> bool { return *values_begin++; });
-    null_bitmap_builder_.UnsafeAppend<true>(
-        length, [&valid_begin]() -> bool { return *valid_begin++; });
-    length_ = null_bitmap_builder_.length();
-    null_count_ = null_bitmap_builder_.false_count();
+    UnsafeAppendGeneratedToBitmap(length,
+                                  [&valid_begin]() -> bool { return *valid_begin++; });
     return Status::OK();
   }
 
@@ -414,16 +444,17 @@ class ARROW_EXPORT BooleanBuilder : public ArrayBuilder {
     if (valid_begin == NULLPTR) {
       UnsafeSetNotNull(length);
     } else {
-      null_bitmap_builder_.UnsafeAppend<true>(
+      UnsafeAppendGeneratedToBitmap(
           length, [&valid_begin]() -> bool { return *valid_begin++; });
     }
-    length_ = null_bitmap_builder_.length();
-    null_count_ = null_bitmap_builder_.false_count();
     return Status::OK();
   }
 
   Status AppendValues(int64_t length, bool value);
 
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override;
+
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
 
   /// \cond FALSE
@@ -17,8 +17,11 @@
 
 #include "arrow/array/builder_union.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <limits>
 #include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/util/checked_cast.h"
@@ -52,6 +55,57 @@ Status DenseUnionBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   return Status::OK();
 }
 
+Status DenseUnionBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                           int64_t length) {
+  const auto& union_type = checked_cast<const UnionType&>(*array.type);
+  const int8_t* types = array.GetValues<int8_t>(1) + offset;
+  const int32_t* offsets = array.GetValues<int32_t>(2) + offset;
+
+  // The range of child values referenced by the slice, for each type code
+  const size_t num_codes = union_type.max_type_code() + 1;
+  std::vector<int32_t> min_offsets(num_codes, std::numeric_limits<int32_t>::max());
+  std::vector<int32_t> max_offsets(num_codes, -1);
+  for (int64_t i = 0; i < length; ++i) {
+    min_offsets[types[i]] = std::min(min_offsets[types[i]], offsets[i]);
+    max_offsets[types[i]] = std::max(max_offsets[types[i]], offsets[i]);
+  }
+
+  // Append the child ranges, then the offsets rebased on them
+  std::vector<int64_t> adjustments(num_codes, 0);
+  for (size_t code = 0; code < num_codes; ++code) {
+    if (max_offsets[code] < 0) continue;
+    ArrayBuilder* child_builder = type_id_to_children_[code];
+    const int64_t num_values = max_offsets[code] - min_offsets[code] + 1;
+    if (child_builder->length() + num_values > kListMaximumElements) {
+      return Status::CapacityError(
+          "a dense UnionArray cannot contain more than 2^31 - 1 elements from a single "
+          "child");
+    }
+    adjustments[code] = child_builder->length() - min_offsets[code];
+    const auto& child_data = *array.child_data[union_type.child_ids()[code]];
+    RETURN_NOT_OK(
+        child_builder->AppendArraySlice(child_data, min_offsets[code], num_values));
+  }
+  RETURN_NOT_OK(types_builder_.Append(types, length));
+  RETURN_NOT_OK(offsets_builder_.Reserve(length));
+  for (int64_t i = 0; i < length; ++i) {
+    offsets_builder_.UnsafeAppend(
+        static_cast<int32_t>(offsets[i] + adjustments[types[i]]));
+  }
+  return Status::OK();
+}
+
+Status SparseUnionBuilder::AppendArraySlice(const ArrayData& array, int64_t offset,
+                                            int64_t length) {
+  const auto& union_type = checked_cast<const UnionType&>(*array.type);
+  for (size_t i = 0; i < type_codes_.size(); ++i) {
+    const int8_t code = type_codes_[i];
+    RETURN_NOT_OK(type_id_to_children_[code]->AppendArraySlice(
+        *array.child_data[union_type.child_ids()[code]], array.offset + offset, length));
+  }
+  return types_builder_.Append(array.GetValues<int8_t>(1) + offset, length);
+}
+
 BasicUnionBuilder::BasicUnionBuilder(
     MemoryPool* pool, const std::vector<std::shared_ptr<ArrayBuilder>>& children,
     const std::shared_ptr<DataType>& type)
@@ -135,6 +135,11 @@ class ARROW_EXPORT DenseUnionBuilder : public BasicUnionBuilder {
     return offsets_builder_.Append(offset);
   }
 
+  /// \brief Append a range of values from a dense union array of the same
+  /// type, along with the child values they reference
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override;
+
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
 
  private:
@@ -188,6 +193,11 @@ class ARROW_EXPORT SparseUnionBuilder : public BasicUnionBuilder {
   /// The corresponding child builder must be appended to independently after this method
   /// is called, and all other child builders must have null appended
   Status Append(int8_t next_type) { return types_builder_.Append(next_type); }
+
+  /// \brief Append a range of values from a sparse union array of the same
+  /// type.  The range is appended to all the children.
+  Status AppendArraySlice(const ArrayData& array, int64_t offset,
+                          int64_t length) override;
 };
 
 }  // namespace arrow
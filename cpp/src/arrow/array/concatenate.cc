@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -35,9 +36,13 @@
 #include "arrow/type_fwd.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
+#include "arrow/util/bitmap_reader.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/int_util.h"
 #include "arrow/util/int_util_internal.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -65,6 +70,76 @@ struct Bitmap {
   bool AllSet() const { return data == nullptr; }
 };
 
+// Total size above which buffers are copied on several threads
+static constexpr int64_t kParallelCopyThreshold = 1 << 22;
+// Minimum number of bytes copied by each thread
+static constexpr int64_t kParallelCopyBlockSize = 1 << 20;
+
+// Allocate a buffer of the exact total size and copy buffers into it.
+// Above kParallelCopyThreshold, the output is split in equal blocks copied
+// in parallel on the CPU thread pool, unless we're already running on it
+// (waiting for the blocks there could starve the pool).
+static Result<std::shared_ptr<Buffer>> ConcatenateBuffersParallel(
+    const BufferVector& buffers, MemoryPool* pool) {
+  int64_t out_length = 0;
+  for (const auto& buffer : buffers) {
+    out_length += buffer->size();
+  }
+  auto thread_pool = internal::GetCpuThreadPool();
+  const int num_blocks = static_cast<int>(
+      std::min<int64_t>(thread_pool->GetCapacity(), out_length / kParallelCopyBlockSize));
+  if (out_length < kParallelCopyThreshold || num_blocks < 2 ||
+      thread_pool->OwnsThisThread()) {
+    return ConcatenateBuffers(buffers, pool);
+  }
+
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> out, AllocateBuffer(out_length, pool));
+  uint8_t* out_data = out->mutable_data();
+  // The start position of each buffer in the output
+  std::vector<int64_t> positions(buffers.size() + 1, 0);
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    positions[i + 1] = positions[i] + buffers[i]->size();
+  }
+
+  const int64_t block_size = BitUtil::CeilDiv(out_length, num_blocks);
+  RETURN_NOT_OK(internal::ParallelFor(num_blocks, [&](int block) {
+    const int64_t block_start = block * block_size;
+    const int64_t block_end = std::min(block_start + block_size, out_length);
+    // Copy the part of each buffer overlapping [block_start, block_end)
+    auto it = std::upper_bound(positions.begin(), positions.end(), block_start);
+    for (size_t i = it - positions.begin() - 1;
+         i < buffers.size() && positions[i] < block_end; ++i) {
+      const int64_t start = std::max(positions[i], block_start);
+      const int64_t end = std::min(positions[i + 1], block_end);
+      if (end > start) {
+        std::memcpy(out_data + start, buffers[i]->data() + (start - positions[i]),
+                    end - start);
+      }
+    }
+    return Status::OK();
+  }));
+  return std::move(out);
+}
+
+// Transpose the indices of a dictionary array into dst with the given
+// transpose map.  Null slots, whose indices can be garbage, are zeroed.
+template <typename IndexType>
+static void TransposeIndices(const ArrayData& in, const int32_t* transpose_map,
+                             uint8_t* dst) {
+  using c_type = typename IndexType::c_type;
+  const c_type* src = in.GetValues<c_type>(1);
+  auto out = reinterpret_cast<c_type*>(dst);
+  if (in.GetNullCount() == 0) {
+    internal::TransposeInts(src, out, in.length, transpose_map);
+    return;
+  }
+  internal::BitmapReader valid(in.buffers[0]->data(), in.offset, in.length);
+  for (int64_t i = 0; i < in.length; ++i) {
+    out[i] = valid.IsSet() ? static_cast<c_type>(transpose_map[src[i]]) : 0;
+    valid.Next();
+  }
+}
+
 // Allocate a buffer and concatenate bitmaps into it.
 static Status ConcatenateBitmaps(const std::vector<Bitmap>& bitmaps, MemoryPool* pool,
                                  std::shared_ptr<Buffer>* out) {
@@ -203,7 +278,7 @@ class ConcatenateImpl {
   Status Visit(const FixedWidthType& fixed) {
     // Handles numbers, decimal128, fixed_size_binary
     ARROW_ASSIGN_OR_RAISE(auto buffers, Buffers(1, fixed));
-    return ConcatenateBuffers(buffers, pool_).Value(&out_->buffers[1]);
+    return ConcatenateBuffersParallel(buffers, pool_).Value(&out_->buffers[1]);
   }
 
   Status Visit(const BinaryType&) {
@@ -212,7 +287,7 @@ class ConcatenateImpl {
     RETURN_NOT_OK(ConcatenateOffsets<int32_t>(index_buffers, pool_, &out_->buffers[1],
                                               &value_ranges));
     ARROW_ASSIGN_OR_RAISE(auto value_buffers, Buffers(2, value_ranges));
-    return ConcatenateBuffers(value_buffers, pool_).Value(&out_->buffers[2]);
+    return ConcatenateBuffersParallel(value_buffers, pool_).Value(&out_->buffers[2]);
   }
 
   Status Visit(const LargeBinaryType&) {
@@ -221,7 +296,7 @@ class ConcatenateImpl {
     RETURN_NOT_OK(ConcatenateOffsets<int64_t>(index_buffers, pool_, &out_->buffers[1],
                                               &value_ranges));
     ARROW_ASSIGN_OR_RAISE(auto value_buffers, Buffers(2, value_ranges));
-    return ConcatenateBuffers(value_buffers, pool_).Value(&out_->buffers[2]);
+    return ConcatenateBuffersParallel(value_buffers, pool_).Value(&out_->buffers[2]);
   }
 
   Status Visit(const ListType&) {
@@ -272,10 +347,72 @@ class ConcatenateImpl {
     if (dictionaries_same) {
       out_->dictionary = in_[0]->dictionary;
       ARROW_ASSIGN_OR_RAISE(auto index_buffers, Buffers(1, *fixed));
-      return ConcatenateBuffers(index_buffers, pool_).Value(&out_->buffers[1]);
-    } else {
-      return Status::NotImplemented("Concat with dictionary unification NYI");
+      return ConcatenateBuffersParallel(index_buffers, pool_).Value(&out_->buffers[1]);
+    }
+    return UnifyDictionaries(d);
+  }
+
+  // Unify the dictionaries of the inputs, then transpose their indices
+  // straight into the output index buffer.  The output keeps the input
+  // index type, so the unified dictionary has to fit in it.
+  Status UnifyDictionaries(const DictionaryType& d) {
+    ARROW_ASSIGN_OR_RAISE(auto unifier, DictionaryUnifier::Make(d.value_type(), pool_));
+    std::vector<std::shared_ptr<Buffer>> transpose_maps(in_.size());
+    for (size_t i = 0; i < in_.size(); ++i) {
+      RETURN_NOT_OK(unifier->Unify(*MakeArray(in_[i]->dictionary), &transpose_maps[i]));
+    }
+    std::shared_ptr<DataType> unified_type;
+    std::shared_ptr<Array> dictionary;
+    RETURN_NOT_OK(unifier->GetResult(&unified_type, &dictionary));
+    const auto& index_type =
+        internal::checked_cast<const FixedWidthType&>(*d.index_type());
+    // Number of bits available to the (non-negative) index values
+    const int value_bits =
+        index_type.bit_width() - (is_signed_integer(index_type.id()) ? 1 : 0);
+    if (value_bits < 63 && dictionary->length() > (int64_t(1) << value_bits)) {
+      return Status::Invalid("Unified dictionary of ", dictionary->length(),
+                             " values doesn't fit in index type ", index_type);
     }
+    out_->dictionary = dictionary->data();
+
+    const int64_t byte_width = index_type.bit_width() / 8;
+    ARROW_ASSIGN_OR_RAISE(out_->buffers[1],
+                          AllocateBuffer(out_->length * byte_width, pool_));
+    uint8_t* dst = out_->buffers[1]->mutable_data();
+    for (size_t i = 0; i < in_.size(); ++i) {
+      const auto transpose_map =
+          reinterpret_cast<const int32_t*>(transpose_maps[i]->data());
+      switch (index_type.id()) {
+        case Type::INT8:
+          TransposeIndices<Int8Type>(*in_[i], transpose_map, dst);
+          break;
+        case Type::UINT8:
+          TransposeIndices<UInt8Type>(*in_[i], transpose_map, dst);
+          break;
+        case Type::INT16:
+          TransposeIndices<Int16Type>(*in_[i], transpose_map, dst);
+          break;
+        case Type::UINT16:
+          TransposeIndices<UInt16Type>(*in_[i], transpose_map, dst);
+          break;
+        case Type::INT32:
+          TransposeIndices<Int32Type>(*in_[i], transpose_map, dst);
+          break;
+        case Type::UINT32:
+          TransposeIndices<UInt32Type>(*in_[i], transpose_map, dst);
+          break;
+        case Type::INT64:
+          TransposeIndices<Int64Type>(*in_[i], transpose_map, dst);
+          break;
+        case Type::UINT64:
+          TransposeIndices<UInt64Type>(*in_[i], transpose_map, dst);
+          break;
+        default:
+          return Status::TypeError("Invalid dictionary index type ", index_type);
+      }
+      dst += in_[i]->length * byte_width;
+    }
+    return Status::OK();
   }
 
   Status Visit(const UnionType& u) {
@@ -215,6 +215,63 @@ TEST_F(ConcatenateTest, DictionaryType) {
   });
 }
 
+TEST_F(ConcatenateTest, DictionaryTypeDifferentDictionaries) {
+  auto type = dictionary(int8(), utf8());
+  auto dict_one = DictArrayFromJSON(type, "[0, 1, null, 1]", R"(["a", "b"])");
+  auto dict_two = DictArrayFromJSON(type, "[2, null, 0, 1]", R"(["c", "b", "a"])");
+  auto expected =
+      DictArrayFromJSON(type, "[0, 1, null, 1, 0, null, 2, 1]", R"(["a", "b", "c"])");
+  ASSERT_OK_AND_ASSIGN(auto concatenated, Concatenate({dict_one, dict_two}));
+  ASSERT_OK(concatenated->ValidateFull());
+  AssertArraysEqual(*expected, *concatenated);
+
+  // Sliced inputs
+  ASSERT_OK_AND_ASSIGN(concatenated,
+                       Concatenate({dict_one->Slice(1, 2), dict_two->Slice(2)}));
+  ASSERT_OK(concatenated->ValidateFull());
+  AssertArraysEqual(*DictArrayFromJSON(type, "[1, null, 2, 1]", R"(["a", "b", "c"])"),
+                    *concatenated);
+}
+
+TEST_F(ConcatenateTest, DictionaryTypeUnifiedDictionaryTooLarge) {
+  // 2 * 100 distinct values don't fit in int8 indices
+  auto type = dictionary(int8(), int32());
+  std::vector<int32_t> values(100);
+  std::iota(values.begin(), values.end(), 0);
+  std::shared_ptr<Array> dict_values_one, dict_values_two;
+  ArrayFromVector<Int32Type>(values, &dict_values_one);
+  std::iota(values.begin(), values.end(), 100);
+  ArrayFromVector<Int32Type>(values, &dict_values_two);
+  auto indices = ArrayFromJSON(int8(), "[0, 99]");
+  ASSERT_RAISES(
+      Invalid,
+      Concatenate({std::make_shared<DictionaryArray>(type, indices, dict_values_one),
+                   std::make_shared<DictionaryArray>(type, indices, dict_values_two)}));
+
+  // They do fit in uint8 indices
+  type = dictionary(uint8(), int32());
+  indices = ArrayFromJSON(uint8(), "[0, 99]");
+  ASSERT_OK_AND_ASSIGN(
+      auto concatenated,
+      Concatenate({std::make_shared<DictionaryArray>(type, indices, dict_values_one),
+                   std::make_shared<DictionaryArray>(type, indices, dict_values_two)}));
+  ASSERT_OK(concatenated->ValidateFull());
+  ASSERT_EQ(concatenated->data()->dictionary->length, 200);
+}
+
+TEST_F(ConcatenateTest, LargeBuffers) {
+  // Large enough to have the value buffers copied in parallel
+  const int64_t size = 1 << 20;
+  auto array = rng_.Numeric<Int64Type>(size, 0, 1000, 0.1);
+  auto strings = rng_.String(size, 0, 16, 0.1);
+  for (const auto& input : {array, strings}) {
+    std::vector<int32_t> offsets = {0, 1, size / 3, size / 3 + 7, size - 1, size};
+    ASSERT_OK_AND_ASSIGN(auto actual, Concatenate(Slices(input, offsets)));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*input, *actual);
+  }
+}
+
 TEST_F(ConcatenateTest, DISABLED_UnionType) {
   // sparse mode
   Check([this](int32_t size, double null_probability, std::shared_ptr<Array>* out) {
@@ -17,6 +17,7 @@
 
 #include "arrow/array/validate.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "arrow/array.h"  // IWYU pragma: keep
@@ -24,6 +25,7 @@
 #include "arrow/extension_type.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/int_util_internal.h"
@@ -405,6 +407,38 @@ struct BoundsCheckVisitor {
 
   template <typename T>
   Status Visit(const NumericArray<T>& array) {
+    // Fast path: the min and max of each run of non-null values, computed
+    // without branches
+    const auto values = array.raw_values();
+    bool in_bounds = true;
+    auto check_run = [&](int64_t position, int64_t length) {
+      auto min_value = values[position], max_value = values[position];
+      for (int64_t i = position + 1; i < position + length; ++i) {
+        min_value = std::min(min_value, values[i]);
+        max_value = std::max(max_value, values[i]);
+      }
+      in_bounds = in_bounds && static_cast<int64_t>(min_value) >= min_value_ &&
+                  static_cast<int64_t>(max_value) <= max_value_;
+    };
+    if (array.null_count() == 0) {
+      if (array.length() > 0) {
+        check_run(0, array.length());
+      }
+    } else {
+      BitRunReader reader(array.null_bitmap_data(), array.offset(), array.length());
+      for (int64_t position = 0; in_bounds && position < array.length();) {
+        const BitRun run = reader.NextRun();
+        if (run.set) {
+          check_run(position, run.length);
+        }
+        position += run.length;
+      }
+    }
+    if (in_bounds) {
+      return Status::OK();
+    }
+
+    // Locate the first value out of bounds
     for (int64_t i = 0; i < array.length(); ++i) {
       if (!array.IsNull(i)) {
         const auto v = static_cast<int64_t>(array.Value(i));
@@ -533,6 +567,25 @@ struct ValidateArrayDataVisitor {
       return Status::Invalid("non-empty array but value_offsets_ is null");
     }
 
+    // Fast path: check that the offsets are monotonic in branch-free blocks
+    // that the compiler can vectorize; as the first offset is non-negative
+    // and the last one within bounds, all offsets are then valid.  On failure,
+    // the slow path below locates the first invalid offset.
+    const auto offsets = array.raw_value_offsets();
+    if (offsets[0] >= 0 && offsets[array.length()] <= offset_limit) {
+      constexpr int64_t kBlockSize = 1024;
+      bool monotonic = true;
+      for (int64_t i = 0; monotonic && i < array.length(); i += kBlockSize) {
+        const int64_t block_end = std::min(i + kBlockSize, array.length());
+        for (int64_t j = i; j < block_end; ++j) {
+          monotonic &= offsets[j] <= offsets[j + 1];
+        }
+      }
+      if (monotonic) {
+        return Status::OK();
+      }
+    }
+
     auto prev_offset = array.value_offset(0);
     if (prev_offset < 0) {
       return Status::Invalid(
@@ -28,6 +28,7 @@
 #include "arrow/status.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_generate.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/ubsan.h"
 #include "arrow/util/visibility.h"
@@ -292,6 +293,13 @@ class TypedBufferBuilder<bool> {
     return Status::OK();
   }
 
+  /// \brief Append num_elements bits of a bitmap, starting at bit offset
+  Status Append(const uint8_t* bitmap, int64_t offset, int64_t num_elements) {
+    ARROW_RETURN_NOT_OK(Reserve(num_elements));
+    UnsafeAppend(bitmap, offset, num_elements);
+    return Status::OK();
+  }
+
   void UnsafeAppend(bool value) {
     BitUtil::SetBitTo(mutable_data(), bit_length_, value);
     if (!value) {
@@ -317,6 +325,13 @@ class TypedBufferBuilder<bool> {
     bit_length_ += num_copies;
   }
 
+  void UnsafeAppend(const uint8_t* bitmap, int64_t offset, int64_t num_elements) {
+    if (num_elements == 0) return;
+    internal::CopyBitmap(bitmap, offset, num_elements, mutable_data(), bit_length_);
+    false_count_ += num_elements - internal::CountSetBits(bitmap, offset, num_elements);
+    bit_length_ += num_elements;
+  }
+
   template <bool count_falses, typename Generator>
   void UnsafeAppend(const int64_t num_elements, Generator&& gen) {
     if (num_elements == 0) return;
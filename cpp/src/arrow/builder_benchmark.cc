@@ -28,6 +28,7 @@
 #include "arrow/builder.h"
 #include "arrow/memory_pool.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/string_view.h"
@@ -197,6 +198,114 @@ static void BuildDecimalArray(benchmark::State& state) {  // NOLINT non-const re
   state.SetBytesProcessed(state.iterations() * kRounds * kNumberOfElements * 16);
 }
 
+// ----------------------------------------------------------------------
+// Bulk append benchmarks
+
+// Every fourth value is null
+static std::vector<uint8_t> kValidBytes = [] {
+  std::vector<uint8_t> valid_bytes(kNumberOfElements);
+  for (int64_t i = 0; i < kNumberOfElements; ++i) {
+    valid_bytes[i] = (i % 4) != 0;
+  }
+  return valid_bytes;
+}();
+
+static std::vector<uint8_t> kValidBitmap = [] {
+  std::vector<uint8_t> bitmap(BitUtil::BytesForBits(kNumberOfElements));
+  for (int64_t i = 0; i < kNumberOfElements; ++i) {
+    BitUtil::SetBitTo(bitmap.data(), i, kValidBytes[i] != 0);
+  }
+  return bitmap;
+}();
+
+static void BuildIntArrayValidBytes(
+    benchmark::State& state) {  // NOLINT non-const reference
+  for (auto _ : state) {
+    Int64Builder builder;
+
+    for (int i = 0; i < kRounds; i++) {
+      ABORT_NOT_OK(builder.AppendValues(kData.data(), kData.size(), kValidBytes.data()));
+    }
+
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+
+  state.SetBytesProcessed(state.iterations() * kBytesProcessed);
+}
+
+static void BuildIntArrayValidBitmap(
+    benchmark::State& state) {  // NOLINT non-const reference
+  for (auto _ : state) {
+    Int64Builder builder;
+
+    for (int i = 0; i < kRounds; i++) {
+      // A non-zero bitmap offset exercises the unaligned copy
+      ABORT_NOT_OK(builder.AppendValues(kData.data(), kData.size() - 1,
+                                        kValidBitmap.data(), /*bitmap_offset=*/1));
+    }
+
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+
+  state.SetBytesProcessed(state.iterations() * kBytesProcessed);
+}
+
+// Append an array in slices of 1024 values, as when concatenating or
+// filtering record batches
+static void BenchmarkAppendArraySlice(
+    const std::shared_ptr<Array>& array,
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t kSliceLength = 1024;
+  std::unique_ptr<ArrayBuilder> builder;
+  ABORT_NOT_OK(MakeBuilder(default_memory_pool(), array->type(), &builder));
+  const ArrayData& data = *array->data();
+
+  for (auto _ : state) {
+    for (int i = 0; i < kRounds / 16; i++) {
+      for (int64_t offset = 0; offset < data.length; offset += kSliceLength) {
+        ABORT_NOT_OK(builder->AppendArraySlice(
+            data, offset, std::min(kSliceLength, data.length - offset)));
+      }
+    }
+
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder->Finish(&out));
+  }
+
+  state.SetItemsProcessed(state.iterations() * (kRounds / 16) * data.length);
+}
+
+static void AppendArraySliceInt64(
+    benchmark::State& state) {  // NOLINT non-const reference
+  random::RandomArrayGenerator rag(42);
+  BenchmarkAppendArraySlice(rag.Int64(kNumberOfElements, 0, 1 << 20, 0.1), state);
+}
+
+static void AppendArraySliceString(
+    benchmark::State& state) {  // NOLINT non-const reference
+  random::RandomArrayGenerator rag(42);
+  BenchmarkAppendArraySlice(rag.String(kNumberOfElements, 0, 16, 0.1), state);
+}
+
+static void AppendArraySliceList(
+    benchmark::State& state) {  // NOLINT non-const reference
+  random::RandomArrayGenerator rag(42);
+  auto values = rag.Int64(kNumberOfElements * 4, 0, 1 << 20, 0.1);
+  BenchmarkAppendArraySlice(rag.List(*values, kNumberOfElements, 0.1), state);
+}
+
+static void AppendArraySliceStruct(
+    benchmark::State& state) {  // NOLINT non-const reference
+  random::RandomArrayGenerator rag(42);
+  auto array = StructArray::Make({rag.Int64(kNumberOfElements, 0, 1 << 20, 0.1),
+                                  rag.String(kNumberOfElements, 0, 16, 0.1)},
+                                 std::vector<std::string>{"ints", "strs"})
+                   .ValueOrDie();
+  BenchmarkAppendArraySlice(array, state);
+}
+
 // ----------------------------------------------------------------------
 // DictionaryBuilder benchmarks
 
@@ -443,6 +552,13 @@ BENCHMARK(BuildChunkedBinaryArray);
 BENCHMARK(BuildFixedSizeBinaryArray);
 BENCHMARK(BuildDecimalArray);
 
+BENCHMARK(BuildIntArrayValidBytes);
+BENCHMARK(BuildIntArrayValidBitmap);
+BENCHMARK(AppendArraySliceInt64);
+BENCHMARK(AppendArraySliceString);
+BENCHMARK(AppendArraySliceList);
+BENCHMARK(AppendArraySliceStruct);
+
 BENCHMARK(BuildInt64DictionaryArrayRandom);
 BENCHMARK(BuildInt64DictionaryArraySequential);
 BENCHMARK(BuildInt64DictionaryArraySimilar);
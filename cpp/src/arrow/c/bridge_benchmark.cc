@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <vector>
 
 #include "benchmark/benchmark.h"
 
@@ -27,6 +28,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
 #include "arrow/util/key_value_metadata.h"
+#include "arrow/util/logging.h"
 
 namespace arrow {
 
@@ -55,6 +57,14 @@ std::shared_ptr<RecordBatch> ExampleRecordBatch() {
   return RecordBatch::Make(schema, length, columns);
 }
 
+// A reader of a stream of batches, as produced by a scan or a Flight stream
+std::shared_ptr<RecordBatchReader> ExampleRecordBatchReader() {
+  constexpr int kNumBatches = 100;
+  auto batch = ExampleRecordBatch();
+  return *RecordBatchReader::Make(RecordBatchVector(kNumBatches, batch),
+                                  batch->schema());
+}
+
 static void ExportType(benchmark::State& state) {  // NOLINT non-const reference
   struct ArrowSchema c_export;
   auto type = utf8();
@@ -146,14 +156,65 @@ static void ExportImportRecordBatch(
   state.SetItemsProcessed(state.iterations());
 }
 
+static void ExportRecordBatchReader(
+    benchmark::State& state) {  // NOLINT non-const reference
+  struct ArrowArrayStream c_stream;
+  struct ArrowSchema c_schema;
+  struct ArrowArray c_array;
+  int64_t num_batches = 0;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto reader = ExampleRecordBatchReader();
+    state.ResumeTiming();
+
+    // Consume the stream as a C consumer would
+    ABORT_NOT_OK(ExportRecordBatchReader(std::move(reader), &c_stream));
+    ARROW_CHECK_EQ(c_stream.get_schema(&c_stream, &c_schema), 0);
+    ArrowSchemaRelease(&c_schema);
+    while (true) {
+      ARROW_CHECK_EQ(c_stream.get_next(&c_stream, &c_array), 0);
+      if (ArrowArrayIsReleased(&c_array)) break;
+      ArrowArrayRelease(&c_array);
+      ++num_batches;
+    }
+    ArrowArrayStreamRelease(&c_stream);
+  }
+  state.SetItemsProcessed(num_batches);
+}
+
+static void ExportImportRecordBatchReader(
+    benchmark::State& state) {  // NOLINT non-const reference
+  struct ArrowArrayStream c_stream;
+  int64_t num_batches = 0;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto reader = ExampleRecordBatchReader();
+    state.ResumeTiming();
+
+    ABORT_NOT_OK(ExportRecordBatchReader(std::move(reader), &c_stream));
+    auto imported = ImportRecordBatchReader(&c_stream).ValueOrDie();
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      ABORT_NOT_OK(imported->ReadNext(&batch));
+      if (batch == nullptr) break;
+      ++num_batches;
+    }
+  }
+  state.SetItemsProcessed(num_batches);
+}
+
 BENCHMARK(ExportType);
 BENCHMARK(ExportSchema);
 BENCHMARK(ExportArray);
 BENCHMARK(ExportRecordBatch);
+BENCHMARK(ExportRecordBatchReader);
 
 BENCHMARK(ExportImportType);
 BENCHMARK(ExportImportSchema);
 BENCHMARK(ExportImportArray);
 BENCHMARK(ExportImportRecordBatch);
+BENCHMARK(ExportImportRecordBatchReader);
 
 }  // namespace arrow
@@ -38,6 +38,7 @@
 #include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
@@ -49,13 +50,56 @@
 namespace arrow {
 
 using internal::BitmapEquals;
+using internal::BitRun;
+using internal::BitRunReader;
 using internal::checked_cast;
+using internal::CountSetBits;
 
 // ----------------------------------------------------------------------
 // Public method implementations
 
 namespace {
 
+// Call `visit(position, length)` on each run of non-null slots of `array`
+// between `start` and `start + length`, stopping at the first call that
+// returns false.  Comparing runs of values at once avoids testing validity
+// bits slot by slot.
+template <typename Visitor>
+bool VisitValidRuns(const Array& array, int64_t start, int64_t length, Visitor&& visit) {
+  const uint8_t* bitmap = array.null_bitmap_data();
+  if (bitmap == nullptr) {
+    return length == 0 || visit(start, length);
+  }
+  BitRunReader reader(bitmap, array.offset() + start, length);
+  int64_t position = 0;
+  while (position < length) {
+    const BitRun run = reader.NextRun();
+    if (run.set && !visit(start + position, run.length)) {
+      return false;
+    }
+    position += run.length;
+  }
+  return true;
+}
+
+// Whether the validity of two array ranges of the given length is equal
+bool NullBitmapsRangeEqual(const Array& left, int64_t left_start, const Array& right,
+                           int64_t right_start, int64_t length) {
+  const uint8_t* left_bitmap = left.null_bitmap_data();
+  const uint8_t* right_bitmap = right.null_bitmap_data();
+  if (left_bitmap == nullptr && right_bitmap == nullptr) {
+    return true;
+  }
+  if (left_bitmap == nullptr) {
+    return CountSetBits(right_bitmap, right.offset() + right_start, length) == length;
+  }
+  if (right_bitmap == nullptr) {
+    return CountSetBits(left_bitmap, left.offset() + left_start, length) == length;
+  }
+  return BitmapEquals(left_bitmap, left.offset() + left_start, right_bitmap,
+                      right.offset() + right_start, length);
+}
+
 // These helper functions assume we already checked the arrays have equal
 // sizes and null bitmaps.
 
@@ -68,21 +112,14 @@ inline bool BaseFloatingEquals(const NumericArray<ArrowType>& left,
   const T* left_data = left.raw_values();
   const T* right_data = right.raw_values();
 
-  if (left.null_count() > 0) {
-    for (int64_t i = 0; i < left.length(); ++i) {
-      if (left.IsNull(i)) continue;
+  return VisitValidRuns(left, 0, left.length(), [&](int64_t position, int64_t length) {
+    for (int64_t i = position; i < position + length; ++i) {
       if (!equals(left_data[i], right_data[i])) {
         return false;
       }
     }
-  } else {
-    for (int64_t i = 0; i < left.length(); ++i) {
-      if (!equals(left_data[i], right_data[i])) {
-        return false;
-      }
-    }
-  }
-  return true;
+    return true;
+  });
 }
 
 template <typename ArrowType>
@@ -131,50 +168,100 @@ class RangeEqualsVisitor {
         right_start_idx_(right_start_idx),
         result_(false) {}
 
+  // Whether the validity of the ranges is equal; thereafter only the values
+  // of the runs of non-null slots need comparing
+  bool NullBitmapsEqual(const Array& left) const {
+    return NullBitmapsRangeEqual(left, left_start_idx_, right_, right_start_idx_,
+                                 left_end_idx_ - left_start_idx_);
+  }
+
+  // Call `compare_run(left_position, right_position, length)` on each run of
+  // non-null slots of the range
+  template <typename CompareRunFunc>
+  bool CompareValidRuns(const Array& left, CompareRunFunc&& compare_run) const {
+    return VisitValidRuns(left, left_start_idx_, left_end_idx_ - left_start_idx_,
+                          [&](int64_t position, int64_t length) {
+                            return compare_run(
+                                position, position - left_start_idx_ + right_start_idx_,
+                                length);
+                          });
+  }
+
+  // Values with a unique representation are compared bytewise
   template <typename ArrayType>
-  inline Status CompareValues(const ArrayType& left) {
-    const auto& right = checked_cast<const ArrayType&>(right_);
+  static enable_if_t<std::is_integral<typename ArrayType::value_type>::value, bool>
+  ValueRunsEqual(const ArrayType& left, const ArrayType& right, int64_t left_position,
+                 int64_t right_position, int64_t length) {
+    return std::memcmp(left.raw_values() + left_position,
+                       right.raw_values() + right_position,
+                       length * sizeof(typename ArrayType::value_type)) == 0;
+  }
 
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      const bool is_null = left.IsNull(i);
-      if (is_null != right.IsNull(o_i) ||
-          (!is_null && left.Value(i) != right.Value(o_i))) {
-        result_ = false;
-        return Status::OK();
+  // Floating point values are compared by value, which equates 0.0 and -0.0
+  // but not NaNs
+  template <typename ArrayType>
+  static enable_if_t<!std::is_integral<typename ArrayType::value_type>::value, bool>
+  ValueRunsEqual(const ArrayType& left, const ArrayType& right, int64_t left_position,
+                 int64_t right_position, int64_t length) {
+    for (int64_t i = 0; i < length; ++i) {
+      if (left.Value(left_position + i) != right.Value(right_position + i)) {
+        return false;
       }
     }
-    result_ = true;
+    return true;
+  }
+
+  static bool ValueRunsEqual(const BooleanArray& left, const BooleanArray& right,
+                             int64_t left_position, int64_t right_position,
+                             int64_t length) {
+    return BitmapEquals(left.values()->data(), left.offset() + left_position,
+                        right.values()->data(), right.offset() + right_position, length);
+  }
+
+  static bool ValueRunsEqual(const DayTimeIntervalArray& left,
+                             const DayTimeIntervalArray& right, int64_t left_position,
+                             int64_t right_position, int64_t length) {
+    for (int64_t i = 0; i < length; ++i) {
+      if (left.Value(left_position + i) != right.Value(right_position + i)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template <typename ArrayType>
+  inline Status CompareValues(const ArrayType& left) {
+    const auto& right = checked_cast<const ArrayType&>(right_);
+    result_ = NullBitmapsEqual(left) &&
+              CompareValidRuns(left, [&](int64_t i, int64_t o_i, int64_t length) {
+                return ValueRunsEqual(left, right, i, o_i, length);
+              });
     return Status::OK();
   }
 
+  // Within a run of non-null slots with equal value lengths, the values are
+  // contiguous and compared at once
   template <typename ArrayType, typename CompareValuesFunc>
   bool CompareWithOffsets(const ArrayType& left,
                           CompareValuesFunc&& compare_values) const {
     const auto& right = checked_cast<const ArrayType&>(right_);
-
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      const bool is_null = left.IsNull(i);
-      if (is_null != right.IsNull(o_i)) {
-        return false;
-      }
-      if (is_null) continue;
-      const auto begin_offset = left.value_offset(i);
-      const auto end_offset = left.value_offset(i + 1);
-      const auto right_begin_offset = right.value_offset(o_i);
-      const auto right_end_offset = right.value_offset(o_i + 1);
-      // Underlying can't be equal if the size isn't equal
-      if (end_offset - begin_offset != right_end_offset - right_begin_offset) {
-        return false;
-      }
-
-      if (!compare_values(left, right, begin_offset, right_begin_offset,
-                          end_offset - begin_offset)) {
-        return false;
-      }
+    if (!NullBitmapsEqual(left)) {
+      return false;
     }
-    return true;
+    return CompareValidRuns(left, [&](int64_t i, int64_t o_i, int64_t length) {
+      const auto left_offsets = left.raw_value_offsets() + i;
+      const auto right_offsets = right.raw_value_offsets() + o_i;
+      // Underlying can't be equal if the sizes aren't equal.  Accumulate
+      // without branching so that the loop vectorizes.
+      bool sizes_equal = true;
+      for (int64_t j = 0; j < length; ++j) {
+        sizes_equal &= (left_offsets[j + 1] - left_offsets[j] ==
+                        right_offsets[j + 1] - right_offsets[j]);
+      }
+      return sizes_equal &&
+             compare_values(left, right, left_offsets[0], right_offsets[0],
+                            left_offsets[length] - left_offsets[0]);
+    });
   }
 
   template <typename BinaryArrayType>
@@ -239,23 +326,17 @@ class RangeEqualsVisitor {
 
   bool CompareStructs(const StructArray& left) {
     const auto& right = checked_cast<const StructArray&>(right_);
-    bool equal_fields = true;
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      if (left.IsNull(i) != right.IsNull(o_i)) {
-        return false;
-      }
-      if (left.IsNull(i)) continue;
+    if (!NullBitmapsEqual(left)) {
+      return false;
+    }
+    return CompareValidRuns(left, [&](int64_t i, int64_t o_i, int64_t length) {
       for (int j = 0; j < left.num_fields(); ++j) {
-        // TODO: really we should be comparing stretches of non-null data rather
-        // than looking at one value at a time.
-        equal_fields = left.field(j)->RangeEquals(i, i + 1, o_i, right.field(j));
-        if (!equal_fields) {
+        if (!left.field(j)->RangeEquals(i, i + length, o_i, right.field(j))) {
           return false;
         }
       }
-    }
-    return true;
+      return true;
+    });
   }
 
   bool CompareUnions(const UnionArray& left) const {
@@ -331,21 +412,12 @@ class RangeEqualsVisitor {
       right_data = right.raw_values();
     }
 
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      const bool is_null = left.IsNull(i);
-      if (is_null != right.IsNull(o_i)) {
-        result_ = false;
-        return Status::OK();
-      }
-      if (is_null) continue;
-
-      if (std::memcmp(left_data + width * i, right_data + width * o_i, width)) {
-        result_ = false;
-        return Status::OK();
-      }
-    }
-    result_ = true;
+    result_ = NullBitmapsEqual(left) &&
+              CompareValidRuns(left, [&](int64_t i, int64_t o_i, int64_t length) {
+                return width == 0 || std::memcmp(left_data + width * i,
+                                                 right_data + width * o_i,
+                                                 width * length) == 0;
+              });
     return Status::OK();
   }
 
@@ -451,19 +523,10 @@ static bool IsEqualPrimitive(const PrimitiveArray& left, const PrimitiveArray& r
     }
     return true;
   } else if (left.null_count() > 0) {
-    for (int64_t i = 0; i < left.length(); ++i) {
-      const bool left_null = left.IsNull(i);
-      const bool right_null = right.IsNull(i);
-      if (left_null != right_null) {
-        return false;
-      }
-      if (!left_null && memcmp(left_data, right_data, byte_width) != 0) {
-        return false;
-      }
-      left_data += byte_width;
-      right_data += byte_width;
-    }
-    return true;
+    return VisitValidRuns(left, 0, left.length(), [&](int64_t position, int64_t length) {
+      return memcmp(left_data + position * byte_width, right_data + position * byte_width,
+                    length * byte_width) == 0;
+    });
   } else {
     auto number_of_bytes_to_compare = static_cast<size_t>(byte_width * left.length());
     return memcmp(left_data, right_data, number_of_bytes_to_compare) == 0;
@@ -490,17 +553,11 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
     const auto& right = checked_cast<const BooleanArray&>(right_);
 
     if (left.null_count() > 0) {
-      const uint8_t* left_data = left.values()->data();
-      const uint8_t* right_data = right.values()->data();
-
-      for (int64_t i = 0; i < left.length(); ++i) {
-        if (left.IsValid(i) && BitUtil::GetBit(left_data, i + left.offset()) !=
-                                   BitUtil::GetBit(right_data, i + right.offset())) {
-          result_ = false;
-          return Status::OK();
-        }
-      }
-      result_ = true;
+      result_ = VisitValidRuns(left, 0, left.length(), [&](int64_t position,
+                                                           int64_t length) {
+        return BitmapEquals(left.values()->data(), left.offset() + position,
+                            right.values()->data(), right.offset() + position, length);
+      });
     } else {
       result_ = BitmapEquals(left.values()->data(), left.offset(), right.values()->data(),
                              right.offset(), left.length());
@@ -539,19 +596,14 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
 
     const auto& right = checked_cast<const ArrayType&>(right_);
 
-    if (left.offset() == 0 && right.offset() == 0) {
-      return left.value_offsets()->Equals(*right.value_offsets(),
-                                          (left.length() + 1) * sizeof(offset_type));
+    const offset_type* left_offsets = left.raw_value_offsets();
+    const offset_type* right_offsets = right.raw_value_offsets();
+    if (left_offsets[0] == right_offsets[0]) {
+      return std::memcmp(left_offsets, right_offsets,
+                         (left.length() + 1) * sizeof(offset_type)) == 0;
     } else {
-      // One of the arrays is sliced; logic is more complicated because the
-      // value offsets are not both 0-based
-      auto left_offsets =
-          reinterpret_cast<const offset_type*>(left.value_offsets()->data()) +
-          left.offset();
-      auto right_offsets =
-          reinterpret_cast<const offset_type*>(right.value_offsets()->data()) +
-          right.offset();
-
+      // The value offsets are not both 0-based, e.g. one of the arrays is
+      // sliced, so compare them relative to their start
       for (int64_t i = 0; i < left.length() + 1; ++i) {
         if (left_offsets[i] - left_offsets[0] != right_offsets[i] - right_offsets[0]) {
           return false;
@@ -582,16 +634,10 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
 
     if (left.null_count() == 0) {
       // Fast path for null count 0, single memcmp
-      if (left.offset() == 0 && right.offset() == 0) {
-        return std::memcmp(left_data, right_data,
-                           left.raw_value_offsets()[left.length()]) == 0;
-      } else {
-        const int64_t total_bytes =
-            left.value_offset(left.length()) - left.value_offset(0);
-        return std::memcmp(left_data + left.value_offset(0),
-                           right_data + right.value_offset(0),
-                           static_cast<size_t>(total_bytes)) == 0;
-      }
+      const int64_t total_bytes = left.value_offset(left.length()) - left.value_offset(0);
+      return std::memcmp(left_data + left.value_offset(0),
+                         right_data + right.value_offset(0),
+                         static_cast<size_t>(total_bytes)) == 0;
     } else {
       // ARROW-537: Only compare data in non-null slots
       auto left_offsets = left.raw_value_offsets();
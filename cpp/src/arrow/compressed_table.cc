@@ -0,0 +1,387 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compressed_table.h"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer.h"
+#include "arrow/chunked_array.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
+
+namespace arrow {
+
+namespace {
+
+// A buffer compressed with the codec, or copied as is if it doesn't shrink
+struct CompressedBuffer {
+  // null if the buffer is absent
+  std::shared_ptr<Buffer> data;
+  // the size of the decompressed buffer, or -1 if data isn't compressed
+  int64_t decompressed_size;
+};
+
+struct CompressedArrayData {
+  std::shared_ptr<DataType> type;
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  std::vector<CompressedBuffer> buffers;
+  std::vector<CompressedArrayData> child_data;
+  std::shared_ptr<CompressedArrayData> dictionary;
+};
+
+class ArrayDataCompressor {
+ public:
+  explicit ArrayDataCompressor(const InMemoryCompressionOptions& options)
+      : options_(options) {}
+
+  Status Compress(const ArrayData& data, CompressedArrayData* out) {
+    out->type = data.type;
+    out->length = data.length;
+    out->null_count = data.null_count;
+    out->offset = data.offset;
+    out->buffers.resize(data.buffers.size());
+    for (size_t i = 0; i < data.buffers.size(); ++i) {
+      RETURN_NOT_OK(Compress(data.buffers[i], &out->buffers[i]));
+    }
+    out->child_data.resize(data.child_data.size());
+    for (size_t i = 0; i < data.child_data.size(); ++i) {
+      RETURN_NOT_OK(Compress(*data.child_data[i], &out->child_data[i]));
+    }
+    if (data.dictionary != nullptr) {
+      out->dictionary = std::make_shared<CompressedArrayData>();
+      RETURN_NOT_OK(Compress(*data.dictionary, out->dictionary.get()));
+    }
+    return Status::OK();
+  }
+
+  int64_t compressed_size() const { return compressed_size_; }
+
+  int64_t uncompressed_size() const { return uncompressed_size_; }
+
+ private:
+  Status Compress(const std::shared_ptr<Buffer>& buffer, CompressedBuffer* out) {
+    out->decompressed_size = -1;
+    if (buffer == nullptr) {
+      return Status::OK();
+    }
+    const int64_t size = buffer->size();
+    uncompressed_size_ += size;
+    if (size >= options_.min_buffer_size) {
+      util::Codec* codec = options_.codec.get();
+      const int64_t max_length = codec->MaxCompressedLen(size, buffer->data());
+      ARROW_ASSIGN_OR_RAISE(auto compressed,
+                            AllocateResizableBuffer(max_length, options_.memory_pool));
+      ARROW_ASSIGN_OR_RAISE(
+          int64_t length, codec->Compress(size, buffer->data(), max_length,
+                                          compressed->mutable_data()));
+      if (length < size) {
+        RETURN_NOT_OK(compressed->Resize(length, /*shrink_to_fit=*/true));
+        out->data = std::move(compressed);
+        out->decompressed_size = size;
+        compressed_size_ += length;
+        return Status::OK();
+      }
+    }
+    // Copy rather than share the buffer, which may be a slice of a larger
+    // allocation that would be kept alive
+    ARROW_ASSIGN_OR_RAISE(out->data, buffer->CopySlice(0, size, options_.memory_pool));
+    compressed_size_ += size;
+    return Status::OK();
+  }
+
+  const InMemoryCompressionOptions& options_;
+  int64_t compressed_size_ = 0;
+  int64_t uncompressed_size_ = 0;
+};
+
+Result<std::shared_ptr<Buffer>> DecompressBuffer(const CompressedBuffer& buffer,
+                                                 util::Codec* codec, MemoryPool* pool) {
+  if (buffer.data == nullptr || buffer.decompressed_size < 0) {
+    return buffer.data;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto decompressed,
+                        AllocateBuffer(buffer.decompressed_size, pool));
+  ARROW_ASSIGN_OR_RAISE(
+      int64_t length,
+      codec->Decompress(buffer.data->size(), buffer.data->data(),
+                        buffer.decompressed_size, decompressed->mutable_data()));
+  if (length != buffer.decompressed_size) {
+    return Status::IOError("Decompressed buffer has size ", length, ", expected ",
+                           buffer.decompressed_size);
+  }
+  return std::shared_ptr<Buffer>(std::move(decompressed));
+}
+
+Result<std::shared_ptr<ArrayData>> DecompressArrayData(const CompressedArrayData& data,
+                                                       util::Codec* codec,
+                                                       MemoryPool* pool) {
+  BufferVector buffers(data.buffers.size());
+  for (size_t i = 0; i < data.buffers.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(buffers[i], DecompressBuffer(data.buffers[i], codec, pool));
+  }
+  ArrayDataVector child_data(data.child_data.size());
+  for (size_t i = 0; i < data.child_data.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(child_data[i],
+                          DecompressArrayData(data.child_data[i], codec, pool));
+  }
+  auto out = ArrayData::Make(data.type, data.length, std::move(buffers),
+                             std::move(child_data), data.null_count, data.offset);
+  if (data.dictionary != nullptr) {
+    ARROW_ASSIGN_OR_RAISE(out->dictionary,
+                          DecompressArrayData(*data.dictionary, codec, pool));
+  }
+  return out;
+}
+
+}  // namespace
+
+InMemoryCompressionOptions InMemoryCompressionOptions::Defaults() {
+  InMemoryCompressionOptions options;
+  if (util::Codec::IsAvailable(Compression::LZ4_FRAME)) {
+    options.codec = util::Codec::Create(Compression::LZ4_FRAME).ValueOrDie();
+  }
+  return options;
+}
+
+// ----------------------------------------------------------------------
+// CompressedChunkedArray
+
+class CompressedChunkedArray::Impl {
+ public:
+  Result<std::shared_ptr<Array>> GetChunk(int i, bool cache_result) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = FindCached(i);
+      if (it != cache_.end()) {
+        // Move to the front as the most recently used chunk
+        std::rotate(cache_.begin(), it, it + 1);
+        return cache_.front().second;
+      }
+    }
+    // Decompress without holding the lock, so that other chunks can be accessed
+    // in the meantime
+    ARROW_ASSIGN_OR_RAISE(auto data,
+                          DecompressArrayData(chunks_[i], codec_.get(), pool_));
+    auto array = MakeArray(std::move(data));
+    if (cache_result && cache_size_ > 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = FindCached(i);
+      if (it != cache_.end()) {
+        // Decompressed concurrently by another thread
+        std::rotate(cache_.begin(), it, it + 1);
+        return cache_.front().second;
+      }
+      cache_.emplace(cache_.begin(), i, array);
+      if (static_cast<int>(cache_.size()) > cache_size_) {
+        cache_.pop_back();
+      }
+    }
+    return array;
+  }
+
+  std::shared_ptr<DataType> type_;
+  std::shared_ptr<util::Codec> codec_;
+  MemoryPool* pool_;
+  int cache_size_;
+  std::vector<CompressedArrayData> chunks_;
+  int64_t length_ = 0;
+  int64_t null_count_ = 0;
+  int64_t compressed_size_ = 0;
+  int64_t uncompressed_size_ = 0;
+
+ private:
+  using CacheEntry = std::pair<int, std::shared_ptr<Array>>;
+
+  std::vector<CacheEntry>::iterator FindCached(int i) {
+    return std::find_if(cache_.begin(), cache_.end(),
+                        [i](const CacheEntry& entry) { return entry.first == i; });
+  }
+
+  std::mutex mutex_;
+  // The decompressed chunks, most recently used first
+  std::vector<CacheEntry> cache_;
+};
+
+CompressedChunkedArray::CompressedChunkedArray(std::unique_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+CompressedChunkedArray::~CompressedChunkedArray() = default;
+
+Result<std::shared_ptr<CompressedChunkedArray>> CompressedChunkedArray::Make(
+    const ChunkedArray& values, const InMemoryCompressionOptions& options) {
+  if (options.codec == nullptr) {
+    return Status::Invalid("A codec is required to compress arrays in memory");
+  }
+  auto impl = ::arrow::internal::make_unique<Impl>();
+  impl->type_ = values.type();
+  impl->codec_ = options.codec;
+  impl->pool_ = options.memory_pool;
+  impl->cache_size_ = options.cache_size;
+  impl->length_ = values.length();
+  impl->null_count_ = values.null_count();
+
+  const int num_chunks = values.num_chunks();
+  impl->chunks_.resize(num_chunks);
+  std::vector<int64_t> compressed_sizes(num_chunks), uncompressed_sizes(num_chunks);
+  RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+      options.use_threads, num_chunks, [&](int i) {
+        ArrayDataCompressor compressor(options);
+        RETURN_NOT_OK(compressor.Compress(*values.chunk(i)->data(), &impl->chunks_[i]));
+        compressed_sizes[i] = compressor.compressed_size();
+        uncompressed_sizes[i] = compressor.uncompressed_size();
+        return Status::OK();
+      }));
+  for (int i = 0; i < num_chunks; ++i) {
+    impl->compressed_size_ += compressed_sizes[i];
+    impl->uncompressed_size_ += uncompressed_sizes[i];
+  }
+  return std::shared_ptr<CompressedChunkedArray>(
+      new CompressedChunkedArray(std::move(impl)));
+}
+
+const std::shared_ptr<DataType>& CompressedChunkedArray::type() const {
+  return impl_->type_;
+}
+
+int64_t CompressedChunkedArray::length() const { return impl_->length_; }
+
+int64_t CompressedChunkedArray::null_count() const { return impl_->null_count_; }
+
+int CompressedChunkedArray::num_chunks() const {
+  return static_cast<int>(impl_->chunks_.size());
+}
+
+int64_t CompressedChunkedArray::chunk_length(int i) const {
+  return impl_->chunks_[i].length;
+}
+
+int64_t CompressedChunkedArray::compressed_size() const {
+  return impl_->compressed_size_;
+}
+
+int64_t CompressedChunkedArray::uncompressed_size() const {
+  return impl_->uncompressed_size_;
+}
+
+Result<std::shared_ptr<Array>> CompressedChunkedArray::chunk(int i) const {
+  DCHECK(i >= 0 && i < num_chunks());
+  return impl_->GetChunk(i, /*cache_result=*/true);
+}
+
+Result<std::shared_ptr<ChunkedArray>> CompressedChunkedArray::Slice(
+    int64_t offset, int64_t length) const {
+  if (offset < 0 || length < 0 || offset > impl_->length_) {
+    return Status::IndexError("Slice [", offset, ", ", offset, " + ", length,
+                              ") out of bounds for array of length ", impl_->length_);
+  }
+  ArrayVector chunks;
+  int i = 0;
+  while (i < num_chunks() && offset >= chunk_length(i)) {
+    offset -= chunk_length(i);
+    ++i;
+  }
+  for (; i < num_chunks() && length > 0; ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto array, chunk(i));
+    chunks.push_back(array->Slice(offset, length));
+    length -= chunk_length(i) - offset;
+    offset = 0;
+  }
+  if (chunks.empty()) {
+    // Make sure there is at least one chunk, without decompressing any
+    ARROW_ASSIGN_OR_RAISE(auto empty, MakeArrayOfNull(impl_->type_, 0, impl_->pool_));
+    chunks.push_back(std::move(empty));
+  }
+  return std::make_shared<ChunkedArray>(std::move(chunks), impl_->type_);
+}
+
+Result<std::shared_ptr<ChunkedArray>> CompressedChunkedArray::Decompress() const {
+  ArrayVector chunks(num_chunks());
+  for (int i = 0; i < num_chunks(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(chunks[i], impl_->GetChunk(i, /*cache_result=*/false));
+  }
+  return std::make_shared<ChunkedArray>(std::move(chunks), impl_->type_);
+}
+
+// ----------------------------------------------------------------------
+// CompressedTable
+
+CompressedTable::CompressedTable(
+    std::shared_ptr<Schema> schema,
+    std::vector<std::shared_ptr<CompressedChunkedArray>> columns, int64_t num_rows)
+    : schema_(std::move(schema)), columns_(std::move(columns)), num_rows_(num_rows) {}
+
+Result<std::shared_ptr<CompressedTable>> CompressedTable::Make(
+    const Table& table, const InMemoryCompressionOptions& options) {
+  std::vector<std::shared_ptr<CompressedChunkedArray>> columns(table.num_columns());
+  for (int i = 0; i < table.num_columns(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(columns[i],
+                          CompressedChunkedArray::Make(*table.column(i), options));
+  }
+  return std::shared_ptr<CompressedTable>(
+      new CompressedTable(table.schema(), std::move(columns), table.num_rows()));
+}
+
+int64_t CompressedTable::compressed_size() const {
+  int64_t size = 0;
+  for (const auto& column : columns_) {
+    size += column->compressed_size();
+  }
+  return size;
+}
+
+int64_t CompressedTable::uncompressed_size() const {
+  int64_t size = 0;
+  for (const auto& column : columns_) {
+    size += column->uncompressed_size();
+  }
+  return size;
+}
+
+Result<std::shared_ptr<Table>> CompressedTable::Slice(int64_t offset,
+                                                      int64_t length) const {
+  if (offset < 0 || length < 0 || offset > num_rows_) {
+    return Status::IndexError("Slice [", offset, ", ", offset, " + ", length,
+                              ") out of bounds for table of ", num_rows_, " rows");
+  }
+  length = std::min(length, num_rows_ - offset);
+  ChunkedArrayVector columns(columns_.size());
+  for (size_t i = 0; i < columns_.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(columns[i], columns_[i]->Slice(offset, length));
+  }
+  return Table::Make(schema_, std::move(columns), length);
+}
+
+Result<std::shared_ptr<Table>> CompressedTable::Decompress() const {
+  ChunkedArrayVector columns(columns_.size());
+  for (size_t i = 0; i < columns_.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(columns[i], columns_[i]->Decompress());
+  }
+  return Table::Make(schema_, std::move(columns), num_rows_);
+}
+
+}  // namespace arrow
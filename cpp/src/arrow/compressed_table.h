@@ -0,0 +1,162 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+namespace util {
+
+class Codec;
+
+}  // namespace util
+
+/// \brief Options for compressing chunked arrays and tables in memory
+struct ARROW_EXPORT InMemoryCompressionOptions {
+  /// The codec compressing the buffers
+  ///
+  /// LZ4_FRAME gives the fastest access to the data, ZSTD a better ratio.
+  std::shared_ptr<util::Codec> codec;
+  /// The number of decompressed chunks each column keeps cached (0 to disable)
+  int cache_size = 2;
+  /// Buffers smaller than this are kept uncompressed
+  int64_t min_buffer_size = 64;
+  /// Whether to compress the chunks in parallel
+  bool use_threads = true;
+  /// The pool of the compressed and decompressed buffers
+  MemoryPool* memory_pool = default_memory_pool();
+
+  /// \brief Default options, compressing with LZ4_FRAME if available
+  static InMemoryCompressionOptions Defaults();
+};
+
+/// \class CompressedChunkedArray
+/// \brief A chunked array whose chunks are held compressed in memory
+///
+/// Each buffer of each chunk, including the buffers of child and dictionary
+/// arrays, is compressed independently; buffers which don't shrink are copied
+/// as is.  A chunk is decompressed on access, and the most recently
+/// accessed chunks are kept decompressed, so that repeated accesses to the same
+/// chunks don't decompress them again.  Operations only decompress the chunks
+/// they touch.
+///
+/// The buffers of sliced chunks are compressed whole, and the slice is applied
+/// again on decompression.
+///
+/// Accessing the chunks is thread-safe.
+class ARROW_EXPORT CompressedChunkedArray {
+ public:
+  ~CompressedChunkedArray();
+
+  /// \brief Compress the chunks of a chunked array
+  static Result<std::shared_ptr<CompressedChunkedArray>> Make(
+      const ChunkedArray& values,
+      const InMemoryCompressionOptions& options = InMemoryCompressionOptions::Defaults());
+
+  const std::shared_ptr<DataType>& type() const;
+
+  int64_t length() const;
+
+  int64_t null_count() const;
+
+  int num_chunks() const;
+
+  /// \brief The length of a chunk, without decompressing it
+  int64_t chunk_length(int i) const;
+
+  /// \brief The size of the compressed buffers
+  int64_t compressed_size() const;
+
+  /// \brief The size of the buffers once decompressed
+  int64_t uncompressed_size() const;
+
+  /// \brief Decompress a chunk, or get it from the cache of decompressed chunks
+  Result<std::shared_ptr<Array>> chunk(int i) const;
+
+  /// \brief Decompress the chunks overlapping a range of the array
+  Result<std::shared_ptr<ChunkedArray>> Slice(int64_t offset, int64_t length) const;
+
+  /// \brief Decompress all chunks
+  ///
+  /// The decompressed chunks are not cached.
+  Result<std::shared_ptr<ChunkedArray>> Decompress() const;
+
+ private:
+  class Impl;
+
+  explicit CompressedChunkedArray(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \class CompressedTable
+/// \brief A table whose columns are held compressed in memory
+///
+/// \see CompressedChunkedArray
+class ARROW_EXPORT CompressedTable {
+ public:
+  /// \brief Compress the columns of a table
+  static Result<std::shared_ptr<CompressedTable>> Make(
+      const Table& table,
+      const InMemoryCompressionOptions& options = InMemoryCompressionOptions::Defaults());
+
+  const std::shared_ptr<Schema>& schema() const { return schema_; }
+
+  int num_columns() const { return static_cast<int>(columns_.size()); }
+
+  int64_t num_rows() const { return num_rows_; }
+
+  const std::shared_ptr<CompressedChunkedArray>& column(int i) const {
+    return columns_[i];
+  }
+
+  const std::vector<std::shared_ptr<CompressedChunkedArray>>& columns() const {
+    return columns_;
+  }
+
+  /// \brief The size of the compressed buffers
+  int64_t compressed_size() const;
+
+  /// \brief The size of the buffers once decompressed
+  int64_t uncompressed_size() const;
+
+  /// \brief Decompress the chunks overlapping a range of rows
+  Result<std::shared_ptr<Table>> Slice(int64_t offset, int64_t length) const;
+
+  /// \brief Decompress all columns
+  Result<std::shared_ptr<Table>> Decompress() const;
+
+ private:
+  CompressedTable(std::shared_ptr<Schema> schema,
+                  std::vector<std::shared_ptr<CompressedChunkedArray>> columns,
+                  int64_t num_rows);
+
+  std::shared_ptr<Schema> schema_;
+  std::vector<std::shared_ptr<CompressedChunkedArray>> columns_;
+  int64_t num_rows_;
+};
+
+}  // namespace arrow
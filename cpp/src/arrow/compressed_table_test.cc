@@ -0,0 +1,179 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/array/util.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compressed_table.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/compression.h"
+
+namespace arrow {
+
+class TestCompressedTable : public ::testing::TestWithParam<Compression::type> {
+ protected:
+  void SetUp() override {
+    if (!util::Codec::IsAvailable(GetParam())) {
+      GTEST_SKIP() << "Compression not available";
+    }
+    ASSERT_OK_AND_ASSIGN(options_.codec, util::Codec::Create(GetParam()));
+  }
+
+  std::shared_ptr<ChunkedArray> SliceIntoChunks(const std::shared_ptr<Array>& values) {
+    // Sliced chunks, and an empty one
+    return std::make_shared<ChunkedArray>(ArrayVector{
+        values->Slice(0, 100), values->Slice(100, 0), values->Slice(100, 250),
+        values->Slice(350)});
+  }
+
+  InMemoryCompressionOptions options_;
+};
+
+TEST_P(TestCompressedTable, Roundtrip) {
+  random::RandomArrayGenerator rand(42);
+  const int64_t length = 500;
+  ASSERT_OK_AND_ASSIGN(
+      auto dict_values,
+      DictionaryArray::FromArrays(dictionary(int8(), utf8()),
+                                  rand.Int8(length, 0, 2, 0.1),
+                                  ArrayFromJSON(utf8(), R"(["foo", "bar", "quux"])")));
+  ArrayVector values_arrays = {
+      rand.Int64(length, 0, 100, 0.1), rand.Boolean(length, 0.5, 0.1),
+      rand.String(length, 0, 10, 0.1),
+      rand.List(*rand.Int32(length * 3, 0, 100, 0.1), length + 1, 0.1), dict_values};
+  for (const auto& values : values_arrays) {
+    SCOPED_TRACE(values->type()->ToString());
+    auto chunked = SliceIntoChunks(values);
+    ASSERT_OK_AND_ASSIGN(auto compressed,
+                         CompressedChunkedArray::Make(*chunked, options_));
+    AssertTypeEqual(*compressed->type(), *values->type());
+    ASSERT_EQ(compressed->length(), chunked->length());
+    ASSERT_EQ(compressed->null_count(), chunked->null_count());
+    ASSERT_EQ(compressed->num_chunks(), chunked->num_chunks());
+    for (int i = 0; i < chunked->num_chunks(); ++i) {
+      ASSERT_EQ(compressed->chunk_length(i), chunked->chunk(i)->length());
+      ASSERT_OK_AND_ASSIGN(auto chunk, compressed->chunk(i));
+      ASSERT_OK(chunk->ValidateFull());
+      AssertArraysEqual(*chunked->chunk(i), *chunk);
+    }
+    ASSERT_OK_AND_ASSIGN(auto decompressed, compressed->Decompress());
+    ASSERT_OK(decompressed->ValidateFull());
+    AssertChunkedEqual(*chunked, *decompressed);
+  }
+}
+
+TEST_P(TestCompressedTable, CompressedSize) {
+  ASSERT_OK_AND_ASSIGN(auto values, MakeArrayFromScalar(Int64Scalar(42), 10000));
+  ChunkedArray chunked({values, values});
+  ASSERT_OK_AND_ASSIGN(auto compressed, CompressedChunkedArray::Make(chunked, options_));
+  ASSERT_EQ(compressed->uncompressed_size(), 2 * 10000 * sizeof(int64_t));
+  ASSERT_LT(compressed->compressed_size(), compressed->uncompressed_size() / 10);
+
+  // Small buffers are kept as is
+  ChunkedArray small(ArrayFromJSON(int8(), "[1, 2, 3]"));
+  ASSERT_OK_AND_ASSIGN(compressed, CompressedChunkedArray::Make(small, options_));
+  ASSERT_EQ(compressed->compressed_size(), 3);
+  ASSERT_EQ(compressed->uncompressed_size(), 3);
+}
+
+TEST_P(TestCompressedTable, ChunkCache) {
+  ChunkedArray chunked({ArrayFromJSON(int32(), "[1, 2]"), ArrayFromJSON(int32(), "[3]"),
+                        ArrayFromJSON(int32(), "[4, 5, 6]")});
+  options_.cache_size = 2;
+  ASSERT_OK_AND_ASSIGN(auto compressed, CompressedChunkedArray::Make(chunked, options_));
+  ASSERT_OK_AND_ASSIGN(auto first, compressed->chunk(0));
+  ASSERT_OK_AND_ASSIGN(auto second, compressed->chunk(0));
+  ASSERT_EQ(first, second);
+  // The least recently used chunk is evicted
+  ASSERT_OK_AND_ASSIGN(auto other, compressed->chunk(1));
+  ASSERT_OK_AND_ASSIGN(second, compressed->chunk(0));
+  ASSERT_EQ(first, second);
+  ASSERT_OK_AND_ASSIGN(other, compressed->chunk(2));
+  ASSERT_OK_AND_ASSIGN(second, compressed->chunk(0));
+  ASSERT_EQ(first, second);
+  ASSERT_OK_AND_ASSIGN(auto evicted, compressed->chunk(1));
+  ASSERT_NE(evicted, other);
+  AssertArraysEqual(*evicted, *chunked.chunk(1));
+
+  options_.cache_size = 0;
+  ASSERT_OK_AND_ASSIGN(compressed, CompressedChunkedArray::Make(chunked, options_));
+  ASSERT_OK_AND_ASSIGN(first, compressed->chunk(0));
+  ASSERT_OK_AND_ASSIGN(second, compressed->chunk(0));
+  ASSERT_NE(first, second);
+  AssertArraysEqual(*first, *second);
+}
+
+TEST_P(TestCompressedTable, Slice) {
+  auto chunked = ChunkedArrayFromJSON(int32(), {"[1, 2]", "[]", "[3, null, 5]", "[6]"});
+  ASSERT_OK_AND_ASSIGN(auto compressed, CompressedChunkedArray::Make(*chunked, options_));
+  for (int64_t offset = 0; offset <= chunked->length(); ++offset) {
+    for (int64_t length = 0; length <= chunked->length() - offset + 1; ++length) {
+      ASSERT_OK_AND_ASSIGN(auto slice, compressed->Slice(offset, length));
+      ASSERT_OK(slice->ValidateFull());
+      AssertChunkedEquivalent(*chunked->Slice(offset, length), *slice);
+    }
+  }
+  // Only the overlapping chunks are decompressed
+  ASSERT_OK_AND_ASSIGN(auto slice, compressed->Slice(3, 2));
+  ASSERT_EQ(slice->num_chunks(), 1);
+
+  ASSERT_RAISES(IndexError, compressed->Slice(-1, 1));
+  ASSERT_RAISES(IndexError, compressed->Slice(7, 1));
+  ASSERT_RAISES(IndexError, compressed->Slice(0, -1));
+}
+
+TEST_P(TestCompressedTable, Table) {
+  auto schm = schema({field("a", int32()), field("b", utf8())});
+  auto table = TableFromJSON(schm, {R"([{"a": null, "b": "yo"}, {"a": 1, "b": ""}])",
+                                    R"([{"a": 2, "b": "hello"}, {"a": 4, "b": "eh"}])"});
+  ASSERT_OK_AND_ASSIGN(auto compressed, CompressedTable::Make(*table, options_));
+  AssertSchemaEqual(*compressed->schema(), *schm);
+  ASSERT_EQ(compressed->num_columns(), 2);
+  ASSERT_EQ(compressed->num_rows(), 4);
+  ASSERT_EQ(compressed->column(1)->num_chunks(), 2);
+
+  ASSERT_OK_AND_ASSIGN(auto decompressed, compressed->Decompress());
+  ASSERT_OK(decompressed->ValidateFull());
+  AssertTablesEqual(*table, *decompressed);
+
+  ASSERT_OK_AND_ASSIGN(auto slice, compressed->Slice(1, 2));
+  ASSERT_OK(slice->ValidateFull());
+  AssertTablesEqual(*table->Slice(1, 2), *slice, /*same_chunk_layout=*/false);
+  ASSERT_OK_AND_ASSIGN(slice, compressed->Slice(3, 10));
+  ASSERT_EQ(slice->num_rows(), 1);
+}
+
+TEST(CompressedTable, NoCodec) {
+  InMemoryCompressionOptions options;
+  ChunkedArray chunked(ArrayFromJSON(int32(), "[1, 2]"));
+  ASSERT_RAISES(Invalid, CompressedChunkedArray::Make(chunked, options));
+}
+
+INSTANTIATE_TEST_SUITE_P(TestCompressedTable, TestCompressedTable,
+                         ::testing::Values(Compression::LZ4_FRAME, Compression::ZSTD,
+                                           Compression::SNAPPY));
+
+}  // namespace arrow
@@ -17,7 +17,14 @@
 
 #include "arrow/compute/api_aggregate.h"
 
+#include <utility>
+
 #include "arrow/compute/exec.h"
+#include "arrow/compute/exec_internal.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/registry.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/make_unique.h"
 
 namespace arrow {
 namespace compute {
@@ -55,5 +62,155 @@ Result<Datum> Variance(const Datum& value, const VarianceOptions& options,
   return CallFunction("variance", {value}, &options, ctx);
 }
 
+Result<Datum> ApproxCountDistinct(const Datum& value,
+                                  const ApproxCountDistinctOptions& options,
+                                  ExecContext* ctx) {
+  return CallFunction("approx_count_distinct", {value}, &options, ctx);
+}
+
+Result<Datum> ApproxQuantile(const Datum& value, const ApproxQuantileOptions& options,
+                             ExecContext* ctx) {
+  return CallFunction("approx_quantile", {value}, &options, ctx);
+}
+
+// ----------------------------------------------------------------------
+// Incremental scalar aggregation
+
+namespace {
+
+class ScalarAggregatorImpl : public ScalarAggregator {
+ public:
+  ScalarAggregatorImpl(std::shared_ptr<const ScalarAggregateFunction> func,
+                       const ScalarAggregateKernel* kernel,
+                       std::vector<ValueDescr> descrs, const FunctionOptions* options,
+                       ExecContext ctx)
+      : func_(std::move(func)),
+        kernel_(kernel),
+        descrs_(std::move(descrs)),
+        options_(options),
+        ctx_(std::move(ctx)),
+        kernel_ctx_(&ctx_) {}
+
+  Status Init() {
+    ARROW_ASSIGN_OR_RAISE(state_, InitState());
+    kernel_ctx_.SetState(state_.get());
+    return Status::OK();
+  }
+
+  Result<std::unique_ptr<ScalarAggregator>> MakeEmpty() const override {
+    auto other = ::arrow::internal::make_unique<ScalarAggregatorImpl>(
+        func_, kernel_, descrs_, options_, ctx_);
+    RETURN_NOT_OK(other->Init());
+    return std::move(other);
+  }
+
+  Status Consume(const ExecBatch& batch) override {
+    if (batch.num_values() != static_cast<int>(descrs_.size())) {
+      return Status::Invalid("Aggregation '", func_->name(), "' expected ",
+                             descrs_.size(), " arguments, got ", batch.num_values());
+    }
+    for (size_t i = 0; i < descrs_.size(); ++i) {
+      if (!batch[i].type()->Equals(*descrs_[i].type)) {
+        return Status::TypeError("Aggregation '", func_->name(), "' argument ", i,
+                                 " expected type ", *descrs_[i].type, ", got ",
+                                 *batch[i].type());
+      }
+    }
+    if (batch.length == 0) {
+      return Status::OK();
+    }
+
+    // As in the function executor, each batch is consumed into its own state
+    // which is then merged, since kernels are not required to accumulate
+    // across calls of consume
+    ARROW_ASSIGN_OR_RAISE(auto batch_state, InitState());
+    KernelContext batch_ctx(&ctx_);
+    batch_ctx.SetState(batch_state.get());
+    kernel_->consume(&batch_ctx, batch);
+    ARROW_CTX_RETURN_IF_ERROR(&batch_ctx);
+
+    kernel_->merge(&kernel_ctx_, std::move(*batch_state), state_.get());
+    ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx_);
+    return Status::OK();
+  }
+
+  Status Consume(const std::vector<Datum>& args) override {
+    ARROW_ASSIGN_OR_RAISE(auto batch_iterator, detail::ExecBatchIterator::Make(
+                                                   args, ctx_.exec_chunksize()));
+    ExecBatch batch;
+    while (batch_iterator->Next(&batch)) {
+      RETURN_NOT_OK(Consume(batch));
+    }
+    return Status::OK();
+  }
+
+  Status MergeFrom(ScalarAggregator&& other) override {
+    auto& other_impl = ::arrow::internal::checked_cast<ScalarAggregatorImpl&>(other);
+    if (other_impl.kernel_ != kernel_) {
+      return Status::Invalid("Cannot merge states of different aggregations");
+    }
+    kernel_->merge(&kernel_ctx_, std::move(*other_impl.state_), state_.get());
+    ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx_);
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    Datum out;
+    kernel_->finalize(&kernel_ctx_, &out);
+    ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx_);
+    return out;
+  }
+
+ private:
+  Result<std::unique_ptr<KernelState>> InitState() {
+    KernelContext init_ctx(&ctx_);
+    KernelInitArgs init_args{kernel_, descrs_, options_};
+    auto state = kernel_->init(&init_ctx, init_args);
+    ARROW_CTX_RETURN_IF_ERROR(&init_ctx);
+    if (state == nullptr) {
+      return Status::Invalid("ScalarAggregation requires non-null kernel state");
+    }
+    return std::move(state);
+  }
+
+  std::shared_ptr<const ScalarAggregateFunction> func_;
+  const ScalarAggregateKernel* kernel_;
+  std::vector<ValueDescr> descrs_;
+  const FunctionOptions* options_;
+  ExecContext ctx_;
+  KernelContext kernel_ctx_;
+  std::unique_ptr<KernelState> state_;
+};
+
+}  // namespace
+
+Result<std::unique_ptr<ScalarAggregator>> ScalarAggregator::Make(
+    const std::string& func_name, const std::vector<ValueDescr>& descrs,
+    const FunctionOptions* options, ExecContext* ctx) {
+  ExecContext exec_ctx = ctx != nullptr ? *ctx : ExecContext();
+  ARROW_ASSIGN_OR_RAISE(auto func, exec_ctx.func_registry()->GetFunction(func_name));
+  if (func->kind() != Function::SCALAR_AGGREGATE) {
+    return Status::Invalid("Function '", func_name,
+                           "' is not a scalar aggregate function");
+  }
+  const Arity& arity = func->arity();
+  if (!arity.is_varargs && static_cast<int>(descrs.size()) != arity.num_args) {
+    return Status::Invalid("Function '", func_name, "' accepts ", arity.num_args,
+                           " arguments but ", descrs.size(), " were given");
+  }
+  if (options == nullptr) {
+    options = func->default_options();
+  }
+
+  auto agg_func = ::arrow::internal::checked_pointer_cast<const ScalarAggregateFunction>(
+      std::move(func));
+  ARROW_ASSIGN_OR_RAISE(const ScalarAggregateKernel* kernel,
+                        agg_func->DispatchExact(descrs));
+  auto aggregator = ::arrow::internal::make_unique<ScalarAggregatorImpl>(
+      std::move(agg_func), kernel, descrs, options, std::move(exec_ctx));
+  RETURN_NOT_OK(aggregator->Init());
+  return std::move(aggregator);
+}
+
 }  // namespace compute
 }  // namespace arrow
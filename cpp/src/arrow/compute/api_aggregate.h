@@ -20,6 +20,12 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/compute/exec.h"
 #include "arrow/compute/function.h"
 #include "arrow/datum.h"
 #include "arrow/result.h"
@@ -88,6 +94,37 @@ struct ARROW_EXPORT VarianceOptions : public FunctionOptions {
   int ddof = 0;
 };
 
+/// \brief Control the accuracy of the approx_count_distinct kernel
+///
+/// The HyperLogLog sketch uses 2^precision bytes of state and has a relative
+/// standard error of about 1.04 / sqrt(2^precision).
+struct ARROW_EXPORT ApproxCountDistinctOptions : public FunctionOptions {
+  explicit ApproxCountDistinctOptions(int precision = 11) : precision(precision) {}
+
+  static ApproxCountDistinctOptions Defaults() { return ApproxCountDistinctOptions{}; }
+
+  /// The base 2 logarithm of the number of sketch registers, from 4 to 18
+  int precision;
+};
+
+/// \brief Control the approx_quantile kernel
+///
+/// By default, the approximate median is returned.
+struct ARROW_EXPORT ApproxQuantileOptions : public FunctionOptions {
+  explicit ApproxQuantileOptions(std::vector<double> q = {0.5}, uint32_t delta = 100,
+                                 uint32_t buffer_size = 500)
+      : q(std::move(q)), delta(delta), buffer_size(buffer_size) {}
+
+  static ApproxQuantileOptions Defaults() { return ApproxQuantileOptions{}; }
+
+  /// The quantiles to estimate, each between 0 and 1
+  std::vector<double> q;
+  /// The compression parameter of the t-digest: larger is more accurate
+  uint32_t delta;
+  /// The number of input values buffered before being merged into the digest
+  uint32_t buffer_size;
+};
+
 /// @}
 
 /// \brief Count non-null (or null) values in an array.
@@ -185,5 +222,122 @@ Result<Datum> Variance(const Datum& value,
                        const VarianceOptions& options = VarianceOptions::Defaults(),
                        ExecContext* ctx = NULLPTR);
 
+/// \brief Estimate the number of distinct non-null values of an array
+///
+/// The estimate comes from a HyperLogLog sketch of the value hashes, using
+/// memory independent of the input cardinality.
+///
+/// \param[in] value input datum, expecting Array or ChunkedArray
+/// \param[in] options see ApproxCountDistinctOptions for more information
+/// \param[in] ctx the function execution context, optional
+/// \return resulting datum as an Int64Scalar
+ARROW_EXPORT
+Result<Datum> ApproxCountDistinct(
+    const Datum& value,
+    const ApproxCountDistinctOptions& options = ApproxCountDistinctOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
+/// \brief Estimate quantiles of a numeric array
+///
+/// The estimates come from a t-digest of the non-null, non-NaN values.
+///
+/// \param[in] value input datum, expecting Array or ChunkedArray
+/// \param[in] options see ApproxQuantileOptions for more information
+/// \param[in] ctx the function execution context, optional
+/// \return resulting datum as a DoubleArray with one value per requested
+/// quantile, null if there are no input values
+ARROW_EXPORT
+Result<Datum> ApproxQuantile(
+    const Datum& value,
+    const ApproxQuantileOptions& options = ApproxQuantileOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
+/// \brief Incremental, mergeable evaluation of a scalar aggregate function
+///
+/// The aggregate functions above compute their result from a single input
+/// datum. A ScalarAggregator instead consumes its input batch by batch, and
+/// the partial states of several aggregators of the same aggregation can be
+/// merged. This allows e.g. one aggregator per thread of a dataset scan,
+/// merged into one before finalizing the result.
+///
+/// An aggregator must not be used from several threads concurrently.
+class ARROW_EXPORT ScalarAggregator {
+ public:
+  virtual ~ScalarAggregator() = default;
+
+  /// \brief Construct an aggregator with an empty state
+  ///
+  /// \param[in] func_name the name of a scalar aggregate function, e.g. "sum"
+  /// \param[in] descrs the descriptors of the arguments to aggregate
+  /// \param[in] options the function options, the function's defaults if null.
+  /// It must outlive the aggregator and any aggregator made from it.
+  /// \param[in] ctx the function execution context, optional
+  static Result<std::unique_ptr<ScalarAggregator>> Make(
+      const std::string& func_name, const std::vector<ValueDescr>& descrs,
+      const FunctionOptions* options = NULLPTR, ExecContext* ctx = NULLPTR);
+
+  /// \brief Construct another aggregator of the same aggregation, with an
+  /// empty state
+  virtual Result<std::unique_ptr<ScalarAggregator>> MakeEmpty() const = 0;
+
+  /// \brief Update the state with a batch of arguments
+  virtual Status Consume(const ExecBatch& batch) = 0;
+
+  /// \brief Update the state with array-like or scalar arguments, which are
+  /// split into batches as by CallFunction
+  virtual Status Consume(const std::vector<Datum>& args) = 0;
+
+  /// \brief Merge the state of another aggregator of the same aggregation into
+  /// this one. The other aggregator must not be used afterwards.
+  virtual Status MergeFrom(ScalarAggregator&& other) = 0;
+
+  /// \brief Compute the aggregate over all consumed (and merged) batches
+  virtual Result<Datum> Finalize() = 0;
+};
+
+namespace internal {
+
+/// \brief Configure a grouped aggregation
+struct ARROW_EXPORT Aggregate {
+  /// the name of the aggregation function
+  std::string function;
+
+  /// options for the aggregation function
+  const FunctionOptions* options;
+};
+
+/// Internal use only: helper function for testing HashAggregateKernels.
+/// This will be replaced by streaming execution operators.
+///
+/// The result is a StructArray with one field per aggregate, named after the
+/// aggregation function, followed by one field per key named "key_<i>".
+/// Null keys form their own group.
+ARROW_EXPORT
+Result<Datum> GroupBy(const std::vector<Datum>& arguments, const std::vector<Datum>& keys,
+                      const std::vector<Aggregate>& aggregates,
+                      ExecContext* ctx = NULLPTR);
+
+/// \brief Assign dense group ids to the distinct values of key columns
+class ARROW_EXPORT Grouper {
+ public:
+  virtual ~Grouper() = default;
+
+  /// Construct a Grouper which receives the specified key types
+  static Result<std::unique_ptr<Grouper>> Make(const std::vector<ValueDescr>& descrs,
+                                               ExecContext* ctx = NULLPTR);
+
+  /// Consume a batch of keys, producing the corresponding group ids as a uint32
+  /// array.
+  virtual Result<Datum> Consume(const ExecBatch& batch) = 0;
+
+  /// Get current unique keys, in group id order. May be called multiple times.
+  virtual Result<ExecBatch> GetUniques() = 0;
+
+  /// Get the current number of groups.
+  virtual uint32_t num_groups() const = 0;
+};
+
+}  // namespace internal
+
 }  // namespace compute
 }  // namespace arrow
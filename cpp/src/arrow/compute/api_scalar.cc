@@ -20,8 +20,10 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <utility>
 
 #include "arrow/compute/exec.h"
+#include "arrow/compute/kernels/scalar_set_lookup_internal.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 
@@ -56,9 +58,14 @@ SCALAR_ARITHMETIC_BINARY(Divide, "divide", "divide_checked")
 // ----------------------------------------------------------------------
 // Set-related operations
 
+SetLookupOptions::SetLookupOptions(Datum value_set, bool skip_nulls)
+    : value_set(std::move(value_set)),
+      skip_nulls(skip_nulls),
+      cache(std::make_shared<detail::SetLookupCache>()) {}
+
 static Result<Datum> ExecSetLookup(const std::string& func_name, const Datum& data,
-                                   const Datum& value_set, bool add_nulls_to_hash_table,
-                                   ExecContext* ctx) {
+                                   const SetLookupOptions& options, ExecContext* ctx) {
+  const Datum& value_set = options.value_set;
   if (!value_set.is_arraylike()) {
     return Status::Invalid("Set lookup value set must be Array or ChunkedArray");
   }
@@ -69,18 +76,27 @@ static Result<Datum> ExecSetLookup(const std::string& func_name, const Datum& da
        << " vs " << value_set.type()->ToString();
     return Status::Invalid(ss.str());
   }
-  SetLookupOptions options(value_set, !add_nulls_to_hash_table);
   return CallFunction(func_name, {data}, &options, ctx);
 }
 
 Result<Datum> IsIn(const Datum& values, const Datum& value_set, ExecContext* ctx) {
-  return ExecSetLookup("is_in", values, value_set,
-                       /*add_nulls_to_hash_table=*/false, ctx);
+  return ExecSetLookup("is_in", values,
+                       SetLookupOptions(value_set, /*skip_nulls=*/true), ctx);
+}
+
+Result<Datum> IsIn(const Datum& values, const SetLookupOptions& options,
+                   ExecContext* ctx) {
+  return ExecSetLookup("is_in", values, options, ctx);
 }
 
 Result<Datum> IndexIn(const Datum& values, const Datum& value_set, ExecContext* ctx) {
-  return ExecSetLookup("index_in", values, value_set,
-                       /*add_nulls_to_hash_table=*/true, ctx);
+  return ExecSetLookup("index_in", values,
+                       SetLookupOptions(value_set, /*skip_nulls=*/false), ctx);
+}
+
+Result<Datum> IndexIn(const Datum& values, const SetLookupOptions& options,
+                      ExecContext* ctx) {
+  return ExecSetLookup("index_in", values, options, ctx);
 }
 
 // ----------------------------------------------------------------------
@@ -131,5 +147,33 @@ Result<Datum> FillNull(const Datum& values, const Datum& fill_value, ExecContext
   return CallFunction("fill_null", {values, fill_value}, ctx);
 }
 
+// ----------------------------------------------------------------------
+// Hash functions
+
+Result<Datum> HashArray(const std::vector<Datum>& values, ExecContext* ctx) {
+  return CallFunction("hash_array", values, ctx);
+}
+
+// ----------------------------------------------------------------------
+// Temporal functions
+
+SCALAR_EAGER_UNARY(Year, "year")
+SCALAR_EAGER_UNARY(Month, "month")
+SCALAR_EAGER_UNARY(Day, "day")
+SCALAR_EAGER_UNARY(DayOfWeek, "day_of_week")
+SCALAR_EAGER_UNARY(DayOfYear, "day_of_year")
+SCALAR_EAGER_UNARY(Quarter, "quarter")
+SCALAR_EAGER_UNARY(Hour, "hour")
+SCALAR_EAGER_UNARY(Minute, "minute")
+SCALAR_EAGER_UNARY(Second, "second")
+SCALAR_EAGER_UNARY(Millisecond, "millisecond")
+SCALAR_EAGER_UNARY(Microsecond, "microsecond")
+SCALAR_EAGER_UNARY(Nanosecond, "nanosecond")
+
+Result<Datum> FloorTemporal(const Datum& values, FloorTemporalOptions options,
+                            ExecContext* ctx) {
+  return CallFunction("floor_temporal", {values}, &options, ctx);
+}
+
 }  // namespace compute
 }  // namespace arrow
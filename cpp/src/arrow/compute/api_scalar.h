@@ -20,8 +20,10 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/compute/exec.h"  // IWYU pragma: keep
 #include "arrow/compute/function.h"
@@ -33,6 +35,12 @@
 namespace arrow {
 namespace compute {
 
+namespace detail {
+
+class SetLookupCache;
+
+}  // namespace detail
+
 /// \addtogroup compute-concrete-options
 ///
 /// @{
@@ -45,10 +53,22 @@ struct ArithmeticOptions : public FunctionOptions {
 struct ARROW_EXPORT MatchSubstringOptions : public FunctionOptions {
   explicit MatchSubstringOptions(std::string pattern) : pattern(std::move(pattern)) {}
 
-  /// The exact substring to look for inside input values.
+  /// The exact substring (or, for match_regex, the regular expression) to look
+  /// for inside input values.
   std::string pattern;
 };
 
+struct ARROW_EXPORT MatchAnySubstringOptions : public FunctionOptions {
+  explicit MatchAnySubstringOptions(std::vector<std::string> patterns,
+                                    bool ignore_case = false)
+      : patterns(std::move(patterns)), ignore_case(ignore_case) {}
+
+  /// The exact substrings to look for inside input values.
+  std::vector<std::string> patterns;
+  /// Whether ASCII letters match regardless of their case.
+  bool ignore_case;
+};
+
 struct ARROW_EXPORT SplitOptions : public FunctionOptions {
   explicit SplitOptions(int64_t max_splits = -1, bool reverse = false)
       : max_splits(max_splits), reverse(reverse) {}
@@ -70,8 +90,7 @@ struct ARROW_EXPORT SplitPatternOptions : public SplitOptions {
 
 /// Options for IsIn and IndexIn functions
 struct ARROW_EXPORT SetLookupOptions : public FunctionOptions {
-  explicit SetLookupOptions(Datum value_set, bool skip_nulls)
-      : value_set(std::move(value_set)), skip_nulls(skip_nulls) {}
+  explicit SetLookupOptions(Datum value_set, bool skip_nulls);
 
   /// The set of values to look up input values into.
   Datum value_set;
@@ -82,6 +101,11 @@ struct ARROW_EXPORT SetLookupOptions : public FunctionOptions {
   /// If false, any null in `value_set` is successfully matched in
   /// the input.
   bool skip_nulls;
+
+  /// The hash table of `value_set`, built by the first call using these options
+  /// and shared with their copies, so that looking up many batches (possibly from
+  /// several threads) into the same value set builds it only once.
+  std::shared_ptr<detail::SetLookupCache> cache;
 };
 
 struct ARROW_EXPORT StrptimeOptions : public FunctionOptions {
@@ -107,6 +131,33 @@ struct CompareOptions : public FunctionOptions {
   enum CompareOperator op;
 };
 
+struct ARROW_EXPORT FloorTemporalOptions : public FunctionOptions {
+  enum Unit : int8_t {
+    NANOSECOND,
+    MICROSECOND,
+    MILLISECOND,
+    SECOND,
+    MINUTE,
+    HOUR,
+    DAY,
+    /// Weeks start on Monday
+    WEEK,
+    MONTH,
+    QUARTER,
+    YEAR,
+  };
+
+  explicit FloorTemporalOptions(int64_t multiple = 1, Unit unit = DAY)
+      : multiple(multiple), unit(unit) {}
+
+  static FloorTemporalOptions Defaults() { return FloorTemporalOptions(); }
+
+  /// Round down to a multiple of this many units, counted from the UNIX epoch.
+  /// Must be positive.
+  int64_t multiple;
+  Unit unit;
+};
+
 /// @}
 
 /// \brief Add two values together. Array values must be the same length. If
@@ -270,6 +321,20 @@ ARROW_EXPORT
 Result<Datum> IsIn(const Datum& values, const Datum& value_set,
                    ExecContext* ctx = NULLPTR);
 
+/// \brief IsIn returns true for each element of `values` that is contained in
+/// the value set of `options`
+///
+/// Unlike IsIn(values, value_set), the hash table of the value set is built once
+/// and reused by the calls passing the same options.
+///
+/// \param[in] values array-like input to look up in the value set
+/// \param[in] options the value set and whether its nulls count for lookup
+/// \param[in] ctx the function execution context, optional
+/// \return the resulting datum
+ARROW_EXPORT
+Result<Datum> IsIn(const Datum& values, const SetLookupOptions& options,
+                   ExecContext* ctx = NULLPTR);
+
 /// \brief IndexIn examines each slot in the values against a value_set array.
 /// If the value is not found in value_set, null will be output.
 /// If found, the index of occurrence within value_set (ignoring duplicates)
@@ -294,6 +359,20 @@ ARROW_EXPORT
 Result<Datum> IndexIn(const Datum& values, const Datum& value_set,
                       ExecContext* ctx = NULLPTR);
 
+/// \brief IndexIn examines each slot in the values against the value set of
+/// `options`
+///
+/// Unlike IndexIn(values, value_set), the hash table of the value set is built
+/// once and reused by the calls passing the same options.
+///
+/// \param[in] values array-like input
+/// \param[in] options the value set and whether its nulls count for lookup
+/// \param[in] ctx the function execution context, optional
+/// \return the resulting datum
+ARROW_EXPORT
+Result<Datum> IndexIn(const Datum& values, const SetLookupOptions& options,
+                      ExecContext* ctx = NULLPTR);
+
 /// \brief IsValid returns true for each element of `values` that is not null,
 /// false otherwise
 ///
@@ -333,5 +412,82 @@ ARROW_EXPORT
 Result<Datum> FillNull(const Datum& values, const Datum& fill_value,
                        ExecContext* ctx = NULLPTR);
 
+/// \brief HashArray computes a hash of each row of one or more arrays
+///
+/// The hashes of multiple arrays, e.g. the key columns of a table, are
+/// combined row by row. Equal values always hash equally, including nulls,
+/// so the hashes can be used for partitioning or for building bloom filters.
+/// They are not stable across Arrow versions.
+///
+/// \param[in] values arrays or chunked arrays of the same length
+/// \param[in] ctx the function execution context, optional
+/// \return a non-null uint64 datum
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> HashArray(const std::vector<Datum>& values, ExecContext* ctx = NULLPTR);
+
+/// \brief Year extracts the year of each date or timestamp value
+///
+/// The other components are extracted by Month, Day, DayOfWeek (from Monday
+/// as 0), DayOfYear (from January 1st as 1) and Quarter, and, for timestamps
+/// only, by Hour, Minute, Second, Millisecond, Microsecond and Nanosecond.
+/// Timestamps with a timezone are not supported.
+///
+/// \param[in] values input date or timestamp values
+/// \param[in] ctx the function execution context, optional
+/// \return an int64 Datum of the components
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> Year(const Datum& values, ExecContext* ctx = NULLPTR);
+
+ARROW_EXPORT
+Result<Datum> Month(const Datum& values, ExecContext* ctx = NULLPTR);
+
+ARROW_EXPORT
+Result<Datum> Day(const Datum& values, ExecContext* ctx = NULLPTR);
+
+ARROW_EXPORT
+Result<Datum> DayOfWeek(const Datum& values, ExecContext* ctx = NULLPTR);
+
+ARROW_EXPORT
+Result<Datum> DayOfYear(const Datum& values, ExecContext* ctx = NULLPTR);
+
+ARROW_EXPORT
+Result<Datum> Quarter(const Datum& values, ExecContext* ctx = NULLPTR);
+
+ARROW_EXPORT
+Result<Datum> Hour(const Datum& values, ExecContext* ctx = NULLPTR);
+
+ARROW_EXPORT
+Result<Datum> Minute(const Datum& values, ExecContext* ctx = NULLPTR);
+
+ARROW_EXPORT
+Result<Datum> Second(const Datum& values, ExecContext* ctx = NULLPTR);
+
+ARROW_EXPORT
+Result<Datum> Millisecond(const Datum& values, ExecContext* ctx = NULLPTR);
+
+ARROW_EXPORT
+Result<Datum> Microsecond(const Datum& values, ExecContext* ctx = NULLPTR);
+
+ARROW_EXPORT
+Result<Datum> Nanosecond(const Datum& values, ExecContext* ctx = NULLPTR);
+
+/// \brief FloorTemporal rounds each date or timestamp value down to a multiple
+/// of a calendar unit, e.g. to the start of its 15 minute interval
+///
+/// \param[in] values input date or timestamp values
+/// \param[in] options the multiple and unit to round down to
+/// \param[in] ctx the function execution context, optional
+/// \return a Datum of the same type as the input
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> FloorTemporal(
+    const Datum& values, FloorTemporalOptions options = FloorTemporalOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
 }  // namespace compute
 }  // namespace arrow
@@ -17,16 +17,23 @@
 
 #include "arrow/compute/api_vector.h"
 
+#include <algorithm>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "arrow/array/array_nested.h"
 #include "arrow/array/builder_primitive.h"
+#include "arrow/array/util.h"
+#include "arrow/compressed_table.h"
+#include "arrow/compute/cast.h"
 #include "arrow/compute/exec.h"
 #include "arrow/datum.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
+#include "arrow/table.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 
 namespace arrow {
@@ -35,6 +42,36 @@ using internal::checked_pointer_cast;
 
 namespace compute {
 
+// ----------------------------------------------------------------------
+// Function options
+
+namespace {
+
+SelectKOptions MakeSelectKOptions(int64_t k, const std::vector<std::string>& key_names,
+                                  SortOrder order) {
+  std::vector<SortKey> sort_keys;
+  for (const auto& name : key_names) {
+    sort_keys.emplace_back(name, order);
+  }
+  if (sort_keys.empty()) {
+    // An unnamed key, so that arrays are ordered as requested
+    sort_keys.emplace_back("", order);
+  }
+  return SelectKOptions(k, std::move(sort_keys));
+}
+
+}  // namespace
+
+SelectKOptions SelectKOptions::TopKDefault(int64_t k,
+                                           std::vector<std::string> key_names) {
+  return MakeSelectKOptions(k, key_names, SortOrder::Descending);
+}
+
+SelectKOptions SelectKOptions::BottomKDefault(int64_t k,
+                                              std::vector<std::string> key_names) {
+  return MakeSelectKOptions(k, key_names, SortOrder::Ascending);
+}
+
 // ----------------------------------------------------------------------
 // Direct exec interface to kernels
 
@@ -51,15 +88,109 @@ Result<std::shared_ptr<Array>> SortToIndices(const Array& values, ExecContext* c
   return result.make_array();
 }
 
+Result<std::shared_ptr<Array>> SortIndices(const Array& values, SortOrder order,
+                                           ExecContext* ctx) {
+  ArraySortOptions options(order);
+  ARROW_ASSIGN_OR_RAISE(
+      Datum result, CallFunction("array_sort_indices", {Datum(values)}, &options, ctx));
+  return result.make_array();
+}
+
+Result<std::shared_ptr<Array>> SortIndices(const ChunkedArray& chunked_array,
+                                           SortOrder order, ExecContext* ctx) {
+  SortOptions options({SortKey("not-used", order)});
+  return SortIndices(Datum(chunked_array), options, ctx);
+}
+
+Result<std::shared_ptr<Array>> SortIndices(const Datum& datum, const SortOptions& options,
+                                           ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(Datum result,
+                        CallFunction("sort_indices", {datum}, &options, ctx));
+  return result.make_array();
+}
+
+Result<std::shared_ptr<Array>> SelectKUnstable(const Datum& datum,
+                                               const SelectKOptions& options,
+                                               ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(Datum result,
+                        CallFunction("select_k_unstable", {datum}, &options, ctx));
+  return result.make_array();
+}
+
+Result<std::shared_ptr<ListArray>> HashPartitionIndices(
+    const Datum& datum, const HashPartitionOptions& options, ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(Datum result,
+                        CallFunction("hash_partition", {datum}, &options, ctx));
+  return checked_pointer_cast<ListArray>(result.make_array());
+}
+
+Result<RecordBatchVector> HashPartition(const RecordBatch& batch,
+                                        const HashPartitionOptions& options,
+                                        ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(auto indices, HashPartitionIndices(Datum(batch), options, ctx));
+  // Gather all partitions at once, then slice them apart
+  ARROW_ASSIGN_OR_RAISE(auto gathered, Take(batch, *indices->values(),
+                                            TakeOptions::NoBoundsCheck(), ctx));
+  RecordBatchVector partitions(indices->length());
+  for (int64_t i = 0; i < indices->length(); ++i) {
+    partitions[i] = gathered->Slice(indices->value_offset(i), indices->value_length(i));
+  }
+  return partitions;
+}
+
+Result<Datum> CumulativeSum(const Datum& values, ExecContext* ctx) {
+  return CallFunction("cumulative_sum", {values}, ctx);
+}
+
+Result<Datum> CumulativeMin(const Datum& values, ExecContext* ctx) {
+  return CallFunction("cumulative_min", {values}, ctx);
+}
+
+Result<Datum> CumulativeMax(const Datum& values, ExecContext* ctx) {
+  return CallFunction("cumulative_max", {values}, ctx);
+}
+
+Result<Datum> RollingMean(const Datum& values, const RollingWindowOptions& options,
+                          ExecContext* ctx) {
+  return CallFunction("rolling_mean", {values}, &options, ctx);
+}
+
+Result<Datum> Lag(const Datum& values, const ShiftOptions& options, ExecContext* ctx) {
+  return CallFunction("lag", {values}, &options, ctx);
+}
+
+Result<Datum> Lead(const Datum& values, const ShiftOptions& options, ExecContext* ctx) {
+  return CallFunction("lead", {values}, &options, ctx);
+}
+
+Result<Datum> RunEndEncode(const Datum& values, ExecContext* ctx) {
+  return CallFunction("run_end_encode", {values}, ctx);
+}
+
+Result<Datum> RunEndDecode(const Datum& encoded, ExecContext* ctx) {
+  return CallFunction("run_end_decode", {encoded}, ctx);
+}
+
 Result<std::shared_ptr<Array>> Unique(const Datum& value, ExecContext* ctx) {
   ARROW_ASSIGN_OR_RAISE(Datum result, CallFunction("unique", {value}, ctx));
   return result.make_array();
 }
 
+Result<std::shared_ptr<Array>> Unique(const Datum& value, const HashOptions& options,
+                                      ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(Datum result, CallFunction("unique", {value}, &options, ctx));
+  return result.make_array();
+}
+
 Result<Datum> DictionaryEncode(const Datum& value, ExecContext* ctx) {
   return CallFunction("dictionary_encode", {value}, ctx);
 }
 
+Result<Datum> DictionaryEncode(const Datum& value, const HashOptions& options,
+                               ExecContext* ctx) {
+  return CallFunction("dictionary_encode", {value}, &options, ctx);
+}
+
 const char kValuesFieldName[] = "values";
 const char kCountsFieldName[] = "counts";
 const int32_t kValuesFieldIndex = 0;
@@ -70,6 +201,14 @@ Result<std::shared_ptr<StructArray>> ValueCounts(const Datum& value, ExecContext
   return checked_pointer_cast<StructArray>(result.make_array());
 }
 
+Result<std::shared_ptr<StructArray>> ValueCounts(const Datum& value,
+                                                 const HashOptions& options,
+                                                 ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(Datum result,
+                        CallFunction("value_counts", {value}, &options, ctx));
+  return checked_pointer_cast<StructArray>(result.make_array());
+}
+
 // ----------------------------------------------------------------------
 // Filter- and take-related selection functions
 
@@ -93,6 +232,118 @@ Result<std::shared_ptr<Array>> Take(const Array& values, const Array& indices,
   return out.make_array();
 }
 
+namespace {
+
+Result<std::shared_ptr<Int64Array>> CastTakeIndices(const Array& indices,
+                                                    ExecContext* ctx) {
+  if (!is_integer(indices.type_id())) {
+    return Status::TypeError("Take indices must be integers, got ", *indices.type());
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum out,
+                        Cast(Datum(indices), int64(), CastOptions::Safe(), ctx));
+  return checked_pointer_cast<Int64Array>(out.make_array());
+}
+
+// Decompress the chunks the indices point into, and take from them with the
+// indices rebased onto the concatenation of those chunks
+Result<std::shared_ptr<ChunkedArray>> TakeCompressed(const CompressedChunkedArray& values,
+                                                     const Int64Array& indices,
+                                                     const TakeOptions& options,
+                                                     ExecContext* ctx) {
+  const int num_chunks = values.num_chunks();
+  // The end offset of each chunk in the array
+  std::vector<int64_t> chunk_ends(num_chunks);
+  int64_t length = 0;
+  for (int i = 0; i < num_chunks; ++i) {
+    length += values.chunk_length(i);
+    chunk_ends[i] = length;
+  }
+
+  std::vector<int> index_chunks(indices.length(), 0);
+  std::vector<bool> touched(num_chunks, false);
+  for (int64_t i = 0; i < indices.length(); ++i) {
+    if (indices.IsNull(i)) {
+      continue;
+    }
+    const int64_t index = indices.Value(i);
+    if (index < 0 || index >= length) {
+      return Status::IndexError("Index ", index, " out of bounds");
+    }
+    index_chunks[i] = static_cast<int>(
+        std::upper_bound(chunk_ends.begin(), chunk_ends.end(), index) -
+        chunk_ends.begin());
+    touched[index_chunks[i]] = true;
+  }
+
+  ArrayVector chunks;
+  // What to add to an index into each touched chunk to rebase it
+  std::vector<int64_t> rebase(num_chunks, 0);
+  int64_t taken_length = 0;
+  for (int i = 0; i < num_chunks; ++i) {
+    if (touched[i]) {
+      ARROW_ASSIGN_OR_RAISE(auto chunk, values.chunk(i));
+      rebase[i] = taken_length - (chunk_ends[i] - chunk->length());
+      taken_length += chunk->length();
+      chunks.push_back(std::move(chunk));
+    }
+  }
+  if (chunks.empty()) {
+    ARROW_ASSIGN_OR_RAISE(auto empty,
+                          MakeArrayOfNull(values.type(), 0, ctx->memory_pool()));
+    chunks.push_back(std::move(empty));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(
+      auto rebased_values,
+      AllocateBuffer(indices.length() * sizeof(int64_t), ctx->memory_pool()));
+  auto raw_rebased = reinterpret_cast<int64_t*>(rebased_values->mutable_data());
+  for (int64_t i = 0; i < indices.length(); ++i) {
+    raw_rebased[i] = indices.IsNull(i) ? 0 : indices.Value(i) + rebase[index_chunks[i]];
+  }
+  std::shared_ptr<Buffer> validity;
+  if (indices.null_count() > 0) {
+    ARROW_ASSIGN_OR_RAISE(
+        validity, ::arrow::internal::CopyBitmap(ctx->memory_pool(),
+                                                indices.null_bitmap_data(),
+                                                indices.offset(), indices.length()));
+  }
+  Int64Array rebased(indices.length(), std::move(rebased_values), std::move(validity),
+                     indices.null_count());
+
+  auto taken_values = std::make_shared<ChunkedArray>(std::move(chunks), values.type());
+  ARROW_ASSIGN_OR_RAISE(Datum out,
+                        Take(Datum(taken_values), Datum(rebased), options, ctx));
+  return out.chunked_array();
+}
+
+}  // namespace
+
+Result<std::shared_ptr<ChunkedArray>> Take(const CompressedChunkedArray& values,
+                                           const Array& indices,
+                                           const TakeOptions& options, ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return Take(values, indices, options, &default_ctx);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto int_indices, CastTakeIndices(indices, ctx));
+  return TakeCompressed(values, *int_indices, options, ctx);
+}
+
+Result<std::shared_ptr<Table>> Take(const CompressedTable& table, const Array& indices,
+                                    const TakeOptions& options, ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return Take(table, indices, options, &default_ctx);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto int_indices, CastTakeIndices(indices, ctx));
+  ChunkedArrayVector columns(table.num_columns());
+  for (int i = 0; i < table.num_columns(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(columns[i],
+                          TakeCompressed(*table.column(i), *int_indices, options, ctx));
+  }
+  return Table::Make(table.schema(), std::move(columns), indices.length());
+}
+
 // ----------------------------------------------------------------------
 // Deprecated functions
 
@@ -18,13 +18,21 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
+#include "arrow/compute/exec.h"
 #include "arrow/compute/function.h"
 #include "arrow/datum.h"
 #include "arrow/result.h"
 #include "arrow/type_fwd.h"
 
 namespace arrow {
+
+class CompressedChunkedArray;
+class CompressedTable;
+
 namespace compute {
 
 class ExecContext;
@@ -66,6 +74,134 @@ struct ARROW_EXPORT PartitionNthOptions : public FunctionOptions {
   int64_t pivot;
 };
 
+enum class SortOrder {
+  Ascending,
+  Descending,
+};
+
+/// \brief Where nulls are placed relative to non-null values when sorting
+enum class NullPlacement {
+  AtStart,
+  AtEnd,
+};
+
+/// \brief Options for the array_sort_indices function
+struct ARROW_EXPORT ArraySortOptions : public FunctionOptions {
+  explicit ArraySortOptions(SortOrder order = SortOrder::Ascending,
+                            NullPlacement null_placement = NullPlacement::AtEnd)
+      : order(order), null_placement(null_placement) {}
+
+  static ArraySortOptions Defaults() { return ArraySortOptions(); }
+
+  SortOrder order;
+  NullPlacement null_placement;
+};
+
+/// \brief One sort key: the name of a column and its sort order
+struct ARROW_EXPORT SortKey {
+  explicit SortKey(std::string name, SortOrder order = SortOrder::Ascending)
+      : name(std::move(name)), order(order) {}
+
+  bool Equals(const SortKey& other) const {
+    return name == other.name && order == other.order;
+  }
+
+  /// The name of the sort column
+  std::string name;
+  /// How to order by this sort key
+  SortOrder order;
+};
+
+/// \brief Options for the sort_indices function
+///
+/// When sorting a RecordBatch or a Table, the sort keys are compared
+/// lexicographically in the given order. When sorting an Array or a
+/// ChunkedArray, only the order of the first sort key is used (ascending if
+/// there are no sort keys).
+struct ARROW_EXPORT SortOptions : public FunctionOptions {
+  explicit SortOptions(std::vector<SortKey> sort_keys = {},
+                       NullPlacement null_placement = NullPlacement::AtEnd)
+      : sort_keys(std::move(sort_keys)), null_placement(null_placement) {}
+
+  static SortOptions Defaults() { return SortOptions(); }
+
+  std::vector<SortKey> sort_keys;
+  NullPlacement null_placement;
+};
+
+/// \brief Options for the select_k_unstable function
+///
+/// The sort keys have the same meaning as in SortOptions. Nulls are always
+/// considered greater than any other value, so they are only selected if
+/// there are fewer than k non-null values.
+struct ARROW_EXPORT SelectKOptions : public FunctionOptions {
+  explicit SelectKOptions(int64_t k = -1, std::vector<SortKey> sort_keys = {})
+      : k(k), sort_keys(std::move(sort_keys)) {}
+
+  /// Select the k largest values of the given columns
+  static SelectKOptions TopKDefault(int64_t k, std::vector<std::string> key_names = {});
+  /// Select the k smallest values of the given columns
+  static SelectKOptions BottomKDefault(int64_t k,
+                                       std::vector<std::string> key_names = {});
+
+  /// The number of values to select
+  int64_t k;
+  std::vector<SortKey> sort_keys;
+};
+
+/// \brief Options for the hash_partition function
+struct ARROW_EXPORT HashPartitionOptions : public FunctionOptions {
+  explicit HashPartitionOptions(int32_t num_partitions = 1,
+                                std::vector<std::string> key_names = {})
+      : num_partitions(num_partitions), key_names(std::move(key_names)) {}
+
+  /// The number of partitions to assign rows to
+  int32_t num_partitions;
+  /// The key columns of record batch or table input, unused for array input
+  std::vector<std::string> key_names;
+};
+
+/// \brief Options for the rolling window functions
+struct ARROW_EXPORT RollingWindowOptions : public FunctionOptions {
+  explicit RollingWindowOptions(int64_t window_size = 1)
+      : RollingWindowOptions(window_size, window_size) {}
+  RollingWindowOptions(int64_t window_size, int64_t min_periods)
+      : window_size(window_size), min_periods(min_periods) {}
+
+  /// The number of rows in a window, ending at the current row
+  int64_t window_size;
+  /// The minimum number of non-null values in a window for a non-null result
+  int64_t min_periods;
+};
+
+/// \brief Options for the lag and lead functions
+struct ARROW_EXPORT ShiftOptions : public FunctionOptions {
+  explicit ShiftOptions(int64_t periods = 1) : periods(periods) {}
+
+  static ShiftOptions Defaults() { return ShiftOptions(); }
+
+  /// The number of rows to shift values by, must not be negative
+  int64_t periods;
+};
+
+/// \brief Options for the unique, value_counts and dictionary_encode functions
+struct ARROW_EXPORT HashOptions : public FunctionOptions {
+  enum Order {
+    /// Distinct values are output in the order of their first occurrence
+    FIRST_SEEN,
+    /// Distinct values are output in ascending order, nulls and NaNs last. Only
+    /// for the types supported by sort_indices.
+    SORTED,
+  };
+
+  explicit HashOptions(Order order = FIRST_SEEN) : order(order) {}
+
+  static HashOptions Defaults() { return HashOptions(); }
+
+  /// The order of the distinct values (the dictionary, for dictionary_encode)
+  Order order;
+};
+
 /// @}
 
 /// \brief Filter with a boolean selection filter
@@ -134,6 +270,24 @@ Result<std::shared_ptr<Array>> Take(const Array& values, const Array& indices,
                                     const TakeOptions& options = TakeOptions::Defaults(),
                                     ExecContext* ctx = NULLPTR);
 
+/// \brief Take from a chunked array held compressed in memory
+///
+/// Only the chunks holding the taken values are decompressed.  Indices are
+/// always bounds-checked, since they are needed to locate the chunks.
+ARROW_EXPORT
+Result<std::shared_ptr<ChunkedArray>> Take(
+    const CompressedChunkedArray& values, const Array& indices,
+    const TakeOptions& options = TakeOptions::Defaults(), ExecContext* ctx = NULLPTR);
+
+/// \brief Take rows from a table held compressed in memory
+///
+/// \see Take(const CompressedChunkedArray&, const Array&, const TakeOptions&,
+/// ExecContext*)
+ARROW_EXPORT
+Result<std::shared_ptr<Table>> Take(const CompressedTable& table, const Array& indices,
+                                    const TakeOptions& options = TakeOptions::Defaults(),
+                                    ExecContext* ctx = NULLPTR);
+
 /// \brief Returns indices that partition an array around n-th
 /// sorted element.
 ///
@@ -168,6 +322,192 @@ ARROW_EXPORT
 Result<std::shared_ptr<Array>> SortToIndices(const Array& values,
                                              ExecContext* ctx = NULLPTR);
 
+/// \brief Returns the indices that would sort an array in the
+/// specified order.
+///
+/// Nulls will be stably partitioned to the end of the output.
+///
+/// \param[in] array array to sort
+/// \param[in] order ascending or descending
+/// \param[in] ctx the function execution context, optional
+/// \return offsets indices that would sort an array
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> SortIndices(const Array& array,
+                                           SortOrder order = SortOrder::Ascending,
+                                           ExecContext* ctx = NULLPTR);
+
+/// \brief Returns the indices that would sort a chunked array in the
+/// specified order.
+///
+/// The chunks are sorted independently, then merged, so that the chunked
+/// array is never concatenated. The output indices refer to the logical
+/// positions in the chunked array.
+///
+/// \param[in] chunked_array chunked array to sort
+/// \param[in] order ascending or descending
+/// \param[in] ctx the function execution context, optional
+/// \return offsets indices that would sort an array
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> SortIndices(const ChunkedArray& chunked_array,
+                                           SortOrder order = SortOrder::Ascending,
+                                           ExecContext* ctx = NULLPTR);
+
+/// \brief Returns the indices that would sort an input in the
+/// specified order. Input is one of array, chunked array, record batch
+/// or table.
+///
+/// For a record batch or a table, the rows are ordered lexicographically by
+/// the columns named in the sort keys, each in its own order.
+///
+/// For example given a record batch with columns a = [1, 1, 2, null] and
+/// b = [4, 3, 1, 2], sorting by (a ascending, b descending) gives
+/// [0, 1, 2, 3].
+///
+/// Chunked arrays, record batches and tables are sorted in parallel if the
+/// context enables threads. Take() the output to reorder the input.
+///
+/// \param[in] datum array-like or table-like input to sort
+/// \param[in] options the sort keys and the null placement
+/// \param[in] ctx the function execution context, optional
+/// \return offsets indices that would sort the input
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> SortIndices(const Datum& datum, const SortOptions& options,
+                                           ExecContext* ctx = NULLPTR);
+
+/// \brief Return the indices of the first k elements of an input in the
+/// order given by the sort keys. Input is one of array, chunked array, record
+/// batch or table.
+///
+/// This is equivalent to the first k indices of SortIndices, but only does
+/// O(n log k) work and memory proportional to k. The relative order of
+/// elements comparing equal is not specified.
+///
+/// \param[in] datum array-like or table-like input to select from
+/// \param[in] options the number of elements to select and the sort keys
+/// \param[in] ctx the function execution context, optional
+/// \return indices of the selected elements, in sorted order
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> SelectKUnstable(const Datum& datum,
+                                               const SelectKOptions& options,
+                                               ExecContext* ctx = NULLPTR);
+
+/// \brief Assign rows to partitions by hashing their keys
+///
+/// Rows with equal keys, including null keys, are always assigned the same
+/// partition, also across batches, so this can be used to shuffle data
+/// between workers or to split a grouped aggregation. Input is an array or
+/// chunked array (the values are the key), or a record batch or table along
+/// with the names of its key columns.
+///
+/// \param[in] datum array-like or table-like input to partition
+/// \param[in] options the number of partitions and the key columns
+/// \param[in] ctx the function execution context, optional
+/// \return a list<int64> array with one element per partition, holding the
+/// indices of the partition's rows in increasing order
+ARROW_EXPORT
+Result<std::shared_ptr<ListArray>> HashPartitionIndices(
+    const Datum& datum, const HashPartitionOptions& options, ExecContext* ctx = NULLPTR);
+
+/// \brief Split a record batch into partitions by hashing its key columns
+///
+/// The rows are assigned as by HashPartitionIndices, then gathered in a
+/// single pass over each column.
+///
+/// \param[in] batch the record batch to partition
+/// \param[in] options the number of partitions and the key columns
+/// \param[in] ctx the function execution context, optional
+/// \return one record batch per partition, possibly empty
+ARROW_EXPORT
+Result<RecordBatchVector> HashPartition(const RecordBatch& batch,
+                                        const HashPartitionOptions& options,
+                                        ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the cumulative sum of an array-like object
+///
+/// Null values yield nulls and are otherwise skipped. Integers are summed as
+/// 64-bit integers, floating-point values as doubles. Chunked arrays are
+/// summed across their chunks.
+///
+/// \param[in] values array-like input
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same length as the input
+ARROW_EXPORT
+Result<Datum> CumulativeSum(const Datum& values, ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the cumulative minimum of an array-like object
+///
+/// \param[in] values array-like input
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same type and length as the input
+ARROW_EXPORT
+Result<Datum> CumulativeMin(const Datum& values, ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the cumulative maximum of an array-like object
+///
+/// \param[in] values array-like input
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same type and length as the input
+ARROW_EXPORT
+Result<Datum> CumulativeMax(const Datum& values, ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the mean over a rolling window of rows
+///
+/// Each output value is the mean of the non-null values in the window of
+/// rows ending at the same position, or null if there are fewer than
+/// min_periods of them. This takes constant time per row, whatever the
+/// window size.
+///
+/// \param[in] values array-like input
+/// \param[in] options the window size and minimum number of values
+/// \param[in] ctx the function execution context, optional
+/// \return double result with the same length as the input
+ARROW_EXPORT
+Result<Datum> RollingMean(const Datum& values, const RollingWindowOptions& options,
+                          ExecContext* ctx = NULLPTR);
+
+/// \brief Shift values forward, so that each output value is the value
+/// options.periods rows before, or null
+///
+/// \param[in] values array-like input
+/// \param[in] options the number of rows to shift by
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same type and length as the input
+ARROW_EXPORT
+Result<Datum> Lag(const Datum& values, const ShiftOptions& options = ShiftOptions(),
+                  ExecContext* ctx = NULLPTR);
+
+/// \brief Shift values backward, so that each output value is the value
+/// options.periods rows after, or null
+///
+/// \param[in] values array-like input
+/// \param[in] options the number of rows to shift by
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same type and length as the input
+ARROW_EXPORT
+Result<Datum> Lead(const Datum& values, const ShiftOptions& options = ShiftOptions(),
+                   ExecContext* ctx = NULLPTR);
+
+/// \brief Run-end encode an array-like object
+///
+/// The result has one row per run of equal consecutive values, as a
+/// struct<run_ends: int32, values> array whose "run_ends" field holds the
+/// exclusive end position of each run. Nulls are equal to each other.
+/// Chunks of a chunked array are encoded separately.
+///
+/// \param[in] values array-like input
+/// \param[in] ctx the function execution context, optional
+/// \return struct result with one row per run
+ARROW_EXPORT
+Result<Datum> RunEndEncode(const Datum& values, ExecContext* ctx = NULLPTR);
+
+/// \brief Decode a run-end encoded array-like object, as returned by RunEndEncode
+///
+/// \param[in] encoded struct<run_ends: int32, values> array-like input
+/// \param[in] ctx the function execution context, optional
+/// \return result with the type of the values, one row per encoded position
+ARROW_EXPORT
+Result<Datum> RunEndDecode(const Datum& encoded, ExecContext* ctx = NULLPTR);
+
 /// \brief Compute unique elements from an array-like object
 ///
 /// Note if a null occurs in the input it will NOT be included in the output.
@@ -181,6 +521,19 @@ Result<std::shared_ptr<Array>> SortToIndices(const Array& values,
 ARROW_EXPORT
 Result<std::shared_ptr<Array>> Unique(const Datum& datum, ExecContext* ctx = NULLPTR);
 
+/// \brief Compute unique elements from an array-like object, in the given order
+///
+/// If the ExecContext enables threads, the chunks of a ChunkedArray are hashed
+/// concurrently, the output being the same as without threads.
+///
+/// \param[in] datum array-like input
+/// \param[in] options the order of the unique elements
+/// \param[in] ctx the function execution context, optional
+/// \return result as Array
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> Unique(const Datum& datum, const HashOptions& options,
+                                      ExecContext* ctx = NULLPTR);
+
 // Constants for accessing the output of ValueCounts
 ARROW_EXPORT extern const char kValuesFieldName[];
 ARROW_EXPORT extern const char kCountsFieldName[];
@@ -205,6 +558,18 @@ ARROW_EXPORT
 Result<std::shared_ptr<StructArray>> ValueCounts(const Datum& value,
                                                  ExecContext* ctx = NULLPTR);
 
+/// \brief Return counts of unique elements from an array-like object, the unique
+/// elements in the given order
+///
+/// \param[in] value array-like input
+/// \param[in] options the order of the unique elements
+/// \param[in] ctx the function execution context, optional
+/// \return counts An array of  <input type "Values", int64_t "Counts"> structs.
+ARROW_EXPORT
+Result<std::shared_ptr<StructArray>> ValueCounts(const Datum& value,
+                                                 const HashOptions& options,
+                                                 ExecContext* ctx = NULLPTR);
+
 /// \brief Dictionary-encode values in an array-like object
 /// \param[in] data array-like input
 /// \param[in] ctx the function execution context, optional
@@ -215,6 +580,161 @@ Result<std::shared_ptr<StructArray>> ValueCounts(const Datum& value,
 ARROW_EXPORT
 Result<Datum> DictionaryEncode(const Datum& data, ExecContext* ctx = NULLPTR);
 
+/// \brief Dictionary-encode values in an array-like object, the dictionary in the
+/// given order
+///
+/// \param[in] data array-like input
+/// \param[in] options the order of the dictionary
+/// \param[in] ctx the function execution context, optional
+/// \return result with same shape and type as input
+ARROW_EXPORT
+Result<Datum> DictionaryEncode(const Datum& data, const HashOptions& options,
+                               ExecContext* ctx = NULLPTR);
+
+namespace internal {
+
+/// \brief The kind of join performed by a HashJoin
+enum class JoinType {
+  /// Emit every pair of matching probe and build rows
+  INNER,
+  /// Like INNER, additionally emitting unmatched probe rows with null build
+  /// columns
+  LEFT_OUTER,
+  /// Emit each probe row having at least one match, once, without build columns
+  LEFT_SEMI,
+  /// Emit each probe row having no match, without build columns
+  LEFT_ANTI,
+};
+
+/// \brief Equi-join a build side table with a stream of probe side batches
+///
+/// A hash table is built once over the key columns of the build side (which
+/// should be the smaller input), then each probe side batch is probed against
+/// it. Null keys never match. Keys may span several columns; probe keys must
+/// have the same types as the corresponding build keys.
+///
+/// \note API not yet finalized
+class ARROW_EXPORT HashJoin {
+ public:
+  virtual ~HashJoin() = default;
+
+  /// \brief Build the hash table over the build side
+  ///
+  /// \param[in] join_type the kind of join to perform
+  /// \param[in] build_side the build side table
+  /// \param[in] build_keys the indices of the key columns in build_side
+  /// \param[in] ctx the function execution context, optional
+  static Result<std::unique_ptr<HashJoin>> Make(JoinType join_type,
+                                                std::shared_ptr<Table> build_side,
+                                                std::vector<int> build_keys,
+                                                ExecContext* ctx = NULLPTR);
+
+  /// \brief Compute the indices of matching rows for a batch of probe keys
+  ///
+  /// The result has two int64 columns: indices into the probe batch and
+  /// indices into the build side. For LEFT_OUTER, unmatched probe rows get a
+  /// null build index. For LEFT_SEMI and LEFT_ANTI, the build indices column
+  /// is omitted.
+  virtual Result<ExecBatch> ProbeIndices(const ExecBatch& probe_keys) = 0;
+
+  /// \brief Join a probe side batch, materializing the output
+  ///
+  /// The output contains the probe side columns followed by the build side
+  /// columns (except for LEFT_SEMI and LEFT_ANTI, which only emit probe side
+  /// columns).
+  ///
+  /// \param[in] probe_side a batch of the probe side
+  /// \param[in] probe_keys the indices of the key columns in probe_side
+  virtual Result<std::shared_ptr<RecordBatch>> Probe(
+      const RecordBatch& probe_side, const std::vector<int>& probe_keys) = 0;
+
+  /// The schema of the batches produced by Probe() for a probe side schema
+  virtual Result<std::shared_ptr<Schema>> OutputSchema(
+      const Schema& probe_schema) const = 0;
+};
+
+/// \brief An index of the values of a column for point lookups
+///
+/// Each distinct value is mapped by a hash table to the rows holding it, so
+/// that the rows equal to a key are found in constant time rather than by an
+/// "equal" and "filter" scan of the column. The index is extended as chunks
+/// are appended to the column, e.g. as record batches are appended to a table.
+/// Like with "equal", null and NaN values never match.
+///
+/// Boolean, numeric, temporal and base binary columns are supported.
+///
+/// \note API not yet finalized
+class ARROW_EXPORT HashIndex {
+ public:
+  virtual ~HashIndex() = default;
+
+  /// \brief Make an empty index for a column of the given type
+  static Result<std::unique_ptr<HashIndex>> Make(std::shared_ptr<DataType> type,
+                                                 ExecContext* ctx = NULLPTR);
+
+  /// \brief Index a chunk of values appended to the column
+  virtual Status Append(const Array& values) = 0;
+
+  /// \brief Index the chunks of values appended to the column
+  Status Append(const ChunkedArray& values);
+
+  /// \brief Compute the indices of the rows equal to some keys
+  ///
+  /// \param[in] keys a scalar, array or chunked array of the column's type
+  /// \return int64 indices, suitable for Take, of the rows equal to each key in
+  /// turn, in ascending order for each key
+  virtual Result<std::shared_ptr<Array>> Lookup(const Datum& keys) = 0;
+
+  /// The number of rows indexed
+  virtual int64_t num_rows() const = 0;
+};
+
+/// \brief An index of the values of a column for range lookups
+///
+/// The rows are kept in the order of their values, as computed by
+/// SortIndices, so that the rows with values in a range are found by binary
+/// search in logarithmic time rather than by a comparison and "filter" scan of
+/// the column. Each chunk appended to the column is sorted on its own, then
+/// merged into the index in linear time. Null and NaN values are in no range.
+///
+/// Boolean, numeric, temporal and base binary columns are supported.
+///
+/// \note API not yet finalized
+class ARROW_EXPORT SortedIndex {
+ public:
+  virtual ~SortedIndex() = default;
+
+  /// \brief Make an empty index for a column of the given type
+  static Result<std::unique_ptr<SortedIndex>> Make(std::shared_ptr<DataType> type,
+                                                   ExecContext* ctx = NULLPTR);
+
+  /// \brief Index a chunk of values appended to the column
+  virtual Status Append(const Array& values) = 0;
+
+  /// \brief Index the chunks of values appended to the column
+  Status Append(const ChunkedArray& values);
+
+  /// \brief Compute the indices of the rows with values in a range
+  ///
+  /// A null bound gives an empty range.
+  ///
+  /// \param[in] lower the lower bound of the range, or NULLPTR if unbounded
+  /// \param[in] upper the upper bound of the range, or NULLPTR if unbounded
+  /// \param[in] lower_inclusive whether values equal to lower are in the range
+  /// \param[in] upper_inclusive whether values equal to upper are in the range
+  /// \return int64 indices, suitable for Take, of the rows in the range, in
+  /// ascending order of values then of rows
+  virtual Result<std::shared_ptr<Array>> Range(const std::shared_ptr<Scalar>& lower,
+                                               const std::shared_ptr<Scalar>& upper,
+                                               bool lower_inclusive = true,
+                                               bool upper_inclusive = true) = 0;
+
+  /// The number of rows indexed
+  virtual int64_t num_rows() const = 0;
+};
+
+}  // namespace internal
+
 // ----------------------------------------------------------------------
 // Deprecated functions
 
@@ -20,7 +20,13 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -30,12 +36,17 @@
 #include "arrow/array/util.h"
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec_internal.h"
+#include "arrow/compute/exec_stats.h"
 #include "arrow/compute/function.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/registry.h"
 #include "arrow/compute/util_internal.h"
 #include "arrow/datum.h"
+#include "arrow/device.h"
+#include "arrow/extension_type.h"
 #include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
@@ -45,6 +56,9 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/stopwatch.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -52,6 +66,7 @@ using internal::BitmapAnd;
 using internal::checked_cast;
 using internal::CopyBitmap;
 using internal::CpuInfo;
+using internal::OptionalParallelFor;
 
 namespace compute {
 
@@ -84,6 +99,19 @@ Status GetValueDescriptors(const std::vector<Datum>& args,
   return Status::OK();
 }
 
+std::string FormatDescrs(const std::vector<ValueDescr>& descrs) {
+  std::stringstream ss;
+  ss << "(";
+  for (size_t i = 0; i < descrs.size(); ++i) {
+    if (i > 0) {
+      ss << ", ";
+    }
+    ss << descrs[i].ToString();
+  }
+  ss << ")";
+  return ss.str();
+}
+
 }  // namespace
 
 namespace detail {
@@ -415,6 +443,57 @@ Status PropagateNulls(KernelContext* ctx, const ExecBatch& batch, ArrayData* out
   return propagator.Execute();
 }
 
+namespace {
+
+// Like PropagateNulls, but for the rows picked by the batch's selection
+// vector. The output bitmap is gathered bit by bit.
+Status PropagateNullsSelected(KernelContext* ctx, const ExecBatch& batch,
+                              ArrayData* output) {
+  const SelectionVector& selection = *batch.selection_vector;
+  const int64_t length = selection.length();
+  const int32_t* indices = selection.indices();
+
+  bool all_null = false;
+  std::vector<const ArrayData*> arrays_with_nulls;
+  for (const Datum& value : batch.values) {
+    if (value.is_scalar()) {
+      all_null |= !value.scalar()->is_valid;
+    } else if (value.type()->id() == Type::NA) {
+      all_null = true;
+    } else if (value.array()->MayHaveNulls()) {
+      arrays_with_nulls.push_back(value.array().get());
+    }
+  }
+  if (!all_null && arrays_with_nulls.empty()) {
+    output->buffers[0] = nullptr;
+    output->null_count = 0;
+    return Status::OK();
+  }
+  if (output->buffers[0] == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(output->buffers[0], ctx->AllocateBitmap(length));
+  }
+  uint8_t* out_bitmap = output->buffers[0]->mutable_data();
+  if (all_null) {
+    BitUtil::SetBitsTo(out_bitmap, output->offset, length, false);
+    output->null_count = length;
+    return Status::OK();
+  }
+
+  int64_t null_count = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    bool valid = true;
+    for (const ArrayData* array : arrays_with_nulls) {
+      valid &= BitUtil::GetBit(array->buffers[0]->data(), array->offset + indices[i]);
+    }
+    BitUtil::SetBitTo(out_bitmap, output->offset + i, valid);
+    null_count += !valid;
+  }
+  output->null_count = null_count;
+  return Status::OK();
+}
+
+}  // namespace
+
 std::shared_ptr<ChunkedArray> ToChunkedArray(const std::vector<Datum>& values,
                                              const std::shared_ptr<DataType>& type) {
   std::vector<std::shared_ptr<Array>> arrays;
@@ -429,6 +508,34 @@ std::shared_ptr<ChunkedArray> ToChunkedArray(const std::vector<Datum>& values,
   return std::make_shared<ChunkedArray>(arrays, type);
 }
 
+// Whether any of the values may be null, without counting nulls
+bool ValuesMayHaveNulls(const std::vector<Datum>& values) {
+  for (const auto& value : values) {
+    switch (value.kind()) {
+      case Datum::SCALAR:
+        if (!value.scalar()->is_valid) {
+          return true;
+        }
+        break;
+      case Datum::ARRAY:
+        if (ArrayHasNulls(*value.array())) {
+          return true;
+        }
+        break;
+      case Datum::CHUNKED_ARRAY:
+        for (const auto& chunk : value.chunked_array()->chunks()) {
+          if (ArrayHasNulls(*chunk->data())) {
+            return true;
+          }
+        }
+        break;
+      default:
+        return true;
+    }
+  }
+  return false;
+}
+
 bool HaveChunkedArray(const std::vector<Datum>& values) {
   for (const auto& value : values) {
     if (value.kind() == Datum::CHUNKED_ARRAY) {
@@ -453,7 +560,11 @@ class FunctionExecutorImpl : public FunctionExecutor {
  public:
   FunctionExecutorImpl(ExecContext* exec_ctx, const FunctionType* func,
                        const FunctionOptions* options)
-      : exec_ctx_(exec_ctx), kernel_ctx_(exec_ctx), func_(func), options_(options) {}
+      : exec_ctx_(exec_ctx),
+        kernel_ctx_(exec_ctx),
+        func_(func),
+        kernel_(NULLPTR),
+        options_(options) {}
 
  protected:
   using KernelType = typename FunctionType::KernelType;
@@ -479,17 +590,103 @@ class FunctionExecutorImpl : public FunctionExecutor {
   }
 
   Status BindArgs(const std::vector<Datum>& args) {
+    if (prepared_) {
+      RETURN_NOT_OK(CheckPreparedArgs(args));
+      if (func_->kind() != Function::SCALAR) {
+        RETURN_NOT_OK(InitStateAndResolveOutput());
+      }
+      return SetupArgIteration(args);
+    }
     RETURN_NOT_OK(GetValueDescriptors(args, &input_descrs_));
     ARROW_ASSIGN_OR_RAISE(kernel_, func_->DispatchExact(input_descrs_));
+    RETURN_NOT_OK(InitStateAndResolveOutput());
+    return SetupArgIteration(args);
+  }
 
+  Status InitStateAndResolveOutput() {
     // Initialize kernel state, since type resolution may depend on this state
     RETURN_NOT_OK(this->InitState());
 
     // Resolve the output descriptor for this kernel
     ARROW_ASSIGN_OR_RAISE(output_descr_, kernel_->signature->out_type().Resolve(
                                              &kernel_ctx_, input_descrs_));
+    return Status::OK();
+  }
 
-    return SetupArgIteration(args);
+  Status Prepare(const std::vector<ValueDescr>& descrs) override {
+    input_descrs_ = descrs;
+    ARROW_ASSIGN_OR_RAISE(kernel_, func_->DispatchExact(input_descrs_));
+    RETURN_NOT_OK(InitStateAndResolveOutput());
+    prepared_ = true;
+    return Status::OK();
+  }
+
+  Status CheckPreparedArgs(const std::vector<Datum>& args) const {
+    bool matches = args.size() == input_descrs_.size();
+    for (size_t i = 0; matches && i < args.size(); ++i) {
+      matches = args[i].descr() == input_descrs_[i];
+    }
+    if (!matches) {
+      std::vector<ValueDescr> descrs;
+      RETURN_NOT_OK(GetValueDescriptors(args, &descrs));
+      return Status::TypeError("Function ", func_->name(), " was prepared for ",
+                               FormatDescrs(input_descrs_), " but executed with ",
+                               FormatDescrs(descrs));
+    }
+    return Status::OK();
+  }
+
+  template <typename ExecutorType>
+  std::unique_ptr<FunctionExecutor> ClonePreparedAs(ExecContext* ctx) const {
+    DCHECK(prepared_);
+    std::unique_ptr<ExecutorType> clone(new ExecutorType(ctx, func_, options_));
+    FunctionExecutorImpl* impl = clone.get();
+    impl->kernel_ = kernel_;
+    impl->input_descrs_ = input_descrs_;
+    impl->output_descr_ = output_descr_;
+    if (func_->kind() == Function::SCALAR) {
+      impl->state_ = state_;
+      impl->kernel_ctx_.SetState(state_.get());
+    }
+    impl->prepared_ = true;
+    return std::move(clone);
+  }
+
+  // If threads are enabled and the arguments were split into several batches,
+  // gather the batches (and their start positions) so that they can be
+  // executed in parallel. Otherwise the batches are executed serially as they
+  // are produced by batch_iterator_.
+  void CollectParallelBatches() {
+    parallel_batches_.clear();
+    parallel_positions_.clear();
+    if (!exec_ctx_->use_threads() || GetCpuThreadPoolCapacity() <= 1) {
+      return;
+    }
+    ExecBatch batch;
+    while (batch_iterator_->Next(&batch)) {
+      parallel_positions_.push_back(batch_iterator_->position() - batch.length);
+      parallel_batches_.push_back(std::move(batch));
+    }
+  }
+
+  // Execute the collected batches in parallel (unless use_threads is false),
+  // each with its own KernelContext (the kernel state is shared). The outputs
+  // are returned in batch order. A single batch is executed on the calling
+  // thread.
+  template <typename ExecuteBatchFn>
+  Result<std::vector<Datum>> ExecuteParallelBatches(bool use_threads,
+                                                    ExecuteBatchFn&& execute_batch) {
+    std::vector<Datum> outputs(parallel_batches_.size());
+    RETURN_NOT_OK(OptionalParallelFor(
+        use_threads && parallel_batches_.size() > 1,
+        static_cast<int>(parallel_batches_.size()),
+        [&](int i) -> Status {
+          KernelContext batch_ctx(exec_ctx_);
+          batch_ctx.SetState(state_.get());
+          return execute_batch(&batch_ctx, parallel_batches_[i], parallel_positions_[i],
+                               &outputs[i]);
+        }));
+    return outputs;
   }
 
   Result<std::shared_ptr<ArrayData>> PrepareOutput(int64_t length) {
@@ -497,18 +694,52 @@ class FunctionExecutorImpl : public FunctionExecutor {
     out->buffers.resize(output_num_buffers_);
 
     if (validity_preallocated_) {
-      ARROW_ASSIGN_OR_RAISE(out->buffers[0], kernel_ctx_.AllocateBitmap(length));
+      const int64_t nbytes = BitUtil::BytesForBits(length);
+      if (auto buffer = TakeOutputBuffer(0, nbytes)) {
+        // Zeroed like a fresh bitmap, see KernelContext::AllocateBitmap
+        std::memset(buffer->mutable_data(), 0, static_cast<size_t>(nbytes));
+        out->buffers[0] = std::move(buffer);
+      } else {
+        ARROW_ASSIGN_OR_RAISE(out->buffers[0], kernel_ctx_.AllocateBitmap(length));
+      }
     }
     if (data_preallocated_) {
       const auto& fw_type = checked_cast<const FixedWidthType&>(*out->type);
-      ARROW_ASSIGN_OR_RAISE(
-          out->buffers[1], AllocateDataBuffer(&kernel_ctx_, length, fw_type.bit_width()));
+      const int bit_width = fw_type.bit_width();
+      const int64_t nbytes =
+          bit_width == 1 ? BitUtil::BytesForBits(length) : length * bit_width / 8;
+      if (auto buffer = TakeOutputBuffer(1, nbytes)) {
+        if (bit_width == 1) {
+          std::memset(buffer->mutable_data(), 0, static_cast<size_t>(nbytes));
+        }
+        out->buffers[1] = std::move(buffer);
+      } else {
+        ARROW_ASSIGN_OR_RAISE(out->buffers[1],
+                              AllocateDataBuffer(&kernel_ctx_, length, bit_width));
+      }
     }
     return out;
   }
 
+  // Return the caller-provided output buffer `i` if it can hold `nbytes`, or
+  // null. Each buffer is returned at most once.
+  std::shared_ptr<Buffer> TakeOutputBuffer(size_t i, int64_t nbytes) {
+    std::lock_guard<std::mutex> lock(output_buffers_mutex_);
+    if (i >= output_buffers_.size() || output_buffers_[i] == nullptr ||
+        !output_buffers_[i]->is_mutable() || output_buffers_[i]->size() < nbytes) {
+      return nullptr;
+    }
+    return std::move(output_buffers_[i]);
+  }
+
+  void SetOutputBuffers(BufferVector buffers) override {
+    output_buffers_ = std::move(buffers);
+  }
+
   ValueDescr output_descr() const override { return output_descr_; }
 
+  const Kernel* kernel() const override { return kernel_; }
+
   // Not all of these members are used for every executor type
 
   ExecContext* exec_ctx_;
@@ -516,11 +747,14 @@ class FunctionExecutorImpl : public FunctionExecutor {
   const FunctionType* func_;
   const KernelType* kernel_;
   std::unique_ptr<ExecBatchIterator> batch_iterator_;
-  std::unique_ptr<KernelState> state_;
+  std::shared_ptr<KernelState> state_;
   std::vector<ValueDescr> input_descrs_;
   ValueDescr output_descr_;
   const FunctionOptions* options_;
 
+  // If true, the kernel was dispatched once by Prepare() for all calls
+  bool prepared_ = false;
+
   int output_num_buffers_;
 
   // If true, then the kernel writes into a preallocated data buffer
@@ -529,6 +763,20 @@ class FunctionExecutorImpl : public FunctionExecutor {
   // If true, then memory is preallocated for the validity bitmap with the same
   // strategy as the data buffer(s).
   bool validity_preallocated_ = false;
+
+  // If true, then the kernel intersects the validity of arguments that have
+  // no nulls: the output has no validity bitmap at all
+  bool validity_elided_ = false;
+
+  // The batches to execute in parallel, and their start positions in the
+  // arguments. Empty for serial execution
+  std::vector<ExecBatch> parallel_batches_;
+  std::vector<int64_t> parallel_positions_;
+
+  // The caller's buffers to write the output into, see SetOutputBuffers.
+  // Batches executed in parallel may prepare their outputs concurrently.
+  BufferVector output_buffers_;
+  std::mutex output_buffers_mutex_;
 };
 
 class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
@@ -538,11 +786,41 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
   using BASE = FunctionExecutorImpl<ScalarFunction>;
   using BASE::BASE;
 
+  std::unique_ptr<FunctionExecutor> ClonePrepared(ExecContext* ctx) const override {
+    return ClonePreparedAs<ScalarExecutor>(ctx);
+  }
+
   Status Execute(const std::vector<Datum>& args, ExecListener* listener) override {
     RETURN_NOT_OK(PrepareExecute(args));
-    ExecBatch batch;
-    while (batch_iterator_->Next(&batch)) {
-      RETURN_NOT_OK(ExecuteBatch(batch, listener));
+    if (!parallel_batches_.empty()) {
+      // Bitmaps are written byte by byte, so batches can only write
+      // concurrently into slices of a contiguous preallocation if these don't
+      // share bytes
+      const bool use_threads = !preallocate_contiguous_ || ParallelSlicesByteAligned();
+      ARROW_ASSIGN_OR_RAISE(
+          auto outputs,
+          ExecuteParallelBatches(use_threads, [this](KernelContext* ctx,
+                                                     const ExecBatch& batch,
+                                                     int64_t position, Datum* out) {
+            return ExecuteBatch(ctx, batch, position, out);
+          }));
+      if (!preallocate_contiguous_) {
+        for (auto& out : outputs) {
+          RETURN_NOT_OK(listener->OnResult(std::move(out)));
+        }
+      }
+    } else {
+      ExecBatch batch;
+      while (batch_iterator_->Next(&batch)) {
+        Datum out;
+        RETURN_NOT_OK(ExecuteBatch(&kernel_ctx_, batch,
+                                   batch_iterator_->position() - batch.length, &out));
+        if (!preallocate_contiguous_) {
+          // If we are producing chunked output rather than one big array, then
+          // emit each chunk as soon as it's available
+          RETURN_NOT_OK(listener->OnResult(std::move(out)));
+        }
+      }
     }
     if (preallocate_contiguous_) {
       // If we preallocated one big chunk, since the kernel execution is
@@ -552,6 +830,38 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
     return Status::OK();
   }
 
+  // Execute a batch with a selection vector, computing only the selected rows.
+  // Returns false without executing if the kernel doesn't support it.
+  Result<bool> ExecuteSelected(const ExecBatch& batch, ExecListener* listener) {
+    this->Reset();
+    RETURN_NOT_OK(this->BindArgs(batch.values));
+    if (!kernel_->can_use_selection_vector ||
+        output_descr_.shape != ValueDescr::ARRAY) {
+      return false;
+    }
+    const int64_t length = batch.selection_vector->length();
+    DecidePreallocation(batch.values);
+    if (!data_preallocated_) {
+      return false;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto out_arr, PrepareOutput(length));
+    if (validity_elided_) {
+      out_arr->null_count = 0;
+    } else if (kernel_->null_handling == NullHandling::INTERSECTION) {
+      RETURN_NOT_OK(PropagateNullsSelected(&kernel_ctx_, batch, out_arr.get()));
+    } else if (kernel_->null_handling == NullHandling::OUTPUT_NOT_NULL) {
+      out_arr->null_count = 0;
+    }
+    Datum out(std::move(out_arr));
+    ExecBatch selected_batch = batch;
+    selected_batch.length = length;
+    kernel_->exec(&kernel_ctx_, selected_batch, &out);
+    ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx_);
+    RETURN_NOT_OK(listener->OnResult(std::move(out)));
+    return true;
+  }
+
   Datum WrapResults(const std::vector<Datum>& inputs,
                     const std::vector<Datum>& outputs) override {
     if (output_descr_.shape == ValueDescr::SCALAR) {
@@ -580,48 +890,48 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
   }
 
  protected:
-  Status ExecuteBatch(const ExecBatch& batch, ExecListener* listener) {
-    Datum out;
-    RETURN_NOT_OK(PrepareNextOutput(batch, &out));
+  // Execute a batch starting at the given position of the arguments. This may
+  // be called concurrently for different batches, with different contexts.
+  Status ExecuteBatch(KernelContext* ctx, const ExecBatch& batch, int64_t position,
+                      Datum* out) {
+    RETURN_NOT_OK(PrepareNextOutput(batch, position, out));
 
     if (output_descr_.shape == ValueDescr::ARRAY) {
-      ArrayData* out_arr = out.mutable_array();
-      if (kernel_->null_handling == NullHandling::INTERSECTION) {
-        RETURN_NOT_OK(PropagateNulls(&kernel_ctx_, batch, out_arr));
+      ArrayData* out_arr = out->mutable_array();
+      if (validity_elided_) {
+        out_arr->null_count = 0;
+      } else if (kernel_->null_handling == NullHandling::INTERSECTION) {
+        RETURN_NOT_OK(PropagateNulls(ctx, batch, out_arr));
       } else if (kernel_->null_handling == NullHandling::OUTPUT_NOT_NULL) {
         out_arr->null_count = 0;
       }
     } else {
       if (kernel_->null_handling == NullHandling::INTERSECTION) {
         // set scalar validity
-        out.scalar()->is_valid =
+        out->scalar()->is_valid =
             std::all_of(batch.values.begin(), batch.values.end(),
                         [](const Datum& input) { return input.scalar()->is_valid; });
       } else if (kernel_->null_handling == NullHandling::OUTPUT_NOT_NULL) {
-        out.scalar()->is_valid = true;
+        out->scalar()->is_valid = true;
       }
     }
 
-    kernel_->exec(&kernel_ctx_, batch, &out);
-    ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx_);
-    if (!preallocate_contiguous_) {
-      // If we are producing chunked output rather than one big array, then
-      // emit each chunk as soon as it's available
-      RETURN_NOT_OK(listener->OnResult(std::move(out)));
-    }
+    kernel_->exec(ctx, batch, out);
+    ARROW_CTX_RETURN_IF_ERROR(ctx);
     return Status::OK();
   }
 
   Status PrepareExecute(const std::vector<Datum>& args) {
     this->Reset();
     RETURN_NOT_OK(this->BindArgs(args));
+    this->CollectParallelBatches();
 
     if (output_descr_.shape == ValueDescr::ARRAY) {
       // If the executor is configured to produce a single large Array output for
       // kernels supporting preallocation, then we do so up front and then
       // iterate over slices of that large array. Otherwise, we preallocate prior
       // to processing each batch emitted from the ExecBatchIterator
-      RETURN_NOT_OK(SetupPreallocation(batch_iterator_->length()));
+      RETURN_NOT_OK(SetupPreallocation(args, batch_iterator_->length()));
     }
     return Status::OK();
   }
@@ -640,12 +950,11 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
   // outputs), then contiguous results are only possible if the input is
   // contiguous.
 
-  Status PrepareNextOutput(const ExecBatch& batch, Datum* out) {
+  Status PrepareNextOutput(const ExecBatch& batch, int64_t batch_start_position,
+                           Datum* out) {
     if (output_descr_.shape == ValueDescr::ARRAY) {
       if (preallocate_contiguous_) {
         // The output is already fully preallocated
-        const int64_t batch_start_position = batch_iterator_->position() - batch.length;
-
         if (batch.length < batch_iterator_->length()) {
           // If this is a partial execution, then we write into a slice of
           // preallocated_
@@ -671,15 +980,21 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
     return Status::OK();
   }
 
-  Status SetupPreallocation(int64_t total_length) {
+  // Decide if we need to preallocate memory for this kernel
+  void DecidePreallocation(const std::vector<Datum>& args) {
     output_num_buffers_ = static_cast<int>(output_descr_.type->layout().buffers.size());
-
-    // Decide if we need to preallocate memory for this kernel
     data_preallocated_ = ((kernel_->mem_allocation == MemAllocation::PREALLOCATE) &&
                           CanPreallocate(*output_descr_.type));
+    // Don't allocate a validity bitmap only to set all its bits
+    validity_elided_ = (kernel_->null_handling == NullHandling::INTERSECTION &&
+                        !ValuesMayHaveNulls(args));
     validity_preallocated_ =
         (kernel_->null_handling != NullHandling::COMPUTED_NO_PREALLOCATE &&
-         kernel_->null_handling != NullHandling::OUTPUT_NOT_NULL);
+         kernel_->null_handling != NullHandling::OUTPUT_NOT_NULL && !validity_elided_);
+  }
+
+  Status SetupPreallocation(const std::vector<Datum>& args, int64_t total_length) {
+    DecidePreallocation(args);
 
     // Contiguous preallocation only possible if both the VALIDITY and DATA can
     // be preallocated. Otherwise, we must go chunk-by-chunk. Note that when
@@ -690,7 +1005,7 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
     // kernel's attributes
     preallocate_contiguous_ =
         (exec_ctx_->preallocate_contiguous() && kernel_->can_write_into_slices &&
-         data_preallocated_ && validity_preallocated_);
+         data_preallocated_ && (validity_preallocated_ || validity_elided_));
     if (preallocate_contiguous_) {
       DCHECK_EQ(2, output_num_buffers_);
       ARROW_ASSIGN_OR_RAISE(preallocated_, PrepareOutput(total_length));
@@ -698,6 +1013,11 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
     return Status::OK();
   }
 
+  bool ParallelSlicesByteAligned() const {
+    return std::all_of(parallel_positions_.begin(), parallel_positions_.end(),
+                       [](int64_t position) { return position % 8 == 0; });
+  }
+
   // If true, and the kernel and output type supports preallocation (for both
   // the validity and data buffers), then we allocate one big array and then
   // iterate through it while executing the kernel in chunks
@@ -734,10 +1054,25 @@ class VectorExecutor : public FunctionExecutorImpl<VectorFunction> {
   using BASE = FunctionExecutorImpl<VectorFunction>;
   using BASE::BASE;
 
+  std::unique_ptr<FunctionExecutor> ClonePrepared(ExecContext* ctx) const override {
+    return ClonePreparedAs<VectorExecutor>(ctx);
+  }
+
   Status Execute(const std::vector<Datum>& args, ExecListener* listener) override {
     RETURN_NOT_OK(PrepareExecute(args));
     ExecBatch batch;
-    if (kernel_->can_execute_chunkwise) {
+    if (!parallel_batches_.empty()) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto outputs,
+          ExecuteParallelBatches(/*use_threads=*/true, [this](KernelContext* ctx,
+                                                              const ExecBatch& batch,
+                                                              int64_t, Datum* out) {
+            return ExecuteBatch(ctx, batch, out);
+          }));
+      for (auto& out : outputs) {
+        RETURN_NOT_OK(EmitResult(std::move(out), listener));
+      }
+    } else if (kernel_->can_execute_chunkwise) {
       while (batch_iterator_->Next(&batch)) {
         RETURN_NOT_OK(ExecuteBatch(batch, listener));
       }
@@ -776,18 +1111,32 @@ class VectorExecutor : public FunctionExecutorImpl<VectorFunction> {
       return Status::OK();
     }
     Datum out;
+    RETURN_NOT_OK(ExecuteBatch(&kernel_ctx_, batch, &out));
+    return EmitResult(std::move(out), listener);
+  }
+
+  // This may be called concurrently for different batches, with different
+  // contexts, if the kernel is stateless
+  Status ExecuteBatch(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
     if (output_descr_.shape == ValueDescr::ARRAY) {
       // We preallocate (maybe) only for the output of processing the current
       // batch
-      ARROW_ASSIGN_OR_RAISE(out.value, PrepareOutput(batch.length));
+      ARROW_ASSIGN_OR_RAISE(out->value, PrepareOutput(batch.length));
     }
 
-    if (kernel_->null_handling == NullHandling::INTERSECTION &&
-        output_descr_.shape == ValueDescr::ARRAY) {
-      RETURN_NOT_OK(PropagateNulls(&kernel_ctx_, batch, out.mutable_array()));
+    if (output_descr_.shape == ValueDescr::ARRAY) {
+      if (validity_elided_) {
+        out->mutable_array()->null_count = 0;
+      } else if (kernel_->null_handling == NullHandling::INTERSECTION) {
+        RETURN_NOT_OK(PropagateNulls(ctx, batch, out->mutable_array()));
+      }
     }
-    kernel_->exec(&kernel_ctx_, batch, &out);
-    ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx_);
+    kernel_->exec(ctx, batch, out);
+    ARROW_CTX_RETURN_IF_ERROR(ctx);
+    return Status::OK();
+  }
+
+  Status EmitResult(Datum out, ExecListener* listener) {
     if (!kernel_->finalize) {
       // If there is no result finalizer (e.g. for hash-based functions, we can
       // emit the processed batch right away rather than waiting
@@ -821,15 +1170,26 @@ class VectorExecutor : public FunctionExecutorImpl<VectorFunction> {
 
   Status PrepareExecute(const std::vector<Datum>& args) {
     this->Reset();
+    results_.clear();
     RETURN_NOT_OK(this->BindArgs(args));
     output_num_buffers_ = static_cast<int>(output_descr_.type->layout().buffers.size());
 
     // Decide if we need to preallocate memory for this kernel
     data_preallocated_ = ((kernel_->mem_allocation == MemAllocation::PREALLOCATE) &&
                           CanPreallocate(*output_descr_.type));
+    validity_elided_ = (kernel_->null_handling == NullHandling::INTERSECTION &&
+                        !ValuesMayHaveNulls(args));
     validity_preallocated_ =
         (kernel_->null_handling != NullHandling::COMPUTED_NO_PREALLOCATE &&
-         kernel_->null_handling != NullHandling::OUTPUT_NOT_NULL);
+         kernel_->null_handling != NullHandling::OUTPUT_NOT_NULL && !validity_elided_);
+
+    // Kernels with state (e.g. hash tables) or a finalizer accumulate results
+    // across batches, so they are executed serially unless they support
+    // concurrent execution
+    if (kernel_->can_execute_chunkwise &&
+        ((!kernel_->init && !kernel_->finalize) || kernel_->can_execute_concurrently)) {
+      this->CollectParallelBatches();
+    }
     return Status::OK();
   }
 
@@ -843,6 +1203,10 @@ class ScalarAggExecutor : public FunctionExecutorImpl<ScalarAggregateFunction> {
   using BASE = FunctionExecutorImpl<ScalarAggregateFunction>;
   using BASE::BASE;
 
+  std::unique_ptr<FunctionExecutor> ClonePrepared(ExecContext* ctx) const override {
+    return ClonePreparedAs<ScalarAggExecutor>(ctx);
+  }
+
   Status Execute(const std::vector<Datum>& args, ExecListener* listener) override {
     RETURN_NOT_OK(BindArgs(args));
 
@@ -901,6 +1265,228 @@ Result<std::unique_ptr<FunctionExecutor>> MakeExecutor(ExecContext* ctx,
   return std::unique_ptr<FunctionExecutor>(new ExecutorType(ctx, typed_func, options));
 }
 
+Result<bool> ExecuteOnDictionaryValues(const Function& func,
+                                       const std::vector<Datum>& args,
+                                       const FunctionOptions* options, ExecContext* ctx,
+                                       Datum* out) {
+  if (func.kind() != Function::SCALAR) {
+    return false;
+  }
+  int dict_index = -1;
+  for (int i = 0; i < static_cast<int>(args.size()); ++i) {
+    if (args[i].is_scalar()) {
+      continue;
+    }
+    if (dict_index >= 0 || args[i].type()->id() != Type::DICTIONARY) {
+      return false;
+    }
+    dict_index = i;
+  }
+  if (dict_index < 0) {
+    return false;
+  }
+  // Kernels accepting dictionaries directly take precedence
+  std::vector<ValueDescr> descrs;
+  RETURN_NOT_OK(GetValueDescriptors(args, &descrs));
+  if (checked_cast<const ScalarFunction&>(func).DispatchExact(descrs).ok()) {
+    return false;
+  }
+
+  const auto& dict_type = checked_cast<const DictionaryType&>(*args[dict_index].type());
+  std::vector<Datum> value_args = args;
+  // Consecutive chunks often share their dictionary, so the results on the
+  // last dictionary seen are reused
+  std::shared_ptr<ArrayData> last_dictionary;
+  Datum last_values;
+  auto execute_chunk = [&](const ArrayData& chunk) -> Result<Datum> {
+    if (chunk.dictionary != last_dictionary) {
+      value_args[dict_index] = chunk.dictionary;
+      ARROW_ASSIGN_OR_RAISE(last_values, func.Execute(value_args, options, ctx));
+      last_dictionary = chunk.dictionary;
+    }
+    auto indices = std::make_shared<ArrayData>(chunk);
+    indices->type = dict_type.index_type();
+    indices->dictionary = nullptr;
+    return CallFunction("take", {last_values, Datum(std::move(indices))},
+                        /*options=*/nullptr, ctx);
+  };
+
+  const Datum& dict_arg = args[dict_index];
+  if (dict_arg.is_array()) {
+    ARROW_ASSIGN_OR_RAISE(*out, execute_chunk(*dict_arg.array()));
+    return true;
+  }
+
+  const ChunkedArray& chunked = *dict_arg.chunked_array();
+  ArrayVector chunks;
+  for (const auto& chunk : chunked.chunks()) {
+    ARROW_ASSIGN_OR_RAISE(Datum result, execute_chunk(*chunk->data()));
+    chunks.push_back(result.make_array());
+  }
+  std::shared_ptr<DataType> out_type;
+  if (chunks.empty()) {
+    // Resolve the output type by executing on an empty dictionary
+    ARROW_ASSIGN_OR_RAISE(auto empty_values,
+                          MakeArrayOfNull(dict_type.value_type(), 0, ctx->memory_pool()));
+    value_args[dict_index] = empty_values;
+    ARROW_ASSIGN_OR_RAISE(Datum empty_result, func.Execute(value_args, options, ctx));
+    out_type = empty_result.type();
+  } else {
+    out_type = chunks[0]->type();
+  }
+  *out = std::make_shared<ChunkedArray>(std::move(chunks), std::move(out_type));
+  return true;
+}
+
+namespace {
+
+// The functions whose results only depend on the equality or ordering of the
+// argument values
+bool CanExecuteOnStorage(const Function& func) {
+  static const std::unordered_set<std::string> kNames = {
+      "array_filter", "array_sort_indices",    "array_take", "dictionary_encode",
+      "index_in",     "is_in",                 "unique",     "value_counts",
+      "partition_nth_indices"};
+  return kNames.count(func.name()) > 0;
+}
+
+
+Datum GetStorage(const Datum& arg) {
+  if (arg.is_array()) {
+    auto storage = arg.array()->Copy();
+    storage->type = checked_cast<const ExtensionType&>(*arg.type()).storage_type();
+    return storage;
+  }
+  ArrayVector chunks;
+  for (const auto& chunk : arg.chunked_array()->chunks()) {
+    chunks.push_back(checked_cast<const ExtensionArray&>(*chunk).storage());
+  }
+  return std::make_shared<ChunkedArray>(
+      std::move(chunks), checked_cast<const ExtensionType&>(*arg.type()).storage_type());
+}
+
+// The kernel of a scalar or vector function matching the arguments, if any
+const Kernel* DispatchKernel(const Function& func,
+                             const std::vector<ValueDescr>& descrs) {
+  if (func.kind() == Function::SCALAR) {
+    auto maybe_kernel = checked_cast<const ScalarFunction&>(func).DispatchExact(descrs);
+    return maybe_kernel.ok() ? *maybe_kernel : nullptr;
+  }
+  if (func.kind() == Function::VECTOR) {
+    auto maybe_kernel = checked_cast<const VectorFunction&>(func).DispatchExact(descrs);
+    return maybe_kernel.ok() ? *maybe_kernel : nullptr;
+  }
+  return nullptr;
+}
+
+// Wrap storage values of a result, including the values of a value_counts
+// struct and the dictionary of dictionary_encode, into the extension type
+std::shared_ptr<ArrayData> WrapStorage(const std::shared_ptr<ArrayData>& data,
+                                       const std::shared_ptr<DataType>& ext_type) {
+  const auto& storage_type = checked_cast<const ExtensionType&>(*ext_type).storage_type();
+  if (data->type->Equals(*storage_type)) {
+    auto out = data->Copy();
+    out->type = ext_type;
+    return out;
+  }
+  if (data->type->id() == Type::STRUCT) {
+    auto out = data->Copy();
+    std::vector<std::shared_ptr<Field>> fields;
+    for (int i = 0; i < data->type->num_fields(); ++i) {
+      out->child_data[i] = WrapStorage(data->child_data[i], ext_type);
+      fields.push_back(data->type->field(i)->WithType(out->child_data[i]->type));
+    }
+    out->type = struct_(std::move(fields));
+    return out;
+  }
+  if (data->type->id() == Type::DICTIONARY && data->dictionary != nullptr &&
+      data->dictionary->type->Equals(*storage_type)) {
+    const auto& dict_type = checked_cast<const DictionaryType&>(*data->type);
+    auto out = data->Copy();
+    out->type = dictionary(dict_type.index_type(), ext_type, dict_type.ordered());
+    out->dictionary = WrapStorage(data->dictionary, ext_type);
+    return out;
+  }
+  return data;
+}
+
+}  // namespace
+
+Result<bool> ExecuteOnExtensionStorage(const Function& func,
+                                       const std::vector<Datum>& args,
+                                       const FunctionOptions* options, ExecContext* ctx,
+                                       Datum* out) {
+  if (!CanExecuteOnStorage(func)) {
+    return false;
+  }
+  std::shared_ptr<DataType> ext_type;
+  std::vector<Datum> storage_args = args;
+  for (auto& arg : storage_args) {
+    if (arg.type() == nullptr || arg.type()->id() != Type::EXTENSION) {
+      continue;
+    }
+    if (!(arg.is_array() || arg.kind() == Datum::CHUNKED_ARRAY) ||
+        !checked_cast<const ExtensionType&>(*arg.type()).ComputeOnStorage()) {
+      return false;
+    }
+    if (ext_type == nullptr) {
+      ext_type = arg.type();
+    }
+    arg = GetStorage(arg);
+  }
+  if (ext_type == nullptr) {
+    return false;
+  }
+  // Kernels accepting the extension types directly take precedence
+  std::vector<ValueDescr> descrs;
+  RETURN_NOT_OK(GetValueDescriptors(args, &descrs));
+  if (DispatchKernel(func, descrs) != nullptr) {
+    return false;
+  }
+
+  // The value set of set lookups must be unwrapped like the input
+  std::unique_ptr<SetLookupOptions> storage_lookup_options;
+  if ((func.name() == "is_in" || func.name() == "index_in") && options != nullptr) {
+    const auto& lookup_options = static_cast<const SetLookupOptions&>(*options);
+    const Datum& value_set = lookup_options.value_set;
+    if (value_set.type() != nullptr && value_set.type()->Equals(*ext_type)) {
+      storage_lookup_options.reset(new SetLookupOptions(lookup_options));
+      storage_lookup_options->value_set = GetStorage(value_set);
+      options = storage_lookup_options.get();
+    }
+  }
+
+  std::vector<ValueDescr> storage_descrs;
+  RETURN_NOT_OK(GetValueDescriptors(storage_args, &storage_descrs));
+  const Kernel* storage_kernel = DispatchKernel(func, storage_descrs);
+  if (storage_kernel == nullptr) {
+    return false;
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum result, func.Execute(storage_args, options, ctx));
+  if (storage_kernel->signature->out_type().kind() == OutputType::FIXED) {
+    *out = std::move(result);
+  } else if (result.is_array()) {
+    *out = WrapStorage(result.array(), ext_type);
+  } else if (result.kind() == Datum::CHUNKED_ARRAY) {
+    ArrayVector chunks;
+    for (const auto& chunk : result.chunked_array()->chunks()) {
+      chunks.push_back(MakeArray(WrapStorage(chunk->data(), ext_type)));
+    }
+    std::shared_ptr<DataType> out_type;
+    if (chunks.empty()) {
+      ARROW_ASSIGN_OR_RAISE(auto empty_result,
+                            MakeArrayOfNull(result.type(), 0, ctx->memory_pool()));
+      out_type = WrapStorage(empty_result->data(), ext_type)->type;
+    } else {
+      out_type = chunks[0]->type();
+    }
+    *out = std::make_shared<ChunkedArray>(std::move(chunks), std::move(out_type));
+  } else {
+    *out = std::move(result);
+  }
+  return true;
+}
+
 Result<std::unique_ptr<FunctionExecutor>> FunctionExecutor::Make(
     ExecContext* ctx, const Function* func, const FunctionOptions* options) {
   switch (func->kind()) {
@@ -940,10 +1526,86 @@ SelectionVector::SelectionVector(const Array& arr) : SelectionVector(arr.data())
 int32_t SelectionVector::length() const { return static_cast<int32_t>(data_->length); }
 
 Result<std::shared_ptr<SelectionVector>> SelectionVector::FromMask(
-    const BooleanArray& arr) {
-  return Status::NotImplemented("FromMask");
+    const BooleanArray& arr, MemoryPool* pool) {
+  if (arr.length() > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("SelectionVector mask is too long: ", arr.length());
+  }
+  const int64_t length = arr.true_count();
+  ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
+                        AllocateBuffer(length * sizeof(int32_t), pool));
+  auto indices = reinterpret_cast<int32_t*>(indices_buffer->mutable_data());
+  for (int64_t i = 0; i < arr.length(); ++i) {
+    if (arr.IsValid(i) && arr.Value(i)) {
+      *indices++ = static_cast<int32_t>(i);
+    }
+  }
+  return std::make_shared<SelectionVector>(
+      ArrayData::Make(int32(), length, {nullptr, std::move(indices_buffer)},
+                      /*null_count=*/0));
+}
+
+namespace {
+
+// Find the non-CPU device holding the buffers of the array data, if any
+Status FindArrayDevice(const ArrayData& data, std::shared_ptr<Device>* device) {
+  for (const auto& buffer : data.buffers) {
+    if (buffer == nullptr || buffer->is_cpu()) {
+      continue;
+    }
+    if (*device == nullptr) {
+      *device = buffer->device();
+    } else if (!(*device)->Equals(*buffer->device())) {
+      return Status::Invalid("Function arguments reside on different devices: ",
+                             (*device)->ToString(), " and ",
+                             buffer->device()->ToString());
+    }
+  }
+  for (const auto& child : data.child_data) {
+    RETURN_NOT_OK(FindArrayDevice(*child, device));
+  }
+  if (data.dictionary != nullptr) {
+    RETURN_NOT_OK(FindArrayDevice(*data.dictionary, device));
+  }
+  return Status::OK();
+}
+
+// Return the non-CPU device holding the array arguments, or null if they all
+// reside in CPU memory
+Result<std::shared_ptr<Device>> GetArgumentsDevice(const std::vector<Datum>& args) {
+  std::shared_ptr<Device> device;
+  for (const auto& arg : args) {
+    if (arg.is_array()) {
+      RETURN_NOT_OK(FindArrayDevice(*arg.array(), &device));
+    } else if (arg.kind() == Datum::CHUNKED_ARRAY) {
+      for (const auto& chunk : arg.chunked_array()->chunks()) {
+        RETURN_NOT_OK(FindArrayDevice(*chunk->data(), &device));
+      }
+    }
+  }
+  return device;
 }
 
+// Look up the function to execute on the given arguments: CPU kernels cannot
+// read device memory, so arguments residing on another device are dispatched
+// to the function registered for that device type
+Result<std::shared_ptr<const Function>> GetFunctionForArguments(
+    const FunctionRegistry& registry, const std::string& func_name,
+    const std::vector<Datum>& args) {
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Device> device, GetArgumentsDevice(args));
+  if (device == nullptr) {
+    return registry.GetFunction(func_name);
+  }
+  auto maybe_func = registry.GetDeviceFunction(device->type_name(), func_name);
+  if (!maybe_func.ok()) {
+    return Status::NotImplemented("Function '", func_name,
+                                  "' has no implementation for arguments residing on ",
+                                  device->ToString());
+  }
+  return std::shared_ptr<const Function>(maybe_func.MoveValueUnsafe());
+}
+
+}  // namespace
+
 Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
                            const FunctionOptions* options, ExecContext* ctx) {
   if (ctx == nullptr) {
@@ -951,7 +1613,7 @@ Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum
     return CallFunction(func_name, args, options, &default_ctx);
   }
   ARROW_ASSIGN_OR_RAISE(std::shared_ptr<const Function> func,
-                        ctx->func_registry()->GetFunction(func_name));
+                        GetFunctionForArguments(*ctx->func_registry(), func_name, args));
   return func->Execute(args, options, ctx);
 }
 
@@ -960,5 +1622,179 @@ Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum
   return CallFunction(func_name, args, /*options=*/nullptr, ctx);
 }
 
+Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
+                           const FunctionOptions* options, ExecContext* ctx,
+                           const ArrayData& out) {
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return CallFunction(func_name, args, options, &default_ctx, out);
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Device> device, GetArgumentsDevice(args));
+  if (device != nullptr) {
+    return Status::NotImplemented(
+        "Executing into preallocated buffers with arguments residing on ",
+        device->ToString());
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<const Function> func,
+                        ctx->func_registry()->GetFunction(func_name));
+  if (options == nullptr) {
+    options = func->default_options();
+  }
+  return detail::ExecuteFunction(*func, args, options, ctx, out.buffers);
+}
+
+namespace {
+
+Status CheckSelectedBatch(const ExecBatch& batch) {
+  int64_t values_length = -1;
+  for (const Datum& value : batch.values) {
+    if (value.is_array()) {
+      if (values_length >= 0 && value.length() != values_length) {
+        return Status::Invalid("Array arguments must all be the same length");
+      }
+      values_length = value.length();
+    } else if (!value.is_scalar()) {
+      return Status::Invalid(
+          "Tried executing function on a selection with a non-array, "
+          "non-scalar value: ",
+          value.ToString());
+    }
+  }
+  const SelectionVector& selection = *batch.selection_vector;
+  const int32_t* indices = selection.indices();
+  for (int32_t i = 0; i < selection.length(); ++i) {
+    if (indices[i] < 0 || (values_length >= 0 && indices[i] >= values_length)) {
+      return Status::IndexError("Selection index ", indices[i], " out of bounds");
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Result<Datum> CallFunctionOnBatch(const std::string& func_name, const ExecBatch& batch,
+                                  const FunctionOptions* options, ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return CallFunctionOnBatch(func_name, batch, options, &default_ctx);
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<const Function> func,
+                        ctx->func_registry()->GetFunction(func_name));
+  if (batch.selection_vector == nullptr) {
+    return func->Execute(batch.values, options, ctx);
+  }
+  RETURN_NOT_OK(CheckSelectedBatch(batch));
+  const bool have_arrays =
+      std::any_of(batch.values.begin(), batch.values.end(),
+                  [](const Datum& value) { return value.is_array(); });
+
+  if (func->kind() == Function::SCALAR && have_arrays) {
+    if (options == nullptr) {
+      options = func->default_options();
+    }
+    detail::ScalarExecutor executor(ctx, checked_cast<const ScalarFunction*>(func.get()),
+                                    options);
+    detail::DatumAccumulator listener;
+    ARROW_ASSIGN_OR_RAISE(bool executed, executor.ExecuteSelected(batch, &listener));
+    if (executed) {
+      return listener.values()[0];
+    }
+  }
+
+  // Materialize the selection, whose indices were checked above
+  std::vector<Datum> selected_values;
+  const Datum indices(batch.selection_vector->data());
+  const auto take_options = TakeOptions::NoBoundsCheck();
+  for (const Datum& value : batch.values) {
+    if (value.is_array()) {
+      ARROW_ASSIGN_OR_RAISE(Datum selected,
+                            CallFunction("take", {value, indices}, &take_options, ctx));
+      selected_values.push_back(std::move(selected));
+    } else {
+      selected_values.push_back(value);
+    }
+  }
+  return func->Execute(selected_values, options, ctx);
+}
+
+// ----------------------------------------------------------------------
+// PreparedFunction
+
+PreparedFunction::PreparedFunction(std::shared_ptr<const Function> func,
+                                   std::vector<ValueDescr> descrs,
+                                   const FunctionOptions* options, ExecContext ctx)
+    : func_(std::move(func)),
+      descrs_(std::move(descrs)),
+      options_(options),
+      ctx_(std::move(ctx)) {}
+
+PreparedFunction::~PreparedFunction() = default;
+
+Result<std::unique_ptr<PreparedFunction>> PreparedFunction::Make(
+    const std::string& func_name, std::vector<ValueDescr> descrs,
+    const FunctionOptions* options, ExecContext* ctx) {
+  ExecContext exec_ctx = ctx != nullptr ? *ctx : ExecContext();
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<const Function> func,
+                        exec_ctx.func_registry()->GetFunction(func_name));
+  if (func->kind() == Function::HASH_AGGREGATE) {
+    return Status::NotImplemented(
+        "Direct execution of HASH_AGGREGATE functions, use GroupBy instead");
+  }
+  if (options == nullptr) {
+    options = func->default_options();
+  }
+  std::unique_ptr<PreparedFunction> prepared(
+      new PreparedFunction(func, std::move(descrs), options, std::move(exec_ctx)));
+
+  // Without a matching kernel, dictionary or extension arguments may be executed
+  // on their values or storage, which depends on the arguments themselves
+  const bool may_unwrap_args =
+      std::any_of(prepared->descrs_.begin(), prepared->descrs_.end(),
+                  [](const ValueDescr& descr) {
+                    return descr.type->id() == Type::DICTIONARY ||
+                           descr.type->id() == Type::EXTENSION;
+                  });
+  if (func->kind() != Function::META &&
+      (!may_unwrap_args || detail::DispatchKernel(*func, prepared->descrs_) != nullptr)) {
+    ARROW_ASSIGN_OR_RAISE(auto executor, detail::FunctionExecutor::Make(
+                                             &prepared->ctx_, func.get(), options));
+    RETURN_NOT_OK(executor->Prepare(prepared->descrs_));
+    prepared->executor_ = std::move(executor);
+  }
+  return std::move(prepared);
+}
+
+Result<Datum> PreparedFunction::Execute(const std::vector<Datum>& args) {
+  if (executor_ == nullptr) {
+    return func_->Execute(args, options_, &ctx_);
+  }
+  RETURN_NOT_OK(detail::CheckAllValues(args));
+  detail::DatumAccumulator listener;
+  ExecStats* stats = ctx_.exec_stats();
+  ::arrow::internal::StopWatch watch;
+  if (stats != nullptr) {
+    watch.Start();
+  }
+  RETURN_NOT_OK(executor_->Execute(args, &listener));
+  Datum out = executor_->WrapResults(args, listener.values());
+  if (stats != nullptr) {
+    stats->Record(*func_, executor_->kernel(), args, static_cast<int64_t>(watch.Stop()));
+  }
+  return out;
+}
+
+std::unique_ptr<PreparedFunction> PreparedFunction::Clone() const {
+  std::unique_ptr<PreparedFunction> clone(
+      new PreparedFunction(func_, descrs_, options_, ctx_));
+  if (executor_ != nullptr) {
+    clone->executor_ = executor_->ClonePrepared(&clone->ctx_);
+  }
+  return clone;
+}
+
+const Kernel* PreparedFunction::kernel() const {
+  return executor_ != nullptr ? executor_->kernel() : nullptr;
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -44,8 +44,17 @@ class CpuInfo;
 
 namespace compute {
 
+class ExecStats;
+class Function;
 struct FunctionOptions;
 class FunctionRegistry;
+struct Kernel;
+
+namespace detail {
+
+class FunctionExecutor;
+
+}  // namespace detail
 
 // It seems like 64K might be a good default chunksize to use for execution
 // based on the experience of other query processing systems. The current
@@ -83,12 +92,15 @@ class ARROW_EXPORT ExecContext {
   // smaller chunks.
   int64_t exec_chunksize() const { return exec_chunksize_; }
 
-  /// \brief Set whether to use multiple threads for function execution. This
-  /// is not yet used.
+  /// \brief Set whether to use multiple threads for function execution.
   void set_use_threads(bool use_threads = true) { use_threads_ = use_threads; }
 
   /// \brief If true, then utilize multiple threads where relevant for function
-  /// execution. This is not yet used.
+  /// execution.
+  ///
+  /// Scalar and stateless vector kernels execute the batches of ChunkedArray
+  /// inputs (or of arrays split according to exec_chunksize()) in parallel on
+  /// the CPU thread pool. The output chunks are kept in order.
   bool use_threads() const { return use_threads_; }
 
   // Set the preallocation strategy for kernel execution as it relates to
@@ -111,9 +123,18 @@ class ARROW_EXPORT ExecContext {
   /// set_preallocate_contiguous() for more information.
   bool preallocate_contiguous() const { return preallocate_contiguous_; }
 
+  /// \brief Set a collector of execution statistics for the functions
+  /// executed with this context, or nullptr (the default) to collect none.
+  /// The collector is not owned and must outlive the context.
+  void set_exec_stats(ExecStats* stats) { exec_stats_ = stats; }
+
+  /// \brief The collector of execution statistics, if any
+  ExecStats* exec_stats() const { return exec_stats_; }
+
  private:
   MemoryPool* pool_;
   FunctionRegistry* func_registry_;
+  ExecStats* exec_stats_ = NULLPTR;
   int64_t exec_chunksize_ = std::numeric_limits<int64_t>::max();
   bool preallocate_contiguous_ = true;
   bool use_threads_ = true;
@@ -131,7 +152,7 @@ class ARROW_EXPORT ExecContext {
 /// implementations. This is especially relevant for aggregations but also
 /// applies to scalar operations.
 ///
-/// We are not yet using this so this is mostly a placeholder for now.
+/// See CallFunctionOnBatch for executing functions on a selection.
 ///
 /// [1]: http://cidrdb.org/cidr2005/papers/P19.pdf
 class ARROW_EXPORT SelectionVector {
@@ -141,11 +162,18 @@ class ARROW_EXPORT SelectionVector {
   explicit SelectionVector(const Array& arr);
 
   /// \brief Create SelectionVector from boolean mask
-  static Result<std::shared_ptr<SelectionVector>> FromMask(const BooleanArray& arr);
+  ///
+  /// The selection holds the indices of the true values, null values are not
+  /// selected.
+  static Result<std::shared_ptr<SelectionVector>> FromMask(
+      const BooleanArray& arr, MemoryPool* pool = default_memory_pool());
 
   const int32_t* indices() const { return indices_; }
   int32_t length() const;
 
+  /// \brief The indices as an int32 array
+  const std::shared_ptr<ArrayData>& data() const { return data_; }
+
  private:
   std::shared_ptr<ArrayData> data_;
   const int32_t* indices_;
@@ -230,7 +258,99 @@ ARROW_EXPORT
 Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
                            ExecContext* ctx = NULLPTR);
 
+/// \brief Variant of CallFunction which writes the output into the buffers of
+/// `out` where possible, rather than allocating them from the memory pool
+///
+/// The validity bitmap (out.buffers[0]) and data buffer (out.buffers[1]) are
+/// reused if they are mutable and large enough for the output of a kernel
+/// writing into preallocated memory, such as most scalar kernels with
+/// fixed-width outputs. Otherwise the output is allocated as usual, so the
+/// result may use any, all or none of the buffers of `out`. The other fields
+/// of `out` are ignored.
+///
+/// This allows reusing scratch buffers across calls in a loop, as long as the
+/// previous result is no longer in use when they are written again. The
+/// buffers must not be those of the arguments.
+ARROW_EXPORT
+Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
+                           const FunctionOptions* options, ExecContext* ctx,
+                           const ArrayData& out);
+
+/// \brief One-shot invoker for a batch of arguments, taking its selection
+/// vector into account
+///
+/// If the batch has a selection vector, the result is as if the array
+/// arguments were filtered by it first. For scalar functions whose kernel
+/// supports it, only the selected rows are computed, without materializing
+/// the filtered arguments. Otherwise the selection is materialized with
+/// "take" before execution.
+///
+/// The batch values must be arrays or scalars.
+ARROW_EXPORT
+Result<Datum> CallFunctionOnBatch(const std::string& func_name, const ExecBatch& batch,
+                                  const FunctionOptions* options = NULLPTR,
+                                  ExecContext* ctx = NULLPTR);
+
 /// @}
 
+/// \brief A function call bound to a function, its options and the types and
+/// shapes of its arguments, to be executed many times
+///
+/// CallFunction looks the function up in the registry, dispatches its kernel
+/// and initializes the kernel state on every call, which is a significant
+/// overhead when executing on small batches. A PreparedFunction does so once,
+/// and keeps the kernel state of scalar functions across calls. The results are
+/// the same as CallFunction's.
+///
+/// Chunked arrays are bound as arrays. If the function is a meta function, or
+/// if no kernel matches dictionary or extension arguments (which may then be
+/// executed on their values or storage), each call only saves the function
+/// lookup.
+///
+/// A PreparedFunction isn't thread-safe: use a Clone() per thread. Clones of
+/// scalar functions share the kernel state, which is immutable.
+class ARROW_EXPORT PreparedFunction {
+ public:
+  /// \brief Bind a function to arguments of the given descriptors
+  ///
+  /// \param[in] func_name the name of the function in the registry of `ctx`
+  /// \param[in] descrs the types and shapes of the arguments
+  /// \param[in] options the function options, the function's default options if
+  /// null. They must outlive the PreparedFunction and its clones.
+  /// \param[in] ctx the execution context, copied. The default context if null.
+  static Result<std::unique_ptr<PreparedFunction>> Make(
+      const std::string& func_name, std::vector<ValueDescr> descrs,
+      const FunctionOptions* options = NULLPTR, ExecContext* ctx = NULLPTR);
+
+  ~PreparedFunction();
+
+  /// \brief Execute the function on arguments of the bound descriptors
+  ///
+  /// \return TypeError if the arguments don't match the bound descriptors
+  Result<Datum> Execute(const std::vector<Datum>& args);
+
+  /// \brief Return a PreparedFunction bound like this one, to execute on
+  /// another thread
+  std::unique_ptr<PreparedFunction> Clone() const;
+
+  const Function& function() const { return *func_; }
+
+  const std::vector<ValueDescr>& descrs() const { return descrs_; }
+
+  /// \brief The kernel executing the function, or null if dispatched on each
+  /// call
+  const Kernel* kernel() const;
+
+ private:
+  PreparedFunction(std::shared_ptr<const Function> func, std::vector<ValueDescr> descrs,
+                   const FunctionOptions* options, ExecContext ctx);
+
+  std::shared_ptr<const Function> func_;
+  std::vector<ValueDescr> descrs_;
+  const FunctionOptions* options_;
+  ExecContext ctx_;
+  std::unique_ptr<detail::FunctionExecutor> executor_;
+};
+
 }  // namespace compute
 }  // namespace arrow
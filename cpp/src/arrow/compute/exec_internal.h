@@ -112,9 +112,32 @@ class ARROW_EXPORT FunctionExecutor {
 
   virtual ValueDescr output_descr() const = 0;
 
+  /// \brief The kernel selected by the last call to Execute, or null
+  virtual const Kernel* kernel() const { return NULLPTR; }
+
+  /// \brief Provide buffers for the output to be written into instead of
+  /// allocating new ones: buffers[0] for the validity bitmap and buffers[1]
+  /// for the data. A buffer is only used if it is mutable and large enough,
+  /// and for a single output allocation. Ignored by executors which don't
+  /// preallocate their outputs.
+  virtual void SetOutputBuffers(BufferVector buffers) {}
+
   virtual Datum WrapResults(const std::vector<Datum>& args,
                             const std::vector<Datum>& outputs) = 0;
 
+  /// \brief Dispatch the kernel for arguments of the given descriptors and
+  /// initialize its state once, rather than on each call to Execute. The
+  /// arguments passed to Execute must then match the descriptors.
+  ///
+  /// The kernel state of scalar functions is kept across calls, being
+  /// immutable. The kernel state of other functions is initialized for each
+  /// call, as it accumulates the results of a call.
+  virtual Status Prepare(const std::vector<ValueDescr>& descrs) = 0;
+
+  /// \brief Return an executor prepared like this one, sharing its kernel
+  /// state if kept across calls. Prepare() must have been called.
+  virtual std::unique_ptr<FunctionExecutor> ClonePrepared(ExecContext* ctx) const = 0;
+
   static Result<std::unique_ptr<FunctionExecutor>> Make(ExecContext* ctx,
                                                         const Function* func,
                                                         const FunctionOptions* options);
@@ -132,6 +155,48 @@ class ARROW_EXPORT FunctionExecutor {
 ARROW_EXPORT
 Status PropagateNulls(KernelContext* ctx, const ExecBatch& batch, ArrayData* out);
 
+/// \brief Execute a scalar function on the values of a dictionary argument
+///
+/// If the arguments are a single dictionary-encoded array or chunked array
+/// along with scalars, and the function has no kernel accepting the dictionary
+/// type, the function is executed once on each distinct dictionary and its
+/// results are gathered through the dictionary indices. This is typically much
+/// cheaper than decoding the dictionary first.
+///
+/// \return false if the arguments or the function are not eligible, in which
+/// case `out` is left untouched
+ARROW_EXPORT
+Result<bool> ExecuteOnDictionaryValues(const Function& func,
+                                       const std::vector<Datum>& args,
+                                       const FunctionOptions* options, ExecContext* ctx,
+                                       Datum* out);
+
+/// \brief Execute a function on the storage of extension arguments
+///
+/// If some arguments are arrays or chunked arrays of extension types that
+/// allow it (see ExtensionType::ComputeOnStorage), and the function is a
+/// selection, sorting, hashing or set lookup function with no kernel
+/// accepting the extension types, the function is executed on the storage
+/// of the arguments. A result of the storage type is wrapped back into the
+/// extension type, unless the kernel output type is fixed (e.g. indices).
+///
+/// \return false if the arguments or the function are not eligible, in which
+/// case `out` is left untouched
+ARROW_EXPORT
+Result<bool> ExecuteOnExtensionStorage(const Function& func,
+                                       const std::vector<Datum>& args,
+                                       const FunctionOptions* options, ExecContext* ctx,
+                                       Datum* out);
+
+/// \brief Execute a function as Function::Execute does, passing
+/// `output_buffers` to FunctionExecutor::SetOutputBuffers
+///
+/// `options` and `ctx` must not be null.
+ARROW_EXPORT
+Result<Datum> ExecuteFunction(const Function& func, const std::vector<Datum>& args,
+                              const FunctionOptions* options, ExecContext* ctx,
+                              BufferVector output_buffers);
+
 }  // namespace detail
 }  // namespace compute
 }  // namespace arrow
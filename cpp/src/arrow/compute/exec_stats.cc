@@ -0,0 +1,145 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/exec_stats.h"
+
+#include <algorithm>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/array/array_base.h"
+#include "arrow/array/data.h"
+#include "arrow/buffer.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/function.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+int64_t BufferBytes(const ArrayData& data) {
+  int64_t bytes = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      bytes += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    bytes += BufferBytes(*child);
+  }
+  if (data.dictionary != nullptr) {
+    bytes += BufferBytes(*data.dictionary);
+  }
+  return bytes;
+}
+
+void Accumulate(const std::vector<Datum>& args, int64_t nanos, FunctionExecStats* out) {
+  int64_t rows = 0;
+  for (const auto& arg : args) {
+    if (arg.kind() == Datum::ARRAY) {
+      rows = std::max(rows, arg.array()->length);
+      out->bytes += BufferBytes(*arg.array());
+    } else if (arg.kind() == Datum::CHUNKED_ARRAY) {
+      rows = std::max(rows, arg.chunked_array()->length());
+      for (const auto& chunk : arg.chunked_array()->chunks()) {
+        out->bytes += BufferBytes(*chunk->data());
+      }
+    }
+  }
+  ++out->calls;
+  out->rows += rows;
+  out->nanos += nanos;
+}
+
+}  // namespace
+
+class ExecStats::ExecStatsImpl {
+ public:
+  void Record(const Function& func, const Kernel* kernel,
+              const std::vector<Datum>& args, int64_t nanos) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& func_stats = functions_[func.name()];
+    if (func_stats.calls == 0) {
+      func_stats.function_name = func.name();
+    }
+    Accumulate(args, nanos, &func_stats);
+    if (kernel == nullptr) {
+      return;
+    }
+    // Kernels are owned by their functions, which outlive the executions
+    auto& kernel_stats = kernels_[kernel];
+    if (kernel_stats.calls == 0) {
+      kernel_stats.function_name = func.name();
+      kernel_stats.signature = kernel->signature->ToString();
+      kernel_stats.simd_level = kernel->simd_level;
+    }
+    Accumulate(args, nanos, &kernel_stats);
+  }
+
+  ExecStatsSnapshot Snapshot() const {
+    ExecStatsSnapshot snapshot;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto& entry : functions_) {
+        snapshot.functions.push_back(entry.second);
+      }
+      for (const auto& entry : kernels_) {
+        snapshot.kernels.push_back(entry.second);
+      }
+    }
+    std::sort(snapshot.functions.begin(), snapshot.functions.end(),
+              [](const FunctionExecStats& left, const FunctionExecStats& right) {
+                return left.function_name < right.function_name;
+              });
+    std::sort(snapshot.kernels.begin(), snapshot.kernels.end(),
+              [](const KernelExecStats& left, const KernelExecStats& right) {
+                return std::tie(left.function_name, left.signature) <
+                       std::tie(right.function_name, right.signature);
+              });
+    return snapshot;
+  }
+
+  void Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    functions_.clear();
+    kernels_.clear();
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, FunctionExecStats> functions_;
+  std::unordered_map<const Kernel*, KernelExecStats> kernels_;
+};
+
+ExecStats::ExecStats() : impl_(new ExecStatsImpl()) {}
+
+ExecStats::~ExecStats() {}
+
+void ExecStats::Record(const Function& func, const Kernel* kernel,
+                       const std::vector<Datum>& args, int64_t nanos) {
+  impl_->Record(func, kernel, args, nanos);
+}
+
+ExecStatsSnapshot ExecStats::Snapshot() const { return impl_->Snapshot(); }
+
+void ExecStats::Reset() { impl_->Reset(); }
+
+}  // namespace compute
+}  // namespace arrow
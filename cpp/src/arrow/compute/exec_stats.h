@@ -0,0 +1,105 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// NOTE: API is EXPERIMENTAL and will change without going through a
+// deprecation cycle
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/datum.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class Function;
+
+/// \brief Cumulative statistics of the executions of a function
+struct ARROW_EXPORT FunctionExecStats {
+  std::string function_name;
+
+  /// The number of successful executions
+  int64_t calls = 0;
+
+  /// The number of input rows, i.e. the length of the longest array argument
+  int64_t rows = 0;
+
+  /// The size of the buffers referenced by the array arguments
+  int64_t bytes = 0;
+
+  /// Wall time spent in the executions, including nested function calls
+  int64_t nanos = 0;
+};
+
+/// \brief Cumulative statistics of the executions of a kernel
+struct ARROW_EXPORT KernelExecStats : public FunctionExecStats {
+  /// The kernel's signature, e.g. "(int32, int32) -> int32"
+  std::string signature;
+
+  /// The SIMD level the kernel was compiled for
+  SimdLevel::type simd_level = SimdLevel::NONE;
+};
+
+/// \brief A point-in-time copy of the statistics of an ExecStats
+struct ARROW_EXPORT ExecStatsSnapshot {
+  /// Sorted by function name
+  std::vector<FunctionExecStats> functions;
+
+  /// Sorted by function name and kernel signature
+  std::vector<KernelExecStats> kernels;
+};
+
+/// \brief Opt-in collector of function and kernel execution statistics
+///
+/// Attach an ExecStats to an ExecContext with ExecContext::set_exec_stats() to
+/// record every function executed with that context, along with the kernel
+/// selected for it. Meta functions, and functions executed on dictionary
+/// values or extension storage, are recorded without a kernel; the functions
+/// they call are recorded separately.
+///
+/// This class is thread-safe.
+class ARROW_EXPORT ExecStats {
+ public:
+  ExecStats();
+  ~ExecStats();
+
+  /// \brief Record a successful execution of `func`
+  ///
+  /// `kernel` may be null if the function was not executed by a kernel of its
+  /// own.
+  void Record(const Function& func, const Kernel* kernel,
+              const std::vector<Datum>& args, int64_t nanos);
+
+  /// \brief Return the statistics recorded so far
+  ExecStatsSnapshot Snapshot() const;
+
+  /// \brief Discard the statistics recorded so far
+  void Reset();
+
+ private:
+  class ExecStatsImpl;
+  std::unique_ptr<ExecStatsImpl> impl_;
+};
+
+}  // namespace compute
+}  // namespace arrow
@@ -17,10 +17,13 @@
 
 #include <cstring>
 #include <memory>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
 
+#include "arrow/testing/extension_type.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 
@@ -28,11 +31,15 @@
 #include "arrow/array/data.h"
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/cast.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
+#include "arrow/compute/exec_stats.h"
 #include "arrow/compute/function.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/registry.h"
+#include "arrow/extension_type.h"
 #include "arrow/memory_pool.h"
 #include "arrow/scalar.h"
 #include "arrow/status.h"
@@ -84,6 +91,18 @@ TEST(SelectionVector, Basics) {
   ASSERT_EQ(3, sel_vector->indices()[1]);
 }
 
+TEST(SelectionVector, FromMask) {
+  auto mask = ArrayFromJSON(boolean(), "[true, false, null, true, true]");
+  const auto& bool_mask = checked_cast<const BooleanArray&>(*mask);
+  ASSERT_OK_AND_ASSIGN(auto sel_vector, SelectionVector::FromMask(bool_mask));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 3, 4]"), *MakeArray(sel_vector->data()));
+
+  auto sliced = mask->Slice(1, 3);
+  ASSERT_OK_AND_ASSIGN(sel_vector, SelectionVector::FromMask(
+                                       checked_cast<const BooleanArray&>(*sliced)));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[2]"), *MakeArray(sel_vector->data()));
+}
+
 void AssertValidityZeroExtraBits(const ArrayData& arr) {
   const Buffer& buf = *arr.buffers[0];
 
@@ -853,6 +872,588 @@ TEST_F(TestCallScalarFunction, ScalarFunction) {
   ASSERT_TRUE(expected->Equals(*result.scalar()));
 }
 
+TEST_F(TestCallScalarFunction, CallerProvidedOutputBuffers) {
+  auto lhs = ArrayFromJSON(int32(), "[1, 2, null, 4]");
+  auto rhs = ArrayFromJSON(int32(), "[10, null, 30, 40]");
+  auto expected = ArrayFromJSON(int32(), "[11, null, null, 44]");
+  std::vector<Datum> args = {lhs, rhs};
+
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Buffer> validity, AllocateBuffer(8));
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Buffer> values, AllocateBuffer(64));
+  std::memset(validity->mutable_data(), 0xff, validity->size());
+  ArrayData out(int32(), 0, {validity, values});
+
+  // The output is written into the caller's buffers, also when reused
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK_AND_ASSIGN(Datum result,
+                         CallFunction("add", args, nullptr, exec_ctx_.get(), out));
+    ASSERT_OK(result.make_array()->ValidateFull());
+    AssertArraysEqual(*expected, *result.make_array());
+    ASSERT_EQ(values->data(), result.array()->buffers[1]->data());
+    ASSERT_EQ(validity->data(), result.array()->buffers[0]->data());
+  }
+
+  // Too small or immutable buffers are not used
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Buffer> small, AllocateBuffer(8));
+  auto immutable = std::make_shared<Buffer>(values->data(), values->size());
+  for (const auto& buffer : {small, immutable}) {
+    ASSERT_OK_AND_ASSIGN(Datum result,
+                         CallFunction("add", args, nullptr, exec_ctx_.get(),
+                                      ArrayData(int32(), 0, {nullptr, buffer})));
+    AssertArraysEqual(*expected, *result.make_array());
+    ASSERT_NE(buffer->data(), result.array()->buffers[1]->data());
+  }
+
+  // Functions which don't preallocate their output ignore the buffers
+  ASSERT_OK_AND_ASSIGN(Datum result,
+                       CallFunction("test_nopre_data", {ArrayFromJSON(uint8(), "[1, 2]")},
+                                    nullptr, exec_ctx_.get(),
+                                    ArrayData(uint8(), 0, {validity, values})));
+  ASSERT_NE(values->data(), result.array()->buffers[1]->data());
+}
+
+class TestParallelExecution : public TestComputeInternals {
+ public:
+  // Executing with threads must have the same result, with the same chunk
+  // layout, as executing serially
+  void Check(const std::string& func_name, const std::vector<Datum>& args,
+             const FunctionOptions* options = nullptr) {
+    ExecContext serial_ctx;
+    serial_ctx.set_use_threads(false);
+    serial_ctx.set_exec_chunksize(exec_ctx_->exec_chunksize());
+    serial_ctx.set_preallocate_contiguous(exec_ctx_->preallocate_contiguous());
+    ASSERT_OK_AND_ASSIGN(Datum expected,
+                         CallFunction(func_name, args, options, &serial_ctx));
+
+    exec_ctx_->set_use_threads(true);
+    ASSERT_OK_AND_ASSIGN(Datum actual,
+                         CallFunction(func_name, args, options, exec_ctx_.get()));
+    ASSERT_EQ(expected.kind(), actual.kind());
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+    if (expected.kind() == Datum::CHUNKED_ARRAY) {
+      const auto& expected_chunks = expected.chunked_array()->chunks();
+      const auto& actual_chunks = actual.chunked_array()->chunks();
+      ASSERT_EQ(expected_chunks.size(), actual_chunks.size());
+      for (size_t i = 0; i < expected_chunks.size(); ++i) {
+        ASSERT_ARRAYS_EQUAL(*expected_chunks[i], *actual_chunks[i]);
+      }
+    }
+  }
+};
+
+TEST_F(TestParallelExecution, ChunkedArrays) {
+  // Chunks whose lengths aren't multiples of 8 can't write concurrently into a
+  // contiguous preallocation of the output bitmaps
+  for (int chunk_length : {1000, 999}) {
+    SCOPED_TRACE("chunk length " + std::to_string(chunk_length));
+    std::vector<int> sizes(40, chunk_length);
+    sizes.push_back(0);
+    sizes.push_back(17);
+    auto left = GetInt32Chunked(sizes);
+    auto right = GetInt32Chunked(sizes);
+    for (bool preallocate_contiguous : {true, false}) {
+      exec_ctx_->set_preallocate_contiguous(preallocate_contiguous);
+      Check("add", {left, right});
+      Check("add", {left, Datum(std::make_shared<Int32Scalar>(5))});
+      Check("greater", {left, right});
+      Check("is_null", {left});
+    }
+    ASSERT_OK_AND_ASSIGN(Datum strings, Cast(left, utf8()));
+    Check("ascii_upper", {strings});
+    Check("binary_length", {strings});
+    Check("unique", {left});
+    Check("dictionary_encode", {left});
+  }
+}
+
+TEST_F(TestParallelExecution, SplitArrays) {
+  auto values = GetInt32Array(10000);
+  for (int64_t chunksize : {1000, 333}) {
+    exec_ctx_->set_exec_chunksize(chunksize);
+    Check("add", {values, values});
+    Check("invert", {rng_->Boolean(10000, 0.5, 0.1)});
+    Check("is_valid", {values});
+  }
+}
+
+TEST_F(TestParallelExecution, Errors) {
+  auto values = GetInt32Chunked(std::vector<int>(20, 100));
+  exec_ctx_->set_use_threads(true);
+  ASSERT_RAISES(Invalid,
+                CallFunction("divide", {values, Datum(std::make_shared<Int32Scalar>(0))},
+                             exec_ctx_.get()));
+}
+
+class TestCallFunctionOnBatch : public TestComputeInternals {
+ public:
+  // Executing the batch with a selection must have the same result as
+  // executing the filtered batch
+  void Check(const std::string& func_name, const std::vector<Datum>& values,
+             const std::shared_ptr<Array>& mask) {
+    const auto& bool_mask = checked_cast<const BooleanArray&>(*mask);
+    ASSERT_OK_AND_ASSIGN(auto sel_vector, SelectionVector::FromMask(bool_mask));
+    std::vector<Datum> filtered;
+    for (const Datum& value : values) {
+      if (value.is_scalar()) {
+        filtered.push_back(value);
+      } else {
+        ASSERT_OK_AND_ASSIGN(Datum arr, CallFunction("filter", {value, mask}));
+        filtered.push_back(arr);
+      }
+    }
+    ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(func_name, filtered));
+
+    ExecBatch batch(values, mask->length());
+    batch.selection_vector = sel_vector;
+    ASSERT_OK_AND_ASSIGN(Datum actual, CallFunctionOnBatch(func_name, batch));
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+};
+
+TEST_F(TestCallFunctionOnBatch, SelectionAwareKernels) {
+  auto mask = ArrayFromJSON(boolean(), "[true, false, true, true, false, true]");
+  auto left = ArrayFromJSON(int32(), "[1, 2, null, 4, 5, 6]");
+  auto right = ArrayFromJSON(int32(), "[6, null, 4, 3, 2, 1]");
+  Check("add", {left, right}, mask);
+  Check("add", {left, Datum(std::make_shared<Int32Scalar>(10))}, mask);
+  Check("subtract", {Datum(std::make_shared<Int32Scalar>(10)), right}, mask);
+  Check("greater", {left, right}, mask);
+  Check("less", {left, Datum(std::make_shared<Int32Scalar>(4))}, mask);
+  Check("add", {left, Datum(MakeNullScalar(int32()))}, mask);
+
+  auto strings = ArrayFromJSON(utf8(), R"(["a", "bc", null, "d", "", "ef"])");
+  auto other_strings = ArrayFromJSON(utf8(), R"(["b", "bc", "x", null, "", "e"])");
+  Check("equal", {strings, other_strings}, mask);
+
+  auto bools = ArrayFromJSON(boolean(), "[true, false, null, true, false, false]");
+  auto other_bools = ArrayFromJSON(boolean(), "[true, true, true, null, false, true]");
+  Check("and", {bools, other_bools}, mask);
+  Check("xor", {bools, other_bools}, mask);
+  Check("invert", {bools}, mask);
+
+  // Sliced inputs
+  Check("add", {left->Slice(1), right->Slice(1)}, mask->Slice(1));
+}
+
+TEST_F(TestCallFunctionOnBatch, MaterializedSelection) {
+  auto mask = ArrayFromJSON(boolean(), "[true, false, true, true]");
+  auto values = ArrayFromJSON(int32(), "[1, 2, null, 4]");
+  Check("add_checked", {values, values}, mask);
+  Check("ascii_upper", {ArrayFromJSON(utf8(), R"(["a", "b", null, "cd"])")}, mask);
+
+  auto bools = ArrayFromJSON(boolean(), "[true, false, null, false]");
+  Check("and_kleene", {bools, ArrayFromJSON(boolean(), "[null, null, false, true]")},
+        mask);
+}
+
+TEST_F(TestCallFunctionOnBatch, NoSelection) {
+  auto values = ArrayFromJSON(int32(), "[1, 2, null, 4]");
+  ExecBatch batch({values, values}, values->length());
+  ASSERT_OK_AND_ASSIGN(Datum actual, CallFunctionOnBatch("add", batch));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[2, 4, null, 8]"), *actual.make_array());
+}
+
+TEST_F(TestCallFunctionOnBatch, InvalidSelection) {
+  auto values = ArrayFromJSON(int32(), "[1, 2, null, 4]");
+  ExecBatch batch({values, values}, values->length());
+  batch.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[0, 4]"));
+  ASSERT_RAISES(IndexError, CallFunctionOnBatch("add", batch));
+
+  batch.values[1] = values->Slice(1);
+  batch.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[0]"));
+  ASSERT_RAISES(Invalid, CallFunctionOnBatch("add", batch));
+}
+
+class TestCallFunctionOnDictionary : public TestComputeInternals {
+ public:
+  void SetUp() override {
+    TestComputeInternals::SetUp();
+    dict_type_ = dictionary(int32(), utf8());
+    dict_ = DictArrayFromJSON(dict_type_, "[0, 2, null, 1, 2, 3]",
+                              R"(["ab", null, "cd", "Ab"])");
+  }
+
+  // Check against the function executed on the decoded arguments
+  void Check(const std::string& func_name, const std::vector<Datum>& args,
+             const FunctionOptions* options = nullptr) {
+    std::vector<Datum> decoded_args;
+    for (const Datum& arg : args) {
+      if (!arg.is_scalar() && arg.type()->id() == Type::DICTIONARY) {
+        ASSERT_OK_AND_ASSIGN(Datum decoded, Cast(arg, utf8()));
+        decoded_args.push_back(decoded);
+      } else {
+        decoded_args.push_back(arg);
+      }
+    }
+    ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(func_name, decoded_args, options));
+    ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(func_name, args, options));
+    ASSERT_EQ(expected.kind(), actual.kind());
+    if (expected.is_array()) {
+      ASSERT_OK(actual.make_array()->ValidateFull());
+      AssertArraysEqual(*expected.make_array(), *actual.make_array(), /*verbose=*/true);
+    } else {
+      ASSERT_OK(actual.chunked_array()->ValidateFull());
+      AssertChunkedEqual(*expected.chunked_array(), *actual.chunked_array());
+    }
+  }
+
+ protected:
+  std::shared_ptr<DataType> dict_type_;
+  std::shared_ptr<Array> dict_;
+};
+
+TEST_F(TestCallFunctionOnDictionary, Arrays) {
+  Check("ascii_upper", {dict_});
+  Check("ascii_upper", {dict_->Slice(2)});
+  Check("equal", {dict_, MakeScalar("cd")});
+  Check("not_equal", {MakeScalar("ab"), dict_->Slice(1, 3)});
+  MatchSubstringOptions options("b");
+  Check("match_substring", {dict_}, &options);
+
+  ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction("ascii_upper", {dict_}));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["AB", "CD", null, null, "CD", "AB"])"),
+                    *actual.make_array());
+}
+
+TEST_F(TestCallFunctionOnDictionary, ChunkedArrays) {
+  auto other_dict = DictArrayFromJSON(dict_type_, "[1, 0, 1]", R"(["x", "y"])");
+  Check("ascii_upper", {std::make_shared<ChunkedArray>(
+                           ArrayVector{dict_, dict_->Slice(3), other_dict, dict_})});
+  Check("equal", {std::make_shared<ChunkedArray>(ArrayVector{dict_, other_dict}),
+                  MakeScalar("y")});
+
+  ASSERT_OK_AND_ASSIGN(
+      Datum actual,
+      CallFunction("ascii_upper",
+                   {std::make_shared<ChunkedArray>(ArrayVector{}, dict_type_)}));
+  ASSERT_EQ(0, actual.chunked_array()->num_chunks());
+  AssertTypeEqual(*utf8(), *actual.type());
+}
+
+TEST_F(TestCallFunctionOnDictionary, NotEligible) {
+  // No kernel for the dictionary values either
+  ASSERT_RAISES(NotImplemented, CallFunction("add", {dict_, MakeScalar("x")}));
+  // Several array arguments
+  ASSERT_RAISES(NotImplemented, CallFunction("equal", {dict_, dict_}));
+  // Kernels accepting the dictionary directly are used as-is
+  ASSERT_OK_AND_ASSIGN(Datum actual, Cast(dict_, utf8()));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["ab", "cd", null, null, "cd", "Ab"])"),
+                    *actual.make_array());
+}
+
+// An extension type which can be computed on as its int32 storage
+class OrderedIdType : public ExtensionType {
+ public:
+  OrderedIdType() : ExtensionType(int32()) {}
+
+  std::string extension_name() const override { return "ordered_id"; }
+
+  bool ExtensionEquals(const ExtensionType& other) const override {
+    return other.extension_name() == extension_name();
+  }
+
+  std::shared_ptr<Array> MakeArray(std::shared_ptr<ArrayData> data) const override {
+    return std::make_shared<ExtensionArray>(data);
+  }
+
+  Result<std::shared_ptr<DataType>> Deserialize(
+      std::shared_ptr<DataType> storage_type,
+      const std::string& serialized) const override {
+    return std::make_shared<OrderedIdType>();
+  }
+
+  std::string Serialize() const override { return ""; }
+
+  bool ComputeOnStorage() const override { return true; }
+};
+
+class TestCallFunctionOnExtension : public TestComputeInternals {
+ public:
+  void SetUp() override {
+    TestComputeInternals::SetUp();
+    ext_type_ = std::make_shared<OrderedIdType>();
+    storage_ = ArrayFromJSON(int32(), "[3, 1, null, 3, 2, 1]");
+    ext_ = ExtensionType::WrapArray(ext_type_, storage_);
+  }
+
+  std::shared_ptr<Array> Wrap(const std::string& json) {
+    return ExtensionType::WrapArray(ext_type_, ArrayFromJSON(int32(), json));
+  }
+
+ protected:
+  std::shared_ptr<DataType> ext_type_;
+  std::shared_ptr<Array> storage_;
+  std::shared_ptr<Array> ext_;
+};
+
+TEST_F(TestCallFunctionOnExtension, Unique) {
+  ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction("unique", {ext_}));
+  ASSERT_OK(actual.make_array()->ValidateFull());
+  AssertArraysEqual(*Wrap("[3, 1, null, 2]"), *actual.make_array(), /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(actual, CallFunction("value_counts", {ext_}));
+  auto counts = ArrayFromJSON(int64(), "[2, 2, 1, 1]");
+  ASSERT_OK_AND_ASSIGN(auto expected,
+                       StructArray::Make({Wrap("[3, 1, null, 2]"), counts},
+                                         std::vector<std::string>{"values", "counts"}));
+  AssertArraysEqual(*expected, *actual.make_array(), /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(actual, CallFunction("dictionary_encode", {ext_}));
+  const auto& encoded = checked_cast<const DictionaryArray&>(*actual.make_array());
+  AssertTypeEqual(*dictionary(int32(), ext_type_), *encoded.type());
+  AssertArraysEqual(*Wrap("[3, 1, 2]"), *encoded.dictionary(), /*verbose=*/true);
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 1, null, 0, 2, 1]"), *encoded.indices(),
+                    /*verbose=*/true);
+}
+
+TEST_F(TestCallFunctionOnExtension, Sort) {
+  // Index outputs are not wrapped
+  ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction("sort_indices", {ext_}));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[1, 5, 4, 0, 3, 2]"), *actual.make_array(),
+                    /*verbose=*/true);
+
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{ext_->Slice(0, 2), ext_});
+  ASSERT_OK_AND_ASSIGN(actual, CallFunction("sort_indices", {chunked}));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[1, 3, 7, 6, 0, 2, 5, 4]"),
+                    *actual.make_array(), /*verbose=*/true);
+}
+
+TEST_F(TestCallFunctionOnExtension, SetLookup) {
+  SetLookupOptions options(Wrap("[1, 2]"), /*skip_nulls=*/true);
+  ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction("is_in", {ext_}, &options));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[false, true, null, false, true, true]"),
+                    *actual.make_array(), /*verbose=*/true);
+  // The int32 output of index_in is not the storage type
+  ASSERT_OK_AND_ASSIGN(actual, CallFunction("index_in", {ext_}, &options));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[null, 0, null, null, 1, 0]"),
+                    *actual.make_array(), /*verbose=*/true);
+}
+
+TEST_F(TestCallFunctionOnExtension, Hash) {
+  // Also used by hash_partition
+  ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction("hash_array", {storage_}));
+  ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction("hash_array", {ext_}));
+  AssertArraysEqual(*expected.make_array(), *actual.make_array(), /*verbose=*/true);
+}
+
+TEST_F(TestCallFunctionOnExtension, NotEligible) {
+  // Extension types don't allow it by default
+  auto smallint_array =
+      ExtensionType::WrapArray(smallint(), ArrayFromJSON(int16(), "[1]"));
+  ASSERT_RAISES(NotImplemented, CallFunction("unique", {smallint_array}));
+  // Functions which are not about equality or ordering of values
+  ASSERT_RAISES(NotImplemented, CallFunction("add", {ext_, ext_}));
+}
+
+// ----------------------------------------------------------------------
+// PreparedFunction
+
+class TestPreparedFunction : public TestComputeInternals {
+ public:
+  // Executing the prepared function on each of the arguments must have the same
+  // result as CallFunction
+  void Check(const std::string& func_name, const std::vector<std::vector<Datum>>& calls,
+             const FunctionOptions* options = nullptr, bool expect_kernel = true) {
+    ASSERT_OK_AND_ASSIGN(auto prepared,
+                         PreparedFunction::Make(func_name, GetDescrs(calls[0]), options,
+                                                exec_ctx_.get()));
+    ASSERT_EQ(func_name, prepared->function().name());
+    ASSERT_EQ(expect_kernel, prepared->kernel() != nullptr);
+    for (const auto& args : calls) {
+      ASSERT_OK_AND_ASSIGN(Datum expected,
+                           CallFunction(func_name, args, options, exec_ctx_.get()));
+      ASSERT_OK_AND_ASSIGN(Datum actual, prepared->Execute(args));
+      AssertDatumsEqual(expected, actual, /*verbose=*/true);
+    }
+  }
+
+  static std::vector<ValueDescr> GetDescrs(const std::vector<Datum>& args) {
+    std::vector<ValueDescr> descrs;
+    for (const auto& arg : args) {
+      descrs.push_back(arg.descr());
+    }
+    return descrs;
+  }
+};
+
+TEST_F(TestPreparedFunction, ScalarFunctions) {
+  auto scalar = Datum(std::make_shared<Int32Scalar>(5));
+  std::vector<std::vector<Datum>> calls, calls_with_scalar, unary_calls;
+  for (int64_t length : {100, 0, 1000, 4000}) {
+    calls.push_back({GetInt32Array(length), GetInt32Array(length)});
+    calls_with_scalar.push_back({GetInt32Array(length), scalar});
+    unary_calls.push_back({GetInt32Array(length)});
+  }
+  calls.push_back({GetInt32Chunked({10, 0, 20}), GetInt32Chunked({30})});
+  Check("add", calls);
+  Check("greater", calls);
+  Check("add", calls_with_scalar);
+  Check("is_null", unary_calls);
+
+  // The kernel state of scalar functions is kept across calls
+  SetLookupOptions lookup_options(GetInt32Array(100, /*null_probability=*/0),
+                                  /*skip_nulls=*/true);
+  Check("is_in", unary_calls, &lookup_options);
+  Check("index_in", unary_calls, &lookup_options);
+}
+
+TEST_F(TestPreparedFunction, VectorAndAggregateFunctions) {
+  // The kernel state accumulates the results of each call
+  std::vector<std::vector<Datum>> calls;
+  for (int64_t length : {100, 1000, 0, 10}) {
+    calls.push_back({GetInt32Array(length)});
+  }
+  Check("unique", calls);
+  Check("value_counts", calls);
+  Check("array_sort_indices", calls);
+  Check("sum", calls);
+  Check("min_max", calls);
+
+  // Meta functions are dispatched on each call
+  Check("sort_indices", calls, nullptr, /*expect_kernel=*/false);
+}
+
+TEST_F(TestPreparedFunction, NoMatchingKernel) {
+  // Executed on the dictionary values, dispatching on each call
+  ASSERT_OK_AND_ASSIGN(Datum strings, Cast(GetInt32Array(100), utf8()));
+  ASSERT_OK_AND_ASSIGN(Datum dict, CallFunction("dictionary_encode", {strings}));
+  ASSERT_OK_AND_ASSIGN(Datum other_dict, CallFunction("dictionary_encode",
+                                                      {strings.make_array()->Slice(10)}));
+  Check("ascii_upper", {{dict}, {other_dict}}, nullptr, /*expect_kernel=*/false);
+}
+
+TEST_F(TestPreparedFunction, Errors) {
+  auto int32_array = ValueDescr::Array(int32());
+  ASSERT_RAISES(KeyError, PreparedFunction::Make("no_such_function", {int32_array}));
+  ASSERT_RAISES(NotImplemented,
+                PreparedFunction::Make("add", {int32_array, ValueDescr::Array(utf8())}));
+  ASSERT_RAISES(Invalid, PreparedFunction::Make("add", {int32_array}));
+
+  ASSERT_OK_AND_ASSIGN(auto prepared, PreparedFunction::Make(
+                                          "add", {ValueDescr::Array(int32()),
+                                                  ValueDescr::Array(int32())}));
+  auto values = GetInt32Array(10);
+  ASSERT_RAISES(TypeError, prepared->Execute({values}));
+  ASSERT_RAISES(TypeError, prepared->Execute({values, GetFloat64Array(10)}));
+  ASSERT_RAISES(TypeError,
+                prepared->Execute({values, Datum(std::make_shared<Int32Scalar>(5))}));
+  ASSERT_OK(prepared->Execute({values, values}));
+
+  // Kernel errors don't prevent further calls
+  ASSERT_OK_AND_ASSIGN(prepared, PreparedFunction::Make(
+                                     "divide", {ValueDescr::Array(int32()),
+                                                ValueDescr::Scalar(int32())}));
+  ASSERT_RAISES(Invalid,
+                prepared->Execute({values, Datum(std::make_shared<Int32Scalar>(0))}));
+  ASSERT_OK(prepared->Execute({values, Datum(std::make_shared<Int32Scalar>(2))}));
+}
+
+TEST_F(TestPreparedFunction, Clones) {
+  SetLookupOptions lookup_options(GetInt32Array(1000, /*null_probability=*/0),
+                                  /*skip_nulls=*/true);
+  ASSERT_OK_AND_ASSIGN(auto prepared,
+                       PreparedFunction::Make("is_in", {ValueDescr::Array(int32())},
+                                              &lookup_options));
+  std::vector<std::shared_ptr<Array>> inputs;
+  std::vector<Datum> expected;
+  for (int i = 0; i < 8; ++i) {
+    inputs.push_back(GetInt32Array(1000));
+    ASSERT_OK_AND_ASSIGN(Datum result, IsIn(inputs.back(), lookup_options));
+    expected.push_back(result);
+  }
+
+  // Each clone executes on its own thread
+  std::vector<std::thread> threads;
+  std::vector<Datum> results(inputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    std::shared_ptr<PreparedFunction> clone = prepared->Clone();
+    ASSERT_EQ(prepared->kernel(), clone->kernel());
+    threads.emplace_back([&, i, clone] {
+      for (int repeat = 0; repeat < 10; ++repeat) {
+        results[i] = clone->Execute({inputs[i]}).ValueOrDie();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    AssertDatumsEqual(expected[i], results[i]);
+  }
+}
+
+// ----------------------------------------------------------------------
+// ExecStats
+
+class TestExecStats : public TestComputeInternals {
+ public:
+  void SetUp() override {
+    TestComputeInternals::SetUp();
+    exec_ctx_->set_exec_stats(&stats_);
+  }
+
+ protected:
+  ExecStats stats_;
+};
+
+TEST_F(TestExecStats, Basics) {
+  auto arr = ArrayFromJSON(int32(), "[1, 2, null, 4]");
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{arr, arr->Slice(1)});
+  ASSERT_OK(CallFunction("add", {arr, arr}, exec_ctx_.get()));
+  ASSERT_OK(CallFunction("add", {chunked, MakeScalar(1)}, exec_ctx_.get()));
+  // Failures aren't recorded
+  ASSERT_RAISES(NotImplemented, CallFunction("add", {arr, MakeScalar("x")},
+                                             exec_ctx_.get()));
+
+  auto snapshot = stats_.Snapshot();
+  ASSERT_EQ(1, snapshot.functions.size());
+  const auto& func_stats = snapshot.functions[0];
+  ASSERT_EQ("add", func_stats.function_name);
+  ASSERT_EQ(2, func_stats.calls);
+  ASSERT_EQ(4 + 7, func_stats.rows);
+  ASSERT_GT(func_stats.bytes, 0);
+  ASSERT_GE(func_stats.nanos, 0);
+
+  ASSERT_EQ(1, snapshot.kernels.size());
+  const auto& kernel_stats = snapshot.kernels[0];
+  ASSERT_EQ("add", kernel_stats.function_name);
+  ASSERT_EQ("(any[int32], any[int32]) -> int32", kernel_stats.signature);
+  ASSERT_EQ(2, kernel_stats.calls);
+  ASSERT_EQ(func_stats.rows, kernel_stats.rows);
+  ASSERT_EQ(func_stats.bytes, kernel_stats.bytes);
+
+  stats_.Reset();
+  snapshot = stats_.Snapshot();
+  ASSERT_EQ(0, snapshot.functions.size());
+  ASSERT_EQ(0, snapshot.kernels.size());
+
+  // Nothing is recorded without a collector
+  ASSERT_OK(CallFunction("add", {arr, arr}));
+  ASSERT_EQ(0, stats_.Snapshot().functions.size());
+}
+
+TEST_F(TestExecStats, MetaFunction) {
+  // "cast" dispatches to a function per output type
+  auto arr = ArrayFromJSON(int32(), "[1, 2, 3]");
+  ASSERT_OK(Cast(arr, int64(), CastOptions::Safe(), exec_ctx_.get()));
+  ASSERT_OK(Cast(arr, float64(), CastOptions::Safe(), exec_ctx_.get()));
+
+  auto snapshot = stats_.Snapshot();
+  ASSERT_EQ(3, snapshot.functions.size());
+  ASSERT_EQ("cast", snapshot.functions[0].function_name);
+  ASSERT_EQ(2, snapshot.functions[0].calls);
+  ASSERT_EQ("cast_double", snapshot.functions[1].function_name);
+  ASSERT_EQ("cast_int64", snapshot.functions[2].function_name);
+  ASSERT_EQ(1, snapshot.functions[2].calls);
+  ASSERT_EQ(3, snapshot.functions[2].rows);
+
+  ASSERT_EQ(2, snapshot.kernels.size());
+  ASSERT_EQ("cast_double", snapshot.kernels[0].function_name);
+  ASSERT_EQ("cast_int64", snapshot.kernels[1].function_name);
+}
+
 }  // namespace detail
 }  // namespace compute
 }  // namespace arrow
@@ -23,8 +23,11 @@
 
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
+#include "arrow/compute/exec_stats.h"
 #include "arrow/datum.h"
 #include "arrow/util/cpu_info.h"
+#include "arrow/util/stopwatch.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace compute {
@@ -114,16 +117,57 @@ Result<Datum> Function::Execute(const std::vector<Datum>& args,
     ExecContext default_ctx;
     return Execute(args, options, &default_ctx);
   }
+  ARROW_TRACE_SPAN("compute", name().c_str());
+  return detail::ExecuteFunction(*this, args, options, ctx, /*output_buffers=*/{});
+}
+
+namespace detail {
+
+Result<Datum> ExecuteFunction(const Function& func, const std::vector<Datum>& args,
+                              const FunctionOptions* options, ExecContext* ctx,
+                              BufferVector output_buffers) {
+  if (func.kind() == Function::META) {
+    return func.Execute(args, options, ctx);
+  }
+  if (func.kind() == Function::HASH_AGGREGATE) {
+    return Status::NotImplemented(
+        "Direct execution of HASH_AGGREGATE functions, use GroupBy instead");
+  }
   // type-check Datum arguments here. Really we'd like to avoid this as much as
   // possible
-  RETURN_NOT_OK(detail::CheckAllValues(args));
-  ARROW_ASSIGN_OR_RAISE(auto executor,
-                        detail::FunctionExecutor::Make(ctx, this, options));
-  auto listener = std::make_shared<detail::DatumAccumulator>();
+  RETURN_NOT_OK(CheckAllValues(args));
+  Datum dict_result;
+  ARROW_ASSIGN_OR_RAISE(
+      bool executed_on_dictionary,
+      ExecuteOnDictionaryValues(func, args, options, ctx, &dict_result));
+  if (executed_on_dictionary) {
+    return dict_result;
+  }
+  Datum storage_result;
+  ARROW_ASSIGN_OR_RAISE(
+      bool executed_on_storage,
+      ExecuteOnExtensionStorage(func, args, options, ctx, &storage_result));
+  if (executed_on_storage) {
+    return storage_result;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto executor, FunctionExecutor::Make(ctx, &func, options));
+  executor->SetOutputBuffers(std::move(output_buffers));
+  auto listener = std::make_shared<DatumAccumulator>();
+  ExecStats* stats = ctx->exec_stats();
+  ::arrow::internal::StopWatch watch;
+  if (stats != nullptr) {
+    watch.Start();
+  }
   RETURN_NOT_OK(executor->Execute(args, listener.get()));
-  return executor->WrapResults(args, listener->values());
+  Datum out = executor->WrapResults(args, listener->values());
+  if (stats != nullptr) {
+    stats->Record(func, executor->kernel(), args, static_cast<int64_t>(watch.Stop()));
+  }
+  return out;
 }
 
+}  // namespace detail
+
 Status Function::Validate() const {
   if (!doc_->summary.empty()) {
     // Documentation given, check its contents
@@ -203,6 +247,20 @@ Result<const ScalarAggregateKernel*> ScalarAggregateFunction::DispatchExact(
   return DispatchExactImpl(*this, kernels_, values);
 }
 
+Status HashAggregateFunction::AddKernel(HashAggregateKernel kernel) {
+  RETURN_NOT_OK(CheckArity(static_cast<int>(kernel.signature->in_types().size())));
+  if (arity_.is_varargs && !kernel.signature->is_varargs()) {
+    return Status::Invalid("Function accepts varargs but kernel signature does not");
+  }
+  kernels_.emplace_back(std::move(kernel));
+  return Status::OK();
+}
+
+Result<const HashAggregateKernel*> HashAggregateFunction::DispatchExact(
+    const std::vector<ValueDescr>& values) const {
+  return DispatchExactImpl(*this, kernels_, values);
+}
+
 Result<Datum> MetaFunction::Execute(const std::vector<Datum>& args,
                                     const FunctionOptions* options,
                                     ExecContext* ctx) const {
@@ -210,7 +268,16 @@ Result<Datum> MetaFunction::Execute(const std::vector<Datum>& args,
   if (options == nullptr) {
     options = default_options();
   }
-  return ExecuteImpl(args, options, ctx);
+  ARROW_TRACE_SPAN("compute", name().c_str());
+  ExecStats* stats = ctx == nullptr ? nullptr : ctx->exec_stats();
+  if (stats == nullptr) {
+    return ExecuteImpl(args, options, ctx);
+  }
+  ::arrow::internal::StopWatch watch;
+  watch.Start();
+  ARROW_ASSIGN_OR_RAISE(Datum out, ExecuteImpl(args, options, ctx));
+  stats->Record(*this, /*kernel=*/nullptr, args, static_cast<int64_t>(watch.Stop()));
+  return out;
 }
 
 }  // namespace compute
@@ -131,6 +131,10 @@ class ARROW_EXPORT Function {
     /// A function that computes scalar summary statistics from array input.
     SCALAR_AGGREGATE,
 
+    /// A function that computes grouped summary statistics from array input
+    /// and an array of group identifiers.
+    HASH_AGGREGATE,
+
     /// A function that dispatches to other functions and does not contain its
     /// own kernels.
     META
@@ -302,6 +306,26 @@ class ARROW_EXPORT ScalarAggregateFunction
 ///
 /// For Array, ChunkedArray, and Scalar Datum kinds, may rely on the execution
 /// of concrete Function types, but must handle other Datum kinds on its own.
+class ARROW_EXPORT HashAggregateFunction
+    : public detail::FunctionImpl<HashAggregateKernel> {
+ public:
+  using KernelType = HashAggregateKernel;
+
+  HashAggregateFunction(std::string name, const Arity& arity, const FunctionDoc* doc,
+                        const FunctionOptions* default_options = NULLPTR)
+      : detail::FunctionImpl<HashAggregateKernel>(
+            std::move(name), Function::HASH_AGGREGATE, arity, doc, default_options) {}
+
+  /// \brief Add a kernel (function implementation). Returns error if the
+  /// kernel's signature does not match the function's arity.
+  Status AddKernel(HashAggregateKernel kernel);
+
+  /// \brief Return a kernel that can execute the function given the exact
+  /// argument types (without implicit type casts or scalar->array promotions)
+  Result<const HashAggregateKernel*> DispatchExact(
+      const std::vector<ValueDescr>& values) const;
+};
+
 class ARROW_EXPORT MetaFunction : public Function {
  public:
   int num_kernels() const override { return 0; }
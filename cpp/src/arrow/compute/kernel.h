@@ -600,6 +600,15 @@ struct ScalarKernel : public ArrayKernel {
   // bitmaps is a reasonable default
   NullHandling::type null_handling = NullHandling::INTERSECTION;
   MemAllocation::type mem_allocation = MemAllocation::PREALLOCATE;
+
+  /// \brief Whether the kernel can execute an ExecBatch with a selection
+  /// vector, computing only the selected rows into an output of the
+  /// selection's length. The executor takes care of the output validity
+  /// bitmap, according to the null handling. If false, the selection is
+  /// materialized before executing the kernel.
+  ///
+  /// This requires that the output data be preallocated.
+  bool can_use_selection_vector = false;
 };
 
 // ----------------------------------------------------------------------
@@ -649,6 +658,11 @@ struct VectorKernel : public ArrayKernel {
   /// be passed whole arrays and don't work on ChunkedArray inputs
   bool can_execute_chunkwise = true;
 
+  /// Some chunkwise kernels with state (like the hash kernels) can execute
+  /// batches concurrently when the ExecContext enables threads. Their finalizer
+  /// is passed the batches' outputs in batch order.
+  bool can_execute_concurrently = false;
+
   /// Some kernels (like unique and value_counts) yield non-chunked output from
   /// chunked-array inputs. This option controls how the results are boxed when
   /// returned from ExecVectorFunction
@@ -701,5 +715,58 @@ struct ScalarAggregateKernel : public Kernel {
   ScalarAggregateFinalize finalize;
 };
 
+// ----------------------------------------------------------------------
+// HashAggregateKernel (for HashAggregateFunction)
+
+using HashAggregateResize = std::function<void(KernelContext*, int64_t)>;
+
+using HashAggregateConsume = std::function<void(KernelContext*, const ExecBatch&)>;
+
+using HashAggregateMerge =
+    std::function<void(KernelContext*, KernelState&&, const ArrayData&)>;
+
+// Finalize returns Datum to permit multiple return values
+using HashAggregateFinalize = std::function<void(KernelContext*, Datum*)>;
+
+/// \brief Kernel data structure for implementations of
+/// HashAggregateFunction. The five necessary components of an aggregation
+/// kernel are the init, resize, consume, merge, and finalize functions.
+///
+/// * init: creates a new KernelState for a kernel.
+/// * resize: ensure that the KernelState can accommodate the specified number
+///   of groups.
+/// * consume: processes an ExecBatch (which includes the argument as well as
+///   an array of uint32 group ids) and updates the KernelState found in the
+///   KernelContext.
+/// * merge: combines one KernelState with the KernelState in the
+///   KernelContext. The passed uint32 array maps each group id of the source
+///   state to a group id of the destination state.
+/// * finalize: produces the end result of the aggregation using the
+///   KernelState in the KernelContext, as an array with one slot per group.
+struct HashAggregateKernel : public Kernel {
+  HashAggregateKernel() {}
+
+  HashAggregateKernel(std::shared_ptr<KernelSignature> sig, KernelInit init,
+                      HashAggregateResize resize, HashAggregateConsume consume,
+                      HashAggregateMerge merge, HashAggregateFinalize finalize)
+      : Kernel(std::move(sig), init),
+        resize(std::move(resize)),
+        consume(std::move(consume)),
+        merge(std::move(merge)),
+        finalize(std::move(finalize)) {}
+
+  HashAggregateKernel(std::vector<InputType> in_types, OutputType out_type,
+                      KernelInit init, HashAggregateResize resize,
+                      HashAggregateConsume consume, HashAggregateMerge merge,
+                      HashAggregateFinalize finalize)
+      : HashAggregateKernel(KernelSignature::Make(std::move(in_types), out_type), init,
+                            resize, consume, merge, finalize) {}
+
+  HashAggregateResize resize;
+  HashAggregateConsume consume;
+  HashAggregateMerge merge;
+  HashAggregateFinalize finalize;
+};
+
 }  // namespace compute
 }  // namespace arrow
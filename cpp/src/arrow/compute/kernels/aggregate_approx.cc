@@ -0,0 +1,254 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/kernels/aggregate_basic_internal.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/hyperloglog.h"
+#include "arrow/util/tdigest.h"
+
+namespace arrow {
+namespace compute {
+namespace aggregate {
+
+namespace {
+
+using ::arrow::internal::HyperLogLog;
+using ::arrow::internal::ScalarHelper;
+using ::arrow::internal::TDigest;
+
+// ----------------------------------------------------------------------
+// approx_count_distinct implementation
+
+template <typename ArrowType>
+struct ApproxCountDistinctImpl : public ScalarAggregator {
+  using ThisType = ApproxCountDistinctImpl<ArrowType>;
+  using ValueType = typename internal::GetViewType<ArrowType>::T;
+
+  explicit ApproxCountDistinctImpl(int precision) : sketch(precision) {}
+
+  void Consume(KernelContext*, const ExecBatch& batch) override {
+    VisitArrayDataInline<ArrowType>(
+        *batch[0].array(),
+        [this](ValueType value) {
+          sketch.Update(ScalarHelper<ValueType, 0>::ComputeHash(value));
+        },
+        []() {});
+  }
+
+  void MergeFrom(KernelContext* ctx, KernelState&& src) override {
+    const auto& other = checked_cast<const ThisType&>(src);
+    KERNEL_RETURN_IF_ERROR(ctx, sketch.Merge(other.sketch));
+  }
+
+  void Finalize(KernelContext*, Datum* out) override {
+    out->value =
+        std::make_shared<Int64Scalar>(static_cast<int64_t>(std::llround(sketch.Estimate())));
+  }
+
+  HyperLogLog sketch;
+};
+
+struct ApproxCountDistinctInitState {
+  std::unique_ptr<KernelState> state;
+  KernelContext* ctx;
+  const DataType& in_type;
+  int precision;
+
+  Status Visit(const DataType&) {
+    return Status::NotImplemented("No approx_count_distinct implemented for ",
+                                  in_type);
+  }
+
+  Status Visit(const HalfFloatType&) {
+    return Status::NotImplemented("No approx_count_distinct implemented for ",
+                                  in_type);
+  }
+
+  template <typename Type>
+  enable_if_t<has_c_type<Type>::value || is_base_binary_type<Type>::value, Status> Visit(
+      const Type&) {
+    state.reset(new ApproxCountDistinctImpl<Type>(precision));
+    return Status::OK();
+  }
+
+  std::unique_ptr<KernelState> Create() {
+    ctx->SetStatus(VisitTypeInline(in_type, this));
+    return std::move(state);
+  }
+};
+
+std::unique_ptr<KernelState> ApproxCountDistinctInit(KernelContext* ctx,
+                                                     const KernelInitArgs& args) {
+  const auto& options = static_cast<const ApproxCountDistinctOptions&>(*args.options);
+  auto precision_check = HyperLogLog::Make(options.precision);
+  if (!precision_check.ok()) {
+    ctx->SetStatus(precision_check.status());
+    return nullptr;
+  }
+  ApproxCountDistinctInitState visitor{nullptr, ctx, *args.inputs[0].type,
+                                       options.precision};
+  return visitor.Create();
+}
+
+// ----------------------------------------------------------------------
+// approx_quantile implementation
+
+template <typename ArrowType>
+struct ApproxQuantileImpl : public ScalarAggregator {
+  using ThisType = ApproxQuantileImpl<ArrowType>;
+  using c_type = typename ArrowType::c_type;
+
+  explicit ApproxQuantileImpl(const ApproxQuantileOptions& options)
+      : q(options.q), digest(options.delta, options.buffer_size) {}
+
+  void Consume(KernelContext*, const ExecBatch& batch) override {
+    VisitArrayDataInline<ArrowType>(
+        *batch[0].array(),
+        [this](c_type value) {
+          const auto v = static_cast<double>(value);
+          if (!std::isnan(v)) {
+            digest.Add(v);
+          }
+        },
+        []() {});
+  }
+
+  void MergeFrom(KernelContext*, KernelState&& src) override {
+    const auto& other = checked_cast<const ThisType&>(src);
+    digest.Merge(other.digest);
+  }
+
+  void Finalize(KernelContext* ctx, Datum* out) override {
+    DoubleBuilder builder(ctx->memory_pool());
+    KERNEL_RETURN_IF_ERROR(ctx, builder.Reserve(q.size()));
+    const bool is_empty = digest.is_empty();
+    for (double quantile : q) {
+      if (is_empty) {
+        builder.UnsafeAppendNull();
+      } else {
+        builder.UnsafeAppend(digest.Quantile(quantile));
+      }
+    }
+    std::shared_ptr<ArrayData> result;
+    KERNEL_RETURN_IF_ERROR(ctx, builder.FinishInternal(&result));
+    out->value = std::move(result);
+  }
+
+  std::vector<double> q;
+  TDigest digest;
+};
+
+struct ApproxQuantileInitState {
+  std::unique_ptr<KernelState> state;
+  KernelContext* ctx;
+  const DataType& in_type;
+  const ApproxQuantileOptions& options;
+
+  Status Visit(const DataType&) {
+    return Status::NotImplemented("No approx_quantile implemented for ", in_type);
+  }
+
+  Status Visit(const HalfFloatType&) {
+    return Status::NotImplemented("No approx_quantile implemented for ", in_type);
+  }
+
+  template <typename Type>
+  enable_if_t<is_number_type<Type>::value, Status> Visit(const Type&) {
+    state.reset(new ApproxQuantileImpl<Type>(options));
+    return Status::OK();
+  }
+
+  std::unique_ptr<KernelState> Create() {
+    ctx->SetStatus(VisitTypeInline(in_type, this));
+    return std::move(state);
+  }
+};
+
+std::unique_ptr<KernelState> ApproxQuantileInit(KernelContext* ctx,
+                                                const KernelInitArgs& args) {
+  const auto& options = static_cast<const ApproxQuantileOptions&>(*args.options);
+  for (double q : options.q) {
+    if (!(q >= 0 && q <= 1)) {
+      ctx->SetStatus(Status::Invalid("Quantile must be between 0 and 1, got ", q));
+      return nullptr;
+    }
+  }
+  ApproxQuantileInitState visitor{nullptr, ctx, *args.inputs[0].type, options};
+  return visitor.Create();
+}
+
+const FunctionDoc approx_count_distinct_doc{
+    "Estimate the number of distinct values of an array",
+    ("The estimate is given by a HyperLogLog sketch of the value hashes, whose\n"
+     "size and accuracy are controlled by ApproxCountDistinctOptions.  The\n"
+     "relative standard error is about 1.04 / sqrt(2 ^ precision).\n"
+     "Nulls are ignored."),
+    {"array"},
+    "ApproxCountDistinctOptions"};
+
+const FunctionDoc approx_quantile_doc{
+    "Estimate quantiles of a numeric array",
+    ("The estimates are given by a t-digest of the input values, which is most\n"
+     "accurate for extreme quantiles.  The output is a double array with one\n"
+     "value per quantile requested in ApproxQuantileOptions.\n"
+     "Nulls and NaNs are ignored.  If there are no other values, the output\n"
+     "values are null."),
+    {"array"},
+    "ApproxQuantileOptions"};
+
+}  // namespace
+
+std::shared_ptr<ScalarAggregateFunction> AddApproxCountDistinctAggKernels() {
+  static auto default_options = ApproxCountDistinctOptions::Defaults();
+  auto func = std::make_shared<ScalarAggregateFunction>(
+      "approx_count_distinct", Arity::Unary(), &approx_count_distinct_doc,
+      &default_options);
+  auto add_kernel = [&](InputType in_type) {
+    auto sig = KernelSignature::Make({std::move(in_type)}, ValueDescr::Scalar(int64()));
+    AddAggKernel(std::move(sig), ApproxCountDistinctInit, func.get());
+  };
+  add_kernel(InputType::Array(boolean()));
+  for (const auto& ty : internal::NumericTypes()) {
+    add_kernel(InputType::Array(ty));
+  }
+  for (const auto& ty : internal::BaseBinaryTypes()) {
+    add_kernel(InputType::Array(ty));
+  }
+  for (const auto id : {Type::DATE32, Type::DATE64, Type::TIME32, Type::TIME64,
+                        Type::TIMESTAMP, Type::DURATION}) {
+    add_kernel(InputType::Array(id));
+  }
+  return func;
+}
+
+std::shared_ptr<ScalarAggregateFunction> AddApproxQuantileAggKernels() {
+  static auto default_options = ApproxQuantileOptions::Defaults();
+  auto func = std::make_shared<ScalarAggregateFunction>(
+      "approx_quantile", Arity::Unary(), &approx_quantile_doc, &default_options);
+  for (const auto& ty : internal::NumericTypes()) {
+    auto sig = KernelSignature::Make({InputType::Array(ty)}, float64());
+    AddAggKernel(std::move(sig), ApproxQuantileInit, func.get());
+  }
+  return func;
+}
+
+}  // namespace aggregate
+}  // namespace compute
+}  // namespace arrow
@@ -15,11 +15,18 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <limits>
+
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/kernels/aggregate_basic_internal.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
 #include "arrow/compute/kernels/common.h"
+#include "arrow/compute/kernels/decimal_internal.h"
+#include "arrow/util/bit_block_counter.h"
 #include "arrow/util/cpu_info.h"
+#include "arrow/util/decimal.h"
+#include "arrow/util/int_util_internal.h"
 #include "arrow/util/make_unique.h"
 
 namespace arrow {
@@ -137,6 +144,228 @@ std::unique_ptr<KernelState> MinMaxInit(KernelContext* ctx, const KernelInitArgs
   return visitor.Create();
 }
 
+// ----------------------------------------------------------------------
+// Decimal sum, mean and min/max implementation
+//
+// Decimal values with a precision of at most 18 digits are aggregated on 64-bit
+// integers, see kMaxDecimal64Precision.
+
+using ::arrow::compute::internal::kMaxDecimal64Precision;
+using ::arrow::compute::internal::LoadDecimal64;
+
+// Call visit(i) for the index of each valid value of a decimal array
+template <typename Visit>
+void VisitValidDecimals(const ArrayData& data, Visit&& visit) {
+  const uint8_t* bitmap = data.GetValues<uint8_t>(0, 0);
+  arrow::internal::OptionalBitBlockCounter bit_counter(bitmap, data.offset, data.length);
+  int64_t position = 0;
+  while (position < data.length) {
+    const auto block = bit_counter.NextBlock();
+    if (block.AllSet()) {
+      for (int64_t i = position; i < position + block.length; ++i) {
+        visit(i);
+      }
+    } else if (!block.NoneSet()) {
+      for (int64_t i = position; i < position + block.length; ++i) {
+        if (BitUtil::GetBit(bitmap, data.offset + i)) {
+          visit(i);
+        }
+      }
+    }
+    position += block.length;
+  }
+}
+
+struct DecimalSumImpl : public ScalarAggregator {
+  DecimalSumImpl(std::shared_ptr<DataType> out_type, const Decimal128Type& in_type)
+      : out_type(std::move(out_type)),
+        use_64_bits(in_type.precision() <= kMaxDecimal64Precision) {}
+
+  void Consume(KernelContext*, const ExecBatch& batch) override {
+    const ArrayData& data = *batch[0].array();
+    const uint8_t* values = data.GetValues<uint8_t>(1, data.offset * 16);
+    count += data.length - data.GetNullCount();
+    if (use_64_bits) {
+      // Sum on an int64_t, which is only added to the 128-bit sum on overflow
+      int64_t partial_sum = 0;
+      VisitValidDecimals(data, [&](int64_t i) {
+        const int64_t value = LoadDecimal64(values + i * 16);
+        int64_t next;
+        if (ARROW_PREDICT_FALSE(
+                arrow::internal::AddWithOverflow(partial_sum, value, &next))) {
+          sum += BasicDecimal128(partial_sum);
+          next = value;
+        }
+        partial_sum = next;
+      });
+      sum += BasicDecimal128(partial_sum);
+    } else {
+      VisitValidDecimals(data,
+                         [&](int64_t i) { sum += BasicDecimal128(values + i * 16); });
+    }
+  }
+
+  void MergeFrom(KernelContext*, KernelState&& src) override {
+    const auto& other = checked_cast<const DecimalSumImpl&>(src);
+    count += other.count;
+    sum += other.sum;
+  }
+
+  void Finalize(KernelContext*, Datum* out) override {
+    if (count == 0) {
+      out->value = std::make_shared<Decimal128Scalar>(out_type);
+    } else {
+      out->value = std::make_shared<Decimal128Scalar>(sum, out_type);
+    }
+  }
+
+  std::shared_ptr<DataType> out_type;
+  bool use_64_bits;
+  int64_t count = 0;
+  BasicDecimal128 sum;
+};
+
+struct DecimalMeanImpl : public DecimalSumImpl {
+  using DecimalSumImpl::DecimalSumImpl;
+
+  void Finalize(KernelContext* ctx, Datum* out) override {
+    if (count == 0) {
+      out->value = std::make_shared<Decimal128Scalar>(out_type);
+      return;
+    }
+    // The mean has the scale of the input, rounded half away from zero
+    const BasicDecimal128 divisor(count);
+    BasicDecimal128 mean, remainder;
+    if (sum.Divide(divisor, &mean, &remainder) != DecimalStatus::kSuccess) {
+      ctx->SetStatus(Status::Invalid("Decimal mean failed"));
+      return;
+    }
+    const BasicDecimal128 abs_remainder = BasicDecimal128::Abs(remainder);
+    if (abs_remainder + abs_remainder >= divisor) {
+      mean += BasicDecimal128(sum.Sign());
+    }
+    out->value = std::make_shared<Decimal128Scalar>(mean, out_type);
+  }
+};
+
+struct DecimalMinMaxImpl : public ScalarAggregator {
+  DecimalMinMaxImpl(std::shared_ptr<DataType> out_type, const Decimal128Type& in_type,
+                    const MinMaxOptions& options)
+      : out_type(std::move(out_type)),
+        options(options),
+        use_64_bits(in_type.precision() <= kMaxDecimal64Precision) {}
+
+  void Consume(KernelContext*, const ExecBatch& batch) override {
+    const ArrayData& data = *batch[0].array();
+    const int64_t null_count = data.GetNullCount();
+    has_nulls |= null_count > 0;
+    if (data.length == null_count ||
+        (has_nulls && options.null_handling == MinMaxOptions::EMIT_NULL)) {
+      return;
+    }
+    has_values = true;
+
+    const uint8_t* values = data.GetValues<uint8_t>(1, data.offset * 16);
+    if (use_64_bits) {
+      int64_t local_min = std::numeric_limits<int64_t>::max();
+      int64_t local_max = std::numeric_limits<int64_t>::min();
+      VisitValidDecimals(data, [&](int64_t i) {
+        const int64_t value = LoadDecimal64(values + i * 16);
+        local_min = std::min(local_min, value);
+        local_max = std::max(local_max, value);
+      });
+      MergeOne(BasicDecimal128(local_min), BasicDecimal128(local_max));
+    } else {
+      VisitValidDecimals(data, [&](int64_t i) {
+        const BasicDecimal128 value(values + i * 16);
+        MergeOne(value, value);
+      });
+    }
+  }
+
+  void MergeFrom(KernelContext*, KernelState&& src) override {
+    const auto& other = checked_cast<const DecimalMinMaxImpl&>(src);
+    has_nulls |= other.has_nulls;
+    if (other.has_values) {
+      has_values = true;
+      MergeOne(other.min, other.max);
+    }
+  }
+
+  void Finalize(KernelContext*, Datum* out) override {
+    const auto& value_type = out_type->field(0)->type();
+    std::vector<std::shared_ptr<Scalar>> values;
+    if (!has_values || (has_nulls && options.null_handling == MinMaxOptions::EMIT_NULL)) {
+      // (null, null)
+      values = {std::make_shared<Decimal128Scalar>(value_type),
+                std::make_shared<Decimal128Scalar>(value_type)};
+    } else {
+      values = {std::make_shared<Decimal128Scalar>(min, value_type),
+                std::make_shared<Decimal128Scalar>(max, value_type)};
+    }
+    out->value = std::make_shared<StructScalar>(std::move(values), out_type);
+  }
+
+  void MergeOne(const BasicDecimal128& other_min, const BasicDecimal128& other_max) {
+    if (other_min < min) min = other_min;
+    if (other_max > max) max = other_max;
+  }
+
+  std::shared_ptr<DataType> out_type;
+  MinMaxOptions options;
+  bool use_64_bits;
+  bool has_nulls = false;
+  bool has_values = false;
+  BasicDecimal128 min = BasicDecimal128::GetMaxValue();
+  BasicDecimal128 max = -BasicDecimal128::GetMaxValue();
+};
+
+// The sum of decimal(p, s) values is a decimal(38, s)
+Result<ValueDescr> ResolveDecimalSumOutput(KernelContext*,
+                                           const std::vector<ValueDescr>& args) {
+  const auto& type = checked_cast<const Decimal128Type&>(*args[0].type);
+  return ValueDescr::Scalar(decimal(Decimal128Type::kMaxPrecision, type.scale()));
+}
+
+Result<ValueDescr> ResolveDecimalMeanOutput(KernelContext*,
+                                            const std::vector<ValueDescr>& args) {
+  return ValueDescr::Scalar(args[0].type);
+}
+
+Result<ValueDescr> ResolveDecimalMinMaxOutput(KernelContext*,
+                                              const std::vector<ValueDescr>& args) {
+  const auto& type = args[0].type;
+  return ValueDescr::Scalar(struct_({field("min", type), field("max", type)}));
+}
+
+std::unique_ptr<KernelState> DecimalSumInit(KernelContext* ctx,
+                                            const KernelInitArgs& args) {
+  auto out_type = ResolveDecimalSumOutput(ctx, args.inputs).ValueOrDie().type;
+  return ::arrow::internal::make_unique<DecimalSumImpl>(
+      std::move(out_type), checked_cast<const Decimal128Type&>(*args.inputs[0].type));
+}
+
+std::unique_ptr<KernelState> DecimalMeanInit(KernelContext*, const KernelInitArgs& args) {
+  return ::arrow::internal::make_unique<DecimalMeanImpl>(
+      args.inputs[0].type, checked_cast<const Decimal128Type&>(*args.inputs[0].type));
+}
+
+std::unique_ptr<KernelState> DecimalMinMaxInit(KernelContext* ctx,
+                                               const KernelInitArgs& args) {
+  auto out_type = ResolveDecimalMinMaxOutput(ctx, args.inputs).ValueOrDie().type;
+  return ::arrow::internal::make_unique<DecimalMinMaxImpl>(
+      std::move(out_type),
+      checked_cast<const Decimal128Type&>(*args.inputs[0].type),
+      static_cast<const MinMaxOptions&>(*args.options));
+}
+
+void AddDecimalAggKernel(KernelInit init, OutputType::Resolver resolver,
+                         ScalarAggregateFunction* func) {
+  auto sig = KernelSignature::Make({InputType::Array(Type::DECIMAL)},
+                                   OutputType(std::move(resolver)));
+  AddAggKernel(std::move(sig), init, func);
+}
+
 void AddAggKernel(std::shared_ptr<KernelSignature> sig, KernelInit init,
                   ScalarAggregateFunction* func, SimdLevel::type simd_level) {
   ScalarAggregateKernel kernel(std::move(sig), init, AggregateConsume, AggregateMerge,
@@ -214,6 +443,8 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
                                 func.get());
   aggregate::AddBasicAggKernels(aggregate::SumInit, FloatingPointTypes(), float64(),
                                 func.get());
+  aggregate::AddDecimalAggKernel(aggregate::DecimalSumInit,
+                                 aggregate::ResolveDecimalSumOutput, func.get());
   // Add the SIMD variants for sum
   auto cpu_info = arrow::internal::CpuInfo::GetInstance();
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
@@ -232,6 +463,8 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   aggregate::AddBasicAggKernels(aggregate::MeanInit, {boolean()}, float64(), func.get());
   aggregate::AddBasicAggKernels(aggregate::MeanInit, NumericTypes(), float64(),
                                 func.get());
+  aggregate::AddDecimalAggKernel(aggregate::DecimalMeanInit,
+                                 aggregate::ResolveDecimalMeanOutput, func.get());
   // Add the SIMD variants for mean
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
   if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
@@ -250,6 +483,8 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
                                                    &min_max_doc, &default_minmax_options);
   aggregate::AddMinMaxKernels(aggregate::MinMaxInit, {boolean()}, func.get());
   aggregate::AddMinMaxKernels(aggregate::MinMaxInit, NumericTypes(), func.get());
+  aggregate::AddDecimalAggKernel(aggregate::DecimalMinMaxInit,
+                                 aggregate::ResolveDecimalMinMaxOutput, func.get());
   // Add the SIMD variants for min max
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
   if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
@@ -267,6 +502,8 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunction(aggregate::AddModeAggKernels()));
   DCHECK_OK(registry->AddFunction(aggregate::AddStddevAggKernels()));
   DCHECK_OK(registry->AddFunction(aggregate::AddVarianceAggKernels()));
+  DCHECK_OK(registry->AddFunction(aggregate::AddApproxCountDistinctAggKernels()));
+  DCHECK_OK(registry->AddFunction(aggregate::AddApproxQuantileAggKernels()));
 }
 
 }  // namespace internal
@@ -61,6 +61,8 @@ void AddMinMaxAvx512AggKernels(ScalarAggregateFunction* func);
 std::shared_ptr<ScalarAggregateFunction> AddModeAggKernels();
 std::shared_ptr<ScalarAggregateFunction> AddStddevAggKernels();
 std::shared_ptr<ScalarAggregateFunction> AddVarianceAggKernels();
+std::shared_ptr<ScalarAggregateFunction> AddApproxCountDistinctAggKernels();
+std::shared_ptr<ScalarAggregateFunction> AddApproxQuantileAggKernels();
 
 // ----------------------------------------------------------------------
 // Sum implementation
@@ -25,8 +25,10 @@
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/type.h"
@@ -39,6 +41,7 @@
 
 namespace arrow {
 
+using internal::BitmapReader;
 using internal::checked_cast;
 using internal::checked_pointer_cast;
 
@@ -64,7 +67,7 @@ static SumResult<ArrowType> NaiveSumPartial(const Array& array) {
   const auto values = array_numeric.raw_values();
 
   if (array.null_count() != 0) {
-    internal::BitmapReader reader(array.null_bitmap_data(), array.offset(),
+    BitmapReader reader(array.null_bitmap_data(), array.offset(),
                                   array.length());
     for (int64_t i = 0; i < array.length(); i++) {
       if (reader.IsSet()) {
@@ -622,7 +625,7 @@ static enable_if_integer<ArrowType, MinMaxResult<ArrowType>> NaiveMinMax(
   T min = std::numeric_limits<T>::max();
   T max = std::numeric_limits<T>::min();
   if (array.null_count() != 0) {  // Some values are null
-    internal::BitmapReader reader(array.null_bitmap_data(), array.offset(),
+    BitmapReader reader(array.null_bitmap_data(), array.offset(),
                                   array.length());
     for (int64_t i = 0; i < array.length(); i++) {
       if (reader.IsSet()) {
@@ -662,7 +665,7 @@ static enable_if_floating_point<ArrowType, MinMaxResult<ArrowType>> NaiveMinMax(
   T min = std::numeric_limits<T>::infinity();
   T max = -std::numeric_limits<T>::infinity();
   if (array.null_count() != 0) {  // Some values are null
-    internal::BitmapReader reader(array.null_bitmap_data(), array.offset(),
+    BitmapReader reader(array.null_bitmap_data(), array.offset(),
                                   array.length());
     for (int64_t i = 0; i < array.length(); i++) {
       if (reader.IsSet()) {
@@ -726,6 +729,105 @@ TYPED_TEST(TestRandomNumericMinMaxKernel, RandomArrayMinMax) {
   }
 }
 
+//
+// Decimal sum, mean and min / max
+//
+
+std::shared_ptr<Scalar> DecimalScalar(const std::shared_ptr<DataType>& type,
+                                      const std::string& value) {
+  return std::make_shared<Decimal128Scalar>(Decimal128(value), type);
+}
+
+void CheckDecimalSum(const Datum& input, const std::shared_ptr<Scalar>& expected) {
+  ASSERT_OK_AND_ASSIGN(Datum out, Sum(input));
+  AssertDatumsEqual(Datum(expected), out, /*verbose=*/true);
+}
+
+TEST(TestDecimalAggregation, Sum) {
+  auto ty = decimal(18, 4);
+  auto out_ty = decimal(38, 4);
+  CheckDecimalSum(ArrayFromJSON(ty, "[]"), MakeNullScalar(out_ty));
+  CheckDecimalSum(ArrayFromJSON(ty, "[null]"), MakeNullScalar(out_ty));
+  CheckDecimalSum(ArrayFromJSON(ty, R"(["1.5000", null, "-0.2500"])"),
+                              DecimalScalar(out_ty, "1.2500"));
+  CheckDecimalSum(
+      ChunkedArrayFromJSON(ty, {R"(["1.5000", "2.2500", null])", "[]", R"(["-0.7500"])"}),
+      DecimalScalar(out_ty, "3.0000"));
+
+  // The sum of values of at most 18 digits overflows int64_t
+  auto max18 = ArrayFromJSON(decimal(18, 0), R"(["999999999999999999"])");
+  ASSERT_OK_AND_ASSIGN(auto many, Concatenate(ArrayVector(20, max18)));
+  CheckDecimalSum(many, DecimalScalar(decimal(38, 0),
+                                                   "19999999999999999980"));
+  ASSERT_OK_AND_ASSIGN(
+      many, Concatenate({many, ArrayFromJSON(decimal(18, 0),
+                                             R"(["-999999999999999999", null])")}));
+  CheckDecimalSum(many->Slice(1), DecimalScalar(decimal(38, 0),
+                                                             "17999999999999999982"));
+
+  CheckDecimalSum(
+      *ArrayFromJSON(decimal(38, 2), R"(["123456789012345678901234567890.12", null,
+                                         "-0.13"])"),
+      DecimalScalar(decimal(38, 2), "123456789012345678901234567889.99"));
+}
+
+TEST(TestDecimalAggregation, Mean) {
+  auto ty = decimal(18, 4);
+  auto check = [&](const std::string& json, const std::shared_ptr<Scalar>& expected) {
+    ASSERT_OK_AND_ASSIGN(Datum out, Mean(ArrayFromJSON(ty, json)));
+    AssertDatumsEqual(Datum(expected), out, /*verbose=*/true);
+  };
+  check("[]", MakeNullScalar(ty));
+  check("[null]", MakeNullScalar(ty));
+  check(R"(["1.0000", null, "2.0000", "2.0001"])", DecimalScalar(ty, "1.6667"));
+  check(R"(["-1.0000", "-2.0000"])", DecimalScalar(ty, "-1.5000"));
+  // Rounded half away from zero
+  check(R"(["0.0001", "0.0000"])", DecimalScalar(ty, "0.0001"));
+  check(R"(["-0.0001", "0.0000"])", DecimalScalar(ty, "-0.0001"));
+  check(R"(["0.0001", "0.0000", "0.0000"])", DecimalScalar(ty, "0.0000"));
+
+  auto large = decimal(38, 2);
+  auto array = ArrayFromJSON(large, R"(["12345678901234567890123456.01",
+                                        "12345678901234567890123456.02"])");
+  ASSERT_OK_AND_ASSIGN(Datum out, Mean(array));
+  AssertDatumsEqual(Datum(DecimalScalar(large, "12345678901234567890123456.02")), out);
+}
+
+TEST(TestDecimalAggregation, MinMax) {
+  for (auto ty : {decimal(18, 4), decimal(38, 4)}) {
+    SCOPED_TRACE(ty->ToString());
+    auto out_ty = struct_({field("min", ty), field("max", ty)});
+    auto check = [&](const Datum& input, const MinMaxOptions& options,
+                     std::shared_ptr<Scalar> min, std::shared_ptr<Scalar> max) {
+      ASSERT_OK_AND_ASSIGN(Datum out, MinMax(input, options));
+      StructScalar expected({std::move(min), std::move(max)}, out_ty);
+      AssertDatumsEqual(Datum(std::make_shared<StructScalar>(expected)), out,
+                        /*verbose=*/true);
+    };
+    MinMaxOptions skip;
+    MinMaxOptions emit_null(MinMaxOptions::EMIT_NULL);
+
+    auto array = ArrayFromJSON(ty, R"(["1.0000", null, "-2.5000", "10.2500", "0.0001"])");
+    check(array, skip, DecimalScalar(ty, "-2.5000"), DecimalScalar(ty, "10.2500"));
+    check(array, emit_null, MakeNullScalar(ty), MakeNullScalar(ty));
+    check(array->Slice(3), emit_null, DecimalScalar(ty, "0.0001"),
+          DecimalScalar(ty, "10.2500"));
+    check(ArrayFromJSON(ty, "[null, null]"), skip, MakeNullScalar(ty),
+          MakeNullScalar(ty));
+    check(ChunkedArrayFromJSON(ty, {R"(["1.0000"])", "[null]",
+                                    R"(["-3.0000", "4.0000"])"}),
+          skip, DecimalScalar(ty, "-3.0000"), DecimalScalar(ty, "4.0000"));
+  }
+  auto large = decimal(38, 0);
+  auto array = ArrayFromJSON(large, R"(["-99999999999999999999999999999999999999", "1",
+                                        "99999999999999999999"])");
+  ASSERT_OK_AND_ASSIGN(Datum out, MinMax(array));
+  const auto& value = out.scalar_as<StructScalar>();
+  AssertScalarsEqual(*DecimalScalar(large, "-99999999999999999999999999999999999999"),
+                     *value.value[0]);
+  AssertScalarsEqual(*DecimalScalar(large, "99999999999999999999"), *value.value[1]);
+}
+
 //
 // Mode
 //
@@ -891,7 +993,7 @@ ModeResult<ArrowType> NaiveMode(const Array& array) {
 
   const auto& array_numeric = reinterpret_cast<const ArrayType&>(array);
   const auto values = array_numeric.raw_values();
-  internal::BitmapReader reader(array.null_bitmap_data(), array.offset(), array.length());
+  BitmapReader reader(array.null_bitmap_data(), array.offset(), array.length());
   for (int64_t i = 0; i < array.length(); ++i) {
     if (reader.IsSet()) {
       ++value_counts[values[i]];
@@ -1088,7 +1190,7 @@ void KahanSum(double& sum, double& adjust, double addend) {
 std::pair<double, double> WelfordVar(const Array& array) {
   const auto& array_numeric = reinterpret_cast<const DoubleArray&>(array);
   const auto values = array_numeric.raw_values();
-  internal::BitmapReader reader(array.null_bitmap_data(), array.offset(), array.length());
+  BitmapReader reader(array.null_bitmap_data(), array.offset(), array.length());
   double count = 0, mean = 0, m2 = 0;
   double mean_adjust = 0, m2_adjust = 0;
   for (int64_t i = 0; i < array.length(); ++i) {
@@ -1132,5 +1234,182 @@ TEST_F(TestVarStdKernelRandom, Basics) {
   this->AssertVarStdIs(chunked, VarianceOptions{1}, var_sample);
 }
 
+//
+// Approximate distinct count / quantiles
+//
+
+template <typename ArrowType>
+class TestNumericApproxCountDistinctKernel : public ::testing::Test {};
+
+TYPED_TEST_SUITE(TestNumericApproxCountDistinctKernel, NumericArrowTypes);
+TYPED_TEST(TestNumericApproxCountDistinctKernel, Basics) {
+  auto ty = TypeTraits<TypeParam>::type_singleton();
+  ASSERT_OK_AND_ASSIGN(
+      Datum out, ApproxCountDistinct(ArrayFromJSON(ty, "[1, 2, null, 2, 3, 1, 1]")));
+  AssertDatumsEqual(Datum(std::make_shared<Int64Scalar>(3)), out);
+
+  ASSERT_OK_AND_ASSIGN(out, ApproxCountDistinct(ArrayFromJSON(ty, "[null, null]")));
+  AssertDatumsEqual(Datum(std::make_shared<Int64Scalar>(0)), out);
+}
+
+TEST(TestApproxCountDistinctKernel, Binary) {
+  for (const auto& ty : {utf8(), large_binary()}) {
+    auto values = ArrayFromJSON(ty, R"(["a", "", "b", null, "a"])");
+    ASSERT_OK_AND_ASSIGN(Datum out, ApproxCountDistinct(values));
+    AssertDatumsEqual(Datum(std::make_shared<Int64Scalar>(3)), out);
+  }
+}
+
+TEST(TestApproxCountDistinctKernel, Random) {
+  auto rand = random::RandomArrayGenerator(0x2138);
+  auto array = rand.Int64(100000, 0, 1000000, /*null_probability=*/0.1);
+  ArrayVector chunks;
+  for (int64_t offset = 0; offset < array->length(); offset += 7000) {
+    chunks.push_back(array->Slice(offset, 7000));
+  }
+  ASSERT_OK_AND_ASSIGN(Datum unique, Unique(array));
+  // Unique() keeps a null entry
+  const int64_t expected = unique.length() - 1;
+
+  for (int precision : {8, 14}) {
+    ApproxCountDistinctOptions options(precision);
+    ASSERT_OK_AND_ASSIGN(auto chunked, ChunkedArray::Make(chunks));
+    ASSERT_OK_AND_ASSIGN(Datum out, ApproxCountDistinct(chunked, options));
+    const double error = 4 * 1.04 / std::sqrt(double(1 << precision));
+    ASSERT_NEAR(static_cast<double>(out.scalar_as<Int64Scalar>().value), expected,
+                expected * error);
+  }
+}
+
+TEST(TestApproxCountDistinctKernel, InvalidPrecision) {
+  ASSERT_RAISES(Invalid, ApproxCountDistinct(ArrayFromJSON(int32(), "[1]"),
+                                             ApproxCountDistinctOptions(3)));
+  ASSERT_RAISES(Invalid, ApproxCountDistinct(ArrayFromJSON(int32(), "[1]"),
+                                             ApproxCountDistinctOptions(19)));
+}
+
+template <typename ArrowType>
+class TestNumericApproxQuantileKernel : public ::testing::Test {};
+
+TYPED_TEST_SUITE(TestNumericApproxQuantileKernel, NumericArrowTypes);
+TYPED_TEST(TestNumericApproxQuantileKernel, Basics) {
+  auto ty = TypeTraits<TypeParam>::type_singleton();
+  ApproxQuantileOptions options({0, 0.5, 1});
+  ASSERT_OK_AND_ASSIGN(Datum out,
+                       ApproxQuantile(ArrayFromJSON(ty, "[5, 1, null, 3]"), options));
+  AssertDatumsEqual(ArrayFromJSON(float64(), "[1, 3, 5]"), out);
+
+  ASSERT_OK_AND_ASSIGN(out, ApproxQuantile(ArrayFromJSON(ty, "[null]"), options));
+  AssertDatumsEqual(ArrayFromJSON(float64(), "[null, null, null]"), out);
+}
+
+TEST(TestApproxQuantileKernel, SkipNaN) {
+  ASSERT_OK_AND_ASSIGN(Datum out,
+                       ApproxQuantile(ArrayFromJSON(float64(), "[NaN, 2, NaN, 4, 3]")));
+  AssertDatumsEqual(ArrayFromJSON(float64(), "[3]"), out);
+}
+
+TEST(TestApproxQuantileKernel, Random) {
+  auto rand = random::RandomArrayGenerator(0x7123);
+  auto array = rand.Float64(50000, -100, 100, /*null_probability=*/0.1);
+  ArrayVector chunks;
+  for (int64_t offset = 0; offset < array->length(); offset += 3000) {
+    chunks.push_back(array->Slice(offset, 3000));
+  }
+  ASSERT_OK_AND_ASSIGN(auto sorted_indices, SortToIndices(*array));
+  const auto num_valid = array->length() - array->null_count();
+  const auto& values = checked_cast<const DoubleArray&>(*array);
+  const int64_t* indices = sorted_indices->data()->GetValues<int64_t>(1);
+
+  const std::vector<double> q = {0.01, 0.1, 0.5, 0.9, 0.99};
+  ASSERT_OK_AND_ASSIGN(auto chunked, ChunkedArray::Make(chunks));
+  ASSERT_OK_AND_ASSIGN(Datum out, ApproxQuantile(chunked, ApproxQuantileOptions(q)));
+  const auto& estimates = checked_cast<const DoubleArray&>(*out.make_array());
+  ASSERT_EQ(estimates.length(), static_cast<int64_t>(q.size()));
+  for (size_t i = 0; i < q.size(); ++i) {
+    const double exact = values.Value(indices[static_cast<int64_t>(q[i] * num_valid)]);
+    // The values are uniformly distributed over [-100, 100]
+    ASSERT_NEAR(estimates.Value(i), exact, 200 * 0.005);
+  }
+}
+
+TEST(TestApproxQuantileKernel, InvalidQuantile) {
+  ASSERT_RAISES(Invalid, ApproxQuantile(ArrayFromJSON(float64(), "[1]"),
+                                        ApproxQuantileOptions({0.5, 1.5})));
+  ASSERT_RAISES(Invalid, ApproxQuantile(ArrayFromJSON(float64(), "[1]"),
+                                        ApproxQuantileOptions({-0.1})));
+}
+
+//
+// Incremental aggregation
+//
+
+class TestScalarAggregator : public ::testing::Test {
+ public:
+  void SetUp() override {
+    chunked_ = ChunkedArrayFromJSON(
+        int64(), {"[1, 2, null]", "[]", "[3, 4, 5, 6]", "[null, 7]", "[8]"});
+  }
+
+  // Aggregate the chunks with one aggregator each, then merge them
+  void AssertMergedEqualsDirect(const std::string& func_name,
+                                const FunctionOptions* options = nullptr) {
+    ASSERT_OK_AND_ASSIGN(auto aggregator,
+                         ScalarAggregator::Make(func_name, {ValueDescr::Array(int64())},
+                                                options));
+    for (const auto& chunk : chunked_->chunks()) {
+      ASSERT_OK_AND_ASSIGN(auto partial, aggregator->MakeEmpty());
+      ASSERT_OK(partial->Consume(ExecBatch({chunk}, chunk->length())));
+      ASSERT_OK(aggregator->MergeFrom(std::move(*partial)));
+    }
+    ASSERT_OK_AND_ASSIGN(Datum merged, aggregator->Finalize());
+    ASSERT_OK_AND_ASSIGN(Datum direct, CallFunction(func_name, {chunked_}, options));
+    AssertDatumsEqual(direct, merged);
+  }
+
+ protected:
+  std::shared_ptr<ChunkedArray> chunked_;
+};
+
+TEST_F(TestScalarAggregator, MergeStates) {
+  AssertMergedEqualsDirect("sum");
+  AssertMergedEqualsDirect("mean");
+  CountOptions count_nulls(CountOptions::COUNT_NULL);
+  AssertMergedEqualsDirect("count", &count_nulls);
+  MinMaxOptions emit_null(MinMaxOptions::EMIT_NULL);
+  AssertMergedEqualsDirect("min_max", &emit_null);
+  AssertMergedEqualsDirect("min_max");
+}
+
+TEST_F(TestScalarAggregator, ConsumeDatums) {
+  ASSERT_OK_AND_ASSIGN(auto aggregator,
+                       ScalarAggregator::Make("sum", {ValueDescr::Array(int64())}));
+  ASSERT_OK(aggregator->Consume({Datum(chunked_)}));
+  ASSERT_OK(aggregator->Consume({Datum(ArrayFromJSON(int64(), "[100]"))}));
+  ASSERT_OK_AND_ASSIGN(Datum result, aggregator->Finalize());
+  AssertDatumsEqual(Datum(std::make_shared<Int64Scalar>(136)), result);
+
+  // An aggregator without input finalizes to the empty aggregate
+  ASSERT_OK_AND_ASSIGN(auto empty, aggregator->MakeEmpty());
+  ASSERT_OK_AND_ASSIGN(result, empty->Finalize());
+  ASSERT_FALSE(result.scalar()->is_valid);
+}
+
+TEST_F(TestScalarAggregator, Errors) {
+  ASSERT_RAISES(Invalid, ScalarAggregator::Make("add", {ValueDescr::Array(int64()),
+                                                       ValueDescr::Array(int64())}));
+  ASSERT_RAISES(Invalid, ScalarAggregator::Make("sum", {}));
+  ASSERT_RAISES(KeyError, ScalarAggregator::Make("nonexistent", {}));
+
+  ASSERT_OK_AND_ASSIGN(auto sum,
+                       ScalarAggregator::Make("sum", {ValueDescr::Array(int64())}));
+  ASSERT_RAISES(TypeError, sum->Consume(ExecBatch({ArrayFromJSON(int32(), "[1]")}, 1)));
+  ASSERT_RAISES(Invalid, sum->Consume(ExecBatch({}, 1)));
+
+  ASSERT_OK_AND_ASSIGN(auto mean,
+                       ScalarAggregator::Make("mean", {ValueDescr::Array(int64())}));
+  ASSERT_RAISES(Invalid, sum->MergeFrom(std::move(*mean)));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -40,6 +40,43 @@ ArrayKernelExec MakeFlippedBinaryExec(ArrayKernelExec exec) {
   };
 }
 
+Status AddSelectionVectorKernel(ScalarFunction* func, std::vector<InputType> in_types,
+                                OutputType out_type, ArrayKernelExec exec) {
+  ScalarKernel kernel(std::move(in_types), std::move(out_type), std::move(exec));
+  kernel.can_use_selection_vector = true;
+  return func->AddKernel(std::move(kernel));
+}
+
+void AddSimdKernels(ScalarFunction* func, SimdLevel::type simd_level,
+                    SimdKernelExec (*get_exec)(Type::type)) {
+  std::vector<ScalarKernel> variants;
+  for (const ScalarKernel* kernel : func->kernels()) {
+    const auto& in_types = kernel->signature->in_types();
+    if (kernel->simd_level != SimdLevel::NONE || in_types.empty() ||
+        in_types[0].kind() != InputType::EXACT_TYPE) {
+      continue;
+    }
+    SimdKernelExec simd_exec = get_exec(in_types[0].type()->id());
+    if (simd_exec == nullptr) {
+      continue;
+    }
+    ScalarKernel variant = *kernel;
+    variant.simd_level = simd_level;
+    ArrayKernelExec exec = kernel->exec;
+    variant.exec = [exec, simd_exec](KernelContext* ctx, const ExecBatch& batch,
+                                     Datum* out) {
+      if (batch.selection_vector != nullptr || !out->is_array()) {
+        return exec(ctx, batch, out);
+      }
+      return simd_exec(ctx, batch, out);
+    };
+    variants.push_back(std::move(variant));
+  }
+  for (auto& variant : variants) {
+    DCHECK_OK(func->AddKernel(std::move(variant)));
+  }
+}
+
 std::vector<std::shared_ptr<DataType>> g_signed_int_types;
 std::vector<std::shared_ptr<DataType>> g_unsigned_int_types;
 std::vector<std::shared_ptr<DataType>> g_int_types;
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -28,6 +29,7 @@
 #include "arrow/buffer.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/compute/exec.h"
+#include "arrow/compute/function.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/datum.h"
 #include "arrow/result.h"
@@ -57,6 +59,8 @@ using internal::BitmapReader;
 using internal::checked_cast;
 using internal::FirstTimeBitmapWriter;
 using internal::GenerateBitsUnrolled;
+using internal::OptionalBinaryBitBlockCounter;
+using internal::OptionalBitBlockCounter;
 using internal::VisitBitBlocksVoid;
 using internal::VisitTwoBitBlocksVoid;
 
@@ -196,6 +200,7 @@ struct ArrayIterator<Type, enable_if_has_c_type_not_boolean<Type>> {
 
   explicit ArrayIterator(const ArrayData& data) : values(data.GetValues<T>(1)) {}
   T operator()() { return *values++; }
+  void Skip(int64_t n) { values += n; }
 };
 
 template <typename Type>
@@ -209,6 +214,11 @@ struct ArrayIterator<Type, enable_if_boolean<Type>> {
     reader.Next();
     return out;
   }
+  void Skip(int64_t n) {
+    for (int64_t i = 0; i < n; ++i) {
+      reader.Next();
+    }
+  }
 };
 
 template <typename Type>
@@ -234,6 +244,72 @@ struct ArrayIterator<Type, enable_if_base_binary<Type>> {
     cur_offset = next_offset;
     return result;
   }
+  void Skip(int64_t n) {
+    position += n;
+    cur_offset = offsets[position];
+  }
+};
+
+template <>
+struct ArrayIterator<Decimal128Type> {
+  const uint8_t* values;
+
+  explicit ArrayIterator(const ArrayData& data)
+      : values(data.GetValues<uint8_t>(1, 0) + data.offset * kByteWidth) {}
+  util::string_view operator()() {
+    auto result = util::string_view(reinterpret_cast<const char*>(values), kByteWidth);
+    values += kByteWidth;
+    return result;
+  }
+  void Skip(int64_t n) { values += n * kByteWidth; }
+
+  static constexpr int64_t kByteWidth = 16;
+};
+
+// Iterator over the values of an array at the positions given by a selection
+// vector, yielding a GetViewType<Type>
+
+template <typename Type, typename Enable = void>
+struct SelectedArrayIterator;
+
+template <typename Type>
+struct SelectedArrayIterator<Type, enable_if_has_c_type_not_boolean<Type>> {
+  using T = typename Type::c_type;
+  const T* values;
+  const int32_t* indices;
+
+  SelectedArrayIterator(const ArrayData& data, const int32_t* indices)
+      : values(data.GetValues<T>(1)), indices(indices) {}
+  T operator()() { return values[*indices++]; }
+};
+
+template <typename Type>
+struct SelectedArrayIterator<Type, enable_if_boolean<Type>> {
+  const uint8_t* bitmap;
+  int64_t offset;
+  const int32_t* indices;
+
+  SelectedArrayIterator(const ArrayData& data, const int32_t* indices)
+      : bitmap(data.buffers[1]->data()), offset(data.offset), indices(indices) {}
+  bool operator()() { return BitUtil::GetBit(bitmap, offset + *indices++); }
+};
+
+template <typename Type>
+struct SelectedArrayIterator<Type, enable_if_base_binary<Type>> {
+  using offset_type = typename Type::offset_type;
+  const offset_type* offsets;
+  const char* data;
+  const int32_t* indices;
+
+  SelectedArrayIterator(const ArrayData& arr, const int32_t* indices)
+      : offsets(arr.GetValues<offset_type>(1)),
+        data(reinterpret_cast<const char*>(arr.buffers[2]->data())),
+        indices(indices) {}
+
+  util::string_view operator()() {
+    const int32_t index = *indices++;
+    return util::string_view(data + offsets[index], offsets[index + 1] - offsets[index]);
+  }
 };
 
 // Iterator over various output array types, taking a GetOutputType<Type>
@@ -253,6 +329,11 @@ struct OutputArrayWriter<Type, enable_if_has_c_type_not_boolean<Type>> {
   // Note that this doesn't write the null bitmap, which should be consistent
   // with Write / WriteNull calls
   void WriteNull() { *values++ = T{}; }
+
+  void WriteNulls(int64_t n) {
+    std::fill(values, values + n, T{});
+    values += n;
+  }
 };
 
 // (Un)box Scalar to / from C++ value
@@ -309,39 +390,92 @@ struct BoxScalar<Decimal128Type> {
   static void Box(T val, Scalar* out) { checked_cast<ScalarType*>(out)->value = val; }
 };
 
+// The validity bitmap of an array, or nullptr if it has no nulls
+inline const uint8_t* GetValidityBitmap(const ArrayData& arr) {
+  return arr.MayHaveNulls() ? arr.buffers[0]->data() : NULLPTR;
+}
+
 // A VisitArrayDataInline variant that calls its visitor function with logical
-// values, such as Decimal128 rather than util::string_view.
+// values, such as Decimal128 rather than util::string_view, and that handles
+// the nulls of a block of validity bits at once: `null_func(n)` is called
+// with the number of consecutive nulls, which is a whole block when all of its
+// values are null. Blocks without nulls are visited by a loop without
+// validity checks.
 
 template <typename T, typename VisitFunc, typename NullFunc>
 static void VisitArrayValuesInline(const ArrayData& arr, VisitFunc&& valid_func,
                                    NullFunc&& null_func) {
-  VisitArrayDataInline<T>(
-      arr,
-      [&](typename GetViewType<T>::PhysicalType v) {
-        valid_func(GetViewType<T>::LogicalValue(std::move(v)));
-      },
-      std::forward<NullFunc>(null_func));
+  ArrayIterator<T> arr_it(arr);
+  const uint8_t* bitmap = GetValidityBitmap(arr);
+  OptionalBitBlockCounter bit_counter(bitmap, arr.offset, arr.length);
+  int64_t position = 0;
+  while (position < arr.length) {
+    const BitBlockCount block = bit_counter.NextBlock();
+    if (block.AllSet()) {
+      for (int64_t i = 0; i < block.length; ++i) {
+        valid_func(GetViewType<T>::LogicalValue(arr_it()));
+      }
+    } else if (block.NoneSet()) {
+      arr_it.Skip(block.length);
+      null_func(static_cast<int64_t>(block.length));
+    } else {
+      for (int64_t i = 0; i < block.length; ++i) {
+        if (BitUtil::GetBit(bitmap, arr.offset + position + i)) {
+          valid_func(GetViewType<T>::LogicalValue(arr_it()));
+        } else {
+          arr_it.Skip(1);
+          null_func(int64_t(1));
+        }
+      }
+    }
+    position += block.length;
+  }
 }
 
-// Like VisitArrayValuesInline, but for binary functions.
+// Like VisitArrayValuesInline, but for binary functions: a pair of values is
+// null if either value is.
 
 template <typename Arg0Type, typename Arg1Type, typename VisitFunc, typename NullFunc>
 static void VisitTwoArrayValuesInline(const ArrayData& arr0, const ArrayData& arr1,
                                       VisitFunc&& valid_func, NullFunc&& null_func) {
   ArrayIterator<Arg0Type> arr0_it(arr0);
   ArrayIterator<Arg1Type> arr1_it(arr1);
-
-  auto visit_valid = [&](int64_t i) {
+  const uint8_t* bitmap0 = GetValidityBitmap(arr0);
+  const uint8_t* bitmap1 = GetValidityBitmap(arr1);
+  OptionalBinaryBitBlockCounter bit_counter(bitmap0, arr0.offset, bitmap1, arr1.offset,
+                                            arr0.length);
+  auto visit_valid = [&]() {
     valid_func(GetViewType<Arg0Type>::LogicalValue(arr0_it()),
                GetViewType<Arg1Type>::LogicalValue(arr1_it()));
   };
-  auto visit_null = [&]() {
-    arr0_it();
-    arr1_it();
-    null_func();
+  auto is_valid = [&](int64_t i) {
+    return (bitmap0 == NULLPTR || BitUtil::GetBit(bitmap0, arr0.offset + i)) &&
+           (bitmap1 == NULLPTR || BitUtil::GetBit(bitmap1, arr1.offset + i));
   };
-  VisitTwoBitBlocksVoid(arr0.buffers[0], arr0.offset, arr1.buffers[0], arr1.offset,
-                        arr0.length, std::move(visit_valid), std::move(visit_null));
+  int64_t position = 0;
+  while (position < arr0.length) {
+    const BitBlockCount block = bit_counter.NextAndBlock();
+    if (block.AllSet()) {
+      for (int64_t i = 0; i < block.length; ++i) {
+        visit_valid();
+      }
+    } else if (block.NoneSet()) {
+      arr0_it.Skip(block.length);
+      arr1_it.Skip(block.length);
+      null_func(static_cast<int64_t>(block.length));
+    } else {
+      for (int64_t i = 0; i < block.length; ++i) {
+        if (is_valid(position + i)) {
+          visit_valid();
+        } else {
+          arr0_it.Skip(1);
+          arr1_it.Skip(1);
+          null_func(int64_t(1));
+        }
+      }
+    }
+    position += block.length;
+  }
 }
 
 // ----------------------------------------------------------------------
@@ -356,6 +490,74 @@ void ExecFail(KernelContext* ctx, const ExecBatch& batch, Datum* out);
 
 ArrayKernelExec MakeFlippedBinaryExec(ArrayKernelExec exec);
 
+// Add a kernel whose exec function can compute the rows picked by a selection
+// vector, such as those generated by the ScalarUnary and ScalarBinary
+// applicators
+Status AddSelectionVectorKernel(ScalarFunction* func, std::vector<InputType> in_types,
+                                OutputType out_type, ArrayKernelExec exec);
+
+// The exec function of a kernel compiled for a given SIMD level, see AddSimdKernels
+using SimdKernelExec = void (*)(KernelContext*, const ExecBatch&, Datum*);
+
+// Add a variant for the given SIMD level of each kernel of `func` whose first
+// input type is exact. `get_exec` returns the exec function of the variant for
+// the input type id, or nullptr if there is none. The exec function is only
+// called with array outputs and without a selection vector, other batches are
+// handed to the original kernel.
+void AddSimdKernels(ScalarFunction* func, SimdLevel::type simd_level,
+                    SimdKernelExec (*get_exec)(Type::type));
+
+// Accessors for the values of an array or a scalar argument, for writing SIMD
+// kernels as loops over indices. The kSimdLevel template parameter keeps the
+// instantiations in translation units compiled for different SIMD levels apart.
+
+template <typename T, SimdLevel::type kSimdLevel>
+struct SimdArrayValues {
+  const T* values;
+  T operator[](int64_t i) const { return values[i]; }
+};
+
+template <typename T, SimdLevel::type kSimdLevel>
+struct SimdScalarValue {
+  T value;
+  T operator[](int64_t) const { return value; }
+};
+
+template <typename T, SimdLevel::type kSimdLevel>
+SimdArrayValues<T, kSimdLevel> SliceSimdValues(SimdArrayValues<T, kSimdLevel> values,
+                                               int64_t offset) {
+  return {values.values + offset};
+}
+
+template <typename T, SimdLevel::type kSimdLevel>
+SimdScalarValue<T, kSimdLevel> SliceSimdValues(SimdScalarValue<T, kSimdLevel> value,
+                                               int64_t) {
+  return value;
+}
+
+// Call Kernel::ExecValues with accessors for the values of both arguments of a
+// batch having at least one array argument
+template <typename Kernel, typename Type, SimdLevel::type kSimdLevel>
+void ExecSimdBinary(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  using T = typename Type::c_type;
+  using ArrayValues = SimdArrayValues<T, kSimdLevel>;
+  using ScalarValue = SimdScalarValue<T, kSimdLevel>;
+  ArrayData* out_arr = out->mutable_array();
+  if (batch[0].is_array()) {
+    ArrayValues left{batch[0].array()->template GetValues<T>(1)};
+    if (batch[1].is_array()) {
+      ArrayValues right{batch[1].array()->template GetValues<T>(1)};
+      Kernel::ExecValues(ctx, left, right, out_arr);
+    } else {
+      Kernel::ExecValues(
+          ctx, left, ScalarValue{UnboxScalar<Type>::Unbox(*batch[1].scalar())}, out_arr);
+    }
+  } else {
+    Kernel::ExecValues(ctx, ScalarValue{UnboxScalar<Type>::Unbox(*batch[0].scalar())},
+                       ArrayValues{batch[1].array()->template GetValues<T>(1)}, out_arr);
+  }
+}
+
 // ----------------------------------------------------------------------
 // Helpers for iterating over common DataType instances for adding kernels to
 // functions
@@ -443,28 +645,54 @@ void SimpleBinary(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
 template <typename Type, typename Enable = void>
 struct OutputAdapter;
 
+//
+// WriteRange writes the output rows [offset, offset + length) and ZeroRange
+// zeroes them without calling the generator.
+
 template <typename Type>
 struct OutputAdapter<Type, enable_if_boolean<Type>> {
   template <typename Generator>
-  static void Write(KernelContext*, Datum* out, Generator&& generator) {
-    ArrayData* out_arr = out->mutable_array();
+  static void Write(KernelContext* ctx, Datum* out, Generator&& generator) {
+    WriteRange(ctx, out->mutable_array(), 0, out->array()->length,
+               std::forward<Generator>(generator));
+  }
+
+  template <typename Generator>
+  static void WriteRange(KernelContext*, ArrayData* out_arr, int64_t offset,
+                         int64_t length, Generator&& generator) {
     auto out_bitmap = out_arr->buffers[1]->mutable_data();
-    GenerateBitsUnrolled(out_bitmap, out_arr->offset, out_arr->length,
+    GenerateBitsUnrolled(out_bitmap, out_arr->offset + offset, length,
                          std::forward<Generator>(generator));
   }
+
+  static void ZeroRange(ArrayData* out_arr, int64_t offset, int64_t length) {
+    BitUtil::SetBitsTo(out_arr->buffers[1]->mutable_data(), out_arr->offset + offset,
+                       length, false);
+  }
 };
 
 template <typename Type>
 struct OutputAdapter<Type, enable_if_has_c_type_not_boolean<Type>> {
   template <typename Generator>
-  static void Write(KernelContext*, Datum* out, Generator&& generator) {
-    ArrayData* out_arr = out->mutable_array();
-    auto out_data = out_arr->GetMutableValues<typename Type::c_type>(1);
+  static void Write(KernelContext* ctx, Datum* out, Generator&& generator) {
+    WriteRange(ctx, out->mutable_array(), 0, out->array()->length,
+               std::forward<Generator>(generator));
+  }
+
+  template <typename Generator>
+  static void WriteRange(KernelContext*, ArrayData* out_arr, int64_t offset,
+                         int64_t length, Generator&& generator) {
+    auto out_data = out_arr->GetMutableValues<typename Type::c_type>(1) + offset;
     // TODO: Is this as fast as a more explicitly inlined function?
-    for (int64_t i = 0; i < out_arr->length; ++i) {
+    for (int64_t i = 0; i < length; ++i) {
       *out_data++ = generator();
     }
   }
+
+  static void ZeroRange(ArrayData* out_arr, int64_t offset, int64_t length) {
+    auto out_data = out_arr->GetMutableValues<typename Type::c_type>(1) + offset;
+    std::fill(out_data, out_data + length, typename Type::c_type{});
+  }
 };
 
 template <typename Type>
@@ -473,8 +701,46 @@ struct OutputAdapter<Type, enable_if_base_binary<Type>> {
   static void Write(KernelContext* ctx, Datum* out, Generator&& generator) {
     ctx->SetStatus(Status::NotImplemented("NYI"));
   }
+
+  template <typename Generator>
+  static void WriteRange(KernelContext* ctx, ArrayData*, int64_t, int64_t,
+                         Generator&&) {
+    ctx->SetStatus(Status::NotImplemented("NYI"));
+  }
+
+  static void ZeroRange(ArrayData*, int64_t, int64_t) {}
 };
 
+// Write the output of an array kernel block by block of the validity bitmaps
+// of its array arguments (`arg1` may be null). Blocks where all rows are null
+// are zeroed, after calling `skip(n)` to advance the input iterators past
+// them, and the other blocks are written by a loop without validity checks.
+template <typename OutType, typename Generator, typename SkipFunc>
+void WriteOutputBlocks(KernelContext* ctx, const ArrayData& arg0, const ArrayData* arg1,
+                       Datum* out, Generator&& generator, SkipFunc&& skip) {
+  ArrayData* out_arr = out->mutable_array();
+  const uint8_t* bitmap0 = GetValidityBitmap(arg0);
+  const uint8_t* bitmap1 = arg1 != NULLPTR ? GetValidityBitmap(*arg1) : NULLPTR;
+  if (bitmap0 == NULLPTR && bitmap1 == NULLPTR) {
+    return OutputAdapter<OutType>::Write(ctx, out, std::forward<Generator>(generator));
+  }
+  OptionalBinaryBitBlockCounter bit_counter(bitmap0, arg0.offset, bitmap1,
+                                            arg1 != NULLPTR ? arg1->offset : 0,
+                                            out_arr->length);
+  int64_t position = 0;
+  while (position < out_arr->length) {
+    const BitBlockCount block = bit_counter.NextAndBlock();
+    if (block.NoneSet()) {
+      skip(static_cast<int64_t>(block.length));
+      OutputAdapter<OutType>::ZeroRange(out_arr, position, block.length);
+    } else {
+      OutputAdapter<OutType>::WriteRange(ctx, out_arr, position, block.length,
+                                         generator);
+    }
+    position += block.length;
+  }
+}
+
 // A kernel exec generator for unary functions that addresses both array and
 // scalar inputs and dispatches input iteration and output writing to other
 // templates
@@ -498,9 +764,12 @@ struct ScalarUnary {
 
   static void Array(KernelContext* ctx, const ArrayData& arg0, Datum* out) {
     ArrayIterator<Arg0Type> arg0_it(arg0);
-    OutputAdapter<OutType>::Write(ctx, out, [&]() -> OutValue {
-      return Op::template Call<OutValue, Arg0Value>(ctx, arg0_it());
-    });
+    WriteOutputBlocks<OutType>(
+        ctx, arg0, NULLPTR, out,
+        [&]() -> OutValue {
+          return Op::template Call<OutValue, Arg0Value>(ctx, arg0_it());
+        },
+        [&](int64_t n) { arg0_it.Skip(n); });
   }
 
   static void Scalar(KernelContext* ctx, const Scalar& arg0, Datum* out) {
@@ -513,8 +782,19 @@ struct ScalarUnary {
     }
   }
 
+  static void SelectedArray(KernelContext* ctx, const ArrayData& arg0,
+                            const SelectionVector& selection, Datum* out) {
+    SelectedArrayIterator<Arg0Type> arg0_it(arg0, selection.indices());
+    OutputAdapter<OutType>::Write(ctx, out, [&]() -> OutValue {
+      return Op::template Call<OutValue, Arg0Value>(ctx, arg0_it());
+    });
+  }
+
   static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
     if (batch[0].kind() == Datum::ARRAY) {
+      if (batch.selection_vector) {
+        return SelectedArray(ctx, *batch[0].array(), *batch.selection_vector, out);
+      }
       return Array(ctx, *batch[0].array(), out);
     } else {
       return Scalar(ctx, *batch[0].scalar(), out);
@@ -556,10 +836,7 @@ struct ScalarUnaryNotNullStateful {
           [&](Arg0Value v) {
             *out_data++ = functor.op.template Call<OutValue, Arg0Value>(ctx, v);
           },
-          [&]() {
-            // null
-            ++out_data;
-          });
+          [&](int64_t num_nulls) { out_data += num_nulls; });
     }
   };
 
@@ -577,7 +854,9 @@ struct ScalarUnaryNotNullStateful {
           [&](Arg0Value v) {
             KERNEL_RETURN_IF_ERROR(ctx, builder.Append(functor.op.Call(ctx, v)));
           },
-          [&]() { KERNEL_RETURN_IF_ERROR(ctx, builder.AppendNull()); });
+          [&](int64_t num_nulls) {
+            KERNEL_RETURN_IF_ERROR(ctx, builder.AppendNulls(num_nulls));
+          });
       if (!ctx->HasError()) {
         std::shared_ptr<ArrayData> result;
         ctx->SetStatus(builder.FinishInternal(&result));
@@ -601,10 +880,9 @@ struct ScalarUnaryNotNullStateful {
             }
             out_writer.Next();
           },
-          [&]() {
-            // null
-            out_writer.Clear();
-            out_writer.Next();
+          [&](int64_t num_nulls) {
+            // Blocks are at most 64 rows when there are nulls
+            out_writer.AppendWord(0, num_nulls);
           });
       out_writer.Finish();
     }
@@ -622,7 +900,7 @@ struct ScalarUnaryNotNullStateful {
             functor.op.template Call<OutValue, Arg0Value>(ctx, v).ToBytes(out_data);
             out_data += 16;
           },
-          [&]() { out_data += 16; });
+          [&](int64_t num_nulls) { out_data += 16 * num_nulls; });
     }
   };
 
@@ -686,27 +964,33 @@ struct ScalarBinary {
                          Datum* out) {
     ArrayIterator<Arg0Type> arg0_it(arg0);
     ArrayIterator<Arg1Type> arg1_it(arg1);
-    OutputAdapter<OutType>::Write(ctx, out, [&]() -> OutValue {
-      return Op::template Call(ctx, arg0_it(), arg1_it());
-    });
+    WriteOutputBlocks<OutType>(
+        ctx, arg0, &arg1, out,
+        [&]() -> OutValue { return Op::template Call(ctx, arg0_it(), arg1_it()); },
+        [&](int64_t n) {
+          arg0_it.Skip(n);
+          arg1_it.Skip(n);
+        });
   }
 
   static void ArrayScalar(KernelContext* ctx, const ArrayData& arg0, const Scalar& arg1,
                           Datum* out) {
     ArrayIterator<Arg0Type> arg0_it(arg0);
     auto arg1_val = UnboxScalar<Arg1Type>::Unbox(arg1);
-    OutputAdapter<OutType>::Write(ctx, out, [&]() -> OutValue {
-      return Op::template Call(ctx, arg0_it(), arg1_val);
-    });
+    WriteOutputBlocks<OutType>(
+        ctx, arg0, NULLPTR, out,
+        [&]() -> OutValue { return Op::template Call(ctx, arg0_it(), arg1_val); },
+        [&](int64_t n) { arg0_it.Skip(n); });
   }
 
   static void ScalarArray(KernelContext* ctx, const Scalar& arg0, const ArrayData& arg1,
                           Datum* out) {
     auto arg0_val = UnboxScalar<Arg0Type>::Unbox(arg0);
     ArrayIterator<Arg1Type> arg1_it(arg1);
-    OutputAdapter<OutType>::Write(ctx, out, [&]() -> OutValue {
-      return Op::template Call(ctx, arg0_val, arg1_it());
-    });
+    WriteOutputBlocks<OutType>(
+        ctx, arg1, NULLPTR, out,
+        [&]() -> OutValue { return Op::template Call(ctx, arg0_val, arg1_it()); },
+        [&](int64_t n) { arg1_it.Skip(n); });
   }
 
   static void ScalarScalar(KernelContext* ctx, const Scalar& arg0, const Scalar& arg1,
@@ -719,7 +1003,36 @@ struct ScalarBinary {
     }
   }
 
+  // Only compute the rows picked by the batch's selection vector. A scalar
+  // argument is the same for every row.
+  static void ExecSelected(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const int32_t* indices = batch.selection_vector->indices();
+    if (batch[0].kind() == Datum::ARRAY) {
+      SelectedArrayIterator<Arg0Type> arg0_it(*batch[0].array(), indices);
+      if (batch[1].kind() == Datum::ARRAY) {
+        SelectedArrayIterator<Arg1Type> arg1_it(*batch[1].array(), indices);
+        OutputAdapter<OutType>::Write(ctx, out, [&]() -> OutValue {
+          return Op::template Call(ctx, arg0_it(), arg1_it());
+        });
+      } else {
+        auto arg1_val = UnboxScalar<Arg1Type>::Unbox(*batch[1].scalar());
+        OutputAdapter<OutType>::Write(ctx, out, [&]() -> OutValue {
+          return Op::template Call(ctx, arg0_it(), arg1_val);
+        });
+      }
+    } else {
+      auto arg0_val = UnboxScalar<Arg0Type>::Unbox(*batch[0].scalar());
+      SelectedArrayIterator<Arg1Type> arg1_it(*batch[1].array(), indices);
+      OutputAdapter<OutType>::Write(ctx, out, [&]() -> OutValue {
+        return Op::template Call(ctx, arg0_val, arg1_it());
+      });
+    }
+  }
+
   static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    if (batch.selection_vector && out->is_array()) {
+      return ExecSelected(ctx, batch, out);
+    }
     if (batch[0].kind() == Datum::ARRAY) {
       if (batch[1].kind() == Datum::ARRAY) {
         return ArrayArray(ctx, *batch[0].array(), *batch[1].array(), out);
@@ -758,7 +1071,7 @@ struct ScalarBinaryNotNullStateful {
         [&](Arg0Value u, Arg1Value v) {
           writer.Write(op.template Call<OutValue, Arg0Value, Arg1Value>(ctx, u, v));
         },
-        [&]() { writer.WriteNull(); });
+        [&](int64_t num_nulls) { writer.WriteNulls(num_nulls); });
   }
 
   void ArrayScalar(KernelContext* ctx, const ArrayData& arg0, const Scalar& arg1,
@@ -772,7 +1085,7 @@ struct ScalarBinaryNotNullStateful {
             writer.Write(
                 op.template Call<OutValue, Arg0Value, Arg1Value>(ctx, u, arg1_val));
           },
-          [&]() { writer.WriteNull(); });
+          [&](int64_t num_nulls) { writer.WriteNulls(num_nulls); });
     }
   }
 
@@ -787,7 +1100,7 @@ struct ScalarBinaryNotNullStateful {
             writer.Write(
                 op.template Call<OutValue, Arg0Value, Arg1Value>(ctx, arg0_val, v));
           },
-          [&]() { writer.WriteNull(); });
+          [&](int64_t num_nulls) { writer.WriteNulls(num_nulls); });
     }
   }
 
@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/util/basic_decimal.h"
+#include "arrow/util/ubsan.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+// Decimal128 values with a precision of up to 18 digits fit in an int64_t, so
+// kernels can compute on the lower 64 bits of such values and only widen to
+// 128 bits when an int64_t operation overflows.
+constexpr int32_t kMaxDecimal64Precision = 18;
+
+// Load a Decimal128 value known to fit in an int64_t
+inline int64_t LoadDecimal64(const uint8_t* value) {
+#if ARROW_LITTLE_ENDIAN
+  return util::SafeLoadAs<int64_t>(value);
+#else
+  return util::SafeLoadAs<int64_t>(value + sizeof(int64_t));
+#endif
+}
+
+// Store an int64_t as a Decimal128 value
+inline void StoreDecimal64(int64_t value, uint8_t* out) {
+  const int64_t high = value < 0 ? -1 : 0;
+#if ARROW_LITTLE_ENDIAN
+  util::SafeStore(out, value);
+  util::SafeStore(out + sizeof(int64_t), high);
+#else
+  util::SafeStore(out, high);
+  util::SafeStore(out + sizeof(int64_t), value);
+#endif
+}
+
+// 10 ^ scale, for 0 <= scale <= kMaxDecimal64Precision
+inline int64_t DecimalScaleMultiplier64(int32_t scale) {
+  static constexpr int64_t kMultipliers[] = {1LL,
+                                             10LL,
+                                             100LL,
+                                             1000LL,
+                                             10000LL,
+                                             100000LL,
+                                             1000000LL,
+                                             10000000LL,
+                                             100000000LL,
+                                             1000000000LL,
+                                             10000000000LL,
+                                             100000000000LL,
+                                             1000000000000LL,
+                                             10000000000000LL,
+                                             100000000000000LL,
+                                             1000000000000000LL,
+                                             10000000000000000LL,
+                                             100000000000000000LL,
+                                             1000000000000000000LL};
+  return kMultipliers[scale];
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
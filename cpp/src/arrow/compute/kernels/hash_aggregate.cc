@@ -0,0 +1,824 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/dict_internal.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/exec_internal.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/compute/kernels/row_encoder_internal.h"
+#include "arrow/util/bit_block_counter.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::DictionaryTraits;
+using internal::HashTraits;
+
+namespace compute {
+namespace internal {
+namespace {
+
+// ----------------------------------------------------------------------
+// Grouper implementation
+
+/// \brief Grouper over a single key column, assigning group ids through the
+/// memo table used by the hash kernels for the key's physical type. Nulls are
+/// handled as a distinct key.
+template <typename Type>
+class MemoGrouper : public Grouper {
+ public:
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+  using Scalar = typename GetViewType<Type>::PhysicalType;
+
+  MemoGrouper(std::shared_ptr<DataType> key_type, MemoryPool* pool)
+      : key_type_(std::move(key_type)), pool_(pool), memo_table_(pool, 0) {}
+
+  Result<Datum> Consume(const ExecBatch& batch) override {
+    if (batch.num_values() != 1) {
+      return Status::Invalid("Grouper expected 1 key column, got ",
+                             batch.num_values());
+    }
+    if (!batch[0].is_array()) {
+      return Status::Invalid("Grouper expected an array key, got ",
+                             batch[0].ToString());
+    }
+    const ArrayData& keys = *batch[0].array();
+
+    ARROW_ASSIGN_OR_RAISE(auto group_ids,
+                          AllocateBuffer(keys.length * sizeof(uint32_t), pool_));
+    auto raw_group_ids = reinterpret_cast<uint32_t*>(group_ids->mutable_data());
+
+    RETURN_NOT_OK(VisitArrayDataInline<Type>(
+        keys,
+        [&](Scalar key) {
+          int32_t memo_index;
+          RETURN_NOT_OK(memo_table_.GetOrInsert(key, &memo_index));
+          *raw_group_ids++ = static_cast<uint32_t>(memo_index);
+          return Status::OK();
+        },
+        [&]() {
+          *raw_group_ids++ = static_cast<uint32_t>(memo_table_.GetOrInsertNull());
+          return Status::OK();
+        }));
+
+    return ArrayData::Make(uint32(), keys.length, {nullptr, std::move(group_ids)},
+                           /*null_count=*/0);
+  }
+
+  Result<ExecBatch> GetUniques() override {
+    std::shared_ptr<ArrayData> uniques;
+    RETURN_NOT_OK(DictionaryTraits<Type>::GetDictionaryArrayData(
+        pool_, key_type_, memo_table_, /*start_offset=*/0, &uniques));
+    return ExecBatch({Datum(std::move(uniques))}, num_groups());
+  }
+
+  uint32_t num_groups() const override {
+    return static_cast<uint32_t>(memo_table_.size());
+  }
+
+ private:
+  std::shared_ptr<DataType> key_type_;
+  MemoryPool* pool_;
+  MemoTable memo_table_;
+};
+
+template <typename Type>
+std::unique_ptr<Grouper> MakeMemoGrouperImpl(const std::shared_ptr<DataType>& key_type,
+                                             MemoryPool* pool) {
+  return std::unique_ptr<Grouper>(new MemoGrouper<Type>(key_type, pool));
+}
+
+// Return a MemoGrouper for the key type, or null if the key type has no memo table
+std::unique_ptr<Grouper> MakeMemoGrouper(const std::shared_ptr<DataType>& key_type,
+                                         MemoryPool* pool) {
+  // Only generate a single grouper per physical data representation, as
+  // in vector_hash.cc
+  switch (key_type->id()) {
+    case Type::BOOL:
+      return MakeMemoGrouperImpl<BooleanType>(key_type, pool);
+    case Type::INT8:
+    case Type::UINT8:
+      return MakeMemoGrouperImpl<UInt8Type>(key_type, pool);
+    case Type::INT16:
+    case Type::UINT16:
+      return MakeMemoGrouperImpl<UInt16Type>(key_type, pool);
+    case Type::INT32:
+    case Type::UINT32:
+    case Type::FLOAT:
+    case Type::DATE32:
+    case Type::TIME32:
+      return MakeMemoGrouperImpl<UInt32Type>(key_type, pool);
+    case Type::INT64:
+    case Type::UINT64:
+    case Type::DOUBLE:
+    case Type::DATE64:
+    case Type::TIME64:
+    case Type::TIMESTAMP:
+    case Type::DURATION:
+      return MakeMemoGrouperImpl<UInt64Type>(key_type, pool);
+    case Type::BINARY:
+    case Type::STRING:
+      return MakeMemoGrouperImpl<BinaryType>(key_type, pool);
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
+      return MakeMemoGrouperImpl<LargeBinaryType>(key_type, pool);
+    case Type::FIXED_SIZE_BINARY:
+    case Type::DECIMAL:
+      return MakeMemoGrouperImpl<FixedSizeBinaryType>(key_type, pool);
+    default:
+      return nullptr;
+  }
+}
+
+/// \brief Grouper over any number of key columns, which are encoded into a
+/// single byte string per row. Each distinct encoded row is hashed once and
+/// stored in a binary memo table, whose insertion order provides the group ids.
+class RowGrouper : public Grouper {
+ public:
+  explicit RowGrouper(MemoryPool* pool) : pool_(pool), memo_table_(pool, 0) {}
+
+  Status Init(const std::vector<ValueDescr>& descrs, ExecContext* ctx) {
+    return encoder_.Init(descrs, ctx);
+  }
+
+  Result<Datum> Consume(const ExecBatch& batch) override {
+    RETURN_NOT_OK(encoder_.EncodeBatch(batch));
+
+    ARROW_ASSIGN_OR_RAISE(auto group_ids,
+                          AllocateBuffer(batch.length * sizeof(uint32_t), pool_));
+    auto raw_group_ids = reinterpret_cast<uint32_t*>(group_ids->mutable_data());
+
+    for (int64_t i = 0; i < batch.length; ++i) {
+      int32_t memo_index;
+      RETURN_NOT_OK(memo_table_.GetOrInsert(encoder_.encoded_row(i), &memo_index));
+      raw_group_ids[i] = static_cast<uint32_t>(memo_index);
+    }
+
+    return ArrayData::Make(uint32(), batch.length, {nullptr, std::move(group_ids)},
+                           /*null_count=*/0);
+  }
+
+  Result<ExecBatch> GetUniques() override {
+    std::vector<const uint8_t*> rows;
+    rows.reserve(num_groups());
+    memo_table_.VisitValues(0, [&](const util::string_view& row) {
+      rows.push_back(reinterpret_cast<const uint8_t*>(row.data()));
+    });
+    return encoder_.Decode(static_cast<int64_t>(rows.size()), rows.data());
+  }
+
+  uint32_t num_groups() const override {
+    return static_cast<uint32_t>(memo_table_.size());
+  }
+
+ private:
+  MemoryPool* pool_;
+  RowEncoder encoder_;
+  ::arrow::internal::BinaryMemoTable<BinaryBuilder> memo_table_;
+};
+
+// ----------------------------------------------------------------------
+// Grouped aggregator framework
+
+struct GroupedAggregator : public KernelState {
+  virtual Status Resize(int64_t new_num_groups) = 0;
+
+  virtual Status Consume(const ExecBatch& batch) = 0;
+
+  virtual Status Merge(GroupedAggregator&& other, const ArrayData& group_id_mapping) = 0;
+
+  virtual Result<Datum> Finalize() = 0;
+
+  int64_t num_groups_ = 0;
+};
+
+void HashAggregateResize(KernelContext* ctx, int64_t num_groups) {
+  KERNEL_RETURN_IF_ERROR(
+      ctx, checked_cast<GroupedAggregator*>(ctx->state())->Resize(num_groups));
+}
+
+void HashAggregateConsume(KernelContext* ctx, const ExecBatch& batch) {
+  KERNEL_RETURN_IF_ERROR(ctx,
+                         checked_cast<GroupedAggregator*>(ctx->state())->Consume(batch));
+}
+
+void HashAggregateMerge(KernelContext* ctx, KernelState&& other,
+                        const ArrayData& group_id_mapping) {
+  KERNEL_RETURN_IF_ERROR(
+      ctx, checked_cast<GroupedAggregator*>(ctx->state())
+               ->Merge(checked_cast<GroupedAggregator&&>(other), group_id_mapping));
+}
+
+void HashAggregateFinalize(KernelContext* ctx, Datum* out) {
+  KERNEL_ASSIGN_OR_RAISE(*out, ctx,
+                         checked_cast<GroupedAggregator*>(ctx->state())->Finalize());
+}
+
+template <typename Impl>
+std::unique_ptr<KernelState> HashAggregateInit(KernelContext* ctx,
+                                               const KernelInitArgs& args) {
+  auto impl = ::arrow::internal::make_unique<Impl>();
+  ctx->SetStatus(impl->Init(ctx->exec_context(), args.options, args.inputs[0].type));
+  if (ctx->HasError()) return nullptr;
+  return std::move(impl);
+}
+
+// Visit each valid value of `input` along with its group id
+template <typename Type, typename ValidFunc>
+void VisitGroupedValues(const ExecBatch& batch, ValidFunc&& valid_func) {
+  using CType = typename TypeTraits<Type>::CType;
+  const ArrayData& input = *batch[0].array();
+  const uint32_t* group_ids = batch[1].array()->GetValues<uint32_t>(1);
+  const CType* values = input.GetValues<CType>(1);
+  VisitBitBlocksVoid(
+      input.buffers[0], input.offset, input.length,
+      [&](int64_t i) { valid_func(group_ids[i], values[i]); }, [] {});
+}
+
+// ----------------------------------------------------------------------
+// Count implementation
+
+struct GroupedCountImpl : public GroupedAggregator {
+  Status Init(ExecContext* ctx, const FunctionOptions* options,
+              const std::shared_ptr<DataType>&) {
+    options_ = static_cast<const CountOptions&>(*options);
+    counts_ = TypedBufferBuilder<int64_t>(ctx->memory_pool());
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    auto added_groups = new_num_groups - num_groups_;
+    num_groups_ = new_num_groups;
+    return counts_.Append(added_groups, 0);
+  }
+
+  Status Consume(const ExecBatch& batch) override {
+    int64_t* counts = counts_.mutable_data();
+    const ArrayData& input = *batch[0].array();
+    const uint32_t* group_ids = batch[1].array()->GetValues<uint32_t>(1);
+
+    if (input.type->id() == Type::NA) {
+      if (options_.count_mode == CountOptions::COUNT_NULL) {
+        for (int64_t i = 0; i < input.length; ++i) {
+          ++counts[group_ids[i]];
+        }
+      }
+      return Status::OK();
+    }
+
+    if (options_.count_mode == CountOptions::COUNT_NON_NULL) {
+      VisitBitBlocksVoid(
+          input.buffers[0], input.offset, input.length,
+          [&](int64_t i) { ++counts[group_ids[i]]; }, [] {});
+    } else if (input.MayHaveNulls()) {
+      int64_t i = 0;
+      VisitBitBlocksVoid(
+          input.buffers[0], input.offset, input.length, [&](int64_t) { ++i; },
+          [&]() { ++counts[group_ids[i++]]; });
+    }
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedCountImpl*>(&raw_other);
+
+    int64_t* counts = counts_.mutable_data();
+    const int64_t* other_counts = other->counts_.data();
+    const uint32_t* g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      counts[g[other_g]] += other_counts[other_g];
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    std::shared_ptr<Buffer> counts;
+    RETURN_NOT_OK(counts_.Finish(&counts));
+    return ArrayData::Make(int64(), num_groups_, {nullptr, std::move(counts)},
+                           /*null_count=*/0);
+  }
+
+  CountOptions options_;
+  TypedBufferBuilder<int64_t> counts_;
+};
+
+// ----------------------------------------------------------------------
+// Sum and mean implementation
+
+template <typename Type>
+struct GroupedSumImpl : public GroupedAggregator {
+  using AccType = typename FindAccumulatorType<Type>::Type;
+  using SumCType = typename TypeTraits<AccType>::CType;
+
+  Status Init(ExecContext* ctx, const FunctionOptions*,
+              const std::shared_ptr<DataType>&) {
+    pool_ = ctx->memory_pool();
+    sums_ = TypedBufferBuilder<SumCType>(pool_);
+    counts_ = TypedBufferBuilder<int64_t>(pool_);
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    auto added_groups = new_num_groups - num_groups_;
+    num_groups_ = new_num_groups;
+    RETURN_NOT_OK(sums_.Append(added_groups, 0));
+    return counts_.Append(added_groups, 0);
+  }
+
+  Status Consume(const ExecBatch& batch) override {
+    SumCType* sums = sums_.mutable_data();
+    int64_t* counts = counts_.mutable_data();
+    VisitGroupedValues<Type>(batch, [&](uint32_t g, typename TypeTraits<Type>::CType v) {
+      sums[g] += v;
+      ++counts[g];
+    });
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedSumImpl*>(&raw_other);
+
+    SumCType* sums = sums_.mutable_data();
+    int64_t* counts = counts_.mutable_data();
+    const SumCType* other_sums = other->sums_.data();
+    const int64_t* other_counts = other->counts_.data();
+    const uint32_t* g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      sums[g[other_g]] += other_sums[other_g];
+      counts[g[other_g]] += other_counts[other_g];
+    }
+    return Status::OK();
+  }
+
+  // Groups without any valid value are emitted as null
+  Result<std::shared_ptr<Buffer>> MakeNullBitmap(int64_t* null_count) const {
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap, AllocateBitmap(num_groups_, pool_));
+    uint8_t* bitmap = null_bitmap->mutable_data();
+    const int64_t* counts = counts_.data();
+    *null_count = 0;
+    for (int64_t i = 0; i < num_groups_; ++i) {
+      if (counts[i] > 0) {
+        BitUtil::SetBit(bitmap, i);
+      } else {
+        BitUtil::ClearBit(bitmap, i);
+        ++*null_count;
+      }
+    }
+    return std::move(null_bitmap);
+  }
+
+  Result<Datum> Finalize() override {
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap, MakeNullBitmap(&null_count));
+    std::shared_ptr<Buffer> sums;
+    RETURN_NOT_OK(sums_.Finish(&sums));
+    return ArrayData::Make(TypeTraits<AccType>::type_singleton(), num_groups_,
+                           {std::move(null_bitmap), std::move(sums)}, null_count);
+  }
+
+  MemoryPool* pool_;
+  TypedBufferBuilder<SumCType> sums_;
+  TypedBufferBuilder<int64_t> counts_;
+};
+
+template <typename Type>
+struct GroupedMeanImpl : public GroupedSumImpl<Type> {
+  using GroupedSumImpl<Type>::num_groups_;
+
+  Result<Datum> Finalize() override {
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap, this->MakeNullBitmap(&null_count));
+
+    ARROW_ASSIGN_OR_RAISE(auto means,
+                          AllocateBuffer(num_groups_ * sizeof(double), this->pool_));
+    auto raw_means = reinterpret_cast<double*>(means->mutable_data());
+    const auto* sums = this->sums_.data();
+    const int64_t* counts = this->counts_.data();
+    for (int64_t i = 0; i < num_groups_; ++i) {
+      raw_means[i] = counts[i] > 0 ? static_cast<double>(sums[i]) / counts[i] : 0;
+    }
+    return ArrayData::Make(float64(), num_groups_,
+                           {std::move(null_bitmap), std::move(means)}, null_count);
+  }
+};
+
+// ----------------------------------------------------------------------
+// MinMax implementation
+
+template <typename CType, typename Enable = void>
+struct MinMaxOps {
+  static constexpr CType anti_min() { return std::numeric_limits<CType>::max(); }
+  static constexpr CType anti_max() { return std::numeric_limits<CType>::min(); }
+  static CType Min(CType a, CType b) { return std::min(a, b); }
+  static CType Max(CType a, CType b) { return std::max(a, b); }
+};
+
+template <typename CType>
+struct MinMaxOps<CType, enable_if_t<std::is_floating_point<CType>::value>> {
+  static constexpr CType anti_min() { return std::numeric_limits<CType>::infinity(); }
+  static constexpr CType anti_max() { return -std::numeric_limits<CType>::infinity(); }
+  static CType Min(CType a, CType b) { return std::fmin(a, b); }
+  static CType Max(CType a, CType b) { return std::fmax(a, b); }
+};
+
+template <typename Type>
+struct GroupedMinMaxImpl : public GroupedAggregator {
+  using CType = typename TypeTraits<Type>::CType;
+  using Ops = MinMaxOps<CType>;
+
+  Status Init(ExecContext* ctx, const FunctionOptions* options,
+              const std::shared_ptr<DataType>& input_type) {
+    options_ = static_cast<const MinMaxOptions&>(*options);
+    type_ = input_type;
+    pool_ = ctx->memory_pool();
+    mins_ = TypedBufferBuilder<CType>(pool_);
+    maxes_ = TypedBufferBuilder<CType>(pool_);
+    has_values_ = TypedBufferBuilder<bool>(pool_);
+    has_nulls_ = TypedBufferBuilder<bool>(pool_);
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    auto added_groups = new_num_groups - num_groups_;
+    num_groups_ = new_num_groups;
+    RETURN_NOT_OK(mins_.Append(added_groups, Ops::anti_min()));
+    RETURN_NOT_OK(maxes_.Append(added_groups, Ops::anti_max()));
+    RETURN_NOT_OK(has_values_.Append(added_groups, false));
+    return has_nulls_.Append(added_groups, false);
+  }
+
+  Status Consume(const ExecBatch& batch) override {
+    CType* mins = mins_.mutable_data();
+    CType* maxes = maxes_.mutable_data();
+    uint8_t* has_values = has_values_.mutable_data();
+
+    VisitGroupedValues<Type>(batch, [&](uint32_t g, CType v) {
+      mins[g] = Ops::Min(mins[g], v);
+      maxes[g] = Ops::Max(maxes[g], v);
+      BitUtil::SetBit(has_values, g);
+    });
+
+    const ArrayData& input = *batch[0].array();
+    if (input.MayHaveNulls()) {
+      const uint32_t* group_ids = batch[1].array()->GetValues<uint32_t>(1);
+      uint8_t* has_nulls = has_nulls_.mutable_data();
+      int64_t i = 0;
+      VisitBitBlocksVoid(
+          input.buffers[0], input.offset, input.length, [&](int64_t) { ++i; },
+          [&]() { BitUtil::SetBit(has_nulls, group_ids[i++]); });
+    }
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedMinMaxImpl*>(&raw_other);
+
+    CType* mins = mins_.mutable_data();
+    CType* maxes = maxes_.mutable_data();
+    uint8_t* has_values = has_values_.mutable_data();
+    uint8_t* has_nulls = has_nulls_.mutable_data();
+
+    const CType* other_mins = other->mins_.data();
+    const CType* other_maxes = other->maxes_.data();
+    const uint8_t* other_has_values = other->has_values_.data();
+    const uint8_t* other_has_nulls = other->has_nulls_.data();
+
+    const uint32_t* g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      mins[g[other_g]] = Ops::Min(mins[g[other_g]], other_mins[other_g]);
+      maxes[g[other_g]] = Ops::Max(maxes[g[other_g]], other_maxes[other_g]);
+      if (BitUtil::GetBit(other_has_values, other_g)) {
+        BitUtil::SetBit(has_values, g[other_g]);
+      }
+      if (BitUtil::GetBit(other_has_nulls, other_g)) {
+        BitUtil::SetBit(has_nulls, g[other_g]);
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    // Groups without any valid value (or with nulls, if EMIT_NULL) are
+    // emitted as null min and max
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap, AllocateBitmap(num_groups_, pool_));
+    uint8_t* bitmap = null_bitmap->mutable_data();
+    const uint8_t* has_values = has_values_.data();
+    const uint8_t* has_nulls = has_nulls_.data();
+    const bool emit_null = options_.null_handling == MinMaxOptions::EMIT_NULL;
+    int64_t null_count = 0;
+    for (int64_t i = 0; i < num_groups_; ++i) {
+      const bool valid = BitUtil::GetBit(has_values, i) &&
+                         !(emit_null && BitUtil::GetBit(has_nulls, i));
+      BitUtil::SetBitTo(bitmap, i, valid);
+      null_count += !valid;
+    }
+
+    std::shared_ptr<Buffer> mins, maxes;
+    RETURN_NOT_OK(mins_.Finish(&mins));
+    RETURN_NOT_OK(maxes_.Finish(&maxes));
+
+    auto mins_data =
+        ArrayData::Make(type_, num_groups_, {null_bitmap, std::move(mins)}, null_count);
+    auto maxes_data = ArrayData::Make(type_, num_groups_,
+                                      {std::move(null_bitmap), std::move(maxes)},
+                                      null_count);
+    return ArrayData::Make(out_type(), num_groups_, {nullptr},
+                           {std::move(mins_data), std::move(maxes_data)},
+                           /*null_count=*/0);
+  }
+
+  std::shared_ptr<DataType> out_type() const {
+    return struct_({field("min", type_), field("max", type_)});
+  }
+
+  MinMaxOptions options_;
+  std::shared_ptr<DataType> type_;
+  MemoryPool* pool_;
+  TypedBufferBuilder<CType> mins_, maxes_;
+  TypedBufferBuilder<bool> has_values_, has_nulls_;
+};
+
+// ----------------------------------------------------------------------
+// Kernel registration helpers
+
+HashAggregateKernel MakeKernel(InputType argument_type, OutputType out_type,
+                               KernelInit init) {
+  HashAggregateKernel kernel;
+  kernel.init = std::move(init);
+  kernel.signature = KernelSignature::Make(
+      {std::move(argument_type), InputType::Array(Type::UINT32)}, std::move(out_type));
+  kernel.resize = HashAggregateResize;
+  kernel.consume = HashAggregateConsume;
+  kernel.merge = HashAggregateMerge;
+  kernel.finalize = HashAggregateFinalize;
+  return kernel;
+}
+
+template <template <typename> class Impl>
+KernelInit GetNumericInit(const DataType& type) {
+  switch (type.id()) {
+    case Type::INT8:
+      return HashAggregateInit<Impl<Int8Type>>;
+    case Type::INT16:
+      return HashAggregateInit<Impl<Int16Type>>;
+    case Type::INT32:
+      return HashAggregateInit<Impl<Int32Type>>;
+    case Type::INT64:
+      return HashAggregateInit<Impl<Int64Type>>;
+    case Type::UINT8:
+      return HashAggregateInit<Impl<UInt8Type>>;
+    case Type::UINT16:
+      return HashAggregateInit<Impl<UInt16Type>>;
+    case Type::UINT32:
+      return HashAggregateInit<Impl<UInt32Type>>;
+    case Type::UINT64:
+      return HashAggregateInit<Impl<UInt64Type>>;
+    case Type::FLOAT:
+      return HashAggregateInit<Impl<FloatType>>;
+    case Type::DOUBLE:
+      return HashAggregateInit<Impl<DoubleType>>;
+    default:
+      DCHECK(false);
+      return nullptr;
+  }
+}
+
+Result<ValueDescr> SumOutputType(KernelContext*, const std::vector<ValueDescr>& descrs) {
+  const auto& type = descrs[0].type;
+  if (is_floating(type->id())) {
+    return ValueDescr::Array(float64());
+  } else if (is_unsigned_integer(type->id())) {
+    return ValueDescr::Array(uint64());
+  }
+  return ValueDescr::Array(int64());
+}
+
+Result<ValueDescr> MinMaxOutputType(KernelContext*,
+                                    const std::vector<ValueDescr>& descrs) {
+  const auto& type = descrs[0].type;
+  return ValueDescr::Array(struct_({field("min", type), field("max", type)}));
+}
+
+template <template <typename> class Impl>
+void AddNumericKernels(OutputType out_type, HashAggregateFunction* func) {
+  for (const auto& ty : NumericTypes()) {
+    DCHECK_OK(func->AddKernel(
+        MakeKernel(InputType::Array(ty), out_type, GetNumericInit<Impl>(*ty))));
+  }
+}
+
+const FunctionDoc hash_count_doc{"Count the number of null / non-null values",
+                                 ("By default, non-null values are counted.\n"
+                                  "This can be changed through CountOptions."),
+                                 {"array", "group_id_array"},
+                                 "CountOptions"};
+
+const FunctionDoc hash_sum_doc{"Sum values of a numeric array",
+                               ("Null values are ignored."),
+                               {"array", "group_id_array"}};
+
+const FunctionDoc hash_mean_doc{"Average values of a numeric array",
+                                ("Null values are ignored. The result is always\n"
+                                 "computed as a double."),
+                                {"array", "group_id_array"}};
+
+const FunctionDoc hash_min_max_doc{
+    "Compute the minimum and maximum values of a numeric array",
+    ("Null values are ignored by default.\n"
+     "This can be changed through MinMaxOptions."),
+    {"array", "group_id_array"},
+    "MinMaxOptions"};
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Grouper and GroupBy
+
+Result<std::unique_ptr<Grouper>> Grouper::Make(const std::vector<ValueDescr>& descrs,
+                                               ExecContext* ctx) {
+  MemoryPool* pool = ctx != nullptr ? ctx->memory_pool() : default_memory_pool();
+  if (descrs.empty()) {
+    return Status::Invalid("Grouper requires at least one key");
+  }
+
+  // A single key column can be hashed directly, without row encoding
+  if (descrs.size() == 1 && descrs[0].shape == ValueDescr::ARRAY) {
+    if (auto memo_grouper = MakeMemoGrouper(descrs[0].type, pool)) {
+      return std::move(memo_grouper);
+    }
+  }
+
+  auto row_grouper = ::arrow::internal::make_unique<RowGrouper>(pool);
+  RETURN_NOT_OK(row_grouper->Init(descrs, ctx));
+  return std::move(row_grouper);
+}
+
+Result<Datum> GroupBy(const std::vector<Datum>& arguments, const std::vector<Datum>& keys,
+                      const std::vector<Aggregate>& aggregates, ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return GroupBy(arguments, keys, aggregates, &default_ctx);
+  }
+  if (arguments.size() != aggregates.size()) {
+    return Status::Invalid("GroupBy got ", arguments.size(), " arguments but ",
+                           aggregates.size(), " aggregates");
+  }
+  if (keys.empty()) {
+    return Status::Invalid("GroupBy requires at least one key");
+  }
+
+  // Look up and initialize the HashAggregateKernels
+  std::vector<const HashAggregateKernel*> kernels(aggregates.size());
+  std::vector<std::unique_ptr<KernelState>> states(aggregates.size());
+  std::vector<KernelContext> kernel_ctxs(aggregates.size(), KernelContext{ctx});
+  FieldVector out_fields(aggregates.size() + keys.size());
+
+  for (size_t i = 0; i < aggregates.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto function,
+                          ctx->func_registry()->GetFunction(aggregates[i].function));
+    if (function->kind() != Function::HASH_AGGREGATE) {
+      return Status::Invalid("The provided function (", aggregates[i].function,
+                             ") is not a hash aggregate function");
+    }
+    const auto& hash_function = checked_cast<const HashAggregateFunction&>(*function);
+
+    std::vector<ValueDescr> in_descrs = {arguments[i].descr(),
+                                         ValueDescr::Array(uint32())};
+    ARROW_ASSIGN_OR_RAISE(kernels[i], hash_function.DispatchExact(in_descrs));
+
+    const FunctionOptions* options = aggregates[i].options != nullptr
+                                         ? aggregates[i].options
+                                         : function->default_options();
+    states[i] = kernels[i]->init(&kernel_ctxs[i], {kernels[i], in_descrs, options});
+    ARROW_CTX_RETURN_IF_ERROR(&kernel_ctxs[i]);
+    kernel_ctxs[i].SetState(states[i].get());
+
+    ARROW_ASSIGN_OR_RAISE(
+        auto out_descr,
+        kernels[i]->signature->out_type().Resolve(&kernel_ctxs[i], in_descrs));
+    out_fields[i] = field(aggregates[i].function, std::move(out_descr.type));
+  }
+
+  // Construct the Grouper
+  std::vector<ValueDescr> key_descrs(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    key_descrs[i] = keys[i].descr();
+    out_fields[aggregates.size() + i] =
+        field("key_" + std::to_string(i), key_descrs[i].type);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto grouper, Grouper::Make(key_descrs, ctx));
+
+  // Iterate over the keys and the arguments in lockstep
+  std::vector<Datum> keys_and_arguments = keys;
+  keys_and_arguments.insert(keys_and_arguments.end(), arguments.begin(),
+                            arguments.end());
+  ARROW_ASSIGN_OR_RAISE(auto batch_iterator,
+                        ::arrow::compute::detail::ExecBatchIterator::Make(
+                            keys_and_arguments, ctx->exec_chunksize()));
+
+  ExecBatch batch;
+  while (batch_iterator->Next(&batch)) {
+    if (batch.length == 0) continue;
+
+    ExecBatch key_batch({batch.values.begin(), batch.values.begin() + keys.size()},
+                        batch.length);
+    ARROW_ASSIGN_OR_RAISE(Datum group_ids, grouper->Consume(key_batch));
+
+    for (size_t i = 0; i < kernels.size(); ++i) {
+      kernels[i]->resize(&kernel_ctxs[i], grouper->num_groups());
+      ARROW_CTX_RETURN_IF_ERROR(&kernel_ctxs[i]);
+
+      kernels[i]->consume(&kernel_ctxs[i],
+                          ExecBatch({batch[keys.size() + i], group_ids}, batch.length));
+      ARROW_CTX_RETURN_IF_ERROR(&kernel_ctxs[i]);
+    }
+  }
+
+  // Finalize the aggregates and append the unique keys
+  ArrayDataVector out_columns(aggregates.size() + keys.size());
+  for (size_t i = 0; i < kernels.size(); ++i) {
+    // Ensure the state is sized even if no batch was consumed
+    kernels[i]->resize(&kernel_ctxs[i], grouper->num_groups());
+    ARROW_CTX_RETURN_IF_ERROR(&kernel_ctxs[i]);
+
+    Datum out;
+    kernels[i]->finalize(&kernel_ctxs[i], &out);
+    ARROW_CTX_RETURN_IF_ERROR(&kernel_ctxs[i]);
+    out_columns[i] = out.array();
+  }
+
+  ARROW_ASSIGN_OR_RAISE(ExecBatch uniques, grouper->GetUniques());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    out_columns[aggregates.size() + i] = uniques[i].array();
+  }
+
+  return ArrayData::Make(struct_(std::move(out_fields)), grouper->num_groups(),
+                         {nullptr}, std::move(out_columns), /*null_count=*/0);
+}
+
+void RegisterHashAggregateBasic(FunctionRegistry* registry) {
+  {
+    static auto default_count_options = CountOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_count", Arity::Binary(), &hash_count_doc, &default_count_options);
+    DCHECK_OK(func->AddKernel(MakeKernel(InputType(ValueDescr::ARRAY),
+                                         ValueDescr::Array(int64()),
+                                         HashAggregateInit<GroupedCountImpl>)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>("hash_sum", Arity::Binary(),
+                                                        &hash_sum_doc);
+    AddNumericKernels<GroupedSumImpl>(OutputType(SumOutputType), func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>("hash_mean", Arity::Binary(),
+                                                        &hash_mean_doc);
+    AddNumericKernels<GroupedMeanImpl>(ValueDescr::Array(float64()), func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    static auto default_minmax_options = MinMaxOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_min_max", Arity::Binary(), &hash_min_max_doc, &default_minmax_options);
+    AddNumericKernels<GroupedMinMaxImpl>(OutputType(MinMaxOutputType), func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,281 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/compute/registry.h"
+#include "arrow/type.h"
+
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+
+namespace compute {
+namespace internal {
+
+namespace {
+
+void AssertGroupByEquals(const std::vector<Datum>& arguments,
+                         const std::vector<Datum>& keys,
+                         const std::vector<Aggregate>& aggregates,
+                         const std::shared_ptr<DataType>& expected_type,
+                         const std::string& expected_json) {
+  ASSERT_OK_AND_ASSIGN(Datum aggregated, GroupBy(arguments, keys, aggregates));
+  auto actual = aggregated.make_array();
+  ASSERT_OK(actual->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(expected_type, expected_json), *actual,
+                    /*verbose=*/true);
+}
+
+}  // namespace
+
+TEST(Grouper, SingleKey) {
+  ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make({ValueDescr::Array(int64())}));
+
+  ExecBatch batch({ArrayFromJSON(int64(), "[3, null, 3, 1, null, 7, 1]")}, 7);
+  ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(batch));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[0, 1, 0, 2, 1, 3, 2]"),
+                    *ids.make_array());
+  ASSERT_EQ(grouper->num_groups(), 4);
+
+  batch = ExecBatch({ArrayFromJSON(int64(), "[7, 5]")}, 2);
+  ASSERT_OK_AND_ASSIGN(ids, grouper->Consume(batch));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[3, 4]"), *ids.make_array());
+
+  ASSERT_OK_AND_ASSIGN(ExecBatch uniques, grouper->GetUniques());
+  ASSERT_EQ(uniques.length, 5);
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[3, null, 1, 7, 5]"),
+                    *uniques[0].make_array());
+}
+
+TEST(Grouper, StringKey) {
+  ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make({ValueDescr::Array(utf8())}));
+
+  ExecBatch batch({ArrayFromJSON(utf8(), R"(["eh", "bee", "eh", null, "bee"])")}, 5);
+  ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(batch));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[0, 1, 0, 2, 1]"), *ids.make_array());
+
+  ASSERT_OK_AND_ASSIGN(ExecBatch uniques, grouper->GetUniques());
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["eh", "bee", null])"),
+                    *uniques[0].make_array());
+}
+
+TEST(Grouper, MultipleKeys) {
+  ASSERT_OK_AND_ASSIGN(
+      auto grouper, Grouper::Make({ValueDescr::Array(utf8()), ValueDescr::Array(int32()),
+                                   ValueDescr::Array(date32())}));
+
+  ExecBatch batch({ArrayFromJSON(utf8(), R"(["a", "b", "a", "a", null, "b", null])"),
+                   ArrayFromJSON(int32(), "[1, 1, 1, 2, 1, null, 1]"),
+                   ArrayFromJSON(date32(), "[0, 0, 0, 0, 0, 0, 0]")},
+                  7);
+  ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(batch));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[0, 1, 0, 2, 3, 4, 3]"),
+                    *ids.make_array());
+  ASSERT_EQ(grouper->num_groups(), 5);
+
+  ASSERT_OK_AND_ASSIGN(ExecBatch uniques, grouper->GetUniques());
+  ASSERT_EQ(uniques.length, 5);
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", "b", "a", null, "b"])"),
+                    *uniques[0].make_array());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 1, 2, 1, null]"),
+                    *uniques[1].make_array());
+  AssertArraysEqual(*ArrayFromJSON(date32(), "[0, 0, 0, 0, 0]"),
+                    *uniques[2].make_array());
+}
+
+TEST(Grouper, BooleanAndScalarKeys) {
+  ASSERT_OK_AND_ASSIGN(auto grouper,
+                       Grouper::Make({ValueDescr::Array(boolean()),
+                                      ValueDescr::Scalar(large_utf8())}));
+
+  std::shared_ptr<Scalar> scalar_key = std::make_shared<LargeStringScalar>("x");
+  ExecBatch batch({ArrayFromJSON(boolean(), "[true, false, null, true]"), scalar_key},
+                  4);
+  ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(batch));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[0, 1, 2, 0]"), *ids.make_array());
+
+  ASSERT_OK_AND_ASSIGN(ExecBatch uniques, grouper->GetUniques());
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, false, null]"),
+                    *uniques[0].make_array());
+  AssertArraysEqual(*ArrayFromJSON(large_utf8(), R"(["x", "x", "x"])"),
+                    *uniques[1].make_array());
+}
+
+TEST(Grouper, DictionaryKey) {
+  auto dict_type = dictionary(int32(), utf8());
+  ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make({ValueDescr::Array(dict_type)}));
+
+  ExecBatch batch({DictArrayFromJSON(dict_type, "[1, 0, null, 1]", R"(["ex", "why"])")},
+                  4);
+  ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(batch));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[0, 1, 2, 0]"), *ids.make_array());
+
+  ASSERT_OK_AND_ASSIGN(ExecBatch uniques, grouper->GetUniques());
+  AssertArraysEqual(*DictArrayFromJSON(dict_type, "[1, 0, null]", R"(["ex", "why"])"),
+                    *uniques[0].make_array());
+
+  // Differing dictionaries are not unified
+  batch = ExecBatch({DictArrayFromJSON(dict_type, "[0]", R"(["zee"])")}, 1);
+  ASSERT_RAISES(NotImplemented, grouper->Consume(batch));
+}
+
+TEST(Grouper, Unsupported) {
+  ASSERT_RAISES(Invalid, Grouper::Make({}));
+  ASSERT_RAISES(NotImplemented, Grouper::Make({ValueDescr::Array(list(int32()))}));
+  ASSERT_RAISES(NotImplemented, Grouper::Make({ValueDescr::Array(int32()),
+                                               ValueDescr::Array(null())}));
+}
+
+TEST(GroupBy, SumMeanCount) {
+  auto argument = ArrayFromJSON(
+      float64(), "[1.0, 0.0, null, 4.0, 3.25, 0.125, -0.25, 0.75, null, null]");
+  auto key = ArrayFromJSON(int64(), "[1, 1, 1, 2, null, 3, 3, null, 2, 4]");
+
+  CountOptions count_options;
+  AssertGroupByEquals({argument, argument, argument}, {key},
+                      {{"hash_count", &count_options}, {"hash_sum", nullptr},
+                       {"hash_mean", nullptr}},
+                      struct_({field("hash_count", int64()),
+                               field("hash_sum", float64()),
+                               field("hash_mean", float64()),
+                               field("key_0", int64())}),
+                      R"([
+    [2, 1.0,   0.5,    1],
+    [1, 4.0,   4.0,    2],
+    [2, 4.0,   2.0,    null],
+    [2, -0.125, -0.0625, 3],
+    [0, null,  null,   4]
+  ])");
+}
+
+TEST(GroupBy, CountNull) {
+  auto argument = ArrayFromJSON(int32(), "[1, null, null, 4, 5]");
+  auto key = ArrayFromJSON(utf8(), R"(["a", "a", "b", "b", "c"])");
+
+  CountOptions count_null(CountOptions::COUNT_NULL);
+  AssertGroupByEquals({argument}, {key}, {{"hash_count", &count_null}},
+                      struct_({field("hash_count", int64()), field("key_0", utf8())}),
+                      R"([[1, "a"], [1, "b"], [0, "c"]])");
+}
+
+TEST(GroupBy, SumIntegers) {
+  auto argument = ArrayFromJSON(int8(), "[1, 2, 3, null, 120, 120]");
+  auto key = ArrayFromJSON(uint16(), "[0, 1, 0, 1, 2, 2]");
+
+  AssertGroupByEquals({argument}, {key}, {{"hash_sum", nullptr}},
+                      struct_({field("hash_sum", int64()), field("key_0", uint16())}),
+                      R"([[4, 0], [2, 1], [240, 2]])");
+}
+
+TEST(GroupBy, MinMax) {
+  auto argument = ArrayFromJSON(
+      float64(), "[1.0, 0.0, null, 4.0, 3.25, 0.125, -0.25, 0.75, null, null]");
+  auto key = ArrayFromJSON(int64(), "[1, 1, 1, 2, null, 3, 3, null, 2, 4]");
+  auto min_max_type = struct_({field("min", float64()), field("max", float64())});
+
+  AssertGroupByEquals({argument}, {key}, {{"hash_min_max", nullptr}},
+                      struct_({field("hash_min_max", min_max_type),
+                               field("key_0", int64())}),
+                      R"([
+    [{"min": 0.0,   "max": 1.0},   1],
+    [{"min": 4.0,   "max": 4.0},   2],
+    [{"min": 0.75,  "max": 3.25},  null],
+    [{"min": -0.25, "max": 0.125}, 3],
+    [{"min": null,  "max": null},  4]
+  ])");
+
+  MinMaxOptions emit_null(MinMaxOptions::EMIT_NULL);
+  AssertGroupByEquals({argument}, {key}, {{"hash_min_max", &emit_null}},
+                      struct_({field("hash_min_max", min_max_type),
+                               field("key_0", int64())}),
+                      R"([
+    [{"min": null,  "max": null},  1],
+    [{"min": null,  "max": null},  2],
+    [{"min": 0.75,  "max": 3.25},  null],
+    [{"min": -0.25, "max": 0.125}, 3],
+    [{"min": null,  "max": null},  4]
+  ])");
+}
+
+TEST(GroupBy, ChunkedInput) {
+  auto argument = ChunkedArrayFromJSON(int32(), {"[1, 2]", "[3, null, 5]", "[]"});
+  auto key = ChunkedArrayFromJSON(utf8(), {R"(["x", "y", "x"])", R"(["z", "y"])", "[]"});
+
+  AssertGroupByEquals({argument, argument}, {key},
+                      {{"hash_sum", nullptr}, {"hash_min_max", nullptr}},
+                      struct_({field("hash_sum", int64()),
+                               field("hash_min_max", struct_({field("min", int32()),
+                                                              field("max", int32())})),
+                               field("key_0", utf8())}),
+                      R"([
+    [4,    {"min": 1,    "max": 3},    "x"],
+    [7,    {"min": 2,    "max": 5},    "y"],
+    [null, {"min": null, "max": null}, "z"]
+  ])");
+}
+
+TEST(GroupBy, MultipleKeys) {
+  auto argument = ArrayFromJSON(int64(), "[1, 2, 3, 4, 5, 6]");
+  auto key_0 = ArrayFromJSON(utf8(), R"(["a", "b", "a", "a", null, "b"])");
+  auto key_1 = ArrayFromJSON(int32(), "[1, 1, 1, 2, 1, null]");
+
+  AssertGroupByEquals({argument, argument}, {key_0, key_1},
+                      {{"hash_sum", nullptr}, {"hash_count", nullptr}},
+                      struct_({field("hash_sum", int64()), field("hash_count", int64()),
+                               field("key_0", utf8()), field("key_1", int32())}),
+                      R"([
+    [4, 2, "a",  1],
+    [2, 1, "b",  1],
+    [4, 1, "a",  2],
+    [5, 1, null, 1],
+    [6, 1, "b",  null]
+  ])");
+}
+
+TEST(GroupBy, Errors) {
+  auto argument = ArrayFromJSON(int32(), "[1, 2]");
+  auto key = ArrayFromJSON(int32(), "[0, 0]");
+
+  // Not a hash aggregate function
+  ASSERT_RAISES(Invalid, GroupBy({argument}, {key}, {{"sum", nullptr}}));
+  // Mismatched arguments and aggregates
+  ASSERT_RAISES(Invalid, GroupBy({argument, argument}, {key}, {{"hash_sum", nullptr}}));
+  // Unsupported argument type
+  ASSERT_RAISES(NotImplemented, GroupBy({ArrayFromJSON(utf8(), R"(["a", "b"])")},
+                                        {key}, {{"hash_sum", nullptr}}));
+}
+
+TEST(HashAggregateFunction, DirectExecution) {
+  auto argument = ArrayFromJSON(int32(), "[1, 2]");
+  auto group_ids = ArrayFromJSON(uint32(), "[0, 0]");
+  ASSERT_RAISES(NotImplemented, CallFunction("hash_sum", {argument, group_ids}));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,280 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/util.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/row_encoder_internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/make_unique.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+namespace {
+
+// Compute a flag per row, set if none of the row's keys is null. Null keys
+// never compare equal in a join.
+std::vector<uint8_t> KeysValid(const ExecBatch& keys) {
+  std::vector<uint8_t> valid(keys.length, 1);
+  for (const Datum& key : keys.values) {
+    if (key.is_scalar()) {
+      if (!key.scalar()->is_valid) {
+        std::fill(valid.begin(), valid.end(), 0);
+      }
+      continue;
+    }
+    const ArrayData& data = *key.array();
+    if (data.type->id() == Type::NA) {
+      std::fill(valid.begin(), valid.end(), 0);
+    } else if (data.MayHaveNulls()) {
+      const uint8_t* bitmap = data.buffers[0]->data();
+      for (int64_t i = 0; i < keys.length; ++i) {
+        valid[i] &= BitUtil::GetBit(bitmap, data.offset + i);
+      }
+    }
+  }
+  return valid;
+}
+
+class HashJoinImpl : public HashJoin {
+ public:
+  HashJoinImpl(JoinType join_type, ExecContext ctx)
+      : join_type_(join_type),
+        ctx_(std::move(ctx)),
+        memo_table_(ctx_.memory_pool(), 0) {}
+
+  Status Init(const std::shared_ptr<Table>& build_side, std::vector<int> build_keys) {
+    if (build_keys.empty()) {
+      return Status::Invalid("HashJoin requires at least one key");
+    }
+    build_schema_ = build_side->schema();
+
+    // Join output is gathered from the build side with random access, so
+    // flatten it once upfront
+    ARROW_ASSIGN_OR_RAISE(auto combined, build_side->CombineChunks(ctx_.memory_pool()));
+    build_columns_.resize(combined->num_columns());
+    for (int i = 0; i < combined->num_columns(); ++i) {
+      const auto& column = combined->column(i);
+      if (column->num_chunks() == 0) {
+        ARROW_ASSIGN_OR_RAISE(build_columns_[i],
+                              MakeArrayOfNull(column->type(), 0, ctx_.memory_pool()));
+      } else {
+        build_columns_[i] = column->chunk(0);
+      }
+    }
+
+    std::vector<ValueDescr> key_descrs(build_keys.size());
+    ExecBatch keys({}, combined->num_rows());
+    for (size_t i = 0; i < build_keys.size(); ++i) {
+      if (build_keys[i] < 0 || build_keys[i] >= combined->num_columns()) {
+        return Status::IndexError("Build key index ", build_keys[i], " out of bounds");
+      }
+      const auto& column = build_columns_[build_keys[i]];
+      key_descrs[i] = ValueDescr::Array(column->type());
+      keys.values.emplace_back(column);
+    }
+    RETURN_NOT_OK(encoder_.Init(key_descrs, &ctx_));
+
+    return BuildHashTable(keys);
+  }
+
+  Result<ExecBatch> ProbeIndices(const ExecBatch& probe_keys) override {
+    const auto& key_descrs = encoder_.descrs();
+    if (probe_keys.num_values() != static_cast<int>(key_descrs.size())) {
+      return Status::Invalid("HashJoin expected ", key_descrs.size(),
+                             " probe keys, got ", probe_keys.num_values());
+    }
+    for (size_t i = 0; i < key_descrs.size(); ++i) {
+      if (!probe_keys[i].type()->Equals(*key_descrs[i].type)) {
+        return Status::TypeError("Probe key ", i, " has type ", *probe_keys[i].type(),
+                                 " but build key has type ", *key_descrs[i].type);
+      }
+    }
+
+    RETURN_NOT_OK(encoder_.EncodeBatch(probe_keys));
+    const std::vector<uint8_t> valid = KeysValid(probe_keys);
+
+    TypedBufferBuilder<int64_t> probe_indices(ctx_.memory_pool());
+    TypedBufferBuilder<int64_t> build_indices(ctx_.memory_pool());
+    TypedBufferBuilder<bool> build_indices_valid(ctx_.memory_pool());
+    int64_t build_null_count = 0;
+    RETURN_NOT_OK(probe_indices.Reserve(probe_keys.length));
+
+    for (int64_t i = 0; i < probe_keys.length; ++i) {
+      const int32_t key_id = valid[i] ? memo_table_.Get(encoder_.encoded_row(i))
+                                      : ::arrow::internal::kKeyNotFound;
+      const bool matched = key_id != ::arrow::internal::kKeyNotFound;
+
+      if (join_type_ == JoinType::LEFT_SEMI || join_type_ == JoinType::LEFT_ANTI) {
+        if (matched == (join_type_ == JoinType::LEFT_SEMI)) {
+          RETURN_NOT_OK(probe_indices.Append(i));
+        }
+      } else if (matched) {
+        const int64_t begin = key_offsets_[key_id];
+        const int64_t num_matches = key_offsets_[key_id + 1] - begin;
+        RETURN_NOT_OK(probe_indices.Append(num_matches, i));
+        RETURN_NOT_OK(build_indices.Append(build_row_ids_.data() + begin, num_matches));
+        if (join_type_ == JoinType::LEFT_OUTER) {
+          RETURN_NOT_OK(build_indices_valid.Append(num_matches, true));
+        }
+      } else if (join_type_ == JoinType::LEFT_OUTER) {
+        RETURN_NOT_OK(probe_indices.Append(i));
+        RETURN_NOT_OK(build_indices.Append(0));
+        RETURN_NOT_OK(build_indices_valid.Append(false));
+        ++build_null_count;
+      }
+    }
+
+    const int64_t length = probe_indices.length();
+    std::shared_ptr<Buffer> probe_indices_buf;
+    RETURN_NOT_OK(probe_indices.Finish(&probe_indices_buf));
+    ExecBatch out(
+        {ArrayData::Make(int64(), length, {nullptr, std::move(probe_indices_buf)},
+                         /*null_count=*/0)},
+        length);
+
+    if (join_type_ == JoinType::INNER || join_type_ == JoinType::LEFT_OUTER) {
+      std::shared_ptr<Buffer> build_indices_buf, validity_buf;
+      RETURN_NOT_OK(build_indices.Finish(&build_indices_buf));
+      if (build_null_count > 0) {
+        RETURN_NOT_OK(build_indices_valid.Finish(&validity_buf));
+      }
+      out.values.emplace_back(ArrayData::Make(
+          int64(), length, {std::move(validity_buf), std::move(build_indices_buf)},
+          build_null_count));
+    }
+    return out;
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Probe(
+      const RecordBatch& probe_side, const std::vector<int>& probe_keys) override {
+    ExecBatch keys({}, probe_side.num_rows());
+    for (int key : probe_keys) {
+      if (key < 0 || key >= probe_side.num_columns()) {
+        return Status::IndexError("Probe key index ", key, " out of bounds");
+      }
+      keys.values.emplace_back(probe_side.column_data(key));
+    }
+    ARROW_ASSIGN_OR_RAISE(ExecBatch indices, ProbeIndices(keys));
+    ARROW_ASSIGN_OR_RAISE(auto out_schema, OutputSchema(*probe_side.schema()));
+
+    const auto probe_indices = indices[0].make_array();
+    ArrayVector out_columns;
+    for (int i = 0; i < probe_side.num_columns(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto column,
+                            Take(*probe_side.column(i), *probe_indices,
+                                 TakeOptions::NoBoundsCheck(), &ctx_));
+      out_columns.push_back(std::move(column));
+    }
+    if (indices.num_values() > 1) {
+      const auto build_indices = indices[1].make_array();
+      for (const auto& build_column : build_columns_) {
+        ARROW_ASSIGN_OR_RAISE(auto column, Take(*build_column, *build_indices,
+                                                TakeOptions::NoBoundsCheck(), &ctx_));
+        out_columns.push_back(std::move(column));
+      }
+    }
+    return RecordBatch::Make(std::move(out_schema), indices.length,
+                             std::move(out_columns));
+  }
+
+  Result<std::shared_ptr<Schema>> OutputSchema(
+      const Schema& probe_schema) const override {
+    FieldVector fields = probe_schema.fields();
+    if (join_type_ == JoinType::INNER) {
+      for (const auto& field : build_schema_->fields()) {
+        fields.push_back(field);
+      }
+    } else if (join_type_ == JoinType::LEFT_OUTER) {
+      for (const auto& field : build_schema_->fields()) {
+        fields.push_back(field->WithNullable(true));
+      }
+    }
+    return schema(std::move(fields));
+  }
+
+ private:
+  // Assign a key id to every distinct build key, then lay out the build row
+  // ids grouped by key id so that each key's matches are contiguous
+  Status BuildHashTable(const ExecBatch& keys) {
+    RETURN_NOT_OK(encoder_.EncodeBatch(keys));
+    const std::vector<uint8_t> valid = KeysValid(keys);
+
+    std::vector<int32_t> row_key_ids(keys.length);
+    for (int64_t i = 0; i < keys.length; ++i) {
+      if (!valid[i]) {
+        row_key_ids[i] = ::arrow::internal::kKeyNotFound;
+        continue;
+      }
+      RETURN_NOT_OK(memo_table_.GetOrInsert(encoder_.encoded_row(i), &row_key_ids[i]));
+    }
+
+    key_offsets_.assign(memo_table_.size() + 1, 0);
+    for (int32_t key_id : row_key_ids) {
+      if (key_id != ::arrow::internal::kKeyNotFound) ++key_offsets_[key_id + 1];
+    }
+    for (size_t i = 1; i < key_offsets_.size(); ++i) {
+      key_offsets_[i] += key_offsets_[i - 1];
+    }
+
+    std::vector<int64_t> cursors(key_offsets_.begin(), key_offsets_.end() - 1);
+    build_row_ids_.resize(key_offsets_.back());
+    for (int64_t i = 0; i < keys.length; ++i) {
+      if (row_key_ids[i] != ::arrow::internal::kKeyNotFound) {
+        build_row_ids_[cursors[row_key_ids[i]]++] = i;
+      }
+    }
+    return Status::OK();
+  }
+
+  JoinType join_type_;
+  ExecContext ctx_;
+  std::shared_ptr<Schema> build_schema_;
+  ArrayVector build_columns_;
+  RowEncoder encoder_;
+  ::arrow::internal::BinaryMemoTable<BinaryBuilder> memo_table_;
+  // build_row_ids_[key_offsets_[k] : key_offsets_[k + 1]] are the build rows
+  // with key id k
+  std::vector<int64_t> key_offsets_;
+  std::vector<int64_t> build_row_ids_;
+};
+
+}  // namespace
+
+Result<std::unique_ptr<HashJoin>> HashJoin::Make(JoinType join_type,
+                                                 std::shared_ptr<Table> build_side,
+                                                 std::vector<int> build_keys,
+                                                 ExecContext* ctx) {
+  auto impl = ::arrow::internal::make_unique<HashJoinImpl>(
+      join_type, ctx != nullptr ? *ctx : ExecContext());
+  RETURN_NOT_OK(impl->Init(build_side, std::move(build_keys)));
+  return std::move(impl);
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
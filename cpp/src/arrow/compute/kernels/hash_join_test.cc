@@ -0,0 +1,158 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+class TestHashJoin : public ::testing::Test {
+ public:
+  void SetUp() override {
+    build_schema_ = schema({field("k0", int32()), field("k1", utf8()),
+                            field("payload", float64())});
+    // The build side is split across chunks and contains duplicate and null keys
+    build_ = TableFromJSON(build_schema_, {R"([
+      {"k0": 1,    "k1": "a", "payload": 1.5},
+      {"k0": 2,    "k1": "b", "payload": 2.5}
+    ])",
+                                           R"([
+      {"k0": 2,    "k1": "b", "payload": 3.5},
+      {"k0": null, "k1": "c", "payload": 4.5},
+      {"k0": 3,    "k1": "c", "payload": 5.5}
+    ])"});
+
+    probe_schema_ = schema({field("id", int64()), field("p0", int32()),
+                            field("p1", utf8())});
+    probe_ = RecordBatchFromJSON(probe_schema_, R"([
+      {"id": 0, "p0": 2,    "p1": "b"},
+      {"id": 1, "p0": 1,    "p1": "b"},
+      {"id": 2, "p0": null, "p1": "c"},
+      {"id": 3, "p0": 3,    "p1": "c"},
+      {"id": 4, "p0": 1,    "p1": "a"}
+    ])");
+  }
+
+  void AssertJoin(JoinType join_type, const std::shared_ptr<Schema>& expected_schema,
+                  const std::string& expected_json) {
+    ASSERT_OK_AND_ASSIGN(auto join, HashJoin::Make(join_type, build_, {0, 1}));
+    ASSERT_OK_AND_ASSIGN(auto out_schema, join->OutputSchema(*probe_schema_));
+    AssertSchemaEqual(*expected_schema, *out_schema);
+
+    ASSERT_OK_AND_ASSIGN(auto joined, join->Probe(*probe_, {1, 2}));
+    ASSERT_OK(joined->ValidateFull());
+    AssertBatchesEqual(*RecordBatchFromJSON(expected_schema, expected_json), *joined);
+  }
+
+ protected:
+  std::shared_ptr<Schema> build_schema_, probe_schema_;
+  std::shared_ptr<Table> build_;
+  std::shared_ptr<RecordBatch> probe_;
+};
+
+TEST_F(TestHashJoin, Inner) {
+  AssertJoin(JoinType::INNER,
+             schema({field("id", int64()), field("p0", int32()), field("p1", utf8()),
+                     field("k0", int32()), field("k1", utf8()),
+                     field("payload", float64())}),
+             R"([
+    {"id": 0, "p0": 2, "p1": "b", "k0": 2, "k1": "b", "payload": 2.5},
+    {"id": 0, "p0": 2, "p1": "b", "k0": 2, "k1": "b", "payload": 3.5},
+    {"id": 3, "p0": 3, "p1": "c", "k0": 3, "k1": "c", "payload": 5.5},
+    {"id": 4, "p0": 1, "p1": "a", "k0": 1, "k1": "a", "payload": 1.5}
+  ])");
+}
+
+TEST_F(TestHashJoin, LeftOuter) {
+  AssertJoin(JoinType::LEFT_OUTER,
+             schema({field("id", int64()), field("p0", int32()), field("p1", utf8()),
+                     field("k0", int32()), field("k1", utf8()),
+                     field("payload", float64())}),
+             R"([
+    {"id": 0, "p0": 2,    "p1": "b", "k0": 2,    "k1": "b",  "payload": 2.5},
+    {"id": 0, "p0": 2,    "p1": "b", "k0": 2,    "k1": "b",  "payload": 3.5},
+    {"id": 1, "p0": 1,    "p1": "b", "k0": null, "k1": null, "payload": null},
+    {"id": 2, "p0": null, "p1": "c", "k0": null, "k1": null, "payload": null},
+    {"id": 3, "p0": 3,    "p1": "c", "k0": 3,    "k1": "c",  "payload": 5.5},
+    {"id": 4, "p0": 1,    "p1": "a", "k0": 1,    "k1": "a",  "payload": 1.5}
+  ])");
+}
+
+TEST_F(TestHashJoin, LeftSemi) {
+  AssertJoin(JoinType::LEFT_SEMI, probe_schema_, R"([
+    {"id": 0, "p0": 2, "p1": "b"},
+    {"id": 3, "p0": 3, "p1": "c"},
+    {"id": 4, "p0": 1, "p1": "a"}
+  ])");
+}
+
+TEST_F(TestHashJoin, LeftAnti) {
+  AssertJoin(JoinType::LEFT_ANTI, probe_schema_, R"([
+    {"id": 1, "p0": 1,    "p1": "b"},
+    {"id": 2, "p0": null, "p1": "c"}
+  ])");
+}
+
+TEST_F(TestHashJoin, ProbeIndices) {
+  ASSERT_OK_AND_ASSIGN(auto join, HashJoin::Make(JoinType::LEFT_OUTER, build_, {0, 1}));
+
+  ExecBatch keys({ArrayFromJSON(int32(), "[3, 2, 7]"),
+                  ArrayFromJSON(utf8(), R"(["c", "b", "c"])")},
+                 3);
+  ASSERT_OK_AND_ASSIGN(ExecBatch indices, join->ProbeIndices(keys));
+  ASSERT_EQ(indices.num_values(), 2);
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[0, 1, 1, 2]"), *indices[0].make_array());
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[4, 1, 2, null]"),
+                    *indices[1].make_array());
+}
+
+TEST_F(TestHashJoin, EmptyBuildSide) {
+  ASSERT_OK_AND_ASSIGN(auto empty, Table::FromRecordBatches(build_schema_, {}));
+  ASSERT_OK_AND_ASSIGN(auto join, HashJoin::Make(JoinType::LEFT_ANTI, empty, {0, 1}));
+  ASSERT_OK_AND_ASSIGN(auto joined, join->Probe(*probe_, {1, 2}));
+  AssertBatchesEqual(*probe_, *joined);
+}
+
+TEST_F(TestHashJoin, Errors) {
+  ASSERT_RAISES(Invalid, HashJoin::Make(JoinType::INNER, build_, {}));
+  ASSERT_RAISES(IndexError, HashJoin::Make(JoinType::INNER, build_, {3}));
+
+  ASSERT_OK_AND_ASSIGN(auto join, HashJoin::Make(JoinType::INNER, build_, {0, 1}));
+  // Mismatched key types
+  ASSERT_RAISES(TypeError, join->Probe(*probe_, {0, 2}));
+  // Mismatched number of keys
+  ASSERT_RAISES(Invalid, join->Probe(*probe_, {1}));
+  ASSERT_RAISES(IndexError, join->Probe(*probe_, {1, 5}));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
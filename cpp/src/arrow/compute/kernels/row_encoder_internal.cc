@@ -0,0 +1,404 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/row_encoder_internal.h"
+
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "arrow/array/util.h"
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/ubsan.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace internal {
+
+namespace {
+
+constexpr int32_t kExtraByteForNull = 1;
+
+// Decode the leading null flag of each encoded value, producing a validity
+// bitmap (or none if all values are valid)
+Status DecodeNulls(MemoryPool* pool, int32_t length, const uint8_t** encoded_bytes,
+                   std::shared_ptr<Buffer>* null_bitmap, int64_t* null_count) {
+  // first count nulls to determine if a null bitmap is necessary
+  *null_count = 0;
+  for (int32_t i = 0; i < length; ++i) {
+    *null_count += encoded_bytes[i][0] == KeyEncoder::kNullByte;
+  }
+
+  if (*null_count > 0) {
+    ARROW_ASSIGN_OR_RAISE(*null_bitmap, AllocateBitmap(length, pool));
+    uint8_t* validity = (*null_bitmap)->mutable_data();
+    for (int32_t i = 0; i < length; ++i) {
+      BitUtil::SetBitTo(validity, i, encoded_bytes[i][0] == KeyEncoder::kValidByte);
+      encoded_bytes[i] += 1;
+    }
+  } else {
+    for (int32_t i = 0; i < length; ++i) {
+      encoded_bytes[i] += 1;
+    }
+  }
+  return Status::OK();
+}
+
+struct BooleanKeyEncoder : KeyEncoder {
+  static constexpr int kByteWidth = 1;
+
+  void AddLength(const ArrayData& data, int32_t* lengths) override {
+    for (int64_t i = 0; i < data.length; ++i) {
+      lengths[i] += kByteWidth + kExtraByteForNull;
+    }
+  }
+
+  Status Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    return VisitArrayDataInline<BooleanType>(
+        data,
+        [&](bool value) {
+          auto& encoded_ptr = *encoded_bytes++;
+          *encoded_ptr++ = kValidByte;
+          *encoded_ptr++ = value;
+          return Status::OK();
+        },
+        [&]() {
+          auto& encoded_ptr = *encoded_bytes++;
+          *encoded_ptr++ = kNullByte;
+          *encoded_ptr++ = 0;
+          return Status::OK();
+        });
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                            int32_t length,
+                                            MemoryPool* pool) const override {
+    std::shared_ptr<Buffer> null_buf;
+    int64_t null_count;
+    RETURN_NOT_OK(DecodeNulls(pool, length, encoded_bytes, &null_buf, &null_count));
+
+    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBitmap(length, pool));
+
+    uint8_t* raw_output = key_buf->mutable_data();
+    for (int32_t i = 0; i < length; ++i) {
+      auto& encoded_ptr = encoded_bytes[i];
+      BitUtil::SetBitTo(raw_output, i, encoded_ptr[0] != 0);
+      encoded_ptr += 1;
+    }
+
+    return ArrayData::Make(boolean(), length, {std::move(null_buf), std::move(key_buf)},
+                           null_count);
+  }
+};
+
+struct FixedWidthKeyEncoder : KeyEncoder {
+  explicit FixedWidthKeyEncoder(std::shared_ptr<DataType> type)
+      : type_(std::move(type)),
+        byte_width_(checked_cast<const FixedWidthType&>(*type_).bit_width() / 8) {}
+
+  void AddLength(const ArrayData& data, int32_t* lengths) override {
+    for (int64_t i = 0; i < data.length; ++i) {
+      lengths[i] += byte_width_ + kExtraByteForNull;
+    }
+  }
+
+  Status Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    ArrayData viewed(fixed_size_binary(byte_width_), data.length, data.buffers,
+                     data.null_count, data.offset);
+
+    return VisitArrayDataInline<FixedSizeBinaryType>(
+        viewed,
+        [&](util::string_view bytes) {
+          auto& encoded_ptr = *encoded_bytes++;
+          *encoded_ptr++ = kValidByte;
+          memcpy(encoded_ptr, bytes.data(), byte_width_);
+          encoded_ptr += byte_width_;
+          return Status::OK();
+        },
+        [&]() {
+          auto& encoded_ptr = *encoded_bytes++;
+          *encoded_ptr++ = kNullByte;
+          memset(encoded_ptr, 0, byte_width_);
+          encoded_ptr += byte_width_;
+          return Status::OK();
+        });
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                            int32_t length,
+                                            MemoryPool* pool) const override {
+    std::shared_ptr<Buffer> null_buf;
+    int64_t null_count;
+    RETURN_NOT_OK(DecodeNulls(pool, length, encoded_bytes, &null_buf, &null_count));
+
+    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBuffer(length * byte_width_, pool));
+
+    uint8_t* raw_output = key_buf->mutable_data();
+    for (int32_t i = 0; i < length; ++i) {
+      auto& encoded_ptr = encoded_bytes[i];
+      memcpy(raw_output, encoded_ptr, byte_width_);
+      encoded_ptr += byte_width_;
+      raw_output += byte_width_;
+    }
+
+    return ArrayData::Make(type_, length, {std::move(null_buf), std::move(key_buf)},
+                           null_count);
+  }
+
+  std::shared_ptr<DataType> type_;
+  int byte_width_;
+};
+
+// Dictionary keys are encoded by their indices. All encoded batches are
+// required to share the same dictionary.
+struct DictionaryKeyEncoder : FixedWidthKeyEncoder {
+  explicit DictionaryKeyEncoder(std::shared_ptr<DataType> type)
+      : FixedWidthKeyEncoder(checked_cast<const DictionaryType&>(*type).index_type()),
+        dictionary_type_(std::move(type)) {}
+
+  Status Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    auto dict = MakeArray(data.dictionary);
+    if (dictionary_ == nullptr) {
+      dictionary_ = dict;
+    } else if (!dictionary_->Equals(dict)) {
+      // Supporting this would require unifying dictionaries across batches
+      return Status::NotImplemented("Unifying differing dictionaries");
+    }
+
+    return FixedWidthKeyEncoder::Encode(data, encoded_bytes);
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                            int32_t length,
+                                            MemoryPool* pool) const override {
+    ARROW_ASSIGN_OR_RAISE(auto data,
+                          FixedWidthKeyEncoder::Decode(encoded_bytes, length, pool));
+
+    if (dictionary_) {
+      data->dictionary = dictionary_->data();
+    } else {
+      ARROW_ASSIGN_OR_RAISE(
+          auto dict,
+          MakeArrayOfNull(checked_cast<const DictionaryType&>(*dictionary_type_)
+                              .value_type(),
+                          0, pool));
+      data->dictionary = dict->data();
+    }
+
+    data->type = dictionary_type_;
+    return data;
+  }
+
+  std::shared_ptr<DataType> dictionary_type_;
+  std::shared_ptr<Array> dictionary_;
+};
+
+template <typename T>
+struct VarLengthKeyEncoder : KeyEncoder {
+  using Offset = typename T::offset_type;
+
+  explicit VarLengthKeyEncoder(std::shared_ptr<DataType> type) : type_(std::move(type)) {}
+
+  void AddLength(const ArrayData& data, int32_t* lengths) override {
+    int64_t i = 0;
+    VisitArrayDataInline<T>(
+        data,
+        [&](util::string_view bytes) {
+          lengths[i++] += kExtraByteForNull + sizeof(Offset) +
+                          static_cast<int32_t>(bytes.size());
+        },
+        [&]() { lengths[i++] += kExtraByteForNull + sizeof(Offset); });
+  }
+
+  Status Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    return VisitArrayDataInline<T>(
+        data,
+        [&](util::string_view bytes) {
+          auto& encoded_ptr = *encoded_bytes++;
+          *encoded_ptr++ = kValidByte;
+          util::SafeStore(encoded_ptr, static_cast<Offset>(bytes.size()));
+          encoded_ptr += sizeof(Offset);
+          memcpy(encoded_ptr, bytes.data(), bytes.size());
+          encoded_ptr += bytes.size();
+          return Status::OK();
+        },
+        [&]() {
+          auto& encoded_ptr = *encoded_bytes++;
+          *encoded_ptr++ = kNullByte;
+          util::SafeStore(encoded_ptr, static_cast<Offset>(0));
+          encoded_ptr += sizeof(Offset);
+          return Status::OK();
+        });
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                            int32_t length,
+                                            MemoryPool* pool) const override {
+    std::shared_ptr<Buffer> null_buf;
+    int64_t null_count;
+    RETURN_NOT_OK(DecodeNulls(pool, length, encoded_bytes, &null_buf, &null_count));
+
+    Offset length_sum = 0;
+    for (int32_t i = 0; i < length; ++i) {
+      length_sum += util::SafeLoadAs<Offset>(encoded_bytes[i]);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto offset_buf,
+                          AllocateBuffer(sizeof(Offset) * (1 + length), pool));
+    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBuffer(length_sum, pool));
+
+    auto raw_offsets = reinterpret_cast<Offset*>(offset_buf->mutable_data());
+    auto raw_keys = key_buf->mutable_data();
+
+    Offset current_offset = 0;
+    for (int32_t i = 0; i < length; ++i) {
+      raw_offsets[i] = current_offset;
+
+      auto key_length = util::SafeLoadAs<Offset>(encoded_bytes[i]);
+      encoded_bytes[i] += sizeof(Offset);
+
+      memcpy(raw_keys + current_offset, encoded_bytes[i], key_length);
+      encoded_bytes[i] += key_length;
+
+      current_offset += key_length;
+    }
+    raw_offsets[length] = current_offset;
+
+    return ArrayData::Make(
+        type_, length, {std::move(null_buf), std::move(offset_buf), std::move(key_buf)},
+        null_count);
+  }
+
+  std::shared_ptr<DataType> type_;
+};
+
+}  // namespace
+
+Result<std::unique_ptr<KeyEncoder>> KeyEncoder::Make(
+    const std::shared_ptr<DataType>& type) {
+  if (type->id() == Type::BOOL) {
+    return ::arrow::internal::make_unique<BooleanKeyEncoder>();
+  }
+
+  if (type->id() == Type::DICTIONARY) {
+    return ::arrow::internal::make_unique<DictionaryKeyEncoder>(type);
+  }
+
+  if (is_fixed_width(type->id())) {
+    return ::arrow::internal::make_unique<FixedWidthKeyEncoder>(type);
+  }
+
+  if (is_binary_like(type->id())) {
+    return ::arrow::internal::make_unique<VarLengthKeyEncoder<BinaryType>>(type);
+  }
+
+  if (is_large_binary_like(type->id())) {
+    return ::arrow::internal::make_unique<VarLengthKeyEncoder<LargeBinaryType>>(type);
+  }
+
+  return Status::NotImplemented("Keys of type ", *type);
+}
+
+Status RowEncoder::Init(const std::vector<ValueDescr>& descrs, ExecContext* ctx) {
+  descrs_ = descrs;
+  pool_ = ctx != nullptr ? ctx->memory_pool() : default_memory_pool();
+  encoders_.resize(descrs.size());
+  for (size_t i = 0; i < descrs.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(encoders_[i], KeyEncoder::Make(descrs[i].type));
+  }
+  offsets_.assign(1, 0);
+  bytes_.clear();
+  return Status::OK();
+}
+
+Status RowEncoder::EncodeBatch(const ExecBatch& batch) {
+  if (batch.num_values() != static_cast<int>(encoders_.size())) {
+    return Status::Invalid("Expected batch with ", encoders_.size(),
+                           " key columns, got ", batch.num_values());
+  }
+
+  std::vector<std::shared_ptr<ArrayData>> columns(encoders_.size());
+  for (size_t i = 0; i < columns.size(); ++i) {
+    if (batch[i].is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(auto broadcast,
+                            MakeArrayFromScalar(*batch[i].scalar(), batch.length, pool_));
+      columns[i] = broadcast->data();
+    } else if (batch[i].is_array()) {
+      columns[i] = batch[i].array();
+    } else {
+      return Status::Invalid("Expected array or scalar key, got ",
+                             batch[i].ToString());
+    }
+  }
+
+  // Determine the encoded length of each row
+  std::vector<int32_t> lengths(batch.length, 0);
+  for (size_t i = 0; i < encoders_.size(); ++i) {
+    encoders_[i]->AddLength(*columns[i], lengths.data());
+  }
+
+  offsets_.resize(batch.length + 1);
+  offsets_[0] = 0;
+  for (int64_t i = 0; i < batch.length; ++i) {
+    offsets_[i + 1] = offsets_[i] + lengths[i];
+  }
+
+  // Encode each column into its place in the rows
+  bytes_.resize(offsets_[batch.length]);
+  std::vector<uint8_t*> row_ptrs(batch.length);
+  for (int64_t i = 0; i < batch.length; ++i) {
+    row_ptrs[i] = bytes_.data() + offsets_[i];
+  }
+  for (size_t i = 0; i < encoders_.size(); ++i) {
+    RETURN_NOT_OK(encoders_[i]->Encode(*columns[i], row_ptrs.data()));
+  }
+  return Status::OK();
+}
+
+Result<ExecBatch> RowEncoder::Decode(int64_t num_rows, const uint8_t* const* rows) const {
+  if (num_rows > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("Cannot decode ", num_rows, " rows at once");
+  }
+  const auto length = static_cast<int32_t>(num_rows);
+
+  // The encoders advance these as they consume the columns
+  std::vector<const uint8_t*> row_ptrs(rows, rows + num_rows);
+
+  ExecBatch out({}, num_rows);
+  out.values.resize(encoders_.size());
+  for (size_t i = 0; i < encoders_.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto column,
+                          encoders_[i]->Decode(row_ptrs.data(), length, pool_));
+    out.values[i] = std::move(column);
+  }
+  return out;
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
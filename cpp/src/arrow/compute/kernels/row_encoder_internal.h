@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/array/data.h"
+#include "arrow/compute/exec.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+/// \brief Encodes the values of one key column into a row-oriented format.
+///
+/// Each encoded value starts with a byte flagging it as valid or null, so that
+/// nulls compare equal to each other and distinct from every valid value.
+/// Encoding happens in two passes: AddLength() accumulates the encoded length
+/// of every row, then Encode() writes each row at the given (advanced) pointers.
+struct ARROW_EXPORT KeyEncoder {
+  static constexpr uint8_t kValidByte = 0;
+  static constexpr uint8_t kNullByte = 1;
+
+  virtual ~KeyEncoder() = default;
+
+  /// Add the encoded length of each value to `lengths`
+  virtual void AddLength(const ArrayData& data, int32_t* lengths) = 0;
+
+  /// Encode each value at `encoded_bytes[i]`, advancing the pointers past it
+  virtual Status Encode(const ArrayData& data, uint8_t** encoded_bytes) = 0;
+
+  /// Decode `length` values from `encoded_bytes[i]`, advancing the pointers past
+  /// the decoded values
+  virtual Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                                    int32_t length,
+                                                    MemoryPool* pool) const = 0;
+
+  static bool IsNull(const uint8_t* encoded_bytes) {
+    return encoded_bytes == NULLPTR || encoded_bytes[0] == kNullByte;
+  }
+
+  /// Construct the encoder appropriate for a key type
+  static Result<std::unique_ptr<KeyEncoder>> Make(const std::shared_ptr<DataType>& type);
+};
+
+/// \brief Encodes rows of several key columns into a single byte string per row.
+///
+/// Encoded rows of identical keys are bytewise identical, so the encoding can be
+/// hashed and compared in one pass regardless of the number and types of the key
+/// columns. This is the building block for grouping, distinct and join keys.
+class ARROW_EXPORT RowEncoder {
+ public:
+  /// Prepare encoding of keys with the given types
+  Status Init(const std::vector<ValueDescr>& descrs, ExecContext* ctx);
+
+  /// Encode the rows of `batch`, replacing any previously encoded rows.
+  /// Scalar keys are broadcast to the batch length.
+  Status EncodeBatch(const ExecBatch& batch);
+
+  /// The number of rows in the last encoded batch
+  int64_t num_rows() const { return static_cast<int64_t>(offsets_.size()) - 1; }
+
+  /// The encoded bytes of a row of the last encoded batch
+  util::string_view encoded_row(int64_t i) const {
+    return util::string_view(reinterpret_cast<const char*>(bytes_.data()) + offsets_[i],
+                             static_cast<size_t>(offsets_[i + 1] - offsets_[i]));
+  }
+
+  /// Decode `num_rows` encoded rows (not necessarily produced by the last
+  /// EncodeBatch call) into key columns.
+  Result<ExecBatch> Decode(int64_t num_rows, const uint8_t* const* rows) const;
+
+  const std::vector<ValueDescr>& descrs() const { return descrs_; }
+
+ private:
+  std::vector<ValueDescr> descrs_;
+  MemoryPool* pool_ = NULLPTR;
+  std::vector<std::unique_ptr<KeyEncoder>> encoders_;
+  std::vector<int64_t> offsets_;
+  std::vector<uint8_t> bytes_;
+};
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
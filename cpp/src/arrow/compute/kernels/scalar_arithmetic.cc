@@ -15,7 +15,13 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+
 #include "arrow/compute/kernels/common.h"
+#include "arrow/compute/kernels/decimal_internal.h"
+#include "arrow/compute/kernels/scalar_arithmetic_internal.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/int_util_internal.h"
 #include "arrow/util/macros.h"
 
@@ -34,49 +40,6 @@ using applicator::ScalarBinaryNotNullEqualTypes;
 
 namespace {
 
-template <typename T>
-using is_unsigned_integer = std::integral_constant<bool, std::is_integral<T>::value &&
-                                                             std::is_unsigned<T>::value>;
-
-template <typename T>
-using is_signed_integer =
-    std::integral_constant<bool, std::is_integral<T>::value && std::is_signed<T>::value>;
-
-template <typename T>
-using enable_if_signed_integer = enable_if_t<is_signed_integer<T>::value, T>;
-
-template <typename T>
-using enable_if_unsigned_integer = enable_if_t<is_unsigned_integer<T>::value, T>;
-
-template <typename T>
-using enable_if_integer =
-    enable_if_t<is_signed_integer<T>::value || is_unsigned_integer<T>::value, T>;
-
-template <typename T>
-using enable_if_floating_point = enable_if_t<std::is_floating_point<T>::value, T>;
-
-template <typename T, typename Unsigned = typename std::make_unsigned<T>::type>
-constexpr Unsigned to_unsigned(T signed_) {
-  return static_cast<Unsigned>(signed_);
-}
-
-struct Add {
-  template <typename T>
-  static constexpr enable_if_floating_point<T> Call(KernelContext*, T left, T right) {
-    return left + right;
-  }
-
-  template <typename T>
-  static constexpr enable_if_unsigned_integer<T> Call(KernelContext*, T left, T right) {
-    return left + right;
-  }
-
-  template <typename T>
-  static constexpr enable_if_signed_integer<T> Call(KernelContext*, T left, T right) {
-    return arrow::internal::SafeSignedAdd(left, right);
-  }
-};
-
 struct AddChecked {
   template <typename T, typename Arg0, typename Arg1>
   enable_if_integer<T> Call(KernelContext* ctx, Arg0 left, Arg1 right) {
@@ -95,23 +58,6 @@ struct AddChecked {
   }
 };
 
-struct Subtract {
-  template <typename T>
-  static constexpr enable_if_floating_point<T> Call(KernelContext*, T left, T right) {
-    return left - right;
-  }
-
-  template <typename T>
-  static constexpr enable_if_unsigned_integer<T> Call(KernelContext*, T left, T right) {
-    return left - right;
-  }
-
-  template <typename T>
-  static constexpr enable_if_signed_integer<T> Call(KernelContext*, T left, T right) {
-    return arrow::internal::SafeSignedSubtract(left, right);
-  }
-};
-
 struct SubtractChecked {
   template <typename T, typename Arg0, typename Arg1>
   enable_if_integer<T> Call(KernelContext* ctx, Arg0 left, Arg1 right) {
@@ -130,45 +76,6 @@ struct SubtractChecked {
   }
 };
 
-struct Multiply {
-  static_assert(std::is_same<decltype(int8_t() * int8_t()), int32_t>::value, "");
-  static_assert(std::is_same<decltype(uint8_t() * uint8_t()), int32_t>::value, "");
-  static_assert(std::is_same<decltype(int16_t() * int16_t()), int32_t>::value, "");
-  static_assert(std::is_same<decltype(uint16_t() * uint16_t()), int32_t>::value, "");
-  static_assert(std::is_same<decltype(int32_t() * int32_t()), int32_t>::value, "");
-  static_assert(std::is_same<decltype(uint32_t() * uint32_t()), uint32_t>::value, "");
-  static_assert(std::is_same<decltype(int64_t() * int64_t()), int64_t>::value, "");
-  static_assert(std::is_same<decltype(uint64_t() * uint64_t()), uint64_t>::value, "");
-
-  template <typename T>
-  static constexpr enable_if_floating_point<T> Call(KernelContext*, T left, T right) {
-    return left * right;
-  }
-
-  template <typename T>
-  static constexpr enable_if_unsigned_integer<T> Call(KernelContext*, T left, T right) {
-    return left * right;
-  }
-
-  template <typename T>
-  static constexpr enable_if_signed_integer<T> Call(KernelContext*, T left, T right) {
-    return to_unsigned(left) * to_unsigned(right);
-  }
-
-  // Multiplication of 16 bit integer types implicitly promotes to signed 32 bit
-  // integer. However, some inputs may nevertheless overflow (which triggers undefined
-  // behaviour). Therefore we first cast to 32 bit unsigned integers where overflow is
-  // well defined.
-  template <typename T = void>
-  static constexpr int16_t Call(KernelContext*, int16_t left, int16_t right) {
-    return static_cast<uint32_t>(left) * static_cast<uint32_t>(right);
-  }
-  template <typename T = void>
-  static constexpr uint16_t Call(KernelContext*, uint16_t left, uint16_t right) {
-    return static_cast<uint32_t>(left) * static_cast<uint32_t>(right);
-  }
-};
-
 struct MultiplyChecked {
   template <typename T, typename Arg0, typename Arg1>
   enable_if_integer<T> Call(KernelContext* ctx, Arg0 left, Arg1 right) {
@@ -270,7 +177,7 @@ std::shared_ptr<ScalarFunction> MakeArithmeticFunction(std::string name,
   auto func = std::make_shared<ScalarFunction>(name, Arity::Binary(), doc);
   for (const auto& ty : NumericTypes()) {
     auto exec = NumericEqualTypesBinary<ScalarBinaryEqualTypes, Op>(ty);
-    DCHECK_OK(func->AddKernel({ty, ty}, ty, exec));
+    DCHECK_OK(AddSelectionVectorKernel(func.get(), {ty, ty}, ty, exec));
   }
   return func;
 }
@@ -288,6 +195,239 @@ std::shared_ptr<ScalarFunction> MakeArithmeticFunctionNotNull(std::string name,
   return func;
 }
 
+// ----------------------------------------------------------------------
+// Decimal arithmetic
+
+int32_t CapDecimalPrecision(int32_t precision) {
+  return std::min(precision, static_cast<int32_t>(Decimal128Type::kMaxPrecision));
+}
+
+struct DecimalAdd {
+  // Both operands are rescaled to the output scale
+  static constexpr bool kRescale = true;
+
+  static Result<std::shared_ptr<DataType>> OutputType(const Decimal128Type& left,
+                                                      const Decimal128Type& right) {
+    const int32_t scale = std::max(left.scale(), right.scale());
+    const int32_t precision =
+        std::max(left.precision() - left.scale(), right.precision() - right.scale()) +
+        scale + 1;
+    return decimal(CapDecimalPrecision(precision), scale);
+  }
+
+  static bool Call(int64_t left, int64_t right, int64_t* out) {
+    return AddWithOverflow(left, right, out);
+  }
+
+  static BasicDecimal128 Call(const BasicDecimal128& left, const BasicDecimal128& right) {
+    return left + right;
+  }
+
+  // Whether the 128-bit operation wrapped around. Sums of values of at most
+  // 38 digits which wrap around don't fit in 38 digits either, so the output
+  // precision check catches them.
+  static bool Overflows(const BasicDecimal128&, const BasicDecimal128&,
+                        const BasicDecimal128&) {
+    return false;
+  }
+};
+
+struct DecimalSubtract : public DecimalAdd {
+  static bool Call(int64_t left, int64_t right, int64_t* out) {
+    return SubtractWithOverflow(left, right, out);
+  }
+
+  static BasicDecimal128 Call(const BasicDecimal128& left, const BasicDecimal128& right) {
+    return left - right;
+  }
+};
+
+struct DecimalMultiply {
+  static constexpr bool kRescale = false;
+
+  static Result<std::shared_ptr<DataType>> OutputType(const Decimal128Type& left,
+                                                      const Decimal128Type& right) {
+    const int32_t scale = left.scale() + right.scale();
+    if (scale > Decimal128Type::kMaxPrecision) {
+      return Status::Invalid("Decimal multiplication result scale ", scale,
+                             " is out of range");
+    }
+    const int32_t precision = left.precision() + right.precision() + 1;
+    return decimal(CapDecimalPrecision(precision), scale);
+  }
+
+  static bool Call(int64_t left, int64_t right, int64_t* out) {
+    return MultiplyWithOverflow(left, right, out);
+  }
+
+  static BasicDecimal128 Call(const BasicDecimal128& left, const BasicDecimal128& right) {
+    return left * right;
+  }
+
+  static bool Overflows(const BasicDecimal128& left, const BasicDecimal128& right,
+                        const BasicDecimal128& result) {
+    return right != 0 && result / right != left;
+  }
+};
+
+template <typename Op>
+Result<ValueDescr> ResolveDecimalBinaryOutput(KernelContext*,
+                                               const std::vector<ValueDescr>& args) {
+  ARROW_ASSIGN_OR_RAISE(
+      auto type, Op::OutputType(checked_cast<const Decimal128Type&>(*args[0].type),
+                                checked_cast<const Decimal128Type&>(*args[1].type)));
+  return ValueDescr(std::move(type));
+}
+
+// An array or scalar decimal operand, rescaled by `scale_up` digits
+struct DecimalOperand {
+  DecimalOperand(const Datum& datum, int32_t scale_up) : scale_up(scale_up) {
+    if (datum.is_scalar()) {
+      scalar_value = checked_cast<const Decimal128Scalar&>(*datum.scalar()).value;
+    } else {
+      const ArrayData& arr = *datum.array();
+      values = arr.GetValues<uint8_t>(1, arr.offset * 16);
+    }
+    const auto& type = checked_cast<const Decimal128Type&>(*datum.type());
+    precision = type.precision() + scale_up;
+  }
+
+  BasicDecimal128 Value(int64_t i) const {
+    BasicDecimal128 value = values ? BasicDecimal128(values + i * 16) : scalar_value;
+    return scale_up > 0 ? value.IncreaseScaleBy(scale_up) : value;
+  }
+
+  // Only valid if precision <= kMaxDecimal64Precision
+  int64_t Value64(int64_t i) const {
+    const int64_t value =
+        values ? LoadDecimal64(values + i * 16)
+               : static_cast<int64_t>(scalar_value.low_bits());
+    return value * DecimalScaleMultiplier64(scale_up);
+  }
+
+  // Whether rescaling the value overflows the maximum decimal precision
+  bool RescaleOverflows(int64_t i) const {
+    if (scale_up == 0) return false;
+    BasicDecimal128 value = values ? BasicDecimal128(values + i * 16) : scalar_value;
+    return !value.FitsInPrecision(Decimal128Type::kMaxPrecision - scale_up);
+  }
+
+  const uint8_t* values = nullptr;
+  BasicDecimal128 scalar_value;
+  int32_t scale_up;
+  int32_t precision;
+};
+
+// Decimal binary arithmetic on arrays and scalars of possibly different decimal
+// types. When both operands fit in 64 bits after rescaling, the int64_t
+// operation is used unless it overflows. In the checked variant, results which
+// don't fit in the output precision (when capped at 38 digits) are an error.
+template <typename Op, bool kChecked>
+struct DecimalBinaryArithmetic {
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const auto& out_type = checked_cast<const Decimal128Type&>(*out->type());
+    const DecimalOperand left(batch[0], ScaleUp(*batch[0].type(), out_type));
+    const DecimalOperand right(batch[1], ScaleUp(*batch[1].type(), out_type));
+
+    if (out->is_scalar()) {
+      const auto& left_scalar = *batch[0].scalar();
+      const auto& right_scalar = *batch[1].scalar();
+      if (left_scalar.is_valid && right_scalar.is_valid) {
+        BasicDecimal128 result;
+        if (Compute(ctx, left, right, out_type, 0, &result)) {
+          out->value = std::make_shared<Decimal128Scalar>(result, out->type());
+        }
+      }
+      return;
+    }
+
+    ArrayData* out_arr = out->mutable_array();
+    uint8_t* out_values = out_arr->GetMutableValues<uint8_t>(1, out_arr->offset * 16);
+    const uint8_t* out_bitmap = out_arr->GetValues<uint8_t>(0, 0);
+    const int64_t length = out_arr->length;
+    auto is_valid = [&](int64_t i) {
+      return out_bitmap == nullptr ||
+             BitUtil::GetBit(out_bitmap, out_arr->offset + i);
+    };
+
+    if (left.precision <= kMaxDecimal64Precision &&
+        right.precision <= kMaxDecimal64Precision) {
+      for (int64_t i = 0; i < length; ++i) {
+        const int64_t u = left.Value64(i);
+        const int64_t v = right.Value64(i);
+        int64_t result;
+        if (ARROW_PREDICT_TRUE(!Op::Call(u, v, &result))) {
+          StoreDecimal64(result, out_values + i * 16);
+        } else {
+          // Widen on overflow. The output precision always fits the result
+          // of two operands of at most 18 digits, so this can't fail.
+          Op::Call(BasicDecimal128(u), BasicDecimal128(v)).ToBytes(out_values + i * 16);
+        }
+      }
+      return;
+    }
+
+    for (int64_t i = 0; i < length; ++i) {
+      BasicDecimal128 result;
+      if (kChecked && !is_valid(i)) {
+        result = 0;
+      } else if (!Compute(ctx, left, right, out_type, i, &result)) {
+        return;
+      }
+      result.ToBytes(out_values + i * 16);
+    }
+  }
+
+  static int32_t ScaleUp(const DataType& type, const Decimal128Type& out_type) {
+    if (!Op::kRescale) return 0;
+    return out_type.scale() - checked_cast<const Decimal128Type&>(type).scale();
+  }
+
+  // Compute a single 128-bit value, returning false on error
+  static bool Compute(KernelContext* ctx, const DecimalOperand& left,
+                      const DecimalOperand& right, const Decimal128Type& out_type,
+                      int64_t i, BasicDecimal128* out) {
+    if (kChecked && (left.RescaleOverflows(i) || right.RescaleOverflows(i))) {
+      ctx->SetStatus(Status::Invalid("Decimal overflow"));
+      return false;
+    }
+    const BasicDecimal128 u = left.Value(i);
+    const BasicDecimal128 v = right.Value(i);
+    *out = Op::Call(u, v);
+    if (kChecked &&
+        (Op::Overflows(u, v, *out) || !out->FitsInPrecision(out_type.precision()))) {
+      ctx->SetStatus(Status::Invalid("Decimal overflow"));
+      return false;
+    }
+    return true;
+  }
+};
+
+template <typename Op, bool kChecked>
+void AddDecimalBinaryKernels(ScalarFunction* func) {
+  OutputType out_type(ResolveDecimalBinaryOutput<Op>);
+  InputType in_type(Type::DECIMAL);
+  ScalarKernel kernel({in_type, in_type}, out_type,
+                      DecimalBinaryArithmetic<Op, kChecked>::Exec);
+  DCHECK_OK(func->AddKernel(std::move(kernel)));
+}
+
+// Add the SIMD variants of the kernels supported by the CPU
+void AddSimdVariants(ScalarFunction* func) {
+  auto cpu_info = arrow::internal::CpuInfo::GetInstance();
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
+    AddArithmeticAvx2Kernels(func);
+  }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX512)) {
+    AddArithmeticAvx512Kernels(func);
+  }
+#endif
+  ARROW_UNUSED(cpu_info);
+}
+
 const FunctionDoc add_doc{"Add the arguments element-wise",
                           ("Results will wrap around on integer overflow.\n"
                            "Use function \"add_checked\" if you want overflow\n"
@@ -343,23 +483,30 @@ const FunctionDoc div_checked_doc{
 void RegisterScalarArithmetic(FunctionRegistry* registry) {
   // ----------------------------------------------------------------------
   auto add = MakeArithmeticFunction<Add>("add", &add_doc);
+  AddSimdVariants(add.get());
+  AddDecimalBinaryKernels<DecimalAdd, /*kChecked=*/false>(add.get());
   DCHECK_OK(registry->AddFunction(std::move(add)));
 
   // ----------------------------------------------------------------------
   auto add_checked =
       MakeArithmeticFunctionNotNull<AddChecked>("add_checked", &add_checked_doc);
+  AddSimdVariants(add_checked.get());
+  AddDecimalBinaryKernels<DecimalAdd, /*kChecked=*/true>(add_checked.get());
   DCHECK_OK(registry->AddFunction(std::move(add_checked)));
 
   // ----------------------------------------------------------------------
   // subtract
   auto subtract = MakeArithmeticFunction<Subtract>("subtract", &sub_doc);
+  AddSimdVariants(subtract.get());
+  AddDecimalBinaryKernels<DecimalSubtract, /*kChecked=*/false>(subtract.get());
 
   // Add subtract(timestamp, timestamp) -> duration
   for (auto unit : AllTimeUnits()) {
     InputType in_type(match::TimestampTypeUnit(unit));
     auto exec =
         NumericEqualTypesBinary<ScalarBinaryEqualTypes, Subtract>(Type::TIMESTAMP);
-    DCHECK_OK(subtract->AddKernel({in_type, in_type}, duration(unit), std::move(exec)));
+    DCHECK_OK(AddSelectionVectorKernel(subtract.get(), {in_type, in_type},
+                                       duration(unit), std::move(exec)));
   }
 
   DCHECK_OK(registry->AddFunction(std::move(subtract)));
@@ -367,15 +514,21 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
   // ----------------------------------------------------------------------
   auto subtract_checked = MakeArithmeticFunctionNotNull<SubtractChecked>(
       "subtract_checked", &sub_checked_doc);
+  AddSimdVariants(subtract_checked.get());
+  AddDecimalBinaryKernels<DecimalSubtract, /*kChecked=*/true>(subtract_checked.get());
   DCHECK_OK(registry->AddFunction(std::move(subtract_checked)));
 
   // ----------------------------------------------------------------------
   auto multiply = MakeArithmeticFunction<Multiply>("multiply", &mul_doc);
+  AddSimdVariants(multiply.get());
+  AddDecimalBinaryKernels<DecimalMultiply, /*kChecked=*/false>(multiply.get());
   DCHECK_OK(registry->AddFunction(std::move(multiply)));
 
   // ----------------------------------------------------------------------
   auto multiply_checked = MakeArithmeticFunctionNotNull<MultiplyChecked>(
       "multiply_checked", &mul_checked_doc);
+  AddSimdVariants(multiply_checked.get());
+  AddDecimalBinaryKernels<DecimalMultiply, /*kChecked=*/true>(multiply_checked.get());
   DCHECK_OK(registry->AddFunction(std::move(multiply_checked)));
 
   // ----------------------------------------------------------------------
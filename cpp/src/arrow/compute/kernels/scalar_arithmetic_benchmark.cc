@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/cast.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -106,6 +107,31 @@ static void ArrayArrayKernel(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * array_size);
 }
 
+// Execute the kernels of the given SIMD level, rather than the ones
+// preferred for the CPU
+static void ArrayArraySimdKernel(benchmark::State& state, const char* func_name,
+                                 std::shared_ptr<DataType> type,
+                                 SimdLevel::type simd_level) {
+  RegressionArgs args(state);
+  auto func = ScalarFunctionAtSimdLevel(func_name, simd_level);
+  if (func->num_kernels() == 0) {
+    state.SkipWithError("SIMD level not supported");
+    return;
+  }
+
+  // Choose values so as to avoid overflow on all ops and types
+  const int64_t array_size =
+      args.size / checked_cast<const FixedWidthType&>(*type).bit_width() * 8;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto lhs = Cast(*rand.Int8(array_size, 8, 14, args.null_proportion), type).ValueOrDie();
+  auto rhs = Cast(*rand.Int8(array_size, 1, 7, args.null_proportion), type).ValueOrDie();
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(func->Execute({lhs, rhs}, nullptr, nullptr).status());
+  }
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
 void SetArgs(benchmark::internal::Benchmark* bench) {
   for (const auto size : {kL1Size, kL2Size}) {
     for (const auto inverse_null_proportion : std::vector<ArgsType>({100, 0})) {
@@ -139,6 +165,16 @@ void SetArgs(benchmark::internal::Benchmark* bench) {
   BENCHMARK_TEMPLATE(BENCHMARK, OP, UInt16Type)->Apply(SetArgs); \
   BENCHMARK_TEMPLATE(BENCHMARK, OP, UInt8Type)->Apply(SetArgs);
 
+#define DECLARE_ARITHMETIC_SIMD_BENCHMARK(FUNC, TYPE, LEVEL)                       \
+  BENCHMARK_CAPTURE(ArrayArraySimdKernel, FUNC##_##TYPE##_##LEVEL, #FUNC, TYPE(), \
+                    SimdLevel::LEVEL)                                             \
+      ->Apply(SetArgs)
+
+#define DECLARE_ARITHMETIC_SIMD_BENCHMARKS(FUNC, TYPE) \
+  DECLARE_ARITHMETIC_SIMD_BENCHMARK(FUNC, TYPE, NONE); \
+  DECLARE_ARITHMETIC_SIMD_BENCHMARK(FUNC, TYPE, AVX2); \
+  DECLARE_ARITHMETIC_SIMD_BENCHMARK(FUNC, TYPE, AVX512)
+
 DECLARE_ARITHMETIC_BENCHMARKS(ArrayArrayKernel, Add);
 DECLARE_ARITHMETIC_BENCHMARKS(ArrayScalarKernel, Add);
 DECLARE_ARITHMETIC_BENCHMARKS(ArrayArrayKernel, Subtract);
@@ -157,5 +193,21 @@ DECLARE_ARITHMETIC_CHECKED_BENCHMARKS(ArrayScalarKernel, MultiplyChecked);
 DECLARE_ARITHMETIC_CHECKED_BENCHMARKS(ArrayArrayKernel, DivideChecked);
 DECLARE_ARITHMETIC_CHECKED_BENCHMARKS(ArrayScalarKernel, DivideChecked);
 
+DECLARE_ARITHMETIC_SIMD_BENCHMARKS(add, int32);
+DECLARE_ARITHMETIC_SIMD_BENCHMARKS(add, int64);
+DECLARE_ARITHMETIC_SIMD_BENCHMARKS(add, float64);
+DECLARE_ARITHMETIC_SIMD_BENCHMARKS(add_checked, int32);
+DECLARE_ARITHMETIC_SIMD_BENCHMARKS(add_checked, int64);
+DECLARE_ARITHMETIC_SIMD_BENCHMARKS(subtract, int32);
+DECLARE_ARITHMETIC_SIMD_BENCHMARKS(subtract, int64);
+DECLARE_ARITHMETIC_SIMD_BENCHMARKS(subtract, float64);
+DECLARE_ARITHMETIC_SIMD_BENCHMARKS(subtract_checked, int32);
+DECLARE_ARITHMETIC_SIMD_BENCHMARKS(subtract_checked, int64);
+DECLARE_ARITHMETIC_SIMD_BENCHMARKS(multiply, int32);
+DECLARE_ARITHMETIC_SIMD_BENCHMARKS(multiply, int64);
+DECLARE_ARITHMETIC_SIMD_BENCHMARKS(multiply, float64);
+DECLARE_ARITHMETIC_SIMD_BENCHMARKS(multiply_checked, int32);
+DECLARE_ARITHMETIC_SIMD_BENCHMARKS(multiply_checked, int64);
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,329 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/bit_block_counter.h"
+#include "arrow/util/int_util_internal.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+template <typename T>
+using is_unsigned_integer = std::integral_constant<bool, std::is_integral<T>::value &&
+                                                             std::is_unsigned<T>::value>;
+
+template <typename T>
+using is_signed_integer =
+    std::integral_constant<bool, std::is_integral<T>::value && std::is_signed<T>::value>;
+
+template <typename T, typename R = T>
+using enable_if_signed_integer = enable_if_t<is_signed_integer<T>::value, R>;
+
+template <typename T, typename R = T>
+using enable_if_unsigned_integer = enable_if_t<is_unsigned_integer<T>::value, R>;
+
+template <typename T, typename R = T>
+using enable_if_integer =
+    enable_if_t<is_signed_integer<T>::value || is_unsigned_integer<T>::value, R>;
+
+template <typename T, typename R = T>
+using enable_if_floating_point = enable_if_t<std::is_floating_point<T>::value, R>;
+
+template <typename T, typename Unsigned = typename std::make_unsigned<T>::type>
+constexpr Unsigned to_unsigned(T signed_) {
+  return static_cast<Unsigned>(signed_);
+}
+
+// The Overflows() functions below tell whether an integer operation overflowed
+// given its wrapped-around result. Unlike AddWithOverflow() and friends, they
+// are branch-free so that the loops calling them can be vectorized.
+
+struct Add {
+  template <typename T>
+  static constexpr enable_if_floating_point<T> Call(KernelContext*, T left, T right) {
+    return left + right;
+  }
+
+  template <typename T>
+  static constexpr enable_if_unsigned_integer<T> Call(KernelContext*, T left, T right) {
+    return left + right;
+  }
+
+  template <typename T>
+  static constexpr enable_if_signed_integer<T> Call(KernelContext*, T left, T right) {
+    return arrow::internal::SafeSignedAdd(left, right);
+  }
+
+  template <typename T>
+  static constexpr enable_if_unsigned_integer<T, bool> Overflows(T left, T, T result) {
+    return result < left;
+  }
+
+  template <typename T>
+  static constexpr enable_if_signed_integer<T, bool> Overflows(T left, T right,
+                                                               T result) {
+    // The result has a different sign than both arguments
+    return ((left ^ result) & (right ^ result)) < 0;
+  }
+};
+
+struct Subtract {
+  template <typename T>
+  static constexpr enable_if_floating_point<T> Call(KernelContext*, T left, T right) {
+    return left - right;
+  }
+
+  template <typename T>
+  static constexpr enable_if_unsigned_integer<T> Call(KernelContext*, T left, T right) {
+    return left - right;
+  }
+
+  template <typename T>
+  static constexpr enable_if_signed_integer<T> Call(KernelContext*, T left, T right) {
+    return arrow::internal::SafeSignedSubtract(left, right);
+  }
+
+  template <typename T>
+  static constexpr enable_if_unsigned_integer<T, bool> Overflows(T left, T right, T) {
+    return left < right;
+  }
+
+  template <typename T>
+  static constexpr enable_if_signed_integer<T, bool> Overflows(T left, T right,
+                                                               T result) {
+    // The arguments have different signs, and the result the sign of the right one
+    return ((left ^ right) & (left ^ result)) < 0;
+  }
+};
+
+struct Multiply {
+  static_assert(std::is_same<decltype(int8_t() * int8_t()), int32_t>::value, "");
+  static_assert(std::is_same<decltype(uint8_t() * uint8_t()), int32_t>::value, "");
+  static_assert(std::is_same<decltype(int16_t() * int16_t()), int32_t>::value, "");
+  static_assert(std::is_same<decltype(uint16_t() * uint16_t()), int32_t>::value, "");
+  static_assert(std::is_same<decltype(int32_t() * int32_t()), int32_t>::value, "");
+  static_assert(std::is_same<decltype(uint32_t() * uint32_t()), uint32_t>::value, "");
+  static_assert(std::is_same<decltype(int64_t() * int64_t()), int64_t>::value, "");
+  static_assert(std::is_same<decltype(uint64_t() * uint64_t()), uint64_t>::value, "");
+
+  template <typename T>
+  static constexpr enable_if_floating_point<T> Call(KernelContext*, T left, T right) {
+    return left * right;
+  }
+
+  template <typename T>
+  static constexpr enable_if_unsigned_integer<T> Call(KernelContext*, T left, T right) {
+    return left * right;
+  }
+
+  template <typename T>
+  static constexpr enable_if_signed_integer<T> Call(KernelContext*, T left, T right) {
+    return to_unsigned(left) * to_unsigned(right);
+  }
+
+  // Multiplication of 16 bit integer types implicitly promotes to signed 32 bit
+  // integer. However, some inputs may nevertheless overflow (which triggers undefined
+  // behaviour). Therefore we first cast to 32 bit unsigned integers where overflow is
+  // well defined.
+  template <typename T = void>
+  static constexpr int16_t Call(KernelContext*, int16_t left, int16_t right) {
+    return static_cast<uint32_t>(left) * static_cast<uint32_t>(right);
+  }
+  template <typename T = void>
+  static constexpr uint16_t Call(KernelContext*, uint16_t left, uint16_t right) {
+    return static_cast<uint32_t>(left) * static_cast<uint32_t>(right);
+  }
+
+  // Integers narrower than 64 bits are multiplied exactly as 64 bit integers
+  template <typename T>
+  static constexpr enable_if_t<is_signed_integer<T>::value && (sizeof(T) < 8), bool>
+  Overflows(T left, T right, T result) {
+    return static_cast<int64_t>(left) * static_cast<int64_t>(right) !=
+           static_cast<int64_t>(result);
+  }
+
+  template <typename T>
+  static constexpr enable_if_t<is_unsigned_integer<T>::value && (sizeof(T) < 8), bool>
+  Overflows(T left, T right, T result) {
+    return static_cast<uint64_t>(left) * static_cast<uint64_t>(right) !=
+           static_cast<uint64_t>(result);
+  }
+
+  template <typename T>
+  static enable_if_t<std::is_integral<T>::value && sizeof(T) == 8, bool> Overflows(
+      T left, T right, T) {
+    T result;
+    return arrow::internal::MultiplyWithOverflow(left, right, &result);
+  }
+};
+
+// ----------------------------------------------------------------------
+// Kernels for add, subtract and multiply compiled for a given SIMD level
+//
+// These are plain loops over the values, with branch-free overflow checks,
+// which the compiler vectorizes according to the instruction set of the
+// translation unit instantiating them (see scalar_arithmetic_avx2.cc and
+// scalar_arithmetic_avx512.cc). The kSimdLevel template parameter keeps the
+// instantiations for different SIMD levels apart.
+
+template <typename Type, typename Op, SimdLevel::type kSimdLevel>
+struct ArithmeticSimd {
+  using T = typename Type::c_type;
+
+  template <typename Left, typename Right>
+  static void Compute(Left left, Right right, int64_t length, T* out) {
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = Op::template Call(nullptr, left[i], right[i]);
+    }
+  }
+
+  template <typename Left, typename Right>
+  static void ExecValues(KernelContext*, Left left, Right right, ArrayData* out) {
+    Compute(left, right, out->length, out->GetMutableValues<T>(1));
+  }
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    ExecSimdBinary<ArithmeticSimd, Type, kSimdLevel>(ctx, batch, out);
+  }
+};
+
+// Like ArithmeticSimd, but raising an error if an integer operation overflows.
+// Only the non-null slots of the preallocated output are checked.
+template <typename Type, typename Op, SimdLevel::type kSimdLevel>
+struct ArithmeticCheckedSimd {
+  using T = typename Type::c_type;
+
+  // Return whether any of the operations overflowed
+  template <typename Left, typename Right>
+  static bool Compute(Left left, Right right, int64_t length, T* out) {
+    // Accumulate into an integer of the same width as the values, so that the
+    // loop gets vectorized
+    typename std::make_unsigned<T>::type overflow = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      const T result = Op::template Call(nullptr, left[i], right[i]);
+      overflow |= Op::Overflows(left[i], right[i], result);
+      out[i] = result;
+    }
+    return overflow != 0;
+  }
+
+  template <typename Left, typename Right>
+  static void ExecValues(KernelContext* ctx, Left left, Right right, ArrayData* out) {
+    T* out_values = out->GetMutableValues<T>(1);
+    const uint8_t* validity =
+        out->buffers[0] != nullptr ? out->buffers[0]->data() : nullptr;
+    ::arrow::internal::OptionalBitBlockCounter counter(validity, out->offset,
+                                                       out->length);
+    bool overflow = false;
+    int64_t position = 0;
+    while (position < out->length) {
+      const auto block = counter.NextBlock();
+      if (block.AllSet()) {
+        overflow |= Compute(SliceSimdValues(left, position),
+                            SliceSimdValues(right, position), block.length,
+                            out_values + position);
+      } else if (block.NoneSet()) {
+        std::memset(out_values + position, 0, block.length * sizeof(T));
+      } else {
+        for (int64_t i = position; i < position + block.length; ++i) {
+          const T result = Op::template Call(nullptr, left[i], right[i]);
+          overflow |= BitUtil::GetBit(validity, out->offset + i) &&
+                      Op::Overflows(left[i], right[i], result);
+          out_values[i] = result;
+        }
+      }
+      position += block.length;
+    }
+    if (ARROW_PREDICT_FALSE(overflow)) {
+      ctx->SetStatus(Status::Invalid("overflow"));
+    }
+  }
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    ExecSimdBinary<ArithmeticCheckedSimd, Type, kSimdLevel>(ctx, batch, out);
+  }
+};
+
+template <template <typename, typename, SimdLevel::type> class Kernel, typename Op,
+          SimdLevel::type kSimdLevel>
+SimdKernelExec GetArithmeticSimdExec(Type::type id) {
+  switch (id) {
+    case Type::INT8:
+      return Kernel<Int8Type, Op, kSimdLevel>::Exec;
+    case Type::UINT8:
+      return Kernel<UInt8Type, Op, kSimdLevel>::Exec;
+    case Type::INT16:
+      return Kernel<Int16Type, Op, kSimdLevel>::Exec;
+    case Type::UINT16:
+      return Kernel<UInt16Type, Op, kSimdLevel>::Exec;
+    case Type::INT32:
+      return Kernel<Int32Type, Op, kSimdLevel>::Exec;
+    case Type::UINT32:
+      return Kernel<UInt32Type, Op, kSimdLevel>::Exec;
+    case Type::INT64:
+      return Kernel<Int64Type, Op, kSimdLevel>::Exec;
+    case Type::UINT64:
+      return Kernel<UInt64Type, Op, kSimdLevel>::Exec;
+    // Floating-point operations don't overflow, the checked variants are the same
+    case Type::FLOAT:
+      return ArithmeticSimd<FloatType, Op, kSimdLevel>::Exec;
+    case Type::DOUBLE:
+      return ArithmeticSimd<DoubleType, Op, kSimdLevel>::Exec;
+    default:
+      return nullptr;
+  }
+}
+
+// Add the kernels for the given SIMD level to one of the add, subtract and
+// multiply functions or their checked variants
+template <SimdLevel::type kSimdLevel>
+void AddArithmeticSimdKernels(ScalarFunction* func) {
+  const std::string& name = func->name();
+  if (name == "add") {
+    AddSimdKernels(func, kSimdLevel,
+                   GetArithmeticSimdExec<ArithmeticSimd, Add, kSimdLevel>);
+  } else if (name == "add_checked") {
+    AddSimdKernels(func, kSimdLevel,
+                   GetArithmeticSimdExec<ArithmeticCheckedSimd, Add, kSimdLevel>);
+  } else if (name == "subtract") {
+    AddSimdKernels(func, kSimdLevel,
+                   GetArithmeticSimdExec<ArithmeticSimd, Subtract, kSimdLevel>);
+  } else if (name == "subtract_checked") {
+    AddSimdKernels(func, kSimdLevel,
+                   GetArithmeticSimdExec<ArithmeticCheckedSimd, Subtract, kSimdLevel>);
+  } else if (name == "multiply") {
+    AddSimdKernels(func, kSimdLevel,
+                   GetArithmeticSimdExec<ArithmeticSimd, Multiply, kSimdLevel>);
+  } else if (name == "multiply_checked") {
+    AddSimdKernels(func, kSimdLevel,
+                   GetArithmeticSimdExec<ArithmeticCheckedSimd, Multiply, kSimdLevel>);
+  }
+}
+
+// SIMD variants for kernels
+void AddArithmeticAvx2Kernels(ScalarFunction* func);
+void AddArithmeticAvx512Kernels(ScalarFunction* func);
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -25,6 +26,7 @@
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/chunked_array.h"
 #include "arrow/compute/api.h"
 #include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/compute/kernels/test_util.h"
@@ -637,5 +639,257 @@ TYPED_TEST(TestBinaryArithmeticFloating, Mul) {
   this->AssertBinop(Multiply, "[null, 2.0]", this->MakeNullScalar(), "[null, null]");
 }
 
+// Nulls are handled a block of validity bits at a time: check inputs whose
+// blocks are all null, all valid or mixed, at various offsets. The null slots
+// hold values that would overflow.
+TEST(TestBinaryArithmetic, NullBlocks) {
+  const int64_t length = 64 * 10 + 5;
+  auto left_valid = [](int64_t i) {
+    return (i >= 128 && i < 256) || (i >= 256 && i < 320 && i % 3 != 0) || i >= 384;
+  };
+  auto right_valid = [](int64_t i) { return i < 448 || i >= 512 || i % 2 == 0; };
+
+  Int32Builder left_builder, right_builder;
+  for (int64_t i = 0; i < length; ++i) {
+    const auto value = static_cast<int32_t>(i);
+    ASSERT_OK(left_builder.Append(left_valid(i) ? value
+                                                : std::numeric_limits<int32_t>::max()));
+    ASSERT_OK(right_builder.Append(value));
+  }
+  ASSERT_OK_AND_ASSIGN(auto left, left_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto right, right_builder.Finish());
+  // Set the validity bitmaps after the values, so that the null slots keep them
+  auto with_validity = [&](const std::shared_ptr<Array>& values,
+                           bool (*is_valid)(int64_t)) -> std::shared_ptr<Array> {
+    auto data = values->data()->Copy();
+    data->buffers[0] = *AllocateEmptyBitmap(length);
+    for (int64_t i = 0; i < length; ++i) {
+      BitUtil::SetBitTo(data->buffers[0]->mutable_data(), i, is_valid(i));
+    }
+    data->null_count = kUnknownNullCount;
+    return MakeArray(data);
+  };
+  left = with_validity(left, left_valid);
+  right = with_validity(right, right_valid);
+
+  for (int64_t offset : {0, 1, 63, 64, 129}) {
+    SCOPED_TRACE("offset = " + std::to_string(offset));
+    auto left_slice = left->Slice(offset);
+    auto right_slice = right->Slice(offset);
+    Int32Builder sum_builder;
+    BooleanBuilder greater_builder;
+    for (int64_t i = offset; i < length; ++i) {
+      if (left_valid(i) && right_valid(i)) {
+        ASSERT_OK(sum_builder.Append(static_cast<int32_t>(2 * i)));
+        ASSERT_OK(greater_builder.Append(false));
+      } else {
+        ASSERT_OK(sum_builder.AppendNull());
+        ASSERT_OK(greater_builder.AppendNull());
+      }
+    }
+    ASSERT_OK_AND_ASSIGN(auto expected_sum, sum_builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto expected_greater, greater_builder.Finish());
+
+    for (std::string func_name : {"add", "add_checked"}) {
+      SCOPED_TRACE(func_name);
+      ASSERT_OK_AND_ASSIGN(Datum out, CallFunction(func_name, {left_slice, right_slice}));
+      ASSERT_OK(out.make_array()->ValidateFull());
+      AssertArraysEqual(*expected_sum, *out.make_array(), /*verbose=*/true);
+    }
+    ASSERT_OK_AND_ASSIGN(Datum out, CallFunction("greater", {left_slice, right_slice}));
+    ASSERT_OK(out.make_array()->ValidateFull());
+    AssertArraysEqual(*expected_greater, *out.make_array(), /*verbose=*/true);
+
+    // Against a scalar, only the array's nulls matter
+    ASSERT_OK_AND_ASSIGN(out, CallFunction("add_checked", {left_slice,
+                                                           MakeScalar(int32_t(1))}));
+    ASSERT_OK(out.make_array()->ValidateFull());
+    ASSERT_EQ(out.make_array()->null_count(), left_slice->null_count());
+  }
+}
+
+void CheckDecimalArithmetic(const std::string& func_name, const Datum& left,
+                            const Datum& right, const Datum& expected) {
+  ASSERT_OK_AND_ASSIGN(Datum out, CallFunction(func_name, {left, right}));
+  if (out.is_array()) {
+    ASSERT_OK(out.make_array()->ValidateFull());
+  }
+  AssertDatumsEqual(expected, out, /*verbose=*/true);
+}
+
+std::shared_ptr<Scalar> DecimalScalarFromString(const std::shared_ptr<DataType>& type,
+                                                const std::string& value) {
+  return std::make_shared<Decimal128Scalar>(Decimal128(value), type);
+}
+
+TEST(TestBinaryArithmeticDecimal, AddSubtract) {
+  auto left = ArrayFromJSON(decimal(10, 2), R"(["1.25", "-3.10", null, "0.00"])");
+  auto right = ArrayFromJSON(decimal(5, 3), R"(["0.125", "1.000", "2.000", null])");
+  for (std::string suffix : {"", "_checked"}) {
+    SCOPED_TRACE(suffix);
+    CheckDecimalArithmetic(
+        "add" + suffix, left, right,
+        ArrayFromJSON(decimal(12, 3), R"(["1.375", "-2.100", null, null])"));
+    CheckDecimalArithmetic(
+        "subtract" + suffix, left, right,
+        ArrayFromJSON(decimal(12, 3), R"(["1.125", "-4.100", null, null])"));
+    CheckDecimalArithmetic(
+        "subtract" + suffix, right, left,
+        ArrayFromJSON(decimal(12, 3), R"(["-1.125", "4.100", null, null])"));
+  }
+}
+
+TEST(TestBinaryArithmeticDecimal, Multiply) {
+  auto left = ArrayFromJSON(decimal(5, 2), R"(["1.25", "-2.00", null, "999.99"])");
+  auto right = ArrayFromJSON(decimal(4, 1), R"(["2.0", "0.5", "1.0", "-999.9"])");
+  for (std::string func_name : {"multiply", "multiply_checked"}) {
+    SCOPED_TRACE(func_name);
+    CheckDecimalArithmetic(
+        func_name, left, right,
+        ArrayFromJSON(decimal(10, 3), R"(["2.500", "-1.000", null, "-999890.001"])"));
+  }
+  auto empty = ArrayFromJSON(decimal(38, 20), "[]");
+  ASSERT_RAISES(Invalid, CallFunction("multiply", {empty, empty}));
+}
+
+TEST(TestBinaryArithmeticDecimal, Scalars) {
+  auto left = ArrayFromJSON(decimal(6, 2), R"(["1.25", null, "-0.01"])");
+  auto right = DecimalScalarFromString(decimal(3, 0), "100");
+  CheckDecimalArithmetic("add", left, right,
+                         ArrayFromJSON(decimal(7, 2), R"(["101.25", null, "99.99"])"));
+  CheckDecimalArithmetic("subtract", right, left,
+                         ArrayFromJSON(decimal(7, 2), R"(["98.75", null, "100.01"])"));
+  CheckDecimalArithmetic("multiply_checked", left, right,
+                         ArrayFromJSON(decimal(10, 2), R"(["125.00", null, "-1.00"])"));
+  CheckDecimalArithmetic("add", DecimalScalarFromString(decimal(6, 2), "1.25"), right,
+                         DecimalScalarFromString(decimal(7, 2), "101.25"));
+  CheckDecimalArithmetic("add", MakeNullScalar(decimal(6, 2)), right,
+                         MakeNullScalar(decimal(7, 2)));
+}
+
+// Operands of at most 18 digits are computed on int64_t until that overflows
+TEST(TestBinaryArithmeticDecimal, WidenOnOverflow) {
+  auto max18 = ArrayFromJSON(
+      decimal(18, 0), R"(["999999999999999999", "-999999999999999999", "1", null])");
+  CheckDecimalArithmetic("add_checked", max18, max18,
+                         ArrayFromJSON(decimal(19, 0),
+                                       R"(["1999999999999999998", "-1999999999999999998",
+                                           "2", null])"));
+  CheckDecimalArithmetic("subtract_checked", max18, ArrayFromJSON(decimal(18, 0),
+                         R"(["-999999999999999999", "999999999999999999", "0", "0"])"),
+                         ArrayFromJSON(decimal(19, 0),
+                                       R"(["1999999999999999998", "-1999999999999999998",
+                                           "1", null])"));
+  CheckDecimalArithmetic(
+      "multiply_checked", max18, max18,
+      ArrayFromJSON(decimal(37, 0),
+                    R"(["999999999999999998000000000000000001",
+                        "999999999999999998000000000000000001", "1", null])"));
+
+  // Rescaled operands can also overflow int64_t
+  auto scaled = ArrayFromJSON(decimal(17, 0), R"(["99999999999999999", "1"])");
+  auto other = ArrayFromJSON(decimal(2, 1), R"(["0.1", "0.1"])");
+  CheckDecimalArithmetic(
+      "add", scaled, other,
+      ArrayFromJSON(decimal(19, 1), R"(["99999999999999999.1", "1.1"])"));
+}
+
+TEST(TestBinaryArithmeticDecimal, LargePrecision) {
+  auto left = ArrayFromJSON(
+      decimal(38, 2), R"(["999999999999999999999999999999999999.99", "-1.01", null])");
+  auto right = ArrayFromJSON(decimal(38, 2),
+                             R"(["-0.99", "12345678901234567890.12",
+                                 "999999999999999999999999999999999999.99"])");
+  CheckDecimalArithmetic(
+      "add_checked", left, right,
+      ArrayFromJSON(decimal(38, 2), R"(["999999999999999999999999999999999999.00",
+                                        "12345678901234567889.11", null])"));
+
+  // The result precision is capped at 38 digits
+  auto one_cent = ArrayFromJSON(decimal(38, 2), R"(["0.01", "0.00", "0.00"])");
+  ASSERT_RAISES(Invalid, CallFunction("add_checked", {left, one_cent}));
+  ASSERT_OK(CallFunction("add", {left, one_cent}));
+  ASSERT_RAISES(Invalid, CallFunction("multiply_checked", {left, left}));
+  // Null slots don't overflow
+  ASSERT_OK(CallFunction("add_checked", {left->Slice(1), right->Slice(1)}));
+}
+
+template <typename T>
+class TestBinaryArithmeticSimd : public ::testing::Test {
+ protected:
+  using CType = typename T::c_type;
+
+  void CheckSimdLevels(const std::vector<Datum>& args) {
+    for (std::string func_name : {"add", "add_checked", "subtract", "subtract_checked",
+                                  "multiply", "multiply_checked"}) {
+      SCOPED_TRACE(func_name);
+      CheckScalarSimdLevels(func_name, args);
+    }
+  }
+
+  std::shared_ptr<Array> RandomArray(int64_t length, CType min, CType max,
+                                     double null_probability) {
+    return rng_.Numeric<T>(length, min, max, null_probability);
+  }
+
+  random::RandomArrayGenerator rng_{0x5EED};
+};
+
+TYPED_TEST_SUITE(TestBinaryArithmeticSimd, NumericArrowTypes);
+
+TYPED_TEST(TestBinaryArithmeticSimd, MatchesDefaultKernels) {
+  using CType = typename TestFixture::CType;
+  const auto min = std::numeric_limits<CType>::lowest();
+  const auto max = std::numeric_limits<CType>::max();
+  for (double null_probability : {0.0, 0.1, 0.9}) {
+    SCOPED_TRACE(null_probability);
+    // Small values don't overflow
+    auto left = this->RandomArray(1000, 0, 10, null_probability);
+    auto right = this->RandomArray(1000, 0, 10, null_probability);
+    this->CheckSimdLevels({left, right});
+    this->CheckSimdLevels({left->Slice(3), right->Slice(5, 995)});
+    ASSERT_OK_AND_ASSIGN(auto scalar, right->GetScalar(1));
+    this->CheckSimdLevels({left, scalar});
+    this->CheckSimdLevels({scalar, left->Slice(7)});
+    this->CheckSimdLevels({left, MakeNullScalar(left->type())});
+    // Output slices starting in the middle of a byte
+    auto chunked = std::make_shared<ChunkedArray>(
+        ArrayVector{left->Slice(0, 13), left->Slice(13, 100), left->Slice(113)});
+    this->CheckSimdLevels({chunked, scalar});
+
+    // Large integers overflow (while floating-point values would give NaNs,
+    // which don't compare equal)
+    if (std::is_integral<CType>::value) {
+      left = this->RandomArray(1000, min, max, null_probability);
+      right = this->RandomArray(1000, min, max, null_probability);
+      this->CheckSimdLevels({left, right});
+    }
+  }
+}
+
+TYPED_TEST(TestBinaryArithmeticSimd, OverflowInNullSlots) {
+  using CType = typename TestFixture::CType;
+  const auto max = std::numeric_limits<CType>::max();
+  // The values overflow in the odd slots, which are null
+  std::vector<CType> values;
+  for (int i = 0; i < 200; ++i) {
+    values.push_back(i % 2 == 0 ? 0 : max);
+  }
+  std::shared_ptr<Array> right;
+  ArrayFromVector<TypeParam>(values, &right);
+  auto left_data = right->data()->Copy();
+  ASSERT_OK_AND_ASSIGN(left_data->buffers[0], AllocateEmptyBitmap(200));
+  for (int i = 0; i < 200; i += 2) {
+    BitUtil::SetBit(left_data->buffers[0]->mutable_data(), i);
+  }
+  left_data->null_count = 100;
+  auto left = MakeArray(left_data);
+  this->CheckSimdLevels({left, right});
+  this->CheckSimdLevels({left->Slice(2), right->Slice(2)});
+  ArithmeticOptions options;
+  options.check_overflow = true;
+  ASSERT_OK(Add(left, right, options).status());
+}
+
 }  // namespace compute
 }  // namespace arrow
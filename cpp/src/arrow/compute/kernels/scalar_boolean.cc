@@ -15,68 +15,84 @@
 // specific language governing permissions and limitations
 // under the License.
 
-#include <array>
+#include <cstdint>
 
 #include "arrow/compute/kernels/common.h"
 #include "arrow/util/bit_util.h"
-#include "arrow/util/bitmap.h"
 #include "arrow/util/bitmap_ops.h"
+#include "arrow/util/bitmap_reader.h"
+#include "arrow/util/bitmap_writer.h"
 
 namespace arrow {
-
-using internal::Bitmap;
-
 namespace compute {
 
 namespace {
 
-enum BitmapIndex { LEFT_VALID, LEFT_DATA, RIGHT_VALID, RIGHT_DATA };
-
 template <typename ComputeWord>
 void ComputeKleene(ComputeWord&& compute_word, KernelContext* ctx, const ArrayData& left,
                    const ArrayData& right, ArrayData* out) {
   DCHECK(left.null_count != 0 || right.null_count != 0);
+  using ::arrow::internal::BitmapWordReader;
+  using ::arrow::internal::BitmapWordWriter;
+
+  // The validity bitmap of an input without nulls may be absent: its data bitmap
+  // is read in its place, and the words read from it are replaced with all ones
+  const bool left_all_valid = left.GetNullCount() == 0;
+  const bool right_all_valid = right.GetNullCount() == 0;
+  const auto& left_valid_buffer = left_all_valid ? left.buffers[1] : left.buffers[0];
+  const auto& right_valid_buffer = right_all_valid ? right.buffers[1] : right.buffers[0];
+
+  const int64_t length = out->length;
+  BitmapWordReader<uint64_t> left_valid_reader(left_valid_buffer->data(), left.offset,
+                                               length);
+  BitmapWordReader<uint64_t> left_data_reader(left.buffers[1]->data(), left.offset,
+                                              length);
+  BitmapWordReader<uint64_t> right_valid_reader(right_valid_buffer->data(),
+                                                right.offset, length);
+  BitmapWordReader<uint64_t> right_data_reader(right.buffers[1]->data(), right.offset,
+                                               length);
+  BitmapWordWriter<uint64_t> out_valid_writer(out->buffers[0]->mutable_data(),
+                                              out->offset, length);
+  BitmapWordWriter<uint64_t> out_data_writer(out->buffers[1]->mutable_data(),
+                                             out->offset, length);
 
-  Bitmap bitmaps[4];
-  bitmaps[LEFT_VALID] = {left.buffers[0], left.offset, left.length};
-  bitmaps[LEFT_DATA] = {left.buffers[1], left.offset, left.length};
-
-  bitmaps[RIGHT_VALID] = {right.buffers[0], right.offset, right.length};
-  bitmaps[RIGHT_DATA] = {right.buffers[1], right.offset, right.length};
-
-  auto out_validity = out->GetMutableValues<uint64_t>(0);
-  auto out_data = out->GetMutableValues<uint64_t>(1);
-
-  int64_t i = 0;
   auto apply = [&](uint64_t left_valid, uint64_t left_data, uint64_t right_valid,
-                   uint64_t right_data) {
+                   uint64_t right_data, uint64_t* out_valid, uint64_t* out_data) {
+    if (left_all_valid) left_valid = ~uint64_t(0);
+    if (right_all_valid) right_valid = ~uint64_t(0);
+
     auto left_true = left_valid & left_data;
     auto left_false = left_valid & ~left_data;
 
     auto right_true = right_valid & right_data;
     auto right_false = right_valid & ~right_data;
 
-    compute_word(left_true, left_false, right_true, right_false, &out_validity[i],
-                 &out_data[i]);
-    ++i;
+    compute_word(left_true, left_false, right_true, right_false, out_valid, out_data);
   };
 
-  if (right.null_count == 0 || left.null_count == 0) {
-    if (left.null_count == 0) {
-      // ensure only bitmaps[RIGHT_VALID].buffer might be null
-      std::swap(bitmaps[LEFT_VALID], bitmaps[RIGHT_VALID]);
-      std::swap(bitmaps[LEFT_DATA], bitmaps[RIGHT_DATA]);
-    }
-    // override bitmaps[RIGHT_VALID] to make it safe for Visit()
-    bitmaps[RIGHT_VALID] = bitmaps[RIGHT_DATA];
-
-    Bitmap::VisitWords(bitmaps, [&](std::array<uint64_t, 4> words) {
-      apply(words[LEFT_VALID], words[LEFT_DATA], ~uint64_t(0), words[RIGHT_DATA]);
-    });
-  } else {
-    Bitmap::VisitWords(bitmaps, [&](std::array<uint64_t, 4> words) {
-      apply(words[LEFT_VALID], words[LEFT_DATA], words[RIGHT_VALID], words[RIGHT_DATA]);
-    });
+  // Whole words, whatever the bit offsets of the inputs and the output
+  int64_t nwords = left_data_reader.words();
+  while (nwords--) {
+    uint64_t out_valid, out_data;
+    apply(left_valid_reader.NextWord(), left_data_reader.NextWord(),
+          right_valid_reader.NextWord(), right_data_reader.NextWord(), &out_valid,
+          &out_data);
+    out_valid_writer.PutNextWord(out_valid);
+    out_data_writer.PutNextWord(out_data);
+  }
+
+  // Trailing bits, a byte at a time
+  int nbytes = left_data_reader.trailing_bytes();
+  while (nbytes--) {
+    int valid_bits;
+    const uint8_t left_valid = left_valid_reader.NextTrailingByte(valid_bits);
+    const uint8_t left_data = left_data_reader.NextTrailingByte(valid_bits);
+    const uint8_t right_valid = right_valid_reader.NextTrailingByte(valid_bits);
+    const uint8_t right_data = right_data_reader.NextTrailingByte(valid_bits);
+    uint64_t out_valid, out_data;
+    apply(left_valid, left_data, right_valid, right_data, &out_valid, &out_data);
+    out_valid_writer.PutNextTrailingByte(static_cast<uint8_t>(out_valid), valid_bits);
+    out_data_writer.PutNextTrailingByte(static_cast<uint8_t>(out_data), valid_bits);
   }
 }
 
@@ -156,10 +172,60 @@ struct Xor {
   }
 };
 
+// Per-value operators, for computing the rows picked by a selection vector
+
+struct InvertOp {
+  template <typename OutValue, typename Arg0Value>
+  static OutValue Call(KernelContext*, Arg0Value val) {
+    return !val;
+  }
+};
+
+struct AndOp {
+  template <typename T>
+  static T Call(KernelContext*, T left, T right) {
+    return left && right;
+  }
+};
+
+struct OrOp {
+  template <typename T>
+  static T Call(KernelContext*, T left, T right) {
+    return left || right;
+  }
+};
+
+struct XorOp {
+  template <typename T>
+  static T Call(KernelContext*, T left, T right) {
+    return left != right;
+  }
+};
+
+template <typename Op, typename SelectedOp>
+void ExecUnary(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  if (batch.selection_vector) {
+    return internal::applicator::ScalarUnary<BooleanType, BooleanType, SelectedOp>::Exec(
+        ctx, batch, out);
+  }
+  return internal::applicator::SimpleUnary<Op>(ctx, batch, out);
+}
+
+template <typename Op, typename SelectedOp>
+void ExecBinary(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  if (batch.selection_vector) {
+    using internal::applicator::ScalarBinaryEqualTypes;
+    return ScalarBinaryEqualTypes<BooleanType, BooleanType, SelectedOp>::Exec(ctx, batch,
+                                                                              out);
+  }
+  return internal::applicator::SimpleBinary<Op>(ctx, batch, out);
+}
+
 void MakeFunction(std::string name, int arity, ArrayKernelExec exec,
                   const FunctionDoc* doc, FunctionRegistry* registry,
                   bool can_write_into_slices = true,
-                  NullHandling::type null_handling = NullHandling::INTERSECTION) {
+                  NullHandling::type null_handling = NullHandling::INTERSECTION,
+                  bool can_use_selection_vector = false) {
   auto func = std::make_shared<ScalarFunction>(name, Arity(arity), doc);
 
   // Scalar arguments not yet supported
@@ -167,6 +233,7 @@ void MakeFunction(std::string name, int arity, ArrayKernelExec exec,
   ScalarKernel kernel(std::move(in_types), boolean(), exec);
   kernel.null_handling = null_handling;
   kernel.can_write_into_slices = can_write_into_slices;
+  kernel.can_use_selection_vector = can_use_selection_vector;
 
   DCHECK_OK(func->AddKernel(kernel));
   DCHECK_OK(registry->AddFunction(std::move(func)));
@@ -224,19 +291,28 @@ const FunctionDoc or_kleene_doc{
 namespace internal {
 
 void RegisterScalarBoolean(FunctionRegistry* registry) {
-  // These functions can write into sliced output bitmaps
-  MakeFunction("invert", 1, applicator::SimpleUnary<Invert>, &invert_doc, registry);
-  MakeFunction("and", 2, applicator::SimpleBinary<And>, &and_doc, registry);
-  MakeFunction("or", 2, applicator::SimpleBinary<Or>, &or_doc, registry);
-  MakeFunction("xor", 2, applicator::SimpleBinary<Xor>, &xor_doc, registry);
-
-  // The Kleene logic kernels cannot write into sliced output bitmaps
+  // These functions can write into sliced output bitmaps, and can compute the
+  // rows picked by a selection vector
+  MakeFunction("invert", 1, ExecUnary<Invert, InvertOp>, &invert_doc, registry,
+               /*can_write_into_slices=*/true, NullHandling::INTERSECTION,
+               /*can_use_selection_vector=*/true);
+  MakeFunction("and", 2, ExecBinary<And, AndOp>, &and_doc, registry,
+               /*can_write_into_slices=*/true, NullHandling::INTERSECTION,
+               /*can_use_selection_vector=*/true);
+  MakeFunction("or", 2, ExecBinary<Or, OrOp>, &or_doc, registry,
+               /*can_write_into_slices=*/true, NullHandling::INTERSECTION,
+               /*can_use_selection_vector=*/true);
+  MakeFunction("xor", 2, ExecBinary<Xor, XorOp>, &xor_doc, registry,
+               /*can_write_into_slices=*/true, NullHandling::INTERSECTION,
+               /*can_use_selection_vector=*/true);
+
+  // The Kleene logic kernels compute their own output validity
   MakeFunction("and_kleene", 2, applicator::SimpleBinary<KleeneAnd>, &and_kleene_doc,
                registry,
-               /*can_write_into_slices=*/false, NullHandling::COMPUTED_PREALLOCATE);
+               /*can_write_into_slices=*/true, NullHandling::COMPUTED_PREALLOCATE);
   MakeFunction("or_kleene", 2, applicator::SimpleBinary<KleeneOr>, &or_kleene_doc,
                registry,
-               /*can_write_into_slices=*/false, NullHandling::COMPUTED_PREALLOCATE);
+               /*can_write_into_slices=*/true, NullHandling::COMPUTED_PREALLOCATE);
 }
 
 }  // namespace internal
@@ -22,11 +22,13 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 
 namespace arrow {
 namespace compute {
@@ -208,5 +210,34 @@ TEST_F(TestBooleanKernel, KleeneOr) {
   TestBinaryKernel(KleeneOr, left, right, expected);
 }
 
+TEST_F(TestBooleanKernel, KleeneUnalignedOffsets) {
+  // Inputs and outputs at bit offsets which differ modulo the word size
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  const int64_t length = 1000;
+  auto left = rand.Boolean(length + 100, /*true_probability=*/0.5,
+                           /*null_probability=*/0.2);
+  auto right = rand.Boolean(length + 100, /*true_probability=*/0.5,
+                            /*null_probability=*/0.2);
+  auto right_no_nulls = rand.Boolean(length + 100, /*true_probability=*/0.5,
+                                     /*null_probability=*/0);
+
+  for (const auto& kernel : std::vector<BinaryKernelFunc>{KleeneAnd, KleeneOr}) {
+    for (const int64_t left_offset : {0, 3, 64, 67}) {
+      for (const int64_t right_offset : {0, 5, 13}) {
+        for (const auto& right_values : {right, right_no_nulls}) {
+          auto sliced_left = left->Slice(left_offset, length);
+          auto sliced_right = right_values->Slice(right_offset, length);
+          // Compute the expected result from inputs with a zero offset
+          ASSERT_OK_AND_ASSIGN(auto aligned_left, Concatenate({sliced_left}));
+          ASSERT_OK_AND_ASSIGN(auto aligned_right, Concatenate({sliced_right}));
+          ASSERT_OK_AND_ASSIGN(Datum expected,
+                               kernel(aligned_left, aligned_right, &ctx_));
+          TestArrayBinary(kernel, sliced_left, sliced_right, expected.make_array());
+        }
+      }
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
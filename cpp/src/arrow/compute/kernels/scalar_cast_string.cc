@@ -31,6 +31,7 @@ namespace arrow {
 using internal::StringFormatter;
 using util::InitializeUTF8;
 using util::ValidateUTF8;
+using util::ValidateUTF8Offsets;
 
 namespace compute {
 namespace internal {
@@ -98,12 +99,19 @@ struct BinaryToStringSameWidthCastFunctor {
       InitializeUTF8();
       const ArrayData& input = *batch[0].array();
 
-      ArrayDataVisitor<I> visitor;
-      Utf8Validator validator;
-      Status st = visitor.Visit(input, &validator);
-      if (!st.ok()) {
-        ctx->SetStatus(st);
-        return;
+      // Validate all values at once if possible, otherwise one by one,
+      // skipping nulls
+      if (input.length > 0 &&
+          !ValidateUTF8Offsets(input.GetValues<uint8_t>(2, /*absolute_offset=*/0),
+                               input.GetValues<typename I::offset_type>(1),
+                               input.length)) {
+        ArrayDataVisitor<I> visitor;
+        Utf8Validator validator;
+        Status st = visitor.Visit(input, &validator);
+        if (!st.ok()) {
+          ctx->SetStatus(st);
+          return;
+        }
       }
     }
     // It's OK to call this because base binary types do not preallocate
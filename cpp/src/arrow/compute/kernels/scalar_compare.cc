@@ -16,6 +16,8 @@
 // under the License.
 
 #include "arrow/compute/kernels/common.h"
+#include "arrow/compute/kernels/scalar_compare_internal.h"
+#include "arrow/util/cpu_info.h"
 
 namespace arrow {
 
@@ -28,48 +30,20 @@ namespace internal {
 
 namespace {
 
-struct Equal {
-  template <typename T>
-  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
-    return left == right;
-  }
-};
-
-struct NotEqual {
-  template <typename T>
-  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
-    return left != right;
-  }
-};
-
-struct Greater {
-  template <typename T>
-  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
-    return left > right;
-  }
-};
-
-struct GreaterEqual {
-  template <typename T>
-  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
-    return left >= right;
-  }
-};
-
 // Implement Less, LessEqual by flipping arguments to Greater, GreaterEqual
 
 template <typename Op>
 void AddIntegerCompare(const std::shared_ptr<DataType>& ty, ScalarFunction* func) {
   auto exec =
       GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(*ty);
-  DCHECK_OK(func->AddKernel({ty, ty}, boolean(), std::move(exec)));
+  DCHECK_OK(AddSelectionVectorKernel(func, {ty, ty}, boolean(), std::move(exec)));
 }
 
 template <typename InType, typename Op>
 void AddGenericCompare(const std::shared_ptr<DataType>& ty, ScalarFunction* func) {
-  DCHECK_OK(
-      func->AddKernel({ty, ty}, boolean(),
-                      applicator::ScalarBinaryEqualTypes<BooleanType, InType, Op>::Exec));
+  DCHECK_OK(AddSelectionVectorKernel(
+      func, {ty, ty}, boolean(),
+      applicator::ScalarBinaryEqualTypes<BooleanType, InType, Op>::Exec));
 }
 
 template <typename Op>
@@ -77,8 +51,8 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name,
                                                     const FunctionDoc* doc) {
   auto func = std::make_shared<ScalarFunction>(name, Arity::Binary(), doc);
 
-  DCHECK_OK(func->AddKernel(
-      {boolean(), boolean()}, boolean(),
+  DCHECK_OK(AddSelectionVectorKernel(
+      func.get(), {boolean(), boolean()}, boolean(),
       applicator::ScalarBinary<BooleanType, BooleanType, BooleanType, Op>::Exec));
 
   for (const std::shared_ptr<DataType>& ty : IntTypes()) {
@@ -96,7 +70,8 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name,
     auto exec =
         GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
             int64());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
+    DCHECK_OK(AddSelectionVectorKernel(func.get(), {in_type, in_type}, boolean(),
+                                       std::move(exec)));
   }
 
   // Duration
@@ -105,7 +80,8 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name,
     auto exec =
         GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
             int64());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
+    DCHECK_OK(AddSelectionVectorKernel(func.get(), {in_type, in_type}, boolean(),
+                                       std::move(exec)));
   }
 
   // Time32 and Time64
@@ -114,21 +90,37 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name,
     auto exec =
         GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
             int32());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
+    DCHECK_OK(AddSelectionVectorKernel(func.get(), {in_type, in_type}, boolean(),
+                                       std::move(exec)));
   }
   for (auto unit : {TimeUnit::MICRO, TimeUnit::NANO}) {
     InputType in_type(match::Time64TypeUnit(unit));
     auto exec =
         GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
             int64());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
+    DCHECK_OK(AddSelectionVectorKernel(func.get(), {in_type, in_type}, boolean(),
+                                       std::move(exec)));
   }
 
   for (const std::shared_ptr<DataType>& ty : BaseBinaryTypes()) {
     auto exec =
         GenerateVarBinaryBase<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(*ty);
-    DCHECK_OK(func->AddKernel({ty, ty}, boolean(), std::move(exec)));
+    DCHECK_OK(AddSelectionVectorKernel(func.get(), {ty, ty}, boolean(), std::move(exec)));
+  }
+
+  // Add the SIMD variants of the kernels supported by the CPU
+  auto cpu_info = arrow::internal::CpuInfo::GetInstance();
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
+    AddCompareAvx2Kernels(func.get());
+  }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX512)) {
+    AddCompareAvx512Kernels(func.get());
   }
+#endif
+  ARROW_UNUSED(cpu_info);
 
   return func;
 }
@@ -0,0 +1,150 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "arrow/compute/kernels/common.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+struct Equal {
+  template <typename T>
+  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
+    return left == right;
+  }
+};
+
+struct NotEqual {
+  template <typename T>
+  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
+    return left != right;
+  }
+};
+
+struct Greater {
+  template <typename T>
+  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
+    return left > right;
+  }
+};
+
+struct GreaterEqual {
+  template <typename T>
+  static constexpr bool Call(KernelContext*, const T& left, const T& right) {
+    return left >= right;
+  }
+};
+
+// ----------------------------------------------------------------------
+// Comparison kernels compiled for a given SIMD level
+//
+// The comparisons are packed eight at a time into whole output bytes, in a
+// loop which the compiler vectorizes according to the instruction set of the
+// translation unit instantiating it (see scalar_compare_avx2.cc and
+// scalar_compare_avx512.cc).
+
+template <typename Type, typename Op, SimdLevel::type kSimdLevel>
+struct CompareSimd {
+  template <typename Left, typename Right>
+  static void ExecValues(KernelContext*, Left left, Right right, ArrayData* out) {
+    uint8_t* out_bitmap = out->buffers[1]->mutable_data();
+    const int64_t length = out->length;
+    int64_t i = 0;
+    // Write the leading bits one by one until the output is byte-aligned
+    for (; i < length && (out->offset + i) % 8 != 0; ++i) {
+      BitUtil::SetBitTo(out_bitmap, out->offset + i,
+                        Op::Call(nullptr, left[i], right[i]));
+    }
+    uint8_t* out_bytes = out_bitmap + (out->offset + i) / 8;
+    const int64_t num_bytes = (length - i) / 8;
+    const Left bytes_left = SliceSimdValues(left, i);
+    const Right bytes_right = SliceSimdValues(right, i);
+    for (int64_t byte_index = 0; byte_index < num_bytes; ++byte_index) {
+      uint8_t byte = 0;
+      for (int bit = 0; bit < 8; ++bit) {
+        const int64_t index = byte_index * 8 + bit;
+        byte |= static_cast<uint8_t>(
+            Op::Call(nullptr, bytes_left[index], bytes_right[index]) << bit);
+      }
+      out_bytes[byte_index] = byte;
+    }
+    for (i += num_bytes * 8; i < length; ++i) {
+      BitUtil::SetBitTo(out_bitmap, out->offset + i,
+                        Op::Call(nullptr, left[i], right[i]));
+    }
+  }
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    ExecSimdBinary<CompareSimd, Type, kSimdLevel>(ctx, batch, out);
+  }
+};
+
+template <typename Op, SimdLevel::type kSimdLevel>
+SimdKernelExec GetCompareSimdExec(Type::type id) {
+  switch (id) {
+    case Type::INT8:
+      return CompareSimd<Int8Type, Op, kSimdLevel>::Exec;
+    case Type::UINT8:
+      return CompareSimd<UInt8Type, Op, kSimdLevel>::Exec;
+    case Type::INT16:
+      return CompareSimd<Int16Type, Op, kSimdLevel>::Exec;
+    case Type::UINT16:
+      return CompareSimd<UInt16Type, Op, kSimdLevel>::Exec;
+    case Type::INT32:
+      return CompareSimd<Int32Type, Op, kSimdLevel>::Exec;
+    case Type::UINT32:
+      return CompareSimd<UInt32Type, Op, kSimdLevel>::Exec;
+    case Type::INT64:
+      return CompareSimd<Int64Type, Op, kSimdLevel>::Exec;
+    case Type::UINT64:
+      return CompareSimd<UInt64Type, Op, kSimdLevel>::Exec;
+    case Type::FLOAT:
+      return CompareSimd<FloatType, Op, kSimdLevel>::Exec;
+    case Type::DOUBLE:
+      return CompareSimd<DoubleType, Op, kSimdLevel>::Exec;
+    default:
+      return nullptr;
+  }
+}
+
+// Add the kernels for the given SIMD level to one of the equal, not_equal,
+// greater and greater_equal functions
+template <SimdLevel::type kSimdLevel>
+void AddCompareSimdKernels(ScalarFunction* func) {
+  const std::string& name = func->name();
+  if (name == "equal") {
+    AddSimdKernels(func, kSimdLevel, GetCompareSimdExec<Equal, kSimdLevel>);
+  } else if (name == "not_equal") {
+    AddSimdKernels(func, kSimdLevel, GetCompareSimdExec<NotEqual, kSimdLevel>);
+  } else if (name == "greater") {
+    AddSimdKernels(func, kSimdLevel, GetCompareSimdExec<Greater, kSimdLevel>);
+  } else if (name == "greater_equal") {
+    AddSimdKernels(func, kSimdLevel, GetCompareSimdExec<GreaterEqual, kSimdLevel>);
+  }
+}
+
+// SIMD variants for kernels
+void AddCompareAvx2Kernels(ScalarFunction* func);
+void AddCompareAvx512Kernels(ScalarFunction* func);
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -25,6 +25,7 @@
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/chunked_array.h"
 #include "arrow/compute/api.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/testing/gtest_common.h"
@@ -407,6 +408,27 @@ TEST(TestCompareKernel, PrimitiveRandomTests) {
   TestRandomPrimitiveCTypes<CompareRandomNumeric>();
 }
 
+TYPED_TEST(TestNumericCompareKernel, SimdLevels) {
+  auto rand = random::RandomArrayGenerator(0x5416447);
+  for (auto null_probability : {0.0, 0.1, 1.0}) {
+    auto left = rand.Numeric<TypeParam>(1000, 0, 20, null_probability);
+    auto right = rand.Numeric<TypeParam>(1000, 0, 20, null_probability);
+    ASSERT_OK_AND_ASSIGN(auto scalar, right->GetScalar(0));
+    // Output slices starting in the middle of a byte
+    auto chunked = std::make_shared<ChunkedArray>(
+        ArrayVector{left->Slice(0, 13), left->Slice(13, 100), left->Slice(113)});
+    for (std::string func_name :
+         {"equal", "not_equal", "greater", "greater_equal", "less", "less_equal"}) {
+      SCOPED_TRACE(func_name);
+      CheckScalarSimdLevels(func_name, {left, right});
+      CheckScalarSimdLevels(func_name, {left->Slice(3), right->Slice(5, 995)});
+      CheckScalarSimdLevels(func_name, {left, scalar});
+      CheckScalarSimdLevels(func_name, {scalar, left->Slice(7)});
+      CheckScalarSimdLevels(func_name, {chunked, scalar});
+    }
+  }
+}
+
 TYPED_TEST(TestNumericCompareKernel, SimpleCompareArrayArray) {
   /* Ensure that null scalar broadcast to all null results. */
   CompareOptions eq(CompareOperator::EQUAL);
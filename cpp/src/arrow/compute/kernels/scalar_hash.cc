@@ -0,0 +1,260 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/array/data.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/compute/kernels/scalar_hash_internal.h"
+#include "arrow/extension_type.h"
+#include "arrow/util/bit_block_counter.h"
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/hash_util.h"
+#include "arrow/util/hashing.h"
+
+namespace arrow {
+
+using internal::OptionalBitBlockCounter;
+
+namespace compute {
+namespace internal {
+
+namespace {
+
+// The hash of a null value, whatever its type
+constexpr uint64_t kNullHash = 0x5bd1e9955bd1e995ULL;
+
+template <typename T>
+using HashValuesFunc = void (*)(const T*, int64_t, bool, uint64_t*);
+
+// Pick the SIMD variant supported by the CPU
+template <typename T>
+HashValuesFunc<T> GetHashValuesFunc() {
+  static const HashValuesFunc<T> func = []() -> HashValuesFunc<T> {
+    auto cpu_info = arrow::internal::CpuInfo::GetInstance();
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+    if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX512)) {
+      return HashValuesAvx512<T>;
+    }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+    if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
+      return HashValuesAvx2<T>;
+    }
+#endif
+    ARROW_UNUSED(cpu_info);
+    return HashSimd<T, SimdLevel::NONE>::Exec;
+  }();
+  return func;
+}
+
+// Hashes of the values without a SIMD variant
+
+template <typename T>
+enable_if_t<std::is_integral<T>::value, uint64_t> HashValue(T value) {
+  return ::arrow::internal::ScalarHelper<T, 0>::ComputeHash(value);
+}
+
+// Fixed-width structured values, e.g. day-time intervals
+template <typename T>
+enable_if_t<std::is_class<T>::value && !std::is_same<T, util::string_view>::value,
+            uint64_t>
+HashValue(const T& value) {
+  return ::arrow::internal::ComputeStringHash<0>(&value, sizeof(T));
+}
+
+uint64_t HashValue(util::string_view value) {
+  return ::arrow::internal::ComputeStringHash<0>(value.data(),
+                                                 static_cast<int64_t>(value.size()));
+}
+
+// Whether the values of an Arrow type have a SIMD hashing variant
+template <typename Type, typename Enable = void>
+struct has_simd_hash : std::false_type {};
+
+template <typename Type>
+struct has_simd_hash<
+    Type, enable_if_t<has_c_type<Type>::value && !is_boolean_type<Type>::value>>
+    : std::is_arithmetic<typename Type::c_type> {};
+
+class ArrayHasher {
+ public:
+  ArrayHasher(const ArrayData& data, bool combine, uint64_t* out)
+      : data_(data), combine_(combine), out_(out) {}
+
+  Status Hash() { return VisitTypeInline(*data_.type, this); }
+
+  // Integer, floating point and temporal values are hashed by runs of valid
+  // values with the SIMD variants
+  template <typename Type>
+  enable_if_t<has_simd_hash<Type>::value, Status> Visit(const Type&) {
+    using T = typename Type::c_type;
+    const HashValuesFunc<T> hash_values = GetHashValuesFunc<T>();
+    const T* values = data_.GetValues<T>(1);
+    const uint8_t* validity = data_.MayHaveNulls() ? data_.buffers[0]->data() : nullptr;
+
+    OptionalBitBlockCounter counter(validity, data_.offset, data_.length);
+    int64_t position = 0;
+    while (position < data_.length) {
+      const auto block = counter.NextBlock();
+      if (block.AllSet()) {
+        hash_values(values + position, block.length, combine_, out_ + position);
+      } else if (block.NoneSet()) {
+        for (int64_t i = position; i < position + block.length; ++i) {
+          Update(out_ + i, kNullHash);
+        }
+      } else {
+        for (int64_t i = position; i < position + block.length; ++i) {
+          Update(out_ + i, BitUtil::GetBit(validity, data_.offset + i)
+                               ? HashSimd<T, SimdLevel::NONE>::HashValue(values[i])
+                               : kNullHash);
+        }
+      }
+      position += block.length;
+    }
+    return Status::OK();
+  }
+
+  template <typename Type>
+  enable_if_t<!has_simd_hash<Type>::value &&
+                  (has_c_type<Type>::value || is_base_binary_type<Type>::value ||
+                   is_fixed_size_binary_type<Type>::value),
+              Status>
+  Visit(const Type&) {
+    uint64_t* out = out_;
+    VisitArrayDataInline<Type>(
+        data_,
+        [&](typename GetViewType<Type>::PhysicalType value) {
+          Update(out++, HashValue(value));
+        },
+        [&]() { Update(out++, kNullHash); });
+    return Status::OK();
+  }
+
+  Status Visit(const NullType&) {
+    for (int64_t i = 0; i < data_.length; ++i) {
+      Update(out_ + i, kNullHash);
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryType& type) {
+    // Hash the dictionary values rather than the indices, so that the hashes
+    // don't depend on the dictionary of each array
+    std::vector<uint64_t> dict_hashes(data_.dictionary->length);
+    RETURN_NOT_OK(ArrayHasher(*data_.dictionary, false, dict_hashes.data()).Hash());
+    switch (type.index_type()->id()) {
+      case Type::INT8:
+        return VisitIndices<int8_t>(dict_hashes);
+      case Type::UINT8:
+        return VisitIndices<uint8_t>(dict_hashes);
+      case Type::INT16:
+        return VisitIndices<int16_t>(dict_hashes);
+      case Type::UINT16:
+        return VisitIndices<uint16_t>(dict_hashes);
+      case Type::INT32:
+        return VisitIndices<int32_t>(dict_hashes);
+      case Type::UINT32:
+        return VisitIndices<uint32_t>(dict_hashes);
+      case Type::INT64:
+        return VisitIndices<int64_t>(dict_hashes);
+      case Type::UINT64:
+        return VisitIndices<uint64_t>(dict_hashes);
+      default:
+        return Status::TypeError("Invalid dictionary index type: ", *type.index_type());
+    }
+  }
+
+  Status Visit(const ExtensionType& type) {
+    if (!type.ComputeOnStorage()) {
+      return Visit(static_cast<const DataType&>(type));
+    }
+    auto storage = data_.Copy();
+    storage->type = type.storage_type();
+    return ArrayHasher(*storage, combine_, out_).Hash();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::TypeError("Unsupported type for hashing: ", type);
+  }
+
+ private:
+  void Update(uint64_t* out, uint64_t hash) {
+    if (combine_) {
+      ::arrow::internal::detail::hash_combine_impl(*out, hash);
+    } else {
+      *out = hash;
+    }
+  }
+
+  template <typename IndexCType>
+  Status VisitIndices(const std::vector<uint64_t>& dict_hashes) {
+    const IndexCType* indices = data_.GetValues<IndexCType>(1);
+    const uint8_t* validity = data_.MayHaveNulls() ? data_.buffers[0]->data() : nullptr;
+    for (int64_t i = 0; i < data_.length; ++i) {
+      const bool valid =
+          validity == nullptr || BitUtil::GetBit(validity, data_.offset + i);
+      Update(out_ + i, valid ? dict_hashes[indices[i]] : kNullHash);
+    }
+    return Status::OK();
+  }
+
+  const ArrayData& data_;
+  const bool combine_;
+  uint64_t* out_;
+};
+
+void HashArrayExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  // Data is preallocated
+  uint64_t* hashes = out->mutable_array()->GetMutableValues<uint64_t>(1);
+  for (int i = 0; i < batch.num_values(); ++i) {
+    KERNEL_RETURN_IF_ERROR(ctx, HashArrayData(*batch[i].array(), i > 0, hashes));
+  }
+}
+
+const FunctionDoc hash_array_doc(
+    "Compute the hashes of the values of one or more arrays",
+    ("For each row of the input arrays, emit a uint64 hash of their values.\n"
+     "The hashes of multiple arrays are combined row by row.  Equal values\n"
+     "hash equally, including nulls, and whatever the chunking or dictionary\n"
+     "encoding of the input.  Hashes are not stable across Arrow versions."),
+    {"values"});
+
+}  // namespace
+
+Status HashArrayData(const ArrayData& data, bool combine, uint64_t* out) {
+  return ArrayHasher(data, combine, out).Hash();
+}
+
+void RegisterScalarHash(FunctionRegistry* registry) {
+  auto func = std::make_shared<ScalarFunction>("hash_array", Arity::VarArgs(1),
+                                               &hash_array_doc);
+  auto signature = KernelSignature::Make({InputType(ValueDescr::ARRAY)}, uint64(),
+                                         /*is_varargs=*/true);
+  ScalarKernel kernel(std::move(signature), HashArrayExec);
+  kernel.null_handling = NullHandling::OUTPUT_NOT_NULL;
+  kernel.mem_allocation = MemAllocation::PREALLOCATE;
+  kernel.can_write_into_slices = true;
+  DCHECK_OK(func->AddKernel(std::move(kernel)));
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
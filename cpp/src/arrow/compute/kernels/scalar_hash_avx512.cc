@@ -0,0 +1,42 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/scalar_hash_internal.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+template <typename T>
+void HashValuesAvx512(const T* values, int64_t length, bool combine, uint64_t* out) {
+  HashSimd<T, SimdLevel::AVX512>::Exec(values, length, combine, out);
+}
+
+template void HashValuesAvx512(const int8_t*, int64_t, bool, uint64_t*);
+template void HashValuesAvx512(const uint8_t*, int64_t, bool, uint64_t*);
+template void HashValuesAvx512(const int16_t*, int64_t, bool, uint64_t*);
+template void HashValuesAvx512(const uint16_t*, int64_t, bool, uint64_t*);
+template void HashValuesAvx512(const int32_t*, int64_t, bool, uint64_t*);
+template void HashValuesAvx512(const uint32_t*, int64_t, bool, uint64_t*);
+template void HashValuesAvx512(const int64_t*, int64_t, bool, uint64_t*);
+template void HashValuesAvx512(const uint64_t*, int64_t, bool, uint64_t*);
+template void HashValuesAvx512(const float*, int64_t, bool, uint64_t*);
+template void HashValuesAvx512(const double*, int64_t, bool, uint64_t*);
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
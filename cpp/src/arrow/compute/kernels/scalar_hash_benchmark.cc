@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+#include "arrow/compute/api_scalar.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/benchmark_util.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x94378165;
+
+static void HashArrayBenchmark(benchmark::State& state,
+                               const std::vector<Datum>& values) {
+  for (auto _ : state) {
+    ABORT_NOT_OK(HashArray(values).status());
+  }
+  state.SetItemsProcessed(state.iterations() * values[0].length());
+}
+
+static void HashArrayInt64(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int64(array_size, -100, 100, args.null_proportion);
+
+  HashArrayBenchmark(state, {values});
+}
+
+static void HashArrayFloat64(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(double);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Float64(array_size, -100, 100, args.null_proportion);
+
+  HashArrayBenchmark(state, {values});
+}
+
+static void HashArrayString(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / 16;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.String(array_size, 4, 28, args.null_proportion);
+
+  HashArrayBenchmark(state, {values});
+}
+
+static void HashArrayInt64String(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  // Combining the hashes of two key columns
+  const int64_t array_size = args.size / 24;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto ints = rand.Int64(array_size, -100, 100, args.null_proportion);
+  auto strings = rand.String(array_size, 4, 28, args.null_proportion);
+
+  HashArrayBenchmark(state, {ints, strings});
+}
+
+BENCHMARK(HashArrayInt64)->Apply(RegressionSetArgs);
+BENCHMARK(HashArrayFloat64)->Apply(RegressionSetArgs);
+BENCHMARK(HashArrayString)->Apply(RegressionSetArgs);
+BENCHMARK(HashArrayInt64String)->Apply(RegressionSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
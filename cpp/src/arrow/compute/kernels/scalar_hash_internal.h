@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+struct ArrayData;
+
+namespace compute {
+namespace internal {
+
+// Compute the hashes of the values of `data` into `out`, which must have room
+// for data.length hashes.  If `combine` is true, the hashes are combined into
+// those already in `out` rather than overwriting them, as when hashing the
+// key columns of a table one after the other.
+//
+// Equal values hash equally, whatever the layout of the array: nulls have a
+// fixed hash, floating point -0.0 and NaNs are canonicalized, and dictionary
+// arrays hash their decoded values.  Nested types are unsupported.
+ARROW_EXPORT
+Status HashArrayData(const ArrayData& data, bool combine, uint64_t* out);
+
+// ----------------------------------------------------------------------
+// Hashing of fixed-width values compiled for a given SIMD level
+//
+// Integers are multiplied by a prime and byte-swapped like
+// ScalarHelper<T>::ComputeHash does, in a loop which the compiler vectorizes
+// according to the instruction set of the translation unit instantiating it
+// (see scalar_hash_avx2.cc and scalar_hash_avx512.cc).  Floating point values
+// are hashed through their canonicalized bit representation.
+
+template <typename T, SimdLevel::type kSimdLevel>
+struct HashSimd {
+  static constexpr uint64_t kMultiplier = 11400714785074694791ULL;
+
+  template <typename U = T>
+  static enable_if_t<std::is_integral<U>::value, uint64_t> HashValue(U value) {
+    return BitUtil::ByteSwap(kMultiplier * static_cast<uint64_t>(value));
+  }
+
+  template <typename U = T>
+  static enable_if_t<std::is_floating_point<U>::value, uint64_t> HashValue(U value) {
+    using Bits = typename std::conditional<sizeof(U) == 4, uint32_t, uint64_t>::type;
+    // Equal values must hash equally: fold -0.0 into 0.0 and all NaNs into one
+    value = (value == 0) ? 0 : value;
+    value = (value != value) ? std::numeric_limits<U>::quiet_NaN() : value;
+    Bits bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return BitUtil::ByteSwap(kMultiplier * static_cast<uint64_t>(bits));
+  }
+
+  static void Exec(const T* values, int64_t length, bool combine, uint64_t* out) {
+    if (combine) {
+      for (int64_t i = 0; i < length; ++i) {
+        // As hash_combine_impl() in arrow/util/hash_util.h
+        out[i] ^= HashValue(values[i]) + 0x9e3779b9 + (out[i] << 6) + (out[i] >> 2);
+      }
+    } else {
+      for (int64_t i = 0; i < length; ++i) {
+        out[i] = HashValue(values[i]);
+      }
+    }
+  }
+};
+
+// SIMD variants, instantiated for all integer and floating point types
+template <typename T>
+void HashValuesAvx2(const T* values, int64_t length, bool combine, uint64_t* out);
+template <typename T>
+void HashValuesAvx512(const T* values, int64_t length, bool combine, uint64_t* out);
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
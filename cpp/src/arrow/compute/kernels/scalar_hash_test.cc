@@ -0,0 +1,155 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_pointer_cast;
+
+namespace compute {
+
+std::shared_ptr<UInt64Array> CheckHashArray(const std::vector<Datum>& values) {
+  EXPECT_OK_AND_ASSIGN(Datum result, HashArray(values));
+  auto hashes = checked_pointer_cast<UInt64Array>(result.make_array());
+  ARROW_EXPECT_OK(hashes->ValidateFull());
+  EXPECT_EQ(hashes->length(), values[0].length());
+  EXPECT_EQ(hashes->null_count(), 0);
+  return hashes;
+}
+
+// Check that rows `i` and `j` hash equally if and only if `equal` is true,
+// for each (i, j, equal) in `pairs`
+void CheckEqualHashes(const UInt64Array& hashes,
+                      const std::vector<std::tuple<int64_t, int64_t, bool>>& pairs) {
+  for (const auto& pair : pairs) {
+    const int64_t i = std::get<0>(pair), j = std::get<1>(pair);
+    if (std::get<2>(pair)) {
+      EXPECT_EQ(hashes.Value(i), hashes.Value(j)) << "rows " << i << " and " << j;
+    } else {
+      EXPECT_NE(hashes.Value(i), hashes.Value(j)) << "rows " << i << " and " << j;
+    }
+  }
+}
+
+TEST(HashArray, EqualValues) {
+  const std::vector<std::tuple<int64_t, int64_t, bool>> pairs = {
+      {0, 3, true}, {1, 4, true}, {2, 5, true}, {0, 1, false}, {0, 2, false}};
+  for (const auto& type : {int8(), uint16(), int32(), uint64(), float32(), float64(),
+                           date32(), timestamp(TimeUnit::NANO), boolean()}) {
+    SCOPED_TRACE(type->ToString());
+    auto hashes = CheckHashArray({ArrayFromJSON(type, "[1, 0, null, 1, 0, null]")});
+    CheckEqualHashes(*hashes, pairs);
+  }
+  for (const auto& type : {utf8(), large_binary(), fixed_size_binary(3)}) {
+    SCOPED_TRACE(type->ToString());
+    auto values = ArrayFromJSON(type, R"(["abc", "xyz", null, "abc", "xyz", null])");
+    auto hashes = CheckHashArray({values});
+    CheckEqualHashes(*hashes, pairs);
+  }
+  auto values =
+      ArrayFromJSON(decimal(12, 2), R"(["1.23", "-4.56", null, "1.23", "-4.56", null])");
+  auto hashes = CheckHashArray({values});
+  CheckEqualHashes(*hashes, pairs);
+}
+
+TEST(HashArray, FloatingPoint) {
+  auto hashes = CheckHashArray({ArrayFromJSON(float64(), "[0.0, -0.0, NaN, 1.5, NaN]")});
+  CheckEqualHashes(*hashes, {{0, 1, true}, {2, 4, true}, {0, 3, false}, {0, 2, false}});
+}
+
+TEST(HashArray, NullsOfAnyType) {
+  auto hashes = CheckHashArray({ArrayFromJSON(int64(), "[null]")});
+  for (const auto& type : {null(), utf8(), float32(), boolean()}) {
+    SCOPED_TRACE(type->ToString());
+    auto null_hashes = CheckHashArray({ArrayFromJSON(type, "[null]")});
+    ASSERT_EQ(null_hashes->Value(0), hashes->Value(0));
+  }
+}
+
+TEST(HashArray, ConsistentAcrossLayouts) {
+  // Slicing, chunking and dictionary encoding don't change hashes
+  auto values = ArrayFromJSON(utf8(), R"(["x", "y", null, "z", "x", "w", "y"])");
+  auto expected = CheckHashArray({values});
+
+  AssertArraysEqual(*expected->Slice(2), *CheckHashArray({values->Slice(2)}));
+
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, 2), values->Slice(2, 0), values->Slice(2)});
+  EXPECT_OK_AND_ASSIGN(Datum result, HashArray({chunked}));
+  ASSERT_EQ(result.kind(), Datum::CHUNKED_ARRAY);
+  AssertChunkedEquivalent(ChunkedArray(expected), *result.chunked_array());
+
+  ASSERT_OK_AND_ASSIGN(auto encoded, DictionaryEncode(values));
+  AssertArraysEqual(*expected, *CheckHashArray({encoded}));
+}
+
+TEST(HashArray, NullRuns) {
+  // Rows are hashed in runs of valid values, check that all rows hash as
+  // they do alone
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  for (const double null_probability : {0.0, 0.1, 0.9, 1.0}) {
+    SCOPED_TRACE("null_probability = " + std::to_string(null_probability));
+    for (const auto& values :
+         {rand.Int64(1000, -100, 100, null_probability),
+          rand.Float32(1000, -100, 100, null_probability)}) {
+      SCOPED_TRACE(values->type()->ToString());
+      auto hashes = CheckHashArray({values->Slice(3)});
+      for (int64_t i = 0; i < hashes->length(); ++i) {
+        ASSERT_EQ(hashes->Value(i), CheckHashArray({values->Slice(3 + i, 1)})->Value(0));
+      }
+    }
+  }
+}
+
+TEST(HashArray, MultipleArrays) {
+  auto ints = ArrayFromJSON(int32(), "[1, 1, 1, 2, null, null]");
+  auto strings = ArrayFromJSON(utf8(), R"(["a", "a", "b", "a", null, "a"])");
+  auto hashes = CheckHashArray({ints, strings});
+  CheckEqualHashes(*hashes, {{0, 1, true}, {0, 2, false}, {0, 3, false}, {4, 5, false}});
+
+  // Combining with a second array changes the hashes
+  auto int_hashes = CheckHashArray({ints});
+  ASSERT_NE(hashes->Value(0), int_hashes->Value(0));
+  // The order of the arrays matters
+  ASSERT_NE(hashes->Value(0), CheckHashArray({strings, ints})->Value(0));
+}
+
+TEST(HashArray, Errors) {
+  ASSERT_RAISES(Invalid, HashArray({}));
+  ASSERT_RAISES(TypeError, HashArray({ArrayFromJSON(list(int32()), "[[1], null]")}));
+  ASSERT_RAISES(Invalid, HashArray({ArrayFromJSON(int32(), "[1, 2]"),
+                                    ArrayFromJSON(int32(), "[1, 2, 3]")}));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -15,10 +15,16 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
 #include "arrow/array/array_base.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/common.h"
+#include "arrow/compute/kernels/scalar_set_lookup_internal.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_writer.h"
 #include "arrow/util/hashing.h"
@@ -29,18 +35,95 @@ namespace arrow {
 
 using internal::checked_cast;
 using internal::HashTraits;
+using internal::hash_t;
+using internal::ScalarHelper;
 
 namespace compute {
+namespace detail {
+
+Result<std::shared_ptr<KernelState>> SetLookupCache::GetOrMake(const Datum& value_set,
+                                                               bool skip_nulls,
+                                                               const MakeTable& make) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (table_ != nullptr) {
+    if (Matches(value_set, skip_nulls)) {
+      return table_;
+    }
+    // The options were modified since the table was built, keep the first table
+    // cached rather than rebuilding tables back and forth
+    return make();
+  }
+  ARROW_ASSIGN_OR_RAISE(table_, make());
+  value_set_ = value_set;
+  skip_nulls_ = skip_nulls;
+  return table_;
+}
+
+bool SetLookupCache::Matches(const Datum& value_set, bool skip_nulls) const {
+  if (skip_nulls != skip_nulls_ || value_set.kind() != value_set_.kind()) {
+    return false;
+  }
+  switch (value_set.kind()) {
+    case Datum::ARRAY:
+      return value_set.array() == value_set_.array();
+    case Datum::CHUNKED_ARRAY:
+      return value_set.chunked_array() == value_set_.chunked_array();
+    default:
+      return false;
+  }
+}
+
+}  // namespace detail
+
 namespace internal {
 namespace {
 
+// A blocked bloom filter over the hashes of a set of values, each value setting
+// four bits of a single 64-bit word so that a lookup touches a single cache line.
+// With 8 bits per value, around 3% of the values not in the set pass the filter.
+class BlockedBloomFilter {
+ public:
+  void Init(int64_t num_values) {
+    const int64_t num_words = BitUtil::NextPower2(std::max<int64_t>(num_values / 8, 1));
+    words_.assign(static_cast<size_t>(num_words), 0);
+    index_mask_ = static_cast<uint64_t>(num_words - 1);
+  }
+
+  bool empty() const { return words_.empty(); }
+
+  void Insert(hash_t h) { words_[Index(h)] |= Mask(h); }
+
+  bool MayContain(hash_t h) const {
+    const uint64_t mask = Mask(h);
+    return (words_[Index(h)] & mask) == mask;
+  }
+
+ private:
+  static uint64_t Mask(hash_t h) {
+    return (uint64_t(1) << (h & 63)) | (uint64_t(1) << ((h >> 6) & 63)) |
+           (uint64_t(1) << ((h >> 12) & 63)) | (uint64_t(1) << ((h >> 18) & 63));
+  }
+
+  size_t Index(hash_t h) const { return static_cast<size_t>((h >> 32) & index_mask_); }
+
+  std::vector<uint64_t> words_;
+  uint64_t index_mask_ = 0;
+};
+
+// Value sets with more distinct values than this are prefiltered with a bloom
+// filter, their hash table no longer fitting in the CPU caches
+constexpr int32_t kPrefilterMinSize = 1 << 16;
+
 template <typename Type>
 struct SetLookupState : public KernelState {
+  using T = typename GetViewType<Type>::T;
+  // Small integers and booleans are looked up in a direct-mapped table
+  static constexpr bool kCanPrefilter = !(std::is_integral<T>::value && sizeof(T) <= 2);
+
   explicit SetLookupState(MemoryPool* pool)
       : lookup_table(pool, 0), lookup_null_count(0) {}
 
   Status Init(const SetLookupOptions& options) {
-    using T = typename GetViewType<Type>::T;
     auto visit_valid = [&](T v) {
       int32_t unused_memo_index;
       return lookup_table.GetOrInsert(v, &unused_memo_index);
@@ -51,26 +134,47 @@ struct SetLookupState : public KernelState {
       }
       return Status::OK();
     };
-    if (options.value_set.kind() == Datum::ARRAY) {
-      const std::shared_ptr<ArrayData>& value_set = options.value_set.array();
-      this->lookup_null_count += value_set->GetNullCount();
-      return VisitArrayDataInline<Type>(*value_set, std::move(visit_valid),
-                                        std::move(visit_null));
-    } else {
-      const ChunkedArray& value_set = *options.value_set.chunked_array();
-      for (const std::shared_ptr<Array>& chunk : value_set.chunks()) {
-        this->lookup_null_count += chunk->null_count();
-        RETURN_NOT_OK(VisitArrayDataInline<Type>(*chunk->data(), std::move(visit_valid),
-                                                 std::move(visit_null)));
-      }
-      return Status::OK();
+    this->lookup_null_count = options.value_set.null_count();
+    RETURN_NOT_OK(VisitValueSet(options.value_set, visit_valid, visit_null));
+    if (kCanPrefilter && lookup_table.size() > kPrefilterMinSize) {
+      prefilter.Init(lookup_table.size());
+      auto prefilter_valid = [&](T v) {
+        prefilter.Insert(ScalarHelper<T, 1>::ComputeHash(v));
+        return Status::OK();
+      };
+      auto prefilter_null = [] { return Status::OK(); };
+      RETURN_NOT_OK(VisitValueSet(options.value_set, prefilter_valid, prefilter_null));
     }
+    return Status::OK();
+  }
+
+  // Return the memo index of `v` in the value set, or -1 if it isn't there
+  int32_t Lookup(T v) const {
+    if (kCanPrefilter && !prefilter.empty() &&
+        !prefilter.MayContain(ScalarHelper<T, 1>::ComputeHash(v))) {
+      return -1;
+    }
+    return lookup_table.Get(v);
   }
 
   using MemoTable = typename HashTraits<Type>::MemoTableType;
   MemoTable lookup_table;
   int64_t lookup_null_count;
   int64_t null_index = -1;
+  BlockedBloomFilter prefilter;
+
+ private:
+  template <typename VisitValid, typename VisitNull>
+  static Status VisitValueSet(const Datum& value_set, VisitValid&& visit_valid,
+                              VisitNull&& visit_null) {
+    if (value_set.kind() == Datum::ARRAY) {
+      return VisitArrayDataInline<Type>(*value_set.array(), visit_valid, visit_null);
+    }
+    for (const std::shared_ptr<Array>& chunk : value_set.chunked_array()->chunks()) {
+      RETURN_NOT_OK(VisitArrayDataInline<Type>(*chunk->data(), visit_valid, visit_null));
+    }
+    return Status::OK();
+  }
 };
 
 template <>
@@ -113,7 +217,7 @@ struct UnsignedIntType<8> {
 struct InitStateVisitor {
   KernelContext* ctx;
   const SetLookupOptions* options;
-  std::unique_ptr<KernelState> result;
+  std::shared_ptr<KernelState> result;
 
   InitStateVisitor(KernelContext* ctx, const SetLookupOptions* options)
       : ctx(ctx), options(options) {}
@@ -150,19 +254,48 @@ struct InitStateVisitor {
   // Handle Decimal128Type, FixedSizeBinaryType
   Status Visit(const FixedSizeBinaryType& type) { return Init<FixedSizeBinaryType>(); }
 
-  Status GetResult(std::unique_ptr<KernelState>* out) {
+  Status GetResult(std::shared_ptr<KernelState>* out) {
     RETURN_NOT_OK(VisitTypeInline(*options->value_set.type(), this));
     *out = std::move(result);
     return Status::OK();
   }
 };
 
+// The state of a set lookup kernel, referencing a lookup table shared with the
+// other kernels initialized with the same options
+struct SetLookupKernelState : public KernelState {
+  explicit SetLookupKernelState(std::shared_ptr<KernelState> table)
+      : table(std::move(table)) {}
+
+  std::shared_ptr<KernelState> table;
+};
+
+template <typename Type>
+const SetLookupState<Type>& GetSetLookupState(KernelContext* ctx) {
+  return checked_cast<const SetLookupState<Type>&>(
+      *checked_cast<const SetLookupKernelState&>(*ctx->state()).table);
+}
+
 std::unique_ptr<KernelState> InitSetLookup(KernelContext* ctx,
                                            const KernelInitArgs& args) {
-  InitStateVisitor visitor{ctx, static_cast<const SetLookupOptions*>(args.options)};
-  std::unique_ptr<KernelState> result;
-  ctx->SetStatus(visitor.GetResult(&result));
-  return result;
+  const auto* options = static_cast<const SetLookupOptions*>(args.options);
+  auto make_table = [&]() -> Result<std::shared_ptr<KernelState>> {
+    InitStateVisitor visitor{ctx, options};
+    std::shared_ptr<KernelState> table;
+    RETURN_NOT_OK(visitor.GetResult(&table));
+    return table;
+  };
+  Result<std::shared_ptr<KernelState>> maybe_table =
+      (options != nullptr && options->cache != nullptr)
+          ? options->cache->GetOrMake(options->value_set, options->skip_nulls,
+                                      make_table)
+          : make_table();
+  if (!maybe_table.ok()) {
+    ctx->SetStatus(maybe_table.status());
+    return nullptr;
+  }
+  return std::unique_ptr<KernelState>(
+      new SetLookupKernelState(maybe_table.MoveValueUnsafe()));
 }
 
 struct IndexInVisitor {
@@ -175,7 +308,7 @@ struct IndexInVisitor {
       : ctx(ctx), data(data), out(out), builder(ctx->exec_context()->memory_pool()) {}
 
   Status Visit(const DataType&) {
-    const auto& state = checked_cast<const SetLookupState<NullType>&>(*ctx->state());
+    const auto& state = GetSetLookupState<NullType>(ctx);
     if (data.length != 0) {
       if (state.lookup_null_count == 0) {
         RETURN_NOT_OK(this->builder.AppendNulls(data.length));
@@ -193,14 +326,14 @@ struct IndexInVisitor {
   Status ProcessIndexIn() {
     using T = typename GetViewType<Type>::T;
 
-    const auto& state = checked_cast<const SetLookupState<Type>&>(*ctx->state());
+    const auto& state = GetSetLookupState<Type>(ctx);
 
     int32_t null_index = state.lookup_table.GetNull();
     RETURN_NOT_OK(this->builder.Reserve(data.length));
     VisitArrayDataInline<Type>(
         data,
         [&](T v) {
-          int32_t index = state.lookup_table.Get(v);
+          int32_t index = state.Lookup(v);
           if (index != -1) {
             // matching needle; output index from value_set
             this->builder.UnsafeAppend(index);
@@ -288,7 +421,7 @@ struct IsInVisitor {
       : ctx(ctx), data(data), out(out) {}
 
   Status Visit(const DataType&) {
-    const auto& state = checked_cast<const SetLookupState<NullType>&>(*ctx->state());
+    const auto& state = GetSetLookupState<NullType>(ctx);
     ArrayData* output = out->mutable_array();
     if (state.lookup_null_count > 0) {
       BitUtil::SetBitsTo(output->buffers[0]->mutable_data(), output->offset,
@@ -305,7 +438,7 @@ struct IsInVisitor {
   template <typename Type>
   Status ProcessIsIn() {
     using T = typename GetViewType<Type>::T;
-    const auto& state = checked_cast<const SetLookupState<Type>&>(*ctx->state());
+    const auto& state = GetSetLookupState<Type>(ctx);
     ArrayData* output = out->mutable_array();
 
     if (this->data.GetNullCount() > 0 && state.lookup_null_count > 0) {
@@ -320,7 +453,7 @@ struct IsInVisitor {
     VisitArrayDataInline<Type>(
         this->data,
         [&](T v) {
-          if (state.lookup_table.Get(v) != -1) {
+          if (state.Lookup(v) != -1) {
             writer.Set();
           } else {
             writer.Clear();
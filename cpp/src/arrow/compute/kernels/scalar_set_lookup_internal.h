@@ -0,0 +1,63 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/datum.h"
+#include "arrow/result.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+namespace detail {
+
+// The lookup table of is_in and index_in, built from the value set of some
+// SetLookupOptions by the first kernel initialized with them and reused by the
+// kernels initialized with them or their copies afterwards, possibly from several
+// threads.  Lookup tables are immutable once built.
+//
+// The table is only reused for the value set (compared by identity) and the
+// skip_nulls it was built for: if the options are modified after their first use,
+// kernels build tables of their own.
+class ARROW_EXPORT SetLookupCache {
+ public:
+  using MakeTable = std::function<Result<std::shared_ptr<KernelState>>()>;
+
+  // Return the table built for the given value set and skip_nulls, calling `make`
+  // to build it if the cache is still empty or was built for other options.
+  Result<std::shared_ptr<KernelState>> GetOrMake(const Datum& value_set,
+                                                 bool skip_nulls,
+                                                 const MakeTable& make);
+
+ private:
+  bool Matches(const Datum& value_set, bool skip_nulls) const;
+
+  std::mutex mutex_;
+  // Held to keep the identity of the value set unique while the table is cached
+  Datum value_set_;
+  bool skip_nulls_ = false;
+  std::shared_ptr<KernelState> table_;
+};
+
+}  // namespace detail
+}  // namespace compute
+}  // namespace arrow
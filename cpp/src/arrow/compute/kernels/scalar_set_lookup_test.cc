@@ -24,6 +24,8 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -39,6 +41,7 @@
 #include "arrow/status.h"
 #include "arrow/testing/gtest_compat.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/decimal.h"
@@ -755,5 +758,126 @@ TEST_F(TestMatchKernel, MatchChunkedArrayInvoke) {
   AssertChunkedEquivalent(*expected_carr, *encoded_out.chunked_array());
 }
 
+// ----------------------------------------------------------------------
+// Set lookups reusing the lookup table of their options
+
+using arrow::internal::checked_cast;
+
+std::string LookupKey(int64_t value) { return std::to_string(value); }
+
+std::string LookupKey(util::string_view value) { return value.to_string(); }
+
+std::shared_ptr<Array> RandomLookupValues(random::RandomArrayGenerator* rng,
+                                          const Int64Type&, int64_t size,
+                                          double null_probability) {
+  return rng->Int64(size, 0, 4 * size, null_probability);
+}
+
+std::shared_ptr<Array> RandomLookupValues(random::RandomArrayGenerator* rng,
+                                          const StringType&, int64_t size,
+                                          double null_probability) {
+  return rng->String(size, 1, 4, null_probability);
+}
+
+template <typename Type>
+class TestSetLookupOptionsReuse : public ::testing::Test {
+ protected:
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+
+  std::shared_ptr<Array> RandomValues(int64_t size, double null_probability) {
+    return RandomLookupValues(&rng_, Type(), size, null_probability);
+  }
+
+  // Check is_in and index_in against the first indices of the distinct values of
+  // `value_set`, which has no nulls
+  void CheckLookups(const std::shared_ptr<Array>& values,
+                    const SetLookupOptions& options) {
+    auto value_set_array = options.value_set.make_array();
+    const auto& value_set = checked_cast<const ArrayType&>(*value_set_array);
+    std::unordered_map<std::string, int32_t> indices;
+    for (int64_t i = 0; i < value_set.length(); ++i) {
+      indices.emplace(LookupKey(value_set.GetView(i)),
+                      static_cast<int32_t>(indices.size()));
+    }
+
+    ASSERT_OK_AND_ASSIGN(Datum is_in, IsIn(values, options));
+    ASSERT_OK_AND_ASSIGN(Datum index_in, IndexIn(values, options));
+    ASSERT_OK(is_in.make_array()->ValidateFull());
+    ASSERT_OK(index_in.make_array()->ValidateFull());
+    const auto& typed_values = checked_cast<const ArrayType&>(*values);
+    const BooleanArray is_in_array(is_in.array());
+    const Int32Array index_in_array(index_in.array());
+    for (int64_t i = 0; i < values->length(); ++i) {
+      if (values->IsNull(i)) {
+        ASSERT_TRUE(is_in_array.IsNull(i));
+        ASSERT_TRUE(index_in_array.IsNull(i));
+        continue;
+      }
+      auto it = indices.find(LookupKey(typed_values.GetView(i)));
+      ASSERT_EQ(is_in_array.Value(i), it != indices.end()) << "at " << i;
+      if (it == indices.end()) {
+        ASSERT_TRUE(index_in_array.IsNull(i)) << "at " << i;
+      } else {
+        ASSERT_TRUE(index_in_array.IsValid(i)) << "at " << i;
+        ASSERT_EQ(index_in_array.Value(i), it->second) << "at " << i;
+      }
+    }
+  }
+
+  random::RandomArrayGenerator rng_{42};
+};
+
+using SetLookupReuseTypes = ::testing::Types<Int64Type, StringType>;
+
+TYPED_TEST_SUITE(TestSetLookupOptionsReuse, SetLookupReuseTypes);
+
+TYPED_TEST(TestSetLookupOptionsReuse, SmallValueSet) {
+  SetLookupOptions options(this->RandomValues(100, 0), /*skip_nulls=*/true);
+  for (int i = 0; i < 3; ++i) {
+    this->CheckLookups(this->RandomValues(1000, 0.1), options);
+  }
+}
+
+TYPED_TEST(TestSetLookupOptionsReuse, LargeValueSet) {
+  // Enough distinct values for the lookups to be prefiltered
+  SetLookupOptions options(this->RandomValues(100000, 0), /*skip_nulls=*/true);
+  for (int i = 0; i < 3; ++i) {
+    this->CheckLookups(this->RandomValues(10000, 0.1), options);
+  }
+}
+
+TYPED_TEST(TestSetLookupOptionsReuse, ModifiedOptions) {
+  SetLookupOptions options(this->RandomValues(1000, 0), /*skip_nulls=*/true);
+  auto values = this->RandomValues(1000, 0.1);
+  this->CheckLookups(values, options);
+
+  // Copies share the lookup table, unless modified
+  SetLookupOptions copy = options;
+  ASSERT_EQ(copy.cache, options.cache);
+  this->CheckLookups(values, copy);
+  copy.value_set = this->RandomValues(1000, 0);
+  this->CheckLookups(values, copy);
+  this->CheckLookups(values, options);
+}
+
+TEST(TestSetLookupConcurrency, SharedOptions) {
+  random::RandomArrayGenerator rng(42);
+  SetLookupOptions options(rng.Int64(100000, 0, 200000), /*skip_nulls=*/true);
+  auto values = rng.Int64(10000, 0, 400000, 0.1);
+  ASSERT_OK_AND_ASSIGN(Datum expected, IsIn(values, options.value_set));
+
+  std::vector<std::thread> threads;
+  std::vector<Datum> results(4);
+  for (size_t i = 0; i < results.size(); ++i) {
+    threads.emplace_back([&, i] { results[i] = IsIn(values, options).ValueOrDie(); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& result : results) {
+    AssertDatumsEqual(expected, result);
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -23,11 +23,19 @@
 #include <utf8proc.h>
 #endif
 
+#ifdef ARROW_WITH_RE2
+#include <re2/filtered_re2.h>
+#include <re2/re2.h>
+#endif
+
 #include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_nested.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/common.h"
+#include "arrow/util/aho_corasick.h"
+#include "arrow/util/simd.h"
+#include "arrow/util/ubsan.h"
 #include "arrow/util/utf8.h"
 #include "arrow/util/value_parsing.h"
 
@@ -37,30 +45,145 @@ namespace internal {
 
 namespace {
 
+template <typename T>
+static inline bool IsAsciiCharacter(T character) {
+  return character < 128;
+}
+
+struct BinaryLength {
+  template <typename OutValue, typename Arg0Value = util::string_view>
+  static OutValue Call(KernelContext*, Arg0Value val) {
+    return static_cast<OutValue>(val.size());
+  }
+};
+
+using TransformFunc = std::function<void(const uint8_t*, int64_t, uint8_t*)>;
+
+// Transform a buffer of offsets to one which begins with 0 and has same
+// value lengths.
+template <typename T>
+Status GetShiftedOffsets(KernelContext* ctx, const Buffer& input_buffer, int64_t offset,
+                         int64_t length, std::shared_ptr<Buffer>* out) {
+  ARROW_ASSIGN_OR_RAISE(*out, ctx->Allocate((length + 1) * sizeof(T)));
+  const T* input_offsets = reinterpret_cast<const T*>(input_buffer.data()) + offset;
+  T* out_offsets = reinterpret_cast<T*>((*out)->mutable_data());
+  T first_offset = *input_offsets;
+  for (int64_t i = 0; i < length; ++i) {
+    *out_offsets++ = input_offsets[i] - first_offset;
+  }
+  *out_offsets = input_offsets[length] - first_offset;
+  return Status::OK();
+}
+
+// Apply `transform` to input character data- this function cannot change the
+// length
+template <typename Type>
+void StringDataTransform(KernelContext* ctx, const ExecBatch& batch,
+                         TransformFunc transform, Datum* out) {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+  using offset_type = typename Type::offset_type;
+
+  if (batch[0].kind() == Datum::ARRAY) {
+    const ArrayData& input = *batch[0].array();
+    ArrayType input_boxed(batch[0].array());
+
+    ArrayData* out_arr = out->mutable_array();
+
+    if (input.offset == 0) {
+      // We can reuse offsets from input
+      out_arr->buffers[1] = input.buffers[1];
+    } else {
+      DCHECK(input.buffers[1]);
+      // We must allocate new space for the offsets and shift the existing offsets
+      KERNEL_RETURN_IF_ERROR(
+          ctx, GetShiftedOffsets<offset_type>(ctx, *input.buffers[1], input.offset,
+                                              input.length, &out_arr->buffers[1]));
+    }
+
+    // Allocate space for output data
+    int64_t data_nbytes = input_boxed.total_values_length();
+    KERNEL_RETURN_IF_ERROR(ctx, ctx->Allocate(data_nbytes).Value(&out_arr->buffers[2]));
+    if (input.length > 0) {
+      transform(input.buffers[2]->data() + input_boxed.value_offset(0), data_nbytes,
+                out_arr->buffers[2]->mutable_data());
+    }
+  } else {
+    const auto& input = checked_cast<const BaseBinaryScalar&>(*batch[0].scalar());
+    auto result = checked_pointer_cast<BaseBinaryScalar>(MakeNullScalar(out->type()));
+    if (input.is_valid) {
+      result->is_valid = true;
+      int64_t data_nbytes = input.value->size();
+      KERNEL_RETURN_IF_ERROR(ctx, ctx->Allocate(data_nbytes).Value(&result->value));
+      transform(input.value->data(), data_nbytes, result->value->mutable_data());
+    }
+    out->value = result;
+  }
+}
+
 // Code units in the range [a-z] can only be an encoding of an ascii
 // character/codepoint, not the 2nd, 3rd or 4th code unit (byte) of an different
 // codepoint. This guaranteed by non-overlap design of the unicode standard. (see
 // section 2.5 of Unicode Standard Core Specification v13.0)
+//
+// Flip the case of the ASCII letters in [kFirst, kLast], leaving all other code units
+// untouched, 16 bytes at a time where SIMD is available.
+template <uint8_t kFirst, uint8_t kLast>
+void TransformAsciiCase(const uint8_t* input, int64_t length, uint8_t* output) {
+#if defined(ARROW_HAVE_SSE4_2)
+  const __m128i before_first = _mm_set1_epi8(kFirst - 1);
+  const __m128i after_last = _mm_set1_epi8(kLast + 1);
+  const __m128i case_bit = _mm_set1_epi8(0x20);
+  for (; length >= 16; input += 16, output += 16, length -= 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+    // Non-ASCII code units are negative as signed bytes, hence never in range
+    const __m128i in_range = _mm_and_si128(_mm_cmpgt_epi8(block, before_first),
+                                           _mm_cmplt_epi8(block, after_last));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output),
+                     _mm_xor_si128(block, _mm_and_si128(in_range, case_bit)));
+  }
+#elif defined(ARROW_HAVE_NEON)
+  const uint8x16_t first = vdupq_n_u8(kFirst);
+  const uint8x16_t last = vdupq_n_u8(kLast);
+  const uint8x16_t case_bit = vdupq_n_u8(0x20);
+  for (; length >= 16; input += 16, output += 16, length -= 16) {
+    const uint8x16_t block = vld1q_u8(input);
+    const uint8x16_t in_range = vandq_u8(vcgeq_u8(block, first), vcleq_u8(block, last));
+    vst1q_u8(output, veorq_u8(block, vandq_u8(in_range, case_bit)));
+  }
+#endif
+  for (int64_t i = 0; i < length; ++i) {
+    output[i] = (input[i] >= kFirst && input[i] <= kLast) ? (input[i] ^ 0x20) : input[i];
+  }
+}
 
-static inline uint8_t ascii_tolower(uint8_t utf8_code_unit) {
-  return ((utf8_code_unit >= 'A') && (utf8_code_unit <= 'Z')) ? (utf8_code_unit + 32)
-                                                              : utf8_code_unit;
+// The end of the run of ASCII code units starting at `data`
+inline const uint8_t* SkipAscii(const uint8_t* data, const uint8_t* end) {
+  while (end - data >= 8 &&
+         (util::SafeLoadAs<uint64_t>(data) & 0x8080808080808080ULL) == 0) {
+    data += 8;
+  }
+  return std::find_if_not(data, end, IsAsciiCharacter<uint8_t>);
 }
 
-static inline uint8_t ascii_toupper(uint8_t utf8_code_unit) {
-  return ((utf8_code_unit >= 'a') && (utf8_code_unit <= 'z')) ? (utf8_code_unit - 32)
-                                                              : utf8_code_unit;
+void TransformAsciiUpper(const uint8_t* input, int64_t length, uint8_t* output) {
+  TransformAsciiCase<'a', 'z'>(input, length, output);
 }
 
-template <typename T>
-static inline bool IsAsciiCharacter(T character) {
-  return character < 128;
+template <typename Type>
+struct AsciiUpper {
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    StringDataTransform<Type>(ctx, batch, TransformAsciiUpper, out);
+  }
+};
+
+void TransformAsciiLower(const uint8_t* input, int64_t length, uint8_t* output) {
+  TransformAsciiCase<'A', 'Z'>(input, length, output);
 }
 
-struct BinaryLength {
-  template <typename OutValue, typename Arg0Value = util::string_view>
-  static OutValue Call(KernelContext*, Arg0Value val) {
-    return static_cast<OutValue>(val.size());
+template <typename Type>
+struct AsciiLower {
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    StringDataTransform<Type>(ctx, batch, TransformAsciiLower, out);
   }
 };
 
@@ -94,16 +217,43 @@ struct UTF8Transform {
   static bool Transform(const uint8_t* input, offset_type input_string_ncodeunits,
                         uint8_t* output, offset_type* output_written) {
     uint8_t* output_start = output;
-    if (ARROW_PREDICT_FALSE(
-            !arrow::util::UTF8Transform(input, input + input_string_ncodeunits, &output,
-                                        Derived::TransformCodepoint))) {
-      return false;
+    const uint8_t* end = input + input_string_ncodeunits;
+    while (input < end) {
+      // Runs of ASCII characters are transformed a block at a time, the multibyte
+      // characters in between (which have no ASCII code units) a codepoint at a time
+      const uint8_t* ascii_end = SkipAscii(input, end);
+      Derived::TransformAscii(input, ascii_end - input, output);
+      output += ascii_end - input;
+      input = std::find_if(ascii_end, end, IsAsciiCharacter<uint8_t>);
+      if (ARROW_PREDICT_FALSE(!arrow::util::UTF8Transform(ascii_end, input, &output,
+                                                          Derived::TransformCodepoint))) {
+        return false;
+      }
     }
     *output_written = static_cast<offset_type>(output - output_start);
     return true;
   }
 
+  // Whether the input is all ASCII, in which case the output has the same size and
+  // offsets as the input
+  static bool IsAsciiInput(const Datum& datum) {
+    if (datum.kind() == Datum::ARRAY) {
+      ArrayType input(datum.array());
+      const int64_t data_nbytes = input.total_values_length();
+      return data_nbytes > 0 &&
+             arrow::util::ValidateAscii(
+                 input.value_data()->data() + input.value_offset(0), data_nbytes);
+    }
+    const auto& input = checked_cast<const BaseBinaryScalar&>(*datum.scalar());
+    return input.is_valid && arrow::util::ValidateAscii(input.value->data(),
+                                                        input.value->size());
+  }
+
   static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    if (IsAsciiInput(batch[0])) {
+      StringDataTransform<Type>(ctx, batch, Derived::TransformAscii, out);
+      return;
+    }
     EnsureLookupTablesFilled();
     if (batch[0].kind() == Datum::ARRAY) {
       const ArrayData& input = *batch[0].array();
@@ -196,6 +346,10 @@ struct UTF8Upper : UTF8Transform<Type, UTF8Upper<Type>> {
     return codepoint <= kMaxCodepointLookup ? lut_upper_codepoint[codepoint]
                                             : utf8proc_toupper(codepoint);
   }
+
+  static void TransformAscii(const uint8_t* input, int64_t length, uint8_t* output) {
+    TransformAsciiUpper(input, length, output);
+  }
 };
 
 template <typename Type>
@@ -204,6 +358,10 @@ struct UTF8Lower : UTF8Transform<Type, UTF8Lower<Type>> {
     return codepoint <= kMaxCodepointLookup ? lut_lower_codepoint[codepoint]
                                             : utf8proc_tolower(codepoint);
   }
+
+  static void TransformAscii(const uint8_t* input, int64_t length, uint8_t* output) {
+    TransformAsciiLower(input, length, output);
+  }
 };
 
 #else
@@ -212,91 +370,6 @@ void EnsureLookupTablesFilled() {}
 
 #endif  // ARROW_WITH_UTF8PROC
 
-using TransformFunc = std::function<void(const uint8_t*, int64_t, uint8_t*)>;
-
-// Transform a buffer of offsets to one which begins with 0 and has same
-// value lengths.
-template <typename T>
-Status GetShiftedOffsets(KernelContext* ctx, const Buffer& input_buffer, int64_t offset,
-                         int64_t length, std::shared_ptr<Buffer>* out) {
-  ARROW_ASSIGN_OR_RAISE(*out, ctx->Allocate((length + 1) * sizeof(T)));
-  const T* input_offsets = reinterpret_cast<const T*>(input_buffer.data()) + offset;
-  T* out_offsets = reinterpret_cast<T*>((*out)->mutable_data());
-  T first_offset = *input_offsets;
-  for (int64_t i = 0; i < length; ++i) {
-    *out_offsets++ = input_offsets[i] - first_offset;
-  }
-  *out_offsets = input_offsets[length] - first_offset;
-  return Status::OK();
-}
-
-// Apply `transform` to input character data- this function cannot change the
-// length
-template <typename Type>
-void StringDataTransform(KernelContext* ctx, const ExecBatch& batch,
-                         TransformFunc transform, Datum* out) {
-  using ArrayType = typename TypeTraits<Type>::ArrayType;
-  using offset_type = typename Type::offset_type;
-
-  if (batch[0].kind() == Datum::ARRAY) {
-    const ArrayData& input = *batch[0].array();
-    ArrayType input_boxed(batch[0].array());
-
-    ArrayData* out_arr = out->mutable_array();
-
-    if (input.offset == 0) {
-      // We can reuse offsets from input
-      out_arr->buffers[1] = input.buffers[1];
-    } else {
-      DCHECK(input.buffers[1]);
-      // We must allocate new space for the offsets and shift the existing offsets
-      KERNEL_RETURN_IF_ERROR(
-          ctx, GetShiftedOffsets<offset_type>(ctx, *input.buffers[1], input.offset,
-                                              input.length, &out_arr->buffers[1]));
-    }
-
-    // Allocate space for output data
-    int64_t data_nbytes = input_boxed.total_values_length();
-    KERNEL_RETURN_IF_ERROR(ctx, ctx->Allocate(data_nbytes).Value(&out_arr->buffers[2]));
-    if (input.length > 0) {
-      transform(input.buffers[2]->data() + input_boxed.value_offset(0), data_nbytes,
-                out_arr->buffers[2]->mutable_data());
-    }
-  } else {
-    const auto& input = checked_cast<const BaseBinaryScalar&>(*batch[0].scalar());
-    auto result = checked_pointer_cast<BaseBinaryScalar>(MakeNullScalar(out->type()));
-    if (input.is_valid) {
-      result->is_valid = true;
-      int64_t data_nbytes = input.value->size();
-      KERNEL_RETURN_IF_ERROR(ctx, ctx->Allocate(data_nbytes).Value(&result->value));
-      transform(input.value->data(), data_nbytes, result->value->mutable_data());
-    }
-    out->value = result;
-  }
-}
-
-void TransformAsciiUpper(const uint8_t* input, int64_t length, uint8_t* output) {
-  std::transform(input, input + length, output, ascii_toupper);
-}
-
-template <typename Type>
-struct AsciiUpper {
-  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
-    StringDataTransform<Type>(ctx, batch, TransformAsciiUpper, out);
-  }
-};
-
-void TransformAsciiLower(const uint8_t* input, int64_t length, uint8_t* output) {
-  std::transform(input, input + length, output, ascii_tolower);
-}
-
-template <typename Type>
-struct AsciiLower {
-  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
-    StringDataTransform<Type>(ctx, batch, TransformAsciiLower, out);
-  }
-};
-
 // ----------------------------------------------------------------------
 // exact pattern detection
 
@@ -411,6 +484,190 @@ void AddMatchSubstring(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
+// Set the output bit of each string for which the predicate is true
+template <typename offset_type, typename Predicate>
+void TransformMatch(const offset_type* offsets, const uint8_t* data, int64_t length,
+                    int64_t output_offset, uint8_t* output, Predicate&& predicate) {
+  FirstTimeBitmapWriter bitmap_writer(output, output_offset, length);
+  for (int64_t i = 0; i < length; ++i) {
+    const char* current_data = reinterpret_cast<const char*>(data + offsets[i]);
+    const int64_t current_length = offsets[i + 1] - offsets[i];
+    if (predicate(
+            util::string_view(current_data, static_cast<size_t>(current_length)))) {
+      bitmap_writer.Set();
+    }
+    bitmap_writer.Next();
+  }
+  bitmap_writer.Finish();
+}
+
+struct MatchAnySubstringState : public KernelState {
+  explicit MatchAnySubstringState(const MatchAnySubstringOptions& options)
+      : matcher(options.patterns, options.ignore_case) {}
+
+  static std::unique_ptr<KernelState> Init(KernelContext* ctx,
+                                           const KernelInitArgs& args) {
+    if (auto options = static_cast<const MatchAnySubstringOptions*>(args.options)) {
+      return ::arrow::internal::make_unique<MatchAnySubstringState>(*options);
+    }
+    ctx->SetStatus(
+        Status::Invalid("Attempted to initialize KernelState from null FunctionOptions"));
+    return NULLPTR;
+  }
+
+  ::arrow::internal::AhoCorasick matcher;
+};
+
+template <typename Type>
+struct MatchAnySubstring {
+  using offset_type = typename Type::offset_type;
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const auto& state = checked_cast<const MatchAnySubstringState&>(*ctx->state());
+    StringBoolTransform<Type>(
+        ctx, batch,
+        [&state](const void* offsets, const uint8_t* data, int64_t length,
+                 int64_t output_offset, uint8_t* output) {
+          TransformMatch(
+              reinterpret_cast<const offset_type*>(offsets), data, length, output_offset,
+              output,
+              [&](util::string_view value) { return state.matcher.Contains(value); });
+        },
+        out);
+  }
+};
+
+const FunctionDoc match_any_substring_doc(
+    "Match strings against a set of literal patterns",
+    ("For each string in `strings`, emit true iff it contains any of the given\n"
+     "patterns.  All patterns are searched for in a single pass over each string.\n"
+     "Null inputs emit null.  The patterns must be given in\n"
+     "MatchAnySubstringOptions."),
+    {"strings"}, "MatchAnySubstringOptions");
+
+void AddMatchAnySubstring(FunctionRegistry* registry) {
+  auto func = std::make_shared<ScalarFunction>("match_any_substring", Arity::Unary(),
+                                               &match_any_substring_doc);
+  auto exec_32 = MatchAnySubstring<StringType>::Exec;
+  auto exec_64 = MatchAnySubstring<LargeStringType>::Exec;
+  DCHECK_OK(func->AddKernel({utf8()}, boolean(), exec_32, MatchAnySubstringState::Init));
+  DCHECK_OK(func->AddKernel({large_utf8()}, boolean(), exec_64,
+                            MatchAnySubstringState::Init));
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+#ifdef ARROW_WITH_RE2
+
+// A compiled regular expression, with an optional prefilter on the literal
+// strings ("atoms") that any match must contain. The state is immutable once
+// compiled, so it can be shared by concurrent executions.
+struct MatchRegexState : public KernelState {
+  // Atoms shorter than this are not worth prefiltering on
+  static constexpr int kMinAtomLength = 3;
+
+  MatchRegexState() : filter(kMinAtomLength) {}
+
+  static Result<std::unique_ptr<MatchRegexState>> Make(
+      const MatchSubstringOptions& options) {
+    RE2::Options re2_options;
+    re2_options.set_log_errors(false);
+    auto state = ::arrow::internal::make_unique<MatchRegexState>();
+    state->regex.reset(new RE2(options.pattern, re2_options));
+    if (!state->regex->ok()) {
+      return Status::Invalid("Invalid regular expression '", options.pattern,
+                             "': ", state->regex->error());
+    }
+    int regex_id;
+    if (state->filter.Add(options.pattern, re2_options, &regex_id) != RE2::NoError) {
+      return Status::Invalid("Invalid regular expression '", options.pattern, "'");
+    }
+    std::vector<std::string> atoms;
+    state->filter.Compile(&atoms);
+    // The atoms are lowercased and must be searched for case-insensitively,
+    // which the atom matcher only does for ASCII
+    const bool ascii_atoms =
+        std::all_of(atoms.begin(), atoms.end(), [](const std::string& atom) {
+          return std::all_of(atom.begin(), atom.end(),
+                             [](char c) { return IsAsciiCharacter<uint8_t>(c); });
+        });
+    if (!atoms.empty() && ascii_atoms) {
+      state->atom_matcher.reset(new ::arrow::internal::AhoCorasick(
+          atoms, /*ascii_case_insensitive=*/true));
+    }
+    return std::move(state);
+  }
+
+  static std::unique_ptr<KernelState> Init(KernelContext* ctx,
+                                           const KernelInitArgs& args) {
+    auto options = static_cast<const MatchSubstringOptions*>(args.options);
+    if (options == nullptr) {
+      ctx->SetStatus(Status::Invalid(
+          "Attempted to initialize KernelState from null FunctionOptions"));
+      return NULLPTR;
+    }
+    auto maybe_state = Make(*options);
+    if (!maybe_state.ok()) {
+      ctx->SetStatus(maybe_state.status());
+      return NULLPTR;
+    }
+    return std::move(maybe_state).ValueOrDie();
+  }
+
+  // `atoms` is a scratch vector, so that it can be reused between calls
+  bool Match(util::string_view value, std::vector<int>* atoms) const {
+    const re2::StringPiece piece(value.data(), value.size());
+    if (atom_matcher == nullptr) {
+      return RE2::PartialMatch(piece, *regex);
+    }
+    atoms->clear();
+    atom_matcher->FindAll(value, atoms);
+    return filter.FirstMatch(piece, *atoms) >= 0;
+  }
+
+  std::unique_ptr<RE2> regex;
+  re2::FilteredRE2 filter;
+  std::unique_ptr<::arrow::internal::AhoCorasick> atom_matcher;
+};
+
+template <typename Type>
+struct MatchRegex {
+  using offset_type = typename Type::offset_type;
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const auto& state = checked_cast<const MatchRegexState&>(*ctx->state());
+    std::vector<int> atoms;
+    StringBoolTransform<Type>(
+        ctx, batch,
+        [&](const void* offsets, const uint8_t* data, int64_t length,
+            int64_t output_offset, uint8_t* output) {
+          TransformMatch(
+              reinterpret_cast<const offset_type*>(offsets), data, length,
+              output_offset, output,
+              [&](util::string_view value) { return state.Match(value, &atoms); });
+        },
+        out);
+  }
+};
+
+const FunctionDoc match_regex_doc(
+    "Match strings against a regular expression",
+    ("For each string in `strings`, emit true iff it contains a match of the\n"
+     "given regular expression (in RE2 syntax).  Strings not containing the\n"
+     "literals required by the regular expression are rejected without running\n"
+     "the regular expression engine.  Null inputs emit null.  The regular\n"
+     "expression must be given in MatchSubstringOptions."),
+    {"strings"}, "MatchSubstringOptions");
+
+void AddMatchRegex(FunctionRegistry* registry) {
+  auto func = std::make_shared<ScalarFunction>("match_regex", Arity::Unary(),
+                                               &match_regex_doc);
+  auto exec_32 = MatchRegex<StringType>::Exec;
+  auto exec_64 = MatchRegex<LargeStringType>::Exec;
+  DCHECK_OK(func->AddKernel({utf8()}, boolean(), exec_32, MatchRegexState::Init));
+  DCHECK_OK(func->AddKernel({large_utf8()}, boolean(), exec_64, MatchRegexState::Init));
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+#endif  // ARROW_WITH_RE2
+
 // IsAlpha/Digit etc
 
 #ifdef ARROW_WITH_UTF8PROC
@@ -661,8 +918,8 @@ struct IsNumericUnicode : CharacterPredicateUnicode<IsNumericUnicode> {
 struct IsAscii {
   static bool Call(KernelContext* ctx, const uint8_t* input,
                    size_t input_string_nascii_characters) {
-    return std::all_of(input, input + input_string_nascii_characters,
-                       IsAsciiCharacter<uint8_t>);
+    return arrow::util::ValidateAscii(
+        input, static_cast<int64_t>(input_string_nascii_characters));
   }
 };
 
@@ -894,6 +1151,30 @@ struct SplitBaseTransform {
     return Status::OK();
   }
 
+  // Whether any valid value contains a separator, i.e. would be split in several parts
+  bool AnySplit(const ArrayType& input) {
+    if (options.max_splits == 0) {
+      return false;
+    }
+    for (int64_t i = 0; i < input.length(); ++i) {
+      if (input.IsNull(i)) continue;
+      const util::string_view s = input.GetView(i);
+      const uint8_t* begin = reinterpret_cast<const uint8_t*>(s.data());
+      const uint8_t* end = begin + s.length();
+      const uint8_t *separator_begin, *separator_end;
+      // same search as the first step of Split()
+      const bool found =
+          options.reverse
+              ? Derived::FindReverse(begin, end, &separator_begin, &separator_end,
+                                     options)
+              : Derived::Find(begin, end, &separator_begin, &separator_end, options);
+      if (found) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   static Status CheckOptions(const Options& options) { return Status::OK(); }
 
   static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
@@ -911,6 +1192,25 @@ struct SplitBaseTransform {
       ArrayType input_boxed(batch[0].array());
 
       string_offset_type input_nstrings = static_cast<string_offset_type>(input.length);
+      ArrayData* output_list = out->mutable_array();
+      // // we use the same null values
+      output_list->buffers[0] = input.buffers[0];
+
+      // The parts of a split value are separated by the separators, so they can't
+      // be referenced in the input data.  When no value is split though, each list
+      // holds its input value, and the input strings are used as list values as is.
+      if (input.length <= std::numeric_limits<list_offset_type>::max() &&
+          !AnySplit(input_boxed)) {
+        ListOffsetsBuilderType list_offsets_builder(ctx->memory_pool());
+        KERNEL_RETURN_IF_ERROR(ctx, list_offsets_builder.Resize(input.length + 1));
+        for (int64_t i = 0; i <= input.length; ++i) {
+          list_offsets_builder.UnsafeAppend(static_cast<list_offset_type>(i));
+        }
+        KERNEL_RETURN_IF_ERROR(ctx,
+                               list_offsets_builder.Finish(&output_list->buffers[1]));
+        output_list->child_data.push_back(batch[0].array());
+        return;
+      }
 
       BuilderType builder(input.type, ctx->memory_pool());
       // a slight overestimate of the data needed
@@ -922,9 +1222,6 @@ struct SplitBaseTransform {
       // https://issues.apache.org/jira/browse/ARROW-10207
       ListOffsetsBuilderType list_offsets_builder(ctx->memory_pool());
       KERNEL_RETURN_IF_ERROR(ctx, list_offsets_builder.Resize(input_nstrings));
-      ArrayData* output_list = out->mutable_array();
-      // // we use the same null values
-      output_list->buffers[0] = input.buffers[0];
       // initial value
       KERNEL_RETURN_IF_ERROR(
           ctx, list_offsets_builder.Append(static_cast<list_offset_type>(0)));
@@ -1497,6 +1794,10 @@ void RegisterScalarStringAscii(FunctionRegistry* registry) {
   AddSplit(registry);
   AddBinaryLength(registry);
   AddMatchSubstring(registry);
+  AddMatchAnySubstring(registry);
+#ifdef ARROW_WITH_RE2
+  AddMatchRegex(registry);
+#endif
   AddStrptime(registry);
 }
 
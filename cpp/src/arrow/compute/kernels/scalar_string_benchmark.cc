@@ -17,6 +17,7 @@
 
 #include "benchmark/benchmark.h"
 
+#include "arrow/chunked_array.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/testing/gtest_util.h"
@@ -49,6 +50,66 @@ static void UnaryStringBenchmark(benchmark::State& state, const std::string& fun
   state.SetBytesProcessed(state.iterations() * values->data()->buffers[2]->size());
 }
 
+// The same input as UnaryStringBenchmark, split into 100 chunks, executed
+// serially or with threads depending on state.range(0)
+static void UnaryStringChunkedBenchmark(benchmark::State& state,
+                                        const std::string& func_name) {
+  const int64_t array_length = 1 << 20;
+  const int64_t num_chunks = 100;
+  random::RandomArrayGenerator rng(kSeed);
+
+  auto values = rng.String(array_length, /*min_length=*/0, /*max_length=*/32,
+                           /*null_probability=*/0.01);
+  ArrayVector chunks;
+  const int64_t chunk_length = array_length / num_chunks;
+  for (int64_t offset = 0; offset < array_length; offset += chunk_length) {
+    chunks.push_back(values->Slice(offset, chunk_length));
+  }
+  auto chunked = std::make_shared<ChunkedArray>(std::move(chunks));
+
+  ExecContext ctx;
+  ctx.set_use_threads(state.range(0) != 0);
+  ABORT_NOT_OK(CallFunction(func_name, {chunked}, &ctx));
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(CallFunction(func_name, {chunked}, &ctx));
+  }
+  state.SetItemsProcessed(state.iterations() * array_length);
+  state.SetBytesProcessed(state.iterations() * values->data()->buffers[2]->size());
+}
+
+// High-cardinality strings sharing long prefixes (URLs, file paths...),
+// dictionary-encoded if state.range(0) is non-zero
+static void PrefixedStringBenchmark(benchmark::State& state, const std::string& func_name,
+                                    const FunctionOptions* options = nullptr) {
+  const int64_t array_length = 1 << 20;
+  const int64_t num_unique = 1 << 14;
+  random::RandomArrayGenerator rng(kSeed);
+
+  std::shared_ptr<Array> values;
+  int64_t data_size;
+  if (state.range(0) != 0) {
+    values = rng.DictionaryStringWithPrefixes(
+        array_length, num_unique, /*num_prefixes=*/16, /*prefix_length=*/24,
+        /*min_suffix_length=*/0, /*max_suffix_length=*/16, /*null_probability=*/0.01);
+    const auto& dict_array = checked_cast<const DictionaryArray&>(*values);
+    data_size = dict_array.indices()->data()->buffers[1]->size() +
+                dict_array.dictionary()->data()->buffers[2]->size();
+  } else {
+    values = rng.StringWithPrefixes(array_length, num_unique, /*num_prefixes=*/16,
+                                    /*prefix_length=*/24, /*min_suffix_length=*/0,
+                                    /*max_suffix_length=*/16, /*null_probability=*/0.01);
+    data_size = values->data()->buffers[2]->size();
+  }
+  ABORT_NOT_OK(CallFunction(func_name, {values}, options));
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(CallFunction(func_name, {values}, options));
+  }
+  state.SetItemsProcessed(state.iterations() * array_length);
+  state.SetBytesProcessed(state.iterations() * data_size);
+}
+
 static void AsciiLower(benchmark::State& state) {
   UnaryStringBenchmark(state, "ascii_lower");
 }
@@ -57,6 +118,14 @@ static void AsciiUpper(benchmark::State& state) {
   UnaryStringBenchmark(state, "ascii_upper");
 }
 
+static void AsciiUpperChunked(benchmark::State& state) {
+  UnaryStringChunkedBenchmark(state, "ascii_upper");
+}
+
+static void AsciiUpperPrefixes(benchmark::State& state) {
+  PrefixedStringBenchmark(state, "ascii_upper");
+}
+
 static void IsAlphaNumericAscii(benchmark::State& state) {
   UnaryStringBenchmark(state, "ascii_is_alnum");
 }
@@ -66,6 +135,34 @@ static void MatchSubstring(benchmark::State& state) {
   UnaryStringBenchmark(state, "match_substring", &options);
 }
 
+static void MatchAnySubstring(benchmark::State& state) {
+  // 50 needles, as when filtering logs for a list of keywords
+  std::vector<std::string> patterns;
+  for (int i = 0; i < 50; ++i) {
+    patterns.push_back("ab" + std::string(1, static_cast<char>('a' + i % 26)) +
+                       std::to_string(i));
+  }
+  MatchAnySubstringOptions options(std::move(patterns));
+  UnaryStringBenchmark(state, "match_any_substring", &options);
+}
+
+static void MatchSubstringPrefixes(benchmark::State& state) {
+  MatchSubstringOptions options("abac");
+  PrefixedStringBenchmark(state, "match_substring", &options);
+}
+
+#ifdef ARROW_WITH_RE2
+static void MatchRegex(benchmark::State& state) {
+  MatchSubstringOptions options("abac[a-z]*d");
+  UnaryStringBenchmark(state, "match_regex", &options);
+}
+
+static void MatchRegexNoLiterals(benchmark::State& state) {
+  MatchSubstringOptions options("[a-c]{3}[0-9]");
+  UnaryStringBenchmark(state, "match_regex", &options);
+}
+#endif
+
 static void SplitPattern(benchmark::State& state) {
   SplitPatternOptions options("a");
   UnaryStringBenchmark(state, "split_pattern", &options);
@@ -87,8 +184,16 @@ static void IsAlphaNumericUnicode(benchmark::State& state) {
 
 BENCHMARK(AsciiLower);
 BENCHMARK(AsciiUpper);
+BENCHMARK(AsciiUpperChunked)->ArgName("use_threads")->Arg(0)->Arg(1)->UseRealTime();
+BENCHMARK(AsciiUpperPrefixes)->ArgName("dictionary")->Arg(0)->Arg(1);
 BENCHMARK(IsAlphaNumericAscii);
 BENCHMARK(MatchSubstring);
+BENCHMARK(MatchSubstringPrefixes)->ArgName("dictionary")->Arg(0)->Arg(1);
+BENCHMARK(MatchAnySubstring);
+#ifdef ARROW_WITH_RE2
+BENCHMARK(MatchRegex);
+BENCHMARK(MatchRegexNoLiterals);
+#endif
 BENCHMARK(SplitPattern);
 #ifdef ARROW_WITH_UTF8PROC
 BENCHMARK(Utf8Lower);
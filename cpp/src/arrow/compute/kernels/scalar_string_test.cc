@@ -85,8 +85,10 @@ TYPED_TEST(TestStringKernels, AsciiLower) {
 TEST(TestStringKernels, LARGE_MEMORY_TEST(Utf8Upper32bitGrowth)) {
   // 0x7fff * 0xffff is the max a 32 bit string array can hold
   // since the utf8_upper kernel can grow it by 3/2, the max we should accept is is
-  // 0x7fff * 0xffff * 2/3 = 0x5555 * 0xffff, so this should give us a CapacityError
-  std::string str(0x5556 * 0xffff, 'a');
+  // 0x7fff * 0xffff * 2/3 = 0x5555 * 0xffff, so this should give us a CapacityError.
+  // ASCII data doesn't grow, hence the trailing non-ASCII character.
+  std::string str(0x5556 * 0xffff - 2, 'a');
+  str += "ɑ";
   arrow::StringBuilder builder;
   ASSERT_OK(builder.Append(str));
   std::shared_ptr<arrow::Array> array;
@@ -118,6 +120,20 @@ TYPED_TEST(TestStringKernels, Utf8Upper) {
   // test maximum buffer growth
   this->CheckUnary("utf8_upper", "[\"ɑɑɑɑ\"]", this->type(), "[\"ⱭⱭⱭⱭ\"]");
 
+  // test ASCII runs of varying lengths between multibyte characters
+  this->CheckUnary(
+      "utf8_upper",
+      R"(["abcdefghijklmnopqrstuvwxyzæ0123456789ɑ", "ɑabcdefghijklmnopqɽ", "xyz"])",
+      this->type(),
+      R"(["ABCDEFGHIJKLMNOPQRSTUVWXYZÆ0123456789Ɑ", "ⱭABCDEFGHIJKLMNOPQⱤ", "XYZ"])");
+
+  // test all-ASCII data, whose offsets are carried over from the input
+  auto ascii_input =
+      ArrayFromJSON(this->type(), R"(["x", "abcdefghijklmnopqrstuvwxyz{}", null, "ok"])");
+  auto ascii_expected =
+      ArrayFromJSON(this->type(), R"(["ABCDEFGHIJKLMNOPQRSTUVWXYZ{}", null, "OK"])");
+  CheckScalarUnary("utf8_upper", ascii_input->Slice(1), ascii_expected);
+
   // Test invalid data
   auto invalid_input = ArrayFromJSON(this->type(), "[\"ɑa\xFFɑ\", \"ɽ\xe1\xbdɽaa\"]");
   EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, testing::HasSubstr("Invalid UTF8 sequence"),
@@ -140,6 +156,13 @@ TYPED_TEST(TestStringKernels, Utf8Lower) {
   // test maximum buffer growth
   this->CheckUnary("utf8_lower", "[\"ȺȺȺȺ\"]", this->type(), "[\"ⱥⱥⱥⱥ\"]");
 
+  // test ASCII runs of varying lengths between multibyte characters
+  this->CheckUnary(
+      "utf8_lower",
+      R"(["ABCDEFGHIJKLMNOPQRSTUVWXYZÆ0123456789Ⱥ", "ȺABCDEFGHIJKLMNOPQⱤ", "XYZ"])",
+      this->type(),
+      R"(["abcdefghijklmnopqrstuvwxyzæ0123456789ⱥ", "ⱥabcdefghijklmnopqɽ", "xyz"])");
+
   // Test invalid data
   auto invalid_input = ArrayFromJSON(this->type(), "[\"Ⱥa\xFFⱭ\", \"Ɽ\xe1\xbdⱤaA\"]");
   EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, testing::HasSubstr("Invalid UTF8 sequence"),
@@ -334,6 +357,78 @@ TYPED_TEST(TestStringKernels, MatchSubstring) {
                    &options_double_char_2);
 }
 
+TYPED_TEST(TestStringKernels, MatchAnySubstring) {
+  MatchAnySubstringOptions options{{"ab", "ca"}};
+  this->CheckUnary("match_any_substring", "[]", boolean(), "[]", &options);
+  this->CheckUnary("match_any_substring", R"(["abc", "acb", "cab", null, "bac", ""])",
+                   boolean(), "[true, false, true, null, false, false]", &options);
+
+  // Overlapping patterns, and patterns which are suffixes of others
+  MatchAnySubstringOptions options_overlap{{"abcd", "bce", "e", "aab"}};
+  this->CheckUnary("match_any_substring",
+                   R"(["abc", "abce", "aaab", "abcd", "bcd", "xyz", "eee"])", boolean(),
+                   "[false, true, true, true, false, false, true]", &options_overlap);
+
+  MatchAnySubstringOptions options_empty_pattern{{"", "x"}};
+  this->CheckUnary("match_any_substring", R"(["", "a", null])", boolean(),
+                   "[true, true, null]", &options_empty_pattern);
+
+  MatchAnySubstringOptions options_no_patterns{{}};
+  this->CheckUnary("match_any_substring", R"(["", "a", null])", boolean(),
+                   "[false, false, null]", &options_no_patterns);
+
+  MatchAnySubstringOptions options_ignore_case{{"Error", "WARN"}, /*ignore_case=*/true};
+  this->CheckUnary("match_any_substring",
+                   R"(["ERROR: x", "warning", "error", "Info", "é WaRn"])", boolean(),
+                   "[true, true, true, false, true]", &options_ignore_case);
+
+  // Non-ASCII patterns
+  MatchAnySubstringOptions options_utf8{{"é", "ðŸ"}};
+  this->CheckUnary("match_any_substring", R"(["café", "cafe", "ðŸ", "ð"])", boolean(),
+                   "[true, false, true, false]", &options_utf8);
+}
+
+#ifdef ARROW_WITH_RE2
+TYPED_TEST(TestStringKernels, MatchRegex) {
+  MatchSubstringOptions options{"ab+c"};
+  this->CheckUnary("match_regex", "[]", boolean(), "[]", &options);
+  this->CheckUnary("match_regex", R"(["abc", "ac", "xabbbcx", null, "cba", ""])",
+                   boolean(), "[true, false, true, null, false, false]", &options);
+
+  // Anchors
+  MatchSubstringOptions options_anchored{"^ab$"};
+  this->CheckUnary("match_regex", R"(["ab", "abab", "xab", ""])", boolean(),
+                   "[true, false, false, false]", &options_anchored);
+
+  // Required literals, which are prefiltered on
+  MatchSubstringOptions options_literals{"(disk|memory) (full|exhausted)"};
+  this->CheckUnary("match_regex",
+                   R"(["disk full", "memory exhausted", "disk exhausted", "disk  full",
+                       "DISK FULL", "cpu full"])",
+                   boolean(), "[true, true, true, false, false, false]",
+                   &options_literals);
+
+  // Case-insensitive matching, which the prefilter must not break
+  MatchSubstringOptions options_ignore_case{"(?i)failed to \\w+"};
+  this->CheckUnary("match_regex",
+                   R"(["FAILED TO OPEN", "Failed to open", "failed to ", "failed"])",
+                   boolean(), "[true, true, false, false]", &options_ignore_case);
+  MatchSubstringOptions options_ignore_case_utf8{"(?i)ÉCOLE"};
+  this->CheckUnary("match_regex", R"(["école", "ÉCOLE", "ecole"])", boolean(),
+                   "[true, true, false]", &options_ignore_case_utf8);
+
+  // No required literals
+  MatchSubstringOptions options_no_literals{"\\d{2,}"};
+  this->CheckUnary("match_regex", R"(["a1", "a12", "123", ""])", boolean(),
+                   "[false, true, true, false]", &options_no_literals);
+
+  MatchSubstringOptions options_invalid{"(abc"};
+  ASSERT_RAISES(Invalid, CallFunction("match_regex",
+                                      {ArrayFromJSON(this->type(), R"(["abc"])")},
+                                      &options_invalid));
+}
+#endif
+
 TYPED_TEST(TestStringKernels, SplitBasics) {
   SplitPatternOptions options{" "};
   // basics
@@ -358,6 +453,23 @@ TYPED_TEST(TestStringKernels, SplitBasics) {
                    &options_long_reverse);
 }
 
+TYPED_TEST(TestStringKernels, SplitNoSeparator) {
+  SplitPatternOptions options{"---"};
+  SplitPatternOptions options_max{" ", 0};
+  this->CheckUnary("split_pattern", R"(["foo", "", "foo--bar"])", list(this->type()),
+                   R"([["foo"], [""], ["foo--bar"]])", &options);
+  this->CheckUnary("split_pattern", R"(["foo bar", " "])", list(this->type()),
+                   R"([["foo bar"], [" "]])", &options_max);
+
+  // the input strings are the list values, without copying
+  auto input = ArrayFromJSON(this->type(), R"(["foo", "", "foo--bar"])");
+  ASSERT_OK_AND_ASSIGN(Datum result, CallFunction("split_pattern", {input}, &options));
+  ASSERT_OK(result.make_array()->ValidateFull());
+  const auto& values = *result.array()->child_data[0];
+  ASSERT_EQ(values.buffers[1], input->data()->buffers[1]);
+  ASSERT_EQ(values.buffers[2], input->data()->buffers[2]);
+}
+
 TYPED_TEST(TestStringKernels, SplitMax) {
   SplitPatternOptions options{"---", 2};
   SplitPatternOptions options_reverse{"---", 2, /*reverse=*/true};
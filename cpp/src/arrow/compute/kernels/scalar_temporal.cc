@@ -0,0 +1,522 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <ratio>
+#include <string>
+#include <utility>
+
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/int_util_internal.h"
+
+namespace arrow {
+
+using internal::MultiplyWithOverflow;
+
+namespace compute {
+namespace internal {
+
+using applicator::ScalarUnary;
+using applicator::ScalarUnaryNotNullStateful;
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Civil calendar arithmetic
+//
+// Conversions between days since the UNIX epoch and proleptic Gregorian dates
+// use H. Hinnant's branch-free algorithms, which the vendored date library is
+// also built upon (http://howardhinnant.github.io/date_algorithms.html). All
+// divisions are by constants, so that the loops over them are compiled to
+// multiplications and shifts and can be vectorized.
+
+// Date32 values are days
+using Days = std::chrono::duration<int64_t, std::ratio<86400>>;
+
+// The number of nanoseconds and of days in a Duration, e.g. std::chrono::seconds
+template <typename Duration>
+constexpr int64_t NanosPerUnit() {
+  return 1000000000LL * Duration::period::num / Duration::period::den;
+}
+
+template <typename Duration>
+constexpr int64_t UnitsPerDay() {
+  return 86400LL * Duration::period::den / Duration::period::num;
+}
+
+// Division rounding towards negative infinity, for a positive divisor
+inline int64_t FloorDiv(int64_t value, int64_t divisor) {
+  return value / divisor - (value % divisor < 0);
+}
+
+struct CivilDate {
+  int64_t year;
+  int64_t month;  // [1, 12]
+  int64_t day;    // [1, 31]
+};
+
+inline CivilDate CivilFromDays(int64_t days) {
+  // Shift the epoch to 0000-03-01, so that leap days end the 400-year eras
+  const int64_t z = days + 719468;
+  const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+  const int64_t day_of_era = z - era * 146097;  // [0, 146096]
+  const int64_t year_of_era =
+      (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) /
+      365;  // [0, 399]
+  const int64_t day_of_year =
+      day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  const int64_t month_of_year = (5 * day_of_year + 2) / 153;  // [0, 11], from March
+  const int64_t day = day_of_year - (153 * month_of_year + 2) / 5 + 1;
+  const int64_t month = month_of_year < 10 ? month_of_year + 3 : month_of_year - 9;
+  return {year_of_era + era * 400 + (month <= 2), month, day};
+}
+
+inline int64_t DaysFromCivil(int64_t year, int64_t month, int64_t day) {
+  year -= month <= 2;
+  const int64_t era = (year >= 0 ? year : year - 399) / 400;
+  const int64_t year_of_era = year - era * 400;  // [0, 399]
+  const int64_t day_of_year =
+      (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;  // [0, 365]
+  const int64_t day_of_era =
+      year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + day_of_era - 719468;
+}
+
+template <typename Duration>
+inline int64_t DaysOf(int64_t value) {
+  return FloorDiv(value, UnitsPerDay<Duration>());
+}
+
+// The nanoseconds since midnight
+template <typename Duration>
+inline int64_t NanosOfDay(int64_t value) {
+  return (value - DaysOf<Duration>(value) * UnitsPerDay<Duration>()) *
+         NanosPerUnit<Duration>();
+}
+
+// ----------------------------------------------------------------------
+// Extraction of date and time components
+
+template <typename Duration>
+struct Year {
+  template <typename T, typename Arg0>
+  static T Call(KernelContext*, Arg0 arg) {
+    return static_cast<T>(CivilFromDays(DaysOf<Duration>(arg)).year);
+  }
+};
+
+template <typename Duration>
+struct Month {
+  template <typename T, typename Arg0>
+  static T Call(KernelContext*, Arg0 arg) {
+    return static_cast<T>(CivilFromDays(DaysOf<Duration>(arg)).month);
+  }
+};
+
+template <typename Duration>
+struct Day {
+  template <typename T, typename Arg0>
+  static T Call(KernelContext*, Arg0 arg) {
+    return static_cast<T>(CivilFromDays(DaysOf<Duration>(arg)).day);
+  }
+};
+
+// Monday is 0 and Sunday is 6
+template <typename Duration>
+struct DayOfWeek {
+  template <typename T, typename Arg0>
+  static T Call(KernelContext*, Arg0 arg) {
+    // 1970-01-01 was a Thursday
+    const int64_t days = DaysOf<Duration>(arg) + 3;
+    return static_cast<T>(days - FloorDiv(days, 7) * 7);
+  }
+};
+
+// January 1st is 1
+template <typename Duration>
+struct DayOfYear {
+  template <typename T, typename Arg0>
+  static T Call(KernelContext*, Arg0 arg) {
+    const int64_t days = DaysOf<Duration>(arg);
+    return static_cast<T>(days - DaysFromCivil(CivilFromDays(days).year, 1, 1) + 1);
+  }
+};
+
+template <typename Duration>
+struct Quarter {
+  template <typename T, typename Arg0>
+  static T Call(KernelContext*, Arg0 arg) {
+    return static_cast<T>((CivilFromDays(DaysOf<Duration>(arg)).month - 1) / 3 + 1);
+  }
+};
+
+template <typename Duration>
+struct Hour {
+  template <typename T, typename Arg0>
+  static T Call(KernelContext*, Arg0 arg) {
+    return static_cast<T>(NanosOfDay<Duration>(arg) / 3600000000000LL);
+  }
+};
+
+template <typename Duration>
+struct Minute {
+  template <typename T, typename Arg0>
+  static T Call(KernelContext*, Arg0 arg) {
+    return static_cast<T>(NanosOfDay<Duration>(arg) / 60000000000LL % 60);
+  }
+};
+
+template <typename Duration>
+struct Second {
+  template <typename T, typename Arg0>
+  static T Call(KernelContext*, Arg0 arg) {
+    return static_cast<T>(NanosOfDay<Duration>(arg) / 1000000000LL % 60);
+  }
+};
+
+template <typename Duration>
+struct Millisecond {
+  template <typename T, typename Arg0>
+  static T Call(KernelContext*, Arg0 arg) {
+    return static_cast<T>(NanosOfDay<Duration>(arg) / 1000000LL % 1000);
+  }
+};
+
+template <typename Duration>
+struct Microsecond {
+  template <typename T, typename Arg0>
+  static T Call(KernelContext*, Arg0 arg) {
+    return static_cast<T>(NanosOfDay<Duration>(arg) / 1000LL % 1000);
+  }
+};
+
+template <typename Duration>
+struct Nanosecond {
+  template <typename T, typename Arg0>
+  static T Call(KernelContext*, Arg0 arg) {
+    return static_cast<T>(NanosOfDay<Duration>(arg) % 1000);
+  }
+};
+
+// Components are computed from the timestamp values as is, which is only
+// meaningful if they aren't UTC instants of another timezone
+ArrayKernelExec RequireNoTimezone(ArrayKernelExec exec) {
+  return [exec](KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const auto& type = checked_cast<const TimestampType&>(*batch[0].type());
+    if (!type.timezone().empty()) {
+      ctx->SetStatus(Status::NotImplemented(
+          "Temporal functions on timestamps with a timezone, got ", type.ToString()));
+      return;
+    }
+    exec(ctx, batch, out);
+  };
+}
+
+// Instantiate Exec<Duration>::Exec for the duration of a timestamp unit
+template <template <typename Duration> class Exec>
+ArrayKernelExec TimestampExec(TimeUnit::type unit) {
+  switch (unit) {
+    case TimeUnit::SECOND:
+      return Exec<std::chrono::seconds>::Exec;
+    case TimeUnit::MILLI:
+      return Exec<std::chrono::milliseconds>::Exec;
+    case TimeUnit::MICRO:
+      return Exec<std::chrono::microseconds>::Exec;
+    case TimeUnit::NANO:
+      return Exec<std::chrono::nanoseconds>::Exec;
+  }
+  DCHECK(false);
+  return ExecFail;
+}
+
+template <template <typename Duration> class Op>
+struct TimestampComponent {
+  template <typename Duration>
+  using Exec = ScalarUnary<Int64Type, TimestampType, Op<Duration>>;
+};
+
+// Register a function extracting a date or time component as an int64
+template <template <typename Duration> class Op>
+std::shared_ptr<ScalarFunction> MakeTemporalComponent(std::string name,
+                                                      const FunctionDoc* doc,
+                                                      bool accepts_dates) {
+  auto func = std::make_shared<ScalarFunction>(std::move(name), Arity::Unary(), doc);
+  if (accepts_dates) {
+    DCHECK_OK(func->AddKernel({date32()}, int64(),
+                              ScalarUnary<Int64Type, Date32Type, Op<Days>>::Exec));
+    DCHECK_OK(func->AddKernel(
+        {date64()}, int64(),
+        ScalarUnary<Int64Type, Date64Type, Op<std::chrono::milliseconds>>::Exec));
+  }
+  for (auto unit : AllTimeUnits()) {
+    InputType in_type(match::TimestampTypeUnit(unit));
+    auto exec = TimestampExec<TimestampComponent<Op>::template Exec>(unit);
+    DCHECK_OK(func->AddKernel({in_type}, int64(), RequireNoTimezone(std::move(exec))));
+  }
+  return func;
+}
+
+// ----------------------------------------------------------------------
+// Flooring to a multiple of a calendar unit
+
+// Floor to a multiple of a fixed-length interval, counted from `origin`
+template <typename Duration>
+struct FloorToInterval {
+  template <typename T, typename Arg0>
+  T Call(KernelContext*, Arg0 arg) const {
+    return static_cast<T>(FloorDiv(arg - origin, interval) * interval + origin);
+  }
+
+  int64_t interval;
+  int64_t origin;
+};
+
+// Floor to the first day of a multiple of months since the epoch
+template <typename Duration>
+struct FloorToMonths {
+  template <typename T, typename Arg0>
+  T Call(KernelContext*, Arg0 arg) const {
+    const CivilDate date = CivilFromDays(DaysOf<Duration>(arg));
+    int64_t months_since_epoch = (date.year - 1970) * 12 + date.month - 1;
+    months_since_epoch = FloorDiv(months_since_epoch, months) * months;
+    const int64_t years_since_epoch = FloorDiv(months_since_epoch, 12);
+    const int64_t month = months_since_epoch - years_since_epoch * 12 + 1;
+    return static_cast<T>(DaysFromCivil(1970 + years_since_epoch, month, 1) *
+                          UnitsPerDay<Duration>());
+  }
+
+  int64_t months;
+};
+
+int64_t UnitNanos(FloorTemporalOptions::Unit unit) {
+  switch (unit) {
+    case FloorTemporalOptions::NANOSECOND:
+      return 1;
+    case FloorTemporalOptions::MICROSECOND:
+      return 1000LL;
+    case FloorTemporalOptions::MILLISECOND:
+      return 1000000LL;
+    case FloorTemporalOptions::SECOND:
+      return 1000000000LL;
+    case FloorTemporalOptions::MINUTE:
+      return 60LL * 1000000000LL;
+    case FloorTemporalOptions::HOUR:
+      return 3600LL * 1000000000LL;
+    case FloorTemporalOptions::DAY:
+      return 86400LL * 1000000000LL;
+    case FloorTemporalOptions::WEEK:
+      return 7LL * 86400LL * 1000000000LL;
+    default:
+      // Not of a fixed length
+      return 0;
+  }
+}
+
+template <typename Type, typename Duration>
+struct FloorTemporal {
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const auto& options = OptionsWrapper<FloorTemporalOptions>::Get(ctx);
+    if (options.multiple <= 0) {
+      ctx->SetStatus(Status::Invalid("floor_temporal multiple must be positive, got ",
+                                     options.multiple));
+      return;
+    }
+
+    int64_t months = 0;
+    switch (options.unit) {
+      case FloorTemporalOptions::MONTH:
+        months = options.multiple;
+        break;
+      case FloorTemporalOptions::QUARTER:
+        months = options.multiple * 3;
+        break;
+      case FloorTemporalOptions::YEAR:
+        months = options.multiple * 12;
+        break;
+      default:
+        break;
+    }
+    if (months > 0) {
+      ScalarUnaryNotNullStateful<Type, Type, FloorToMonths<Duration>> kernel(
+          FloorToMonths<Duration>{months});
+      return kernel.Exec(ctx, batch, out);
+    }
+
+    int64_t interval_nanos;
+    if (MultiplyWithOverflow(UnitNanos(options.unit), options.multiple,
+                             &interval_nanos)) {
+      ctx->SetStatus(Status::Invalid("floor_temporal interval is too large"));
+      return;
+    }
+    int64_t interval = 1;
+    if (interval_nanos % NanosPerUnit<Duration>() == 0) {
+      interval = interval_nanos / NanosPerUnit<Duration>();
+    } else if (NanosPerUnit<Duration>() % interval_nanos != 0) {
+      // Otherwise all values are already multiples of the interval
+      ctx->SetStatus(Status::Invalid(
+          "floor_temporal interval is not a multiple of the resolution of ",
+          batch[0].type()->ToString()));
+      return;
+    }
+    // Weeks start on Monday 1969-12-29
+    const int64_t origin =
+        options.unit == FloorTemporalOptions::WEEK ? -3 * UnitsPerDay<Duration>() : 0;
+    ScalarUnaryNotNullStateful<Type, Type, FloorToInterval<Duration>> kernel(
+        FloorToInterval<Duration>{interval, origin});
+    kernel.Exec(ctx, batch, out);
+  }
+};
+
+template <typename Duration>
+using FloorTimestamp = FloorTemporal<TimestampType, Duration>;
+
+std::shared_ptr<ScalarFunction> MakeFloorTemporal(const FunctionDoc* doc) {
+  static auto default_options = FloorTemporalOptions::Defaults();
+  auto func = std::make_shared<ScalarFunction>("floor_temporal", Arity::Unary(), doc,
+                                               &default_options);
+  auto init = OptionsWrapper<FloorTemporalOptions>::Init;
+  DCHECK_OK(func->AddKernel({date32()}, OutputType(FirstType),
+                            FloorTemporal<Date32Type, Days>::Exec, init));
+  DCHECK_OK(func->AddKernel({date64()}, OutputType(FirstType),
+                            FloorTemporal<Date64Type, std::chrono::milliseconds>::Exec,
+                            init));
+  for (auto unit : AllTimeUnits()) {
+    InputType in_type(match::TimestampTypeUnit(unit));
+    auto exec = TimestampExec<FloorTimestamp>(unit);
+    DCHECK_OK(func->AddKernel({in_type}, OutputType(FirstType),
+                              RequireNoTimezone(std::move(exec)), init));
+  }
+  return func;
+}
+
+const FunctionDoc year_doc{
+    "Extract the year",
+    ("Null values emit null.\n"
+     "An error is returned for timestamps with a timezone."),
+    {"values"}};
+
+const FunctionDoc month_doc{
+    "Extract the month number",
+    ("Months are numbered from 1 (January) to 12 (December). Null values emit null.\n"
+     "An error is returned for timestamps with a timezone."),
+    {"values"}};
+
+const FunctionDoc day_doc{
+    "Extract the day of the month",
+    ("Days are numbered from 1. Null values emit null.\n"
+     "An error is returned for timestamps with a timezone."),
+    {"values"}};
+
+const FunctionDoc day_of_week_doc{
+    "Extract the day of the week",
+    ("Days are numbered from 0 (Monday) to 6 (Sunday). Null values emit null.\n"
+     "An error is returned for timestamps with a timezone."),
+    {"values"}};
+
+const FunctionDoc day_of_year_doc{
+    "Extract the day of the year",
+    ("Days are numbered from 1 (January 1st). Null values emit null.\n"
+     "An error is returned for timestamps with a timezone."),
+    {"values"}};
+
+const FunctionDoc quarter_doc{
+    "Extract the quarter of the year",
+    ("Quarters are numbered from 1 to 4. Null values emit null.\n"
+     "An error is returned for timestamps with a timezone."),
+    {"values"}};
+
+const FunctionDoc hour_doc{
+    "Extract the hour",
+    ("Null values emit null.\n"
+     "An error is returned for timestamps with a timezone."),
+    {"values"}};
+
+const FunctionDoc minute_doc{
+    "Extract the minute",
+    ("Null values emit null.\n"
+     "An error is returned for timestamps with a timezone."),
+    {"values"}};
+
+const FunctionDoc second_doc{
+    "Extract the second",
+    ("The fractional part of the second is not included. Null values emit null.\n"
+     "An error is returned for timestamps with a timezone."),
+    {"values"}};
+
+const FunctionDoc millisecond_doc{
+    "Extract the millisecond",
+    ("This is the number of milliseconds since the last full second.\n"
+     "Null values emit null.\n"
+     "An error is returned for timestamps with a timezone."),
+    {"values"}};
+
+const FunctionDoc microsecond_doc{
+    "Extract the microsecond",
+    ("This is the number of microseconds since the last full millisecond.\n"
+     "Null values emit null.\n"
+     "An error is returned for timestamps with a timezone."),
+    {"values"}};
+
+const FunctionDoc nanosecond_doc{
+    "Extract the nanosecond",
+    ("This is the number of nanoseconds since the last full microsecond.\n"
+     "Null values emit null.\n"
+     "An error is returned for timestamps with a timezone."),
+    {"values"}};
+
+const FunctionDoc floor_temporal_doc{
+    "Round temporal values down to a multiple of a calendar unit",
+    ("The multiples are counted from the UNIX epoch (1970-01-01), except for\n"
+     "weeks which start on Mondays. Null values emit null.\n"
+     "An error is returned for timestamps with a timezone."),
+    {"values"},
+    "FloorTemporalOptions"};
+
+}  // namespace
+
+void RegisterScalarTemporal(FunctionRegistry* registry) {
+  DCHECK_OK(registry->AddFunction(MakeTemporalComponent<Year>("year", &year_doc, true)));
+  DCHECK_OK(
+      registry->AddFunction(MakeTemporalComponent<Month>("month", &month_doc, true)));
+  DCHECK_OK(registry->AddFunction(MakeTemporalComponent<Day>("day", &day_doc, true)));
+  DCHECK_OK(registry->AddFunction(
+      MakeTemporalComponent<DayOfWeek>("day_of_week", &day_of_week_doc, true)));
+  DCHECK_OK(registry->AddFunction(
+      MakeTemporalComponent<DayOfYear>("day_of_year", &day_of_year_doc, true)));
+  DCHECK_OK(registry->AddFunction(
+      MakeTemporalComponent<Quarter>("quarter", &quarter_doc, true)));
+  DCHECK_OK(
+      registry->AddFunction(MakeTemporalComponent<Hour>("hour", &hour_doc, false)));
+  DCHECK_OK(registry->AddFunction(
+      MakeTemporalComponent<Minute>("minute", &minute_doc, false)));
+  DCHECK_OK(registry->AddFunction(
+      MakeTemporalComponent<Second>("second", &second_doc, false)));
+  DCHECK_OK(registry->AddFunction(
+      MakeTemporalComponent<Millisecond>("millisecond", &millisecond_doc, false)));
+  DCHECK_OK(registry->AddFunction(
+      MakeTemporalComponent<Microsecond>("microsecond", &microsecond_doc, false)));
+  DCHECK_OK(registry->AddFunction(
+      MakeTemporalComponent<Nanosecond>("nanosecond", &nanosecond_doc, false)));
+  DCHECK_OK(registry->AddFunction(MakeFloorTemporal(&floor_temporal_doc)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
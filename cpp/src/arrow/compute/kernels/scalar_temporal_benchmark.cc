@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/compute/api_scalar.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/benchmark_util.h"
+
+namespace arrow {
+namespace compute {
+constexpr auto kSeed = 0x0ff1ce;
+
+// Nanosecond timestamps spanning roughly 1700 to 2250
+static std::shared_ptr<Array> RandomTimestamps(const RegressionArgs& args,
+                                               int64_t* array_size) {
+  constexpr int64_t kMaxNanos = 8800000000LL * 1000000000LL;
+  *array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int64(*array_size, -kMaxNanos, kMaxNanos, args.null_proportion);
+  return *values->View(timestamp(TimeUnit::NANO));
+}
+
+static void YearTimestamp(benchmark::State& state) {
+  RegressionArgs args(state);
+  int64_t array_size;
+  auto values = RandomTimestamps(args, &array_size);
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(Year(values).status());
+  }
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
+static void HourTimestamp(benchmark::State& state) {
+  RegressionArgs args(state);
+  int64_t array_size;
+  auto values = RandomTimestamps(args, &array_size);
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(Hour(values).status());
+  }
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
+static void FloorTemporalTimestamp(benchmark::State& state,
+                                   FloorTemporalOptions options) {
+  RegressionArgs args(state);
+  int64_t array_size;
+  auto values = RandomTimestamps(args, &array_size);
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(FloorTemporal(values, options).status());
+  }
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
+static void FloorTimestampTo15Minutes(benchmark::State& state) {
+  FloorTemporalTimestamp(state, FloorTemporalOptions(15, FloorTemporalOptions::MINUTE));
+}
+
+static void FloorTimestampToMonth(benchmark::State& state) {
+  FloorTemporalTimestamp(state, FloorTemporalOptions(1, FloorTemporalOptions::MONTH));
+}
+
+BENCHMARK(YearTimestamp)
+    ->Apply(RegressionSetArgs)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+BENCHMARK(HourTimestamp)
+    ->Apply(RegressionSetArgs)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+BENCHMARK(FloorTimestampTo15Minutes)
+    ->Apply(RegressionSetArgs)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+BENCHMARK(FloorTimestampToMonth)
+    ->Apply(RegressionSetArgs)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,337 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/vendored/datetime.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace date = arrow_vendored::date;
+
+namespace {
+
+const char* kComponentFunctions[] = {
+    "year",   "month",       "day",         "day_of_week", "day_of_year",
+    "quarter", "hour",       "minute",      "second",      "millisecond",
+    "microsecond", "nanosecond"};
+
+void CheckComponent(const std::string& func_name, const std::shared_ptr<Array>& input,
+                    const std::string& expected_json) {
+  CheckScalarUnary(func_name, input, ArrayFromJSON(int64(), expected_json));
+}
+
+// The components of a timestamp, computed with the vendored date library
+template <typename Duration>
+std::vector<int64_t> ReferenceComponents(int64_t value) {
+  const date::sys_time<Duration> time{Duration(value)};
+  const auto days = date::floor<date::days>(time);
+  const date::year_month_day ymd(days);
+  const date::hh_mm_ss<std::chrono::nanoseconds> tod(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(time - days));
+  const auto year_start = date::sys_days(ymd.year() / 1 / 1);
+  const int64_t subsecond = tod.subseconds().count();
+  return {static_cast<int32_t>(ymd.year()),
+          static_cast<unsigned>(ymd.month()),
+          static_cast<unsigned>(ymd.day()),
+          (date::weekday(days).c_encoding() + 6) % 7,
+          (days - year_start).count() + 1,
+          (static_cast<unsigned>(ymd.month()) - 1) / 3 + 1,
+          tod.hours().count(),
+          tod.minutes().count(),
+          tod.seconds().count(),
+          subsecond / 1000000,
+          subsecond / 1000 % 1000,
+          subsecond % 1000};
+}
+
+std::vector<int64_t> ReferenceComponents(int64_t value, TimeUnit::type unit) {
+  switch (unit) {
+    case TimeUnit::SECOND:
+      return ReferenceComponents<std::chrono::seconds>(value);
+    case TimeUnit::MILLI:
+      return ReferenceComponents<std::chrono::milliseconds>(value);
+    case TimeUnit::MICRO:
+      return ReferenceComponents<std::chrono::microseconds>(value);
+    default:
+      return ReferenceComponents<std::chrono::nanoseconds>(value);
+  }
+}
+
+}  // namespace
+
+TEST(ScalarTemporalTest, TimestampComponents) {
+  const char* times = R"(["1970-01-01 00:00:59", "2000-02-29 23:23:23",
+                          "1899-01-01 00:59:20", "2033-05-18 03:33:20", null])";
+  for (auto unit : {TimeUnit::SECOND, TimeUnit::NANO}) {
+    auto input = ArrayFromJSON(timestamp(unit), times);
+    CheckComponent("year", input, "[1970, 2000, 1899, 2033, null]");
+    CheckComponent("month", input, "[1, 2, 1, 5, null]");
+    CheckComponent("day", input, "[1, 29, 1, 18, null]");
+    CheckComponent("day_of_week", input, "[3, 1, 6, 2, null]");
+    CheckComponent("day_of_year", input, "[1, 60, 1, 138, null]");
+    CheckComponent("quarter", input, "[1, 1, 1, 2, null]");
+    CheckComponent("hour", input, "[0, 23, 0, 3, null]");
+    CheckComponent("minute", input, "[0, 23, 59, 33, null]");
+    CheckComponent("second", input, "[59, 23, 20, 20, null]");
+    CheckComponent("millisecond", input, "[0, 0, 0, 0, null]");
+    CheckComponent("nanosecond", input, "[0, 0, 0, 0, null]");
+  }
+}
+
+TEST(ScalarTemporalTest, SubsecondComponents) {
+  // 1969-12-31 23:59:59.999999999 and 2009-02-13 23:31:30.123456789
+  auto input = ArrayFromJSON(timestamp(TimeUnit::NANO), "[-1, 1234567890123456789]");
+  CheckComponent("year", input, "[1969, 2009]");
+  CheckComponent("day", input, "[31, 13]");
+  CheckComponent("hour", input, "[23, 23]");
+  CheckComponent("minute", input, "[59, 31]");
+  CheckComponent("second", input, "[59, 30]");
+  CheckComponent("millisecond", input, "[999, 123]");
+  CheckComponent("microsecond", input, "[999, 456]");
+  CheckComponent("nanosecond", input, "[999, 789]");
+
+  input = ArrayFromJSON(timestamp(TimeUnit::MILLI), "[-1, 1234567890123]");
+  CheckComponent("second", input, "[59, 30]");
+  CheckComponent("millisecond", input, "[999, 123]");
+  CheckComponent("microsecond", input, "[0, 0]");
+}
+
+TEST(ScalarTemporalTest, DateComponents) {
+  // 1970-01-01, 1969-12-31, 2000-02-29 and 1600-03-01
+  auto date32_input = ArrayFromJSON(date32(), "[0, -1, 11016, -135080, null]");
+  auto date64_input = ArrayFromJSON(
+      date64(), "[0, -86400000, 951782400000, -11670912000000, null]");
+  for (auto input : {date32_input, date64_input}) {
+    CheckComponent("year", input, "[1970, 1969, 2000, 1600, null]");
+    CheckComponent("month", input, "[1, 12, 2, 3, null]");
+    CheckComponent("day", input, "[1, 31, 29, 1, null]");
+    CheckComponent("day_of_week", input, "[3, 2, 1, 2, null]");
+    CheckComponent("day_of_year", input, "[1, 365, 60, 61, null]");
+    CheckComponent("quarter", input, "[1, 4, 1, 1, null]");
+  }
+  ASSERT_RAISES(NotImplemented, CallFunction("hour", {date32_input}));
+}
+
+TEST(ScalarTemporalTest, RandomComponents) {
+  auto rand = random::RandomArrayGenerator(0x5487656);
+  // Roughly years -2000 to 4000 at a second resolution
+  const int64_t max_seconds = 64000000000LL;
+  for (auto unit :
+       {TimeUnit::SECOND, TimeUnit::MILLI, TimeUnit::MICRO, TimeUnit::NANO}) {
+    SCOPED_TRACE(unit);
+    int64_t max_value = max_seconds;
+    if (unit == TimeUnit::MILLI) max_value *= 1000;
+    if (unit == TimeUnit::MICRO) max_value *= 1000000;
+    if (unit == TimeUnit::NANO) max_value = std::numeric_limits<int64_t>::max();
+    auto values_array = rand.Int64(1000, -max_value, max_value, /*null_probability=*/0.1);
+    const auto& values = checked_cast<const Int64Array&>(*values_array);
+    ASSERT_OK_AND_ASSIGN(auto input, values.View(timestamp(unit)));
+
+    std::vector<std::vector<int64_t>> expected(12);
+    for (int64_t i = 0; i < values.length(); ++i) {
+      const auto components = ReferenceComponents(values.Value(i), unit);
+      for (size_t j = 0; j < components.size(); ++j) {
+        expected[j].push_back(components[j]);
+      }
+    }
+    for (size_t j = 0; j < expected.size(); ++j) {
+      SCOPED_TRACE(kComponentFunctions[j]);
+      ASSERT_OK_AND_ASSIGN(Datum out, CallFunction(kComponentFunctions[j], {input}));
+      const auto& actual = checked_cast<const Int64Array&>(*out.make_array());
+      for (int64_t i = 0; i < values.length(); ++i) {
+        ASSERT_EQ(values.IsValid(i), actual.IsValid(i));
+        if (values.IsValid(i)) {
+          ASSERT_EQ(expected[j][i], actual.Value(i)) << "value " << values.Value(i);
+        }
+      }
+    }
+  }
+}
+
+TEST(ScalarTemporalTest, TimezoneNotImplemented) {
+  auto input = ArrayFromJSON(timestamp(TimeUnit::SECOND, "UTC"), "[0]");
+  for (const char* func_name : kComponentFunctions) {
+    ASSERT_RAISES(NotImplemented, CallFunction(func_name, {input}));
+  }
+  ASSERT_RAISES(NotImplemented, FloorTemporal(input));
+}
+
+TEST(ScalarTemporalTest, FloorTemporal) {
+  auto input = ArrayFromJSON(timestamp(TimeUnit::SECOND),
+                             R"(["2021-03-17 13:47:59", "1969-12-31 23:22:01",
+                                 "2000-02-29 00:00:00", null])");
+  auto check = [&](int64_t multiple, FloorTemporalOptions::Unit unit,
+                   const std::string& expected) {
+    FloorTemporalOptions options(multiple, unit);
+    CheckScalarUnary("floor_temporal", input,
+                     ArrayFromJSON(timestamp(TimeUnit::SECOND), expected), &options);
+  };
+  check(1, FloorTemporalOptions::SECOND,
+        R"(["2021-03-17 13:47:59", "1969-12-31 23:22:01", "2000-02-29 00:00:00", null])");
+  check(15, FloorTemporalOptions::MINUTE,
+        R"(["2021-03-17 13:45:00", "1969-12-31 23:15:00", "2000-02-29 00:00:00", null])");
+  check(1, FloorTemporalOptions::HOUR,
+        R"(["2021-03-17 13:00:00", "1969-12-31 23:00:00", "2000-02-29 00:00:00", null])");
+  check(1, FloorTemporalOptions::DAY,
+        R"(["2021-03-17 00:00:00", "1969-12-31 00:00:00", "2000-02-29 00:00:00", null])");
+  // Weeks start on Mondays
+  check(1, FloorTemporalOptions::WEEK,
+        R"(["2021-03-15 00:00:00", "1969-12-29 00:00:00", "2000-02-28 00:00:00", null])");
+  check(1, FloorTemporalOptions::MONTH,
+        R"(["2021-03-01 00:00:00", "1969-12-01 00:00:00", "2000-02-01 00:00:00", null])");
+  // Multiples of months and years are counted from the epoch
+  check(5, FloorTemporalOptions::MONTH,
+        R"(["2020-11-01 00:00:00", "1969-08-01 00:00:00", "2000-01-01 00:00:00", null])");
+  check(1, FloorTemporalOptions::QUARTER,
+        R"(["2021-01-01 00:00:00", "1969-10-01 00:00:00", "2000-01-01 00:00:00", null])");
+  check(1, FloorTemporalOptions::YEAR,
+        R"(["2021-01-01 00:00:00", "1969-01-01 00:00:00", "2000-01-01 00:00:00", null])");
+  check(4, FloorTemporalOptions::YEAR,
+        R"(["2018-01-01 00:00:00", "1966-01-01 00:00:00", "1998-01-01 00:00:00", null])");
+  // Flooring to a finer unit than the resolution is a no-op
+  check(10, FloorTemporalOptions::MILLISECOND,
+        R"(["2021-03-17 13:47:59", "1969-12-31 23:22:01", "2000-02-29 00:00:00", null])");
+
+  auto nanos = ArrayFromJSON(timestamp(TimeUnit::NANO), "[-1, 1234567890123456789]");
+  FloorTemporalOptions options(1, FloorTemporalOptions::MICROSECOND);
+  CheckScalarUnary("floor_temporal", nanos,
+                   ArrayFromJSON(timestamp(TimeUnit::NANO),
+                                 "[-1000, 1234567890123456000]"),
+                   &options);
+  options = FloorTemporalOptions(1, FloorTemporalOptions::DAY);
+  CheckScalarUnary("floor_temporal", nanos,
+                   ArrayFromJSON(timestamp(TimeUnit::NANO),
+                                 "[-86400000000000, 1234483200000000000]"),
+                   &options);
+}
+
+TEST(ScalarTemporalTest, FloorTemporalDates) {
+  // 1970-01-01, 1969-12-31, 2000-02-29 and 1600-03-01
+  auto input = ArrayFromJSON(date32(), "[0, -1, 11016, -135080, null]");
+  FloorTemporalOptions options(1, FloorTemporalOptions::MONTH);
+  CheckScalarUnary("floor_temporal", input,
+                   ArrayFromJSON(date32(), "[0, -31, 10988, -135080, null]"), &options);
+  options = FloorTemporalOptions(1, FloorTemporalOptions::WEEK);
+  CheckScalarUnary("floor_temporal", input,
+                   ArrayFromJSON(date32(), "[-3, -3, 11015, -135082, null]"), &options);
+  options = FloorTemporalOptions(6, FloorTemporalOptions::HOUR);
+  CheckScalarUnary("floor_temporal", input, input, &options);
+
+  auto date64_input = ArrayFromJSON(date64(), "[0, -86400000, 951782400000, null]");
+  options = FloorTemporalOptions(1, FloorTemporalOptions::YEAR);
+  CheckScalarUnary("floor_temporal", date64_input,
+                   ArrayFromJSON(date64(), "[0, -31536000000, 946684800000, null]"),
+                   &options);
+}
+
+TEST(ScalarTemporalTest, FloorTemporalInvalid) {
+  auto input = ArrayFromJSON(timestamp(TimeUnit::SECOND), "[0]");
+  ASSERT_RAISES(Invalid, FloorTemporal(input, FloorTemporalOptions(0)));
+  ASSERT_RAISES(Invalid, FloorTemporal(input, FloorTemporalOptions(-1)));
+  // Not a multiple of a second
+  ASSERT_RAISES(Invalid,
+                FloorTemporal(input, FloorTemporalOptions(
+                                         1500, FloorTemporalOptions::MILLISECOND)));
+  // Overflows the interval in nanoseconds
+  ASSERT_RAISES(Invalid,
+                FloorTemporal(input, FloorTemporalOptions(int64_t(1) << 62,
+                                                          FloorTemporalOptions::WEEK)));
+  ASSERT_RAISES(Invalid,
+                FloorTemporal(ArrayFromJSON(date32(), "[0]"),
+                              FloorTemporalOptions(36, FloorTemporalOptions::HOUR)));
+}
+
+TEST(ScalarTemporalTest, RandomFloorTemporal) {
+  auto rand = random::RandomArrayGenerator(0x1f0bc1);
+  const int64_t max_seconds = 64000000000LL;
+  auto values_array =
+      rand.Int64(1000, -max_seconds, max_seconds, /*null_probability=*/0.1);
+  const auto& values = checked_cast<const Int64Array&>(*values_array);
+  ASSERT_OK_AND_ASSIGN(auto input, values.View(timestamp(TimeUnit::SECOND)));
+
+  for (auto unit : {FloorTemporalOptions::MINUTE, FloorTemporalOptions::DAY,
+                    FloorTemporalOptions::WEEK, FloorTemporalOptions::MONTH,
+                    FloorTemporalOptions::YEAR}) {
+    SCOPED_TRACE(unit);
+    ASSERT_OK_AND_ASSIGN(Datum out, FloorTemporal(input, FloorTemporalOptions(1, unit)));
+    const auto& actual = checked_cast<const TimestampArray&>(*out.make_array());
+    for (int64_t i = 0; i < values.length(); ++i) {
+      ASSERT_EQ(values.IsValid(i), actual.IsValid(i));
+      if (!values.IsValid(i)) continue;
+      const date::sys_seconds time{std::chrono::seconds(values.Value(i))};
+      const auto days = date::floor<date::days>(time);
+      const date::year_month_day ymd(days);
+      date::sys_seconds expected;
+      switch (unit) {
+        case FloorTemporalOptions::MINUTE:
+          expected = date::floor<std::chrono::minutes>(time);
+          break;
+        case FloorTemporalOptions::DAY:
+          expected = days;
+          break;
+        case FloorTemporalOptions::WEEK:
+          expected = days - (date::weekday(days) - date::Monday);
+          break;
+        case FloorTemporalOptions::MONTH:
+          expected = date::sys_days(ymd.year() / ymd.month() / 1);
+          break;
+        default:
+          expected = date::sys_days(ymd.year() / 1 / 1);
+          break;
+      }
+      ASSERT_EQ(expected.time_since_epoch().count(), actual.Value(i))
+          << "value " << values.Value(i);
+    }
+  }
+}
+
+TEST(ScalarTemporalTest, Scalars) {
+  FloorTemporalOptions options(1, FloorTemporalOptions::MONTH);
+  ASSERT_OK_AND_ASSIGN(auto scalar,
+                       Scalar::Parse(timestamp(TimeUnit::SECOND), "2021-03-17 13:47:59"));
+  ASSERT_OK_AND_ASSIGN(Datum out, Year(scalar));
+  AssertScalarsEqual(Int64Scalar(2021), *out.scalar());
+  ASSERT_OK_AND_ASSIGN(out, FloorTemporal(scalar, options));
+  ASSERT_OK_AND_ASSIGN(auto expected,
+                       Scalar::Parse(timestamp(TimeUnit::SECOND), "2021-03-01 00:00:00"));
+  AssertScalarsEqual(*expected, *out.scalar());
+  ASSERT_OK_AND_ASSIGN(out, Month(MakeNullScalar(timestamp(TimeUnit::SECOND))));
+  ASSERT_FALSE(out.scalar()->is_valid);
+}
+
+}  // namespace compute
+}  // namespace arrow
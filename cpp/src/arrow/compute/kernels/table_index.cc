@@ -0,0 +1,346 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/util.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/codegen_internal.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace internal {
+namespace {
+
+// NaNs compare unequal to everything, so they are never looked up
+template <typename T>
+bool IsNaN(const T&) {
+  return false;
+}
+
+bool IsNaN(float value) { return std::isnan(value); }
+
+bool IsNaN(double value) { return std::isnan(value); }
+
+template <typename Type>
+enable_if_has_c_type<Type, typename Type::c_type> ScalarValue(const Scalar& scalar) {
+  return checked_cast<const typename TypeTraits<Type>::ScalarType&>(scalar).value;
+}
+
+template <typename Type>
+enable_if_base_binary<Type, util::string_view> ScalarValue(const Scalar& scalar) {
+  return util::string_view(*checked_cast<const BaseBinaryScalar&>(scalar).value);
+}
+
+Status CheckType(const DataType& expected, const DataType& actual) {
+  if (!actual.Equals(expected)) {
+    return Status::TypeError("Index of type ", expected, " got values of type ", actual);
+  }
+  return Status::OK();
+}
+
+Result<std::shared_ptr<Array>> MakeIndices(TypedBufferBuilder<int64_t>* builder) {
+  const int64_t length = builder->length();
+  std::shared_ptr<Buffer> indices;
+  RETURN_NOT_OK(builder->Finish(&indices));
+  return MakeArray(
+      ArrayData::Make(int64(), length, {nullptr, std::move(indices)}, /*null_count=*/0));
+}
+
+template <typename Type>
+class HashIndexImpl : public HashIndex {
+ public:
+  using T = typename GetViewType<Type>::T;
+  using MemoTable = typename ::arrow::internal::HashTraits<Type>::MemoTableType;
+
+  using HashIndex::Append;
+
+  HashIndexImpl(std::shared_ptr<DataType> type, ExecContext ctx)
+      : type_(std::move(type)),
+        ctx_(std::move(ctx)),
+        memo_table_(ctx_.memory_pool(), 0) {}
+
+  Status Append(const Array& values) override {
+    RETURN_NOT_OK(CheckType(*type_, *values.type()));
+    int64_t row = num_rows();
+    next_rows_.resize(row + values.length(), kNoRow);
+    return VisitArrayDataInline<Type>(
+        *values.data(),
+        [&](T value) {
+          if (!IsNaN(value)) {
+            RETURN_NOT_OK(Insert(value, row));
+          }
+          ++row;
+          return Status::OK();
+        },
+        [&]() {
+          ++row;
+          return Status::OK();
+        });
+  }
+
+  Result<std::shared_ptr<Array>> Lookup(const Datum& keys) override {
+    ArrayDataVector key_chunks;
+    if (keys.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(auto key_array,
+                            MakeArrayFromScalar(*keys.scalar(), 1, ctx_.memory_pool()));
+      key_chunks.push_back(key_array->data());
+    } else if (keys.is_array()) {
+      key_chunks.push_back(keys.array());
+    } else if (keys.kind() == Datum::CHUNKED_ARRAY) {
+      for (const auto& chunk : keys.chunked_array()->chunks()) {
+        key_chunks.push_back(chunk->data());
+      }
+    } else {
+      return Status::Invalid("HashIndex keys must be array-like or scalar");
+    }
+
+    TypedBufferBuilder<int64_t> indices(ctx_.memory_pool());
+    for (const auto& key_chunk : key_chunks) {
+      RETURN_NOT_OK(CheckType(*type_, *key_chunk->type));
+      RETURN_NOT_OK(VisitArrayDataInline<Type>(
+          *key_chunk,
+          [&](T key) {
+            const int32_t key_id =
+                IsNaN(key) ? ::arrow::internal::kKeyNotFound : memo_table_.Get(key);
+            if (key_id == ::arrow::internal::kKeyNotFound) {
+              return Status::OK();
+            }
+            for (int64_t row = first_rows_[key_id]; row != kNoRow;
+                 row = next_rows_[row]) {
+              RETURN_NOT_OK(indices.Append(row));
+            }
+            return Status::OK();
+          },
+          [] { return Status::OK(); }));
+    }
+    return MakeIndices(&indices);
+  }
+
+  int64_t num_rows() const override { return static_cast<int64_t>(next_rows_.size()); }
+
+ private:
+  static constexpr int64_t kNoRow = -1;
+
+  Status Insert(T value, int64_t row) {
+    int32_t key_id;
+    RETURN_NOT_OK(memo_table_.GetOrInsert(value, &key_id));
+    if (key_id == static_cast<int32_t>(first_rows_.size())) {
+      first_rows_.push_back(row);
+      last_rows_.push_back(row);
+    } else {
+      next_rows_[last_rows_[key_id]] = row;
+      last_rows_[key_id] = row;
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> type_;
+  ExecContext ctx_;
+  MemoTable memo_table_;
+  // The rows holding the value with key id k are chained from first_rows_[k] to
+  // last_rows_[k] through next_rows_, in ascending order
+  std::vector<int64_t> first_rows_;
+  std::vector<int64_t> last_rows_;
+  std::vector<int64_t> next_rows_;
+};
+
+template <typename Type>
+constexpr int64_t HashIndexImpl<Type>::kNoRow;
+
+template <typename Type>
+class SortedIndexImpl : public SortedIndex {
+ public:
+  using T = typename GetViewType<Type>::T;
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+
+  using SortedIndex::Append;
+
+  SortedIndexImpl(std::shared_ptr<DataType> type, ExecContext ctx)
+      : type_(std::move(type)), ctx_(std::move(ctx)) {}
+
+  Status Append(const Array& values) override {
+    RETURN_NOT_OK(CheckType(*type_, *values.type()));
+    ARROW_ASSIGN_OR_RAISE(auto sorted_indices,
+                          SortIndices(values, SortOrder::Ascending, &ctx_));
+    const uint64_t* sorted = sorted_indices->data()->GetValues<uint64_t>(1);
+    const auto& typed_values = checked_cast<const ArrayType&>(values);
+
+    std::vector<Entry> appended;
+    appended.reserve(values.length() - values.null_count());
+    for (int64_t i = 0; i < values.length(); ++i) {
+      const int64_t index = static_cast<int64_t>(sorted[i]);
+      if (values.IsNull(index)) continue;
+      const T value = typed_values.GetView(index);
+      if (IsNaN(value)) continue;
+      appended.push_back({value, num_rows_ + index});
+    }
+
+    // The merge is stable, so rows with equal values stay in ascending order
+    if (entries_.empty()) {
+      entries_ = std::move(appended);
+    } else {
+      std::vector<Entry> merged;
+      merged.reserve(entries_.size() + appended.size());
+      std::merge(entries_.begin(), entries_.end(), appended.begin(), appended.end(),
+                 std::back_inserter(merged), ValueLess());
+      entries_ = std::move(merged);
+    }
+    // Keep binary values alive for the views held in entries_
+    chunks_.push_back(values.data());
+    num_rows_ += values.length();
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Array>> Range(const std::shared_ptr<Scalar>& lower,
+                                       const std::shared_ptr<Scalar>& upper,
+                                       bool lower_inclusive,
+                                       bool upper_inclusive) override {
+    TypedBufferBuilder<int64_t> indices(ctx_.memory_pool());
+    auto begin = entries_.begin();
+    auto end = entries_.end();
+    if (lower != nullptr) {
+      RETURN_NOT_OK(CheckType(*type_, *lower->type));
+      if (!lower->is_valid || IsNaN(ScalarValue<Type>(*lower))) {
+        return MakeIndices(&indices);
+      }
+      const Entry bound{ScalarValue<Type>(*lower), 0};
+      begin = lower_inclusive ? std::lower_bound(begin, end, bound, ValueLess())
+                              : std::upper_bound(begin, end, bound, ValueLess());
+    }
+    if (upper != nullptr) {
+      RETURN_NOT_OK(CheckType(*type_, *upper->type));
+      if (!upper->is_valid || IsNaN(ScalarValue<Type>(*upper))) {
+        return MakeIndices(&indices);
+      }
+      const Entry bound{ScalarValue<Type>(*upper), 0};
+      end = upper_inclusive ? std::upper_bound(begin, end, bound, ValueLess())
+                            : std::lower_bound(begin, end, bound, ValueLess());
+    }
+
+    if (begin < end) {
+      RETURN_NOT_OK(indices.Reserve(end - begin));
+      for (auto it = begin; it != end; ++it) {
+        indices.UnsafeAppend(it->row);
+      }
+    }
+    return MakeIndices(&indices);
+  }
+
+  int64_t num_rows() const override { return num_rows_; }
+
+ private:
+  struct Entry {
+    T value;
+    int64_t row;
+  };
+
+  struct ValueLess {
+    bool operator()(const Entry& left, const Entry& right) const {
+      return left.value < right.value;
+    }
+  };
+
+  std::shared_ptr<DataType> type_;
+  ExecContext ctx_;
+  ArrayDataVector chunks_;
+  int64_t num_rows_ = 0;
+  // The non-null, non-NaN values of the column with their rows, in ascending order
+  // of values then of rows
+  std::vector<Entry> entries_;
+};
+
+// Instantiate the implementation of an index for the type of a column
+template <typename Index, template <typename> class IndexImpl>
+struct IndexMaker {
+  template <typename T>
+  using enable_if_indexable =
+      enable_if_t<is_boolean_type<T>::value || is_number_type<T>::value ||
+                      (is_temporal_type<T>::value && !is_interval_type<T>::value) ||
+                      is_base_binary_type<T>::value,
+                  Status>;
+
+  template <typename T>
+  enable_if_indexable<T> Visit(const T&) {
+    out = ::arrow::internal::make_unique<IndexImpl<T>>(type, ctx);
+    return Status::OK();
+  }
+
+  Status Visit(const DataType&) {
+    return Status::NotImplemented("Indexing columns of type ", *type);
+  }
+
+  Result<std::unique_ptr<Index>> Make() && {
+    RETURN_NOT_OK(VisitTypeInline(*type, this));
+    return std::move(out);
+  }
+
+  std::shared_ptr<DataType> type;
+  ExecContext ctx;
+  std::unique_ptr<Index> out;
+};
+
+}  // namespace
+
+Result<std::unique_ptr<HashIndex>> HashIndex::Make(std::shared_ptr<DataType> type,
+                                                   ExecContext* ctx) {
+  return IndexMaker<HashIndex, HashIndexImpl>{std::move(type),
+                                              ctx != nullptr ? *ctx : ExecContext()}
+      .Make();
+}
+
+Status HashIndex::Append(const ChunkedArray& values) {
+  for (const auto& chunk : values.chunks()) {
+    RETURN_NOT_OK(Append(*chunk));
+  }
+  return Status::OK();
+}
+
+Result<std::unique_ptr<SortedIndex>> SortedIndex::Make(std::shared_ptr<DataType> type,
+                                                       ExecContext* ctx) {
+  return IndexMaker<SortedIndex, SortedIndexImpl>{std::move(type),
+                                                  ctx != nullptr ? *ctx : ExecContext()}
+      .Make();
+}
+
+Status SortedIndex::Append(const ChunkedArray& values) {
+  for (const auto& chunk : values.chunks()) {
+    RETURN_NOT_OK(Append(*chunk));
+  }
+  return Status::OK();
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
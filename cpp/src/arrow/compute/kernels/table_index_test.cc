@@ -0,0 +1,182 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+void AssertIndices(const Result<std::shared_ptr<Array>>& indices,
+                   const std::string& expected_json) {
+  ASSERT_OK(indices.status());
+  ASSERT_OK((*indices)->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(int64(), expected_json), **indices,
+                    /*verbose=*/true);
+}
+
+TEST(TestHashIndex, Lookup) {
+  ASSERT_OK_AND_ASSIGN(auto index, HashIndex::Make(int32()));
+  ASSERT_OK(index->Append(*ChunkedArrayFromJSON(int32(), {"[1, 2, null]", "[2, 3, 1]"})));
+  ASSERT_EQ(index->num_rows(), 6);
+
+  AssertIndices(index->Lookup(Datum(2)), "[1, 3]");
+  AssertIndices(index->Lookup(Datum(4)), "[]");
+  AssertIndices(index->Lookup(MakeNullScalar(int32())), "[]");
+  AssertIndices(index->Lookup(ArrayFromJSON(int32(), "[1, null, 4, 2, 1]")),
+                "[0, 5, 1, 3, 0, 5]");
+  AssertIndices(index->Lookup(ChunkedArrayFromJSON(int32(), {"[3]", "[]", "[1]"})),
+                "[4, 0, 5]");
+
+  // Appended rows follow the rows indexed so far
+  ASSERT_OK(index->Append(*ArrayFromJSON(int32(), "[null, 2, 4]")));
+  ASSERT_EQ(index->num_rows(), 9);
+  AssertIndices(index->Lookup(Datum(2)), "[1, 3, 7]");
+  AssertIndices(index->Lookup(Datum(4)), "[8]");
+}
+
+TEST(TestHashIndex, Types) {
+  ASSERT_OK_AND_ASSIGN(auto strings, HashIndex::Make(utf8()));
+  ASSERT_OK(strings->Append(*ArrayFromJSON(utf8(), R"(["a", "bc", "", null, "bc"])")));
+  AssertIndices(strings->Lookup(ArrayFromJSON(utf8(), R"(["bc", "", "b"])")),
+                "[1, 4, 2]");
+
+  ASSERT_OK_AND_ASSIGN(auto doubles, HashIndex::Make(float64()));
+  ASSERT_OK(doubles->Append(*ArrayFromJSON(float64(), "[1.5, -0.5, 1.5]")));
+  ASSERT_OK(doubles->Append(*ArrayFromJSON(float64(), "[2.5]")));
+  ASSERT_OK(doubles->Append(*ArrayFromJSON(float64(), "[]")));
+  AssertIndices(doubles->Lookup(Datum(1.5)), "[0, 2]");
+  // NaNs are never equal
+  ASSERT_OK(doubles->Append(*ArrayFromJSON(float64(), "[1.5]")));
+  std::shared_ptr<Array> nans;
+  ArrayFromVector<DoubleType>({std::nan("")}, &nans);
+  ASSERT_OK(doubles->Append(*nans));
+  AssertIndices(doubles->Lookup(nans), "[]");
+  AssertIndices(doubles->Lookup(Datum(1.5)), "[0, 2, 4]");
+
+  ASSERT_OK_AND_ASSIGN(auto booleans, HashIndex::Make(boolean()));
+  ASSERT_OK(booleans->Append(*ArrayFromJSON(boolean(), "[true, false, null, true]")));
+  AssertIndices(booleans->Lookup(Datum(true)), "[0, 3]");
+}
+
+TEST(TestHashIndex, Random) {
+  random::RandomArrayGenerator rng(42);
+  ASSERT_OK_AND_ASSIGN(auto index, HashIndex::Make(int32()));
+  std::vector<std::shared_ptr<Array>> chunks;
+  for (int i = 0; i < 5; ++i) {
+    chunks.push_back(rng.Int32(1000, 0, 100, /*null_probability=*/0.1));
+    ASSERT_OK(index->Append(*chunks.back()));
+  }
+
+  for (int32_t key = 0; key <= 100; ++key) {
+    std::vector<int64_t> expected;
+    int64_t row = 0;
+    for (const auto& chunk : chunks) {
+      const auto& values = ::arrow::internal::checked_cast<const Int32Array&>(*chunk);
+      for (int64_t i = 0; i < values.length(); ++i, ++row) {
+        if (values.IsValid(i) && values.Value(i) == key) expected.push_back(row);
+      }
+    }
+    ASSERT_OK_AND_ASSIGN(auto indices, index->Lookup(Datum(key)));
+    std::shared_ptr<Array> expected_indices;
+    ArrayFromVector<Int64Type>(expected, &expected_indices);
+    AssertArraysEqual(*expected_indices, *indices);
+  }
+}
+
+TEST(TestSortedIndex, Range) {
+  ASSERT_OK_AND_ASSIGN(auto index, SortedIndex::Make(int64()));
+  ASSERT_OK(
+      index->Append(*ChunkedArrayFromJSON(int64(), {"[5, 1, null, 3]", "[3, 7, 1]"})));
+  ASSERT_EQ(index->num_rows(), 7);
+
+  auto scalar = [](int64_t value) { return std::make_shared<Int64Scalar>(value); };
+  AssertIndices(index->Range(nullptr, nullptr), "[1, 6, 3, 4, 0, 5]");
+  AssertIndices(index->Range(scalar(2), scalar(5)), "[3, 4, 0]");
+  AssertIndices(index->Range(scalar(3), scalar(5), /*lower_inclusive=*/false,
+                             /*upper_inclusive=*/false),
+                "[]");
+  AssertIndices(index->Range(scalar(3), nullptr, /*lower_inclusive=*/false), "[0, 5]");
+  AssertIndices(index->Range(nullptr, scalar(3), true, /*upper_inclusive=*/false),
+                "[1, 6]");
+  AssertIndices(index->Range(scalar(6), scalar(2)), "[]");
+  AssertIndices(index->Range(MakeNullScalar(int64()), scalar(2)), "[]");
+
+  // Appended rows are merged with the rows indexed so far
+  ASSERT_OK(index->Append(*ArrayFromJSON(int64(), "[3, 0, null, 9]")));
+  ASSERT_EQ(index->num_rows(), 11);
+  AssertIndices(index->Range(nullptr, nullptr), "[8, 1, 6, 3, 4, 7, 0, 5, 10]");
+  AssertIndices(index->Range(scalar(3), scalar(3)), "[3, 4, 7]");
+
+  // Taking the indices gives the values of the range in sorted order
+  ASSERT_OK_AND_ASSIGN(auto indices, index->Range(scalar(1), scalar(5)));
+  ASSERT_OK_AND_ASSIGN(
+      auto taken,
+      Take(*ArrayFromJSON(int64(), "[5, 1, null, 3, 3, 7, 1, 3, 0, null, 9]"), *indices));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 1, 3, 3, 3, 5]"), *taken);
+}
+
+TEST(TestSortedIndex, Types) {
+  ASSERT_OK_AND_ASSIGN(auto strings, SortedIndex::Make(utf8()));
+  ASSERT_OK(strings->Append(*ArrayFromJSON(utf8(), R"(["b", "ab", null, "a"])")));
+  ASSERT_OK(strings->Append(*ArrayFromJSON(utf8(), R"(["abc", ""])")));
+  AssertIndices(strings->Range(std::make_shared<StringScalar>("a"),
+                               std::make_shared<StringScalar>("b"), true, false),
+                "[3, 1, 4]");
+
+  ASSERT_OK_AND_ASSIGN(auto doubles, SortedIndex::Make(float64()));
+  ASSERT_OK(doubles->Append(*ArrayFromJSON(float64(), "[2.5, null, -1.5, 0.5]")));
+  // NaNs are in no range
+  std::shared_ptr<Array> nans;
+  ArrayFromVector<DoubleType>({std::nan("")}, &nans);
+  ASSERT_OK(doubles->Append(*nans));
+  AssertIndices(doubles->Range(nullptr, nullptr), "[2, 3, 0]");
+  AssertIndices(doubles->Range(std::make_shared<DoubleScalar>(0), nullptr), "[3, 0]");
+  AssertIndices(doubles->Range(std::make_shared<DoubleScalar>(std::nan("")), nullptr),
+                "[]");
+}
+
+TEST(TestTableIndex, Errors) {
+  ASSERT_RAISES(NotImplemented, HashIndex::Make(list(int32())));
+  ASSERT_RAISES(NotImplemented, SortedIndex::Make(list(int32())));
+
+  ASSERT_OK_AND_ASSIGN(auto hash_index, HashIndex::Make(int32()));
+  ASSERT_RAISES(TypeError, hash_index->Append(*ArrayFromJSON(int64(), "[1]")));
+  ASSERT_RAISES(TypeError, hash_index->Lookup(Datum(static_cast<int64_t>(1))));
+
+  ASSERT_OK_AND_ASSIGN(auto sorted_index, SortedIndex::Make(int32()));
+  ASSERT_RAISES(TypeError, sorted_index->Append(*ArrayFromJSON(int64(), "[1]")));
+  ASSERT_RAISES(TypeError,
+                sorted_index->Range(std::make_shared<Int64Scalar>(1), nullptr));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
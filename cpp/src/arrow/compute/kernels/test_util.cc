@@ -154,5 +154,28 @@ void CheckScalarBinary(std::string func_name, std::shared_ptr<Array> left_input,
   CheckScalar(std::move(func_name), {left_input, right_input}, expected, options);
 }
 
+void CheckScalarSimdLevels(const std::string& func_name,
+                           const std::vector<Datum>& args) {
+  auto expected = ScalarFunctionAtSimdLevel(func_name, SimdLevel::NONE)
+                      ->Execute(args, /*options=*/nullptr, /*ctx=*/nullptr);
+  for (auto simd_level : {SimdLevel::AVX2, SimdLevel::AVX512}) {
+    auto func = ScalarFunctionAtSimdLevel(func_name, simd_level);
+    if (func->num_kernels() == 0) {
+      continue;
+    }
+    SCOPED_TRACE("simd_level = " + std::to_string(static_cast<int>(simd_level)));
+    auto actual = func->Execute(args, /*options=*/nullptr, /*ctx=*/nullptr);
+    if (!expected.ok()) {
+      ASSERT_EQ(expected.status().code(), actual.status().code()) << actual.status();
+      continue;
+    }
+    ASSERT_OK(actual.status());
+    if (actual.ValueOrDie().is_array()) {
+      ASSERT_OK(actual.ValueOrDie().make_array()->ValidateFull());
+    }
+    AssertDatumsEqual(expected.ValueOrDie(), actual.ValueOrDie(), /*verbose=*/true);
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -34,7 +34,9 @@
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 
+#include "arrow/compute/function.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/registry.h"
 
 // IWYU pragma: end_exports
 
@@ -90,6 +92,31 @@ struct DatumEqual<Type, enable_if_integer<Type>> {
   }
 };
 
+/// \brief Copy a scalar function, keeping only its kernels for the given SIMD level
+///
+/// This allows executing the kernels of any SIMD level supported by the CPU,
+/// rather than the preferred ones. The copy has no kernels if the CPU doesn't
+/// support the SIMD level.
+inline std::shared_ptr<ScalarFunction> ScalarFunctionAtSimdLevel(
+    const std::string& func_name, SimdLevel::type simd_level) {
+  auto func = checked_cast<const ScalarFunction*>(
+      GetFunctionRegistry()->GetFunction(func_name).ValueOrDie().get());
+  auto copy = std::make_shared<ScalarFunction>(func_name, func->arity(), &func->doc(),
+                                               func->default_options());
+  for (const ScalarKernel* kernel : func->kernels()) {
+    if (kernel->simd_level == simd_level) {
+      ScalarKernel kernel_copy = *kernel;
+      kernel_copy.simd_level = SimdLevel::NONE;
+      ARROW_EXPECT_OK(copy->AddKernel(std::move(kernel_copy)));
+    }
+  }
+  return copy;
+}
+
+/// \brief Check that the kernels for each SIMD level supported by the CPU
+/// give the same results, or errors, as the default kernels
+void CheckScalarSimdLevels(const std::string& func_name, const std::vector<Datum>& args);
+
 void CheckScalarUnary(std::string func_name, std::shared_ptr<DataType> in_ty,
                       std::string json_input, std::shared_ptr<DataType> out_ty,
                       std::string json_expected,
@@ -15,13 +15,16 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstring>
 #include <mutex>
+#include <vector>
 
 #include "arrow/array/array_base.h"
 #include "arrow/array/array_dict.h"
 #include "arrow/array/array_nested.h"
 #include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/array/dict_internal.h"
 #include "arrow/array/util.h"
 #include "arrow/compute/api_vector.h"
@@ -29,11 +32,16 @@
 #include "arrow/result.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
 using internal::DictionaryTraits;
 using internal::HashTraits;
+using internal::OptionalParallelFor;
+using internal::ParallelFor;
+using internal::ScalarHelper;
 
 namespace compute {
 namespace internal {
@@ -50,6 +58,14 @@ class ActionBase {
   MemoryPool* pool_;
 };
 
+std::shared_ptr<ArrayData> BoxValueCounts(const std::shared_ptr<ArrayData>& uniques,
+                                          const std::shared_ptr<ArrayData>& counts) {
+  auto data_type =
+      struct_({field(kValuesFieldName, uniques->type), field(kCountsFieldName, int64())});
+  ArrayVector children = {MakeArray(uniques), MakeArray(counts)};
+  return std::make_shared<StructArray>(data_type, uniques->length, children)->data();
+}
+
 // ----------------------------------------------------------------------
 // Unique
 
@@ -79,6 +95,11 @@ class UniqueAction final : public ActionBase {
   Status Flush(Datum* out) { return Status::OK(); }
 
   Status FlushFinal(Datum* out) { return Status::OK(); }
+
+  Status FlushBatch(std::shared_ptr<ArrayData> uniques, Datum* out) {
+    out->value = std::move(uniques);
+    return Status::OK();
+  }
 };
 
 // ----------------------------------------------------------------------
@@ -116,6 +137,14 @@ class ValueCountsAction final : ActionBase {
     return Status::OK();
   }
 
+  // Return the MemoTable keys boxed with their counts
+  Status FlushBatch(std::shared_ptr<ArrayData> uniques, Datum* out) {
+    Datum counts;
+    RETURN_NOT_OK(FlushFinal(&counts));
+    out->value = BoxValueCounts(uniques, counts.array());
+    return Status::OK();
+  }
+
   template <class Index>
   void ObserveNullFound(Index index) {
     count_builder_[index]++;
@@ -200,10 +229,40 @@ class DictEncodeAction final : public ActionBase {
 
   Status FlushFinal(Datum* out) { return Status::OK(); }
 
+  // Return the indices, with the MemoTable keys as their dictionary
+  Status FlushBatch(std::shared_ptr<ArrayData> uniques, Datum* out) {
+    RETURN_NOT_OK(Flush(out));
+    out->mutable_array()->dictionary = std::move(uniques);
+    return Status::OK();
+  }
+
  private:
   Int32Builder indices_builder_;
 };
 
+// The distinct values of all the batches hashed by a kernel
+struct Distinct {
+  std::shared_ptr<ArrayData> values;
+  // The number of occurrences of each value, for value_counts
+  std::shared_ptr<ArrayData> counts;
+  // The position in values of the memo indices of each batch hashed
+  // concurrently, unless the batch's memo indices are already positions in
+  // values (a single batch)
+  std::vector<std::vector<int32_t>> mappings;
+  // The position in values of each memo index, if values were sorted after
+  // hashing the batches serially
+  std::vector<int32_t> ranks;
+
+  // The mapping of the memo indices output for a batch to positions in values,
+  // null if they are the same
+  const std::vector<int32_t>* mapping(size_t batch) const {
+    if (!mappings.empty()) {
+      return &mappings[batch];
+    }
+    return ranks.empty() ? nullptr : &ranks;
+  }
+};
+
 class HashKernel : public KernelState {
  public:
   // Reset for another run.
@@ -228,8 +287,28 @@ class HashKernel : public KernelState {
   // data structures) and visit the given input with Action.
   virtual Status Append(const ArrayData& arr) = 0;
 
+  // Hash the given input into a memo table of its own rather than the
+  // kernel's, and output the Action's result for it along with its distinct
+  // values. Batches may thus be hashed concurrently, see MergeBatches.
+  virtual Status AppendBatch(const ArrayData& arr, Datum* out) = 0;
+
+  // Merge the distinct values (and their counts, if any) output by
+  // AppendBatch, in batch order, so that they are numbered in order of first
+  // occurrence in the whole input.
+  virtual Status MergeBatches(ExecContext* ctx, const ArrayDataVector& batch_values,
+                              const ArrayDataVector& batch_counts, Distinct* out) = 0;
+
+  const HashOptions& options() const { return options_; }
+  void set_options(const HashOptions& options) { options_ = options; }
+
+  // Whether batches are hashed by AppendBatch rather than Append
+  bool concurrent() const { return concurrent_; }
+  void set_concurrent(bool concurrent) { concurrent_ = concurrent; }
+
  protected:
   std::mutex lock_;
+  HashOptions options_;
+  bool concurrent_ = false;
 };
 
 // ----------------------------------------------------------------------
@@ -263,6 +342,138 @@ class RegularHashKernel : public HashKernel {
                                                           0 /* start_offset */, out);
   }
 
+  Status AppendBatch(const ArrayData& arr, Datum* out) override {
+    RegularHashKernel batch_kernel(type_, pool_);
+    RETURN_NOT_OK(batch_kernel.Reset());
+    RETURN_NOT_OK(batch_kernel.Append(arr));
+    std::shared_ptr<ArrayData> uniques;
+    RETURN_NOT_OK(batch_kernel.GetDictionary(&uniques));
+    return batch_kernel.action_.FlushBatch(std::move(uniques), out);
+  }
+
+  // The distinct values of the batches are partitioned by hash. Each partition
+  // is merged by a single task into a memo table of its own, so the partitions
+  // are merged in parallel without contention. The distinct values are then
+  // numbered by their first occurrence, and the batches' memo indices mapped
+  // to these numbers.
+  Status MergeBatches(ExecContext* ctx, const ArrayDataVector& batch_values,
+                      const ArrayDataVector& batch_counts, Distinct* out) override {
+    const int num_batches = static_cast<int>(batch_values.size());
+    const bool with_counts = !batch_counts.empty();
+    if (num_batches == 1) {
+      out->values = batch_values[0];
+      out->counts = with_counts ? batch_counts[0] : nullptr;
+      return Status::OK();
+    }
+
+    const int num_partitions = std::max(1, GetCpuThreadPoolCapacity());
+    std::vector<BatchValues> batches(num_batches);
+    RETURN_NOT_OK(ParallelFor(num_batches, [&](int i) {
+      batches[i].Partition(*batch_values[i], num_partitions);
+      return Status::OK();
+    }));
+
+    // The position in the output of each partition's memo indices
+    std::vector<std::vector<int32_t>> positions(num_partitions);
+    std::vector<std::vector<int64_t>> partition_counts(num_partitions);
+    RETURN_NOT_OK(ParallelFor(num_partitions, [&](int partition) {
+      MemoTable memo_table(pool_, 0);
+      auto& counts = partition_counts[partition];
+      for (int i = 0; i < num_batches; ++i) {
+        BatchValues& batch = batches[i];
+        const int64_t* value_counts =
+            with_counts ? batch_counts[i]->GetValues<int64_t>(1) : nullptr;
+        for (int32_t j : batch.by_partition[partition]) {
+          auto on_found = [](int32_t memo_index) {};
+          auto on_not_found = [&](int32_t memo_index) { batch.first[j] = 1; };
+          int32_t memo_index;
+          if (j == batch.null_position) {
+            memo_index = memo_table.GetOrInsertNull(on_found, on_not_found);
+          } else {
+            RETURN_NOT_OK(memo_table.GetOrInsert(batch.values[j], on_found,
+                                                 on_not_found, &memo_index));
+          }
+          batch.memo_indices[j] = memo_index;
+          if (!with_counts) {
+            continue;
+          }
+          if (memo_index == static_cast<int32_t>(counts.size())) {
+            counts.push_back(value_counts[j]);
+          } else {
+            counts[memo_index] += value_counts[j];
+          }
+        }
+      }
+      positions[partition].resize(memo_table.size());
+      return Status::OK();
+    }));
+
+    // Values first occurring in earlier batches come first, then values are in
+    // the order of the batch's memo indices
+    std::vector<int32_t> first_positions(num_batches + 1, 0);
+    std::vector<int64_t> batch_offsets(num_batches + 1, 0);
+    for (int i = 0; i < num_batches; ++i) {
+      const auto& first = batches[i].first;
+      first_positions[i + 1] =
+          first_positions[i] +
+          static_cast<int32_t>(std::count(first.begin(), first.end(), 1));
+      batch_offsets[i + 1] = batch_offsets[i] + batch_values[i]->length;
+    }
+    const int32_t num_values = first_positions[num_batches];
+    // The positions of the output values in the concatenated batches' values
+    ARROW_ASSIGN_OR_RAISE(auto take_indices,
+                          AllocateBuffer(num_values * sizeof(int64_t), pool_));
+    auto take_data = reinterpret_cast<int64_t*>(take_indices->mutable_data());
+    RETURN_NOT_OK(ParallelFor(num_batches, [&](int i) {
+      const BatchValues& batch = batches[i];
+      int32_t position = first_positions[i];
+      for (int32_t j = 0; j < batch.size(); ++j) {
+        if (batch.first[j]) {
+          positions[batch.partitions[j]][batch.memo_indices[j]] = position;
+          take_data[position++] = batch_offsets[i] + j;
+        }
+      }
+      return Status::OK();
+    }));
+
+    out->mappings.resize(num_batches);
+    RETURN_NOT_OK(ParallelFor(num_batches, [&](int i) {
+      const BatchValues& batch = batches[i];
+      auto& mapping = out->mappings[i];
+      mapping.resize(batch.size());
+      for (int32_t j = 0; j < batch.size(); ++j) {
+        mapping[j] = positions[batch.partitions[j]][batch.memo_indices[j]];
+      }
+      return Status::OK();
+    }));
+
+    if (with_counts) {
+      ARROW_ASSIGN_OR_RAISE(auto counts,
+                            AllocateBuffer(num_values * sizeof(int64_t), pool_));
+      auto counts_data = reinterpret_cast<int64_t*>(counts->mutable_data());
+      for (int partition = 0; partition < num_partitions; ++partition) {
+        const auto& partition_positions = positions[partition];
+        for (size_t k = 0; k < partition_positions.size(); ++k) {
+          counts_data[partition_positions[k]] = partition_counts[partition][k];
+        }
+      }
+      out->counts = ArrayData::Make(int64(), num_values, {nullptr, std::move(counts)},
+                                    /*null_count=*/0);
+    }
+
+    ArrayVector arrays;
+    for (const auto& values : batch_values) {
+      arrays.push_back(MakeArray(values));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto concatenated, Concatenate(arrays, pool_));
+    auto indices = ArrayData::Make(int64(), num_values,
+                                   {nullptr, std::move(take_indices)}, /*null_count=*/0);
+    ARROW_ASSIGN_OR_RAISE(
+        Datum values, Take(concatenated, indices, TakeOptions::NoBoundsCheck(), ctx));
+    out->values = values.array();
+    return Status::OK();
+  }
+
   std::shared_ptr<DataType> value_type() const override { return type_; }
 
   template <bool HasError = with_error_status>
@@ -336,6 +547,45 @@ class RegularHashKernel : public HashKernel {
  protected:
   using MemoTable = typename HashTraits<Type>::MemoTableType;
 
+  // The distinct values of a batch hashed by AppendBatch, partitioned by hash
+  struct BatchValues {
+    std::vector<Scalar> values;
+    int32_t null_position = -1;
+    std::vector<int32_t> partitions;
+    // The positions of the values of each partition
+    std::vector<std::vector<int32_t>> by_partition;
+    // The memo index of each value in its partition's memo table
+    std::vector<int32_t> memo_indices;
+    // Whether each value occurs first in this batch
+    std::vector<uint8_t> first;
+
+    int32_t size() const { return static_cast<int32_t>(values.size()); }
+
+    void Partition(const ArrayData& arr, int num_partitions) {
+      values.reserve(arr.length);
+      VisitArrayDataInline<Type>(
+          arr, [&](Scalar v) { values.push_back(v); },
+          [&]() {
+            null_position = size();
+            values.emplace_back();
+          });
+      partitions.resize(values.size());
+      by_partition.resize(num_partitions);
+      for (int32_t j = 0; j < size(); ++j) {
+        // Not the hash of the memo tables, whose buckets would otherwise
+        // correlate with the partitions
+        partitions[j] =
+            j == null_position
+                ? 0
+                : static_cast<int32_t>(ScalarHelper<Scalar, 1>::ComputeHash(values[j]) %
+                                       num_partitions);
+        by_partition[partitions[j]].push_back(j);
+      }
+      memo_indices.resize(values.size());
+      first.assign(values.size(), 0);
+    }
+  };
+
   MemoryPool* pool_;
   std::shared_ptr<DataType> type_;
   Action action_;
@@ -375,6 +625,15 @@ class NullHashKernel : public HashKernel {
     return Status::OK();
   }
 
+  Status AppendBatch(const ArrayData& arr, Datum* out) override {
+    return Status::NotImplemented("Hashing null arrays concurrently");
+  }
+
+  Status MergeBatches(ExecContext* ctx, const ArrayDataVector& batch_values,
+                      const ArrayDataVector& batch_counts, Distinct* out) override {
+    return Status::NotImplemented("Hashing null arrays concurrently");
+  }
+
   std::shared_ptr<DataType> value_type() const override { return type_; }
 
  protected:
@@ -417,6 +676,15 @@ class DictionaryHashKernel : public HashKernel {
     return indices_kernel_->GetDictionary(out);
   }
 
+  Status AppendBatch(const ArrayData& arr, Datum* out) override {
+    return Status::NotImplemented("Hashing dictionary arrays concurrently");
+  }
+
+  Status MergeBatches(ExecContext* ctx, const ArrayDataVector& batch_values,
+                      const ArrayDataVector& batch_counts, Distinct* out) override {
+    return Status::NotImplemented("Hashing dictionary arrays concurrently");
+  }
+
   std::shared_ptr<DataType> value_type() const override {
     return indices_kernel_->value_type();
   }
@@ -459,7 +727,15 @@ std::unique_ptr<HashKernel> HashInitImpl(KernelContext* ctx, const KernelInitArg
 
 template <typename Type, typename Action>
 std::unique_ptr<KernelState> HashInit(KernelContext* ctx, const KernelInitArgs& args) {
-  return std::move(HashInitImpl<Type, Action>(ctx, args));
+  auto result = HashInitImpl<Type, Action>(ctx, args);
+  if (args.options) {
+    result->set_options(static_cast<const HashOptions&>(*args.options));
+  }
+  // The executor hashes batches concurrently if threads are enabled, see
+  // VectorKernel::can_execute_concurrently
+  result->set_concurrent(ctx->exec_context()->use_threads() &&
+                         !std::is_same<Type, NullType>::value);
+  return std::move(result);
 }
 
 template <typename Action>
@@ -509,6 +785,11 @@ KernelInit GetHashInit(Type::type type_id) {
 template <typename Action>
 std::unique_ptr<KernelState> DictionaryHashInit(KernelContext* ctx,
                                                 const KernelInitArgs& args) {
+  if (args.options &&
+      static_cast<const HashOptions&>(*args.options).order != HashOptions::FIRST_SEEN) {
+    ctx->SetStatus(Status::NotImplemented("Sorting the unique values of dictionaries"));
+    return nullptr;
+  }
   const auto& dict_type = checked_cast<const DictionaryType&>(*args.inputs[0].type);
   std::unique_ptr<HashKernel> indices_hasher;
   switch (dict_type.index_type()->id()) {
@@ -533,45 +814,144 @@ std::unique_ptr<KernelState> DictionaryHashInit(KernelContext* ctx,
 
 void HashExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
   auto hash_impl = checked_cast<HashKernel*>(ctx->state());
+  if (hash_impl->concurrent()) {
+    KERNEL_RETURN_IF_ERROR(ctx, hash_impl->AppendBatch(*batch[0].array(), out));
+    return;
+  }
   KERNEL_RETURN_IF_ERROR(ctx, hash_impl->Append(ctx, *batch[0].array()));
   KERNEL_RETURN_IF_ERROR(ctx, hash_impl->Flush(out));
 }
 
+Status SortDistinct(ExecContext* ctx, Distinct* distinct) {
+  const int64_t length = distinct->values->length;
+  if (length <= 1) {
+    return Status::OK();
+  }
+  ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(*MakeArray(distinct->values),
+                                                  SortOrder::Ascending, ctx));
+  ARROW_ASSIGN_OR_RAISE(Datum values, Take(distinct->values, indices,
+                                           TakeOptions::NoBoundsCheck(), ctx));
+  distinct->values = values.array();
+  if (distinct->counts) {
+    ARROW_ASSIGN_OR_RAISE(Datum counts, Take(distinct->counts, indices,
+                                             TakeOptions::NoBoundsCheck(), ctx));
+    distinct->counts = counts.array();
+  }
+
+  std::vector<int32_t> ranks(length);
+  const uint64_t* sorted = indices->data()->GetValues<uint64_t>(1);
+  for (int32_t i = 0; i < static_cast<int32_t>(length); ++i) {
+    ranks[sorted[i]] = i;
+  }
+  if (distinct->mappings.empty()) {
+    distinct->ranks = std::move(ranks);
+  }
+  for (auto& mapping : distinct->mappings) {
+    for (auto& position : mapping) {
+      position = ranks[position];
+    }
+  }
+  return Status::OK();
+}
+
+// Get the distinct values of all batches in the requested order, merging the
+// batches' distinct values if they were hashed concurrently
+Status GetDistinct(KernelContext* ctx, const ArrayDataVector& batch_values,
+                   const ArrayDataVector& batch_counts, bool with_counts,
+                   Distinct* out) {
+  auto hash_impl = checked_cast<HashKernel*>(ctx->state());
+  if (hash_impl->concurrent() && !batch_values.empty()) {
+    RETURN_NOT_OK(
+        hash_impl->MergeBatches(ctx->exec_context(), batch_values, batch_counts, out));
+  } else {
+    RETURN_NOT_OK(hash_impl->GetDictionary(&out->values));
+    if (with_counts) {
+      Datum counts;
+      RETURN_NOT_OK(hash_impl->FlushFinal(&counts));
+      out->counts = counts.array();
+    }
+  }
+  if (hash_impl->options().order == HashOptions::SORTED) {
+    return SortDistinct(ctx->exec_context(), out);
+  }
+  return Status::OK();
+}
+
+// Replace the memo indices output for each batch by positions in the distinct
+// values
+Status RemapIndices(KernelContext* ctx, const Distinct& distinct,
+                    std::vector<Datum>* out) {
+  auto hash_impl = checked_cast<HashKernel*>(ctx->state());
+  return OptionalParallelFor(
+      hash_impl->concurrent() && out->size() > 1, static_cast<int>(out->size()),
+      [&](int i) -> Status {
+        const std::vector<int32_t>* mapping = distinct.mapping(i);
+        // Without a mapping, or distinct values, there is nothing to remap
+        if (mapping == nullptr || mapping->empty()) {
+          return Status::OK();
+        }
+        const ArrayData& indices = *(*out)[i].array();
+        ARROW_ASSIGN_OR_RAISE(
+            auto buffer,
+            AllocateBuffer(indices.length * sizeof(int32_t), ctx->memory_pool()));
+        const int32_t* memo_indices = indices.GetValues<int32_t>(1);
+        auto remapped = reinterpret_cast<int32_t*>(buffer->mutable_data());
+        // The memo index of nulls is 0, remapped like the others
+        for (int64_t j = 0; j < indices.length; ++j) {
+          remapped[j] = (*mapping)[memo_indices[j]];
+        }
+        (*out)[i] = ArrayData::Make(indices.type, indices.length,
+                                    {indices.buffers[0], std::move(buffer)},
+                                    indices.null_count, indices.offset);
+        return Status::OK();
+      });
+}
+
 void UniqueFinalize(KernelContext* ctx, std::vector<Datum>* out) {
   auto hash_impl = checked_cast<HashKernel*>(ctx->state());
-  std::shared_ptr<ArrayData> uniques;
-  KERNEL_RETURN_IF_ERROR(ctx, hash_impl->GetDictionary(&uniques));
-  *out = {Datum(uniques)};
+  ArrayDataVector batch_values;
+  if (hash_impl->concurrent()) {
+    for (const auto& batch_out : *out) {
+      batch_values.push_back(batch_out.array());
+    }
+  }
+  Distinct distinct;
+  KERNEL_RETURN_IF_ERROR(ctx, GetDistinct(ctx, batch_values, {}, false, &distinct));
+  *out = {Datum(distinct.values)};
 }
 
 void DictEncodeFinalize(KernelContext* ctx, std::vector<Datum>* out) {
   auto hash_impl = checked_cast<HashKernel*>(ctx->state());
-  std::shared_ptr<ArrayData> uniques;
-  KERNEL_RETURN_IF_ERROR(ctx, hash_impl->GetDictionary(&uniques));
-  auto dict_type = dictionary(int32(), uniques->type);
-  auto dict = MakeArray(uniques);
+  ArrayDataVector batch_values;
+  if (hash_impl->concurrent()) {
+    for (auto& batch_out : *out) {
+      batch_values.push_back(std::move(batch_out.mutable_array()->dictionary));
+    }
+  }
+  Distinct distinct;
+  KERNEL_RETURN_IF_ERROR(ctx, GetDistinct(ctx, batch_values, {}, false, &distinct));
+  KERNEL_RETURN_IF_ERROR(ctx, RemapIndices(ctx, distinct, out));
+  auto dict_type = dictionary(int32(), distinct.values->type);
+  auto dict = MakeArray(distinct.values);
   for (size_t i = 0; i < out->size(); ++i) {
     (*out)[i] =
         std::make_shared<DictionaryArray>(dict_type, (*out)[i].make_array(), dict);
   }
 }
 
-std::shared_ptr<ArrayData> BoxValueCounts(const std::shared_ptr<ArrayData>& uniques,
-                                          const std::shared_ptr<ArrayData>& counts) {
-  auto data_type =
-      struct_({field(kValuesFieldName, uniques->type), field(kCountsFieldName, int64())});
-  ArrayVector children = {MakeArray(uniques), MakeArray(counts)};
-  return std::make_shared<StructArray>(data_type, uniques->length, children)->data();
-}
-
 void ValueCountsFinalize(KernelContext* ctx, std::vector<Datum>* out) {
   auto hash_impl = checked_cast<HashKernel*>(ctx->state());
-  std::shared_ptr<ArrayData> uniques;
-  Datum value_counts;
-
-  KERNEL_RETURN_IF_ERROR(ctx, hash_impl->GetDictionary(&uniques));
-  KERNEL_RETURN_IF_ERROR(ctx, hash_impl->FlushFinal(&value_counts));
-  *out = {Datum(BoxValueCounts(uniques, value_counts.array()))};
+  ArrayDataVector batch_values, batch_counts;
+  if (hash_impl->concurrent()) {
+    for (const auto& batch_out : *out) {
+      batch_values.push_back(batch_out.array()->child_data[0]);
+      batch_counts.push_back(batch_out.array()->child_data[1]);
+    }
+  }
+  Distinct distinct;
+  KERNEL_RETURN_IF_ERROR(ctx,
+                         GetDistinct(ctx, batch_values, batch_counts, true, &distinct));
+  *out = {Datum(BoxValueCounts(distinct.values, distinct.counts))};
 }
 
 void UniqueFinalizeDictionary(KernelContext* ctx, std::vector<Datum>* out) {
@@ -607,8 +987,10 @@ void AddHashKernels(VectorFunction* func, VectorKernel base, OutputType out_ty)
   for (const auto& ty : PrimitiveTypes()) {
     base.init = GetHashInit<Action>(ty->id());
     base.signature = KernelSignature::Make({InputType::Array(ty)}, out_ty);
+    base.can_execute_concurrently = ty->id() != Type::NA;
     DCHECK_OK(func->AddKernel(base));
   }
+  base.can_execute_concurrently = true;
 
   // Example parametric types that we want to match only on Type::type
   auto parametric_types = {time32(TimeUnit::SECOND), time64(TimeUnit::MICRO),
@@ -640,6 +1022,8 @@ const FunctionDoc dictionary_encode_doc(
     "Dictionary-encode array",
     ("Return a dictionary-encoded version of the input array."), {"array"});
 
+const auto default_hash_options = HashOptions::Defaults();
+
 }  // namespace
 
 void RegisterVectorHash(FunctionRegistry* registry) {
@@ -651,7 +1035,8 @@ void RegisterVectorHash(FunctionRegistry* registry) {
 
   base.finalize = UniqueFinalize;
   base.output_chunked = false;
-  auto unique = std::make_shared<VectorFunction>("unique", Arity::Unary(), &unique_doc);
+  auto unique = std::make_shared<VectorFunction>("unique", Arity::Unary(), &unique_doc,
+                                                 &default_hash_options);
   AddHashKernels<UniqueAction>(unique.get(), base, OutputType(FirstType));
 
   // Dictionary unique
@@ -667,8 +1052,8 @@ void RegisterVectorHash(FunctionRegistry* registry) {
   // value_counts
 
   base.finalize = ValueCountsFinalize;
-  auto value_counts =
-      std::make_shared<VectorFunction>("value_counts", Arity::Unary(), &value_counts_doc);
+  auto value_counts = std::make_shared<VectorFunction>(
+      "value_counts", Arity::Unary(), &value_counts_doc, &default_hash_options);
   AddHashKernels<ValueCountsAction>(value_counts.get(), base,
                                     OutputType(ValueCountsOutput));
 
@@ -687,8 +1072,8 @@ void RegisterVectorHash(FunctionRegistry* registry) {
   base.finalize = DictEncodeFinalize;
   // Unique and ValueCounts output unchunked arrays
   base.output_chunked = true;
-  auto dict_encode = std::make_shared<VectorFunction>("dictionary_encode", Arity::Unary(),
-                                                      &dictionary_encode_doc);
+  auto dict_encode = std::make_shared<VectorFunction>(
+      "dictionary_encode", Arity::Unary(), &dictionary_encode_doc, &default_hash_options);
   AddHashKernels<DictEncodeAction>(dict_encode.get(), base, OutputType(DictEncodeOutput));
 
   // Calling dictionary_encode on dictionary input not supported, but if it
@@ -225,6 +225,82 @@ static void UniqueString100bytes(benchmark::State& state) {
   BenchUnique(state, HashParams<StringType>{general_bench_cases[state.range(0)], 100});
 }
 
+// Key distributions closer to real-world data than uniform draws
+enum KeyDistribution { kUniformKeys, kZipfKeys, kNearlySortedKeys, kClusteredNullKeys };
+
+std::shared_ptr<Array> MakeInt64Keys(int distribution, int64_t num_unique) {
+  random::RandomArrayGenerator rng(0x5eed);
+  switch (distribution) {
+    case kZipfKeys:
+      return rng.ZipfInt64(kHashBenchmarkLength, num_unique, /*exponent=*/1.1);
+    case kNearlySortedKeys:
+      return rng.SortedRunsInt64(kHashBenchmarkLength, 0, num_unique - 1,
+                                 /*num_runs=*/1, /*disorder=*/0.01);
+    case kClusteredNullKeys:
+      return rng.WithClusteredNulls(
+          *rng.Int64(kHashBenchmarkLength, 0, num_unique - 1),
+          /*null_probability=*/0.2, /*mean_null_run_length=*/1000);
+    default:
+      return rng.Int64(kHashBenchmarkLength, 0, num_unique - 1);
+  }
+}
+
+template <typename Operation>
+void BenchInt64Distribution(benchmark::State& state, Operation&& operation) {
+  const auto arr = MakeInt64Keys(static_cast<int>(state.range(0)), state.range(1));
+  for (auto _ : state) {
+    ABORT_NOT_OK(operation(arr).status());
+  }
+  state.counters["null_percent"] =
+      static_cast<double>(arr->null_count()) / arr->length() * 100;
+  state.SetBytesProcessed(state.iterations() * arr->length() * sizeof(int64_t));
+  state.SetItemsProcessed(state.iterations() * arr->length());
+}
+
+static void UniqueInt64Distribution(benchmark::State& state) {
+  BenchInt64Distribution(state, [](const std::shared_ptr<Array>& arr) {
+    return Unique(arr);
+  });
+}
+
+static void DictionaryEncodeInt64Distribution(benchmark::State& state) {
+  BenchInt64Distribution(state, [](const std::shared_ptr<Array>& arr) {
+    return DictionaryEncode(arr);
+  });
+}
+
+// High-cardinality strings sharing long prefixes (URLs, file paths...), either
+// plain or already dictionary-encoded
+template <bool kDictionaryEncoded>
+static void UniqueStringPrefixes(benchmark::State& state) {
+  random::RandomArrayGenerator rng(0x5eed);
+  const int64_t num_unique = state.range(0);
+  const auto arr =
+      kDictionaryEncoded
+          ? rng.DictionaryStringWithPrefixes(kHashBenchmarkLength, num_unique,
+                                             /*num_prefixes=*/16, /*prefix_length=*/24,
+                                             /*min_suffix_length=*/4,
+                                             /*max_suffix_length=*/16)
+          : rng.StringWithPrefixes(kHashBenchmarkLength, num_unique,
+                                   /*num_prefixes=*/16, /*prefix_length=*/24,
+                                   /*min_suffix_length=*/4, /*max_suffix_length=*/16);
+  for (auto _ : state) {
+    ABORT_NOT_OK(Unique(arr).status());
+  }
+  state.counters["num_unique"] = static_cast<double>(num_unique);
+  state.SetItemsProcessed(state.iterations() * arr->length());
+}
+
+void DistributionSetArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"distribution", "num_unique"});
+  for (const int distribution :
+       {kUniformKeys, kZipfKeys, kNearlySortedKeys, kClusteredNullKeys}) {
+    for (const int64_t num_unique : {100, 100000}) {
+      bench->Args({distribution, num_unique});
+    }
+  }
+}
+
 void HashSetArgs(benchmark::internal::Benchmark* bench) {
   for (int i = 0; i < static_cast<int>(general_bench_cases.size()); ++i) {
     bench->Arg(i);
@@ -238,6 +314,11 @@ BENCHMARK(UniqueInt64)->Apply(HashSetArgs);
 BENCHMARK(UniqueString10bytes)->Apply(HashSetArgs);
 BENCHMARK(UniqueString100bytes)->Apply(HashSetArgs);
 
+BENCHMARK(UniqueInt64Distribution)->Apply(DistributionSetArgs);
+BENCHMARK(DictionaryEncodeInt64Distribution)->Apply(DistributionSetArgs);
+BENCHMARK_TEMPLATE(UniqueStringPrefixes, false)->Arg(1000)->Arg(1000000);
+BENCHMARK_TEMPLATE(UniqueStringPrefixes, true)->Arg(1000)->Arg(1000000);
+
 void UInt8SetArgs(benchmark::internal::Benchmark* bench) {
   for (int i = 0; i < static_cast<int>(uint8_bench_cases.size()); ++i) {
     bench->Arg(i);
@@ -34,6 +34,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_common.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
@@ -677,5 +678,103 @@ TEST_F(TestHashKernel, ChunkedArrayZeroChunk) {
                      *result_datum.chunked_array());
 }
 
+TEST_F(TestHashKernel, Sorted) {
+  HashOptions sorted(HashOptions::SORTED);
+  auto input = ArrayFromJSON(utf8(), R"(["c", null, "a", "c", "b", null, "a", "c"])");
+
+  ASSERT_OK_AND_ASSIGN(auto uniques, Unique(input, sorted));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", "b", "c", null])"), *uniques);
+
+  ASSERT_OK_AND_ASSIGN(auto counts, ValueCounts(input, sorted));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", "b", "c", null])"),
+                    *counts->field(kValuesFieldIndex));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[2, 1, 3, 2]"),
+                    *counts->field(kCountsFieldIndex));
+
+  ASSERT_OK_AND_ASSIGN(auto chunked, ChunkedArray::Make({input->Slice(0, 3),
+                                                         input->Slice(3)}));
+  ASSERT_OK_AND_ASSIGN(Datum encoded, DictionaryEncode(chunked, sorted));
+  auto dict = ArrayFromJSON(utf8(), R"(["a", "b", "c"])");
+  auto dict_type = dictionary(int32(), utf8());
+  AssertChunkedEqual(
+      ChunkedArray({std::make_shared<DictionaryArray>(
+                        dict_type, ArrayFromJSON(int32(), "[2, null, 0]"), dict),
+                    std::make_shared<DictionaryArray>(
+                        dict_type, ArrayFromJSON(int32(), "[2, 1, null, 0, 2]"), dict)}),
+      *encoded.chunked_array());
+
+  auto dict_input = DictArrayFromJSON(dict_type, "[2, 0]", R"(["a", "b", "c"])");
+  ASSERT_RAISES(NotImplemented, Unique(dict_input, sorted));
+}
+
+class TestHashKernelConcurrent : public ::testing::TestWithParam<HashOptions::Order> {
+ protected:
+  // Hashing the chunks concurrently gives the same output as hashing them serially
+  void CheckConcurrent(const std::shared_ptr<ChunkedArray>& chunked) {
+    HashOptions options(GetParam());
+    ExecContext serial_ctx, threaded_ctx;
+    serial_ctx.set_use_threads(false);
+    threaded_ctx.set_use_threads(true);
+
+    ASSERT_OK_AND_ASSIGN(auto expected_uniques, Unique(chunked, options, &serial_ctx));
+    ASSERT_OK_AND_ASSIGN(auto uniques, Unique(chunked, options, &threaded_ctx));
+    ASSERT_OK(uniques->ValidateFull());
+    AssertArraysEqual(*expected_uniques, *uniques);
+
+    ASSERT_OK_AND_ASSIGN(auto expected_counts,
+                         ValueCounts(chunked, options, &serial_ctx));
+    ASSERT_OK_AND_ASSIGN(auto counts, ValueCounts(chunked, options, &threaded_ctx));
+    ASSERT_OK(counts->ValidateFull());
+    AssertArraysEqual(*expected_counts, *counts);
+
+    ASSERT_OK_AND_ASSIGN(Datum expected_encoded,
+                         DictionaryEncode(chunked, options, &serial_ctx));
+    ASSERT_OK_AND_ASSIGN(Datum encoded,
+                         DictionaryEncode(chunked, options, &threaded_ctx));
+    ASSERT_OK(encoded.chunked_array()->ValidateFull());
+    AssertChunkedEqual(*expected_encoded.chunked_array(), *encoded.chunked_array());
+
+    if (GetParam() == HashOptions::SORTED) {
+      ASSERT_OK_AND_ASSIGN(auto indices, SortIndices(*uniques));
+      ASSERT_OK_AND_ASSIGN(Datum sorted, Take(uniques, indices));
+      AssertArraysEqual(*sorted.make_array(), *uniques);
+    }
+  }
+};
+
+TEST_P(TestHashKernelConcurrent, Strings) {
+  random::RandomArrayGenerator rng(42);
+  // Values repeated across chunks, and values unique to a chunk
+  auto values = rng.StringWithRepeats(20000, /*unique=*/500, /*min_length=*/0,
+                                      /*max_length=*/8, /*null_probability=*/0.01);
+  ArrayVector chunks;
+  for (int64_t offset = 0; offset < values->length(); offset += 1000 + offset / 10) {
+    chunks.push_back(values->Slice(offset, 1000 + offset / 10));
+  }
+  chunks.push_back(rng.String(100, 10, 12, /*null_probability=*/0));
+  CheckConcurrent(std::make_shared<ChunkedArray>(chunks));
+}
+
+TEST_P(TestHashKernelConcurrent, Numbers) {
+  random::RandomArrayGenerator rng(42);
+  for (const auto& values :
+       {rng.Int64(20000, -1000, 1000, /*null_probability=*/0.01),
+        rng.Float64(20000, -1, 1, /*null_probability=*/0),
+        rng.Int8(20000, -100, 100, /*null_probability=*/0.5)}) {
+    ArrayVector chunks;
+    for (int64_t offset = 0; offset < values->length(); offset += 3000) {
+      chunks.push_back(values->Slice(offset, 3000));
+    }
+    // An all-null chunk, which has no distinct values when dictionary encoded
+    ASSERT_OK_AND_ASSIGN(auto nulls, MakeArrayOfNull(values->type(), 10));
+    chunks.insert(chunks.begin() + 2, nulls);
+    CheckConcurrent(std::make_shared<ChunkedArray>(chunks));
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(HashOrder, TestHashKernelConcurrent,
+                         ::testing::Values(HashOptions::FIRST_SEEN,
+                                           HashOptions::SORTED));
+
 }  // namespace compute
 }  // namespace arrow
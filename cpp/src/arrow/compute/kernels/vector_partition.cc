@@ -0,0 +1,181 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/data.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/compute/kernels/scalar_hash_internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// hash_partition implementation
+
+// Partition `length` rows by the hashes of their keys. Each key column is
+// given as a sequence of chunks spanning all rows.
+Result<Datum> PartitionByHash(const std::vector<ArrayVector>& keys, int64_t length,
+                              int32_t num_partitions, ExecContext* ctx) {
+  if (length > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("hash_partition input has ", length,
+                                 " rows, exceeding the list offset range");
+  }
+  std::vector<uint64_t> hashes(length);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    int64_t offset = 0;
+    for (const auto& chunk : keys[i]) {
+      RETURN_NOT_OK(HashArrayData(*chunk->data(), i > 0, hashes.data() + offset));
+      offset += chunk->length();
+    }
+    DCHECK_EQ(offset, length);
+  }
+
+  // Counting sort of the row indices by partition, preserving row order
+  // inside each partition
+  ARROW_ASSIGN_OR_RAISE(auto offsets_buffer,
+                        AllocateBuffer((num_partitions + 1) * sizeof(int32_t),
+                                       ctx->memory_pool()));
+  auto offsets = reinterpret_cast<int32_t*>(offsets_buffer->mutable_data());
+  std::fill(offsets, offsets + num_partitions + 1, 0);
+  for (auto& hash : hashes) {
+    hash %= static_cast<uint64_t>(num_partitions);
+    ++offsets[hash + 1];
+  }
+  for (int32_t i = 0; i < num_partitions; ++i) {
+    offsets[i + 1] += offsets[i];
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
+                        AllocateBuffer(length * sizeof(int64_t), ctx->memory_pool()));
+  auto indices = reinterpret_cast<int64_t*>(indices_buffer->mutable_data());
+  std::vector<int32_t> cursors(offsets, offsets + num_partitions);
+  for (int64_t i = 0; i < length; ++i) {
+    indices[cursors[hashes[i]]++] = i;
+  }
+
+  auto values = ArrayData::Make(int64(), length, {nullptr, std::move(indices_buffer)},
+                                /*null_count=*/0);
+  auto out = ArrayData::Make(list(int64()), num_partitions,
+                             {nullptr, std::move(offsets_buffer)}, /*null_count=*/0);
+  out->child_data.push_back(std::move(values));
+  return Datum(std::move(out));
+}
+
+ArrayVector ColumnChunks(const RecordBatch& batch, int index) {
+  return {batch.column(index)};
+}
+
+ArrayVector ColumnChunks(const Table& table, int index) {
+  return table.column(index)->chunks();
+}
+
+template <typename TableLike>
+Result<std::vector<ArrayVector>> ResolvePartitionKeys(
+    const TableLike& table, const std::vector<std::string>& key_names) {
+  if (key_names.empty()) {
+    return Status::Invalid("hash_partition requires key columns for ",
+                           "record batch or table input");
+  }
+  std::vector<ArrayVector> keys;
+  for (const auto& name : key_names) {
+    const int index = table.schema()->GetFieldIndex(name);
+    if (index < 0) {
+      return Status::Invalid("Nonexistent partition key column: ", name);
+    }
+    keys.push_back(ColumnChunks(table, index));
+  }
+  return keys;
+}
+
+const FunctionDoc hash_partition_doc(
+    "Assign rows to partitions by hashing their keys",
+    ("This function assigns each row of the input to one of the number of\n"
+     "partitions given in HashPartitionOptions, according to the hash of its\n"
+     "key.  Equal keys, including nulls, are assigned the same partition.\n"
+     "The output is a list<int64> array holding the row indices assigned to\n"
+     "each partition, in increasing order.  The key of an array or chunked\n"
+     "array is its values; the key columns of a record batch or table are\n"
+     "named in HashPartitionOptions."),
+    {"input"}, "HashPartitionOptions");
+
+class HashPartitionMetaFunction : public MetaFunction {
+ public:
+  HashPartitionMetaFunction()
+      : MetaFunction("hash_partition", Arity::Unary(), &hash_partition_doc) {}
+
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const FunctionOptions* options,
+                            ExecContext* ctx) const override {
+    if (options == nullptr) {
+      return Status::Invalid("hash_partition requires HashPartitionOptions");
+    }
+    const auto& partition_options = static_cast<const HashPartitionOptions&>(*options);
+    if (partition_options.num_partitions < 1) {
+      return Status::Invalid("hash_partition requires a positive number of partitions",
+                             ", got ", partition_options.num_partitions);
+    }
+    const int32_t num_partitions = partition_options.num_partitions;
+
+    switch (args[0].kind()) {
+      case Datum::ARRAY:
+        return PartitionByHash({{args[0].make_array()}}, args[0].length(),
+                               num_partitions, ctx);
+      case Datum::CHUNKED_ARRAY:
+        return PartitionByHash({args[0].chunked_array()->chunks()}, args[0].length(),
+                               num_partitions, ctx);
+      case Datum::RECORD_BATCH: {
+        const auto& batch = *args[0].record_batch();
+        ARROW_ASSIGN_OR_RAISE(auto keys,
+                              ResolvePartitionKeys(batch, partition_options.key_names));
+        return PartitionByHash(keys, batch.num_rows(), num_partitions, ctx);
+      }
+      case Datum::TABLE: {
+        const auto& table = *args[0].table();
+        ARROW_ASSIGN_OR_RAISE(auto keys,
+                              ResolvePartitionKeys(table, partition_options.key_names));
+        return PartitionByHash(keys, table.num_rows(), num_partitions, ctx);
+      }
+      default:
+        break;
+    }
+    return Status::NotImplemented(
+        "Unsupported types for hash_partition operation: "
+        "values=",
+        args[0].ToString());
+  }
+};
+
+}  // namespace
+
+void RegisterVectorPartition(FunctionRegistry* registry) {
+  DCHECK_OK(registry->AddFunction(std::make_shared<HashPartitionMetaFunction>()));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
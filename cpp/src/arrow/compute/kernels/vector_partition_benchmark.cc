@@ -19,6 +19,7 @@
 
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/test_util.h"
+#include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/benchmark_util.h"
@@ -55,5 +56,54 @@ BENCHMARK(NthToIndicesInt64)
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+static void HashPartitionBenchmark(benchmark::State& state,
+                                   const std::shared_ptr<RecordBatch>& batch,
+                                   const HashPartitionOptions& options) {
+  for (auto _ : state) {
+    ABORT_NOT_OK(HashPartition(*batch, options).status());
+  }
+  state.SetItemsProcessed(state.iterations() * batch->num_rows());
+}
+
+static void HashPartitionInt64(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t num_rows = args.size / (2 * sizeof(int64_t));
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto batch = RecordBatch::Make(
+      schema({field("key", int64()), field("value", int64())}), num_rows,
+      {rand.Int64(num_rows, 0, 1 << 20, args.null_proportion),
+       rand.Int64(num_rows, 0, 1 << 20, args.null_proportion)});
+
+  HashPartitionBenchmark(state, batch, HashPartitionOptions(64, {"key"}));
+}
+
+static void HashPartitionStringInt64(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t num_rows = args.size / 32;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto batch = RecordBatch::Make(
+      schema({field("s", utf8()), field("i", int64()), field("value", float64())}),
+      num_rows,
+      {rand.String(num_rows, 4, 12, args.null_proportion),
+       rand.Int64(num_rows, 0, 100, args.null_proportion),
+       rand.Float64(num_rows, -1, 1, args.null_proportion)});
+
+  HashPartitionBenchmark(state, batch, HashPartitionOptions(64, {"s", "i"}));
+}
+
+BENCHMARK(HashPartitionInt64)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(HashPartitionStringInt64)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,174 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+// Check that every row is assigned exactly one partition, in increasing row
+// order, and return each row's partition
+std::vector<int32_t> CheckPartitionIndices(const ListArray& partitions,
+                                           int32_t num_partitions, int64_t length) {
+  ARROW_EXPECT_OK(partitions.ValidateFull());
+  EXPECT_EQ(partitions.length(), num_partitions);
+  EXPECT_EQ(partitions.null_count(), 0);
+  std::vector<int32_t> row_partitions(length, -1);
+  for (int32_t p = 0; p < num_partitions; ++p) {
+    const auto& indices = checked_cast<const Int64Array&>(*partitions.value_slice(p));
+    for (int64_t i = 0; i < indices.length(); ++i) {
+      if (i > 0) {
+        EXPECT_LT(indices.Value(i - 1), indices.Value(i));
+      }
+      EXPECT_EQ(row_partitions[indices.Value(i)], -1);
+      row_partitions[indices.Value(i)] = p;
+    }
+  }
+  for (int32_t p : row_partitions) {
+    EXPECT_NE(p, -1);
+  }
+  return row_partitions;
+}
+
+TEST(HashPartition, EqualKeysSamePartition) {
+  auto values = ArrayFromJSON(utf8(), R"(["a", "b", null, "a", "c", null, "b", "a"])");
+  ASSERT_OK_AND_ASSIGN(auto partitions,
+                       HashPartitionIndices(values, HashPartitionOptions(3)));
+  auto row_partitions = CheckPartitionIndices(*partitions, 3, values->length());
+  ASSERT_EQ(row_partitions[0], row_partitions[3]);
+  ASSERT_EQ(row_partitions[0], row_partitions[7]);
+  ASSERT_EQ(row_partitions[1], row_partitions[6]);
+  ASSERT_EQ(row_partitions[2], row_partitions[5]);
+}
+
+TEST(HashPartition, SinglePartition) {
+  auto values = ArrayFromJSON(int32(), "[3, null, 1]");
+  ASSERT_OK_AND_ASSIGN(auto partitions,
+                       HashPartitionIndices(values, HashPartitionOptions(1)));
+  AssertArraysEqual(*ArrayFromJSON(list(int64()), "[[0, 1, 2]]"), *partitions);
+}
+
+TEST(HashPartition, Empty) {
+  auto values = ArrayFromJSON(int32(), "[]");
+  ASSERT_OK_AND_ASSIGN(auto partitions,
+                       HashPartitionIndices(values, HashPartitionOptions(2)));
+  AssertArraysEqual(*ArrayFromJSON(list(int64()), "[[], []]"), *partitions);
+}
+
+TEST(HashPartition, ConsistentAcrossLayouts) {
+  // Chunking, slicing and dictionary encoding don't change partition
+  // assignments
+  auto values = ArrayFromJSON(utf8(), R"(["x", "y", null, "z", "x", "w", "y"])");
+  HashPartitionOptions options(4);
+  ASSERT_OK_AND_ASSIGN(auto expected, HashPartitionIndices(values, options));
+
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, 2), values->Slice(2, 0), values->Slice(2)});
+  ASSERT_OK_AND_ASSIGN(auto actual, HashPartitionIndices(chunked, options));
+  AssertArraysEqual(*expected, *actual);
+
+  ASSERT_OK_AND_ASSIGN(auto encoded, DictionaryEncode(values));
+  ASSERT_OK_AND_ASSIGN(actual, HashPartitionIndices(encoded, options));
+  AssertArraysEqual(*expected, *actual);
+}
+
+TEST(HashPartition, FloatingPointKeys) {
+  auto values = ArrayFromJSON(float64(), "[0.0, -0.0, NaN, 1.5, NaN]");
+  ASSERT_OK_AND_ASSIGN(auto partitions,
+                       HashPartitionIndices(values, HashPartitionOptions(5)));
+  auto row_partitions = CheckPartitionIndices(*partitions, 5, values->length());
+  ASSERT_EQ(row_partitions[0], row_partitions[1]);
+  ASSERT_EQ(row_partitions[2], row_partitions[4]);
+}
+
+TEST(HashPartition, MultipleKeys) {
+  auto batch_schema =
+      schema({field("a", int32()), field("b", utf8()), field("c", float64())});
+  auto batch = RecordBatchFromJSON(batch_schema, R"([
+    {"a": 1,    "b": "x", "c": 0.5},
+    {"a": 2,    "b": "x", "c": 1.5},
+    {"a": 1,    "b": "x", "c": 2.5},
+    {"a": null, "b": "y", "c": 3.5},
+    {"a": 1,    "b": "y", "c": 4.5},
+    {"a": null, "b": "y", "c": 5.5}
+  ])");
+  HashPartitionOptions options(16, {"a", "b"});
+  ASSERT_OK_AND_ASSIGN(auto partitions, HashPartitionIndices(batch, options));
+  auto row_partitions = CheckPartitionIndices(*partitions, 16, batch->num_rows());
+  ASSERT_EQ(row_partitions[0], row_partitions[2]);
+  ASSERT_EQ(row_partitions[3], row_partitions[5]);
+
+  // A table with differently chunked columns gives the same result
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(
+                                       {batch->Slice(0, 4), batch->Slice(4)}));
+  ASSERT_OK_AND_ASSIGN(auto actual, HashPartitionIndices(table, options));
+  AssertArraysEqual(*partitions, *actual);
+}
+
+TEST(HashPartition, RecordBatches) {
+  auto rand = random::RandomArrayGenerator(0x94378165);
+  const int64_t length = 1000;
+  auto batch = RecordBatch::Make(
+      schema({field("key", int64()), field("value", float64())}), length,
+      {rand.Int64(length, 0, 50, 0.1), rand.Float64(length, -1, 1, 0.1)});
+  HashPartitionOptions options(7, {"key"});
+
+  ASSERT_OK_AND_ASSIGN(auto partitions, HashPartitionIndices(batch, options));
+  CheckPartitionIndices(*partitions, 7, length);
+  ASSERT_OK_AND_ASSIGN(auto batches, HashPartition(*batch, options));
+  ASSERT_EQ(batches.size(), 7);
+  for (int32_t p = 0; p < 7; ++p) {
+    ASSERT_OK(batches[p]->ValidateFull());
+    ASSERT_OK_AND_ASSIGN(auto expected, Take(*batch, *partitions->value_slice(p)));
+    AssertBatchesEqual(*expected, *batches[p]);
+  }
+}
+
+TEST(HashPartition, Errors) {
+  auto batch = RecordBatchFromJSON(schema({field("a", int32()), field("b", utf8())}),
+                                   R"([{"a": 1, "b": "x"}])");
+  ASSERT_RAISES(Invalid, HashPartitionIndices(batch, HashPartitionOptions(0, {"a"})));
+  ASSERT_RAISES(Invalid, HashPartitionIndices(batch, HashPartitionOptions(2)));
+  ASSERT_RAISES(Invalid, HashPartitionIndices(batch, HashPartitionOptions(2, {"c"})));
+  ASSERT_RAISES(Invalid, CallFunction("hash_partition", {batch}));
+
+  auto nested = ArrayFromJSON(list(int32()), "[[1]]");
+  ASSERT_RAISES(TypeError, HashPartitionIndices(nested, HashPartitionOptions(2)));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,260 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/array_nested.h"
+#include "arrow/array/data.h"
+#include "arrow/buffer.h"
+#include "arrow/compare.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace internal {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Run-end encoding
+//
+// A run-end encoded array is a struct array of two fields of equal length:
+// "run_ends" holds the exclusive end position of each run of equal values,
+// and "values" the value of the run.  Encoding finds the start positions of
+// the runs, then takes their values.  Decoding takes the values back at the
+// index of the run of each position.
+
+std::shared_ptr<DataType> RunEndEncodedType(std::shared_ptr<DataType> value_type) {
+  return struct_({field("run_ends", int32(), /*nullable=*/false),
+                  field("values", std::move(value_type))});
+}
+
+// Floating point values are compared bitwise, so that -0.0 and 0.0 or
+// different NaNs don't share a run and decode as they were
+template <typename T>
+enable_if_t<std::is_floating_point<T>::value, bool> ValuesEqual(T left, T right) {
+  return std::memcmp(&left, &right, sizeof(T)) == 0;
+}
+
+template <typename T>
+enable_if_t<!std::is_floating_point<T>::value, bool> ValuesEqual(const T& left,
+                                                                 const T& right) {
+  return left == right;
+}
+
+// Collect the start positions of the runs of equal values of an array, nulls
+// being equal to each other
+class RunFinder {
+ public:
+  RunFinder(const std::shared_ptr<ArrayData>& data, std::vector<int32_t>* run_starts)
+      : data_(data), run_starts_(run_starts) {}
+
+  Status Find() {
+    if (data_->length == 0) {
+      return Status::OK();
+    }
+    return VisitTypeInline(*data_->type, this);
+  }
+
+  template <typename Type>
+  enable_if_t<has_c_type<Type>::value || is_base_binary_type<Type>::value ||
+                  std::is_same<Type, FixedSizeBinaryType>::value,
+              Status>
+  Visit(const Type&) {
+    using ValueType = typename GetViewType<Type>::PhysicalType;
+    ValueType previous{};
+    bool previous_valid = false;
+    int32_t position = 0;
+    VisitArrayDataInline<Type>(
+        *data_,
+        [&](ValueType value) {
+          if (position == 0 || !previous_valid || !ValuesEqual(previous, value)) {
+            run_starts_->push_back(position);
+          }
+          previous = value;
+          previous_valid = true;
+          ++position;
+        },
+        [&]() {
+          if (position == 0 || previous_valid) {
+            run_starts_->push_back(position);
+          }
+          previous_valid = false;
+          ++position;
+        });
+    return Status::OK();
+  }
+
+  Status Visit(const NullType&) {
+    run_starts_->push_back(0);
+    return Status::OK();
+  }
+
+  // Other types, e.g. decimals, dictionaries or nested types, are compared
+  // row by row
+  Status Visit(const DataType&) {
+    // Two distinct Array objects, as ArrayRangeEquals() deems an array equal
+    // to itself whatever the ranges
+    auto array = MakeArray(data_), shifted = MakeArray(data_);
+    run_starts_->push_back(0);
+    for (int64_t i = 1; i < data_->length; ++i) {
+      if (!ArrayRangeEquals(*array, *shifted, i, i + 1, i - 1)) {
+        run_starts_->push_back(static_cast<int32_t>(i));
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  const std::shared_ptr<ArrayData>& data_;
+  std::vector<int32_t>* run_starts_;
+};
+
+Result<ValueDescr> ResolveRunEndEncodeOutput(KernelContext*,
+                                             const std::vector<ValueDescr>& descrs) {
+  return ValueDescr::Array(RunEndEncodedType(descrs[0].type));
+}
+
+void RunEndEncodeExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const auto& values = batch[0].array();
+  if (values->length > std::numeric_limits<int32_t>::max()) {
+    ctx->SetStatus(Status::Invalid("Array of length ", values->length,
+                                   " is too long for int32 run ends"));
+    return;
+  }
+
+  std::vector<int32_t> run_starts;
+  KERNEL_RETURN_IF_ERROR(ctx, RunFinder(values, &run_starts).Find());
+  const auto num_runs = static_cast<int64_t>(run_starts.size());
+
+  KERNEL_ASSIGN_OR_RAISE(auto run_ends_buffer, ctx,
+                         ctx->Allocate(num_runs * sizeof(int32_t)));
+  auto run_ends = reinterpret_cast<int32_t*>(run_ends_buffer->mutable_data());
+  for (int64_t i = 0; i < num_runs; ++i) {
+    run_ends[i] = (i + 1 < num_runs) ? run_starts[i + 1]
+                                     : static_cast<int32_t>(values->length);
+  }
+
+  Int32Array run_start_indices(num_runs, Buffer::Wrap(run_starts));
+  KERNEL_ASSIGN_OR_RAISE(Datum run_values, ctx,
+                         Take(Datum(values), Datum(run_start_indices.data()),
+                              TakeOptions::NoBoundsCheck(), ctx->exec_context()));
+
+  ArrayData* output = out->mutable_array();
+  output->length = num_runs;
+  output->buffers = {nullptr};
+  output->null_count = 0;
+  output->child_data = {
+      ArrayData::Make(int32(), num_runs, {nullptr, std::move(run_ends_buffer)}, 0),
+      run_values.array()};
+}
+
+Result<ValueDescr> ResolveRunEndDecodeOutput(KernelContext*,
+                                             const std::vector<ValueDescr>& descrs) {
+  const auto& type = *descrs[0].type;
+  if (type.num_fields() != 2 || type.field(0)->type()->id() != Type::INT32) {
+    return Status::TypeError("Expected a run-end encoded struct<int32, values>, got ",
+                             type);
+  }
+  return ValueDescr::Array(type.field(1)->type());
+}
+
+void RunEndDecodeExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  StructArray encoded(batch[0].array());
+  if (encoded.null_count() != 0) {
+    ctx->SetStatus(Status::Invalid("Run-end encoded array cannot have nulls"));
+    return;
+  }
+  const auto& run_ends = checked_cast<const Int32Array&>(*encoded.field(0));
+  if (run_ends.null_count() != 0) {
+    ctx->SetStatus(Status::Invalid("Run ends cannot be null"));
+    return;
+  }
+
+  const int64_t num_runs = run_ends.length();
+  const int64_t length = num_runs == 0 ? 0 : run_ends.Value(num_runs - 1);
+  KERNEL_ASSIGN_OR_RAISE(auto indices_buffer, ctx,
+                         ctx->Allocate(std::max<int64_t>(length, 0) * sizeof(int32_t)));
+  auto indices = reinterpret_cast<int32_t*>(indices_buffer->mutable_data());
+  int32_t run_start = 0;
+  for (int64_t i = 0; i < num_runs; ++i) {
+    const int32_t run_end = run_ends.Value(i);
+    if (run_end <= run_start || run_end > length) {
+      ctx->SetStatus(
+          Status::Invalid("Run ends must be positive and strictly increasing"));
+      return;
+    }
+    std::fill(indices + run_start, indices + run_end, static_cast<int32_t>(i));
+    run_start = run_end;
+  }
+
+  Int32Array run_indices(length, std::move(indices_buffer));
+  KERNEL_ASSIGN_OR_RAISE(*out, ctx,
+                         Take(Datum(encoded.field(1)), Datum(run_indices.data()),
+                              TakeOptions::NoBoundsCheck(), ctx->exec_context()));
+}
+
+const FunctionDoc run_end_encode_doc(
+    "Run-end encode an array",
+    ("Return a struct array with one row per run of equal consecutive values:\n"
+     "the \"run_ends\" field holds the int32 end position of the run, exclusive,\n"
+     "and the \"values\" field its value.  Nulls are equal to each other.\n"
+     "Chunks of a chunked array are encoded separately."),
+    {"values"});
+
+const FunctionDoc run_end_decode_doc(
+    "Decode a run-end encoded array",
+    ("Expand a struct array of run ends and values, as returned by\n"
+     "\"run_end_encode\", back into an array of the values."),
+    {"encoded"});
+
+}  // namespace
+
+void RegisterVectorRunEnd(FunctionRegistry* registry) {
+  auto encode = std::make_shared<VectorFunction>("run_end_encode", Arity::Unary(),
+                                                 &run_end_encode_doc);
+  VectorKernel encode_kernel({InputType(ValueDescr::ARRAY)},
+                             OutputType(ResolveRunEndEncodeOutput), RunEndEncodeExec);
+  encode_kernel.null_handling = NullHandling::OUTPUT_NOT_NULL;
+  encode_kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  DCHECK_OK(encode->AddKernel(std::move(encode_kernel)));
+  DCHECK_OK(registry->AddFunction(std::move(encode)));
+
+  auto decode = std::make_shared<VectorFunction>("run_end_decode", Arity::Unary(),
+                                                 &run_end_decode_doc);
+  VectorKernel decode_kernel({InputType::Array(Type::STRUCT)},
+                             OutputType(ResolveRunEndDecodeOutput), RunEndDecodeExec);
+  decode_kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+  decode_kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  DCHECK_OK(decode->AddKernel(std::move(decode_kernel)));
+  DCHECK_OK(registry->AddFunction(std::move(decode)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,136 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+std::shared_ptr<DataType> RunEndEncodedType(const std::shared_ptr<DataType>& type) {
+  return struct_({field("run_ends", int32(), /*nullable=*/false), field("values", type)});
+}
+
+// Check that `values` encode as the given run ends and run values, and decode back
+void CheckRunEndEncode(const std::shared_ptr<Array>& values, const std::string& run_ends,
+                       const std::string& run_values) {
+  ASSERT_OK_AND_ASSIGN(Datum encoded, RunEndEncode(values));
+  auto actual = encoded.make_array();
+  ASSERT_OK(actual->ValidateFull());
+  ASSERT_OK_AND_ASSIGN(
+      auto expected,
+      StructArray::Make({ArrayFromJSON(int32(), run_ends),
+                         ArrayFromJSON(values->type(), run_values)},
+                        RunEndEncodedType(values->type())->fields()));
+  AssertArraysEqual(*expected, *actual, /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(Datum decoded, RunEndDecode(encoded));
+  ASSERT_OK(decoded.make_array()->ValidateFull());
+  AssertArraysEqual(*values, *decoded.make_array(), /*verbose=*/true);
+}
+
+TEST(RunEndEncode, Basics) {
+  for (const auto& type : {int8(), uint32(), int64(), float64(), date32()}) {
+    SCOPED_TRACE(type->ToString());
+    CheckRunEndEncode(ArrayFromJSON(type, "[]"), "[]", "[]");
+    CheckRunEndEncode(ArrayFromJSON(type, "[1]"), "[1]", "[1]");
+    CheckRunEndEncode(ArrayFromJSON(type, "[1, 1, 1, 2, null, null, 1, 3, 3]"),
+                      "[3, 4, 6, 7, 9]", "[1, 2, null, 1, 3]");
+  }
+  CheckRunEndEncode(ArrayFromJSON(boolean(), "[true, true, false, null, false, false]"),
+                    "[2, 3, 4, 6]", "[true, false, null, false]");
+  for (const auto& type : {utf8(), large_binary(), fixed_size_binary(1)}) {
+    SCOPED_TRACE(type->ToString());
+    CheckRunEndEncode(ArrayFromJSON(type, R"(["a", "a", null, "b", "b", "a"])"),
+                      "[2, 3, 5, 6]", R"(["a", null, "b", "a"])");
+  }
+  CheckRunEndEncode(ArrayFromJSON(null(), "[null, null, null]"), "[3]", "[null]");
+}
+
+TEST(RunEndEncode, FloatingPoint) {
+  // Values are compared bitwise, so that they decode as they were
+  CheckRunEndEncode(ArrayFromJSON(float64(), "[0.0, -0.0, -0.0, NaN, NaN, 1.5]"),
+                    "[1, 3, 5, 6]", "[0.0, -0.0, NaN, 1.5]");
+}
+
+TEST(RunEndEncode, OtherTypes) {
+  CheckRunEndEncode(ArrayFromJSON(decimal(5, 2), R"(["1.00", "1.00", null, "-2.50"])"),
+                    "[2, 3, 4]", R"(["1.00", null, "-2.50"])");
+  CheckRunEndEncode(ArrayFromJSON(list(int32()), "[[1, 2], [1, 2], [], null, null, [1]]"),
+                    "[2, 3, 5, 6]", "[[1, 2], [], null, [1]]");
+  auto dict_type = dictionary(int8(), utf8());
+  auto dict = ArrayFromJSON(utf8(), R"(["x", "y"])");
+  auto values = std::make_shared<DictionaryArray>(
+      dict_type, ArrayFromJSON(int8(), "[0, 0, 1, null, 1]"), dict);
+  ASSERT_OK_AND_ASSIGN(Datum encoded, RunEndEncode(values));
+  ASSERT_OK_AND_ASSIGN(Datum decoded, RunEndDecode(encoded));
+  AssertArraysEqual(*values, *decoded.make_array(), /*verbose=*/true);
+  ASSERT_EQ(encoded.length(), 4);
+}
+
+TEST(RunEndEncode, SlicedAndChunked) {
+  auto values = ArrayFromJSON(int32(), "[5, 1, 1, 2, 2, 2, 7]");
+  CheckRunEndEncode(values->Slice(1, 5), "[2, 5]", "[1, 2]");
+
+  // Chunks are encoded separately
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, 3), values->Slice(3)});
+  ASSERT_OK_AND_ASSIGN(Datum encoded, RunEndEncode(chunked));
+  ASSERT_EQ(encoded.kind(), Datum::CHUNKED_ARRAY);
+  ASSERT_EQ(encoded.chunked_array()->num_chunks(), 2);
+  ASSERT_OK_AND_ASSIGN(Datum decoded, RunEndDecode(encoded));
+  AssertChunkedEquivalent(*chunked, *decoded.chunked_array());
+}
+
+TEST(RunEndEncode, Random) {
+  auto rand = random::RandomArrayGenerator(0x2a4b6c8d);
+  for (const double null_probability : {0.0, 0.5}) {
+    auto values = rand.Int16(1000, 0, 2, null_probability);
+    ASSERT_OK_AND_ASSIGN(Datum encoded, RunEndEncode(values));
+    ASSERT_OK_AND_ASSIGN(Datum decoded, RunEndDecode(encoded));
+    AssertArraysEqual(*values, *decoded.make_array(), /*verbose=*/true);
+  }
+}
+
+TEST(RunEndDecode, Errors) {
+  auto type = RunEndEncodedType(int32());
+  // Run ends must be positive and strictly increasing
+  for (const auto& run_ends : {"[0]", "[2, 2]", "[3, 1]", "[5, 100, 10]"}) {
+    SCOPED_TRACE(run_ends);
+    auto run_ends_array = ArrayFromJSON(int32(), run_ends);
+    auto values = ArrayFromJSON(int32(), "[1, 2, 3]")->Slice(0, run_ends_array->length());
+    ASSERT_OK_AND_ASSIGN(auto encoded,
+                         StructArray::Make({run_ends_array, values}, type->fields()));
+    ASSERT_RAISES(Invalid, RunEndDecode(encoded));
+  }
+  ASSERT_RAISES(TypeError,
+                RunEndDecode(ArrayFromJSON(struct_({field("a", int64())}), "[[1]]")));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -18,6 +18,9 @@
 #include <algorithm>
 #include <cstring>
 #include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
 
 #include "arrow/array/array_base.h"
 #include "arrow/array/array_binary.h"
@@ -28,6 +31,7 @@
 #include "arrow/buffer_builder.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/cast.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/extension_type.h"
@@ -36,6 +40,7 @@
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/bit_block_counter.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/bitmap_reader.h"
@@ -46,6 +51,8 @@ namespace arrow {
 using internal::BinaryBitBlockCounter;
 using internal::BitBlockCount;
 using internal::BitBlockCounter;
+using internal::BitRun;
+using internal::BitRunReader;
 using internal::BitmapReader;
 using internal::CheckIndexBounds;
 using internal::CopyBitmap;
@@ -1255,6 +1262,10 @@ struct Selection {
       return impl->template VisitTake<IndexCType>(std::forward<ValidVisitor>(visit_valid),
                                                   std::forward<NullVisitor>(visit_null));
     }
+    template <typename OffsetType>
+    int64_t SelectedValuesLength(const OffsetType* raw_offsets) {
+      return impl->template TakeValuesLength<IndexCType>(raw_offsets);
+    }
   };
 
   // Forwards the generic value visitors to the VisitFilter template
@@ -1268,6 +1279,10 @@ struct Selection {
       return impl->VisitFilter(std::forward<ValidVisitor>(visit_valid),
                                std::forward<NullVisitor>(visit_null));
     }
+    template <typename OffsetType>
+    int64_t SelectedValuesLength(const OffsetType* raw_offsets) {
+      return impl->FilterValuesLength(raw_offsets);
+    }
   };
 
   KernelContext* ctx;
@@ -1340,6 +1355,50 @@ struct Selection {
     return Status::OK();
   }
 
+  // Exact total length of the variable-size values selected by the take
+  // indices, from the values' offsets.  This first pass lets the output data be
+  // allocated once and then copied without any capacity checks.
+  template <typename IndexCType, typename OffsetType>
+  int64_t TakeValuesLength(const OffsetType* raw_offsets) const {
+    const auto indices_values = selection->GetValues<IndexCType>(1);
+    int64_t total_length = 0;
+    if (!selection->MayHaveNulls() && !values->MayHaveNulls()) {
+      for (int64_t i = 0; i < selection->length; ++i) {
+        const IndexCType index = indices_values[i];
+        total_length += raw_offsets[index + 1] - raw_offsets[index];
+      }
+      return total_length;
+    }
+    OptionalBitIndexer indices_is_valid(selection->buffers[0], selection->offset);
+    OptionalBitIndexer values_is_valid(values->buffers[0], values->offset);
+    for (int64_t i = 0; i < selection->length; ++i) {
+      const IndexCType index = indices_values[i];
+      if (indices_is_valid[i] && values_is_valid[index]) {
+        total_length += raw_offsets[index + 1] - raw_offsets[index];
+      }
+    }
+    return total_length;
+  }
+
+  // Upper bound of the total length of the variable-size values selected by
+  // the filter, summed over runs of set filter bits (null filter slots and
+  // null values are included)
+  template <typename OffsetType>
+  int64_t FilterValuesLength(const OffsetType* raw_offsets) const {
+    BitRunReader reader(selection->buffers[1]->data(), selection->offset,
+                        selection->length);
+    int64_t total_length = 0;
+    int64_t position = 0;
+    while (position < selection->length) {
+      const BitRun run = reader.NextRun();
+      if (run.set) {
+        total_length += raw_offsets[position + run.length] - raw_offsets[position];
+      }
+      position += run.length;
+    }
+    return total_length;
+  }
+
   // We use the NullVisitor both for "selected" nulls as well as "emitted"
   // nulls coming from the filter when using FilterOptions::EMIT_NULL
   template <typename ValidVisitor, typename NullVisitor>
@@ -1548,44 +1607,28 @@ struct VarBinaryImpl : public Selection<VarBinaryImpl<Type>, Type> {
   template <typename Adapter>
   Status GenerateOutput() {
     ValuesArrayType typed_values(this->values_as_binary);
-
-    // Presize the data builder with a rough estimate of the required data size
-    if (values->length > 0) {
-      const double mean_value_length =
-          (typed_values.total_values_length() / static_cast<double>(values->length));
-
-      // TODO: See if possible to reduce output_length for take/filter cases
-      // where there are nulls in the selection array
-      RETURN_NOT_OK(
-          data_builder.Reserve(static_cast<int64_t>(mean_value_length * output_length)));
-    }
-    int64_t space_available = data_builder.capacity();
-
     const offset_type* raw_offsets = typed_values.raw_value_offsets();
     const uint8_t* raw_data = typed_values.raw_data();
 
-    offset_type offset = 0;
+    // Size the output data exactly (take) or by an upper bound (filter) in a
+    // first pass, so that the values can be copied without capacity checks
     Adapter adapter(this);
+    const int64_t data_length = adapter.SelectedValuesLength(raw_offsets);
+    // Use static property to prune this code from the filter path in
+    // optimized builds
+    if (Adapter::is_take && ARROW_PREDICT_FALSE(data_length > kOffsetLimit)) {
+      return Status::Invalid("Take operation overflowed binary array capacity");
+    }
+    RETURN_NOT_OK(data_builder.Reserve(data_length));
+
+    offset_type offset = 0;
     RETURN_NOT_OK(adapter.Generate(
         [&](int64_t index) {
           offset_builder.UnsafeAppend(offset);
-          offset_type val_offset = raw_offsets[index];
-          offset_type val_size = raw_offsets[index + 1] - val_offset;
-
-          // Use static property to prune this code from the filter path in
-          // optimized builds
-          if (Adapter::is_take &&
-              ARROW_PREDICT_FALSE(static_cast<int64_t>(offset) +
-                                  static_cast<int64_t>(val_size)) > kOffsetLimit) {
-            return Status::Invalid("Take operation overflowed binary array capacity");
-          }
+          const offset_type val_offset = raw_offsets[index];
+          const offset_type val_size = raw_offsets[index + 1] - val_offset;
           offset += val_size;
-          if (ARROW_PREDICT_FALSE(val_size > space_available)) {
-            RETURN_NOT_OK(data_builder.Reserve(val_size));
-            space_available = data_builder.capacity() - data_builder.length();
-          }
           data_builder.UnsafeAppend(raw_data + val_offset, val_size);
-          space_available -= val_size;
           return Status::OK();
         },
         [&]() {
@@ -1658,19 +1701,25 @@ struct ListImpl : public Selection<ListImpl<Type>, Type> {
   template <typename Adapter>
   Status GenerateOutput() {
     ValuesArrayType typed_values(this->values);
+    const offset_type* raw_offsets = typed_values.raw_value_offsets();
 
-    // TODO presize child_index_builder with a similar heuristic as VarBinaryImpl
+    // Size the child indices in a first pass, as in VarBinaryImpl
+    Adapter adapter(this);
+    const int64_t child_length = adapter.SelectedValuesLength(raw_offsets);
+    if (Adapter::is_take &&
+        ARROW_PREDICT_FALSE(child_length > std::numeric_limits<offset_type>::max())) {
+      return Status::Invalid("Take operation overflowed list array capacity");
+    }
+    RETURN_NOT_OK(child_index_builder.Reserve(child_length));
 
     offset_type offset = 0;
-    Adapter adapter(this);
     RETURN_NOT_OK(adapter.Generate(
         [&](int64_t index) {
           offset_builder.UnsafeAppend(offset);
-          offset_type value_offset = typed_values.value_offset(index);
-          offset_type value_length = typed_values.value_length(index);
-          offset += value_length;
-          RETURN_NOT_OK(child_index_builder.Reserve(value_length));
-          for (offset_type j = value_offset; j < value_offset + value_length; ++j) {
+          const offset_type value_offset = raw_offsets[index];
+          const offset_type value_end = raw_offsets[index + 1];
+          offset += value_end - value_offset;
+          for (offset_type j = value_offset; j < value_end; ++j) {
             child_index_builder.UnsafeAppend(j);
           }
           return Status::OK();
@@ -1904,6 +1953,120 @@ Result<std::shared_ptr<Array>> TakeAA(const Array& values, const Array& indices,
   return result.make_array();
 }
 
+// Take from a multi-chunk array without concatenating its chunks: resolve
+// each index to a chunk and a position within that chunk, then take from each
+// chunk separately.  If the indices visit the chunks in order, the taken
+// pieces are the output chunks; otherwise they are concatenated (which only
+// copies output-sized data) and put back in the order of the indices.
+// Returns null if concatenating the values is expected to be cheaper.
+Result<std::shared_ptr<ChunkedArray>> TakeChunksSeparately(const ChunkedArray& values,
+                                                           const Array& indices,
+                                                           const TakeOptions& options,
+                                                           ExecContext* ctx) {
+  if (options.boundscheck) {
+    RETURN_NOT_OK(CheckIndexBounds(*indices.data(), values.length()));
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum indices_as_int64,
+                        Cast(indices, int64(), CastOptions::Unsafe(), ctx));
+  const Int64Array typed_indices(indices_as_int64.array());
+
+  const int num_chunks = values.num_chunks();
+  std::vector<int64_t> chunk_starts(num_chunks + 1, 0);
+  for (int i = 0; i < num_chunks; ++i) {
+    chunk_starts[i + 1] = chunk_starts[i] + values.chunk(i)->length();
+  }
+
+  // First pass: the chunk of each index.  Null indices are assigned the chunk
+  // of the previous index so as not to break runs of in-order indices.
+  const int64_t length = typed_indices.length();
+  std::vector<int> chunk_of_index(length);
+  std::vector<int64_t> chunk_lengths(num_chunks, 0);
+  // Reordering costs a second take of the output, which only pays off if the
+  // output is much smaller than the values
+  const bool can_reorder = length <= values.length() / 8;
+  bool in_chunk_order = true;
+  int chunk = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    if (typed_indices.IsValid(i)) {
+      const int64_t index = typed_indices.Value(i);
+      if (index < chunk_starts[chunk] || index >= chunk_starts[chunk + 1]) {
+        const int next_chunk = static_cast<int>(
+            std::upper_bound(chunk_starts.begin(), chunk_starts.end(), index) -
+            chunk_starts.begin() - 1);
+        DCHECK(next_chunk >= 0 && next_chunk < num_chunks);
+        if (next_chunk < chunk) {
+          if (!can_reorder) {
+            return nullptr;
+          }
+          in_chunk_order = false;
+        }
+        chunk = next_chunk;
+      }
+    }
+    chunk_of_index[i] = chunk;
+    ++chunk_lengths[chunk];
+  }
+
+  // Second pass: the indices within each chunk, laid out chunk after chunk,
+  // and the position of each output value in the concatenated pieces
+  MemoryPool* pool = ctx->memory_pool();
+  std::vector<int64_t> piece_starts(num_chunks, 0);
+  for (int i = 1; i < num_chunks; ++i) {
+    piece_starts[i] = piece_starts[i - 1] + chunk_lengths[i - 1];
+  }
+  ARROW_ASSIGN_OR_RAISE(auto chunk_indices_data,
+                        AllocateBuffer(length * sizeof(int64_t), pool));
+  std::shared_ptr<Buffer> positions_data;
+  if (!in_chunk_order) {
+    ARROW_ASSIGN_OR_RAISE(positions_data, AllocateBuffer(length * sizeof(int64_t), pool));
+  }
+  std::shared_ptr<Buffer> chunk_indices_validity;
+  if (typed_indices.null_count() > 0) {
+    ARROW_ASSIGN_OR_RAISE(chunk_indices_validity, AllocateBitmap(length, pool));
+  }
+  auto chunk_indices = reinterpret_cast<int64_t*>(chunk_indices_data->mutable_data());
+  int64_t* positions = in_chunk_order
+                           ? nullptr
+                           : reinterpret_cast<int64_t*>(positions_data->mutable_data());
+  std::vector<int64_t> cursors = piece_starts;
+  for (int64_t i = 0; i < length; ++i) {
+    const int index_chunk = chunk_of_index[i];
+    const int64_t position = cursors[index_chunk]++;
+    const bool is_valid = typed_indices.IsValid(i);
+    chunk_indices[position] =
+        is_valid ? typed_indices.Value(i) - chunk_starts[index_chunk] : 0;
+    if (chunk_indices_validity != nullptr) {
+      BitUtil::SetBitTo(chunk_indices_validity->mutable_data(), position, is_valid);
+    }
+    if (positions != nullptr) {
+      positions[i] = position;
+    }
+  }
+  Int64Array all_chunk_indices(length, std::move(chunk_indices_data),
+                               std::move(chunk_indices_validity),
+                               typed_indices.null_count());
+
+  ArrayVector pieces;
+  for (int i = 0; i < num_chunks; ++i) {
+    if (chunk_lengths[i] == 0) {
+      continue;
+    }
+    auto piece_indices = all_chunk_indices.Slice(piece_starts[i], chunk_lengths[i]);
+    ARROW_ASSIGN_OR_RAISE(auto piece, TakeAA(*values.chunk(i), *piece_indices,
+                                             TakeOptions::NoBoundsCheck(), ctx));
+    pieces.push_back(std::move(piece));
+  }
+  if (in_chunk_order) {
+    return std::make_shared<ChunkedArray>(std::move(pieces), values.type());
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto concatenated, Concatenate(pieces, pool));
+  const Int64Array positions_array(length, std::move(positions_data));
+  ARROW_ASSIGN_OR_RAISE(auto taken, TakeAA(*concatenated, positions_array,
+                                           TakeOptions::NoBoundsCheck(), ctx));
+  return std::make_shared<ChunkedArray>(ArrayVector{std::move(taken)});
+}
+
 Result<std::shared_ptr<ChunkedArray>> TakeCA(const ChunkedArray& values,
                                              const Array& indices,
                                              const TakeOptions& options,
@@ -1916,12 +2079,16 @@ Result<std::shared_ptr<ChunkedArray>> TakeCA(const ChunkedArray& values,
   if (num_chunks == 1) {
     current_chunk = values.chunk(0);
   } else {
-    // TODO Case 2: See if all `indices` fall in the same chunk and call Array Take on it
-    // See
-    // https://github.com/apache/arrow/blob/6f2c9041137001f7a9212f244b51bc004efc29af/r/src/compute.cpp#L123-L151
-    // TODO Case 3: If indices are sorted, can slice them and call Array Take
-
-    // Case 4: Else, concatenate chunks and call Array Take
+    // Case 2: take from each chunk separately, unless the indices are both
+    // out of order and not much shorter than the values
+    if (num_chunks > 1 && indices.length() > 0) {
+      ARROW_ASSIGN_OR_RAISE(auto taken,
+                            TakeChunksSeparately(values, indices, options, ctx));
+      if (taken != nullptr) {
+        return taken;
+      }
+    }
+    // Case 3: Else, concatenate chunks and call Array Take
     ARROW_ASSIGN_OR_RAISE(current_chunk,
                           Concatenate(values.chunks(), ctx->memory_pool()));
   }
@@ -1938,13 +2105,15 @@ Result<std::shared_ptr<ChunkedArray>> TakeCC(const ChunkedArray& values,
   std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
   for (int i = 0; i < num_chunks; i++) {
     // Take with that indices chunk
-    // Note that as currently implemented, this is inefficient because `values`
-    // will get concatenated on every iteration of this loop
     ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ChunkedArray> current_chunk,
                           TakeCA(values, *indices.chunk(i), options, ctx));
     // Concatenate the result to make a single array for this chunk
-    ARROW_ASSIGN_OR_RAISE(new_chunks[i],
-                          Concatenate(current_chunk->chunks(), ctx->memory_pool()));
+    if (current_chunk->num_chunks() == 1) {
+      new_chunks[i] = current_chunk->chunk(0);
+    } else {
+      ARROW_ASSIGN_OR_RAISE(new_chunks[i],
+                            Concatenate(current_chunk->chunks(), ctx->memory_pool()));
+    }
   }
   return std::make_shared<ChunkedArray>(std::move(new_chunks));
 }
@@ -19,7 +19,9 @@
 
 #include <cstdint>
 #include <sstream>
+#include <utility>
 
+#include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/testing/gtest_util.h"
@@ -135,21 +137,49 @@ struct TakeBenchmark {
     Bench(values);
   }
 
-  void Bench(const std::shared_ptr<Array>& values) {
+  void ListInt64() {
+    auto int_array = rand.Int64(args.size * 4, -100, 100, args.null_proportion);
+    Bench(rand.List(*int_array, args.size + 1, args.null_proportion));
+  }
+
+  // Values split into 8 chunks, taken from without concatenating them
+  void ChunkedString() {
+    int32_t string_min_length = 0, string_max_length = 32;
+    auto values = rand.String(args.size, string_min_length, string_max_length,
+                              args.null_proportion);
+    const int64_t chunk_length = values->length() / 8;
+    ArrayVector chunks;
+    for (int64_t offset = 0; offset < values->length(); offset += chunk_length) {
+      chunks.push_back(values->Slice(offset, chunk_length));
+    }
+    Bench(std::make_shared<ChunkedArray>(std::move(chunks)), values->length());
+  }
+
+  std::shared_ptr<Array> MakeIndices(int64_t values_length) {
     double indices_null_proportion = indices_have_nulls ? args.null_proportion : 0;
-    auto indices =
-        rand.Int32(values->length(), 0, static_cast<int32_t>(values->length() - 1),
-                   indices_null_proportion);
+    auto indices = rand.Int32(values_length, 0, static_cast<int32_t>(values_length - 1),
+                              indices_null_proportion);
 
     if (monotonic_indices) {
       auto arg_sorter = *SortToIndices(*indices);
       indices = *Take(*indices, *arg_sorter);
     }
+    return indices;
+  }
 
+  void Bench(const std::shared_ptr<Array>& values) {
+    auto indices = MakeIndices(values->length());
     for (auto _ : state) {
       ABORT_NOT_OK(Take(values, indices).status());
     }
   }
+
+  void Bench(const std::shared_ptr<ChunkedArray>& values, int64_t values_length) {
+    auto indices = MakeIndices(values_length);
+    for (auto _ : state) {
+      ABORT_NOT_OK(Take(Datum(values), Datum(indices)).status());
+    }
+  }
 };
 
 struct FilterBenchmark {
@@ -300,7 +330,23 @@ static void TakeStringRandomIndicesWithNulls(benchmark::State& state) {
 }
 
 static void TakeStringMonotonicIndices(benchmark::State& state) {
-  TakeBenchmark(state, /*indices_with_nulls=*/false, /*monotonic=*/true).FSLInt64();
+  TakeBenchmark(state, /*indices_with_nulls=*/false, /*monotonic=*/true).String();
+}
+
+static void TakeListInt64RandomIndicesNoNulls(benchmark::State& state) {
+  TakeBenchmark(state, false).ListInt64();
+}
+
+static void TakeListInt64RandomIndicesWithNulls(benchmark::State& state) {
+  TakeBenchmark(state, true).ListInt64();
+}
+
+static void TakeChunkedStringRandomIndicesNoNulls(benchmark::State& state) {
+  TakeBenchmark(state, false).ChunkedString();
+}
+
+static void TakeChunkedStringMonotonicIndices(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/false, /*monotonic=*/true).ChunkedString();
 }
 
 void FilterSetArgs(benchmark::internal::Benchmark* bench) {
@@ -344,6 +390,10 @@ BENCHMARK(TakeFSLInt64MonotonicIndices)->Apply(TakeSetArgs);
 BENCHMARK(TakeStringRandomIndicesNoNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeStringRandomIndicesWithNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeStringMonotonicIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeListInt64RandomIndicesNoNulls)->Apply(TakeSetArgs);
+BENCHMARK(TakeListInt64RandomIndicesWithNulls)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedStringRandomIndicesNoNulls)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedStringMonotonicIndices)->Apply(TakeSetArgs);
 
 }  // namespace compute
 }  // namespace arrow
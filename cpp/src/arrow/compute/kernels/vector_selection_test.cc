@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "arrow/chunked_array.h"
+#include "arrow/compressed_table.h"
 #include "arrow/compute/api.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/table.h"
@@ -31,6 +32,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/compression.h"
 
 namespace arrow {
 
@@ -1477,6 +1479,47 @@ TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArray) {
                                                        {"[0, 1, 0]", "[5, 1]"}, &arr));
 }
 
+TEST_F(TestTakeKernelWithChunkedArray, TakeChunksSeparately) {
+  auto rand = random::RandomArrayGenerator(kRandomSeed);
+  const int64_t length = 500;
+  std::vector<std::shared_ptr<Array>> values_arrays = {
+      rand.Int64(length, 0, 100, 0.1), rand.String(length, 0, 10, 0.1),
+      rand.List(*rand.Int32(length * 3, 0, 100, 0.1), length + 1, 0.1)};
+
+  Int32Builder ascending_builder;
+  for (int32_t i = 20; i < length; i += 7) {
+    ASSERT_OK(ascending_builder.Append(i));
+    if (i % 5 == 0) {
+      ASSERT_OK(ascending_builder.AppendNull());
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto ascending_indices, ascending_builder.Finish());
+  std::vector<std::shared_ptr<Array>> indices_arrays = {
+      // In chunk order: the taken pieces are the output chunks
+      ascending_indices,
+      // Out of order: the taken pieces are concatenated, then reordered
+      rand.Int32(50, 0, length - 1, 0.1),
+      // Not much shorter than the values: the values are concatenated
+      rand.Int32(2 * length, 0, length - 1, 0.1)};
+
+  for (const auto& values : values_arrays) {
+    SCOPED_TRACE(values->type()->ToString());
+    auto chunked_values = std::make_shared<ChunkedArray>(
+        ArrayVector{values->Slice(0, 100), values->Slice(100, 0), values->Slice(100, 250),
+                    values->Slice(350)});
+    for (const auto& indices : indices_arrays) {
+      ASSERT_OK_AND_ASSIGN(Datum expected, Take(values, indices));
+      ASSERT_OK_AND_ASSIGN(Datum actual, Take(Datum(chunked_values), Datum(indices)));
+      ASSERT_OK(actual.chunked_array()->ValidateFull());
+      AssertChunkedEquivalent(ChunkedArray(expected.make_array()),
+                              *actual.chunked_array());
+    }
+    ASSERT_OK_AND_ASSIGN(Datum actual,
+                         Take(Datum(chunked_values), Datum(ascending_indices)));
+    ASSERT_EQ(actual.chunked_array()->num_chunks(), 3);
+  }
+}
+
 class TestTakeKernelWithTable : public TestTakeKernel<Table> {
  public:
   void AssertTake(const std::shared_ptr<Schema>& schm,
@@ -1536,6 +1579,48 @@ TEST_F(TestTakeKernelWithTable, TakeTable) {
   this->AssertChunkedTake(schm, table_json, {"[0, 1]", "[2, 3]"}, table_json);
 }
 
+TEST(TestTakeCompressed, ChunkedArrayAndTable) {
+  if (!util::Codec::IsAvailable(Compression::LZ4_FRAME)) {
+    GTEST_SKIP() << "Compression not available";
+  }
+  auto rand = random::RandomArrayGenerator(kRandomSeed);
+  const int64_t length = 500;
+  auto values = rand.String(length, 0, 10, 0.1);
+  auto chunked_values = std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, 100), values->Slice(100, 0), values->Slice(100, 250),
+                  values->Slice(350)});
+  ASSERT_OK_AND_ASSIGN(auto compressed,
+                       CompressedChunkedArray::Make(*chunked_values));
+
+  std::vector<std::shared_ptr<Array>> indices_arrays = {
+      rand.Int32(50, 0, length - 1, 0.1), rand.Int64(2 * length, 0, length - 1, 0.1),
+      // Touching a single chunk, and no chunk at all
+      ArrayFromJSON(int16(), "[360, null, 499]"),
+      ArrayFromJSON(uint16(), "[null, 120, null, 200]")->Slice(1),
+      ArrayFromJSON(int8(), "[null, null]"), ArrayFromJSON(int8(), "[]")};
+  for (const auto& indices : indices_arrays) {
+    SCOPED_TRACE(indices->ToString());
+    ASSERT_OK_AND_ASSIGN(Datum expected, Take(values, indices));
+    ASSERT_OK_AND_ASSIGN(auto actual, Take(*compressed, *indices));
+    ASSERT_OK(actual->ValidateFull());
+    AssertChunkedEquivalent(ChunkedArray(expected.make_array()), *actual);
+  }
+  ASSERT_RAISES(IndexError, Take(*compressed, *ArrayFromJSON(int32(), "[0, 500]")));
+  ASSERT_RAISES(IndexError, Take(*compressed, *ArrayFromJSON(int32(), "[-1]")));
+  ASSERT_RAISES(TypeError, Take(*compressed, *ArrayFromJSON(float64(), "[0]")));
+
+  auto schm = schema({field("a", int32()), field("b", utf8())});
+  auto table = TableFromJSON(schm, {R"([{"a": null, "b": "yo"}, {"a": 1, "b": ""}])",
+                                    R"([{"a": 2, "b": "hello"}, {"a": 4, "b": "eh"}])"});
+  ASSERT_OK_AND_ASSIGN(auto compressed_table, CompressedTable::Make(*table));
+  ASSERT_OK_AND_ASSIGN(auto actual,
+                       Take(*compressed_table, *ArrayFromJSON(int8(), "[3, 1, null]")));
+  ASSERT_OK(actual->ValidateFull());
+  AssertTablesEqual(*TableFromJSON(schm, {R"([{"a": 4, "b": "eh"}, {"a": 1, "b": ""},
+                                              {"a": null, "b": null}])"}),
+                    *actual, /*same_chunk_layout=*/false);
+}
+
 TEST(TestTakeMetaFunction, ArityChecking) {
   ASSERT_RAISES(Invalid, CallFunction("take", {}));
 }
@@ -1645,5 +1730,48 @@ TEST(TestTake, RandomFixedSizeBinary) {
   TakeRandomTest<FixedSizeBinaryType>::Test(fixed_size_binary(16));
 }
 
+TEST(TestTake, RandomList) {
+  auto rand = random::RandomArrayGenerator(kRandomSeed);
+  for (const auto null_probability : {0.0, 0.1, 1.0}) {
+    auto child = rand.Int32(4000, 0, 100, null_probability);
+    auto values = rand.List(*child, 1000, null_probability)->Slice(1);
+    auto indices = rand.Int32(300, 0, static_cast<int32_t>(values->length() - 1),
+                              null_probability);
+    ASSERT_OK_AND_ASSIGN(Datum out, Take(values, indices));
+    auto taken = out.make_array();
+    ASSERT_OK(taken->ValidateFull());
+    ASSERT_EQ(taken->length(), indices->length());
+    const auto& typed_indices = checked_cast<const Int32Array&>(*indices);
+    for (int64_t i = 0; i < indices->length(); ++i) {
+      if (typed_indices.IsNull(i)) {
+        ASSERT_TRUE(taken->IsNull(i));
+      } else {
+        ASSERT_TRUE(taken->RangeEquals(i, i + 1, typed_indices.Value(i), values));
+      }
+    }
+  }
+}
+
+TEST(TestFilter, RandomList) {
+  auto rand = random::RandomArrayGenerator(kRandomSeed);
+  for (const auto null_probability : {0.0, 0.1, 1.0}) {
+    auto child = rand.Int32(4000, 0, 100, null_probability);
+    auto values = rand.List(*child, 1000, null_probability)->Slice(1);
+    auto filter = checked_pointer_cast<BooleanArray>(
+        rand.Boolean(values->length(), 0.3, /*null_probability=*/0.0));
+    Int32Builder indices_builder;
+    for (int64_t i = 0; i < filter->length(); ++i) {
+      if (filter->Value(i)) {
+        ASSERT_OK(indices_builder.Append(static_cast<int32_t>(i)));
+      }
+    }
+    ASSERT_OK_AND_ASSIGN(auto indices, indices_builder.Finish());
+    ASSERT_OK_AND_ASSIGN(Datum filtered, Filter(values, filter));
+    ASSERT_OK_AND_ASSIGN(Datum taken, Take(values, indices));
+    ASSERT_OK(filtered.make_array()->ValidateFull());
+    AssertArraysEqual(*taken.make_array(), *filtered.make_array());
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
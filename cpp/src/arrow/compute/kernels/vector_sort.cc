@@ -16,13 +16,25 @@
 // under the License.
 
 #include <algorithm>
+#include <array>
 #include <limits>
+#include <memory>
 #include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "arrow/array/data.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/common.h"
+#include "arrow/extension_type.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/util/binary_view.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/optional.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace compute {
@@ -111,25 +123,97 @@ inline void VisitRawValuesInline(const ArrayType& values,
   }
 }
 
+// The sorters below reorder a range of indices in place. The indices in the
+// range are offset by `offset` from positions in `values`, which allows
+// sorting a slice of a larger logical sequence (e.g. a chunk of a chunked
+// array). The sort is stable with regard to the initial order of the range,
+// so that successive sorts by less significant keys first yield a
+// lexicographic order.
+
+// Stably move the indices of null values to the start or the end of the
+// range, returning the range of the indices of non-null values
+template <typename ArrayType>
+std::pair<uint64_t*, uint64_t*> PartitionNulls(uint64_t* indices_begin,
+                                               uint64_t* indices_end,
+                                               const ArrayType& values, int64_t offset,
+                                               NullPlacement null_placement) {
+  if (values.null_count() == 0) {
+    return {indices_begin, indices_end};
+  }
+  if (null_placement == NullPlacement::AtStart) {
+    auto nulls_end = std::stable_partition(
+        indices_begin, indices_end,
+        [&values, offset](uint64_t ind) { return values.IsNull(ind - offset); });
+    return {nulls_end, indices_end};
+  }
+  auto nulls_begin = std::stable_partition(
+      indices_begin, indices_end,
+      [&values, offset](uint64_t ind) { return !values.IsNull(ind - offset); });
+  return {indices_begin, nulls_begin};
+}
+
 template <typename ArrowType>
 class CompareSorter {
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
 
  public:
-  void Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values) {
-    std::iota(indices_begin, indices_end, 0);
+  void Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values,
+            int64_t offset, const ArraySortOptions& options) {
+    auto non_nulls = PartitionNulls(indices_begin, indices_end, values, offset,
+                                    options.null_placement);
+    if (options.order == SortOrder::Ascending) {
+      std::stable_sort(non_nulls.first, non_nulls.second,
+                       [&values, offset](uint64_t left, uint64_t right) {
+                         return values.GetView(left - offset) <
+                                values.GetView(right - offset);
+                       });
+    } else {
+      std::stable_sort(non_nulls.first, non_nulls.second,
+                       [&values, offset](uint64_t left, uint64_t right) {
+                         return values.GetView(right - offset) <
+                                values.GetView(left - offset);
+                       });
+    }
+  }
+};
+
+// Binary values are sorted through 16-byte views holding their size and first
+// bytes, which resolve most comparisons without chasing the offsets then the
+// character data of both values
+template <typename ArrowType>
+class BinaryViewSorter {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using BinaryView = ::arrow::internal::BinaryView;
+
+ public:
+  void Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values,
+            int64_t offset, const ArraySortOptions& options) {
+    auto non_nulls = PartitionNulls(indices_begin, indices_end, values, offset,
+                                    options.null_placement);
+    if (non_nulls.second - non_nulls.first < 2) {
+      return;
+    }
+    views_.resize(values.length());
+    for (auto it = non_nulls.first; it != non_nulls.second; ++it) {
+      views_[*it - offset] = BinaryView(values.GetView(*it - offset));
+    }
 
-    auto nulls_begin = indices_end;
-    if (values.null_count()) {
-      nulls_begin =
-          std::stable_partition(indices_begin, indices_end,
-                                [&values](uint64_t ind) { return !values.IsNull(ind); });
+    const BinaryView* views = views_.data() - offset;
+    if (options.order == SortOrder::Ascending) {
+      std::stable_sort(non_nulls.first, non_nulls.second,
+                       [views](uint64_t left, uint64_t right) {
+                         return views[left] < views[right];
+                       });
+    } else {
+      std::stable_sort(non_nulls.first, non_nulls.second,
+                       [views](uint64_t left, uint64_t right) {
+                         return views[right] < views[left];
+                       });
     }
-    std::stable_sort(indices_begin, nulls_begin,
-                     [&values](uint64_t left, uint64_t right) {
-                       return values.GetView(left) < values.GetView(right);
-                     });
   }
+
+ private:
+  std::vector<BinaryView> views_;
 };
 
 template <typename ArrowType>
@@ -148,12 +232,13 @@ class CountSorter {
     value_range_ = static_cast<uint32_t>(max - min) + 1;
   }
 
-  void Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values) {
+  void Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values,
+            int64_t offset, const ArraySortOptions& options) {
     // 32bit counter performs much better than 64bit one
     if (values.length() < (1LL << 32)) {
-      SortInternal<uint32_t>(indices_begin, indices_end, values);
+      SortInternal<uint32_t>(indices_begin, indices_end, values, offset, options);
     } else {
-      SortInternal<uint64_t>(indices_begin, indices_end, values);
+      SortInternal<uint64_t>(indices_begin, indices_end, values, offset, options);
     }
   }
 
@@ -163,28 +248,130 @@ class CountSorter {
 
   template <typename CounterType>
   void SortInternal(uint64_t* indices_begin, uint64_t* indices_end,
-                    const ArrayType& values) {
+                    const ArrayType& values, int64_t offset,
+                    const ArraySortOptions& options) {
     const uint32_t value_range = value_range_;
+    const c_type* data = values.raw_values();
+    const bool descending = options.order == SortOrder::Descending;
+    // The position of a value in the sorted order of the distinct values
+    auto rank = [&](c_type v) -> uint32_t {
+      const auto r = static_cast<uint32_t>(v - min_);
+      return descending ? value_range - 1 - r : r;
+    };
+
+    // Copy the input order, as the output is written over it
+    const std::vector<uint64_t> input(indices_begin, indices_end);
 
     // first slot reserved for prefix sum
     std::vector<CounterType> counts(1 + value_range);
-
-    VisitRawValuesInline(
-        values, [&](c_type v) { ++counts[v - min_ + 1]; }, []() {});
+    int64_t null_count = 0;
+    for (uint64_t ind : input) {
+      if (values.IsNull(ind - offset)) {
+        ++null_count;
+      } else {
+        ++counts[rank(data[ind - offset]) + 1];
+      }
+    }
 
     for (uint32_t i = 1; i <= value_range; ++i) {
       counts[i] += counts[i - 1];
     }
 
-    int64_t index = 0;
-    VisitRawValuesInline(
-        values, [&](c_type v) { indices_begin[counts[v - min_]++] = index++; },
-        [&]() { indices_begin[counts[value_range]++] = index++; });
+    const int64_t non_null_count = static_cast<int64_t>(input.size()) - null_count;
+    uint64_t* non_nulls_begin = indices_begin;
+    uint64_t* nulls_out = indices_begin + non_null_count;
+    if (options.null_placement == NullPlacement::AtStart) {
+      non_nulls_begin = indices_begin + null_count;
+      nulls_out = indices_begin;
+    }
+    for (uint64_t ind : input) {
+      if (values.IsNull(ind - offset)) {
+        *nulls_out++ = ind;
+      } else {
+        non_nulls_begin[counts[rank(data[ind - offset])]++] = ind;
+      }
+    }
   }
 };
 
-// Sort integers with counting sort or comparison based sorting algorithm
+// LSD radix sort over the bytes of integer keys. Passes over bytes which are
+// identical for all values (e.g. the high bytes of small values) are skipped.
+template <typename ArrowType>
+class RadixSorter {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using c_type = typename ArrowType::c_type;
+  using KeyType = typename std::make_unsigned<c_type>::type;
+
+  static constexpr int kRadixBits = 8;
+  static constexpr int kNumBuckets = 1 << kRadixBits;
+  static constexpr int kNumPasses = static_cast<int>(sizeof(KeyType));
+
+ public:
+  void Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values,
+            int64_t offset, const ArraySortOptions& options) {
+    auto non_nulls = PartitionNulls(indices_begin, indices_end, values, offset,
+                                    options.null_placement);
+    const int64_t length = non_nulls.second - non_nulls.first;
+    if (length <= 1) {
+      return;
+    }
+
+    // Map values to unsigned keys whose unsigned order is the requested order
+    const c_type* data = values.raw_values();
+    const KeyType sign_flip =
+        std::is_signed<c_type>::value ? KeyType(KeyType(1) << (kNumPasses * 8 - 1)) : 0;
+    const KeyType order_flip =
+        options.order == SortOrder::Descending ? std::numeric_limits<KeyType>::max() : 0;
+
+    std::vector<KeyType> keys(length), keys_scratch(length);
+    std::vector<uint64_t> indices_scratch(length);
+    for (int64_t i = 0; i < length; ++i) {
+      const auto value = static_cast<KeyType>(data[non_nulls.first[i] - offset]);
+      keys[i] = static_cast<KeyType>(value ^ sign_flip ^ order_flip);
+    }
+
+    KeyType* keys_in = keys.data();
+    KeyType* keys_out = keys_scratch.data();
+    uint64_t* indices_in = non_nulls.first;
+    uint64_t* indices_out = indices_scratch.data();
+
+    std::array<int64_t, kNumBuckets> counts;
+    for (int pass = 0; pass < kNumPasses; ++pass) {
+      const int shift = pass * kRadixBits;
+      counts.fill(0);
+      for (int64_t i = 0; i < length; ++i) {
+        ++counts[(keys_in[i] >> shift) & (kNumBuckets - 1)];
+      }
+      if (counts[(keys_in[0] >> shift) & (kNumBuckets - 1)] == length) {
+        // All values share this byte
+        continue;
+      }
+      int64_t sum = 0;
+      for (auto& count : counts) {
+        const int64_t bucket_count = count;
+        count = sum;
+        sum += bucket_count;
+      }
+      for (int64_t i = 0; i < length; ++i) {
+        const auto bucket = (keys_in[i] >> shift) & (kNumBuckets - 1);
+        const int64_t pos = counts[bucket]++;
+        keys_out[pos] = keys_in[i];
+        indices_out[pos] = indices_in[i];
+      }
+      std::swap(keys_in, keys_out);
+      std::swap(indices_in, indices_out);
+    }
+
+    if (indices_in != non_nulls.first) {
+      std::copy(indices_in, indices_in + length, non_nulls.first);
+    }
+  }
+};
+
+// Sort integers with counting sort, radix sort or comparison based sorting
+// algorithm
 // - Use O(n) counting sort if values are in a small range
+// - Use O(n) radix sort if there are many values
 // - Use O(nlogn) std::stable_sort otherwise
 template <typename ArrowType>
 class CountOrCompareSorter {
@@ -192,7 +379,8 @@ class CountOrCompareSorter {
   using c_type = typename ArrowType::c_type;
 
  public:
-  void Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values) {
+  void Sort(uint64_t* indices_begin, uint64_t* indices_end, const ArrayType& values,
+            int64_t offset, const ArraySortOptions& options) {
     if (values.length() >= countsort_min_len_ && values.length() > values.null_count()) {
       c_type min{std::numeric_limits<c_type>::max()};
       c_type max{std::numeric_limits<c_type>::min()};
@@ -210,17 +398,23 @@ class CountOrCompareSorter {
       if (static_cast<uint64_t>(max) - static_cast<uint64_t>(min) <=
           countsort_max_range_) {
         count_sorter_.SetMinMax(min, max);
-        count_sorter_.Sort(indices_begin, indices_end, values);
+        count_sorter_.Sort(indices_begin, indices_end, values, offset, options);
         return;
       }
     }
 
-    compare_sorter_.Sort(indices_begin, indices_end, values);
+    if (values.length() >= radixsort_min_len_) {
+      radix_sorter_.Sort(indices_begin, indices_end, values, offset, options);
+      return;
+    }
+
+    compare_sorter_.Sort(indices_begin, indices_end, values, offset, options);
   }
 
  private:
   CompareSorter<ArrowType> compare_sorter_;
   CountSorter<ArrowType> count_sorter_;
+  RadixSorter<ArrowType> radix_sorter_;
 
   // Cross point to prefer counting sort than stl::stable_sort(merge sort)
   // - array to be sorted is longer than "count_min_len_"
@@ -233,6 +427,11 @@ class CountOrCompareSorter {
   // See https://issues.apache.org/jira/browse/ARROW-1571 for detailed analysis.
   static const uint32_t countsort_min_len_ = 1024;
   static const uint32_t countsort_max_range_ = 4096;
+
+  // Cross point to prefer radix sort than stl::stable_sort(merge sort). Radix
+  // sort does a fixed number of passes over the values, so it only pays off
+  // once log2(length) exceeds the number of (non skipped) passes.
+  static const uint32_t radixsort_min_len_ = 1 << 16;
 };
 
 template <typename Type, typename Enable = void>
@@ -257,15 +456,23 @@ struct Sorter<Type, enable_if_t<is_integer_type<Type>::value &&
 };
 
 template <typename Type>
-struct Sorter<Type, enable_if_t<is_floating_type<Type>::value ||
-                                is_base_binary_type<Type>::value>> {
+struct Sorter<Type, enable_if_t<is_floating_type<Type>::value>> {
   CompareSorter<Type> impl;
 };
 
+template <typename Type>
+struct Sorter<Type, enable_if_t<is_base_binary_type<Type>::value>> {
+  BinaryViewSorter<Type> impl;
+};
+
+using ArraySortIndicesState = internal::OptionsWrapper<ArraySortOptions>;
+
 template <typename OutType, typename InType>
-struct SortIndices {
+struct ArraySortIndices {
   using ArrayType = typename TypeTraits<InType>::ArrayType;
   static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const auto& options = ArraySortIndicesState::Get(ctx);
+
     std::shared_ptr<ArrayData> arg0;
     KERNEL_RETURN_IF_ERROR(
         ctx,
@@ -274,15 +481,17 @@ struct SortIndices {
     ArrayData* out_arr = out->mutable_array();
     uint64_t* out_begin = out_arr->GetMutableValues<uint64_t>(1);
     uint64_t* out_end = out_begin + arr.length();
+    std::iota(out_begin, out_end, 0);
 
     Sorter<InType> sorter;
-    sorter.impl.Sort(out_begin, out_end, arr);
+    sorter.impl.Sort(out_begin, out_end, arr, 0, options);
   }
 };
 
 // Sort indices kernels implemented for
 //
 // * Number types
+// * Temporal types (through their physical integer representation)
 // * Base binary types
 
 template <template <typename...> class ExecTemplate>
@@ -292,6 +501,16 @@ void AddSortingKernels(VectorKernel base, VectorFunction* func) {
     base.exec = GenerateNumeric<ExecTemplate, UInt64Type>(*ty);
     DCHECK_OK(func->AddKernel(base));
   }
+  for (const auto id : {Type::DATE32, Type::TIME32}) {
+    base.signature = KernelSignature::Make({InputType::Array(id)}, uint64());
+    base.exec = ExecTemplate<UInt64Type, Int32Type>::Exec;
+    DCHECK_OK(func->AddKernel(base));
+  }
+  for (const auto id : {Type::DATE64, Type::TIME64, Type::TIMESTAMP, Type::DURATION}) {
+    base.signature = KernelSignature::Make({InputType::Array(id)}, uint64());
+    base.exec = ExecTemplate<UInt64Type, Int64Type>::Exec;
+    DCHECK_OK(func->AddKernel(base));
+  }
   for (const auto& ty : BaseBinaryTypes()) {
     base.signature = KernelSignature::Make({InputType::Array(ty)}, uint64());
     base.exec = GenerateVarBinaryBase<ExecTemplate, UInt64Type>(*ty);
@@ -299,12 +518,742 @@ void AddSortingKernels(VectorKernel base, VectorFunction* func) {
   }
 }
 
-const FunctionDoc sort_indices_doc(
+// ----------------------------------------------------------------------
+// Multiple key and chunked sorting
+//
+// A table (or chunked array) is cut into record batches along the chunk
+// boundaries of its columns, without copying. Each batch is sorted by
+// successive stable sorts from the least to the most significant sort key,
+// reusing the array sorters above. The sorted runs of the batches are then
+// merged pairwise, comparing rows across batches.
+
+// The physical type a sort key is sorted as: temporal types are sorted
+// through their integer representation
+std::shared_ptr<DataType> GetPhysicalType(const std::shared_ptr<DataType>& type) {
+  switch (type->id()) {
+    case Type::DATE32:
+    case Type::TIME32:
+      return int32();
+    case Type::DATE64:
+    case Type::TIME64:
+    case Type::TIMESTAMP:
+    case Type::DURATION:
+      return int64();
+    case Type::EXTENSION: {
+      // Extension values are sorted like their storage if the type allows it
+      const auto& ext_type = checked_cast<const ExtensionType&>(*type);
+      return ext_type.ComputeOnStorage() ? GetPhysicalType(ext_type.storage_type())
+                                         : type;
+    }
+    default:
+      return type;
+  }
+}
+
+Result<std::shared_ptr<Array>> GetPhysicalArray(const Array& array) {
+  if (array.type_id() == Type::EXTENSION &&
+      checked_cast<const ExtensionType&>(*array.type()).ComputeOnStorage()) {
+    return GetPhysicalArray(*checked_cast<const ExtensionArray&>(array).storage());
+  }
+  auto physical_type = GetPhysicalType(array.type());
+  if (physical_type == array.type()) {
+    return MakeArray(array.data());
+  }
+  return array.View(physical_type);
+}
+
+// Visits the physical type of a sort key, failing on unsupported types
+template <typename Visitor>
+Status VisitSortKeyType(const DataType& type, Visitor&& visitor) {
+  switch (type.id()) {
+#define VISIT_SORT_KEY(TYPE_CLASS)    \
+  case TYPE_CLASS##Type::type_id:     \
+    return visitor.template Visit<TYPE_CLASS##Type>();
+    VISIT_SORT_KEY(Int8)
+    VISIT_SORT_KEY(Int16)
+    VISIT_SORT_KEY(Int32)
+    VISIT_SORT_KEY(Int64)
+    VISIT_SORT_KEY(UInt8)
+    VISIT_SORT_KEY(UInt16)
+    VISIT_SORT_KEY(UInt32)
+    VISIT_SORT_KEY(UInt64)
+    VISIT_SORT_KEY(Float)
+    VISIT_SORT_KEY(Double)
+    VISIT_SORT_KEY(Binary)
+    VISIT_SORT_KEY(String)
+    VISIT_SORT_KEY(LargeBinary)
+    VISIT_SORT_KEY(LargeString)
+#undef VISIT_SORT_KEY
+    default:
+      return Status::TypeError("Sorting not supported for type ", type);
+  }
+}
+
+struct SortKeyTypeCheck {
+  template <typename Type>
+  Status Visit() {
+    return Status::OK();
+  }
+};
+
+// Stably sort a range of indices by the values of one column
+struct SortByColumn {
+  template <typename Type>
+  Status Visit() {
+    using ArrayType = typename TypeTraits<Type>::ArrayType;
+    Sorter<Type> sorter;
+    sorter.impl.Sort(indices_begin, indices_end,
+                     ::arrow::internal::checked_cast<const ArrayType&>(values), offset,
+                     options);
+    return Status::OK();
+  }
+
+  const Array& values;
+  uint64_t* indices_begin;
+  uint64_t* indices_end;
+  int64_t offset;
+  ArraySortOptions options;
+};
+
+// Compares the rows of one column across the record batches of a table
+class ColumnComparator {
+ public:
+  virtual ~ColumnComparator() = default;
+
+  virtual int Compare(int64_t left_batch, int64_t left_index, int64_t right_batch,
+                      int64_t right_index) const = 0;
+};
+
+template <typename Type>
+class TypedColumnComparator : public ColumnComparator {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+
+ public:
+  TypedColumnComparator(ArrayVector arrays, SortOrder order,
+                        NullPlacement null_placement)
+      : arrays_(std::move(arrays)), order_(order), null_placement_(null_placement) {
+    for (const auto& array : arrays_) {
+      typed_arrays_.push_back(
+          ::arrow::internal::checked_cast<const ArrayType*>(array.get()));
+    }
+  }
+
+  int Compare(int64_t left_batch, int64_t left_index, int64_t right_batch,
+              int64_t right_index) const override {
+    const ArrayType& left = *typed_arrays_[left_batch];
+    const ArrayType& right = *typed_arrays_[right_batch];
+    const bool left_null = left.IsNull(left_index);
+    const bool right_null = right.IsNull(right_index);
+    if (left_null || right_null) {
+      if (left_null && right_null) return 0;
+      return left_null == (null_placement_ == NullPlacement::AtStart) ? -1 : 1;
+    }
+    const auto left_value = left.GetView(left_index);
+    const auto right_value = right.GetView(right_index);
+    int compared = left_value < right_value ? -1 : (right_value < left_value ? 1 : 0);
+    return order_ == SortOrder::Ascending ? compared : -compared;
+  }
+
+ private:
+  ArrayVector arrays_;
+  std::vector<const ArrayType*> typed_arrays_;
+  SortOrder order_;
+  NullPlacement null_placement_;
+};
+
+struct ColumnComparatorFactory {
+  template <typename Type>
+  Status Visit() {
+    out.reset(new TypedColumnComparator<Type>(std::move(arrays), order, null_placement));
+    return Status::OK();
+  }
+
+  ArrayVector arrays;
+  SortOrder order;
+  NullPlacement null_placement;
+  std::unique_ptr<ColumnComparator> out;
+};
+
+// Resolve a logical row index to a (batch, index in batch) location,
+// caching the last resolved batch as consecutive lookups tend to hit it.
+class BatchResolver {
+ public:
+  explicit BatchResolver(const std::vector<int64_t>& offsets) : offsets_(offsets) {}
+
+  std::pair<int64_t, int64_t> Resolve(int64_t index) const {
+    if (index < offsets_[cached_batch_] || index >= offsets_[cached_batch_ + 1]) {
+      auto it = std::upper_bound(offsets_.begin(), offsets_.end(), index);
+      cached_batch_ = static_cast<int64_t>(it - offsets_.begin()) - 1;
+    }
+    return {cached_batch_, index - offsets_[cached_batch_]};
+  }
+
+ private:
+  const std::vector<int64_t>& offsets_;
+  mutable int64_t cached_batch_ = 0;
+};
+
+struct ResolvedSortKey {
+  // The key column, one array per record batch
+  ArrayVector arrays;
+  SortOrder order;
+};
+
+// Compares rows, given by their logical index, by all sort keys.  Not thread-safe
+// as the resolvers cache the last batches resolved: each thread needs its own.
+class RowComparator {
+ public:
+  RowComparator(const std::vector<std::unique_ptr<ColumnComparator>>& comparators,
+                const std::vector<int64_t>& batch_offsets)
+      : comparators_(comparators),
+        left_resolver_(batch_offsets),
+        right_resolver_(batch_offsets) {}
+
+  bool operator()(uint64_t left, uint64_t right) const {
+    const auto left_loc = left_resolver_.Resolve(static_cast<int64_t>(left));
+    const auto right_loc = right_resolver_.Resolve(static_cast<int64_t>(right));
+    for (const auto& comparator : comparators_) {
+      const int compared = comparator->Compare(left_loc.first, left_loc.second,
+                                               right_loc.first, right_loc.second);
+      if (compared != 0) return compared < 0;
+    }
+    return false;
+  }
+
+ private:
+  const std::vector<std::unique_ptr<ColumnComparator>>& comparators_;
+  BatchResolver left_resolver_, right_resolver_;
+};
+
+// The number of elements of `left` among the first `k` elements of the stable
+// merge of the sorted ranges `left` and `right` (the "merge path" co-rank)
+template <typename Comparator>
+int64_t MergeCoRank(const uint64_t* left, int64_t left_length, const uint64_t* right,
+                    int64_t right_length, int64_t k, Comparator&& less) {
+  int64_t lo = std::max<int64_t>(0, k - right_length);
+  int64_t hi = std::min(k, left_length);
+  while (lo < hi) {
+    const int64_t i = lo + (hi - lo + 1) / 2;
+    // left[i - 1] is merged before right[k - i] unless strictly greater
+    if (!less(right[k - i], left[i - 1])) {
+      lo = i;
+    } else {
+      hi = i - 1;
+    }
+  }
+  return lo;
+}
+
+// Sorts the rows of record batches by several keys.
+//
+// The batches are cut into runs, each sorted key by key from the least
+// significant one, then adjacent runs are merged bottom-up.  With threads, runs
+// are sorted in parallel and each merge is cut into slices of similar length by
+// binary search of the merge path, which are merged in parallel too.
+class MultipleKeySorter {
+ public:
+  MultipleKeySorter(std::vector<ResolvedSortKey> sort_keys, int64_t num_rows,
+                    NullPlacement null_placement, ExecContext* ctx)
+      : sort_keys_(std::move(sort_keys)),
+        num_rows_(num_rows),
+        null_placement_(null_placement),
+        ctx_(ctx) {}
+
+  Result<std::shared_ptr<Array>> Sort() {
+    ARROW_ASSIGN_OR_RAISE(
+        auto indices_buffer,
+        AllocateBuffer(num_rows_ * sizeof(uint64_t), ctx_->memory_pool()));
+    uint64_t* indices = reinterpret_cast<uint64_t*>(indices_buffer->mutable_data());
+
+    const size_t num_batches = sort_keys_.empty() ? 0 : sort_keys_[0].arrays.size();
+    batch_offsets_.assign(1, 0);
+    for (size_t batch = 0; batch < num_batches; ++batch) {
+      batch_offsets_.push_back(batch_offsets_.back() +
+                               sort_keys_[0].arrays[batch]->length());
+    }
+    DCHECK_EQ(batch_offsets_.back(), num_rows_);
+
+    // Without threads, runs are the batches.  With threads, batches are also cut
+    // so that there are about as many runs as threads.
+    const int num_threads =
+        ctx_->use_threads() ? std::max(1, GetCpuThreadPoolCapacity()) : 1;
+    task_length_ = num_rows_;
+    if (num_threads > 1) {
+      task_length_ = std::max(kMinTaskLength, BitUtil::CeilDiv(num_rows_, num_threads));
+    }
+    struct Run {
+      size_t batch;
+      int64_t offset, length;
+    };
+    std::vector<Run> runs;
+    run_offsets_.assign(1, 0);
+    for (size_t batch = 0; batch < num_batches; ++batch) {
+      const int64_t batch_end = batch_offsets_[batch + 1];
+      for (int64_t offset = batch_offsets_[batch]; offset < batch_end;
+           offset += task_length_) {
+        const int64_t length = std::min(task_length_, batch_end - offset);
+        runs.push_back({batch, offset, length});
+        run_offsets_.push_back(offset + length);
+      }
+    }
+
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        num_threads > 1 && runs.size() > 1, static_cast<int>(runs.size()),
+        [&](int i) -> Status {
+          const Run& run = runs[i];
+          uint64_t* begin = indices + run.offset;
+          uint64_t* end = begin + run.length;
+          std::iota(begin, end, run.offset);
+          for (auto it = sort_keys_.rbegin(); it != sort_keys_.rend(); ++it) {
+            auto values = it->arrays[run.batch]->Slice(
+                run.offset - batch_offsets_[run.batch], run.length);
+            SortByColumn visitor{*values, begin, end, run.offset,
+                                 ArraySortOptions(it->order, null_placement_)};
+            RETURN_NOT_OK(VisitSortKeyType(*values->type(), visitor));
+          }
+          return Status::OK();
+        }));
+
+    if (runs.size() > 1) {
+      RETURN_NOT_OK(MergeRuns(indices, num_threads > 1));
+    }
+    return std::make_shared<UInt64Array>(num_rows_, std::move(indices_buffer));
+  }
+
+ private:
+  // The minimum number of rows of the runs sorted, and of the slices of runs
+  // merged, by one task when sorting in parallel
+  static constexpr int64_t kMinTaskLength = 1 << 16;
+
+  // Bottom-up merge of adjacent sorted runs
+  Status MergeRuns(uint64_t* indices, bool use_threads) {
+    std::vector<std::unique_ptr<ColumnComparator>> comparators;
+    for (auto& sort_key : sort_keys_) {
+      ColumnComparatorFactory factory{std::move(sort_key.arrays), sort_key.order,
+                                      null_placement_, nullptr};
+      RETURN_NOT_OK(VisitSortKeyType(*factory.arrays[0]->type(), factory));
+      comparators.push_back(std::move(factory.out));
+    }
+
+    // A slice [out_begin, out_end) of the output of merging the runs
+    // [first, middle) and [middle, last)
+    struct MergeTask {
+      size_t first, middle, last;
+      int64_t out_begin, out_end;
+    };
+
+    std::vector<uint64_t> scratch(num_rows_);
+    uint64_t* in = indices;
+    uint64_t* out = scratch.data();
+    const size_t num_runs = run_offsets_.size() - 1;
+    for (size_t width = 1; width < num_runs; width *= 2) {
+      std::vector<MergeTask> tasks;
+      for (size_t first = 0; first < num_runs; first += 2 * width) {
+        const size_t middle = std::min(first + width, num_runs);
+        const size_t last = std::min(first + 2 * width, num_runs);
+        for (int64_t out_begin = run_offsets_[first]; out_begin < run_offsets_[last];
+             out_begin += task_length_) {
+          tasks.push_back({first, middle, last, out_begin,
+                           std::min(out_begin + task_length_, run_offsets_[last])});
+        }
+      }
+
+      RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+          use_threads && tasks.size() > 1, static_cast<int>(tasks.size()),
+          [&](int i) -> Status {
+            const MergeTask& task = tasks[i];
+            RowComparator less(comparators, batch_offsets_);
+            const int64_t base = run_offsets_[task.first];
+            const uint64_t* left = in + base;
+            const int64_t left_length = run_offsets_[task.middle] - base;
+            const uint64_t* right = in + run_offsets_[task.middle];
+            const int64_t right_length =
+                run_offsets_[task.last] - run_offsets_[task.middle];
+            // Locate the slice of each run which this slice of output merges
+            const int64_t left_begin = MergeCoRank(left, left_length, right,
+                                                   right_length, task.out_begin - base,
+                                                   less);
+            const int64_t left_end = MergeCoRank(left, left_length, right,
+                                                 right_length, task.out_end - base,
+                                                 less);
+            const int64_t right_begin = task.out_begin - base - left_begin;
+            const int64_t right_end = task.out_end - base - left_end;
+            // std::merge takes from the first range on ties, which keeps it stable
+            std::merge(left + left_begin, left + left_end, right + right_begin,
+                       right + right_end, out + task.out_begin, less);
+            return Status::OK();
+          }));
+      std::swap(in, out);
+    }
+    if (in != indices) {
+      std::copy(in, in + num_rows_, indices);
+    }
+    return Status::OK();
+  }
+
+  std::vector<ResolvedSortKey> sort_keys_;
+  int64_t num_rows_;
+  NullPlacement null_placement_;
+  ExecContext* ctx_;
+  std::vector<int64_t> batch_offsets_;
+  std::vector<int64_t> run_offsets_;
+  int64_t task_length_ = 0;
+};
+
+constexpr int64_t MultipleKeySorter::kMinTaskLength;
+
+// Look up the sort key columns of a table and slice them into batches along
+// chunk boundaries (zero-copy)
+Result<std::vector<ResolvedSortKey>> ResolveTableSortKeys(
+    const Table& table, const std::vector<SortKey>& sort_keys) {
+  if (sort_keys.empty()) {
+    return Status::Invalid("Must specify one or more sort keys");
+  }
+  std::vector<int> key_columns;
+  std::vector<ResolvedSortKey> resolved(sort_keys.size());
+  for (size_t i = 0; i < sort_keys.size(); ++i) {
+    const int column = table.schema()->GetFieldIndex(sort_keys[i].name);
+    if (column < 0) {
+      return Status::Invalid("Nonexistent sort key column: ", sort_keys[i].name);
+    }
+    RETURN_NOT_OK(VisitSortKeyType(
+        *GetPhysicalType(table.schema()->field(column)->type()), SortKeyTypeCheck{}));
+    key_columns.push_back(column);
+    resolved[i].order = sort_keys[i].order;
+  }
+
+  TableBatchReader reader(table);
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+    if (batch == nullptr) break;
+    if (batch->num_rows() == 0) continue;
+    for (size_t i = 0; i < resolved.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto array, GetPhysicalArray(*batch->column(key_columns[i])));
+      resolved[i].arrays.push_back(std::move(array));
+    }
+  }
+  return resolved;
+}
+
+Result<std::shared_ptr<Array>> SortTable(const Table& table, const SortOptions& options,
+                                         ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(auto sort_keys, ResolveTableSortKeys(table, options.sort_keys));
+  MultipleKeySorter sorter(std::move(sort_keys), table.num_rows(),
+                           options.null_placement, ctx);
+  return sorter.Sort();
+}
+
+Result<std::shared_ptr<Array>> SortChunkedArray(const ChunkedArray& chunked_array,
+                                                const SortOptions& options,
+                                                ExecContext* ctx) {
+  // Only the order of the first sort key applies
+  SortOrder order = SortOrder::Ascending;
+  if (!options.sort_keys.empty()) {
+    order = options.sort_keys[0].order;
+  }
+
+  RETURN_NOT_OK(
+      VisitSortKeyType(*GetPhysicalType(chunked_array.type()), SortKeyTypeCheck{}));
+
+  std::vector<ResolvedSortKey> sort_keys(1);
+  sort_keys[0].order = order;
+  for (const auto& chunk : chunked_array.chunks()) {
+    if (chunk->length() == 0) continue;
+    ARROW_ASSIGN_OR_RAISE(auto array, GetPhysicalArray(*chunk));
+    sort_keys[0].arrays.push_back(std::move(array));
+  }
+  MultipleKeySorter sorter(std::move(sort_keys), chunked_array.length(),
+                           options.null_placement, ctx);
+  return sorter.Sort();
+}
+
+// ----------------------------------------------------------------------
+// select_k_unstable implementation
+//
+// The first k rows are selected with a bounded heap of the best rows seen so
+// far, whose top is the last of them in sort order. Rows are fed chunk by
+// chunk, and once the heap is full a row costs a single comparison against
+// the top unless it replaces it. This is O(n log k) and only needs memory
+// proportional to k.
+
+// Offer an item to a bounded heap of at most k items. `before` is the sort
+// order of the items.
+template <typename Item, typename Comparator>
+void PushBounded(std::vector<Item>* heap, int64_t k, Item item, Comparator&& before) {
+  if (static_cast<int64_t>(heap->size()) < k) {
+    heap->push_back(std::move(item));
+    std::push_heap(heap->begin(), heap->end(), before);
+  } else if (k > 0 && before(item, heap->front())) {
+    std::pop_heap(heap->begin(), heap->end(), before);
+    heap->back() = std::move(item);
+    std::push_heap(heap->begin(), heap->end(), before);
+  }
+}
+
+Result<std::shared_ptr<Array>> MakeIndicesArray(const std::vector<uint64_t>& indices,
+                                                ExecContext* ctx) {
+  const auto length = static_cast<int64_t>(indices.size());
+  ARROW_ASSIGN_OR_RAISE(auto buffer,
+                        AllocateBuffer(length * sizeof(uint64_t), ctx->memory_pool()));
+  std::copy(indices.begin(), indices.end(),
+            reinterpret_cast<uint64_t*>(buffer->mutable_data()));
+  return std::make_shared<UInt64Array>(length, std::move(buffer));
+}
+
+// Select by a single key, comparing values directly. Nulls are set aside
+// and only selected when there are fewer than k non-null values.
+struct SingleKeySelecter {
+  template <typename Type>
+  Status Visit() {
+    using ArrayType = typename TypeTraits<Type>::ArrayType;
+    using ValueType = decltype(std::declval<ArrayType>().GetView(0));
+    using Item = std::pair<ValueType, uint64_t>;
+
+    if (order == SortOrder::Ascending) {
+      return Select<ArrayType>(
+          [](const Item& left, const Item& right) { return left.first < right.first; });
+    }
+    return Select<ArrayType>(
+        [](const Item& left, const Item& right) { return right.first < left.first; });
+  }
+
+  template <typename ArrayType, typename Comparator>
+  Status Select(Comparator&& before) {
+    using ValueType = decltype(std::declval<ArrayType>().GetView(0));
+    std::vector<std::pair<ValueType, uint64_t>> heap;
+    heap.reserve(static_cast<size_t>(k));
+    std::vector<uint64_t> nulls;
+
+    uint64_t offset = 0;
+    for (const auto& chunk : chunks) {
+      const auto& values = ::arrow::internal::checked_cast<const ArrayType&>(*chunk);
+      for (int64_t i = 0; i < values.length(); ++i) {
+        if (values.IsNull(i)) {
+          if (static_cast<int64_t>(nulls.size()) < k) nulls.push_back(offset + i);
+        } else {
+          PushBounded(&heap, k, std::make_pair(values.GetView(i), offset + i), before);
+        }
+      }
+      offset += values.length();
+    }
+
+    std::sort_heap(heap.begin(), heap.end(), before);
+    std::vector<uint64_t> indices;
+    for (const auto& item : heap) {
+      indices.push_back(item.second);
+    }
+    for (auto it = nulls.begin();
+         it != nulls.end() && static_cast<int64_t>(indices.size()) < k; ++it) {
+      indices.push_back(*it);
+    }
+    return MakeIndicesArray(indices, ctx).Value(&out);
+  }
+
+  const ArrayVector& chunks;
+  SortOrder order;
+  int64_t k;
+  ExecContext* ctx;
+  std::shared_ptr<Array> out;
+};
+
+Result<std::shared_ptr<Array>> SelectKSingleKey(const ArrayVector& chunks,
+                                                const std::shared_ptr<DataType>& type,
+                                                SortOrder order, int64_t k,
+                                                ExecContext* ctx) {
+  ArrayVector physical_chunks;
+  for (const auto& chunk : chunks) {
+    ARROW_ASSIGN_OR_RAISE(auto physical_chunk, GetPhysicalArray(*chunk));
+    physical_chunks.push_back(std::move(physical_chunk));
+  }
+  SingleKeySelecter selecter{physical_chunks, order, k, ctx, nullptr};
+  RETURN_NOT_OK(VisitSortKeyType(*GetPhysicalType(type), selecter));
+  return selecter.out;
+}
+
+// Select by several keys, comparing rows lexicographically through the
+// column comparators of the multiple key sort
+Result<std::shared_ptr<Array>> SelectKMultipleKeys(std::vector<ResolvedSortKey> sort_keys,
+                                                   int64_t k, ExecContext* ctx) {
+  std::vector<int64_t> batch_lengths;
+  for (const auto& array : sort_keys[0].arrays) {
+    batch_lengths.push_back(array->length());
+  }
+
+  std::vector<std::unique_ptr<ColumnComparator>> comparators;
+  for (auto& sort_key : sort_keys) {
+    if (sort_key.arrays.empty()) {
+      return MakeIndicesArray({}, ctx);
+    }
+    ColumnComparatorFactory factory{std::move(sort_key.arrays), sort_key.order,
+                                    NullPlacement::AtEnd, nullptr};
+    RETURN_NOT_OK(VisitSortKeyType(*factory.arrays[0]->type(), factory));
+    comparators.push_back(std::move(factory.out));
+  }
+
+  // A row as (batch, index in batch, index in input)
+  struct Row {
+    int64_t batch;
+    int64_t index;
+    uint64_t global_index;
+  };
+  auto before = [&comparators](const Row& left, const Row& right) {
+    for (const auto& comparator : comparators) {
+      const int compared =
+          comparator->Compare(left.batch, left.index, right.batch, right.index);
+      if (compared != 0) return compared < 0;
+    }
+    return false;
+  };
+
+  std::vector<Row> heap;
+  heap.reserve(static_cast<size_t>(k));
+  uint64_t offset = 0;
+  for (int64_t batch = 0; batch < static_cast<int64_t>(batch_lengths.size()); ++batch) {
+    for (int64_t i = 0; i < batch_lengths[batch]; ++i) {
+      PushBounded(&heap, k, Row{batch, i, offset + i}, before);
+    }
+    offset += batch_lengths[batch];
+  }
+
+  std::sort_heap(heap.begin(), heap.end(), before);
+  std::vector<uint64_t> indices;
+  for (const auto& row : heap) {
+    indices.push_back(row.global_index);
+  }
+  return MakeIndicesArray(indices, ctx);
+}
+
+Result<std::shared_ptr<Array>> SelectKTable(const Table& table,
+                                            const SelectKOptions& options,
+                                            ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(auto sort_keys, ResolveTableSortKeys(table, options.sort_keys));
+  if (sort_keys.size() == 1) {
+    const int column = table.schema()->GetFieldIndex(options.sort_keys[0].name);
+    return SelectKSingleKey(sort_keys[0].arrays, table.schema()->field(column)->type(),
+                            sort_keys[0].order, options.k, ctx);
+  }
+  return SelectKMultipleKeys(std::move(sort_keys), options.k, ctx);
+}
+
+const SortOptions* GetDefaultSortOptions() {
+  static const auto kDefaultSortOptions = SortOptions::Defaults();
+  return &kDefaultSortOptions;
+}
+
+const FunctionDoc array_sort_indices_doc(
     "Return the indices that would sort an array",
-    ("This function computes an array of indices that define a non-stable sort\n"
-     "of the input array.  Null values are considered greater than any\n"
-     "other value and are therefore sorted at the end of the array."),
-    {"array"});
+    ("This function computes an array of indices that define a stable sort\n"
+     "of the input array.  By default, Null values are considered greater\n"
+     "than any other value and are therefore sorted at the end of the array.\n"
+     "The sort order and the null placement can be changed through\n"
+     "ArraySortOptions."),
+    {"array"}, "ArraySortOptions");
+
+const FunctionDoc sort_indices_doc(
+    "Return the indices that would sort an array, record batch or table",
+    ("This function computes an array of indices that define a stable sort\n"
+     "of the input array, record batch or table.  By default, Null values are\n"
+     "considered greater than any other value and are therefore sorted at the\n"
+     "end of the input.  Record batches and tables are sorted lexicographically\n"
+     "by the sort keys given in SortOptions.  Chunked inputs are sorted in\n"
+     "runs, then merged, in parallel when threads are enabled."),
+    {"input"}, "SortOptions");
+
+class SortIndicesMetaFunction : public MetaFunction {
+ public:
+  SortIndicesMetaFunction()
+      : MetaFunction("sort_indices", Arity::Unary(), &sort_indices_doc,
+                     GetDefaultSortOptions()) {}
+
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const FunctionOptions* options,
+                            ExecContext* ctx) const override {
+    const auto& sort_options = static_cast<const SortOptions&>(*options);
+    switch (args[0].kind()) {
+      case Datum::ARRAY: {
+        ArraySortOptions array_options(SortOrder::Ascending,
+                                       sort_options.null_placement);
+        if (!sort_options.sort_keys.empty()) {
+          array_options.order = sort_options.sort_keys[0].order;
+        }
+        return CallFunction("array_sort_indices", {args[0]}, &array_options, ctx);
+      }
+      case Datum::CHUNKED_ARRAY:
+        return SortChunkedArray(*args[0].chunked_array(), sort_options, ctx);
+      case Datum::RECORD_BATCH: {
+        ARROW_ASSIGN_OR_RAISE(auto table,
+                              Table::FromRecordBatches({args[0].record_batch()}));
+        return SortTable(*table, sort_options, ctx);
+      }
+      case Datum::TABLE:
+        return SortTable(*args[0].table(), sort_options, ctx);
+      default:
+        break;
+    }
+    return Status::NotImplemented(
+        "Unsupported types for sort_indices operation: "
+        "values=",
+        args[0].ToString());
+  }
+};
+
+const FunctionDoc select_k_unstable_doc(
+    "Return the indices of the first k elements in the given sort order",
+    ("This function selects the indices of the first `k` elements of the\n"
+     "input array, chunked array, record batch or table, ordered by the sort\n"
+     "keys given in SelectKOptions.  The output is in sort order, but the\n"
+     "relative order of equal elements is not specified.  Null values are\n"
+     "considered greater than any other value."),
+    {"input"}, "SelectKOptions");
+
+class SelectKUnstableMetaFunction : public MetaFunction {
+ public:
+  SelectKUnstableMetaFunction()
+      : MetaFunction("select_k_unstable", Arity::Unary(), &select_k_unstable_doc) {}
+
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const FunctionOptions* options,
+                            ExecContext* ctx) const override {
+    if (options == nullptr) {
+      return Status::Invalid("select_k_unstable requires SelectKOptions");
+    }
+    const auto& select_k_options = static_cast<const SelectKOptions&>(*options);
+    if (select_k_options.k < 0) {
+      return Status::Invalid("select_k_unstable requires a nonnegative `k`, got ",
+                             select_k_options.k);
+    }
+    // For array-like inputs, only the order of the first sort key applies
+    SortOrder order = SortOrder::Ascending;
+    if (!select_k_options.sort_keys.empty()) {
+      order = select_k_options.sort_keys[0].order;
+    }
+
+    switch (args[0].kind()) {
+      case Datum::ARRAY:
+        return SelectKSingleKey({args[0].make_array()}, args[0].type(), order,
+                                select_k_options.k, ctx);
+      case Datum::CHUNKED_ARRAY: {
+        const auto& chunked_array = *args[0].chunked_array();
+        return SelectKSingleKey(chunked_array.chunks(), chunked_array.type(), order,
+                                select_k_options.k, ctx);
+      }
+      case Datum::RECORD_BATCH: {
+        ARROW_ASSIGN_OR_RAISE(auto table,
+                              Table::FromRecordBatches({args[0].record_batch()}));
+        return SelectKTable(*table, select_k_options, ctx);
+      }
+      case Datum::TABLE:
+        return SelectKTable(*args[0].table(), select_k_options, ctx);
+      default:
+        break;
+    }
+    return Status::NotImplemented(
+        "Unsupported types for select_k_unstable operation: "
+        "values=",
+        args[0].ToString());
+  }
+};
 
 const FunctionDoc partition_nth_indices_doc(
     "Return the indices that would partition an array around a pivot",
@@ -329,10 +1278,16 @@ void RegisterVectorSort(FunctionRegistry* registry) {
   base.mem_allocation = MemAllocation::PREALLOCATE;
   base.null_handling = NullHandling::OUTPUT_NOT_NULL;
 
-  auto sort_indices =
-      std::make_shared<VectorFunction>("sort_indices", Arity::Unary(), &sort_indices_doc);
-  AddSortingKernels<SortIndices>(base, sort_indices.get());
-  DCHECK_OK(registry->AddFunction(std::move(sort_indices)));
+  static auto default_array_sort_options = ArraySortOptions::Defaults();
+  auto array_sort_indices = std::make_shared<VectorFunction>(
+      "array_sort_indices", Arity::Unary(), &array_sort_indices_doc,
+      &default_array_sort_options);
+  base.init = ArraySortIndicesState::Init;
+  AddSortingKernels<ArraySortIndices>(base, array_sort_indices.get());
+  DCHECK_OK(registry->AddFunction(std::move(array_sort_indices)));
+
+  DCHECK_OK(registry->AddFunction(std::make_shared<SortIndicesMetaFunction>()));
+  DCHECK_OK(registry->AddFunction(std::make_shared<SelectKUnstableMetaFunction>()));
 
   // partition_nth_indices has a parameter so needs its init function
   auto part_indices = std::make_shared<VectorFunction>(
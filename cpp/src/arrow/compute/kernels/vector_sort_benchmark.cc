@@ -19,9 +19,12 @@
 
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/benchmark_util.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace compute {
@@ -59,6 +62,101 @@ static void SortToIndicesInt64Compare(benchmark::State& state) {
   SortToIndicesBenchmark(state, values);
 }
 
+static void SortToIndicesString(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  // Strings of 8 to 24 characters
+  const int64_t array_size = args.size / 16;
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  auto values = rand.String(array_size, 8, 24, args.null_proportion);
+
+  SortToIndicesBenchmark(state, values);
+}
+
+// Data layouts closer to real-world data than uniform draws
+enum SortDistribution {
+  kZipf,
+  kSorted,
+  kNearlySorted,
+  kSortedRuns,
+  kClusteredNulls,
+};
+
+static void SortToIndicesInt64Distribution(benchmark::State& state) {
+  const int64_t array_size = (1 << 20) / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  const auto min = std::numeric_limits<int64_t>::min();
+  const auto max = std::numeric_limits<int64_t>::max();
+
+  std::shared_ptr<Array> values;
+  switch (state.range(0)) {
+    case kZipf:
+      values = rand.ZipfInt64(array_size, /*num_unique=*/10000, /*exponent=*/1.1);
+      break;
+    case kSorted:
+      values = rand.SortedRunsInt64(array_size, min, max, /*num_runs=*/1);
+      break;
+    case kNearlySorted:
+      values = rand.SortedRunsInt64(array_size, min, max, /*num_runs=*/1,
+                                    /*disorder=*/0.01);
+      break;
+    case kSortedRuns:
+      values = rand.SortedRunsInt64(array_size, min, max, /*num_runs=*/64);
+      break;
+    default:
+      values = rand.WithClusteredNulls(*rand.Int64(array_size, min, max),
+                                       /*null_probability=*/0.2,
+                                       /*mean_null_run_length=*/1000);
+      break;
+  }
+
+  SortToIndicesBenchmark(state, values);
+}
+
+static void SortToIndicesStringPrefixes(benchmark::State& state) {
+  // Strings sharing 24-character prefixes, so that comparisons look past them
+  const int64_t array_size = (1 << 20) / 32;
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  auto values = rand.StringWithPrefixes(array_size, /*unique=*/array_size / 4,
+                                        /*num_prefixes=*/16, /*prefix_length=*/24,
+                                        /*min_suffix_length=*/4,
+                                        /*max_suffix_length=*/12);
+
+  SortToIndicesBenchmark(state, values);
+}
+
+// Sort a table of 1M rows in 8 chunks by (int64, string) keys with a given number
+// of CPU threads
+static void SortTableIndicesThreads(benchmark::State& state) {
+  const int64_t num_rows = 1 << 20;
+  const int num_chunks = 8;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto schema = ::arrow::schema({field("i", int64()), field("s", utf8())});
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int i = 0; i < num_chunks; ++i) {
+    const int64_t length = num_rows / num_chunks;
+    batches.push_back(RecordBatch::Make(
+        schema, length,
+        {rand.Int64(length, 0, 1 << 16, /*null_probability=*/0.01),
+         rand.String(length, 4, 12, /*null_probability=*/0.01)}));
+  }
+  auto table = *Table::FromRecordBatches(schema, batches);
+  SortOptions options({SortKey("i"), SortKey("s", SortOrder::Descending)});
+
+  const int num_threads = static_cast<int>(state.range(0));
+  const int old_capacity = GetCpuThreadPoolCapacity();
+  ABORT_NOT_OK(SetCpuThreadPoolCapacity(num_threads));
+  ExecContext ctx;
+  ctx.set_use_threads(num_threads > 1);
+  for (auto _ : state) {
+    ABORT_NOT_OK(SortIndices(table, options, &ctx).status());
+  }
+  ABORT_NOT_OK(SetCpuThreadPoolCapacity(old_capacity));
+  state.SetItemsProcessed(state.iterations() * num_rows);
+}
+
 BENCHMARK(SortToIndicesInt64Count)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 1})
@@ -73,5 +171,30 @@ BENCHMARK(SortToIndicesInt64Compare)
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+BENCHMARK(SortToIndicesString)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 0})
+    ->Args({1 << 23, 0})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(SortToIndicesInt64Distribution)
+    ->ArgName("distribution")
+    ->DenseRange(kZipf, kClusteredNulls)
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(SortToIndicesStringPrefixes)
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(SortTableIndicesThreads)
+    ->ArgName("threads")
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->MinTime(1.0)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
 }  // namespace compute
 }  // namespace arrow
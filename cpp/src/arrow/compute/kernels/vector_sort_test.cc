@@ -22,6 +22,8 @@
 
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -275,6 +277,20 @@ TYPED_TEST(TestSortToIndicesKernelForStrings, SortStrings) {
   this->AssertSortToIndices(R"(["foo", "bar", "baz"])", "[1,2,0]");
 
   this->AssertSortToIndices(R"(["testing", "sort", "for", "strings"])", "[2, 1, 3, 0]");
+
+  // Shared prefixes, around the size of the inline views
+  this->AssertSortToIndices(
+      R"(["abcdefghijklm", "abcdefghijkl", "abcd", "abc", "abcdefghijklmn", "abce", ""])",
+      "[6, 3, 2, 1, 0, 4, 5]");
+  this->AssertSortToIndices(
+      R"(["long value number 2", "long value number 10", "long value number 1"])",
+      "[2, 1, 0]");
+
+  // Bytes compare as unsigned
+  this->AssertSortToIndices(R"(["é", "z", "aé", "az"])", "[3, 2, 1, 0]");
+
+  this->AssertSortToIndices(R"(["bb", null, "a", "bb", null, "a"])",
+                            "[2, 5, 0, 3, 1, 4]");
 }
 
 template <typename ArrowType>
@@ -302,6 +318,9 @@ class TestSortToIndicesKernelRandomCount : public TestBase {};
 template <typename ArrowType>
 class TestSortToIndicesKernelRandomCompare : public TestBase {};
 
+template <typename ArrowType>
+class TestSortToIndicesKernelRandomRadix : public TestBase {};
+
 using SortToIndicesableTypes =
     ::testing::Types<UInt8Type, UInt16Type, UInt32Type, UInt64Type, Int8Type, Int16Type,
                      Int32Type, Int64Type, FloatType, DoubleType, StringType>;
@@ -376,5 +395,249 @@ TYPED_TEST(TestSortToIndicesKernelRandomCompare, SortRandomValuesCompare) {
   }
 }
 
+// Very long array with big value range: radix sort
+TYPED_TEST_SUITE(TestSortToIndicesKernelRandomRadix, IntegralArrowTypes);
+
+TYPED_TEST(TestSortToIndicesKernelRandomRadix, SortRandomValuesRadix) {
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+
+  Random<TypeParam> rand(0x5487658);
+  int length = 1 << 17;
+  for (auto null_probability : {0.0, 0.1}) {
+    auto array = rand.Generate(length, null_probability);
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Array> offsets, SortToIndices(*array));
+    ValidateSorted<ArrayType>(*checked_pointer_cast<ArrayType>(array),
+                              *checked_pointer_cast<UInt64Array>(offsets));
+  }
+}
+
+// ----------------------------------------------------------------------
+// Sort order, null placement and multiple key sorting
+
+void AssertSortIndices(const std::shared_ptr<Array>& values, SortOrder order,
+                       const std::string& expected) {
+  ASSERT_OK_AND_ASSIGN(auto actual, SortIndices(*values, order));
+  ASSERT_OK(actual->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+}
+
+void AssertSortIndices(const ChunkedArray& values, SortOrder order,
+                       const std::string& expected) {
+  ASSERT_OK_AND_ASSIGN(auto actual, SortIndices(values, order));
+  ASSERT_OK(actual->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+}
+
+void AssertSortIndices(const Datum& values, const SortOptions& options,
+                       const std::string& expected) {
+  ASSERT_OK_AND_ASSIGN(auto actual, SortIndices(values, options));
+  ASSERT_OK(actual->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+}
+
+TEST(TestArraySortIndices, SortOrder) {
+  auto values = ArrayFromJSON(int16(), "[3, null, 1, 2, 1, 3]");
+  AssertSortIndices(values, SortOrder::Ascending, "[2, 4, 3, 0, 5, 1]");
+  AssertSortIndices(values, SortOrder::Descending, "[0, 5, 3, 2, 4, 1]");
+
+  values = ArrayFromJSON(utf8(), R"(["b", null, "a", "c", "a"])");
+  AssertSortIndices(values, SortOrder::Ascending, "[2, 4, 0, 3, 1]");
+  AssertSortIndices(values, SortOrder::Descending, "[3, 0, 2, 4, 1]");
+
+  values = ArrayFromJSON(date32(), "[5, null, -3, 0]");
+  AssertSortIndices(values, SortOrder::Ascending, "[2, 3, 0, 1]");
+  AssertSortIndices(values, SortOrder::Descending, "[0, 3, 2, 1]");
+}
+
+TEST(TestArraySortIndices, NullPlacement) {
+  auto values = ArrayFromJSON(float64(), "[null, 1.5, null, -2.5, 1.5]");
+  ArraySortOptions options(SortOrder::Descending, NullPlacement::AtStart);
+  ASSERT_OK_AND_ASSIGN(Datum actual,
+                       CallFunction("array_sort_indices", {values}, &options));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[0, 2, 1, 4, 3]"), *actual.make_array());
+
+  AssertSortIndices(values, SortOptions({SortKey("unused")}, NullPlacement::AtStart),
+                    "[0, 2, 3, 1, 4]");
+}
+
+TEST(TestChunkedArraySortIndices, Basics) {
+  auto chunked = ChunkedArrayFromJSON(
+      int32(), {"[4, null, 2]", "[]", "[1, 4]", "[null, 3, 2]"});
+  AssertSortIndices(*chunked, SortOrder::Ascending, "[3, 2, 7, 6, 0, 4, 1, 5]");
+  AssertSortIndices(*chunked, SortOrder::Descending, "[0, 4, 6, 2, 7, 3, 1, 5]");
+
+  auto empty = ChunkedArrayFromJSON(int32(), {});
+  AssertSortIndices(*empty, SortOrder::Ascending, "[]");
+}
+
+class TestTableSortIndices : public ::testing::Test {
+ public:
+  void SetUp() override {
+    schema_ = schema({field("a", int64()), field("b", utf8()),
+                      field("t", timestamp(TimeUnit::SECOND))});
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_;
+};
+
+TEST_F(TestTableSortIndices, RecordBatch) {
+  auto batch = RecordBatchFromJSON(schema_, R"([
+    {"a": 2,    "b": "x", "t": 1},
+    {"a": 1,    "b": "y", "t": 2},
+    {"a": null, "b": "x", "t": 3},
+    {"a": 1,    "b": "x", "t": 4},
+    {"a": 2,    "b": null, "t": 5}
+  ])");
+  AssertSortIndices(batch, SortOptions({SortKey("a"), SortKey("b")}),
+                    "[3, 1, 0, 4, 2]");
+  AssertSortIndices(batch,
+                    SortOptions({SortKey("b", SortOrder::Descending),
+                                 SortKey("a", SortOrder::Descending)}),
+                    "[1, 0, 3, 2, 4]");
+  AssertSortIndices(batch,
+                    SortOptions({SortKey("a", SortOrder::Descending)},
+                                NullPlacement::AtStart),
+                    "[2, 0, 4, 1, 3]");
+}
+
+TEST_F(TestTableSortIndices, ChunkedTable) {
+  auto table = TableFromJSON(schema_, {R"([
+    {"a": 1,    "b": "x", "t": 7},
+    {"a": 2,    "b": "y", "t": 3}
+  ])",
+                                       R"([
+    {"a": 1,    "b": "z", "t": 9},
+    {"a": null, "b": "x", "t": 1},
+    {"a": 2,    "b": "x", "t": null}
+  ])",
+                                       R"([
+    {"a": 1,    "b": "y", "t": 7}
+  ])"});
+  AssertSortIndices(table,
+                    SortOptions({SortKey("a"), SortKey("t", SortOrder::Descending)}),
+                    "[2, 0, 5, 1, 4, 3]");
+  AssertSortIndices(table,
+                    SortOptions({SortKey("t"), SortKey("b", SortOrder::Descending)}),
+                    "[3, 1, 5, 0, 2, 4]");
+}
+
+TEST_F(TestTableSortIndices, Errors) {
+  auto batch = RecordBatchFromJSON(schema_, R"([{"a": 1, "b": "x", "t": 1}])");
+  ASSERT_RAISES(Invalid, SortIndices(batch, SortOptions()));
+  ASSERT_RAISES(Invalid, SortIndices(batch, SortOptions({SortKey("nonexistent")})));
+
+  auto struct_batch =
+      RecordBatchFromJSON(::arrow::schema({field("s", struct_({field("x", int8())}))}),
+                          R"([{"s": {"x": 1}}])");
+  ASSERT_RAISES(TypeError, SortIndices(struct_batch, SortOptions({SortKey("s")})));
+}
+
+TEST_F(TestTableSortIndices, Parallel) {
+  // Large enough for batches to be cut into several runs, merged in slices
+  random::RandomArrayGenerator rng(0x5487655);
+  auto schema = ::arrow::schema({field("i", int32()), field("s", utf8())});
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int64_t length : {200000, 0, 50000, 120000}) {
+    batches.push_back(RecordBatch::Make(
+        schema, length,
+        {rng.Int32(length, -1000, 1000, /*null_probability=*/0.1),
+         rng.StringWithRepeats(length, /*unique=*/100, /*min_length=*/0,
+                               /*max_length=*/4, /*null_probability=*/0.1)}));
+  }
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(schema, batches));
+
+  ExecContext serial_ctx, parallel_ctx;
+  serial_ctx.set_use_threads(false);
+  parallel_ctx.set_use_threads(true);
+  for (const auto& options :
+       {SortOptions({SortKey("i"), SortKey("s", SortOrder::Descending)}),
+        SortOptions({SortKey("s"), SortKey("i")}, NullPlacement::AtStart)}) {
+    ASSERT_OK_AND_ASSIGN(auto expected, SortIndices(table, options, &serial_ctx));
+    ASSERT_OK_AND_ASSIGN(auto actual, SortIndices(table, options, &parallel_ctx));
+    ASSERT_OK(actual->ValidateFull());
+    // The sort is stable, so its output is unique
+    AssertArraysEqual(*expected, *actual);
+  }
+
+  // A single chunk is cut into runs too
+  ChunkedArray chunked(batches[0]->column(0));
+  ASSERT_OK_AND_ASSIGN(auto expected,
+                       SortIndices(chunked, SortOrder::Ascending, &serial_ctx));
+  ASSERT_OK_AND_ASSIGN(auto actual,
+                       SortIndices(chunked, SortOrder::Ascending, &parallel_ctx));
+  AssertArraysEqual(*expected, *actual);
+  ASSERT_OK_AND_ASSIGN(auto array_expected,
+                       SortIndices(*batches[0]->column(0), SortOrder::Ascending));
+  AssertArraysEqual(*array_expected, *actual);
+}
+
+// ----------------------------------------------------------------------
+// select_k_unstable
+
+void AssertSelectK(const Datum& values, const SelectKOptions& options,
+                   const std::string& expected) {
+  ASSERT_OK_AND_ASSIGN(auto actual, SelectKUnstable(values, options));
+  ASSERT_OK(actual->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+}
+
+TEST(TestSelectKUnstable, Array) {
+  auto values = ArrayFromJSON(int32(), "[3, null, 1, 7, 2, null, 5]");
+  AssertSelectK(values, SelectKOptions::TopKDefault(3), "[3, 6, 0]");
+  AssertSelectK(values, SelectKOptions::BottomKDefault(2), "[2, 4]");
+  AssertSelectK(values, SelectKOptions::BottomKDefault(0), "[]");
+  // Nulls are only selected when running out of non-null values
+  AssertSelectK(values, SelectKOptions::TopKDefault(6), "[3, 6, 0, 4, 2, 1]");
+  AssertSelectK(values, SelectKOptions::TopKDefault(10), "[3, 6, 0, 4, 2, 1, 5]");
+
+  values = ArrayFromJSON(utf8(), R"(["b", "d", null, "a", "c"])");
+  AssertSelectK(values, SelectKOptions::BottomKDefault(3), "[3, 0, 4]");
+
+  values = ArrayFromJSON(timestamp(TimeUnit::MILLI), "[30, -10, 20]");
+  AssertSelectK(values, SelectKOptions::TopKDefault(2), "[0, 2]");
+}
+
+TEST(TestSelectKUnstable, ChunkedArray) {
+  auto chunked = ChunkedArrayFromJSON(float64(), {"[4.5, null]", "[]", "[-1, 8, 2.5]"});
+  AssertSelectK(chunked, SelectKOptions::TopKDefault(2), "[3, 0]");
+  AssertSelectK(chunked, SelectKOptions::BottomKDefault(4), "[2, 4, 0, 3]");
+}
+
+TEST(TestSelectKUnstable, Table) {
+  auto table_schema = schema({field("a", int64()), field("b", utf8())});
+  auto table = TableFromJSON(table_schema, {R"([
+    {"a": 2,    "b": "x"},
+    {"a": 1,    "b": "y"}
+  ])",
+                                            R"([
+    {"a": 1,    "b": "v"},
+    {"a": null, "b": "w"},
+    {"a": 2,    "b": "z"}
+  ])"});
+  AssertSelectK(table, SelectKOptions::BottomKDefault(3, {"b"}), "[2, 3, 0]");
+  AssertSelectK(table,
+                SelectKOptions(3, {SortKey("a"), SortKey("b", SortOrder::Descending)}),
+                "[1, 2, 4]");
+  AssertSelectK(table, SelectKOptions::TopKDefault(2, {"a", "b"}), "[4, 0]");
+
+  auto batch = RecordBatchFromJSON(table_schema, R"([
+    {"a": 2, "b": "x"},
+    {"a": 1, "b": "y"},
+    {"a": 2, "b": "w"}
+  ])");
+  AssertSelectK(batch, SelectKOptions::TopKDefault(2, {"a", "b"}), "[0, 2]");
+}
+
+TEST(TestSelectKUnstable, Errors) {
+  auto values = ArrayFromJSON(int32(), "[1, 2]");
+  ASSERT_RAISES(Invalid, SelectKUnstable(values, SelectKOptions(-1)));
+  ASSERT_RAISES(Invalid, CallFunction("select_k_unstable", {values}));
+
+  auto batch = RecordBatchFromJSON(schema({field("a", int32())}), "[[1], [2]]");
+  ASSERT_RAISES(Invalid, SelectKUnstable(batch, SelectKOptions(1)));
+  ASSERT_RAISES(Invalid, SelectKUnstable(batch, SelectKOptions::TopKDefault(1, {"z"})));
+}
+
 }  // namespace compute
 }  // namespace arrow
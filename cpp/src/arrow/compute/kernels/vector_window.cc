@@ -0,0 +1,514 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/concatenate.h"
+#include "arrow/array/data.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Cumulative functions
+//
+// The running value is kept in the kernel state, so that chunked arrays are
+// processed chunk by chunk without being concatenated.
+
+template <typename T>
+enable_if_t<std::is_integral<T>::value, T> WrappingAdd(T left, T right) {
+  using Unsigned = typename std::make_unsigned<T>::type;
+  return static_cast<T>(static_cast<Unsigned>(left) + static_cast<Unsigned>(right));
+}
+
+template <typename T>
+enable_if_t<std::is_floating_point<T>::value, T> WrappingAdd(T left, T right) {
+  return left + right;
+}
+
+struct CumulativeSum {
+  template <typename InType>
+  using OutType = typename FindAccumulatorType<InType>::Type;
+
+  template <typename T>
+  static T Combine(T left, T right) {
+    return WrappingAdd(left, right);
+  }
+};
+
+// NaNs are ignored by cumulative_min and cumulative_max, unless all the
+// values so far are NaN
+struct CumulativeMin {
+  template <typename InType>
+  using OutType = InType;
+
+  template <typename T>
+  static enable_if_t<std::is_integral<T>::value, T> Combine(T left, T right) {
+    return std::min(left, right);
+  }
+
+  template <typename T>
+  static enable_if_t<std::is_floating_point<T>::value, T> Combine(T left, T right) {
+    return std::fmin(left, right);
+  }
+};
+
+struct CumulativeMax {
+  template <typename InType>
+  using OutType = InType;
+
+  template <typename T>
+  static enable_if_t<std::is_integral<T>::value, T> Combine(T left, T right) {
+    return std::max(left, right);
+  }
+
+  template <typename T>
+  static enable_if_t<std::is_floating_point<T>::value, T> Combine(T left, T right) {
+    return std::fmax(left, right);
+  }
+};
+
+template <typename Op, typename InType>
+struct CumulativeKernel {
+  using OutType = typename Op::template OutType<InType>;
+  using InT = typename InType::c_type;
+  using OutT = typename OutType::c_type;
+
+  struct State : public KernelState {
+    OutT value = OutT();
+    bool started = false;
+  };
+
+  static std::unique_ptr<KernelState> Init(KernelContext*, const KernelInitArgs&) {
+    return ::arrow::internal::make_unique<State>();
+  }
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    auto state = checked_cast<State*>(ctx->state());
+    OutT* out_values = out->mutable_array()->GetMutableValues<OutT>(1);
+
+    // Null slots are skipped, and zeroed in the output
+    OutT value = state->value;
+    bool started = state->started;
+    VisitArrayDataInline<InType>(
+        *batch[0].array(),
+        [&](InT v) {
+          const auto out_v = static_cast<OutT>(v);
+          value = started ? Op::Combine(value, out_v) : out_v;
+          started = true;
+          *out_values++ = value;
+        },
+        [&]() { *out_values++ = OutT(); });
+    state->value = value;
+    state->started = started;
+  }
+};
+
+template <typename Op>
+struct CumulativeKernelAdder {
+  template <typename Type>
+  enable_if_number<Type, Status> Visit(const Type&) {
+    using Kernel = CumulativeKernel<Op, Type>;
+    VectorKernel kernel(
+        {InputType::Array(Type::type_id)},
+        OutputType(TypeTraits<typename Kernel::OutType>::type_singleton()),
+        Kernel::Exec, Kernel::Init);
+    kernel.null_handling = NullHandling::INTERSECTION;
+    kernel.mem_allocation = MemAllocation::PREALLOCATE;
+    return func->AddKernel(std::move(kernel));
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Cumulative kernel for ", type);
+  }
+
+  VectorFunction* func;
+};
+
+template <typename Op>
+std::shared_ptr<VectorFunction> MakeCumulativeFunction(std::string name,
+                                                       const FunctionDoc* doc) {
+  auto func = std::make_shared<VectorFunction>(std::move(name), Arity::Unary(), doc);
+  CumulativeKernelAdder<Op> adder{func.get()};
+  for (const auto& ty : NumericTypes()) {
+    DCHECK_OK(VisitTypeInline(*ty, &adder));
+  }
+  return func;
+}
+
+// ----------------------------------------------------------------------
+// Rolling window functions
+//
+// The values of the current window are kept in a ring buffer in the kernel
+// state, along with the aggregates over them, so that sliding the window by one
+// row is O(1) whatever its size.
+
+// The sum of the values in a window, using Neumaier's compensated summation so
+// that values leaving the window are subtracted back accurately. Non-finite
+// values are counted rather than summed, since they would otherwise stick to the
+// sum after leaving the window (inf - inf is NaN).
+class WindowSum {
+ public:
+  void Add(double value) { Update(value, 1); }
+
+  void Remove(double value) { Update(value, -1); }
+
+  int64_t count() const { return count_; }
+
+  double Mean() const {
+    if (nan_count_ > 0 || (pos_inf_count_ > 0 && neg_inf_count_ > 0)) {
+      return std::nan("");
+    }
+    if (pos_inf_count_ > 0) {
+      return std::numeric_limits<double>::infinity();
+    }
+    if (neg_inf_count_ > 0) {
+      return -std::numeric_limits<double>::infinity();
+    }
+    return (sum_ + compensation_) / static_cast<double>(count_);
+  }
+
+ private:
+  void Update(double value, int64_t delta) {
+    count_ += delta;
+    if (std::isnan(value)) {
+      nan_count_ += delta;
+    } else if (std::isinf(value)) {
+      (value > 0 ? pos_inf_count_ : neg_inf_count_) += delta;
+    } else if ((finite_count_ += delta) == 0) {
+      // Drop rounding residues once the window holds no finite values
+      sum_ = compensation_ = 0;
+    } else {
+      const double addend = delta > 0 ? value : -value;
+      const double sum = sum_ + addend;
+      if (std::abs(sum_) >= std::abs(addend)) {
+        compensation_ += (sum_ - sum) + addend;
+      } else {
+        compensation_ += (addend - sum) + sum_;
+      }
+      sum_ = sum;
+    }
+  }
+
+  double sum_ = 0;
+  double compensation_ = 0;
+  int64_t count_ = 0;
+  int64_t finite_count_ = 0;
+  int64_t nan_count_ = 0;
+  int64_t pos_inf_count_ = 0;
+  int64_t neg_inf_count_ = 0;
+};
+
+struct RollingWindowState : public KernelState {
+  explicit RollingWindowState(const RollingWindowOptions& options)
+      : options(options),
+        values(static_cast<size_t>(options.window_size)),
+        valid(static_cast<size_t>(options.window_size), false) {}
+
+  static std::unique_ptr<KernelState> Init(KernelContext* ctx,
+                                           const KernelInitArgs& args) {
+    auto options = static_cast<const RollingWindowOptions*>(args.options);
+    if (options == nullptr) {
+      ctx->SetStatus(Status::Invalid("Rolling window functions require ",
+                                     "RollingWindowOptions"));
+      return nullptr;
+    }
+    if (options->window_size < 1) {
+      ctx->SetStatus(Status::Invalid("Rolling window size must be positive, got ",
+                                     options->window_size));
+      return nullptr;
+    }
+    if (options->min_periods < 1 || options->min_periods > options->window_size) {
+      ctx->SetStatus(Status::Invalid("Rolling window min_periods must be between 1 ",
+                                     "and the window size, got ",
+                                     options->min_periods));
+      return nullptr;
+    }
+    return ::arrow::internal::make_unique<RollingWindowState>(*options);
+  }
+
+  // Slide the window to a new row
+  void Push(double value, bool is_valid) {
+    if (valid[next]) {
+      sum.Remove(values[next]);
+    }
+    values[next] = value;
+    valid[next] = is_valid;
+    if (is_valid) {
+      sum.Add(value);
+    }
+    if (++next == values.size()) {
+      next = 0;
+    }
+  }
+
+  RollingWindowOptions options;
+  // The ring buffer of the rows in the window, starting at the oldest (next) one.
+  // Initially all null, as the rows before the start of the input.
+  std::vector<double> values;
+  std::vector<bool> valid;
+  size_t next = 0;
+  WindowSum sum;
+};
+
+template <typename InType>
+struct RollingMean {
+  using InT = typename InType::c_type;
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    auto state = checked_cast<RollingWindowState*>(ctx->state());
+    ArrayData* output = out->mutable_array();
+    double* out_values = output->GetMutableValues<double>(1);
+    uint8_t* out_validity = output->buffers[0]->mutable_data();
+
+    int64_t i = 0;
+    int64_t null_count = 0;
+    auto emit = [&]() {
+      const bool is_valid = state->sum.count() >= state->options.min_periods;
+      out_values[i] = is_valid ? state->sum.Mean() : 0;
+      BitUtil::SetBitTo(out_validity, output->offset + i, is_valid);
+      null_count += !is_valid;
+      ++i;
+    };
+    VisitArrayDataInline<InType>(
+        *batch[0].array(),
+        [&](InT v) {
+          state->Push(static_cast<double>(v), true);
+          emit();
+        },
+        [&]() {
+          state->Push(0, false);
+          emit();
+        });
+    output->null_count = null_count;
+  }
+};
+
+struct RollingMeanKernelAdder {
+  template <typename Type>
+  enable_if_number<Type, Status> Visit(const Type&) {
+    VectorKernel kernel({InputType::Array(Type::type_id)}, float64(),
+                        RollingMean<Type>::Exec, RollingWindowState::Init);
+    kernel.null_handling = NullHandling::COMPUTED_PREALLOCATE;
+    kernel.mem_allocation = MemAllocation::PREALLOCATE;
+    return func->AddKernel(std::move(kernel));
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Rolling window kernel for ", type);
+  }
+
+  VectorFunction* func;
+};
+
+// ----------------------------------------------------------------------
+// lag and lead
+//
+// The values shifted into a chunk may come from any other chunk, so the input
+// chunks are passed through by the kernel, and each output chunk is assembled
+// in the finalizer from slices of the input chunks (zero-copy if it falls
+// within one input chunk).
+
+struct ShiftState : public KernelState {
+  explicit ShiftState(int64_t periods) : periods(periods) {}
+
+  static std::unique_ptr<KernelState> Init(KernelContext* ctx,
+                                           const KernelInitArgs& args) {
+    auto options = static_cast<const ShiftOptions*>(args.options);
+    const int64_t periods = options ? options->periods : 1;
+    if (periods < 0) {
+      ctx->SetStatus(
+          Status::Invalid("Shift periods must not be negative, got ", periods));
+      return nullptr;
+    }
+    return ::arrow::internal::make_unique<ShiftState>(periods);
+  }
+
+  int64_t periods;
+};
+
+void ShiftExec(KernelContext*, const ExecBatch& batch, Datum* out) { *out = batch[0]; }
+
+// Return the rows [start, start + length) of the concatenated chunks, given
+// their start offsets. The rows outside of the chunks are null.
+Result<std::shared_ptr<Array>> GetShiftedRange(const ArrayVector& chunks,
+                                               const std::vector<int64_t>& offsets,
+                                               int64_t start, int64_t length,
+                                               MemoryPool* pool) {
+  const auto& type = chunks[0]->type();
+  const int64_t total_length = offsets.back();
+  const int64_t end = start + length;
+
+  ArrayVector pieces;
+  const int64_t leading_nulls = std::min(std::max<int64_t>(-start, 0), length);
+  if (leading_nulls > 0) {
+    ARROW_ASSIGN_OR_RAISE(auto nulls, MakeArrayOfNull(type, leading_nulls, pool));
+    pieces.push_back(std::move(nulls));
+  }
+  int64_t position = std::max<int64_t>(start, 0);
+  const int64_t values_end = std::min(end, total_length);
+  if (position < values_end) {
+    auto chunk_index = static_cast<size_t>(
+        std::upper_bound(offsets.begin(), offsets.end(), position) - offsets.begin() - 1);
+    while (position < values_end) {
+      const int64_t chunk_end = std::min(offsets[chunk_index + 1], values_end);
+      pieces.push_back(chunks[chunk_index]->Slice(position - offsets[chunk_index],
+                                                  chunk_end - position));
+      position = chunk_end;
+      ++chunk_index;
+    }
+  }
+  const int64_t trailing_nulls = length - leading_nulls - std::max<int64_t>(
+                                     values_end - std::max<int64_t>(start, 0), 0);
+  if (trailing_nulls > 0) {
+    ARROW_ASSIGN_OR_RAISE(auto nulls, MakeArrayOfNull(type, trailing_nulls, pool));
+    pieces.push_back(std::move(nulls));
+  }
+
+  if (pieces.size() == 1) {
+    return pieces[0];
+  }
+  return Concatenate(pieces, pool);
+}
+
+template <bool kLead>
+void ShiftFinalize(KernelContext* ctx, std::vector<Datum>* results) {
+  const int64_t periods = checked_cast<const ShiftState&>(*ctx->state()).periods;
+
+  // The results are still the input chunks
+  ArrayVector chunks;
+  std::vector<int64_t> offsets = {0};
+  for (const auto& result : *results) {
+    chunks.push_back(result.make_array());
+    offsets.push_back(offsets.back() + chunks.back()->length());
+  }
+
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    const int64_t start = kLead ? offsets[i] + periods : offsets[i] - periods;
+    KERNEL_ASSIGN_OR_RAISE(auto shifted, ctx,
+                           GetShiftedRange(chunks, offsets, start, chunks[i]->length(),
+                                           ctx->memory_pool()));
+    (*results)[i] = Datum(std::move(shifted));
+  }
+}
+
+// ----------------------------------------------------------------------
+// Function documentation
+
+const FunctionDoc cumulative_sum_doc(
+    "Compute the cumulative sum of an array",
+    ("The output at each position is the sum of the non-null input values up\n"
+     "to and including that position. Null inputs yield null outputs and are\n"
+     "otherwise skipped. Integers are summed as 64-bit integers, and overflow\n"
+     "wraps around; floating-point values are summed as doubles.\n"
+     "Chunked arrays are summed across their chunks."),
+    {"values"});
+
+const FunctionDoc cumulative_min_doc(
+    "Compute the cumulative minimum of an array",
+    ("The output at each position is the minimum of the non-null input values\n"
+     "up to and including that position. Null inputs yield null outputs and\n"
+     "are otherwise skipped, as are NaNs unless all preceding values are NaN.\n"
+     "Chunked arrays are processed across their chunks."),
+    {"values"});
+
+const FunctionDoc cumulative_max_doc(
+    "Compute the cumulative maximum of an array",
+    ("The output at each position is the maximum of the non-null input values\n"
+     "up to and including that position. Null inputs yield null outputs and\n"
+     "are otherwise skipped, as are NaNs unless all preceding values are NaN.\n"
+     "Chunked arrays are processed across their chunks."),
+    {"values"});
+
+const FunctionDoc rolling_mean_doc(
+    "Compute the mean over a rolling window of rows",
+    ("The output at each position is the mean of the non-null input values in\n"
+     "the window of `window_size` rows ending at that position, or null if\n"
+     "there are fewer than `min_periods` such values. Each row takes constant\n"
+     "time whatever the window size. Chunked arrays are processed across their\n"
+     "chunks. The window is given in RollingWindowOptions."),
+    {"values"}, "RollingWindowOptions");
+
+const FunctionDoc lag_doc(
+    "Shift the values of an array forward",
+    ("The output at position `i` is the input value at position `i - periods`,\n"
+     "or null if there is no such position. Chunked arrays are shifted across\n"
+     "their chunks. The number of periods is given in ShiftOptions\n"
+     "and defaults to 1."),
+    {"values"}, "ShiftOptions");
+
+const FunctionDoc lead_doc(
+    "Shift the values of an array backward",
+    ("The output at position `i` is the input value at position `i + periods`,\n"
+     "or null if there is no such position. Chunked arrays are shifted across\n"
+     "their chunks. The number of periods is given in ShiftOptions\n"
+     "and defaults to 1."),
+    {"values"}, "ShiftOptions");
+
+}  // namespace
+
+void RegisterVectorWindow(FunctionRegistry* registry) {
+  DCHECK_OK(registry->AddFunction(
+      MakeCumulativeFunction<CumulativeSum>("cumulative_sum", &cumulative_sum_doc)));
+  DCHECK_OK(registry->AddFunction(
+      MakeCumulativeFunction<CumulativeMin>("cumulative_min", &cumulative_min_doc)));
+  DCHECK_OK(registry->AddFunction(
+      MakeCumulativeFunction<CumulativeMax>("cumulative_max", &cumulative_max_doc)));
+
+  auto rolling_mean = std::make_shared<VectorFunction>("rolling_mean", Arity::Unary(),
+                                                       &rolling_mean_doc);
+  RollingMeanKernelAdder adder{rolling_mean.get()};
+  for (const auto& ty : NumericTypes()) {
+    DCHECK_OK(VisitTypeInline(*ty, &adder));
+  }
+  DCHECK_OK(registry->AddFunction(std::move(rolling_mean)));
+
+  static const auto default_shift_options = ShiftOptions::Defaults();
+  auto lag = std::make_shared<VectorFunction>("lag", Arity::Unary(), &lag_doc,
+                                              &default_shift_options);
+  DCHECK_OK(lag->AddKernel(VectorKernel({InputType(ValueDescr::ARRAY)},
+                                        OutputType(FirstType), ShiftExec,
+                                        ShiftState::Init, ShiftFinalize<false>)));
+  DCHECK_OK(registry->AddFunction(std::move(lag)));
+
+  auto lead = std::make_shared<VectorFunction>("lead", Arity::Unary(), &lead_doc,
+                                               &default_shift_options);
+  DCHECK_OK(lead->AddKernel(VectorKernel({InputType(ValueDescr::ARRAY)},
+                                         OutputType(FirstType), ShiftExec,
+                                         ShiftState::Init, ShiftFinalize<true>)));
+  DCHECK_OK(registry->AddFunction(std::move(lead)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/benchmark_util.h"
+
+namespace arrow {
+namespace compute {
+constexpr auto kSeed = 0x0ff1ce;
+
+static void CumulativeSumInt64(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int64(array_size, -1000, 1000, args.null_proportion);
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(CumulativeSum(values).status());
+  }
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
+// The time per row should not depend on the window size
+static void RollingMeanDouble(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(double);
+  const int64_t window_size = state.range(2);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Float64(array_size, -1000, 1000, args.null_proportion);
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(RollingMean(values, RollingWindowOptions(window_size, 1)).status());
+  }
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
+static void LagInt64(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int64(array_size, -1000, 1000, args.null_proportion);
+  // Shifting chunked values has to stitch slices of neighbouring chunks
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{
+      values->Slice(0, array_size / 3), values->Slice(array_size / 3, array_size / 3),
+      values->Slice(2 * array_size / 3)});
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(Lag(chunked, ShiftOptions(7)).status());
+  }
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
+BENCHMARK(CumulativeSumInt64)
+    ->Apply(RegressionSetArgs)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(RollingMeanDouble)
+    ->Args({1 << 20, 10, 4})
+    ->Args({1 << 20, 10, 64})
+    ->Args({1 << 20, 10, 4096})
+    ->Args({1 << 20, 0, 64})
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(LagInt64)
+    ->Apply(RegressionSetArgs)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,291 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+// Check a function on an array, and on the same values split into chunks
+// at every possible position
+void CheckWindowFunction(const std::string& func_name,
+                         const std::shared_ptr<Array>& input,
+                         const std::shared_ptr<Array>& expected,
+                         const FunctionOptions* options = nullptr) {
+  ASSERT_OK_AND_ASSIGN(Datum out, CallFunction(func_name, {input}, options));
+  auto actual = out.make_array();
+  ASSERT_OK(actual->ValidateFull());
+  AssertArraysApproxEqual(*expected, *actual, /*verbose=*/true,
+                          EqualOptions().nans_equal(true));
+
+  for (int64_t split = 0; split <= input->length(); ++split) {
+    SCOPED_TRACE("split at " + std::to_string(split));
+    auto chunked = std::make_shared<ChunkedArray>(
+        ArrayVector{input->Slice(0, split), input->Slice(split)}, input->type());
+    ASSERT_OK_AND_ASSIGN(out, CallFunction(func_name, {chunked}, options));
+    ASSERT_EQ(out.kind(), Datum::CHUNKED_ARRAY);
+    ASSERT_OK(out.chunked_array()->ValidateFull());
+    ASSERT_EQ(out.length(), expected->length());
+    if (expected->length() > 0) {
+      ASSERT_OK_AND_ASSIGN(auto flattened, Concatenate(out.chunked_array()->chunks()));
+      AssertArraysApproxEqual(*expected, *flattened, /*verbose=*/true,
+                              EqualOptions().nans_equal(true));
+    }
+  }
+}
+
+TEST(CumulativeSum, Basics) {
+  for (const auto& ty : {int8(), int32(), uint16(), int64()}) {
+    auto expected_type = is_unsigned_integer(ty->id()) ? uint64() : int64();
+    CheckWindowFunction("cumulative_sum", ArrayFromJSON(ty, "[]"),
+                        ArrayFromJSON(expected_type, "[]"));
+    CheckWindowFunction("cumulative_sum", ArrayFromJSON(ty, "[1, 2, null, 3, 4]"),
+                        ArrayFromJSON(expected_type, "[1, 3, null, 6, 10]"));
+    CheckWindowFunction("cumulative_sum", ArrayFromJSON(ty, "[null, null, 5]"),
+                        ArrayFromJSON(expected_type, "[null, null, 5]"));
+  }
+  for (const auto& ty : {float32(), float64()}) {
+    CheckWindowFunction("cumulative_sum", ArrayFromJSON(ty, "[1.5, null, 2, -0.5]"),
+                        ArrayFromJSON(float64(), "[1.5, null, 3.5, 3]"));
+    CheckWindowFunction("cumulative_sum", ArrayFromJSON(ty, "[1, NaN, 2]"),
+                        ArrayFromJSON(float64(), "[1, NaN, NaN]"));
+  }
+}
+
+TEST(CumulativeSum, Overflow) {
+  // Integers are summed as 64-bit integers, wrapping around
+  CheckWindowFunction("cumulative_sum", ArrayFromJSON(int8(), "[100, 100, -128]"),
+                      ArrayFromJSON(int64(), "[100, 200, 72]"));
+  CheckWindowFunction(
+      "cumulative_sum", ArrayFromJSON(int64(), "[9223372036854775807, 1]"),
+      ArrayFromJSON(int64(), "[9223372036854775807, -9223372036854775808]"));
+}
+
+TEST(CumulativeMinMax, Basics) {
+  for (const auto& ty : {int8(), uint32(), int64(), float64()}) {
+    CheckWindowFunction("cumulative_min", ArrayFromJSON(ty, "[3, null, 5, 1, 2, 0]"),
+                        ArrayFromJSON(ty, "[3, null, 3, 1, 1, 0]"));
+    CheckWindowFunction("cumulative_max", ArrayFromJSON(ty, "[3, null, 5, 1, 7, 0]"),
+                        ArrayFromJSON(ty, "[3, null, 5, 5, 7, 7]"));
+    CheckWindowFunction("cumulative_min", ArrayFromJSON(ty, "[null, 4]"),
+                        ArrayFromJSON(ty, "[null, 4]"));
+  }
+  // NaNs are skipped unless all values so far are NaN
+  CheckWindowFunction("cumulative_min", ArrayFromJSON(float32(), "[NaN, 2, NaN, 1]"),
+                      ArrayFromJSON(float32(), "[NaN, 2, 2, 1]"));
+  CheckWindowFunction("cumulative_max", ArrayFromJSON(float64(), "[NaN, 2, NaN, 3]"),
+                      ArrayFromJSON(float64(), "[NaN, 2, 2, 3]"));
+}
+
+TEST(CumulativeSum, Convenience) {
+  auto values = ArrayFromJSON(int32(), "[1, 2, 3]");
+  ASSERT_OK_AND_ASSIGN(Datum out, CumulativeSum(values));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 3, 6]"), *out.make_array());
+  ASSERT_OK_AND_ASSIGN(out, CumulativeMin(values));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 1, 1]"), *out.make_array());
+  ASSERT_OK_AND_ASSIGN(out, CumulativeMax(values));
+  AssertArraysEqual(*values, *out.make_array());
+}
+
+TEST(Cumulative, UnsupportedType) {
+  ASSERT_RAISES(NotImplemented,
+                CallFunction("cumulative_sum", {ArrayFromJSON(utf8(), R"(["a"])")}));
+}
+
+TEST(RollingMean, Basics) {
+  auto values = ArrayFromJSON(int32(), "[1, 2, 3, 4, 5, 6]");
+  RollingWindowOptions options(3);
+  CheckWindowFunction("rolling_mean", values,
+                      ArrayFromJSON(float64(), "[null, null, 2, 3, 4, 5]"), &options);
+  options = RollingWindowOptions(3, 1);
+  CheckWindowFunction("rolling_mean", values,
+                      ArrayFromJSON(float64(), "[1, 1.5, 2, 3, 4, 5]"), &options);
+  options = RollingWindowOptions(1);
+  CheckWindowFunction("rolling_mean", values,
+                      ArrayFromJSON(float64(), "[1, 2, 3, 4, 5, 6]"), &options);
+  options = RollingWindowOptions(10, 4);
+  CheckWindowFunction("rolling_mean", values,
+                      ArrayFromJSON(float64(), "[null, null, null, 2.5, 3, 3.5]"),
+                      &options);
+}
+
+TEST(RollingMean, Nulls) {
+  auto values = ArrayFromJSON(float64(), "[1, null, 3, null, null, null, 7]");
+  RollingWindowOptions options(3, 2);
+  CheckWindowFunction("rolling_mean", values,
+                      ArrayFromJSON(float64(), "[null, null, 2, null, null, null, null]"),
+                      &options);
+  options = RollingWindowOptions(3, 1);
+  CheckWindowFunction("rolling_mean", values,
+                      ArrayFromJSON(float64(), "[1, 1, 2, 3, 3, null, 7]"), &options);
+}
+
+TEST(RollingMean, NonFinite) {
+  // Non-finite values only affect the windows containing them
+  auto values = ArrayFromJSON(float64(), "[1, NaN, 2, 3, Inf, 4, -Inf, 5, 6, 7]");
+  RollingWindowOptions options(2);
+  CheckWindowFunction(
+      "rolling_mean", values,
+      ArrayFromJSON(float64(), "[null, NaN, NaN, 2.5, Inf, Inf, -Inf, -Inf, 5.5, 6.5]"),
+      &options);
+  options = RollingWindowOptions(3);
+  CheckWindowFunction(
+      "rolling_mean", values,
+      ArrayFromJSON(float64(), "[null, null, NaN, NaN, Inf, Inf, NaN, -Inf, -Inf, 6]"),
+      &options);
+}
+
+TEST(RollingMean, Accuracy) {
+  // Large values leaving the window must not leave rounding errors behind
+  auto values = ArrayFromJSON(float64(), "[1e16, 1, -1e16, 1, 1, 1, 0.5, 0.25]");
+  RollingWindowOptions options(2);
+  CheckWindowFunction(
+      "rolling_mean", values,
+      ArrayFromJSON(float64(), "[null, 5e15, -5e15, -5e15, 1, 1, 0.75, 0.375]"),
+      &options);
+}
+
+TEST(RollingMean, Random) {
+  random::RandomArrayGenerator rng(kRandomSeed);
+  auto values = rng.Float64(500, -100, 100, /*null_probability=*/0.2);
+  const auto& doubles = checked_cast<const DoubleArray&>(*values);
+  for (int64_t window_size : {1, 2, 7, 100, 600}) {
+    for (int64_t min_periods : {int64_t(1), window_size}) {
+      RollingWindowOptions options(window_size, min_periods);
+      DoubleBuilder builder;
+      for (int64_t i = 0; i < doubles.length(); ++i) {
+        double sum = 0;
+        int64_t count = 0;
+        for (int64_t j = std::max<int64_t>(0, i - window_size + 1); j <= i; ++j) {
+          if (doubles.IsValid(j)) {
+            sum += doubles.Value(j);
+            ++count;
+          }
+        }
+        if (count >= min_periods) {
+          ASSERT_OK(builder.Append(sum / count));
+        } else {
+          ASSERT_OK(builder.AppendNull());
+        }
+      }
+      ASSERT_OK_AND_ASSIGN(auto expected, builder.Finish());
+
+      ASSERT_OK_AND_ASSIGN(Datum out, RollingMean(values, options));
+      ASSERT_OK(out.make_array()->ValidateFull());
+      AssertArraysApproxEqual(*expected, *out.make_array(), /*verbose=*/true);
+
+      auto chunked = std::make_shared<ChunkedArray>(ArrayVector{
+          values->Slice(0, 10), values->Slice(10, 0), values->Slice(10, 200),
+          values->Slice(210)});
+      ASSERT_OK_AND_ASSIGN(out, RollingMean(chunked, options));
+      ASSERT_OK_AND_ASSIGN(auto flattened, Concatenate(out.chunked_array()->chunks()));
+      AssertArraysApproxEqual(*expected, *flattened, /*verbose=*/true);
+    }
+  }
+}
+
+TEST(RollingMean, InvalidOptions) {
+  auto values = ArrayFromJSON(int32(), "[1, 2]");
+  ASSERT_RAISES(Invalid, RollingMean(values, RollingWindowOptions(0)));
+  ASSERT_RAISES(Invalid, RollingMean(values, RollingWindowOptions(-1)));
+  ASSERT_RAISES(Invalid, RollingMean(values, RollingWindowOptions(2, 0)));
+  ASSERT_RAISES(Invalid, RollingMean(values, RollingWindowOptions(2, 3)));
+  ASSERT_RAISES(Invalid, CallFunction("rolling_mean", {values}));
+}
+
+TEST(LagLead, Basics) {
+  for (const auto& ty : {int32(), float64(), utf8()}) {
+    auto values = ArrayFromJSON(ty, ty->id() == Type::STRING
+                                        ? R"(["1", "2", null, "4", "5"])"
+                                        : "[1, 2, null, 4, 5]");
+    ShiftOptions options;
+    CheckWindowFunction("lag", values,
+                        ArrayFromJSON(ty, ty->id() == Type::STRING
+                                              ? R"([null, "1", "2", null, "4"])"
+                                              : "[null, 1, 2, null, 4]"),
+                        &options);
+    CheckWindowFunction("lead", values,
+                        ArrayFromJSON(ty, ty->id() == Type::STRING
+                                              ? R"(["2", null, "4", "5", null])"
+                                              : "[2, null, 4, 5, null]"),
+                        &options);
+  }
+}
+
+TEST(LagLead, Periods) {
+  auto values = ArrayFromJSON(int64(), "[1, 2, 3, 4, 5]");
+  for (int64_t periods = 0; periods <= 6; ++periods) {
+    SCOPED_TRACE("periods = " + std::to_string(periods));
+    ShiftOptions options(periods);
+    const int64_t shifted = std::min<int64_t>(periods, values->length());
+    ASSERT_OK_AND_ASSIGN(auto nulls, MakeArrayOfNull(int64(), shifted));
+    ASSERT_OK_AND_ASSIGN(
+        auto lag_expected,
+        Concatenate({nulls, values->Slice(0, values->length() - shifted)}));
+    CheckWindowFunction("lag", values, lag_expected, &options);
+    ASSERT_OK_AND_ASSIGN(auto lead_expected,
+                         Concatenate({values->Slice(shifted), nulls}));
+    CheckWindowFunction("lead", values, lead_expected, &options);
+  }
+}
+
+TEST(LagLead, ManyChunks) {
+  auto chunked = ChunkedArrayFromJSON(int32(), {"[1, 2]", "[]", "[3]", "[4, 5, 6]"});
+  ASSERT_OK_AND_ASSIGN(Datum out, Lag(chunked, ShiftOptions(2)));
+  ASSERT_OK(out.chunked_array()->ValidateFull());
+  AssertChunkedEquivalent(
+      *ChunkedArrayFromJSON(int32(), {"[null, null, 1, 2, 3, 4]"}), *out.chunked_array());
+  ASSERT_OK_AND_ASSIGN(out, Lead(chunked, ShiftOptions(2)));
+  AssertChunkedEquivalent(
+      *ChunkedArrayFromJSON(int32(), {"[3, 4, 5, 6, null, null]"}), *out.chunked_array());
+}
+
+TEST(LagLead, Defaults) {
+  auto values = ArrayFromJSON(int8(), "[1, 2, 3]");
+  ASSERT_OK_AND_ASSIGN(Datum out, CallFunction("lag", {values}));
+  AssertArraysEqual(*ArrayFromJSON(int8(), "[null, 1, 2]"), *out.make_array());
+  ASSERT_OK_AND_ASSIGN(out, Lead(values));
+  AssertArraysEqual(*ArrayFromJSON(int8(), "[2, 3, null]"), *out.make_array());
+}
+
+TEST(LagLead, InvalidOptions) {
+  auto values = ArrayFromJSON(int8(), "[1, 2, 3]");
+  ASSERT_RAISES(Invalid, Lag(values, ShiftOptions(-1)));
+  ASSERT_RAISES(Invalid, Lead(values, ShiftOptions(-1)));
+}
+
+}  // namespace compute
+}  // namespace arrow
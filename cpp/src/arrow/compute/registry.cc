@@ -65,6 +65,36 @@ class FunctionRegistry::FunctionRegistryImpl {
     return it->second;
   }
 
+  Status AddDeviceFunction(const std::string& device_type,
+                           std::shared_ptr<Function> function, bool allow_overwrite) {
+    RETURN_NOT_OK(function->Validate());
+
+    std::lock_guard<std::mutex> mutation_guard(lock_);
+
+    auto& functions = device_type_to_functions_[device_type];
+    const std::string& name = function->name();
+    auto it = functions.find(name);
+    if (it != functions.end() && !allow_overwrite) {
+      return Status::KeyError("Already have a function registered with name: ", name,
+                              " for device type: ", device_type);
+    }
+    functions[name] = std::move(function);
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Function>> GetDeviceFunction(const std::string& device_type,
+                                                      const std::string& name) const {
+    auto functions_it = device_type_to_functions_.find(device_type);
+    if (functions_it != device_type_to_functions_.end()) {
+      auto it = functions_it->second.find(name);
+      if (it != functions_it->second.end()) {
+        return it->second;
+      }
+    }
+    return Status::KeyError("No function registered with name: ", name,
+                            " for device type: ", device_type);
+  }
+
   std::vector<std::string> GetFunctionNames() const {
     std::vector<std::string> results;
     for (auto it : name_to_function_) {
@@ -79,6 +109,10 @@ class FunctionRegistry::FunctionRegistryImpl {
  private:
   std::mutex lock_;
   std::unordered_map<std::string, std::shared_ptr<Function>> name_to_function_;
+  // Functions executing on non-CPU devices, by device type then name
+  std::unordered_map<std::string,
+                     std::unordered_map<std::string, std::shared_ptr<Function>>>
+      device_type_to_functions_;
 };
 
 std::unique_ptr<FunctionRegistry> FunctionRegistry::Make() {
@@ -104,6 +138,17 @@ Result<std::shared_ptr<Function>> FunctionRegistry::GetFunction(
   return impl_->GetFunction(name);
 }
 
+Status FunctionRegistry::AddDeviceFunction(const std::string& device_type,
+                                           std::shared_ptr<Function> function,
+                                           bool allow_overwrite) {
+  return impl_->AddDeviceFunction(device_type, std::move(function), allow_overwrite);
+}
+
+Result<std::shared_ptr<Function>> FunctionRegistry::GetDeviceFunction(
+    const std::string& device_type, const std::string& name) const {
+  return impl_->GetDeviceFunction(device_type, name);
+}
+
 std::vector<std::string> FunctionRegistry::GetFunctionNames() const {
   return impl_->GetFunctionNames();
 }
@@ -120,20 +165,26 @@ static std::unique_ptr<FunctionRegistry> CreateBuiltInRegistry() {
   RegisterScalarBoolean(registry.get());
   RegisterScalarCast(registry.get());
   RegisterScalarComparison(registry.get());
+  RegisterScalarHash(registry.get());
   RegisterScalarNested(registry.get());
   RegisterScalarSetLookup(registry.get());
   RegisterScalarStringAscii(registry.get());
   RegisterScalarValidity(registry.get());
   RegisterScalarFillNull(registry.get());
+  RegisterScalarTemporal(registry.get());
 
   // Aggregate functions
   RegisterScalarAggregateBasic(registry.get());
+  RegisterHashAggregateBasic(registry.get());
 
   // Vector functions
   RegisterVectorHash(registry.get());
   RegisterVectorSelection(registry.get());
   RegisterVectorNested(registry.get());
+  RegisterVectorPartition(registry.get());
+  RegisterVectorRunEnd(registry.get());
   RegisterVectorSort(registry.get());
+  RegisterVectorWindow(registry.get());
 
   return registry;
 }
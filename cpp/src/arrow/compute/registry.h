@@ -61,6 +61,22 @@ class ARROW_EXPORT FunctionRegistry {
   /// \brief Retrieve a function by name from the registry
   Result<std::shared_ptr<Function>> GetFunction(const std::string& name) const;
 
+  /// \brief Add an implementation of a function for data residing on another
+  /// device than the CPU. Returns Status::KeyError if a function with the same
+  /// name is already registered for that device type
+  ///
+  /// \param[in] device_type the Device::type_name() of the device
+  /// \param[in] function the function, usually named as the CPU function it
+  /// stands for
+  /// \param[in] allow_overwrite whether to replace an existing function
+  Status AddDeviceFunction(const std::string& device_type,
+                           std::shared_ptr<Function> function,
+                           bool allow_overwrite = false);
+
+  /// \brief Retrieve by name a function registered for a device type
+  Result<std::shared_ptr<Function>> GetDeviceFunction(const std::string& device_type,
+                                                      const std::string& name) const;
+
   /// \brief Return vector of all entry names in the registry. Helpful for
   /// displaying a manifest of available functions
   std::vector<std::string> GetFunctionNames() const;
@@ -83,5 +83,31 @@ TEST_F(TestRegistry, Basics) {
   ASSERT_EQ(func, f2);
 }
 
+TEST_F(TestRegistry, DeviceFunctions) {
+  std::shared_ptr<Function> func =
+      std::make_shared<ScalarFunction>("f1", Arity::Unary(), /*doc=*/nullptr);
+  ASSERT_OK(registry_->AddFunction(func));
+
+  std::shared_ptr<Function> device_func =
+      std::make_shared<ScalarFunction>("f1", Arity::Unary(), /*doc=*/nullptr);
+  ASSERT_OK(registry_->AddDeviceFunction("some_device", device_func));
+  // Device functions are listed separately
+  ASSERT_EQ(1, registry_->num_functions());
+
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<const Function> f1,
+                       registry_->GetDeviceFunction("some_device", "f1"));
+  ASSERT_EQ(device_func, f1);
+  ASSERT_OK_AND_ASSIGN(f1, registry_->GetFunction("f1"));
+  ASSERT_EQ(func, f1);
+
+  ASSERT_RAISES(KeyError, registry_->GetDeviceFunction("some_device", "f2"));
+  ASSERT_RAISES(KeyError, registry_->GetDeviceFunction("other_device", "f1"));
+
+  ASSERT_RAISES(KeyError, registry_->AddDeviceFunction("some_device", device_func));
+  ASSERT_OK(registry_->AddDeviceFunction("some_device", device_func,
+                                         /*allow_overwrite=*/true));
+  ASSERT_OK(registry_->AddDeviceFunction("other_device", device_func));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -26,6 +26,8 @@ namespace compute {
 class ExecContext;
 class KernelContext;
 
+struct FunctionOptions;
+
 struct Kernel;
 struct ScalarKernel;
 struct ScalarAggregateKernel;
@@ -17,10 +17,12 @@
 
 #include "arrow/csv/chunker.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <utility>
 
+#include "arrow/buffer.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
@@ -45,11 +47,14 @@ class Lexer {
     AT_QUOTED_ESCAPE
   };
 
-  explicit Lexer(const ParseOptions& options) : options_(options) {
+  explicit Lexer(const ParseOptions& options, State initial_state = FIELD_START)
+      : options_(options), state_(initial_state) {
     DCHECK_EQ(quoting, options_.quoting);
     DCHECK_EQ(escaping, options_.escaping);
   }
 
+  State state() const { return state_; }
+
   const char* ReadLine(const char* data, const char* data_end) {
     // The parsing state machine
     char c;
@@ -171,6 +176,7 @@ class Lexer {
     goto FieldStart;
 
   LineEnd:
+    state_ = FIELD_START;
     return data;
 
   AbortLine:
@@ -238,6 +244,113 @@ class LexingBoundaryFinder : public BoundaryFinder {
   ParseOptions options_;
 };
 
+template <bool quoting, bool escaping>
+class SpeculativeLexingChunker : public SpeculativeChunker {
+ public:
+  using LexerType = Lexer<quoting, escaping>;
+  using State = typename LexerType::State;
+
+  explicit SpeculativeLexingChunker(ParseOptions options)
+      : options_(std::move(options)) {}
+
+  Status Speculate(util::string_view block, Speculation* out) const override {
+    // Starting inside an unquoted field is equivalent to starting a field
+    // that doesn't begin with a quote, which is the most likely situation.
+    out->unquoted = LexBlock(LexerType::IN_FIELD, block);
+    if (quoting) {
+      out->quoted = LexBlock(LexerType::IN_QUOTED_FIELD, block);
+    }
+    return Status::OK();
+  }
+
+  Status Process(std::shared_ptr<Buffer> partial, std::shared_ptr<Buffer> block,
+                 const Speculation& speculation, bool is_final,
+                 std::shared_ptr<Buffer>* completion, std::shared_ptr<Buffer>* whole,
+                 std::shared_ptr<Buffer>* next_partial) override {
+    const util::string_view view(*block);
+    if (view.empty()) {
+      // Only the first block (after the header) can be empty
+      DCHECK_EQ(partial->size(), 0);
+      *completion = *whole = block;
+      if (!is_final) {
+        *next_partial = block;
+      }
+      return Status::OK();
+    }
+
+    const BlockBoundaries* bounds;
+    BlockBoundaries relexed;
+    if (state_ == LexerType::IN_FIELD ||
+        (state_ == LexerType::FIELD_START &&
+         (!quoting || view[0] != options_.quote_char))) {
+      bounds = &speculation.unquoted;
+    } else if (quoting && state_ == LexerType::IN_QUOTED_FIELD) {
+      bounds = &speculation.quoted;
+    } else {
+      // The block starts in the middle of an escape or quote sequence, or
+      // with an opening quote: no speculation applies.
+      relexed = LexBlock(state_, view);
+      bounds = &relexed;
+    }
+
+    int64_t whole_start = 0;
+    if (partial->size() > 0) {
+      if (bounds->first_pos == BoundaryFinder::kNoDelimiterFound) {
+        if (!is_final) {
+          return Status::Invalid(
+              "straddling object straddles two block boundaries "
+              "(try to increase block size?)");
+        }
+        // The last block is entirely a completion of partial
+        whole_start = block->size();
+      } else {
+        whole_start = bounds->first_pos;
+      }
+    }
+    *completion = SliceBuffer(block, 0, whole_start);
+    if (is_final) {
+      *whole = SliceBuffer(block, whole_start);
+    } else {
+      const int64_t whole_end = std::max(whole_start, bounds->last_pos);
+      *whole = SliceBuffer(block, whole_start, whole_end - whole_start);
+      *next_partial = SliceBuffer(block, whole_end);
+    }
+    state_ = static_cast<State>(bounds->end_state);
+    return Status::OK();
+  }
+
+ protected:
+  BlockBoundaries LexBlock(State initial_state, util::string_view block) const {
+    LexerType lexer(options_, initial_state);
+    BlockBoundaries bounds;
+
+    const char* data = block.data();
+    const char* const data_end = block.data() + block.size();
+
+    while (data < data_end) {
+      const char* line_end = lexer.ReadLine(data, data_end);
+      if (line_end == nullptr) {
+        // Cannot read any further
+        break;
+      }
+      DCHECK_GT(line_end, data);
+      if (bounds.first_pos == BoundaryFinder::kNoDelimiterFound) {
+        bounds.first_pos = static_cast<int64_t>(line_end - block.data());
+      }
+      data = line_end;
+    }
+    if (bounds.first_pos != BoundaryFinder::kNoDelimiterFound) {
+      bounds.last_pos = static_cast<int64_t>(data - block.data());
+    }
+    bounds.end_state = lexer.state();
+    return bounds;
+  }
+
+  ParseOptions options_;
+  // Lexer state at the start of the next block to process
+  State state_ = LexerType::FIELD_START;
+};
+
 }  // namespace
 
 std::unique_ptr<Chunker> MakeChunker(const ParseOptions& options) {
@@ -262,5 +375,21 @@ std::unique_ptr<Chunker> MakeChunker(const ParseOptions& options) {
   return internal::make_unique<Chunker>(std::move(delimiter));
 }
 
+std::unique_ptr<SpeculativeChunker> MakeSpeculativeChunker(const ParseOptions& options) {
+  if (options.quoting) {
+    if (options.escaping) {
+      return internal::make_unique<SpeculativeLexingChunker<true, true>>(options);
+    } else {
+      return internal::make_unique<SpeculativeLexingChunker<true, false>>(options);
+    }
+  } else {
+    if (options.escaping) {
+      return internal::make_unique<SpeculativeLexingChunker<false, true>>(options);
+    } else {
+      return internal::make_unique<SpeculativeLexingChunker<false, false>>(options);
+    }
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -24,6 +24,7 @@
 #include "arrow/status.h"
 #include "arrow/util/delimiting.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/string_view.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -32,5 +33,62 @@ namespace csv {
 ARROW_EXPORT
 std::unique_ptr<Chunker> MakeChunker(const ParseOptions& options);
 
+/// \brief A chunker for CSV data that can lex several blocks in parallel
+///
+/// When newlines are allowed in values, whether a newline delimits a row
+/// depends on the quoting state at the start of the block, which is only
+/// known once all previous blocks have been lexed.  This chunker lexes each
+/// block independently from both an unquoted and a quoted initial state,
+/// then picks the consistent speculation when blocks are chunked in file order.
+class ARROW_EXPORT SpeculativeChunker {
+ public:
+  /// Row boundaries found when lexing a block from a given initial state
+  struct BlockBoundaries {
+    /// Position just after the first row delimiter, or -1 if none
+    int64_t first_pos = -1;
+    /// Position just after the last row delimiter, or -1 if none
+    int64_t last_pos = -1;
+    /// Lexer state at the end of the block (implementation-specific)
+    int end_state = 0;
+  };
+
+  struct Speculation {
+    BlockBoundaries unquoted;
+    BlockBoundaries quoted;
+  };
+
+  virtual ~SpeculativeChunker() = default;
+
+  /// \brief Lex a block from both initial quoting states
+  ///
+  /// This method doesn't modify the chunker's state and can be called
+  /// concurrently on any number of blocks.
+  virtual Status Speculate(util::string_view block, Speculation* out) const = 0;
+
+  /// \brief Chunk the next block in file order
+  ///
+  /// This is equivalent to Chunker::ProcessWithPartial followed by
+  /// Chunker::Process on the rest (or to Chunker::ProcessFinal if `is_final`
+  /// is true, in which case `next_partial` is left untouched), but reuses the
+  /// row boundaries computed by Speculate() on `block`.  The block is lexed
+  /// again if it starts in a state that wasn't speculated on.
+  ///
+  /// \param[in] partial incomplete CSV data returned by the previous call
+  /// \param[in] block data following partial
+  /// \param[in] speculation the result of Speculate() on `block`
+  /// \param[in] is_final whether `block` is the last block of the file
+  /// \param[out] completion subrange of block containing the completion of partial
+  /// \param[out] whole subrange of block containing whole CSV rows
+  /// \param[out] next_partial subrange of block starting with an incomplete row
+  virtual Status Process(std::shared_ptr<Buffer> partial, std::shared_ptr<Buffer> block,
+                         const Speculation& speculation, bool is_final,
+                         std::shared_ptr<Buffer>* completion,
+                         std::shared_ptr<Buffer>* whole,
+                         std::shared_ptr<Buffer>* next_partial) = 0;
+};
+
+ARROW_EXPORT
+std::unique_ptr<SpeculativeChunker> MakeSpeculativeChunker(const ParseOptions& options);
+
 }  // namespace csv
 }  // namespace arrow
@@ -19,6 +19,7 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -261,5 +262,79 @@ TEST_P(BaseChunkerTest, EscapingNewline) {
   }
 }
 
+// Split `csv` into blocks of `block_size` bytes and chunk them, either the way
+// ThreadedBlockReader does or using a SpeculativeChunker.  Returns the sequence
+// of (completion, whole) pairs, or the first error.
+Status ChunkBlocks(const ParseOptions& options, const std::string& csv,
+                   size_t block_size, bool speculative,
+                   std::vector<std::string>* out) {
+  auto chunker = MakeChunker(options);
+  auto speculative_chunker = MakeSpeculativeChunker(options);
+  std::shared_ptr<Buffer> partial = std::make_shared<Buffer>("");
+
+  for (size_t pos = 0; pos < csv.size(); pos += block_size) {
+    auto block = Buffer::FromString(csv.substr(pos, block_size));
+    const bool is_final = pos + block_size >= csv.size();
+    std::shared_ptr<Buffer> completion, whole, next_partial;
+    if (speculative) {
+      SpeculativeChunker::Speculation speculation;
+      RETURN_NOT_OK(
+          speculative_chunker->Speculate(util::string_view(*block), &speculation));
+      RETURN_NOT_OK(speculative_chunker->Process(partial, block, speculation, is_final,
+                                                 &completion, &whole, &next_partial));
+    } else if (is_final) {
+      RETURN_NOT_OK(chunker->ProcessFinal(partial, block, &completion, &whole));
+    } else {
+      std::shared_ptr<Buffer> rest;
+      RETURN_NOT_OK(chunker->ProcessWithPartial(partial, block, &completion, &rest));
+      RETURN_NOT_OK(chunker->Process(rest, &whole, &next_partial));
+    }
+    out->push_back(completion->ToString());
+    out->push_back(whole->ToString());
+    partial = next_partial;
+  }
+  return Status::OK();
+}
+
+void AssertSpeculativeChunking(const ParseOptions& options, const std::string& csv) {
+  for (size_t block_size = 1; block_size <= csv.size(); ++block_size) {
+    SCOPED_TRACE("block_size = " + std::to_string(block_size));
+    std::vector<std::string> expected, actual;
+    Status expected_status = ChunkBlocks(options, csv, block_size, false, &expected);
+    Status actual_status = ChunkBlocks(options, csv, block_size, true, &actual);
+    ASSERT_EQ(expected_status.ok(), actual_status.ok()) << actual_status.ToString();
+    if (expected_status.ok()) {
+      ASSERT_EQ(expected, actual);
+    }
+  }
+}
+
+TEST(SpeculativeChunker, MatchesChunker) {
+  auto options = ParseOptions::Defaults();
+  options.newlines_in_values = true;
+  const std::vector<std::string> csvs = {
+      MakeCSVData({"ab,c,\n", "def,,gh\n", ",ij,kl\n"}),
+      MakeCSVData({"a,\"b\nc\",d\n", "\"e\r\nf\",g\n", "\"\",\"\n\"\r\n"}),
+      MakeCSVData({"\"a\"\"\nb\",c\n", "d\"e,\"f\n\"\n", "\"\"\"\"\n", "\"g\nh\""}),
+      MakeCSVData({"a\\\nb,\"c\\\"\nd\"\n", "\\\\,\"\\\\\"\n", "e\\\\\n"}),
+  };
+  for (bool quoting : {true, false}) {
+    for (bool escaping : {false, true}) {
+      for (bool double_quote : {true, false}) {
+        options.quoting = quoting;
+        options.escaping = escaping;
+        options.double_quote = double_quote;
+        for (const auto& csv : csvs) {
+          SCOPED_TRACE("quoting = " + std::to_string(quoting) +
+                       ", escaping = " + std::to_string(escaping) +
+                       ", double_quote = " + std::to_string(double_quote) +
+                       ", csv = " + csv);
+          AssertSpeculativeChunking(options, csv);
+        }
+      }
+    }
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
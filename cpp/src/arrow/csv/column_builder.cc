@@ -213,10 +213,12 @@ class InferringColumnBuilder : public ConcreteColumnBuilder {
  public:
   InferringColumnBuilder(int32_t col_index, const ConvertOptions& options,
                          MemoryPool* pool,
-                         const std::shared_ptr<internal::TaskGroup>& task_group)
+                         const std::shared_ptr<internal::TaskGroup>& task_group,
+                         const std::shared_ptr<DataType>& initial_type)
       : ConcreteColumnBuilder(pool, task_group, col_index),
         options_(options),
-        infer_status_(options) {}
+        infer_status_(initial_type ? InferStatus(options, *initial_type)
+                                   : InferStatus(options)) {}
 
   Status Init();
 
@@ -350,9 +352,10 @@ Result<std::shared_ptr<ColumnBuilder>> ColumnBuilder::Make(
 
 Result<std::shared_ptr<ColumnBuilder>> ColumnBuilder::Make(
     MemoryPool* pool, int32_t col_index, const ConvertOptions& options,
-    const std::shared_ptr<TaskGroup>& task_group) {
-  auto ptr =
-      std::make_shared<InferringColumnBuilder>(col_index, options, pool, task_group);
+    const std::shared_ptr<TaskGroup>& task_group,
+    const std::shared_ptr<DataType>& initial_type) {
+  auto ptr = std::make_shared<InferringColumnBuilder>(col_index, options, pool,
+                                                      task_group, initial_type);
   RETURN_NOT_OK(ptr->Init());
   return ptr;
 }
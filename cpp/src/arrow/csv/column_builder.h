@@ -57,9 +57,12 @@ class ARROW_EXPORT ColumnBuilder {
       const std::shared_ptr<internal::TaskGroup>& task_group);
 
   /// Construct a type-inferring ColumnBuilder.
+  /// If `initial_type` is given (for example the type inferred on a sample
+  /// of the data), inference starts from it instead of the null type.
   static Result<std::shared_ptr<ColumnBuilder>> Make(
       MemoryPool* pool, int32_t col_index, const ConvertOptions& options,
-      const std::shared_ptr<internal::TaskGroup>& task_group);
+      const std::shared_ptr<internal::TaskGroup>& task_group,
+      const std::shared_ptr<DataType>& initial_type = NULLPTR);
 
   /// Construct a ColumnBuilder for a column of nulls
   /// (i.e. not present in the CSV file).
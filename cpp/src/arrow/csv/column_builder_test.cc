@@ -468,6 +468,37 @@ TEST_F(InferringColumnBuilderTest, MultipleChunkIntegerParallel) {
   CheckInferred(tg, {{"1", "2"}, {"3"}, {"4", "5"}, {"6", "7"}}, options, expected);
 }
 
+TEST_F(InferringColumnBuilderTest, InitialType) {
+  auto options = ConvertOptions::Defaults();
+  auto tg = TaskGroup::MakeSerial();
+  std::shared_ptr<ColumnBuilder> builder;
+  std::shared_ptr<ChunkedArray> actual;
+
+  // Inference starts from the initial type...
+  ASSERT_OK_AND_ASSIGN(builder, ColumnBuilder::Make(default_memory_pool(), 0, options,
+                                                    tg, float64()));
+  AssertBuilding(builder, {{"", "1"}, {"2"}}, &actual);
+  AssertChunkedEqual(*actual, ChunkedArray({ArrayFromJSON(float64(), "[null, 1]"),
+                                            ArrayFromJSON(float64(), "[2]")}));
+
+  // ... which can still be loosened
+  ASSERT_OK_AND_ASSIGN(builder, ColumnBuilder::Make(default_memory_pool(), 0, options,
+                                                    tg, int64()));
+  AssertBuilding(builder, {{"1"}, {"x"}}, &actual);
+  AssertChunkedEqual(*actual, ChunkedArray({ArrayFromJSON(utf8(), R"(["1"])"),
+                                            ArrayFromJSON(utf8(), R"(["x"])")}));
+
+  // Dictionary encoding decisions are kept
+  options.auto_dict_encode = true;
+  ASSERT_OK_AND_ASSIGN(builder, ColumnBuilder::Make(default_memory_pool(), 0, options,
+                                                    tg, dictionary(int32(), utf8())));
+  AssertBuilding(builder, {{"1", "2", "1"}}, &actual);
+  ASSERT_EQ(actual->num_chunks(), 1);
+  const auto& dict_array = checked_cast<const DictionaryArray&>(*actual->chunk(0));
+  AssertArraysEqual(*dict_array.dictionary(), *ArrayFromJSON(utf8(), R"(["1", "2"])"));
+  AssertArraysEqual(*dict_array.indices(), *ArrayFromJSON(int32(), "[0, 1, 0]"));
+}
+
 TEST_F(InferringColumnBuilderTest, SingleChunkBinaryAutoDict) {
   auto options = ConvertOptions::Defaults();
   options.auto_dict_encode = true;
@@ -239,10 +239,12 @@ class InferringColumnDecoder : public ConcreteColumnDecoder {
  public:
   InferringColumnDecoder(int32_t col_index, const ConvertOptions& options,
                          MemoryPool* pool,
-                         const std::shared_ptr<internal::TaskGroup>& task_group)
+                         const std::shared_ptr<internal::TaskGroup>& task_group,
+                         const std::shared_ptr<DataType>& initial_type)
       : ConcreteColumnDecoder(pool, task_group, col_index),
         options_(options),
-        infer_status_(options),
+        infer_status_(initial_type ? InferStatus(options, *initial_type)
+                                   : InferStatus(options)),
         type_frozen_(false) {}
 
   Status Init();
@@ -340,9 +342,9 @@ void InferringColumnDecoder::Insert(int64_t block_index,
 
 Result<std::shared_ptr<ColumnDecoder>> ColumnDecoder::Make(
     MemoryPool* pool, int32_t col_index, const ConvertOptions& options,
-    std::shared_ptr<TaskGroup> task_group) {
-  auto ptr = std::make_shared<InferringColumnDecoder>(col_index, options, pool,
-                                                      std::move(task_group));
+    std::shared_ptr<TaskGroup> task_group, std::shared_ptr<DataType> initial_type) {
+  auto ptr = std::make_shared<InferringColumnDecoder>(
+      col_index, options, pool, std::move(task_group), std::move(initial_type));
   RETURN_NOT_OK(ptr->Init());
   return ptr;
 }
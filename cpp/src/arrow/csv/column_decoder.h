@@ -60,9 +60,12 @@ class ARROW_EXPORT ColumnDecoder {
 
   /// Construct a type-inferring ColumnDecoder.
   /// Inference will run only on the first block, the type will be frozen afterwards.
+  /// If `initial_type` is given (for example the type inferred on a sample
+  /// of the data), inference starts from it instead of the null type.
   static Result<std::shared_ptr<ColumnDecoder>> Make(
       MemoryPool* pool, int32_t col_index, const ConvertOptions& options,
-      std::shared_ptr<internal::TaskGroup> task_group);
+      std::shared_ptr<internal::TaskGroup> task_group,
+      std::shared_ptr<DataType> initial_type = NULLPTR);
 
   /// Construct a ColumnDecoder for a column of nulls
   /// (i.e. not present in the CSV file).
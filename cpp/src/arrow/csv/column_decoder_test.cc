@@ -320,9 +320,10 @@ class InferringColumnDecoderTest : public ColumnDecoderTest {
  public:
   InferringColumnDecoderTest() { tg_ = ExecutorType::task_group(); }
 
-  void MakeDecoder(const ConvertOptions& options) {
-    ASSERT_OK_AND_ASSIGN(auto decoder,
-                         ColumnDecoder::Make(default_memory_pool(), 0, options, tg_));
+  void MakeDecoder(const ConvertOptions& options,
+                   const std::shared_ptr<DataType>& initial_type = nullptr) {
+    ASSERT_OK_AND_ASSIGN(auto decoder, ColumnDecoder::Make(default_memory_pool(), 0,
+                                                           options, tg_, initial_type));
     SetDecoder(decoder);
   }
 
@@ -395,6 +396,19 @@ class InferringColumnDecoderTest : public ColumnDecoderTest {
     AssertFetchEOF();
   }
 
+  void TestInitialType() {
+    auto type = float64();
+
+    // The first block would be inferred as integers on its own
+    MakeDecoder(default_options, float64());
+
+    AppendChunks({{"123", "N/A"}, {"4.5"}});
+    SetEOF();
+    AssertFetch(ArrayFromJSON(type, "[123, null]"));
+    AssertFetch(ArrayFromJSON(type, "[4.5]"));
+    AssertFetchEOF();
+  }
+
   void TestEmpty() {
     auto type = null();
 
@@ -419,6 +433,8 @@ TYPED_TEST(InferringColumnDecoderTest, Options) { this->TestOptions(); }
 
 TYPED_TEST(InferringColumnDecoderTest, Errors) { this->TestErrors(); }
 
+TYPED_TEST(InferringColumnDecoderTest, InitialType) { this->TestInitialType(); }
+
 TYPED_TEST(InferringColumnDecoderTest, Empty) { this->TestEmpty(); }
 
 // More inference tests are in InferringColumnBuilderTest
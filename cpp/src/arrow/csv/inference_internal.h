@@ -21,6 +21,8 @@
 
 #include "arrow/csv/converter.h"
 #include "arrow/csv/options.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -43,6 +45,13 @@ class InferStatus {
   explicit InferStatus(const ConvertOptions& options)
       : kind_(InferKind::Null), can_loosen_type_(true), options_(options) {}
 
+  // Start inference from the given type, as returned by a previous
+  // inference's converter.  Unrecognized types start from the null type.
+  InferStatus(const ConvertOptions& options, const DataType& initial_type)
+      : InferStatus(options) {
+    SetKind(KindFromType(initial_type));
+  }
+
   InferKind kind() const { return kind_; }
 
   bool can_loosen_type() const { return can_loosen_type_; }
@@ -132,6 +141,35 @@ class InferStatus {
     }
   }
 
+  static InferKind KindFromType(const DataType& type) {
+    switch (type.id()) {
+      case Type::INT64:
+        return InferKind::Integer;
+      case Type::BOOL:
+        return InferKind::Boolean;
+      case Type::TIMESTAMP:
+        return InferKind::Timestamp;
+      case Type::DOUBLE:
+        return InferKind::Real;
+      case Type::STRING:
+        return InferKind::Text;
+      case Type::BINARY:
+        return InferKind::Binary;
+      case Type::DICTIONARY: {
+        const auto& value_type =
+            *internal::checked_cast<const DictionaryType&>(type).value_type();
+        if (value_type.id() == Type::STRING) {
+          return InferKind::TextDict;
+        } else if (value_type.id() == Type::BINARY) {
+          return InferKind::BinaryDict;
+        }
+        return InferKind::Null;
+      }
+      default:
+        return InferKind::Null;
+    }
+  }
+
   InferKind kind_;
   bool can_loosen_type_;
   const ConvertOptions& options_;
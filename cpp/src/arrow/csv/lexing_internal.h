@@ -0,0 +1,147 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace csv {
+namespace internal {
+
+/// \brief Copy CSV field data up to the next byte the parser must look at
+///
+/// Inside a field, most bytes are copied verbatim by the parser state machine.
+/// The scanner is given up to four special characters (e.g. the delimiter,
+/// escape character and line endings of an unquoted field) and copies the
+/// bytes which are none of them a SIMD register, or a 64-bit word, at a time.
+/// Unused slots should repeat one of the special characters.
+class SpecialCharScanner {
+ public:
+#if defined(ARROW_HAVE_AVX2)
+  static constexpr int64_t kBlockSize = 32;
+#elif defined(ARROW_HAVE_SSE4_2)
+  static constexpr int64_t kBlockSize = 16;
+#else
+  static constexpr int64_t kBlockSize = 8;
+#endif
+
+  SpecialCharScanner(char c0, char c1, char c2, char c3)
+#if defined(ARROW_HAVE_AVX2)
+      : c0_(_mm256_set1_epi8(c0)),
+        c1_(_mm256_set1_epi8(c1)),
+        c2_(_mm256_set1_epi8(c2)),
+        c3_(_mm256_set1_epi8(c3)) {
+  }
+#elif defined(ARROW_HAVE_SSE4_2)
+      : c0_(_mm_set1_epi8(c0)),
+        c1_(_mm_set1_epi8(c1)),
+        c2_(_mm_set1_epi8(c2)),
+        c3_(_mm_set1_epi8(c3)) {
+  }
+#else
+      : c0_(Broadcast(c0)), c1_(Broadcast(c1)), c2_(Broadcast(c2)), c3_(Broadcast(c3)) {
+  }
+#endif
+
+  /// \brief Copy the bytes which are not special characters
+  ///
+  /// Copy the bytes of [data, data_end) up to the first special character, or up
+  /// to the point where less than kBlockSize bytes are left, to `out`.  Whole
+  /// blocks are stored, so `out` must have room for kBlockSize bytes more than
+  /// are copied.  Return the number of bytes copied; any bytes left before the
+  /// next special character are to be examined one by one.
+  int64_t CopyRun(const char* data, const char* data_end, uint8_t* out) const {
+    const char* const start = data;
+    while (ARROW_PREDICT_TRUE(data_end - data >= kBlockSize)) {
+      const uint64_t mask = LoadAndStore(data, out + (data - start));
+      if (mask != 0) {
+#if ARROW_LITTLE_ENDIAN || defined(ARROW_HAVE_SSE4_2)
+        return (data - start) + BitUtil::CountTrailingZeros(mask) / kMatchBits;
+#else
+        // The match can't be located cheaply, let the caller look at this word
+        return data - start;
+#endif
+      }
+      data += kBlockSize;
+    }
+    return data - start;
+  }
+
+ private:
+#if defined(ARROW_HAVE_AVX2)
+  // One bit per byte of the block
+  static constexpr int kMatchBits = 1;
+
+  // Copy a block and return the mask of its special characters
+  uint64_t LoadAndStore(const char* data, uint8_t* out) const {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), block);
+    const __m256i matches = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(block, c0_), _mm256_cmpeq_epi8(block, c1_)),
+        _mm256_or_si256(_mm256_cmpeq_epi8(block, c2_), _mm256_cmpeq_epi8(block, c3_)));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+  }
+
+  __m256i c0_, c1_, c2_, c3_;
+#elif defined(ARROW_HAVE_SSE4_2)
+  static constexpr int kMatchBits = 1;
+
+  uint64_t LoadAndStore(const char* data, uint8_t* out) const {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), block);
+    const __m128i matches = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(block, c0_), _mm_cmpeq_epi8(block, c1_)),
+        _mm_or_si128(_mm_cmpeq_epi8(block, c2_), _mm_cmpeq_epi8(block, c3_)));
+    return static_cast<uint32_t>(_mm_movemask_epi8(matches));
+  }
+
+  __m128i c0_, c1_, c2_, c3_;
+#else
+  // The high bit of each byte of the word
+  static constexpr int kMatchBits = 8;
+  static constexpr uint64_t kLowBits = 0x0101010101010101ULL;
+  static constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+
+  static uint64_t Broadcast(char c) { return kLowBits * static_cast<uint8_t>(c); }
+
+  // Flags the bytes of `word` which are zero.  Bytes above a zero byte may be
+  // flagged spuriously, but the lowest flagged byte is always a zero byte.
+  static uint64_t ZeroBytes(uint64_t word) {
+    return (word - kLowBits) & ~word & kHighBits;
+  }
+
+  uint64_t LoadAndStore(const char* data, uint8_t* out) const {
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    std::memcpy(out, &word, sizeof(word));
+    return ZeroBytes(word ^ c0_) | ZeroBytes(word ^ c1_) | ZeroBytes(word ^ c2_) |
+           ZeroBytes(word ^ c3_);
+  }
+
+  uint64_t c0_, c1_, c2_, c3_;
+#endif
+};
+
+}  // namespace internal
+}  // namespace csv
+}  // namespace arrow
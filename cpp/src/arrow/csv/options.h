@@ -132,9 +132,37 @@ struct ARROW_EXPORT ReadOptions {
   /// If false, column names will be read from the first CSV row after `skip_rows`.
   bool autogenerate_column_names = false;
 
+  /// Number of bytes at the start of the CSV data used to infer column types
+  ///
+  /// If non-zero, the types of columns without a type in
+  /// ConvertOptions::column_types (including the dictionary encoding decision,
+  /// see ConvertOptions::auto_dict_encode) are first inferred on about that many
+  /// bytes, rounded up to whole blocks.  Conversion of all blocks then starts
+  /// with the sampled types, which avoids reconverting earlier blocks when
+  /// inference changes its mind.  Data outside of the sample can still loosen
+  /// the inferred types.
+  int64_t inference_sample_size = 0;
+
   /// Create read options with default values
   static ReadOptions Defaults();
 };
 
+struct ARROW_EXPORT WriteOptions {
+  /// Whether to write an initial header line with column names
+  bool include_header = true;
+
+  /// Maximum number of rows formatted at a time
+  ///
+  /// Within each batch of rows, columns are formatted in parallel if
+  /// use_threads is true.
+  int32_t batch_size = 1024;
+
+  /// Whether to use the global CPU thread pool
+  bool use_threads = true;
+
+  /// Create write options with default values
+  static WriteOptions Defaults();
+};
+
 }  // namespace csv
 }  // namespace arrow
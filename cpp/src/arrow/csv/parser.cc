@@ -22,6 +22,7 @@
 #include <limits>
 #include <utility>
 
+#include "arrow/csv/lexing_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -68,6 +69,18 @@ int32_t SkipRows(const uint8_t* data, uint32_t size, int32_t num_rows,
   return skipped_rows;
 }
 
+// Bulk scanning has a fixed cost per field, which only pays off if values are
+// long enough on average
+constexpr int64_t kBulkScanMinValueLength = 10;
+
+// Decide from the values of the last parsed chunk whether to bulk scan the next one
+static inline void UpdateBulkScan(int64_t parsed_size, int64_t num_values,
+                                  bool* bulk_scan) {
+  if (num_values > 0) {
+    *bulk_scan = parsed_size >= num_values * kBulkScanMinValueLength;
+  }
+}
+
 template <bool Quoting, bool Escaping>
 class SpecializedOptions {
  public:
@@ -75,13 +88,30 @@ class SpecializedOptions {
   static constexpr bool escaping = Escaping;
 };
 
+// The scanners skipping the bytes of unquoted and quoted fields which are copied
+// verbatim.  In an unquoted field, quote characters are not special.
+struct BlockParser::FieldScanners {
+  explicit FieldScanners(const ParseOptions& options)
+      : unquoted(options.delimiter,
+                 options.escaping ? options.escape_char : options.delimiter, '\r',
+                 '\n'),
+        quoted(options.quote_char,
+               options.escaping ? options.escape_char : options.quote_char,
+               options.quote_char, options.quote_char) {}
+
+  internal::SpecialCharScanner unquoted;
+  internal::SpecialCharScanner quoted;
+};
+
 // A helper class allocating the buffer for parsed values and writing into it
 // without any further resizes, except at the end.
 class BlockParser::PresizedParsedWriter {
  public:
   PresizedParsedWriter(MemoryPool* pool, uint32_t size)
       : parsed_size_(0), parsed_capacity_(size) {
-    parsed_buffer_ = *AllocateResizableBuffer(parsed_capacity_, pool);
+    // Leave room for the whole blocks stored by PushFieldRun()
+    parsed_buffer_ = *AllocateResizableBuffer(
+        parsed_capacity_ + internal::SpecialCharScanner::kBlockSize, pool);
     parsed_ = parsed_buffer_->mutable_data();
   }
 
@@ -92,14 +122,29 @@ class BlockParser::PresizedParsedWriter {
 
   void BeginLine() { saved_parsed_size_ = parsed_size_; }
 
+  void BeginField() { saved_field_size_ = parsed_size_; }
+
   void PushFieldChar(char c) {
     DCHECK_LT(parsed_size_, parsed_capacity_);
     parsed_[parsed_size_++] = static_cast<uint8_t>(c);
   }
 
+  // Push the characters up to the next one special to `scanner`, and return
+  // the position after them
+  const char* PushFieldRun(const internal::SpecialCharScanner& scanner,
+                           const char* data, const char* data_end) {
+    const int64_t length = scanner.CopyRun(data, data_end, parsed_ + parsed_size_);
+    parsed_size_ += length;
+    DCHECK_LE(parsed_size_, parsed_capacity_);
+    return data + length;
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
+  // Drop the characters pushed since BeginField()
+  void RollbackField() { parsed_size_ = saved_field_size_; }
+
   int64_t size() { return parsed_size_; }
 
  protected:
@@ -109,6 +154,8 @@ class BlockParser::PresizedParsedWriter {
   int64_t parsed_capacity_;
   // Checkpointing, for when an incomplete line is encountered at end of block
   int64_t saved_parsed_size_;
+  // Checkpointing, for when a field is not stored
+  int64_t saved_field_size_;
 };
 
 // A helper class handling a growable buffer for values offsets.  This class is
@@ -212,16 +259,26 @@ class BlockParser::PresizedValuesWriter {
   int64_t saved_values_size_;
 };
 
-template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
-Status BlockParser::ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                              const char* data, const char* data_end, bool is_final,
+template <typename SpecializedOptions, bool BulkScan, typename ValuesWriter,
+          typename ParsedWriter>
+Status BlockParser::ParseLine(const FieldScanners& scanners, ValuesWriter* values_writer,
+                              ParsedWriter* parsed_writer, const char* data,
+                              const char* data_end, bool is_final,
                               const char** out_data) {
   int32_t num_cols = 0;
   char c;
 
   DCHECK_GT(data_end, data);
 
-  auto FinishField = [&]() { values_writer->FinishField(parsed_writer); };
+  // Values of masked out columns are delimited, then dropped
+  const bool has_column_mask = !stored_col_indices_.empty();
+  auto FinishField = [&]() {
+    if (ARROW_PREDICT_TRUE(!has_column_mask || IsColumnStored(num_cols))) {
+      values_writer->FinishField(parsed_writer);
+    } else {
+      parsed_writer->RollbackField();
+    }
+  };
 
   values_writer->BeginLine();
   parsed_writer->BeginLine();
@@ -246,6 +303,9 @@ Status BlockParser::ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_
 
 FieldStart:
   // At the start of a field
+  if (has_column_mask) {
+    parsed_writer->BeginField();
+  }
   // Quoting is only recognized at start of field
   if (SpecializedOptions::quoting && ARROW_PREDICT_FALSE(*data == options_.quote_char)) {
     ++data;
@@ -258,6 +318,10 @@ FieldStart:
 
 InField:
   // Inside a non-quoted part of a field
+  if (BulkScan) {
+    // Copy any run of ordinary characters in bulk
+    data = parsed_writer->PushFieldRun(scanners.unquoted, data, data_end);
+  }
   if (ARROW_PREDICT_FALSE(data == data_end)) {
     goto AbortLine;
   }
@@ -290,6 +354,9 @@ InField:
 
 InQuotedField:
   // Inside a quoted part of a field
+  if (BulkScan) {
+    data = parsed_writer->PushFieldRun(scanners.quoted, data, data_end);
+  }
   if (ARROW_PREDICT_FALSE(data == data_end)) {
     goto AbortLine;
   }
@@ -365,7 +432,8 @@ EmptyLine:
       num_cols_ = 1;
     }
     // Record as row of empty (null?) values
-    while (num_cols++ < num_cols_) {
+    for (; num_cols < num_cols_; ++num_cols) {
+      parsed_writer->BeginField();
       values_writer->StartField(false /* quoted */);
       FinishField();
     }
@@ -375,17 +443,19 @@ EmptyLine:
   return Status::OK();
 }
 
-template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
-Status BlockParser::ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                               const char* data, const char* data_end, bool is_final,
+template <typename SpecializedOptions, bool BulkScan, typename ValuesWriter,
+          typename ParsedWriter>
+Status BlockParser::ParseChunk(const FieldScanners& scanners, ValuesWriter* values_writer,
+                               ParsedWriter* parsed_writer, const char* data,
+                               const char* data_end, bool is_final,
                                int32_t rows_in_chunk, const char** out_data,
                                bool* finished_parsing) {
   int32_t num_rows_deadline = num_rows_ + rows_in_chunk;
 
   while (data < data_end && num_rows_ < num_rows_deadline) {
     const char* line_end = data;
-    RETURN_NOT_OK(ParseLine<SpecializedOptions>(values_writer, parsed_writer, data,
-                                                data_end, is_final, &line_end));
+    RETURN_NOT_OK((ParseLine<SpecializedOptions, BulkScan>(
+        scanners, values_writer, parsed_writer, data, data_end, is_final, &line_end)));
     if (line_end == data) {
       // Cannot parse any further
       *finished_parsing = true;
@@ -423,6 +493,7 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
   }
 
   PresizedParsedWriter parsed_writer(pool_, static_cast<uint32_t>(total_view_length));
+  const FieldScanners scanners(options_);
   uint32_t total_parsed_length = 0;
 
   for (const auto& view : views) {
@@ -437,9 +508,18 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
       ResizableValuesWriter values_writer(pool_);
       values_writer.Start(parsed_writer);
 
-      RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
-                                                   data_end, is_final, rows_in_chunk,
-                                                   &data, &finished_parsing));
+      const int64_t parsed_start = parsed_writer.size();
+      if (bulk_scan_) {
+        RETURN_NOT_OK((ParseChunk<SpecializedOptions, true>(
+            scanners, &values_writer, &parsed_writer, data, data_end, is_final,
+            rows_in_chunk, &data, &finished_parsing)));
+      } else {
+        RETURN_NOT_OK((ParseChunk<SpecializedOptions, false>(
+            scanners, &values_writer, &parsed_writer, data, data_end, is_final,
+            rows_in_chunk, &data, &finished_parsing)));
+      }
+      UpdateBulkScan(parsed_writer.size() - parsed_start,
+                     static_cast<int64_t>(num_rows_) * num_stored_cols(), &bulk_scan_);
       if (num_cols_ == -1) {
         return ParseError("Empty CSV file or block: cannot infer number of columns");
       }
@@ -450,21 +530,33 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
       // a given number of rows
       DCHECK_GE(num_cols_, 0);
 
+      const int32_t num_row_values = num_stored_cols();
       int32_t rows_in_chunk;
       constexpr int32_t kTargetChunkSize = 32768;
-      if (num_cols_ > 0) {
-        rows_in_chunk = std::min(std::max(kTargetChunkSize / num_cols_, 512),
+      if (num_row_values > 0) {
+        rows_in_chunk = std::min(std::max(kTargetChunkSize / num_row_values, 512),
                                  max_num_rows_ - num_rows_);
       } else {
         rows_in_chunk = std::min(kTargetChunkSize, max_num_rows_ - num_rows_);
       }
 
-      PresizedValuesWriter values_writer(pool_, rows_in_chunk, num_cols_);
+      PresizedValuesWriter values_writer(pool_, rows_in_chunk, num_row_values);
       values_writer.Start(parsed_writer);
 
-      RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
-                                                   data_end, is_final, rows_in_chunk,
-                                                   &data, &finished_parsing));
+      const int64_t parsed_start = parsed_writer.size();
+      const int32_t rows_start = num_rows_;
+      if (bulk_scan_) {
+        RETURN_NOT_OK((ParseChunk<SpecializedOptions, true>(
+            scanners, &values_writer, &parsed_writer, data, data_end, is_final,
+            rows_in_chunk, &data, &finished_parsing)));
+      } else {
+        RETURN_NOT_OK((ParseChunk<SpecializedOptions, false>(
+            scanners, &values_writer, &parsed_writer, data, data_end, is_final,
+            rows_in_chunk, &data, &finished_parsing)));
+      }
+      UpdateBulkScan(parsed_writer.size() - parsed_start,
+                     static_cast<int64_t>(num_rows_ - rows_start) * num_row_values,
+                     &bulk_scan_);
     }
     DCHECK_GE(data, view.data());
     DCHECK_LE(data, data_end);
@@ -480,7 +572,7 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
   parsed_size_ = static_cast<int32_t>(parsed_buffer_->size());
   parsed_ = parsed_buffer_->data();
 
-  DCHECK_EQ(values_size_, num_rows_ * num_cols_);
+  DCHECK_EQ(values_size_, num_rows_ * num_stored_cols());
   if (num_cols_ == -1) {
     DCHECK_EQ(num_rows_, 0);
   }
@@ -540,12 +632,21 @@ Status BlockParser::ParseFinal(util::string_view data, uint32_t* out_size) {
 }
 
 BlockParser::BlockParser(MemoryPool* pool, ParseOptions options, int32_t num_cols,
-                         int32_t max_num_rows)
+                         int32_t max_num_rows, const std::vector<bool>& column_mask)
     : pool_(pool),
       options_(options),
       num_rows_(-1),
       num_cols_(num_cols),
-      max_num_rows_(max_num_rows) {}
+      max_num_rows_(max_num_rows),
+      bulk_scan_(false),
+      num_stored_cols_(0) {
+  if (!column_mask.empty()) {
+    stored_col_indices_.resize(column_mask.size());
+    for (size_t i = 0; i < column_mask.size(); ++i) {
+      stored_col_indices_[i] = column_mask[i] ? num_stored_cols_++ : -1;
+    }
+  }
+}
 
 BlockParser::BlockParser(ParseOptions options, int32_t num_cols, int32_t max_num_rows)
     : BlockParser(default_memory_pool(), options, num_cols, max_num_rows) {}
@@ -56,12 +56,18 @@ int32_t SkipRows(const uint8_t* data, uint32_t size, int32_t num_rows,
 /// Also, if the previous block ends with CR (0x0d) and a new block starts
 /// with LF (0x0a), the parser will consider the leading newline as an empty
 /// line; the caller should therefore strip it.
+///
+/// If a non-empty column mask is given, only the values of the CSV columns
+/// whose mask entry is true are stored (columns beyond the end of the mask
+/// are not stored).  All fields are still delimited, so that the number of
+/// columns is checked as usual.
 class ARROW_EXPORT BlockParser {
  public:
   explicit BlockParser(ParseOptions options, int32_t num_cols = -1,
                        int32_t max_num_rows = kMaxParserNumRows);
   explicit BlockParser(MemoryPool* pool, ParseOptions options, int32_t num_cols = -1,
-                       int32_t max_num_rows = kMaxParserNumRows);
+                       int32_t max_num_rows = kMaxParserNumRows,
+                       const std::vector<bool>& column_mask = {});
 
   /// \brief Parse a block of data
   ///
@@ -89,6 +95,10 @@ class ARROW_EXPORT BlockParser {
   int32_t num_rows() const { return num_rows_; }
   /// \brief Return the number of parsed columns
   int32_t num_cols() const { return num_cols_; }
+  /// \brief Return the number of columns whose values are stored
+  int32_t num_stored_cols() const {
+    return stored_col_indices_.empty() ? num_cols_ : num_stored_cols_;
+  }
   /// \brief Return the total size in bytes of parsed data
   uint32_t num_bytes() const { return parsed_size_; }
 
@@ -96,14 +106,25 @@ class ARROW_EXPORT BlockParser {
   ///
   /// The signature of the visitor is
   /// Status(const uint8_t* data, uint32_t size, bool quoted)
+  ///
+  /// col_index is the index of the column in the CSV data; it must not have
+  /// been masked out.
   template <typename Visitor>
   Status VisitColumn(int32_t col_index, Visitor&& visit) const {
+    int32_t stored_index = col_index;
+    if (!stored_col_indices_.empty()) {
+      if (!IsColumnStored(col_index)) {
+        return Status::Invalid("CSV column ", col_index, " was not stored by parser");
+      }
+      stored_index = stored_col_indices_[col_index];
+    }
+    const int32_t stride = num_stored_cols();
     for (size_t buf_index = 0; buf_index < values_buffers_.size(); ++buf_index) {
       const auto& values_buffer = values_buffers_[buf_index];
       const auto values = reinterpret_cast<const ValueDesc*>(values_buffer->data());
       const auto max_pos =
           static_cast<int32_t>(values_buffer->size() / sizeof(ValueDesc)) - 1;
-      for (int32_t pos = col_index; pos < max_pos; pos += num_cols_) {
+      for (int32_t pos = stored_index; pos < max_pos; pos += stride) {
         auto start = values[pos].offset;
         auto stop = values[pos + 1].offset;
         auto quoted = values[pos + 1].quoted;
@@ -113,13 +134,15 @@ class ARROW_EXPORT BlockParser {
     return Status::OK();
   }
 
+  /// \brief Visit the stored values of the last parsed row
   template <typename Visitor>
   Status VisitLastRow(Visitor&& visit) const {
+    const int32_t num_values = num_stored_cols();
     const auto& values_buffer = values_buffers_.back();
     const auto values = reinterpret_cast<const ValueDesc*>(values_buffer->data());
     const auto start_pos =
-        static_cast<int32_t>(values_buffer->size() / sizeof(ValueDesc)) - num_cols_ - 1;
-    for (int32_t col_index = 0; col_index < num_cols_; ++col_index) {
+        static_cast<int32_t>(values_buffer->size() / sizeof(ValueDesc)) - num_values - 1;
+    for (int32_t col_index = 0; col_index < num_values; ++col_index) {
       auto start = values[start_pos + col_index].offset;
       auto stop = values[start_pos + col_index + 1].offset;
       auto quoted = values[start_pos + col_index + 1].quoted;
@@ -131,22 +154,34 @@ class ARROW_EXPORT BlockParser {
  protected:
   ARROW_DISALLOW_COPY_AND_ASSIGN(BlockParser);
 
+  bool IsColumnStored(int32_t col_index) const {
+    return col_index < static_cast<int32_t>(stored_col_indices_.size()) &&
+           stored_col_indices_[col_index] >= 0;
+  }
+
   Status DoParse(const std::vector<util::string_view>& data, bool is_final,
                  uint32_t* out_size);
   template <typename SpecializedOptions>
   Status DoParseSpecialized(const std::vector<util::string_view>& data, bool is_final,
                             uint32_t* out_size);
 
-  template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
-  Status ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                    const char* data, const char* data_end, bool is_final,
-                    int32_t rows_in_chunk, const char** out_data, bool* finished_parsing);
+  struct FieldScanners;
+
+  // With BulkScan, runs of ordinary characters in fields are copied a SIMD block
+  // at a time
+  template <typename SpecializedOptions, bool BulkScan, typename ValuesWriter,
+            typename ParsedWriter>
+  Status ParseChunk(const FieldScanners& scanners, ValuesWriter* values_writer,
+                    ParsedWriter* parsed_writer, const char* data, const char* data_end,
+                    bool is_final, int32_t rows_in_chunk, const char** out_data,
+                    bool* finished_parsing);
 
   // Parse a single line from the data pointer
-  template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
-  Status ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                   const char* data, const char* data_end, bool is_final,
-                   const char** out_data);
+  template <typename SpecializedOptions, bool BulkScan, typename ValuesWriter,
+            typename ParsedWriter>
+  Status ParseLine(const FieldScanners& scanners, ValuesWriter* values_writer,
+                   ParsedWriter* parsed_writer, const char* data, const char* data_end,
+                   bool is_final, const char** out_data);
 
   MemoryPool* pool_;
   const ParseOptions options_;
@@ -156,6 +191,12 @@ class ARROW_EXPORT BlockParser {
   int32_t num_cols_;
   // The maximum number of rows to parse from this block
   int32_t max_num_rows_;
+  // Whether values were long enough for bulk scanning in the last parsed chunk
+  bool bulk_scan_;
+  // The index of each CSV column among stored columns, or -1 if masked out.
+  // Empty if all columns are stored.
+  std::vector<int32_t> stored_col_indices_;
+  int32_t num_stored_cols_;
 
   // Linear scratchpad for parsed values
   struct ValueDesc {
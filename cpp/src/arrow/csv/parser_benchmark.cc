@@ -34,6 +34,11 @@ namespace csv {
 // >> For a static/global string constant, use a C style string instead
 const char* one_row = "abc,\"d,f\",12.34,\n";
 const char* one_row_escaped = "abc,d\\,f,12.34,\n";
+// Rows with long text fields, where most bytes are copied without inspection
+const char* one_row_long_text =
+    "\"Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod\","
+    "tempor incididunt ut labore et dolore magna aliqua. Ut enim ad minim veniam,"
+    "12.34,quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea commodo\n";
 
 const auto num_rows = static_cast<int32_t>((1024 * 64) / strlen(one_row));
 
@@ -139,11 +144,35 @@ static void ParseCSVEscapedBlock(benchmark::State& state) {  // NOLINT non-const
   BenchmarkCSVParsing(state, csv, num_rows, options);
 }
 
+static void ParseCSVLongTextBlock(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto rows = static_cast<int32_t>((1024 * 64) / strlen(one_row_long_text));
+  auto csv = BuildCSVData(one_row_long_text, rows);
+  auto options = ParseOptions::Defaults();
+  options.quoting = true;
+  options.escaping = false;
+
+  BenchmarkCSVParsing(state, csv, rows, options);
+}
+
+static void ParseCSVLongTextEscapedBlock(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const auto rows = static_cast<int32_t>((1024 * 64) / strlen(one_row_long_text));
+  auto csv = BuildCSVData(one_row_long_text, rows);
+  auto options = ParseOptions::Defaults();
+  options.quoting = true;
+  options.escaping = true;
+
+  BenchmarkCSVParsing(state, csv, rows, options);
+}
+
 BENCHMARK(ChunkCSVQuotedBlock);
 BENCHMARK(ChunkCSVEscapedBlock);
 BENCHMARK(ChunkCSVNoNewlinesBlock);
 BENCHMARK(ParseCSVQuotedBlock);
 BENCHMARK(ParseCSVEscapedBlock);
+BENCHMARK(ParseCSVLongTextBlock);
+BENCHMARK(ParseCSVLongTextEscapedBlock);
 
 }  // namespace csv
 }  // namespace arrow
@@ -25,6 +25,7 @@
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
 #include "arrow/csv/test_common.h"
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 
@@ -555,6 +556,57 @@ TEST(BlockParser, MismatchingNumColumns) {
   }
 }
 
+TEST(BlockParser, ColumnMask) {
+  const std::vector<bool> mask = {false, true, false, true};
+  {
+    auto csv = MakeCSVData({"ab,cd,ef,gh\n", "\"i,j\",kl,,mn\n", "o,\"p\"\"\",q,\n"});
+    BlockParser parser(default_memory_pool(), ParseOptions::Defaults(), 4, 100, mask);
+    AssertParseOk(parser, csv);
+    ASSERT_EQ(parser.num_cols(), 4);
+    ASSERT_EQ(parser.num_stored_cols(), 2);
+    AssertColumnEq(parser, 1, {"cd", "kl", "p\""}, {false, false, true});
+    AssertColumnEq(parser, 3, {"gh", "mn", ""}, {false, false, false});
+    // Only values of stored columns are kept
+    ASSERT_EQ(parser.num_bytes(), 10);
+    std::vector<std::string> values;
+    std::vector<bool> quoted;
+    GetLastRow(parser, &values, &quoted);
+    ASSERT_EQ(values, std::vector<std::string>({"p\"", ""}));
+    ASSERT_EQ(quoted, std::vector<bool>({true, false}));
+    ASSERT_RAISES(Invalid, parser.VisitColumn(
+                               0, [&](const uint8_t*, uint32_t, bool) -> Status {
+                                 return Status::OK();
+                               }));
+  }
+  {
+    // Number of columns is inferred, empty lines and truncated final row
+    auto options = ParseOptions::Defaults();
+    options.ignore_empty_lines = false;
+    auto csv = MakeCSVData({"ab,cd,ef,gh\n", "\n", "i,j,k,l"});
+    BlockParser parser(default_memory_pool(), options, -1, 100, mask);
+    AssertParseFinal(parser, csv);
+    ASSERT_EQ(parser.num_cols(), 4);
+    AssertColumnEq(parser, 1, {"cd", "", "j"});
+    AssertColumnEq(parser, 3, {"gh", "", "l"});
+    ASSERT_EQ(parser.num_bytes(), 6);
+  }
+  {
+    // Truncated row at end of block is rolled back
+    auto csv = MakeCSVData({"ab,cd,ef,gh\n", "ij,kl"});
+    BlockParser parser(default_memory_pool(), ParseOptions::Defaults(), 4, 100, mask);
+    AssertParsePartial(parser, csv, 12);
+    AssertColumnEq(parser, 1, {"cd"});
+    AssertColumnEq(parser, 3, {"gh"});
+    ASSERT_EQ(parser.num_bytes(), 4);
+  }
+  {
+    // Masked out columns are still counted
+    uint32_t out_size;
+    BlockParser parser(default_memory_pool(), ParseOptions::Defaults(), 4, 100, mask);
+    ASSERT_RAISES(Invalid, Parse(parser, MakeCSVData({"a,b,c\n"}), &out_size));
+  }
+}
+
 TEST(BlockParser, Escaping) {
   auto options = ParseOptions::Defaults();
   options.escaping = true;
@@ -623,5 +675,77 @@ TEST(BlockParser, QuotedEscape) {
   }
 }
 
+// Fields long enough to be scanned a SIMD block at a time, with special
+// characters at various positions relative to the block boundaries
+TEST(BlockParser, LongFields) {
+  constexpr int kNumCols = 3;
+  std::vector<std::string> values;
+  for (int length = 1; length < 100; length += 3) {
+    std::string value(length, ' ');
+    for (int i = 0; i < length; ++i) {
+      value[i] = static_cast<char>('a' + i % 26);
+    }
+    values.push_back(value);
+    for (char special : {',', '"', '\\', '\n', '\r'}) {
+      for (int pos : {0, length / 2, length - 1}) {
+        auto special_value = value;
+        special_value[pos] = special;
+        values.push_back(special_value);
+      }
+    }
+  }
+  values.resize(values.size() - values.size() % kNumCols);
+
+  std::vector<std::vector<std::string>> columns(kNumCols);
+  for (size_t i = 0; i < values.size(); ++i) {
+    columns[i % kNumCols].push_back(values[i]);
+  }
+
+  // With quoting, every field is quoted and quotes are doubled
+  std::string quoted_csv;
+  // With escaping, special characters are preceded by a backslash
+  std::string escaped_csv;
+  std::vector<size_t> escaped_row_ends;
+  for (size_t i = 0; i < values.size(); ++i) {
+    quoted_csv += '"';
+    for (char c : values[i]) {
+      if (c == '"') quoted_csv += '"';
+      quoted_csv += c;
+      if (c == ',' || c == '\\' || c == '\n' || c == '\r') escaped_csv += '\\';
+      escaped_csv += c;
+    }
+    quoted_csv += '"';
+    const char separator = (i % kNumCols == kNumCols - 1) ? '\n' : ',';
+    quoted_csv += separator;
+    escaped_csv += separator;
+    if (separator == '\n') escaped_row_ends.push_back(escaped_csv.size());
+  }
+
+  {
+    auto options = ParseOptions::Defaults();
+    BlockParser parser(options);
+    AssertParseOk(parser, quoted_csv);
+    AssertColumnsEq(parser, columns);
+  }
+  {
+    auto options = ParseOptions::Defaults();
+    options.quoting = false;
+    options.escaping = true;
+    BlockParser parser(options);
+    AssertParseOk(parser, escaped_csv);
+    AssertColumnsEq(parser, columns);
+  }
+  {
+    // Truncated in the middle of a long field: the partial row is not parsed
+    auto options = ParseOptions::Defaults();
+    options.quoting = false;
+    options.escaping = true;
+    const auto row_end = escaped_row_ends[escaped_row_ends.size() / 2];
+    const auto truncated = escaped_csv.substr(0, row_end + 50);
+    BlockParser parser(options);
+    AssertParsePartial(parser, truncated, static_cast<uint32_t>(row_end));
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
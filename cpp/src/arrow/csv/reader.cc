@@ -17,8 +17,10 @@
 
 #include "arrow/csv/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -33,6 +35,8 @@
 #include "arrow/csv/chunker.h"
 #include "arrow/csv/column_builder.h"
 #include "arrow/csv/column_decoder.h"
+#include "arrow/csv/converter.h"
+#include "arrow/csv/inference_internal.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
 #include "arrow/io/interfaces.h"
@@ -41,9 +45,11 @@
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/iterator.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/optional.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
 #include "arrow/util/utf8.h"
@@ -73,19 +79,21 @@ struct ConversionSchema {
     // If set, convert the CSV column to this type
     // If unset (and is_missing is false), infer the type from the CSV column
     std::shared_ptr<DataType> type;
+    // For an inferred column, the type inferred on a sample of the CSV data (if any)
+    std::shared_ptr<DataType> initial_type;
   };
 
   static Column NullColumn(std::string col_name, std::shared_ptr<DataType> type) {
-    return Column{std::move(col_name), -1, true, std::move(type)};
+    return Column{std::move(col_name), -1, true, std::move(type), nullptr};
   }
 
   static Column TypedColumn(std::string col_name, int32_t col_index,
                             std::shared_ptr<DataType> type) {
-    return Column{std::move(col_name), col_index, false, std::move(type)};
+    return Column{std::move(col_name), col_index, false, std::move(type), nullptr};
   }
 
   static Column InferredColumn(std::string col_name, int32_t col_index) {
-    return Column{std::move(col_name), col_index, false, nullptr};
+    return Column{std::move(col_name), col_index, false, nullptr, nullptr};
   }
 
   std::vector<Column> columns;
@@ -256,6 +264,92 @@ class ThreadedBlockReader : public BlockReader {
   }
 };
 
+// An object that reads delimited CSV blocks for threaded use, when values
+// can contain newlines.  Row boundaries in upcoming buffers are located
+// speculatively on the thread pool, so that chunking doesn't have to lex
+// the whole file serially.
+class SpeculativeBlockReader {
+ public:
+  using Speculation = SpeculativeChunker::Speculation;
+
+  SpeculativeBlockReader(std::unique_ptr<SpeculativeChunker> chunker,
+                         Iterator<std::shared_ptr<Buffer>> buffer_iterator,
+                         std::shared_ptr<Buffer> first_buffer, ThreadPool* thread_pool,
+                         int32_t lookahead)
+      : chunker_(std::move(chunker)),
+        buffer_iterator_(std::move(buffer_iterator)),
+        thread_pool_(thread_pool),
+        lookahead_(std::max(lookahead, 1)),
+        partial_(std::make_shared<Buffer>("")),
+        first_buffer_(std::move(first_buffer)) {}
+
+  Result<arrow::util::optional<CSVBlock>> Next() {
+    // Keep one more buffer in flight than consumed, so as to know whether
+    // the current buffer is the last one.
+    while (!eof_ && static_cast<int32_t>(pending_.size()) <= lookahead_) {
+      std::shared_ptr<Buffer> buffer;
+      if (first_buffer_ != nullptr) {
+        buffer = std::move(first_buffer_);
+      } else {
+        ARROW_ASSIGN_OR_RAISE(buffer, buffer_iterator_.Next());
+      }
+      if (buffer == nullptr) {
+        eof_ = true;
+        break;
+      }
+      RETURN_NOT_OK(Speculate(std::move(buffer)));
+    }
+    if (pending_.empty()) {
+      // EOF
+      return util::optional<CSVBlock>();
+    }
+
+    auto current = std::move(pending_.front());
+    pending_.pop_front();
+    bool is_final = pending_.empty();
+    ARROW_ASSIGN_OR_RAISE(auto speculation, current.speculation.result());
+
+    std::shared_ptr<Buffer> completion, whole, next_partial;
+    auto current_partial = std::move(partial_);
+    RETURN_NOT_OK(chunker_->Process(current_partial, current.buffer, speculation,
+                                    is_final, &completion, &whole, &next_partial));
+    partial_ = std::move(next_partial);
+
+    return CSVBlock{current_partial, completion, whole, block_index_++, is_final, {}};
+  }
+
+ protected:
+  struct PendingBuffer {
+    std::shared_ptr<Buffer> buffer;
+    Future<Speculation> speculation;
+  };
+
+  Status Speculate(std::shared_ptr<Buffer> buffer) {
+    // The task shares ownership of the chunker, in case the reader is
+    // destroyed before all speculations have finished.
+    std::shared_ptr<const SpeculativeChunker> chunker = chunker_;
+    ARROW_ASSIGN_OR_RAISE(
+        auto speculation,
+        thread_pool_->Submit([chunker, buffer]() -> Result<Speculation> {
+          Speculation speculation;
+          RETURN_NOT_OK(chunker->Speculate(util::string_view(*buffer), &speculation));
+          return speculation;
+        }));
+    pending_.push_back(PendingBuffer{std::move(buffer), std::move(speculation)});
+    return Status::OK();
+  }
+
+  std::shared_ptr<SpeculativeChunker> chunker_;
+  Iterator<std::shared_ptr<Buffer>> buffer_iterator_;
+  ThreadPool* thread_pool_;
+  const int32_t lookahead_;
+
+  std::shared_ptr<Buffer> partial_, first_buffer_;
+  std::deque<PendingBuffer> pending_;
+  int64_t block_index_ = 0;
+  bool eof_ = false;
+};
+
 /////////////////////////////////////////////////////////////////////////
 // Base class for common functionality
 
@@ -384,10 +478,13 @@ class ReaderMixin {
         col_indices.emplace(column_names_[i], i);
       }
 
+      // Only the values of included columns need to be stored by the parser
+      column_mask_.assign(num_csv_cols_, false);
       for (const auto& col_name : convert_options_.include_columns) {
         auto it = col_indices.find(col_name);
         if (it != col_indices.end()) {
           append_csv_column(col_name, it->second);
+          column_mask_[it->second] = true;
         } else if (convert_options_.include_missing_columns) {
           append_null_column(col_name);
         } else {
@@ -400,6 +497,83 @@ class ReaderMixin {
     return Status::OK();
   }
 
+  // Infer the types of inferred columns on the first
+  // ReadOptions::inference_sample_size bytes of CSV data.  The sampled buffers
+  // are then put back in front of `buffer_iterator_`.
+  Status InferColumnsFromSample(std::shared_ptr<Buffer>* first_buffer) {
+    if (read_options_.inference_sample_size <= 0 ||
+        std::none_of(conversion_schema_.columns.begin(), conversion_schema_.columns.end(),
+                     [](const ConversionSchema::Column& column) {
+                       return !column.is_missing && column.type == nullptr;
+                     })) {
+      return Status::OK();
+    }
+
+    std::vector<std::shared_ptr<Buffer>> sample = {*first_buffer};
+    int64_t sample_size = (*first_buffer)->size();
+    bool is_final = false;
+    while (sample_size < read_options_.inference_sample_size) {
+      ARROW_ASSIGN_OR_RAISE(auto buffer, buffer_iterator_.Next());
+      if (buffer == nullptr) {
+        is_final = true;
+        break;
+      }
+      sample_size += buffer->size();
+      sample.push_back(std::move(buffer));
+    }
+
+    // The sampled rows may straddle buffer boundaries
+    ARROW_ASSIGN_OR_RAISE(auto sample_data, ConcatenateBuffers(sample, pool_));
+    static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
+    BlockParser parser(pool_, parse_options_, num_csv_cols_, max_num_rows, column_mask_);
+    uint32_t parsed_size;
+    if (is_final) {
+      RETURN_NOT_OK(parser.ParseFinal(util::string_view(*sample_data), &parsed_size));
+    } else {
+      // A trailing incomplete row is ignored
+      RETURN_NOT_OK(parser.Parse(util::string_view(*sample_data), &parsed_size));
+    }
+
+    // Run inference on each column, as the column builders would do
+    // on a single block
+    auto& columns = conversion_schema_.columns;
+    RETURN_NOT_OK(arrow::internal::OptionalParallelFor(
+        read_options_.use_threads, static_cast<int>(columns.size()), [&](int i) {
+          auto& column = columns[i];
+          if (column.is_missing || column.type != nullptr) {
+            return Status::OK();
+          }
+          InferStatus infer_status(convert_options_);
+          while (true) {
+            ARROW_ASSIGN_OR_RAISE(auto converter, infer_status.MakeConverter(pool_));
+            auto maybe_array = converter->Convert(parser, column.index);
+            if (maybe_array.ok()) {
+              column.initial_type = converter->type();
+              return Status::OK();
+            }
+            if (!infer_status.can_loosen_type()) {
+              // Let the column builder report the error
+              return Status::OK();
+            }
+            infer_status.LoosenType(maybe_array.status());
+          }
+        }));
+
+    // Yield the sampled buffers again
+    *first_buffer = std::move(sample[0]);
+    auto sampled_it = MakeVectorIterator(
+        std::vector<std::shared_ptr<Buffer>>(sample.begin() + 1, sample.end()));
+    if (is_final) {
+      buffer_iterator_ = std::move(sampled_it);
+    } else {
+      std::vector<Iterator<std::shared_ptr<Buffer>>> its;
+      its.push_back(std::move(sampled_it));
+      its.push_back(std::move(buffer_iterator_));
+      buffer_iterator_ = MakeFlattenIterator(MakeVectorIterator(std::move(its)));
+    }
+    return Status::OK();
+  }
+
   struct ParseResult {
     std::shared_ptr<BlockParser> parser;
     int64_t parsed_bytes;
@@ -410,8 +584,8 @@ class ReaderMixin {
                             const std::shared_ptr<Buffer>& block, int64_t block_index,
                             bool is_final) {
     static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
-    auto parser =
-        std::make_shared<BlockParser>(pool_, parse_options_, num_csv_cols_, max_num_rows);
+    auto parser = std::make_shared<BlockParser>(pool_, parse_options_, num_csv_cols_,
+                                                max_num_rows, column_mask_);
 
     std::shared_ptr<Buffer> straddling;
     std::vector<util::string_view> views;
@@ -447,6 +621,8 @@ class ReaderMixin {
   // Column names in the CSV file
   std::vector<std::string> column_names_;
   ConversionSchema conversion_schema_;
+  // Which CSV columns are converted (empty if all of them)
+  std::vector<bool> column_mask_;
 
   std::shared_ptr<io::InputStream> input_;
   Iterator<std::shared_ptr<Buffer>> buffer_iterator_;
@@ -475,9 +651,9 @@ class BaseTableReader : public ReaderMixin, public csv::TableReader {
                               ColumnBuilder::Make(pool_, column.type, column.index,
                                                   convert_options_, task_group_));
       } else {
-        ARROW_ASSIGN_OR_RAISE(
-            builder,
-            ColumnBuilder::Make(pool_, column.index, convert_options_, task_group_));
+        ARROW_ASSIGN_OR_RAISE(builder,
+                              ColumnBuilder::Make(pool_, column.index, convert_options_,
+                                                  task_group_, column.initial_type));
       }
       column_builders_.push_back(std::move(builder));
     }
@@ -554,9 +730,9 @@ class BaseStreamingReader : public ReaderMixin, public csv::StreamingReader {
                               ColumnDecoder::Make(pool_, column.type, column.index,
                                                   convert_options_, task_group_));
       } else {
-        ARROW_ASSIGN_OR_RAISE(
-            decoder,
-            ColumnDecoder::Make(pool_, column.index, convert_options_, task_group_));
+        ARROW_ASSIGN_OR_RAISE(decoder,
+                              ColumnDecoder::Make(pool_, column.index, convert_options_,
+                                                  task_group_, column.initial_type));
       }
       column_decoders_.push_back(std::move(decoder));
     }
@@ -703,6 +879,7 @@ class SerialStreamingReader : public BaseStreamingReader {
       return Status::Invalid("Empty CSV file");
     }
     RETURN_NOT_OK(ProcessHeader(first_buffer, &first_buffer));
+    RETURN_NOT_OK(InferColumnsFromSample(&first_buffer));
     RETURN_NOT_OK(MakeColumnDecoders());
 
     block_reader_ = std::make_shared<SerialBlockReader>(MakeChunker(parse_options_),
@@ -716,6 +893,166 @@ class SerialStreamingReader : public BaseStreamingReader {
   std::shared_ptr<SerialBlockReader> block_reader_;
 };
 
+/////////////////////////////////////////////////////////////////////////
+// Parallel StreamingReader implementation
+
+class ThreadedStreamingReader : public BaseStreamingReader {
+ public:
+  ThreadedStreamingReader(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                          const ReadOptions& read_options,
+                          const ParseOptions& parse_options,
+                          const ConvertOptions& convert_options, ThreadPool* thread_pool)
+      : BaseStreamingReader(pool, input, read_options, parse_options, convert_options),
+        thread_pool_(thread_pool),
+        max_blocks_in_flight_(std::max(thread_pool->GetCapacity(), 1)) {}
+
+  ~ThreadedStreamingReader() override {
+    if (task_group_) {
+      // Make sure all pending tasks are finished before we start destroying
+      // the column decoders and BaseStreamingReader members
+      ARROW_UNUSED(task_group_->Finish());
+    }
+  }
+
+  Status Init() override {
+    ARROW_ASSIGN_OR_RAISE(auto istream_it,
+                          io::MakeInputStreamIterator(input_, read_options_.block_size));
+
+    // Reading (and decompressing, if the input is compressed) happens on the
+    // readahead thread, while parsing and conversion use the thread pool
+    ARROW_ASSIGN_OR_RAISE(auto rh_it, MakeReadaheadIterator(std::move(istream_it),
+                                                            max_blocks_in_flight_));
+    buffer_iterator_ = CSVBufferIterator::Make(std::move(rh_it));
+    task_group_ = internal::TaskGroup::MakeThreaded(thread_pool_);
+
+    // Read schema from first batch
+    ARROW_ASSIGN_OR_RAISE(pending_batch_, ReadNext());
+    DCHECK_NE(schema_, nullptr);
+    return Status::OK();
+  }
+
+ protected:
+  Result<std::shared_ptr<RecordBatch>> ReadNext() override {
+    if (eof_) {
+      return nullptr;
+    }
+    if (!next_block_) {
+      Status st = SetupReader();
+      if (!st.ok()) {
+        // Can't setup reader => bail out
+        eof_ = true;
+        return st;
+      }
+    }
+    auto batch = std::move(pending_batch_);
+    if (batch != nullptr) {
+      return batch;
+    }
+
+    Status st = ScheduleBlocks();
+    if (!st.ok()) {
+      // Read, chunking or parse error => bail out
+      eof_ = true;
+      return st;
+    }
+
+    auto maybe_batch = DecodeNextBatch();
+    ++num_decoded_blocks_;
+    if (schema_ == nullptr && maybe_batch.ok()) {
+      schema_ = (*maybe_batch)->schema();
+    }
+    return maybe_batch;
+  }
+
+  // Launch parsing of upcoming blocks, then feed the column decoders
+  // with parsed blocks in order, at least up to the next block to decode.
+  Status ScheduleBlocks() {
+    while (!source_eof_ && num_blocks_ - num_decoded_blocks_ < max_blocks_in_flight_) {
+      auto maybe_next = next_block_();
+      if (!maybe_next.ok()) {
+        // Report the error once all previous blocks have been decoded
+        source_status_ = maybe_next.status();
+        source_eof_ = true;
+        break;
+      }
+      auto maybe_block = *std::move(maybe_next);
+      if (!maybe_block.has_value()) {
+        source_eof_ = true;
+        for (auto& decoder : column_decoders_) {
+          decoder->SetEOF(num_blocks_);
+        }
+        break;
+      }
+      DCHECK(!maybe_block->consume_bytes);
+      DCHECK_EQ(maybe_block->block_index, num_blocks_);
+      ++num_blocks_;
+
+      // Parse errors are reported through the Future rather than the
+      // TaskGroup, so as not to cancel pending conversion tasks.
+      auto parsed = Future<ParseResult>::Make();
+      parsing_.push_back(parsed);
+      task_group_->Append([this, maybe_block, parsed]() mutable {
+        parsed.MarkFinished(Parse(maybe_block->partial, maybe_block->completion,
+                                  maybe_block->buffer, maybe_block->block_index,
+                                  maybe_block->is_final));
+        return Status::OK();
+      });
+    }
+
+    // Column decoders must be fed from this thread, as type inference
+    // may block until the first block is converted.  A parse error is only
+    // reported when the block is the next one to decode.
+    while (!parsing_.empty() && (num_inserted_blocks_ == num_decoded_blocks_ ||
+                                 parsing_.front().state() == FutureState::SUCCESS)) {
+      auto parsed = std::move(parsing_.front());
+      parsing_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(auto result, parsed.result());
+      RETURN_NOT_OK(ProcessData(result.parser, num_inserted_blocks_++));
+    }
+    if (num_decoded_blocks_ == num_blocks_) {
+      return source_status_;
+    }
+    return Status::OK();
+  }
+
+  Status SetupReader() {
+    ARROW_ASSIGN_OR_RAISE(auto first_buffer, buffer_iterator_.Next());
+    if (first_buffer == nullptr) {
+      return Status::Invalid("Empty CSV file");
+    }
+    RETURN_NOT_OK(ProcessHeader(first_buffer, &first_buffer));
+    RETURN_NOT_OK(InferColumnsFromSample(&first_buffer));
+    RETURN_NOT_OK(MakeColumnDecoders());
+
+    if (parse_options_.newlines_in_values) {
+      auto block_reader = std::make_shared<SpeculativeBlockReader>(
+          MakeSpeculativeChunker(parse_options_), std::move(buffer_iterator_),
+          std::move(first_buffer), thread_pool_, max_blocks_in_flight_);
+      next_block_ = [block_reader]() { return block_reader->Next(); };
+    } else {
+      auto block_reader = std::make_shared<ThreadedBlockReader>(
+          MakeChunker(parse_options_), std::move(buffer_iterator_),
+          std::move(first_buffer));
+      next_block_ = [block_reader]() { return block_reader->Next(); };
+    }
+    return Status::OK();
+  }
+
+  ThreadPool* thread_pool_;
+  // Maximum number of blocks read but not yet decoded by the consumer
+  const int32_t max_blocks_in_flight_;
+
+  std::function<Result<util::optional<CSVBlock>>()> next_block_;
+  // Blocks being parsed and not yet inserted into the column decoders,
+  // in file order
+  std::deque<Future<ParseResult>> parsing_;
+  bool source_eof_ = false;
+  Status source_status_;
+  int64_t num_blocks_ = 0;
+  int64_t num_inserted_blocks_ = 0;
+  int64_t num_decoded_blocks_ = 0;
+};
+
 /////////////////////////////////////////////////////////////////////////
 // Serial TableReader implementation
 
@@ -744,6 +1081,7 @@ class SerialTableReader : public BaseTableReader {
       return Status::Invalid("Empty CSV file");
     }
     RETURN_NOT_OK(ProcessHeader(first_buffer, &first_buffer));
+    RETURN_NOT_OK(InferColumnsFromSample(&first_buffer));
     RETURN_NOT_OK(MakeColumnBuilders());
 
     SerialBlockReader block_reader(MakeChunker(parse_options_),
@@ -808,17 +1146,34 @@ class ThreadedTableReader : public BaseTableReader {
       return Status::Invalid("Empty CSV file");
     }
     RETURN_NOT_OK(ProcessHeader(first_buffer, &first_buffer));
+    RETURN_NOT_OK(InferColumnsFromSample(&first_buffer));
     RETURN_NOT_OK(MakeColumnBuilders());
 
-    ThreadedBlockReader block_reader(MakeChunker(parse_options_),
-                                     std::move(buffer_iterator_),
-                                     std::move(first_buffer));
+    if (parse_options_.newlines_in_values) {
+      SpeculativeBlockReader block_reader(
+          MakeSpeculativeChunker(parse_options_), std::move(buffer_iterator_),
+          std::move(first_buffer), thread_pool_, thread_pool_->GetCapacity());
+      RETURN_NOT_OK(ParseBlocks(&block_reader));
+    } else {
+      ThreadedBlockReader block_reader(MakeChunker(parse_options_),
+                                       std::move(buffer_iterator_),
+                                       std::move(first_buffer));
+      RETURN_NOT_OK(ParseBlocks(&block_reader));
+    }
+
+    // Finish conversion, create schema and table
+    RETURN_NOT_OK(task_group_->Finish());
+    return MakeTable();
+  }
 
+ protected:
+  template <typename BlockReaderType>
+  Status ParseBlocks(BlockReaderType* block_reader) {
     while (true) {
-      ARROW_ASSIGN_OR_RAISE(auto maybe_block, block_reader.Next());
+      ARROW_ASSIGN_OR_RAISE(auto maybe_block, block_reader->Next());
       if (!maybe_block.has_value()) {
         // EOF
-        break;
+        return Status::OK();
       }
       DCHECK(!maybe_block->consume_bytes);
 
@@ -830,13 +1185,8 @@ class ThreadedTableReader : public BaseTableReader {
             .status();
       });
     }
-
-    // Finish conversion, create schema and table
-    RETURN_NOT_OK(task_group_->Finish());
-    return MakeTable();
   }
 
- protected:
   ThreadPool* thread_pool_;
 };
 
@@ -864,8 +1214,13 @@ Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
     const ReadOptions& read_options, const ParseOptions& parse_options,
     const ConvertOptions& convert_options) {
   std::shared_ptr<BaseStreamingReader> reader;
-  reader = std::make_shared<SerialStreamingReader>(pool, input, read_options,
-                                                   parse_options, convert_options);
+  if (read_options.use_threads) {
+    reader = std::make_shared<ThreadedStreamingReader>(
+        pool, input, read_options, parse_options, convert_options, GetCpuThreadPool());
+  } else {
+    reader = std::make_shared<SerialStreamingReader>(pool, input, read_options,
+                                                     parse_options, convert_options);
+  }
   RETURN_NOT_OK(reader->Init());
   return reader;
 }
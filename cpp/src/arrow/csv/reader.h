@@ -56,8 +56,9 @@ class ARROW_EXPORT StreamingReader : public RecordBatchReader {
 
   /// Create a StreamingReader instance
   ///
-  /// Currently, the StreamingReader is always single-threaded (parallel
-  /// readahead is not supported).
+  /// If ReadOptions::use_threads is true, reading happens on a background
+  /// thread and a bounded number of upcoming blocks are parsed and converted
+  /// on the global CPU thread pool.  Batches are always yielded in file order.
   static Result<std::shared_ptr<StreamingReader>> Make(
       MemoryPool* pool, std::shared_ptr<io::InputStream> input, const ReadOptions&,
       const ParseOptions&, const ConvertOptions&);
@@ -0,0 +1,415 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/writer.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/formatting.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/string_view.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::StringFormatter;
+
+namespace csv {
+
+namespace {
+
+constexpr char kQuote = '"';
+
+// Append `value` between quotes, doubling any quote character inside it
+void UnsafeAppendQuoted(util::string_view value, BufferBuilder* out) {
+  out->UnsafeAppend(1, static_cast<uint8_t>(kQuote));
+  const char* data = value.data();
+  const char* end = data + value.size();
+  while (data < end) {
+    const char* quote = static_cast<const char*>(memchr(data, kQuote, end - data));
+    if (quote == nullptr) {
+      out->UnsafeAppend(data, end - data);
+      break;
+    }
+    // Include the quote, then repeat it
+    out->UnsafeAppend(data, quote + 1 - data);
+    out->UnsafeAppend(1, static_cast<uint8_t>(kQuote));
+    data = quote + 1;
+  }
+  out->UnsafeAppend(1, static_cast<uint8_t>(kQuote));
+}
+
+Status AppendQuoted(util::string_view value, BufferBuilder* out) {
+  // Worst case: every character is a quote
+  RETURN_NOT_OK(out->Reserve(2 * static_cast<int64_t>(value.size()) + 2));
+  UnsafeAppendQuoted(value, out);
+  return Status::OK();
+}
+
+/////////////////////////////////////////////////////////////////////////
+// Column formatters: format all values of an array into contiguous CSV cells
+
+class ColumnFormatter {
+ public:
+  explicit ColumnFormatter(MemoryPool* pool) : data_(pool) {}
+  virtual ~ColumnFormatter() = default;
+
+  // Format the values of `array`, replacing any previously formatted cells
+  Status Format(const Array& array) {
+    data_.Rewind(0);
+    offsets_.clear();
+    offsets_.reserve(array.length() + 1);
+    offsets_.push_back(0);
+    RETURN_NOT_OK(FormatCells(array));
+    DCHECK_EQ(static_cast<int64_t>(offsets_.size()), array.length() + 1);
+    return Status::OK();
+  }
+
+  util::string_view cell(int64_t i) const {
+    return util::string_view(reinterpret_cast<const char*>(data_.data()) + offsets_[i],
+                             offsets_[i + 1] - offsets_[i]);
+  }
+
+  // The total size of formatted cells
+  int64_t data_size() const { return data_.length(); }
+
+ protected:
+  virtual Status FormatCells(const Array& array) = 0;
+
+  void FinishCell() { offsets_.push_back(data_.length()); }
+
+  Status AppendCell(util::string_view value) {
+    RETURN_NOT_OK(data_.Append(value.data(), static_cast<int64_t>(value.size())));
+    FinishCell();
+    return Status::OK();
+  }
+
+  Status AppendQuotedCell(util::string_view value) {
+    RETURN_NOT_OK(AppendQuoted(value, &data_));
+    FinishCell();
+    return Status::OK();
+  }
+
+  BufferBuilder data_;
+  // The end offsets of cells in data_, preceded by 0
+  std::vector<int64_t> offsets_;
+};
+
+// Null values are written as empty cells
+class NullColumnFormatter : public ColumnFormatter {
+ public:
+  using ColumnFormatter::ColumnFormatter;
+
+ protected:
+  Status FormatCells(const Array& array) override {
+    offsets_.resize(array.length() + 1, 0);
+    return Status::OK();
+  }
+};
+
+// Numbers, booleans and temporal values, using the fast formatters in
+// arrow/util/formatting.h
+template <typename T>
+class PrimitiveColumnFormatter : public ColumnFormatter {
+ public:
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+
+  PrimitiveColumnFormatter(MemoryPool* pool, const std::shared_ptr<DataType>& type)
+      : ColumnFormatter(pool), formatter_(type) {}
+
+ protected:
+  Status FormatCells(const Array& array) override {
+    const auto& typed_array = checked_cast<const ArrayType&>(array);
+    auto append = [this](util::string_view formatted) {
+      return data_.Append(formatted.data(), static_cast<int64_t>(formatted.size()));
+    };
+    for (int64_t i = 0; i < typed_array.length(); ++i) {
+      if (typed_array.IsValid(i)) {
+        RETURN_NOT_OK(formatter_(typed_array.Value(i), append));
+      }
+      FinishCell();
+    }
+    return Status::OK();
+  }
+
+  StringFormatter<T> formatter_;
+};
+
+// Binary-like values are always quoted
+template <typename T>
+class BinaryColumnFormatter : public ColumnFormatter {
+ public:
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+  using ColumnFormatter::ColumnFormatter;
+
+ protected:
+  Status FormatCells(const Array& array) override {
+    const auto& typed_array = checked_cast<const ArrayType&>(array);
+    for (int64_t i = 0; i < typed_array.length(); ++i) {
+      if (typed_array.IsValid(i)) {
+        RETURN_NOT_OK(AppendQuoted(typed_array.GetView(i), &data_));
+      }
+      FinishCell();
+    }
+    return Status::OK();
+  }
+};
+
+class Decimal128ColumnFormatter : public ColumnFormatter {
+ public:
+  using ColumnFormatter::ColumnFormatter;
+
+ protected:
+  Status FormatCells(const Array& array) override {
+    const auto& typed_array = checked_cast<const Decimal128Array&>(array);
+    for (int64_t i = 0; i < typed_array.length(); ++i) {
+      if (typed_array.IsValid(i)) {
+        RETURN_NOT_OK(AppendCell(typed_array.FormatValue(i)));
+      } else {
+        FinishCell();
+      }
+    }
+    return Status::OK();
+  }
+};
+
+Result<std::unique_ptr<ColumnFormatter>> MakeColumnFormatter(
+    const std::shared_ptr<DataType>& type, MemoryPool* pool);
+
+// Dictionary values are formatted once per dictionary, then copied for
+// each index
+class DictionaryColumnFormatter : public ColumnFormatter {
+ public:
+  DictionaryColumnFormatter(MemoryPool* pool,
+                            std::unique_ptr<ColumnFormatter> dictionary_formatter)
+      : ColumnFormatter(pool), dictionary_formatter_(std::move(dictionary_formatter)) {}
+
+ protected:
+  Status FormatCells(const Array& array) override {
+    const auto& dict_array = checked_cast<const DictionaryArray&>(array);
+    if (dict_array.dictionary().get() != last_dictionary_) {
+      RETURN_NOT_OK(dictionary_formatter_->Format(*dict_array.dictionary()));
+      last_dictionary_ = dict_array.dictionary().get();
+    }
+    for (int64_t i = 0; i < dict_array.length(); ++i) {
+      if (dict_array.IsValid(i)) {
+        const int64_t index = dict_array.GetValueIndex(i);
+        RETURN_NOT_OK(AppendCell(dictionary_formatter_->cell(index)));
+      } else {
+        FinishCell();
+      }
+    }
+    return Status::OK();
+  }
+
+  std::unique_ptr<ColumnFormatter> dictionary_formatter_;
+  // The dictionary whose values are in dictionary_formatter_
+  const Array* last_dictionary_ = nullptr;
+};
+
+struct ColumnFormatterFactory {
+  template <typename T>
+  enable_if_t<internal::is_formattable<T>::value, Status> Visit(const T&) {
+    out.reset(new PrimitiveColumnFormatter<T>(pool, type));
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_t<is_base_binary_type<T>::value ||
+                  std::is_same<T, FixedSizeBinaryType>::value,
+              Status>
+  Visit(const T&) {
+    out.reset(new BinaryColumnFormatter<T>(pool));
+    return Status::OK();
+  }
+
+  Status Visit(const NullType&) {
+    out.reset(new NullColumnFormatter(pool));
+    return Status::OK();
+  }
+
+  Status Visit(const Decimal128Type&) {
+    out.reset(new Decimal128ColumnFormatter(pool));
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryType& dict_type) {
+    ARROW_ASSIGN_OR_RAISE(auto dictionary_formatter,
+                          MakeColumnFormatter(dict_type.value_type(), pool));
+    out.reset(new DictionaryColumnFormatter(pool, std::move(dictionary_formatter)));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType&) {
+    return Status::NotImplemented("Writing values of type ", *type, " as CSV");
+  }
+
+  const std::shared_ptr<DataType>& type;
+  MemoryPool* pool;
+  std::unique_ptr<ColumnFormatter> out;
+};
+
+Result<std::unique_ptr<ColumnFormatter>> MakeColumnFormatter(
+    const std::shared_ptr<DataType>& type, MemoryPool* pool) {
+  ColumnFormatterFactory factory{type, pool, nullptr};
+  RETURN_NOT_OK(VisitTypeInline(*type, &factory));
+  return std::move(factory.out);
+}
+
+/////////////////////////////////////////////////////////////////////////
+// Writer implementation
+
+class CSVWriterImpl : public CSVWriter {
+ public:
+  CSVWriterImpl(MemoryPool* pool, io::OutputStream* output,
+                std::shared_ptr<Schema> schema, const WriteOptions& options)
+      : output_(output),
+        schema_(std::move(schema)),
+        options_(options),
+        rows_(pool) {}
+
+  Status Init(MemoryPool* pool) {
+    if (options_.batch_size <= 0) {
+      return Status::Invalid("CSV WriteOptions::batch_size must be > 0");
+    }
+    for (const auto& field : schema_->fields()) {
+      ARROW_ASSIGN_OR_RAISE(auto formatter, MakeColumnFormatter(field->type(), pool));
+      formatters_.push_back(std::move(formatter));
+    }
+    if (options_.include_header && schema_->num_fields() > 0) {
+      RETURN_NOT_OK(WriteHeader());
+    }
+    return Status::OK();
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    if (!batch.schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Record batch schema does not match CSV writer schema");
+    }
+    if (schema_->num_fields() == 0) {
+      return Status::OK();
+    }
+    for (int64_t offset = 0; offset < batch.num_rows(); offset += options_.batch_size) {
+      const int64_t length =
+          std::min<int64_t>(options_.batch_size, batch.num_rows() - offset);
+      RETURN_NOT_OK(WriteRows(batch, offset, length));
+    }
+    return Status::OK();
+  }
+
+ protected:
+  Status WriteHeader() {
+    rows_.Rewind(0);
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      RETURN_NOT_OK(AppendQuoted(schema_->field(i)->name(), &rows_));
+      RETURN_NOT_OK(rows_.Append(1, i + 1 == schema_->num_fields() ? '\n' : ','));
+    }
+    return output_->Write(rows_.data(), rows_.length());
+  }
+
+  Status WriteRows(const RecordBatch& batch, int64_t offset, int64_t length) {
+    const int num_cols = batch.num_columns();
+    // Format each column separately, then interleave the cells into rows
+    RETURN_NOT_OK(internal::OptionalParallelFor(
+        options_.use_threads && num_cols > 1, num_cols, [&](int col_index) -> Status {
+          return formatters_[col_index]->Format(
+              *batch.column(col_index)->Slice(offset, length));
+        }));
+
+    // Each cell is followed by a delimiter or a line separator
+    int64_t rows_size = length * num_cols;
+    for (const auto& formatter : formatters_) {
+      rows_size += formatter->data_size();
+    }
+    rows_.Rewind(0);
+    RETURN_NOT_OK(rows_.Reserve(rows_size));
+    for (int64_t row = 0; row < length; ++row) {
+      for (int col_index = 0; col_index < num_cols; ++col_index) {
+        const auto cell = formatters_[col_index]->cell(row);
+        rows_.UnsafeAppend(cell.data(), static_cast<int64_t>(cell.size()));
+        rows_.UnsafeAppend(1, col_index + 1 == num_cols ? '\n' : ',');
+      }
+    }
+    DCHECK_EQ(rows_.length(), rows_size);
+    return output_->Write(rows_.data(), rows_.length());
+  }
+
+  io::OutputStream* output_;
+  std::shared_ptr<Schema> schema_;
+  const WriteOptions options_;
+  std::vector<std::unique_ptr<ColumnFormatter>> formatters_;
+  // Scratch buffer for the rows being written
+  BufferBuilder rows_;
+};
+
+}  // namespace
+
+Status CSVWriter::WriteTable(const Table& table) {
+  TableBatchReader reader(table);
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    RETURN_NOT_OK(WriteRecordBatch(*batch));
+  }
+  return Status::OK();
+}
+
+Result<std::shared_ptr<CSVWriter>> CSVWriter::Make(MemoryPool* pool,
+                                                   io::OutputStream* output,
+                                                   std::shared_ptr<Schema> schema,
+                                                   const WriteOptions& options) {
+  auto writer = std::make_shared<CSVWriterImpl>(pool, output, std::move(schema), options);
+  RETURN_NOT_OK(writer->Init(pool));
+  return writer;
+}
+
+Status WriteCSV(const Table& table, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output) {
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        CSVWriter::Make(pool, output, table.schema(), options));
+  return writer->WriteTable(table);
+}
+
+Status WriteCSV(const RecordBatch& batch, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output) {
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        CSVWriter::Make(pool, output, batch.schema(), options));
+  return writer->WriteRecordBatch(batch);
+}
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/csv/options.h"  // IWYU pragma: keep
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+class OutputStream;
+}  // namespace io
+
+namespace csv {
+
+/// \class CSVWriter
+/// \brief A class that writes record batches as CSV rows
+///
+/// String and binary values are always quoted, other values never are.
+/// Nulls are written as empty values.
+class ARROW_EXPORT CSVWriter {
+ public:
+  virtual ~CSVWriter() = default;
+
+  /// \brief Write a record batch, which must have the writer's schema
+  virtual Status WriteRecordBatch(const RecordBatch& batch) = 0;
+
+  /// \brief Write a table, which must have the writer's schema
+  Status WriteTable(const Table& table);
+
+  /// \brief Create a CSVWriter instance
+  ///
+  /// The header line, if any, is written immediately.  The caller is
+  /// responsible for closing the output stream.
+  static Result<std::shared_ptr<CSVWriter>> Make(MemoryPool* pool,
+                                                 io::OutputStream* output,
+                                                 std::shared_ptr<Schema> schema,
+                                                 const WriteOptions& options);
+};
+
+/// \brief Write a table as CSV to the given output stream
+ARROW_EXPORT
+Status WriteCSV(const Table& table, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output);
+
+/// \brief Write a record batch as CSV to the given output stream
+ARROW_EXPORT
+Status WriteCSV(const RecordBatch& batch, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output);
+
+}  // namespace csv
+}  // namespace arrow
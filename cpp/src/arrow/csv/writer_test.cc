@@ -0,0 +1,146 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/csv/writer.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace csv {
+
+std::string WriteToString(const Table& table, const WriteOptions& options) {
+  auto out = *io::BufferOutputStream::Create(1024, default_memory_pool());
+  ABORT_NOT_OK(WriteCSV(table, options, default_memory_pool(), out.get()));
+  return (*out->Finish())->ToString();
+}
+
+void AssertWritten(const Table& table, const std::string& expected,
+                   WriteOptions options = WriteOptions::Defaults()) {
+  for (bool use_threads : {false, true}) {
+    for (int32_t batch_size : {1, 2, 1024}) {
+      options.use_threads = use_threads;
+      options.batch_size = batch_size;
+      ASSERT_EQ(WriteToString(table, options), expected)
+          << "use_threads = " << use_threads << ", batch_size = " << batch_size;
+    }
+  }
+}
+
+TEST(CSVWriter, Basics) {
+  auto schema = arrow::schema({field("i", int32()), field("f", float64()),
+                               field("b", boolean()), field("s", utf8()),
+                               field("n", null())});
+  auto table = TableFromJSON(schema, {R"([[1, 1.5, true, "ab", null],
+                                          [null, null, null, null, null]])",
+                                      R"([[-3, 0.25, false, "c,\"d\"\ne", null]])"});
+  AssertWritten(*table, "\"i\",\"f\",\"b\",\"s\",\"n\"\n"
+                        "1,1.5,true,\"ab\",\n"
+                        ",,,,\n"
+                        "-3,0.25,false,\"c,\"\"d\"\"\ne\",\n");
+
+  auto options = WriteOptions::Defaults();
+  options.include_header = false;
+  AssertWritten(*table->Slice(2),
+                "-3,0.25,false,\"c,\"\"d\"\"\ne\",\n", options);
+}
+
+TEST(CSVWriter, EmptyTable) {
+  auto schema = arrow::schema({field("a", int32()), field("b\"", utf8())});
+  AssertWritten(*TableFromJSON(schema, {"[]"}), "\"a\",\"b\"\"\"\n");
+}
+
+TEST(CSVWriter, Temporal) {
+  auto schema = arrow::schema({field("d", date32()), field("t", time32(TimeUnit::SECOND)),
+                               field("ts", timestamp(TimeUnit::MILLI))});
+  auto table =
+      TableFromJSON(schema, {R"([[0, 3661, 1000], [18000, null, 1577836800123]])"});
+  AssertWritten(*table,
+                "\"d\",\"t\",\"ts\"\n"
+                "1970-01-01,01:01:01,1970-01-01 00:00:01.000\n"
+                "2019-04-14,,2020-01-01 00:00:00.123\n");
+}
+
+TEST(CSVWriter, Dictionary) {
+  auto type = dictionary(int8(), utf8());
+  auto dict = ArrayFromJSON(utf8(), R"(["foo", "bar"])");
+  auto indices = ArrayFromJSON(int8(), "[1, null, 0, 1]");
+  auto array = *DictionaryArray::FromArrays(type, indices, dict);
+  auto table = Table::Make(arrow::schema({field("x", type)}), {array});
+  AssertWritten(*table, "\"x\"\n\"bar\"\n\n\"foo\"\n\"bar\"\n");
+}
+
+TEST(CSVWriter, RoundTrip) {
+  auto schema = arrow::schema({field("i", int64()), field("f", float64()),
+                               field("s", utf8()), field("b", boolean()),
+                               field("ts", timestamp(TimeUnit::SECOND))});
+  auto table = TableFromJSON(schema, {R"([[1, 2.5, "x\ny", true, 0],
+                                          [null, -1e+30, "", false, 86400],
+                                          [3, null, "\"", null, null],
+                                          [4, 0.5, null, true, 1]])"});
+
+  auto out = *io::BufferOutputStream::Create(1024, default_memory_pool());
+  ASSERT_OK(WriteCSV(*table, WriteOptions::Defaults(), default_memory_pool(), out.get()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, out->Finish());
+
+  auto parse_options = ParseOptions::Defaults();
+  parse_options.newlines_in_values = true;
+  auto convert_options = ConvertOptions::Defaults();
+  // Null strings are written unquoted, empty strings quoted
+  convert_options.strings_can_be_null = true;
+  for (const auto& field : schema->fields()) {
+    convert_options.column_types[field->name()] = field->type();
+  }
+  ASSERT_OK_AND_ASSIGN(
+      auto reader,
+      TableReader::Make(default_memory_pool(), std::make_shared<io::BufferReader>(buffer),
+                        ReadOptions::Defaults(), parse_options, convert_options));
+  ASSERT_OK_AND_ASSIGN(auto read_table, reader->Read());
+  AssertTablesEqual(*table, *read_table);
+}
+
+TEST(CSVWriter, UnsupportedType) {
+  auto schema = arrow::schema({field("l", list(int32()))});
+  auto out = *io::BufferOutputStream::Create(1024, default_memory_pool());
+  ASSERT_RAISES(NotImplemented, CSVWriter::Make(default_memory_pool(), out.get(), schema,
+                                               WriteOptions::Defaults()));
+}
+
+TEST(CSVWriter, SchemaMismatch) {
+  auto out = *io::BufferOutputStream::Create(1024, default_memory_pool());
+  ASSERT_OK_AND_ASSIGN(
+      auto writer, CSVWriter::Make(default_memory_pool(), out.get(),
+                                   arrow::schema({field("a", int32())}),
+                                   WriteOptions::Defaults()));
+  auto batch = RecordBatchFromJSON(arrow::schema({field("a", int64())}), "[[1]]");
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*batch));
+}
+
+}  // namespace csv
+}  // namespace arrow
@@ -24,6 +24,10 @@
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/file_csv.h"
 #include "arrow/dataset/file_ipc.h"
+#include "arrow/dataset/file_orc.h"
 #include "arrow/dataset/file_parquet.h"
 #include "arrow/dataset/filter.h"
+#include "arrow/dataset/gandiva_evaluator.h"
+#include "arrow/dataset/query.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/dataset/spill.h"
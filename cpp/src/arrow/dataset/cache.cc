@@ -0,0 +1,294 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/cache.h"
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/array_base.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace dataset {
+
+//
+// FragmentCache
+//
+
+class FragmentCache::Impl {
+ public:
+  explicit Impl(int64_t capacity) : capacity_(capacity) {}
+
+  std::shared_ptr<ChunkedArray> Get(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      ++misses_;
+      return nullptr;
+    }
+    ++hits_;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->column;
+  }
+
+  void Put(const std::string& key, std::shared_ptr<ChunkedArray> column) {
+    int64_t bytes = 0;
+    for (const auto& chunk : column->chunks()) {
+      bytes += BufferedBytes(*chunk->data());
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    EraseUnlocked(key);
+    if (bytes > capacity_) {
+      return;
+    }
+    while (size_ + bytes > capacity_) {
+      EraseUnlocked(entries_.back().key);
+    }
+    entries_.push_front({key, std::move(column), bytes});
+    index_.emplace(key, entries_.begin());
+    size_ += bytes;
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    index_.clear();
+    size_ = 0;
+  }
+
+  int64_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_;
+  }
+
+  int64_t hits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hits_;
+  }
+
+  int64_t misses() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return misses_;
+  }
+
+  const int64_t capacity_;
+
+ private:
+  struct Entry {
+    std::string key;
+    std::shared_ptr<ChunkedArray> column;
+    int64_t bytes;
+  };
+
+  void EraseUnlocked(const std::string& key) {
+    auto it = index_.find(key);
+    if (it == index_.end()) return;
+    size_ -= it->second->bytes;
+    entries_.erase(it->second);
+    index_.erase(it);
+  }
+
+  mutable std::mutex mutex_;
+  // most recently used first
+  std::list<Entry> entries_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+  int64_t size_ = 0, hits_ = 0, misses_ = 0;
+};
+
+FragmentCache::FragmentCache(int64_t capacity) : impl_(new Impl(capacity)) {}
+
+FragmentCache::~FragmentCache() = default;
+
+std::shared_ptr<ChunkedArray> FragmentCache::Get(const std::string& key) {
+  return impl_->Get(key);
+}
+
+void FragmentCache::Put(const std::string& key, std::shared_ptr<ChunkedArray> column) {
+  impl_->Put(key, std::move(column));
+}
+
+void FragmentCache::Clear() { impl_->Clear(); }
+
+int64_t FragmentCache::capacity() const { return impl_->capacity_; }
+
+int64_t FragmentCache::size() const { return impl_->size(); }
+
+int64_t FragmentCache::hits() const { return impl_->hits(); }
+
+int64_t FragmentCache::misses() const { return impl_->misses(); }
+
+//
+// CachedFragment
+//
+
+CachedFragment::CachedFragment(std::shared_ptr<Fragment> fragment,
+                               std::shared_ptr<FragmentCache> cache)
+    : Fragment(fragment->partition_expression(), /*physical_schema=*/nullptr),
+      fragment_(std::move(fragment)),
+      cache_(std::move(cache)) {}
+
+Result<std::shared_ptr<Schema>> CachedFragment::ReadPhysicalSchemaImpl() {
+  return fragment_->ReadPhysicalSchema();
+}
+
+namespace {
+
+// The prefix of the keys of a file fragment's columns.
+Result<std::string> FragmentKey(FileFragment* fragment) {
+  const auto& source = fragment->source();
+  ARROW_ASSIGN_OR_RAISE(auto info, source.filesystem()->GetFileInfo(source.path()));
+  if (!info.IsFile()) {
+    return Status::IOError("Cannot cache ", source.path(), ": not a file");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto subset, fragment->DescribeSubset());
+
+  std::string key = source.filesystem()->type_name();
+  for (const auto& part :
+       {source.path(), std::to_string(info.mtime().time_since_epoch().count()),
+        std::to_string(info.size()), subset, fragment->format()->type_name()}) {
+    key += '\0';
+    key += part;
+  }
+  return key + '\0';
+}
+
+}  // namespace
+
+Result<ScanTaskIterator> CachedFragment::Scan(std::shared_ptr<ScanOptions> options,
+                                              std::shared_ptr<ScanContext> context) {
+  auto file = dynamic_cast<FileFragment*>(fragment_.get());
+  if (file == nullptr || file->source().filesystem() == nullptr) {
+    return fragment_->Scan(std::move(options), std::move(context));
+  }
+
+  // The materialized fields of the file, in the order of its schema
+  ARROW_ASSIGN_OR_RAISE(auto physical_schema, ReadPhysicalSchema());
+  auto materialized = options->MaterializedFields();
+  std::unordered_set<std::string> names(materialized.begin(), materialized.end());
+  FieldVector fields;
+  for (const auto& field : physical_schema->fields()) {
+    if (names.erase(field->name()) == 1) {
+      fields.push_back(field);
+    }
+  }
+  if (fields.empty()) {
+    return fragment_->Scan(std::move(options), std::move(context));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto key, FragmentKey(file));
+  ChunkedArrayVector columns(fields.size());
+  FieldVector missing_fields;
+  std::vector<size_t> missing;
+  for (size_t i = 0; i < fields.size(); ++i) {
+    columns[i] = cache_->Get(key + fields[i]->name());
+    if (columns[i] == nullptr) {
+      missing_fields.push_back(fields[i]);
+      missing.push_back(i);
+    }
+  }
+
+  if (!missing.empty()) {
+    // Decode the missing columns of every row: the filter is applied to the cached
+    // columns by the Scanner.
+    auto missing_options = options->ReplaceSchema(schema(missing_fields));
+    missing_options->filter = scalar(true);
+
+    std::vector<ArrayVector> chunks(missing.size());
+    ARROW_ASSIGN_OR_RAISE(auto scan_task_it, fragment_->Scan(missing_options, context));
+    for (auto maybe_task : scan_task_it) {
+      ARROW_ASSIGN_OR_RAISE(auto task, maybe_task);
+      ARROW_ASSIGN_OR_RAISE(auto batch_it, task->Execute());
+      for (auto maybe_batch : batch_it) {
+        ARROW_ASSIGN_OR_RAISE(auto batch, maybe_batch);
+        for (size_t j = 0; j < missing.size(); ++j) {
+          auto column = batch->GetColumnByName(missing_fields[j]->name());
+          if (column == nullptr) {
+            return Status::Invalid("Scanning ", file->source().path(),
+                                   " yielded no column ", missing_fields[j]->name());
+          }
+          chunks[j].push_back(std::move(column));
+        }
+      }
+    }
+
+    for (size_t j = 0; j < missing.size(); ++j) {
+      ARROW_ASSIGN_OR_RAISE(
+          columns[missing[j]],
+          ChunkedArray::Make(std::move(chunks[j]), missing_fields[j]->type()));
+      cache_->Put(key + missing_fields[j]->name(), columns[missing[j]]);
+    }
+  }
+
+  int64_t num_rows = columns[0]->length();
+  for (const auto& column : columns) {
+    if (column->length() != num_rows) {
+      return Status::Invalid("Cached columns of ", file->source().path(),
+                             " have differing lengths");
+    }
+  }
+
+  auto table = Table::Make(schema(std::move(fields)), std::move(columns), num_rows);
+  TableBatchReader reader(*table);
+  reader.set_chunksize(options->batch_size);
+  RecordBatchVector batches;
+  RETURN_NOT_OK(reader.ReadAll(&batches));
+
+  ScanTaskVector tasks{std::make_shared<InMemoryScanTask>(
+      std::move(batches), std::move(options), std::move(context))};
+  return MakeVectorIterator(std::move(tasks));
+}
+
+//
+// CachingDataset
+//
+
+CachingDataset::CachingDataset(std::shared_ptr<Dataset> dataset,
+                               std::shared_ptr<FragmentCache> cache)
+    : Dataset(dataset->schema(), dataset->partition_expression()),
+      dataset_(std::move(dataset)),
+      cache_(std::move(cache)) {}
+
+Result<std::shared_ptr<Dataset>> CachingDataset::ReplaceSchema(
+    std::shared_ptr<Schema> schema) const {
+  ARROW_ASSIGN_OR_RAISE(auto dataset, dataset_->ReplaceSchema(std::move(schema)));
+  return std::make_shared<CachingDataset>(std::move(dataset), cache_);
+}
+
+FragmentIterator CachingDataset::GetFragmentsImpl(std::shared_ptr<Expression> predicate) {
+  auto cache = cache_;
+  auto wrap = [cache](std::shared_ptr<Fragment> fragment) -> std::shared_ptr<Fragment> {
+    return std::make_shared<CachedFragment>(std::move(fragment), cache);
+  };
+  return MakeMapIterator(std::move(wrap), dataset_->GetFragments(std::move(predicate)));
+}
+
+}  // namespace dataset
+}  // namespace arrow
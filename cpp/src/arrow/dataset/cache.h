@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief A thread safe cache of decoded columns, bounded by the total size of the
+/// buffers they reference. The least recently used columns are evicted first.
+class ARROW_DS_EXPORT FragmentCache {
+ public:
+  /// \brief Construct a cache holding at most `capacity` bytes of columns.
+  explicit FragmentCache(int64_t capacity);
+  ~FragmentCache();
+
+  /// \brief Return the column cached under `key`, or nullptr. A hit marks the column
+  /// as the most recently used.
+  std::shared_ptr<ChunkedArray> Get(const std::string& key);
+
+  /// \brief Cache a column under `key`, replacing any previous column and evicting the
+  /// least recently used columns until the cache fits its capacity. A column larger
+  /// than the capacity is not cached.
+  void Put(const std::string& key, std::shared_ptr<ChunkedArray> column);
+
+  /// \brief Evict every column.
+  void Clear();
+
+  int64_t capacity() const;
+
+  /// \brief The total size of the buffers referenced by the cached columns.
+  int64_t size() const;
+
+  /// \brief The number of calls to Get which found, or didn't find, a column.
+  int64_t hits() const;
+  int64_t misses() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief A Fragment which reads the columns of a FileFragment through a FragmentCache.
+///
+/// Columns are cached whole, decoded, under a key made of the file's filesystem, path,
+/// modification time and size, the subset of the file viewed by the fragment (see
+/// FileFragment::DescribeSubset), the format's type name and the column's name. A
+/// rewritten file is thus read again, while fragments of the same file sharing a cache
+/// across datasets share its columns. Files read with different options of the same
+/// format must not share a cache.
+///
+/// Fragments which aren't FileFragments backed by a filesystem, and scans projecting no
+/// column of the file, are forwarded to the wrapped fragment.
+class ARROW_DS_EXPORT CachedFragment : public Fragment {
+ public:
+  CachedFragment(std::shared_ptr<Fragment> fragment,
+                 std::shared_ptr<FragmentCache> cache);
+
+  Result<ScanTaskIterator> Scan(std::shared_ptr<ScanOptions> options,
+                                std::shared_ptr<ScanContext> context) override;
+
+  Result<int64_t> CountRows() override { return fragment_->CountRows(); }
+
+  bool splittable() const override { return fragment_->splittable(); }
+
+  std::string type_name() const override { return "cached"; }
+
+  const std::shared_ptr<Fragment>& fragment() const { return fragment_; }
+
+ protected:
+  Result<std::shared_ptr<Schema>> ReadPhysicalSchemaImpl() override;
+
+  std::shared_ptr<Fragment> fragment_;
+  std::shared_ptr<FragmentCache> cache_;
+};
+
+/// \brief A Dataset wrapping the fragments of another Dataset in CachedFragments, so
+/// that repeated scans of the same files are served from memory.
+class ARROW_DS_EXPORT CachingDataset : public Dataset {
+ public:
+  CachingDataset(std::shared_ptr<Dataset> dataset, std::shared_ptr<FragmentCache> cache);
+
+  std::string type_name() const override { return "caching"; }
+
+  Result<std::shared_ptr<Dataset>> ReplaceSchema(
+      std::shared_ptr<Schema> schema) const override;
+
+  const std::shared_ptr<Dataset>& dataset() const { return dataset_; }
+  const std::shared_ptr<FragmentCache>& cache() const { return cache_; }
+
+ protected:
+  FragmentIterator GetFragmentsImpl(std::shared_ptr<Expression> predicate) override;
+
+  std::shared_ptr<Dataset> dataset_;
+  std::shared_ptr<FragmentCache> cache_;
+};
+
+}  // namespace dataset
+}  // namespace arrow
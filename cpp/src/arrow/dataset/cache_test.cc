@@ -0,0 +1,179 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/cache.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/chunked_array.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/file_ipc.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace dataset {
+
+TEST(FragmentCache, EvictsLeastRecentlyUsed) {
+  auto column = [](const std::string& json) {
+    return std::make_shared<ChunkedArray>(ArrayFromJSON(int64(), json));
+  };
+  // 16 bytes of data each
+  auto a = column("[1, 2]"), b = column("[3, 4]"), c = column("[5, 6]");
+
+  FragmentCache cache(32);
+  cache.Put("a", a);
+  cache.Put("b", b);
+  EXPECT_EQ(cache.size(), 32);
+  EXPECT_EQ(cache.Get("a"), a);
+
+  // "b" is the least recently used
+  cache.Put("c", c);
+  EXPECT_EQ(cache.size(), 32);
+  EXPECT_EQ(cache.Get("b"), nullptr);
+  EXPECT_EQ(cache.Get("a"), a);
+  EXPECT_EQ(cache.Get("c"), c);
+  EXPECT_EQ(cache.hits(), 3);
+  EXPECT_EQ(cache.misses(), 1);
+
+  // replacing a column doesn't count it twice
+  cache.Put("c", b);
+  EXPECT_EQ(cache.size(), 32);
+  EXPECT_EQ(cache.Get("c"), b);
+
+  // too large to be cached
+  cache.Put("d", column("[1, 2, 3, 4, 5]"));
+  EXPECT_EQ(cache.Get("d"), nullptr);
+  EXPECT_EQ(cache.size(), 32);
+
+  cache.Clear();
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_EQ(cache.Get("a"), nullptr);
+}
+
+class TestCachingDataset : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(fs_, fs::internal::MockFileSystem::Make(fs::kNoTime, {}));
+  }
+
+  void WriteFile(const std::string& path, const std::string& i64_json,
+                 const std::string& str_json) {
+    auto batch = RecordBatch::Make(
+        schema_, 4, {ArrayFromJSON(int64(), i64_json), ArrayFromJSON(utf8(), str_json)});
+    ASSERT_OK_AND_ASSIGN(auto sink, fs_->OpenOutputStream(path));
+    ASSERT_OK_AND_ASSIGN(auto writer, ipc::MakeFileWriter(sink.get(), schema_));
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+    ASSERT_OK(writer->Close());
+    ASSERT_OK(sink->Close());
+  }
+
+  std::shared_ptr<Dataset> MakeDataset() {
+    std::vector<std::shared_ptr<FileFragment>> fragments;
+    for (const auto& path : {"0.arrow", "1.arrow"}) {
+      EXPECT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment({path, fs_}));
+      fragments.push_back(std::move(fragment));
+    }
+    EXPECT_OK_AND_ASSIGN(auto dataset, FileSystemDataset::Make(schema_, scalar(true),
+                                                               format_, fs_, fragments));
+    return std::make_shared<CachingDataset>(std::move(dataset), cache_);
+  }
+
+  std::shared_ptr<Table> Scan(std::vector<std::string> columns,
+                              std::shared_ptr<Expression> filter = scalar(true)) {
+    ScannerBuilder builder(MakeDataset(), std::make_shared<ScanContext>());
+    ARROW_EXPECT_OK(builder.Project(std::move(columns)));
+    ARROW_EXPECT_OK(builder.Filter(std::move(filter)));
+    EXPECT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+    EXPECT_OK_AND_ASSIGN(auto table, scanner->ToTable());
+    return table;
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_ = schema({field("i64", int64()), field("str", utf8())});
+  std::shared_ptr<IpcFileFormat> format_ = std::make_shared<IpcFileFormat>();
+  std::shared_ptr<FragmentCache> cache_ = std::make_shared<FragmentCache>(1 << 20);
+  std::shared_ptr<fs::FileSystem> fs_;
+};
+
+TEST_F(TestCachingDataset, ScansFromCache) {
+  WriteFile("0.arrow", "[1, 2, 3, 4]", R"(["a", "b", "c", "d"])");
+  WriteFile("1.arrow", "[5, 6, 7, 8]", R"(["e", "f", "g", "h"])");
+
+  auto table = Scan({"i64"});
+  AssertTablesEqual(*Table::Make(schema({field("i64", int64())}),
+                                 {ArrayFromJSON(int64(), "[1, 2, 3, 4, 5, 6, 7, 8]")}),
+                    *table, /*same_chunk_layout=*/false);
+  EXPECT_EQ(cache_->hits(), 0);
+  EXPECT_EQ(cache_->misses(), 2);
+
+  // "i64" is cached; only "str" is read
+  table = Scan({"str"}, greater(field_ref("i64"), scalar(int64_t(6))));
+  AssertTablesEqual(*Table::Make(schema({field("str", utf8())}),
+                                 {ArrayFromJSON(utf8(), R"(["g", "h"])")}),
+                    *table, /*same_chunk_layout=*/false);
+  EXPECT_EQ(cache_->hits(), 2);
+  EXPECT_EQ(cache_->misses(), 4);
+
+  // Every column is cached...
+  table = Scan({"i64", "str"}, equal(field_ref("str"), scalar("b")));
+  AssertTablesEqual(*Table::Make(schema_, {ArrayFromJSON(int64(), "[2]"),
+                                           ArrayFromJSON(utf8(), R"(["b"])")}),
+                    *table, /*same_chunk_layout=*/false);
+  EXPECT_EQ(cache_->hits(), 6);
+  EXPECT_EQ(cache_->misses(), 4);
+
+  // ... until a file is rewritten. The mock filesystem doesn't track modification
+  // times, but the size of the file changes.
+  WriteFile("1.arrow", "[50, 60, 70, 80]", R"(["eeeeeeeeee", "ff", "gg", "hh"])");
+  table = Scan({"str"}, greater(field_ref("i64"), scalar(int64_t(6))));
+  auto expected = ArrayFromJSON(utf8(), R"(["eeeeeeeeee", "ff", "gg", "hh"])");
+  AssertTablesEqual(*Table::Make(schema({field("str", utf8())}), {expected}), *table,
+                    /*same_chunk_layout=*/false);
+  EXPECT_EQ(cache_->hits(), 8);
+  EXPECT_EQ(cache_->misses(), 6);
+}
+
+TEST_F(TestCachingDataset, ForwardsInMemoryFragments) {
+  auto batch = RecordBatch::Make(schema_, 2,
+                                 {ArrayFromJSON(int64(), "[1, 2]"),
+                                  ArrayFromJSON(utf8(), R"([null, "b"])")});
+  auto dataset = std::make_shared<CachingDataset>(
+      std::make_shared<InMemoryDataset>(schema_, RecordBatchVector{batch}), cache_);
+  ASSERT_OK_AND_ASSIGN(auto builder, dataset->NewScan());
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder->Finish());
+  ASSERT_OK_AND_ASSIGN(auto table, scanner->ToTable());
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches({batch}));
+  AssertTablesEqual(*expected, *table);
+  EXPECT_EQ(cache_->misses(), 0);
+  EXPECT_EQ(cache_->size(), 0);
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -55,6 +55,8 @@ Result<std::shared_ptr<Schema>> Fragment::ReadPhysicalSchema() {
   return physical_schema_;
 }
 
+Result<int64_t> Fragment::CountRows() { return -1; }
+
 Result<std::shared_ptr<Schema>> InMemoryFragment::ReadPhysicalSchemaImpl() {
   return physical_schema_;
 }
@@ -95,6 +97,14 @@ Result<ScanTaskIterator> InMemoryFragment::Scan(std::shared_ptr<ScanOptions> opt
   return MakeMapIterator(fn, std::move(batches_it));
 }
 
+Result<int64_t> InMemoryFragment::CountRows() {
+  int64_t num_rows = 0;
+  for (const auto& batch : record_batches_) {
+    num_rows += batch->num_rows();
+  }
+  return num_rows;
+}
+
 Dataset::Dataset(std::shared_ptr<Schema> schema,
                  std::shared_ptr<Expression> partition_expression)
     : schema_(std::move(schema)), partition_expression_(std::move(partition_expression)) {
@@ -64,6 +64,10 @@ class ARROW_DS_EXPORT Fragment {
   virtual Result<ScanTaskIterator> Scan(std::shared_ptr<ScanOptions> options,
                                         std::shared_ptr<ScanContext> context) = 0;
 
+  /// \brief Return the number of rows of the Fragment if it is known without reading
+  /// its data, e.g. from file metadata, otherwise -1.
+  virtual Result<int64_t> CountRows();
+
   /// \brief Return true if the fragment can benefit from parallel scanning.
   virtual bool splittable() const = 0;
 
@@ -101,6 +105,8 @@ class ARROW_DS_EXPORT InMemoryFragment : public Fragment {
   Result<ScanTaskIterator> Scan(std::shared_ptr<ScanOptions> options,
                                 std::shared_ptr<ScanContext> context) override;
 
+  Result<int64_t> CountRows() override;
+
   bool splittable() const override { return false; }
 
   std::string type_name() const override { return "in-memory"; }
@@ -17,13 +17,17 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/data.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/file_base.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/record_batch.h"
 #include "arrow/scalar.h"
@@ -70,5 +74,38 @@ inline std::shared_ptr<Schema> SchemaFromColumnNames(
   return schema(std::move(columns))->WithMetadata(input->metadata());
 }
 
+/// \brief Return true if every field materialized by a scan (see
+/// ScanOptions::MaterializedFields) is referenced by a fragment's partition
+/// expression, so that the scan needs no data from the fragment but its row count.
+inline bool MaterializesOnlyPartitionFields(const ScanOptions& options,
+                                            const Expression& partition_expression) {
+  auto partition_fields = FieldsInExpression(partition_expression);
+  for (const auto& name : options.MaterializedFields()) {
+    if (std::find(partition_fields.begin(), partition_fields.end(), name) ==
+        partition_fields.end()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// \brief Approximate the memory held by an array by the sizes of the buffers it
+/// references.
+inline int64_t BufferedBytes(const ArrayData& data) {
+  int64_t bytes = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      bytes += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    bytes += BufferedBytes(*child);
+  }
+  if (data.dictionary != nullptr) {
+    bytes += BufferedBytes(*data.dictionary);
+  }
+  return bytes;
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -347,6 +347,66 @@ TEST(TestProjector, NonTrivial) {
   AssertBatchesEqual(*expected_batch, *reconciled_batch);
 }
 
+TEST(TestProjector, ReuseMissingColumns) {
+  auto from_schema = schema({field("f64", float64())});
+  auto to_schema =
+      schema({field("a", int32()), field("b", int32()), field("f64", float64()),
+              field("c", int32()), field("d", int32()), field("e", utf8())});
+  auto scalar_i32 = std::make_shared<Int32Scalar>(7);
+
+  RecordBatchProjector projector(to_schema);
+  ASSERT_OK(projector.SetDefaultValue(to_schema->GetFieldIndex("c"), scalar_i32));
+  ASSERT_OK(projector.SetDefaultValue(to_schema->GetFieldIndex("d"),
+                                      std::make_shared<Int32Scalar>(7)));
+
+  auto zeroes = [&](int64_t length) {
+    return ConstantArrayGenerator::Zeroes(length, from_schema);
+  };
+  auto values = [](const RecordBatch& batch, int i) {
+    return batch.column_data(i)->buffers[1]->data();
+  };
+  auto check = [&](const RecordBatch& batch) {
+    ASSERT_OK(batch.ValidateFull());
+    ASSERT_OK_AND_ASSIGN(auto null_i32, MakeArrayOfNull(int32(), batch.num_rows()));
+    ASSERT_OK_AND_ASSIGN(auto null_str, MakeArrayOfNull(utf8(), batch.num_rows()));
+    ASSERT_OK_AND_ASSIGN(auto array_i32,
+                         MakeArrayFromScalar(*scalar_i32, batch.num_rows()));
+    AssertArraysEqual(*null_i32, *batch.column(0));
+    AssertArraysEqual(*null_i32, *batch.column(1));
+    AssertArraysEqual(*array_i32, *batch.column(3));
+    AssertArraysEqual(*array_i32, *batch.column(4));
+    AssertArraysEqual(*null_str, *batch.column(5));
+  };
+
+  // Columns of the same type and value are materialized once
+  ASSERT_OK_AND_ASSIGN(auto projected, projector.Project(*zeroes(100)));
+  ASSERT_NO_FATAL_FAILURE(check(*projected));
+  ASSERT_EQ(values(*projected, 0), values(*projected, 1));
+  ASSERT_EQ(values(*projected, 3), values(*projected, 4));
+
+  // ... and reused for shorter batches, also by copies of the projector
+  RecordBatchProjector copy = projector;
+  ASSERT_OK_AND_ASSIGN(auto shorter, copy.Project(*zeroes(50)));
+  ASSERT_NO_FATAL_FAILURE(check(*shorter));
+  for (int i : {0, 3, 5}) {
+    ASSERT_EQ(values(*shorter, i), values(*projected, i));
+  }
+
+  // Longer batches regrow them
+  ASSERT_OK_AND_ASSIGN(projected, projector.Project(*zeroes(300)));
+  ASSERT_NO_FATAL_FAILURE(check(*projected));
+  ASSERT_NE(values(*projected, 0), values(*shorter, 0));
+
+  // A field missing from a new input schema is filled in at the current length
+  auto other_batch = ConstantArrayGenerator::Zeroes(200, schema({field("c", int32())}));
+  ASSERT_OK_AND_ASSIGN(projected, projector.Project(*other_batch));
+  ASSERT_OK(projected->ValidateFull());
+  ASSERT_OK_AND_ASSIGN(auto null_f64, MakeArrayOfNull(float64(), 200));
+  AssertArraysEqual(*null_f64, *projected->column(2));
+  ASSERT_OK_AND_ASSIGN(auto zeroes_i32, MakeArrayFromScalar(Int32Scalar(0), 200));
+  AssertArraysEqual(*zeroes_i32, *projected->column(3));
+}
+
 class TestEndToEnd : public TestUnionDataset {
   void SetUp() override {
     bool nullable = false;
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -27,6 +28,7 @@
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/partition.h"
+#include "arrow/dataset/statistics.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/filesystem/path_forest.h"
 #include "arrow/filesystem/path_util.h"
@@ -177,35 +179,43 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
   }
 
   ARROW_ASSIGN_OR_RAISE(selector.base_dir, filesystem->NormalizePath(selector.base_dir));
-  ARROW_ASSIGN_OR_RAISE(auto files, filesystem->GetFileInfo(selector));
-
-  // Filter out anything that's not a file or that's explicitly ignored
-  Status st;
-  auto files_end =
-      std::remove_if(files.begin(), files.end(), [&](const fs::FileInfo& info) {
-        if (!info.IsFile()) return true;
-
-        auto relative = fs::internal::RemoveAncestor(selector.base_dir, info.path());
-        if (!relative.has_value()) {
-          st = Status::Invalid("GetFileInfo() yielded path '", info.path(),
-                               "', which is outside base dir '", selector.base_dir, "'");
-          return false;
-        }
-
-        if (StartsWithAnyOf(std::string(*relative), options.selector_ignore_prefixes)) {
-          return true;
-        }
-
-        return false;
-      });
-  RETURN_NOT_OK(st);
-  files.erase(files_end, files.end());
+  // Filter out anything that's not a file or that's explicitly ignored.
+  // Listing results are streamed, so that filtering (which may involve
+  // opening files) proceeds while the rest of the tree is being listed.
+  std::vector<fs::FileInfo> files;
+  auto listing = filesystem->GetFileInfoIterator(selector);
+  RETURN_NOT_OK(listing.Visit([&](fs::FileInfoVector infos) -> Status {
+    for (auto& info : infos) {
+      if (!info.IsFile()) continue;
+
+      auto relative = fs::internal::RemoveAncestor(selector.base_dir, info.path());
+      if (!relative.has_value()) {
+        return Status::Invalid("GetFileInfo() yielded path '", info.path(),
+                               "', which is outside base dir '", selector.base_dir,
+                               "'");
+      }
+
+      if (StartsWithAnyOf(std::string(*relative), options.selector_ignore_prefixes)) {
+        continue;
+      }
+
+      if (options.exclude_invalid_files) {
+        ARROW_ASSIGN_OR_RAISE(auto supported,
+                              format->IsSupported(FileSource(info, filesystem)));
+        if (!supported) continue;
+      }
+
+      files.push_back(std::move(info));
+    }
+    return Status::OK();
+  }));
 
   // Sorting by path guarantees a stability sometimes needed by unit tests.
   std::sort(files.begin(), files.end(), fs::FileInfo::ByPath());
 
-  return Make(std::move(filesystem), std::move(files), std::move(format),
-              std::move(options));
+  return std::shared_ptr<DatasetFactory>(
+      new FileSystemDatasetFactory(std::move(files), std::move(filesystem),
+                                   std::move(format), std::move(options)));
 }
 
 Result<std::vector<std::shared_ptr<Schema>>> FileSystemDatasetFactory::InspectSchemas(
@@ -228,6 +238,42 @@ Result<std::vector<std::shared_ptr<Schema>>> FileSystemDatasetFactory::InspectSc
   return schemas;
 }
 
+// Keep only the statistics which describe a field of the dataset's schema with the
+// field's type.
+static ColumnStatisticsVector StatisticsMatchingSchema(
+    const Schema& schema, const ColumnStatisticsVector& statistics) {
+  ColumnStatisticsVector out;
+  for (const auto& column : statistics) {
+    auto field = schema.GetFieldByName(column.name);
+    if (field != nullptr && column.min != nullptr && column.max != nullptr &&
+        column.min->type->Equals(field->type()) &&
+        column.max->type->Equals(field->type())) {
+      out.push_back(column);
+    }
+  }
+  return out;
+}
+
+// Look up the recorded statistics of a file, keeping only those which describe a field
+// of the dataset's schema with the field's type.
+static ColumnStatisticsVector StatisticsForFile(
+    const Schema& schema, const std::string& statistics_dir, const std::string& path,
+    const std::unordered_map<std::string, ColumnStatisticsVector>& statistics) {
+  auto relative_path = statistics_dir.empty()
+                           ? util::optional<util::string_view>(path)
+                           : fs::internal::RemoveAncestor(statistics_dir, path);
+  if (!relative_path) {
+    return {};
+  }
+
+  auto it = statistics.find(relative_path->to_string());
+  if (it == statistics.end()) {
+    return {};
+  }
+
+  return StatisticsMatchingSchema(schema, it->second);
+}
+
 Result<std::shared_ptr<Dataset>> FileSystemDatasetFactory::Finish(FinishOptions options) {
   std::shared_ptr<Schema> schema = options.schema;
   bool schema_missing = schema == nullptr;
@@ -250,16 +296,80 @@ Result<std::shared_ptr<Dataset>> FileSystemDatasetFactory::Finish(FinishOptions
     ARROW_ASSIGN_OR_RAISE(partitioning, factory->Finish(schema));
   }
 
+  std::unordered_map<std::string, ColumnStatisticsVector> statistics;
+  std::string statistics_dir;
+  if (!options_.statistics_sidecar.empty()) {
+    ARROW_ASSIGN_OR_RAISE(statistics,
+                          ReadStatisticsSidecar(fs_.get(), options_.statistics_sidecar));
+    statistics_dir =
+        fs::internal::GetAbstractPathParent(options_.statistics_sidecar).first;
+  }
+
   std::vector<std::shared_ptr<FileFragment>> fragments;
   for (const auto& info : files_) {
     auto fixed_path = StripPrefixAndFilename(info.path(), options_.partition_base_dir);
     ARROW_ASSIGN_OR_RAISE(auto partition, partitioning->Parse(fixed_path));
     ARROW_ASSIGN_OR_RAISE(auto fragment, format_->MakeFragment({info, fs_}, partition));
+    if (!statistics.empty()) {
+      fragment->SetStatistics(StatisticsForFile(*schema, statistics_dir, info.path(),
+                                                statistics));
+    }
     fragments.push_back(fragment);
   }
 
   return FileSystemDataset::Make(schema, root_partition_, format_, fs_, fragments);
 }
 
+ManifestDatasetFactory::ManifestDatasetFactory(std::shared_ptr<fs::FileSystem> filesystem,
+                                               std::shared_ptr<FileFormat> format,
+                                               DatasetManifest manifest,
+                                               std::string base_dir)
+    : fs_(std::move(filesystem)),
+      format_(std::move(format)),
+      manifest_(std::move(manifest)),
+      base_dir_(std::move(base_dir)) {}
+
+Result<std::shared_ptr<DatasetFactory>> ManifestDatasetFactory::Make(
+    const std::string& manifest_path, std::shared_ptr<fs::FileSystem> filesystem,
+    std::shared_ptr<FileFormat> format) {
+  ARROW_ASSIGN_OR_RAISE(auto manifest,
+                        ReadDatasetManifest(filesystem.get(), manifest_path));
+  auto base_dir = fs::internal::GetAbstractPathParent(manifest_path).first;
+  return std::shared_ptr<DatasetFactory>(
+      new ManifestDatasetFactory(std::move(filesystem), std::move(format),
+                                 std::move(manifest), std::move(base_dir)));
+}
+
+Result<std::vector<std::shared_ptr<Schema>>> ManifestDatasetFactory::InspectSchemas(
+    InspectOptions options) {
+  return std::vector<std::shared_ptr<Schema>>{manifest_.schema};
+}
+
+Result<std::shared_ptr<Dataset>> ManifestDatasetFactory::Finish(FinishOptions options) {
+  std::shared_ptr<Schema> schema = options.schema;
+  if (schema == nullptr) {
+    schema = manifest_.schema;
+  } else if (options.validate_fragments) {
+    RETURN_NOT_OK(SchemaBuilder::AreCompatible({schema, manifest_.schema}));
+  }
+
+  std::vector<std::shared_ptr<FileFragment>> fragments;
+  for (const auto& entry : manifest_.files) {
+    fs::FileInfo info(fs::internal::ConcatAbstractPath(base_dir_, entry.path),
+                      fs::FileType::File);
+    info.set_size(entry.size);
+    ARROW_ASSIGN_OR_RAISE(auto fragment,
+                          format_->MakeFragment({std::move(info), fs_},
+                                                entry.partition_expression,
+                                                manifest_.physical_schema));
+    fragment->SetStatistics(StatisticsMatchingSchema(*schema, entry.statistics));
+    fragment->SetNumRows(entry.num_rows);
+    fragments.push_back(std::move(fragment));
+  }
+
+  return FileSystemDataset::Make(schema, root_partition_, format_, fs_,
+                                 std::move(fragments));
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -27,6 +27,7 @@
 #include <string>
 #include <vector>
 
+#include "arrow/dataset/manifest.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
@@ -182,6 +183,17 @@ struct FileSystemFactoryOptions {
       ".",
       "_",
   };
+
+  // Path of a statistics sidecar, such as the one written by FileSystemDataset::Write
+  // when write_statistics is set. If provided, the column statistics recorded for each
+  // file will be attached to its fragment and used to skip fragments which cannot
+  // satisfy a scan's filter. Recorded paths are resolved relative to the directory
+  // containing the sidecar. Statistics of fields absent from the dataset's schema or
+  // of a different type are ignored.
+  //
+  // Example:
+  // statistics_sidecar = "/dataset/_statistics.arrow";
+  std::string statistics_sidecar;
 };
 
 /// \brief FileSystemDatasetFactory creates a Dataset from a vector of
@@ -239,5 +251,41 @@ class ARROW_DS_EXPORT FileSystemDatasetFactory : public DatasetFactory {
   FileSystemFactoryOptions options_;
 };
 
+/// \brief ManifestDatasetFactory creates a FileSystemDataset from a manifest, such as
+/// the one written by FileSystemDataset::Write when write_manifest is set.
+///
+/// The dataset's schema, files, partition expressions and column statistics are all
+/// read from the manifest: the filesystem is not listed and no file is inspected.
+class ARROW_DS_EXPORT ManifestDatasetFactory : public DatasetFactory {
+ public:
+  /// \brief Create a ManifestDatasetFactory from a manifest path.
+  ///
+  /// The paths recorded in the manifest are relative to `dirname(manifest_path)`.
+  ///
+  /// \param[in] manifest_path path of the manifest
+  /// \param[in] filesystem from which to read the manifest and the dataset's files
+  /// \param[in] format to read the files with
+  static Result<std::shared_ptr<DatasetFactory>> Make(
+      const std::string& manifest_path, std::shared_ptr<fs::FileSystem> filesystem,
+      std::shared_ptr<FileFormat> format);
+
+  Result<std::vector<std::shared_ptr<Schema>>> InspectSchemas(
+      InspectOptions options) override;
+
+  Result<std::shared_ptr<Dataset>> Finish(FinishOptions options) override;
+
+  const DatasetManifest& manifest() const { return manifest_; }
+
+ protected:
+  ManifestDatasetFactory(std::shared_ptr<fs::FileSystem> filesystem,
+                         std::shared_ptr<FileFormat> format, DatasetManifest manifest,
+                         std::string base_dir);
+
+  std::shared_ptr<fs::FileSystem> fs_;
+  std::shared_ptr<FileFormat> format_;
+  DatasetManifest manifest_;
+  std::string base_dir_;
+};
+
 }  // namespace dataset
 }  // namespace arrow
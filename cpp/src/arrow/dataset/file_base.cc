@@ -18,13 +18,18 @@
 #include "arrow/dataset/file_base.h"
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
+#include <limits>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
+#include "arrow/dataset/manifest.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/dataset/scanner_internal.h"
 #include "arrow/filesystem/filesystem.h"
@@ -32,6 +37,7 @@
 #include "arrow/filesystem/path_util.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
@@ -39,6 +45,7 @@
 #include "arrow/util/mutex.h"
 #include "arrow/util/string.h"
 #include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace dataset {
@@ -77,11 +84,151 @@ Result<std::shared_ptr<Schema>> FileFragment::ReadPhysicalSchemaImpl() {
   return format_->Inspect(source_);
 }
 
+Result<std::shared_ptr<FileFragment>> FileFragment::ReplaceSource(FileSource source) {
+  auto lock = physical_schema_mutex_.Lock();
+  ARROW_ASSIGN_OR_RAISE(auto fragment,
+                        format_->MakeFragment(std::move(source), partition_expression_,
+                                              physical_schema_));
+  fragment->statistics_ = statistics_;
+  fragment->statistics_expression_ = statistics_expression_;
+  fragment->num_rows_ = num_rows_;
+  return fragment;
+}
+
+void FileFragment::SetStatistics(ColumnStatisticsVector statistics) {
+  statistics_ = std::move(statistics);
+  statistics_expression_ =
+      statistics_.empty() ? nullptr : StatisticsAsExpression(statistics_);
+}
+
 Result<ScanTaskIterator> FileFragment::Scan(std::shared_ptr<ScanOptions> options,
                                             std::shared_ptr<ScanContext> context) {
+  if (MaterializesOnlyPartitionFields(*options, *partition_expression_)) {
+    // The projector fills in the partition fields, so only the row count is needed
+    ARROW_ASSIGN_OR_RAISE(auto num_rows, CountRows());
+    if (num_rows >= 0) {
+      RecordBatchVector batches;
+      auto empty_schema = schema({});
+      for (int64_t offset = 0; offset < num_rows; offset += options->batch_size) {
+        auto length = std::min(options->batch_size, num_rows - offset);
+        batches.push_back(RecordBatch::Make(empty_schema, length, ArrayVector{}));
+      }
+      ScanTaskVector tasks{std::make_shared<InMemoryScanTask>(
+          std::move(batches), std::move(options), std::move(context))};
+      return MakeVectorIterator(std::move(tasks));
+    }
+  }
   return format_->ScanFile(std::move(options), std::move(context), this);
 }
 
+// The fragments of a FileSystemDataset indexed by partition expression, as a trie of
+// the members of their conjunctions: a fragment of partition expression
+// ("year"_ == 2020 and "month"_ == 1) is found in the node reached from the root by
+// ("year"_ == 2020) then ("month"_ == 1). Partitionings emit the members of partition
+// expressions in the order of their fields, so fragments of a same partition share
+// their path and the nodes of their parent partitions.
+//
+// Selecting the fragments satisfying a predicate then simplifies the predicate once
+// per node instead of once per fragment, and skips whole subtrees as soon as the
+// simplified predicate isn't satisfiable.  The selections of the last predicates are
+// also kept, since a dataset is commonly scanned repeatedly with the same filter.
+struct FileSystemDataset::FragmentIndex {
+  static constexpr size_t kMaxCachedPredicates = 16;
+
+  struct Node {
+    std::shared_ptr<Expression> conjunct;
+    std::vector<std::unique_ptr<Node>> children;
+    // The index of children by the string representation of their conjunct, to
+    // avoid comparing against each sibling while building
+    std::unordered_multimap<std::string, Node*> children_by_repr;
+    // The indices of the fragments whose partition expression ends at this node
+    std::vector<int> fragments;
+
+    Node* GetOrInsertChild(const std::shared_ptr<Expression>& expr) {
+      auto repr = expr->ToString();
+      auto range = children_by_repr.equal_range(repr);
+      for (auto it = range.first; it != range.second; ++it) {
+        if (it->second->conjunct->Equals(*expr)) return it->second;
+      }
+      children.emplace_back(new Node);
+      Node* child = children.back().get();
+      child->conjunct = expr;
+      children_by_repr.emplace(std::move(repr), child);
+      return child;
+    }
+  };
+
+  struct CachedSelection {
+    std::shared_ptr<Expression> predicate;
+    std::vector<int> fragments;
+  };
+
+  void Build(const std::vector<std::shared_ptr<FileFragment>>& fragments) {
+    for (int i = 0; i < static_cast<int>(fragments.size()); ++i) {
+      Node* node = &root;
+      DCHECK_OK(VisitConjunctionMembers(
+          *fragments[i]->partition_expression(), [&](const Expression& member) {
+            if (!member.Equals(true)) {
+              node = node->GetOrInsertChild(member.Copy());
+            }
+            return Status::OK();
+          }));
+      node->fragments.push_back(i);
+    }
+    built = true;
+  }
+
+  void Select(const std::vector<std::shared_ptr<FileFragment>>& fragments,
+              const Node& node, const Expression& predicate,
+              std::vector<int>* selected) const {
+    for (int i : node.fragments) {
+      const auto& statistics = fragments[i]->statistics_expression();
+      if (statistics == nullptr || predicate.IsSatisfiableWith(*statistics)) {
+        selected->push_back(i);
+      }
+    }
+    for (const auto& child : node.children) {
+      auto simplified = predicate.Assume(*child->conjunct);
+      if (simplified->IsSatisfiable()) {
+        Select(fragments, *child, *simplified, selected);
+      }
+    }
+  }
+
+  std::vector<int> Select(const std::vector<std::shared_ptr<FileFragment>>& fragments,
+                          const std::shared_ptr<Expression>& predicate) {
+    auto lock = mutex.Lock();
+    if (!built) {
+      Build(fragments);
+    }
+    for (const auto& cached : cache) {
+      if (cached.predicate->Equals(*predicate)) return cached.fragments;
+    }
+    lock.Unlock();
+
+    std::vector<int> selected;
+    if (predicate->IsSatisfiable()) {
+      Select(fragments, root, *predicate, &selected);
+      // Preserve the order of the fragments in the dataset
+      std::sort(selected.begin(), selected.end());
+    }
+
+    lock = mutex.Lock();
+    if (cache.size() == kMaxCachedPredicates) {
+      cache.pop_front();
+    }
+    cache.push_back({predicate, selected});
+    return selected;
+  }
+
+  util::Mutex mutex;
+  bool built = false;
+  Node root;
+  std::deque<CachedSelection> cache;
+};
+
+constexpr size_t FileSystemDataset::FragmentIndex::kMaxCachedPredicates;
+
 FileSystemDataset::FileSystemDataset(std::shared_ptr<Schema> schema,
                                      std::shared_ptr<Expression> root_partition,
                                      std::shared_ptr<FileFormat> format,
@@ -90,7 +237,8 @@ FileSystemDataset::FileSystemDataset(std::shared_ptr<Schema> schema,
     : Dataset(std::move(schema), std::move(root_partition)),
       format_(std::move(format)),
       filesystem_(std::move(filesystem)),
-      fragments_(std::move(fragments)) {}
+      fragments_(std::move(fragments)),
+      fragment_index_(std::make_shared<FragmentIndex>()) {}
 
 Result<std::shared_ptr<FileSystemDataset>> FileSystemDataset::Make(
     std::shared_ptr<Schema> schema, std::shared_ptr<Expression> root_partition,
@@ -104,8 +252,11 @@ Result<std::shared_ptr<FileSystemDataset>> FileSystemDataset::Make(
 Result<std::shared_ptr<Dataset>> FileSystemDataset::ReplaceSchema(
     std::shared_ptr<Schema> schema) const {
   RETURN_NOT_OK(CheckProjectable(*schema_, *schema));
-  return std::shared_ptr<Dataset>(new FileSystemDataset(
+  std::shared_ptr<FileSystemDataset> dataset(new FileSystemDataset(
       std::move(schema), partition_expression_, format_, filesystem_, fragments_));
+  // The fragments are the same, so are their partition expressions
+  dataset->fragment_index_ = fragment_index_;
+  return dataset;
 }
 
 std::vector<std::string> FileSystemDataset::files() const {
@@ -140,13 +291,9 @@ std::string FileSystemDataset::ToString() const {
 FragmentIterator FileSystemDataset::GetFragmentsImpl(
     std::shared_ptr<Expression> predicate) {
   FragmentVector fragments;
-
-  for (const auto& fragment : fragments_) {
-    if (predicate->IsSatisfiableWith(fragment->partition_expression())) {
-      fragments.push_back(fragment);
-    }
+  for (int i : fragment_index_->Select(fragments_, predicate)) {
+    fragments.push_back(fragments_[i]);
   }
-
   return MakeVectorIterator(std::move(fragments));
 }
 
@@ -172,93 +319,345 @@ Status ValidateBasenameTemplate(util::string_view basename_template) {
   return Status::OK();
 }
 
+Status ValidateWriteOptions(const FileSystemDatasetWriteOptions& write_options) {
+  RETURN_NOT_OK(ValidateBasenameTemplate(write_options.basename_template));
+  if (write_options.max_rows_per_group > 0 &&
+      write_options.min_rows_per_group > write_options.max_rows_per_group) {
+    return Status::Invalid("min_rows_per_group (", write_options.min_rows_per_group,
+                           ") must not exceed max_rows_per_group (",
+                           write_options.max_rows_per_group, ")");
+  }
+  return Status::OK();
+}
+
+class WriteQueue;
+
+/// A file written by a WriteQueue
+struct WrittenFile {
+  std::string path, relative_path;
+  std::shared_ptr<Expression> partition;
+  std::shared_ptr<Schema> schema;
+  int64_t num_rows = 0;
+  std::unique_ptr<StatisticsCollector> statistics;
+};
+
+/// WriteState is shared by all WriteQueues of a single FileSystemDataset::Write. It
+/// numbers the written files and enforces max_open_files.
+class WriteState {
+ public:
+  explicit WriteState(const FileSystemDatasetWriteOptions& write_options)
+      : write_options_(write_options) {}
+
+  const FileSystemDatasetWriteOptions& write_options() const { return write_options_; }
+
+  int NextFileIndex() { return next_file_index_++; }
+
+  // Register a file about to be opened by `queue`. If max_open_files are already open,
+  // wait until a file of another queue can be closed.
+  Status AcquireFile(WriteQueue* queue);
+
+  void ReleaseFile(WriteQueue* queue) {
+    if (write_options_.max_open_files <= 0) return;
+    auto lock = mutex_.Lock();
+    open_.erase(queue);
+  }
+
+ private:
+  const FileSystemDatasetWriteOptions& write_options_;
+  std::atomic<int> next_file_index_{0};
+
+  util::Mutex mutex_;
+  std::unordered_set<WriteQueue*> open_;
+};
+
 /// WriteQueue allows batches to be pushed from multiple threads while another thread
 /// flushes some to disk.
 class WriteQueue {
  public:
-  WriteQueue(std::string partition_expression, size_t index,
-             std::shared_ptr<Schema> schema)
+  WriteQueue(std::string partition_expression, std::shared_ptr<Expression> partition,
+             std::shared_ptr<Schema> schema, WriteState* state)
       : partition_expression_(std::move(partition_expression)),
-        index_(index),
-        schema_(std::move(schema)) {}
+        partition_(std::move(partition)),
+        schema_(std::move(schema)),
+        state_(state),
+        file_index_(state->NextFileIndex()) {}
 
   // Push a batch into the writer's queue of pending writes.
   void Push(std::shared_ptr<RecordBatch> batch) {
     auto push_lock = push_mutex_.Lock();
+    pending_rows_ += batch->num_rows();
     pending_.push_back(std::move(batch));
   }
 
-  // Flush all pending batches, or return immediately if another thread is already
-  // flushing this queue.
-  Status Flush(const FileSystemDatasetWriteOptions& write_options) {
-    if (auto writer_lock = writer_mutex_.TryLock()) {
-      if (writer_ == nullptr) {
-        // FileWriters are opened lazily to avoid blocking access to a scan-wide queue set
-        RETURN_NOT_OK(OpenWriter(write_options));
-      }
+  // Flush pending batches, or return immediately if another thread is already
+  // flushing this queue. Batches are buffered until min_rows_per_group rows are
+  // pending unless this is the final flush, which writes every pending batch and
+  // closes the current file.
+  Status Flush(bool final = false) {
+    const auto& write_options = state_->write_options();
+    auto writer_lock = final ? writer_mutex_.Lock() : writer_mutex_.TryLock();
+    if (!writer_lock) {
+      return Status::OK();
+    }
 
-      while (true) {
-        std::shared_ptr<RecordBatch> batch;
-        {
-          auto push_lock = push_mutex_.Lock();
-          if (pending_.empty()) {
-            // Ensure the writer_lock is released before the push_lock. Otherwise another
-            // thread might successfully Push() a batch but then fail to Flush() it since
-            // the writer_lock is still held, leaving an unflushed batch in pending_.
+    while (true) {
+      RecordBatchVector group;
+      {
+        auto push_lock = push_mutex_.Lock();
+        if (pending_.empty() ||
+            (!final && pending_rows_ < write_options.min_rows_per_group)) {
+          // Ensure the writer_lock is released before the push_lock. Otherwise another
+          // thread might successfully Push() a batch but then fail to Flush() it since
+          // the writer_lock is still held, leaving an unflushed batch in pending_.
+          if (!final) {
             writer_lock.Unlock();
-            break;
           }
-          batch = std::move(pending_.front());
-          pending_.pop_front();
+          break;
         }
-        RETURN_NOT_OK(writer_->Write(batch));
+        group = PopGroup();
       }
+      RETURN_NOT_OK(WriteGroup(std::move(group)));
+    }
+
+    if (final && writer_ != nullptr) {
+      RETURN_NOT_OK(CloseWriter());
     }
     return Status::OK();
   }
 
-  const std::shared_ptr<FileWriter>& writer() const { return writer_; }
+  // Close the current file unless this queue is being flushed by another thread.
+  // Return whether a file was closed.
+  Result<bool> TryCloseWriter() {
+    auto writer_lock = writer_mutex_.TryLock();
+    if (!writer_lock || writer_ == nullptr) {
+      return false;
+    }
+    RETURN_NOT_OK(CloseWriter());
+    return true;
+  }
+
+  // Every file written by this queue. All must have been closed by a final Flush().
+  const std::vector<WrittenFile>& files() const { return files_; }
 
  private:
-  Status OpenWriter(const FileSystemDatasetWriteOptions& write_options) {
+  // Pop a group of batches totalling at least min_rows_per_group rows (if that many
+  // are pending) and at most max_rows_per_group rows (splitting a batch if necessary).
+  // Must be called with the push_lock held.
+  RecordBatchVector PopGroup() {
+    const auto& write_options = state_->write_options();
+    int64_t max_rows = write_options.max_rows_per_group > 0
+                           ? write_options.max_rows_per_group
+                           : std::numeric_limits<int64_t>::max();
+
+    RecordBatchVector group;
+    int64_t rows = 0;
+    do {
+      auto& next = pending_.front();
+      int64_t take = std::min(next->num_rows(), max_rows - rows);
+      if (take < next->num_rows()) {
+        group.push_back(next->Slice(0, take));
+        next = next->Slice(take);
+      } else {
+        group.push_back(std::move(next));
+        pending_.pop_front();
+      }
+      rows += take;
+    } while (!pending_.empty() && rows < write_options.min_rows_per_group &&
+             rows < max_rows);
+
+    pending_rows_ -= rows;
+    return group;
+  }
+
+  // Write a group of batches as a single batch, rotating files at max_rows_per_file.
+  Status WriteGroup(RecordBatchVector group) {
+    const auto& write_options = state_->write_options();
+    std::shared_ptr<RecordBatch> batch;
+    if (group.size() == 1) {
+      batch = std::move(group[0]);
+    } else {
+      ARROW_ASSIGN_OR_RAISE(batch, ConcatenateBatches(group));
+    }
+
+    int64_t offset = 0;
+    do {
+      if (writer_ == nullptr) {
+        // FileWriters are opened lazily to avoid blocking access to a scan-wide queue set
+        RETURN_NOT_OK(OpenWriter());
+      }
+      WrittenFile& file = files_.back();
+
+      auto slice = batch;
+      if (write_options.max_rows_per_file > 0) {
+        int64_t room = write_options.max_rows_per_file - file.num_rows;
+        if (offset != 0 || room < batch->num_rows()) {
+          slice = batch->Slice(offset, room);
+        }
+      }
+      offset += slice->num_rows();
+
+      if (file.statistics != nullptr) {
+        RETURN_NOT_OK(file.statistics->Update(*slice));
+      }
+      file.num_rows += slice->num_rows();
+      RETURN_NOT_OK(writer_->Write(slice));
+
+      if (write_options.max_rows_per_file > 0 &&
+          file.num_rows >= write_options.max_rows_per_file) {
+        RETURN_NOT_OK(CloseWriter());
+      }
+    } while (offset < batch->num_rows());
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<RecordBatch>> ConcatenateBatches(
+      const RecordBatchVector& batches) {
+    int64_t num_rows = 0;
+    for (const auto& batch : batches) {
+      num_rows += batch->num_rows();
+    }
+
+    ArrayVector columns(schema_->num_fields());
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      ArrayVector chunks;
+      for (const auto& batch : batches) {
+        chunks.push_back(batch->column(i));
+      }
+      ARROW_ASSIGN_OR_RAISE(columns[i], Concatenate(chunks));
+    }
+    return RecordBatch::Make(schema_, num_rows, std::move(columns));
+  }
+
+  Status OpenWriter() {
+    const auto& write_options = state_->write_options();
     auto dir =
         fs::internal::EnsureTrailingSlash(write_options.base_dir) + partition_expression_;
 
+    int file_index = file_index_ >= 0 ? file_index_ : state_->NextFileIndex();
+    file_index_ = -1;
     auto basename = internal::Replace(write_options.basename_template, kIntegerToken,
-                                      std::to_string(index_));
+                                      std::to_string(file_index));
     if (!basename) {
       return Status::Invalid("string interpolation of basename template failed");
     }
 
-    auto path = fs::internal::ConcatAbstractPath(dir, *basename);
+    WrittenFile file;
+    file.path = fs::internal::ConcatAbstractPath(dir, *basename);
+    file.relative_path =
+        fs::internal::ConcatAbstractPath(partition_expression_, *basename);
+    file.partition = partition_;
+    file.schema = schema_;
+    if (write_options.write_statistics || write_options.write_manifest) {
+      file.statistics = internal::make_unique<StatisticsCollector>(schema_);
+    }
 
+    RETURN_NOT_OK(state_->AcquireFile(this));
     RETURN_NOT_OK(write_options.filesystem->CreateDir(dir));
     ARROW_ASSIGN_OR_RAISE(auto destination,
-                          write_options.filesystem->OpenOutputStream(path));
+                          write_options.filesystem->OpenOutputStream(file.path));
 
     ARROW_ASSIGN_OR_RAISE(
         writer_, write_options.format()->MakeWriter(std::move(destination), schema_,
                                                     write_options.file_write_options));
+    files_.push_back(std::move(file));
     return Status::OK();
   }
 
+  // Must be called with the writer_lock held.
+  Status CloseWriter() {
+    auto writer = std::move(writer_);
+    state_->ReleaseFile(this);
+    return writer->Finish();
+  }
+
   util::Mutex writer_mutex_;
   std::shared_ptr<FileWriter> writer_;
+  std::vector<WrittenFile> files_;
 
   util::Mutex push_mutex_;
   std::deque<std::shared_ptr<RecordBatch>> pending_;
+  int64_t pending_rows_ = 0;
 
   // The (formatted) partition expression to which this queue corresponds
   std::string partition_expression_;
-
-  size_t index_;
+  std::shared_ptr<Expression> partition_;
 
   std::shared_ptr<Schema> schema_;
+
+  WriteState* state_;
+
+  // The first file of each queue is numbered in order of queue creation, subsequent
+  // files in the order they are opened.
+  int file_index_;
 };
 
+Status WriteState::AcquireFile(WriteQueue* queue) {
+  if (write_options_.max_open_files <= 0) return Status::OK();
+
+  while (true) {
+    std::vector<WriteQueue*> open;
+    {
+      auto lock = mutex_.Lock();
+      if (static_cast<int>(open_.size()) < write_options_.max_open_files) {
+        open_.insert(queue);
+        return Status::OK();
+      }
+      open.assign(open_.begin(), open_.end());
+    }
+
+    // Files being written by other threads can't be closed, but will be available
+    // once their queue's flush completes.
+    for (WriteQueue* other : open) {
+      ARROW_ASSIGN_OR_RAISE(bool closed, other->TryCloseWriter());
+      if (closed) break;
+    }
+    std::this_thread::yield();
+  }
+}
+
+// Record every written file, with the statistics collected while writing it.
+static Status WriteManifest(const FileSystemDatasetWriteOptions& write_options,
+                            std::shared_ptr<Schema> dataset_schema,
+                            const std::vector<const WrittenFile*>& written,
+                            std::vector<ColumnStatisticsVector> statistics) {
+  std::vector<std::string> paths;
+  for (const WrittenFile* file : written) {
+    paths.push_back(file->path);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto infos, write_options.filesystem->GetFileInfo(paths));
+
+  DatasetManifest manifest;
+  manifest.schema = std::move(dataset_schema);
+
+  bool same_physical_schema = true;
+  for (size_t i = 0; i < written.size(); ++i) {
+    const WrittenFile& file = *written[i];
+    if (i == 0) {
+      manifest.physical_schema = file.schema;
+    } else if (!file.schema->Equals(*manifest.physical_schema)) {
+      same_physical_schema = false;
+    }
+
+    ManifestEntry entry;
+    entry.path = file.relative_path;
+    entry.size = infos[i].size();
+    entry.num_rows = file.num_rows;
+    entry.partition_expression = file.partition;
+    entry.statistics = std::move(statistics[i]);
+    manifest.files.push_back(std::move(entry));
+  }
+  if (!same_physical_schema) {
+    manifest.physical_schema = nullptr;
+  }
+
+  auto manifest_path =
+      fs::internal::ConcatAbstractPath(write_options.base_dir, kManifestBasename);
+  return WriteDatasetManifest(write_options.filesystem.get(), manifest_path, manifest);
+}
+
 Status FileSystemDataset::Write(const FileSystemDatasetWriteOptions& write_options,
                                 std::shared_ptr<Scanner> scanner) {
-  RETURN_NOT_OK(ValidateBasenameTemplate(write_options.basename_template));
+  RETURN_NOT_OK(ValidateWriteOptions(write_options));
 
   auto task_group = scanner->context()->TaskGroup();
 
@@ -296,6 +695,7 @@ Status FileSystemDataset::Write(const FileSystemDatasetWriteOptions& write_optio
   // to a WriteQueue which flushes batches into that partition's output file. In principle
   // any thread could produce a batch for any partition, so each task alternates between
   // pushing batches and flushing them to disk.
+  WriteState state(write_options);
   util::Mutex queues_mutex;
   std::unordered_map<std::string, std::unique_ptr<WriteQueue>> queues;
 
@@ -313,8 +713,8 @@ Status FileSystemDataset::Write(const FileSystemDatasetWriteOptions& write_optio
 
         std::unordered_set<WriteQueue*> need_flushed;
         for (size_t i = 0; i < groups.batches.size(); ++i) {
-          AndExpression partition_expression(std::move(groups.expressions[i]),
-                                             fragment->partition_expression());
+          auto partition = std::move(groups.expressions[i]);
+          AndExpression partition_expression(partition, fragment->partition_expression());
           auto batch = std::move(groups.batches[i]);
 
           ARROW_ASSIGN_OR_RAISE(auto part,
@@ -330,10 +730,8 @@ Status FileSystemDataset::Write(const FileSystemDatasetWriteOptions& write_optio
                         [&](const std::string& emplaced_part) {
                           // lookup in `queues` also failed,
                           // generate a new WriteQueue
-                          size_t queue_index = queues.size() - 1;
-
                           return internal::make_unique<WriteQueue>(
-                              emplaced_part, queue_index, batch->schema());
+                              emplaced_part, partition, batch->schema(), &state);
                         })
                         ->second.get();
           }
@@ -344,7 +742,7 @@ Status FileSystemDataset::Write(const FileSystemDatasetWriteOptions& write_optio
 
         // flush all touched WriteQueues
         for (auto queue : need_flushed) {
-          RETURN_NOT_OK(queue->Flush(write_options));
+          RETURN_NOT_OK(queue->Flush());
         }
       }
 
@@ -353,11 +751,54 @@ Status FileSystemDataset::Write(const FileSystemDatasetWriteOptions& write_optio
   }
   RETURN_NOT_OK(task_group->Finish());
 
-  task_group = scanner->context()->TaskGroup();
+  // Write whatever remains buffered and close all files. Since this is only IO, use the
+  // IO thread pool when threads are allowed.
+  task_group = scanner->context()->use_threads
+                   ? internal::TaskGroup::MakeThreaded(io::internal::GetIOThreadPool())
+                   : internal::TaskGroup::MakeSerial();
   for (const auto& part_queue : queues) {
-    task_group->Append([&] { return part_queue.second->writer()->Finish(); });
+    task_group->Append([&] { return part_queue.second->Flush(/*final=*/true); });
+  }
+  RETURN_NOT_OK(task_group->Finish());
+
+  if (!write_options.write_statistics && !write_options.write_manifest) {
+    return Status::OK();
   }
-  return task_group->Finish();
+
+  // sort by path so the sidecar and manifest don't depend on the order queues were hashed
+  std::vector<const WrittenFile*> written;
+  for (const auto& part_queue : queues) {
+    for (const auto& file : part_queue.second->files()) {
+      written.push_back(&file);
+    }
+  }
+  std::sort(written.begin(), written.end(),
+            [](const WrittenFile* l, const WrittenFile* r) {
+              return l->relative_path < r->relative_path;
+            });
+
+  std::vector<std::pair<std::string, ColumnStatisticsVector>> statistics;
+  for (const WrittenFile* file : written) {
+    ARROW_ASSIGN_OR_RAISE(auto file_statistics, file->statistics->Finish());
+    statistics.emplace_back(file->relative_path, std::move(file_statistics));
+  }
+
+  RETURN_NOT_OK(write_options.filesystem->CreateDir(write_options.base_dir));
+  if (write_options.write_statistics) {
+    auto sidecar_path = fs::internal::ConcatAbstractPath(write_options.base_dir,
+                                                         kStatisticsSidecarBasename);
+    RETURN_NOT_OK(
+        WriteStatisticsSidecar(write_options.filesystem.get(), sidecar_path, statistics));
+  }
+  if (write_options.write_manifest) {
+    std::vector<ColumnStatisticsVector> manifest_statistics;
+    for (auto& file_statistics : statistics) {
+      manifest_statistics.push_back(std::move(file_statistics.second));
+    }
+    RETURN_NOT_OK(WriteManifest(write_options, scanner->schema(), written,
+                                std::move(manifest_statistics)));
+  }
+  return Status::OK();
 }
 
 }  // namespace dataset
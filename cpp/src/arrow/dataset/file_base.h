@@ -30,6 +30,7 @@
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/dataset/statistics.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
 #include "arrow/filesystem/filesystem.h"
@@ -172,6 +173,45 @@ class ARROW_DS_EXPORT FileFragment : public Fragment {
   const FileSource& source() const { return source_; }
   const std::shared_ptr<FileFormat>& format() const { return format_; }
 
+  /// \brief Return a copy of this fragment which reads its file from another source,
+  /// e.g. a buffer holding the prefetched contents of the file.
+  ///
+  /// Any format-specific state of the fragment is preserved.
+  virtual Result<std::shared_ptr<FileFragment>> ReplaceSource(FileSource source);
+
+  /// \brief Return a description of the part of the file viewed by this fragment, e.g.
+  /// its row groups, or an empty string if it views the whole file.
+  ///
+  /// Fragments of the same file with equal descriptions yield the same data.
+  virtual Result<std::string> DescribeSubset() { return ""; }
+
+  /// \brief Return the number of rows provided by SetNumRows, or -1.
+  Result<int64_t> CountRows() override { return num_rows_; }
+
+  /// \brief Provide the number of rows of this fragment's file, e.g. from a manifest.
+  ///
+  /// Scans which only materialize partition fields then read nothing from the file.
+  /// This is not thread safe and must be done before the fragment is scanned.
+  void SetNumRows(int64_t num_rows) { num_rows_ = num_rows; }
+
+  /// \brief Return the statistics summarizing the columns of this fragment's file.
+  /// Empty if none were provided.
+  const ColumnStatisticsVector& statistics() const { return statistics_; }
+
+  /// \brief Return an expression guaranteed to be satisfied by every row of this
+  /// fragment's file, derived from its statistics, or nullptr if it has none.
+  const std::shared_ptr<Expression>& statistics_expression() const {
+    return statistics_expression_;
+  }
+
+  /// \brief Provide statistics summarizing the columns of this fragment's file, which
+  /// FileSystemDataset will use to skip the fragment when a filter cannot be satisfied.
+  ///
+  /// The type of each column's min and max must be identical to the type of the
+  /// corresponding field of the dataset's schema. This is not thread safe and must be
+  /// done before the fragment is scanned.
+  void SetStatistics(ColumnStatisticsVector statistics);
+
  protected:
   FileFragment(FileSource source, std::shared_ptr<FileFormat> format,
                std::shared_ptr<Expression> partition_expression,
@@ -185,6 +225,10 @@ class ARROW_DS_EXPORT FileFragment : public Fragment {
   FileSource source_;
   std::shared_ptr<FileFormat> format_;
 
+  ColumnStatisticsVector statistics_;
+  std::shared_ptr<Expression> statistics_expression_;
+  int64_t num_rows_ = -1;
+
   friend class FileFormat;
 };
 
@@ -246,6 +290,12 @@ class ARROW_DS_EXPORT FileSystemDataset : public Dataset {
   std::shared_ptr<FileFormat> format_;
   std::shared_ptr<fs::FileSystem> filesystem_;
   std::vector<std::shared_ptr<FileFragment>> fragments_;
+
+ private:
+  // An index of fragments_ by partition expression and a cache of the fragments
+  // selected by the last predicates, built by the first call to GetFragments.
+  struct FragmentIndex;
+  std::shared_ptr<FragmentIndex> fragment_index_;
 };
 
 class ARROW_DS_EXPORT FileWriteOptions {
@@ -302,6 +352,37 @@ struct ARROW_DS_EXPORT FileSystemDatasetWriteOptions {
   /// {i} will be replaced by an auto incremented integer.
   std::string basename_template;
 
+  /// If true, collect statistics of the columns of each written file and store them in
+  /// a sidecar file named kStatisticsSidecarBasename in base_dir. The sidecar can be
+  /// passed to FileSystemFactoryOptions::statistics_sidecar to prune fragments when the
+  /// dataset is read.
+  bool write_statistics = false;
+
+  /// If true, write a manifest named kManifestBasename in base_dir recording the
+  /// dataset's schema and each written file's path, size, row count, partition
+  /// expression and column statistics. ManifestDatasetFactory reconstructs the dataset
+  /// from it without listing base_dir or inspecting any file.
+  bool write_manifest = false;
+
+  /// Maximum number of rows written to a single file. Once a file holds this many rows
+  /// it is closed and subsequent rows of its partition are written to a new file.
+  /// 0 means unlimited.
+  int64_t max_rows_per_file = 0;
+
+  /// Rows of each partition are buffered until at least this many are available, then
+  /// written to the file in a single batch. Fewer rows may be written by the last
+  /// write to each file. 0 writes batches as they are produced.
+  int64_t min_rows_per_group = 0;
+
+  /// Maximum number of rows written in a single batch; larger batches are split.
+  /// Must not be less than min_rows_per_group. 0 means unlimited.
+  int64_t max_rows_per_group = 0;
+
+  /// Maximum number of files open for writing at any time. When a new file must be
+  /// opened beyond this limit, another partition's file is closed first, and that
+  /// partition's subsequent rows are written to a new file. 0 means unlimited.
+  int max_open_files = 0;
+
   const std::shared_ptr<FileFormat>& format() const {
     return file_write_options->format();
   }
@@ -18,6 +18,7 @@
 #include "arrow/dataset/file_ipc.h"
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -224,6 +225,73 @@ TEST_F(TestIpcFileSystemDataset, WriteWithEmptyPartitioningSchema) {
   TestWriteWithEmptyPartitioningSchema();
 }
 
+TEST_F(TestIpcFileFormat, ReplaceSource) {
+  auto reader = GetRecordBatchReader();
+  auto buffer = Write(reader.get());
+  auto partition_expression = equal(field_ref("part"), scalar(1));
+  ASSERT_OK_AND_ASSIGN(auto fragment,
+                       format_->MakeFragment({"part=1/data.arrow", nullptr},
+                                             partition_expression, schema_));
+
+  ASSERT_OK_AND_ASSIGN(auto replaced, fragment->ReplaceSource(FileSource(buffer)));
+  ASSERT_EQ(replaced->source().buffer(), buffer);
+  ASSERT_EQ(replaced->format(), format_);
+  ASSERT_TRUE(replaced->partition_expression()->Equals(*partition_expression));
+  ASSERT_OK_AND_ASSIGN(auto physical_schema, replaced->ReadPhysicalSchema());
+  AssertSchemaEqual(*schema_, *physical_schema);
+}
+
+TEST_F(TestIpcFileFormat, ScanBatchesOfFiles) {
+  opts_ = ScanOptions::Make(schema_);
+  auto fs = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+  ASSERT_OK(fs->CreateDir("data"));
+
+  FragmentVector fragments;
+  RecordBatchVector expected;
+  for (int i = 0; i < 6; ++i) {
+    auto batch = RecordBatch::Make(
+        schema_, 2, {ArrayFromJSON(float64(), "[" + std::to_string(i) + ", null]")});
+    ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches({batch, batch}));
+    expected.insert(expected.end(), {batch, batch});
+
+    auto path = "data/" + std::to_string(i) + ".arrow";
+    ASSERT_OK_AND_ASSIGN(auto sink, fs->OpenOutputStream(path));
+    ASSERT_OK(sink->Write(Write(*table)));
+    ASSERT_OK(sink->Close());
+    ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment({path, fs}));
+    fragments.push_back(std::move(fragment));
+  }
+
+  auto make_scanner = [&](int64_t readahead_bytes) {
+    std::vector<std::shared_ptr<FileFragment>> file_fragments;
+    for (const auto& fragment : fragments) {
+      file_fragments.push_back(checked_pointer_cast<FileFragment>(fragment));
+    }
+    EXPECT_OK_AND_ASSIGN(auto dataset,
+                         FileSystemDataset::Make(schema_, scalar(true), format_, fs,
+                                                 std::move(file_fragments)));
+    ctx_->use_threads = true;
+    opts_->readahead_bytes = readahead_bytes;
+    return Scanner{dataset, opts_, ctx_};
+  };
+
+  // Files are prefetched whole, or larger than the limit and read incrementally
+  for (int64_t readahead_bytes : {kDefaultReadaheadBytes, int64_t(1)}) {
+    ASSERT_OK_AND_ASSIGN(auto batch_it, make_scanner(readahead_bytes).ScanBatches());
+    ASSERT_OK_AND_ASSIGN(auto actual, batch_it.ToVector());
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      AssertBatchesEqual(*expected[i], *actual[i]);
+    }
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto missing, format_->MakeFragment({"data/missing.arrow", fs}));
+  fragments.insert(fragments.begin() + 3, missing);
+  for (int64_t readahead_bytes : {kDefaultReadaheadBytes, int64_t(1)}) {
+    ASSERT_RAISES(IOError, make_scanner(readahead_bytes).ToTable());
+  }
+}
+
 TEST_F(TestIpcFileFormat, OpenFailureWithRelevantError) {
   std::shared_ptr<Buffer> buf = std::make_shared<Buffer>(util::string_view(""));
   auto result = format_->Inspect(FileSource(buf));
@@ -0,0 +1,183 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_orc.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/adapters/orc/adapter.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/dataset/statistics.h"
+#include "arrow/util/iterator.h"
+
+namespace arrow {
+namespace dataset {
+
+using adapters::orc::ORCColumnStatistics;
+using adapters::orc::ORCFileReader;
+
+namespace {
+
+Result<std::shared_ptr<ORCFileReader>> OpenReader(
+    const FileSource& source, MemoryPool* pool = default_memory_pool()) {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+
+  std::unique_ptr<ORCFileReader> reader;
+  auto status = ORCFileReader::Open(std::move(input), pool, &reader);
+  if (!status.ok()) {
+    return status.WithMessage("Could not open ORC input source '", source.path(),
+                              "': ", status.message());
+  }
+  return std::shared_ptr<ORCFileReader>(std::move(reader));
+}
+
+/// \brief A ScanTask reading a single stripe of an ORC file.
+class OrcScanTask : public ScanTask {
+ public:
+  OrcScanTask(std::shared_ptr<ORCFileReader> reader, std::shared_ptr<Schema> schema,
+              int64_t stripe, std::vector<std::string> included_names,
+              std::vector<int> filter_fields, std::shared_ptr<ScanOptions> options,
+              std::shared_ptr<ScanContext> context)
+      : ScanTask(std::move(options), std::move(context)),
+        reader_(std::move(reader)),
+        schema_(std::move(schema)),
+        stripe_(stripe),
+        included_names_(std::move(included_names)),
+        filter_fields_(std::move(filter_fields)) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    std::vector<int> row_groups;
+    if (!filter_fields_.empty()) {
+      std::vector<ORCColumnStatistics> statistics;
+      std::vector<std::vector<ORCColumnStatistics>> row_group_statistics;
+      RETURN_NOT_OK(
+          reader_->ReadStripeStatistics(stripe_, &statistics, &row_group_statistics));
+      if (!IsSatisfiableWith(statistics)) {
+        return MakeEmptyIterator<std::shared_ptr<RecordBatch>>();
+      }
+
+      for (size_t i = 0; i < row_group_statistics.size(); ++i) {
+        if (IsSatisfiableWith(row_group_statistics[i])) {
+          row_groups.push_back(static_cast<int>(i));
+        }
+      }
+      if (!row_group_statistics.empty()) {
+        if (row_groups.empty()) {
+          return MakeEmptyIterator<std::shared_ptr<RecordBatch>>();
+        }
+        if (row_groups.size() == row_group_statistics.size()) {
+          // Every row group may satisfy the filter, read the stripe in one go
+          row_groups.clear();
+        }
+      }
+    }
+
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(reader_->ReadStripe(stripe_, included_names_, row_groups, &batch));
+    return MakeVectorIterator<std::shared_ptr<RecordBatch>>({std::move(batch)});
+  }
+
+ private:
+  // Whether the rows summarized by the statistics may satisfy the filter
+  bool IsSatisfiableWith(const std::vector<ORCColumnStatistics>& statistics) const {
+    ColumnStatisticsVector columns;
+    for (int i : filter_fields_) {
+      const auto& field_statistics = statistics[i];
+      if (field_statistics.min == nullptr || field_statistics.max == nullptr) {
+        continue;
+      }
+      ColumnStatistics column;
+      column.name = schema_->field(i)->name();
+      column.min = field_statistics.min;
+      column.max = field_statistics.max;
+      column.null_count = field_statistics.has_null ? -1 : 0;
+      columns.push_back(std::move(column));
+    }
+    return options_->filter->IsSatisfiableWith(StatisticsAsExpression(columns));
+  }
+
+  std::shared_ptr<ORCFileReader> reader_;
+  std::shared_ptr<Schema> schema_;
+  int64_t stripe_;
+  std::vector<std::string> included_names_;
+  // The indices of the top-level fields referenced by the filter
+  std::vector<int> filter_fields_;
+};
+
+}  // namespace
+
+Result<bool> OrcFileFormat::IsSupported(const FileSource& source) const {
+  RETURN_NOT_OK(source.Open().status());
+  return OpenReader(source).ok();
+}
+
+Result<std::shared_ptr<Schema>> OrcFileFormat::Inspect(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source));
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(reader->ReadSchema(&schema));
+  return schema;
+}
+
+Result<ScanTaskIterator> OrcFileFormat::ScanFile(std::shared_ptr<ScanOptions> options,
+                                                 std::shared_ptr<ScanContext> context,
+                                                 FileFragment* fragment) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(fragment->source(), context->pool));
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(reader->ReadSchema(&schema));
+
+  // Only decode the materialized fields which are present in the file
+  std::vector<std::string> included_names;
+  for (FieldRef ref : options->MaterializedFields()) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*schema));
+    if (match.indices().empty()) continue;
+
+    const auto& name = schema->field(match.indices()[0])->name();
+    if (std::find(included_names.begin(), included_names.end(), name) ==
+        included_names.end()) {
+      included_names.push_back(name);
+    }
+  }
+
+  // Only read statistics if the filter may prune stripes
+  std::vector<int> filter_fields;
+  if (!options->filter->Equals(true)) {
+    for (const auto& name : FieldsInExpression(*options->filter)) {
+      int i = schema->GetFieldIndex(name);
+      if (i != -1 && std::find(filter_fields.begin(), filter_fields.end(), i) ==
+                         filter_fields.end()) {
+        filter_fields.push_back(i);
+      }
+    }
+  }
+
+  std::vector<std::shared_ptr<ScanTask>> tasks;
+  for (int64_t stripe = 0; stripe < reader->NumberOfStripes(); ++stripe) {
+    tasks.push_back(std::make_shared<OrcScanTask>(reader, schema, stripe, included_names,
+                                                  filter_fields, options, context));
+  }
+  return MakeVectorIterator(std::move(tasks));
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,208 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_orc.h"
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <orc/OrcFile.hh>
+
+#include "arrow/array.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace liborc = orc;
+
+namespace arrow {
+namespace dataset {
+
+constexpr int64_t kStripeCount = 4;
+constexpr int64_t kStripeRowCount = 5000;
+constexpr int64_t kRowIndexStride = 1000;
+constexpr int64_t kNumRows = kStripeCount * kStripeRowCount;
+
+class BufferOutputStream : public liborc::OutputStream {
+ public:
+  uint64_t getLength() const override { return data_.size(); }
+
+  uint64_t getNaturalWriteSize() const override { return 128 * 1024; }
+
+  void write(const void* buf, size_t size) override {
+    const char* bytes = reinterpret_cast<const char*>(buf);
+    data_.insert(data_.end(), bytes, bytes + size);
+  }
+
+  const std::string& getName() const override { return name_; }
+
+  void close() override {}
+
+  std::shared_ptr<Buffer> Finish() { return Buffer::FromString(std::move(data_)); }
+
+ private:
+  std::string data_;
+  std::string name_ = "BufferOutputStream";
+};
+
+class TestOrcFileFormat : public ::testing::Test {
+ public:
+  // Write stripes of (i32: the row number, f64: the row number halved), with a
+  // row index
+  void SetUp() override {
+    std::unique_ptr<liborc::Type> type(
+        liborc::Type::buildTypeFromString("struct<i32:int,f64:double>"));
+    liborc::WriterOptions options;
+    options.setStripeSize(1024);
+    options.setRowIndexStride(kRowIndexStride);
+    BufferOutputStream stream;
+    auto writer = liborc::createWriter(*type, &stream, options);
+
+    auto batch = writer->createRowBatch(kStripeRowCount);
+    auto struct_batch = dynamic_cast<liborc::StructVectorBatch*>(batch.get());
+    auto long_batch = dynamic_cast<liborc::LongVectorBatch*>(struct_batch->fields[0]);
+    auto double_batch = dynamic_cast<liborc::DoubleVectorBatch*>(struct_batch->fields[1]);
+    int64_t row = 0;
+    for (int64_t j = 0; j < kStripeCount; ++j) {
+      for (int64_t i = 0; i < kStripeRowCount; ++i, ++row) {
+        long_batch->data[i] = row;
+        double_batch->data[i] = row / 2.0;
+      }
+      struct_batch->numElements = long_batch->numElements = double_batch->numElements =
+          kStripeRowCount;
+      writer->add(*batch);
+    }
+    writer->close();
+
+    source_ = internal::make_unique<FileSource>(stream.Finish());
+    opts_ = ScanOptions::Make(schema_);
+  }
+
+  RecordBatchIterator Batches(Fragment* fragment) {
+    EXPECT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(opts_, ctx_));
+    return MakeFlattenIterator(MakeMaybeMapIterator(
+        [](std::shared_ptr<ScanTask> scan_task) { return scan_task->Execute(); },
+        std::move(scan_task_it)));
+  }
+
+  void CountRowsAndBatchesInScan(Fragment* fragment, int64_t expected_rows,
+                                 int64_t expected_batches) {
+    int64_t actual_rows = 0;
+    int64_t actual_batches = 0;
+    for (auto maybe_batch : Batches(fragment)) {
+      ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      actual_rows += batch->num_rows();
+      ++actual_batches;
+    }
+    EXPECT_EQ(actual_rows, expected_rows);
+    EXPECT_EQ(actual_batches, expected_batches);
+  }
+
+ protected:
+  std::unique_ptr<FileSource> source_;
+  std::shared_ptr<OrcFileFormat> format_ = std::make_shared<OrcFileFormat>();
+  std::shared_ptr<ScanOptions> opts_;
+  std::shared_ptr<ScanContext> ctx_ = std::make_shared<ScanContext>();
+  std::shared_ptr<Schema> schema_ =
+      schema({field("i32", int32()), field("f64", float64())});
+};
+
+TEST_F(TestOrcFileFormat, IsSupportedAndInspect) {
+  ASSERT_OK_AND_EQ(true, format_->IsSupported(*source_));
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(*source_));
+  AssertSchemaEqual(*schema_, *actual, /*check_metadata=*/false);
+
+  FileSource not_orc(Buffer::FromString("not an ORC file"));
+  ASSERT_OK_AND_EQ(false, format_->IsSupported(not_orc));
+  ASSERT_RAISES(IOError, format_->Inspect(not_orc));
+}
+
+TEST_F(TestOrcFileFormat, ScanStripes) {
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source_));
+
+  int64_t row = 0;
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+    ASSERT_EQ(batch->num_rows(), kStripeRowCount);
+    ASSERT_OK(batch->ValidateFull());
+    const auto& i32 = checked_cast<const Int32Array&>(*batch->GetColumnByName("i32"));
+    ASSERT_EQ(i32.Value(0), row);
+    row += batch->num_rows();
+  }
+  ASSERT_EQ(row, kNumRows);
+}
+
+TEST_F(TestOrcFileFormat, ScanProjected) {
+  // Only the materialized fields are decoded
+  opts_ = ScanOptions::Make(schema({field("f64", float64()), field("virtual", utf8())}));
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source_));
+
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+    AssertSchemaEqual(*schema({field("f64", float64())}), *batch->schema(),
+                      /*check_metadata=*/false);
+  }
+
+  opts_->filter = ("i32"_ == int32_t(0)).Copy();
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+    AssertSchemaEqual(*schema_, *batch->schema(), /*check_metadata=*/false);
+  }
+}
+
+TEST_F(TestOrcFileFormat, PredicatePushdown) {
+  // The fragment is scanned directly, so rows are not filtered: the rows and
+  // batches returned are those of the row groups and stripes which may satisfy
+  // the filter.
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source_));
+
+  opts_->filter = scalar(true);
+  CountRowsAndBatchesInScan(fragment.get(), kNumRows, kStripeCount);
+
+  // Whole stripes
+  opts_->filter = ("i32"_ >= int32_t(10000)).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), 10000, 2);
+
+  // Row groups within stripes
+  opts_->filter = ("i32"_ >= int32_t(17500)).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), 3000, 1);
+  opts_->filter = ("i32"_ == int32_t(4500) or "i32"_ == int32_t(5500)).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), 2000, 2);
+  opts_->filter = ("f64"_ < 250.0).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), 1000, 1);
+
+  // Nothing
+  opts_->filter = scalar(false);
+  CountRowsAndBatchesInScan(fragment.get(), 0, 0);
+  opts_->filter = ("i32"_ < int32_t(0)).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), 0, 0);
+  opts_->filter = ("i32"_ < int32_t(1000) and "f64"_ > 1000.0).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), 0, 0);
+
+  // Fields absent from the file can't prune anything
+  opts_->filter = ("virtual"_ == "x").Copy();
+  CountRowsAndBatchesInScan(fragment.get(), kNumRows, kStripeCount);
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -17,16 +17,20 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/array_base.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/datum.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/scalar.h"
 #include "arrow/table.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
@@ -35,7 +39,9 @@
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/file_reader.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
 
@@ -50,19 +56,42 @@ using parquet::arrow::SchemaField;
 using parquet::arrow::SchemaManifest;
 using parquet::arrow::StatisticsAsScalars;
 
+/// \brief The projected columns of a parquet file, split for late materialization.
+///
+/// The columns referenced by the filter are read and the filter is evaluated first. The
+/// remaining columns are read only if some row of the RowGroup satisfies the filter, and
+/// only the matching rows are retained.
+struct LateMaterialization {
+  /// The filter, simplified with the fragment's partition expression
+  std::shared_ptr<Expression> filter;
+
+  /// Leaf column indices of the fields referenced by the filter, and of the others
+  std::vector<int> filter_columns, other_columns;
+
+  /// For each projected field in the order of the file's schema, whether it is
+  /// referenced by the filter
+  std::vector<bool> is_filter_field;
+};
+
 /// \brief A ScanTask backed by a parquet file and a RowGroup within a parquet file.
 class ParquetScanTask : public ScanTask {
  public:
   ParquetScanTask(RowGroupInfo row_group, std::vector<int> column_projection,
+                  std::shared_ptr<LateMaterialization> late_materialization,
                   std::shared_ptr<parquet::arrow::FileReader> reader,
                   std::shared_ptr<ScanOptions> options,
                   std::shared_ptr<ScanContext> context)
       : ScanTask(std::move(options), std::move(context)),
         row_group_(std::move(row_group)),
         column_projection_(std::move(column_projection)),
+        late_materialization_(std::move(late_materialization)),
         reader_(std::move(reader)) {}
 
   Result<RecordBatchIterator> Execute() override {
+    if (late_materialization_ != nullptr) {
+      return ExecuteLateMaterialized();
+    }
+
     // The construction of parquet's RecordBatchReader is deferred here to
     // control the memory usage of consumers who materialize all ScanTasks
     // before dispatching them, e.g. for scheduling purposes.
@@ -76,8 +105,106 @@ class ParquetScanTask : public ScanTask {
   }
 
  private:
+  // State of a late materialized scan after the filter has been evaluated
+  struct Materializer {
+    Result<std::shared_ptr<RecordBatch>> Next() {
+      while (index < filtered.size()) {
+        std::shared_ptr<RecordBatch> other;
+        RETURN_NOT_OK(other_reader->ReadNext(&other));
+        if (other == nullptr || other->num_rows() != lengths[index]) {
+          return Status::Invalid("Batches read from the filter columns of RowGroup ",
+                                 row_group, " did not align with the other columns");
+        }
+
+        auto filter_batch = std::move(filtered[index]);
+        const Datum& selection = selections[index++];
+        if (filter_batch->num_rows() == 0) {
+          // Nothing to retain
+          continue;
+        }
+        if (filter_batch->num_rows() != other->num_rows()) {
+          ARROW_ASSIGN_OR_RAISE(other, evaluator->Filter(selection, other, pool));
+        }
+        return Merge(*filter_batch, *other);
+      }
+      return nullptr;
+    }
+
+    // Interleave the columns of both batches in the order of the file's schema
+    std::shared_ptr<RecordBatch> Merge(const RecordBatch& filter_batch,
+                                       const RecordBatch& other) {
+      FieldVector fields;
+      ArrayVector columns;
+      int filter_i = 0, other_i = 0;
+      for (bool is_filter_field : late_materialization->is_filter_field) {
+        const RecordBatch& source = is_filter_field ? filter_batch : other;
+        int i = is_filter_field ? filter_i++ : other_i++;
+        fields.push_back(source.schema()->field(i));
+        columns.push_back(source.column(i));
+      }
+      return RecordBatch::Make(schema(std::move(fields)), other.num_rows(),
+                               std::move(columns));
+    }
+
+    int row_group;
+    std::shared_ptr<LateMaterialization> late_materialization;
+    std::shared_ptr<ExpressionEvaluator> evaluator;
+    MemoryPool* pool;
+    std::shared_ptr<parquet::arrow::FileReader> reader;
+    std::unique_ptr<RecordBatchReader> other_reader;
+
+    // For each batch of the RowGroup, its length, the filter's result and the filter
+    // columns' matching rows
+    std::vector<int64_t> lengths;
+    std::vector<Datum> selections;
+    RecordBatchVector filtered;
+    size_t index = 0;
+  };
+
+  Result<RecordBatchIterator> ExecuteLateMaterialized() {
+    auto materializer = std::make_shared<Materializer>();
+    materializer->row_group = row_group_.id();
+    materializer->late_materialization = late_materialization_;
+    materializer->evaluator = options_->evaluator;
+    materializer->pool = context_->pool;
+    materializer->reader = reader_;
+
+    std::unique_ptr<RecordBatchReader> filter_reader;
+    RETURN_NOT_OK(reader_->GetRecordBatchReader(
+        {row_group_.id()}, late_materialization_->filter_columns, &filter_reader));
+
+    int64_t num_matching = 0;
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(filter_reader->ReadNext(&batch));
+      if (batch == nullptr) break;
+
+      ARROW_ASSIGN_OR_RAISE(auto selection,
+                            options_->evaluator->Evaluate(*late_materialization_->filter,
+                                                          *batch, context_->pool));
+      ARROW_ASSIGN_OR_RAISE(
+          auto filtered, options_->evaluator->Filter(selection, batch, context_->pool));
+      num_matching += filtered->num_rows();
+
+      materializer->lengths.push_back(batch->num_rows());
+      materializer->selections.push_back(std::move(selection));
+      materializer->filtered.push_back(std::move(filtered));
+    }
+
+    if (num_matching == 0) {
+      // No row of this RowGroup satisfies the filter; skip reading the other columns
+      return MakeEmptyIterator<std::shared_ptr<RecordBatch>>();
+    }
+
+    RETURN_NOT_OK(reader_->GetRecordBatchReader({row_group_.id()},
+                                                late_materialization_->other_columns,
+                                                &materializer->other_reader));
+    return MakeFunctionIterator([materializer] { return materializer->Next(); });
+  }
+
   RowGroupInfo row_group_;
   std::vector<int> column_projection_;
+  std::shared_ptr<LateMaterialization> late_materialization_;
   // The ScanTask _must_ hold a reference to reader_ because there's no
   // guarantee the producing ParquetScanTaskIterator is still alive. This is a
   // contract required by record_batch_reader_
@@ -85,10 +212,12 @@ class ParquetScanTask : public ScanTask {
 };
 
 static Result<std::unique_ptr<parquet::ParquetFileReader>> OpenReader(
-    const FileSource& source, parquet::ReaderProperties properties) {
+    const FileSource& source, parquet::ReaderProperties properties,
+    std::shared_ptr<parquet::FileMetaData> metadata = NULLPTR) {
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
   try {
-    return parquet::ParquetFileReader::Open(std::move(input), std::move(properties));
+    return parquet::ParquetFileReader::Open(std::move(input), std::move(properties),
+                                            std::move(metadata));
   } catch (const ::parquet::ParquetException& e) {
     return Status::IOError("Could not open parquet input source '", source.path(),
                            "': ", e.what());
@@ -204,11 +333,21 @@ class ParquetScanTaskIterator {
                                        std::shared_ptr<ScanContext> context,
                                        FileSource source,
                                        std::unique_ptr<parquet::arrow::FileReader> reader,
-                                       std::vector<RowGroupInfo> row_groups) {
+                                       std::vector<RowGroupInfo> row_groups,
+                                       const ParquetFileFormat& format,
+                                       const Expression& partition_expression) {
     auto column_projection = InferColumnProjection(*reader, *options);
+
+    std::shared_ptr<LateMaterialization> late_materialization;
+    if (format.reader_options.late_materialization) {
+      late_materialization =
+          SplitColumnProjection(*reader, *options, partition_expression);
+    }
+
     return static_cast<ScanTaskIterator>(ParquetScanTaskIterator(
         std::move(options), std::move(context), std::move(source), std::move(reader),
-        std::move(column_projection), std::move(row_groups)));
+        std::move(column_projection), std::move(late_materialization),
+        std::move(row_groups)));
   }
 
   Result<std::shared_ptr<ScanTask>> Next() {
@@ -217,8 +356,9 @@ class ParquetScanTaskIterator {
     }
 
     auto row_group = row_groups_[idx_++];
-    return std::shared_ptr<ScanTask>(
-        new ParquetScanTask(row_group, column_projection_, reader_, options_, context_));
+    return std::shared_ptr<ScanTask>(new ParquetScanTask(row_group, column_projection_,
+                                                         late_materialization_, reader_,
+                                                         options_, context_));
   }
 
  private:
@@ -226,13 +366,9 @@ class ParquetScanTaskIterator {
   static std::vector<int> InferColumnProjection(const parquet::arrow::FileReader& reader,
                                                 const ScanOptions& options) {
     auto manifest = reader.manifest();
-    // Checks if the field is needed in either the projection or the filter.
-    auto field_names = options.MaterializedFields();
-    std::unordered_set<std::string> materialized_fields{field_names.cbegin(),
-                                                        field_names.cend()};
-    auto should_materialize_column = [&materialized_fields](const std::string& f) {
-      return materialized_fields.find(f) != materialized_fields.end();
-    };
+    auto filter_names = FieldsInExpression(*options.filter);
+    std::unordered_set<std::string> filter_fields{filter_names.cbegin(),
+                                                  filter_names.cend()};
 
     std::vector<int> columns_selection;
     // Note that the loop is using the file's schema to iterate instead of the
@@ -241,14 +377,90 @@ class ParquetScanTaskIterator {
     // scanner's projector will take care of padding the column with the proper
     // values.
     for (const auto& schema_field : manifest.schema_fields) {
-      if (should_materialize_column(schema_field.field->name())) {
-        AddColumnIndices(schema_field, &columns_selection);
-      }
+      AddMaterializedColumnIndices(schema_field, options, filter_fields,
+                                   &columns_selection);
     }
 
     return columns_selection;
   }
 
+  // Add the leaf column indices of a top-level field needed in either the projection or
+  // the filter. The filter is evaluated against whole columns, but only the projected
+  // children of struct columns are needed otherwise.
+  static void AddMaterializedColumnIndices(
+      const SchemaField& schema_field, const ScanOptions& options,
+      const std::unordered_set<std::string>& filter_fields,
+      std::vector<int>* column_projection) {
+    const auto& name = schema_field.field->name();
+    if (filter_fields.find(name) != filter_fields.end()) {
+      AddColumnIndices(schema_field, column_projection);
+      return;
+    }
+
+    auto projected = options.schema()->GetAllFieldsByName(name);
+    if (projected.size() == 1) {
+      AddProjectedColumnIndices(schema_field, *projected[0]->type(), column_projection);
+    } else if (!projected.empty()) {
+      AddColumnIndices(schema_field, column_projection);
+    }
+  }
+
+  // Add the leaf column indices of the children of a field which are retained by the
+  // projected type.
+  static void AddProjectedColumnIndices(const SchemaField& schema_field,
+                                        const DataType& projected_type,
+                                        std::vector<int>* column_projection) {
+    if (schema_field.is_leaf() || schema_field.field->type()->id() != Type::STRUCT ||
+        projected_type.id() != Type::STRUCT ||
+        schema_field.field->type()->Equals(projected_type)) {
+      AddColumnIndices(schema_field, column_projection);
+      return;
+    }
+
+    const auto& projected_struct = checked_cast<const StructType&>(projected_type);
+    for (const auto& child : schema_field.children) {
+      if (auto projected_child = projected_struct.GetFieldByName(child.field->name())) {
+        AddProjectedColumnIndices(child, *projected_child->type(), column_projection);
+      }
+    }
+  }
+
+  // Split the column projection into the columns referenced by the filter and the
+  // others, or return null if late materialization wouldn't skip anything.
+  static std::shared_ptr<LateMaterialization> SplitColumnProjection(
+      const parquet::arrow::FileReader& reader, const ScanOptions& options,
+      const Expression& partition_expression) {
+    auto filter = options.filter->Assume(partition_expression);
+    if (filter->Equals(true)) {
+      return nullptr;
+    }
+
+    auto filter_names = FieldsInExpression(*filter);
+    std::unordered_set<std::string> filter_fields{filter_names.cbegin(),
+                                                  filter_names.cend()};
+
+    auto late_materialization = std::make_shared<LateMaterialization>();
+    late_materialization->filter = std::move(filter);
+    for (const auto& schema_field : reader.manifest().schema_fields) {
+      bool is_filter_field =
+          filter_fields.find(schema_field.field->name()) != filter_fields.end();
+      auto* columns = is_filter_field ? &late_materialization->filter_columns
+                                      : &late_materialization->other_columns;
+
+      auto num_columns = columns->size();
+      AddMaterializedColumnIndices(schema_field, options, filter_fields, columns);
+      if (columns->size() != num_columns) {
+        late_materialization->is_filter_field.push_back(is_filter_field);
+      }
+    }
+
+    if (late_materialization->filter_columns.empty() ||
+        late_materialization->other_columns.empty()) {
+      return nullptr;
+    }
+    return late_materialization;
+  }
+
   static void AddColumnIndices(const SchemaField& schema_field,
                                std::vector<int>* column_projection) {
     if (schema_field.is_leaf()) {
@@ -265,12 +477,14 @@ class ParquetScanTaskIterator {
                           std::shared_ptr<ScanContext> context, FileSource source,
                           std::unique_ptr<parquet::arrow::FileReader> reader,
                           std::vector<int> column_projection,
+                          std::shared_ptr<LateMaterialization> late_materialization,
                           std::vector<RowGroupInfo> row_groups)
       : options_(std::move(options)),
         context_(std::move(context)),
         source_(std::move(source)),
         reader_(std::move(reader)),
         column_projection_(std::move(column_projection)),
+        late_materialization_(std::move(late_materialization)),
         row_groups_(std::move(row_groups)) {}
 
   std::shared_ptr<ScanOptions> options_;
@@ -280,6 +494,7 @@ class ParquetScanTaskIterator {
   std::shared_ptr<parquet::arrow::FileReader> reader_;
 
   std::vector<int> column_projection_;
+  std::shared_ptr<LateMaterialization> late_materialization_;
   std::vector<RowGroupInfo> row_groups_;
 
   // row group index.
@@ -296,7 +511,8 @@ bool ParquetFileFormat::Equals(const FileFormat& other) const {
   // FIXME extract these to scan time options so comparison is unnecessary
   return reader_options.use_buffered_stream == other_reader_options.use_buffered_stream &&
          reader_options.buffer_size == other_reader_options.buffer_size &&
-         reader_options.dict_columns == other_reader_options.dict_columns;
+         reader_options.dict_columns == other_reader_options.dict_columns &&
+         reader_options.late_materialization == other_reader_options.late_materialization;
 }
 
 ParquetFileFormat::ParquetFileFormat(const parquet::ReaderProperties& reader_properties) {
@@ -333,12 +549,14 @@ Result<std::shared_ptr<Schema>> ParquetFileFormat::Inspect(
 }
 
 Result<std::unique_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader(
-    const FileSource& source, ScanOptions* options, ScanContext* context) const {
+    const FileSource& source, ScanOptions* options, ScanContext* context,
+    std::shared_ptr<parquet::FileMetaData> metadata) const {
   MemoryPool* pool = context ? context->pool : default_memory_pool();
   auto properties = MakeReaderProperties(*this, pool);
-  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, std::move(properties)));
+  ARROW_ASSIGN_OR_RAISE(auto reader,
+                        OpenReader(source, std::move(properties), std::move(metadata)));
 
-  std::shared_ptr<parquet::FileMetaData> metadata = reader->metadata();
+  metadata = reader->metadata();
   auto arrow_properties = MakeArrowReaderProperties(*this, *metadata);
 
   if (options) {
@@ -361,6 +579,269 @@ static inline bool RowGroupInfosAreComplete(const std::vector<RowGroupInfo>& inf
                      [](const RowGroupInfo& i) { return i.HasStatistics(); });
 }
 
+/// Values which a field must equal for a row to satisfy the filter
+using BloomFilterPredicate = std::pair<std::string, ScalarVector>;
+
+/// Collect the equality and IN conjuncts of a filter which compare a field to literals
+static Status CollectBloomFilterPredicates(const Expression& expr,
+                                           std::vector<BloomFilterPredicate>* out) {
+  switch (expr.type()) {
+    case ExpressionType::AND: {
+      const auto& and_ = checked_cast<const AndExpression&>(expr);
+      RETURN_NOT_OK(CollectBloomFilterPredicates(*and_.left_operand(), out));
+      return CollectBloomFilterPredicates(*and_.right_operand(), out);
+    }
+    case ExpressionType::COMPARISON: {
+      const auto& cmp = checked_cast<const ComparisonExpression&>(expr);
+      if (cmp.op() != CompareOperator::EQUAL) break;
+      const Expression* field = cmp.left_operand().get();
+      const Expression* value = cmp.right_operand().get();
+      if (field->type() != ExpressionType::FIELD) std::swap(field, value);
+      if (field->type() != ExpressionType::FIELD ||
+          value->type() != ExpressionType::SCALAR) {
+        break;
+      }
+      const auto& scalar = checked_cast<const ScalarExpression&>(*value).value();
+      if (!scalar->is_valid) break;
+      out->emplace_back(checked_cast<const FieldExpression&>(*field).name(),
+                        ScalarVector{scalar});
+      break;
+    }
+    case ExpressionType::IN: {
+      const auto& in = checked_cast<const InExpression&>(expr);
+      if (in.operand()->type() != ExpressionType::FIELD) break;
+      ScalarVector values;
+      for (int64_t i = 0; i < in.set()->length(); ++i) {
+        if (in.set()->IsNull(i)) continue;
+        ARROW_ASSIGN_OR_RAISE(auto value, in.set()->GetScalar(i));
+        values.push_back(std::move(value));
+      }
+      out->emplace_back(checked_cast<const FieldExpression&>(*in.operand()).name(),
+                        std::move(values));
+      break;
+    }
+    default:
+      break;
+  }
+  return Status::OK();
+}
+
+/// Hash a literal as the parquet writer hashes values of a column, or return false if
+/// the literal's representation in the column is not known.
+static bool HashForBloomFilter(const Scalar& value, parquet::Type::type physical_type,
+                               const parquet::BloomFilter& bloom_filter,
+                               uint64_t* out) {
+  switch (value.type->id()) {
+    case Type::INT8:
+      if (physical_type != parquet::Type::INT32) return false;
+      *out = bloom_filter.Hash(
+          static_cast<int32_t>(checked_cast<const Int8Scalar&>(value).value));
+      return true;
+    case Type::INT16:
+      if (physical_type != parquet::Type::INT32) return false;
+      *out = bloom_filter.Hash(
+          static_cast<int32_t>(checked_cast<const Int16Scalar&>(value).value));
+      return true;
+    case Type::INT32:
+      if (physical_type != parquet::Type::INT32) return false;
+      *out = bloom_filter.Hash(checked_cast<const Int32Scalar&>(value).value);
+      return true;
+    case Type::DATE32:
+      if (physical_type != parquet::Type::INT32) return false;
+      *out = bloom_filter.Hash(checked_cast<const Date32Scalar&>(value).value);
+      return true;
+    case Type::INT64:
+      if (physical_type != parquet::Type::INT64) return false;
+      *out = bloom_filter.Hash(checked_cast<const Int64Scalar&>(value).value);
+      return true;
+    case Type::FLOAT: {
+      // -0.0 equals 0.0 but hashes differently
+      float float_value = checked_cast<const FloatScalar&>(value).value;
+      if (physical_type != parquet::Type::FLOAT || float_value == 0) return false;
+      *out = bloom_filter.Hash(float_value);
+      return true;
+    }
+    case Type::DOUBLE: {
+      double double_value = checked_cast<const DoubleScalar&>(value).value;
+      if (physical_type != parquet::Type::DOUBLE || double_value == 0) return false;
+      *out = bloom_filter.Hash(double_value);
+      return true;
+    }
+    case Type::STRING:
+    case Type::BINARY: {
+      if (physical_type != parquet::Type::BYTE_ARRAY) return false;
+      const auto& buffer = checked_cast<const BaseBinaryScalar&>(value).value;
+      parquet::ByteArray byte_array(static_cast<uint32_t>(buffer->size()),
+                                    buffer->data());
+      *out = bloom_filter.Hash(&byte_array);
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+/// Exclude the RowGroups whose Bloom filters contain none of the values which some
+/// top-level field must equal to satisfy the filter.
+static Result<std::vector<RowGroupInfo>> FilterRowGroupsByBloomFilters(
+    parquet::arrow::FileReader* reader, const Expression& filter,
+    std::vector<RowGroupInfo> row_groups) {
+  std::vector<BloomFilterPredicate> predicates;
+  RETURN_NOT_OK(CollectBloomFilterPredicates(filter, &predicates));
+  if (predicates.empty()) return row_groups;
+
+  // resolve each predicate to the leaf column of a top-level primitive field
+  const auto& manifest = reader->manifest();
+  std::vector<std::pair<int, const ScalarVector*>> columns;
+  for (const auto& predicate : predicates) {
+    const SchemaField* match = nullptr;
+    int num_matches = 0;
+    for (const auto& schema_field : manifest.schema_fields) {
+      if (schema_field.field->name() != predicate.first) continue;
+      match = &schema_field;
+      ++num_matches;
+    }
+    if (num_matches != 1 || !match->is_leaf()) continue;
+    // the literals must have the field's type, or the hashes need not agree
+    bool same_type = std::all_of(
+        predicate.second.begin(), predicate.second.end(),
+        [&](const std::shared_ptr<Scalar>& value) {
+          return value->type->Equals(*match->field->type());
+        });
+    if (!same_type) continue;
+    columns.emplace_back(match->column_index, &predicate.second);
+  }
+  if (columns.empty()) return row_groups;
+
+  std::vector<RowGroupInfo> filtered;
+  auto parquet_reader = reader->parquet_reader();
+  try {
+    for (auto& row_group : row_groups) {
+      auto row_group_reader = parquet_reader->RowGroup(row_group.id());
+      bool excluded = false;
+      for (const auto& column : columns) {
+        auto bloom_filter = row_group_reader->GetColumnBloomFilter(column.first);
+        if (bloom_filter == nullptr) continue;
+        auto physical_type =
+            row_group_reader->metadata()->schema()->Column(column.first)->physical_type();
+        excluded = std::none_of(column.second->begin(), column.second->end(),
+                                [&](const std::shared_ptr<Scalar>& value) {
+                                  uint64_t hash;
+                                  return !HashForBloomFilter(*value, physical_type,
+                                                             *bloom_filter, &hash) ||
+                                         bloom_filter->FindHash(hash);
+                                });
+        if (excluded) break;
+      }
+      if (!excluded) filtered.push_back(std::move(row_group));
+    }
+  } catch (const ::parquet::ParquetException& e) {
+    return Status::IOError("Could not read parquet Bloom filter: ", e.what());
+  }
+  return filtered;
+}
+
+/// The expression which the values of a page described by a ColumnIndex satisfy, or
+/// nullptr if it can't be derived.
+static std::shared_ptr<Expression> PageStatisticsAsExpression(
+    const SchemaField& schema_field, const parquet::ColumnIndex& column_index, int page) {
+  const auto& field = schema_field.field;
+  auto field_expr = field_ref(field->name());
+  if (column_index.null_pages()[page]) {
+    return equal(std::move(field_expr), scalar(MakeNullScalar(field->type())));
+  }
+
+  std::shared_ptr<Scalar> min, max;
+  if (!StatisticsAsScalars(*column_index.page_statistics(page), &min, &max).ok()) {
+    return nullptr;
+  }
+  auto maybe_min = min->CastTo(field->type());
+  auto maybe_max = max->CastTo(field->type());
+  if (!maybe_min.ok() || !maybe_max.ok()) {
+    return nullptr;
+  }
+  return and_(greater_equal(field_expr, scalar(maybe_min.MoveValueUnsafe())),
+              less_equal(field_expr, scalar(maybe_max.MoveValueUnsafe())));
+}
+
+/// A sorted list of disjoint [begin, end) ranges of rows
+using RowRanges = std::vector<std::pair<int64_t, int64_t>>;
+
+static RowRanges IntersectRowRanges(const RowRanges& left, const RowRanges& right) {
+  RowRanges out;
+  auto l = left.begin();
+  auto r = right.begin();
+  while (l != left.end() && r != right.end()) {
+    int64_t begin = std::max(l->first, r->first);
+    int64_t end = std::min(l->second, r->second);
+    if (begin < end) out.emplace_back(begin, end);
+    if (l->second < r->second) {
+      ++l;
+    } else {
+      ++r;
+    }
+  }
+  return out;
+}
+
+/// Exclude the RowGroups in which, according to the page indexes of the top-level fields
+/// referenced by the filter, no row is in a page of each of those fields which may
+/// satisfy the filter.
+static Result<std::vector<RowGroupInfo>> FilterRowGroupsByPageIndexes(
+    parquet::arrow::FileReader* reader, const Expression& filter,
+    std::vector<RowGroupInfo> row_groups) {
+  const auto& manifest = reader->manifest();
+  std::vector<const SchemaField*> fields;
+  for (const auto& name : FieldsInExpression(filter)) {
+    for (const auto& schema_field : manifest.schema_fields) {
+      if (schema_field.field->name() == name && schema_field.is_leaf()) {
+        fields.push_back(&schema_field);
+        break;
+      }
+    }
+  }
+  if (fields.empty()) return row_groups;
+
+  std::vector<RowGroupInfo> filtered;
+  auto parquet_reader = reader->parquet_reader();
+  try {
+    for (auto& row_group : row_groups) {
+      auto row_group_reader = parquet_reader->RowGroup(row_group.id());
+      const int64_t num_rows = row_group_reader->metadata()->num_rows();
+      RowRanges candidates = {{0, num_rows}};
+      for (const SchemaField* schema_field : fields) {
+        auto column_index = row_group_reader->GetColumnIndex(schema_field->column_index);
+        if (column_index == nullptr) continue;
+        auto offset_index = row_group_reader->GetOffsetIndex(schema_field->column_index);
+        if (offset_index == nullptr ||
+            offset_index->num_pages() != column_index->num_pages()) {
+          continue;
+        }
+
+        RowRanges column_candidates;
+        for (int page = 0; page < column_index->num_pages(); ++page) {
+          auto page_expr = PageStatisticsAsExpression(*schema_field, *column_index, page);
+          if (page_expr != nullptr && !filter.IsSatisfiableWith(*page_expr)) continue;
+
+          int64_t begin = offset_index->page_locations()[page].first_row_index;
+          int64_t end = begin + offset_index->page_num_rows(page, num_rows);
+          if (!column_candidates.empty() && column_candidates.back().second == begin) {
+            column_candidates.back().second = end;
+          } else {
+            column_candidates.emplace_back(begin, end);
+          }
+        }
+        candidates = IntersectRowRanges(candidates, column_candidates);
+        if (candidates.empty()) break;
+      }
+      if (!candidates.empty()) filtered.push_back(std::move(row_group));
+    }
+  } catch (const ::parquet::ParquetException& e) {
+    return Status::IOError("Could not read parquet page index: ", e.what());
+  }
+  return filtered;
+}
+
 Result<ScanTaskIterator> ParquetFileFormat::ScanFile(std::shared_ptr<ScanOptions> options,
                                                      std::shared_ptr<ScanContext> context,
                                                      FileFragment* fragment) const {
@@ -379,9 +860,12 @@ Result<ScanTaskIterator> ParquetFileFormat::ScanFile(std::shared_ptr<ScanOptions
     }
   }
 
-  // Open the reader and pay the real IO cost.
+  // Open the reader and pay the real IO cost. The footer is only parsed by the first
+  // scan of the fragment; later scans reuse its metadata.
   ARROW_ASSIGN_OR_RAISE(auto reader,
-                        GetReader(fragment->source(), options.get(), context.get()));
+                        GetReader(fragment->source(), options.get(), context.get(),
+                                  parquet_fragment->metadata()));
+  parquet_fragment->SetMetadata(reader->parquet_reader()->metadata());
 
   if (!parquet_fragment->HasCompleteMetadata()) {
     // row groups were not already filtered; do this now (if there is a filter)
@@ -402,9 +886,22 @@ Result<ScanTaskIterator> ParquetFileFormat::ScanFile(std::shared_ptr<ScanOptions
     }
   }
 
+  if (!options->filter->Equals(true)) {
+    ARROW_ASSIGN_OR_RAISE(row_groups, FilterRowGroupsByBloomFilters(
+                                          reader.get(), *options->filter,
+                                          std::move(row_groups)));
+    ARROW_ASSIGN_OR_RAISE(row_groups, FilterRowGroupsByPageIndexes(
+                                          reader.get(), *options->filter,
+                                          std::move(row_groups)));
+    if (row_groups.empty()) {
+      return MakeEmptyIterator<std::shared_ptr<ScanTask>>();
+    }
+  }
+
   return ParquetScanTaskIterator::Make(std::move(options), std::move(context),
                                        fragment->source(), std::move(reader),
-                                       std::move(row_groups));
+                                       std::move(row_groups), *this,
+                                       *fragment->partition_expression());
 }
 
 Result<std::shared_ptr<FileFragment>> ParquetFileFormat::MakeFragment(
@@ -561,11 +1058,25 @@ const std::vector<RowGroupInfo>* ParquetFileFragment::row_groups() {
   return &row_groups_;
 }
 
+std::shared_ptr<parquet::FileMetaData> ParquetFileFragment::metadata() {
+  auto lock = physical_schema_mutex_.Lock();
+  return metadata_;
+}
+
+void ParquetFileFragment::SetMetadata(std::shared_ptr<parquet::FileMetaData> metadata) {
+  auto lock = physical_schema_mutex_.Lock();
+  if (metadata_ == nullptr) {
+    metadata_ = std::move(metadata);
+  }
+}
+
 Result<int> ParquetFileFragment::GetNumRowGroups() {
   auto lock = physical_schema_mutex_.Lock();
   if (num_row_groups_ == -1) {
-    ARROW_ASSIGN_OR_RAISE(auto reader, parquet_format_.GetReader(source_));
+    ARROW_ASSIGN_OR_RAISE(auto reader, parquet_format_.GetReader(source_, NULLPTR,
+                                                                 NULLPTR, metadata_));
     SetNumRowGroups(reader->num_row_groups());
+    metadata_ = reader->parquet_reader()->metadata();
   }
   return num_row_groups_;
 }
@@ -576,7 +1087,8 @@ Status ParquetFileFragment::EnsureCompleteMetadata(parquet::arrow::FileReader* r
   }
 
   if (reader == nullptr) {
-    ARROW_ASSIGN_OR_RAISE(auto reader, parquet_format_.GetReader(source_));
+    ARROW_ASSIGN_OR_RAISE(
+        auto reader, parquet_format_.GetReader(source_, NULLPTR, NULLPTR, metadata()));
     return EnsureCompleteMetadata(reader.get());
   }
 
@@ -593,6 +1105,9 @@ Status ParquetFileFragment::EnsureCompleteMetadata(parquet::arrow::FileReader* r
                            *schema);
   }
   physical_schema_ = std::move(schema);
+  if (metadata_ == nullptr) {
+    metadata_ = reader->parquet_reader()->metadata();
+  }
 
   if (num_row_groups_ == -1) {
     SetNumRowGroups(reader->num_row_groups());
@@ -640,6 +1155,51 @@ Result<FragmentVector> ParquetFileFragment::SplitByRowGroup(
   return fragments;
 }
 
+Result<int64_t> ParquetFileFragment::CountRows() {
+  if (num_rows_ >= 0) {
+    return num_rows_;
+  }
+  RETURN_NOT_OK(EnsureCompleteMetadata());
+  int64_t num_rows = 0;
+  for (const auto& info : row_groups_) {
+    if (info.num_rows() < 0) {
+      return -1;
+    }
+    num_rows += info.num_rows();
+  }
+  return num_rows;
+}
+
+Result<std::string> ParquetFileFragment::DescribeSubset() {
+  RETURN_NOT_OK(GetNumRowGroups());
+  auto lock = physical_schema_mutex_.Lock();
+  std::string description = "row_groups=";
+  for (size_t i = 0; i < row_groups_.size(); ++i) {
+    if (i > 0) description += ",";
+    description += std::to_string(row_groups_[i].id());
+  }
+  return description;
+}
+
+Result<std::shared_ptr<FileFragment>> ParquetFileFragment::ReplaceSource(
+    FileSource source) {
+  auto lock = physical_schema_mutex_.Lock();
+  std::shared_ptr<FileFragment> fragment;
+  if (num_row_groups_ == -1) {
+    ARROW_ASSIGN_OR_RAISE(fragment,
+                          parquet_format_.MakeFragment(std::move(source),
+                                                       partition_expression_,
+                                                       physical_schema_));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(fragment,
+                          parquet_format_.MakeFragment(std::move(source),
+                                                       partition_expression_,
+                                                       row_groups_, physical_schema_));
+  }
+  fragment->SetStatistics(statistics_);
+  return fragment;
+}
+
 Result<std::shared_ptr<Fragment>> ParquetFileFragment::Subset(
     const std::shared_ptr<Expression>& predicate) {
   RETURN_NOT_OK(EnsureCompleteMetadata());
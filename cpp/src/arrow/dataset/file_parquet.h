@@ -101,6 +101,13 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
     /// option will be removed after support is added for simultaneous parallelization
     /// across files and columns.
     bool enable_parallel_column_conversion = false;
+
+    /// If true, RowGroups of a filtered scan are read in two phases. First only the
+    /// columns referenced by the filter are read and the filter is evaluated. The
+    /// remaining columns are then read only for RowGroups containing matching rows, and
+    /// only matching rows are retained. This saves IO and decoding for selective filters
+    /// on wide files.
+    bool late_materialization = false;
   } reader_options;
 
   Result<bool> IsSupported(const FileSource& source) const override;
@@ -127,8 +134,11 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
       std::shared_ptr<Schema> physical_schema) override;
 
   /// \brief Return a FileReader on the given source.
+  /// \brief Open a reader for a file. If `metadata` is provided it must have been read
+  /// from the same file, whose footer is then not parsed again.
   Result<std::unique_ptr<parquet::arrow::FileReader>> GetReader(
-      const FileSource& source, ScanOptions* = NULLPTR, ScanContext* = NULLPTR) const;
+      const FileSource& source, ScanOptions* = NULLPTR, ScanContext* = NULLPTR,
+      std::shared_ptr<parquet::FileMetaData> metadata = NULLPTR) const;
 
   Result<std::shared_ptr<FileWriter>> MakeWriter(
       std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
@@ -222,6 +232,14 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   /// \brief Return the number of row groups selected by this fragment.
   Result<int> GetNumRowGroups();
 
+  /// \brief Return the number of rows of the selected RowGroups, reading the file's
+  /// metadata if it wasn't provided.
+  Result<int64_t> CountRows() override;
+
+  /// \brief Return the metadata parsed from the footer of this fragment's file, or
+  /// nullptr if the file was not opened yet. Scans of the fragment reuse it.
+  std::shared_ptr<parquet::FileMetaData> metadata();
+
   /// \brief Indicate if the attached statistics are complete and the physical schema
   /// is cached.
   ///
@@ -236,6 +254,12 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   Result<std::shared_ptr<Fragment>> Subset(const std::shared_ptr<Expression>& predicate);
   Result<std::shared_ptr<Fragment>> Subset(const std::vector<int> row_group_ids);
 
+  Result<std::shared_ptr<FileFragment>> ReplaceSource(FileSource source) override;
+
+  /// \brief Describe the selected RowGroups, e.g. "row_groups=0,2". The number of
+  /// RowGroups is read from the file if it isn't known yet.
+  Result<std::string> DescribeSubset() override;
+
  private:
   ParquetFileFragment(FileSource source, std::shared_ptr<FileFormat> format,
                       std::shared_ptr<Expression> partition_expression,
@@ -256,11 +280,13 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   Result<std::vector<RowGroupInfo>> FilterRowGroups(const Expression& predicate);
 
   void SetNumRowGroups(int);
+  void SetMetadata(std::shared_ptr<parquet::FileMetaData> metadata);
 
   std::vector<RowGroupInfo> row_groups_;
   ParquetFileFormat& parquet_format_;
   bool has_complete_metadata_ = false;
   int num_row_groups_ = -1;
+  std::shared_ptr<parquet::FileMetaData> metadata_;
 
   friend class ParquetFileFormat;
 };
@@ -298,6 +298,34 @@ TEST_F(TestParquetFileFormat, ScanRecordBatchReaderProjected) {
   ASSERT_EQ(row_count, kNumRows);
 }
 
+TEST_F(TestParquetFileFormat, ScanRecordBatchReaderProjectedNested) {
+  auto id = ArrayFromJSON(int64(), "[1, 2, 3]");
+  auto name = ArrayFromJSON(utf8(), R"(["a", "b", null])");
+  auto other = ArrayFromJSON(int32(), "[7, 8, 9]");
+  ASSERT_OK_AND_ASSIGN(auto user,
+                       StructArray::Make(ArrayVector{id, name},
+                                         std::vector<std::string>{"id", "name"}));
+  schema_ = schema({field("user", user->type()), field("other", int32())});
+  auto batch = RecordBatch::Make(schema_, 3, {user, other});
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make({batch}));
+  auto source = GetFileSource(reader.get());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  // Only the projected leaf of "user" is read
+  ASSERT_OK_AND_ASSIGN(
+      auto pruned_user,
+      StructArray::Make(ArrayVector{id}, std::vector<std::string>{"id"}));
+  opts_ = ScanOptions::Make(schema({field("user", pruned_user->type())}));
+  auto expected =
+      RecordBatch::Make(schema({field("user", pruned_user->type())}), 3, {pruned_user});
+  AssertBatchesEqual(*expected, *SingleBatch(fragment.get()));
+
+  // ... unless the filter references the whole column
+  opts_->filter = "user"_.IsValid().Copy();
+  AssertSchemaEqual(*schema({field("user", user->type())}),
+                    *SingleBatch(fragment.get())->schema());
+}
+
 TEST_F(TestParquetFileFormat, ScanRecordBatchReaderProjectedMissingCols) {
   auto reader_without_i32 = GetRecordBatchReader(
       schema({field("f64", float64()), field("i64", int64()), field("f32", float32())}));
@@ -437,6 +465,40 @@ TEST_F(TestParquetFileFormat, PredicatePushdown) {
                             kNumRowGroups - 5);
 }
 
+TEST_F(TestParquetFileFormat, LateMaterialization) {
+  schema_ =
+      schema({field("i32", int32()), field("utf8", utf8()), field("f64", float64())});
+  auto batch = RecordBatch::Make(schema_, 4,
+                                 {ArrayFromJSON(int32(), "[0, 1, 2, 3]"),
+                                  ArrayFromJSON(utf8(), R"(["a", "b", "c", "d"])"),
+                                  ArrayFromJSON(float64(), "[1.0, 2.0, 3.0, 4.0]")});
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make({batch}));
+  auto source = GetFileSource(reader.get());
+
+  format_->reader_options.late_materialization = true;
+  opts_ = ScanOptions::Make(schema_);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  // Only matching rows are materialized, and columns retain the file's order
+  opts_->filter = ("utf8"_ >= "c").Copy();
+  ASSERT_OK_AND_ASSIGN(auto batches, Batches(fragment.get()).ToVector());
+  ASSERT_EQ(batches.size(), 1);
+  AssertBatchesEqual(*batch->Slice(2), *batches[0]);
+
+  opts_->filter = ("f64"_ == 1.5 or "i32"_ == 1).Copy();
+  ASSERT_OK_AND_ASSIGN(batches, Batches(fragment.get()).ToVector());
+  ASSERT_EQ(batches.size(), 1);
+  AssertBatchesEqual(*batch->Slice(1, 1), *batches[0]);
+
+  // Statistics can't exclude the RowGroup, but no row matches
+  opts_->filter = ("f64"_ == 1.5).Copy();
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+
+  // Filter fields which are absent from the file are null
+  opts_->filter = ("f64"_ > 2.5 and "absent"_ == 1).Copy();
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+}
+
 TEST_F(TestParquetFileFormat, PredicatePushdownRowGroupFragments) {
   constexpr int64_t kNumRowGroups = 16;
 
@@ -496,6 +558,85 @@ TEST_F(TestParquetFileFormat, PredicatePushdownRowGroupFragmentsUsingStringColum
   CountRowGroupsInFragment(fragment, {0, 3}, "x"_ == "a");
 }
 
+TEST_F(TestParquetFileFormat, PredicatePushdownUsingBloomFilter) {
+  // statistics cannot exclude a RowGroup since every range spans "b" and "x"
+  auto table = TableFromJSON(schema({field("x", utf8()), field("i32", int32())}),
+                             {
+                                 R"([{"x": "a", "i32": 1}, {"x": "z", "i32": 9}])",
+                                 R"([{"x": "b", "i32": 1}, {"x": "y", "i32": 9}])",
+                                 R"([{"x": "a", "i32": 5}, {"x": "x", "i32": 9}])",
+                             });
+  TableBatchReader reader(*table);
+  auto properties = WriterProperties::Builder()
+                        .enable_bloom_filter("x")
+                        ->enable_bloom_filter("i32")
+                        ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteRecordBatchReader(&reader, default_memory_pool(), sink, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  opts_ = ScanOptions::Make(reader.schema());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+
+  auto CountScanTasks = [&](const Expression& filter) {
+    opts_->filter = filter.Copy();
+    EXPECT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(opts_, ctx_));
+    EXPECT_OK_AND_ASSIGN(auto scan_tasks, scan_task_it.ToVector());
+    return scan_tasks.size();
+  };
+
+  EXPECT_EQ(CountScanTasks(*scalar(true)), 3);
+  EXPECT_EQ(CountScanTasks("x"_ == "b"), 1);
+  EXPECT_EQ(CountScanTasks("x"_ == "c"), 0);
+  EXPECT_EQ(CountScanTasks("i32"_ == int32_t(5)), 1);
+  EXPECT_EQ(CountScanTasks("x"_ == "a" and "i32"_ == int32_t(5)), 1);
+  EXPECT_EQ(CountScanTasks("x"_ == "z" and "i32"_ == int32_t(5)), 0);
+  EXPECT_EQ(CountScanTasks("x"_.In(ArrayFromJSON(utf8(), R"(["y", "z"])"))), 2);
+  // disjunctions are not looked up
+  EXPECT_EQ(CountScanTasks("x"_ == "c" or "x"_ == "q"), 3);
+}
+
+TEST_F(TestParquetFileFormat, PredicatePushdownUsingPageIndex) {
+  // statistics cannot exclude the RowGroup since its ranges span every literal below
+  auto table = TableFromJSON(schema({field("x", int64()), field("y", int64())}),
+                             {
+                                 R"([{"x": 1, "y": 12}, {"x": 2, "y": 11},
+                                     {"x": 3, "y": 10}, {"x": 10, "y": 3},
+                                     {"x": 11, "y": 2}, {"x": 12, "y": 1}])",
+                             });
+  TableBatchReader reader(*table);
+  // write a page per row
+  auto properties = WriterProperties::Builder()
+                        .enable_write_page_index()
+                        ->disable_dictionary()
+                        ->data_pagesize(1)
+                        ->write_batch_size(1)
+                        ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteRecordBatchReader(&reader, default_memory_pool(), sink, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  opts_ = ScanOptions::Make(reader.schema());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+
+  auto CountScanTasks = [&](const Expression& filter) {
+    opts_->filter = filter.Copy();
+    EXPECT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(opts_, ctx_));
+    EXPECT_OK_AND_ASSIGN(auto scan_tasks, scan_task_it.ToVector());
+    return scan_tasks.size();
+  };
+
+  EXPECT_EQ(CountScanTasks(*scalar(true)), 1);
+  EXPECT_EQ(CountScanTasks("x"_ == int64_t(11)), 1);
+  EXPECT_EQ(CountScanTasks("x"_ == int64_t(5)), 0);
+  EXPECT_EQ(CountScanTasks("x"_ > int64_t(3) and "x"_ < int64_t(10)), 0);
+  EXPECT_EQ(CountScanTasks("x"_ <= int64_t(3)), 1);
+  EXPECT_EQ(CountScanTasks("y"_ <= int64_t(3)), 1);
+  // the pages which may match x and y hold different rows
+  EXPECT_EQ(CountScanTasks("x"_ <= int64_t(3) and "y"_ <= int64_t(3)), 0);
+  EXPECT_EQ(CountScanTasks("x"_ <= int64_t(10) and "y"_ <= int64_t(3)), 1);
+}
+
 TEST_F(TestParquetFileFormat, ExplicitRowGroupSelection) {
   constexpr int64_t kNumRowGroups = 16;
   constexpr int64_t kTotalNumRows = kNumRowGroups * (kNumRowGroups + 1) / 2;
@@ -551,6 +692,37 @@ TEST_F(TestParquetFileFormat, ExplicitRowGroupSelection) {
       row_groups_fragment({kNumRowGroups + 1})->Scan(opts_, ctx_));
 }
 
+TEST_F(TestParquetFileFormat, ReuseMetadataAcrossScans) {
+  constexpr int64_t kNumRowGroups = 4;
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto source = GetFileSource(reader.get());
+  opts_ = ScanOptions::Make(reader->schema());
+
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, scalar(true)));
+  auto parquet_fragment = internal::checked_pointer_cast<ParquetFileFragment>(fragment);
+  EXPECT_EQ(parquet_fragment->metadata(), nullptr);
+
+  CountRowsAndBatchesInScan(fragment, 1 + 2 + 3 + 4, kNumRowGroups);
+  auto metadata = parquet_fragment->metadata();
+  ASSERT_NE(metadata, nullptr);
+  EXPECT_EQ(metadata->num_row_groups(), kNumRowGroups);
+
+  // later scans don't parse the footer again
+  CountRowsAndBatchesInScan(fragment, 1 + 2 + 3 + 4, kNumRowGroups);
+  EXPECT_EQ(parquet_fragment->metadata(), metadata);
+
+  ASSERT_OK_AND_ASSIGN(auto num_rows, parquet_fragment->CountRows());
+  EXPECT_EQ(num_rows, 1 + 2 + 3 + 4);
+
+  ASSERT_OK_AND_ASSIGN(auto description, parquet_fragment->DescribeSubset());
+  EXPECT_EQ(description, "row_groups=0,1,2,3");
+  ASSERT_OK_AND_ASSIGN(auto subset, parquet_fragment->Subset(std::vector<int>{1, 3}));
+  ASSERT_OK_AND_ASSIGN(
+      description,
+      internal::checked_pointer_cast<ParquetFileFragment>(subset)->DescribeSubset());
+  EXPECT_EQ(description, "row_groups=1,3");
+}
+
 TEST_F(TestParquetFileFormat, WriteRecordBatchReader) {
   std::shared_ptr<RecordBatchReader> reader = GetRecordBatchReader();
   auto source = GetFileSource(reader.get());
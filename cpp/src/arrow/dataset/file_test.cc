@@ -26,9 +26,12 @@
 #include "arrow/dataset/api.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/mockfs.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/test_util.h"
+#include "arrow/ipc/reader.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/io_util.h"
 
@@ -213,5 +216,167 @@ TEST_F(TestFileSystemDataset, FragmentPartitions) {
       });
 }
 
+TEST_F(TestFileSystemDataset, ManyPartitionsPruning) {
+  std::vector<fs::FileInfo> files = {fs::File("unpartitioned")};
+  ExpressionVector partitions = {scalar(true)};
+  for (int year = 2000; year < 2010; ++year) {
+    for (int month = 1; month <= 12; ++month) {
+      for (const std::string& name : {"a", "b"}) {
+        files.push_back(fs::File(std::to_string(year) + "/" + std::to_string(month) +
+                                 "/" + name));
+        partitions.push_back(("year"_ == year and "month"_ == month).Copy());
+      }
+    }
+  }
+  MakeDataset(files, scalar(true), partitions);
+  ASSERT_OK_AND_ASSIGN(auto replaced, dataset_->ReplaceSchema(schema({})));
+
+  for (const auto& filter : ExpressionVector{
+           ("year"_ == 2003).Copy(),
+           ("month"_ > 6).Copy(),
+           ("year"_ >= 2005 and "month"_ == 2).Copy(),
+           ("year"_ == 2001 or "month"_ == 12).Copy(),
+           ("year"_ == 1999).Copy(),
+           ("other"_ == 1).Copy(),
+       }) {
+    // The fragments selected by evaluating the filter against each fragment
+    std::vector<std::string> expected;
+    for (size_t i = 0; i < files.size(); ++i) {
+      if (filter->IsSatisfiableWith(partitions[i])) {
+        expected.push_back(files[i].path());
+      }
+    }
+
+    // The second time, the selection is cached
+    for (int i = 0; i < 2; ++i) {
+      EXPECT_EQ(PathsOf(IteratorToVector(dataset_->GetFragments(filter))), expected)
+          << filter->ToString();
+      EXPECT_EQ(PathsOf(IteratorToVector(replaced->GetFragments(filter))), expected)
+          << filter->ToString();
+    }
+    // An equal filter hits the cache too
+    EXPECT_EQ(PathsOf(IteratorToVector(dataset_->GetFragments(filter->Copy()))),
+              expected)
+        << filter->ToString();
+  }
+}
+
+class TestFileSystemDatasetWrite : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(fs_, fs::internal::MockFileSystem::Make(fs::kNoTime, {}));
+    schema_ = schema({field("value", int64()), field("part", int32())});
+    format_ = std::make_shared<IpcFileFormat>();
+
+    write_options_.file_write_options = format_->DefaultWriteOptions();
+    write_options_.filesystem = fs_;
+    write_options_.base_dir = "ds";
+    write_options_.partitioning =
+        std::make_shared<DirectoryPartitioning>(schema({field("part", int32())}));
+    write_options_.basename_template = "dat_{i}.arrow";
+    write_options_.write_manifest = true;
+  }
+
+  std::shared_ptr<RecordBatch> MakeBatch(const std::string& values,
+                                         const std::string& parts) {
+    auto value_array = ArrayFromJSON(int64(), values);
+    return RecordBatch::Make(schema_, value_array->length(),
+                             {value_array, ArrayFromJSON(int32(), parts)});
+  }
+
+  void Write(RecordBatchVector batches) {
+    auto dataset = std::make_shared<InMemoryDataset>(schema_, std::move(batches));
+    auto scanner = std::make_shared<Scanner>(dataset, ScanOptions::Make(schema_),
+                                             std::make_shared<ScanContext>());
+    ASSERT_OK(FileSystemDataset::Write(write_options_, scanner));
+    ASSERT_OK_AND_ASSIGN(manifest_,
+                         ReadDatasetManifest(fs_.get(), "ds/_manifest.arrow"));
+  }
+
+  std::vector<std::string> WrittenPaths() const {
+    std::vector<std::string> paths;
+    for (const auto& entry : manifest_.files) {
+      paths.push_back(entry.path);
+    }
+    return paths;
+  }
+
+  std::vector<int64_t> WrittenRows() const {
+    std::vector<int64_t> rows;
+    for (const auto& entry : manifest_.files) {
+      rows.push_back(entry.num_rows);
+    }
+    return rows;
+  }
+
+  // The number of rows of each batch in a written file
+  std::vector<int64_t> BatchRows(const std::string& path) {
+    std::vector<int64_t> rows;
+    EXPECT_OK_AND_ASSIGN(auto input, fs_->OpenInputFile("ds/" + path));
+    EXPECT_OK_AND_ASSIGN(auto reader, ipc::RecordBatchFileReader::Open(input));
+    for (int i = 0; i < reader->num_record_batches(); ++i) {
+      EXPECT_OK_AND_ASSIGN(auto batch, reader->ReadRecordBatch(i));
+      rows.push_back(batch->num_rows());
+    }
+    return rows;
+  }
+
+ protected:
+  std::shared_ptr<fs::FileSystem> fs_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<FileFormat> format_;
+  FileSystemDatasetWriteOptions write_options_;
+  DatasetManifest manifest_;
+};
+
+TEST_F(TestFileSystemDatasetWrite, MaxRowsPerFile) {
+  write_options_.max_rows_per_file = 3;
+  Write({MakeBatch("[1, 2, 3, 4]", "[0, 0, 0, 0]"), MakeBatch("[5, 6, 7]", "[0, 0, 1]")});
+
+  EXPECT_EQ(WrittenPaths(), (std::vector<std::string>{"0/dat_0.arrow", "0/dat_1.arrow",
+                                                      "1/dat_2.arrow"}));
+  EXPECT_EQ(WrittenRows(), (std::vector<int64_t>{3, 3, 1}));
+  EXPECT_EQ(BatchRows("0/dat_0.arrow"), (std::vector<int64_t>{3}));
+  EXPECT_EQ(BatchRows("0/dat_1.arrow"), (std::vector<int64_t>{1, 2}));
+}
+
+TEST_F(TestFileSystemDatasetWrite, RowsPerGroup) {
+  write_options_.min_rows_per_group = 5;
+  write_options_.max_rows_per_group = 6;
+  Write({MakeBatch("[1, 2, 3, 4]", "[0, 0, 0, 0]"), MakeBatch("[5, 6, 7]", "[0, 0, 0]"),
+         MakeBatch("[8, 9, 10, 11]", "[0, 0, 0, 0]"), MakeBatch("[12, 13]", "[0, 0]")});
+
+  EXPECT_EQ(WrittenRows(), (std::vector<int64_t>{13}));
+  EXPECT_EQ(BatchRows("0/dat_0.arrow"), (std::vector<int64_t>{6, 5, 2}));
+
+  write_options_.min_rows_per_group = 7;
+  ASSERT_RAISES(Invalid, FileSystemDataset::Write(
+                             write_options_,
+                             std::make_shared<Scanner>(
+                                 std::make_shared<InMemoryDataset>(schema_,
+                                                                   RecordBatchVector{}),
+                                 ScanOptions::Make(schema_),
+                                 std::make_shared<ScanContext>())));
+}
+
+TEST_F(TestFileSystemDatasetWrite, MaxOpenFiles) {
+  write_options_.max_open_files = 1;
+  Write({MakeBatch("[1, 2]", "[0, 0]"), MakeBatch("[3]", "[1]"),
+         MakeBatch("[4, 5]", "[0, 0]")});
+
+  // writing partition 1 closed the file of partition 0
+  EXPECT_EQ(WrittenPaths(), (std::vector<std::string>{"0/dat_0.arrow", "0/dat_2.arrow",
+                                                      "1/dat_1.arrow"}));
+  EXPECT_EQ(WrittenRows(), (std::vector<int64_t>{2, 2, 1}));
+
+  ASSERT_OK_AND_ASSIGN(auto factory,
+                       ManifestDatasetFactory::Make("ds/_manifest.arrow", fs_, format_));
+  ASSERT_OK_AND_ASSIGN(auto dataset, factory->Finish());
+  ASSERT_OK_AND_ASSIGN(auto builder, dataset->NewScan());
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder->Finish());
+  ASSERT_OK_AND_ASSIGN(auto table, scanner->ToTable());
+  EXPECT_EQ(table->num_rows(), 5);
+}
+
 }  // namespace dataset
 }  // namespace arrow
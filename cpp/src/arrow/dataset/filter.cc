@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <string>
 #include <unordered_map>
@@ -34,10 +35,13 @@
 #include "arrow/io/memory.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/scalar.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/int_util_internal.h"
 #include "arrow/util/iterator.h"
@@ -575,10 +579,17 @@ std::shared_ptr<Expression> NotExpression::Assume(const Expression& given) const
   return Copy();
 }
 
+std::shared_ptr<Expression> InExpression::WithOperand(
+    std::shared_ptr<Expression> operand) const {
+  auto out = std::make_shared<InExpression>(*this);
+  out->operand_ = std::move(operand);
+  return out;
+}
+
 std::shared_ptr<Expression> InExpression::Assume(const Expression& given) const {
   auto operand = operand_->Assume(given);
   if (operand->type() != ExpressionType::SCALAR) {
-    return std::make_shared<InExpression>(std::move(operand), set_);
+    return WithOperand(std::move(operand));
   }
 
   if (operand->IsNull()) {
@@ -593,7 +604,7 @@ std::shared_ptr<Expression> InExpression::Assume(const Expression& given) const
                            *checked_cast<const ScalarExpression&>(*operand).value())
                            .GetEncodedValue();
     if (!maybe_decoded.ok() || !maybe_value.ok()) {
-      return std::make_shared<InExpression>(std::move(operand), set_);
+      return WithOperand(std::move(operand));
     }
     set = *maybe_decoded;
     value = *maybe_value;
@@ -605,7 +616,7 @@ std::shared_ptr<Expression> InExpression::Assume(const Expression& given) const
   compute::CompareOptions eq(CompareOperator::EQUAL);
   Result<Datum> maybe_out = compute::Compare(set, value, eq);
   if (!maybe_out.ok()) {
-    return std::make_shared<InExpression>(std::move(operand), set_);
+    return WithOperand(std::move(operand));
   }
 
   Datum out = maybe_out.ValueOrDie();
@@ -1202,7 +1213,7 @@ struct TreeEvaluator::Impl {
   Result<Datum> operator()(const NotExpression& expr) const {
     ARROW_ASSIGN_OR_RAISE(Datum to_invert, Evaluate(*expr.operand()));
     if (IsNullDatum(to_invert)) {
-      return NullDatum();
+      return Datum(std::make_shared<BooleanScalar>());
     }
 
     if (to_invert.is_scalar()) {
@@ -1220,7 +1231,7 @@ struct TreeEvaluator::Impl {
     }
 
     DCHECK(operand_values.is_array());
-    return compute::IsIn(operand_values, expr.set(), &ctx_);
+    return compute::IsIn(operand_values, expr.lookup_options(), &ctx_);
   }
 
   Result<Datum> operator()(const IsValidExpression& expr) const {
@@ -1238,8 +1249,10 @@ struct TreeEvaluator::Impl {
       return Datum(true);
     }
 
-    return Datum(std::make_shared<BooleanArray>(operand_values.array()->length,
-                                                operand_values.array()->buffers[0]));
+    const auto& data = *operand_values.array();
+    return Datum(std::make_shared<BooleanArray>(data.length, data.buffers[0],
+                                                /*null_bitmap=*/nullptr,
+                                                /*null_count=*/0, data.offset));
   }
 
   Result<Datum> operator()(const CastExpression& expr) const {
@@ -1308,33 +1321,216 @@ struct TreeEvaluator::Impl {
   mutable compute::ExecContext ctx_;
 };
 
+namespace {
+
+// A MemoryPool keeping the regions freed by the intermediate results of a block,
+// so that they can be handed out again to the identically sized intermediate
+// results of the following blocks.
+class ScratchMemoryPool : public MemoryPool {
+ public:
+  explicit ScratchMemoryPool(MemoryPool* pool) : pool_(pool) {}
+
+  ~ScratchMemoryPool() override {
+    for (const auto& region : free_regions_) {
+      pool_->Free(region.second, region.first);
+    }
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = free_regions_.begin(); it != free_regions_.end(); ++it) {
+      if (it->first == size) {
+        *out = it->second;
+        free_regions_.erase(it);
+        bytes_allocated_ += size;
+        return Status::OK();
+      }
+    }
+    RETURN_NOT_OK(pool_->Allocate(size, out));
+    bytes_allocated_ += size;
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    bytes_allocated_ += new_size - old_size;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    bytes_allocated_ -= size;
+    if (size > 0 && free_regions_.size() < kMaxFreeRegions) {
+      free_regions_.emplace_back(size, buffer);
+    } else {
+      pool_->Free(buffer, size);
+    }
+  }
+
+  int64_t bytes_allocated() const override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_allocated_;
+  }
+
+  std::string backend_name() const override { return pool_->backend_name(); }
+
+ private:
+  static constexpr size_t kMaxFreeRegions = 64;
+
+  MemoryPool* pool_;
+  mutable std::mutex mutex_;
+  int64_t bytes_allocated_ = 0;
+  std::vector<std::pair<int64_t, uint8_t*>> free_regions_;
+};
+
+constexpr size_t ScratchMemoryPool::kMaxFreeRegions;
+
+// Write the boolean result of evaluating a block to the bitmaps of the whole batch,
+// allocating the validity bitmap on the first null encountered.
+Status WriteBooleanBlock(const Datum& block, int64_t offset, int64_t length,
+                         int64_t batch_length, MemoryPool* pool, uint8_t* values,
+                         std::shared_ptr<Buffer>* validity) {
+  bool all_valid;
+  const ArrayData* data = nullptr;
+  if (block.is_scalar()) {
+    const auto& scalar = *block.scalar();
+    all_valid = scalar.is_valid && scalar.type->id() == Type::BOOL;
+    BitUtil::SetBitsTo(values, offset, length,
+                       all_valid && checked_cast<const BooleanScalar&>(scalar).value);
+  } else {
+    data = block.array().get();
+    DCHECK_EQ(data->length, length);
+    if (data->type->id() != Type::BOOL) {
+      return Status::TypeError("Expected a boolean block, got ", *data->type);
+    }
+    arrow::internal::CopyBitmap(data->buffers[1]->data(), data->offset, length, values,
+                                offset);
+    all_valid = data->GetNullCount() == 0;
+  }
+
+  if (all_valid) {
+    if (*validity) {
+      BitUtil::SetBitsTo((*validity)->mutable_data(), offset, length, true);
+    }
+    return Status::OK();
+  }
+
+  if (*validity == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(*validity, AllocateEmptyBitmap(batch_length, pool));
+    BitUtil::SetBitsTo((*validity)->mutable_data(), 0, offset, true);
+  }
+  if (data == nullptr) {
+    BitUtil::SetBitsTo((*validity)->mutable_data(), offset, length, false);
+  } else {
+    arrow::internal::CopyBitmap(data->buffers[0]->data(), data->offset, length,
+                                (*validity)->mutable_data(), offset);
+  }
+  return Status::OK();
+}
+
+// Evaluate a boolean expression one block of rows at a time. The intermediate
+// results of a block are released before the next block is evaluated, so only
+// the output spans the whole batch. If every block evaluates to the same scalar,
+// that scalar is returned instead.
+Result<Datum> EvaluateBooleanInBlocks(const ExpressionEvaluator& evaluator,
+                                      const Expression& expr, const RecordBatch& batch,
+                                      int64_t block_size, MemoryPool* pool) {
+  const int64_t length = batch.num_rows();
+  ScratchMemoryPool scratch_pool(pool);
+
+  std::shared_ptr<Scalar> uniform;
+  std::shared_ptr<Buffer> values, validity;
+  for (int64_t offset = 0; offset < length; offset += block_size) {
+    const int64_t block_length = std::min(block_size, length - offset);
+    ARROW_ASSIGN_OR_RAISE(
+        Datum block,
+        evaluator.Evaluate(expr, *batch.Slice(offset, block_length), &scratch_pool));
+
+    if (values == nullptr) {
+      if (block.is_scalar() && (offset == 0 || uniform->Equals(*block.scalar()))) {
+        uniform = block.scalar();
+        continue;
+      }
+
+      ARROW_ASSIGN_OR_RAISE(values, AllocateEmptyBitmap(length, pool));
+      if (offset > 0) {
+        RETURN_NOT_OK(WriteBooleanBlock(Datum(uniform), 0, offset, length, pool,
+                                        values->mutable_data(), &validity));
+      }
+    }
+    RETURN_NOT_OK(WriteBooleanBlock(block, offset, block_length, length, pool,
+                                    values->mutable_data(), &validity));
+  }
+
+  if (values == nullptr) {
+    return Datum(std::move(uniform));
+  }
+  return Datum(std::make_shared<BooleanArray>(length, std::move(values), validity,
+                                              validity ? kUnknownNullCount : 0));
+}
+
+}  // namespace
+
+constexpr int64_t TreeEvaluator::kDefaultBlockSize;
+
 Result<Datum> TreeEvaluator::Evaluate(const Expression& expr, const RecordBatch& batch,
                                       MemoryPool* pool) const {
+  if (block_size_ > 0 && batch.num_rows() > block_size_) {
+    ARROW_ASSIGN_OR_RAISE(auto type, expr.Validate(*batch.schema()));
+    if (type->id() == Type::BOOL) {
+      return EvaluateBooleanInBlocks(*this, expr, batch, block_size_, pool);
+    }
+  }
   return VisitExpression(expr, Impl{this, batch, compute::ExecContext{pool}});
 }
 
-Result<std::shared_ptr<RecordBatch>> TreeEvaluator::Filter(
-    const Datum& selection, const std::shared_ptr<RecordBatch>& batch,
-    MemoryPool* pool) const {
-  if (selection.is_array()) {
-    auto selection_array = selection.make_array();
-    compute::ExecContext ctx(pool);
-    ARROW_ASSIGN_OR_RAISE(Datum filtered,
-                          compute::Filter(batch, selection_array,
-                                          compute::FilterOptions::Defaults(), &ctx));
-    return filtered.record_batch();
-  }
-
-  if (!selection.is_scalar() || selection.type()->id() != Type::BOOL) {
+Result<int64_t> CountSelected(const Datum& selection, int64_t num_rows) {
+  if (!(selection.is_array() || selection.is_scalar()) ||
+      selection.type()->id() != Type::BOOL) {
     return Status::NotImplemented("Filtering batches against DatumKind::",
                                   selection.kind(), " of type ", *selection.type());
   }
 
-  if (BooleanScalar(true).Equals(*selection.scalar())) {
+  if (selection.is_scalar()) {
+    return BooleanScalar(true).Equals(*selection.scalar()) ? num_rows : 0;
+  }
+
+  const ArrayData& data = *selection.array();
+  const int64_t null_count = data.GetNullCount();
+  if (null_count == data.length) {
+    return 0;
+  }
+  if (null_count == 0) {
+    return arrow::internal::CountSetBits(data.buffers[1]->data(), data.offset,
+                                         data.length);
+  }
+  // Selected rows are both valid and true
+  return arrow::internal::CountAndSetBits(data.buffers[0]->data(), data.offset,
+                                          data.buffers[1]->data(), data.offset,
+                                          data.length);
+}
+
+Result<std::shared_ptr<RecordBatch>> TreeEvaluator::Filter(
+    const Datum& selection, const std::shared_ptr<RecordBatch>& batch,
+    MemoryPool* pool) const {
+  // Count the selected rows first: the filter kernel is only needed when some but
+  // not all of the rows are selected
+  ARROW_ASSIGN_OR_RAISE(int64_t num_selected,
+                        CountSelected(selection, batch->num_rows()));
+  if (num_selected == 0) {
+    return batch->Slice(0, 0);
+  }
+  if (num_selected == batch->num_rows()) {
     return batch;
   }
 
-  return batch->Slice(0, 0);
+  auto selection_array = selection.make_array();
+  compute::ExecContext ctx(pool);
+  ARROW_ASSIGN_OR_RAISE(Datum filtered,
+                        compute::Filter(batch, selection_array,
+                                        compute::FilterOptions::Defaults(), &ctx));
+  return filtered.record_batch();
 }
 
 std::shared_ptr<Expression> scalar(bool value) { return scalar(MakeScalar(value)); }
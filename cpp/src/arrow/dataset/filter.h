@@ -364,7 +364,9 @@ class ARROW_DS_EXPORT InExpression final
     : public ExpressionImpl<UnaryExpression, InExpression, ExpressionType::IN> {
  public:
   InExpression(std::shared_ptr<Expression> operand, std::shared_ptr<Array> set)
-      : ExpressionImpl(std::move(operand)), set_(std::move(set)) {}
+      : ExpressionImpl(std::move(operand)),
+        set_(std::move(set)),
+        lookup_options_(set_, /*skip_nulls=*/true) {}
 
   std::string ToString() const override;
 
@@ -375,8 +377,16 @@ class ARROW_DS_EXPORT InExpression final
   /// The set against which the operand will be compared
   const std::shared_ptr<Array>& set() const { return set_; }
 
+  /// The options of the lookups of the operand into the set. The hash table of the
+  /// set is built on the first evaluation and shared by the copies of this
+  /// expression and the expressions derived from it by Assume().
+  const compute::SetLookupOptions& lookup_options() const { return lookup_options_; }
+
  private:
+  std::shared_ptr<Expression> WithOperand(std::shared_ptr<Expression> operand) const;
+
   std::shared_ptr<Array> set_;
+  compute::SetLookupOptions lookup_options_;
 };
 
 /// Explicitly cast an expression to a different type
@@ -636,10 +646,32 @@ class ARROW_DS_EXPORT ExpressionEvaluator {
   static std::shared_ptr<ExpressionEvaluator> Null();
 };
 
+/// \brief Count the rows of a batch which a selection would keep when filtering it,
+/// without filtering the batch.
+///
+/// selection is the result of evaluating a filter expression against a batch of
+/// num_rows rows; rows for which it is null are not kept. This is a cheap estimate
+/// of the selectivity of a filter, computed one 64-bit word of the selection's
+/// bitmaps at a time.
+ARROW_DS_EXPORT
+Result<int64_t> CountSelected(const Datum& selection, int64_t num_rows);
+
 /// construct an Evaluator which uses compute kernels to evaluate expressions and
 /// filter record batches in depth first order
+///
+/// Boolean expressions are evaluated against batches longer than block_size rows
+/// one block of rows at a time, so that intermediate results stay cache-sized and
+/// their allocations are reused from one block to the next. A block_size of zero
+/// evaluates whole batches at once.
 class ARROW_DS_EXPORT TreeEvaluator : public ExpressionEvaluator {
  public:
+  static constexpr int64_t kDefaultBlockSize = 4096;
+
+  explicit TreeEvaluator(int64_t block_size = kDefaultBlockSize)
+      : block_size_(block_size) {}
+
+  int64_t block_size() const { return block_size_; }
+
   Result<Datum> Evaluate(const Expression& expr, const RecordBatch& batch,
                          MemoryPool* pool) const override;
 
@@ -649,6 +681,8 @@ class ARROW_DS_EXPORT TreeEvaluator : public ExpressionEvaluator {
 
  protected:
   struct Impl;
+
+  int64_t block_size_;
 };
 
 /// \brief Assemble lists of indices of identical rows.
@@ -25,11 +25,13 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/compute/api.h"
 #include "arrow/dataset/test_util.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/checked_cast.h"
@@ -560,6 +562,79 @@ void AssertFieldsInExpression(std::shared_ptr<Expression> expr,
   EXPECT_THAT(FieldsInExpression(expr), testing::ContainerEq(expected));
 }
 
+void AssertEvaluatesInBlocks(const Expression& expr, const RecordBatch& batch) {
+  SCOPED_TRACE(expr.ToString());
+  ASSERT_OK_AND_ASSIGN(Datum expected, TreeEvaluator(/*block_size=*/0)
+                                           .Evaluate(expr, batch, default_memory_pool()));
+
+  for (int64_t block_size : {1, 7, 64, 999, 1000}) {
+    SCOPED_TRACE("block_size = " + std::to_string(block_size));
+    ProxyMemoryPool pool(default_memory_pool());
+    {
+      ASSERT_OK_AND_ASSIGN(Datum actual,
+                           TreeEvaluator(block_size).Evaluate(expr, batch, &pool));
+      AssertDatumsEqual(expected, actual);
+    }
+    ASSERT_EQ(pool.bytes_allocated(), 0);
+  }
+}
+
+TEST(TreeEvaluatorTest, EvaluateInBlocks) {
+  constexpr int64_t kLength = 1000;
+  random::RandomArrayGenerator rng(0x5eed);
+
+  // "e" has nulls only in its second half
+  ASSERT_OK_AND_ASSIGN(auto e, Concatenate({rng.Int32(kLength / 2, 0, 10, 0),
+                                            rng.Int32(kLength / 2, 0, 10, 0.5)}));
+  auto batch = RecordBatch::Make(
+      schema({field("a", int32()), field("b", float64()), field("c", int32()),
+              field("d", boolean()), field("e", int32())}),
+      kLength,
+      {rng.Int32(kLength, 0, 10, 0.1), rng.Float64(kLength, -5.0, 5.0, 0.1),
+       rng.Int32(kLength, 0, 10, 0.3), rng.Boolean(kLength, 0.5, 0.2), e});
+
+  AssertEvaluatesInBlocks(("a"_ > 5 and "b"_ < 1.0) or not "c"_.IsValid(), *batch);
+  AssertEvaluatesInBlocks("a"_ == 3 or "d"_, *batch);
+  AssertEvaluatesInBlocks("a"_.CastTo(float64()) == 2.0 and not "d"_, *batch);
+  AssertEvaluatesInBlocks("e"_.IsValid(), *batch);
+  AssertEvaluatesInBlocks("absent"_ == 0, *batch);
+  AssertEvaluatesInBlocks(*scalar(true), *batch);
+}
+
+TEST(CountSelectedTest, Basic) {
+  ASSERT_OK_AND_EQ(5, CountSelected(Datum(true), 5));
+  ASSERT_OK_AND_EQ(0, CountSelected(Datum(false), 5));
+  ASSERT_OK_AND_EQ(0, CountSelected(Datum(std::make_shared<BooleanScalar>()), 5));
+
+  auto selection = ArrayFromJSON(boolean(), "[true, false, null, true, true, null]");
+  ASSERT_OK_AND_EQ(3, CountSelected(selection, 6));
+  ASSERT_OK_AND_EQ(1, CountSelected(selection->Slice(1, 3), 3));
+  ASSERT_OK_AND_EQ(0, CountSelected(ArrayFromJSON(boolean(), "[null, null]"), 2));
+  ASSERT_OK_AND_EQ(2, CountSelected(ArrayFromJSON(boolean(), "[true, true]"), 2));
+
+  ASSERT_RAISES(NotImplemented, CountSelected(ArrayFromJSON(int32(), "[1, 0]"), 2));
+}
+
+TEST(TreeEvaluatorTest, FilterSkipsKernelForUniformSelections) {
+  auto batch = RecordBatchFromJSON(schema({field("a", int32())}), R"([
+      {"a": 1}, {"a": 2}, {"a": 3}
+  ])");
+  TreeEvaluator evaluator;
+
+  auto all = ArrayFromJSON(boolean(), "[true, true, true]");
+  ASSERT_OK_AND_ASSIGN(auto filtered,
+                       evaluator.Filter(all, batch, default_memory_pool()));
+  ASSERT_EQ(filtered, batch);
+
+  auto none = ArrayFromJSON(boolean(), "[false, null, false]");
+  ASSERT_OK_AND_ASSIGN(filtered, evaluator.Filter(none, batch, default_memory_pool()));
+  ASSERT_EQ(filtered->num_rows(), 0);
+
+  auto some = ArrayFromJSON(boolean(), "[false, true, null]");
+  ASSERT_OK_AND_ASSIGN(filtered, evaluator.Filter(some, batch, default_memory_pool()));
+  AssertBatchesEqual(*RecordBatchFromJSON(batch->schema(), R"([{"a": 2}])"), *filtered);
+}
+
 TEST(FieldsInExpressionTest, Basic) {
   AssertFieldsInExpression(scalar(true), {});
 
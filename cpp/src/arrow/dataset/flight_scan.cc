@@ -0,0 +1,170 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/flight_scan.h"
+
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace dataset {
+
+namespace {
+
+std::shared_ptr<Schema> ScanRequestSchema() {
+  return schema({field("filter", binary(), /*nullable=*/false),
+                 field("columns", list(utf8()), /*nullable=*/false)});
+}
+
+}  // namespace
+
+Result<std::shared_ptr<Buffer>> FlightScanRequest::Serialize() const {
+  if (filter == nullptr) {
+    return Status::Invalid("FlightScanRequest filter must not be null");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto serialized_filter, filter->Serialize());
+  BinaryBuilder filter_builder;
+  RETURN_NOT_OK(filter_builder.Append(serialized_filter->data(),
+                                      static_cast<int32_t>(serialized_filter->size())));
+  std::shared_ptr<Array> filter_array;
+  RETURN_NOT_OK(filter_builder.Finish(&filter_array));
+
+  auto column_builder = std::make_shared<StringBuilder>();
+  ListBuilder columns_builder(default_memory_pool(), column_builder);
+  RETURN_NOT_OK(columns_builder.Append());
+  for (const auto& column : columns) {
+    RETURN_NOT_OK(column_builder->Append(column));
+  }
+  std::shared_ptr<Array> columns_array;
+  RETURN_NOT_OK(columns_builder.Finish(&columns_array));
+
+  auto batch = RecordBatch::Make(ScanRequestSchema(), 1, {filter_array, columns_array});
+  ARROW_ASSIGN_OR_RAISE(auto stream, io::BufferOutputStream::Create());
+  ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeStreamWriter(stream, batch->schema()));
+  RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  RETURN_NOT_OK(writer->Close());
+  return stream->Finish();
+}
+
+Result<FlightScanRequest> FlightScanRequest::Deserialize(const Buffer& serialized) {
+  io::BufferReader stream(serialized);
+  ARROW_ASSIGN_OR_RAISE(auto reader, ipc::RecordBatchStreamReader::Open(&stream));
+  if (!reader->schema()->Equals(*ScanRequestSchema(), /*check_metadata=*/false)) {
+    return Status::Invalid("Not a FlightScanRequest: unexpected schema ",
+                           reader->schema()->ToString());
+  }
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(reader->ReadNext(&batch));
+  if (batch == nullptr || batch->num_rows() != 1) {
+    return Status::Invalid("FlightScanRequest must hold exactly one row");
+  }
+  RETURN_NOT_OK(batch->ValidateFull());
+
+  FlightScanRequest request;
+  const auto& filter_array = checked_cast<const BinaryArray&>(*batch->column(0));
+  const auto serialized_filter = filter_array.GetView(0);
+  ARROW_ASSIGN_OR_RAISE(
+      request.filter, Expression::Deserialize(Buffer(
+                          reinterpret_cast<const uint8_t*>(serialized_filter.data()),
+                          static_cast<int64_t>(serialized_filter.size()))));
+
+  const auto& columns_array = checked_cast<const ListArray&>(*batch->column(1));
+  const auto& names = checked_cast<const StringArray&>(*columns_array.values());
+  for (int64_t i = columns_array.value_offset(0); i < columns_array.value_offset(1);
+       ++i) {
+    request.columns.push_back(names.GetString(i));
+  }
+  return request;
+}
+
+Status ScanFlight(flight::FlightClient* client, const flight::FlightCallOptions& options,
+                  const flight::FlightDescriptor& descriptor,
+                  const FlightScanRequest& request, std::shared_ptr<Table>* out) {
+  ARROW_ASSIGN_OR_RAISE(auto serialized, request.Serialize());
+  std::unique_ptr<flight::FlightStreamWriter> writer;
+  std::unique_ptr<flight::FlightStreamReader> reader;
+  RETURN_NOT_OK(client->DoExchange(options, descriptor, &writer, &reader));
+  RETURN_NOT_OK(writer->WriteMetadata(std::move(serialized)));
+  RETURN_NOT_OK(writer->DoneWriting());
+  RETURN_NOT_OK(reader->ReadAll(out));
+  return writer->Close();
+}
+
+Status ServeFlightScan(std::shared_ptr<Dataset> dataset,
+                       std::shared_ptr<ScanContext> context,
+                       flight::FlightMessageReader* reader,
+                       flight::FlightMessageWriter* writer) {
+  // The deserialized filter may reference the request, which is kept alive
+  // along with the chunk until the scan is done.
+  flight::FlightStreamChunk chunk;
+  RETURN_NOT_OK(reader->Next(&chunk));
+  if (chunk.data != nullptr || chunk.app_metadata == nullptr) {
+    return Status::Invalid(
+        "Expected a FlightScanRequest as the metadata of the first message");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto request,
+                        FlightScanRequest::Deserialize(*chunk.app_metadata));
+
+  if (context == nullptr) {
+    context = std::make_shared<ScanContext>();
+  }
+  ARROW_ASSIGN_OR_RAISE(auto builder, dataset->NewScan(std::move(context)));
+  if (!request.columns.empty()) {
+    RETURN_NOT_OK(builder->Project(std::move(request.columns)));
+  }
+  RETURN_NOT_OK(builder->Filter(std::move(request.filter)));
+  ARROW_ASSIGN_OR_RAISE(auto scanner, builder->Finish());
+  ARROW_ASSIGN_OR_RAISE(auto batches, scanner->ToRecordBatchReader());
+
+  RETURN_NOT_OK(writer->Begin(batches->schema()));
+  while (true) {
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(batches->ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  }
+  return Status::OK();
+}
+
+FlightDatasetServer::FlightDatasetServer(std::shared_ptr<ScanContext> context)
+    : scan_context_(std::move(context)) {}
+
+Status FlightDatasetServer::DoExchange(
+    const flight::ServerCallContext& context,
+    std::unique_ptr<flight::FlightMessageReader> reader,
+    std::unique_ptr<flight::FlightMessageWriter> writer) {
+  ARROW_ASSIGN_OR_RAISE(auto dataset, GetDataset(reader->descriptor()));
+  return ServeFlightScan(std::move(dataset), scan_context_, reader.get(), writer.get());
+}
+
+}  // namespace dataset
+}  // namespace arrow
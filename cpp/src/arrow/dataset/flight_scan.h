@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/flight/client.h"
+#include "arrow/flight/server.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief A filter and projection for a Flight server to apply to a dataset
+///
+/// The client sends the serialized request as the app_metadata of the first message of
+/// a DoExchange() call, whose descriptor names the dataset. The server replies with a
+/// stream of the matching rows of the requested columns, so that only those cross the
+/// network.
+struct ARROW_DS_EXPORT FlightScanRequest {
+  /// Only rows satisfying the filter are returned
+  std::shared_ptr<Expression> filter = scalar(true);
+
+  /// The columns to return, in order. If empty, all columns are returned.
+  std::vector<std::string> columns;
+
+  /// \brief Encode the request as an Arrow IPC stream of a single row, with a binary
+  /// column "filter" holding the serialized Expression and a list<utf8> column
+  /// "columns".
+  Result<std::shared_ptr<Buffer>> Serialize() const;
+
+  static Result<FlightScanRequest> Deserialize(const Buffer& serialized);
+};
+
+/// \brief Scan a dataset on a Flight server supporting FlightScanRequest, such as a
+/// FlightDatasetServer
+///
+/// \param[in] client the client connected to the server
+/// \param[in] options the options of the DoExchange() call
+/// \param[in] descriptor the descriptor naming the dataset on the server
+/// \param[in] request the filter and projection to apply on the server
+/// \param[out] out the matching rows of the requested columns
+ARROW_DS_EXPORT
+Status ScanFlight(flight::FlightClient* client, const flight::FlightCallOptions& options,
+                  const flight::FlightDescriptor& descriptor,
+                  const FlightScanRequest& request, std::shared_ptr<Table>* out);
+
+/// \brief Answer a FlightScanRequest received by DoExchange()
+///
+/// The request is read from the first message, applied through a Scanner of the
+/// dataset, and the scanned batches are streamed back as they are produced.
+ARROW_DS_EXPORT
+Status ServeFlightScan(std::shared_ptr<Dataset> dataset,
+                       std::shared_ptr<ScanContext> context,
+                       flight::FlightMessageReader* reader,
+                       flight::FlightMessageWriter* writer);
+
+/// \brief A Flight server answering DoExchange() calls with FlightScanRequests
+///
+/// Subclasses map descriptors to datasets by implementing GetDataset.
+///
+/// \note Only available if Arrow was built with ARROW_FLIGHT=ON.
+class ARROW_DS_EXPORT FlightDatasetServer : public flight::FlightServerBase {
+ public:
+  /// \param[in] context the context of the scans, e.g. to scan with threads.
+  explicit FlightDatasetServer(std::shared_ptr<ScanContext> context = NULLPTR);
+
+  Status DoExchange(const flight::ServerCallContext& context,
+                    std::unique_ptr<flight::FlightMessageReader> reader,
+                    std::unique_ptr<flight::FlightMessageWriter> writer) override;
+
+ protected:
+  /// \brief Return the dataset named by a descriptor
+  virtual Result<std::shared_ptr<Dataset>> GetDataset(
+      const flight::FlightDescriptor& descriptor) = 0;
+
+  std::shared_ptr<ScanContext> scan_context_;
+};
+
+}  // namespace dataset
+}  // namespace arrow
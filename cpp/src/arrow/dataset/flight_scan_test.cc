@@ -0,0 +1,159 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/flight_scan.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace dataset {
+
+// clang-format off
+using string_literals::operator"" _;
+// clang-format on
+
+// Serves a single in-memory dataset under the path "data"
+class InMemoryFlightDatasetServer : public FlightDatasetServer {
+ public:
+  explicit InMemoryFlightDatasetServer(std::shared_ptr<Dataset> dataset)
+      : dataset_(std::move(dataset)) {}
+
+ protected:
+  Result<std::shared_ptr<Dataset>> GetDataset(
+      const flight::FlightDescriptor& descriptor) override {
+    if (descriptor.type != flight::FlightDescriptor::PATH ||
+        descriptor.path != std::vector<std::string>{"data"}) {
+      return Status::KeyError("No dataset for ", descriptor.ToString());
+    }
+    return dataset_;
+  }
+
+ private:
+  std::shared_ptr<Dataset> dataset_;
+};
+
+class TestFlightScan : public ::testing::Test {
+ public:
+  void SetUp() override {
+    auto batches = {
+        RecordBatchFromJSON(schema_, R"([{"i32": 0, "f64": 0.5, "str": "a"},
+                                         {"i32": 1, "f64": 1.5, "str": "b"},
+                                         {"i32": 2, "f64": null, "str": "c"}])"),
+        RecordBatchFromJSON(schema_, R"([{"i32": 3, "f64": 3.5, "str": null},
+                                         {"i32": 4, "f64": 4.5, "str": "e"}])")};
+    dataset_ = std::make_shared<InMemoryDataset>(schema_, batches);
+
+    flight::Location location;
+    ASSERT_OK(flight::Location::ForGrpcTcp("localhost", 0, &location));
+    server_.reset(new InMemoryFlightDatasetServer(dataset_));
+    ASSERT_OK(server_->Init(flight::FlightServerOptions(location)));
+
+    flight::Location real_location;
+    ASSERT_OK(flight::Location::ForGrpcTcp("localhost", server_->port(), &real_location));
+    ASSERT_OK(flight::FlightClient::Connect(real_location, &client_));
+  }
+
+  void TearDown() override { ASSERT_OK(server_->Shutdown()); }
+
+  void AssertScanMatchesLocal(const FlightScanRequest& request) {
+    std::shared_ptr<Table> actual;
+    ASSERT_OK(ScanFlight(client_.get(), {}, flight::FlightDescriptor::Path({"data"}),
+                         request, &actual));
+
+    ASSERT_OK_AND_ASSIGN(auto builder, dataset_->NewScan());
+    if (!request.columns.empty()) {
+      ASSERT_OK(builder->Project(request.columns));
+    }
+    ASSERT_OK(builder->Filter(request.filter));
+    ASSERT_OK_AND_ASSIGN(auto scanner, builder->Finish());
+    ASSERT_OK_AND_ASSIGN(auto expected, scanner->ToTable());
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_ =
+      schema({field("i32", int32()), field("f64", float64()), field("str", utf8())});
+  std::shared_ptr<Dataset> dataset_;
+  std::unique_ptr<flight::FlightServerBase> server_;
+  std::unique_ptr<flight::FlightClient> client_;
+};
+
+TEST_F(TestFlightScan, RequestRoundTrip) {
+  FlightScanRequest request;
+  request.filter = ("i32"_ > 1 and "str"_ == "e").Copy();
+  request.columns = {"str", "i32"};
+  ASSERT_OK_AND_ASSIGN(auto serialized, request.Serialize());
+  ASSERT_OK_AND_ASSIGN(auto deserialized, FlightScanRequest::Deserialize(*serialized));
+  ASSERT_TRUE(deserialized.filter->Equals(*request.filter));
+  ASSERT_EQ(deserialized.columns, request.columns);
+
+  // All columns
+  request.columns.clear();
+  ASSERT_OK_AND_ASSIGN(serialized, request.Serialize());
+  ASSERT_OK_AND_ASSIGN(deserialized, FlightScanRequest::Deserialize(*serialized));
+  ASSERT_TRUE(deserialized.columns.empty());
+
+  ASSERT_RAISES(Invalid, FlightScanRequest::Deserialize(*Buffer::FromString("foo")));
+}
+
+TEST_F(TestFlightScan, All) { AssertScanMatchesLocal(FlightScanRequest{}); }
+
+TEST_F(TestFlightScan, FilterAndProject) {
+  FlightScanRequest request;
+  request.filter = ("i32"_ >= 1 and "f64"_ > 1.0).Copy();
+  request.columns = {"str", "i32"};
+  AssertScanMatchesLocal(request);
+
+  std::shared_ptr<Table> actual;
+  ASSERT_OK(ScanFlight(client_.get(), {}, flight::FlightDescriptor::Path({"data"}),
+                       request, &actual));
+  AssertSchemaEqual(*schema({field("str", utf8()), field("i32", int32())}),
+                    *actual->schema());
+  ASSERT_EQ(actual->num_rows(), 3);
+}
+
+TEST_F(TestFlightScan, NoMatches) {
+  FlightScanRequest request;
+  request.filter = ("i32"_ > 100).Copy();
+  AssertScanMatchesLocal(request);
+}
+
+TEST_F(TestFlightScan, Errors) {
+  std::shared_ptr<Table> table;
+  FlightScanRequest request;
+  request.columns = {"missing"};
+  ASSERT_RAISES(Invalid, ScanFlight(client_.get(), {},
+                                    flight::FlightDescriptor::Path({"data"}), request,
+                                    &table));
+
+  ASSERT_RAISES(KeyError, ScanFlight(client_.get(), {},
+                                     flight::FlightDescriptor::Path({"other"}),
+                                     FlightScanRequest{}, &table));
+}
+
+}  // namespace dataset
+}  // namespace arrow
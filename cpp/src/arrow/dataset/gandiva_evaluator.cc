@@ -0,0 +1,306 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/gandiva_evaluator.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/visitor_inline.h"
+#include "gandiva/projector.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace arrow {
+namespace dataset {
+
+using arrow::internal::checked_cast;
+using gandiva::NodePtr;
+using gandiva::TreeExprBuilder;
+
+namespace {
+
+// Translate an Expression to a Gandiva expression tree over the fields of a schema.
+struct GandivaTranslator {
+  explicit GandivaTranslator(const Schema& schema) : schema(schema) {}
+
+  Result<NodePtr> operator()(const ScalarExpression& expr) const {
+    const auto& value = *expr.value();
+    if (!value.is_valid) {
+      return TreeExprBuilder::MakeNull(value.type);
+    }
+    switch (value.type->id()) {
+      case Type::BOOL:
+        return TreeExprBuilder::MakeLiteral(
+            checked_cast<const BooleanScalar&>(value).value);
+#define LITERAL_CASE(TYPE_ID, SCALAR_TYPE) \
+  case Type::TYPE_ID:                      \
+    return TreeExprBuilder::MakeLiteral(checked_cast<const SCALAR_TYPE&>(value).value);
+        LITERAL_CASE(INT8, Int8Scalar)
+        LITERAL_CASE(INT16, Int16Scalar)
+        LITERAL_CASE(INT32, Int32Scalar)
+        LITERAL_CASE(INT64, Int64Scalar)
+        LITERAL_CASE(UINT8, UInt8Scalar)
+        LITERAL_CASE(UINT16, UInt16Scalar)
+        LITERAL_CASE(UINT32, UInt32Scalar)
+        LITERAL_CASE(UINT64, UInt64Scalar)
+        LITERAL_CASE(FLOAT, FloatScalar)
+        LITERAL_CASE(DOUBLE, DoubleScalar)
+#undef LITERAL_CASE
+      case Type::STRING:
+        return TreeExprBuilder::MakeStringLiteral(
+            checked_cast<const StringScalar&>(value).value->ToString());
+      case Type::BINARY:
+        return TreeExprBuilder::MakeBinaryLiteral(
+            checked_cast<const BinaryScalar&>(value).value->ToString());
+      default:
+        break;
+    }
+    return NotTranslatable(expr);
+  }
+
+  Result<NodePtr> operator()(const FieldExpression& expr) {
+    auto field = schema.GetFieldByName(expr.name());
+    if (field == nullptr || field->type()->id() == Type::DICTIONARY) {
+      return NotTranslatable(expr);
+    }
+    has_fields = true;
+    return TreeExprBuilder::MakeField(std::move(field));
+  }
+
+  Result<NodePtr> operator()(const AndExpression& expr) {
+    ARROW_ASSIGN_OR_RAISE(auto lhs, Translate(*expr.left_operand()));
+    ARROW_ASSIGN_OR_RAISE(auto rhs, Translate(*expr.right_operand()));
+    return TreeExprBuilder::MakeAnd({std::move(lhs), std::move(rhs)});
+  }
+
+  Result<NodePtr> operator()(const OrExpression& expr) {
+    ARROW_ASSIGN_OR_RAISE(auto lhs, Translate(*expr.left_operand()));
+    ARROW_ASSIGN_OR_RAISE(auto rhs, Translate(*expr.right_operand()));
+    return TreeExprBuilder::MakeOr({std::move(lhs), std::move(rhs)});
+  }
+
+  Result<NodePtr> operator()(const NotExpression& expr) {
+    ARROW_ASSIGN_OR_RAISE(auto operand, Translate(*expr.operand()));
+    return TreeExprBuilder::MakeFunction("not", {std::move(operand)}, boolean());
+  }
+
+  Result<NodePtr> operator()(const IsValidExpression& expr) {
+    ARROW_ASSIGN_OR_RAISE(auto operand, Translate(*expr.operand()));
+    return TreeExprBuilder::MakeFunction("isnotnull", {std::move(operand)}, boolean());
+  }
+
+  Result<NodePtr> operator()(const ComparisonExpression& expr) {
+    ARROW_ASSIGN_OR_RAISE(auto lhs, Translate(*expr.left_operand()));
+    ARROW_ASSIGN_OR_RAISE(auto rhs, Translate(*expr.right_operand()));
+    std::string function;
+    switch (expr.op()) {
+      case compute::CompareOperator::EQUAL:
+        function = "equal";
+        break;
+      case compute::CompareOperator::NOT_EQUAL:
+        function = "not_equal";
+        break;
+      case compute::CompareOperator::GREATER:
+        function = "greater_than";
+        break;
+      case compute::CompareOperator::GREATER_EQUAL:
+        function = "greater_than_or_equal_to";
+        break;
+      case compute::CompareOperator::LESS:
+        function = "less_than";
+        break;
+      case compute::CompareOperator::LESS_EQUAL:
+        function = "less_than_or_equal_to";
+        break;
+    }
+    return TreeExprBuilder::MakeFunction(function, {std::move(lhs), std::move(rhs)},
+                                         boolean());
+  }
+
+  Result<NodePtr> operator()(const InExpression& expr) {
+    const auto& set = *expr.set();
+    // compute::IsIn matches null operands against nulls in the set, which Gandiva
+    // doesn't support
+    if (set.null_count() != 0) {
+      return NotTranslatable(expr);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto operand, Translate(*expr.operand()));
+
+    NodePtr in;
+    switch (set.type_id()) {
+      case Type::INT32: {
+        const auto& values = checked_cast<const Int32Array&>(set);
+        std::unordered_set<int32_t> constants(values.raw_values(),
+                                              values.raw_values() + values.length());
+        in = TreeExprBuilder::MakeInExpressionInt32(operand, constants);
+        break;
+      }
+      case Type::INT64: {
+        const auto& values = checked_cast<const Int64Array&>(set);
+        std::unordered_set<int64_t> constants(values.raw_values(),
+                                              values.raw_values() + values.length());
+        in = TreeExprBuilder::MakeInExpressionInt64(operand, constants);
+        break;
+      }
+      case Type::STRING:
+      case Type::BINARY: {
+        const auto& values = checked_cast<const BinaryArray&>(set);
+        std::unordered_set<std::string> constants;
+        for (int64_t i = 0; i < values.length(); ++i) {
+          constants.insert(values.GetString(i));
+        }
+        in = set.type_id() == Type::STRING
+                 ? TreeExprBuilder::MakeInExpressionString(operand, constants)
+                 : TreeExprBuilder::MakeInExpressionBinary(operand, constants);
+        break;
+      }
+      default:
+        return NotTranslatable(expr);
+    }
+
+    // Gandiva yields false for null operands where compute::IsIn yields null
+    auto is_valid = TreeExprBuilder::MakeFunction("isnotnull", {operand}, boolean());
+    return TreeExprBuilder::MakeIf(std::move(is_valid), std::move(in),
+                                   TreeExprBuilder::MakeNull(boolean()), boolean());
+  }
+
+  Result<NodePtr> operator()(const CastExpression& expr) {
+    ARROW_ASSIGN_OR_RAISE(auto from_type, expr.operand()->Validate(schema));
+    ARROW_ASSIGN_OR_RAISE(auto to_type, expr.Validate(schema));
+    ARROW_ASSIGN_OR_RAISE(auto operand, Translate(*expr.operand()));
+    if (from_type->Equals(*to_type)) {
+      return operand;
+    }
+
+    // Only translate the widening casts, which never fail or lose precision
+    std::string function;
+    if (to_type->id() == Type::INT64 && from_type->id() == Type::INT32) {
+      function = "castBIGINT";
+    } else if (to_type->id() == Type::DOUBLE &&
+               (from_type->id() == Type::INT32 || from_type->id() == Type::FLOAT)) {
+      function = "castFLOAT8";
+    } else {
+      return NotTranslatable(expr);
+    }
+    return TreeExprBuilder::MakeFunction(function, {std::move(operand)},
+                                         std::move(to_type));
+  }
+
+  Result<NodePtr> operator()(const Expression& expr) const {
+    return NotTranslatable(expr);
+  }
+
+  Result<NodePtr> Translate(const Expression& expr) {
+    return VisitExpression(expr, *this);
+  }
+
+  static Status NotTranslatable(const Expression& expr) {
+    return Status::NotImplemented("Translation of ", expr.ToString(), " to Gandiva");
+  }
+
+  const Schema& schema;
+  bool has_fields = false;
+};
+
+// Compile a projector evaluating expr, or return null if expr cannot be
+// evaluated with Gandiva.
+std::shared_ptr<gandiva::Projector> MakeProjector(const Expression& expr,
+                                                  const std::shared_ptr<Schema>& schema) {
+  auto maybe_type = expr.Validate(*schema);
+  if (!maybe_type.ok()) {
+    return nullptr;
+  }
+  GandivaTranslator translator(*schema);
+  auto maybe_root = translator.Translate(expr);
+  // Evaluating expressions without fields, such as literals, is trivial
+  if (!maybe_root.ok() || !translator.has_fields) {
+    return nullptr;
+  }
+
+  auto gandiva_expr = TreeExprBuilder::MakeExpression(
+      maybe_root.ValueOrDie(), field("out", maybe_type.ValueOrDie()));
+  std::shared_ptr<gandiva::Projector> projector;
+  if (!gandiva::Projector::Make(schema, {gandiva_expr}, &projector).ok()) {
+    return nullptr;
+  }
+  return projector;
+}
+
+}  // namespace
+
+class GandivaEvaluator::ProjectorCache {
+ public:
+  // Return the projector evaluating expr against batches of schema, or null if
+  // expr must be evaluated by the TreeEvaluator.
+  std::shared_ptr<gandiva::Projector> Get(const Expression& expr,
+                                          const std::shared_ptr<Schema>& schema) {
+    auto maybe_serialized = expr.Serialize();
+    if (!maybe_serialized.ok()) {
+      // Custom expressions cannot be serialized, nor translated
+      return nullptr;
+    }
+    std::string key = maybe_serialized.ValueOrDie()->ToString();
+    key += '\0';
+    key += schema->ToString();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = projectors_.find(key);
+      if (it != projectors_.end()) {
+        return it->second;
+      }
+    }
+
+    // Compile outside of the lock, so as not to block evaluation of other
+    // expressions meanwhile
+    auto projector = MakeProjector(expr, schema);
+    std::lock_guard<std::mutex> lock(mutex_);
+    return projectors_.emplace(std::move(key), std::move(projector)).first->second;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::shared_ptr<gandiva::Projector>> projectors_;
+};
+
+GandivaEvaluator::GandivaEvaluator() : projectors_(new ProjectorCache) {}
+
+GandivaEvaluator::~GandivaEvaluator() = default;
+
+Result<Datum> GandivaEvaluator::Evaluate(const Expression& expr,
+                                         const RecordBatch& batch,
+                                         MemoryPool* pool) const {
+  auto projector = projectors_->Get(expr, batch.schema());
+  if (projector == nullptr) {
+    return TreeEvaluator::Evaluate(expr, batch, pool);
+  }
+
+  ArrayVector outputs;
+  RETURN_NOT_OK(projector->Evaluate(batch, pool, &outputs));
+  return Datum(std::move(outputs[0]));
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,54 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief An ExpressionEvaluator compiling expressions with Gandiva
+///
+/// Expressions are translated to Gandiva expression trees and compiled by LLVM into
+/// a projector, which is cached for each distinct expression and schema. Expressions
+/// which cannot be translated or compiled (for instance referencing dictionary or
+/// absent columns, or custom expressions) are evaluated as by TreeEvaluator, whose
+/// subexpressions are in turn evaluated with Gandiva where possible.
+///
+/// \note Only available if Arrow was built with ARROW_GANDIVA=ON.
+class ARROW_DS_EXPORT GandivaEvaluator : public TreeEvaluator {
+ public:
+  GandivaEvaluator();
+  ~GandivaEvaluator() override;
+
+  Result<Datum> Evaluate(const Expression& expr, const RecordBatch& batch,
+                         MemoryPool* pool) const override;
+
+  using ExpressionEvaluator::Evaluate;
+
+ private:
+  class ProjectorCache;
+  std::unique_ptr<ProjectorCache> projectors_;
+};
+
+}  // namespace dataset
+}  // namespace arrow
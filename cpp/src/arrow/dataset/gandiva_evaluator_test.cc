@@ -0,0 +1,123 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/gandiva_evaluator.h"
+
+#include <cstdint>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "arrow/dataset/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace dataset {
+
+// clang-format off
+using string_literals::operator"" _;
+// clang-format on
+
+class TestGandivaEvaluator : public ::testing::Test {
+ public:
+  void SetUp() override {
+    random::RandomArrayGenerator rng(0x5eed);
+    batch_ = RecordBatch::Make(
+        schema({field("a", int32()), field("b", float64()), field("c", int64()),
+                field("d", boolean()), field("s", utf8())}),
+        kLength,
+        {rng.Int32(kLength, 0, 10, 0.1), rng.Float64(kLength, -5.0, 5.0, 0.1),
+         rng.Int64(kLength, 0, 10, 0.3), rng.Boolean(kLength, 0.5, 0.2),
+         rng.String(kLength, 0, 2, 0.1)});
+  }
+
+  // Evaluating with Gandiva must give the same results as the TreeEvaluator,
+  // including for expressions which are (partially) evaluated by the latter.
+  void AssertEvaluatesAsTree(const Expression& expr) {
+    SCOPED_TRACE(expr.ToString());
+    ASSERT_OK_AND_ASSIGN(Datum expected, tree_->Evaluate(expr, *batch_));
+    // Evaluate twice to exercise the cached projector
+    for (int i = 0; i < 2; ++i) {
+      ASSERT_OK_AND_ASSIGN(Datum actual, evaluator_->Evaluate(expr, *batch_));
+      AssertDatumsEqual(ToArray(expected), ToArray(actual));
+    }
+  }
+
+ protected:
+  static constexpr int64_t kLength = 1000;
+
+  Datum ToArray(const Datum& datum) {
+    if (datum.is_scalar()) {
+      return MakeArrayFromScalar(*datum.scalar(), kLength).ValueOrDie();
+    }
+    return datum;
+  }
+
+  std::shared_ptr<ExpressionEvaluator> evaluator_ = std::make_shared<GandivaEvaluator>();
+  std::shared_ptr<ExpressionEvaluator> tree_ = std::make_shared<TreeEvaluator>();
+  std::shared_ptr<RecordBatch> batch_;
+};
+
+constexpr int64_t TestGandivaEvaluator::kLength;
+
+TEST_F(TestGandivaEvaluator, Basics) {
+  AssertEvaluatesAsTree("a"_ == 3);
+  AssertEvaluatesAsTree("a"_ != 3 and "b"_ > 0.0);
+  AssertEvaluatesAsTree(("a"_ > 5 and "b"_ < 1.0) or not "c"_.IsValid());
+  AssertEvaluatesAsTree("c"_ >= int64_t(2) or "d"_);
+  AssertEvaluatesAsTree(not "d"_);
+  AssertEvaluatesAsTree("s"_ == "a" or "s"_ < "b");
+  AssertEvaluatesAsTree("s"_.IsValid());
+}
+
+TEST_F(TestGandivaEvaluator, In) {
+  AssertEvaluatesAsTree("a"_.In(ArrayFromJSON(int32(), "[1, 3, 5]")));
+  AssertEvaluatesAsTree("c"_.In(ArrayFromJSON(int64(), "[0, 9]")));
+  AssertEvaluatesAsTree("s"_.In(ArrayFromJSON(utf8(), R"(["", "a", "bc"])")));
+  // Evaluated by the TreeEvaluator, as the set contains null
+  AssertEvaluatesAsTree("a"_.In(ArrayFromJSON(int32(), "[1, null]")));
+}
+
+TEST_F(TestGandivaEvaluator, Cast) {
+  AssertEvaluatesAsTree("a"_.CastTo(float64()) == 2.0);
+  AssertEvaluatesAsTree("a"_.CastTo(int64()) == "c"_);
+  // Evaluated by the TreeEvaluator, as the cast may overflow
+  AssertEvaluatesAsTree("c"_.CastTo(int8()) == int8_t(1));
+}
+
+TEST_F(TestGandivaEvaluator, FallBackToTreeEvaluator) {
+  AssertEvaluatesAsTree(*scalar(true));
+  AssertEvaluatesAsTree("absent"_ == 0);
+  AssertEvaluatesAsTree("absent"_ == 0 or "a"_ < 2);
+}
+
+TEST_F(TestGandivaEvaluator, Filter) {
+  auto expr = "a"_ > 5 and "s"_ != "";
+  ASSERT_OK_AND_ASSIGN(Datum selection, evaluator_->Evaluate(expr, *batch_));
+  ASSERT_OK_AND_ASSIGN(auto actual, evaluator_->Filter(selection, batch_));
+
+  ASSERT_OK_AND_ASSIGN(selection, tree_->Evaluate(expr, *batch_));
+  ASSERT_OK_AND_ASSIGN(auto expected, tree_->Filter(selection, batch_));
+  AssertBatchesEqual(*expected, *actual);
+}
+
+}  // namespace dataset
+}  // namespace arrow
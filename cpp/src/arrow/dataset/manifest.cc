@@ -0,0 +1,195 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/manifest.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/buffer.h"
+#include "arrow/dataset/statistics_internal.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/dictionary.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+#include "arrow/util/base64.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/key_value_metadata.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace dataset {
+
+namespace {
+
+constexpr char kSchemaKey[] = "ARROW:schema";
+constexpr char kPhysicalSchemaKey[] = "ARROW:physical_schema";
+
+// The columns preceding the statistics columns.
+constexpr int kNumEntryColumns = 4;
+
+Result<std::string> EncodeSchema(const Schema& schema) {
+  ARROW_ASSIGN_OR_RAISE(auto serialized, ipc::SerializeSchema(schema));
+  return util::base64_encode(serialized->data(),
+                             static_cast<unsigned int>(serialized->size()));
+}
+
+Result<std::shared_ptr<Schema>> DecodeSchema(const std::string& encoded) {
+  io::BufferReader input(Buffer::FromString(util::base64_decode(encoded)));
+  ipc::DictionaryMemo dictionary_memo;
+  return ipc::ReadSchema(&input, &dictionary_memo);
+}
+
+Status AppendSizeOrNull(Int64Builder* builder, int64_t size) {
+  return size < 0 ? builder->AppendNull() : builder->Append(size);
+}
+
+int64_t SizeOrUnknown(const Int64Array& sizes, int64_t row) {
+  return sizes.IsValid(row) ? sizes.Value(row) : -1;
+}
+
+}  // namespace
+
+Status WriteDatasetManifest(fs::FileSystem* filesystem, const std::string& path,
+                            const DatasetManifest& manifest) {
+  if (manifest.schema == nullptr) {
+    return Status::Invalid("Cannot write a manifest without a dataset schema");
+  }
+
+  StringBuilder paths;
+  Int64Builder sizes, num_rows;
+  BinaryBuilder partitions;
+  std::vector<const ColumnStatisticsVector*> statistics;
+
+  for (const auto& file : manifest.files) {
+    RETURN_NOT_OK(paths.Append(file.path));
+    RETURN_NOT_OK(AppendSizeOrNull(&sizes, file.size));
+    RETURN_NOT_OK(AppendSizeOrNull(&num_rows, file.num_rows));
+    ARROW_ASSIGN_OR_RAISE(auto partition, file.partition_expression->Serialize());
+    RETURN_NOT_OK(partitions.Append(partition->data(), partition->size()));
+    statistics.push_back(&file.statistics);
+  }
+
+  FieldVector fields = {field("path", utf8()), field("size", int64()),
+                        field("num_rows", int64()), field("partition", binary())};
+  ArrayVector columns(kNumEntryColumns);
+  RETURN_NOT_OK(paths.Finish(&columns[0]));
+  RETURN_NOT_OK(sizes.Finish(&columns[1]));
+  RETURN_NOT_OK(num_rows.Finish(&columns[2]));
+  RETURN_NOT_OK(partitions.Finish(&columns[3]));
+  RETURN_NOT_OK(MakeStatisticsColumns(statistics, &fields, &columns));
+
+  std::vector<std::string> keys = {kSchemaKey}, values(1);
+  ARROW_ASSIGN_OR_RAISE(values[0], EncodeSchema(*manifest.schema));
+  if (manifest.physical_schema != nullptr) {
+    keys.emplace_back(kPhysicalSchemaKey);
+    ARROW_ASSIGN_OR_RAISE(auto physical_schema,
+                          EncodeSchema(*manifest.physical_schema));
+    values.push_back(std::move(physical_schema));
+  }
+
+  auto manifest_schema = schema(std::move(fields), key_value_metadata(keys, values));
+  auto batch = RecordBatch::Make(manifest_schema,
+                                 static_cast<int64_t>(manifest.files.size()),
+                                 std::move(columns));
+
+  ARROW_ASSIGN_OR_RAISE(auto destination, filesystem->OpenOutputStream(path));
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        ipc::MakeFileWriter(destination.get(), manifest_schema));
+  RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  RETURN_NOT_OK(writer->Close());
+  return destination->Close();
+}
+
+Result<DatasetManifest> ReadDatasetManifest(fs::FileSystem* filesystem,
+                                            const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto input, filesystem->OpenInputFile(path));
+  ARROW_ASSIGN_OR_RAISE(auto reader, ipc::RecordBatchFileReader::Open(input.get()));
+
+  auto manifest_schema = reader->schema();
+  auto expected_entry_schema =
+      schema({field("path", utf8()), field("size", int64()), field("num_rows", int64()),
+              field("partition", binary())});
+  if (manifest_schema->num_fields() < kNumEntryColumns) {
+    return Status::Invalid("Manifest ", path, " had too few columns: ",
+                           manifest_schema->ToString());
+  }
+  for (int i = 0; i < kNumEntryColumns; ++i) {
+    if (!manifest_schema->field(i)->Equals(expected_entry_schema->field(i))) {
+      return Status::Invalid("Manifest ", path, " had an invalid column ",
+                             manifest_schema->field(i)->ToString(), ", expected ",
+                             expected_entry_schema->field(i)->ToString());
+    }
+  }
+  RETURN_NOT_OK(CheckStatisticsColumns(*manifest_schema, kNumEntryColumns, path));
+
+  DatasetManifest manifest;
+  const auto& metadata = manifest_schema->metadata();
+  int schema_index = metadata ? metadata->FindKey(kSchemaKey) : -1;
+  if (schema_index == -1) {
+    return Status::Invalid("Manifest ", path, " did not contain a dataset schema");
+  }
+  ARROW_ASSIGN_OR_RAISE(manifest.schema, DecodeSchema(metadata->value(schema_index)));
+
+  int physical_schema_index = metadata->FindKey(kPhysicalSchemaKey);
+  if (physical_schema_index != -1) {
+    ARROW_ASSIGN_OR_RAISE(manifest.physical_schema,
+                          DecodeSchema(metadata->value(physical_schema_index)));
+  }
+
+  for (int batch_index = 0; batch_index < reader->num_record_batches(); ++batch_index) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, reader->ReadRecordBatch(batch_index));
+    const auto& paths = checked_cast<const StringArray&>(*batch->column(0));
+    const auto& sizes = checked_cast<const Int64Array&>(*batch->column(1));
+    const auto& num_rows = checked_cast<const Int64Array&>(*batch->column(2));
+    const auto& partitions = checked_cast<const BinaryArray&>(*batch->column(3));
+
+    for (int64_t row = 0; row < batch->num_rows(); ++row) {
+      if (paths.IsNull(row)) {
+        return Status::Invalid("Manifest ", path, " contained a null path");
+      }
+
+      ManifestEntry entry;
+      entry.path = paths.GetString(row);
+      entry.size = SizeOrUnknown(sizes, row);
+      entry.num_rows = SizeOrUnknown(num_rows, row);
+      if (partitions.IsValid(row)) {
+        ARROW_ASSIGN_OR_RAISE(entry.partition_expression,
+                              Expression::Deserialize(Buffer(partitions.GetView(row))));
+      }
+      ARROW_ASSIGN_OR_RAISE(entry.statistics,
+                            StatisticsFromColumns(*batch, kNumEntryColumns, row));
+      manifest.files.push_back(std::move(entry));
+    }
+  }
+
+  return manifest;
+}
+
+}  // namespace dataset
+}  // namespace arrow
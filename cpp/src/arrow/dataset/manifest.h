@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/statistics.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/filesystem/type_fwd.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief Description of a single file of a dataset, as recorded in a manifest.
+struct ARROW_DS_EXPORT ManifestEntry {
+  /// The path of the file, relative to the directory containing the manifest.
+  std::string path;
+
+  /// The size of the file in bytes, or -1 if unknown.
+  int64_t size = -1;
+
+  /// The number of rows in the file, or -1 if unknown.
+  int64_t num_rows = -1;
+
+  /// The partition expression of the file.
+  std::shared_ptr<Expression> partition_expression = scalar(true);
+
+  /// Statistics summarizing the columns of the file.
+  ColumnStatisticsVector statistics;
+};
+
+/// \brief Everything needed to reconstruct a FileSystemDataset without listing its
+/// directory or inspecting its files.
+struct ARROW_DS_EXPORT DatasetManifest {
+  /// The schema of the dataset, including partition fields.
+  std::shared_ptr<Schema> schema;
+
+  /// The schema of every file, or nullptr if the files' schemas differ.
+  std::shared_ptr<Schema> physical_schema;
+
+  std::vector<ManifestEntry> files;
+};
+
+/// \brief The basename of the manifest written by FileSystemDataset::Write.
+constexpr char kManifestBasename[] = "_manifest.arrow";
+
+/// \brief Write a manifest: an IPC file containing a row for each file with columns
+/// "path", "size", "num_rows" and "partition" (the serialized partition expression),
+/// followed by a statistics column for each summarized field as in the statistics
+/// sidecar. The schemas are stored base64 encoded in the file's metadata.
+ARROW_DS_EXPORT
+Status WriteDatasetManifest(fs::FileSystem* filesystem, const std::string& path,
+                            const DatasetManifest& manifest);
+
+/// \brief Read a manifest written by WriteDatasetManifest.
+ARROW_DS_EXPORT
+Result<DatasetManifest> ReadDatasetManifest(fs::FileSystem* filesystem,
+                                            const std::string& path);
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,196 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/manifest.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/discovery.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/file_ipc.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/partition.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/key_value_metadata.h"
+
+namespace arrow {
+
+using internal::checked_pointer_cast;
+
+namespace dataset {
+
+class TestDatasetManifest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(fs_, fs::internal::MockFileSystem::Make(fs::kNoTime, {}));
+    ASSERT_OK(fs_->CreateDir("ds"));
+  }
+
+ protected:
+  std::shared_ptr<fs::FileSystem> fs_;
+};
+
+TEST_F(TestDatasetManifest, RoundTrip) {
+  DatasetManifest manifest;
+  manifest.schema = schema({field("i32", int32()), field("part", utf8())},
+                           key_value_metadata({"key"}, {"value"}));
+  manifest.physical_schema = schema({field("i32", int32())});
+
+  ManifestEntry first;
+  first.path = "part=a/0.arrow";
+  first.size = 1024;
+  first.num_rows = 10;
+  first.partition_expression = equal(field_ref("part"), scalar("a"));
+  ColumnStatistics i32;
+  i32.name = "i32";
+  i32.min = MakeScalar(int32_t(-3));
+  i32.max = MakeScalar(int32_t(7));
+  i32.null_count = 2;
+  first.statistics = {i32};
+
+  // size, row count, partition and statistics unknown
+  ManifestEntry second;
+  second.path = "1.arrow";
+
+  manifest.files = {first, second};
+  ASSERT_OK(WriteDatasetManifest(fs_.get(), "ds/_manifest.arrow", manifest));
+  ASSERT_OK_AND_ASSIGN(auto read, ReadDatasetManifest(fs_.get(), "ds/_manifest.arrow"));
+
+  AssertSchemaEqual(*manifest.schema, *read.schema, /*check_metadata=*/true);
+  AssertSchemaEqual(*manifest.physical_schema, *read.physical_schema);
+  ASSERT_EQ(read.files.size(), 2);
+
+  EXPECT_EQ(read.files[0].path, first.path);
+  EXPECT_EQ(read.files[0].size, 1024);
+  EXPECT_EQ(read.files[0].num_rows, 10);
+  EXPECT_TRUE(read.files[0].partition_expression->Equals(*first.partition_expression));
+  ASSERT_EQ(read.files[0].statistics.size(), 1);
+  EXPECT_EQ(read.files[0].statistics[0].name, "i32");
+  AssertScalarsEqual(*i32.min, *read.files[0].statistics[0].min);
+  AssertScalarsEqual(*i32.max, *read.files[0].statistics[0].max);
+  EXPECT_EQ(read.files[0].statistics[0].null_count, 2);
+
+  EXPECT_EQ(read.files[1].path, second.path);
+  EXPECT_EQ(read.files[1].size, -1);
+  EXPECT_EQ(read.files[1].num_rows, -1);
+  EXPECT_TRUE(read.files[1].partition_expression->Equals(true));
+  EXPECT_TRUE(read.files[1].statistics.empty());
+
+  manifest.physical_schema = nullptr;
+  ASSERT_OK(WriteDatasetManifest(fs_.get(), "ds/_manifest.arrow", manifest));
+  ASSERT_OK_AND_ASSIGN(read, ReadDatasetManifest(fs_.get(), "ds/_manifest.arrow"));
+  EXPECT_EQ(read.physical_schema, nullptr);
+
+  // a statistics sidecar is not a manifest
+  ASSERT_OK(WriteStatisticsSidecar(fs_.get(), "ds/_statistics.arrow", {}));
+  ASSERT_RAISES(Invalid, ReadDatasetManifest(fs_.get(), "ds/_statistics.arrow"));
+}
+
+TEST_F(TestDatasetManifest, WriteAndReopen) {
+  auto schm = schema({field("value", int64()), field("part", int32())});
+  RecordBatchVector batches = {
+      RecordBatch::Make(schm, 4,
+                        {ArrayFromJSON(int64(), "[1, 100, 9, null]"),
+                         ArrayFromJSON(int32(), "[0, 1, 0, 2]")}),
+      RecordBatch::Make(schm, 3,
+                        {ArrayFromJSON(int64(), "[150, 1000, 5]"),
+                         ArrayFromJSON(int32(), "[1, 2, 0]")}),
+  };
+  auto format = std::make_shared<IpcFileFormat>();
+
+  FileSystemDatasetWriteOptions write_options;
+  write_options.file_write_options = format->DefaultWriteOptions();
+  write_options.filesystem = fs_;
+  write_options.base_dir = "ds";
+  write_options.partitioning =
+      std::make_shared<DirectoryPartitioning>(schema({field("part", int32())}));
+  write_options.basename_template = "dat_{i}.arrow";
+  write_options.write_manifest = true;
+
+  auto dataset = std::make_shared<InMemoryDataset>(schm, batches);
+  auto scanner = std::make_shared<Scanner>(dataset, ScanOptions::Make(schm),
+                                           std::make_shared<ScanContext>());
+  ASSERT_OK(FileSystemDataset::Write(write_options, scanner));
+
+  ASSERT_OK_AND_ASSIGN(auto factory,
+                       ManifestDatasetFactory::Make("ds/_manifest.arrow", fs_, format));
+  const auto& manifest =
+      checked_pointer_cast<ManifestDatasetFactory>(factory)->manifest();
+  AssertSchemaEqual(*schm, *manifest.schema);
+  AssertSchemaEqual(*schema({field("value", int64())}), *manifest.physical_schema);
+  ASSERT_EQ(manifest.files.size(), 3);
+  std::vector<int64_t> num_rows;
+  for (const auto& entry : manifest.files) {
+    ASSERT_OK_AND_ASSIGN(auto info, fs_->GetFileInfo("ds/" + entry.path));
+    EXPECT_EQ(entry.size, info.size());
+    num_rows.push_back(entry.num_rows);
+  }
+  EXPECT_EQ(manifest.files[0].path, "0/dat_0.arrow");
+  EXPECT_TRUE(manifest.files[0].partition_expression->Equals(
+      *equal(field_ref("part"), scalar(int32_t(0)))));
+  EXPECT_EQ(num_rows, (std::vector<int64_t>{3, 2, 2}));
+
+  ASSERT_OK_AND_ASSIGN(auto reopened, factory->Finish());
+  AssertSchemaEqual(*schm, *reopened->schema());
+  EXPECT_EQ(checked_pointer_cast<FileSystemDataset>(reopened)->files(),
+            (std::vector<std::string>{"ds/0/dat_0.arrow", "ds/1/dat_1.arrow",
+                                      "ds/2/dat_2.arrow"}));
+
+  ScannerBuilder builder(reopened, std::make_shared<ScanContext>());
+  ASSERT_OK(builder.Filter(greater(field_ref("value"), scalar(int64_t(120)))));
+  ASSERT_OK_AND_ASSIGN(auto filtered, builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto fragments, filtered->GetFragments().ToVector());
+  EXPECT_EQ(fragments.size(), 2);
+  ASSERT_OK_AND_ASSIGN(auto table, filtered->ToTable());
+  EXPECT_EQ(table->num_rows(), 2);
+
+  // Reopening touches nothing but the manifest
+  for (const auto& path : {"ds/0/dat_0.arrow", "ds/1/dat_1.arrow", "ds/2/dat_2.arrow"}) {
+    ASSERT_OK(fs_->DeleteFile(path));
+  }
+  ASSERT_OK_AND_ASSIGN(factory,
+                       ManifestDatasetFactory::Make("ds/_manifest.arrow", fs_, format));
+  ASSERT_OK_AND_ASSIGN(reopened, factory->Finish());
+  EXPECT_EQ(checked_pointer_cast<FileSystemDataset>(reopened)->files().size(), 3);
+
+  // ... and so do scans of partition fields only, given the files' row counts
+  builder = ScannerBuilder(reopened, std::make_shared<ScanContext>());
+  ASSERT_OK(builder.Project({"part"}));
+  ASSERT_OK(builder.Filter(not_(equal(field_ref("part"), scalar(int32_t(1))))));
+  ASSERT_OK_AND_ASSIGN(auto partitions, builder.Finish());
+  ASSERT_OK_AND_ASSIGN(table, partitions->ToTable());
+  AssertTablesEqual(*Table::Make(schema({field("part", int32())}),
+                                 {ArrayFromJSON(int32(), "[0, 0, 0, 2, 2]")}),
+                    *table, /*same_chunk_layout=*/false);
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -17,23 +17,72 @@
 
 #include "arrow/dataset/projector.h"
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/util.h"
+#include "arrow/compare.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace dataset {
 
+namespace {
+
+// Whether `to` can be produced from `from` by removing children of (possibly nested)
+// structs.
+bool IsPrunedStruct(const DataType& from, const DataType& to) {
+  if (from.id() != Type::STRUCT || to.id() != Type::STRUCT) {
+    return false;
+  }
+  const auto& from_struct = checked_cast<const StructType&>(from);
+  for (const auto& to_child : to.fields()) {
+    auto from_child = from_struct.GetFieldByName(to_child->name());
+    if (from_child == nullptr || from_child->nullable() != to_child->nullable()) {
+      return false;
+    }
+    if (!from_child->type()->Equals(to_child->type()) &&
+        !IsPrunedStruct(*from_child->type(), *to_child->type())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Select the children of a struct column named by `type`, without copying any buffer.
+std::shared_ptr<ArrayData> PruneStruct(const ArrayData& data,
+                                       const std::shared_ptr<DataType>& type) {
+  const auto& from_type = checked_cast<const StructType&>(*data.type);
+  auto out = data.Copy();
+  out->type = type;
+  out->child_data.clear();
+  for (const auto& child : type->fields()) {
+    const auto& child_data = data.child_data[from_type.GetFieldIndex(child->name())];
+    out->child_data.push_back(child_data->type->Equals(child->type())
+                                  ? child_data
+                                  : PruneStruct(*child_data, child->type()));
+  }
+  return out;
+}
+
+}  // namespace
+
 Status CheckProjectable(const Schema& from, const Schema& to) {
   for (const auto& to_field : to.fields()) {
     ARROW_ASSIGN_OR_RAISE(auto from_field, FieldRef(to_field->name()).GetOneOrNone(from));
@@ -55,7 +104,8 @@ Status CheckProjectable(const Schema& from, const Schema& to) {
                                " in origin schema ", from);
     }
 
-    if (!from_field->type()->Equals(to_field->type())) {
+    if (!from_field->type()->Equals(to_field->type()) &&
+        !IsPrunedStruct(*from_field->type(), *to_field->type())) {
       return Status::TypeError("fields had matching names but differing types. From: ",
                                from_field->ToString(), " To: ", to_field->ToString());
     }
@@ -70,10 +120,82 @@ Status CheckProjectable(const Schema& from, const Schema& to) {
   return Status::OK();
 }
 
+// Columns to fill in for the fields absent from projected batches, all null or all
+// equal to a default value.  A single column is materialized per type and value and
+// each batch gets a zero-copy slice of it.  A column is regrown geometrically when
+// a longer batch comes, from the memory pool of that batch.
+class RecordBatchProjector::MissingColumnCache {
+ public:
+  Result<std::shared_ptr<Array>> Get(const std::shared_ptr<DataType>& type,
+                                     const std::shared_ptr<Scalar>& scalar,
+                                     int64_t length, MemoryPool* pool) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto& entries =
+        entries_[scalar == nullptr ? type->Hash() : Scalar::Hash::hash(*scalar)];
+    auto entry = std::find_if(entries.begin(), entries.end(), [&](const Entry& other) {
+      if (scalar == nullptr || other.scalar == nullptr) {
+        return scalar == other.scalar && other.type->Equals(*type);
+      }
+      return other.scalar->Equals(*scalar, EqualOptions().nans_equal(true));
+    });
+    if (entry == entries.end()) {
+      if (scalar != nullptr) {
+        // Default values vary by fragment (e.g. partition keys), don't hoard them
+        if (num_constants_ == kMaxConstants) EvictConstants();
+        ++num_constants_;
+      }
+      entries.push_back({type, scalar, nullptr});
+      entry = entries.end() - 1;
+    }
+
+    if (entry->array == nullptr || entry->array->length() < length) {
+      const int64_t new_length =
+          entry->array == nullptr ? length : std::max(length, 2 * entry->array->length());
+      if (scalar == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(entry->array, MakeArrayOfNull(type, new_length, pool));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(entry->array,
+                              MakeArrayFromScalar(*scalar, new_length, pool));
+      }
+    }
+    return entry->array->Slice(0, length);
+  }
+
+ private:
+  static constexpr int kMaxConstants = 64;
+
+  struct Entry {
+    std::shared_ptr<DataType> type;
+    // null for columns of nulls
+    std::shared_ptr<Scalar> scalar;
+    std::shared_ptr<Array> array;
+  };
+
+  void EvictConstants() {
+    for (auto& hash_entries : entries_) {
+      auto& entries = hash_entries.second;
+      entries.erase(
+          std::remove_if(entries.begin(), entries.end(),
+                         [](const Entry& entry) { return entry.scalar != nullptr; }),
+          entries.end());
+    }
+    num_constants_ = 0;
+  }
+
+  std::mutex mutex_;
+  // entries by hash of their scalar, or of their type for columns of nulls
+  std::unordered_map<size_t, std::vector<Entry>> entries_;
+  int num_constants_ = 0;
+};
+
+constexpr int RecordBatchProjector::MissingColumnCache::kMaxConstants;
+
 RecordBatchProjector::RecordBatchProjector(std::shared_ptr<Schema> to)
     : to_(std::move(to)),
-      missing_columns_(to_->num_fields(), nullptr),
+      missing_columns_(std::make_shared<MissingColumnCache>()),
       column_indices_(to_->num_fields(), kNoMatch),
+      prune_columns_(to_->num_fields(), false),
       scalars_(to_->num_fields(), nullptr) {}
 
 Status RecordBatchProjector::SetDefaultValue(FieldRef ref,
@@ -103,17 +225,18 @@ Result<std::shared_ptr<RecordBatch>> RecordBatchProjector::Project(
     RETURN_NOT_OK(SetInputSchema(batch.schema(), pool));
   }
 
-  if (missing_columns_length_ < batch.num_rows()) {
-    RETURN_NOT_OK(ResizeMissingColumns(batch.num_rows(), pool));
-  }
-
   ArrayVector columns(to_->num_fields());
 
   for (int i = 0; i < to_->num_fields(); ++i) {
-    if (column_indices_[i] != kNoMatch) {
+    if (prune_columns_[i]) {
+      columns[i] = MakeArray(
+          PruneStruct(*batch.column_data(column_indices_[i]), to_->field(i)->type()));
+    } else if (column_indices_[i] != kNoMatch) {
       columns[i] = batch.column(column_indices_[i]);
     } else {
-      columns[i] = missing_columns_[i]->Slice(0, batch.num_rows());
+      ARROW_ASSIGN_OR_RAISE(columns[i],
+                            missing_columns_->Get(to_->field(i)->type(), scalars_[i],
+                                                  batch.num_rows(), pool));
     }
   }
 
@@ -131,40 +254,19 @@ Status RecordBatchProjector::SetInputSchema(std::shared_ptr<Schema> from,
 
     if (match.indices().empty() ||
         from_->field(match.indices()[0])->type()->id() == Type::NA) {
-      // Mark column i as missing by setting missing_columns_[i]
-      // to a non-null placeholder.
-      ARROW_ASSIGN_OR_RAISE(missing_columns_[i],
-                            MakeArrayOfNull(to_->field(i)->type(), 0, pool));
+      // Column i is missing, it will be filled in from missing_columns_
       column_indices_[i] = kNoMatch;
+      prune_columns_[i] = false;
     } else {
-      // Mark column i as not missing by setting missing_columns_[i] to nullptr
-      missing_columns_[i] = nullptr;
       column_indices_[i] = match.indices()[0];
+      // Nested fields which weren't projected must be dropped from struct columns
+      prune_columns_[i] =
+          !from_->field(column_indices_[i])->type()->Equals(to_->field(i)->type());
     }
   }
   return Status::OK();
 }
 
-Status RecordBatchProjector::ResizeMissingColumns(int64_t new_length, MemoryPool* pool) {
-  // TODO(bkietz) MakeArrayOfNull could use fewer buffers by reusing a single zeroed
-  // buffer for every buffer in every column which is null
-  for (int i = 0; i < to_->num_fields(); ++i) {
-    if (missing_columns_[i] == nullptr) {
-      continue;
-    }
-    if (scalars_[i] == nullptr) {
-      ARROW_ASSIGN_OR_RAISE(
-          missing_columns_[i],
-          MakeArrayOfNull(missing_columns_[i]->type(), new_length, pool));
-      continue;
-    }
-    ARROW_ASSIGN_OR_RAISE(missing_columns_[i],
-                          MakeArrayFromScalar(*scalars_[i], new_length, pool));
-  }
-  missing_columns_length_ = new_length;
-  return Status::OK();
-}
-
 constexpr int RecordBatchProjector::kNoMatch;
 
 }  // namespace dataset
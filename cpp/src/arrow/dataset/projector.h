@@ -29,6 +29,10 @@
 namespace arrow {
 namespace dataset {
 
+/// \brief Check whether batches of schema `from` can be projected to schema `to`.
+///
+/// A struct field of `to` may omit some of the children of its counterpart in `from`,
+/// which are then dropped by RecordBatchProjector.
 ARROW_DS_EXPORT Status CheckProjectable(const Schema& from, const Schema& to);
 
 /// \brief Project a RecordBatch to a given schema.
@@ -40,6 +44,10 @@ ARROW_DS_EXPORT Status CheckProjectable(const Schema& from, const Schema& to);
 /// RecordBatchProjector is most efficient when projecting record batches with a
 /// consistent schema (for example batches from a table), but it can project record
 /// batches having any schema.
+///
+/// Null and constant columns are materialized once per type and value, then sliced
+/// for each projected batch.  They are shared by copies of the projector, which may
+/// project batches concurrently.
 class ARROW_DS_EXPORT RecordBatchProjector {
  public:
   static constexpr int kNoMatch = -1;
@@ -61,13 +69,13 @@ class ARROW_DS_EXPORT RecordBatchProjector {
                         MemoryPool* pool = default_memory_pool());
 
  private:
-  Status ResizeMissingColumns(int64_t new_length, MemoryPool* pool);
+  class MissingColumnCache;
 
   std::shared_ptr<Schema> from_, to_;
-  int64_t missing_columns_length_ = 0;
+  std::shared_ptr<MissingColumnCache> missing_columns_;
   // these vectors are indexed parallel to to_->fields()
-  std::vector<std::shared_ptr<Array>> missing_columns_;
   std::vector<int> column_indices_;
+  std::vector<bool> prune_columns_;
   std::vector<std::shared_ptr<Scalar>> scalars_;
 };
 
@@ -0,0 +1,600 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/query.h"
+
+#include <mutex>
+#include <utility>
+
+#include "arrow/array/util.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/function.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/registry.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/table_builder.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/task_group.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
+namespace dataset {
+
+// A node of a plan, processing the morsels pushed by the previous node. Each task of
+// a running plan pushes its morsels with a state of its own.
+struct QueryPlan::Node {
+  struct LocalState {
+    virtual ~LocalState() = default;
+  };
+
+  explicit Node(std::shared_ptr<Schema> output_schema)
+      : output_schema(std::move(output_schema)) {}
+
+  virtual ~Node() = default;
+
+  virtual bool is_aggregate() const { return false; }
+
+  // Called each time the plan starts running, before any other method
+  virtual Status Init() { return Status::OK(); }
+
+  // Make the state with which a task pushes its morsels
+  virtual Result<std::unique_ptr<LocalState>> MakeLocalState() {
+    return std::unique_ptr<LocalState>();
+  }
+
+  // Process a morsel, returning the morsel to push to the next node, or null if there
+  // is none
+  virtual Result<std::shared_ptr<RecordBatch>> Push(std::shared_ptr<RecordBatch> morsel,
+                                                    LocalState* state) = 0;
+
+  // Called with the state of a task once it has pushed all its morsels, possibly
+  // concurrently with other tasks
+  virtual Status FinishLocalState(std::unique_ptr<LocalState> state) {
+    return Status::OK();
+  }
+
+  // Called once every task has finished, returning the node's last output or null
+  virtual Result<std::shared_ptr<RecordBatch>> Finish() {
+    return std::shared_ptr<RecordBatch>();
+  }
+
+  std::shared_ptr<Schema> output_schema;
+};
+
+namespace {
+
+using Node = QueryPlan::Node;
+
+class FilterNode : public Node {
+ public:
+  FilterNode(std::shared_ptr<Schema> schema, std::shared_ptr<Expression> filter,
+             std::shared_ptr<ExpressionEvaluator> evaluator, MemoryPool* pool)
+      : Node(std::move(schema)),
+        filter_(std::move(filter)),
+        evaluator_(std::move(evaluator)),
+        pool_(pool) {}
+
+  Result<std::shared_ptr<RecordBatch>> Push(std::shared_ptr<RecordBatch> morsel,
+                                            LocalState*) override {
+    ARROW_ASSIGN_OR_RAISE(Datum selection,
+                          evaluator_->Evaluate(*filter_, *morsel, pool_));
+    ARROW_ASSIGN_OR_RAISE(auto filtered, evaluator_->Filter(selection, morsel, pool_));
+    if (filtered->num_rows() == 0) {
+      return std::shared_ptr<RecordBatch>();
+    }
+    return filtered;
+  }
+
+ private:
+  std::shared_ptr<Expression> filter_;
+  std::shared_ptr<ExpressionEvaluator> evaluator_;
+  MemoryPool* pool_;
+};
+
+class ProjectNode : public Node {
+ public:
+  ProjectNode(std::shared_ptr<Schema> schema,
+              std::vector<std::shared_ptr<Expression>> exprs,
+              std::shared_ptr<ExpressionEvaluator> evaluator, MemoryPool* pool)
+      : Node(std::move(schema)),
+        exprs_(std::move(exprs)),
+        evaluator_(std::move(evaluator)),
+        pool_(pool) {}
+
+  Result<std::shared_ptr<RecordBatch>> Push(std::shared_ptr<RecordBatch> morsel,
+                                            LocalState*) override {
+    const int64_t num_rows = morsel->num_rows();
+    ArrayVector columns(exprs_.size());
+    for (size_t i = 0; i < exprs_.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(Datum value,
+                            evaluator_->Evaluate(*exprs_[i], *morsel, pool_));
+      if (value.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(columns[i],
+                              MakeArrayFromScalar(*value.scalar(), num_rows, pool_));
+      } else if (value.is_array()) {
+        columns[i] = value.make_array();
+      } else {
+        return Status::NotImplemented("Projecting DatumKind::", value.kind());
+      }
+
+      const auto& type = output_schema->field(static_cast<int>(i))->type();
+      if (!columns[i]->type()->Equals(*type)) {
+        return Status::TypeError("Expression ", exprs_[i]->ToString(), " evaluated to ",
+                                 *columns[i]->type(), ", expected ", *type);
+      }
+    }
+    return RecordBatch::Make(output_schema, num_rows, std::move(columns));
+  }
+
+ private:
+  std::vector<std::shared_ptr<Expression>> exprs_;
+  std::shared_ptr<ExpressionEvaluator> evaluator_;
+  MemoryPool* pool_;
+};
+
+// Aggregate all rows with ScalarAggregators, one per aggregation and per task,
+// merged as tasks finish
+class ScalarAggregateNode : public Node {
+ public:
+  struct State : public LocalState {
+    std::vector<std::unique_ptr<compute::ScalarAggregator>> aggregators;
+  };
+
+  static Result<std::shared_ptr<Node>> Make(const Schema& input_schema,
+                                            const std::vector<QueryAggregate>& aggregates,
+                                            MemoryPool* pool) {
+    compute::ExecContext ctx(pool);
+    std::shared_ptr<ScalarAggregateNode> node(new ScalarAggregateNode(pool));
+    FieldVector fields;
+    for (const auto& aggregate : aggregates) {
+      const int target = input_schema.GetFieldIndex(aggregate.target);
+      const auto& type = input_schema.field(target)->type();
+      ARROW_ASSIGN_OR_RAISE(
+          auto aggregator,
+          compute::ScalarAggregator::Make(aggregate.function, {ValueDescr::Array(type)},
+                                          aggregate.options, &ctx));
+
+      // The output type is that of the result of an empty aggregation
+      ARROW_ASSIGN_OR_RAISE(auto empty, aggregator->MakeEmpty());
+      ARROW_ASSIGN_OR_RAISE(Datum empty_result, empty->Finalize());
+      fields.push_back(field(aggregate.name.empty() ? aggregate.function : aggregate.name,
+                             empty_result.type()));
+
+      node->targets_.push_back(target);
+      node->prototypes_.push_back(std::move(aggregator));
+    }
+    node->output_schema = schema(std::move(fields));
+    return node;
+  }
+
+  bool is_aggregate() const override { return true; }
+
+  Status Init() override {
+    ARROW_ASSIGN_OR_RAISE(merged_, MakeState());
+    return Status::OK();
+  }
+
+  Result<std::unique_ptr<LocalState>> MakeLocalState() override {
+    ARROW_ASSIGN_OR_RAISE(auto state, MakeState());
+    return std::move(state);
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Push(std::shared_ptr<RecordBatch> morsel,
+                                            LocalState* raw_state) override {
+    auto state = checked_cast<State*>(raw_state);
+    for (size_t i = 0; i < targets_.size(); ++i) {
+      RETURN_NOT_OK(state->aggregators[i]->Consume({morsel->column(targets_[i])}));
+    }
+    return std::shared_ptr<RecordBatch>();
+  }
+
+  Status FinishLocalState(std::unique_ptr<LocalState> raw_state) override {
+    auto state = checked_cast<State*>(raw_state.get());
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < targets_.size(); ++i) {
+      RETURN_NOT_OK(
+          merged_->aggregators[i]->MergeFrom(std::move(*state->aggregators[i])));
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Finish() override {
+    ArrayVector columns(targets_.size());
+    for (size_t i = 0; i < targets_.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(Datum result, merged_->aggregators[i]->Finalize());
+      if (!result.is_scalar()) {
+        return Status::NotImplemented("Aggregation to DatumKind::", result.kind());
+      }
+      ARROW_ASSIGN_OR_RAISE(columns[i], MakeArrayFromScalar(*result.scalar(), 1, pool_));
+    }
+    return RecordBatch::Make(output_schema, 1, std::move(columns));
+  }
+
+ private:
+  explicit ScalarAggregateNode(MemoryPool* pool) : Node(nullptr), pool_(pool) {}
+
+  Result<std::unique_ptr<State>> MakeState() const {
+    auto state = ::arrow::internal::make_unique<State>();
+    for (const auto& prototype : prototypes_) {
+      ARROW_ASSIGN_OR_RAISE(auto aggregator, prototype->MakeEmpty());
+      state->aggregators.push_back(std::move(aggregator));
+    }
+    return std::move(state);
+  }
+
+  MemoryPool* pool_;
+  std::vector<int> targets_;
+  std::vector<std::unique_ptr<compute::ScalarAggregator>> prototypes_;
+
+  std::mutex mutex_;
+  std::unique_ptr<State> merged_;
+};
+
+// Aggregate the rows of each group of keys with the kernels of hash aggregate
+// functions. Each task assigns its own group ids; when it finishes its groups are
+// looked up in the merged Grouper, which maps them to the group ids of the merged
+// kernel states.
+class GroupedAggregateNode : public Node {
+ public:
+  struct State : public LocalState {
+    std::unique_ptr<compute::internal::Grouper> grouper;
+    std::vector<std::unique_ptr<compute::KernelState>> kernel_states;
+    std::vector<compute::KernelContext> kernel_ctxs;
+  };
+
+  static Result<std::shared_ptr<Node>> Make(const Schema& input_schema,
+                                            const std::vector<QueryAggregate>& aggregates,
+                                            const std::vector<std::string>& keys,
+                                            MemoryPool* pool) {
+    std::shared_ptr<GroupedAggregateNode> node(new GroupedAggregateNode(pool));
+    auto registry = node->ctx_.func_registry();
+    FieldVector fields;
+    for (const auto& aggregate : aggregates) {
+      const auto function_name = "hash_" + aggregate.function;
+      ARROW_ASSIGN_OR_RAISE(auto function, registry->GetFunction(function_name));
+      if (function->kind() != compute::Function::HASH_AGGREGATE) {
+        return Status::Invalid("The provided function (", function_name,
+                               ") is not a hash aggregate function");
+      }
+      const int target = input_schema.GetFieldIndex(aggregate.target);
+      std::vector<ValueDescr> in_descrs = {
+          ValueDescr::Array(input_schema.field(target)->type()),
+          ValueDescr::Array(uint32())};
+      ARROW_ASSIGN_OR_RAISE(
+          auto kernel, checked_cast<const compute::HashAggregateFunction&>(*function)
+                           .DispatchExact(in_descrs));
+
+      node->targets_.push_back(target);
+      node->kernels_.push_back(kernel);
+      node->in_descrs_.push_back(std::move(in_descrs));
+      node->options_.push_back(aggregate.options != nullptr
+                                   ? aggregate.options
+                                   : function->default_options());
+    }
+
+    for (const auto& key : keys) {
+      const int index = input_schema.GetFieldIndex(key);
+      node->keys_.push_back(index);
+      node->key_descrs_.push_back(ValueDescr::Array(input_schema.field(index)->type()));
+    }
+
+    // Resolve the output types against an initialized state, as GroupBy does
+    ARROW_ASSIGN_OR_RAISE(auto state, node->MakeState());
+    for (size_t i = 0; i < aggregates.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto out_descr,
+                            node->kernels_[i]->signature->out_type().Resolve(
+                                &state->kernel_ctxs[i], node->in_descrs_[i]));
+      fields.push_back(field(
+          aggregates[i].name.empty() ? aggregates[i].function : aggregates[i].name,
+          std::move(out_descr.type)));
+    }
+    for (size_t i = 0; i < keys.size(); ++i) {
+      fields.push_back(input_schema.field(node->keys_[i]));
+    }
+    node->output_schema = schema(std::move(fields));
+    return node;
+  }
+
+  bool is_aggregate() const override { return true; }
+
+  Status Init() override {
+    ARROW_ASSIGN_OR_RAISE(merged_, MakeState());
+    return Status::OK();
+  }
+
+  Result<std::unique_ptr<LocalState>> MakeLocalState() override {
+    ARROW_ASSIGN_OR_RAISE(auto state, MakeState());
+    return std::move(state);
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Push(std::shared_ptr<RecordBatch> morsel,
+                                            LocalState* raw_state) override {
+    auto state = checked_cast<State*>(raw_state);
+    const int64_t num_rows = morsel->num_rows();
+
+    std::vector<Datum> key_columns;
+    for (int key : keys_) {
+      key_columns.emplace_back(morsel->column(key));
+    }
+    ARROW_ASSIGN_OR_RAISE(Datum group_ids,
+                          state->grouper->Consume(compute::ExecBatch(key_columns,
+                                                                     num_rows)));
+
+    for (size_t i = 0; i < kernels_.size(); ++i) {
+      auto kernel_ctx = &state->kernel_ctxs[i];
+      kernels_[i]->resize(kernel_ctx, state->grouper->num_groups());
+      ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+      kernels_[i]->consume(
+          kernel_ctx,
+          compute::ExecBatch({morsel->column(targets_[i]), group_ids}, num_rows));
+      ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+    }
+    return std::shared_ptr<RecordBatch>();
+  }
+
+  Status FinishLocalState(std::unique_ptr<LocalState> raw_state) override {
+    auto state = checked_cast<State*>(raw_state.get());
+    if (state->grouper->num_groups() == 0) {
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(compute::ExecBatch uniques, state->grouper->GetUniques());
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ARROW_ASSIGN_OR_RAISE(Datum group_id_mapping, merged_->grouper->Consume(uniques));
+    for (size_t i = 0; i < kernels_.size(); ++i) {
+      auto kernel_ctx = &merged_->kernel_ctxs[i];
+      kernels_[i]->resize(kernel_ctx, merged_->grouper->num_groups());
+      ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+      kernels_[i]->merge(kernel_ctx, std::move(*state->kernel_states[i]),
+                         *group_id_mapping.array());
+      ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Finish() override {
+    const int64_t num_groups = merged_->grouper->num_groups();
+    ArrayVector columns;
+    for (size_t i = 0; i < kernels_.size(); ++i) {
+      // Ensure the state is sized even if no morsel was consumed
+      auto kernel_ctx = &merged_->kernel_ctxs[i];
+      kernels_[i]->resize(kernel_ctx, num_groups);
+      ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+
+      Datum out;
+      kernels_[i]->finalize(kernel_ctx, &out);
+      ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+      columns.push_back(out.make_array());
+    }
+
+    ARROW_ASSIGN_OR_RAISE(compute::ExecBatch uniques, merged_->grouper->GetUniques());
+    for (const auto& unique : uniques.values) {
+      columns.push_back(unique.make_array());
+    }
+    return RecordBatch::Make(output_schema, num_groups, std::move(columns));
+  }
+
+ private:
+  explicit GroupedAggregateNode(MemoryPool* pool) : Node(nullptr), ctx_(pool) {}
+
+  Result<std::unique_ptr<State>> MakeState() {
+    auto state = ::arrow::internal::make_unique<State>();
+    ARROW_ASSIGN_OR_RAISE(state->grouper,
+                          compute::internal::Grouper::Make(key_descrs_, &ctx_));
+    state->kernel_ctxs.resize(kernels_.size(), compute::KernelContext{&ctx_});
+    for (size_t i = 0; i < kernels_.size(); ++i) {
+      auto kernel_ctx = &state->kernel_ctxs[i];
+      state->kernel_states.push_back(
+          kernels_[i]->init(kernel_ctx, {kernels_[i], in_descrs_[i], options_[i]}));
+      ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+      kernel_ctx->SetState(state->kernel_states.back().get());
+    }
+    return std::move(state);
+  }
+
+  compute::ExecContext ctx_;
+  std::vector<int> targets_;
+  std::vector<const compute::HashAggregateKernel*> kernels_;
+  std::vector<std::vector<ValueDescr>> in_descrs_;
+  std::vector<const compute::FunctionOptions*> options_;
+  std::vector<int> keys_;
+  std::vector<ValueDescr> key_descrs_;
+
+  std::mutex mutex_;
+  std::unique_ptr<State> merged_;
+};
+
+// Push a morsel through the nodes of a plan, appending what comes out of the last
+// node to the table being built
+Status PushMorsel(const std::vector<std::shared_ptr<Node>>& nodes,
+                  const std::vector<std::unique_ptr<Node::LocalState>>& states,
+                  std::shared_ptr<RecordBatch> morsel, int64_t sequence_number,
+                  ConcurrentTableBuilder* builder) {
+  for (size_t i = 0; i < nodes.size() && morsel != nullptr; ++i) {
+    ARROW_ASSIGN_OR_RAISE(morsel, nodes[i]->Push(std::move(morsel), states[i].get()));
+  }
+  if (morsel != nullptr) {
+    RETURN_NOT_OK(builder->Append(sequence_number, std::move(morsel)));
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+constexpr int64_t QueryPlan::kDefaultMorselSize;
+
+QueryPlan::QueryPlan(std::shared_ptr<Scanner> scanner) : scanner_(std::move(scanner)) {}
+
+QueryPlan::~QueryPlan() = default;
+
+Result<std::shared_ptr<QueryPlan>> QueryPlan::Make(std::shared_ptr<Scanner> scanner) {
+  if (scanner == nullptr) {
+    return Status::Invalid("QueryPlan requires a Scanner");
+  }
+  return std::shared_ptr<QueryPlan>(new QueryPlan(std::move(scanner)));
+}
+
+const std::shared_ptr<Schema>& QueryPlan::schema() const {
+  return nodes_.empty() ? scanner_->schema() : nodes_.back()->output_schema;
+}
+
+Status QueryPlan::CheckNotAggregated() const {
+  if (!nodes_.empty() && nodes_.back()->is_aggregate()) {
+    return Status::Invalid("Cannot add a node to a QueryPlan after its aggregation");
+  }
+  return Status::OK();
+}
+
+Status QueryPlan::Filter(std::shared_ptr<Expression> filter) {
+  RETURN_NOT_OK(CheckNotAggregated());
+  RETURN_NOT_OK(schema()->CanReferenceFieldsByNames(FieldsInExpression(*filter)));
+  ARROW_ASSIGN_OR_RAISE(auto type, filter->Validate(*schema()));
+  if (type->id() != Type::BOOL) {
+    return Status::TypeError("Filter expression ", filter->ToString(),
+                             " must be boolean, got ", *type);
+  }
+  nodes_.push_back(std::make_shared<FilterNode>(schema(), std::move(filter),
+                                                std::make_shared<TreeEvaluator>(),
+                                                scanner_->context()->pool));
+  return Status::OK();
+}
+
+Status QueryPlan::Project(std::vector<std::shared_ptr<Expression>> exprs,
+                          std::vector<std::string> names) {
+  RETURN_NOT_OK(CheckNotAggregated());
+  if (exprs.size() != names.size()) {
+    return Status::Invalid("Project got ", exprs.size(), " expressions but ",
+                           names.size(), " names");
+  }
+  FieldVector fields(exprs.size());
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    RETURN_NOT_OK(schema()->CanReferenceFieldsByNames(FieldsInExpression(*exprs[i])));
+    ARROW_ASSIGN_OR_RAISE(auto type, exprs[i]->Validate(*schema()));
+    fields[i] = field(std::move(names[i]), std::move(type));
+  }
+  nodes_.push_back(std::make_shared<ProjectNode>(
+      arrow::schema(std::move(fields)), std::move(exprs),
+      std::make_shared<TreeEvaluator>(), scanner_->context()->pool));
+  return Status::OK();
+}
+
+Status QueryPlan::Aggregate(std::vector<QueryAggregate> aggregates,
+                            std::vector<std::string> keys) {
+  RETURN_NOT_OK(CheckNotAggregated());
+  if (aggregates.empty()) {
+    return Status::Invalid("Aggregate requires at least one aggregation");
+  }
+  std::vector<std::string> referenced = keys;
+  for (const auto& aggregate : aggregates) {
+    referenced.push_back(aggregate.target);
+  }
+  RETURN_NOT_OK(schema()->CanReferenceFieldsByNames(referenced));
+
+  std::shared_ptr<Node> node;
+  MemoryPool* pool = scanner_->context()->pool;
+  if (keys.empty()) {
+    ARROW_ASSIGN_OR_RAISE(node, ScalarAggregateNode::Make(*schema(), aggregates, pool));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(node,
+                          GroupedAggregateNode::Make(*schema(), aggregates, keys, pool));
+  }
+  nodes_.push_back(std::move(node));
+  return Status::OK();
+}
+
+Status QueryPlan::MorselSize(int64_t morsel_size) {
+  if (morsel_size <= 0) {
+    return Status::Invalid("MorselSize must be greater than 0, got ", morsel_size);
+  }
+  morsel_size_ = morsel_size;
+  return Status::OK();
+}
+
+Result<std::shared_ptr<Table>> QueryPlan::ToTable() {
+  // Each ScanTask pushes its morsels through the whole plan. Without an aggregation,
+  // the morsels coming out of the plan are appended to a builder which restores the
+  // order of the ScanTasks.
+  auto builder = std::make_shared<ConcurrentTableBuilder>(schema());
+  auto task_group = scanner_->context()->TaskGroup();
+  auto nodes = nodes_;
+  const int64_t morsel_size = morsel_size_;
+  for (const auto& node : nodes) {
+    RETURN_NOT_OK(node->Init());
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto scan_tasks, scanner_->Scan());
+  int64_t task_index = 0;
+  for (auto maybe_task : scan_tasks) {
+    ARROW_ASSIGN_OR_RAISE(auto task, maybe_task);
+    if (!task_group->ok()) break;
+
+    const int64_t sequence_number = task_index++;
+    task_group->Append([nodes, builder, task, sequence_number, morsel_size]() -> Status {
+      std::vector<std::unique_ptr<Node::LocalState>> states(nodes.size());
+      for (size_t i = 0; i < nodes.size(); ++i) {
+        ARROW_ASSIGN_OR_RAISE(states[i], nodes[i]->MakeLocalState());
+      }
+
+      ARROW_ASSIGN_OR_RAISE(auto batches, task->Execute());
+      for (auto maybe_batch : batches) {
+        ARROW_ASSIGN_OR_RAISE(auto batch, maybe_batch);
+        const int64_t num_rows = batch->num_rows();
+        if (num_rows <= morsel_size) {
+          if (num_rows > 0) {
+            RETURN_NOT_OK(PushMorsel(nodes, states, std::move(batch), sequence_number,
+                                     builder.get()));
+          }
+          continue;
+        }
+        for (int64_t offset = 0; offset < num_rows; offset += morsel_size) {
+          RETURN_NOT_OK(PushMorsel(nodes, states, batch->Slice(offset, morsel_size),
+                                   sequence_number, builder.get()));
+        }
+      }
+
+      for (size_t i = 0; i < nodes.size(); ++i) {
+        RETURN_NOT_OK(nodes[i]->FinishLocalState(std::move(states[i])));
+      }
+      return Status::OK();
+    });
+  }
+  RETURN_NOT_OK(task_group->Finish());
+
+  // Only the last node may be an aggregation, whose output is the plan's
+  for (const auto& node : nodes_) {
+    ARROW_ASSIGN_OR_RAISE(auto output, node->Finish());
+    if (output != nullptr) {
+      DCHECK_EQ(node, nodes_.back());
+      RETURN_NOT_OK(builder->Append(task_index, std::move(output)));
+    }
+  }
+  return builder->Finish();
+}
+
+}  // namespace dataset
+}  // namespace arrow
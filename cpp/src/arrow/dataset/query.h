@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/compute/type_fwd.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief An aggregation computed by a QueryPlan
+struct ARROW_DS_EXPORT QueryAggregate {
+  QueryAggregate(std::string function, std::string target, std::string name = "",
+                 const compute::FunctionOptions* options = NULLPTR)
+      : function(std::move(function)),
+        target(std::move(target)),
+        name(std::move(name)),
+        options(options) {}
+
+  /// The name of a scalar aggregate function, e.g. "sum". When the plan groups rows
+  /// by keys, the hash aggregate function of the same name prefixed by "hash_" is
+  /// used instead, e.g. "hash_sum".
+  std::string function;
+
+  /// The name of the aggregated column
+  std::string target;
+
+  /// The name of the output column, the function's name if empty
+  std::string name;
+
+  /// The options of the function, its defaults if null. They must outlive the plan.
+  const compute::FunctionOptions* options;
+};
+
+/// \brief A pipeline of relational operators executed over the batches of a scan.
+///
+/// A plan is a chain of nodes: a Scanner as source, any number of filter and project
+/// nodes, then optionally an aggregate node, and finally the sink collecting the
+/// plan's output into a Table.
+///
+/// Execution is push-based and morsel-driven. Each ScanTask of the scan runs as a
+/// task of the ScanContext's TaskGroup, so on the CPU thread pool when the scan uses
+/// threads. The batches a task scans are cut into morsels of at most morsel_size()
+/// rows, and each morsel is pushed through all the filter and project nodes and into
+/// the aggregate node before the next morsel is scanned: intermediate results are
+/// never materialized for more than a morsel, and stay in the CPU caches from one
+/// node to the next. Aggregate nodes accumulate a separate state in each task, merged
+/// into a single state when the task ends and finalized once the scan is complete.
+///
+/// Without an aggregate node, the output batches keep the order of the scan.
+class ARROW_DS_EXPORT QueryPlan {
+ public:
+  static constexpr int64_t kDefaultMorselSize = 1 << 14;
+
+  /// \brief Start a plan scanning the batches of a Scanner
+  static Result<std::shared_ptr<QueryPlan>> Make(std::shared_ptr<Scanner> scanner);
+
+  ~QueryPlan();
+
+  /// \brief Keep only the rows for which a boolean expression is true
+  ///
+  /// \return Failure if the expression is not boolean or references columns absent
+  /// from schema(), or if the plan already aggregates.
+  Status Filter(std::shared_ptr<Expression> filter);
+
+  /// \brief Replace the columns by the values of expressions
+  ///
+  /// \param[in] exprs the expressions computing the new columns
+  /// \param[in] names the names of the new columns, one per expression
+  /// \return Failure if an expression references columns absent from schema(), or if
+  /// the plan already aggregates.
+  Status Project(std::vector<std::shared_ptr<Expression>> exprs,
+                 std::vector<std::string> names);
+
+  /// \brief Aggregate all rows, or the rows of each distinct combination of keys
+  ///
+  /// The output has one column per aggregate, followed by one column per key.
+  ///
+  /// \param[in] aggregates the aggregations to compute
+  /// \param[in] keys the names of the columns to group rows by, none to aggregate
+  /// all rows into a single output row
+  /// \return Failure if an aggregation or a key is invalid, or if the plan already
+  /// aggregates.
+  Status Aggregate(std::vector<QueryAggregate> aggregates,
+                   std::vector<std::string> keys = {});
+
+  /// \brief Set the maximum number of rows pushed through the plan at once
+  ///
+  /// \return An error if the size is not greater than 0.
+  Status MorselSize(int64_t morsel_size);
+
+  int64_t morsel_size() const { return morsel_size_; }
+
+  /// \brief The schema of the output of the plan's last node
+  const std::shared_ptr<Schema>& schema() const;
+
+  /// \brief Run the plan and collect its output into a Table
+  ///
+  /// A plan may run several times, but not concurrently.
+  Result<std::shared_ptr<Table>> ToTable();
+
+  struct Node;
+
+ private:
+  explicit QueryPlan(std::shared_ptr<Scanner> scanner);
+
+  Status CheckNotAggregated() const;
+
+  std::shared_ptr<Scanner> scanner_;
+  std::vector<std::shared_ptr<Node>> nodes_;
+  int64_t morsel_size_ = kDefaultMorselSize;
+};
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,173 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/query.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace dataset {
+
+using string_literals::operator"" _;
+
+class TestQueryPlan : public ::testing::TestWithParam<bool> {
+ protected:
+  void SetUp() override {
+    schema_ = schema({field("i", int64()), field("key", utf8()), field("f", float64())});
+    // Two fragments of two batches each
+    auto batch = [&](const std::string& i, const std::string& key,
+                     const std::string& f) {
+      return RecordBatch::Make(schema_, 4,
+                               {ArrayFromJSON(int64(), i), ArrayFromJSON(utf8(), key),
+                                ArrayFromJSON(float64(), f)});
+    };
+    batches_ = {
+        batch("[1, 2, 3, 4]", R"(["a", "b", "a", null])", "[0.5, 1.5, null, 2.5]"),
+        batch("[5, 6, 7, 8]", R"(["b", "b", "c", "a"])", "[1, 2, 3, 4]"),
+        batch("[9, null, 11, 12]", R"(["c", "a", null, "b"])", "[5, 6, 7, 8]"),
+        batch("[13, 14, 15, 16]", R"(["a", "a", "a", "a"])", "[9, 10, 11, 12]"),
+    };
+    DatasetVector children = {
+        std::make_shared<InMemoryDataset>(schema_,
+                                          RecordBatchVector{batches_[0], batches_[1]}),
+        std::make_shared<InMemoryDataset>(schema_,
+                                          RecordBatchVector{batches_[2], batches_[3]})};
+    ASSERT_OK_AND_ASSIGN(auto dataset, UnionDataset::Make(schema_, children));
+
+    auto context = std::make_shared<ScanContext>();
+    context->use_threads = GetParam();
+    ScannerBuilder builder(dataset, context);
+    ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+    ASSERT_OK_AND_ASSIGN(plan_, QueryPlan::Make(scanner));
+  }
+
+  void AssertPlanOutputs(const std::shared_ptr<Schema>& schema,
+                         const std::vector<std::string>& json_batches) {
+    AssertSchemaEqual(*schema, *plan_->schema());
+    // Morsels smaller, equal and larger than the scanned batches
+    for (int64_t morsel_size :
+         std::vector<int64_t>{1, 3, 4, QueryPlan::kDefaultMorselSize}) {
+      ASSERT_OK(plan_->MorselSize(morsel_size));
+      ASSERT_OK_AND_ASSIGN(auto table, plan_->ToTable());
+      AssertTablesEqual(*TableFromJSON(schema, json_batches), *table,
+                        /*same_chunk_layout=*/false);
+    }
+  }
+
+  std::shared_ptr<Schema> schema_;
+  RecordBatchVector batches_;
+  std::shared_ptr<QueryPlan> plan_;
+};
+
+TEST_P(TestQueryPlan, ScanOnly) {
+  ASSERT_OK_AND_ASSIGN(auto table, plan_->ToTable());
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches(batches_));
+  AssertTablesEqual(*expected, *table, /*same_chunk_layout=*/false);
+}
+
+TEST_P(TestQueryPlan, FilterProject) {
+  ASSERT_OK(plan_->Filter(("i"_ > int64_t(2)).Copy()));
+  ASSERT_OK(plan_->Filter(("key"_ != "a").Copy()));
+  ASSERT_OK(plan_->Project({field_ref("f"), ("i"_ <= int64_t(6)).Copy()}, {"g", "le"}));
+
+  AssertPlanOutputs(schema({field("g", float64()), field("le", boolean())}),
+                    {R"([{"g": 1, "le": true}, {"g": 2, "le": true},
+                         {"g": 3, "le": false}, {"g": 5, "le": false},
+                         {"g": 8, "le": false}])"});
+}
+
+TEST_P(TestQueryPlan, FilterEverything) {
+  ASSERT_OK(plan_->Filter(("i"_ > int64_t(100)).Copy()));
+  AssertPlanOutputs(schema_, {});
+}
+
+TEST_P(TestQueryPlan, ScalarAggregate) {
+  compute::CountOptions count_nulls(compute::CountOptions::COUNT_NULL);
+  ASSERT_OK(plan_->Filter(("i"_ >= int64_t(2)).Copy()));
+  ASSERT_OK(plan_->Aggregate({{"sum", "i", "sum_i"},
+                              {"count", "f", "count_f"},
+                              {"count", "f", "nulls_f", &count_nulls},
+                              {"min_max", "f", "min_max_f"}}));
+
+  auto min_max_type = struct_({field("min", float64()), field("max", float64())});
+  AssertPlanOutputs(schema({field("sum_i", int64()), field("count_f", int64()),
+                            field("nulls_f", int64()), field("min_max_f", min_max_type)}),
+                    {R"([{"sum_i": 125, "count_f": 13, "nulls_f": 1,
+                          "min_max_f": {"min": 1, "max": 12}}])"});
+}
+
+TEST_P(TestQueryPlan, ScalarAggregateNothing) {
+  ASSERT_OK(plan_->Filter(("i"_ > int64_t(100)).Copy()));
+  ASSERT_OK(plan_->Aggregate({{"count", "i", ""}}));
+  AssertPlanOutputs(schema({field("count", int64())}), {R"([{"count": 0}])"});
+}
+
+TEST_P(TestQueryPlan, GroupedAggregate) {
+  ASSERT_OK(plan_->Filter(("f"_ < 11.0).Copy()));
+  ASSERT_OK(plan_->Aggregate({{"sum", "i", "sum_i"}, {"count", "f", "count_f"}},
+                             {"key"}));
+  ASSERT_OK_AND_ASSIGN(auto table, plan_->ToTable());
+
+  // The order of the groups depends on the scheduling of the scan, sort them
+  ASSERT_OK_AND_ASSIGN(auto indices,
+                       compute::SortIndices(*table->GetColumnByName("sum_i")));
+  ASSERT_OK_AND_ASSIGN(auto sorted, compute::Take(table, indices));
+
+  auto expected_schema =
+      schema({field("sum_i", int64()), field("count_f", int64()), field("key", utf8())});
+  AssertSchemaEqual(*expected_schema, *plan_->schema());
+  AssertTablesEqual(*TableFromJSON(expected_schema, {R"([
+                        {"sum_i": 15, "count_f": 2, "key": null},
+                        {"sum_i": 16, "count_f": 2, "key": "c"},
+                        {"sum_i": 25, "count_f": 4, "key": "b"},
+                        {"sum_i": 36, "count_f": 5, "key": "a"}
+                      ])"}),
+                    *sorted.table(), /*same_chunk_layout=*/false);
+}
+
+TEST_P(TestQueryPlan, Invalid) {
+  ASSERT_RAISES(Invalid, plan_->Filter(("missing"_ > int64_t(2)).Copy()));
+  ASSERT_RAISES(TypeError, plan_->Filter(field_ref("i")));
+  ASSERT_RAISES(Invalid, plan_->Project({field_ref("i")}, {}));
+  ASSERT_RAISES(Invalid, plan_->MorselSize(0));
+  ASSERT_RAISES(Invalid, plan_->Aggregate({}));
+
+  ASSERT_OK(plan_->Project({field_ref("i")}, {"j"}));
+  ASSERT_RAISES(Invalid, plan_->Aggregate({{"sum", "i", ""}}));
+  ASSERT_RAISES(Invalid, plan_->Aggregate({{"sum", "j", ""}}, {"key"}));
+
+  ASSERT_OK(plan_->Aggregate({{"sum", "j", ""}}));
+  ASSERT_RAISES(Invalid, plan_->Filter(("sum"_ > int64_t(2)).Copy()));
+}
+
+INSTANTIATE_TEST_SUITE_P(QueryPlanThreading, TestQueryPlan, ::testing::Bool());
+
+}  // namespace dataset
+}  // namespace arrow
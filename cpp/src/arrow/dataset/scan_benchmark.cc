@@ -0,0 +1,289 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// End-to-end benchmarks of dataset scans: a Scanner with a filter and a
+// projection over files of each format, on fast and high-latency storage.
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/array/array_nested.h"
+#include "arrow/csv/writer.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/file_csv.h"
+#include "arrow/dataset/file_ipc.h"
+#include "arrow/dataset/file_parquet.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/io/instrumented.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/thread_pool.h"
+
+#include "parquet/arrow/writer.h"
+
+namespace arrow {
+namespace dataset {
+
+enum class Format { kIpc, kParquet, kCsv };
+
+enum class Shape {
+  // Many numeric columns
+  kWide,
+  // Struct and list columns
+  kNested,
+  // Variable-length string columns, some with few distinct values
+  kStrings,
+};
+
+enum class Storage {
+  // In-memory filesystem
+  kLocal,
+  // The same, with a latency on each request, like an object store
+  kHighLatency,
+};
+
+constexpr int kNumFiles = 8;
+constexpr int64_t kRowsPerFile = 1 << 15;
+// The filter column takes values uniformly in [0, kKeyRange)
+constexpr int64_t kKeyRange = 1000;
+// Scaled down from typical object store latencies, to keep iterations short
+constexpr double kHighLatencySeconds = 0.0005;
+
+std::shared_ptr<Table> MakeTable(Shape shape, random::RandomArrayGenerator* rng) {
+  FieldVector fields = {field("key", int64())};
+  ArrayVector columns = {
+      rng->Int64(kRowsPerFile, 0, kKeyRange - 1, /*null_probability=*/0)};
+  switch (shape) {
+    case Shape::kWide:
+      for (int i = 0; i < 31; ++i) {
+        auto type = i % 2 == 0 ? float64() : int32();
+        fields.push_back(field("f" + std::to_string(i), type));
+        columns.push_back(rng->ArrayOf(type, kRowsPerFile, /*null_probability=*/0.1));
+      }
+      break;
+    case Shape::kNested: {
+      auto struct_array =
+          StructArray::Make({rng->Int32(kRowsPerFile, 0, 1 << 20, 0.1),
+                             rng->String(kRowsPerFile, 0, 16, 0.1)},
+                            std::vector<std::string>{"a", "b"})
+              .ValueOrDie();
+      fields.push_back(field("struct", struct_array->type()));
+      columns.push_back(struct_array);
+      auto values = rng->Int64(kRowsPerFile * 4, 0, 1 << 20, 0.1);
+      fields.push_back(field("list", list(int64())));
+      columns.push_back(rng->List(*values, kRowsPerFile, 0.1));
+      break;
+    }
+    case Shape::kStrings:
+      for (int i = 0; i < 4; ++i) {
+        fields.push_back(field("s" + std::to_string(i), utf8()));
+        columns.push_back(rng->String(kRowsPerFile, 0, 64, 0.1));
+      }
+      for (int i = 0; i < 2; ++i) {
+        fields.push_back(field("r" + std::to_string(i), utf8()));
+        columns.push_back(rng->StringWithRepeats(kRowsPerFile, 100, 4, 16, 0.1));
+      }
+      break;
+  }
+  return Table::Make(schema(fields), columns);
+}
+
+Status WriteFile(Format format, const Table& table, fs::FileSystem* filesystem,
+                 const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto out, filesystem->OpenOutputStream(path));
+  switch (format) {
+    case Format::kIpc: {
+      ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeFileWriter(out, table.schema()));
+      RETURN_NOT_OK(writer->WriteTable(table));
+      RETURN_NOT_OK(writer->Close());
+      break;
+    }
+    case Format::kParquet:
+      RETURN_NOT_OK(parquet::arrow::WriteTable(table, default_memory_pool(), out,
+                                               /*chunk_size=*/kRowsPerFile / 4));
+      break;
+    case Format::kCsv:
+      RETURN_NOT_OK(csv::WriteCSV(table, csv::WriteOptions::Defaults(),
+                                  default_memory_pool(), out.get()));
+      break;
+  }
+  return out->Close();
+}
+
+std::shared_ptr<FileFormat> MakeFormat(Format format) {
+  switch (format) {
+    case Format::kIpc:
+      return std::make_shared<IpcFileFormat>();
+    case Format::kParquet:
+      return std::make_shared<ParquetFileFormat>();
+    case Format::kCsv:
+      return std::make_shared<CsvFileFormat>();
+  }
+  return nullptr;
+}
+
+// The files of each format and shape, generated once
+std::shared_ptr<fs::FileSystem> GetFiles(Format format, Shape shape) {
+  static std::map<std::pair<Format, Shape>, std::shared_ptr<fs::FileSystem>> cache;
+  auto it = cache.find({format, shape});
+  if (it != cache.end()) {
+    return it->second;
+  }
+  auto filesystem = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+  random::RandomArrayGenerator rng(42);
+  for (int i = 0; i < kNumFiles; ++i) {
+    auto table = MakeTable(shape, &rng);
+    ABORT_NOT_OK(WriteFile(format, *table, filesystem.get(), std::to_string(i)));
+  }
+  cache[{format, shape}] = filesystem;
+  return filesystem;
+}
+
+Result<std::shared_ptr<Dataset>> MakeDataset(Format format,
+                                             std::shared_ptr<fs::FileSystem> filesystem) {
+  auto file_format = MakeFormat(format);
+  std::vector<std::shared_ptr<FileFragment>> fragments;
+  for (int i = 0; i < kNumFiles; ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto fragment, file_format->MakeFragment(
+                                             FileSource(std::to_string(i), filesystem)));
+    fragments.push_back(std::move(fragment));
+  }
+  ARROW_ASSIGN_OR_RAISE(auto physical_schema, fragments[0]->ReadPhysicalSchema());
+  return FileSystemDataset::Make(physical_schema, scalar(true), file_format,
+                                 std::move(filesystem), std::move(fragments));
+}
+
+// The filter column and every other column
+std::vector<std::string> ProjectedColumns(const Schema& schema) {
+  std::vector<std::string> columns;
+  for (int i = 0; i < schema.num_fields(); i += 2) {
+    columns.push_back(schema.field(i)->name());
+  }
+  if (columns.size() == 1 && schema.num_fields() > 1) {
+    columns.push_back(schema.field(1)->name());
+  }
+  return columns;
+}
+
+// Arguments: selectivity (percent), number of threads, batch size
+template <Format format, Shape shape, Storage storage>
+static void ScanDataset(benchmark::State& state) {
+  const int64_t selectivity = state.range(0);
+  const int threads = static_cast<int>(state.range(1));
+  const int64_t batch_size = state.range(2);
+
+  std::shared_ptr<fs::FileSystem> filesystem = GetFiles(format, shape);
+  if (storage == Storage::kHighLatency) {
+    filesystem = std::make_shared<fs::SlowFileSystem>(filesystem, kHighLatencySeconds,
+                                                      /*seed=*/42);
+  }
+  auto statistics = std::make_shared<io::IOStatistics>();
+  filesystem = std::make_shared<fs::InstrumentedFileSystem>(filesystem, statistics);
+  ASSERT_OK_AND_ASSIGN(auto dataset, MakeDataset(format, filesystem));
+
+  auto context = std::make_shared<ScanContext>();
+  std::shared_ptr<internal::ThreadPool> thread_pool;
+  if (threads > 1) {
+    ASSERT_OK_AND_ASSIGN(thread_pool, internal::ThreadPool::Make(threads));
+    context->use_threads = true;
+    context->cpu_executor = thread_pool.get();
+  }
+
+  int64_t rows_selected = 0;
+  statistics->Reset();
+  for (auto _ : state) {
+    ASSERT_OK_AND_ASSIGN(auto builder, dataset->NewScan(context));
+    ASSERT_OK(builder->Project(ProjectedColumns(*dataset->schema())));
+    ASSERT_OK(builder->Filter("key"_ < kKeyRange * selectivity / 100));
+    ASSERT_OK(builder->BatchSize(batch_size));
+    ASSERT_OK_AND_ASSIGN(auto scanner, builder->Finish());
+    ASSERT_OK_AND_ASSIGN(auto table, scanner->ToTable());
+    rows_selected += table->num_rows();
+  }
+
+  // Rows and bytes of the dataset, read from the storage
+  state.SetItemsProcessed(state.iterations() * kNumFiles * kRowsPerFile);
+  state.SetBytesProcessed(statistics->Snapshot().bytes_read);
+  state.counters["rows_selected"] = benchmark::Counter(
+      static_cast<double>(rows_selected), benchmark::Counter::kAvgIterations);
+  state.counters["read_requests"] =
+      benchmark::Counter(static_cast<double>(statistics->Snapshot().read_requests),
+                         benchmark::Counter::kAvgIterations);
+}
+
+static void ScanArguments(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"selectivity", "threads", "batch_size"});
+  for (const int64_t selectivity : {1, 10, 100}) {
+    for (const int64_t threads : {1, 4}) {
+      for (const int64_t batch_size : {1 << 12, 1 << 16}) {
+        bench->Args({selectivity, threads, batch_size});
+      }
+    }
+  }
+  bench->UseRealTime();
+}
+
+BENCHMARK_TEMPLATE(ScanDataset, Format::kIpc, Shape::kWide, Storage::kLocal)
+    ->Apply(ScanArguments);
+BENCHMARK_TEMPLATE(ScanDataset, Format::kIpc, Shape::kWide, Storage::kHighLatency)
+    ->Apply(ScanArguments);
+BENCHMARK_TEMPLATE(ScanDataset, Format::kIpc, Shape::kNested, Storage::kLocal)
+    ->Apply(ScanArguments);
+BENCHMARK_TEMPLATE(ScanDataset, Format::kIpc, Shape::kNested, Storage::kHighLatency)
+    ->Apply(ScanArguments);
+BENCHMARK_TEMPLATE(ScanDataset, Format::kIpc, Shape::kStrings, Storage::kLocal)
+    ->Apply(ScanArguments);
+BENCHMARK_TEMPLATE(ScanDataset, Format::kIpc, Shape::kStrings, Storage::kHighLatency)
+    ->Apply(ScanArguments);
+
+BENCHMARK_TEMPLATE(ScanDataset, Format::kParquet, Shape::kWide, Storage::kLocal)
+    ->Apply(ScanArguments);
+BENCHMARK_TEMPLATE(ScanDataset, Format::kParquet, Shape::kWide, Storage::kHighLatency)
+    ->Apply(ScanArguments);
+BENCHMARK_TEMPLATE(ScanDataset, Format::kParquet, Shape::kNested, Storage::kLocal)
+    ->Apply(ScanArguments);
+BENCHMARK_TEMPLATE(ScanDataset, Format::kParquet, Shape::kNested,
+                   Storage::kHighLatency)
+    ->Apply(ScanArguments);
+BENCHMARK_TEMPLATE(ScanDataset, Format::kParquet, Shape::kStrings, Storage::kLocal)
+    ->Apply(ScanArguments);
+BENCHMARK_TEMPLATE(ScanDataset, Format::kParquet, Shape::kStrings,
+                   Storage::kHighLatency)
+    ->Apply(ScanArguments);
+
+// CSV doesn't support nested types
+BENCHMARK_TEMPLATE(ScanDataset, Format::kCsv, Shape::kWide, Storage::kLocal)
+    ->Apply(ScanArguments);
+BENCHMARK_TEMPLATE(ScanDataset, Format::kCsv, Shape::kWide, Storage::kHighLatency)
+    ->Apply(ScanArguments);
+BENCHMARK_TEMPLATE(ScanDataset, Format::kCsv, Shape::kStrings, Storage::kLocal)
+    ->Apply(ScanArguments);
+BENCHMARK_TEMPLATE(ScanDataset, Format::kCsv, Shape::kStrings, Storage::kHighLatency)
+    ->Apply(ScanArguments);
+
+}  // namespace dataset
+}  // namespace arrow
@@ -18,17 +18,30 @@
 #include "arrow/dataset/scanner.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
 
+#include "arrow/array/data.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner_internal.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
+#include "arrow/table_builder.h"
 #include "arrow/util/iterator.h"
+#include "arrow/util/stopwatch.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace dataset {
@@ -43,6 +56,8 @@ std::shared_ptr<ScanOptions> ScanOptions::ReplaceSchema(
   copy->filter = filter;
   copy->evaluator = evaluator;
   copy->batch_size = batch_size;
+  copy->fragment_readahead = fragment_readahead;
+  copy->readahead_bytes = readahead_bytes;
   return copy;
 }
 
@@ -109,6 +124,69 @@ Status ScannerBuilder::Project(std::vector<std::string> columns) {
   RETURN_NOT_OK(schema()->CanReferenceFieldsByNames(columns));
   has_projection_ = true;
   project_columns_ = std::move(columns);
+  project_schema_ = nullptr;
+  return Status::OK();
+}
+
+// Retain only the children of (nested) struct fields which lie on one of the paths,
+// given relative to `field`
+static Result<std::shared_ptr<Field>> PruneField(
+    const std::shared_ptr<Field>& field, const std::vector<std::vector<int>>& paths) {
+  // group the paths by the child they traverse, in the order of the struct's children
+  std::map<int, std::vector<std::vector<int>>> child_paths;
+  for (const auto& path : paths) {
+    if (path.empty()) {
+      // the field itself is referenced
+      return field;
+    }
+    child_paths[path[0]].emplace_back(path.begin() + 1, path.end());
+  }
+
+  if (field->type()->id() != Type::STRUCT) {
+    return Status::NotImplemented("Projecting children of field ", field->ToString(),
+                                  "; only children of structs can be projected");
+  }
+
+  FieldVector children;
+  for (const auto& index_paths : child_paths) {
+    ARROW_ASSIGN_OR_RAISE(auto child,
+                          PruneField(field->type()->field(index_paths.first),
+                                     index_paths.second));
+    children.push_back(std::move(child));
+  }
+  return field->WithType(struct_(std::move(children)));
+}
+
+static Result<std::shared_ptr<Schema>> SchemaFromFieldRefs(
+    const Schema& schema, const std::vector<FieldRef>& refs) {
+  // the paths referenced within each top-level field, in order of first reference
+  std::vector<int> top_level_indices;
+  std::unordered_map<int, std::vector<std::vector<int>>> paths;
+  for (const auto& ref : refs) {
+    ARROW_ASSIGN_OR_RAISE(auto path, ref.FindOne(schema));
+    const auto& indices = path.indices();
+    if (paths.find(indices[0]) == paths.end()) {
+      top_level_indices.push_back(indices[0]);
+    }
+    paths[indices[0]].emplace_back(indices.begin() + 1, indices.end());
+  }
+
+  FieldVector fields;
+  for (int i : top_level_indices) {
+    ARROW_ASSIGN_OR_RAISE(auto field, PruneField(schema.field(i), paths[i]));
+    fields.push_back(std::move(field));
+  }
+  return arrow::schema(std::move(fields), schema.metadata());
+}
+
+Status ScannerBuilder::ProjectFields(std::vector<FieldRef> fields) {
+  std::shared_ptr<Schema> projected;
+  if (!fields.empty()) {
+    ARROW_ASSIGN_OR_RAISE(projected, SchemaFromFieldRefs(*schema(), fields));
+  }
+  has_projection_ = true;
+  project_columns_.clear();
+  project_schema_ = std::move(projected);
   return Status::OK();
 }
 
@@ -121,6 +199,14 @@ Status ScannerBuilder::Filter(std::shared_ptr<Expression> filter) {
 
 Status ScannerBuilder::Filter(const Expression& filter) { return Filter(filter.Copy()); }
 
+Status ScannerBuilder::Evaluator(std::shared_ptr<ExpressionEvaluator> evaluator) {
+  if (evaluator == nullptr) {
+    return Status::Invalid("Evaluator must not be null");
+  }
+  evaluator_ = std::move(evaluator);
+  return Status::OK();
+}
+
 Status ScannerBuilder::UseThreads(bool use_threads) {
   scan_context_->use_threads = use_threads;
   return Status::OK();
@@ -134,9 +220,29 @@ Status ScannerBuilder::BatchSize(int64_t batch_size) {
   return Status::OK();
 }
 
+Status ScannerBuilder::FragmentReadahead(int32_t fragment_readahead) {
+  if (fragment_readahead <= 0) {
+    return Status::Invalid("FragmentReadahead must be greater than 0, got ",
+                           fragment_readahead);
+  }
+  scan_options_->fragment_readahead = fragment_readahead;
+  return Status::OK();
+}
+
+Status ScannerBuilder::ReadaheadBytes(int64_t readahead_bytes) {
+  if (readahead_bytes <= 0) {
+    return Status::Invalid("ReadaheadBytes must be greater than 0, got ",
+                           readahead_bytes);
+  }
+  scan_options_->readahead_bytes = readahead_bytes;
+  return Status::OK();
+}
+
 Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() const {
   std::shared_ptr<ScanOptions> scan_options;
-  if (has_projection_ && !project_columns_.empty()) {
+  if (project_schema_ != nullptr) {
+    scan_options = scan_options_->ReplaceSchema(project_schema_);
+  } else if (has_projection_ && !project_columns_.empty()) {
     scan_options =
         scan_options_->ReplaceSchema(SchemaFromColumnNames(schema(), project_columns_));
   } else {
@@ -144,7 +250,8 @@ Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() const {
   }
 
   if (!scan_options->filter->Equals(true)) {
-    scan_options->evaluator = std::make_shared<TreeEvaluator>();
+    scan_options->evaluator =
+        evaluator_ ? evaluator_ : std::make_shared<TreeEvaluator>();
   }
 
   if (dataset_ == nullptr) {
@@ -156,68 +263,541 @@ Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() const {
 
 using arrow::internal::TaskGroup;
 
+arrow::internal::Executor* ScanContext::GetCpuExecutor() const {
+  if (cpu_executor != NULLPTR) {
+    return cpu_executor;
+  }
+  return arrow::internal::GetCpuThreadPool();
+}
+
 std::shared_ptr<TaskGroup> ScanContext::TaskGroup() const {
   if (use_threads) {
-    auto* thread_pool = arrow::internal::GetCpuThreadPool();
-    return TaskGroup::MakeThreaded(thread_pool);
+    return TaskGroup::MakeThreaded(GetCpuExecutor());
   }
   return TaskGroup::MakeSerial();
 }
 
-static inline RecordBatchVector FlattenRecordBatchVector(
-    std::vector<RecordBatchVector> nested_batches) {
-  RecordBatchVector flattened;
+namespace {
+
+// Approximate the memory held by a batch by the sizes of the buffers it references.
+int64_t BufferedBytes(const RecordBatch& batch) {
+  int64_t bytes = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    bytes += dataset::BufferedBytes(*batch.column_data(i));
+  }
+  return bytes;
+}
 
-  for (auto& task_batches : nested_batches) {
-    for (auto& batch : task_batches) {
-      flattened.emplace_back(std::move(batch));
+std::string DescribeFragment(const Fragment& fragment) {
+  if (auto file_fragment = dynamic_cast<const FileFragment*>(&fragment)) {
+    if (!file_fragment->source().path().empty()) {
+      return file_fragment->source().path();
     }
   }
+  return fragment.type_name();
+}
 
-  return flattened;
+// The iterators returned by FilterAndProjectScanTask::Execute reference their task,
+// which must therefore be kept alive alongside.
+struct ScanTaskBatchIterator {
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    ARROW_TRACE_SPAN("dataset", "ScanTask::Next", timing.fragment);
+    arrow::internal::StopWatch watch;
+    watch.Start();
+    auto maybe_batch = batches.Next();
+    timing.wall_nanos += static_cast<int64_t>(watch.Stop());
+
+    if (maybe_batch.ok()) {
+      if (const auto& batch = *maybe_batch) {
+        ++timing.num_batches;
+        timing.num_rows += batch->num_rows();
+      } else if (task != nullptr) {
+        task.reset();
+        if (on_task_finished) {
+          on_task_finished(timing);
+        }
+      }
+    }
+    return maybe_batch;
+  }
+
+  std::shared_ptr<ScanTask> task;
+  RecordBatchIterator batches;
+  ScanTaskTiming timing;
+  std::function<void(const ScanTaskTiming&)> on_task_finished;
+};
+
+// Execute a ScanTask, returning an iterator of its batches which reports the
+// task's timing to ScanContext::on_task_finished once exhausted.
+Result<RecordBatchIterator> ExecuteScanTask(std::shared_ptr<ScanTask> task,
+                                            std::string fragment, int task_index,
+                                            const ScanContext& context) {
+  ScanTaskBatchIterator it;
+  it.timing.fragment = std::move(fragment);
+  it.timing.task_index = task_index;
+  it.on_task_finished = context.on_task_finished;
+
+  ARROW_TRACE_SPAN("dataset", "ScanTask::Execute", it.timing.fragment);
+  arrow::internal::StopWatch watch;
+  watch.Start();
+  ARROW_ASSIGN_OR_RAISE(it.batches, task->Execute());
+  it.timing.wall_nanos = static_cast<int64_t>(watch.Stop());
+  it.task = std::move(task);
+  return RecordBatchIterator(std::move(it));
 }
 
-struct TableAssemblyState {
-  /// Protecting mutating accesses to batches
-  std::mutex mutex{};
-  std::vector<RecordBatchVector> batches{};
+/// \brief Shared state of a scan which runs ahead of its consumer.
+///
+/// Fragments are taken from the Scanner's FragmentIterator in order and kept in a
+/// window of at most ScanOptions::fragment_readahead fragments in flight. Each
+/// fragment is fetched on the IO thread pool, then each of its ScanTasks is executed
+/// on the CPU thread pool, queuing the batches it yields until the consumer pops
+/// them, in order.
+///
+/// All fields are protected by mutex_. Whenever the bytes held ahead of the
+/// consumer reach ScanOptions::readahead_bytes, no fragment is launched and
+/// ScanTasks pause between batches, except for the task the consumer is waiting
+/// on. Schedule() resumes them as the consumer makes room.
+class ReadaheadScanState : public std::enable_shared_from_this<ReadaheadScanState> {
+ public:
+  ReadaheadScanState(FragmentIterator fragments, std::shared_ptr<ScanOptions> options,
+                     std::shared_ptr<ScanContext> context)
+      : fragments_(std::move(fragments)),
+        options_(std::move(options)),
+        context_(std::move(context)),
+        io_executor_(io::internal::GetIOThreadPool()),
+        cpu_executor_(context_->GetCpuExecutor()),
+        max_running_tasks_(std::max(cpu_executor_->GetCapacity(), 1)) {}
+
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    Schedule();
+    while (true) {
+      RETURN_NOT_OK(status_);
+
+      if (window_.empty()) {
+        if (fragments_exhausted_) {
+          return IterationTraits<std::shared_ptr<RecordBatch>>::End();
+        }
+        // Launching fragments only stops early on error
+        Schedule();
+        continue;
+      }
+
+      const auto& fragment = window_.front();
+      if (fragment->tasks_known) {
+        if (next_task_ == fragment->tasks.size()) {
+          window_.pop_front();
+          next_task_ = 0;
+          Schedule();
+          continue;
+        }
+
+        auto& task = fragment->tasks[next_task_];
+        if (!task->queue.empty()) {
+          auto batch = std::move(task->queue.front());
+          task->queue.pop_front();
+          bytes_ -= batch.second;
+          Schedule();
+          return std::move(batch.first);
+        }
+
+        if (task->finished) {
+          ++next_task_;
+          // The new head task may have been paused
+          Schedule();
+          continue;
+        }
+      }
+
+      cv_.wait(lock);
+    }
+  }
+
+  /// Stop scheduling work, e.g. once the consumer is gone.
+  void Abandon() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    abandoned_ = true;
+  }
+
+ private:
+  struct TaskState {
+    std::shared_ptr<ScanTask> task;
+    // Valid once the task was executed
+    RecordBatchIterator batches;
+    std::deque<std::pair<std::shared_ptr<RecordBatch>, int64_t>> queue;
+    bool executed = false;
+    bool running = false;
+    bool finished = false;
+    ScanTaskTiming timing;
+  };
+
+  struct FragmentState {
+    std::shared_ptr<Fragment> fragment;
+    std::string description;
+    std::vector<std::shared_ptr<TaskState>> tasks;
+    bool tasks_known = false;
+    size_t tasks_unfinished = 0;
+    int64_t prefetched_bytes = 0;
+  };
+
+  using FragmentStatePtr = std::shared_ptr<FragmentState>;
+  using TaskStatePtr = std::shared_ptr<TaskState>;
+
+  bool OverBudget() const { return bytes_ >= options_->readahead_bytes; }
+
+  bool IsHead(const FragmentState* fragment, const TaskState* task) const {
+    return !window_.empty() && window_.front().get() == fragment &&
+           next_task_ < fragment->tasks.size() &&
+           fragment->tasks[next_task_].get() == task;
+  }
+
+  void Fail(Status st) {
+    if (status_.ok()) {
+      status_ = std::move(st);
+    }
+    cv_.notify_all();
+  }
+
+  template <typename Function>
+  void Dispatch(arrow::internal::Executor* executor, Function&& func) {
+    auto st = executor->Spawn(std::forward<Function>(func));
+    if (!st.ok()) {
+      Fail(std::move(st));
+    }
+  }
+
+  // Launch fragments and (re)start tasks as permitted by the readahead limits.
+  void Schedule() {
+    if (!status_.ok() || abandoned_) return;
+
+    auto self = shared_from_this();
+    while (!fragments_exhausted_ &&
+           active_fragments_ < static_cast<size_t>(options_->fragment_readahead) &&
+           (active_fragments_ == 0 || !OverBudget())) {
+      auto maybe_fragment = fragments_.Next();
+      if (!maybe_fragment.ok()) {
+        return Fail(maybe_fragment.status());
+      }
+      auto fragment = maybe_fragment.MoveValueUnsafe();
+      if (fragment == nullptr) {
+        fragments_exhausted_ = true;
+        break;
+      }
+
+      auto state = std::make_shared<FragmentState>();
+      state->description = DescribeFragment(*fragment);
+      state->fragment = std::move(fragment);
+      window_.push_back(state);
+      ++active_fragments_;
+      Dispatch(io_executor_, [self, state] { self->FetchFragment(state); });
+    }
+
+    for (const auto& fragment : window_) {
+      if (!fragment->tasks_known) continue;
+
+      size_t first_task = fragment == window_.front() ? next_task_ : 0;
+      for (size_t i = first_task; i < fragment->tasks.size(); ++i) {
+        const auto& task = fragment->tasks[i];
+        if (task->running || task->finished) continue;
+
+        if (!IsHead(fragment.get(), task.get()) &&
+            (OverBudget() || running_tasks_ >= max_running_tasks_)) {
+          return;
+        }
+        task->running = true;
+        ++running_tasks_;
+        Dispatch(cpu_executor_,
+                 [self, fragment, task] { self->RunTask(fragment, task); });
+      }
+    }
+  }
+
+  // Read a whole file in a single request, if it fits in the readahead limit, or
+  // return the fragment unchanged. Scans of partition fields only, which may be
+  // answered from the file's metadata, are never prefetched.
+  Result<std::shared_ptr<Fragment>> Prefetch(FragmentState* state) {
+    auto file_fragment = std::dynamic_pointer_cast<FileFragment>(state->fragment);
+    if (file_fragment == nullptr || file_fragment->source().filesystem() == nullptr ||
+        MaterializesOnlyPartitionFields(*options_,
+                                        *file_fragment->partition_expression())) {
+      return state->fragment;
+    }
+
+    const auto& source = file_fragment->source();
+    ARROW_ASSIGN_OR_RAISE(auto file, source.Open());
+    ARROW_ASSIGN_OR_RAISE(int64_t size, file->GetSize());
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (size > options_->readahead_bytes - bytes_) {
+        // Leave it to the format to read the file incrementally
+        return state->fragment;
+      }
+      bytes_ += size;
+      state->prefetched_bytes = size;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto buffer, file->ReadAt(0, size));
+    RETURN_NOT_OK(file->Close());
+    ARROW_ASSIGN_OR_RAISE(auto prefetched, file_fragment->ReplaceSource(FileSource(
+                                               std::move(buffer), source.compression())));
+    return prefetched;
+  }
+
+  // Runs on the IO thread pool
+  void FetchFragment(const FragmentStatePtr& state) {
+    auto maybe_tasks = [&]() -> Result<ScanTaskVector> {
+      ARROW_ASSIGN_OR_RAISE(auto fragment, Prefetch(state.get()));
+      auto tasks = GetScanTaskIterator(MakeVectorIterator(FragmentVector{fragment}),
+                                       options_, context_);
+      return tasks.ToVector();
+    }();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!maybe_tasks.ok()) {
+      return Fail(maybe_tasks.status());
+    }
+    state->fragment.reset();
+    for (auto& task : maybe_tasks.MoveValueUnsafe()) {
+      auto task_state = std::make_shared<TaskState>();
+      task_state->task = std::move(task);
+      task_state->timing.fragment = state->description;
+      task_state->timing.task_index = static_cast<int>(state->tasks.size());
+      state->tasks.push_back(std::move(task_state));
+    }
+    state->tasks_known = true;
+    state->tasks_unfinished = state->tasks.size();
+    if (state->tasks_unfinished == 0) {
+      FinishFragment(state.get());
+    }
+    Schedule();
+    cv_.notify_all();
+  }
+
+  void FinishFragment(FragmentState* state) {
+    --active_fragments_;
+    bytes_ -= state->prefetched_bytes;
+    state->prefetched_bytes = 0;
+  }
+
+  // Runs on the CPU thread pool
+  void RunTask(const FragmentStatePtr& fragment, const TaskStatePtr& task) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    arrow::internal::StopWatch watch;
+    if (!task->executed) {
+      lock.unlock();
+      watch.Start();
+      auto maybe_batches = task->task->Execute();
+      int64_t nanos = static_cast<int64_t>(watch.Stop());
+      lock.lock();
+      task->timing.wall_nanos += nanos;
+      if (!maybe_batches.ok()) {
+        return Fail(maybe_batches.status());
+      }
+      task->batches = maybe_batches.MoveValueUnsafe();
+      task->executed = true;
+    }
+
+    while (true) {
+      if (!status_.ok() || abandoned_) return;
+
+      if (!IsHead(fragment.get(), task.get()) && OverBudget()) {
+        // Pause until the consumer makes room
+        task->running = false;
+        --running_tasks_;
+        return;
+      }
+
+      lock.unlock();
+      watch.Start();
+      auto maybe_batch = task->batches.Next();
+      int64_t nanos = static_cast<int64_t>(watch.Stop());
+      lock.lock();
+      task->timing.wall_nanos += nanos;
+      if (!maybe_batch.ok()) {
+        return Fail(maybe_batch.status());
+      }
+
+      auto batch = maybe_batch.MoveValueUnsafe();
+      if (batch == nullptr) {
+        if (context_->on_task_finished) {
+          // Report before the task is seen to be finished by the consumer
+          lock.unlock();
+          context_->on_task_finished(task->timing);
+          lock.lock();
+        }
+        break;
+      }
+      ++task->timing.num_batches;
+      task->timing.num_rows += batch->num_rows();
+
+      int64_t bytes = BufferedBytes(*batch);
+      bytes_ += bytes;
+      task->queue.emplace_back(std::move(batch), bytes);
+      cv_.notify_all();
+    }
 
-  void Emplace(RecordBatchVector b, size_t position) {
-    std::lock_guard<std::mutex> lock(mutex);
-    if (batches.size() <= position) {
-      batches.resize(position + 1);
+    task->running = false;
+    task->finished = true;
+    task->batches = RecordBatchIterator();
+    task->task.reset();
+    --running_tasks_;
+    if (--fragment->tasks_unfinished == 0) {
+      FinishFragment(fragment.get());
     }
-    batches[position] = std::move(b);
+    Schedule();
+    cv_.notify_all();
   }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  Status status_;
+  bool abandoned_ = false;
+
+  FragmentIterator fragments_;
+  bool fragments_exhausted_ = false;
+  std::shared_ptr<ScanOptions> options_;
+  std::shared_ptr<ScanContext> context_;
+  arrow::internal::Executor* io_executor_;
+  arrow::internal::Executor* cpu_executor_;
+  const int max_running_tasks_;
+
+  // Fragments which were launched and not entirely consumed yet
+  std::deque<FragmentStatePtr> window_;
+  // Index of the task being consumed in window_.front()
+  size_t next_task_ = 0;
+  // Fragments in window_ whose tasks did not all finish
+  size_t active_fragments_ = 0;
+  int running_tasks_ = 0;
+  // Bytes prefetched or queued ahead of the consumer
+  int64_t bytes_ = 0;
 };
 
+class ReadaheadBatchIterator {
+ public:
+  explicit ReadaheadBatchIterator(std::shared_ptr<ReadaheadScanState> state)
+      : state_(std::move(state)) {}
+
+  ReadaheadBatchIterator(ReadaheadBatchIterator&&) = default;
+  ReadaheadBatchIterator& operator=(ReadaheadBatchIterator&&) = default;
+
+  ~ReadaheadBatchIterator() {
+    if (state_ != nullptr) {
+      state_->Abandon();
+    }
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Next() { return state_->Next(); }
+
+ private:
+  std::shared_ptr<ReadaheadScanState> state_;
+};
+
+class ScanBatchesReader : public RecordBatchReader {
+ public:
+  ScanBatchesReader(std::shared_ptr<Schema> schema, RecordBatchIterator batches)
+      : schema_(std::move(schema)), batches_(std::move(batches)) {}
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    return batches_.Next().Value(batch);
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  RecordBatchIterator batches_;
+};
+
+}  // namespace
+
+Result<RecordBatchIterator> Scanner::ScanBatches() {
+  if (scan_context_->use_threads) {
+    auto state = std::make_shared<ReadaheadScanState>(GetFragments(), scan_options_,
+                                                      scan_context_);
+    return RecordBatchIterator(ReadaheadBatchIterator(std::move(state)));
+  }
+
+  auto options = scan_options_;
+  auto context = scan_context_;
+  auto batches_of_fragment =
+      [options, context](std::shared_ptr<Fragment> fragment) -> RecordBatchIterator {
+    auto description = DescribeFragment(*fragment);
+    auto scan_task_it = GetScanTaskIterator(
+        MakeVectorIterator(FragmentVector{std::move(fragment)}), options, context);
+    auto task_index = std::make_shared<int>(0);
+
+    return MakeFlattenIterator(MakeMaybeMapIterator(
+        [context, description,
+         task_index](std::shared_ptr<ScanTask> task) -> Result<RecordBatchIterator> {
+          return ExecuteScanTask(std::move(task), description, (*task_index)++,
+                                 *context);
+        },
+        std::move(scan_task_it)));
+  };
+
+  return MakeFlattenIterator(MakeMapIterator(batches_of_fragment, GetFragments()));
+}
+
+Result<std::shared_ptr<RecordBatchReader>> Scanner::ToRecordBatchReader() {
+  ARROW_ASSIGN_OR_RAISE(auto batch_it, ScanBatches());
+  return std::make_shared<ScanBatchesReader>(scan_options_->schema(),
+                                             std::move(batch_it));
+}
+
 Result<std::shared_ptr<Table>> Scanner::ToTable() {
-  ARROW_ASSIGN_OR_RAISE(auto scan_task_it, Scan());
-  auto task_group = scan_context_->TaskGroup();
-
-  /// Wraps the state in a shared_ptr to ensure that failing ScanTasks don't
-  /// invalidate concurrently running tasks when Finish() early returns
-  /// and the mutex/batches fail out of scope.
-  auto state = std::make_shared<TableAssemblyState>();
-
-  size_t scan_task_id = 0;
-  for (auto maybe_scan_task : scan_task_it) {
-    ARROW_ASSIGN_OR_RAISE(auto scan_task, maybe_scan_task);
-
-    auto id = scan_task_id++;
-    task_group->Append([state, id, scan_task] {
-      ARROW_ASSIGN_OR_RAISE(auto batch_it, scan_task->Execute());
-      ARROW_ASSIGN_OR_RAISE(auto local, batch_it.ToVector());
-      state->Emplace(std::move(local), id);
+  if (!scan_context_->use_threads) {
+    ARROW_ASSIGN_OR_RAISE(auto batch_it, ScanBatches());
+    ARROW_ASSIGN_OR_RAISE(auto batches, batch_it.ToVector());
+    return Table::FromRecordBatches(scan_options_->schema(), std::move(batches));
+  }
+
+  // Rather than funnelling all batches through the ordered readahead of
+  // ScanBatches(), every ScanTask appends its batches to a lock-free builder
+  // which restores the scan order: the sequence number of a batch holds the
+  // index of its fragment in the high 32 bits and the index of its task in the
+  // low ones.
+  auto options = scan_options_;
+  auto context = scan_context_;
+  auto builder = std::make_shared<ConcurrentTableBuilder>(options->schema());
+  auto task_group = context->TaskGroup();
+
+  int64_t fragment_index = 0;
+  for (auto maybe_fragment : GetFragments()) {
+    ARROW_ASSIGN_OR_RAISE(auto fragment, maybe_fragment);
+    if (!task_group->ok()) break;
+
+    const int64_t fragment_sequence_number = fragment_index++ << 32;
+    task_group->Append([options, context, builder, task_group, fragment,
+                        fragment_sequence_number]() -> Status {
+      auto description = DescribeFragment(*fragment);
+      ARROW_ASSIGN_OR_RAISE(
+          auto tasks,
+          GetScanTaskIterator(MakeVectorIterator(FragmentVector{fragment}), options,
+                              context)
+              .ToVector());
+      for (size_t i = 0; i < tasks.size(); ++i) {
+        auto task = std::move(tasks[i]);
+        task_group->Append([context, builder, task, description, i,
+                            fragment_sequence_number]() -> Status {
+          ARROW_ASSIGN_OR_RAISE(auto batches, ExecuteScanTask(task, description,
+                                                              static_cast<int>(i),
+                                                              *context));
+          const int64_t sequence_number =
+              fragment_sequence_number | static_cast<int64_t>(i);
+          for (auto maybe_batch : batches) {
+            ARROW_ASSIGN_OR_RAISE(auto batch, maybe_batch);
+            RETURN_NOT_OK(builder->Append(sequence_number, std::move(batch)));
+          }
+          return Status::OK();
+        });
+      }
       return Status::OK();
     });
   }
 
-  // Wait for all tasks to complete, or the first error.
   RETURN_NOT_OK(task_group->Finish());
-
-  return Table::FromRecordBatches(scan_options_->schema(),
-                                  FlattenRecordBatchVector(std::move(state->batches)));
+  return builder->Finish();
 }
 
 }  // namespace dataset
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -37,15 +38,50 @@ namespace arrow {
 namespace dataset {
 
 constexpr int64_t kDefaultBatchSize = 1 << 20;
+constexpr int32_t kDefaultFragmentReadahead = 8;
+constexpr int64_t kDefaultReadaheadBytes = 256 << 20;
+
+/// \brief Time spent executing a single ScanTask.
+struct ARROW_DS_EXPORT ScanTaskTiming {
+  /// The path of the fragment which produced the task if it is a FileFragment with a
+  /// path, otherwise the fragment's type name.
+  std::string fragment;
+
+  /// The index of the task among those produced by its fragment.
+  int task_index = 0;
+
+  /// Nanoseconds spent in ScanTask::Execute() and in producing the task's batches,
+  /// excluding the time the task was paused by readahead limits.
+  int64_t wall_nanos = 0;
+
+  /// The number of batches and rows produced by the task.
+  int64_t num_batches = 0, num_rows = 0;
+};
 
 /// \brief Shared state for a Scan operation
 struct ARROW_DS_EXPORT ScanContext {
   /// A pool from which materialized and scanned arrays will be allocated.
+  /// E.g. a TrackingMemoryPool accounts for the memory of the scan, and
+  /// may limit it.
   MemoryPool* pool = arrow::default_memory_pool();
 
   /// Indicate if the Scanner should make use of a ThreadPool.
   bool use_threads = false;
 
+  /// The executor running the CPU work of threaded scans, or null for the global
+  /// CPU thread pool.  E.g. a ThreadPool made by ThreadPool::MakeNumaPinned(),
+  /// with a NumaMemoryPool as `pool`, keeps each batch on the NUMA node which
+  /// decodes and processes it.
+  internal::Executor* cpu_executor = NULLPTR;
+
+  /// Return cpu_executor, or the global CPU thread pool if it is null.
+  internal::Executor* GetCpuExecutor() const;
+
+  /// If set, Scanner::ScanBatches, ToRecordBatchReader and ToTable call this with the
+  /// timing of each ScanTask once the task has produced all its batches. When
+  /// use_threads is true it may be called concurrently from several threads.
+  std::function<void(const ScanTaskTiming&)> on_task_finished;
+
   /// Return a threaded or serial TaskGroup according to use_threads.
   std::shared_ptr<internal::TaskGroup> TaskGroup() const;
 };
@@ -77,6 +113,14 @@ class ARROW_DS_EXPORT ScanOptions {
   // Maximum row count for scanned batches.
   int64_t batch_size = kDefaultBatchSize;
 
+  // Maximum number of fragments fetched and decoded concurrently by
+  // Scanner::ScanBatches.
+  int32_t fragment_readahead = kDefaultFragmentReadahead;
+
+  // Soft limit on the bytes Scanner::ScanBatches holds ahead of its consumer, counting
+  // prefetched file contents and decoded batches that were not yet consumed.
+  int64_t readahead_bytes = kDefaultReadaheadBytes;
+
   // Return a vector of fields that requires materialization.
   //
   // This is usually the union of the fields referenced in the projection and the
@@ -166,10 +210,31 @@ class ARROW_DS_EXPORT Scanner {
   /// in a concurrent fashion and outlive the iterator.
   Result<ScanTaskIterator> Scan();
 
+  /// \brief Return a stream of the scanned RecordBatches, in order.
+  ///
+  /// If the ScanContext requests threads, the scan runs ahead of the consumer:
+  /// up to ScanOptions::fragment_readahead fragments are in flight at once,
+  /// their files being fetched on the IO thread pool and decoded on the CPU
+  /// thread pool, while the bytes held ahead of the consumer are bounded by
+  /// ScanOptions::readahead_bytes. Files which fit in that bound are read whole
+  /// in a single request before being decoded from memory. Otherwise the scan
+  /// is driven serially by the consumer.
+  ///
+  /// Abandoning the iterator stops the scan, although work already dispatched
+  /// to the thread pools may complete in the background.
+  Result<RecordBatchIterator> ScanBatches();
+
+  /// \brief Return the stream of ScanBatches as a RecordBatchReader of this
+  /// Scanner's schema.
+  Result<std::shared_ptr<RecordBatchReader>> ToRecordBatchReader();
+
   /// \brief Convert a Scanner into a Table.
   ///
-  /// Use this convenience utility with care. This will serially materialize the
+  /// Use this convenience utility with care. This will materialize the
   /// Scan result in memory before creating the Table.
+  ///
+  /// The rows are in the order of ScanBatches(). When use_threads is true the
+  /// ScanTasks are executed concurrently, without readahead limits.
   Result<std::shared_ptr<Table>> ToTable();
 
   /// \brief GetFragments returns an iterator over all Fragments in this scan.
@@ -213,6 +278,21 @@ class ARROW_DS_EXPORT ScannerBuilder {
   ///         Schema.
   Status Project(std::vector<std::string> columns);
 
+  /// \brief Set the subset of (possibly nested) fields to materialize.
+  ///
+  /// Each referenced field is materialized within the top-level column containing it,
+  /// whose struct types retain only the referenced children. For example referencing
+  /// FieldRef("a", "b") in a dataset with a column a: struct<b: int32, c: utf8>
+  /// materializes a column a: struct<b: int32>. Formats which support it only read the
+  /// referenced leaves.
+  ///
+  /// \param[in] fields list of fields to project. Top-level columns are ordered by
+  ///            their first reference.
+  ///
+  /// \return Failure if any reference does not match exactly one field in the
+  ///         dataset's Schema, or traverses a type other than struct.
+  Status ProjectFields(std::vector<FieldRef> fields);
+
   /// \brief Set the filter expression to return only rows matching the filter.
   ///
   /// The predicate will be passed down to Sources and corresponding
@@ -226,6 +306,14 @@ class ARROW_DS_EXPORT ScannerBuilder {
   Status Filter(std::shared_ptr<Expression> filter);
   Status Filter(const Expression& filter);
 
+  /// \brief Set the evaluator of the filter expression.
+  ///
+  /// By default, filters are evaluated by a TreeEvaluator.
+  ///
+  /// \param[in] evaluator the evaluator to use.
+  /// \return An error if the evaluator is null.
+  Status Evaluator(std::shared_ptr<ExpressionEvaluator> evaluator);
+
   /// \brief Indicate if the Scanner should make use of the available
   ///        ThreadPool found in ScanContext;
   Status UseThreads(bool use_threads = true);
@@ -238,6 +326,23 @@ class ARROW_DS_EXPORT ScannerBuilder {
   /// This option provides a control limiting the memory owned by any RecordBatch.
   Status BatchSize(int64_t batch_size);
 
+  /// \brief Set the maximum number of fragments scanned concurrently by
+  /// Scanner::ScanBatches.
+  ///
+  /// \param[in] fragment_readahead the maximum number of fragments in flight.
+  /// \returns An error if the number is not greater than 0.
+  Status FragmentReadahead(int32_t fragment_readahead);
+
+  /// \brief Set the number of bytes Scanner::ScanBatches may hold ahead of its
+  /// consumer.
+  ///
+  /// \param[in] readahead_bytes the soft limit on prefetched and buffered bytes.
+  /// \returns An error if the number is not greater than 0.
+  ///
+  /// The limit is soft in that at least one file or batch is always in flight,
+  /// however large.
+  Status ReadaheadBytes(int64_t readahead_bytes);
+
   /// \brief Return the constructed now-immutable Scanner object
   Result<std::shared_ptr<Scanner>> Finish() const;
 
@@ -248,8 +353,10 @@ class ARROW_DS_EXPORT ScannerBuilder {
   std::shared_ptr<Fragment> fragment_;
   std::shared_ptr<ScanOptions> scan_options_;
   std::shared_ptr<ScanContext> scan_context_;
+  std::shared_ptr<ExpressionEvaluator> evaluator_;
   bool has_projection_ = false;
   std::vector<std::string> project_columns_;
+  std::shared_ptr<Schema> project_schema_;
 };
 
 }  // namespace dataset
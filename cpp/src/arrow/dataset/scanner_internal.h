@@ -24,6 +24,7 @@
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace dataset {
@@ -33,6 +34,7 @@ inline RecordBatchIterator FilterRecordBatch(RecordBatchIterator it,
                                              const Expression& filter, MemoryPool* pool) {
   return MakeMaybeMapIterator(
       [&filter, &evaluator, pool](std::shared_ptr<RecordBatch> in) {
+        ARROW_TRACE_SPAN("dataset", "FilterRecordBatch");
         return evaluator.Evaluate(filter, *in, pool).Map([&](Datum selection) {
           return evaluator.Filter(selection, in);
         });
@@ -43,13 +45,14 @@ inline RecordBatchIterator FilterRecordBatch(RecordBatchIterator it,
 inline RecordBatchIterator ProjectRecordBatch(RecordBatchIterator it,
                                               RecordBatchProjector* projector,
                                               MemoryPool* pool) {
+  // The RecordBatchProjector is shared across ScanTasks of the same Fragment and
+  // resolving the input schema is not thread safe. Ensure that each ScanTask gets
+  // its own projector; copies share their cache of missing columns.
+  auto local_projector = std::make_shared<RecordBatchProjector>(*projector);
   return MakeMaybeMapIterator(
       [=](std::shared_ptr<RecordBatch> in) {
-        // The RecordBatchProjector is shared across ScanTasks of the same
-        // Fragment. The resize operation of missing columns is not thread safe.
-        // Ensure that each ScanTask gets his own projector.
-        RecordBatchProjector local_projector{*projector};
-        return local_projector.Project(*in, pool);
+        ARROW_TRACE_SPAN("dataset", "ProjectRecordBatch");
+        return local_projector->Project(*in, pool);
       },
       std::move(it));
 }
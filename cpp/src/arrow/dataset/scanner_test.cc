@@ -18,7 +18,10 @@
 #include "arrow/dataset/scanner.h"
 
 #include <memory>
+#include <mutex>
+#include <vector>
 
+#include "arrow/array/array_nested.h"
 #include "arrow/dataset/test_util.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
@@ -140,13 +143,120 @@ TEST_F(TestScanner, ToTable) {
   ASSERT_OK_AND_ASSIGN(actual, scanner.ToTable());
   AssertTablesEqual(*expected, *actual);
 
-  // There is no guarantee on the ordering when using multiple threads, but
-  // since the RecordBatch is always the same it will pass.
+  // The order is checked in ScanBatchesInOrder
   ctx_->use_threads = true;
   ASSERT_OK_AND_ASSIGN(actual, scanner.ToTable());
   AssertTablesEqual(*expected, *actual);
 }
 
+TEST_F(TestScanner, ScanBatchesInOrder) {
+  SetSchema({field("i32", int32())});
+
+  // Tell batches apart by their values to check the order
+  std::vector<RecordBatchVector> child_batches(kNumberChildDatasets);
+  RecordBatchVector expected;
+  for (int32_t i = 0; i < kNumberChildDatasets * kNumberBatches; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto i32, ArrayFromBuilderVisitor(int32(), kBatchSize,
+                                                           [&](Int32Builder* builder) {
+                                                             builder->UnsafeAppend(i);
+                                                           }));
+    auto batch = RecordBatch::Make(schema_, kBatchSize, {i32});
+    child_batches[i / kNumberBatches].push_back(batch);
+    expected.push_back(batch);
+  }
+
+  DatasetVector children;
+  for (const auto& batches : child_batches) {
+    children.push_back(std::make_shared<InMemoryDataset>(schema_, batches));
+  }
+  ASSERT_OK_AND_ASSIGN(auto dataset, UnionDataset::Make(schema_, children));
+  ASSERT_OK_AND_ASSIGN(auto expected_table, Table::FromRecordBatches(expected));
+
+  auto check_scan = [&](bool use_threads, int32_t fragment_readahead,
+                        int64_t readahead_bytes) {
+    ctx_->use_threads = use_threads;
+    options_->fragment_readahead = fragment_readahead;
+    options_->readahead_bytes = readahead_bytes;
+    Scanner scanner{dataset, options_, ctx_};
+
+    ASSERT_OK_AND_ASSIGN(auto batch_it, scanner.ScanBatches());
+    ASSERT_OK_AND_ASSIGN(auto actual, batch_it.ToVector());
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      AssertBatchesEqual(*expected[i], *actual[i]);
+    }
+
+    ASSERT_OK_AND_ASSIGN(auto table, scanner.ToTable());
+    AssertTablesEqual(*expected_table, *table);
+  };
+
+  auto check_reader = [&](bool use_threads) {
+    ctx_->use_threads = use_threads;
+    Scanner scanner{dataset, options_, ctx_};
+
+    ASSERT_OK_AND_ASSIGN(auto reader, scanner.ToRecordBatchReader());
+    AssertSchemaEqual(*schema_, *reader->schema());
+    for (const auto& batch : expected) {
+      std::shared_ptr<RecordBatch> actual;
+      ASSERT_OK(reader->ReadNext(&actual));
+      ASSERT_NE(actual, nullptr);
+      AssertBatchesEqual(*batch, *actual);
+    }
+    std::shared_ptr<RecordBatch> end;
+    ASSERT_OK(reader->ReadNext(&end));
+    ASSERT_EQ(end, nullptr);
+  };
+
+  check_scan(false, kDefaultFragmentReadahead, kDefaultReadaheadBytes);
+  check_reader(false);
+  check_scan(true, kDefaultFragmentReadahead, kDefaultReadaheadBytes);
+  // Only the batch being consumed may be scanned ahead
+  check_scan(true, 1, 1);
+  check_scan(true, 2, kBatchSize * sizeof(int32_t) * 3);
+  check_reader(true);
+}
+
+TEST_F(TestScanner, AbandonScanBatches) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+  auto scanner = MakeScanner(batch);
+  ctx_->use_threads = true;
+
+  ASSERT_OK_AND_ASSIGN(auto batch_it, scanner.ScanBatches());
+  ASSERT_OK_AND_ASSIGN(auto first, batch_it.Next());
+  AssertBatchesEqual(*batch, *first);
+  // Dropping the iterator stops the scan in the background
+}
+
+TEST_F(TestScanner, TaskTiming) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+
+  for (bool use_threads : {false, true}) {
+    std::mutex mutex;
+    std::vector<ScanTaskTiming> timings;
+    ctx_->use_threads = use_threads;
+    ctx_->on_task_finished = [&](const ScanTaskTiming& timing) {
+      std::lock_guard<std::mutex> lock(mutex);
+      timings.push_back(timing);
+    };
+
+    auto scanner = MakeScanner(batch);
+    ASSERT_OK_AND_ASSIGN(auto table, scanner.ToTable());
+
+    int64_t num_batches = 0, num_rows = 0;
+    for (const auto& timing : timings) {
+      EXPECT_EQ(timing.fragment, "in-memory");
+      EXPECT_GE(timing.wall_nanos, 0);
+      num_batches += timing.num_batches;
+      num_rows += timing.num_rows;
+    }
+    EXPECT_EQ(num_batches, kNumberChildDatasets * kNumberBatches);
+    EXPECT_EQ(num_rows, table->num_rows());
+  }
+  ctx_->on_task_finished = nullptr;
+}
+
 class TestScannerBuilder : public ::testing::Test {
   void SetUp() {
     DatasetVector sources;
@@ -181,6 +291,56 @@ TEST_F(TestScannerBuilder, TestProject) {
   ASSERT_RAISES(Invalid, builder.Project({"i8", "not_found_column"}));
 }
 
+static Result<std::shared_ptr<Array>> MakeStruct(ArrayVector children,
+                                                  std::vector<std::string> names) {
+  return StructArray::Make(children, names);
+}
+
+TEST(ScannerBuilder, ProjectNestedFields) {
+  auto id = ArrayFromJSON(int64(), "[1, 2, 3]");
+  auto name = ArrayFromJSON(utf8(), R"(["a", "b", null])");
+  auto score = ArrayFromJSON(float64(), "[0.5, 1.5, 2.5]");
+  ASSERT_OK_AND_ASSIGN(auto user, MakeStruct({id, name}, {"id", "name"}));
+  ASSERT_OK_AND_ASSIGN(auto payload,
+                       MakeStruct({user, score}, {"user", "score"}));
+  auto other = ArrayFromJSON(int32(), "[7, 8, 9]");
+
+  auto dataset_schema = schema({field("other", int32()),
+                                field("payload", payload->type())});
+  auto batch = RecordBatch::Make(dataset_schema, 3, {other, payload});
+  auto dataset = std::make_shared<InMemoryDataset>(
+      dataset_schema, RecordBatchVector{batch->Slice(0, 1), batch->Slice(1)});
+  ScannerBuilder builder(dataset, std::make_shared<ScanContext>());
+
+  ASSERT_OK(builder.ProjectFields({FieldRef("payload", "user", "id"), FieldRef("other"),
+                                   FieldRef("payload", "score")}));
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+
+  ASSERT_OK_AND_ASSIGN(auto pruned_user, MakeStruct({id}, {"id"}));
+  ASSERT_OK_AND_ASSIGN(auto pruned_payload,
+                       MakeStruct({pruned_user, score}, {"user", "score"}));
+  auto expected_schema = schema({field("payload", pruned_payload->type()),
+                                 field("other", int32())});
+  AssertSchemaEqual(*expected_schema, *scanner->schema());
+
+  ASSERT_OK_AND_ASSIGN(auto table, scanner->ToTable());
+  ASSERT_OK_AND_ASSIGN(
+      auto expected,
+      Table::FromRecordBatches(
+          {RecordBatch::Make(expected_schema, 3, {pruned_payload, other})}));
+  AssertTablesEqual(*expected, *table, /*same_chunk_layout=*/false);
+
+  // Referencing a field and one of its children projects the whole field
+  ASSERT_OK(builder.ProjectFields({FieldRef("payload", "user"),
+                                   FieldRef("payload", "user", "name")}));
+  ASSERT_OK_AND_ASSIGN(scanner, builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto payload_user, MakeStruct({user}, {"user"}));
+  AssertSchemaEqual(*schema({field("payload", payload_user->type())}),
+                    *scanner->schema());
+
+  ASSERT_RAISES(Invalid, builder.ProjectFields({FieldRef("payload", "missing")}));
+}
+
 TEST_F(TestScannerBuilder, TestFilter) {
   ScannerBuilder builder(dataset_, ctx_);
 
@@ -194,6 +354,38 @@ TEST_F(TestScannerBuilder, TestFilter) {
                 builder.Filter("i64"_ == int64_t(10) || "not_a_column"_ == true));
 }
 
+TEST_F(TestScannerBuilder, TestEvaluator) {
+  ScannerBuilder builder(dataset_, ctx_);
+  ASSERT_OK(builder.Filter("i64"_ == int64_t(10)));
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+  ASSERT_NE(dynamic_cast<const TreeEvaluator*>(scanner->options()->evaluator.get()),
+            nullptr);
+
+  auto evaluator = std::make_shared<TreeEvaluator>(/*block_size=*/0);
+  ASSERT_RAISES(Invalid, builder.Evaluator(nullptr));
+  ASSERT_OK(builder.Evaluator(evaluator));
+  ASSERT_OK_AND_ASSIGN(scanner, builder.Finish());
+  ASSERT_EQ(scanner->options()->evaluator, evaluator);
+}
+
+TEST_F(TestScannerBuilder, TestReadahead) {
+  ScannerBuilder builder(dataset_, ctx_);
+
+  ASSERT_RAISES(Invalid, builder.FragmentReadahead(0));
+  ASSERT_RAISES(Invalid, builder.ReadaheadBytes(-1));
+  ASSERT_OK(builder.FragmentReadahead(2));
+  ASSERT_OK(builder.ReadaheadBytes(1 << 10));
+
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+  ASSERT_EQ(scanner->options()->fragment_readahead, 2);
+  ASSERT_EQ(scanner->options()->readahead_bytes, 1 << 10);
+
+  ASSERT_OK(builder.Project({"i8"}));
+  ASSERT_OK_AND_ASSIGN(scanner, builder.Finish());
+  ASSERT_EQ(scanner->options()->fragment_readahead, 2);
+  ASSERT_EQ(scanner->options()->readahead_bytes, 1 << 10);
+}
+
 using testing::ElementsAre;
 using testing::IsEmpty;
 
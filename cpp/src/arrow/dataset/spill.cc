@@ -0,0 +1,773 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/spill.h"
+
+#include <algorithm>
+#include <queue>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/exec.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/io/file.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/make_unique.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace dataset {
+
+constexpr int64_t SpillOptions::kDefaultMemoryLimit;
+
+namespace {
+
+Status ValidateSpillOptions(const SpillOptions& options) {
+  if (options.memory_limit <= 0) {
+    return Status::Invalid("SpillOptions::memory_limit must be greater than 0, got ",
+                           options.memory_limit);
+  }
+  if (options.batch_size <= 0) {
+    return Status::Invalid("SpillOptions::batch_size must be greater than 0, got ",
+                           options.batch_size);
+  }
+  if (options.num_partitions <= 0) {
+    return Status::Invalid("SpillOptions::num_partitions must be greater than 0, got ",
+                           options.num_partitions);
+  }
+  switch (options.compression) {
+    case Compression::UNCOMPRESSED:
+    case Compression::LZ4_FRAME:
+    case Compression::ZSTD:
+      return Status::OK();
+    default:
+      return Status::Invalid("Spill files can't be compressed with ",
+                             util::Codec::GetCodecAsString(options.compression));
+  }
+}
+
+int64_t BufferedBytes(const RecordBatch& batch) {
+  int64_t bytes = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    bytes += dataset::BufferedBytes(*batch.column_data(i));
+  }
+  return bytes;
+}
+
+// An IPC file being written to a SpillDirectory
+class SpillFileWriter {
+ public:
+  SpillFileWriter(std::shared_ptr<io::FileOutputStream> file,
+                  std::shared_ptr<ipc::RecordBatchWriter> writer)
+      : file_(std::move(file)), writer_(std::move(writer)) {}
+
+  ipc::RecordBatchWriter* operator->() { return writer_.get(); }
+
+  Status Close() {
+    RETURN_NOT_OK(writer_->Close());
+    return file_->Close();
+  }
+
+ private:
+  std::shared_ptr<io::FileOutputStream> file_;
+  std::shared_ptr<ipc::RecordBatchWriter> writer_;
+};
+
+// The temporary directory holding the spill files of an operator, removed with all
+// its files once the operator and the readers of its files are destroyed
+class SpillDirectory {
+ public:
+  static Result<std::shared_ptr<SpillDirectory>> Make(const SpillOptions& options) {
+    std::unique_ptr<internal::TemporaryDir> dir;
+    if (options.directory.empty()) {
+      ARROW_ASSIGN_OR_RAISE(dir, internal::TemporaryDir::Make("arrow-spill-"));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(
+          dir, internal::TemporaryDir::Make("arrow-spill-", options.directory));
+    }
+
+    auto write_options = ipc::IpcWriteOptions::Defaults();
+    write_options.memory_pool = options.pool;
+    // Operators spill from the threads executing them
+    write_options.use_threads = false;
+    if (options.compression != Compression::UNCOMPRESSED) {
+      ARROW_ASSIGN_OR_RAISE(write_options.codec,
+                            util::Codec::Create(options.compression));
+    }
+    auto read_options = ipc::IpcReadOptions::Defaults();
+    read_options.memory_pool = options.pool;
+    read_options.use_threads = false;
+
+    return std::shared_ptr<SpillDirectory>(
+        new SpillDirectory(std::move(dir), std::move(write_options), read_options));
+  }
+
+  Result<SpillFileWriter> OpenWriter(const std::string& name,
+                                     const std::shared_ptr<Schema>& schema) {
+    ARROW_ASSIGN_OR_RAISE(auto path, dir_->path().Join(name));
+    ARROW_ASSIGN_OR_RAISE(auto file, io::FileOutputStream::Open(path.ToString()));
+    ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeFileWriter(file, schema, write_options_));
+    return SpillFileWriter(std::move(file), std::move(writer));
+  }
+
+  Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReader(
+      const std::string& name) {
+    ARROW_ASSIGN_OR_RAISE(auto path, dir_->path().Join(name));
+    ARROW_ASSIGN_OR_RAISE(
+        auto file, io::ReadableFile::Open(path.ToString(), read_options_.memory_pool));
+    return ipc::RecordBatchFileReader::Open(file, read_options_);
+  }
+
+  // Read the batches of a spill file one at a time
+  Result<RecordBatchIterator> ReadBatches(const std::string& name) {
+    ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(name));
+    int i = 0;
+    return MakeFunctionIterator(
+        [reader, i]() mutable -> Result<std::shared_ptr<RecordBatch>> {
+          if (i == reader->num_record_batches()) {
+            return IterationTraits<std::shared_ptr<RecordBatch>>::End();
+          }
+          return reader->ReadRecordBatch(i++);
+        });
+  }
+
+ private:
+  SpillDirectory(std::unique_ptr<internal::TemporaryDir> dir,
+                 ipc::IpcWriteOptions write_options, ipc::IpcReadOptions read_options)
+      : dir_(std::move(dir)),
+        write_options_(std::move(write_options)),
+        read_options_(std::move(read_options)) {}
+
+  std::unique_ptr<internal::TemporaryDir> dir_;
+  ipc::IpcWriteOptions write_options_;
+  ipc::IpcReadOptions read_options_;
+};
+
+// ----------------------------------------------------------------------
+// Sorting
+
+// Compares values of one sort key across the batches of different sorted runs, as
+// sort_indices does
+class KeyComparator {
+ public:
+  virtual ~KeyComparator() = default;
+
+  virtual int Compare(const Array& left, int64_t left_index, const Array& right,
+                      int64_t right_index) const = 0;
+};
+
+template <typename Type>
+class TypedKeyComparator : public KeyComparator {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+
+ public:
+  TypedKeyComparator(compute::SortOrder order, compute::NullPlacement null_placement)
+      : order_(order), null_placement_(null_placement) {}
+
+  int Compare(const Array& left_array, int64_t left_index, const Array& right_array,
+              int64_t right_index) const override {
+    const auto& left = checked_cast<const ArrayType&>(left_array);
+    const auto& right = checked_cast<const ArrayType&>(right_array);
+    const bool left_null = left.IsNull(left_index);
+    const bool right_null = right.IsNull(right_index);
+    if (left_null || right_null) {
+      if (left_null && right_null) return 0;
+      return left_null == (null_placement_ == compute::NullPlacement::AtStart) ? -1 : 1;
+    }
+    const auto left_value = left.GetView(left_index);
+    const auto right_value = right.GetView(right_index);
+    int compared = left_value < right_value ? -1 : (right_value < left_value ? 1 : 0);
+    return order_ == compute::SortOrder::Ascending ? compared : -compared;
+  }
+
+ private:
+  compute::SortOrder order_;
+  compute::NullPlacement null_placement_;
+};
+
+Result<std::unique_ptr<KeyComparator>> MakeKeyComparator(
+    const DataType& type, compute::SortOrder order,
+    compute::NullPlacement null_placement) {
+  switch (type.id()) {
+#define MAKE_KEY_COMPARATOR(TYPE_CLASS)                                   \
+  case TYPE_CLASS##Type::type_id:                                         \
+    return std::unique_ptr<KeyComparator>(                                \
+        new TypedKeyComparator<TYPE_CLASS##Type>(order, null_placement));
+    MAKE_KEY_COMPARATOR(Int8)
+    MAKE_KEY_COMPARATOR(Int16)
+    MAKE_KEY_COMPARATOR(Int32)
+    MAKE_KEY_COMPARATOR(Int64)
+    MAKE_KEY_COMPARATOR(UInt8)
+    MAKE_KEY_COMPARATOR(UInt16)
+    MAKE_KEY_COMPARATOR(UInt32)
+    MAKE_KEY_COMPARATOR(UInt64)
+    MAKE_KEY_COMPARATOR(Float)
+    MAKE_KEY_COMPARATOR(Double)
+    MAKE_KEY_COMPARATOR(Date32)
+    MAKE_KEY_COMPARATOR(Date64)
+    MAKE_KEY_COMPARATOR(Time32)
+    MAKE_KEY_COMPARATOR(Time64)
+    MAKE_KEY_COMPARATOR(Timestamp)
+    MAKE_KEY_COMPARATOR(Duration)
+    MAKE_KEY_COMPARATOR(Binary)
+    MAKE_KEY_COMPARATOR(String)
+    MAKE_KEY_COMPARATOR(LargeBinary)
+    MAKE_KEY_COMPARATOR(LargeString)
+#undef MAKE_KEY_COMPARATOR
+    default:
+      return Status::TypeError("Sorting not supported for type ", type);
+  }
+}
+
+// The k-way merge of sorted runs, each a sequence of sorted batches. Ties are broken
+// by the order of the runs, which keeps the merge stable if runs are in input order.
+class MergingReader : public RecordBatchReader {
+ public:
+  MergingReader(std::shared_ptr<Schema> schema, std::vector<int> key_indices,
+                std::vector<std::unique_ptr<KeyComparator>> comparators,
+                std::vector<RecordBatchIterator> runs, int64_t batch_size,
+                MemoryPool* pool, std::shared_ptr<SpillDirectory> directory)
+      : schema_(std::move(schema)),
+        key_indices_(std::move(key_indices)),
+        comparators_(std::move(comparators)),
+        batch_size_(batch_size),
+        ctx_(pool),
+        directory_(std::move(directory)),
+        heap_(HeapOrder{this}) {
+    for (auto& run : runs) {
+      runs_.push_back(Run{std::move(run), nullptr, 0});
+    }
+  }
+
+  Status Init() {
+    for (size_t i = 0; i < runs_.size(); ++i) {
+      RETURN_NOT_OK(LoadNextBatch(&runs_[i]));
+      if (runs_[i].batch != nullptr) {
+        heap_.push(i);
+      }
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    if (heap_.empty()) {
+      *out = nullptr;
+      return Status::OK();
+    }
+
+    // Gather the rows of the output batch from the batches they're in, each batch
+    // becoming a chunk of the table the rows are then taken from
+    RecordBatchVector chunks;
+    std::vector<int64_t> chunk_offsets;
+    std::vector<const RecordBatch*> run_chunks(runs_.size(), nullptr);
+    std::vector<int64_t> run_chunk_offsets(runs_.size(), 0);
+    Int64Builder indices(ctx_.memory_pool());
+    RETURN_NOT_OK(indices.Reserve(batch_size_));
+
+    int64_t chunks_length = 0;
+    while (indices.length() < batch_size_ && !heap_.empty()) {
+      const size_t i = heap_.top();
+      heap_.pop();
+      Run* run = &runs_[i];
+      if (run_chunks[i] != run->batch.get()) {
+        run_chunks[i] = run->batch.get();
+        run_chunk_offsets[i] = chunks_length;
+        chunks.push_back(run->batch);
+        chunks_length += run->batch->num_rows();
+      }
+      indices.UnsafeAppend(run_chunk_offsets[i] + run->row);
+
+      if (++run->row == run->batch->num_rows()) {
+        RETURN_NOT_OK(LoadNextBatch(run));
+      }
+      if (run->batch != nullptr) {
+        heap_.push(i);
+      }
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(schema_, chunks));
+    ARROW_ASSIGN_OR_RAISE(auto taken_indices, indices.Finish());
+    ARROW_ASSIGN_OR_RAISE(Datum taken,
+                          compute::Take(table, taken_indices,
+                                        compute::TakeOptions::NoBoundsCheck(), &ctx_));
+    ARROW_ASSIGN_OR_RAISE(auto combined,
+                          taken.table()->CombineChunks(ctx_.memory_pool()));
+    TableBatchReader reader(*combined);
+    return reader.ReadNext(out);
+  }
+
+ private:
+  struct Run {
+    RecordBatchIterator batches;
+    std::shared_ptr<RecordBatch> batch;
+    int64_t row;
+  };
+
+  // Order the heap of runs so that its top is the run with the least current row
+  struct HeapOrder {
+    bool operator()(size_t left, size_t right) const {
+      const int compared = self->CompareRows(self->runs_[left], self->runs_[right]);
+      return compared != 0 ? compared > 0 : left > right;
+    }
+
+    MergingReader* self;
+  };
+
+  Status LoadNextBatch(Run* run) {
+    do {
+      ARROW_ASSIGN_OR_RAISE(run->batch, run->batches.Next());
+    } while (run->batch != nullptr && run->batch->num_rows() == 0);
+    run->row = 0;
+    return Status::OK();
+  }
+
+  int CompareRows(const Run& left, const Run& right) const {
+    for (size_t k = 0; k < key_indices_.size(); ++k) {
+      const int compared =
+          comparators_[k]->Compare(*left.batch->column(key_indices_[k]), left.row,
+                                   *right.batch->column(key_indices_[k]), right.row);
+      if (compared != 0) return compared;
+    }
+    return 0;
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::vector<int> key_indices_;
+  std::vector<std::unique_ptr<KeyComparator>> comparators_;
+  int64_t batch_size_;
+  compute::ExecContext ctx_;
+  // Declared before the runs, so that the spill files are closed before removal
+  std::shared_ptr<SpillDirectory> directory_;
+  std::vector<Run> runs_;
+  std::priority_queue<size_t, std::vector<size_t>, HeapOrder> heap_;
+};
+
+// ----------------------------------------------------------------------
+// Grouping
+
+// Hash the keys of each row of a batch, equal keys having equal hashes
+class KeyHasher {
+ public:
+  static Status Check(const DataType& type) {
+    // Dictionary indices aren't comparable across batches
+    if (type.id() != Type::DICTIONARY &&
+        (is_base_binary_like(type.id()) || is_fixed_width(type.id()))) {
+      return Status::OK();
+    }
+    return Status::NotImplemented("Spilling a group by on keys of type ", type);
+  }
+
+  static Status HashColumn(const Array& column, std::vector<uint64_t>* hashes) {
+    const int64_t length = column.length();
+    auto combine = [hashes](int64_t i, uint64_t hash) {
+      // Mix the hashes of the keys as boost::hash_combine does
+      (*hashes)[i] ^= hash + 0x9e3779b97f4a7c15ULL + ((*hashes)[i] << 6) +
+                      ((*hashes)[i] >> 2);
+    };
+
+    if (column.type_id() == Type::BOOL) {
+      const auto& values = checked_cast<const BooleanArray&>(column);
+      for (int64_t i = 0; i < length; ++i) {
+        combine(i, values.IsNull(i) ? 0 : (values.Value(i) ? 1 : 2));
+      }
+    } else if (is_binary_like(column.type_id())) {
+      const auto& values = checked_cast<const BinaryArray&>(column);
+      for (int64_t i = 0; i < length; ++i) {
+        const auto view = values.GetView(i);
+        combine(i, values.IsNull(i) ? 0
+                                    : internal::ComputeStringHash<0>(view.data(),
+                                                                    view.size()));
+      }
+    } else if (is_large_binary_like(column.type_id())) {
+      const auto& values = checked_cast<const LargeBinaryArray&>(column);
+      for (int64_t i = 0; i < length; ++i) {
+        const auto view = values.GetView(i);
+        combine(i, values.IsNull(i) ? 0
+                                    : internal::ComputeStringHash<0>(view.data(),
+                                                                    view.size()));
+      }
+    } else {
+      const int byte_width =
+          checked_cast<const FixedWidthType&>(*column.type()).bit_width() / 8;
+      const uint8_t* data =
+          column.data()->GetValues<uint8_t>(1, column.offset() * byte_width);
+      for (int64_t i = 0; i < length; ++i) {
+        combine(i, column.IsNull(i) ? 0
+                                    : internal::ComputeStringHash<0>(
+                                          data + i * byte_width, byte_width));
+      }
+    }
+    return Status::OK();
+  }
+};
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// SpillingSorter implementation
+
+class SpillingSorter::Impl {
+ public:
+  Impl(std::shared_ptr<Schema> schema, compute::SortOptions sort_options,
+       SpillOptions spill_options, std::vector<int> key_indices)
+      : schema_(std::move(schema)),
+        sort_options_(std::move(sort_options)),
+        spill_options_(std::move(spill_options)),
+        key_indices_(std::move(key_indices)),
+        ctx_(spill_options_.pool) {}
+
+  Status Consume(std::shared_ptr<RecordBatch> batch) {
+    if (!batch->schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::TypeError("SpillingSorter of ", *schema_,
+                               " can't consume a batch of ", *batch->schema());
+    }
+    if (batch->num_rows() == 0) {
+      return Status::OK();
+    }
+    bytes_ += BufferedBytes(*batch);
+    buffered_.push_back(std::move(batch));
+    if (bytes_ > spill_options_.memory_limit) {
+      return SpillRun();
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<RecordBatchReader>> Finish() {
+    ARROW_ASSIGN_OR_RAISE(auto sorted_batches, SortBuffered());
+    if (runs_.empty()) {
+      return RecordBatchReader::Make(std::move(sorted_batches), schema_);
+    }
+
+    // The buffered batches come last in the input, hence are the last run
+    std::vector<RecordBatchIterator> runs;
+    for (const auto& run : runs_) {
+      ARROW_ASSIGN_OR_RAISE(auto batches, directory_->ReadBatches(run));
+      runs.push_back(std::move(batches));
+    }
+    runs.push_back(MakeVectorIterator(std::move(sorted_batches)));
+
+    std::vector<std::unique_ptr<KeyComparator>> comparators;
+    for (size_t k = 0; k < key_indices_.size(); ++k) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto comparator,
+          MakeKeyComparator(*schema_->field(key_indices_[k])->type(),
+                            sort_options_.sort_keys[k].order,
+                            sort_options_.null_placement));
+      comparators.push_back(std::move(comparator));
+    }
+    auto reader = std::make_shared<MergingReader>(
+        schema_, key_indices_, std::move(comparators), std::move(runs),
+        spill_options_.batch_size, spill_options_.pool, directory_);
+    RETURN_NOT_OK(reader->Init());
+    return reader;
+  }
+
+  int num_spilled_runs() const { return static_cast<int>(runs_.size()); }
+
+ private:
+  // Sort the buffered batches into batches of at most batch_size rows
+  Result<RecordBatchVector> SortBuffered() {
+    RecordBatchVector sorted_batches;
+    if (buffered_.empty()) {
+      return sorted_batches;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(schema_, buffered_));
+    buffered_.clear();
+    bytes_ = 0;
+    ARROW_ASSIGN_OR_RAISE(auto indices,
+                          compute::SortIndices(table, sort_options_, &ctx_));
+    ARROW_ASSIGN_OR_RAISE(Datum sorted,
+                          compute::Take(table, indices,
+                                        compute::TakeOptions::NoBoundsCheck(), &ctx_));
+    TableBatchReader reader(*sorted.table());
+    reader.set_chunksize(spill_options_.batch_size);
+    RETURN_NOT_OK(reader.ReadAll(&sorted_batches));
+    return sorted_batches;
+  }
+
+  Status SpillRun() {
+    ARROW_ASSIGN_OR_RAISE(auto sorted_batches, SortBuffered());
+    if (directory_ == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(directory_, SpillDirectory::Make(spill_options_));
+    }
+    auto name = "run-" + std::to_string(runs_.size()) + ".arrow";
+    ARROW_ASSIGN_OR_RAISE(auto writer, directory_->OpenWriter(name, schema_));
+    for (const auto& batch : sorted_batches) {
+      RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    RETURN_NOT_OK(writer.Close());
+    runs_.push_back(std::move(name));
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema_;
+  compute::SortOptions sort_options_;
+  SpillOptions spill_options_;
+  std::vector<int> key_indices_;
+  compute::ExecContext ctx_;
+
+  RecordBatchVector buffered_;
+  int64_t bytes_ = 0;
+  std::shared_ptr<SpillDirectory> directory_;
+  std::vector<std::string> runs_;
+};
+
+Result<std::unique_ptr<SpillingSorter>> SpillingSorter::Make(
+    std::shared_ptr<Schema> schema, compute::SortOptions sort_options,
+    SpillOptions spill_options) {
+  RETURN_NOT_OK(ValidateSpillOptions(spill_options));
+  if (sort_options.sort_keys.empty()) {
+    return Status::Invalid("SpillingSorter requires at least one sort key");
+  }
+  std::vector<int> key_indices;
+  for (const auto& sort_key : sort_options.sort_keys) {
+    RETURN_NOT_OK(schema->CanReferenceFieldsByNames({sort_key.name}));
+    key_indices.push_back(schema->GetFieldIndex(sort_key.name));
+    RETURN_NOT_OK(MakeKeyComparator(*schema->field(key_indices.back())->type(),
+                                    sort_key.order, sort_options.null_placement)
+                      .status());
+  }
+  return std::unique_ptr<SpillingSorter>(new SpillingSorter(
+      ::arrow::internal::make_unique<Impl>(std::move(schema), std::move(sort_options),
+                                           std::move(spill_options),
+                                           std::move(key_indices))));
+}
+
+SpillingSorter::SpillingSorter(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+SpillingSorter::~SpillingSorter() = default;
+
+Status SpillingSorter::Consume(std::shared_ptr<RecordBatch> batch) {
+  return impl_->Consume(std::move(batch));
+}
+
+Result<std::shared_ptr<RecordBatchReader>> SpillingSorter::Finish() {
+  return impl_->Finish();
+}
+
+int SpillingSorter::num_spilled_runs() const { return impl_->num_spilled_runs(); }
+
+// ----------------------------------------------------------------------
+// SpillingGroupBy implementation
+
+class SpillingGroupBy::Impl {
+ public:
+  Impl(std::shared_ptr<Schema> schema, std::vector<QueryAggregate> aggregates,
+       std::vector<int> target_indices, std::vector<int> key_indices,
+       SpillOptions spill_options)
+      : schema_(std::move(schema)),
+        aggregates_(std::move(aggregates)),
+        target_indices_(std::move(target_indices)),
+        key_indices_(std::move(key_indices)),
+        spill_options_(std::move(spill_options)),
+        ctx_(spill_options_.pool) {}
+
+  Status Consume(std::shared_ptr<RecordBatch> batch) {
+    if (!batch->schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::TypeError("SpillingGroupBy of ", *schema_,
+                               " can't consume a batch of ", *batch->schema());
+    }
+    if (batch->num_rows() == 0) {
+      return Status::OK();
+    }
+    bytes_ += BufferedBytes(*batch);
+    buffered_.push_back(std::move(batch));
+    if (bytes_ > spill_options_.memory_limit) {
+      return SpillPartitions();
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Table>> Finish() {
+    if (partitions_.empty()) {
+      ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(schema_, buffered_));
+      buffered_.clear();
+      ARROW_ASSIGN_OR_RAISE(auto output, Aggregate(*table));
+      return Table::FromRecordBatches(output_schema_, {output});
+    }
+
+    RETURN_NOT_OK(SpillPartitions());
+    for (auto& partition : partitions_) {
+      RETURN_NOT_OK(partition.Close());
+    }
+    partitions_.clear();
+
+    // Aggregate one partition at a time
+    RecordBatchVector outputs;
+    for (int p = 0; p < spill_options_.num_partitions; ++p) {
+      ARROW_ASSIGN_OR_RAISE(auto reader, directory_->OpenReader(PartitionName(p)));
+      RecordBatchVector batches(reader->num_record_batches());
+      for (int i = 0; i < reader->num_record_batches(); ++i) {
+        ARROW_ASSIGN_OR_RAISE(batches[i], reader->ReadRecordBatch(i));
+      }
+      ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(schema_, batches));
+      if (table->num_rows() == 0) continue;
+      ARROW_ASSIGN_OR_RAISE(auto output, Aggregate(*table));
+      outputs.push_back(std::move(output));
+    }
+    return Table::FromRecordBatches(output_schema_, std::move(outputs));
+  }
+
+  bool spilled() const { return directory_ != nullptr; }
+
+  Status Init() {
+    // Resolve the output schema by aggregating nothing
+    ARROW_ASSIGN_OR_RAISE(auto empty, Table::FromRecordBatches(schema_, {}));
+    return Aggregate(*empty).status();
+  }
+
+ private:
+  static std::string PartitionName(int partition) {
+    return "partition-" + std::to_string(partition) + ".arrow";
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Aggregate(const Table& table) {
+    std::vector<Datum> arguments, keys;
+    std::vector<compute::internal::Aggregate> aggregates;
+    for (size_t i = 0; i < aggregates_.size(); ++i) {
+      arguments.emplace_back(table.column(target_indices_[i]));
+      aggregates.push_back({"hash_" + aggregates_[i].function, aggregates_[i].options});
+    }
+    for (int key : key_indices_) {
+      keys.emplace_back(table.column(key));
+    }
+    ARROW_ASSIGN_OR_RAISE(Datum grouped,
+                          compute::internal::GroupBy(arguments, keys, aggregates, &ctx_));
+    const auto columns = checked_cast<const StructArray&>(*grouped.make_array()).fields();
+
+    if (output_schema_ == nullptr) {
+      FieldVector fields;
+      for (size_t i = 0; i < aggregates_.size(); ++i) {
+        const auto& name =
+            aggregates_[i].name.empty() ? aggregates_[i].function : aggregates_[i].name;
+        fields.push_back(field(name, columns[i]->type()));
+      }
+      for (int key : key_indices_) {
+        fields.push_back(schema_->field(key));
+      }
+      output_schema_ = schema(std::move(fields));
+    }
+    return RecordBatch::Make(output_schema_, grouped.length(), columns);
+  }
+
+  Status SpillPartitions() {
+    if (directory_ == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(directory_, SpillDirectory::Make(spill_options_));
+      for (int p = 0; p < spill_options_.num_partitions; ++p) {
+        ARROW_ASSIGN_OR_RAISE(auto writer,
+                              directory_->OpenWriter(PartitionName(p), schema_));
+        partitions_.push_back(std::move(writer));
+      }
+    }
+
+    const auto num_partitions = static_cast<uint64_t>(spill_options_.num_partitions);
+    std::vector<std::vector<int64_t>> partition_rows(num_partitions);
+    for (const auto& batch : buffered_) {
+      std::vector<uint64_t> hashes(batch->num_rows(), 0);
+      for (int key : key_indices_) {
+        RETURN_NOT_OK(KeyHasher::HashColumn(*batch->column(key), &hashes));
+      }
+      for (auto& rows : partition_rows) {
+        rows.clear();
+      }
+      for (int64_t i = 0; i < batch->num_rows(); ++i) {
+        partition_rows[hashes[i] % num_partitions].push_back(i);
+      }
+
+      for (uint64_t p = 0; p < num_partitions; ++p) {
+        if (partition_rows[p].empty()) continue;
+        std::shared_ptr<Array> indices;
+        Int64Builder builder(ctx_.memory_pool());
+        RETURN_NOT_OK(builder.AppendValues(partition_rows[p]));
+        RETURN_NOT_OK(builder.Finish(&indices));
+        ARROW_ASSIGN_OR_RAISE(
+            Datum rows,
+            compute::Take(batch, indices, compute::TakeOptions::NoBoundsCheck(), &ctx_));
+        RETURN_NOT_OK(partitions_[p]->WriteRecordBatch(*rows.record_batch()));
+      }
+    }
+    buffered_.clear();
+    bytes_ = 0;
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::vector<QueryAggregate> aggregates_;
+  std::vector<int> target_indices_;
+  std::vector<int> key_indices_;
+  SpillOptions spill_options_;
+  compute::ExecContext ctx_;
+  std::shared_ptr<Schema> output_schema_;
+
+  RecordBatchVector buffered_;
+  int64_t bytes_ = 0;
+  std::shared_ptr<SpillDirectory> directory_;
+  std::vector<SpillFileWriter> partitions_;
+};
+
+Result<std::unique_ptr<SpillingGroupBy>> SpillingGroupBy::Make(
+    std::shared_ptr<Schema> schema, std::vector<QueryAggregate> aggregates,
+    std::vector<std::string> keys, SpillOptions spill_options) {
+  RETURN_NOT_OK(ValidateSpillOptions(spill_options));
+  if (keys.empty()) {
+    return Status::Invalid("SpillingGroupBy requires at least one key");
+  }
+  std::vector<int> target_indices, key_indices;
+  for (const auto& aggregate : aggregates) {
+    RETURN_NOT_OK(schema->CanReferenceFieldsByNames({aggregate.target}));
+    target_indices.push_back(schema->GetFieldIndex(aggregate.target));
+  }
+  for (const auto& key : keys) {
+    RETURN_NOT_OK(schema->CanReferenceFieldsByNames({key}));
+    key_indices.push_back(schema->GetFieldIndex(key));
+    RETURN_NOT_OK(KeyHasher::Check(*schema->field(key_indices.back())->type()));
+  }
+  auto impl = ::arrow::internal::make_unique<Impl>(
+      std::move(schema), std::move(aggregates), std::move(target_indices),
+      std::move(key_indices), std::move(spill_options));
+  RETURN_NOT_OK(impl->Init());
+  return std::unique_ptr<SpillingGroupBy>(new SpillingGroupBy(std::move(impl)));
+}
+
+SpillingGroupBy::SpillingGroupBy(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+SpillingGroupBy::~SpillingGroupBy() = default;
+
+Status SpillingGroupBy::Consume(std::shared_ptr<RecordBatch> batch) {
+  return impl_->Consume(std::move(batch));
+}
+
+Result<std::shared_ptr<Table>> SpillingGroupBy::Finish() { return impl_->Finish(); }
+
+bool SpillingGroupBy::spilled() const { return impl_->spilled(); }
+
+}  // namespace dataset
+}  // namespace arrow
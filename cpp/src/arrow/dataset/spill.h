@@ -0,0 +1,148 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/api_vector.h"
+#include "arrow/dataset/query.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/memory_pool.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/compression.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief Options of the operators which spill their input to disk when it exceeds a
+/// memory budget
+struct ARROW_DS_EXPORT SpillOptions {
+  static constexpr int64_t kDefaultMemoryLimit = 256 << 20;
+
+  /// The number of bytes of input an operator may hold in memory before spilling it,
+  /// as measured by the sizes of the buffers its record batches reference
+  int64_t memory_limit = kDefaultMemoryLimit;
+
+  /// The directory in which an operator creates its spill files, inside a
+  /// subdirectory removed with the operator. The platform's temporary directory if
+  /// empty.
+  std::string directory;
+
+  /// The compression of the spill files' buffers: UNCOMPRESSED, LZ4_FRAME or ZSTD
+  Compression::type compression = Compression::UNCOMPRESSED;
+
+  /// The maximum number of rows of the batches written to and read from spill files,
+  /// and of the batches an operator outputs
+  int64_t batch_size = 1 << 15;
+
+  /// The number of partitions an operator partitioning its input by hash spills to
+  int num_partitions = 16;
+
+  /// The pool from which operators allocate, including when reading spill files
+  MemoryPool* pool = default_memory_pool();
+
+  static SpillOptions Defaults() { return SpillOptions(); }
+};
+
+/// \brief Sort record batches which may not fit in memory.
+///
+/// The batches consumed are buffered until they exceed the memory limit, then
+/// sorted and spilled as a sorted run to an Arrow IPC file. Finish() merges the
+/// spilled runs and the last buffered batches into a single sorted stream.
+///
+/// Like sort_indices, the sort is stable.
+class ARROW_DS_EXPORT SpillingSorter {
+ public:
+  /// \brief Make a sorter of batches of the given schema
+  ///
+  /// \return Failure if the sort keys aren't columns of the schema or if the spill
+  /// options are invalid.
+  static Result<std::unique_ptr<SpillingSorter>> Make(
+      std::shared_ptr<Schema> schema, compute::SortOptions sort_options,
+      SpillOptions spill_options = SpillOptions::Defaults());
+
+  ~SpillingSorter();
+
+  /// \brief Add a batch to sort, spilling the buffered batches if over budget
+  Status Consume(std::shared_ptr<RecordBatch> batch);
+
+  /// \brief Sort all consumed batches
+  ///
+  /// The returned reader keeps the spill files until it is destroyed. The sorter must
+  /// not be used afterwards.
+  Result<std::shared_ptr<RecordBatchReader>> Finish();
+
+  /// \brief The number of sorted runs spilled to disk so far
+  int num_spilled_runs() const;
+
+ private:
+  class Impl;
+  explicit SpillingSorter(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Group record batches by keys and aggregate each group, the distinct keys
+/// possibly not fitting in memory.
+///
+/// The batches consumed are buffered until they exceed the memory limit. The
+/// buffered rows are then partitioned by the hash of their keys and spilled to one
+/// Arrow IPC file per partition. Finish() aggregates each partition in turn, holding
+/// the groups of a single partition in memory.
+///
+/// The output has one column per aggregate, followed by one column per key, as the
+/// output of QueryPlan::Aggregate. The order of the groups is unspecified.
+class ARROW_DS_EXPORT SpillingGroupBy {
+ public:
+  /// \brief Make a group by of batches of the given schema
+  ///
+  /// \param[in] schema the schema of the batches consumed
+  /// \param[in] aggregates the aggregations, of the hash aggregate functions
+  /// prefixed by "hash_"
+  /// \param[in] keys the names of the columns to group rows by, at least one
+  /// \param[in] spill_options the options of spilling
+  static Result<std::unique_ptr<SpillingGroupBy>> Make(
+      std::shared_ptr<Schema> schema, std::vector<QueryAggregate> aggregates,
+      std::vector<std::string> keys,
+      SpillOptions spill_options = SpillOptions::Defaults());
+
+  ~SpillingGroupBy();
+
+  /// \brief Add a batch to aggregate, spilling the buffered batches if over budget
+  Status Consume(std::shared_ptr<RecordBatch> batch);
+
+  /// \brief Aggregate all consumed batches. The group by must not be used afterwards.
+  Result<std::shared_ptr<Table>> Finish();
+
+  /// \brief Whether the consumed batches have been spilled to disk so far
+  bool spilled() const;
+
+ private:
+  class Impl;
+  explicit SpillingGroupBy(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace dataset
+}  // namespace arrow
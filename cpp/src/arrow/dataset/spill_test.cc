@@ -0,0 +1,208 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/spill.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/compute/api_vector.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace dataset {
+
+using compute::SortKey;
+using compute::SortOptions;
+using compute::SortOrder;
+
+class TestSpilling : public ::testing::TestWithParam<Compression::type> {
+ protected:
+  void SetUp() override {
+    if (!util::Codec::IsAvailable(GetParam())) {
+      GTEST_SKIP() << "Compression not available";
+    }
+    ASSERT_OK_AND_ASSIGN(spill_dir_,
+                         arrow::internal::TemporaryDir::Make("spill-test-"));
+    spill_options_.directory = spill_dir_->path().ToString();
+    spill_options_.compression = GetParam();
+    spill_options_.batch_size = 100;
+
+    schema_ = schema({field("key", utf8()), field("i", int32()), field("f", float64())});
+    random::RandomArrayGenerator rng(42);
+    // Few distinct keys, with duplicates across and within batches
+    auto keys = rng.StringWithRepeats(50 * 20 * 19 / 2, /*unique=*/30, /*min_length=*/1,
+                                      /*max_length=*/4, /*null_probability=*/0.1);
+    int64_t offset = 0;
+    for (int i = 0; i < 20; ++i) {
+      const int64_t length = 50 * i;
+      batches_.push_back(RecordBatch::Make(
+          schema_, length,
+          {keys->Slice(offset, length),
+           rng.Int32(length, -100, 100, /*null_probability=*/0.1),
+           rng.Float64(length, -1, 1, /*null_probability=*/0.1)}));
+      offset += length;
+    }
+  }
+
+  // The number of spill directories created in spill_dir_
+  size_t NumSpillDirs() {
+    EXPECT_OK_AND_ASSIGN(auto entries, arrow::internal::ListDir(spill_dir_->path()));
+    return entries.size();
+  }
+
+  Result<std::shared_ptr<Table>> InMemorySort(const SortOptions& options) {
+    ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(schema_, batches_));
+    ARROW_ASSIGN_OR_RAISE(auto indices, compute::SortIndices(table, options));
+    ARROW_ASSIGN_OR_RAISE(Datum sorted, compute::Take(table, indices));
+    return sorted.table();
+  }
+
+  std::unique_ptr<arrow::internal::TemporaryDir> spill_dir_;
+  SpillOptions spill_options_;
+  std::shared_ptr<Schema> schema_;
+  RecordBatchVector batches_;
+};
+
+TEST_P(TestSpilling, Sort) {
+  for (const auto& options :
+       {SortOptions({SortKey("key")}),
+        SortOptions({SortKey("key", SortOrder::Descending), SortKey("i")},
+                    compute::NullPlacement::AtStart),
+        SortOptions({SortKey("f"), SortKey("key")})}) {
+    ASSERT_OK_AND_ASSIGN(auto expected, InMemorySort(options));
+
+    // Spill no runs, a few runs or a run per batch
+    for (int64_t memory_limit : {int64_t(1) << 30, int64_t(10000), int64_t(1)}) {
+      spill_options_.memory_limit = memory_limit;
+      ASSERT_OK_AND_ASSIGN(auto sorter,
+                           SpillingSorter::Make(schema_, options, spill_options_));
+      for (const auto& batch : batches_) {
+        ASSERT_OK(sorter->Consume(batch));
+      }
+      if (memory_limit == 1) {
+        // Empty batches aren't spilled
+        ASSERT_EQ(sorter->num_spilled_runs(), static_cast<int>(batches_.size()) - 1);
+      } else if (memory_limit > 10000) {
+        ASSERT_EQ(sorter->num_spilled_runs(), 0);
+      } else {
+        ASSERT_GT(sorter->num_spilled_runs(), 1);
+      }
+
+      ASSERT_OK_AND_ASSIGN(auto reader, sorter->Finish());
+      sorter.reset();
+      RecordBatchVector sorted_batches;
+      ASSERT_OK(reader->ReadAll(&sorted_batches));
+      for (const auto& batch : sorted_batches) {
+        ASSERT_LE(batch->num_rows(), spill_options_.batch_size);
+      }
+      ASSERT_OK_AND_ASSIGN(auto sorted,
+                           Table::FromRecordBatches(schema_, sorted_batches));
+      // The sort is stable, so the output is exactly the in-memory sort's
+      AssertTablesEqual(*expected, *sorted, /*same_chunk_layout=*/false);
+    }
+  }
+}
+
+TEST_P(TestSpilling, RemoveSpillFiles) {
+  spill_options_.memory_limit = 1;
+  ASSERT_OK_AND_ASSIGN(
+      auto sorter,
+      SpillingSorter::Make(schema_, SortOptions({SortKey("i")}), spill_options_));
+  for (const auto& batch : batches_) {
+    ASSERT_OK(sorter->Consume(batch));
+  }
+  ASSERT_EQ(NumSpillDirs(), 1);
+  ASSERT_OK_AND_ASSIGN(auto reader, sorter->Finish());
+  sorter.reset();
+  // The reader keeps the spill files until it's destroyed
+  ASSERT_EQ(NumSpillDirs(), 1);
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  reader.reset();
+  ASSERT_EQ(NumSpillDirs(), 0);
+}
+
+TEST_P(TestSpilling, GroupBy) {
+  std::vector<QueryAggregate> aggregates = {
+      {"sum", "i", "sum_i"}, {"count", "f", "count_f"}, {"min_max", "f"}};
+
+  std::shared_ptr<Table> expected;
+  for (int64_t memory_limit : {int64_t(1) << 30, int64_t(10000), int64_t(1)}) {
+    spill_options_.memory_limit = memory_limit;
+    ASSERT_OK_AND_ASSIGN(auto group_by, SpillingGroupBy::Make(schema_, aggregates,
+                                                              {"key"}, spill_options_));
+    for (const auto& batch : batches_) {
+      ASSERT_OK(group_by->Consume(batch));
+    }
+    ASSERT_EQ(group_by->spilled(), memory_limit <= 10000);
+    ASSERT_OK_AND_ASSIGN(auto grouped, group_by->Finish());
+    ASSERT_OK(grouped->ValidateFull());
+
+    // Groups are output in an unspecified order, sort them
+    ASSERT_OK_AND_ASSIGN(
+        auto indices,
+        compute::SortIndices(grouped, SortOptions({SortKey("key")},
+                                                  compute::NullPlacement::AtStart)));
+    ASSERT_OK_AND_ASSIGN(Datum sorted, compute::Take(grouped, indices));
+    ASSERT_EQ(sorted.table()->schema()->field_names(),
+              std::vector<std::string>({"sum_i", "count_f", "min_max", "key"}));
+    // At most 30 distinct keys and null
+    ASSERT_LE(sorted.table()->num_rows(), 31);
+    if (expected == nullptr) {
+      // Without spilling, the group by aggregates everything at once
+      expected = sorted.table();
+    } else {
+      AssertTablesEqual(*expected, *sorted.table(), /*same_chunk_layout=*/false);
+    }
+  }
+}
+
+TEST_P(TestSpilling, Invalid) {
+  spill_options_.memory_limit = 0;
+  ASSERT_RAISES(Invalid, SpillingSorter::Make(schema_, SortOptions({SortKey("i")}),
+                                              spill_options_));
+  spill_options_.memory_limit = 1;
+  ASSERT_RAISES(Invalid, SpillingSorter::Make(schema_, SortOptions(), spill_options_));
+  ASSERT_RAISES(Invalid, SpillingSorter::Make(schema_, SortOptions({SortKey("missing")}),
+                                              spill_options_));
+  ASSERT_RAISES(Invalid,
+                SpillingGroupBy::Make(schema_, {{"sum", "i"}}, {}, spill_options_));
+  ASSERT_RAISES(Invalid, SpillingGroupBy::Make(schema_, {{"sum", "missing"}}, {"key"},
+                                               spill_options_));
+
+  ASSERT_OK_AND_ASSIGN(
+      auto sorter,
+      SpillingSorter::Make(schema_, SortOptions({SortKey("i")}), spill_options_));
+  auto other = RecordBatch::Make(schema({field("i", int32())}), 0,
+                                 {batches_[0]->column(1)});
+  ASSERT_RAISES(TypeError, sorter->Consume(other));
+}
+
+INSTANTIATE_TEST_SUITE_P(SpillCompression, TestSpilling,
+                         ::testing::Values(Compression::UNCOMPRESSED,
+                                           Compression::LZ4_FRAME));
+
+}  // namespace dataset
+}  // namespace arrow
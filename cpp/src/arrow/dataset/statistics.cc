@@ -0,0 +1,493 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/statistics.h"
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/buffer.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/statistics_internal.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/string_view.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace dataset {
+
+std::shared_ptr<Expression> StatisticsAsExpression(
+    const ColumnStatisticsVector& statistics) {
+  ExpressionVector expressions;
+
+  for (const auto& column : statistics) {
+    const auto& min = column.min;
+    const auto& max = column.max;
+    if (min == nullptr || max == nullptr || min->is_valid != max->is_valid) {
+      // no usable guarantee
+      continue;
+    }
+
+    auto field_expr = field_ref(column.name);
+    expressions.push_back(min->is_valid
+                              ? and_(greater_equal(field_expr, scalar(min)),
+                                     less_equal(field_expr, scalar(max)))
+                              : equal(std::move(field_expr), scalar(min)));
+  }
+
+  if (expressions.empty()) {
+    return scalar(true);
+  }
+  return and_(std::move(expressions));
+}
+
+namespace {
+
+// Values are compared consistently with the scalar comparisons made by
+// Expression::Assume: numbers by value and binary data lexicographically by byte.
+template <typename T, typename Enable = void>
+struct MinMaxTraits;
+
+template <typename T>
+struct MinMaxTraits<T, enable_if_t<is_physical_integer_type<T>::value ||
+                                   is_physical_floating_type<T>::value>> {
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+  using Value = typename T::c_type;
+  using View = Value;
+
+  static View GetView(const ArrayType& array, int64_t i) { return array.Value(i); }
+
+  template <typename U = T>
+  static enable_if_physical_floating_point<U, bool> IsOrdered(View value) {
+    return !std::isnan(value);
+  }
+
+  template <typename U = T>
+  static enable_if_physical_integer<U, bool> IsOrdered(View) {
+    return true;
+  }
+
+  static Value Copy(View value) { return value; }
+
+  static Result<std::shared_ptr<Scalar>> MakeScalar(const Value& value,
+                                                    std::shared_ptr<DataType> type) {
+    return ::arrow::MakeScalar(std::move(type), value);
+  }
+};
+
+template <typename T>
+struct MinMaxTraits<T, enable_if_base_binary<T>> {
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+  using Value = std::string;
+  using View = util::string_view;
+
+  static View GetView(const ArrayType& array, int64_t i) { return array.GetView(i); }
+
+  static bool IsOrdered(View) { return true; }
+
+  static Value Copy(View value) { return value.to_string(); }
+
+  static Result<std::shared_ptr<Scalar>> MakeScalar(const Value& value,
+                                                    std::shared_ptr<DataType> type) {
+    return ::arrow::MakeScalar(std::move(type), Buffer::FromString(value));
+  }
+};
+
+template <>
+struct MinMaxTraits<Decimal128Type> {
+  using ArrayType = Decimal128Array;
+  using Value = Decimal128;
+  using View = Decimal128;
+
+  static View GetView(const ArrayType& array, int64_t i) {
+    return Decimal128(array.GetValue(i));
+  }
+
+  static bool IsOrdered(View) { return true; }
+
+  static Value Copy(View value) { return value; }
+
+  static Result<std::shared_ptr<Scalar>> MakeScalar(const Value& value,
+                                                    std::shared_ptr<DataType> type) {
+    return ::arrow::MakeScalar(std::move(type), value);
+  }
+};
+
+class ColumnAccumulator {
+ public:
+  virtual ~ColumnAccumulator() = default;
+
+  virtual void Update(const Array& array) = 0;
+
+  // Return false if the column could not be summarized.
+  virtual Result<bool> Finish(ColumnStatistics* out) const = 0;
+};
+
+template <typename T>
+class MinMaxAccumulator : public ColumnAccumulator {
+ public:
+  using Traits = MinMaxTraits<T>;
+  using ArrayType = typename Traits::ArrayType;
+  using View = typename Traits::View;
+
+  explicit MinMaxAccumulator(std::shared_ptr<DataType> type) : type_(std::move(type)) {}
+
+  void Update(const Array& array) override {
+    if (!ordered_) return;
+
+    const auto& values = checked_cast<const ArrayType&>(array);
+    null_count_ += values.null_count();
+    if (values.null_count() == values.length()) return;
+
+    for (int64_t i = 0; i < values.length(); ++i) {
+      if (values.IsNull(i)) continue;
+
+      auto value = Traits::GetView(values, i);
+      if (!Traits::IsOrdered(value)) {
+        ordered_ = false;
+        return;
+      }
+
+      if (!has_values_) {
+        min_ = Traits::Copy(value);
+        max_ = Traits::Copy(value);
+        has_values_ = true;
+        continue;
+      }
+
+      if (value < View(min_)) {
+        min_ = Traits::Copy(value);
+      } else if (View(max_) < value) {
+        max_ = Traits::Copy(value);
+      }
+    }
+  }
+
+  Result<bool> Finish(ColumnStatistics* out) const override {
+    if (!ordered_) return false;
+
+    out->null_count = null_count_;
+    if (!has_values_) {
+      out->min = out->max = MakeNullScalar(type_);
+      return true;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(out->min, Traits::MakeScalar(min_, type_));
+    ARROW_ASSIGN_OR_RAISE(out->max, Traits::MakeScalar(max_, type_));
+    return true;
+  }
+
+ private:
+  std::shared_ptr<DataType> type_;
+  typename Traits::Value min_{}, max_{};
+  bool has_values_ = false;
+  bool ordered_ = true;
+  int64_t null_count_ = 0;
+};
+
+struct MakeAccumulatorImpl {
+  template <typename T>
+  enable_if_t<is_physical_integer_type<T>::value || is_physical_floating_type<T>::value,
+              Status>
+  Visit(const T&) {
+    return Make<T>();
+  }
+
+  template <typename T>
+  enable_if_base_binary<T, Status> Visit(const T&) {
+    return Make<T>();
+  }
+
+  Status Visit(const Decimal128Type&) { return Make<Decimal128Type>(); }
+
+  // Scalars of this type cannot be compared by Expression::Assume.
+  Status Visit(const HalfFloatType&) { return Status::OK(); }
+
+  // Other types are not summarized.
+  Status Visit(const DataType&) { return Status::OK(); }
+
+  template <typename T>
+  Status Make() {
+    out_ = internal::make_unique<MinMaxAccumulator<T>>(type_);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> type_;
+  std::unique_ptr<ColumnAccumulator> out_;
+};
+
+std::unique_ptr<ColumnAccumulator> MakeAccumulator(std::shared_ptr<DataType> type) {
+  MakeAccumulatorImpl impl{type, nullptr};
+  DCHECK_OK(VisitTypeInline(*type, &impl));
+  return std::move(impl.out_);
+}
+
+}  // namespace
+
+class StatisticsCollector::Impl {
+ public:
+  explicit Impl(std::shared_ptr<Schema> schema) : schema_(std::move(schema)) {
+    for (const auto& field : schema_->fields()) {
+      accumulators_.push_back(MakeAccumulator(field->type()));
+    }
+  }
+
+  Status Update(const RecordBatch& batch) {
+    if (!batch.schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Cannot collect statistics of a batch with schema ",
+                             *batch.schema(), " into statistics of schema ", *schema_);
+    }
+
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      if (accumulators_[i] != nullptr) {
+        accumulators_[i]->Update(*batch.column(i));
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<ColumnStatisticsVector> Finish() const {
+    ColumnStatisticsVector statistics;
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      if (accumulators_[i] == nullptr) continue;
+
+      ColumnStatistics column;
+      column.name = schema_->field(i)->name();
+      ARROW_ASSIGN_OR_RAISE(bool summarized, accumulators_[i]->Finish(&column));
+      if (summarized) {
+        statistics.push_back(std::move(column));
+      }
+    }
+    return statistics;
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  std::vector<std::unique_ptr<ColumnAccumulator>> accumulators_;
+};
+
+StatisticsCollector::StatisticsCollector(std::shared_ptr<Schema> schema)
+    : impl_(new Impl(std::move(schema))) {}
+
+StatisticsCollector::~StatisticsCollector() = default;
+
+Status StatisticsCollector::Update(const RecordBatch& batch) {
+  return impl_->Update(batch);
+}
+
+Result<ColumnStatisticsVector> StatisticsCollector::Finish() const {
+  return impl_->Finish();
+}
+
+namespace {
+
+bool IsSummarizedAs(const ColumnStatistics& column, const DataType& type) {
+  return column.min != nullptr && column.max != nullptr &&
+         column.min->type->Equals(type) && column.max->type->Equals(type);
+}
+
+Result<std::shared_ptr<Array>> MakeStatisticsColumn(
+    const std::shared_ptr<DataType>& type,
+    const std::vector<const ColumnStatistics*>& columns) {
+  ArrayVector mins, maxes, null_counts;
+  TypedBufferBuilder<bool> validity;
+  RETURN_NOT_OK(validity.Reserve(columns.size()));
+
+  for (const ColumnStatistics* column : columns) {
+    validity.UnsafeAppend(column != nullptr);
+    if (column == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(auto null_value, MakeArrayOfNull(type, 1));
+      mins.push_back(null_value);
+      maxes.push_back(std::move(null_value));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(auto min, MakeArrayFromScalar(*column->min, 1));
+      ARROW_ASSIGN_OR_RAISE(auto max, MakeArrayFromScalar(*column->max, 1));
+      mins.push_back(std::move(min));
+      maxes.push_back(std::move(max));
+    }
+
+    Int64Scalar null_count(column ? column->null_count : 0);
+    null_count.is_valid = column != nullptr && column->null_count >= 0;
+    ARROW_ASSIGN_OR_RAISE(auto null_count_value, MakeArrayFromScalar(null_count, 1));
+    null_counts.push_back(std::move(null_count_value));
+  }
+
+  ArrayVector children(3);
+  ARROW_ASSIGN_OR_RAISE(children[0], Concatenate(mins));
+  ARROW_ASSIGN_OR_RAISE(children[1], Concatenate(maxes));
+  ARROW_ASSIGN_OR_RAISE(children[2], Concatenate(null_counts));
+
+  std::shared_ptr<Buffer> null_bitmap;
+  RETURN_NOT_OK(validity.Finish(&null_bitmap));
+  return StructArray::Make(children, {"min", "max", "null_count"},
+                           std::move(null_bitmap));
+}
+
+}  // namespace
+
+Status MakeStatisticsColumns(const std::vector<const ColumnStatisticsVector*>& files,
+                             FieldVector* fields, ArrayVector* columns) {
+  // Summarized fields in order of first appearance, each with the first type it was
+  // summarized as. Statistics of another type are not written.
+  FieldVector summarized;
+  std::unordered_map<std::string, int> field_indices;
+
+  for (const ColumnStatisticsVector* file : files) {
+    for (const auto& column : *file) {
+      if (column.min == nullptr || field_indices.count(column.name) != 0) continue;
+      field_indices.emplace(column.name, static_cast<int>(summarized.size()));
+      summarized.push_back(field(column.name, column.min->type));
+    }
+  }
+
+  std::vector<std::vector<const ColumnStatistics*>> by_field(
+      summarized.size(), std::vector<const ColumnStatistics*>(files.size(), nullptr));
+
+  for (size_t file_index = 0; file_index < files.size(); ++file_index) {
+    for (const auto& column : *files[file_index]) {
+      auto it = field_indices.find(column.name);
+      if (it == field_indices.end()) continue;
+      if (!IsSummarizedAs(column, *summarized[it->second]->type())) continue;
+      by_field[it->second][file_index] = &column;
+    }
+  }
+
+  for (size_t i = 0; i < summarized.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto column,
+                          MakeStatisticsColumn(summarized[i]->type(), by_field[i]));
+    fields->push_back(field(summarized[i]->name(), column->type()));
+    columns->push_back(std::move(column));
+  }
+  return Status::OK();
+}
+
+Status CheckStatisticsColumns(const Schema& schema, int first_column,
+                              const std::string& path) {
+  for (int i = first_column; i < schema.num_fields(); ++i) {
+    const auto& type = *schema.field(i)->type();
+    if (type.id() != Type::STRUCT || type.num_children() != 3 ||
+        !type.child(0)->type()->Equals(type.child(1)->type()) ||
+        type.child(2)->type()->id() != Type::INT64) {
+      return Status::Invalid(path, " had invalid statistics column ",
+                             schema.field(i)->ToString());
+    }
+  }
+  return Status::OK();
+}
+
+Result<ColumnStatisticsVector> StatisticsFromColumns(const RecordBatch& batch,
+                                                     int first_column, int64_t row) {
+  ColumnStatisticsVector statistics;
+  for (int i = first_column; i < batch.num_columns(); ++i) {
+    const auto& column = checked_cast<const StructArray&>(*batch.column(i));
+    if (column.IsNull(row)) continue;
+
+    ColumnStatistics column_statistics;
+    column_statistics.name = batch.column_name(i);
+    ARROW_ASSIGN_OR_RAISE(column_statistics.min, column.field(0)->GetScalar(row));
+    ARROW_ASSIGN_OR_RAISE(column_statistics.max, column.field(1)->GetScalar(row));
+
+    const auto& null_counts = checked_cast<const Int64Array&>(*column.field(2));
+    column_statistics.null_count =
+        null_counts.IsValid(row) ? null_counts.Value(row) : -1;
+    statistics.push_back(std::move(column_statistics));
+  }
+  return statistics;
+}
+
+Status WriteStatisticsSidecar(
+    fs::FileSystem* filesystem, const std::string& path,
+    const std::vector<std::pair<std::string, ColumnStatisticsVector>>& files) {
+  std::vector<std::string> paths;
+  std::vector<const ColumnStatisticsVector*> statistics;
+  for (const auto& file : files) {
+    paths.push_back(file.first);
+    statistics.push_back(&file.second);
+  }
+
+  FieldVector sidecar_fields = {field("path", utf8())};
+  ArrayVector sidecar_columns(1);
+
+  StringBuilder path_builder;
+  RETURN_NOT_OK(path_builder.AppendValues(paths));
+  RETURN_NOT_OK(path_builder.Finish(&sidecar_columns[0]));
+
+  RETURN_NOT_OK(MakeStatisticsColumns(statistics, &sidecar_fields, &sidecar_columns));
+
+  auto sidecar_schema = schema(std::move(sidecar_fields));
+  auto batch = RecordBatch::Make(sidecar_schema, static_cast<int64_t>(files.size()),
+                                 std::move(sidecar_columns));
+
+  ARROW_ASSIGN_OR_RAISE(auto destination, filesystem->OpenOutputStream(path));
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        ipc::MakeFileWriter(destination.get(), sidecar_schema));
+  RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  RETURN_NOT_OK(writer->Close());
+  return destination->Close();
+}
+
+Result<std::unordered_map<std::string, ColumnStatisticsVector>> ReadStatisticsSidecar(
+    fs::FileSystem* filesystem, const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto input, filesystem->OpenInputFile(path));
+  ARROW_ASSIGN_OR_RAISE(auto reader, ipc::RecordBatchFileReader::Open(input.get()));
+
+  auto sidecar_schema = reader->schema();
+  if (sidecar_schema->num_fields() == 0 || sidecar_schema->field(0)->name() != "path" ||
+      sidecar_schema->field(0)->type()->id() != Type::STRING) {
+    return Status::Invalid("Statistics sidecar ", path,
+                           " did not begin with a string column 'path'");
+  }
+  RETURN_NOT_OK(CheckStatisticsColumns(*sidecar_schema, 1, path));
+
+  std::unordered_map<std::string, ColumnStatisticsVector> statistics;
+  for (int batch_index = 0; batch_index < reader->num_record_batches(); ++batch_index) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, reader->ReadRecordBatch(batch_index));
+    const auto& paths = checked_cast<const StringArray&>(*batch->column(0));
+
+    for (int64_t row = 0; row < batch->num_rows(); ++row) {
+      if (paths.IsNull(row)) continue;
+      ARROW_ASSIGN_OR_RAISE(statistics[paths.GetString(row)],
+                            StatisticsFromColumns(*batch, 1, row));
+    }
+  }
+
+  return statistics;
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/filesystem/type_fwd.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief Summary of the values of a single column of a file.
+struct ARROW_DS_EXPORT ColumnStatistics {
+  /// The name of the summarized column.
+  std::string name;
+
+  /// The smallest and largest valid values of the column. If the column contains only
+  /// nulls, both are null scalars of the column's type.
+  std::shared_ptr<Scalar> min, max;
+
+  /// The number of null values in the column, or -1 if unknown.
+  int64_t null_count = -1;
+};
+
+using ColumnStatisticsVector = std::vector<ColumnStatistics>;
+
+/// \brief Convert column statistics to an expression which is guaranteed to be
+/// satisfied by every row they summarize, suitable for Expression::Assume and
+/// Expression::IsSatisfiableWith.
+///
+/// The types of min and max must be identical to the type of the corresponding field
+/// in the schema the expression will be evaluated against.
+ARROW_DS_EXPORT
+std::shared_ptr<Expression> StatisticsAsExpression(
+    const ColumnStatisticsVector& statistics);
+
+/// \brief Accumulate statistics from the batches written to a single file.
+///
+/// Only columns of a type which can be compared by Expression::Assume are summarized:
+/// integer, floating point, temporal, decimal, binary and string columns. Floating
+/// point columns which contain NaN are not summarized.
+class ARROW_DS_EXPORT StatisticsCollector {
+ public:
+  explicit StatisticsCollector(std::shared_ptr<Schema> schema);
+  ~StatisticsCollector();
+
+  /// \brief Summarize a batch, which must have the collector's schema.
+  Status Update(const RecordBatch& batch);
+
+  /// \brief Return the statistics of all batches passed to Update().
+  Result<ColumnStatisticsVector> Finish() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief The basename of the file in which FileSystemDataset::Write stores the
+/// statistics of the files it has written.
+constexpr char kStatisticsSidecarBasename[] = "_statistics.arrow";
+
+/// \brief Write a statistics sidecar: an IPC file containing a row for each summarized
+/// file, with a string column "path" and a struct<min, max, null_count> column for each
+/// summarized field. A null struct indicates the column was not summarized for that
+/// file.
+///
+/// Paths are recorded as they are given. FileSystemDataset::Write records paths
+/// relative to the directory containing the sidecar.
+ARROW_DS_EXPORT
+Status WriteStatisticsSidecar(
+    fs::FileSystem* filesystem, const std::string& path,
+    const std::vector<std::pair<std::string, ColumnStatisticsVector>>& files);
+
+/// \brief Read a statistics sidecar written by WriteStatisticsSidecar, returning the
+/// statistics of each file keyed by the recorded path.
+ARROW_DS_EXPORT
+Result<std::unordered_map<std::string, ColumnStatisticsVector>> ReadStatisticsSidecar(
+    fs::FileSystem* filesystem, const std::string& path);
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,50 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "arrow/dataset/statistics.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace dataset {
+
+// Statistics are stored in IPC files (the statistics sidecar and the dataset manifest)
+// as one row per file with a struct<min: T, max: T, null_count: int64> column for each
+// summarized field. A null struct indicates the field was not summarized for that file.
+
+/// \brief Append a statistics column to `columns` (and its field to `fields`) for each
+/// field summarized by any of `files`.
+Status MakeStatisticsColumns(const std::vector<const ColumnStatisticsVector*>& files,
+                             FieldVector* fields, ArrayVector* columns);
+
+/// \brief Check that every field of `schema` after `first_column` is a statistics
+/// column. `path` is only used in error messages.
+Status CheckStatisticsColumns(const Schema& schema, int first_column,
+                              const std::string& path);
+
+/// \brief Extract the statistics of a single file from the statistics columns of a
+/// batch whose schema was checked with CheckStatisticsColumns.
+Result<ColumnStatisticsVector> StatisticsFromColumns(const RecordBatch& batch,
+                                                     int first_column, int64_t row);
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,266 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/statistics.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/discovery.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/file_ipc.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/partition.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/iterator.h"
+
+namespace arrow {
+
+using internal::checked_pointer_cast;
+
+namespace dataset {
+
+void AssertStatisticsEqual(const ColumnStatistics& expected,
+                           const ColumnStatistics& actual) {
+  EXPECT_EQ(expected.name, actual.name);
+  AssertScalarsEqual(*expected.min, *actual.min, /*verbose=*/true);
+  AssertScalarsEqual(*expected.max, *actual.max, /*verbose=*/true);
+  EXPECT_EQ(expected.null_count, actual.null_count);
+}
+
+void AssertStatisticsEqual(const ColumnStatisticsVector& expected,
+                           const ColumnStatisticsVector& actual) {
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    AssertStatisticsEqual(expected[i], actual[i]);
+  }
+}
+
+ColumnStatistics MakeStatistics(std::string name, std::shared_ptr<Scalar> min,
+                                std::shared_ptr<Scalar> max, int64_t null_count) {
+  ColumnStatistics statistics;
+  statistics.name = std::move(name);
+  statistics.min = std::move(min);
+  statistics.max = std::move(max);
+  statistics.null_count = null_count;
+  return statistics;
+}
+
+TEST(StatisticsCollector, Basics) {
+  auto schm = schema({field("i32", int32()), field("str", utf8()),
+                      field("ts", timestamp(TimeUnit::SECOND)), field("f64", float64()),
+                      field("nulls", int64())});
+  StatisticsCollector collector(schm);
+
+  ASSERT_OK_AND_ASSIGN(auto empty, collector.Finish());
+  ASSERT_EQ(empty.size(), 5);
+  AssertStatisticsEqual(MakeStatistics("i32", MakeNullScalar(int32()),
+                                       MakeNullScalar(int32()), 0),
+                        empty[0]);
+
+  ASSERT_OK(collector.Update(*RecordBatch::Make(
+      schm, 3,
+      {ArrayFromJSON(int32(), "[5, null, -3]"),
+       ArrayFromJSON(utf8(), R"(["b", "ab", "b"])"),
+       ArrayFromJSON(timestamp(TimeUnit::SECOND), "[10, 20, null]"),
+       ArrayFromJSON(float64(), "[1.5, -0.5, 0]"),
+       ArrayFromJSON(int64(), "[null, null, null]")})));
+  ASSERT_OK(collector.Update(*RecordBatch::Make(
+      schm, 2,
+      {ArrayFromJSON(int32(), "[null, 7]"), ArrayFromJSON(utf8(), R"(["ba", null])"),
+       ArrayFromJSON(timestamp(TimeUnit::SECOND), "[null, 5]"),
+       ArrayFromJSON(float64(), "[2.5, null]"),
+       ArrayFromJSON(int64(), "[null, null]")})));
+
+  ASSERT_OK_AND_ASSIGN(auto statistics, collector.Finish());
+  AssertStatisticsEqual(
+      {
+          MakeStatistics("i32", MakeScalar(int32_t(-3)), MakeScalar(int32_t(7)), 2),
+          MakeStatistics("str", MakeScalar(std::string("ab")),
+                         MakeScalar(std::string("ba")), 1),
+          MakeStatistics("ts", MakeScalar(timestamp(TimeUnit::SECOND), 5).ValueOrDie(),
+                         MakeScalar(timestamp(TimeUnit::SECOND), 20).ValueOrDie(), 2),
+          MakeStatistics("f64", MakeScalar(-0.5), MakeScalar(2.5), 1),
+          MakeStatistics("nulls", MakeNullScalar(int64()), MakeNullScalar(int64()), 5),
+      },
+      statistics);
+
+  auto other_schema = schema({field("i32", int32())});
+  ASSERT_RAISES(Invalid, collector.Update(*RecordBatch::Make(
+                             other_schema, 1, {ArrayFromJSON(int32(), "[1]")})));
+}
+
+TEST(StatisticsCollector, UnsummarizedColumns) {
+  auto schm = schema({field("f32", float32()), field("list", list(int32())),
+                      field("bool", boolean()), field("i8", int8())});
+  StatisticsCollector collector(schm);
+
+  ASSERT_OK(collector.Update(*RecordBatch::Make(
+      schm, 2,
+      {ArrayFromJSON(float32(), "[1, NaN]"), ArrayFromJSON(list(int32()), "[[1], null]"),
+       ArrayFromJSON(boolean(), "[true, false]"), ArrayFromJSON(int8(), "[3, 4]")})));
+
+  ASSERT_OK_AND_ASSIGN(auto statistics, collector.Finish());
+  AssertStatisticsEqual(
+      {MakeStatistics("i8", MakeScalar(int8_t(3)), MakeScalar(int8_t(4)), 0)},
+      statistics);
+}
+
+TEST(StatisticsAsExpression, Basics) {
+  ASSERT_TRUE(StatisticsAsExpression({})->Equals(true));
+
+  auto guarantee = StatisticsAsExpression({
+      MakeStatistics("i32", MakeScalar(int32_t(-3)), MakeScalar(int32_t(7)), 2),
+      MakeStatistics("nulls", MakeNullScalar(int64()), MakeNullScalar(int64()), 5),
+      // incomplete statistics are ignored
+      MakeStatistics("str", MakeScalar(std::string("ab")), nullptr, 1),
+  });
+
+  ASSERT_TRUE(guarantee->Equals(
+      and_({and_(greater_equal(field_ref("i32"), scalar(int32_t(-3))),
+                 less_equal(field_ref("i32"), scalar(int32_t(7)))),
+            equal(field_ref("nulls"), scalar(MakeNullScalar(int64())))})));
+
+  EXPECT_TRUE(equal(field_ref("i32"), scalar(int32_t(7)))->IsSatisfiableWith(guarantee));
+  EXPECT_TRUE(less(field_ref("i32"), scalar(int32_t(0)))->IsSatisfiableWith(guarantee));
+  EXPECT_FALSE(
+      greater(field_ref("i32"), scalar(int32_t(7)))->IsSatisfiableWith(guarantee));
+  EXPECT_FALSE(
+      equal(field_ref("nulls"), scalar(int64_t(0)))->IsSatisfiableWith(guarantee));
+  EXPECT_TRUE(equal(field_ref("str"), scalar("zz"))->IsSatisfiableWith(guarantee));
+}
+
+class TestStatisticsSidecar : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(fs_, fs::internal::MockFileSystem::Make(fs::kNoTime, {}));
+  }
+
+ protected:
+  std::shared_ptr<fs::FileSystem> fs_;
+};
+
+TEST_F(TestStatisticsSidecar, RoundTrip) {
+  std::vector<std::pair<std::string, ColumnStatisticsVector>> files = {
+      {"a/0.arrow",
+       {MakeStatistics("i32", MakeScalar(int32_t(-3)), MakeScalar(int32_t(7)), 2),
+        MakeStatistics("str", MakeScalar(std::string("ab")),
+                       MakeScalar(std::string("ba")), -1)}},
+      // no statistics for i32, str is all null
+      {"b/0.arrow",
+       {MakeStatistics("str", MakeNullScalar(utf8()), MakeNullScalar(utf8()), 4)}},
+      // statistics of a conflicting type are not written
+      {"c/0.arrow",
+       {MakeStatistics("i32", MakeScalar(int64_t(1)), MakeScalar(int64_t(2)), 0)}},
+  };
+
+  ASSERT_OK(fs_->CreateDir("ds"));
+  ASSERT_OK(WriteStatisticsSidecar(fs_.get(), "ds/_statistics.arrow", files));
+  ASSERT_OK_AND_ASSIGN(auto read,
+                       ReadStatisticsSidecar(fs_.get(), "ds/_statistics.arrow"));
+
+  ASSERT_EQ(read.size(), 3);
+  AssertStatisticsEqual(files[0].second, read["a/0.arrow"]);
+  AssertStatisticsEqual(files[1].second, read["b/0.arrow"]);
+  AssertStatisticsEqual({}, read["c/0.arrow"]);
+
+  ASSERT_RAISES(IOError, ReadStatisticsSidecar(fs_.get(), "ds/missing.arrow"));
+}
+
+TEST_F(TestStatisticsSidecar, WriteAndPruneFragments) {
+  auto schm = schema({field("part", int32()), field("value", int64())});
+  RecordBatchVector batches = {
+      RecordBatch::Make(schm, 4,
+                        {ArrayFromJSON(int32(), "[0, 1, 0, 2]"),
+                         ArrayFromJSON(int64(), "[1, 100, 9, null]")}),
+      RecordBatch::Make(schm, 3,
+                        {ArrayFromJSON(int32(), "[1, 2, 0]"),
+                         ArrayFromJSON(int64(), "[150, 1000, 5]")}),
+  };
+  auto partitioning =
+      std::make_shared<DirectoryPartitioning>(schema({field("part", int32())}));
+  auto format = std::make_shared<IpcFileFormat>();
+
+  FileSystemDatasetWriteOptions write_options;
+  write_options.file_write_options = format->DefaultWriteOptions();
+  write_options.filesystem = fs_;
+  write_options.base_dir = "ds";
+  write_options.partitioning = partitioning;
+  write_options.basename_template = "dat_{i}.arrow";
+  write_options.write_statistics = true;
+
+  auto dataset = std::make_shared<InMemoryDataset>(schm, batches);
+  auto scanner = std::make_shared<Scanner>(dataset, ScanOptions::Make(schm),
+                                           std::make_shared<ScanContext>());
+  ASSERT_OK(FileSystemDataset::Write(write_options, scanner));
+
+  FileSystemFactoryOptions factory_options;
+  factory_options.partitioning = partitioning;
+  factory_options.statistics_sidecar = "ds/_statistics.arrow";
+  fs::FileSelector selector;
+  selector.base_dir = "ds";
+  selector.recursive = true;
+  ASSERT_OK_AND_ASSIGN(auto factory, FileSystemDatasetFactory::Make(
+                                         fs_, selector, format, factory_options));
+  ASSERT_OK_AND_ASSIGN(auto written, factory->Finish());
+  ASSERT_EQ(checked_pointer_cast<FileSystemDataset>(written)->files().size(), 3);
+
+  auto fragment_paths = [&](std::shared_ptr<Expression> predicate) {
+    std::vector<std::string> paths;
+    for (auto maybe_fragment : written->GetFragments(std::move(predicate))) {
+      EXPECT_OK_AND_ASSIGN(auto fragment, maybe_fragment);
+      auto file_fragment = checked_pointer_cast<FileFragment>(fragment);
+      EXPECT_EQ(file_fragment->statistics().size(), 1);
+      paths.push_back(file_fragment->source().path());
+    }
+    std::sort(paths.begin(), paths.end());
+    return paths;
+  };
+
+  using Paths = std::vector<std::string>;
+  EXPECT_EQ(fragment_paths(scalar(true)).size(), 3);
+  EXPECT_EQ(fragment_paths(greater(field_ref("value"), scalar(int64_t(120)))),
+            (Paths{"ds/1/dat_1.arrow", "ds/2/dat_2.arrow"}));
+  EXPECT_EQ(fragment_paths(less(field_ref("value"), scalar(int64_t(10)))),
+            (Paths{"ds/0/dat_0.arrow"}));
+  EXPECT_EQ(fragment_paths(and_(equal(field_ref("part"), scalar(int32_t(2))),
+                                less(field_ref("value"), scalar(int64_t(10))))),
+            Paths{});
+
+  // Scanning a pruned dataset yields only the rows of the remaining fragments
+  ScannerBuilder builder(written, std::make_shared<ScanContext>());
+  ASSERT_OK(builder.Filter(greater(field_ref("value"), scalar(int64_t(120)))));
+  ASSERT_OK_AND_ASSIGN(auto filtered, builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto table, filtered->ToTable());
+  EXPECT_EQ(table->num_rows(), 2);
+}
+
+}  // namespace dataset
+}  // namespace arrow
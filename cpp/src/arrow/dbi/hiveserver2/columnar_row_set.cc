@@ -17,12 +17,23 @@
 
 #include "arrow/dbi/hiveserver2/columnar_row_set.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <string>
 #include <vector>
 
 #include "arrow/dbi/hiveserver2/TCLIService.h"
 #include "arrow/dbi/hiveserver2/thrift_internal.h"
 
+#include "arrow/array/data.h"
+#include "arrow/buffer.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_generate.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/logging.h"
 
 namespace hs2 = apache::hive::service::cli::thrift;
@@ -96,5 +107,249 @@ std::unique_ptr<BinaryColumn> ColumnarRowSet::GetBinaryCol(int i) const {
   return GetCol<BinaryColumn>(i);
 }
 
+namespace {
+
+// The values and nulls of whichever member of the TColumn union is set
+struct ColumnValues {
+  int64_t length = 0;
+  const std::string* nulls = nullptr;
+};
+
+ColumnValues GetColumnValues(const hs2::TColumn& col) {
+  ColumnValues out;
+#define GET_VALUES(ATTR_NAME)                                       \
+  if (col.__isset.ATTR_NAME) {                                      \
+    out.length = static_cast<int64_t>(col.ATTR_NAME.values.size()); \
+    out.nulls = &col.ATTR_NAME.nulls;                               \
+    return out;                                                     \
+  }
+
+  GET_VALUES(boolVal);
+  GET_VALUES(byteVal);
+  GET_VALUES(i16Val);
+  GET_VALUES(i32Val);
+  GET_VALUES(i64Val);
+  GET_VALUES(doubleVal);
+  GET_VALUES(stringVal);
+  GET_VALUES(binaryVal);
+
+#undef GET_VALUES
+  return out;
+}
+
+// Thrift null bitmaps have a bit set for each null value, while Arrow validity bitmaps
+// have a bit set for each non-null value. No bitmap is allocated if there are no nulls.
+Status MakeValidityBitmap(const std::string& nulls, int64_t length, MemoryPool* pool,
+                          std::shared_ptr<Buffer>* out, int64_t* null_count) {
+  const int64_t nbytes = BitUtil::BytesForBits(length);
+  // The bitmap may be shorter than expected, see HUE-2722
+  const int64_t nulls_size = std::min(static_cast<int64_t>(nulls.size()), nbytes);
+  const auto nulls_data = reinterpret_cast<const uint8_t*>(nulls.data());
+  *null_count = internal::CountSetBits(nulls_data, 0, std::min(length, nulls_size * 8));
+  if (*null_count == 0) {
+    out->reset();
+    return Status::OK();
+  }
+  ARROW_ASSIGN_OR_RAISE(*out, AllocateBuffer(nbytes, pool));
+  uint8_t* bitmap = (*out)->mutable_data();
+  for (int64_t i = 0; i < nulls_size; ++i) {
+    bitmap[i] = static_cast<uint8_t>(~nulls_data[i]);
+  }
+  std::memset(bitmap + nulls_size, 0xFF, static_cast<size_t>(nbytes - nulls_size));
+  return Status::OK();
+}
+
+template <typename ArrowType, typename T>
+Status CopyValues(const std::vector<T>& values, MemoryPool* pool,
+                  std::shared_ptr<Buffer>* out) {
+  using c_type = typename ArrowType::c_type;
+  ARROW_ASSIGN_OR_RAISE(*out, AllocateBuffer(values.size() * sizeof(c_type), pool));
+  std::copy(values.begin(), values.end(),
+            reinterpret_cast<c_type*>((*out)->mutable_data()));
+  return Status::OK();
+}
+
+Status CopyValues(const std::vector<bool>& values, MemoryPool* pool,
+                  std::shared_ptr<Buffer>* out) {
+  const auto length = static_cast<int64_t>(values.size());
+  ARROW_ASSIGN_OR_RAISE(*out, AllocateBuffer(BitUtil::BytesForBits(length), pool));
+  auto it = values.begin();
+  internal::GenerateBitsUnrolled((*out)->mutable_data(), 0, length,
+                                 [&it]() -> bool { return *it++; });
+  return Status::OK();
+}
+
+Status CopyStrings(const std::vector<std::string>& values, MemoryPool* pool,
+                   std::shared_ptr<Buffer>* offsets, std::shared_ptr<Buffer>* data) {
+  ARROW_ASSIGN_OR_RAISE(*offsets,
+                        AllocateBuffer((values.size() + 1) * sizeof(int32_t), pool));
+  auto offsets_data = reinterpret_cast<int32_t*>((*offsets)->mutable_data());
+  int64_t data_size = 0;
+  offsets_data[0] = 0;
+  for (size_t i = 0; i < values.size(); ++i) {
+    data_size += static_cast<int64_t>(values[i].size());
+    if (ARROW_PREDICT_FALSE(data_size > std::numeric_limits<int32_t>::max())) {
+      return Status::CapacityError(
+          "Fetched string column too large for a binary array, fetch fewer rows");
+    }
+    offsets_data[i + 1] = static_cast<int32_t>(data_size);
+  }
+  ARROW_ASSIGN_OR_RAISE(*data, AllocateBuffer(data_size, pool));
+  uint8_t* out = (*data)->mutable_data();
+  for (const std::string& value : values) {
+    std::memcpy(out, value.data(), value.size());
+    out += value.size();
+  }
+  return Status::OK();
+}
+
+Status ColumnToArrayData(const hs2::TColumn& col, const std::shared_ptr<Field>& field,
+                         MemoryPool* pool, std::shared_ptr<ArrayData>* out) {
+  const ColumnValues values = GetColumnValues(col);
+  if (values.nulls == nullptr) {
+    return Status::Invalid("No values fetched for column '", field->name(), "'");
+  }
+  const std::shared_ptr<DataType>& type = field->type();
+  if (type->id() == Type::NA) {
+    *out = ArrayData::Make(type, values.length, {nullptr}, values.length);
+    return Status::OK();
+  }
+
+  int64_t null_count = 0;
+  std::shared_ptr<Buffer> validity, data, offsets;
+  RETURN_NOT_OK(
+      MakeValidityBitmap(*values.nulls, values.length, pool, &validity, &null_count));
+
+#define MISMATCH_IF_NOT_SET(ATTR_NAME)                                     \
+  if (!col.__isset.ATTR_NAME) {                                            \
+    return Status::TypeError("Fetched values for column '", field->name(), \
+                             "' do not match the expected type ", *type);  \
+  }
+
+  switch (type->id()) {
+    case Type::BOOL:
+      MISMATCH_IF_NOT_SET(boolVal);
+      RETURN_NOT_OK(CopyValues(col.boolVal.values, pool, &data));
+      break;
+    case Type::INT8:
+      MISMATCH_IF_NOT_SET(byteVal);
+      RETURN_NOT_OK(CopyValues<Int8Type>(col.byteVal.values, pool, &data));
+      break;
+    case Type::INT16:
+      MISMATCH_IF_NOT_SET(i16Val);
+      RETURN_NOT_OK(CopyValues<Int16Type>(col.i16Val.values, pool, &data));
+      break;
+    case Type::INT32:
+      MISMATCH_IF_NOT_SET(i32Val);
+      RETURN_NOT_OK(CopyValues<Int32Type>(col.i32Val.values, pool, &data));
+      break;
+    case Type::INT64:
+      MISMATCH_IF_NOT_SET(i64Val);
+      RETURN_NOT_OK(CopyValues<Int64Type>(col.i64Val.values, pool, &data));
+      break;
+    case Type::FLOAT:
+      MISMATCH_IF_NOT_SET(doubleVal);
+      RETURN_NOT_OK(CopyValues<FloatType>(col.doubleVal.values, pool, &data));
+      break;
+    case Type::DOUBLE:
+      MISMATCH_IF_NOT_SET(doubleVal);
+      RETURN_NOT_OK(CopyValues<DoubleType>(col.doubleVal.values, pool, &data));
+      break;
+    case Type::STRING:
+      MISMATCH_IF_NOT_SET(stringVal);
+      RETURN_NOT_OK(CopyStrings(col.stringVal.values, pool, &offsets, &data));
+      break;
+    case Type::BINARY:
+      MISMATCH_IF_NOT_SET(binaryVal);
+      RETURN_NOT_OK(CopyStrings(col.binaryVal.values, pool, &offsets, &data));
+      break;
+    default:
+      return Status::NotImplemented("Conversion of fetched values to ", *type);
+  }
+
+#undef MISMATCH_IF_NOT_SET
+
+  if (offsets != nullptr) {
+    *out = ArrayData::Make(type, values.length, {validity, offsets, data}, null_count);
+  } else {
+    *out = ArrayData::Make(type, values.length, {validity, data}, null_count);
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+int64_t ColumnarRowSet::num_rows() const {
+  const auto& columns = impl_->resp.results.columns;
+  return columns.empty() ? 0 : GetColumnValues(columns[0]).length;
+}
+
+Status ColumnarRowSet::ToRecordBatch(const std::shared_ptr<Schema>& schema,
+                                     MemoryPool* pool,
+                                     std::shared_ptr<RecordBatch>* out) const {
+  const auto& columns = impl_->resp.results.columns;
+  if (static_cast<int>(columns.size()) != schema->num_fields()) {
+    return Status::Invalid("Fetched ", columns.size(), " columns, schema has ",
+                           schema->num_fields(), " fields");
+  }
+  const int64_t length = num_rows();
+  std::vector<std::shared_ptr<ArrayData>> arrays(columns.size());
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    RETURN_NOT_OK(ColumnToArrayData(columns[i], schema->field(i), pool, &arrays[i]));
+    if (arrays[i]->length != length) {
+      return Status::Invalid("Fetched columns have different lengths");
+    }
+  }
+  *out = RecordBatch::Make(schema, length, std::move(arrays));
+  return Status::OK();
+}
+
+Status ColumnDescsToSchema(const std::vector<ColumnDesc>& column_descs,
+                           std::shared_ptr<Schema>* out) {
+  std::vector<std::shared_ptr<Field>> fields;
+  fields.reserve(column_descs.size());
+  for (const ColumnDesc& desc : column_descs) {
+    std::shared_ptr<DataType> type;
+    switch (desc.type()->type_id()) {
+      case ColumnType::TypeId::BOOLEAN:
+        type = boolean();
+        break;
+      case ColumnType::TypeId::TINYINT:
+        type = int8();
+        break;
+      case ColumnType::TypeId::SMALLINT:
+        type = int16();
+        break;
+      case ColumnType::TypeId::INT:
+        type = int32();
+        break;
+      case ColumnType::TypeId::BIGINT:
+        type = int64();
+        break;
+      case ColumnType::TypeId::FLOAT:
+        type = float32();
+        break;
+      case ColumnType::TypeId::DOUBLE:
+        type = float64();
+        break;
+      case ColumnType::TypeId::BINARY:
+        type = binary();
+        break;
+      case ColumnType::TypeId::NULL_TYPE:
+        type = null();
+        break;
+      case ColumnType::TypeId::INVALID:
+        return Status::TypeError("Invalid type for column '", desc.column_name(), "'");
+      default:
+        // Fetched as strings
+        type = utf8();
+        break;
+    }
+    fields.push_back(field(desc.column_name(), std::move(type)));
+  }
+  *out = schema(std::move(fields));
+  return Status::OK();
+}
+
 }  // namespace hiveserver2
 }  // namespace arrow
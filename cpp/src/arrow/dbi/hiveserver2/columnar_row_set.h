@@ -22,6 +22,8 @@
 #include <string>
 #include <vector>
 
+#include "arrow/dbi/hiveserver2/types.h"
+#include "arrow/type_fwd.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
@@ -137,6 +139,15 @@ class ARROW_EXPORT ColumnarRowSet {
   template <typename T>
   std::unique_ptr<T> GetCol(int i) const;
 
+  // Returns the number of rows in this set of results.
+  int64_t num_rows() const;
+
+  // Decodes the results into an Arrow record batch with the given schema, which is
+  // usually obtained from ColumnDescsToSchema(). Values and null bitmaps are copied
+  // in bulk from the fetched columns.
+  Status ToRecordBatch(const std::shared_ptr<Schema>& schema, MemoryPool* pool,
+                       std::shared_ptr<RecordBatch>* out) const;
+
  private:
   // Hides Thrift objects from the header.
   struct ColumnarRowSetImpl;
@@ -151,5 +162,12 @@ class ARROW_EXPORT ColumnarRowSet {
   std::unique_ptr<ColumnarRowSetImpl> impl_;
 };
 
+// Converts the description of the columns of a result set to an Arrow schema.
+// Types that HiveServer2 returns as strings, such as TIMESTAMP, DECIMAL or the
+// nested types, are converted to utf8.
+ARROW_EXPORT
+Status ColumnDescsToSchema(const std::vector<ColumnDesc>& column_descs,
+                           std::shared_ptr<Schema>* out);
+
 }  // namespace hiveserver2
 }  // namespace arrow
@@ -17,14 +17,21 @@
 
 #include "arrow/dbi/hiveserver2/operation.h"
 
+#include <utility>
+
 #include "arrow/dbi/hiveserver2/thrift_internal.h"
 
 #include "arrow/dbi/hiveserver2/ImpalaService_types.h"
 #include "arrow/dbi/hiveserver2/TCLIService.h"
 
+#include "arrow/io/util_internal.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/thread_pool.h"
 
 namespace hs2 = apache::hive::service::cli::thrift;
 using std::unique_ptr;
@@ -113,6 +120,92 @@ Status Operation::Fetch(int max_rows, FetchOrientation orientation,
   return status;
 }
 
+namespace {
+
+struct FetchedRows {
+  std::shared_ptr<ColumnarRowSet> rows;
+  bool has_more_rows = false;
+};
+
+// Fetches the next rows on an IO thread while the previous ones are decoded
+class ResultSetReader : public RecordBatchReader {
+ public:
+  ResultSetReader(const Operation* op, int max_rows, MemoryPool* pool,
+                  std::shared_ptr<Schema> schema)
+      : op_(op), max_rows_(max_rows), pool_(pool), schema_(std::move(schema)) {}
+
+  ~ResultSetReader() override {
+    // The operation must not be used by a fetch once the reader is destroyed
+    if (pending_.is_valid()) {
+      pending_.Wait();
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status StartFetch() {
+    const Operation* op = op_;
+    const int max_rows = max_rows_;
+    ARROW_ASSIGN_OR_RAISE(
+        pending_,
+        io::internal::GetIOThreadPool()->Submit([op, max_rows]() -> Result<FetchedRows> {
+          std::unique_ptr<ColumnarRowSet> rows;
+          FetchedRows fetched;
+          RETURN_NOT_OK(op->Fetch(max_rows, FetchOrientation::NEXT, &rows,
+                                  &fetched.has_more_rows));
+          fetched.rows = std::move(rows);
+          return fetched;
+        }));
+    return Status::OK();
+  }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    out->reset();
+    while (!finished_) {
+      ARROW_ASSIGN_OR_RAISE(FetchedRows fetched, pending_.result());
+      const int64_t num_rows = fetched.rows->num_rows();
+      // Some servers only signal the end of the results with an empty fetch
+      if (fetched.has_more_rows && num_rows > 0) {
+        RETURN_NOT_OK(StartFetch());
+      } else {
+        finished_ = true;
+      }
+      if (num_rows > 0) {
+        return fetched.rows->ToRecordBatch(schema_, pool_, out);
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  const Operation* op_;
+  const int max_rows_;
+  MemoryPool* pool_;
+  std::shared_ptr<Schema> schema_;
+  Future<FetchedRows> pending_;
+  bool finished_ = false;
+};
+
+}  // namespace
+
+Status Operation::GetRecordBatchReader(std::shared_ptr<RecordBatchReader>* out) const {
+  return GetRecordBatchReader(kDefaultMaxRows, default_memory_pool(), out);
+}
+
+Status Operation::GetRecordBatchReader(int max_rows, MemoryPool* pool,
+                                       std::shared_ptr<RecordBatchReader>* out) const {
+  std::vector<ColumnDesc> column_descs;
+  RETURN_NOT_OK(GetResultSetMetadata(&column_descs));
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(ColumnDescsToSchema(column_descs, &schema));
+
+  auto reader =
+      std::make_shared<ResultSetReader>(this, max_rows, pool, std::move(schema));
+  RETURN_NOT_OK(reader->StartFetch());
+  *out = std::move(reader);
+  return Status::OK();
+}
+
 Status Operation::Cancel() const {
   hs2::TCancelOperationReq req;
   req.__set_operationHandle(impl_->handle);
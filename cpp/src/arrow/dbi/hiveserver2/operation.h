@@ -24,13 +24,12 @@
 #include "arrow/dbi/hiveserver2/columnar_row_set.h"
 #include "arrow/dbi/hiveserver2/types.h"
 
+#include "arrow/type_fwd.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
 
-class Status;
-
 namespace hiveserver2 {
 
 struct ThriftRPC;
@@ -91,6 +90,15 @@ class ARROW_EXPORT Operation {
   Status Fetch(int max_rows, FetchOrientation orientation,
                std::unique_ptr<ColumnarRowSet>* results, bool* has_more_rows) const;
 
+  // Returns a reader decoding the remaining results of this operation into Arrow
+  // record batches of up to max_rows rows, with the schema given by
+  // ColumnDescsToSchema(). The next batch is fetched in the background while the
+  // current one is decoded. The operation must not be used or closed while the reader
+  // exists.
+  Status GetRecordBatchReader(std::shared_ptr<RecordBatchReader>* out) const;
+  Status GetRecordBatchReader(int max_rows, MemoryPool* pool,
+                              std::shared_ptr<RecordBatchReader>* out) const;
+
   // May be called after successfully creating the operation and before calling Close.
   Status Cancel() const;
 
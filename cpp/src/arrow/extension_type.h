@@ -81,6 +81,15 @@ class ARROW_EXPORT ExtensionType : public DataType {
   /// \return the serialized representation
   virtual std::string Serialize() const = 0;
 
+  /// \brief Whether compute functions may execute on the storage of this type
+  ///
+  /// If true, selection, sorting, hashing and set lookup functions with no
+  /// kernel for this type are executed on the storage arrays, and their
+  /// results holding storage values are wrapped back into this type.  This
+  /// is only correct if the storage values compare and order like the
+  /// extension values, hence it is disabled by default.
+  virtual bool ComputeOnStorage() const { return false; }
+
   /// \brief Wrap the given storage array as an extension array
   static std::shared_ptr<Array> WrapArray(const std::shared_ptr<DataType>& ext_type,
                                           const std::shared_ptr<Array>& storage);
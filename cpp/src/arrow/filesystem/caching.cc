@@ -0,0 +1,645 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/filesystem/caching.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::PlatformFilename;
+
+namespace fs {
+
+//////////////////////////////////////////////////////////////////////////
+// BlockCache implementation
+
+BlockCacheOptions BlockCacheOptions::Defaults(std::string cache_dir) {
+  BlockCacheOptions options;
+  options.cache_dir = std::move(cache_dir);
+  return options;
+}
+
+class BlockCache::Impl {
+ public:
+  explicit Impl(BlockCacheOptions options) : options_(std::move(options)) {}
+
+  ~Impl() {
+    // Cached blocks don't survive the cache
+    std::vector<PlatformFilename> to_delete;
+    for (const auto& block : lru_) {
+      to_delete.push_back(block.file);
+    }
+    DeleteBlockFiles(to_delete);
+  }
+
+  Status Init() {
+    if (options_.cache_dir.empty()) {
+      return Status::Invalid("BlockCache needs a cache directory");
+    }
+    if (options_.block_size <= 0) {
+      return Status::Invalid("BlockCache block size must be strictly positive");
+    }
+    if (options_.capacity < 0) {
+      return Status::Invalid("BlockCache capacity must be positive");
+    }
+    ARROW_ASSIGN_OR_RAISE(cache_dir_, PlatformFilename::FromString(options_.cache_dir));
+    RETURN_NOT_OK(::arrow::internal::CreateDirTree(cache_dir_));
+    // Blocks left by a previous cache are not indexed, remove them
+    return ::arrow::internal::DeleteDirContents(cache_dir_).status();
+  }
+
+  const BlockCacheOptions& options() const { return options_; }
+
+  Result<bool> ReadBlock(const std::string& key, const FileInfo& info,
+                         int64_t block_index, int64_t offset, int64_t nbytes,
+                         uint8_t* out) {
+    PlatformFilename file;
+    {
+      std::vector<PlatformFilename> to_delete;
+      std::unique_lock<std::mutex> lock(mutex_);
+      auto it = FindFile(key, info, &to_delete);
+      if (it == files_.end()) {
+        lock.unlock();
+        DeleteBlockFiles(to_delete);
+        return Miss();
+      }
+      auto block_it = it->second.blocks.find(block_index);
+      if (block_it == it->second.blocks.end() ||
+          offset + nbytes > block_it->second->size) {
+        return Miss();
+      }
+      // Mark as most recently used
+      lru_.splice(lru_.begin(), lru_, block_it->second);
+      file = block_it->second->file;
+    }
+
+    // The block may be evicted concurrently, in which case the read fails
+    // and is simply reported as a miss.
+    auto maybe_fd = ::arrow::internal::FileOpenReadable(file);
+    if (!maybe_fd.ok()) {
+      return Miss();
+    }
+    const int fd = *maybe_fd;
+    auto maybe_bytes_read = ::arrow::internal::FileReadAt(fd, out, offset, nbytes);
+    RETURN_NOT_OK(::arrow::internal::FileClose(fd));
+    if (!maybe_bytes_read.ok() || *maybe_bytes_read != nbytes) {
+      return Miss();
+    }
+    ++hits_;
+    return true;
+  }
+
+  Status InsertBlock(const std::string& key, const FileInfo& info, int64_t block_index,
+                     const Buffer& data) {
+    const int64_t size = data.size();
+    if (size > options_.block_size) {
+      return Status::Invalid("Cannot cache block larger than the block size");
+    }
+    if (size > options_.capacity) {
+      return Status::OK();
+    }
+
+    // Write the block file outside of the lock
+    ARROW_ASSIGN_OR_RAISE(
+        auto file, cache_dir_.Join(std::to_string(next_block_id_++) + ".block"));
+    ARROW_ASSIGN_OR_RAISE(int fd, ::arrow::internal::FileOpenWritable(file));
+    auto st = ::arrow::internal::FileWrite(fd, data.data(), size);
+    st &= ::arrow::internal::FileClose(fd);
+    if (!st.ok()) {
+      DeleteBlockFiles({file});
+      return st;
+    }
+
+    std::vector<PlatformFilename> to_delete;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      auto it = FindFile(key, info, &to_delete);
+      if (it == files_.end()) {
+        FileEntry entry;
+        entry.size = info.size();
+        entry.mtime = info.mtime();
+        it = files_.emplace(key, std::move(entry)).first;
+      }
+      auto& blocks = it->second.blocks;
+      if (blocks.find(block_index) != blocks.end()) {
+        // Cached concurrently by another reader
+        to_delete.push_back(std::move(file));
+      } else {
+        lru_.push_front(Block{key, block_index, size, std::move(file)});
+        blocks.emplace(block_index, lru_.begin());
+        cached_bytes_ += size;
+        // Evict least recently used blocks
+        while (cached_bytes_ > options_.capacity) {
+          auto& victim = lru_.back();
+          to_delete.push_back(victim.file);
+          EraseBlock(std::prev(lru_.end()));
+        }
+      }
+    }
+    DeleteBlockFiles(to_delete);
+    return Status::OK();
+  }
+
+  void Invalidate(const std::string& key, bool recursive) {
+    std::vector<PlatformFilename> to_delete;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      auto it = files_.find(key);
+      if (it != files_.end()) {
+        EraseFile(it, &to_delete);
+      }
+      if (recursive) {
+        const auto prefix =
+            (!key.empty() && key.back() == '/') ? key : key + std::string(1, '/');
+        for (it = files_.begin(); it != files_.end();) {
+          if (it->first.compare(0, prefix.length(), prefix) == 0) {
+            it = EraseFile(it, &to_delete);
+          } else {
+            ++it;
+          }
+        }
+      }
+    }
+    DeleteBlockFiles(to_delete);
+  }
+
+  int64_t hits() const { return hits_.load(); }
+
+  int64_t misses() const { return misses_.load(); }
+
+  int64_t cached_bytes() const {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return cached_bytes_;
+  }
+
+ protected:
+  struct Block {
+    std::string key;
+    int64_t index;
+    int64_t size;
+    PlatformFilename file;
+  };
+  // Most recently used blocks first
+  using BlockList = std::list<Block>;
+
+  struct FileEntry {
+    int64_t size;
+    TimePoint mtime;
+    std::unordered_map<int64_t, BlockList::iterator> blocks;
+  };
+  using FileMap = std::unordered_map<std::string, FileEntry>;
+
+  bool Miss() {
+    ++misses_;
+    return false;
+  }
+
+  // Find the entry for the given file, discarding it if it's outdated.
+  // The caller must hold the lock.
+  FileMap::iterator FindFile(const std::string& key, const FileInfo& info,
+                             std::vector<PlatformFilename>* to_delete) {
+    auto it = files_.find(key);
+    if (it != files_.end() &&
+        (it->second.size != info.size() || it->second.mtime != info.mtime())) {
+      EraseFile(it, to_delete);
+      return files_.end();
+    }
+    return it;
+  }
+
+  // The caller must hold the lock.
+  FileMap::iterator EraseFile(FileMap::iterator it,
+                              std::vector<PlatformFilename>* to_delete) {
+    for (const auto& pair : it->second.blocks) {
+      to_delete->push_back(pair.second->file);
+      cached_bytes_ -= pair.second->size;
+      lru_.erase(pair.second);
+    }
+    return files_.erase(it);
+  }
+
+  // The caller must hold the lock.
+  void EraseBlock(BlockList::iterator block_it) {
+    auto it = files_.find(block_it->key);
+    DCHECK(it != files_.end());
+    it->second.blocks.erase(block_it->index);
+    if (it->second.blocks.empty()) {
+      files_.erase(it);
+    }
+    cached_bytes_ -= block_it->size;
+    lru_.erase(block_it);
+  }
+
+  void DeleteBlockFiles(const std::vector<PlatformFilename>& files) {
+    for (const auto& file : files) {
+      auto st = ::arrow::internal::DeleteFile(file).status();
+      if (!st.ok()) {
+        ARROW_LOG(WARNING) << "Failed to delete cached block: " << st.ToString();
+      }
+    }
+  }
+
+  const BlockCacheOptions options_;
+  PlatformFilename cache_dir_;
+
+  mutable std::mutex mutex_;
+  FileMap files_;
+  BlockList lru_;
+  int64_t cached_bytes_ = 0;
+
+  std::atomic<int64_t> next_block_id_{0};
+  std::atomic<int64_t> hits_{0};
+  std::atomic<int64_t> misses_{0};
+};
+
+BlockCache::BlockCache(BlockCacheOptions options)
+    : impl_(new Impl(std::move(options))) {}
+
+BlockCache::~BlockCache() {}
+
+Result<std::shared_ptr<BlockCache>> BlockCache::Make(BlockCacheOptions options) {
+  std::shared_ptr<BlockCache> cache(new BlockCache(std::move(options)));
+  RETURN_NOT_OK(cache->impl_->Init());
+  return cache;
+}
+
+const BlockCacheOptions& BlockCache::options() const { return impl_->options(); }
+
+Result<bool> BlockCache::ReadBlock(const std::string& key, const FileInfo& info,
+                                   int64_t block_index, int64_t offset, int64_t nbytes,
+                                   uint8_t* out) {
+  return impl_->ReadBlock(key, info, block_index, offset, nbytes, out);
+}
+
+Status BlockCache::InsertBlock(const std::string& key, const FileInfo& info,
+                               int64_t block_index, const Buffer& data) {
+  return impl_->InsertBlock(key, info, block_index, data);
+}
+
+void BlockCache::Invalidate(const std::string& key, bool recursive) {
+  impl_->Invalidate(key, recursive);
+}
+
+int64_t BlockCache::hits() const { return impl_->hits(); }
+
+int64_t BlockCache::misses() const { return impl_->misses(); }
+
+int64_t BlockCache::cached_bytes() const { return impl_->cached_bytes(); }
+
+//////////////////////////////////////////////////////////////////////////
+// CachingFileSystem implementation
+
+namespace {
+
+bool IsCacheable(const FileInfo& info) {
+  return info.IsFile() && info.size() != kNoSize && info.mtime() != kNoTime;
+}
+
+// A RandomAccessFile that reads through a BlockCache, and reads missing
+// blocks from the base filesystem
+class CachedInputFile final : public io::RandomAccessFile {
+ public:
+  CachedInputFile(std::shared_ptr<FileSystem> base_fs, std::shared_ptr<BlockCache> cache,
+                  std::string key, FileInfo info)
+      : base_fs_(std::move(base_fs)),
+        cache_(std::move(cache)),
+        key_(std::move(key)),
+        info_(std::move(info)),
+        block_size_(cache_->options().block_size) {}
+
+  Status CheckClosed() const {
+    if (closed_) {
+      return Status::Invalid("Operation on closed file");
+    }
+    return Status::OK();
+  }
+
+  Status CheckPosition(int64_t position, const char* action) const {
+    if (position < 0) {
+      return Status::Invalid("Cannot ", action, " from negative position");
+    }
+    if (position > info_.size()) {
+      return Status::IOError("Cannot ", action, " past end of file");
+    }
+    return Status::OK();
+  }
+
+  // RandomAccessFile APIs
+
+  Status Close() override {
+    std::unique_lock<std::mutex> lock(base_file_mutex_);
+    closed_ = true;
+    if (base_file_) {
+      RETURN_NOT_OK(base_file_->Close());
+      base_file_.reset();
+    }
+    return Status::OK();
+  }
+
+  bool closed() const override { return closed_; }
+
+  Result<int64_t> Tell() const override {
+    RETURN_NOT_OK(CheckClosed());
+    return pos_;
+  }
+
+  Result<int64_t> GetSize() override {
+    RETURN_NOT_OK(CheckClosed());
+    return info_.size();
+  }
+
+  Status Seek(int64_t position) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "seek"));
+
+    pos_ = position;
+    return Status::OK();
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "read"));
+
+    nbytes = std::min(nbytes, info_.size() - position);
+    if (nbytes == 0) {
+      return 0;
+    }
+    auto out_data = static_cast<uint8_t*>(out);
+    const int64_t first_block = position / block_size_;
+    const int64_t last_block = (position + nbytes - 1) / block_size_;
+
+    // Copy cached blocks, remembering the missing ones
+    std::vector<int64_t> missing_blocks;
+    for (int64_t block = first_block; block <= last_block; ++block) {
+      int64_t offset, length;
+      uint8_t* dest = BlockSlice(position, nbytes, block, out_data, &offset, &length);
+      ARROW_ASSIGN_OR_RAISE(bool hit,
+                            cache_->ReadBlock(key_, info_, block, offset, length, dest));
+      if (!hit) {
+        missing_blocks.push_back(block);
+      }
+    }
+
+    // Fetch runs of consecutive missing blocks in a single read
+    size_t i = 0;
+    while (i < missing_blocks.size()) {
+      size_t j = i + 1;
+      while (j < missing_blocks.size() &&
+             missing_blocks[j] == missing_blocks[j - 1] + 1) {
+        ++j;
+      }
+      RETURN_NOT_OK(FetchBlocks(missing_blocks[i], missing_blocks[j - 1], position,
+                                nbytes, out_data));
+      i = j;
+    }
+    return nbytes;
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "read"));
+
+    // No need to allocate more than the remaining number of bytes
+    nbytes = std::min(nbytes, info_.size() - position);
+
+    ARROW_ASSIGN_OR_RAISE(auto buf, AllocateResizableBuffer(nbytes));
+    if (nbytes > 0) {
+      ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                            ReadAt(position, nbytes, buf->mutable_data()));
+      DCHECK_EQ(bytes_read, nbytes);
+    }
+    return std::move(buf);
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(pos_, nbytes, out));
+    pos_ += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(pos_, nbytes));
+    pos_ += buffer->size();
+    return std::move(buffer);
+  }
+
+ protected:
+  // Compute the part of `block` that overlaps the read of [position, position + nbytes),
+  // returning the corresponding destination pointer.
+  uint8_t* BlockSlice(int64_t position, int64_t nbytes, int64_t block, uint8_t* out,
+                      int64_t* offset, int64_t* length) const {
+    const int64_t block_start = block * block_size_;
+    const int64_t start = std::max(position, block_start);
+    const int64_t end = std::min(position + nbytes, block_start + block_size_);
+    *offset = start - block_start;
+    *length = end - start;
+    return out + (start - position);
+  }
+
+  // Read blocks [first_block, last_block] from the base file, copy their
+  // overlap with the current read to `out`, and cache them.
+  Status FetchBlocks(int64_t first_block, int64_t last_block, int64_t position,
+                     int64_t nbytes, uint8_t* out) {
+    const int64_t start = first_block * block_size_;
+    const int64_t end = std::min(info_.size(), (last_block + 1) * block_size_);
+    ARROW_ASSIGN_OR_RAISE(auto base_file, GetBaseFile());
+    ARROW_ASSIGN_OR_RAISE(auto data, base_file->ReadAt(start, end - start));
+    if (data->size() != end - start) {
+      return Status::IOError("File '", info_.path(), "' was truncated while reading it");
+    }
+    for (int64_t block = first_block; block <= last_block; ++block) {
+      int64_t offset, length;
+      uint8_t* dest = BlockSlice(position, nbytes, block, out, &offset, &length);
+      const int64_t block_offset = (block - first_block) * block_size_;
+      std::memcpy(dest, data->data() + block_offset + offset, length);
+
+      const int64_t block_length = std::min(block_size_, data->size() - block_offset);
+      auto st = cache_->InsertBlock(key_, info_, block,
+                                    *SliceBuffer(data, block_offset, block_length));
+      if (!st.ok()) {
+        // Caching is best-effort, the read itself succeeded
+        ARROW_LOG(WARNING) << "Failed to cache block: " << st.ToString();
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<io::RandomAccessFile>> GetBaseFile() {
+    std::unique_lock<std::mutex> lock(base_file_mutex_);
+    RETURN_NOT_OK(CheckClosed());
+    if (!base_file_) {
+      ARROW_ASSIGN_OR_RAISE(base_file_, base_fs_->OpenInputFile(info_));
+    }
+    return base_file_;
+  }
+
+  std::shared_ptr<FileSystem> base_fs_;
+  std::shared_ptr<BlockCache> cache_;
+  const std::string key_;
+  const FileInfo info_;
+  const int64_t block_size_;
+
+  // The base file is only opened on a cache miss
+  std::mutex base_file_mutex_;
+  std::shared_ptr<io::RandomAccessFile> base_file_;
+  std::atomic<bool> closed_{false};
+  int64_t pos_ = 0;
+};
+
+}  // namespace
+
+CachingFileSystem::CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                                     std::shared_ptr<BlockCache> cache)
+    : base_fs_(std::move(base_fs)),
+      cache_(std::move(cache)),
+      key_prefix_(base_fs_->type_name() + "://") {}
+
+std::string CachingFileSystem::CacheKey(const std::string& path) const {
+  return key_prefix_ + path;
+}
+
+Result<std::string> CachingFileSystem::NormalizePath(std::string path) {
+  return base_fs_->NormalizePath(std::move(path));
+}
+
+bool CachingFileSystem::Equals(const FileSystem& other) const {
+  if (this == &other) {
+    return true;
+  }
+  if (other.type_name() != type_name()) {
+    return false;
+  }
+  const auto& caching = checked_cast<const CachingFileSystem&>(other);
+  return cache_ == caching.cache_ && base_fs_->Equals(caching.base_fs_);
+}
+
+Result<FileInfo> CachingFileSystem::GetFileInfo(const std::string& path) {
+  return base_fs_->GetFileInfo(path);
+}
+
+Result<std::vector<FileInfo>> CachingFileSystem::GetFileInfo(
+    const FileSelector& select) {
+  return base_fs_->GetFileInfo(select);
+}
+
+FileInfoIterator CachingFileSystem::GetFileInfoIterator(const FileSelector& select) {
+  return base_fs_->GetFileInfoIterator(select);
+}
+
+Status CachingFileSystem::CreateDir(const std::string& path, bool recursive) {
+  return base_fs_->CreateDir(path, recursive);
+}
+
+Status CachingFileSystem::DeleteDir(const std::string& path) {
+  cache_->Invalidate(CacheKey(path), /*recursive=*/true);
+  return base_fs_->DeleteDir(path);
+}
+
+Status CachingFileSystem::DeleteDirContents(const std::string& path) {
+  cache_->Invalidate(CacheKey(path), /*recursive=*/true);
+  return base_fs_->DeleteDirContents(path);
+}
+
+Status CachingFileSystem::DeleteRootDirContents() {
+  cache_->Invalidate(key_prefix_, /*recursive=*/true);
+  return base_fs_->DeleteRootDirContents();
+}
+
+Status CachingFileSystem::DeleteFile(const std::string& path) {
+  cache_->Invalidate(CacheKey(path));
+  return base_fs_->DeleteFile(path);
+}
+
+Status CachingFileSystem::DeleteFiles(const std::vector<std::string>& paths) {
+  for (const auto& path : paths) {
+    cache_->Invalidate(CacheKey(path));
+  }
+  return base_fs_->DeleteFiles(paths);
+}
+
+Status CachingFileSystem::Move(const std::string& src, const std::string& dest) {
+  cache_->Invalidate(CacheKey(src), /*recursive=*/true);
+  cache_->Invalidate(CacheKey(dest), /*recursive=*/true);
+  return base_fs_->Move(src, dest);
+}
+
+Status CachingFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  cache_->Invalidate(CacheKey(dest));
+  return base_fs_->CopyFile(src, dest);
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto info, base_fs_->GetFileInfo(path));
+  return OpenInputStream(info);
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const FileInfo& info) {
+  if (!IsCacheable(info)) {
+    return base_fs_->OpenInputStream(info);
+  }
+  // A RandomAccessFile is also an InputStream
+  ARROW_ASSIGN_OR_RAISE(auto file, OpenInputFile(info));
+  return std::move(file);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto info, base_fs_->GetFileInfo(path));
+  return OpenInputFile(info);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const FileInfo& info) {
+  if (!IsCacheable(info)) {
+    return base_fs_->OpenInputFile(info);
+  }
+  return std::make_shared<CachedInputFile>(base_fs_, cache_, CacheKey(info.path()), info);
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenOutputStream(
+    const std::string& path) {
+  cache_->Invalidate(CacheKey(path));
+  return base_fs_->OpenOutputStream(path);
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenAppendStream(
+    const std::string& path) {
+  cache_->Invalidate(CacheKey(path));
+  return base_fs_->OpenAppendStream(path);
+}
+
+}  // namespace fs
+}  // namespace arrow
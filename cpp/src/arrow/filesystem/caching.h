@@ -0,0 +1,174 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace fs {
+
+/// Options for a BlockCache.
+struct ARROW_EXPORT BlockCacheOptions {
+  /// The local directory where cached blocks are stored.
+  ///
+  /// The directory is owned by the cache: it is created if necessary,
+  /// and any existing contents are deleted when the cache is created.
+  std::string cache_dir;
+  /// The size in bytes of cached blocks.
+  int64_t block_size = 4 * 1024 * 1024;
+  /// The maximum total size in bytes of cached blocks.
+  int64_t capacity = 1LL << 30;
+
+  /// \brief Initialize with defaults, storing blocks in `cache_dir`
+  static BlockCacheOptions Defaults(std::string cache_dir);
+};
+
+/// \brief A cache of fixed-size file blocks, stored on local disk
+///
+/// Blocks are stored in individual local files, while the index is kept
+/// in memory.  Each cached file is tagged with the size and modification
+/// time it had when its blocks were cached; looking it up with a different
+/// size or modification time invalidates all its blocks.  Least recently
+/// used blocks are evicted once the cache capacity is exceeded.
+///
+/// A BlockCache is thread-safe, and is meant to be shared by all readers
+/// of a process (for example several CachingFileSystem instances).
+class ARROW_EXPORT BlockCache {
+ public:
+  ~BlockCache();
+
+  static Result<std::shared_ptr<BlockCache>> Make(BlockCacheOptions options);
+
+  const BlockCacheOptions& options() const;
+
+  /// \brief Read part of a cached block
+  ///
+  /// `key` identifies the file, and `info` its current version.  Return
+  /// false if the block isn't cached (or isn't valid anymore), in which case
+  /// the contents of `out` are unspecified.
+  Result<bool> ReadBlock(const std::string& key, const FileInfo& info,
+                         int64_t block_index, int64_t offset, int64_t nbytes,
+                         uint8_t* out);
+
+  /// \brief Cache a block of the given file
+  ///
+  /// `data` must be a whole block, i.e. `block_size` bytes or less for the
+  /// last block of the file.
+  Status InsertBlock(const std::string& key, const FileInfo& info, int64_t block_index,
+                     const Buffer& data);
+
+  /// \brief Discard the cached blocks for a file
+  ///
+  /// If `recursive` is true, also discard the cached blocks of all files
+  /// whose key starts with `key` followed by a '/' separator (or simply
+  /// starts with `key`, if it already ends with a separator).
+  void Invalidate(const std::string& key, bool recursive = false);
+
+  /// The number of ReadBlock() calls that found a valid block
+  int64_t hits() const;
+  /// The number of ReadBlock() calls that didn't find a valid block
+  int64_t misses() const;
+  /// The total size of the cached blocks
+  int64_t cached_bytes() const;
+
+ protected:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+
+  explicit BlockCache(BlockCacheOptions options);
+};
+
+/// \brief A FileSystem implementation that caches reads from another
+/// implementation in a BlockCache.
+///
+/// This is useful for remote filesystems (such as S3 or HDFS) where the
+/// same files are read repeatedly.  Files opened with OpenInputFile() and
+/// OpenInputStream() are read through the cache, block by block, and runs
+/// of missing blocks are fetched from the base filesystem in a single read.
+/// Opening by path issues a GetFileInfo() call on the base filesystem to
+/// validate the cached blocks; files without a known size and modification
+/// time are not cached.
+///
+/// Other operations are forwarded to the base filesystem.  Writing,
+/// moving or deleting files through this filesystem discards the
+/// corresponding cached blocks.
+class ARROW_EXPORT CachingFileSystem : public FileSystem {
+ public:
+  CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                    std::shared_ptr<BlockCache> cache);
+
+  std::string type_name() const override { return "caching"; }
+  std::shared_ptr<FileSystem> base_fs() const { return base_fs_; }
+  std::shared_ptr<BlockCache> cache() const { return cache_; }
+
+  Result<std::string> NormalizePath(std::string path) override;
+
+  bool Equals(const FileSystem& other) const override;
+
+  /// \cond FALSE
+  using FileSystem::GetFileInfo;
+  /// \endcond
+  Result<FileInfo> GetFileInfo(const std::string& path) override;
+  Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) override;
+  FileInfoIterator GetFileInfoIterator(const FileSelector& select) override;
+
+  Status CreateDir(const std::string& path, bool recursive = true) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path) override;
+  Status DeleteRootDirContents() override;
+
+  Status DeleteFile(const std::string& path) override;
+  Status DeleteFiles(const std::vector<std::string>& paths) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(const FileInfo& info) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const FileInfo& info) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
+      const std::string& path) override;
+
+ protected:
+  // The cache key for a path of the base filesystem
+  std::string CacheKey(const std::string& path) const;
+
+  std::shared_ptr<FileSystem> base_fs_;
+  std::shared_ptr<BlockCache> cache_;
+  // Distinguishes the base filesystem's entries from other filesystems'
+  // in a shared cache
+  const std::string key_prefix_;
+};
+
+}  // namespace fs
+}  // namespace arrow
@@ -0,0 +1,228 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/caching.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/filesystem/test_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/util.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace fs {
+
+using ::arrow::internal::TemporaryDir;
+
+class CachingFSTestMixin {
+ public:
+  void SetUpCache(int64_t block_size = 1000, int64_t capacity = 1 << 20) {
+    time_ = TimePoint(TimePoint::duration(42));
+    base_fs_ = std::make_shared<internal::MockFileSystem>(time_);
+    ASSERT_OK_AND_ASSIGN(temp_dir_, TemporaryDir::Make("caching-fs-test-"));
+    auto options = BlockCacheOptions::Defaults(temp_dir_->path().ToString());
+    options.block_size = block_size;
+    options.capacity = capacity;
+    ASSERT_OK_AND_ASSIGN(cache_, BlockCache::Make(options));
+    fs_ = std::make_shared<CachingFileSystem>(base_fs_, cache_);
+  }
+
+ protected:
+  TimePoint time_;
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  std::shared_ptr<FileSystem> base_fs_;
+  std::shared_ptr<BlockCache> cache_;
+  std::shared_ptr<CachingFileSystem> fs_;
+};
+
+////////////////////////////////////////////////////////////////////////////
+// Generic CachingFileSystem tests
+
+class TestCachingFSGeneric : public ::testing::Test,
+                             public CachingFSTestMixin,
+                             public GenericFileSystemTest {
+ public:
+  void SetUp() override { SetUpCache(); }
+
+ protected:
+  std::shared_ptr<FileSystem> GetEmptyFileSystem() override { return fs_; }
+};
+
+GENERIC_FS_TEST_FUNCTIONS(TestCachingFSGeneric);
+
+////////////////////////////////////////////////////////////////////////////
+// Caching-specific tests
+
+class TestCachingFS : public ::testing::Test, public CachingFSTestMixin {
+ public:
+  void SetUp() override { SetUpCache(); }
+
+  void CheckReadAt(io::RandomAccessFile* file, const std::string& data,
+                   int64_t position, int64_t nbytes) {
+    ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(position, nbytes));
+    nbytes = std::min<int64_t>(nbytes, data.size() - position);
+    ASSERT_EQ(buf->ToString(), data.substr(position, nbytes));
+  }
+};
+
+TEST_F(TestCachingFS, ReadThroughCache) {
+  const auto data = random_string(4500, /*seed=*/42);
+  ASSERT_OK(base_fs_->CreateDir("AB"));
+  CreateFile(base_fs_.get(), "AB/file", data);
+
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("AB/file"));
+  ASSERT_OK_AND_EQ(4500, file->GetSize());
+  // Spans blocks 1 and 2
+  CheckReadAt(file.get(), data, 1500, 1000);
+  ASSERT_EQ(cache_->hits(), 0);
+  ASSERT_EQ(cache_->misses(), 2);
+  ASSERT_EQ(cache_->cached_bytes(), 2000);
+
+  // Same blocks, from cache
+  CheckReadAt(file.get(), data, 1200, 1700);
+  ASSERT_EQ(cache_->hits(), 2);
+  ASSERT_EQ(cache_->misses(), 2);
+
+  // Partially cached read, including the shorter last block
+  CheckReadAt(file.get(), data, 500, 100000);
+  ASSERT_EQ(cache_->hits(), 4);
+  ASSERT_EQ(cache_->misses(), 5);
+  ASSERT_EQ(cache_->cached_bytes(), 4500);
+  ASSERT_OK(file->Close());
+
+  // Cached blocks are shared between files and filesystems
+  auto other_fs = std::make_shared<CachingFileSystem>(base_fs_, cache_);
+  ASSERT_OK_AND_ASSIGN(auto stream, other_fs->OpenInputStream("AB/file"));
+  ASSERT_OK_AND_ASSIGN(auto buf, stream->Read(10000));
+  ASSERT_EQ(buf->ToString(), data);
+  ASSERT_EQ(cache_->hits(), 9);
+  ASSERT_EQ(cache_->misses(), 5);
+
+  // Empty reads and reads at end of file
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("AB/file"));
+  CheckReadAt(file.get(), data, 4500, 10);
+  CheckReadAt(file.get(), data, 100, 0);
+  ASSERT_RAISES(IOError, file->ReadAt(4501, 10));
+  ASSERT_RAISES(Invalid, file->ReadAt(-1, 10));
+}
+
+TEST_F(TestCachingFS, Validation) {
+  auto data = random_string(2500, /*seed=*/42);
+  CreateFile(base_fs_.get(), "file", data);
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("file"));
+  CheckReadAt(file.get(), data, 0, 2500);
+  ASSERT_EQ(cache_->misses(), 3);
+
+  // Modified behind our back, with a different size
+  data = random_string(2600, /*seed=*/43);
+  CreateFile(base_fs_.get(), "file", data);
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("file"));
+  CheckReadAt(file.get(), data, 0, 2600);
+  ASSERT_EQ(cache_->hits(), 0);
+  ASSERT_EQ(cache_->misses(), 6);
+  ASSERT_EQ(cache_->cached_bytes(), 2600);
+
+  // Files of unknown modification time are not cached
+  FileInfo info("file", FileType::File);
+  info.set_size(2600);
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile(info));
+  CheckReadAt(file.get(), data, 0, 2600);
+  ASSERT_EQ(cache_->hits(), 0);
+  ASSERT_EQ(cache_->misses(), 6);
+}
+
+TEST_F(TestCachingFS, Invalidation) {
+  const auto data = random_string(1500, /*seed=*/42);
+  ASSERT_OK(base_fs_->CreateDir("AB/CD"));
+  CreateFile(base_fs_.get(), "AB/CD/file", data);
+  CreateFile(base_fs_.get(), "AB/other", data);
+  CreateFile(base_fs_.get(), "ABC", data);
+
+  auto read_all = [&](const std::string& path) {
+    ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile(path));
+    CheckReadAt(file.get(), data, 0, 1500);
+  };
+  read_all("AB/CD/file");
+  read_all("AB/other");
+  read_all("ABC");
+  ASSERT_EQ(cache_->cached_bytes(), 4500);
+
+  CreateFile(fs_.get(), "AB/other", "new data");
+  ASSERT_EQ(cache_->cached_bytes(), 3000);
+  read_all("AB/CD/file");
+  ASSERT_EQ(cache_->hits(), 2);
+
+  ASSERT_OK(fs_->DeleteDir("AB"));
+  ASSERT_EQ(cache_->cached_bytes(), 1500);
+  read_all("ABC");
+  ASSERT_EQ(cache_->hits(), 4);
+
+  ASSERT_OK(fs_->DeleteRootDirContents());
+  ASSERT_EQ(cache_->cached_bytes(), 0);
+}
+
+TEST_F(TestCachingFS, Eviction) {
+  SetUpCache(/*block_size=*/1000, /*capacity=*/2500);
+  const auto data = random_string(5000, /*seed=*/42);
+  CreateFile(base_fs_.get(), "file", data);
+
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("file"));
+  CheckReadAt(file.get(), data, 0, 1000);
+  CheckReadAt(file.get(), data, 1000, 1000);
+  ASSERT_EQ(cache_->cached_bytes(), 2000);
+  // Touch block 0, so that block 1 is evicted first
+  CheckReadAt(file.get(), data, 0, 1000);
+  CheckReadAt(file.get(), data, 2000, 1000);
+  ASSERT_EQ(cache_->cached_bytes(), 2000);
+  ASSERT_EQ(cache_->hits(), 1);
+  ASSERT_EQ(cache_->misses(), 3);
+
+  CheckReadAt(file.get(), data, 0, 1000);
+  ASSERT_EQ(cache_->hits(), 2);
+  CheckReadAt(file.get(), data, 1000, 1000);
+  ASSERT_EQ(cache_->misses(), 4);
+
+  // The whole file doesn't fit, but reads are still correct
+  CheckReadAt(file.get(), data, 0, 5000);
+  ASSERT_LE(cache_->cached_bytes(), 2500);
+}
+
+TEST(BlockCache, InvalidOptions) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir, TemporaryDir::Make("caching-fs-test-"));
+  BlockCacheOptions options;
+  ASSERT_RAISES(Invalid, BlockCache::Make(options));
+  options = BlockCacheOptions::Defaults(temp_dir->path().ToString());
+  options.block_size = 0;
+  ASSERT_RAISES(Invalid, BlockCache::Make(options));
+  options.block_size = 1000;
+  options.capacity = -1;
+  ASSERT_RAISES(Invalid, BlockCache::Make(options));
+  options.capacity = 0;
+  ASSERT_OK(BlockCache::Make(options));
+}
+
+}  // namespace fs
+}  // namespace arrow
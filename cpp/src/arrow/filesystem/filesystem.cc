@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <chrono>
 #include <sstream>
 #include <utility>
 
@@ -31,6 +32,7 @@
 #include "arrow/filesystem/mockfs.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/util_internal.h"
+#include "arrow/io/instrumented.h"
 #include "arrow/io/slow.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -132,6 +134,19 @@ Result<std::vector<FileInfo>> FileSystem::GetFileInfo(
   return res;
 }
 
+FileInfoIterator FileSystem::GetFileInfoIterator(const FileSelector& select) {
+  auto maybe_infos = GetFileInfo(select);
+  if (!maybe_infos.ok()) {
+    return MakeErrorIterator<FileInfoVector>(maybe_infos.status());
+  }
+  auto infos = maybe_infos.MoveValueUnsafe();
+  std::vector<FileInfoVector> batches;
+  if (!infos.empty()) {
+    batches.push_back(std::move(infos));
+  }
+  return MakeVectorIterator(std::move(batches));
+}
+
 Status FileSystem::DeleteFiles(const std::vector<std::string>& paths) {
   Status st = Status::OK();
   for (const auto& path : paths) {
@@ -167,7 +182,9 @@ Result<std::shared_ptr<io::RandomAccessFile>> FileSystem::OpenInputFile(
 
 SubTreeFileSystem::SubTreeFileSystem(const std::string& base_path,
                                      std::shared_ptr<FileSystem> base_fs)
-    : base_path_(NormalizeBasePath(base_path, base_fs).ValueOrDie()), base_fs_(base_fs) {}
+    : FileSystem(base_fs->io_context()),
+      base_path_(NormalizeBasePath(base_path, base_fs).ValueOrDie()),
+      base_fs_(base_fs) {}
 
 SubTreeFileSystem::~SubTreeFileSystem() {}
 
@@ -205,17 +222,25 @@ Status SubTreeFileSystem::PrependBaseNonEmpty(std::string* s) const {
   }
 }
 
-Result<std::string> SubTreeFileSystem::StripBase(const std::string& s) const {
-  auto len = base_path_.length();
-  // Note base_path_ ends with a slash (if not empty)
-  if (s.length() >= len && s.substr(0, len) == base_path_) {
+namespace {
+
+Result<std::string> StripBasePath(const std::string& base_path, const std::string& s) {
+  auto len = base_path.length();
+  // Note base_path ends with a slash (if not empty)
+  if (s.length() >= len && s.substr(0, len) == base_path) {
     return s.substr(len);
   } else {
     return Status::UnknownError("Underlying filesystem returned path '", s,
-                                "', which is not a subpath of '", base_path_, "'");
+                                "', which is not a subpath of '", base_path, "'");
   }
 }
 
+}  // namespace
+
+Result<std::string> SubTreeFileSystem::StripBase(const std::string& s) const {
+  return StripBasePath(base_path_, s);
+}
+
 Status SubTreeFileSystem::FixInfo(FileInfo* info) const {
   ARROW_ASSIGN_OR_RAISE(auto fixed_path, StripBase(info->path()));
   info->set_path(std::move(fixed_path));
@@ -243,6 +268,22 @@ Result<std::vector<FileInfo>> SubTreeFileSystem::GetFileInfo(const FileSelector&
   return infos;
 }
 
+FileInfoIterator SubTreeFileSystem::GetFileInfoIterator(const FileSelector& select) {
+  auto selector = select;
+  selector.base_dir = PrependBase(selector.base_dir);
+  // The iterator may outlive this filesystem, so capture the base path by value
+  auto base_path = base_path_;
+  auto fix_infos = [base_path](FileInfoVector infos) -> Result<FileInfoVector> {
+    for (auto& info : infos) {
+      ARROW_ASSIGN_OR_RAISE(auto fixed_path, StripBasePath(base_path, info.path()));
+      info.set_path(std::move(fixed_path));
+    }
+    return infos;
+  };
+  return MakeMaybeMapIterator(std::move(fix_infos),
+                              base_fs_->GetFileInfoIterator(selector));
+}
+
 Status SubTreeFileSystem::CreateDir(const std::string& path, bool recursive) {
   auto s = path;
   RETURN_NOT_OK(PrependBaseNonEmpty(&s));
@@ -344,15 +385,19 @@ Result<std::shared_ptr<io::OutputStream>> SubTreeFileSystem::OpenAppendStream(
 
 SlowFileSystem::SlowFileSystem(std::shared_ptr<FileSystem> base_fs,
                                std::shared_ptr<io::LatencyGenerator> latencies)
-    : base_fs_(base_fs), latencies_(latencies) {}
+    : FileSystem(base_fs->io_context()), base_fs_(base_fs), latencies_(latencies) {}
 
 SlowFileSystem::SlowFileSystem(std::shared_ptr<FileSystem> base_fs,
                                double average_latency)
-    : base_fs_(base_fs), latencies_(io::LatencyGenerator::Make(average_latency)) {}
+    : FileSystem(base_fs->io_context()),
+      base_fs_(base_fs),
+      latencies_(io::LatencyGenerator::Make(average_latency)) {}
 
 SlowFileSystem::SlowFileSystem(std::shared_ptr<FileSystem> base_fs,
                                double average_latency, int32_t seed)
-    : base_fs_(base_fs), latencies_(io::LatencyGenerator::Make(average_latency, seed)) {}
+    : FileSystem(base_fs->io_context()),
+      base_fs_(base_fs),
+      latencies_(io::LatencyGenerator::Make(average_latency, seed)) {}
 
 bool SlowFileSystem::Equals(const FileSystem& other) const { return this == &other; }
 
@@ -366,6 +411,11 @@ Result<std::vector<FileInfo>> SlowFileSystem::GetFileInfo(const FileSelector& se
   return base_fs_->GetFileInfo(selector);
 }
 
+FileInfoIterator SlowFileSystem::GetFileInfoIterator(const FileSelector& selector) {
+  latencies_->Sleep();
+  return base_fs_->GetFileInfoIterator(selector);
+}
+
 Status SlowFileSystem::CreateDir(const std::string& path, bool recursive) {
   latencies_->Sleep();
   return base_fs_->CreateDir(path, recursive);
@@ -442,6 +492,132 @@ Result<std::shared_ptr<io::OutputStream>> SlowFileSystem::OpenAppendStream(
   return base_fs_->OpenAppendStream(path);
 }
 
+//////////////////////////////////////////////////////////////////////////
+// InstrumentedFileSystem implementation
+
+namespace {
+
+using MetadataClock = std::chrono::steady_clock;
+
+int64_t NanosSince(MetadataClock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(MetadataClock::now() -
+                                                              start)
+      .count();
+}
+
+}  // namespace
+
+InstrumentedFileSystem::InstrumentedFileSystem(
+    std::shared_ptr<FileSystem> base_fs, std::shared_ptr<io::IOStatistics> statistics)
+    : FileSystem(base_fs->io_context()),
+      base_fs_(std::move(base_fs)),
+      statistics_(std::move(statistics)) {}
+
+bool InstrumentedFileSystem::Equals(const FileSystem& other) const {
+  return this == &other;
+}
+
+Result<std::string> InstrumentedFileSystem::NormalizePath(std::string path) {
+  return base_fs_->NormalizePath(std::move(path));
+}
+
+Result<FileInfo> InstrumentedFileSystem::GetFileInfo(const std::string& path) {
+  const auto start = MetadataClock::now();
+  ARROW_ASSIGN_OR_RAISE(auto info, base_fs_->GetFileInfo(path));
+  statistics_->RecordMetadata(NanosSince(start));
+  return info;
+}
+
+Result<std::vector<FileInfo>> InstrumentedFileSystem::GetFileInfo(
+    const FileSelector& selector) {
+  const auto start = MetadataClock::now();
+  ARROW_ASSIGN_OR_RAISE(auto infos, base_fs_->GetFileInfo(selector));
+  statistics_->RecordMetadata(NanosSince(start));
+  return infos;
+}
+
+FileInfoIterator InstrumentedFileSystem::GetFileInfoIterator(
+    const FileSelector& selector) {
+  // Each batch of the listing is counted as a request
+  auto statistics = statistics_;
+  auto it = std::make_shared<FileInfoIterator>(base_fs_->GetFileInfoIterator(selector));
+  return MakeFunctionIterator([statistics, it]() -> Result<std::vector<FileInfo>> {
+    const auto start = MetadataClock::now();
+    ARROW_ASSIGN_OR_RAISE(auto infos, it->Next());
+    if (!infos.empty()) {
+      statistics->RecordMetadata(NanosSince(start));
+    }
+    return infos;
+  });
+}
+
+Status InstrumentedFileSystem::CreateDir(const std::string& path, bool recursive) {
+  return base_fs_->CreateDir(path, recursive);
+}
+
+Status InstrumentedFileSystem::DeleteDir(const std::string& path) {
+  return base_fs_->DeleteDir(path);
+}
+
+Status InstrumentedFileSystem::DeleteDirContents(const std::string& path) {
+  return base_fs_->DeleteDirContents(path);
+}
+
+Status InstrumentedFileSystem::DeleteRootDirContents() {
+  return base_fs_->DeleteRootDirContents();
+}
+
+Status InstrumentedFileSystem::DeleteFile(const std::string& path) {
+  return base_fs_->DeleteFile(path);
+}
+
+Status InstrumentedFileSystem::Move(const std::string& src, const std::string& dest) {
+  return base_fs_->Move(src, dest);
+}
+
+Status InstrumentedFileSystem::CopyFile(const std::string& src,
+                                        const std::string& dest) {
+  return base_fs_->CopyFile(src, dest);
+}
+
+Result<std::shared_ptr<io::InputStream>> InstrumentedFileSystem::OpenInputStream(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto stream, base_fs_->OpenInputStream(path));
+  statistics_->RecordOpen();
+  return std::make_shared<io::InstrumentedInputStream>(stream, statistics_);
+}
+
+Result<std::shared_ptr<io::InputStream>> InstrumentedFileSystem::OpenInputStream(
+    const FileInfo& info) {
+  ARROW_ASSIGN_OR_RAISE(auto stream, base_fs_->OpenInputStream(info));
+  statistics_->RecordOpen();
+  return std::make_shared<io::InstrumentedInputStream>(stream, statistics_);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> InstrumentedFileSystem::OpenInputFile(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto file, base_fs_->OpenInputFile(path));
+  statistics_->RecordOpen();
+  return std::make_shared<io::InstrumentedRandomAccessFile>(file, statistics_);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> InstrumentedFileSystem::OpenInputFile(
+    const FileInfo& info) {
+  ARROW_ASSIGN_OR_RAISE(auto file, base_fs_->OpenInputFile(info));
+  statistics_->RecordOpen();
+  return std::make_shared<io::InstrumentedRandomAccessFile>(file, statistics_);
+}
+
+Result<std::shared_ptr<io::OutputStream>> InstrumentedFileSystem::OpenOutputStream(
+    const std::string& path) {
+  return base_fs_->OpenOutputStream(path);
+}
+
+Result<std::shared_ptr<io::OutputStream>> InstrumentedFileSystem::OpenAppendStream(
+    const std::string& path) {
+  return base_fs_->OpenAppendStream(path);
+}
+
 Status CopyFiles(const std::vector<FileLocator>& sources,
                  const std::vector<FileLocator>& destinations, int64_t chunk_size,
                  bool use_threads) {
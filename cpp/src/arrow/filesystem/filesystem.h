@@ -26,9 +26,11 @@
 #include <vector>
 
 #include "arrow/filesystem/type_fwd.h"
+#include "arrow/io/interfaces.h"
 #include "arrow/io/type_fwd.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/compare.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 #include "arrow/util/windows_fixup.h"
@@ -118,6 +120,21 @@ struct ARROW_EXPORT FileInfo : public util::EqualityComparable<FileInfo> {
 
 ARROW_EXPORT std::ostream& operator<<(std::ostream& os, const FileInfo&);
 
+using FileInfoVector = std::vector<FileInfo>;
+/// \brief A sequence of FileInfo batches, as returned by GetFileInfoIterator()
+///
+/// Batches are never empty; an empty batch signals the end of iteration.
+using FileInfoIterator = Iterator<FileInfoVector>;
+
+}  // namespace fs
+
+template <>
+struct IterationTraits<fs::FileInfoVector> {
+  static fs::FileInfoVector End() { return {}; }
+};
+
+namespace fs {
+
 /// \brief File selector for filesystem APIs
 struct ARROW_EXPORT FileSelector {
   /// The directory in which to select files.
@@ -153,6 +170,15 @@ class ARROW_EXPORT FileSystem : public std::enable_shared_from_this<FileSystem>
   /// may allow normalizing irregular path forms (such as Windows local paths).
   virtual Result<std::string> NormalizePath(std::string path);
 
+  /// The context for the asynchronous I/O of this filesystem
+  ///
+  /// Its executor runs the background tasks of the filesystem (such as
+  /// parallel directory listing), and is meant for asynchronous reads of its
+  /// files.  Give each filesystem its own throttled executor (see
+  /// arrow::internal::ThrottledExecutor) to cap its requests in flight
+  /// independently of other filesystems.
+  const io::AsyncContext& io_context() const { return io_context_; }
+
   virtual bool Equals(const FileSystem& other) const = 0;
 
   virtual bool Equals(const std::shared_ptr<FileSystem>& other) const {
@@ -175,6 +201,18 @@ class ARROW_EXPORT FileSystem : public std::enable_shared_from_this<FileSystem>
   /// it exists.
   /// If it doesn't exist, see `FileSelector::allow_not_found`.
   virtual Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) = 0;
+  /// Same, streaming the results in batches.
+  ///
+  /// Batches are yielded as soon as they are available, in no particular
+  /// order.  This allows callers to start processing entries before a large
+  /// tree is entirely listed.  Any error (including the selector's base
+  /// directory not being found) is returned by the iterator.
+  ///
+  /// The default implementation calls GetFileInfo(select) and yields its
+  /// result as a single batch.  Implementations where listing a directory
+  /// is slow (such as object stores) may list several directories
+  /// concurrently in the background.
+  virtual FileInfoIterator GetFileInfoIterator(const FileSelector& select);
 
   /// Create a directory and subdirectories.
   ///
@@ -250,6 +288,12 @@ class ARROW_EXPORT FileSystem : public std::enable_shared_from_this<FileSystem>
   /// If the target doesn't exist, a new empty file is created.
   virtual Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
       const std::string& path) = 0;
+
+ protected:
+  explicit FileSystem(const io::AsyncContext& io_context = io::AsyncContext())
+      : io_context_(io_context) {}
+
+  io::AsyncContext io_context_;
 };
 
 /// \brief A FileSystem implementation that delegates to another
@@ -281,6 +325,7 @@ class ARROW_EXPORT SubTreeFileSystem : public FileSystem {
   /// \endcond
   Result<FileInfo> GetFileInfo(const std::string& path) override;
   Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) override;
+  FileInfoIterator GetFileInfoIterator(const FileSelector& select) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
@@ -337,6 +382,7 @@ class ARROW_EXPORT SlowFileSystem : public FileSystem {
   using FileSystem::GetFileInfo;
   Result<FileInfo> GetFileInfo(const std::string& path) override;
   Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) override;
+  FileInfoIterator GetFileInfoIterator(const FileSelector& select) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
@@ -367,6 +413,59 @@ class ARROW_EXPORT SlowFileSystem : public FileSystem {
   std::shared_ptr<io::LatencyGenerator> latencies_;
 };
 
+/// \brief A FileSystem implementation that delegates to another
+/// implementation and records the I/O performed through it.
+///
+/// Files and streams opened for reading are wrapped to record their reads
+/// into the given io::IOStatistics, and file info requests are recorded as
+/// metadata requests.  Other operations are forwarded directly.
+class ARROW_EXPORT InstrumentedFileSystem : public FileSystem {
+ public:
+  InstrumentedFileSystem(std::shared_ptr<FileSystem> base_fs,
+                         std::shared_ptr<io::IOStatistics> statistics);
+
+  std::string type_name() const override { return "instrumented"; }
+  bool Equals(const FileSystem& other) const override;
+
+  std::shared_ptr<FileSystem> base_fs() const { return base_fs_; }
+  const std::shared_ptr<io::IOStatistics>& statistics() const { return statistics_; }
+
+  Result<std::string> NormalizePath(std::string path) override;
+
+  using FileSystem::GetFileInfo;
+  Result<FileInfo> GetFileInfo(const std::string& path) override;
+  Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) override;
+  FileInfoIterator GetFileInfoIterator(const FileSelector& select) override;
+
+  Status CreateDir(const std::string& path, bool recursive = true) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path) override;
+  Status DeleteRootDirContents() override;
+
+  Status DeleteFile(const std::string& path) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(const FileInfo& info) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const FileInfo& info) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
+      const std::string& path) override;
+
+ protected:
+  std::shared_ptr<FileSystem> base_fs_;
+  std::shared_ptr<io::IOStatistics> statistics_;
+};
+
 /// \defgroup filesystem-factories Functions for creating FileSystem instances
 ///
 /// @{
@@ -26,6 +26,7 @@
 #include "arrow/filesystem/mockfs.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/test_util.h"
+#include "arrow/io/instrumented.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/testing/gtest_util.h"
 
@@ -779,6 +780,30 @@ TEST_F(TestSubTreeFileSystem, GetFileInfoSelector) {
   ASSERT_EQ(infos.size(), 0);
 }
 
+TEST_F(TestSubTreeFileSystem, GetFileInfoIterator) {
+  FileSelector selector;
+
+  ASSERT_OK(subfs_->CreateDir("AB/CD"));
+  CreateFile("ab", "data");
+  CreateFile("AB/cd", "data2");
+  CreateFile("AB/CD/ef", "data34");
+
+  selector.base_dir = "AB";
+  selector.recursive = true;
+  auto it = subfs_->GetFileInfoIterator(selector);
+  ASSERT_OK_AND_ASSIGN(auto infos, it.Next());
+  ASSERT_EQ(infos.size(), 3);
+  AssertFileInfo(infos[0], "AB/CD", FileType::Directory, time_);
+  AssertFileInfo(infos[1], "AB/CD/ef", FileType::File, time_, 6);
+  AssertFileInfo(infos[2], "AB/cd", FileType::File, time_, 5);
+  ASSERT_OK_AND_ASSIGN(infos, it.Next());
+  ASSERT_EQ(infos, IterationTraits<FileInfoVector>::End());
+
+  selector.base_dir = "nonexistent";
+  it = subfs_->GetFileInfoIterator(selector);
+  ASSERT_RAISES(IOError, it.Next());
+}
+
 ////////////////////////////////////////////////////////////////////////////
 // Generic SlowFileSystem tests
 
@@ -800,6 +825,70 @@ class TestSlowFSGeneric : public ::testing::Test, public GenericFileSystemTest {
 
 GENERIC_FS_TEST_FUNCTIONS(TestSlowFSGeneric);
 
+////////////////////////////////////////////////////////////////////////////
+// InstrumentedFileSystem tests
+
+class TestInstrumentedFSGeneric : public ::testing::Test, public GenericFileSystemTest {
+ public:
+  void SetUp() override {
+    time_ = TimePoint(TimePoint::duration(42));
+    fs_ = std::make_shared<MockFileSystem>(time_);
+    instrumented_fs_ = std::make_shared<InstrumentedFileSystem>(
+        fs_, std::make_shared<io::IOStatistics>());
+  }
+
+ protected:
+  std::shared_ptr<FileSystem> GetEmptyFileSystem() override { return instrumented_fs_; }
+
+  TimePoint time_;
+  std::shared_ptr<MockFileSystem> fs_;
+  std::shared_ptr<InstrumentedFileSystem> instrumented_fs_;
+};
+
+GENERIC_FS_TEST_FUNCTIONS(TestInstrumentedFSGeneric);
+
+TEST(TestInstrumentedFS, Statistics) {
+  auto time = TimePoint(TimePoint::duration(42));
+  auto base_fs = std::make_shared<MockFileSystem>(time);
+  auto stats = std::make_shared<io::IOStatistics>();
+  InstrumentedFileSystem fs(base_fs, stats);
+  ASSERT_EQ(fs.type_name(), "instrumented");
+
+  ASSERT_OK(fs.CreateDir("AB"));
+  CreateFile(&fs, "AB/ab", "some data");
+  auto snapshot = stats->Snapshot();
+  ASSERT_EQ(snapshot.files_opened, 0);
+  ASSERT_EQ(snapshot.read_requests, 0);
+  ASSERT_EQ(snapshot.metadata_requests, 0);
+
+  ASSERT_OK_AND_ASSIGN(auto info, fs.GetFileInfo("AB/ab"));
+  FileSelector selector;
+  selector.base_dir = "AB";
+  ASSERT_OK_AND_ASSIGN(auto infos, fs.GetFileInfo(selector));
+  ASSERT_EQ(infos.size(), 1);
+
+  ASSERT_OK_AND_ASSIGN(auto stream, fs.OpenInputStream(info));
+  ASSERT_OK_AND_ASSIGN(auto buffer, stream->Read(4));
+  AssertBufferEqual(*buffer, "some");
+  ASSERT_OK(stream->Close());
+
+  ASSERT_OK_AND_ASSIGN(auto file, fs.OpenInputFile("AB/ab"));
+  ASSERT_OK_AND_ASSIGN(buffer, file->ReadAt(5, 4));
+  AssertBufferEqual(*buffer, "data");
+  ASSERT_OK_AND_ASSIGN(auto size, file->GetSize());
+  ASSERT_EQ(size, 9);
+  ASSERT_OK(file->Close());
+
+  snapshot = stats->Snapshot();
+  ASSERT_EQ(snapshot.files_opened, 2);
+  ASSERT_EQ(snapshot.read_requests, 2);
+  ASSERT_EQ(snapshot.bytes_read, 8);
+  ASSERT_EQ(snapshot.metadata_requests, 3);
+
+  ASSERT_RAISES(IOError, fs.OpenInputFile("nonexistent"));
+  ASSERT_EQ(stats->Snapshot().files_opened, 2);
+}
+
 }  // namespace internal
 }  // namespace fs
 }  // namespace arrow
@@ -283,6 +283,19 @@ void HdfsOptions::ConfigureExtraConf(std::string key, std::string val) {
   connection_config.extra_conf.emplace(std::move(key), std::move(val));
 }
 
+void HdfsOptions::ConfigureHedgedReads(int32_t threads, int32_t threshold_ms) {
+  connection_config.hedged_read_threads = threads;
+  connection_config.hedged_read_threshold_ms = threshold_ms;
+}
+
+void HdfsOptions::ConfigureShortCircuitReads(std::string domain_socket_path) {
+  connection_config.domain_socket_path = std::move(domain_socket_path);
+}
+
+void HdfsOptions::ConfigureReadHandles(int32_t max_read_handles) {
+  connection_config.max_read_handles = max_read_handles;
+}
+
 bool HdfsOptions::Equals(const HdfsOptions& other) const {
   return (buffer_size == other.buffer_size && replication == other.replication &&
           default_block_size == other.default_block_size &&
@@ -290,6 +303,14 @@ bool HdfsOptions::Equals(const HdfsOptions& other) const {
           connection_config.port == other.connection_config.port &&
           connection_config.user == other.connection_config.user &&
           connection_config.kerb_ticket == other.connection_config.kerb_ticket &&
+          connection_config.hedged_read_threads ==
+              other.connection_config.hedged_read_threads &&
+          connection_config.hedged_read_threshold_ms ==
+              other.connection_config.hedged_read_threshold_ms &&
+          connection_config.domain_socket_path ==
+              other.connection_config.domain_socket_path &&
+          connection_config.max_read_handles ==
+              other.connection_config.max_read_handles &&
           connection_config.extra_conf == other.connection_config.extra_conf);
 }
 
@@ -366,6 +387,49 @@ Result<HdfsOptions> HdfsOptions::FromUri(const Uri& uri) {
     options_map.erase(it);
   }
 
+  // configure hedged reads
+  it = options_map.find("hedged_read_threads");
+  if (it != options_map.end()) {
+    const auto& v = it->second;
+    int32_t threads;
+    if (!ParseValue<Int32Type>(v.data(), v.size(), &threads)) {
+      return Status::Invalid("Invalid value for option 'hedged_read_threads': '", v,
+                             "'");
+    }
+    options.connection_config.hedged_read_threads = threads;
+    options_map.erase(it);
+  }
+  it = options_map.find("hedged_read_threshold_ms");
+  if (it != options_map.end()) {
+    const auto& v = it->second;
+    int32_t threshold_ms;
+    if (!ParseValue<Int32Type>(v.data(), v.size(), &threshold_ms)) {
+      return Status::Invalid("Invalid value for option 'hedged_read_threshold_ms': '",
+                             v, "'");
+    }
+    options.connection_config.hedged_read_threshold_ms = threshold_ms;
+    options_map.erase(it);
+  }
+
+  // configure short-circuit reads
+  it = options_map.find("domain_socket_path");
+  if (it != options_map.end()) {
+    options.ConfigureShortCircuitReads(it->second);
+    options_map.erase(it);
+  }
+
+  // configure concurrent reads
+  it = options_map.find("max_read_handles");
+  if (it != options_map.end()) {
+    const auto& v = it->second;
+    int32_t max_read_handles;
+    if (!ParseValue<Int32Type>(v.data(), v.size(), &max_read_handles)) {
+      return Status::Invalid("Invalid value for option 'max_read_handles': '", v, "'");
+    }
+    options.ConfigureReadHandles(max_read_handles);
+    options_map.erase(it);
+  }
+
   // configure other options
   for (const auto& it : options_map) {
     options.ConfigureExtraConf(it.first, it.second);
@@ -380,14 +444,15 @@ Result<HdfsOptions> HdfsOptions::FromUri(const std::string& uri_string) {
   return FromUri(uri);
 }
 
-HadoopFileSystem::HadoopFileSystem(const HdfsOptions& options)
-    : impl_(new Impl{options}) {}
+HadoopFileSystem::HadoopFileSystem(const HdfsOptions& options,
+                                   const io::AsyncContext& io_context)
+    : FileSystem(io_context), impl_(new Impl{options}) {}
 
 HadoopFileSystem::~HadoopFileSystem() {}
 
 Result<std::shared_ptr<HadoopFileSystem>> HadoopFileSystem::Make(
-    const HdfsOptions& options) {
-  std::shared_ptr<HadoopFileSystem> ptr(new HadoopFileSystem(options));
+    const HdfsOptions& options, const io::AsyncContext& io_context) {
+  std::shared_ptr<HadoopFileSystem> ptr(new HadoopFileSystem(options, io_context));
   RETURN_NOT_OK(ptr->impl_->Init());
   return ptr;
 }
@@ -48,6 +48,13 @@ struct ARROW_EXPORT HdfsOptions {
   void ConfigureBlockSize(int64_t default_block_size);
   void ConfigureKerberosTicketCachePath(std::string path);
   void ConfigureExtraConf(std::string key, std::string val);
+  /// Start a second read of a block on another DataNode if the first one takes
+  /// longer than threshold_ms, using at most `threads` threads
+  void ConfigureHedgedReads(int32_t threads, int32_t threshold_ms);
+  /// Read local blocks directly, if the DataNode domain socket exists locally
+  void ConfigureShortCircuitReads(std::string domain_socket_path);
+  /// Allow this many concurrent positional reads on each file opened for reading
+  void ConfigureReadHandles(int32_t max_read_handles);
 
   bool Equals(const HdfsOptions& other) const;
 
@@ -97,10 +104,12 @@ class ARROW_EXPORT HadoopFileSystem : public FileSystem {
       const std::string& path) override;
 
   /// Create a HdfsFileSystem instance from the given options.
-  static Result<std::shared_ptr<HadoopFileSystem>> Make(const HdfsOptions& options);
+  static Result<std::shared_ptr<HadoopFileSystem>> Make(
+      const HdfsOptions& options,
+      const io::AsyncContext& io_context = io::AsyncContext());
 
  protected:
-  explicit HadoopFileSystem(const HdfsOptions& options);
+  HadoopFileSystem(const HdfsOptions& options, const io::AsyncContext& io_context);
 
   class Impl;
   std::unique_ptr<Impl> impl_;
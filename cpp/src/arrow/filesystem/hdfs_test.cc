@@ -59,6 +59,17 @@ TEST(TestHdfsOptions, FromUri) {
   ASSERT_EQ(options.connection_config.port, 9999);
   ASSERT_EQ(options.connection_config.extra_conf["hdfs_token"], "hdfs_token_ticket");
 
+  ASSERT_OK(uri.Parse(
+      "hdfs://otherhost:9999/?hedged_read_threads=4&hedged_read_threshold_ms=100"
+      "&domain_socket_path=/var/run/hdfs/dn._PORT&max_read_handles=8"));
+  ASSERT_OK_AND_ASSIGN(options, HdfsOptions::FromUri(uri));
+  ASSERT_EQ(options.connection_config.hedged_read_threads, 4);
+  ASSERT_EQ(options.connection_config.hedged_read_threshold_ms, 100);
+  ASSERT_EQ(options.connection_config.domain_socket_path, "/var/run/hdfs/dn._PORT");
+  ASSERT_EQ(options.connection_config.max_read_handles, 8);
+  ASSERT_TRUE(options.connection_config.extra_conf.empty());
+  ASSERT_RAISES(Invalid, HdfsOptions::FromUri("hdfs://otherhost/?max_read_handles=x"));
+
   ASSERT_OK(uri.Parse("viewfs://other-nn/mypath/myfile"));
   ASSERT_OK_AND_ASSIGN(options, HdfsOptions::FromUri(uri));
   ASSERT_EQ(options.connection_config.host, "viewfs://other-nn");
@@ -15,14 +15,19 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
+#include <mutex>
 #include <sstream>
 #include <utility>
 
 #ifdef _WIN32
 #include "arrow/util/windows_compatibility.h"
 #else
+#include <dirent.h>
 #include <errno.h>
 #include <fcntl.h>
 #include <stdio.h>
@@ -35,6 +40,7 @@
 #include "arrow/io/file.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/uri.h"
 #include "arrow/util/windows_fixup.h"
 
@@ -201,9 +207,132 @@ Result<FileInfo> StatFile(const std::string& path) {
 
 #endif
 
-Status StatSelector(const PlatformFilename& dir_fn, const FileSelector& select,
-                    int32_t nesting_depth, std::vector<FileInfo>* out) {
-  auto result = ListDir(dir_fn);
+#ifdef _WIN32
+
+// List a directory and stat its entries
+Result<std::vector<FileInfo>> ListAndStatDir(const PlatformFilename& dir_fn) {
+  ARROW_ASSIGN_OR_RAISE(auto children, ListDir(dir_fn));
+  std::vector<FileInfo> infos;
+  infos.reserve(children.size());
+  for (const auto& child_fn : children) {
+    ARROW_ASSIGN_OR_RAISE(FileInfo info, StatFile(dir_fn.Join(child_fn).ToNative()));
+    if (info.type() != FileType::NotFound) {
+      infos.push_back(std::move(info));
+    }
+  }
+  return infos;
+}
+
+#else  // POSIX systems
+
+#if defined(__linux__) && defined(STATX_TYPE)
+#define ARROW_HAVE_STATX
+
+// Set to false if statx() proves unsupported by the running kernel
+std::atomic<bool> statx_supported(true);
+
+FileInfo StatxToFileInfo(const struct statx& s) {
+  FileInfo info;
+  if (S_ISREG(s.stx_mode)) {
+    info.set_type(FileType::File);
+    info.set_size(static_cast<int64_t>(s.stx_size));
+  } else if (S_ISDIR(s.stx_mode)) {
+    info.set_type(FileType::Directory);
+    info.set_size(kNoSize);
+  } else {
+    info.set_type(FileType::Unknown);
+    info.set_size(kNoSize);
+  }
+  struct timespec mtime;
+  mtime.tv_sec = static_cast<time_t>(s.stx_mtime.tv_sec);
+  mtime.tv_nsec = static_cast<long>(s.stx_mtime.tv_nsec);  // NOLINT runtime/int
+  info.set_mtime(ToTimePoint(mtime));
+  return info;
+}
+#endif
+
+// Stat a directory entry relative to the directory's handle.  This saves
+// a full path lookup per entry, which matters on network filesystems.
+Status StatDirEntry(int dir_fd, const char* name, FileInfo* info) {
+#ifdef ARROW_HAVE_STATX
+  if (statx_supported.load()) {
+    // Only ask for the attributes we need, so that network filesystems
+    // can skip fetching the others
+    struct statx s;
+    if (statx(dir_fd, name, 0, STATX_TYPE | STATX_SIZE | STATX_MTIME, &s) == 0) {
+      *info = StatxToFileInfo(s);
+      return Status::OK();
+    }
+    if (errno != ENOSYS) {
+      return IOErrorFromErrno(errno, "statx() failed");
+    }
+    statx_supported.store(false);
+  }
+#endif
+  struct stat s;
+  if (fstatat(dir_fd, name, &s, 0) != 0) {
+    return IOErrorFromErrno(errno, "fstatat() failed");
+  }
+  *info = StatToFileInfo(s);
+  return Status::OK();
+}
+
+// List a directory and stat its entries
+Result<std::vector<FileInfo>> ListAndStatDir(const PlatformFilename& dir_fn) {
+  const auto dir_path = dir_fn.ToNative();
+  DIR* dir = opendir(dir_path.c_str());
+  if (dir == nullptr) {
+    return IOErrorFromErrno(errno, "Cannot list directory '", dir_fn.ToString(), "'");
+  }
+  auto dir_deleter = [](DIR* dir) -> void {
+    if (closedir(dir) != 0) {
+      ARROW_LOG(WARNING) << "Cannot close directory handle: "
+                         << ::arrow::internal::ErrnoMessage(errno);
+    }
+  };
+  std::unique_ptr<DIR, decltype(dir_deleter)> dir_guard(dir, dir_deleter);
+  const int dir_fd = dirfd(dir);
+
+  std::vector<FileInfo> infos;
+  while (true) {
+    errno = 0;
+    // readdir() fetches entries in batches through getdents64()
+    struct dirent* entry = readdir(dir);
+    if (entry == nullptr) {
+      if (errno != 0) {
+        return IOErrorFromErrno(errno, "Cannot list directory '", dir_fn.ToString(),
+                                "'");
+      }
+      break;
+    }
+    const char* name = entry->d_name;
+    if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0) {
+      continue;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto child_fn, dir_fn.Join(name));
+    FileInfo info;
+    auto st = StatDirEntry(dir_fd, name, &info);
+    if (!st.ok()) {
+      const int errnum = ::arrow::internal::ErrnoFromStatus(st);
+      if (errnum == ENOENT || errnum == ENOTDIR || errnum == ELOOP) {
+        // Vanished entry or dangling symlink
+        continue;
+      }
+      return st.WithMessage("Failed stat()ing path '", child_fn.ToString(),
+                            "': ", st.message());
+    }
+    info.set_path(child_fn.ToNative());
+    infos.push_back(std::move(info));
+  }
+  return infos;
+}
+
+#endif
+
+// List a directory for a selector, handling `allow_not_found`
+Status ListSelectorDir(const PlatformFilename& dir_fn, const FileSelector& select,
+                       std::vector<FileInfo>* out) {
+  auto result = ListAndStatDir(dir_fn);
   if (!result.ok()) {
     auto status = result.status();
     if (select.allow_not_found && status.IsIOError()) {
@@ -214,21 +343,135 @@ Status StatSelector(const PlatformFilename& dir_fn, const FileSelector& select,
     }
     return status;
   }
+  *out = std::move(result).ValueOrDie();
+  return Status::OK();
+}
 
-  for (const auto& child_fn : *result) {
-    PlatformFilename full_fn = dir_fn.Join(child_fn);
-    ARROW_ASSIGN_OR_RAISE(FileInfo info, StatFile(full_fn.ToNative()));
-    if (info.type() != FileType::NotFound) {
-      out->push_back(std::move(info));
-    }
-    if (nesting_depth < select.max_recursion && select.recursive &&
-        info.type() == FileType::Directory) {
-      RETURN_NOT_OK(StatSelector(full_fn, select, nesting_depth + 1, out));
+Status StatSelector(const PlatformFilename& dir_fn, const FileSelector& select,
+                    int32_t nesting_depth, std::vector<FileInfo>* out) {
+  std::vector<FileInfo> infos;
+  RETURN_NOT_OK(ListSelectorDir(dir_fn, select, &infos));
+
+  for (auto& info : infos) {
+    const bool recurse = nesting_depth < select.max_recursion && select.recursive &&
+                         info.type() == FileType::Directory;
+    std::string path = info.path();
+    out->push_back(std::move(info));
+    if (recurse) {
+      ARROW_ASSIGN_OR_RAISE(auto child_fn, PlatformFilename::FromString(path));
+      RETURN_NOT_OK(StatSelector(child_fn, select, nesting_depth + 1, out));
     }
   }
   return Status::OK();
 }
 
+// Walk a directory tree, listing up to `concurrency` directories at once on
+// the filesystem's I/O executor.  The calling thread takes part in the walk, so that
+// progress is made even if the thread pool is busy.
+class ParallelSelectorWalk : public std::enable_shared_from_this<ParallelSelectorWalk> {
+ public:
+  ParallelSelectorWalk(FileSelector select, int32_t concurrency,
+                       ::arrow::internal::Executor* executor)
+      : select_(std::move(select)), concurrency_(concurrency), executor_(executor) {}
+
+  Result<std::vector<FileInfo>> Run(PlatformFilename base_fn) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      pending_.push_back({std::move(base_fn), 0});
+    }
+    Work();
+    std::lock_guard<std::mutex> lock(mutex_);
+    RETURN_NOT_OK(status_);
+    return std::move(results_);
+  }
+
+ private:
+  struct PendingDir {
+    PlatformFilename fn;
+    int32_t nesting_depth;
+  };
+
+  // Spawn workers for the pending directories.  The mutex must be held.
+  void SpawnWorkers() {
+    while (num_workers_ < concurrency_ &&
+           static_cast<size_t>(num_workers_ - num_busy_) < pending_.size() &&
+           status_.ok()) {
+      auto self = shared_from_this();
+      auto st = executor_->Spawn([self]() { self->Work(); });
+      if (!st.ok()) {
+        // The calling thread will do the work
+        break;
+      }
+      ++num_workers_;
+    }
+  }
+
+  bool done() const { return (pending_.empty() && num_busy_ == 0) || !status_.ok(); }
+
+  void Work() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      cv_.wait(lock, [&] { return !pending_.empty() || done(); });
+      if (done()) {
+        break;
+      }
+      auto dir = std::move(pending_.front());
+      pending_.pop_front();
+      ++num_busy_;
+      lock.unlock();
+
+      std::vector<FileInfo> infos;
+      auto st = ListSelectorDir(dir.fn, select_, &infos);
+      std::vector<PendingDir> children;
+      if (st.ok() && select_.recursive && dir.nesting_depth < select_.max_recursion) {
+        for (const auto& info : infos) {
+          if (info.type() == FileType::Directory) {
+            auto maybe_fn = PlatformFilename::FromString(info.path());
+            if (!maybe_fn.ok()) {
+              st = maybe_fn.status();
+              break;
+            }
+            children.push_back({*std::move(maybe_fn), dir.nesting_depth + 1});
+          }
+        }
+      }
+
+      lock.lock();
+      --num_busy_;
+      if (!st.ok()) {
+        if (status_.ok()) {
+          status_ = std::move(st);
+        }
+      } else {
+        for (auto& info : infos) {
+          results_.push_back(std::move(info));
+        }
+        for (auto& child : children) {
+          pending_.push_back(std::move(child));
+        }
+        SpawnWorkers();
+      }
+      cv_.notify_all();
+    }
+    // Workers spawned on the thread pool may outlive the Run() call, but they
+    // just notice that the walk is done.
+  }
+
+  const FileSelector select_;
+  const int32_t concurrency_;
+  ::arrow::internal::Executor* executor_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<PendingDir> pending_;
+  // Number of workers spawned on the thread pool
+  int32_t num_workers_ = 0;
+  // Number of directories being listed
+  int32_t num_busy_ = 0;
+  Status status_;
+  std::vector<FileInfo> results_;
+};
+
 }  // namespace
 
 LocalFileSystemOptions LocalFileSystemOptions::Defaults() {
@@ -236,7 +479,8 @@ LocalFileSystemOptions LocalFileSystemOptions::Defaults() {
 }
 
 bool LocalFileSystemOptions::Equals(const LocalFileSystemOptions& other) const {
-  return use_mmap == other.use_mmap;
+  return use_mmap == other.use_mmap &&
+         directory_listing_concurrency == other.directory_listing_concurrency;
 }
 
 Result<LocalFileSystemOptions> LocalFileSystemOptions::FromUri(
@@ -266,8 +510,9 @@ Result<LocalFileSystemOptions> LocalFileSystemOptions::FromUri(
 
 LocalFileSystem::LocalFileSystem() : options_(LocalFileSystemOptions::Defaults()) {}
 
-LocalFileSystem::LocalFileSystem(const LocalFileSystemOptions& options)
-    : options_(options) {}
+LocalFileSystem::LocalFileSystem(const LocalFileSystemOptions& options,
+                                 const io::AsyncContext& io_context)
+    : FileSystem(io_context), options_(options) {}
 
 LocalFileSystem::~LocalFileSystem() {}
 
@@ -292,6 +537,12 @@ Result<FileInfo> LocalFileSystem::GetFileInfo(const std::string& path) {
 
 Result<std::vector<FileInfo>> LocalFileSystem::GetFileInfo(const FileSelector& select) {
   ARROW_ASSIGN_OR_RAISE(auto fn, PlatformFilename::FromString(select.base_dir));
+  if (select.recursive && select.max_recursion > 0 &&
+      options_.directory_listing_concurrency > 1) {
+    auto walk = std::make_shared<ParallelSelectorWalk>(
+        select, options_.directory_listing_concurrency, io_context_.executor);
+    return walk->Run(std::move(fn));
+  }
   std::vector<FileInfo> results;
   RETURN_NOT_OK(StatSelector(fn, select, 0, &results));
   return results;
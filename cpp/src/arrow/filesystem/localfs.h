@@ -38,6 +38,14 @@ struct ARROW_EXPORT LocalFileSystemOptions {
   /// or a regular one.
   bool use_mmap = false;
 
+  /// The maximum number of directories listed concurrently by recursive
+  /// GetFileInfo(FileSelector) calls.
+  ///
+  /// With a value greater than 1, subdirectories are listed on the I/O
+  /// thread pool, which hides metadata latency on network filesystems
+  /// (NFS, Lustre...).  Results are then returned in an unspecified order.
+  int32_t directory_listing_concurrency = 1;
+
   /// \brief Initialize with defaults
   static LocalFileSystemOptions Defaults();
 
@@ -56,7 +64,8 @@ struct ARROW_EXPORT LocalFileSystemOptions {
 class ARROW_EXPORT LocalFileSystem : public FileSystem {
  public:
   LocalFileSystem();
-  explicit LocalFileSystem(const LocalFileSystemOptions&);
+  explicit LocalFileSystem(const LocalFileSystemOptions&,
+                           const io::AsyncContext& = io::AsyncContext());
   ~LocalFileSystem() override;
 
   std::string type_name() const override { return "local"; }
@@ -31,6 +31,7 @@
 #include "arrow/filesystem/util_internal.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/io_util.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace fs {
@@ -148,6 +149,18 @@ class TestLocalFSGenericMMap : public TestLocalFSGeneric<CommonPathFormatter> {
 
 GENERIC_FS_TEST_FUNCTIONS(TestLocalFSGenericMMap);
 
+class TestLocalFSGenericParallelListing
+    : public TestLocalFSGeneric<CommonPathFormatter> {
+ protected:
+  LocalFileSystemOptions options() override {
+    auto options = LocalFileSystemOptions::Defaults();
+    options.directory_listing_concurrency = 4;
+    return options;
+  }
+};
+
+GENERIC_FS_TEST_FUNCTIONS(TestLocalFSGenericParallelListing);
+
 ////////////////////////////////////////////////////////////////////////////
 // Concrete LocalFileSystem tests
 
@@ -383,6 +396,74 @@ TYPED_TEST(TestLocalFS, FileMTime) {
   AssertDurationBetween(t2 - infos[1].mtime(), -kTimeSlack, kTimeSlack);
 }
 
+TYPED_TEST(TestLocalFS, ParallelListing) {
+  // A tree a few levels deep, with several directories per level
+  for (const std::string top : {"A", "B", "C"}) {
+    for (const std::string mid : {"a", "b", "c", "d"}) {
+      const auto dir = top + "/" + mid;
+      ASSERT_OK(this->fs_->CreateDir(dir + "/x/y"));
+      CreateFile(this->fs_.get(), dir + "/data", "some data");
+      CreateFile(this->fs_.get(), dir + "/x/y/data", "other data");
+    }
+  }
+
+  auto options = LocalFileSystemOptions::Defaults();
+  options.directory_listing_concurrency = 8;
+  auto parallel_fs = std::make_shared<SubTreeFileSystem>(
+      this->local_path_, std::make_shared<LocalFileSystem>(options));
+
+  for (const int32_t max_recursion : {0, 1, 2, 100}) {
+    SCOPED_TRACE("max_recursion = " + std::to_string(max_recursion));
+    FileSelector select;
+    select.base_dir = "";
+    select.recursive = true;
+    select.max_recursion = max_recursion;
+    ASSERT_OK_AND_ASSIGN(auto expected, this->fs_->GetFileInfo(select));
+    ASSERT_OK_AND_ASSIGN(auto actual, parallel_fs->GetFileInfo(select));
+    SortInfos(&expected);
+    SortInfos(&actual);
+    ASSERT_EQ(actual, expected);
+  }
+
+  FileSelector select;
+  select.base_dir = "missing";
+  select.recursive = true;
+  ASSERT_RAISES(IOError, parallel_fs->GetFileInfo(select));
+  select.allow_not_found = true;
+  ASSERT_OK_AND_ASSIGN(auto infos, parallel_fs->GetFileInfo(select));
+  ASSERT_EQ(infos.size(), 0);
+}
+
+TYPED_TEST(TestLocalFS, IOContext) {
+  ASSERT_EQ(this->local_fs_->io_context().executor, ::arrow::io::AsyncContext().executor);
+
+  for (const std::string dir : {"a/b/c", "a/d", "e/f"}) {
+    ASSERT_OK(this->fs_->CreateDir(dir));
+    CreateFile(this->fs_.get(), dir + "/data", "some data");
+  }
+
+  // A filesystem with its own cap on concurrent I/O tasks
+  ASSERT_OK_AND_ASSIGN(auto pool, ::arrow::internal::ThreadPool::Make(4));
+  ASSERT_OK_AND_ASSIGN(auto executor,
+                       ::arrow::internal::ThrottledExecutor::Make(pool.get(), 2));
+  auto options = LocalFileSystemOptions::Defaults();
+  options.directory_listing_concurrency = 8;
+  auto throttled_fs = std::make_shared<SubTreeFileSystem>(
+      this->local_path_,
+      std::make_shared<LocalFileSystem>(options, io::AsyncContext(executor.get())));
+  ASSERT_EQ(throttled_fs->io_context().executor, executor.get());
+
+  FileSelector select;
+  select.base_dir = "";
+  select.recursive = true;
+  ASSERT_OK_AND_ASSIGN(auto expected, this->fs_->GetFileInfo(select));
+  ASSERT_OK_AND_ASSIGN(auto actual, throttled_fs->GetFileInfo(select));
+  SortInfos(&expected);
+  SortInfos(&actual);
+  ASSERT_EQ(actual, expected);
+  ASSERT_OK(pool->Shutdown());
+}
+
 // TODO Should we test backslash paths on Windows?
 // SubTreeFileSystem isn't compatible with them.
 
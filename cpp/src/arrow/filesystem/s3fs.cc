@@ -20,10 +20,14 @@
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iterator>
 #include <mutex>
 #include <sstream>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #ifdef _WIN32
 // Undefine preprocessor macros that interfere with AWS function / method names
@@ -75,7 +79,9 @@
 #include "arrow/status.h"
 #include "arrow/util/atomic_shared_ptr.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/windows_fixup.h"
 
 namespace arrow {
@@ -307,6 +313,10 @@ Result<S3Options> S3Options::FromUri(const std::string& uri_string,
 bool S3Options::Equals(const S3Options& other) const {
   return (region == other.region && endpoint_override == other.endpoint_override &&
           scheme == other.scheme && background_writes == other.background_writes &&
+          read_part_size == other.read_part_size &&
+          read_parallelism == other.read_parallelism &&
+          write_part_size == other.write_part_size &&
+          max_concurrent_uploads == other.max_concurrent_uploads &&
           GetAccessKey() == other.GetAccessKey() &&
           GetSecretKey() == other.GetSecretKey() &&
           GetSessionToken() == other.GetSessionToken());
@@ -622,12 +632,136 @@ Result<S3Model::GetObjectResult> GetObjectRange(Aws::S3::S3Client* client,
   return OutcomeToResult(client->GetObject(req));
 }
 
+// A read of a contiguous range of a S3 object, split into ranged GET requests
+// of at most `part_size` bytes, with up to `parallelism` of them in flight.
+// This object is kept alive by the completion handlers of the requests.
+class ObjectRangeReader : public std::enable_shared_from_this<ObjectRangeReader> {
+ public:
+  // Called with the number of bytes read, once all requests are finished
+  using FinishCallback = std::function<void(Result<int64_t>)>;
+
+  ObjectRangeReader(std::shared_ptr<FileSystem> fs, Aws::S3::S3Client* client,
+                    const S3Path& path, int64_t position, int64_t nbytes, uint8_t* out,
+                    int64_t part_size, int parallelism, FinishCallback on_finish)
+      : fs_(std::move(fs)),
+        client_(client),
+        path_(path),
+        position_(position),
+        nbytes_(nbytes),
+        out_(out),
+        part_size_(part_size > 0 ? part_size : nbytes),
+        parallelism_(std::max(parallelism, 1)),
+        on_finish_(std::move(on_finish)) {
+    DCHECK_GT(nbytes_, 0);
+    num_parts_ = (nbytes_ + part_size_ - 1) / part_size_;
+    part_bytes_read_.resize(static_cast<size_t>(num_parts_), 0);
+  }
+
+  void Start() { IssueParts(); }
+
+ protected:
+  void IssueParts() {
+    std::vector<int64_t> parts;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      while (status_.ok() && next_part_ < num_parts_ && parts_in_flight_ < parallelism_) {
+        parts.push_back(next_part_++);
+        ++parts_in_flight_;
+      }
+    }
+    // Don't hold the lock while issuing, in case a handler runs immediately
+    for (const auto part : parts) {
+      IssuePart(part);
+    }
+  }
+
+  void IssuePart(int64_t part) {
+    const int64_t offset = part * part_size_;
+    const int64_t length = std::min(part_size_, nbytes_ - offset);
+
+    S3Model::GetObjectRequest req;
+    req.SetBucket(ToAwsString(path_.bucket));
+    req.SetKey(ToAwsString(path_.key));
+    req.SetRange(ToAwsString(FormatRange(position_ + offset, length)));
+    req.SetResponseStreamFactory(AwsWriteableStreamFactory(out_ + offset, length));
+
+    auto self = shared_from_this();
+    auto handler =
+        [self, part, length](
+            const Aws::S3::S3Client*, const S3Model::GetObjectRequest&,
+            const S3Model::GetObjectOutcome& outcome,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) -> void {
+      self->OnPartFinished(part, length, outcome);
+    };
+    client_->GetObjectAsync(req, handler);
+  }
+
+  void OnPartFinished(int64_t part, int64_t length,
+                      const S3Model::GetObjectOutcome& outcome) {
+    bool finished;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --parts_in_flight_;
+      if (!outcome.IsSuccess()) {
+        status_ &= ErrorToStatus(
+            std::forward_as_tuple("When reading from key '", path_.key, "' in bucket '",
+                                  path_.bucket, "': "),
+            outcome.GetError());
+      } else {
+        part_bytes_read_[part] = std::min<int64_t>(
+            length, static_cast<int64_t>(outcome.GetResult().GetContentLength()));
+      }
+      finished = parts_in_flight_ == 0 && (!status_.ok() || next_part_ == num_parts_);
+    }
+    if (!finished) {
+      IssueParts();
+      return;
+    }
+    if (!status_.ok()) {
+      on_finish_(status_);
+      return;
+    }
+    // The bytes read are those of the leading complete parts
+    // (a part can only be short if the object was truncated concurrently)
+    int64_t bytes_read = 0;
+    for (int64_t i = 0; i < num_parts_; ++i) {
+      bytes_read += part_bytes_read_[i];
+      if (part_bytes_read_[i] < std::min(part_size_, nbytes_ - i * part_size_)) {
+        break;
+      }
+    }
+    on_finish_(bytes_read);
+  }
+
+  std::shared_ptr<FileSystem> fs_;  // Owner of S3Client
+  Aws::S3::S3Client* client_;
+  const S3Path path_;
+  const int64_t position_;
+  const int64_t nbytes_;
+  uint8_t* out_;
+  const int64_t part_size_;
+  const int parallelism_;
+  FinishCallback on_finish_;
+
+  std::mutex mutex_;
+  int64_t num_parts_;
+  int64_t next_part_ = 0;
+  int parts_in_flight_ = 0;
+  std::vector<int64_t> part_bytes_read_;
+  Status status_;
+};
+
 // A RandomAccessFile that reads from a S3 object
 class ObjectInputFile final : public io::RandomAccessFile {
  public:
   ObjectInputFile(std::shared_ptr<FileSystem> fs, Aws::S3::S3Client* client,
-                  const S3Path& path, int64_t size = kNoSize)
-      : fs_(std::move(fs)), client_(client), path_(path), content_length_(size) {}
+                  const S3Path& path, const S3Options& options, int64_t size = kNoSize)
+      : fs_(std::move(fs)),
+        client_(client),
+        path_(path),
+        read_part_size_(options.read_part_size),
+        read_parallelism_(options.read_parallelism),
+        content_length_(size) {}
 
   Status Init() {
     // Issue a HEAD Object to get the content-length and ensure any
@@ -712,6 +846,16 @@ class ObjectInputFile final : public io::RandomAccessFile {
       return 0;
     }
 
+    if (IsSplitRead(nbytes)) {
+      // Issue concurrent requests for the parts and wait for all of them
+      auto fut = Future<int64_t>::Make();
+      StartRangeRead(position, nbytes, static_cast<uint8_t*>(out),
+                     [fut](Result<int64_t> bytes_read) mutable {
+                       fut.MarkFinished(std::move(bytes_read));
+                     });
+      return fut.result();
+    }
+
     // Read the desired range of bytes
     ARROW_ASSIGN_OR_RAISE(S3Model::GetObjectResult result,
                           GetObjectRange(client_, path_, position, nbytes, out));
@@ -740,6 +884,46 @@ class ObjectInputFile final : public io::RandomAccessFile {
     return std::move(buf);
   }
 
+  // The reads are issued on the AWS SDK's executor rather than on the context's
+  Future<std::shared_ptr<Buffer>> ReadAsync(const io::AsyncContext&, int64_t position,
+                                            int64_t nbytes) override {
+    Status st = CheckClosed();
+    if (st.ok()) {
+      st = CheckPosition(position, "read");
+    }
+    if (!st.ok()) {
+      return Future<std::shared_ptr<Buffer>>::MakeFinished(std::move(st));
+    }
+
+    // No need to allocate more than the remaining number of bytes
+    nbytes = std::min(nbytes, content_length_ - position);
+    auto maybe_buffer = AllocateResizableBuffer(nbytes);
+    if (!maybe_buffer.ok()) {
+      return Future<std::shared_ptr<Buffer>>::MakeFinished(maybe_buffer.status());
+    }
+    std::shared_ptr<ResizableBuffer> buf = *std::move(maybe_buffer);
+    if (nbytes == 0) {
+      return Future<std::shared_ptr<Buffer>>::MakeFinished(
+          std::shared_ptr<Buffer>(std::move(buf)));
+    }
+
+    auto fut = Future<std::shared_ptr<Buffer>>::Make();
+    StartRangeRead(position, nbytes, buf->mutable_data(),
+                   [fut, buf](Result<int64_t> bytes_read) mutable {
+                     if (!bytes_read.ok()) {
+                       fut.MarkFinished(bytes_read.status());
+                       return;
+                     }
+                     Status st = buf->Resize(*bytes_read);
+                     if (!st.ok()) {
+                       fut.MarkFinished(std::move(st));
+                       return;
+                     }
+                     fut.MarkFinished(std::shared_ptr<Buffer>(std::move(buf)));
+                   });
+    return fut;
+  }
+
   Result<int64_t> Read(int64_t nbytes, void* out) override {
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(pos_, nbytes, out));
     pos_ += bytes_read;
@@ -753,9 +937,23 @@ class ObjectInputFile final : public io::RandomAccessFile {
   }
 
  protected:
+  bool IsSplitRead(int64_t nbytes) const {
+    return read_part_size_ > 0 && read_parallelism_ > 1 && nbytes > read_part_size_;
+  }
+
+  void StartRangeRead(int64_t position, int64_t nbytes, uint8_t* out,
+                      ObjectRangeReader::FinishCallback on_finish) {
+    auto reader = std::make_shared<ObjectRangeReader>(
+        fs_, client_, path_, position, nbytes, out, read_part_size_, read_parallelism_,
+        std::move(on_finish));
+    reader->Start();
+  }
+
   std::shared_ptr<FileSystem> fs_;  // Owner of S3Client
   Aws::S3::S3Client* client_;
   S3Path path_;
+  const int64_t read_part_size_;
+  const int read_parallelism_;
   bool closed_ = false;
   int64_t pos_ = 0;
   int64_t content_length_ = kNoSize;
@@ -767,6 +965,34 @@ class ObjectInputFile final : public io::RandomAccessFile {
 // (see https://docs.aws.amazon.com/AmazonS3/latest/API/mpUploadUploadPart.html)
 static constexpr int64_t kMinimumPartUpload = 5 * 1024 * 1024;
 
+// Limits the number of concurrent part uploads across all output streams
+// of a filesystem
+class UploadLimiter {
+ public:
+  explicit UploadLimiter(int max_uploads) : max_uploads_(max_uploads) {}
+
+  // Block until an upload may start
+  void Acquire() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return uploads_ < max_uploads_; });
+    ++uploads_;
+  }
+
+  void Release() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --uploads_;
+    }
+    cv_.notify_one();
+  }
+
+ protected:
+  const int max_uploads_;
+  int uploads_ = 0;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+};
+
 // An OutputStream that writes to a S3 object
 class ObjectOutputStream final : public io::OutputStream {
  protected:
@@ -774,8 +1000,15 @@ class ObjectOutputStream final : public io::OutputStream {
 
  public:
   ObjectOutputStream(std::shared_ptr<FileSystem> fs, Aws::S3::S3Client* client,
-                     const S3Path& path, const S3Options& options)
-      : fs_(std::move(fs)), client_(client), path_(path), options_(options) {}
+                     const S3Path& path, const S3Options& options,
+                     std::shared_ptr<UploadLimiter> upload_limiter = nullptr)
+      : fs_(std::move(fs)),
+        client_(client),
+        path_(path),
+        options_(options),
+        upload_limiter_(std::move(upload_limiter)),
+        part_size_(std::max(options.write_part_size, kMinimumPartUpload)),
+        part_upload_threshold_(part_size_) {}
 
   ~ObjectOutputStream() override {
     // For compliance with the rest of the IO stack, Close rather than Abort,
@@ -906,7 +1139,8 @@ class ObjectOutputStream final : public io::OutputStream {
     // Can't upload data on its own, need to buffer it
     if (!current_part_) {
       ARROW_ASSIGN_OR_RAISE(current_part_,
-                            io::BufferOutputStream::Create(part_upload_threshold_));
+                            io::BufferOutputStream::Create(part_upload_threshold_,
+                                                           options_.memory_pool));
       current_part_size_ = 0;
     }
     RETURN_NOT_OK(current_part_->Write(data, nbytes));
@@ -954,9 +1188,18 @@ class ObjectOutputStream final : public io::OutputStream {
     req.SetPartNumber(part_number_);
     req.SetContentLength(nbytes);
 
+    // Wait for an upload slot, without holding the upload state lock
+    // (completion handlers need it before releasing their slot)
+    if (upload_limiter_) {
+      upload_limiter_->Acquire();
+    }
+
     if (!options_.background_writes) {
       req.SetBody(std::make_shared<StringViewStream>(data, nbytes));
       auto outcome = client_->UploadPart(req);
+      if (upload_limiter_) {
+        upload_limiter_->Release();
+      }
       if (!outcome.IsSuccess()) {
         return UploadPartError(req, outcome);
       } else {
@@ -969,7 +1212,14 @@ class ObjectOutputStream final : public io::OutputStream {
 
       // If the data isn't owned, make an immutable copy for the lifetime of the closure
       if (owned_buffer == nullptr) {
-        ARROW_ASSIGN_OR_RAISE(owned_buffer, AllocateBuffer(nbytes));
+        auto maybe_buffer = AllocateBuffer(nbytes, options_.memory_pool);
+        if (!maybe_buffer.ok()) {
+          if (upload_limiter_) {
+            upload_limiter_->Release();
+          }
+          return maybe_buffer.status();
+        }
+        owned_buffer = *std::move(maybe_buffer);
         memcpy(owned_buffer->mutable_data(), data, nbytes);
       } else {
         DCHECK_EQ(data, owned_buffer->data());
@@ -978,20 +1228,26 @@ class ObjectOutputStream final : public io::OutputStream {
       req.SetBody(
           std::make_shared<StringViewStream>(owned_buffer->data(), owned_buffer->size()));
 
+      auto limiter = upload_limiter_;
       auto handler =
-          [state, owned_buffer, part_number](
+          [state, owned_buffer, part_number, limiter](
               const Aws::S3::S3Client*, const S3Model::UploadPartRequest& req,
               const S3Model::UploadPartOutcome& outcome,
               const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) -> void {
-        std::unique_lock<std::mutex> lock(state->mutex);
-        if (!outcome.IsSuccess()) {
-          state->status &= UploadPartError(req, outcome);
-        } else {
-          AddCompletedPart(state, part_number, outcome.GetResult());
+        {
+          std::unique_lock<std::mutex> lock(state->mutex);
+          if (!outcome.IsSuccess()) {
+            state->status &= UploadPartError(req, outcome);
+          } else {
+            AddCompletedPart(state, part_number, outcome.GetResult());
+          }
+          // Notify completion, regardless of success / error status
+          if (--state->parts_in_progress == 0) {
+            state->cv.notify_all();
+          }
         }
-        // Notify completion, regardless of success / error status
-        if (--state->parts_in_progress == 0) {
-          state->cv.notify_all();
+        if (limiter) {
+          limiter->Release();
         }
       };
       ++upload_state_->parts_in_progress;
@@ -1001,7 +1257,8 @@ class ObjectOutputStream final : public io::OutputStream {
     ++part_number_;
     // With up to 10000 parts in an upload (S3 limit), a stream writing chunks
     // of exactly 5MB would be limited to 50GB total.  To avoid that, we bump
-    // the upload threshold every 100 parts.  So the pattern is:
+    // the upload threshold every 100 parts.  So the pattern is (with the
+    // default part size):
     // - part 1 to 99: 5MB threshold
     // - part 100 to 199: 10MB threshold
     // - part 200 to 299: 15MB threshold
@@ -1011,7 +1268,7 @@ class ObjectOutputStream final : public io::OutputStream {
     // chunk sizes and avoiding too much buffering in the common case of a small-ish
     // stream.  If the limit's not enough, we can revisit.
     if (part_number_ % 100 == 0) {
-      part_upload_threshold_ += kMinimumPartUpload;
+      part_upload_threshold_ += part_size_;
     }
 
     return Status::OK();
@@ -1045,13 +1302,15 @@ class ObjectOutputStream final : public io::OutputStream {
   Aws::S3::S3Client* client_;
   S3Path path_;
   const S3Options& options_;
+  std::shared_ptr<UploadLimiter> upload_limiter_;
+  const int64_t part_size_;
   Aws::String upload_id_;
   bool closed_ = true;
   int64_t pos_ = 0;
   int32_t part_number_ = 1;
   std::shared_ptr<io::BufferOutputStream> current_part_;
   int64_t current_part_size_ = 0;
-  int64_t part_upload_threshold_ = kMinimumPartUpload;
+  int64_t part_upload_threshold_;
 
   // This struct is kept alive through background writes to avoid problems
   // in the completion handler.
@@ -1096,9 +1355,17 @@ class S3FileSystem::Impl {
   // Limit recursing depth, since a recursion bomb can be created
   const int32_t kMaxNestingDepth = 100;
 
+  // Shared by all output streams, if S3Options::max_concurrent_uploads is set
+  std::shared_ptr<UploadLimiter> upload_limiter_;
+
   explicit Impl(S3Options options) : builder_(std::move(options)) {}
 
-  Status Init() { return builder_.BuildClient().Value(&client_); }
+  Status Init() {
+    if (options().max_concurrent_uploads > 0) {
+      upload_limiter_ = std::make_shared<UploadLimiter>(options().max_concurrent_uploads);
+    }
+    return builder_.BuildClient().Value(&client_);
+  }
 
   const S3Options& options() const { return builder_.options(); }
 
@@ -1239,24 +1506,16 @@ class S3FileSystem::Impl {
     return Status::OK();
   }
 
-  // Recursive workhorse for GetTargetStats(FileSelector...)
-  Status Walk(const FileSelector& select, const std::string& bucket,
-              const std::string& key, std::vector<FileInfo>* out) {
-    int32_t nesting_depth = 0;
-    return Walk(select, bucket, key, nesting_depth, out);
-  }
-
-  Status Walk(const FileSelector& select, const std::string& bucket,
-              const std::string& key, int32_t nesting_depth, std::vector<FileInfo>* out) {
-    if (nesting_depth >= kMaxNestingDepth) {
-      return Status::IOError("S3 filesystem tree exceeds maximum nesting depth (",
-                             kMaxNestingDepth, ")");
-    }
-
+  // List the immediate children of a "directory", calling `page_callable`
+  // with the entries and the child directory keys of each results page.
+  template <typename PageCallable>
+  Status ListDirectory(const FileSelector& select, const std::string& bucket,
+                       const std::string& key, PageCallable&& page_callable) {
     bool is_empty = true;
-    std::vector<std::string> child_keys;
 
     auto handle_results = [&](const S3Model::ListObjectsV2Result& result) -> Status {
+      FileInfoVector infos;
+      std::vector<std::string> child_keys;
       // Walk "files"
       for (const auto& obj : result.GetContents()) {
         is_empty = false;
@@ -1270,7 +1529,7 @@ class S3FileSystem::Impl {
         child_path << bucket << kSep << child_key;
         info.set_path(child_path.str());
         FileObjectToInfo(obj, &info);
-        out->push_back(std::move(info));
+        infos.push_back(std::move(info));
       }
       // Walk "directories"
       for (const auto& prefix : result.GetCommonPrefixes()) {
@@ -1282,12 +1541,10 @@ class S3FileSystem::Impl {
         FileInfo info;
         info.set_path(ss.str());
         info.set_type(FileType::Directory);
-        out->push_back(std::move(info));
-        if (select.recursive) {
-          child_keys.emplace_back(child_key);
-        }
+        infos.push_back(std::move(info));
+        child_keys.emplace_back(child_key);
       }
-      return Status::OK();
+      return page_callable(std::move(infos), std::move(child_keys));
     };
 
     auto handle_error = [&](const AWSError<S3Errors>& error) -> Status {
@@ -1302,13 +1559,6 @@ class S3FileSystem::Impl {
     RETURN_NOT_OK(
         ListObjectsV2(bucket, key, std::move(handle_results), std::move(handle_error)));
 
-    // Recurse
-    if (select.recursive && nesting_depth < select.max_recursion) {
-      for (const auto& child_key : child_keys) {
-        RETURN_NOT_OK(Walk(select, bucket, child_key, nesting_depth + 1, out));
-      }
-    }
-
     // If no contents were found, perhaps it's an empty "directory",
     // or perhaps it's a nonexistent entry.  Check.
     if (is_empty && !select.allow_not_found) {
@@ -1320,6 +1570,135 @@ class S3FileSystem::Impl {
     return Status::OK();
   }
 
+  // Workhorse for GetFileInfoIterator(FileSelector...)
+  //
+  // Each "directory" is listed by a separate task on the IO thread pool,
+  // and subdirectory tasks are spawned as soon as a results page mentions
+  // them, so that sibling directories are listed concurrently.  Results
+  // pages are queued until the consumer asks for them.
+  class TreeListing : public std::enable_shared_from_this<TreeListing> {
+   public:
+    TreeListing(std::shared_ptr<FileSystem> fs, Impl* impl, FileSelector select)
+        : fs_(std::move(fs)), impl_(impl), select_(std::move(select)) {}
+
+    // Schedule listing the given "directory" in the background
+    void Spawn(std::string bucket, std::string key, int32_t nesting_depth) {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (cancelled_ || !status_.ok()) {
+          return;
+        }
+        ++pending_tasks_;
+      }
+      auto self = shared_from_this();
+      auto st = fs_->io_context().executor->Spawn(
+          [self, bucket, key, nesting_depth]() {
+            self->TaskFinished(self->List(bucket, key, nesting_depth));
+          });
+      if (!st.ok()) {
+        TaskFinished(st);
+      }
+    }
+
+    // Queue a batch of entries for the consumer
+    Status Push(FileInfoVector infos) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (cancelled_) {
+        return Status::Cancelled("Listing abandoned");
+      }
+      if (!infos.empty()) {
+        batches_.push_back(std::move(infos));
+        cv_.notify_all();
+      }
+      return Status::OK();
+    }
+
+    Result<FileInfoVector> Next() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock,
+               [&] { return !status_.ok() || !batches_.empty() || pending_tasks_ == 0; });
+      RETURN_NOT_OK(status_);
+      if (batches_.empty()) {
+        // Finished
+        return FileInfoVector{};
+      }
+      auto infos = std::move(batches_.front());
+      batches_.pop_front();
+      return infos;
+    }
+
+    // Stop listing, as the consumer went away
+    void Cancel() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cancelled_ = true;
+      batches_.clear();
+    }
+
+   protected:
+    Status List(const std::string& bucket, const std::string& key,
+                int32_t nesting_depth) {
+      if (nesting_depth >= impl_->kMaxNestingDepth) {
+        return Status::IOError("S3 filesystem tree exceeds maximum nesting depth (",
+                               impl_->kMaxNestingDepth, ")");
+      }
+      const bool recurse = select_.recursive && nesting_depth < select_.max_recursion;
+
+      auto handle_page = [&](FileInfoVector infos,
+                             std::vector<std::string> child_keys) -> Status {
+        RETURN_NOT_OK(Push(std::move(infos)));
+        if (recurse) {
+          for (auto& child_key : child_keys) {
+            Spawn(bucket, std::move(child_key), nesting_depth + 1);
+          }
+        }
+        return Status::OK();
+      };
+      return impl_->ListDirectory(select_, bucket, key, std::move(handle_page));
+    }
+
+    void TaskFinished(Status st) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (!st.ok() && status_.ok() && !cancelled_) {
+        status_ = std::move(st);
+      }
+      --pending_tasks_;
+      cv_.notify_all();
+    }
+
+    // Keep the filesystem (and therefore `impl_`) alive while listing
+    std::shared_ptr<FileSystem> fs_;
+    Impl* impl_;
+    const FileSelector select_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<FileInfoVector> batches_;
+    int64_t pending_tasks_ = 0;
+    bool cancelled_ = false;
+    Status status_;
+  };
+
+  // The iterator facade over a TreeListing
+  class TreeListingIterator {
+   public:
+    explicit TreeListingIterator(std::shared_ptr<TreeListing> listing)
+        : listing_(std::move(listing)) {}
+
+    TreeListingIterator(TreeListingIterator&&) = default;
+    TreeListingIterator& operator=(TreeListingIterator&&) = default;
+
+    ~TreeListingIterator() {
+      if (listing_) {
+        listing_->Cancel();
+      }
+    }
+
+    Result<FileInfoVector> Next() { return listing_->Next(); }
+
+   private:
+    std::shared_ptr<TreeListing> listing_;
+  };
+
   Status WalkForDeleteDir(const std::string& bucket, const std::string& key,
                           std::vector<std::string>* file_keys,
                           std::vector<std::string>* dir_keys) {
@@ -1452,8 +1831,8 @@ class S3FileSystem::Impl {
     ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(s));
     RETURN_NOT_OK(ValidateFilePath(path));
 
-    auto ptr =
-        std::make_shared<ObjectInputFile>(fs->shared_from_this(), client_.get(), path);
+    auto ptr = std::make_shared<ObjectInputFile>(fs->shared_from_this(), client_.get(),
+                                                 path, options());
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -1471,20 +1850,22 @@ class S3FileSystem::Impl {
     RETURN_NOT_OK(ValidateFilePath(path));
 
     auto ptr = std::make_shared<ObjectInputFile>(fs->shared_from_this(), client_.get(),
-                                                 path, info.size());
+                                                 path, options(), info.size());
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
 };
 
-S3FileSystem::S3FileSystem(const S3Options& options) : impl_(new Impl{options}) {}
+S3FileSystem::S3FileSystem(const S3Options& options, const io::AsyncContext& io_context)
+    : FileSystem(io_context), impl_(new Impl{options}) {}
 
 S3FileSystem::~S3FileSystem() {}
 
-Result<std::shared_ptr<S3FileSystem>> S3FileSystem::Make(const S3Options& options) {
+Result<std::shared_ptr<S3FileSystem>> S3FileSystem::Make(
+    const S3Options& options, const io::AsyncContext& io_context) {
   RETURN_NOT_OK(CheckS3Initialized());
 
-  std::shared_ptr<S3FileSystem> ptr(new S3FileSystem(options));
+  std::shared_ptr<S3FileSystem> ptr(new S3FileSystem(options, io_context));
   RETURN_NOT_OK(ptr->impl_->Init());
   return ptr;
 }
@@ -1570,29 +1951,49 @@ Result<FileInfo> S3FileSystem::GetFileInfo(const std::string& s) {
 }
 
 Result<std::vector<FileInfo>> S3FileSystem::GetFileInfo(const FileSelector& select) {
-  ARROW_ASSIGN_OR_RAISE(auto base_path, S3Path::FromString(select.base_dir));
-
   std::vector<FileInfo> results;
+  auto it = GetFileInfoIterator(select);
+  RETURN_NOT_OK(it.Visit([&](FileInfoVector infos) {
+    std::move(infos.begin(), infos.end(), std::back_inserter(results));
+    return Status::OK();
+  }));
+  return results;
+}
+
+FileInfoIterator S3FileSystem::GetFileInfoIterator(const FileSelector& select) {
+  auto maybe_base_path = S3Path::FromString(select.base_dir);
+  if (!maybe_base_path.ok()) {
+    return MakeErrorIterator<FileInfoVector>(maybe_base_path.status());
+  }
+  const auto& base_path = *maybe_base_path;
+  auto listing =
+      std::make_shared<Impl::TreeListing>(shared_from_this(), impl_.get(), select);
 
   if (base_path.empty()) {
     // List all buckets
     std::vector<std::string> buckets;
-    RETURN_NOT_OK(impl_->ListBuckets(&buckets));
+    auto st = impl_->ListBuckets(&buckets);
+    if (!st.ok()) {
+      return MakeErrorIterator<FileInfoVector>(std::move(st));
+    }
+    FileInfoVector infos;
     for (const auto& bucket : buckets) {
       FileInfo info;
       info.set_path(bucket);
       info.set_type(FileType::Directory);
-      results.push_back(std::move(info));
-      if (select.recursive) {
-        RETURN_NOT_OK(impl_->Walk(select, bucket, "", &results));
+      infos.push_back(std::move(info));
+    }
+    DCHECK_OK(listing->Push(std::move(infos)));
+    if (select.recursive) {
+      for (const auto& bucket : buckets) {
+        listing->Spawn(bucket, "", /*nesting_depth=*/0);
       }
     }
-    return results;
+  } else {
+    // Nominal case -> walk a single bucket
+    listing->Spawn(base_path.bucket, base_path.key, /*nesting_depth=*/0);
   }
-
-  // Nominal case -> walk a single bucket
-  RETURN_NOT_OK(impl_->Walk(select, base_path.bucket, base_path.key, &results));
-  return results;
+  return FileInfoIterator(Impl::TreeListingIterator(std::move(listing)));
 }
 
 Status S3FileSystem::CreateDir(const std::string& s, bool recursive) {
@@ -1755,8 +2156,9 @@ Result<std::shared_ptr<io::OutputStream>> S3FileSystem::OpenOutputStream(
   ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(s));
   RETURN_NOT_OK(ValidateFilePath(path));
 
-  auto ptr = std::make_shared<ObjectOutputStream>(
-      shared_from_this(), impl_->client_.get(), path, impl_->options());
+  auto ptr =
+      std::make_shared<ObjectOutputStream>(shared_from_this(), impl_->client_.get(), path,
+                                           impl_->options(), impl_->upload_limiter_);
   RETURN_NOT_OK(ptr->Init());
   return ptr;
 }
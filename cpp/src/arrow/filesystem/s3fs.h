@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "arrow/filesystem/filesystem.h"
+#include "arrow/memory_pool.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/uri.h"
 
@@ -72,6 +73,24 @@ struct ARROW_EXPORT S3Options {
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
 
+  /// Size of the parts uploaded by OutputStreams.  Values smaller than 5 MiB
+  /// (the S3 minimum) are rounded up.  The part size is increased after every
+  /// 100 parts, so that large objects don't hit the limit of 10000 parts.
+  int64_t write_part_size = 5 * 1024 * 1024;
+  /// Maximum number of part uploads in flight at any time, across all
+  /// OutputStreams of the filesystem.  When the limit is reached, writes
+  /// block until an upload finishes.  Zero means no limit.
+  int max_concurrent_uploads = 0;
+  /// Memory pool used to allocate the parts buffered by OutputStreams.
+  MemoryPool* memory_pool = default_memory_pool();
+
+  /// Reads larger than this are split into several ranged GET requests of
+  /// at most this size, which are issued concurrently.  A single HTTP stream
+  /// often cannot saturate the available bandwidth.  Zero disables splitting.
+  int64_t read_part_size = 8 * 1024 * 1024;
+  /// Maximum number of concurrent GET requests issued for a single read.
+  int read_parallelism = 8;
+
   /// Configure with the default AWS credentials provider chain.
   void ConfigureDefaultCredentials();
 
@@ -148,6 +167,7 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
   /// \endcond
   Result<FileInfo> GetFileInfo(const std::string& path) override;
   Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) override;
+  FileInfoIterator GetFileInfoIterator(const FileSelector& select) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
@@ -176,7 +196,10 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
 
   /// Create a random access file for reading from a S3 object.
   ///
-  /// See OpenInputStream for performance notes.
+  /// See OpenInputStream for performance notes.  Large reads are split
+  /// according to S3Options.read_part_size and S3Options.read_parallelism.
+  /// ReadAsync() is served by the AWS SDK's asynchronous client, without
+  /// blocking a thread while waiting for the response.
   Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
       const std::string& path) override;
   /// Create a random access file for reading from a S3 object.
@@ -199,10 +222,11 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
       const std::string& path) override;
 
   /// Create a S3FileSystem instance from the given options.
-  static Result<std::shared_ptr<S3FileSystem>> Make(const S3Options& options);
+  static Result<std::shared_ptr<S3FileSystem>> Make(
+      const S3Options& options, const io::AsyncContext& io_context = io::AsyncContext());
 
  protected:
-  explicit S3FileSystem(const S3Options& options);
+  S3FileSystem(const S3Options& options, const io::AsyncContext& io_context);
 
   class Impl;
   std::unique_ptr<Impl> impl_;
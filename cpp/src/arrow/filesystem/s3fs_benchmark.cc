@@ -106,8 +106,9 @@ class MinioFixture : public benchmark::Fixture {
     }
   }
 
-  void MakeFileSystem() {
+  void MakeFileSystem(int64_t read_part_size = S3Options().read_part_size) {
     options_.ConfigureAccessKey(minio_->access_key(), minio_->secret_key());
+    options_.read_part_size = read_part_size;
     options_.scheme = "http";
     if (!region_.empty()) {
       options_.region = region_;
@@ -368,6 +369,18 @@ BENCHMARK_DEFINE_F(MinioFixture, ReadAll500Mib)(benchmark::State& st) {
 }
 BENCHMARK_REGISTER_F(MinioFixture, ReadAll500Mib)->UseRealTime();
 
+// Same as above, with each read issued as a single GET request
+BENCHMARK_DEFINE_F(MinioFixture, ReadAllUnsplit100Mib)(benchmark::State& st) {
+  MakeFileSystem(/*read_part_size=*/0);
+  NaiveRead(st, fs_.get(), bucket_ + "/bytes_100mib");
+}
+BENCHMARK_REGISTER_F(MinioFixture, ReadAllUnsplit100Mib)->UseRealTime();
+BENCHMARK_DEFINE_F(MinioFixture, ReadAllUnsplit500Mib)(benchmark::State& st) {
+  MakeFileSystem(/*read_part_size=*/0);
+  NaiveRead(st, fs_.get(), bucket_ + "/bytes_500mib");
+}
+BENCHMARK_REGISTER_F(MinioFixture, ReadAllUnsplit500Mib)->UseRealTime();
+
 BENCHMARK_DEFINE_F(MinioFixture, ReadChunked100Mib)(benchmark::State& st) {
   ChunkedRead(st, fs_.get(), bucket_ + "/bytes_100mib");
 }
@@ -68,6 +68,7 @@
 #include "arrow/filesystem/s3_test_util.h"
 #include "arrow/filesystem/s3fs.h"
 #include "arrow/filesystem/test_util.h"
+#include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
@@ -851,6 +852,55 @@ TEST_F(TestS3FS, OpenInputFile) {
   ASSERT_RAISES(IOError, file->Seek(10));
 }
 
+TEST_F(TestS3FS, OpenInputFileSplitReads) {
+  // Split reads into tiny parts
+  options_.read_part_size = 2;
+  options_.read_parallelism = 3;
+  MakeFileSystem();
+
+  std::shared_ptr<io::RandomAccessFile> file;
+  std::shared_ptr<Buffer> buf;
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("bucket/somefile"));
+
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(0, 9));
+  AssertBufferEqual(*buf, "some data");
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(1, 5));
+  AssertBufferEqual(*buf, "ome d");
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(5, 20));
+  AssertBufferEqual(*buf, "data");
+  ASSERT_OK_AND_ASSIGN(buf, file->Read(7));
+  AssertBufferEqual(*buf, "some da");
+
+  char result[10];
+  ASSERT_OK_AND_EQ(7, file->ReadAt(2, 20, &result));
+  ASSERT_EQ(std::string(result, 7), "me data");
+}
+
+TEST_F(TestS3FS, OpenInputFileReadAsync) {
+  for (const int64_t part_size : {int64_t(0), int64_t(3)}) {
+    options_.read_part_size = part_size;
+    MakeFileSystem();
+
+    std::shared_ptr<io::RandomAccessFile> file;
+    ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("bucket/somefile"));
+
+    auto fut1 = file->ReadAsync({}, 1, 7);
+    auto fut2 = file->ReadAsync({}, 5, 20);
+    auto fut3 = file->ReadAsync({}, 9, 20);
+    ASSERT_OK_AND_ASSIGN(auto buf, fut1.result());
+    AssertBufferEqual(*buf, "ome dat");
+    ASSERT_OK_AND_ASSIGN(buf, fut2.result());
+    AssertBufferEqual(*buf, "data");
+    ASSERT_OK_AND_ASSIGN(buf, fut3.result());
+    AssertBufferEqual(*buf, "");
+
+    // Reading past end of file
+    ASSERT_RAISES(IOError, file->ReadAsync({}, 10, 20).result());
+    ASSERT_OK(file->Close());
+    ASSERT_RAISES(Invalid, file->ReadAsync({}, 0, 4).result());
+  }
+}
+
 TEST_F(TestS3FS, OpenOutputStreamBackgroundWrites) { TestOpenOutputStream(); }
 
 TEST_F(TestS3FS, OpenOutputStreamSyncWrites) {
@@ -859,6 +909,40 @@ TEST_F(TestS3FS, OpenOutputStreamSyncWrites) {
   TestOpenOutputStream();
 }
 
+TEST_F(TestS3FS, OpenOutputStreamUploadLimits) {
+  ProxyMemoryPool pool(default_memory_pool());
+  options_.write_part_size = 6 * 1024 * 1024;
+  options_.max_concurrent_uploads = 2;
+  options_.memory_pool = &pool;
+  MakeFileSystem();
+  TestOpenOutputStream();
+
+  // Several streams with large writes sharing the upload limit
+  const int kNumStreams = 4;
+  std::vector<std::shared_ptr<io::OutputStream>> streams;
+  std::vector<std::string> expected(kNumStreams);
+  for (int i = 0; i < kNumStreams; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto stream,
+                         fs_->OpenOutputStream("bucket/limited" + std::to_string(i)));
+    streams.push_back(stream);
+  }
+  for (int j = 0; j < 3; ++j) {
+    for (int i = 0; i < kNumStreams; ++i) {
+      auto data = random_string(4000000, /*seed=*/i * 10 + j);
+      ASSERT_OK(streams[i]->Write(data));
+      expected[i] += data;
+    }
+  }
+  ASSERT_GT(pool.bytes_allocated(), 0);
+  for (int i = 0; i < kNumStreams; ++i) {
+    ASSERT_OK(streams[i]->Close());
+    AssertObjectContents(client_.get(), "bucket", "limited" + std::to_string(i),
+                         expected[i]);
+  }
+  streams.clear();
+  ASSERT_EQ(pool.bytes_allocated(), 0);
+}
+
 TEST_F(TestS3FS, OpenOutputStreamAbortBackgroundWrites) { TestOpenOutputStreamAbort(); }
 
 TEST_F(TestS3FS, OpenOutputStreamAbortSyncWrites) {
@@ -920,6 +920,77 @@ void GenericFileSystemTest::TestOpenInputFileWithFileInfo(FileSystem* fs) {
   ASSERT_RAISES(IOError, fs->OpenInputFile(info));
 }
 
+void GetSortedInfosFromIterator(FileSystem* fs, FileSelector s,
+                                std::vector<FileInfo>& infos) {
+  infos.clear();
+  auto it = fs->GetFileInfoIterator(s);
+  ASSERT_OK(it.Visit([&](FileInfoVector batch) {
+    EXPECT_FALSE(batch.empty());
+    for (auto& info : batch) {
+      // Clear mtime & size for easier testing.
+      info.set_mtime(kNoTime);
+      info.set_size(kNoSize);
+      infos.push_back(std::move(info));
+    }
+    return Status::OK();
+  }));
+  SortInfos(&infos);
+}
+
+void GenericFileSystemTest::TestGetFileInfoIterator(FileSystem* fs) {
+  ASSERT_OK(fs->CreateDir("01/02/03"));
+  ASSERT_OK(fs->CreateDir("AA"));
+  CreateFile(fs, "00.file", "00");
+  CreateFile(fs, "01/01.file", "01");
+  CreateFile(fs, "AA/AA.file", "aa");
+  CreateFile(fs, "01/02/02.file", "02");
+  CreateFile(fs, "01/02/03/03.file", "03");
+
+  std::vector<FileInfo> infos;
+  FileSelector s;
+
+  s.base_dir = "";
+  s.recursive = false;
+  GetSortedInfosFromIterator(fs, s, infos);
+  EXPECT_THAT(infos, ElementsAre(File("00.file"), Dir("01"), Dir("AA")));
+
+  s.recursive = true;
+  s.max_recursion = 1;
+  GetSortedInfosFromIterator(fs, s, infos);
+  EXPECT_THAT(infos, ElementsAre(File("00.file"), Dir("01"), File("01/01.file"),
+                                 Dir("01/02"), Dir("AA"), File("AA/AA.file")));
+
+  s.max_recursion = INT32_MAX;
+  GetSortedInfosFromIterator(fs, s, infos);
+  EXPECT_THAT(infos, ElementsAre(File("00.file"), Dir("01"), File("01/01.file"),
+                                 Dir("01/02"), File("01/02/02.file"), Dir("01/02/03"),
+                                 File("01/02/03/03.file"), Dir("AA"),
+                                 File("AA/AA.file")));
+
+  s.base_dir = "01/02";
+  GetSortedInfosFromIterator(fs, s, infos);
+  EXPECT_THAT(infos, ElementsAre(File("01/02/02.file"), Dir("01/02/03"),
+                                 File("01/02/03/03.file")));
+
+  // Abandoning the iterator before the end
+  s.base_dir = "";
+  {
+    auto it = fs->GetFileInfoIterator(s);
+    ASSERT_OK_AND_ASSIGN(auto batch, it.Next());
+    ASSERT_FALSE(batch.empty());
+  }
+
+  // Nonexistent base directory
+  s.base_dir = "XX";
+  {
+    auto it = fs->GetFileInfoIterator(s);
+    ASSERT_RAISES(IOError, it.Next());
+  }
+  s.allow_not_found = true;
+  GetSortedInfosFromIterator(fs, s, infos);
+  ASSERT_EQ(infos.size(), 0);
+}
+
 #define GENERIC_FS_TEST_DEFINE(FUNC_NAME) \
   void GenericFileSystemTest::FUNC_NAME() { FUNC_NAME(GetEmptyFileSystem().get()); }
 
@@ -938,6 +1009,7 @@ GENERIC_FS_TEST_DEFINE(TestGetFileInfo)
 GENERIC_FS_TEST_DEFINE(TestGetFileInfoVector)
 GENERIC_FS_TEST_DEFINE(TestGetFileInfoSelector)
 GENERIC_FS_TEST_DEFINE(TestGetFileInfoSelectorWithRecursion)
+GENERIC_FS_TEST_DEFINE(TestGetFileInfoIterator)
 GENERIC_FS_TEST_DEFINE(TestOpenOutputStream)
 GENERIC_FS_TEST_DEFINE(TestOpenAppendStream)
 GENERIC_FS_TEST_DEFINE(TestOpenInputStream)
@@ -20,11 +20,18 @@
 // Platform-specific defines
 #include "arrow/flight/platform.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 
@@ -46,6 +53,7 @@
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/uri.h"
 
@@ -55,6 +63,7 @@
 #include "arrow/flight/middleware.h"
 #include "arrow/flight/middleware_internal.h"
 #include "arrow/flight/serialization_internal.h"
+#include "arrow/flight/shared_memory_internal.h"
 #include "arrow/flight/types.h"
 
 namespace pb = arrow::flight::protocol;
@@ -68,7 +77,14 @@ const char* kWriteSizeDetailTypeId = "flight::FlightWriteSizeStatusDetail";
 FlightCallOptions::FlightCallOptions()
     : timeout(-1),
       read_options(ipc::IpcReadOptions::Defaults()),
-      write_options(ipc::IpcWriteOptions::Defaults()) {}
+      write_options(ipc::IpcWriteOptions::Defaults()),
+      accept_dictionary_deltas(true) {
+  for (const auto compression : {Compression::ZSTD, Compression::LZ4_FRAME}) {
+    if (util::Codec::IsAvailable(compression)) {
+      accepted_compression.push_back(compression);
+    }
+  }
+}
 
 const char* FlightWriteSizeStatusDetail::type_id() const {
   return kWriteSizeDetailTypeId;
@@ -90,10 +106,17 @@ std::shared_ptr<FlightWriteSizeStatusDetail> FlightWriteSizeStatusDetail::Unwrap
 }
 
 FlightClientOptions::FlightClientOptions()
-    : write_size_limit_bytes(0), disable_server_verification(false) {}
+    : write_size_limit_bytes(0), disable_server_verification(false), num_channels(1) {}
 
 FlightClientOptions FlightClientOptions::Defaults() { return FlightClientOptions(); }
 
+FlightMultiStreamOptions::FlightMultiStreamOptions()
+    : ordered(true), max_concurrent_streams(16), max_buffered_messages(4) {}
+
+FlightMultiStreamOptions FlightMultiStreamOptions::Defaults() {
+  return FlightMultiStreamOptions();
+}
+
 struct ClientRpc {
   grpc::ClientContext context;
 
@@ -104,6 +127,20 @@ struct ClientRpc {
               std::chrono::system_clock::now() + options.timeout);
       context.set_deadline(deadline);
     }
+    // Advertise the IPC features we accept for data sent by the server
+    if (!options.accepted_compression.empty()) {
+      std::string codecs;
+      for (const auto compression : options.accepted_compression) {
+        if (!codecs.empty()) {
+          codecs += ",";
+        }
+        codecs += util::Codec::GetCodecAsString(compression);
+      }
+      context.AddMetadata(internal::kIpcAcceptCompressionHeader, codecs);
+    }
+    if (options.accept_dictionary_deltas) {
+      context.AddMetadata(internal::kIpcAcceptDictionaryDeltasHeader, "1");
+    }
   }
 
   /// \brief Add an auth token via an auth handler
@@ -115,6 +152,51 @@ struct ClientRpc {
     }
     return Status::OK();
   }
+
+  /// \brief Offer the server a shared memory segment for message bodies
+  void OfferSharedMemory() {
+    auto maybe_reader = internal::SharedMemoryBodyReader::Create();
+    if (!maybe_reader.ok()) {
+      // Bodies will be sent over gRPC
+      ARROW_LOG(DEBUG) << "Not using shared memory: " << maybe_reader.status();
+      return;
+    }
+    shm_reader = maybe_reader.MoveValueUnsafe();
+    context.AddMetadata(internal::kShmSegmentHeader, shm_reader->name());
+  }
+
+  /// \brief Map the message body from shared memory, if the server wrote
+  /// it there
+  ///
+  /// Must be called for every message read, in order.
+  Status ResolveBody(internal::FlightData* data) {
+    if (!shm_reader) {
+      return Status::OK();
+    }
+    if (!shm_accepted) {
+      // The server's answer comes with the first message
+      const auto& server_metadata = context.GetServerInitialMetadata();
+      if (server_metadata.find(internal::kShmBodiesHeader) == server_metadata.end()) {
+        shm_reader.reset();
+        return Status::OK();
+      }
+      // The server has the segment open, its name isn't needed anymore
+      shm_reader->Unlink();
+      shm_accepted = true;
+    }
+    if (!data->body_chunks.empty()) {
+      // A body reference is tiny, but may still straddle gRPC slices
+      ARROW_ASSIGN_OR_RAISE(data->body, ConcatenateBuffers(data->body_chunks));
+      data->body_chunks.clear();
+    }
+    if (data->body && data->body->size() > 0) {
+      return shm_reader->Resolve(&data->body);
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<internal::SharedMemoryBodyReader> shm_reader;
+  bool shm_accepted = false;
 };
 
 /// Helper that manages Finish() of a gRPC stream.
@@ -450,6 +532,10 @@ class GrpcIpcMessageReader : public ipc::MessageReader {
       stream_finished_ = true;
       return stream_->Finish(Status::OK());
     }
+    auto status = rpc_->ResolveBody(data);
+    if (!status.ok()) {
+      return stream_->Finish(std::move(status));
+    }
     // Validate IPC message
     auto result = data->OpenMessage();
     if (!result.ok()) {
@@ -843,6 +929,263 @@ class GrpcMetadataReader : public FlightMetadataReader {
   std::shared_ptr<std::mutex> read_mutex_;
 };
 
+// A FlightStreamReader that reads the streams of several endpoints on
+// background threads, merging them into a single stream
+class MultiEndpointStreamReader : public FlightStreamReader {
+ public:
+  // Get a client for a location
+  using ClientGetter =
+      std::function<Status(const Location&, std::shared_ptr<FlightClient>*)>;
+
+  MultiEndpointStreamReader(FlightClient* client, ClientGetter get_client,
+                            const FlightMultiStreamOptions& options,
+                            const FlightInfo& info)
+      : client_(client),
+        get_client_(std::move(get_client)),
+        options_(options),
+        endpoints_(info.endpoints()),
+        streams_(endpoints_.size()) {
+    if (endpoints_.empty()) {
+      // No stream to take the schema from
+      ipc::DictionaryMemo dictionary_memo;
+      status_ = info.GetSchema(&dictionary_memo, &schema_);
+    }
+  }
+
+  ~MultiEndpointStreamReader() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      StopUnlocked();
+    }
+    cv_.notify_all();
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  void Start() {
+    const auto num_endpoints = static_cast<int32_t>(endpoints_.size());
+    int32_t num_threads = options_.max_concurrent_streams;
+    if (num_threads <= 0 || num_threads > num_endpoints) {
+      num_threads = num_endpoints;
+    }
+    for (int32_t i = 0; i < num_threads; ++i) {
+      threads_.emplace_back([this] { WorkerLoop(); });
+    }
+  }
+
+  arrow::Result<std::shared_ptr<Schema>> GetSchema() override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] {
+      return schema_ != nullptr || stopped_ || num_finished_ == streams_.size();
+    });
+    RETURN_NOT_OK(CheckStatusUnlocked());
+    if (schema_ == nullptr) {
+      return MakeFlightError(FlightStatusCode::Internal,
+                             "No schema received from Flight endpoints");
+    }
+    return schema_;
+  }
+
+  Status Next(FlightStreamChunk* out) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      RETURN_NOT_OK(CheckStatusUnlocked());
+      if (options_.ordered) {
+        while (next_stream_ < streams_.size() && streams_[next_stream_].finished &&
+               streams_[next_stream_].chunks.empty()) {
+          ++next_stream_;
+        }
+        if (next_stream_ < streams_.size() && PopChunk(next_stream_, out)) {
+          break;
+        }
+      } else {
+        // Round-robin between streams, for fairness
+        bool found = false;
+        for (size_t i = 0; i < streams_.size() && !found; ++i) {
+          next_stream_ = (next_stream_ + 1) % streams_.size();
+          found = PopChunk(next_stream_, out);
+        }
+        if (found) {
+          break;
+        }
+      }
+      if (num_finished_ == streams_.size()) {
+        // All streams exhausted
+        out->data = nullptr;
+        out->app_metadata = nullptr;
+        break;
+      }
+      cv_.wait(lock);
+    }
+    lock.unlock();
+    cv_.notify_all();
+    return Status::OK();
+  }
+
+  void Cancel() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!stopped_) {
+        cancelled_ = true;
+        StopUnlocked();
+      }
+    }
+    cv_.notify_all();
+  }
+
+ private:
+  struct EndpointStream {
+    std::deque<FlightStreamChunk> chunks;
+    // The reader for this endpoint, while it is being read
+    FlightStreamReader* reader = nullptr;
+    bool finished = false;
+  };
+
+  Status CheckStatusUnlocked() const {
+    if (cancelled_) {
+      return MakeFlightError(FlightStatusCode::Cancelled, "DoGet was cancelled");
+    }
+    return status_;
+  }
+
+  bool PopChunk(size_t index, FlightStreamChunk* out) {
+    auto& chunks = streams_[index].chunks;
+    if (chunks.empty()) {
+      return false;
+    }
+    *out = std::move(chunks.front());
+    chunks.pop_front();
+    return true;
+  }
+
+  // Stop all workers, interrupting any blocking read
+  void StopUnlocked() {
+    stopped_ = true;
+    for (auto& stream : streams_) {
+      if (stream.reader != nullptr) {
+        stream.reader->Cancel();
+      }
+    }
+  }
+
+  void WorkerLoop() {
+    while (true) {
+      size_t index;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // Endpoints are claimed in order, so that in ordered mode the
+        // endpoint being consumed is always being read
+        if (stopped_ || next_endpoint_ == endpoints_.size()) {
+          return;
+        }
+        index = next_endpoint_++;
+      }
+      // The client is kept alive while its stream is being read
+      std::shared_ptr<FlightClient> client;
+      std::unique_ptr<FlightStreamReader> reader;
+      auto st = ReadEndpoint(index, &client, &reader);
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        streams_[index].reader = nullptr;
+        streams_[index].finished = true;
+        ++num_finished_;
+        // Errors after stopping are most likely caused by cancellation
+        if (!st.ok() && !stopped_) {
+          status_ = std::move(st);
+          StopUnlocked();
+        }
+      }
+      cv_.notify_all();
+    }
+  }
+
+  Status OpenEndpoint(const FlightEndpoint& endpoint,
+                      std::shared_ptr<FlightClient>* client,
+                      std::unique_ptr<FlightStreamReader>* out) {
+    if (endpoint.locations.empty()) {
+      return client_->DoGet(options_.call_options, endpoint.ticket, out);
+    }
+    // Try each location in turn
+    Status st;
+    for (const auto& location : endpoint.locations) {
+      st = get_client_(location, client);
+      if (st.ok()) {
+        st = (*client)->DoGet(options_.call_options, endpoint.ticket, out);
+      }
+      if (st.ok()) {
+        break;
+      }
+    }
+    return st;
+  }
+
+  // Read an endpoint into its buffer.  `reader` is owned by the caller, so
+  // that it is only destroyed once unregistered.
+  Status ReadEndpoint(size_t index, std::shared_ptr<FlightClient>* client,
+                      std::unique_ptr<FlightStreamReader>* out) {
+    RETURN_NOT_OK(OpenEndpoint(endpoints_[index], client, out));
+    FlightStreamReader* reader = out->get();
+    ARROW_ASSIGN_OR_RAISE(auto schema, reader->GetSchema());
+    auto& stream = streams_[index];
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_) {
+        reader->Cancel();
+        return Status::OK();
+      }
+      if (schema_ == nullptr) {
+        schema_ = schema;
+      } else if (!schema_->Equals(*schema)) {
+        return Status::Invalid("Flight endpoint #", index,
+                               " returned a different schema than other endpoints");
+      }
+      stream.reader = reader;
+    }
+    cv_.notify_all();
+
+    const size_t max_buffered =
+        static_cast<size_t>(std::max<int32_t>(1, options_.max_buffered_messages));
+    while (true) {
+      FlightStreamChunk chunk;
+      RETURN_NOT_OK(reader->Next(&chunk));
+      if (chunk.data == nullptr && chunk.app_metadata == nullptr) {
+        return Status::OK();
+      }
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [&] { return stopped_ || stream.chunks.size() < max_buffered; });
+        if (stopped_) {
+          return Status::OK();
+        }
+        stream.chunks.push_back(std::move(chunk));
+      }
+      cv_.notify_all();
+    }
+  }
+
+  FlightClient* client_;
+  ClientGetter get_client_;
+  const FlightMultiStreamOptions options_;
+  const std::vector<FlightEndpoint> endpoints_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<EndpointStream> streams_;
+  std::vector<std::thread> threads_;
+  std::shared_ptr<Schema> schema_;
+  Status status_;
+  // The next endpoint for workers to read
+  size_t next_endpoint_ = 0;
+  // The number of endpoints read to completion (or abandoned)
+  size_t num_finished_ = 0;
+  // The stream the consumer reads from next (ordered mode), or the stream
+  // it last read from (unordered mode)
+  size_t next_stream_ = 0;
+  bool stopped_ = false;
+  bool cancelled_ = false;
+};
+
 namespace {
 // Dummy self-signed certificate to be used because TlsCredentials
 // requires root CA certs, even if you are skipping server
@@ -871,6 +1214,8 @@ constexpr char BLANK_ROOT_PEM[] =
 class FlightClient::FlightClientImpl {
  public:
   Status Connect(const Location& location, const FlightClientOptions& options) {
+    location_ = location;
+    options_ = options;
     const std::string& scheme = location.scheme();
 
     std::stringstream grpc_uri;
@@ -924,9 +1269,10 @@ class FlightClient::FlightClientImpl {
       } else {
         creds = grpc::InsecureChannelCredentials();
       }
-    } else if (scheme == kSchemeGrpcUnix) {
+    } else if (scheme == kSchemeGrpcUnix || scheme == kSchemeGrpcShm) {
       grpc_uri << "unix://" << location.uri_->path();
       creds = grpc::InsecureChannelCredentials();
+      shared_memory_ = scheme == kSchemeGrpcShm;
     } else {
       return Status::NotImplemented("Flight scheme " + scheme + " is not supported.");
     }
@@ -961,25 +1307,37 @@ class FlightClient::FlightClientImpl {
       args.SetInt(pair.first, pair.second);
     }
 
-    std::vector<std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
-        interceptors;
-    interceptors.emplace_back(
-        new GrpcClientInterceptorAdapterFactory(std::move(options.middleware)));
-
-    stub_ = pb::FlightService::NewStub(
-        grpc::experimental::CreateCustomChannelWithInterceptors(
-            grpc_uri.str(), creds, args, std::move(interceptors)));
+    // Since subchannels aren't shared, each channel opens its own connection
+    const int num_channels = std::max(1, options.num_channels);
+    for (int i = 0; i < num_channels; ++i) {
+      std::vector<std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
+          interceptors;
+      interceptors.emplace_back(
+          new GrpcClientInterceptorAdapterFactory(options.middleware));
+
+      stubs_.push_back(pb::FlightService::NewStub(
+          grpc::experimental::CreateCustomChannelWithInterceptors(
+              grpc_uri.str(), creds, args, std::move(interceptors))));
+    }
 
     write_size_limit_bytes_ = options.write_size_limit_bytes;
     return Status::OK();
   }
 
+  // Get a stub for a new call, spreading calls over the channels
+  pb::FlightService::Stub* stub() {
+    if (stubs_.size() == 1) {
+      return stubs_[0].get();
+    }
+    return stubs_[next_stub_++ % stubs_.size()].get();
+  }
+
   Status Authenticate(const FlightCallOptions& options,
                       std::unique_ptr<ClientAuthHandler> auth_handler) {
     auth_handler_ = std::move(auth_handler);
     ClientRpc rpc(options);
     std::shared_ptr<grpc::ClientReaderWriter<pb::HandshakeRequest, pb::HandshakeResponse>>
-        stream = stub_->Handshake(&rpc.context);
+        stream = stub()->Handshake(&rpc.context);
     GrpcClientAuthSender outgoing{stream};
     GrpcClientAuthReader incoming{stream};
     RETURN_NOT_OK(auth_handler_->Authenticate(&outgoing, &incoming));
@@ -1001,7 +1359,7 @@ class FlightClient::FlightClientImpl {
     ClientRpc rpc(options);
     RETURN_NOT_OK(rpc.SetToken(auth_handler_.get()));
     std::unique_ptr<grpc::ClientReader<pb::FlightInfo>> stream(
-        stub_->ListFlights(&rpc.context, pb_criteria));
+        stub()->ListFlights(&rpc.context, pb_criteria));
 
     std::vector<FlightInfo> flights;
 
@@ -1024,7 +1382,7 @@ class FlightClient::FlightClientImpl {
     ClientRpc rpc(options);
     RETURN_NOT_OK(rpc.SetToken(auth_handler_.get()));
     std::unique_ptr<grpc::ClientReader<pb::Result>> stream(
-        stub_->DoAction(&rpc.context, pb_action));
+        stub()->DoAction(&rpc.context, pb_action));
 
     pb::Result pb_result;
 
@@ -1046,7 +1404,7 @@ class FlightClient::FlightClientImpl {
     ClientRpc rpc(options);
     RETURN_NOT_OK(rpc.SetToken(auth_handler_.get()));
     std::unique_ptr<grpc::ClientReader<pb::ActionType>> stream(
-        stub_->ListActions(&rpc.context, empty));
+        stub()->ListActions(&rpc.context, empty));
 
     pb::ActionType pb_type;
     ActionType type;
@@ -1068,7 +1426,7 @@ class FlightClient::FlightClientImpl {
     ClientRpc rpc(options);
     RETURN_NOT_OK(rpc.SetToken(auth_handler_.get()));
     Status s = internal::FromGrpcStatus(
-        stub_->GetFlightInfo(&rpc.context, pb_descriptor, &pb_response), &rpc.context);
+        stub()->GetFlightInfo(&rpc.context, pb_descriptor, &pb_response), &rpc.context);
     RETURN_NOT_OK(s);
 
     FlightInfo::Data info_data;
@@ -1087,7 +1445,7 @@ class FlightClient::FlightClientImpl {
     ClientRpc rpc(options);
     RETURN_NOT_OK(rpc.SetToken(auth_handler_.get()));
     Status s = internal::FromGrpcStatus(
-        stub_->GetSchema(&rpc.context, pb_descriptor, &pb_response), &rpc.context);
+        stub()->GetSchema(&rpc.context, pb_descriptor, &pb_response), &rpc.context);
     RETURN_NOT_OK(s);
 
     std::string str;
@@ -1104,8 +1462,11 @@ class FlightClient::FlightClientImpl {
 
     auto rpc = std::make_shared<ClientRpc>(options);
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
+    if (shared_memory_) {
+      rpc->OfferSharedMemory();
+    }
     std::shared_ptr<grpc::ClientReader<pb::FlightData>> stream =
-        stub_->DoGet(&rpc->context, pb_ticket);
+        stub()->DoGet(&rpc->context, pb_ticket);
     auto finishable_stream = std::make_shared<
         FinishableStream<grpc::ClientReader<pb::FlightData>, internal::FlightData>>(
         rpc, stream);
@@ -1115,6 +1476,24 @@ class FlightClient::FlightClientImpl {
     return static_cast<StreamReader*>(out->get())->EnsureDataStarted();
   }
 
+  // Get a client for the given location: either `self`, or a client
+  // from the pool, connecting it if necessary
+  Status GetPooledClient(FlightClient* self, const Location& location,
+                         std::shared_ptr<FlightClient>* out) {
+    if (location.Equals(location_)) {
+      // Non-owning pointer
+      *out = std::shared_ptr<FlightClient>(std::shared_ptr<FlightClient>(), self);
+      return Status::OK();
+    }
+    {
+      std::lock_guard<std::mutex> lock(pool_mutex_);
+      if (pool_ == nullptr) {
+        pool_.reset(new FlightClientPool(options_));
+      }
+    }
+    return pool_->GetClient(location, out);
+  }
+
   Status DoPut(const FlightCallOptions& options, const FlightDescriptor& descriptor,
                const std::shared_ptr<Schema>& schema,
                std::unique_ptr<FlightStreamWriter>* out,
@@ -1124,7 +1503,7 @@ class FlightClient::FlightClientImpl {
 
     auto rpc = std::make_shared<ClientRpc>(options);
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
-    std::shared_ptr<GrpcStream> stream = stub_->DoPut(&rpc->context);
+    std::shared_ptr<GrpcStream> stream = stub()->DoPut(&rpc->context);
     // The writer drains the reader on close to avoid hanging inside
     // gRPC. Concurrent reads are unsafe, so a mutex protects this operation.
     std::shared_ptr<std::mutex> read_mutex = std::make_shared<std::mutex>();
@@ -1147,7 +1526,7 @@ class FlightClient::FlightClientImpl {
     auto rpc = std::make_shared<ClientRpc>(options);
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
     std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>> stream =
-        stub_->DoExchange(&rpc->context);
+        stub()->DoExchange(&rpc->context);
     // The writer drains the reader on close to avoid hanging inside
     // gRPC. Concurrent reads are unsafe, so a mutex protects this operation.
     std::shared_ptr<std::mutex> read_mutex = std::make_shared<std::mutex>();
@@ -1163,8 +1542,16 @@ class FlightClient::FlightClientImpl {
   }
 
  private:
-  std::unique_ptr<pb::FlightService::Stub> stub_;
+  std::vector<std::unique_ptr<pb::FlightService::Stub>> stubs_;
+  std::atomic<uint64_t> next_stub_{0};
   std::shared_ptr<ClientAuthHandler> auth_handler_;
+  Location location_;
+  FlightClientOptions options_;
+  // Whether DoGet() bodies are read from shared memory (grpc+shm scheme)
+  bool shared_memory_ = false;
+  // Clients for other locations, used by multi-endpoint DoGet
+  std::mutex pool_mutex_;
+  std::unique_ptr<FlightClientPool> pool_;
 #if defined(GRPC_NAMESPACE_FOR_TLS_CREDENTIALS_OPTIONS)
   // Scope the TlsServerAuthorizationCheckConfig to be at the class instance level, since
   // it gets created during Connect() and needs to persist to DoAction() calls. gRPC does
@@ -1234,6 +1621,20 @@ Status FlightClient::DoGet(const FlightCallOptions& options, const Ticket& ticke
   return impl_->DoGet(options, ticket, stream);
 }
 
+Status FlightClient::DoGet(const FlightMultiStreamOptions& options,
+                           const FlightInfo& info,
+                           std::unique_ptr<FlightStreamReader>* stream) {
+  auto get_client = [this](const Location& location,
+                           std::shared_ptr<FlightClient>* out) {
+    return impl_->GetPooledClient(this, location, out);
+  };
+  std::unique_ptr<MultiEndpointStreamReader> reader(
+      new MultiEndpointStreamReader(this, get_client, options, info));
+  reader->Start();
+  *stream = std::move(reader);
+  return Status::OK();
+}
+
 Status FlightClient::DoPut(const FlightCallOptions& options,
                            const FlightDescriptor& descriptor,
                            const std::shared_ptr<Schema>& schema,
@@ -1249,5 +1650,90 @@ Status FlightClient::DoExchange(const FlightCallOptions& options,
   return impl_->DoExchange(options, descriptor, writer, reader);
 }
 
+class FlightClientPool::Impl {
+ public:
+  Impl(const FlightClientOptions& options, TimeoutDuration idle_timeout)
+      : options_(options),
+        idle_timeout_(std::chrono::duration_cast<Clock::duration>(idle_timeout)) {}
+
+  Status GetClient(const Location& location, std::shared_ptr<FlightClient>* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto now = Clock::now();
+    EvictIdleClientsUnlocked(now);
+    auto& entry = clients_[location.ToString()];
+    if (entry.client == nullptr) {
+      std::unique_ptr<FlightClient> client;
+      auto st = FlightClient::Connect(location, options_, &client);
+      if (!st.ok()) {
+        clients_.erase(location.ToString());
+        return st;
+      }
+      entry.client = std::move(client);
+    }
+    entry.last_used = now;
+    *out = entry.client;
+    return Status::OK();
+  }
+
+  void EvictIdleClients() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    EvictIdleClientsUnlocked(Clock::now());
+  }
+
+  int64_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int64_t>(clients_.size());
+  }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Entry {
+    std::shared_ptr<FlightClient> client;
+    Clock::time_point last_used;
+  };
+
+  void EvictIdleClientsUnlocked(Clock::time_point now) {
+    auto it = clients_.begin();
+    while (it != clients_.end()) {
+      auto& entry = it->second;
+      if (entry.client.use_count() > 1) {
+        // Still in use by someone else
+        entry.last_used = now;
+        ++it;
+      } else if (now - entry.last_used >= idle_timeout_) {
+        it = clients_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  const FlightClientOptions options_;
+  const Clock::duration idle_timeout_;
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, Entry> clients_;
+};
+
+FlightClientPool::FlightClientPool(const FlightClientOptions& options,
+                                   TimeoutDuration idle_timeout)
+    : impl_(new Impl(options, idle_timeout)) {}
+
+FlightClientPool::~FlightClientPool() {}
+
+FlightClientPool* FlightClientPool::GetGlobal() {
+  static FlightClientPool pool;
+  return &pool;
+}
+
+Status FlightClientPool::GetClient(const Location& location,
+                                   std::shared_ptr<FlightClient>* client) {
+  return impl_->GetClient(location, client);
+}
+
+void FlightClientPool::EvictIdleClients() { impl_->EvictIdleClients(); }
+
+int64_t FlightClientPool::size() const { return impl_->size(); }
+
 }  // namespace flight
 }  // namespace arrow
@@ -65,6 +65,17 @@ class ARROW_FLIGHT_EXPORT FlightCallOptions {
 
   /// \brief IPC writer options, if applicable for the call.
   ipc::IpcWriteOptions write_options;
+
+  /// \brief IPC body compression codecs accepted for data sent by the server.
+  ///
+  /// The server picks one of them, if configured to compress data (see
+  /// FlightServerOptions::ipc_compression).  Defaults to the codecs
+  /// available in this build among LZ4_FRAME and ZSTD.  Compression of data
+  /// sent by the client is configured by `write_options.codec`.
+  std::vector<Compression::type> accepted_compression;
+
+  /// \brief Whether dictionary deltas are accepted from the server.
+  bool accept_dictionary_deltas;
 };
 
 /// \brief Indicate that the client attempted to write a message
@@ -118,6 +129,13 @@ class ARROW_FLIGHT_EXPORT FlightClientOptions {
   /// \brief Use TLS without validating the server certificate. Use with caution.
   bool disable_server_verification;
 
+  /// \brief The number of gRPC channels, hence of connections, to open.
+  ///
+  /// Calls are spread round-robin over the channels.  A single HTTP/2
+  /// connection can limit throughput on fast networks when many streams
+  /// are read at once; opening several connections avoids that.
+  int num_channels;
+
   /// \brief Get default options.
   static FlightClientOptions Defaults();
 };
@@ -162,6 +180,35 @@ class ARROW_FLIGHT_EXPORT FlightMetadataReader {
   virtual Status ReadMetadata(std::shared_ptr<Buffer>* out) = 0;
 };
 
+/// \brief Options for reading all the endpoints of a flight as a single
+/// stream, see FlightClient::DoGet(const FlightMultiStreamOptions&, ...).
+class ARROW_FLIGHT_EXPORT FlightMultiStreamOptions {
+ public:
+  FlightMultiStreamOptions();
+
+  /// \brief Per-RPC options for each DoGet call.
+  FlightCallOptions call_options;
+  /// \brief Whether to return batches in endpoint order.
+  ///
+  /// If true (the default), all batches of an endpoint are returned before
+  /// the batches of the next endpoint.  Otherwise, batches are returned as
+  /// soon as any endpoint produces them, which avoids stalling on a slow
+  /// endpoint.
+  bool ordered;
+  /// \brief The maximum number of endpoints read at once.
+  ///
+  /// If zero or negative, all endpoints are read at once.
+  int32_t max_concurrent_streams;
+  /// \brief The maximum number of messages buffered per endpoint.
+  ///
+  /// Reading from an endpoint pauses when its buffer is full, bounding
+  /// memory consumption when the consumer is slower than the endpoints.
+  int32_t max_buffered_messages;
+
+  /// \brief Get default options.
+  static FlightMultiStreamOptions Defaults();
+};
+
 /// \brief Client class for Arrow Flight RPC services (gRPC-based).
 /// API experimental for now
 class ARROW_FLIGHT_EXPORT FlightClient {
@@ -266,6 +313,29 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoGet({}, ticket, stream);
   }
 
+  /// \brief Given a FlightInfo, read the streams of all its endpoints
+  /// concurrently, presenting them as a single stream.
+  ///
+  /// Each endpoint is read from the first of its locations that can be
+  /// reached, or from this client if it has no locations.  Clients for
+  /// other locations are connected with the options this client was
+  /// created with, and kept in a pool for reuse by subsequent calls; note
+  /// they don't inherit this client's authentication.
+  ///
+  /// All endpoints must return the same schema.  An error on any stream
+  /// is returned by the reader and stops the other streams.  Cancel() on
+  /// the returned reader may be called from any thread to stop reading
+  /// early.
+  ///
+  /// This client must outlive the returned reader.
+  ///
+  /// \param[in] options Options for the combined read
+  /// \param[in] info The flight to read
+  /// \param[out] stream the returned RecordBatchReader
+  /// \return Status
+  Status DoGet(const FlightMultiStreamOptions& options, const FlightInfo& info,
+               std::unique_ptr<FlightStreamReader>* stream);
+
   /// \brief Upload data to a Flight described by the given
   /// descriptor. The caller must call Close() on the returned stream
   /// once they are done writing.
@@ -305,5 +375,43 @@ class ARROW_FLIGHT_EXPORT FlightClient {
   std::unique_ptr<FlightClientImpl> impl_;
 };
 
+/// \brief A pool of FlightClients, keyed by location.
+///
+/// Clients are connected on first request with the options given to the
+/// pool, then shared by all requesters of the same location, which avoids
+/// paying for connection setup (such as TLS handshakes) on each use.
+/// Clients which haven't been in use for longer than the idle timeout are
+/// evicted.
+///
+/// This class is thread-safe.
+class ARROW_FLIGHT_EXPORT FlightClientPool {
+ public:
+  explicit FlightClientPool(
+      const FlightClientOptions& options = FlightClientOptions::Defaults(),
+      TimeoutDuration idle_timeout = TimeoutDuration(60));
+  ~FlightClientPool();
+
+  /// \brief Get the process-wide pool, which uses default client options
+  static FlightClientPool* GetGlobal();
+
+  /// \brief Get a client for the given location, connecting it if needed
+  /// \param[in] location the URI
+  /// \param[out] client the pooled client
+  /// \return Status
+  Status GetClient(const Location& location, std::shared_ptr<FlightClient>* client);
+
+  /// \brief Evict clients which have been idle for too long
+  ///
+  /// This is also done on each GetClient() call.
+  void EvictIdleClients();
+
+  /// \brief The number of clients in the pool
+  int64_t size() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace flight
 }  // namespace arrow
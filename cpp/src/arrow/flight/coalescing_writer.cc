@@ -0,0 +1,194 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/coalescing_writer.h"
+
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/buffer.h"
+#include "arrow/flight/client.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace flight {
+
+namespace {
+
+// Concatenate the buffered batches column by column
+::arrow::Result<std::shared_ptr<RecordBatch>> ConcatenateBatches(
+    const std::vector<std::shared_ptr<RecordBatch>>& batches, int64_t num_rows,
+    MemoryPool* pool) {
+  const auto& schema = batches.front()->schema();
+  std::vector<std::shared_ptr<Array>> columns(schema->num_fields());
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    ArrayVector chunks;
+    chunks.reserve(batches.size());
+    for (const auto& batch : batches) {
+      chunks.push_back(batch->column(i));
+    }
+    ARROW_ASSIGN_OR_RAISE(columns[i], Concatenate(chunks, pool));
+  }
+  return RecordBatch::Make(schema, num_rows, std::move(columns));
+}
+
+}  // namespace
+
+CoalescingWriterOptions::CoalescingWriterOptions()
+    : target_bytes(1 << 20),
+      target_rows(0),
+      max_delay(0),
+      max_batch_bytes(0),
+      pool(default_memory_pool()) {}
+
+CoalescingWriterOptions CoalescingWriterOptions::Defaults() {
+  return CoalescingWriterOptions();
+}
+
+CoalescingRecordBatchWriter::CoalescingRecordBatchWriter(
+    std::shared_ptr<MetadataRecordBatchWriter> writer,
+    const CoalescingWriterOptions& options)
+    : writer_(std::move(writer)),
+      options_(options),
+      ipc_options_(ipc::IpcWriteOptions::Defaults()),
+      buffered_bytes_(0),
+      buffered_rows_(0) {}
+
+CoalescingRecordBatchWriter::~CoalescingRecordBatchWriter() = default;
+
+Status CoalescingRecordBatchWriter::Begin(const std::shared_ptr<Schema>& schema,
+                                          const ipc::IpcWriteOptions& options) {
+  ipc_options_ = options;
+  ipc_options_.codec = nullptr;
+  return writer_->Begin(schema, options);
+}
+
+bool CoalescingRecordBatchWriter::ShouldFlush() const {
+  if (options_.target_bytes <= 0 && options_.target_rows <= 0) {
+    return true;
+  }
+  if (options_.target_bytes > 0 && buffered_bytes_ >= options_.target_bytes) {
+    return true;
+  }
+  if (options_.target_rows > 0 && buffered_rows_ >= options_.target_rows) {
+    return true;
+  }
+  return options_.max_delay.count() > 0 &&
+         std::chrono::steady_clock::now() - first_buffered_ >= options_.max_delay;
+}
+
+Status CoalescingRecordBatchWriter::WriteRecordBatch(const RecordBatch& batch) {
+  int64_t size = 0;
+  RETURN_NOT_OK(ipc::GetRecordBatchSize(batch, ipc_options_, &size));
+  if (buffered_.empty()) {
+    first_buffered_ = std::chrono::steady_clock::now();
+  } else if (!buffered_.front()->schema()->Equals(*batch.schema(),
+                                                   /*check_metadata=*/false)) {
+    return Status::Invalid("Record batch schema does not match the stream schema");
+  }
+  buffered_.push_back(
+      RecordBatch::Make(batch.schema(), batch.num_rows(), batch.columns()));
+  buffered_bytes_ += size;
+  buffered_rows_ += batch.num_rows();
+  if (ShouldFlush()) {
+    return Flush();
+  }
+  return Status::OK();
+}
+
+Status CoalescingRecordBatchWriter::Flush() {
+  if (buffered_.empty()) {
+    return Status::OK();
+  }
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  batches.swap(buffered_);
+  const int64_t num_rows = buffered_rows_;
+  buffered_bytes_ = 0;
+  buffered_rows_ = 0;
+
+  if (batches.size() == 1) {
+    return WriteSplit(batches.front(), nullptr);
+  }
+  auto maybe_batch = ConcatenateBatches(batches, num_rows, options_.pool);
+  if (maybe_batch.status().IsNotImplemented()) {
+    for (const auto& batch : batches) {
+      RETURN_NOT_OK(WriteSplit(batch, nullptr));
+    }
+    return Status::OK();
+  }
+  RETURN_NOT_OK(maybe_batch.status());
+  return WriteSplit(*maybe_batch, nullptr);
+}
+
+Status CoalescingRecordBatchWriter::WriteSplit(const std::shared_ptr<RecordBatch>& batch,
+                                               std::shared_ptr<Buffer> app_metadata) {
+  const int64_t num_rows = batch->num_rows();
+  if (options_.max_batch_bytes > 0 && num_rows > 1) {
+    int64_t size = 0;
+    RETURN_NOT_OK(ipc::GetRecordBatchSize(*batch, ipc_options_, &size));
+    if (size > options_.max_batch_bytes) {
+      const int64_t num_parts = (size + options_.max_batch_bytes - 1) /
+                                options_.max_batch_bytes;
+      const int64_t part_rows = (num_rows + num_parts - 1) / num_parts;
+      for (int64_t offset = 0; offset < num_rows; offset += part_rows) {
+        // Each part is checked again, as rows may be of uneven sizes
+        RETURN_NOT_OK(
+            WriteSplit(batch->Slice(offset, part_rows), std::move(app_metadata)));
+        app_metadata = nullptr;
+      }
+      return Status::OK();
+    }
+  }
+
+  Status st = app_metadata ? writer_->WriteWithMetadata(*batch, app_metadata)
+                           : writer_->WriteRecordBatch(*batch);
+  auto detail = FlightWriteSizeStatusDetail::UnwrapStatus(st);
+  if (detail == nullptr || num_rows <= 1) {
+    return st;
+  }
+  // The batch was rejected before being written: split it in halves, and
+  // split the following batches before they reach the limit
+  if (options_.max_batch_bytes <= 0 || detail->limit() < options_.max_batch_bytes) {
+    options_.max_batch_bytes = detail->limit();
+  }
+  const int64_t half = num_rows / 2;
+  RETURN_NOT_OK(WriteSplit(batch->Slice(0, half), std::move(app_metadata)));
+  return WriteSplit(batch->Slice(half), nullptr);
+}
+
+Status CoalescingRecordBatchWriter::WriteMetadata(std::shared_ptr<Buffer> app_metadata) {
+  RETURN_NOT_OK(Flush());
+  return writer_->WriteMetadata(std::move(app_metadata));
+}
+
+Status CoalescingRecordBatchWriter::WriteWithMetadata(
+    const RecordBatch& batch, std::shared_ptr<Buffer> app_metadata) {
+  RETURN_NOT_OK(Flush());
+  return WriteSplit(RecordBatch::Make(batch.schema(), batch.num_rows(), batch.columns()),
+                    std::move(app_metadata));
+}
+
+Status CoalescingRecordBatchWriter::Close() {
+  RETURN_NOT_OK(Flush());
+  return writer_->Close();
+}
+
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,131 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// A MetadataRecordBatchWriter merging small record batches into larger
+// Flight messages, and splitting oversized ones.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/flight/types.h"
+#include "arrow/flight/visibility.h"
+#include "arrow/ipc/options.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+
+namespace arrow {
+
+class MemoryPool;
+
+namespace flight {
+
+/// \brief Options for a CoalescingRecordBatchWriter.
+class ARROW_FLIGHT_EXPORT CoalescingWriterOptions {
+ public:
+  CoalescingWriterOptions();
+
+  /// \brief Buffered batches are written once they hold at least this
+  /// many bytes of IPC messages.
+  ///
+  /// Disabled if zero or negative.
+  int64_t target_bytes;
+  /// \brief Buffered batches are written once they hold at least this
+  /// many rows.
+  ///
+  /// Disabled if zero or negative.  If neither target is enabled, each
+  /// batch is written as it comes.
+  int64_t target_rows;
+  /// \brief Buffered batches are written by the next write once the
+  /// oldest of them has been buffered this long.
+  ///
+  /// Disabled if zero.  The writer has no thread of its own: call
+  /// CoalescingRecordBatchWriter::Flush when the producer goes idle.
+  std::chrono::microseconds max_delay;
+  /// \brief Batches whose IPC message is larger than this are split
+  /// before being written.
+  ///
+  /// Disabled if zero or negative.  Batches rejected by the underlying
+  /// writer with a FlightWriteSizeStatusDetail are split as well, and the
+  /// reported limit is used for the following batches.
+  int64_t max_batch_bytes;
+  /// \brief The pool to allocate the concatenated batches from.
+  MemoryPool* pool;
+
+  /// \brief Get default options.
+  static CoalescingWriterOptions Defaults();
+};
+
+/// \brief A writer buffering record batches, and writing them
+/// concatenated into larger batches.
+///
+/// Flight sends one message per record batch, so the per-message overhead
+/// dominates when a producer emits many small batches.  This writer
+/// wraps another writer, e.g. a FlightStreamWriter or a
+/// FlightMessageWriter, and only forwards batches once they add up to a
+/// target number of bytes or rows.  Writing application metadata flushes
+/// the buffered batches first, so that the order of the stream is kept.
+///
+/// Batches that can't be concatenated, e.g. dictionary-encoded columns
+/// with differing dictionaries, are written as they are.
+class ARROW_FLIGHT_EXPORT CoalescingRecordBatchWriter : public MetadataRecordBatchWriter {
+ public:
+  explicit CoalescingRecordBatchWriter(
+      std::shared_ptr<MetadataRecordBatchWriter> writer,
+      const CoalescingWriterOptions& options = CoalescingWriterOptions::Defaults());
+  ~CoalescingRecordBatchWriter() override;
+
+  using MetadataRecordBatchWriter::Begin;
+  Status Begin(const std::shared_ptr<Schema>& schema,
+               const ipc::IpcWriteOptions& options) override;
+  Status WriteRecordBatch(const RecordBatch& batch) override;
+  Status WriteMetadata(std::shared_ptr<Buffer> app_metadata) override;
+  /// \brief Write a batch along with application metadata.
+  ///
+  /// The buffered batches are flushed first.  If the batch is split, the
+  /// metadata is sent with its first part.
+  Status WriteWithMetadata(const RecordBatch& batch,
+                           std::shared_ptr<Buffer> app_metadata) override;
+  /// \brief Write the buffered batches, then close the underlying writer.
+  Status Close() override;
+
+  /// \brief Write the buffered batches now.
+  Status Flush();
+
+  /// \brief The number of rows buffered, but not written yet.
+  int64_t buffered_rows() const { return buffered_rows_; }
+
+ private:
+  bool ShouldFlush() const;
+  Status WriteSplit(const std::shared_ptr<RecordBatch>& batch,
+                    std::shared_ptr<Buffer> app_metadata);
+
+  std::shared_ptr<MetadataRecordBatchWriter> writer_;
+  CoalescingWriterOptions options_;
+  // Used to measure batches, without compression
+  ipc::IpcWriteOptions ipc_options_;
+  std::vector<std::shared_ptr<RecordBatch>> buffered_;
+  int64_t buffered_bytes_;
+  int64_t buffered_rows_;
+  std::chrono::steady_clock::time_point first_buffered_;
+};
+
+}  // namespace flight
+}  // namespace arrow
@@ -16,6 +16,8 @@
 // under the License.
 
 #include <cstdint>
+#include <fstream>
+#include <iostream>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -34,6 +36,7 @@
 #include "arrow/ipc/api.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/stopwatch.h"
 #include "arrow/util/thread_pool.h"
 
@@ -45,12 +48,31 @@ DEFINE_string(server_host, "",
               "An existing performance server to benchmark against (leave blank to spawn "
               "one automatically)");
 DEFINE_int32(server_port, 31337, "The port to connect to");
-DEFINE_int32(num_servers, 1, "Number of performance servers to run");
+DEFINE_int32(num_servers, 1,
+             "Number of performance servers to run (or to connect to, on consecutive "
+             "ports starting from server_port)");
+DEFINE_string(server_args, "",
+              "Extra space-separated arguments for spawned servers, e.g. "
+              "\"-num_async_threads=4\"");
 DEFINE_int32(num_streams, 4, "Number of streams for each server");
 DEFINE_int32(num_threads, 4, "Number of concurrent gets");
 DEFINE_int64(records_per_stream, 10000000, "Total records per stream");
 DEFINE_int32(records_per_batch, 4096, "Total records per batch within stream");
-DEFINE_bool(test_put, false, "Test DoPut instead of DoGet");
+DEFINE_string(method, "get", "The method to benchmark: get, put or exchange");
+DEFINE_bool(test_put, false, "Test DoPut instead of DoGet (same as -method=put)");
+DEFINE_string(data_kind, "int64",
+              "The kind of data in each batch: int64, string, nested or dictionary");
+DEFINE_bool(tls, false, "Use TLS, with the test certificates");
+DEFINE_string(compression, "",
+              "IPC compression codec (lz4 or zstd, leave blank for no compression)");
+DEFINE_int32(num_channels, 1, "Number of gRPC channels (connections) per client");
+DEFINE_bool(use_client_pool, false,
+            "Share pooled clients between streams, instead of connecting per stream");
+DEFINE_bool(use_multi_endpoint_get, false,
+            "Read all the endpoints of each server as a single stream, using "
+            "num_threads concurrent gets (DoGet only)");
+DEFINE_string(json_output, "",
+              "Also write the results as JSON to this file (- for standard output)");
 
 namespace perf = arrow::flight::perf;
 namespace acc = boost::accumulators;
@@ -106,6 +128,15 @@ struct PerformanceStats {
   }
 };
 
+// What is sent in each stream
+struct PerformanceData {
+  FlightCallOptions call_options;
+  // A full batch
+  std::shared_ptr<RecordBatch> batch;
+  // The in-memory size of a record, used to compute throughput
+  double bytes_per_record;
+};
+
 Status WaitForReady(FlightClient* client) {
   Action action{"ping", nullptr};
   for (int attempt = 0; attempt < 10; attempt++) {
@@ -118,24 +149,42 @@ Status WaitForReady(FlightClient* client) {
   return Status::IOError("Server was not available after 10 attempts");
 }
 
-arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
-                                              const perf::Token& token,
-                                              const FlightEndpoint& endpoint,
-                                              PerformanceStats& stats) {
-  std::unique_ptr<FlightStreamReader> reader;
-  RETURN_NOT_OK(client->DoGet(endpoint.ticket, &reader));
+int64_t DataBytes(const ArrayData& data) {
+  int64_t nbytes = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer) {
+      nbytes += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    nbytes += DataBytes(*child);
+  }
+  if (data.dictionary) {
+    nbytes += DataBytes(*data.dictionary);
+  }
+  return nbytes;
+}
 
-  FlightStreamChunk batch;
+int64_t BatchBytes(const RecordBatch& batch) {
+  int64_t nbytes = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    nbytes += DataBytes(*batch.column_data(i));
+  }
+  return nbytes;
+}
 
-  // This is hard-coded for right now, 4 columns each with int64
-  const int bytes_per_record = 32;
+int64_t RecordBytes(const PerformanceData& data, int64_t num_records) {
+  return static_cast<int64_t>(data.bytes_per_record * static_cast<double>(num_records));
+}
 
+// Read batches (or an echo of batches) until the end of the stream
+template <typename Reader>
+Status ReadStream(Reader* reader, const perf::Token& token, const PerformanceData& data,
+                  PerformanceStats& stats, PerformanceResult* result) {
   // This must also be set in perf_server.cc
   const bool verify = false;
 
-  int64_t num_bytes = 0;
-  int64_t num_records = 0;
-  int64_t num_batches = 0;
+  FlightStreamChunk batch;
   StopWatch timer;
   while (true) {
     timer.Start();
@@ -147,7 +196,7 @@ arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
 
     if (verify) {
       auto values = batch.data->column_data(0)->GetValues<int64_t>(1);
-      const int64_t start = token.start() + num_records;
+      const int64_t start = token.start() + result->num_records;
       for (int64_t i = 0; i < batch.data->num_rows(); ++i) {
         if (values[i] != start + i) {
           return Status::Invalid("verification failure");
@@ -155,108 +204,240 @@ arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
       }
     }
 
-    ++num_batches;
-    num_records += batch.data->num_rows();
-
-    // Hard-coded
-    num_bytes += batch.data->num_rows() * bytes_per_record;
+    ++result->num_batches;
+    result->num_records += batch.data->num_rows();
   }
-  return PerformanceResult{num_batches, num_records, num_bytes};
+  result->num_bytes = RecordBytes(data, result->num_records);
+  return Status::OK();
 }
 
-arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
+arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
+                                              const PerformanceData& data,
                                               const perf::Token& token,
                                               const FlightEndpoint& endpoint,
                                               PerformanceStats& stats) {
-  std::unique_ptr<FlightStreamWriter> writer;
-  std::unique_ptr<FlightMetadataReader> reader;
-  std::shared_ptr<Schema> schema =
-      arrow::schema({field("a", int64()), field("b", int64()), field("c", int64()),
-                     field("d", int64())});
-  RETURN_NOT_OK(client->DoPut(FlightDescriptor{}, schema, &writer, &reader));
-
-  // This is hard-coded for right now, 4 columns each with int64
-  const int bytes_per_record = 32;
-
-  int64_t num_bytes = 0;
-  int64_t num_records = 0;
-  int64_t num_batches = 0;
-
-  std::shared_ptr<ResizableBuffer> buffer;
-  std::vector<std::shared_ptr<Array>> arrays;
-
-  const int32_t length = token.definition().records_per_batch();
-  const int32_t ncolumns = 4;
-  for (int i = 0; i < ncolumns; ++i) {
-    RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
-                                       &buffer, static_cast<int32_t>(i) /* seed */));
-    arrays.push_back(std::make_shared<Int64Array>(length, buffer));
-    RETURN_NOT_OK(arrays.back()->Validate());
-  }
-
-  std::shared_ptr<RecordBatch> batch = RecordBatch::Make(schema, length, arrays);
+  std::unique_ptr<FlightStreamReader> reader;
+  RETURN_NOT_OK(client->DoGet(data.call_options, endpoint.ticket, &reader));
+  PerformanceResult result{0, 0, 0};
+  RETURN_NOT_OK(ReadStream(reader.get(), token, data, stats, &result));
+  return result;
+}
 
+// Write a stream of batches, calling `on_batch` after each batch
+template <typename Writer, typename OnBatch>
+Status WriteStream(Writer* writer, const perf::Token& token, const PerformanceData& data,
+                   PerformanceStats& stats, PerformanceResult* result,
+                   OnBatch&& on_batch) {
+  const int64_t length = data.batch->num_rows();
   int64_t records_sent = 0;
   const int64_t total_records = token.definition().records_per_stream();
   StopWatch timer;
   while (records_sent < total_records) {
     if (records_sent + length > total_records) {
-      const int last_length = total_records - records_sent;
-      RETURN_NOT_OK(writer->WriteRecordBatch(*(batch->Slice(0, last_length))));
-      num_records += last_length;
-      // Hard-coded
-      num_bytes += last_length * bytes_per_record;
+      const int64_t last_length = total_records - records_sent;
+      RETURN_NOT_OK(writer->WriteRecordBatch(*(data.batch->Slice(0, last_length))));
+      RETURN_NOT_OK(on_batch());
       records_sent += last_length;
     } else {
       timer.Start();
-      RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+      RETURN_NOT_OK(writer->WriteRecordBatch(*data.batch));
+      RETURN_NOT_OK(on_batch());
       stats.AddLatency(timer.Stop());
-      num_records += length;
-      // Hard-coded
-      num_bytes += length * bytes_per_record;
       records_sent += length;
     }
-    ++num_batches;
+    ++result->num_batches;
   }
+  result->num_records = records_sent;
+  result->num_bytes = RecordBytes(data, records_sent);
+  return Status::OK();
+}
+
+arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
+                                              const PerformanceData& data,
+                                              const perf::Token& token,
+                                              const FlightEndpoint& endpoint,
+                                              PerformanceStats& stats) {
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightMetadataReader> reader;
+  RETURN_NOT_OK(client->DoPut(data.call_options, FlightDescriptor{},
+                              data.batch->schema(), &writer, &reader));
+  PerformanceResult result{0, 0, 0};
+  RETURN_NOT_OK(WriteStream(writer.get(), token, data, stats, &result,
+                            []() { return Status::OK(); }));
+  RETURN_NOT_OK(writer->Close());
+  return result;
+}
 
+arrow::Result<PerformanceResult> RunDoExchangeTest(FlightClient* client,
+                                                   const PerformanceData& data,
+                                                   const perf::Token& token,
+                                                   const FlightEndpoint& endpoint,
+                                                   PerformanceStats& stats) {
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  RETURN_NOT_OK(
+      client->DoExchange(data.call_options, FlightDescriptor{}, &writer, &reader));
+  RETURN_NOT_OK(writer->Begin(data.batch->schema()));
+  // Latencies are round trips: each batch is read back once echoed
+  PerformanceResult result{0, 0, 0};
+  int64_t records_received = 0;
+  auto read_echo = [&]() {
+    FlightStreamChunk chunk;
+    RETURN_NOT_OK(reader->Next(&chunk));
+    if (!chunk.data) {
+      return Status::IOError("Server ended the exchange early");
+    }
+    records_received += chunk.data->num_rows();
+    return Status::OK();
+  };
+  RETURN_NOT_OK(WriteStream(writer.get(), token, data, stats, &result, read_echo));
+  RETURN_NOT_OK(writer->DoneWriting());
+  if (records_received != result.num_records) {
+    return Status::Invalid("Did not receive back all records");
+  }
   RETURN_NOT_OK(writer->Close());
-  return PerformanceResult{num_batches, num_records, num_bytes};
+  return result;
+}
+
+// Read all the endpoints of a flight as a single stream
+arrow::Result<PerformanceResult> RunMultiEndpointGetTest(FlightClient* client,
+                                                         const PerformanceData& data,
+                                                         const FlightInfo& plan,
+                                                         PerformanceStats& stats) {
+  auto options = FlightMultiStreamOptions::Defaults();
+  options.call_options = data.call_options;
+  options.ordered = false;
+  options.max_concurrent_streams = FLAGS_num_threads;
+  std::unique_ptr<FlightStreamReader> reader;
+  RETURN_NOT_OK(client->DoGet(options, plan, &reader));
+  PerformanceResult result{0, 0, 0};
+  RETURN_NOT_OK(ReadStream(reader.get(), perf::Token(), data, stats, &result));
+  return result;
+}
+
+Status ConnectClient(const Location& location, std::unique_ptr<FlightClient>* out) {
+  auto client_options = FlightClientOptions::Defaults();
+  client_options.num_channels = FLAGS_num_channels;
+  if (FLAGS_tls) {
+    CertKeyPair root;
+    RETURN_NOT_OK(ExampleTlsCertificateRoot(&root));
+    client_options.tls_root_certs = root.pem_cert;
+  }
+  return FlightClient::Connect(location, client_options, out);
+}
+
+Status MakeLocation(const std::string& host, int port, Location* out) {
+  if (FLAGS_tls) {
+    return Location::ForGrpcTls(host, port, out);
+  }
+  return Location::ForGrpcTcp(host, port, out);
 }
 
-Status RunPerformanceTest(FlightClient* client, bool test_put) {
-  // TODO(wesm): Multiple servers
-  // std::vector<std::unique_ptr<TestServer>> servers;
+void WriteJsonResults(std::ostream& out, const std::string& method,
+                      const PerformanceStats& stats, uint64_t elapsed_nanos) {
+  const double time_elapsed = static_cast<double>(elapsed_nanos) / 1e9;
+  out << "{\"method\": \"" << method << "\", \"data_kind\": \"" << FLAGS_data_kind
+      << "\", \"tls\": " << (FLAGS_tls ? "true" : "false") << ", \"compression\": \""
+      << FLAGS_compression << "\", \"num_servers\": " << FLAGS_num_servers
+      << ", \"num_streams\": " << FLAGS_num_streams
+      << ", \"num_threads\": " << FLAGS_num_threads
+      << ", \"num_channels\": " << FLAGS_num_channels
+      << ", \"records_per_batch\": " << FLAGS_records_per_batch
+      << ", \"batches\": " << stats.total_batches
+      << ", \"records\": " << stats.total_records << ", \"bytes\": " << stats.total_bytes
+      << ", \"nanos\": " << elapsed_nanos << ", \"bytes_per_second\": "
+      << static_cast<double>(stats.total_bytes) / time_elapsed
+      << ", \"batches_per_second\": "
+      << static_cast<double>(stats.total_batches) / time_elapsed
+      << ", \"latency_mean_us\": " << stats.mean_latency();
+  for (auto q : stats.quantiles) {
+    out << ", \"latency_p" << static_cast<int>(q * 100) << "_us\": "
+        << stats.quantile_latency(q);
+  }
+  out << ", \"latency_max_us\": " << stats.max_latency() << "}" << std::endl;
+}
 
+Status RunPerformanceTest(const std::vector<Location>& locations,
+                          const std::string& method) {
   // schema not needed
   perf::Perf perf;
   perf.set_stream_count(FLAGS_num_streams);
   perf.set_records_per_stream(FLAGS_records_per_stream);
   perf.set_records_per_batch(FLAGS_records_per_batch);
+  perf.set_data_kind(FLAGS_data_kind);
+
+  PerformanceData data;
+  RETURN_NOT_OK(MakePerfBatch(FLAGS_data_kind, FLAGS_records_per_batch, &data.batch));
+  data.bytes_per_record = static_cast<double>(BatchBytes(*data.batch)) /
+                          static_cast<double>(FLAGS_records_per_batch);
+  if (!FLAGS_compression.empty()) {
+    ARROW_ASSIGN_OR_RAISE(auto compression,
+                          util::Codec::GetCompressionType(FLAGS_compression));
+    // For data sent by the server, the server decides
+    ARROW_ASSIGN_OR_RAISE(data.call_options.write_options.codec,
+                          util::Codec::Create(compression));
+  }
 
-  // Plan the query
+  // Plan the query on each server
   FlightDescriptor descriptor;
   descriptor.type = FlightDescriptor::CMD;
   perf.SerializeToString(&descriptor.cmd);
 
-  std::unique_ptr<FlightInfo> plan;
-  RETURN_NOT_OK(client->GetFlightInfo(descriptor, &plan));
-
-  // Read the streams in parallel
-  std::shared_ptr<Schema> schema;
-  ipc::DictionaryMemo dict_memo;
-  RETURN_NOT_OK(plan->GetSchema(&dict_memo, &schema));
+  std::vector<std::unique_ptr<FlightInfo>> plans;
+  std::vector<std::unique_ptr<FlightClient>> plan_clients;
+  uint64_t total_records = 0;
+  for (const auto& location : locations) {
+    std::unique_ptr<FlightClient> client;
+    RETURN_NOT_OK(ConnectClient(location, &client));
+    RETURN_NOT_OK(WaitForReady(client.get()));
+    std::unique_ptr<FlightInfo> plan;
+    RETURN_NOT_OK(client->GetFlightInfo(descriptor, &plan));
+    total_records += plan->total_records();
+    plans.push_back(std::move(plan));
+    plan_clients.push_back(std::move(client));
+  }
 
   PerformanceStats stats;
-  auto test_loop = test_put ? &RunDoPutTest : &RunDoGetTest;
-  auto ConsumeStream = [&stats, &test_loop](const FlightEndpoint& endpoint) {
+  auto test_loop = &RunDoGetTest;
+  if (method == "DoPut") {
+    test_loop = &RunDoPutTest;
+  } else if (method == "DoExchange") {
+    test_loop = &RunDoExchangeTest;
+  }
+  auto client_options = FlightClientOptions::Defaults();
+  client_options.num_channels = FLAGS_num_channels;
+  if (FLAGS_tls) {
+    CertKeyPair root;
+    RETURN_NOT_OK(ExampleTlsCertificateRoot(&root));
+    client_options.tls_root_certs = root.pem_cert;
+  }
+  FlightClientPool client_pool(client_options);
+
+  auto ConsumeStream = [&](const FlightEndpoint& endpoint) {
     // TODO(wesm): Use location from endpoint, same host/port for now
-    std::unique_ptr<FlightClient> client;
-    RETURN_NOT_OK(FlightClient::Connect(endpoint.locations.front(), &client));
+    std::shared_ptr<FlightClient> client;
+    if (FLAGS_use_client_pool) {
+      RETURN_NOT_OK(client_pool.GetClient(endpoint.locations.front(), &client));
+    } else {
+      std::unique_ptr<FlightClient> new_client;
+      RETURN_NOT_OK(ConnectClient(endpoint.locations.front(), &new_client));
+      client = std::move(new_client);
+    }
 
     perf::Token token;
     token.ParseFromString(endpoint.ticket.ticket);
 
-    const auto& result = test_loop(client.get(), token, endpoint, stats);
+    const auto& result = test_loop(client.get(), data, token, endpoint, stats);
+    if (result.ok()) {
+      const PerformanceResult& perf = result.ValueOrDie();
+      stats.Update(perf.num_batches, perf.num_records, perf.num_bytes);
+    }
+    return result.status();
+  };
+
+  auto ConsumeFlight = [&](size_t i) {
+    const auto& result =
+        RunMultiEndpointGetTest(plan_clients[i].get(), data, *plans[i], stats);
     if (result.ok()) {
       const PerformanceResult& perf = result.ValueOrDie();
       stats.Update(perf.num_batches, perf.num_records, perf.num_bytes);
@@ -272,11 +453,23 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
   //   RETURN_NOT_OK(ConsumeStream(endpoint));
   // }
 
-  ARROW_ASSIGN_OR_RAISE(auto pool, ThreadPool::Make(FLAGS_num_threads));
   std::vector<Future<Status>> tasks;
-  for (const auto& endpoint : plan->endpoints()) {
-    ARROW_ASSIGN_OR_RAISE(auto task, pool->Submit(ConsumeStream, endpoint));
-    tasks.push_back(std::move(task));
+  std::shared_ptr<ThreadPool> pool;
+  if (FLAGS_use_multi_endpoint_get) {
+    // One reader per server, each with its own concurrent gets
+    ARROW_ASSIGN_OR_RAISE(pool, ThreadPool::Make(static_cast<int>(plans.size())));
+    for (size_t i = 0; i < plans.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto task, pool->Submit(ConsumeFlight, i));
+      tasks.push_back(std::move(task));
+    }
+  } else {
+    ARROW_ASSIGN_OR_RAISE(pool, ThreadPool::Make(FLAGS_num_threads));
+    for (const auto& plan : plans) {
+      for (const auto& endpoint : plan->endpoints()) {
+        ARROW_ASSIGN_OR_RAISE(auto task, pool->Submit(ConsumeStream, endpoint));
+        tasks.push_back(std::move(task));
+      }
+    }
   }
 
   // Wait for tasks to finish
@@ -292,17 +485,17 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
   constexpr double kMegabyte = static_cast<double>(1 << 20);
 
   // Check that number of rows read / written is as expected
-  if (stats.total_records != static_cast<int64_t>(plan->total_records())) {
+  if (stats.total_records != static_cast<int64_t>(total_records)) {
     return Status::Invalid("Did not consume expected number of records");
   }
 
   std::cout << "Batch size: " << stats.total_bytes / stats.total_batches << std::endl;
-  if (FLAGS_test_put) {
-    std::cout << "Batches written: " << stats.total_batches << std::endl;
-    std::cout << "Bytes written: " << stats.total_bytes << std::endl;
-  } else {
+  if (method == "DoGet") {
     std::cout << "Batches read: " << stats.total_batches << std::endl;
     std::cout << "Bytes read: " << stats.total_bytes << std::endl;
+  } else {
+    std::cout << "Batches written: " << stats.total_batches << std::endl;
+    std::cout << "Bytes written: " << stats.total_bytes << std::endl;
   }
 
   std::cout << "Nanos: " << elapsed_nanos << std::endl;
@@ -320,6 +513,16 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
   }
   std::cout << "Latency max: " << stats.max_latency() << " us" << std::endl;
 
+  if (FLAGS_json_output == "-") {
+    WriteJsonResults(std::cout, method, stats, elapsed_nanos);
+  } else if (!FLAGS_json_output.empty()) {
+    std::ofstream json_file(FLAGS_json_output);
+    if (!json_file) {
+      return Status::IOError("Could not open '", FLAGS_json_output, "'");
+    }
+    WriteJsonResults(json_file, method, stats, elapsed_nanos);
+  }
+
   return Status::OK();
 }
 
@@ -329,39 +532,60 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
 int main(int argc, char** argv) {
   gflags::ParseCommandLineFlags(&argc, &argv, true);
 
-  std::unique_ptr<arrow::flight::TestServer> server;
+  std::string method;
+  if (FLAGS_test_put || FLAGS_method == "put") {
+    method = "DoPut";
+  } else if (FLAGS_method == "get") {
+    method = "DoGet";
+  } else if (FLAGS_method == "exchange") {
+    method = "DoExchange";
+  } else {
+    std::cerr << "Unknown method: " << FLAGS_method << std::endl;
+    return 1;
+  }
+
+  std::vector<std::unique_ptr<arrow::flight::TestServer>> servers;
   std::string hostname = "localhost";
   if (FLAGS_server_host == "") {
     std::cout << "Using standalone server: false" << std::endl;
-    server.reset(
-        new arrow::flight::TestServer("arrow-flight-perf-server", FLAGS_server_port));
-    server->Start();
+    std::vector<std::string> server_args;
+    std::istringstream args_stream(FLAGS_server_args);
+    std::string arg;
+    while (args_stream >> arg) {
+      server_args.push_back(arg);
+    }
+    if (FLAGS_tls) {
+      server_args.push_back("-tls");
+    }
+    if (!FLAGS_compression.empty()) {
+      server_args.push_back("-compression=" + FLAGS_compression);
+    }
+    for (int i = 0; i < FLAGS_num_servers; ++i) {
+      servers.emplace_back(new arrow::flight::TestServer("arrow-flight-perf-server",
+                                                         FLAGS_server_port + i));
+      servers.back()->Start(server_args);
+    }
   } else {
     std::cout << "Using standalone server: true" << std::endl;
     hostname = FLAGS_server_host;
   }
 
-  std::cout << "Testing method: ";
-  if (FLAGS_test_put) {
-    std::cout << "DoPut";
-  } else {
-    std::cout << "DoGet";
-  }
-  std::cout << std::endl;
-
+  std::cout << "Testing method: " << method << std::endl;
+  std::cout << "Data kind: " << FLAGS_data_kind << std::endl;
   std::cout << "Server host: " << hostname << std::endl
             << "Server port: " << FLAGS_server_port << std::endl;
 
-  std::unique_ptr<arrow::flight::FlightClient> client;
-  arrow::flight::Location location;
-  ABORT_NOT_OK(
-      arrow::flight::Location::ForGrpcTcp(hostname, FLAGS_server_port, &location));
-  ABORT_NOT_OK(arrow::flight::FlightClient::Connect(location, &client));
-  ABORT_NOT_OK(arrow::flight::WaitForReady(client.get()));
+  std::vector<arrow::flight::Location> locations;
+  for (int i = 0; i < FLAGS_num_servers; ++i) {
+    arrow::flight::Location location;
+    ABORT_NOT_OK(
+        arrow::flight::MakeLocation(hostname, FLAGS_server_port + i, &location));
+    locations.push_back(location);
+  }
 
-  arrow::Status s = arrow::flight::RunPerformanceTest(client.get(), FLAGS_test_put);
+  arrow::Status s = arrow::flight::RunPerformanceTest(locations, method);
 
-  if (server) {
+  for (auto& server : servers) {
     server->Stop();
   }
 
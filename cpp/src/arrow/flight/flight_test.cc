@@ -18,6 +18,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
@@ -33,9 +34,11 @@
 #include "arrow/flight/api.h"
 #include "arrow/ipc/test_common.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
 
@@ -306,6 +309,372 @@ TEST(TestFlight, BuilderHook) {
   ASSERT_OK(server->Shutdown());
 }
 
+// Records whether the server wrote DoGet() bodies to shared memory
+class SharedMemoryClientMiddleware : public ClientMiddleware {
+ public:
+  explicit SharedMemoryClientMiddleware(bool* used_shared_memory)
+      : used_shared_memory_(used_shared_memory) {}
+
+  void SendingHeaders(AddCallHeaders* outgoing_headers) override {}
+
+  void ReceivedHeaders(const CallHeaders& incoming_headers) override {
+    *used_shared_memory_ =
+        incoming_headers.find(internal::kShmBodiesHeader) != incoming_headers.end();
+  }
+
+  void CallCompleted(const Status& status) override {}
+
+ private:
+  bool* used_shared_memory_;
+};
+
+class SharedMemoryClientMiddlewareFactory : public ClientMiddlewareFactory {
+ public:
+  explicit SharedMemoryClientMiddlewareFactory(bool* used_shared_memory)
+      : used_shared_memory_(used_shared_memory) {}
+
+  void StartCall(const CallInfo& info,
+                 std::unique_ptr<ClientMiddleware>* middleware) override {
+    *middleware =
+        arrow::internal::make_unique<SharedMemoryClientMiddleware>(used_shared_memory_);
+  }
+
+ private:
+  bool* used_shared_memory_;
+};
+
+TEST(TestFlight, SharedMemoryDoGet) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir,
+                       arrow::internal::TemporaryDir::Make("flight-shm-test-"));
+  Location location;
+  ASSERT_OK(Location::ForGrpcShm(temp_dir->path().ToString() + "flight.sock", &location));
+  std::unique_ptr<FlightServerBase> server = ExampleTestServer();
+  ASSERT_OK(server->Init(FlightServerOptions(location)));
+
+  bool used_shared_memory = false;
+  auto client_options = FlightClientOptions::Defaults();
+  client_options.middleware.push_back(
+      std::make_shared<SharedMemoryClientMiddlewareFactory>(&used_shared_memory));
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(FlightClient::Connect(location, client_options, &client));
+
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+  // Several streams, with bodies outliving their stream
+  BatchVector batches;
+  for (int i = 0; i < 3; ++i) {
+    std::unique_ptr<FlightStreamReader> stream;
+    ASSERT_OK(client->DoGet(Ticket{"ticket-ints-1"}, &stream));
+    BatchVector stream_batches;
+    ASSERT_OK(stream->ReadAll(&stream_batches));
+    batches.insert(batches.end(), stream_batches.begin(), stream_batches.end());
+  }
+#ifdef __linux__
+  ASSERT_TRUE(used_shared_memory);
+#endif
+  ASSERT_EQ(expected_batches.size() * 3, batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    ASSERT_BATCHES_EQUAL(*expected_batches[i % expected_batches.size()], *batches[i]);
+  }
+  ASSERT_OK(server->Shutdown());
+}
+
+TEST(TestFlight, AsyncDoGet) {
+  Location location;
+  std::unique_ptr<FlightServerBase> server = ExampleTestServer();
+  ASSERT_OK(Location::ForGrpcTcp("localhost", 0, &location));
+  FlightServerOptions options(location);
+  options.num_async_threads = 2;
+  ASSERT_OK(server->Init(options));
+
+  Location real_location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server->port(), &real_location));
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(FlightClient::Connect(real_location, &client));
+
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+  // More concurrent streams than server threads
+  std::vector<std::unique_ptr<FlightStreamReader>> streams(8);
+  for (auto& stream : streams) {
+    ASSERT_OK(client->DoGet(Ticket{"ticket-ints-1"}, &stream));
+  }
+  for (auto& stream : streams) {
+    BatchVector batches;
+    ASSERT_OK(stream->ReadAll(&batches));
+    ASSERT_EQ(expected_batches.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+    }
+  }
+
+  // Errors are still reported
+  std::unique_ptr<FlightStreamReader> stream;
+  BatchVector batches;
+  Status status = client->DoGet(Ticket{"ticket-unknown"}, &stream);
+  if (status.ok()) {
+    status = stream->ReadAll(&batches);
+  }
+  ASSERT_RAISES(NotImplemented, status);
+  ASSERT_OK(server->Shutdown());
+}
+
+// A server middleware that records the statistics of completed streams
+class StreamStatsServerMiddleware : public ServerMiddleware {
+ public:
+  explicit StreamStatsServerMiddleware(std::vector<ServerStreamStats>* recorded)
+      : recorded_(recorded) {}
+  void SendingHeaders(AddCallHeaders* outgoing_headers) override {}
+  void CallCompleted(const Status& status) override {}
+  void StreamCompleted(const ServerStreamStats& stats) override {
+    recorded_->push_back(stats);
+  }
+
+  std::string name() const override { return "StreamStatsServerMiddleware"; }
+
+ private:
+  std::vector<ServerStreamStats>* recorded_;
+};
+
+class StreamStatsServerMiddlewareFactory : public ServerMiddlewareFactory {
+ public:
+  Status StartCall(const CallInfo& info, const CallHeaders& incoming_headers,
+                   std::shared_ptr<ServerMiddleware>* middleware) override {
+    *middleware = std::make_shared<StreamStatsServerMiddleware>(&recorded_);
+    return Status::OK();
+  }
+
+  // Calls are made one at a time in tests
+  std::vector<ServerStreamStats> recorded_;
+};
+
+TEST(TestFlight, ServerStreamStats) {
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+
+  // Without and with read-ahead
+  for (const int64_t max_queued_bytes : {0, 1, 1 << 20}) {
+    SCOPED_TRACE("max_queued_bytes_per_stream = " + std::to_string(max_queued_bytes));
+    Location location;
+    std::unique_ptr<FlightServerBase> server = ExampleTestServer();
+    ASSERT_OK(Location::ForGrpcTcp("localhost", 0, &location));
+    FlightServerOptions options(location);
+    auto stats_factory = std::make_shared<StreamStatsServerMiddlewareFactory>();
+    options.middleware.push_back({"stats", stats_factory});
+    options.max_queued_bytes_per_stream = max_queued_bytes;
+    ASSERT_OK(server->Init(options));
+
+    Location real_location;
+    ASSERT_OK(Location::ForGrpcTcp("localhost", server->port(), &real_location));
+    std::unique_ptr<FlightClient> client;
+    ASSERT_OK(FlightClient::Connect(real_location, &client));
+
+    std::unique_ptr<FlightStreamReader> stream;
+    ASSERT_OK(client->DoGet(Ticket{"ticket-ints-1"}, &stream));
+    BatchVector batches;
+    ASSERT_OK(stream->ReadAll(&batches));
+    ASSERT_EQ(expected_batches.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+    }
+
+    // Errors are still reported
+    Status status = client->DoGet(Ticket{"ticket-unknown"}, &stream);
+    if (status.ok()) {
+      status = stream->ReadAll(&batches);
+    }
+    ASSERT_RAISES(NotImplemented, status);
+    ASSERT_OK(server->Shutdown());
+
+    // Only the first call started a stream
+    ASSERT_EQ(1, stats_factory->recorded_.size());
+    const ServerStreamStats& stats = stats_factory->recorded_[0];
+    // The schema, then the batches
+    ASSERT_EQ(static_cast<int64_t>(expected_batches.size() + 1), stats.messages_written);
+    ASSERT_GT(stats.bytes_written, 0);
+    ASSERT_GT(stats.max_queued_bytes, 0);
+    ASSERT_LE(stats.max_queued_bytes, stats.bytes_written);
+    ASSERT_GT(stats.produce_time.count(), 0);
+    ASSERT_GT(stats.write_stall_time.count(), 0);
+  }
+}
+
+// Records the batches written, rejecting those larger than a size limit as
+// a FlightStreamWriter with write_size_limit_bytes does
+class RecordingBatchWriter : public MetadataRecordBatchWriter {
+ public:
+  explicit RecordingBatchWriter(int64_t size_limit = 0) : size_limit_(size_limit) {}
+
+  Status Begin(const std::shared_ptr<Schema>& schema,
+               const ipc::IpcWriteOptions& options) override {
+    return Status::OK();
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    return WriteWithMetadata(batch, nullptr);
+  }
+
+  Status WriteMetadata(std::shared_ptr<Buffer> app_metadata) override {
+    batches_.push_back(nullptr);
+    metadata_.push_back(std::move(app_metadata));
+    return Status::OK();
+  }
+
+  Status WriteWithMetadata(const RecordBatch& batch,
+                           std::shared_ptr<Buffer> app_metadata) override {
+    if (size_limit_ > 0) {
+      int64_t size = 0;
+      RETURN_NOT_OK(ipc::GetRecordBatchSize(batch, &size));
+      if (size > size_limit_) {
+        ++rejected_;
+        return Status(StatusCode::Invalid, "IPC payload size exceeded soft limit",
+                      std::make_shared<FlightWriteSizeStatusDetail>(size_limit_, size));
+      }
+    }
+    batches_.push_back(
+        RecordBatch::Make(batch.schema(), batch.num_rows(), batch.columns()));
+    metadata_.push_back(std::move(app_metadata));
+    return Status::OK();
+  }
+
+  Status Close() override {
+    closed_ = true;
+    return Status::OK();
+  }
+
+  int64_t size_limit_;
+  int rejected_ = 0;
+  bool closed_ = false;
+  // A null batch denotes a metadata-only message
+  BatchVector batches_;
+  std::vector<std::shared_ptr<Buffer>> metadata_;
+};
+
+// Check that the written batches hold the same rows as the input
+void AssertSameRows(const BatchVector& expected, const BatchVector& actual) {
+  BatchVector actual_data;
+  for (const auto& batch : actual) {
+    if (batch) {
+      actual_data.push_back(batch);
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto expected_table, Table::FromRecordBatches(expected));
+  ASSERT_OK_AND_ASSIGN(auto actual_table,
+                       Table::FromRecordBatches(expected_table->schema(), actual_data));
+  AssertTablesEqual(*expected_table, *actual_table, /*same_chunk_layout=*/false);
+}
+
+TEST(TestCoalescingWriter, CoalesceRows) {
+  BatchVector input;
+  for (int i = 0; i < 25; ++i) {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(ipc::test::MakeIntBatchSized(10, &batch, /*seed=*/i));
+    input.push_back(batch);
+  }
+  auto recording = std::make_shared<RecordingBatchWriter>();
+  auto options = CoalescingWriterOptions::Defaults();
+  options.target_bytes = 0;
+  options.target_rows = 100;
+  CoalescingRecordBatchWriter writer(recording, options);
+  ASSERT_OK(writer.Begin(input[0]->schema()));
+  for (const auto& batch : input) {
+    ASSERT_OK(writer.WriteRecordBatch(*batch));
+  }
+  ASSERT_EQ(2, recording->batches_.size());
+  ASSERT_EQ(50, writer.buffered_rows());
+  ASSERT_OK(writer.Close());
+  ASSERT_TRUE(recording->closed_);
+
+  ASSERT_EQ(3, recording->batches_.size());
+  ASSERT_EQ(100, recording->batches_[0]->num_rows());
+  ASSERT_EQ(100, recording->batches_[1]->num_rows());
+  ASSERT_EQ(50, recording->batches_[2]->num_rows());
+  AssertSameRows(input, recording->batches_);
+}
+
+TEST(TestCoalescingWriter, CoalesceBytes) {
+  BatchVector input;
+  ASSERT_OK(ExampleIntBatches(&input));
+  int64_t total_size = 0;
+  for (const auto& batch : input) {
+    int64_t size = 0;
+    ASSERT_OK(ipc::GetRecordBatchSize(*batch, &size));
+    total_size += size;
+  }
+  auto recording = std::make_shared<RecordingBatchWriter>();
+  auto options = CoalescingWriterOptions::Defaults();
+  options.target_bytes = total_size;
+  CoalescingRecordBatchWriter writer(recording, options);
+  for (const auto& batch : input) {
+    ASSERT_OK(writer.WriteRecordBatch(*batch));
+  }
+  ASSERT_EQ(1, recording->batches_.size());
+  ASSERT_EQ(0, writer.buffered_rows());
+  AssertSameRows(input, recording->batches_);
+}
+
+TEST(TestCoalescingWriter, MetadataFlushes) {
+  BatchVector input;
+  ASSERT_OK(ExampleIntBatches(&input));
+  auto recording = std::make_shared<RecordingBatchWriter>();
+  CoalescingRecordBatchWriter writer(recording);
+  ASSERT_OK(writer.WriteRecordBatch(*input[0]));
+  ASSERT_OK(writer.WriteRecordBatch(*input[1]));
+  ASSERT_OK(writer.WriteMetadata(Buffer::FromString("foo")));
+  ASSERT_OK(writer.WriteRecordBatch(*input[2]));
+  ASSERT_OK(writer.WriteWithMetadata(*input[3], Buffer::FromString("bar")));
+  ASSERT_OK(writer.Close());
+
+  // [0, 1], foo, [2], [3] with bar
+  ASSERT_EQ(4, recording->batches_.size());
+  ASSERT_EQ(input[0]->num_rows() + input[1]->num_rows(),
+            recording->batches_[0]->num_rows());
+  ASSERT_EQ(nullptr, recording->batches_[1]);
+  ASSERT_EQ("foo", recording->metadata_[1]->ToString());
+  ASSERT_BATCHES_EQUAL(*input[2], *recording->batches_[2]);
+  ASSERT_BATCHES_EQUAL(*input[3], *recording->batches_[3]);
+  ASSERT_EQ("bar", recording->metadata_[3]->ToString());
+  AssertSameRows({input[0], input[1], input[2], input[3]}, recording->batches_);
+}
+
+TEST(TestCoalescingWriter, SplitLargeBatches) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::test::MakeIntBatchSized(10000, &batch));
+  int64_t size = 0;
+  ASSERT_OK(ipc::GetRecordBatchSize(*batch, &size));
+
+  // Split proactively
+  auto recording = std::make_shared<RecordingBatchWriter>(size / 4);
+  auto options = CoalescingWriterOptions::Defaults();
+  options.max_batch_bytes = size / 8;
+  CoalescingRecordBatchWriter writer(recording, options);
+  ASSERT_OK(writer.WriteRecordBatch(*batch));
+  ASSERT_OK(writer.Flush());
+  ASSERT_EQ(0, recording->rejected_);
+  ASSERT_GE(recording->batches_.size(), 8);
+  AssertSameRows({batch}, recording->batches_);
+
+  // Split once the underlying writer reports its limit
+  recording = std::make_shared<RecordingBatchWriter>(size / 4);
+  CoalescingRecordBatchWriter limited_writer(recording);
+  ASSERT_OK(limited_writer.WriteRecordBatch(*batch));
+  ASSERT_OK(limited_writer.Flush());
+  ASSERT_GT(recording->rejected_, 0);
+  const int rejected = recording->rejected_;
+  ASSERT_OK(limited_writer.WriteWithMetadata(*batch, Buffer::FromString("foo")));
+  ASSERT_EQ(rejected, recording->rejected_);
+  AssertSameRows({batch, batch}, recording->batches_);
+  ASSERT_EQ(nullptr, recording->metadata_.back());
+
+  // A single row above the limit can't be split
+  recording = std::make_shared<RecordingBatchWriter>(1);
+  CoalescingRecordBatchWriter unsplittable_writer(recording);
+  ASSERT_OK(unsplittable_writer.WriteRecordBatch(*batch));
+  Status status = unsplittable_writer.Flush();
+  ASSERT_RAISES(Invalid, status);
+  ASSERT_NE(nullptr, FlightWriteSizeStatusDetail::UnwrapStatus(status));
+}
+
 // ----------------------------------------------------------------------
 // Client tests
 
@@ -848,6 +1217,57 @@ class ErrorMiddlewareServer : public FlightServerBase {
   }
 };
 
+// A server sending batches whose dictionaries grow and get replaced
+class IpcNegotiationTestServer : public FlightServerBase {
+ public:
+  static BatchVector DictionaryBatches() {
+    auto type = dictionary(int8(), utf8());
+    auto schema = ::arrow::schema({field("dict", type)});
+    BatchVector batches;
+    // Initial dictionary, delta, unchanged, replacement
+    const std::vector<std::pair<std::string, std::string>> indices_and_dicts = {
+        {"[0, 0, null]", R"(["foo"])"},
+        {"[1, null, 0]", R"(["foo", "bar"])"},
+        {"[null, 1, 1]", R"(["foo", "bar"])"},
+        {"[0, 0, 0]", R"(["quux"])"}};
+    for (const auto& pair : indices_and_dicts) {
+      auto array = DictArrayFromJSON(type, pair.first, pair.second);
+      batches.push_back(RecordBatch::Make(schema, array->length(), {array}));
+    }
+    return batches;
+  }
+
+  Status DoGet(const ServerCallContext& context, const Ticket& request,
+               std::unique_ptr<FlightDataStream>* data_stream) override {
+    auto batches = DictionaryBatches();
+    auto reader = std::make_shared<BatchIterator>(batches[0]->schema(), batches);
+    *data_stream = std::unique_ptr<FlightDataStream>(
+        new RecordBatchStream(reader, context.negotiated_write_options()));
+    return Status::OK();
+  }
+
+  Status DoExchange(const ServerCallContext& context,
+                    std::unique_ptr<FlightMessageReader> reader,
+                    std::unique_ptr<FlightMessageWriter> writer) override {
+    auto batches = DictionaryBatches();
+    RETURN_NOT_OK(writer->Begin(batches[0]->schema()));
+    for (const auto& batch : batches) {
+      RETURN_NOT_OK(writer->WriteWithMetadata(*batch, Buffer::FromString("meta")));
+    }
+    return Status::OK();
+  }
+
+  // Return the negotiated options as "<codec name>,<whether deltas are enabled>"
+  Status DoAction(const ServerCallContext& context, const Action& action,
+                  std::unique_ptr<ResultStream>* result) override {
+    const auto& options = context.negotiated_write_options();
+    std::string codec = options.codec ? options.codec->name() : "uncompressed";
+    auto buf = Buffer::FromString(codec + (options.emit_dictionary_deltas ? ",1" : ",0"));
+    *result = std::unique_ptr<ResultStream>(new SimpleResultStream({Result{buf}}));
+    return Status::OK();
+  }
+};
+
 class PropagatingTestServer : public FlightServerBase {
  public:
   explicit PropagatingTestServer(std::unique_ptr<FlightClient> client)
@@ -993,6 +1413,102 @@ class TestErrorMiddleware : public ::testing::Test {
   std::unique_ptr<FlightServerBase> server_;
 };
 
+class TestIpcNegotiation : public ::testing::Test {
+ public:
+  void SetUp() {
+    for (const auto compression : {Compression::ZSTD, Compression::LZ4_FRAME}) {
+      if (util::Codec::IsAvailable(compression)) {
+        compressions_.push_back(compression);
+      }
+    }
+    ASSERT_OK(MakeServer<IpcNegotiationTestServer>(
+        &server_, &client_,
+        [&](FlightServerOptions* options) {
+          options->ipc_compression = compressions_;
+          options->ipc_dictionary_deltas = true;
+          return Status::OK();
+        },
+        [](FlightClientOptions* options) { return Status::OK(); }));
+  }
+
+  void TearDown() { ASSERT_OK(server_->Shutdown()); }
+
+  std::string GetNegotiated(const FlightCallOptions& options) {
+    std::unique_ptr<ResultStream> stream;
+    ARROW_EXPECT_OK(client_->DoAction(options, Action{"negotiated", nullptr}, &stream));
+    std::unique_ptr<Result> result;
+    ARROW_EXPECT_OK(stream->Next(&result));
+    return result ? result->body->ToString() : "";
+  }
+
+ protected:
+  std::vector<Compression::type> compressions_;
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+};
+
+TEST_F(TestIpcNegotiation, Negotiate) {
+  FlightCallOptions options;
+  const std::string expected_codec =
+      compressions_.empty() ? "uncompressed"
+                            : util::Codec::GetCodecAsString(compressions_[0]);
+  ASSERT_EQ(GetNegotiated(options), expected_codec + ",1");
+
+  // Client preference order doesn't matter
+  options.accepted_compression = compressions_;
+  std::reverse(options.accepted_compression.begin(), options.accepted_compression.end());
+  ASSERT_EQ(GetNegotiated(options), expected_codec + ",1");
+
+  // Only the second server codec is accepted
+  if (compressions_.size() > 1) {
+    options.accepted_compression = {compressions_[1]};
+    ASSERT_EQ(GetNegotiated(options),
+              util::Codec::GetCodecAsString(compressions_[1]) + ",1");
+  }
+
+  options.accepted_compression = {Compression::GZIP};
+  options.accept_dictionary_deltas = false;
+  ASSERT_EQ(GetNegotiated(options), "uncompressed,0");
+}
+
+TEST_F(TestIpcNegotiation, DoGet) {
+  const auto expected = IpcNegotiationTestServer::DictionaryBatches();
+  for (const bool negotiate : {true, false}) {
+    FlightCallOptions options;
+    if (!negotiate) {
+      options.accepted_compression.clear();
+      options.accept_dictionary_deltas = false;
+    }
+    std::unique_ptr<FlightStreamReader> stream;
+    ASSERT_OK(client_->DoGet(options, Ticket{""}, &stream));
+    BatchVector batches;
+    ASSERT_OK(stream->ReadAll(&batches));
+    ASSERT_EQ(batches.size(), expected.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      ASSERT_BATCHES_EQUAL(*expected[i], *batches[i]);
+    }
+  }
+}
+
+TEST_F(TestIpcNegotiation, DoExchange) {
+  const auto expected = IpcNegotiationTestServer::DictionaryBatches();
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(FlightDescriptor::Command(""), &writer, &reader));
+  ASSERT_OK(writer->DoneWriting());
+  FlightStreamChunk chunk;
+  for (const auto& batch : expected) {
+    ASSERT_OK(reader->Next(&chunk));
+    ASSERT_NE(chunk.data, nullptr);
+    ASSERT_BATCHES_EQUAL(*batch, *chunk.data);
+    ASSERT_NE(chunk.app_metadata, nullptr);
+    ASSERT_EQ(chunk.app_metadata->ToString(), "meta");
+  }
+  ASSERT_OK(reader->Next(&chunk));
+  ASSERT_EQ(chunk.data, nullptr);
+  ASSERT_OK(writer->Close());
+}
+
 TEST_F(TestErrorMiddleware, TestMetadata) {
   Action action;
   std::unique_ptr<ResultStream> stream;
@@ -1119,6 +1635,108 @@ TEST_F(TestFlightClient, DoGetLargeBatch) {
   CheckDoGet(ticket, expected_batches);
 }
 
+TEST_F(TestFlightClient, DoGetMultipleEndpoints) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  const int num_batches = static_cast<int>(batches.size());
+
+  Location self_location, other_location, bad_location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server_->port(), &self_location));
+  // Same server under another name, connected through the client pool
+  ASSERT_OK(Location::ForGrpcTcp("127.0.0.1", server_->port(), &other_location));
+  ASSERT_OK(Location::ForGrpcUnix("/nonexistent/flight.sock", &bad_location));
+
+  FlightInfo::Data data;
+  data.total_records = -1;
+  data.total_bytes = -1;
+  data.endpoints = {{{"ticket-ints-1"}, {}},
+                    {{"ticket-ints-1"}, {self_location}},
+                    {{"ticket-ints-1"}, {bad_location, other_location}}};
+  FlightInfo info(data);
+
+  for (const bool ordered : {true, false}) {
+    SCOPED_TRACE(ordered ? "ordered" : "unordered");
+    auto options = FlightMultiStreamOptions::Defaults();
+    options.ordered = ordered;
+    options.max_concurrent_streams = 2;
+    options.max_buffered_messages = 1;
+    std::unique_ptr<FlightStreamReader> stream;
+    ASSERT_OK(client_->DoGet(options, info, &stream));
+    ASSERT_OK_AND_ASSIGN(auto schema, stream->GetSchema());
+    AssertSchemaEqual(*batches[0]->schema(), *schema);
+
+    BatchVector actual;
+    ASSERT_OK(stream->ReadAll(&actual));
+    ASSERT_EQ(actual.size(), 3 * batches.size());
+    if (ordered) {
+      for (size_t i = 0; i < actual.size(); ++i) {
+        ASSERT_BATCHES_EQUAL(*batches[i % num_batches], *actual[i]);
+      }
+    }
+  }
+
+  // An error on any endpoint fails the whole stream
+  data.endpoints.push_back({{"bogus-ticket"}, {}});
+  FlightInfo bad_info(data);
+  std::unique_ptr<FlightStreamReader> stream;
+  ASSERT_OK(client_->DoGet(FlightMultiStreamOptions::Defaults(), bad_info, &stream));
+  BatchVector actual;
+  ASSERT_FALSE(stream->ReadAll(&actual).ok());
+
+  // Cancellation
+  ASSERT_OK(client_->DoGet(FlightMultiStreamOptions::Defaults(), info, &stream));
+  FlightStreamChunk chunk;
+  ASSERT_OK(stream->Next(&chunk));
+  ASSERT_NE(chunk.data, nullptr);
+  stream->Cancel();
+  ASSERT_RAISES(IOError, stream->Next(&chunk));
+}
+
+TEST_F(TestFlightClient, MultipleChannels) {
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server_->port(), &location));
+  auto options = FlightClientOptions::Defaults();
+  options.num_channels = 3;
+  ASSERT_OK(FlightClient::Connect(location, options, &client_));
+
+  // Calls are spread over the channels
+  for (int i = 0; i < 5; ++i) {
+    CheckDoGet(Ticket{"ticket-ints-1"}, expected_batches);
+  }
+}
+
+TEST_F(TestFlightClient, ClientPool) {
+  Location location, other_location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server_->port(), &location));
+  ASSERT_OK(Location::ForGrpcTcp("127.0.0.1", server_->port(), &other_location));
+
+  FlightClientPool pool(FlightClientOptions::Defaults(), TimeoutDuration(0));
+  std::shared_ptr<FlightClient> client1, client2, client3;
+  ASSERT_OK(pool.GetClient(location, &client1));
+  ASSERT_OK(pool.GetClient(location, &client2));
+  ASSERT_EQ(client1, client2);
+  ASSERT_OK(pool.GetClient(other_location, &client3));
+  ASSERT_NE(client1, client3);
+  ASSERT_EQ(pool.size(), 2);
+
+  std::vector<ActionType> actions;
+  ASSERT_OK(client3->ListActions(&actions));
+
+  // Clients in use are not evicted
+  pool.EvictIdleClients();
+  ASSERT_EQ(pool.size(), 2);
+  client3.reset();
+  pool.EvictIdleClients();
+  ASSERT_EQ(pool.size(), 1);
+  client1.reset();
+  client2.reset();
+  pool.EvictIdleClients();
+  ASSERT_EQ(pool.size(), 0);
+}
+
 TEST_F(TestFlightClient, DoExchange) {
   auto descr = FlightDescriptor::Command("counter");
   BatchVector batches;
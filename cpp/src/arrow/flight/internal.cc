@@ -51,6 +51,10 @@ const char* kGrpcAuthHeader = "auth-token-bin";
 const char* kGrpcStatusCodeHeader = "x-arrow-status";
 const char* kGrpcStatusMessageHeader = "x-arrow-status-message-bin";
 const char* kGrpcStatusDetailHeader = "x-arrow-status-detail-bin";
+const char* kIpcAcceptCompressionHeader = "x-arrow-ipc-accept-compression";
+const char* kIpcAcceptDictionaryDeltasHeader = "x-arrow-ipc-accept-dictionary-deltas";
+const char* kShmSegmentHeader = "x-arrow-flight-shm-segment";
+const char* kShmBodiesHeader = "x-arrow-flight-shm-bodies";
 const char* kBinaryErrorDetailsKey = "grpc-status-details-bin";
 
 static Status StatusCodeFromString(const grpc::string_ref& code_ref, StatusCode* code) {
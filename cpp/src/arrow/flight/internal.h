@@ -79,6 +79,26 @@ extern const char* kGrpcStatusMessageHeader;
 ARROW_FLIGHT_EXPORT
 extern const char* kGrpcStatusDetailHeader;
 
+/// The name of the header used by clients to pass the comma-separated
+/// names of the IPC compression codecs they accept.
+ARROW_FLIGHT_EXPORT
+extern const char* kIpcAcceptCompressionHeader;
+
+/// The name of the header used by clients to signal they accept
+/// dictionary deltas.
+ARROW_FLIGHT_EXPORT
+extern const char* kIpcAcceptDictionaryDeltasHeader;
+
+/// The name of the header used by clients to pass the name of the shared
+/// memory segment where DoGet() bodies may be written.
+ARROW_FLIGHT_EXPORT
+extern const char* kShmSegmentHeader;
+
+/// The name of the header used by servers to signal that DoGet() bodies
+/// are written to the client's shared memory segment.
+ARROW_FLIGHT_EXPORT
+extern const char* kShmBodiesHeader;
+
 ARROW_FLIGHT_EXPORT
 extern const char* kBinaryErrorDetailsKey;
 
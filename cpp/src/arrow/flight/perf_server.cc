@@ -31,6 +31,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 
 #include "arrow/flight/api.h"
@@ -40,6 +41,16 @@
 
 DEFINE_string(server_host, "localhost", "Host where the server is running on");
 DEFINE_int32(port, 31337, "Server port to listen on");
+DEFINE_bool(tls, false, "Use TLS, with the test certificates");
+DEFINE_string(compression, "",
+              "IPC compression codec for data sent to clients which accept it "
+              "(lz4 or zstd, leave blank for no compression)");
+DEFINE_int32(num_async_threads, 0,
+             "Number of threads serving DoGet asynchronously (0 to serve "
+             "synchronously)");
+DEFINE_int64(max_queued_bytes_per_stream, 0,
+             "Number of bytes DoGet may produce ahead of the client (0 to produce "
+             "on demand)");
 
 namespace perf = arrow::flight::perf;
 namespace proto = arrow::flight::protocol;
@@ -59,17 +70,15 @@ namespace flight {
 class PerfDataStream : public FlightDataStream {
  public:
   PerfDataStream(bool verify, const int64_t start, const int64_t total_records,
-                 const std::shared_ptr<Schema>& schema, const ArrayVector& arrays)
+                 const std::shared_ptr<RecordBatch>& batch)
       : start_(start),
         verify_(verify),
-        batch_length_(arrays[0]->length()),
+        batch_length_(batch->num_rows()),
         total_records_(total_records),
         records_sent_(0),
-        schema_(schema),
-        mapper_(*schema),
-        arrays_(arrays) {
-    batch_ = RecordBatch::Make(schema, batch_length_, arrays_);
-  }
+        schema_(batch->schema()),
+        mapper_(*schema_),
+        batch_(batch) {}
 
   std::shared_ptr<Schema> schema() override { return schema_; }
 
@@ -86,8 +95,8 @@ class PerfDataStream : public FlightDataStream {
 
     if (verify_) {
       // mutate first array
-      auto data =
-          reinterpret_cast<int64_t*>(arrays_[0]->data()->buffers[1]->mutable_data());
+      auto data = reinterpret_cast<int64_t*>(
+          batch_->column_data(0)->buffers[1]->mutable_data());
       for (int64_t i = 0; i < batch_length_; ++i) {
         data[i] = start_ + records_sent_ + i;
       }
@@ -115,35 +124,30 @@ class PerfDataStream : public FlightDataStream {
   ipc::DictionaryFieldMapper mapper_;
   ipc::IpcWriteOptions ipc_options_;
   std::shared_ptr<RecordBatch> batch_;
-  ArrayVector arrays_;
 };
 
-Status GetPerfBatches(const perf::Token& token, const std::shared_ptr<Schema>& schema,
-                      bool use_verifier, std::unique_ptr<FlightDataStream>* data_stream) {
-  std::shared_ptr<ResizableBuffer> buffer;
-  std::vector<std::shared_ptr<Array>> arrays;
-
-  const int32_t length = token.definition().records_per_batch();
-  const int32_t ncolumns = 4;
-  for (int i = 0; i < ncolumns; ++i) {
-    RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
-                                       &buffer, static_cast<int32_t>(i) /* seed */));
-    arrays.push_back(std::make_shared<Int64Array>(length, buffer));
-    RETURN_NOT_OK(arrays.back()->Validate());
-  }
+std::string GetDataKind(const perf::Perf& perf) {
+  return perf.data_kind().empty() ? "int64" : perf.data_kind();
+}
 
-  *data_stream = std::unique_ptr<FlightDataStream>(
-      new PerfDataStream(use_verifier, token.start(),
-                         token.definition().records_per_stream(), schema, arrays));
+Status GetPerfBatches(const perf::Token& token, bool use_verifier,
+                      std::unique_ptr<FlightDataStream>* data_stream) {
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(MakePerfBatch(GetDataKind(token.definition()),
+                              token.definition().records_per_batch(), &batch));
+  *data_stream = std::unique_ptr<FlightDataStream>(new PerfDataStream(
+      use_verifier, token.start(), token.definition().records_per_stream(), batch));
   return Status::OK();
 }
 
 class FlightPerfServer : public FlightServerBase {
  public:
   FlightPerfServer() : location_() {
-    DCHECK_OK(Location::ForGrpcTcp(FLAGS_server_host, FLAGS_port, &location_));
-    perf_schema_ = schema({field("a", int64()), field("b", int64()), field("c", int64()),
-                           field("d", int64())});
+    if (FLAGS_tls) {
+      DCHECK_OK(Location::ForGrpcTls(FLAGS_server_host, FLAGS_port, &location_));
+    } else {
+      DCHECK_OK(Location::ForGrpcTcp(FLAGS_server_host, FLAGS_port, &location_));
+    }
   }
 
   Status GetFlightInfo(const ServerCallContext& context, const FlightDescriptor& request,
@@ -169,9 +173,11 @@ class FlightPerfServer : public FlightServerBase {
     uint64_t total_records =
         perf_request.stream_count() * perf_request.records_per_stream();
 
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(MakePerfBatch(GetDataKind(perf_request), /*length=*/0, &batch));
     FlightInfo::Data data;
     RETURN_NOT_OK(
-        MakeFlightInfo(*perf_schema_, request, endpoints, total_records, -1, &data));
+        MakeFlightInfo(*batch->schema(), request, endpoints, total_records, -1, &data));
     *info = std::unique_ptr<FlightInfo>(new FlightInfo(data));
     return Status::OK();
   }
@@ -180,7 +186,7 @@ class FlightPerfServer : public FlightServerBase {
                std::unique_ptr<FlightDataStream>* data_stream) override {
     perf::Token token;
     CHECK_PARSE(token.ParseFromString(request.ticket));
-    return GetPerfBatches(token, perf_schema_, false, data_stream);
+    return GetPerfBatches(token, false, data_stream);
   }
 
   Status DoPut(const ServerCallContext& context,
@@ -197,6 +203,22 @@ class FlightPerfServer : public FlightServerBase {
     return Status::OK();
   }
 
+  // Send back the uploaded batches
+  Status DoExchange(const ServerCallContext& context,
+                    std::unique_ptr<FlightMessageReader> reader,
+                    std::unique_ptr<FlightMessageWriter> writer) override {
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(reader->GetSchema().Value(&schema));
+    RETURN_NOT_OK(writer->Begin(schema));
+    FlightStreamChunk chunk;
+    while (true) {
+      RETURN_NOT_OK(reader->Next(&chunk));
+      if (!chunk.data) break;
+      RETURN_NOT_OK(writer->WriteRecordBatch(*chunk.data));
+    }
+    return writer->Close();
+  }
+
   Status DoAction(const ServerCallContext& context, const Action& action,
                   std::unique_ptr<ResultStream>* result) override {
     if (action.type == "ping") {
@@ -209,7 +231,6 @@ class FlightPerfServer : public FlightServerBase {
 
  private:
   Location location_;
-  std::shared_ptr<Schema> perf_schema_;
 };
 
 }  // namespace flight
@@ -229,8 +250,24 @@ int main(int argc, char** argv) {
   g_server.reset(new arrow::flight::FlightPerfServer);
 
   arrow::flight::Location location;
-  ARROW_CHECK_OK(arrow::flight::Location::ForGrpcTcp("0.0.0.0", FLAGS_port, &location));
+  if (FLAGS_tls) {
+    ARROW_CHECK_OK(
+        arrow::flight::Location::ForGrpcTls("0.0.0.0", FLAGS_port, &location));
+  } else {
+    ARROW_CHECK_OK(
+        arrow::flight::Location::ForGrpcTcp("0.0.0.0", FLAGS_port, &location));
+  }
   arrow::flight::FlightServerOptions options(location);
+  if (FLAGS_tls) {
+    ARROW_CHECK_OK(arrow::flight::ExampleTlsCertificates(&options.tls_certificates));
+  }
+  if (!FLAGS_compression.empty()) {
+    auto compression = arrow::util::Codec::GetCompressionType(FLAGS_compression);
+    ARROW_CHECK_OK(compression.status());
+    options.ipc_compression.push_back(*compression);
+  }
+  options.num_async_threads = FLAGS_num_async_threads;
+  options.max_queued_bytes_per_stream = FLAGS_max_queued_bytes_per_stream;
 
   ARROW_CHECK_OK(g_server->Init(options));
   // Exit with a clean error code (0) on SIGTERM
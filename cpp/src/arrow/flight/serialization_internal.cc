@@ -17,9 +17,12 @@
 
 #include "arrow/flight/serialization_internal.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "arrow/flight/platform.h"
@@ -65,23 +68,10 @@ using arrow::ipc::IpcPayload;
 
 using google::protobuf::internal::WireFormatLite;
 using google::protobuf::io::ArrayOutputStream;
-using google::protobuf::io::CodedInputStream;
 using google::protobuf::io::CodedOutputStream;
 
 using grpc::ByteBuffer;
 
-bool ReadBytesZeroCopy(const std::shared_ptr<Buffer>& source_data,
-                       CodedInputStream* input, std::shared_ptr<Buffer>* out) {
-  uint32_t length;
-  if (!input->ReadVarint32(&length)) {
-    return false;
-  }
-  auto buf =
-      SliceBuffer(source_data, input->CurrentPosition(), static_cast<int64_t>(length));
-  *out = buf;
-  return input->Skip(static_cast<int>(length));
-}
-
 // Internal wrapper for gRPC ByteBuffer so its memory can be exposed to Arrow
 // consumers with zero-copy
 class GrpcBuffer : public MutableBuffer {
@@ -96,7 +86,9 @@ class GrpcBuffer : public MutableBuffer {
     grpc_slice_unref(slice_);
   }
 
-  static Status Wrap(ByteBuffer* cpp_buf, std::shared_ptr<Buffer>* out) {
+  // Expose the slices of a ByteBuffer as Arrow buffers.  Only compressed
+  // ByteBuffers are reassembled into a single buffer.
+  static Status WrapSlices(ByteBuffer* cpp_buf, BufferVector* out) {
     // These types are guaranteed by static assertions in gRPC to have the same
     // in-memory representation
 
@@ -105,22 +97,27 @@ class GrpcBuffer : public MutableBuffer {
     // This part below is based on the Flatbuffers gRPC SerializationTraits in
     // flatbuffers/grpc.h
 
-    // Check if this is a single uncompressed slice.
+    // Check if this is uncompressed.
     if ((buffer->type == GRPC_BB_RAW) &&
-        (buffer->data.raw.compression == GRPC_COMPRESS_NONE) &&
-        (buffer->data.raw.slice_buffer.count == 1)) {
-      // If it is, then we can reference the `grpc_slice` directly.
-      grpc_slice slice = buffer->data.raw.slice_buffer.slices[0];
-
-      if (slice.refcount) {
-        // Increment reference count so this memory remains valid
-        *out = std::make_shared<GrpcBuffer>(slice, true);
-      } else {
-        // Small slices (less than GRPC_SLICE_INLINED_SIZE bytes) are
-        // inlined into the structure and must be copied.
-        const uint8_t length = slice.data.inlined.length;
-        ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer(length));
-        std::memcpy((*out)->mutable_data(), slice.data.inlined.bytes, length);
+        (buffer->data.raw.compression == GRPC_COMPRESS_NONE)) {
+      // If it is, then we can reference the `grpc_slice`s directly.
+      const grpc_slice_buffer& slice_buffer = buffer->data.raw.slice_buffer;
+      for (size_t i = 0; i < slice_buffer.count; ++i) {
+        grpc_slice slice = slice_buffer.slices[i];
+        if (GRPC_SLICE_LENGTH(slice) == 0) continue;
+
+        if (slice.refcount) {
+          // Increment reference count so this memory remains valid
+          out->push_back(std::make_shared<GrpcBuffer>(slice, true));
+        } else {
+          // Small slices (less than GRPC_SLICE_INLINED_SIZE bytes) are
+          // inlined into the structure and must be copied.
+          const uint8_t length = slice.data.inlined.length;
+          ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> copy,
+                                arrow::AllocateBuffer(length));
+          std::memcpy(copy->mutable_data(), slice.data.inlined.bytes, length);
+          out->push_back(std::move(copy));
+        }
       }
     } else {
       // Otherwise, we need to use `grpc_byte_buffer_reader_readall` to read
@@ -134,7 +131,7 @@ class GrpcBuffer : public MutableBuffer {
       grpc_byte_buffer_reader_destroy(&reader);
 
       // Steal the slice reference
-      *out = std::make_shared<GrpcBuffer>(slice, false);
+      out->push_back(std::make_shared<GrpcBuffer>(slice, false));
     }
 
     return Status::OK();
@@ -144,6 +141,77 @@ class GrpcBuffer : public MutableBuffer {
   grpc_slice slice_;
 };
 
+// Reader of Protobuf wire format over a sequence of buffers, such as the
+// slices of a gRPC ByteBuffer.  Length-delimited fields are returned as
+// slices of the underlying buffers, without copying.
+class ChunkedWireReader {
+ public:
+  explicit ChunkedWireReader(const BufferVector& chunks)
+      : chunks_(chunks), chunk_(0), position_(0) {}
+
+  bool AtEnd() const { return chunk_ == chunks_.size(); }
+
+  bool ReadVarint32(uint32_t* out) {
+    // Like CodedInputStream, accept (and truncate) 64-bit varints
+    uint64_t result = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (AtEnd()) {
+        return false;
+      }
+      const uint8_t byte = chunks_[chunk_]->data()[position_];
+      Advance(1);
+      result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if (!(byte & 0x80)) {
+        *out = static_cast<uint32_t>(result);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Read a length-delimited field, as one slice per buffer it spans
+  bool ReadLengthDelimited(BufferVector* out) {
+    uint32_t length;
+    if (!ReadVarint32(&length)) {
+      return false;
+    }
+    int64_t remaining = static_cast<int64_t>(length);
+    while (remaining > 0) {
+      if (AtEnd()) {
+        return false;
+      }
+      const auto& chunk = chunks_[chunk_];
+      const int64_t nbytes = std::min(remaining, chunk->size() - position_);
+      out->push_back(SliceBuffer(chunk, position_, nbytes));
+      Advance(nbytes);
+      remaining -= nbytes;
+    }
+    return true;
+  }
+
+ private:
+  void Advance(int64_t nbytes) {
+    position_ += nbytes;
+    if (position_ == chunks_[chunk_]->size()) {
+      ++chunk_;
+      position_ = 0;
+    }
+  }
+
+  const BufferVector& chunks_;
+  size_t chunk_;
+  int64_t position_;
+};
+
+// Make a single buffer out of the slices of a (small) field
+Status MakeContiguous(const BufferVector& slices, std::shared_ptr<Buffer>* out) {
+  if (slices.size() == 1) {
+    *out = slices[0];
+    return Status::OK();
+  }
+  return ConcatenateBuffers(slices).Value(out);
+}
+
 // Destructor callback for grpc::Slice
 static void ReleaseBuffer(void* buf_ptr) {
   delete reinterpret_cast<std::shared_ptr<Buffer>*>(buf_ptr);
@@ -315,32 +383,34 @@ grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
   out->app_metadata = nullptr;
   out->metadata = nullptr;
   out->body = nullptr;
-
-  std::shared_ptr<arrow::Buffer> wrapped_buffer;
-  GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &wrapped_buffer));
-
-  auto buffer_length = static_cast<int>(wrapped_buffer->size());
-  CodedInputStream pb_stream(wrapped_buffer->data(), buffer_length);
-
-  pb_stream.SetTotalBytesLimit(buffer_length);
-
-  // This is the bytes remaining when using CodedInputStream like this
-  while (pb_stream.BytesUntilTotalBytesLimit()) {
-    const uint32_t tag = pb_stream.ReadTag();
+  out->body_chunks.clear();
+
+  // For large messages, the ByteBuffer is made of many slices. Rather than
+  // reassembling them, the body is kept as a list of slices, which the IPC
+  // reader consumes without copying (except for Arrow buffers straddling
+  // a slice boundary).
+  BufferVector slices;
+  GRPC_RETURN_NOT_OK(GrpcBuffer::WrapSlices(buffer, &slices));
+
+  ChunkedWireReader reader(slices);
+  while (!reader.AtEnd()) {
+    uint32_t tag;
+    if (!reader.ReadVarint32(&tag)) {
+      return grpc::Status(grpc::StatusCode::INTERNAL, "Unable to parse FlightData tag");
+    }
     const int field_number = WireFormatLite::GetTagFieldNumber(tag);
+    BufferVector field;
     switch (field_number) {
       case pb::FlightData::kFlightDescriptorFieldNumber: {
-        pb::FlightDescriptor pb_descriptor;
-        uint32_t length;
-        if (!pb_stream.ReadVarint32(&length)) {
+        std::shared_ptr<Buffer> descriptor_data;
+        if (!reader.ReadLengthDelimited(&field)) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
                               "Unable to parse length of FlightDescriptor");
         }
-        // Can't use ParseFromCodedStream as this reads the entire
-        // rest of the stream into the descriptor command field.
-        std::string buffer;
-        pb_stream.ReadString(&buffer, length);
-        if (!pb_descriptor.ParseFromString(buffer)) {
+        GRPC_RETURN_NOT_OK(MakeContiguous(field, &descriptor_data));
+        pb::FlightDescriptor pb_descriptor;
+        if (!pb_descriptor.ParseFromArray(descriptor_data->data(),
+                                          static_cast<int>(descriptor_data->size()))) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
                               "Unable to parse FlightDescriptor");
         }
@@ -350,25 +420,33 @@ grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
         out->descriptor.reset(new arrow::flight::FlightDescriptor(descriptor));
       } break;
       case pb::FlightData::kDataHeaderFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->metadata)) {
+        if (!reader.ReadLengthDelimited(&field)) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
                               "Unable to read FlightData metadata");
         }
+        GRPC_RETURN_NOT_OK(MakeContiguous(field, &out->metadata));
       } break;
       case pb::FlightData::kAppMetadataFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->app_metadata)) {
+        if (!reader.ReadLengthDelimited(&field)) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
                               "Unable to read FlightData application metadata");
         }
+        GRPC_RETURN_NOT_OK(MakeContiguous(field, &out->app_metadata));
       } break;
       case pb::FlightData::kDataBodyFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->body)) {
+        if (!reader.ReadLengthDelimited(&field)) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
                               "Unable to read FlightData body");
         }
+        if (field.size() > 1) {
+          out->body_chunks = std::move(field);
+        } else {
+          GRPC_RETURN_NOT_OK(MakeContiguous(field, &out->body));
+        }
       } break;
       default:
-        DCHECK(false) << "cannot happen";
+        return grpc::Status(grpc::StatusCode::INTERNAL,
+                            "Unexpected field in FlightData");
     }
   }
   buffer->Clear();
@@ -380,6 +458,9 @@ grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
 }
 
 ::arrow::Result<std::unique_ptr<ipc::Message>> FlightData::OpenMessage() {
+  if (!body_chunks.empty()) {
+    return ipc::Message::Open(metadata, body_chunks);
+  }
   return ipc::Message::Open(metadata, body);
 }
 
@@ -426,6 +507,18 @@ bool WritePayload(const FlightPayload& payload,
                        grpc::WriteOptions());
 }
 
+Status WritePayload(const FlightPayload& payload,
+                    grpc::ServerAsyncWriter<pb::FlightData>* writer, void* tag) {
+  // Asynchronous writes abort on serialization errors, so check for the
+  // only expected one beforehand
+  if (payload.ipc_message.body_length > kInt32Max) {
+    return Status::CapacityError("Cannot send record batches exceeding 2GB yet");
+  }
+  // Pretend to be pb::FlightData and intercept in SerializationTraits
+  writer->Write(*reinterpret_cast<const pb::FlightData*>(&payload), tag);
+  return Status::OK();
+}
+
 bool ReadPayload(grpc::ClientReader<pb::FlightData>* reader, FlightData* data) {
   // Pretend to be pb::FlightData and intercept in SerializationTraits
   return reader->Read(reinterpret_cast<pb::FlightData*>(data));
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "arrow/flight/internal.h"
 #include "arrow/flight/types.h"
@@ -49,6 +50,10 @@ struct FlightData {
   /// Message body
   std::shared_ptr<Buffer> body;
 
+  /// Message body, if received split across several gRPC slices (body is
+  /// then null)
+  std::vector<std::shared_ptr<Buffer>> body_chunks;
+
   /// Open IPC message from the metadata and body
   ::arrow::Result<std::unique_ptr<ipc::Message>> OpenMessage();
 };
@@ -63,6 +68,10 @@ bool WritePayload(const FlightPayload& payload,
                   grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer);
 bool WritePayload(const FlightPayload& payload,
                   grpc::ServerWriter<pb::FlightData>* writer);
+/// Start writing a Flight message on an asynchronous gRPC stream.
+/// `tag` is returned by the completion queue once the message is written.
+Status WritePayload(const FlightPayload& payload,
+                    grpc::ServerAsyncWriter<pb::FlightData>* writer, void* tag);
 
 /// Read Flight message from gRPC stream with zero-copy optimizations.
 /// True is returned on success, false if stream ended.
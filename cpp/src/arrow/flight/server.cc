@@ -20,11 +20,17 @@
 
 #include "arrow/flight/server.h"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 
@@ -43,7 +49,10 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/util/io_util.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/stopwatch.h"
+#include "arrow/util/string_view.h"
 #include "arrow/util/uri.h"
 
 #include "arrow/flight/internal.h"
@@ -52,6 +61,7 @@
 #include "arrow/flight/serialization_internal.h"
 #include "arrow/flight/server_auth.h"
 #include "arrow/flight/server_middleware.h"
+#include "arrow/flight/shared_memory_internal.h"
 #include "arrow/flight/types.h"
 
 using FlightService = arrow::flight::protocol::FlightService;
@@ -90,6 +100,9 @@ namespace flight {
 
 namespace {
 
+// The index of DoGet() in the FlightService definition (see Flight.proto)
+constexpr int kDoGetMethodIndex = 4;
+
 // A MessageReader implementation that reads from a gRPC ServerReader.
 // Templated to be generic over DoPut/DoExchange.
 template <typename Reader>
@@ -272,13 +285,169 @@ class GrpcServerAuthSender : public ServerAuthSender {
   grpc::ServerReaderWriter<pb::HandshakeResponse, pb::HandshakeRequest>* stream_;
 };
 
+// The size of a payload, as accounted in ServerStreamStats
+int64_t PayloadSize(const FlightPayload& payload) {
+  int64_t size = payload.ipc_message.body_length;
+  if (payload.ipc_message.metadata) {
+    size += payload.ipc_message.metadata->size();
+  }
+  if (payload.app_metadata) {
+    size += payload.app_metadata->size();
+  }
+  return size;
+}
+
+// Account for a message written to a DoGet() or DoExchange() stream
+void RecordWrite(int64_t size, uint64_t stall_ns, ServerStreamStats* stats) {
+  ++stats->messages_written;
+  stats->bytes_written += size;
+  stats->max_queued_bytes = std::max(stats->max_queued_bytes, size);
+  stats->write_stall_time += std::chrono::nanoseconds(stall_ns);
+}
+
+/// A FlightDataStream producing the payloads of another stream on a
+/// separate thread, ahead of their consumer, until a number of bytes are
+/// queued (FlightServerOptions::max_queued_bytes_per_stream).
+class ReadAheadDataStream : public FlightDataStream {
+ public:
+  ReadAheadDataStream(std::unique_ptr<FlightDataStream> stream, int64_t max_queued_bytes)
+      : stream_(std::move(stream)), max_queued_bytes_(max_queued_bytes) {}
+
+  ~ReadAheadDataStream() override { Stop(); }
+
+  std::shared_ptr<Schema> schema() override { return stream_->schema(); }
+
+  Status GetSchemaPayload(FlightPayload* payload) override {
+    return stream_->GetSchemaPayload(payload);
+  }
+
+  Status Next(FlightPayload* payload) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!producer_.joinable()) {
+      producer_ = std::thread([this]() { Produce(); });
+    }
+    // The previous payload has been written by now
+    queued_bytes_ -= consumed_bytes_;
+    consumed_bytes_ = 0;
+    cv_.notify_all();
+    cv_.wait(lock, [this]() { return !queue_.empty() || finished_; });
+    if (queue_.empty()) {
+      *payload = FlightPayload();
+      return status_;
+    }
+    *payload = std::move(queue_.front());
+    queue_.pop_front();
+    consumed_bytes_ = PayloadSize(*payload);
+    return Status::OK();
+  }
+
+  /// Stop producing, waiting for a pending Next() call on the underlying
+  /// stream to return
+  void Stop() {
+    if (!producer_.joinable()) {
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopped_ = true;
+    }
+    cv_.notify_all();
+    producer_.join();
+  }
+
+  /// Fill the producer side of the statistics, after Stop()
+  void GetStats(ServerStreamStats* stats) const {
+    stats->produce_time = produce_time_;
+    stats->max_queued_bytes = std::max(stats->max_queued_bytes, max_queued_bytes_seen_);
+  }
+
+ private:
+  void Produce() {
+    ::arrow::internal::StopWatch watch;
+    while (true) {
+      FlightPayload payload;
+      watch.Start();
+      Status status = stream_->Next(&payload);
+      const auto elapsed = std::chrono::nanoseconds(watch.Stop());
+
+      std::unique_lock<std::mutex> lock(mutex_);
+      produce_time_ += elapsed;
+      if (!status.ok() || payload.ipc_message.metadata == nullptr) {
+        status_ = std::move(status);
+        finished_ = true;
+        cv_.notify_all();
+        return;
+      }
+      queued_bytes_ += PayloadSize(payload);
+      max_queued_bytes_seen_ = std::max(max_queued_bytes_seen_, queued_bytes_);
+      queue_.push_back(std::move(payload));
+      cv_.notify_all();
+      cv_.wait(lock, [this]() { return queued_bytes_ < max_queued_bytes_ || stopped_; });
+      if (stopped_) {
+        return;
+      }
+    }
+  }
+
+  std::unique_ptr<FlightDataStream> stream_;
+  const int64_t max_queued_bytes_;
+  std::thread producer_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<FlightPayload> queue_;
+  // Bytes queued, including the payload being written by the consumer
+  int64_t queued_bytes_ = 0;
+  int64_t consumed_bytes_ = 0;
+  int64_t max_queued_bytes_seen_ = 0;
+  std::chrono::nanoseconds produce_time_{0};
+  Status status_;
+  bool finished_ = false;
+  bool stopped_ = false;
+};
+
+/// An IpcPayloadWriter that queues payloads, so that we can reuse the IPC
+/// stream writer's handling of dictionaries (replacements and deltas).
+/// Schema payloads are skipped, as Flight sends the schema separately.
+class PayloadQueueWriter : public ipc::internal::IpcPayloadWriter {
+ public:
+  explicit PayloadQueueWriter(std::deque<ipc::IpcPayload>* queue) : queue_(queue) {}
+
+  Status WritePayload(const ipc::IpcPayload& payload) override {
+    if (payload.type != ipc::MessageType::SCHEMA) {
+      queue_->push_back(payload);
+    }
+    return Status::OK();
+  }
+
+  Status Close() override { return Status::OK(); }
+
+ private:
+  std::deque<ipc::IpcPayload>* queue_;
+};
+
+Status OpenQueueingWriter(const std::shared_ptr<Schema>& schema,
+                          const ipc::IpcWriteOptions& options,
+                          std::deque<ipc::IpcPayload>* queue,
+                          std::unique_ptr<ipc::RecordBatchWriter>* out) {
+  std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(
+      new PayloadQueueWriter(queue));
+  return ipc::internal::OpenRecordBatchWriter(std::move(payload_writer), schema, options)
+      .Value(out);
+}
+
 /// The implementation of the write side of a bidirectional FlightData
 /// stream for DoExchange.
 class DoExchangeMessageWriter : public FlightMessageWriter {
  public:
-  explicit DoExchangeMessageWriter(
-      grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* stream)
-      : stream_(stream), ipc_options_(::arrow::ipc::IpcWriteOptions::Defaults()) {}
+  DoExchangeMessageWriter(
+      grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* stream,
+      const ipc::IpcWriteOptions& default_options, ServerStreamStats* stats)
+      : stream_(stream), default_options_(default_options), stats_(stats) {}
+
+  /// Begin with the IPC options negotiated with the client
+  Status Begin(const std::shared_ptr<Schema>& schema) override {
+    return Begin(schema, default_options_);
+  }
 
   Status Begin(const std::shared_ptr<Schema>& schema,
                const ipc::IpcWriteOptions& options) override {
@@ -286,12 +455,12 @@ class DoExchangeMessageWriter : public FlightMessageWriter {
       return Status::Invalid("This writer has already been started.");
     }
     started_ = true;
-    ipc_options_ = options;
 
-    RETURN_NOT_OK(mapper_.AddSchemaFields(*schema));
+    ipc::DictionaryFieldMapper mapper(*schema);
     FlightPayload schema_payload;
-    RETURN_NOT_OK(ipc::GetSchemaPayload(*schema, ipc_options_, mapper_,
-                                        &schema_payload.ipc_message));
+    RETURN_NOT_OK(
+        ipc::GetSchemaPayload(*schema, options, mapper, &schema_payload.ipc_message));
+    RETURN_NOT_OK(OpenQueueingWriter(schema, options, &queue_, &batch_writer_));
     return WritePayload(schema_payload);
   }
 
@@ -308,13 +477,21 @@ class DoExchangeMessageWriter : public FlightMessageWriter {
   Status WriteWithMetadata(const RecordBatch& batch,
                            std::shared_ptr<Buffer> app_metadata) override {
     RETURN_NOT_OK(CheckStarted());
-    RETURN_NOT_OK(EnsureDictionariesWritten(batch));
-    FlightPayload payload{};
-    if (app_metadata) {
-      payload.app_metadata = app_metadata;
+    // Queues any new, replaced or delta dictionaries, then the batch
+    watch_.Start();
+    RETURN_NOT_OK(batch_writer_->WriteRecordBatch(batch));
+    stats_->produce_time += std::chrono::nanoseconds(watch_.Stop());
+    while (!queue_.empty()) {
+      FlightPayload payload{};
+      payload.ipc_message = std::move(queue_.front());
+      queue_.pop_front();
+      if (queue_.empty() && app_metadata) {
+        // Attach metadata to the record batch
+        payload.app_metadata = app_metadata;
+      }
+      RETURN_NOT_OK(WritePayload(payload));
     }
-    RETURN_NOT_OK(ipc::GetRecordBatchPayload(batch, ipc_options_, &payload.ipc_message));
-    return WritePayload(payload);
+    return Status::OK();
   }
 
   Status Close() override {
@@ -324,10 +501,12 @@ class DoExchangeMessageWriter : public FlightMessageWriter {
 
  private:
   Status WritePayload(const FlightPayload& payload) {
+    watch_.Start();
     if (!internal::WritePayload(payload, stream_)) {
       // gRPC doesn't give us any way to find what the error was (if any).
       return Status::IOError("Could not write payload to stream");
     }
+    RecordWrite(PayloadSize(payload), watch_.Stop(), stats_);
     return Status::OK();
   }
 
@@ -338,29 +517,16 @@ class DoExchangeMessageWriter : public FlightMessageWriter {
     return Status::OK();
   }
 
-  Status EnsureDictionariesWritten(const RecordBatch& batch) {
-    if (dictionaries_written_) {
-      return Status::OK();
-    }
-    dictionaries_written_ = true;
-    ARROW_ASSIGN_OR_RAISE(const auto dictionaries,
-                          ipc::CollectDictionaries(batch, mapper_));
-    for (const auto& pair : dictionaries) {
-      FlightPayload payload{};
-      RETURN_NOT_OK(ipc::GetDictionaryPayload(pair.first, pair.second, ipc_options_,
-                                              &payload.ipc_message));
-      RETURN_NOT_OK(WritePayload(payload));
-    }
-    return Status::OK();
-  }
-
   grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* stream_;
-  ::arrow::ipc::IpcWriteOptions ipc_options_;
-  ipc::DictionaryFieldMapper mapper_;
+  const ipc::IpcWriteOptions default_options_;
+  ServerStreamStats* stats_;
+  ::arrow::internal::StopWatch watch_;
+  std::unique_ptr<ipc::RecordBatchWriter> batch_writer_;
+  std::deque<ipc::IpcPayload> queue_;
   bool started_ = false;
-  bool dictionaries_written_ = false;
 };
 
+class AsyncDoGetCall;
 class FlightServiceImpl;
 class GrpcServerCallContext : public ServerCallContext {
   explicit GrpcServerCallContext(grpc::ServerContext* context)
@@ -379,6 +545,9 @@ class GrpcServerCallContext : public ServerCallContext {
 
   grpc::Status FinishRequest(const arrow::Status& status) {
     for (const auto& instance : middleware_) {
+      if (stream_stats_ != nullptr) {
+        instance->StreamCompleted(*stream_stats_);
+      }
       instance->CallCompleted(status);
     }
 
@@ -395,13 +564,21 @@ class GrpcServerCallContext : public ServerCallContext {
     return instance->second.get();
   }
 
+  const ipc::IpcWriteOptions& negotiated_write_options() const override {
+    return write_options_;
+  }
+
  private:
+  friend class AsyncDoGetCall;
   friend class FlightServiceImpl;
   ServerContext* context_;
   std::string peer_;
   std::string peer_identity_;
+  ipc::IpcWriteOptions write_options_ = ipc::IpcWriteOptions::Defaults();
   std::vector<std::shared_ptr<ServerMiddleware>> middleware_;
   std::unordered_map<std::string, std::shared_ptr<ServerMiddleware>> middleware_map_;
+  // Set for DoGet() and DoExchange() calls, once the stream is started
+  const ServerStreamStats* stream_stats_ = nullptr;
 };
 
 class GrpcAddCallHeaders : public AddCallHeaders {
@@ -417,6 +594,20 @@ class GrpcAddCallHeaders : public AddCallHeaders {
   grpc::ServerContext* context_;
 };
 
+// Whether a comma-separated list contains the given item
+bool ListContains(util::string_view list, util::string_view item) {
+  while (true) {
+    const auto pos = list.find(',');
+    if (list.substr(0, pos) == item) {
+      return true;
+    }
+    if (pos == util::string_view::npos) {
+      return false;
+    }
+    list = list.substr(pos + 1);
+  }
+}
+
 // This class glues an implementation of FlightServerBase together with the
 // gRPC service definition, so the latter is not exposed in the public API
 class FlightServiceImpl : public FlightService::Service {
@@ -425,8 +616,22 @@ class FlightServiceImpl : public FlightService::Service {
       std::shared_ptr<ServerAuthHandler> auth_handler,
       std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
           middleware,
+      std::vector<std::shared_ptr<util::Codec>> ipc_codecs, bool ipc_dictionary_deltas,
+      bool shared_memory, bool async_do_get, int64_t max_queued_bytes_per_stream,
       FlightServerBase* server)
-      : auth_handler_(auth_handler), middleware_(middleware), server_(server) {}
+      : auth_handler_(auth_handler),
+        middleware_(middleware),
+        ipc_codecs_(std::move(ipc_codecs)),
+        ipc_dictionary_deltas_(ipc_dictionary_deltas),
+        shared_memory_(shared_memory),
+        max_queued_bytes_per_stream_(max_queued_bytes_per_stream),
+        server_(server) {
+    if (async_do_get) {
+      // DoGet() calls are requested with RequestDoGet() instead of
+      // running DoGet() below
+      MarkMethodAsync(kDoGetMethodIndex);
+    }
+  }
 
   template <typename UserType, typename Iterator, typename ProtoType>
   grpc::Status WriteStream(Iterator* iterator, ServerWriter<ProtoType>* writer) {
@@ -488,9 +693,63 @@ class FlightServiceImpl : public FlightService::Service {
     return MakeCallContext(method, context, flight_context);
   }
 
+  // Choose IPC options for data sent to the client, given the
+  // capabilities it advertised
+  void NegotiateWriteOptions(ServerContext* context,
+                             GrpcServerCallContext& flight_context) {
+    const auto& client_metadata = context->client_metadata();
+    auto& options = flight_context.write_options_;
+
+    const auto compression_header =
+        client_metadata.find(internal::kIpcAcceptCompressionHeader);
+    if (!ipc_codecs_.empty() && compression_header != client_metadata.end()) {
+      const util::string_view accepted(compression_header->second.data(),
+                                       compression_header->second.length());
+      // The first codec in server preference order which the client accepts
+      for (const auto& codec : ipc_codecs_) {
+        if (ListContains(accepted, codec->name())) {
+          options.codec = codec;
+          break;
+        }
+      }
+    }
+
+    const auto deltas_header =
+        client_metadata.find(internal::kIpcAcceptDictionaryDeltasHeader);
+    options.emit_dictionary_deltas = ipc_dictionary_deltas_ &&
+                                     deltas_header != client_metadata.end() &&
+                                     deltas_header->second == "1";
+  }
+
+  // Open the shared memory segment passed by a co-located client, if any.
+  // nullptr is returned, and bodies are sent over gRPC, if the segment
+  // can't be used.
+  std::unique_ptr<internal::SharedMemoryBodyWriter> OpenSharedMemoryWriter(
+      ServerContext* context) {
+    if (!shared_memory_) {
+      return nullptr;
+    }
+    const auto& client_metadata = context->client_metadata();
+    const auto segment_header = client_metadata.find(internal::kShmSegmentHeader);
+    if (segment_header == client_metadata.end()) {
+      return nullptr;
+    }
+    auto maybe_writer = internal::SharedMemoryBodyWriter::Open(
+        std::string(segment_header->second.data(), segment_header->second.length()));
+    if (!maybe_writer.ok()) {
+      ARROW_LOG(DEBUG) << "Not using shared memory: " << maybe_writer.status();
+      return nullptr;
+    }
+    // Sent along with the first message
+    context->AddInitialMetadata(internal::kShmBodiesHeader, "1");
+    return maybe_writer.MoveValueUnsafe();
+  }
+
   // Authenticate the client (if applicable) and construct the call context
   grpc::Status MakeCallContext(const FlightMethod& method, ServerContext* context,
                                GrpcServerCallContext& flight_context) {
+    NegotiateWriteOptions(context, flight_context);
+
     // Run server middleware
     const CallInfo info{method};
     CallHeaders incoming_headers;
@@ -611,45 +870,122 @@ class FlightServiceImpl : public FlightService::Service {
     RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status::OK);
   }
 
-  grpc::Status DoGet(ServerContext* context, const pb::Ticket* request,
-                     ServerWriter<pb::FlightData>* writer) {
-    GrpcServerCallContext flight_context(context);
+  // Set up a DoGet() call, up to computing the schema payload.  If an
+  // error is returned, it has already been passed to the middleware.
+  grpc::Status StartDoGet(ServerContext* context, const pb::Ticket& request,
+                          GrpcServerCallContext& flight_context,
+                          std::unique_ptr<FlightDataStream>* data_stream,
+                          std::unique_ptr<internal::SharedMemoryBodyWriter>* shm_writer,
+                          FlightPayload* schema_payload) {
     GRPC_RETURN_NOT_GRPC_OK(CheckAuth(FlightMethod::DoGet, context, flight_context));
 
-    CHECK_ARG_NOT_NULL(flight_context, request, "ticket cannot be null");
-
     Ticket ticket;
-    SERVICE_RETURN_NOT_OK(flight_context, internal::FromProto(*request, &ticket));
+    SERVICE_RETURN_NOT_OK(flight_context, internal::FromProto(request, &ticket));
 
-    std::unique_ptr<FlightDataStream> data_stream;
     SERVICE_RETURN_NOT_OK(flight_context,
-                          server_->DoGet(flight_context, ticket, &data_stream));
+                          server_->DoGet(flight_context, ticket, data_stream));
 
-    if (!data_stream) {
+    if (!*data_stream) {
       RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status(grpc::StatusCode::NOT_FOUND,
                                                           "No data in this flight"));
     }
 
-    // Write the schema as the first message in the stream
+    *shm_writer = OpenSharedMemoryWriter(context);
+
+    SERVICE_RETURN_NOT_OK(flight_context,
+                          (*data_stream)->GetSchemaPayload(schema_payload));
+    return grpc::Status::OK;
+  }
+
+  // Request the next asynchronous DoGet() call on the completion queue
+  void RequestDoGet(ServerContext* context, pb::Ticket* request,
+                    grpc::ServerAsyncWriter<pb::FlightData>* writer,
+                    grpc::ServerCompletionQueue* cq, void* tag) {
+    RequestAsyncServerStreaming(kDoGetMethodIndex, context, request, writer, cq, cq,
+                                tag);
+  }
+
+  grpc::Status DoGet(ServerContext* context, const pb::Ticket* request,
+                     ServerWriter<pb::FlightData>* writer) {
+    GrpcServerCallContext flight_context(context);
+    if (request == nullptr) {
+      GRPC_RETURN_NOT_GRPC_OK(CheckAuth(FlightMethod::DoGet, context, flight_context));
+      RETURN_WITH_MIDDLEWARE(flight_context,
+                             grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                                          "ticket cannot be null"));
+    }
+
+    std::unique_ptr<FlightDataStream> data_stream;
+    std::unique_ptr<internal::SharedMemoryBodyWriter> shm_writer;
     FlightPayload schema_payload;
-    SERVICE_RETURN_NOT_OK(flight_context, data_stream->GetSchemaPayload(&schema_payload));
-    if (!internal::WritePayload(schema_payload, writer)) {
+    GRPC_RETURN_NOT_GRPC_OK(StartDoGet(context, *request, flight_context, &data_stream,
+                                       &shm_writer, &schema_payload));
+
+    ServerStreamStats stats;
+    const Status status = WriteDataStream(std::move(data_stream), schema_payload,
+                                          shm_writer.get(), writer, &stats);
+    flight_context.stream_stats_ = &stats;
+    RETURN_WITH_MIDDLEWARE(flight_context, status);
+  }
+
+  // Write out the payloads of a synchronous DoGet() call
+  Status WriteDataStream(std::unique_ptr<FlightDataStream> data_stream,
+                         const FlightPayload& schema_payload,
+                         internal::SharedMemoryBodyWriter* shm_writer,
+                         ServerWriter<pb::FlightData>* writer, ServerStreamStats* stats) {
+    ::arrow::internal::StopWatch watch;
+    auto write = [&](const FlightPayload& payload) {
+      watch.Start();
+      if (!internal::WritePayload(payload, writer)) {
+        return false;
+      }
+      RecordWrite(PayloadSize(payload), watch.Stop(), stats);
+      return true;
+    };
+
+    // Write the schema as the first message in the stream
+    if (!write(schema_payload)) {
       // gRPC doesn't give any way for us to know why the message
       // could not be written.
-      RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status::OK);
+      return Status::OK();
+    }
+
+    ReadAheadDataStream* read_ahead = nullptr;
+    if (max_queued_bytes_per_stream_ > 0) {
+      read_ahead =
+          new ReadAheadDataStream(std::move(data_stream), max_queued_bytes_per_stream_);
+      data_stream.reset(read_ahead);
     }
 
     // Consume data stream and write out payloads
+    Status status;
     while (true) {
       FlightPayload payload;
-      SERVICE_RETURN_NOT_OK(flight_context, data_stream->Next(&payload));
-      if (payload.ipc_message.metadata == nullptr ||
-          !internal::WritePayload(payload, writer))
-        // No more messages to write, or connection terminated for some other
-        // reason
+      watch.Start();
+      status = data_stream->Next(&payload);
+      if (read_ahead == nullptr) {
+        stats->produce_time += std::chrono::nanoseconds(watch.Stop());
+      }
+      if (!status.ok() || payload.ipc_message.metadata == nullptr) {
+        // Error, or no more messages to write
+        break;
+      }
+      if (shm_writer) {
+        status = shm_writer->Rewrite(&payload.ipc_message);
+        if (!status.ok()) {
+          break;
+        }
+      }
+      if (!write(payload)) {
+        // Connection terminated for some other reason
         break;
+      }
     }
-    RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status::OK);
+    if (read_ahead != nullptr) {
+      read_ahead->Stop();
+      read_ahead->GetStats(stats);
+    }
+    return status;
   }
 
   grpc::Status DoPut(ServerContext* context,
@@ -675,8 +1011,10 @@ class FlightServiceImpl : public FlightService::Service {
     auto message_reader = std::unique_ptr<FlightMessageReaderImpl<pb::FlightData>>(
         new FlightMessageReaderImpl<pb::FlightData>(stream));
     SERVICE_RETURN_NOT_OK(flight_context, message_reader->Init());
-    auto writer =
-        std::unique_ptr<DoExchangeMessageWriter>(new DoExchangeMessageWriter(stream));
+    ServerStreamStats stats;
+    flight_context.stream_stats_ = &stats;
+    auto writer = std::unique_ptr<DoExchangeMessageWriter>(new DoExchangeMessageWriter(
+        stream, flight_context.negotiated_write_options(), &stats));
     RETURN_WITH_MIDDLEWARE(flight_context,
                            server_->DoExchange(flight_context, std::move(message_reader),
                                                std::move(writer)));
@@ -730,9 +1068,131 @@ class FlightServiceImpl : public FlightService::Service {
   std::shared_ptr<ServerAuthHandler> auth_handler_;
   std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
       middleware_;
+  std::vector<std::shared_ptr<util::Codec>> ipc_codecs_;
+  bool ipc_dictionary_deltas_;
+  bool shared_memory_;
+  int64_t max_queued_bytes_per_stream_;
   FlightServerBase* server_;
 };
 
+// An asynchronous DoGet() call (FlightServerOptions::num_async_threads).
+//
+// At most one operation is pending at any time: either a gRPC operation,
+// whose completion is passed to Proceed() by a completion queue thread, or
+// a FlightDataStream::NextAsync() future.  The instance deletes itself once
+// the call is finished.
+class AsyncDoGetCall {
+ public:
+  AsyncDoGetCall(FlightServiceImpl* service, grpc::ServerCompletionQueue* cq)
+      : service_(service),
+        cq_(cq),
+        writer_(&context_),
+        state_(State::kRequested) {
+    service_->RequestDoGet(&context_, &request_, &writer_, cq_, this);
+  }
+
+  void Proceed(bool ok) {
+    switch (state_) {
+      case State::kRequested:
+        if (!ok) {
+          // The server is shutting down
+          delete this;
+          return;
+        }
+        // Be ready for the next call
+        new AsyncDoGetCall(service_, cq_);
+        Start();
+        break;
+      case State::kWriting:
+        if (!ok) {
+          // Connection terminated for some other reason
+          Finish(flight_context_->FinishRequest(grpc::Status::OK));
+          return;
+        }
+        RecordWrite(pending_bytes_, watch_.Stop(), &stats_);
+        WriteNext();
+        break;
+      case State::kFinishing:
+        delete this;
+        break;
+    }
+  }
+
+ private:
+  enum class State { kRequested, kWriting, kFinishing };
+
+  void Start() {
+    // The context can only be inspected once the call is started
+    flight_context_.reset(new GrpcServerCallContext(&context_));
+    FlightPayload schema_payload;
+    const auto status = service_->StartDoGet(&context_, request_, *flight_context_,
+                                             &data_stream_, &shm_writer_,
+                                             &schema_payload);
+    if (!status.ok()) {
+      Finish(status);
+      return;
+    }
+    flight_context_->stream_stats_ = &stats_;
+    // Write the schema as the first message in the stream
+    Write(schema_payload);
+  }
+
+  void Write(const FlightPayload& payload) {
+    state_ = State::kWriting;
+    pending_bytes_ = PayloadSize(payload);
+    watch_.Start();
+    const auto status = internal::WritePayload(payload, &writer_, this);
+    if (!status.ok()) {
+      Finish(flight_context_->FinishRequest(status));
+    }
+  }
+
+  void WriteNext() {
+    auto on_payload = [this](const arrow::Result<FlightPayload>& result) {
+      stats_.produce_time += std::chrono::nanoseconds(watch_.Stop());
+      if (!result.ok()) {
+        Finish(flight_context_->FinishRequest(result.status()));
+        return;
+      }
+      FlightPayload payload = *result;
+      if (payload.ipc_message.metadata == nullptr) {
+        // No more messages to write
+        Finish(flight_context_->FinishRequest(grpc::Status::OK));
+        return;
+      }
+      if (shm_writer_) {
+        const auto status = shm_writer_->Rewrite(&payload.ipc_message);
+        if (!status.ok()) {
+          Finish(flight_context_->FinishRequest(status));
+          return;
+        }
+      }
+      Write(payload);
+    };
+    watch_.Start();
+    data_stream_->NextAsync().AddCallback(std::move(on_payload));
+  }
+
+  void Finish(const grpc::Status& status) {
+    state_ = State::kFinishing;
+    writer_.Finish(status, this);
+  }
+
+  FlightServiceImpl* service_;
+  grpc::ServerCompletionQueue* cq_;
+  ServerContext context_;
+  pb::Ticket request_;
+  grpc::ServerAsyncWriter<pb::FlightData> writer_;
+  std::unique_ptr<GrpcServerCallContext> flight_context_;
+  std::unique_ptr<FlightDataStream> data_stream_;
+  std::unique_ptr<internal::SharedMemoryBodyWriter> shm_writer_;
+  State state_;
+  ServerStreamStats stats_;
+  ::arrow::internal::StopWatch watch_;
+  // The size of the payload being written
+  int64_t pending_bytes_ = 0;
+};
+
 }  // namespace
 
 FlightMetadataWriter::~FlightMetadataWriter() = default;
@@ -750,6 +1210,10 @@ using ::arrow::internal::SignalHandler;
 
 struct FlightServerBase::Impl {
   std::unique_ptr<FlightServiceImpl> service_;
+  // Completion queues for asynchronous DoGet(), which must outlive the server
+  std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> completion_queues_;
+  std::vector<std::thread> async_threads_;
+  bool async_stopped_ = false;
   std::unique_ptr<grpc::Server> server_;
   int port_;
 #ifdef _WIN32
@@ -777,6 +1241,52 @@ struct FlightServerBase::Impl {
     got_signal_ = signum;
     server_->Shutdown();
   }
+
+  ~Impl() {
+    if (server_) {
+      server_->Shutdown();
+    }
+    StopAsyncThreads();
+  }
+
+  void StartAsyncThreads() {
+    for (const auto& cq : completion_queues_) {
+      auto cq_ptr = cq.get();
+      new AsyncDoGetCall(service_.get(), cq_ptr);
+      async_threads_.emplace_back([cq_ptr] {
+        void* tag;
+        bool ok;
+        while (cq_ptr->Next(&tag, &ok)) {
+          static_cast<AsyncDoGetCall*>(tag)->Proceed(ok);
+        }
+      });
+    }
+  }
+
+  // Must be called after the server is shut down, which waits for all
+  // calls to be finished
+  void StopAsyncThreads() {
+    if (async_stopped_) {
+      return;
+    }
+    async_stopped_ = true;
+    for (const auto& cq : completion_queues_) {
+      cq->Shutdown();
+    }
+    if (async_threads_.empty()) {
+      // Not started, drain the queues here
+      for (const auto& cq : completion_queues_) {
+        void* tag;
+        bool ok;
+        while (cq->Next(&tag, &ok)) {
+        }
+      }
+    }
+    for (auto& thread : async_threads_) {
+      thread.join();
+    }
+    async_threads_.clear();
+  }
 };
 
 #ifdef _WIN32
@@ -793,24 +1303,42 @@ FlightServerOptions::FlightServerOptions(const Location& location_)
       verify_client(false),
       root_certificates(),
       middleware(),
-      builder_hook(nullptr) {}
+      builder_hook(nullptr),
+      ipc_compression(),
+      ipc_dictionary_deltas(false),
+      num_async_threads(0),
+      max_queued_bytes_per_stream(0) {}
 
 FlightServerOptions::~FlightServerOptions() = default;
 
+const ipc::IpcWriteOptions& ServerCallContext::negotiated_write_options() const {
+  static const auto options = ipc::IpcWriteOptions::Defaults();
+  return options;
+}
+
 FlightServerBase::FlightServerBase() { impl_.reset(new Impl); }
 
 FlightServerBase::~FlightServerBase() {}
 
 Status FlightServerBase::Init(const FlightServerOptions& options) {
-  impl_->service_.reset(
-      new FlightServiceImpl(options.auth_handler, options.middleware, this));
+  std::vector<std::shared_ptr<util::Codec>> ipc_codecs;
+  for (const auto compression : options.ipc_compression) {
+    RETURN_NOT_OK(ipc::internal::CheckCompressionSupported(compression));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<util::Codec> codec,
+                          util::Codec::Create(compression));
+    ipc_codecs.push_back(std::move(codec));
+  }
+  const Location& location = options.location;
+  const std::string scheme = location.scheme();
+  impl_->service_.reset(new FlightServiceImpl(
+      options.auth_handler, options.middleware, std::move(ipc_codecs),
+      options.ipc_dictionary_deltas, scheme == kSchemeGrpcShm,
+      options.num_async_threads > 0, options.max_queued_bytes_per_stream, this));
 
   grpc::ServerBuilder builder;
   // Allow uploading messages of any length
   builder.SetMaxReceiveMessageSize(-1);
 
-  const Location& location = options.location;
-  const std::string scheme = location.scheme();
   if (scheme == kSchemeGrpc || scheme == kSchemeGrpcTcp || scheme == kSchemeGrpcTls) {
     std::stringstream address;
     address << location.uri_->host() << ':' << location.uri_->port_text();
@@ -834,7 +1362,7 @@ Status FlightServerBase::Init(const FlightServerOptions& options) {
     }
 
     builder.AddListeningPort(address.str(), creds, &impl_->port_);
-  } else if (scheme == kSchemeGrpcUnix) {
+  } else if (scheme == kSchemeGrpcUnix || scheme == kSchemeGrpcShm) {
     std::stringstream address;
     address << "unix:" << location.uri_->path();
     builder.AddListeningPort(address.str(), grpc::InsecureServerCredentials());
@@ -852,10 +1380,15 @@ Status FlightServerBase::Init(const FlightServerOptions& options) {
     options.builder_hook(&builder);
   }
 
+  for (int i = 0; i < options.num_async_threads; ++i) {
+    impl_->completion_queues_.push_back(builder.AddCompletionQueue());
+  }
+
   impl_->server_ = builder.BuildAndStart();
   if (!impl_->server_) {
     return Status::UnknownError("Server did not start properly");
   }
+  impl_->StartAsyncThreads();
   return Status::OK();
 }
 
@@ -903,6 +1436,7 @@ Status FlightServerBase::Shutdown() {
     return Status::Invalid("Shutdown() on uninitialized FlightServerBase");
   }
   impl_->server_->Shutdown();
+  impl_->StopAsyncThreads();
   return Status::OK();
 }
 
@@ -962,13 +1496,6 @@ Status FlightServerBase::GetSchema(const ServerCallContext& context,
 
 class RecordBatchStream::RecordBatchStreamImpl {
  public:
-  // Stages of the stream when producing payloads
-  enum class Stage {
-    NEW,          // The stream has been created, but Next has not been called yet
-    DICTIONARY,   // Dictionaries have been collected, and are being sent
-    RECORD_BATCH  // Initial have been sent
-  };
-
   RecordBatchStreamImpl(const std::shared_ptr<RecordBatchReader>& reader,
                         const ipc::IpcWriteOptions& options)
       : reader_(reader), mapper_(*reader_->schema()), ipc_options_(options) {}
@@ -981,61 +1508,46 @@ class RecordBatchStream::RecordBatchStreamImpl {
   }
 
   Status Next(FlightPayload* payload) {
-    if (stage_ == Stage::NEW) {
+    if (writer_ == nullptr) {
+      RETURN_NOT_OK(
+          OpenQueueingWriter(reader_->schema(), ipc_options_, &queue_, &writer_));
+    }
+    while (queue_.empty()) {
       RETURN_NOT_OK(reader_->ReadNext(&current_batch_));
       if (!current_batch_) {
         // Signal that iteration is over
         payload->ipc_message.metadata = nullptr;
         return Status::OK();
       }
-      ARROW_ASSIGN_OR_RAISE(dictionaries_,
-                            ipc::CollectDictionaries(*current_batch_, mapper_));
-      stage_ = Stage::DICTIONARY;
-    }
-
-    if (stage_ == Stage::DICTIONARY) {
-      if (dictionary_index_ == static_cast<int>(dictionaries_.size())) {
-        stage_ = Stage::RECORD_BATCH;
-        return ipc::GetRecordBatchPayload(*current_batch_, ipc_options_,
-                                          &payload->ipc_message);
-      } else {
-        return GetNextDictionary(payload);
-      }
-    }
-
-    RETURN_NOT_OK(reader_->ReadNext(&current_batch_));
-
-    // TODO(wesm): Delta dictionaries
-    if (!current_batch_) {
-      // Signal that iteration is over
-      payload->ipc_message.metadata = nullptr;
-      return Status::OK();
-    } else {
-      return ipc::GetRecordBatchPayload(*current_batch_, ipc_options_,
-                                        &payload->ipc_message);
+      // Queues any new, replaced or delta dictionaries, then the batch
+      RETURN_NOT_OK(writer_->WriteRecordBatch(*current_batch_));
     }
+    payload->ipc_message = std::move(queue_.front());
+    queue_.pop_front();
+    return Status::OK();
   }
 
  private:
-  Status GetNextDictionary(FlightPayload* payload) {
-    const auto& it = dictionaries_[dictionary_index_++];
-    return ipc::GetDictionaryPayload(it.first, it.second, ipc_options_,
-                                     &payload->ipc_message);
-  }
-
-  Stage stage_ = Stage::NEW;
   std::shared_ptr<RecordBatchReader> reader_;
   ipc::DictionaryFieldMapper mapper_;
   ipc::IpcWriteOptions ipc_options_;
   std::shared_ptr<RecordBatch> current_batch_;
-  std::vector<std::pair<int64_t, std::shared_ptr<Array>>> dictionaries_;
-
-  // Index of next dictionary to send
-  int dictionary_index_ = 0;
+  std::unique_ptr<ipc::RecordBatchWriter> writer_;
+  // Payloads to send, in order
+  std::deque<ipc::IpcPayload> queue_;
 };
 
 FlightDataStream::~FlightDataStream() {}
 
+Future<FlightPayload> FlightDataStream::NextAsync() {
+  FlightPayload payload;
+  auto status = Next(&payload);
+  if (!status.ok()) {
+    return Future<FlightPayload>::MakeFinished(std::move(status));
+  }
+  return Future<FlightPayload>::MakeFinished(std::move(payload));
+}
+
 RecordBatchStream::RecordBatchStream(const std::shared_ptr<RecordBatchReader>& reader,
                                      const ipc::IpcWriteOptions& options) {
   impl_.reset(new RecordBatchStreamImpl(reader, options));
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -32,6 +33,7 @@
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/options.h"
 #include "arrow/record_batch.h"
+#include "arrow/util/future.h"
 
 namespace arrow {
 
@@ -57,6 +59,14 @@ class ARROW_FLIGHT_EXPORT FlightDataStream {
   // When the stream is completed, the last payload written will have null
   // metadata
   virtual Status Next(FlightPayload* payload) = 0;
+
+  /// \brief Asynchronously compute the next payload
+  ///
+  /// This is used instead of Next() by servers with
+  /// FlightServerOptions::num_async_threads > 0, so that streams waiting
+  /// for data don't hold a thread.  As with Next(), the last payload has
+  /// null metadata.  The default implementation calls Next() synchronously.
+  virtual Future<FlightPayload> NextAsync();
 };
 
 /// \brief A basic implementation of FlightDataStream that will provide
@@ -119,6 +129,13 @@ class ARROW_FLIGHT_EXPORT ServerCallContext {
   /// to the object beyond the request body.
   /// \return The middleware, or nullptr if not found.
   virtual ServerMiddleware* GetMiddleware(const std::string& key) const = 0;
+  /// \brief IPC write options negotiated with the client for data sent to it.
+  ///
+  /// The body compression codec and dictionary deltas configured in
+  /// FlightServerOptions are enabled as far as the client accepts them.
+  /// Pass these options to RecordBatchStream in DoGet; they are also the
+  /// default options of the DoExchange writer.
+  virtual const ipc::IpcWriteOptions& negotiated_write_options() const;
 };
 
 class ARROW_FLIGHT_EXPORT FlightServerOptions {
@@ -154,6 +171,34 @@ class ARROW_FLIGHT_EXPORT FlightServerOptions {
   /// link to the same transport implementation as Flight to avoid
   /// runtime problems.
   std::function<void(void*)> builder_hook;
+
+  /// \brief IPC body compression codecs the server may use for data sent to
+  /// clients, in order of preference.
+  ///
+  /// The first codec accepted by the client (see
+  /// FlightCallOptions::accepted_compression) is chosen for each call.
+  /// May only contain LZ4_FRAME and ZSTD.  If empty (the default), data
+  /// isn't compressed.
+  std::vector<Compression::type> ipc_compression;
+  /// \brief Whether to send dictionary deltas to clients which accept them.
+  bool ipc_dictionary_deltas;
+  /// \brief The number of threads serving DoGet() calls asynchronously.
+  ///
+  /// If 0 (the default), each DoGet() call holds a gRPC thread until its
+  /// stream is finished.  Otherwise, DoGet() streams are multiplexed on this
+  /// many threads using FlightDataStream::NextAsync(), which allows serving
+  /// many more concurrent streams.  Other methods are not affected.
+  int num_async_threads;
+  /// \brief The number of bytes a synchronous DoGet() stream may produce
+  /// ahead of the client.
+  ///
+  /// If positive, FlightDataStream::Next() is called on a separate thread
+  /// for each DoGet() call, and payloads are queued until gRPC accepts
+  /// them, up to this many bytes (one more payload may be queued when the
+  /// limit isn't reached yet).  This overlaps producing data with sending
+  /// it, at the price of memory.  If 0 (the default), payloads are
+  /// produced as they are sent.  Ignored for asynchronous DoGet() calls.
+  int64_t max_queued_bytes_per_stream;
 };
 
 /// \brief Skeleton RPC server implementation which can be used to create
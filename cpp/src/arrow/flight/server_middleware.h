@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -30,6 +32,29 @@
 namespace arrow {
 namespace flight {
 
+/// \brief Statistics of the data written by the server for a DoGet() or
+/// DoExchange() call.
+struct ARROW_FLIGHT_EXPORT ServerStreamStats {
+  /// \brief The number of FlightData messages written
+  int64_t messages_written = 0;
+  /// \brief The number of bytes (metadata, application metadata and
+  /// body) written
+  int64_t bytes_written = 0;
+  /// \brief The largest number of bytes produced but not yet written,
+  /// including the message being written
+  int64_t max_queued_bytes = 0;
+  /// \brief The time spent producing and serializing payloads
+  ///
+  /// For DoGet(), this is the time spent in FlightDataStream::Next().
+  /// For DoExchange(), this is the time spent serializing record batches.
+  std::chrono::nanoseconds produce_time{0};
+  /// \brief The time spent waiting for gRPC to accept written messages
+  ///
+  /// A large write stall time means that the stream is throttled by the
+  /// client or the network, through gRPC flow control.
+  std::chrono::nanoseconds write_stall_time{0};
+};
+
 /// \brief Server-side middleware for a call, instantiated per RPC.
 ///
 /// Middleware should be fast and must be infallible: there is no way
@@ -48,6 +73,12 @@ class ARROW_FLIGHT_EXPORT ServerMiddleware {
 
   /// \brief A callback after the call has completed.
   virtual void CallCompleted(const Status& status) = 0;
+
+  /// \brief A callback with the statistics of the data written by a
+  /// DoGet() or DoExchange() call, just before CallCompleted().
+  ///
+  /// The default implementation does nothing.
+  virtual void StreamCompleted(const ServerStreamStats& stats) {}
 };
 
 /// \brief A factory for new middleware instances.
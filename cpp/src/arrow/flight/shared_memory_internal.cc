@@ -0,0 +1,255 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/shared_memory_internal.h"
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/ipc/message.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/ubsan.h"
+
+namespace arrow {
+namespace flight {
+namespace internal {
+
+namespace {
+
+constexpr int64_t kBodyReferenceSize = 16;
+
+#ifdef __linux__
+
+const char kSegmentDirectory[] = "/dev/shm/";
+const char kSegmentPrefix[] = "arrow-flight-";
+
+std::string SegmentPath(const std::string& name) { return kSegmentDirectory + name; }
+
+// A body mapped from a segment.  The pages are released from the segment
+// along with the mapping.
+class SharedMemoryBuffer : public Buffer {
+ public:
+  SharedMemoryBuffer(uint8_t* data, int64_t size) : Buffer(data, size) {}
+
+  ~SharedMemoryBuffer() override {
+    auto addr = const_cast<uint8_t*>(data_);
+    if (madvise(addr, static_cast<size_t>(size_), MADV_REMOVE) != 0) {
+      ARROW_LOG(WARNING) << "Failed to release shared memory body: "
+                         << std::strerror(errno);
+    }
+    munmap(addr, static_cast<size_t>(size_));
+  }
+};
+
+#endif
+
+}  // namespace
+
+SharedMemoryBodyReader::SharedMemoryBodyReader(int fd, std::string name)
+    : fd_(fd), name_(std::move(name)), linked_(true) {}
+
+SharedMemoryBodyReader::~SharedMemoryBodyReader() {
+#ifdef __linux__
+  Unlink();
+  close(fd_);
+#endif
+}
+
+::arrow::Result<std::shared_ptr<SharedMemoryBodyReader>>
+SharedMemoryBodyReader::Create() {
+#ifdef __linux__
+  static std::atomic<int64_t> counter{0};
+  const auto seed = static_cast<uint64_t>(::arrow::internal::GetRandomSeed());
+  for (int attempt = 0; attempt < 10; ++attempt) {
+    std::stringstream ss;
+    ss << kSegmentPrefix << getpid() << "-" << counter++ << "-" << std::hex
+       << (seed + attempt);
+    const std::string name = ss.str();
+    int fd = open(SegmentPath(name).c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC,
+                  S_IRUSR | S_IWUSR);
+    if (fd >= 0) {
+      return std::shared_ptr<SharedMemoryBodyReader>(
+          new SharedMemoryBodyReader(fd, name));
+    }
+    if (errno != EEXIST) {
+      return ::arrow::internal::IOErrorFromErrno(
+          errno, "Failed to create shared memory segment '", name, "'");
+    }
+  }
+  return Status::IOError("Failed to create a unique shared memory segment");
+#else
+  return Status::NotImplemented("Shared memory is not supported on this platform");
+#endif
+}
+
+void SharedMemoryBodyReader::Unlink() {
+#ifdef __linux__
+  if (linked_) {
+    unlink(SegmentPath(name_).c_str());
+    linked_ = false;
+  }
+#endif
+}
+
+Status SharedMemoryBodyReader::Resolve(std::shared_ptr<Buffer>* body) {
+#ifdef __linux__
+  if (*body == nullptr || (*body)->size() != kBodyReferenceSize) {
+    return Status::Invalid("Invalid shared memory body reference");
+  }
+  const uint8_t* data = (*body)->data();
+  const auto offset = BitUtil::FromLittleEndian(util::SafeLoadAs<uint64_t>(data));
+  const auto length = BitUtil::FromLittleEndian(util::SafeLoadAs<uint64_t>(data + 8));
+
+  struct stat st;
+  if (fstat(fd_, &st) != 0) {
+    return ::arrow::internal::IOErrorFromErrno(errno,
+                                               "Failed to stat shared memory segment");
+  }
+  const auto page_size = static_cast<uint64_t>(::arrow::internal::GetPageSize());
+  const auto segment_size = static_cast<uint64_t>(st.st_size);
+  // Mapping past the end of the segment would fault on access
+  if (length == 0 || offset % page_size != 0 || offset > segment_size ||
+      length > segment_size - offset) {
+    return Status::Invalid("Shared memory body reference out of bounds");
+  }
+  // Released pages are punched out of the segment, which requires a
+  // writable mapping
+  void* addr = mmap(nullptr, static_cast<size_t>(length), PROT_READ | PROT_WRITE,
+                    MAP_SHARED, fd_, static_cast<off_t>(offset));
+  if (addr == MAP_FAILED) {
+    return ::arrow::internal::IOErrorFromErrno(errno,
+                                               "Failed to map shared memory body");
+  }
+  *body = std::make_shared<SharedMemoryBuffer>(static_cast<uint8_t*>(addr),
+                                               static_cast<int64_t>(length));
+  return Status::OK();
+#else
+  return Status::NotImplemented("Shared memory is not supported on this platform");
+#endif
+}
+
+SharedMemoryBodyWriter::SharedMemoryBodyWriter(int fd) : fd_(fd), position_(0) {}
+
+SharedMemoryBodyWriter::~SharedMemoryBodyWriter() {
+#ifdef __linux__
+  close(fd_);
+#endif
+}
+
+::arrow::Result<std::unique_ptr<SharedMemoryBodyWriter>> SharedMemoryBodyWriter::Open(
+    const std::string& name) {
+#ifdef __linux__
+  // Don't let clients designate arbitrary files
+  if (name.compare(0, sizeof(kSegmentPrefix) - 1, kSegmentPrefix) != 0 ||
+      name.find('/') != std::string::npos) {
+    return Status::Invalid("Invalid shared memory segment name '", name, "'");
+  }
+  int fd = open(SegmentPath(name).c_str(), O_RDWR | O_NOFOLLOW | O_CLOEXEC);
+  if (fd < 0) {
+    return ::arrow::internal::IOErrorFromErrno(
+        errno, "Failed to open shared memory segment '", name, "'");
+  }
+  std::unique_ptr<SharedMemoryBodyWriter> writer(new SharedMemoryBodyWriter(fd));
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    return ::arrow::internal::IOErrorFromErrno(
+        errno, "Failed to stat shared memory segment '", name, "'");
+  }
+  if (!S_ISREG(st.st_mode) || st.st_uid != geteuid() || st.st_size != 0) {
+    return Status::Invalid("Shared memory segment '", name,
+                           "' is not a new segment of the current user");
+  }
+  return std::move(writer);
+#else
+  return Status::NotImplemented("Shared memory is not supported on this platform");
+#endif
+}
+
+Status SharedMemoryBodyWriter::Rewrite(ipc::IpcPayload* payload) {
+#ifdef __linux__
+  if (!ipc::Message::HasBody(payload->type) || payload->body_length == 0) {
+    return Status::OK();
+  }
+  const int64_t offset =
+      BitUtil::RoundUp(position_, ::arrow::internal::GetPageSize());
+  // Same layout as the gRPC body: each buffer padded to a multiple of 8.
+  // The segment is sparse, so the padding doesn't need to be written.
+  int64_t body_size = 0;
+  int64_t written_end = offset;
+  for (const auto& buffer : payload->body_buffers) {
+    // Buffer may be null when the row length is zero, or when all
+    // entries are invalid.
+    if (!buffer) continue;
+
+    const uint8_t* data = buffer->data();
+    int64_t remaining = buffer->size();
+    int64_t position = offset + body_size;
+    while (remaining > 0) {
+      const ssize_t ret = pwrite(fd_, data, static_cast<size_t>(remaining),
+                                 static_cast<off_t>(position));
+      if (ret < 0) {
+        if (errno == EINTR) continue;
+        return ::arrow::internal::IOErrorFromErrno(
+            errno, "Failed to write to shared memory segment");
+      }
+      data += ret;
+      remaining -= ret;
+      position += ret;
+    }
+    written_end = position;
+    body_size += BitUtil::RoundUpToMultipleOf8(buffer->size());
+  }
+  if (body_size == 0) {
+    return Status::OK();
+  }
+  // Extend the segment over any trailing padding
+  if (written_end < offset + body_size &&
+      ftruncate(fd_, static_cast<off_t>(offset + body_size)) != 0) {
+    return ::arrow::internal::IOErrorFromErrno(
+        errno, "Failed to resize shared memory segment");
+  }
+  position_ = offset + body_size;
+
+  ARROW_ASSIGN_OR_RAISE(auto reference, AllocateBuffer(kBodyReferenceSize));
+  const auto le_offset = BitUtil::ToLittleEndian(static_cast<uint64_t>(offset));
+  const auto le_length = BitUtil::ToLittleEndian(static_cast<uint64_t>(body_size));
+  std::memcpy(reference->mutable_data(), &le_offset, sizeof(le_offset));
+  std::memcpy(reference->mutable_data() + 8, &le_length, sizeof(le_length));
+  payload->body_buffers = {std::move(reference)};
+  payload->body_length = kBodyReferenceSize;
+  return Status::OK();
+#else
+  return Status::NotImplemented("Shared memory is not supported on this platform");
+#endif
+}
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,102 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Shared memory data plane for co-located Flight clients and servers
+// (the "grpc+shm" scheme).
+//
+// The client creates an empty segment and passes its name in the DoGet()
+// call headers.  The server opens it, appends each message body at a
+// page-aligned offset, and sends a 16-byte reference (little-endian
+// offset and length) in place of the body over gRPC.  The client maps
+// each body read-only and punches it out of the segment once the body
+// buffer is released, so the segment only holds the bodies that are
+// still in use.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/flight/visibility.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+
+namespace arrow {
+
+class Buffer;
+
+namespace flight {
+namespace internal {
+
+/// \brief The client side of a shared memory segment
+class ARROW_FLIGHT_EXPORT SharedMemoryBodyReader {
+ public:
+  ~SharedMemoryBodyReader();
+
+  /// \brief Create a new, empty segment
+  ///
+  /// NotImplemented is returned on platforms without shared memory support.
+  static ::arrow::Result<std::shared_ptr<SharedMemoryBodyReader>> Create();
+
+  /// \brief The segment name to pass to the server
+  const std::string& name() const { return name_; }
+
+  /// \brief Remove the segment name, once the server has opened it
+  ///
+  /// The segment and the bodies mapped from it stay valid.
+  void Unlink();
+
+  /// \brief Replace a body reference sent by the server with the body
+  Status Resolve(std::shared_ptr<Buffer>* body);
+
+ private:
+  SharedMemoryBodyReader(int fd, std::string name);
+
+  int fd_;
+  std::string name_;
+  bool linked_;
+};
+
+/// \brief The server side of a shared memory segment
+class ARROW_FLIGHT_EXPORT SharedMemoryBodyWriter {
+ public:
+  ~SharedMemoryBodyWriter();
+
+  /// \brief Open the segment created by a client
+  ///
+  /// Only empty segments created by the same user are accepted.
+  static ::arrow::Result<std::unique_ptr<SharedMemoryBodyWriter>> Open(
+      const std::string& name);
+
+  /// \brief Write the payload body to the segment, and replace it with a
+  /// reference
+  ///
+  /// Payloads without a body are left untouched.
+  Status Rewrite(ipc::IpcPayload* payload);
+
+ private:
+  explicit SharedMemoryBodyWriter(int fd);
+
+  int fd_;
+  int64_t position_;
+};
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
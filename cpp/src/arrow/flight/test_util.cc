@@ -23,6 +23,7 @@
 #endif
 
 #include <cstdlib>
+#include <limits>
 #include <sstream>
 
 #include <boost/filesystem.hpp>
@@ -36,6 +37,7 @@
 #include "arrow/ipc/test_common.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/logging.h"
 
@@ -86,7 +88,9 @@ Status ResolveCurrentExecutable(fs::path* out) {
 
 }  // namespace
 
-void TestServer::Start() {
+void TestServer::Start() { Start({}); }
+
+void TestServer::Start(const std::vector<std::string>& extra_args) {
   namespace fs = boost::filesystem;
 
   std::string str_port = std::to_string(port_);
@@ -104,7 +108,8 @@ void TestServer::Start() {
 
   try {
     server_process_ = std::make_shared<bp::child>(
-        bp::search_path(executable_name_, search_path), "-port", str_port);
+        bp::search_path(executable_name_, search_path), "-port", str_port,
+        bp::args(extra_args));
   } catch (...) {
     std::stringstream ss;
     ss << "Failed to launch test server '" << executable_name_ << "', looked in ";
@@ -607,6 +612,52 @@ Status ExampleLargeBatches(BatchVector* out) {
   return Status::OK();
 }
 
+Status MakePerfBatch(const std::string& kind, int64_t length,
+                     std::shared_ptr<RecordBatch>* out) {
+  constexpr int64_t kMaxInt64 = std::numeric_limits<int64_t>::max();
+  random::RandomArrayGenerator rng(/*seed=*/42);
+  FieldVector fields = {field("a", int64())};
+  ArrayVector arrays = {rng.Int64(length, 0, kMaxInt64, /*null_probability=*/0)};
+  if (kind == "int64") {
+    for (const std::string name : {"b", "c", "d"}) {
+      fields.push_back(field(name, int64()));
+      arrays.push_back(rng.Int64(length, 0, kMaxInt64, /*null_probability=*/0));
+    }
+  } else if (kind == "string") {
+    for (const std::string name : {"b", "c"}) {
+      fields.push_back(field(name, utf8()));
+      arrays.push_back(rng.String(length, /*min_length=*/0, /*max_length=*/32,
+                                  /*null_probability=*/0.1));
+    }
+  } else if (kind == "nested") {
+    auto values = rng.Int64(length * 4, 0, kMaxInt64, /*null_probability=*/0.1);
+    fields.push_back(field("b", list(int64())));
+    arrays.push_back(rng.List(*values, length, /*null_probability=*/0.1));
+    ARROW_ASSIGN_OR_RAISE(
+        auto struct_array,
+        StructArray::Make({rng.Int32(length, 0, 1000, /*null_probability=*/0.1),
+                           rng.String(length, 0, 16, /*null_probability=*/0.1)},
+                          std::vector<std::string>{"x", "y"}));
+    fields.push_back(field("c", struct_array->type()));
+    arrays.push_back(std::move(struct_array));
+  } else if (kind == "dictionary") {
+    for (const std::string name : {"b", "c"}) {
+      auto dict = rng.String(100, /*min_length=*/4, /*max_length=*/16,
+                             /*null_probability=*/0);
+      auto indices = rng.Int32(length, 0, 99, /*null_probability=*/0.1);
+      ARROW_ASSIGN_OR_RAISE(auto dict_array, DictionaryArray::FromArrays(
+                                                 dictionary(int32(), utf8()), indices,
+                                                 dict));
+      fields.push_back(field(name, dict_array->type()));
+      arrays.push_back(std::move(dict_array));
+    }
+  } else {
+    return Status::Invalid("Unknown benchmark data kind: '", kind, "'");
+  }
+  *out = RecordBatch::Make(schema(fields), length, arrays);
+  return Status::OK();
+}
+
 std::vector<ActionType> ExampleActionTypes() {
   return {{"drop", "drop a dataset"}, {"cache", "cache a dataset"}};
 }
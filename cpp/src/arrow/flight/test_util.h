@@ -56,6 +56,9 @@ class ARROW_FLIGHT_EXPORT TestServer {
 
   void Start();
 
+  /// \brief Start the server with extra command-line arguments
+  void Start(const std::vector<std::string>& extra_args);
+
   int Stop();
 
   bool IsRunning();
@@ -158,6 +161,16 @@ Status ExampleNestedBatches(BatchVector* out);
 ARROW_FLIGHT_EXPORT
 Status ExampleLargeBatches(BatchVector* out);
 
+/// \brief Make a random record batch for benchmarks.
+///
+/// The batch starts with an int64 column "a", followed by columns
+/// depending on `kind`: "int64" (three more int64 columns), "string"
+/// (utf8 columns), "nested" (list and struct columns) or "dictionary"
+/// (dictionary-encoded utf8 columns).
+ARROW_FLIGHT_EXPORT
+Status MakePerfBatch(const std::string& kind, int64_t length,
+                     std::shared_ptr<RecordBatch>* out);
+
 ARROW_FLIGHT_EXPORT
 std::vector<FlightInfo> ExampleFlightInfo();
 
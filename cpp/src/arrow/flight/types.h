@@ -270,6 +270,8 @@ ARROW_FLIGHT_EXPORT
 extern const char* kSchemeGrpcUnix;
 ARROW_FLIGHT_EXPORT
 extern const char* kSchemeGrpcTls;
+ARROW_FLIGHT_EXPORT
+extern const char* kSchemeGrpcShm;
 
 /// \brief A host location (a URI)
 struct ARROW_FLIGHT_EXPORT Location {
@@ -300,6 +302,16 @@ struct ARROW_FLIGHT_EXPORT Location {
   /// \param[out] location The resulting location
   static Status ForGrpcUnix(const std::string& path, Location* location);
 
+  /// \brief Initialize a location for a Flight service on the same host,
+  /// using a domain socket for gRPC and shared memory for data
+  ///
+  /// DoGet() record batch bodies are handed over through a shared memory
+  /// segment instead of being copied through the socket.  Streams fall
+  /// back to plain gRPC if shared memory is not available.
+  /// \param[in] path The path to the domain socket
+  /// \param[out] location The resulting location
+  static Status ForGrpcShm(const std::string& path, Location* location);
+
   /// \brief Get a representation of this URI as a string.
   std::string ToString() const;
 
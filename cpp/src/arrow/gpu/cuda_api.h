@@ -18,6 +18,8 @@
 #pragma once
 
 #include "arrow/gpu/cuda_arrow_ipc.h"
+#include "arrow/gpu/cuda_compute.h"
 #include "arrow/gpu/cuda_context.h"
 #include "arrow/gpu/cuda_memory.h"
+#include "arrow/gpu/cuda_transfer.h"
 #include "arrow/gpu/cuda_version.h"
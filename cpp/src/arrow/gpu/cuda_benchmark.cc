@@ -23,6 +23,8 @@
 
 #include "arrow/array.h"
 #include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 
@@ -90,5 +92,81 @@ BENCHMARK(Writer_Unbuffered)
     ->Range(1 << 8, 1 << 16)
     ->UseRealTime();
 
+static std::shared_ptr<RecordBatch> MakeTransferBatch(int64_t length) {
+  random::RandomArrayGenerator rng(/*seed=*/0);
+  auto schema = ::arrow::schema({field("f0", int64()), field("f1", float64()),
+                                 field("f2", int32()), field("f3", boolean())});
+  return RecordBatch::Make(schema, length,
+                           {rng.Int64(length, 0, 1000, /*null_probability=*/0.1),
+                            rng.Float64(length, 0, 1, /*null_probability=*/0.1),
+                            rng.Int32(length, 0, 1000, /*null_probability=*/0.1),
+                            rng.Boolean(length, 0.5, /*null_probability=*/0.1)});
+}
+
+static int64_t BatchBytes(const RecordBatch& batch) {
+  int64_t total = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    for (const auto& buffer : batch.column_data(i)->buffers) {
+      total += buffer == nullptr ? 0 : buffer->size();
+    }
+  }
+  return total;
+}
+
+// Copy each buffer of a batch synchronously, from pageable memory
+static void BatchTransfer_BufferByBuffer(benchmark::State& state) {
+  CudaDeviceManager* manager;
+  ABORT_NOT_OK(CudaDeviceManager::Instance().Value(&manager));
+  std::shared_ptr<CudaContext> context;
+  ABORT_NOT_OK(manager->GetContext(kGpuNumber).Value(&context));
+  auto batch = MakeTransferBatch(state.range(0));
+
+  while (state.KeepRunning()) {
+    for (int i = 0; i < batch->num_columns(); ++i) {
+      for (const auto& buffer : batch->column_data(i)->buffers) {
+        if (buffer != nullptr) {
+          std::shared_ptr<CudaBuffer> device_buffer;
+          ABORT_NOT_OK(context->Allocate(buffer->size()).Value(&device_buffer));
+          ABORT_NOT_OK(device_buffer->CopyFromHost(0, buffer->data(), buffer->size()));
+        }
+      }
+    }
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * BatchBytes(*batch));
+}
+
+// Copy batches through the pinned staging buffers of a pipelined transfer
+static void BatchTransfer_Pipelined(benchmark::State& state) {
+  CudaDeviceManager* manager;
+  ABORT_NOT_OK(CudaDeviceManager::Instance().Value(&manager));
+  std::shared_ptr<CudaContext> context;
+  ABORT_NOT_OK(manager->GetContext(kGpuNumber).Value(&context));
+  std::unique_ptr<CudaRecordBatchTransfer> transfer;
+  ABORT_NOT_OK(CudaRecordBatchTransfer::Make(context).Value(&transfer));
+  auto batch = MakeTransferBatch(state.range(0));
+
+  while (state.KeepRunning()) {
+    ABORT_NOT_OK(transfer->Submit(batch));
+    if (transfer->num_pending() == CudaTransferOptions::Defaults().pipeline_depth) {
+      ABORT_NOT_OK(transfer->Next().status());
+    }
+  }
+  while (transfer->num_pending() > 0) {
+    ABORT_NOT_OK(transfer->Next().status());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * BatchBytes(*batch));
+}
+
+// Vary batch length from 1K to 1M rows
+BENCHMARK(BatchTransfer_BufferByBuffer)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 20)
+    ->UseRealTime();
+
+BENCHMARK(BatchTransfer_Pipelined)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 20)
+    ->UseRealTime();
+
 }  // namespace cuda
 }  // namespace arrow
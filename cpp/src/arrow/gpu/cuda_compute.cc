@@ -0,0 +1,526 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/gpu/cuda_compute.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cuda.h>
+
+#include "arrow/array/data.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/function.h"
+#include "arrow/compute/registry.h"
+#include "arrow/datum.h"
+#include "arrow/gpu/cuda_compute_internal.h"
+#include "arrow/gpu/cuda_context.h"
+#include "arrow/gpu/cuda_internal.h"
+#include "arrow/gpu/cuda_memory.h"
+#include "arrow/result.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::PrimitiveScalarBase;
+
+namespace cuda {
+
+using compute::Arity;
+using compute::ExecContext;
+using compute::FunctionOptions;
+using internal::ArithmeticOp;
+using internal::CompareOp;
+using internal::ContextSaver;
+using internal::DeviceValues;
+
+namespace {
+
+bool IsNumeric(Type::type type_id) {
+  return is_integer(type_id) || type_id == Type::FLOAT || type_id == Type::DOUBLE;
+}
+
+const uint8_t* DeviceAddress(const std::shared_ptr<Buffer>& buffer) {
+  return buffer == nullptr ? nullptr
+                           : reinterpret_cast<const uint8_t*>(buffer->address());
+}
+
+int ByteWidth(const DataType& type) {
+  return checked_cast<const FixedWidthType&>(type).bit_width() / 8;
+}
+
+uint8_t* MutableDeviceAddress(const std::shared_ptr<Buffer>& buffer) {
+  return reinterpret_cast<uint8_t*>(buffer->address());
+}
+
+Status CheckOnDevice(const ArrayData& data) {
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr && buffer->is_cpu() && buffer->size() > 0) {
+      return Status::Invalid(
+          "Array arguments of CUDA functions must all reside on the device");
+    }
+  }
+  return Status::OK();
+}
+
+// Return the context owning the device buffers of the array
+Result<std::shared_ptr<CudaContext>> GetContext(const ArrayData& data) {
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr && !buffer->is_cpu()) {
+      ARROW_ASSIGN_OR_RAISE(auto cuda_buffer, CudaBuffer::FromBuffer(buffer));
+      return cuda_buffer->context();
+    }
+  }
+  return Status::Invalid("Array does not reside on a CUDA device");
+}
+
+DeviceValues ArrayValues(const ArrayData& data) {
+  DeviceValues values;
+  if (data.null_count != 0) {
+    values.validity = DeviceAddress(data.buffers[0]);
+  }
+  values.values = DeviceAddress(data.buffers[1]);
+  values.offset = data.offset;
+  return values;
+}
+
+DeviceValues ScalarValues(const Scalar& scalar) {
+  DeviceValues values;
+  values.is_scalar = true;
+  const auto& primitive = checked_cast<const PrimitiveScalarBase&>(scalar);
+  std::memcpy(&values.scalar_bits, primitive.data(), ByteWidth(*scalar.type));
+  return values;
+}
+
+Result<int64_t> NullCount(const ArrayData& data) {
+  if (data.null_count != kUnknownNullCount) {
+    return data.null_count;
+  }
+  if (data.buffers[0] == nullptr) {
+    return 0;
+  }
+  int64_t set_count = 0;
+  RETURN_NOT_OK(internal::CountSetBits(DeviceAddress(data.buffers[0]), data.offset,
+                                       data.length, &set_count));
+  return data.length - set_count;
+}
+
+Result<std::shared_ptr<Buffer>> AllocateBitmap(CudaContext* context, int64_t length) {
+  return context->Allocate(BitUtil::BytesForBits(length));
+}
+
+Result<std::shared_ptr<Buffer>> AllocateZeroedBitmap(CudaContext* context,
+                                                     int64_t length) {
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> bitmap, AllocateBitmap(context, length));
+  if (bitmap->size() > 0) {
+    CU_RETURN_NOT_OK("cuMemsetD8", cuMemsetD8(bitmap->address(), 0,
+                                              static_cast<size_t>(bitmap->size())));
+  }
+  return bitmap;
+}
+
+// Count the nulls of a validity bitmap written at offset 0
+Result<int64_t> OutputNullCount(const std::shared_ptr<Buffer>& validity,
+                                int64_t length) {
+  if (validity == nullptr) {
+    return 0;
+  }
+  int64_t set_count = 0;
+  RETURN_NOT_OK(internal::CountSetBits(DeviceAddress(validity), 0, length, &set_count));
+  return length - set_count;
+}
+
+// ----------------------------------------------------------------------
+// Element-wise binary functions
+
+class CudaBinaryFunction : public compute::MetaFunction {
+ protected:
+  explicit CudaBinaryFunction(std::string name)
+      : MetaFunction(std::move(name), Arity::Binary(), /*doc=*/nullptr) {}
+
+  struct Inputs {
+    std::shared_ptr<CudaContext> context;
+    std::shared_ptr<DataType> type;
+    DeviceValues left;
+    DeviceValues right;
+    int64_t length = -1;
+    // Validity of the inputs, may be null if all valid
+    const uint8_t* left_validity = nullptr;
+    const uint8_t* right_validity = nullptr;
+    bool has_null_scalar = false;
+  };
+
+  Result<Inputs> PrepareInputs(const std::vector<Datum>& args) const {
+    Inputs inputs;
+    inputs.type = args[0].type();
+    if (!inputs.type || !args[1].type() || !inputs.type->Equals(*args[1].type()) ||
+        !IsNumeric(inputs.type->id())) {
+      return Status::NotImplemented("CUDA function '", name(),
+                                    "' only supports numeric arguments of the same type");
+    }
+    DeviceValues* values[] = {&inputs.left, &inputs.right};
+    for (int i = 0; i < 2; ++i) {
+      const Datum& arg = args[i];
+      if (arg.is_scalar()) {
+        if (!arg.scalar()->is_valid) {
+          inputs.has_null_scalar = true;
+        } else {
+          *values[i] = ScalarValues(*arg.scalar());
+        }
+      } else if (arg.is_array()) {
+        const ArrayData& data = *arg.array();
+        RETURN_NOT_OK(CheckOnDevice(data));
+        if (inputs.length >= 0 && inputs.length != data.length) {
+          return Status::Invalid("Array arguments must all be the same length");
+        }
+        inputs.length = data.length;
+        if (inputs.context == nullptr) {
+          ARROW_ASSIGN_OR_RAISE(inputs.context, GetContext(data));
+        }
+        *values[i] = ArrayValues(data);
+      } else {
+        return Status::NotImplemented("CUDA function '", name(),
+                                      "' only supports array and scalar arguments");
+      }
+    }
+    if (inputs.context == nullptr) {
+      return Status::Invalid("CUDA function '", name(),
+                             "' needs an array argument residing on the device");
+    }
+    return inputs;
+  }
+
+  // Compute the output validity as the intersection of the inputs' validity
+  Status IntersectValidity(const Inputs& inputs, std::shared_ptr<Buffer>* validity,
+                           int64_t* null_count) const {
+    if (inputs.has_null_scalar) {
+      ARROW_ASSIGN_OR_RAISE(*validity,
+                            AllocateZeroedBitmap(inputs.context.get(), inputs.length));
+      *null_count = inputs.length;
+      return Status::OK();
+    }
+    if (inputs.left.validity == nullptr && inputs.right.validity == nullptr) {
+      *validity = nullptr;
+      *null_count = 0;
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(*validity, AllocateBitmap(inputs.context.get(), inputs.length));
+    RETURN_NOT_OK(internal::BitmapAnd(inputs.left.validity, inputs.left.offset,
+                                      inputs.right.validity, inputs.right.offset,
+                                      inputs.length, MutableDeviceAddress(*validity)));
+    return OutputNullCount(*validity, inputs.length).Value(null_count);
+  }
+};
+
+class CudaArithmeticFunction : public CudaBinaryFunction {
+ public:
+  CudaArithmeticFunction(std::string name, ArithmeticOp op)
+      : CudaBinaryFunction(std::move(name)), op_(op) {}
+
+ protected:
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const FunctionOptions* options,
+                            ExecContext* ctx) const override {
+    if (options != nullptr &&
+        static_cast<const compute::ArithmeticOptions&>(*options).check_overflow) {
+      return Status::NotImplemented("CUDA function '", name(),
+                                    "' does not check for overflow");
+    }
+    ARROW_ASSIGN_OR_RAISE(Inputs inputs, PrepareInputs(args));
+    ContextSaver set_temporary(*inputs.context);
+
+    std::shared_ptr<Buffer> validity;
+    int64_t null_count = 0;
+    RETURN_NOT_OK(IntersectValidity(inputs, &validity, &null_count));
+    const int byte_width = ByteWidth(*inputs.type);
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> out_values,
+                          inputs.context->Allocate(inputs.length * byte_width));
+    if (null_count < inputs.length) {
+      RETURN_NOT_OK(internal::Arithmetic(
+          op_, inputs.type->id(), inputs.left, inputs.right, DeviceAddress(validity),
+          inputs.length, MutableDeviceAddress(out_values)));
+    }
+    return ArrayData::Make(inputs.type, inputs.length,
+                           {std::move(validity), std::move(out_values)}, null_count);
+  }
+
+ private:
+  ArithmeticOp op_;
+};
+
+class CudaCompareFunction : public CudaBinaryFunction {
+ public:
+  CudaCompareFunction(std::string name, CompareOp op)
+      : CudaBinaryFunction(std::move(name)), op_(op) {}
+
+ protected:
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args, const FunctionOptions*,
+                            ExecContext* ctx) const override {
+    ARROW_ASSIGN_OR_RAISE(Inputs inputs, PrepareInputs(args));
+    ContextSaver set_temporary(*inputs.context);
+
+    std::shared_ptr<Buffer> validity;
+    int64_t null_count = 0;
+    RETURN_NOT_OK(IntersectValidity(inputs, &validity, &null_count));
+    std::shared_ptr<Buffer> out_values;
+    if (null_count < inputs.length) {
+      ARROW_ASSIGN_OR_RAISE(out_values,
+                            AllocateBitmap(inputs.context.get(), inputs.length));
+      RETURN_NOT_OK(internal::Compare(op_, inputs.type->id(), inputs.left, inputs.right,
+                                      inputs.length, MutableDeviceAddress(out_values)));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(out_values,
+                            AllocateZeroedBitmap(inputs.context.get(), inputs.length));
+    }
+    return ArrayData::Make(boolean(), inputs.length,
+                           {std::move(validity), std::move(out_values)}, null_count);
+  }
+
+ private:
+  CompareOp op_;
+};
+
+// ----------------------------------------------------------------------
+// Aggregation
+
+class CudaSumFunction : public compute::MetaFunction {
+ public:
+  CudaSumFunction() : MetaFunction("sum", Arity::Unary(), /*doc=*/nullptr) {}
+
+ protected:
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args, const FunctionOptions*,
+                            ExecContext* ctx) const override {
+    if (!args[0].is_array() || !IsNumeric(args[0].type()->id())) {
+      return Status::NotImplemented(
+          "CUDA function 'sum' only supports a numeric array argument");
+    }
+    const ArrayData& data = *args[0].array();
+    RETURN_NOT_OK(CheckOnDevice(data));
+    ARROW_ASSIGN_OR_RAISE(auto context, GetContext(data));
+    ContextSaver set_temporary(*context);
+
+    const Type::type type_id = data.type->id();
+    std::shared_ptr<DataType> out_type =
+        is_signed_integer(type_id)
+            ? int64()
+            : (is_unsigned_integer(type_id) ? uint64() : float64());
+    ARROW_ASSIGN_OR_RAISE(int64_t null_count, NullCount(data));
+    if (null_count == data.length) {
+      return MakeNullScalar(std::move(out_type));
+    }
+    DeviceValues values = ArrayValues(data);
+    if (null_count == 0) {
+      values.validity = nullptr;
+    }
+    // Large enough for any of the output C types
+    uint64_t sum = 0;
+    RETURN_NOT_OK(internal::Sum(type_id, values, data.length, &sum));
+    std::shared_ptr<Scalar> out;
+    switch (out_type->id()) {
+      case Type::INT64:
+        out = std::make_shared<Int64Scalar>(static_cast<int64_t>(sum));
+        break;
+      case Type::UINT64:
+        out = std::make_shared<UInt64Scalar>(sum);
+        break;
+      default: {
+        double double_sum;
+        std::memcpy(&double_sum, &sum, sizeof(double));
+        out = std::make_shared<DoubleScalar>(double_sum);
+        break;
+      }
+    }
+    return out;
+  }
+};
+
+// ----------------------------------------------------------------------
+// Selection
+
+// Check that the values can be gathered by the take kernel
+Status CheckSelectionValues(const std::string& func_name, const Datum& values) {
+  if (!values.is_array()) {
+    return Status::NotImplemented("CUDA function '", func_name,
+                                  "' only supports array arguments");
+  }
+  const DataType& type = *values.type();
+  if (type.id() == Type::BOOL || !is_fixed_width(type.id())) {
+    return Status::NotImplemented("CUDA function '", func_name,
+                                  "' only supports fixed-width values, got ", type);
+  }
+  const int byte_width = ByteWidth(type);
+  if (byte_width != 1 && byte_width != 2 && byte_width != 4 && byte_width != 8) {
+    return Status::NotImplemented("CUDA function '", func_name,
+                                  "' only supports values of 1, 2, 4 or 8 bytes, got ",
+                                  type);
+  }
+  return CheckOnDevice(*values.array());
+}
+
+// Gather the values at the given device indices into a new device array
+Result<Datum> TakeOnDevice(CudaContext* context, const ArrayData& values,
+                           Type::type index_type, const DeviceValues& indices,
+                           bool indices_may_be_null, int64_t length, bool boundscheck,
+                           bool negative_is_null) {
+  const int byte_width = ByteWidth(*values.type);
+  ARROW_ASSIGN_OR_RAISE(int64_t values_null_count, NullCount(values));
+  DeviceValues values_view = ArrayValues(values);
+  if (values_null_count == 0) {
+    values_view.validity = nullptr;
+  }
+
+  std::shared_ptr<Buffer> validity;
+  if (values_view.validity != nullptr || indices_may_be_null) {
+    ARROW_ASSIGN_OR_RAISE(validity, AllocateBitmap(context, length));
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> out_values,
+                        context->Allocate(length * byte_width));
+  RETURN_NOT_OK(internal::Take(byte_width, values_view, values.length, index_type,
+                               indices, length, boundscheck, negative_is_null,
+                               MutableDeviceAddress(out_values),
+                               validity == nullptr ? nullptr
+                                                   : MutableDeviceAddress(validity)));
+  ARROW_ASSIGN_OR_RAISE(int64_t null_count, OutputNullCount(validity, length));
+  if (null_count == 0) {
+    validity = nullptr;
+  }
+  return ArrayData::Make(values.type, length,
+                         {std::move(validity), std::move(out_values)}, null_count);
+}
+
+class CudaTakeFunction : public compute::MetaFunction {
+ public:
+  CudaTakeFunction() : MetaFunction("take", Arity::Binary(), /*doc=*/nullptr) {}
+
+ protected:
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const FunctionOptions* options,
+                            ExecContext* ctx) const override {
+    RETURN_NOT_OK(CheckSelectionValues(name(), args[0]));
+    if (!args[1].is_array() || !is_integer(args[1].type()->id())) {
+      return Status::NotImplemented(
+          "CUDA function 'take' only supports an array of integer indices");
+    }
+    const ArrayData& values = *args[0].array();
+    const ArrayData& indices = *args[1].array();
+    RETURN_NOT_OK(CheckOnDevice(indices));
+    const bool boundscheck =
+        options == nullptr ||
+        static_cast<const compute::TakeOptions&>(*options).boundscheck;
+
+    ARROW_ASSIGN_OR_RAISE(auto context, GetContext(values.length > 0 ? values : indices));
+    ContextSaver set_temporary(*context);
+    ARROW_ASSIGN_OR_RAISE(int64_t indices_null_count, NullCount(indices));
+    DeviceValues indices_view = ArrayValues(indices);
+    if (indices_null_count == 0) {
+      indices_view.validity = nullptr;
+    }
+    return TakeOnDevice(context.get(), values, indices.type->id(), indices_view,
+                        indices_null_count > 0, indices.length, boundscheck,
+                        /*negative_is_null=*/false);
+  }
+};
+
+class CudaFilterFunction : public compute::MetaFunction {
+ public:
+  CudaFilterFunction() : MetaFunction("filter", Arity::Binary(), /*doc=*/nullptr) {}
+
+ protected:
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const FunctionOptions* options,
+                            ExecContext* ctx) const override {
+    RETURN_NOT_OK(CheckSelectionValues(name(), args[0]));
+    if (!args[1].is_array() || args[1].type()->id() != Type::BOOL) {
+      return Status::NotImplemented(
+          "CUDA function 'filter' only supports a boolean array filter");
+    }
+    const ArrayData& values = *args[0].array();
+    const ArrayData& filter = *args[1].array();
+    RETURN_NOT_OK(CheckOnDevice(filter));
+    if (values.length != filter.length) {
+      return Status::Invalid("Filter inputs must all be the same length");
+    }
+    const bool emit_null =
+        options != nullptr &&
+        static_cast<const compute::FilterOptions&>(*options).null_selection_behavior ==
+            compute::FilterOptions::EMIT_NULL;
+
+    ARROW_ASSIGN_OR_RAISE(auto context, GetContext(values.length > 0 ? values : filter));
+    ContextSaver set_temporary(*context);
+    ARROW_ASSIGN_OR_RAISE(int64_t filter_null_count, NullCount(filter));
+    DeviceValues filter_view = ArrayValues(filter);
+    if (filter_null_count == 0) {
+      filter_view.validity = nullptr;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indices,
+                          context->Allocate(filter.length * sizeof(int64_t)));
+    int64_t out_length = 0;
+    RETURN_NOT_OK(internal::FilterIndices(filter_view, filter.length, emit_null,
+                                          reinterpret_cast<int64_t*>(indices->address()),
+                                          &out_length));
+    DeviceValues indices_view;
+    indices_view.values = DeviceAddress(indices);
+    return TakeOnDevice(context.get(), values, Type::INT64, indices_view,
+                        emit_null && filter_null_count > 0, out_length,
+                        /*boundscheck=*/false, /*negative_is_null=*/true);
+  }
+};
+
+}  // namespace
+
+Status RegisterComputeFunctions(compute::FunctionRegistry* registry) {
+  if (registry == nullptr) {
+    registry = compute::GetFunctionRegistry();
+  }
+  std::vector<std::shared_ptr<compute::Function>> functions = {
+      std::make_shared<CudaArithmeticFunction>("add", ArithmeticOp::ADD),
+      std::make_shared<CudaArithmeticFunction>("subtract", ArithmeticOp::SUBTRACT),
+      std::make_shared<CudaArithmeticFunction>("multiply", ArithmeticOp::MULTIPLY),
+      std::make_shared<CudaArithmeticFunction>("divide", ArithmeticOp::DIVIDE),
+      std::make_shared<CudaCompareFunction>("equal", CompareOp::EQUAL),
+      std::make_shared<CudaCompareFunction>("not_equal", CompareOp::NOT_EQUAL),
+      std::make_shared<CudaCompareFunction>("less", CompareOp::LESS),
+      std::make_shared<CudaCompareFunction>("less_equal", CompareOp::LESS_EQUAL),
+      std::make_shared<CudaCompareFunction>("greater", CompareOp::GREATER),
+      std::make_shared<CudaCompareFunction>("greater_equal", CompareOp::GREATER_EQUAL),
+      std::make_shared<CudaSumFunction>(),
+      std::make_shared<CudaTakeFunction>(),
+      std::make_shared<CudaFilterFunction>(),
+  };
+  for (auto& function : functions) {
+    RETURN_NOT_OK(registry->AddDeviceFunction(internal::kCudaDeviceTypeName,
+                                              std::move(function),
+                                              /*allow_overwrite=*/true));
+  }
+  return Status::OK();
+}
+
+}  // namespace cuda
+}  // namespace arrow
@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+namespace compute {
+
+class FunctionRegistry;
+
+}  // namespace compute
+
+namespace cuda {
+
+/// \brief Register the compute functions executing on CUDA devices
+///
+/// Once registered, compute::CallFunction() dispatches calls whose array
+/// arguments reside on a CUDA device to these functions, rather than to the
+/// CPU kernels.  Array results are allocated on the same device, so that a
+/// pipeline of calls does not copy data back to the host.
+///
+/// The following functions are implemented:
+/// - "add", "subtract", "multiply", "divide" on numeric arrays and scalars
+///   of the same type (integer arithmetic wraps around on overflow);
+/// - "equal", "not_equal", "less", "less_equal", "greater", "greater_equal"
+///   on numeric arrays and scalars of the same type;
+/// - "sum" of a numeric array, returned as a host scalar;
+/// - "take" and "filter" of arrays of fixed-width values of 1, 2, 4 or 8 bytes.
+///
+/// Registering again is a no-op.
+///
+/// \param[in] registry the registry to add the functions to, the global
+/// registry by default
+ARROW_EXPORT
+Status RegisterComputeFunctions(compute::FunctionRegistry* registry = NULLPTR);
+
+}  // namespace cuda
+}  // namespace arrow
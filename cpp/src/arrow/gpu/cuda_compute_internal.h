@@ -0,0 +1,119 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Non-public header: launchers of the device kernels, compiled by nvcc in
+// cuda_compute_kernels.cu.  Only plain pointers and Arrow status and type ids
+// cross this interface.  All pointers are device pointers unless noted
+// otherwise; the launchers run on the current CUDA context and return once the
+// device is done.
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace cuda {
+namespace internal {
+
+/// \brief The values of an argument of a device kernel
+///
+/// Either an array residing on the device, or a non-null scalar broadcast to
+/// all positions.
+struct DeviceValues {
+  /// Validity bitmap of the array, null if all values are valid
+  const uint8_t* validity = nullptr;
+  /// Values of the array, not adjusted for the offset
+  const uint8_t* values = nullptr;
+  int64_t offset = 0;
+
+  bool is_scalar = false;
+  /// Bytes of the scalar value, in host memory
+  uint64_t scalar_bits = 0;
+};
+
+enum class ArithmeticOp { ADD, SUBTRACT, MULTIPLY, DIVIDE };
+
+enum class CompareOp { EQUAL, NOT_EQUAL, LESS, LESS_EQUAL, GREATER, GREATER_EQUAL };
+
+/// \brief Write the intersection of two validity bitmaps at offset 0
+///
+/// A null bitmap stands for all valid values.  The padding bits of the last
+/// byte are cleared.
+Status BitmapAnd(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+                 int64_t right_offset, int64_t length, uint8_t* out);
+
+/// \brief Count the set bits of a bitmap, into a host integer
+Status CountSetBits(const uint8_t* bitmap, int64_t offset, int64_t length,
+                    int64_t* out);
+
+/// \brief Compute an element-wise arithmetic operation on numeric values
+///
+/// Integer operations wrap around on overflow.  Slots not set in the output
+/// validity bitmap (if given, at offset 0) are not computed; a zero divisor
+/// in any other slot fails with Status::Invalid.
+Status Arithmetic(ArithmeticOp op, Type::type type, const DeviceValues& left,
+                  const DeviceValues& right, const uint8_t* out_validity,
+                  int64_t length, uint8_t* out);
+
+/// \brief Compare numeric values element-wise into a bitmap at offset 0
+Status Compare(CompareOp op, Type::type type, const DeviceValues& left,
+               const DeviceValues& right, int64_t length, uint8_t* out);
+
+/// \brief Sum the valid numeric values
+///
+/// The sum is written to host memory, as an int64_t for signed integers, an
+/// uint64_t for unsigned integers, and a double for floating-point values.
+Status Sum(Type::type type, const DeviceValues& values, int64_t length, void* out);
+
+/// \brief Gather fixed-width values at the given indices
+///
+/// \param[in] byte_width the width of the values: 1, 2, 4 or 8
+/// \param[in] values the values to gather from
+/// \param[in] values_length the number of values
+/// \param[in] index_type the integer type of the indices
+/// \param[in] indices the indices of the values to gather
+/// \param[in] length the number of indices
+/// \param[in] boundscheck whether to fail with Status::IndexError on an out of
+/// bounds index, rather than emit a null
+/// \param[in] negative_is_null whether negative indices emit a null
+/// \param[out] out_values the gathered values
+/// \param[out] out_validity the validity bitmap of the gathered values at offset
+/// 0, may be null if neither values nor indices can be null
+Status Take(int byte_width, const DeviceValues& values, int64_t values_length,
+            Type::type index_type, const DeviceValues& indices, int64_t length,
+            bool boundscheck, bool negative_is_null, uint8_t* out_values,
+            uint8_t* out_validity);
+
+/// \brief Compute the int64 indices of the values selected by a boolean filter
+///
+/// When emit_null is true, null filter slots emit a -1 index, otherwise they
+/// are dropped.
+///
+/// \param[in] filter the boolean filter
+/// \param[in] length the length of the filter
+/// \param[in] emit_null whether null filter slots emit a null
+/// \param[out] out_indices the selected indices, with room for length indices
+/// \param[out] out_length the number of selected indices, in host memory
+Status FilterIndices(const DeviceValues& filter, int64_t length, bool emit_null,
+                     int64_t* out_indices, int64_t* out_length);
+
+}  // namespace internal
+}  // namespace cuda
+}  // namespace arrow
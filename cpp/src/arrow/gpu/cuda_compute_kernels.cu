@@ -0,0 +1,668 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/gpu/cuda_compute_internal.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include <cuda_runtime.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform_reduce.h>
+
+namespace arrow {
+namespace cuda {
+namespace internal {
+
+namespace {
+
+constexpr int kThreadsPerBlock = 256;
+constexpr int64_t kMaxBlocks = 4096;
+
+int NumBlocks(int64_t num_items) {
+  const int64_t blocks = (num_items + kThreadsPerBlock - 1) / kThreadsPerBlock;
+  return static_cast<int>(std::max<int64_t>(1, std::min(kMaxBlocks, blocks)));
+}
+
+Status StatusFromCudaRuntime(cudaError_t err, const char* function_name) {
+  if (err == cudaSuccess) {
+    return Status::OK();
+  }
+  return Status::IOError("Cuda error ", static_cast<int>(err), " in function '",
+                         function_name, "': [", cudaGetErrorName(err), "] ",
+                         cudaGetErrorString(err));
+}
+
+#define CUDA_RT_RETURN_NOT_OK(FUNC_NAME, STMT)        \
+  do {                                                \
+    cudaError_t __err = (STMT);                       \
+    if (__err != cudaSuccess) {                       \
+      return StatusFromCudaRuntime(__err, FUNC_NAME); \
+    }                                                 \
+  } while (0)
+
+// Check the last kernel launch and wait for its completion
+Status WaitForKernel(const char* kernel_name) {
+  CUDA_RT_RETURN_NOT_OK(kernel_name, cudaGetLastError());
+  CUDA_RT_RETURN_NOT_OK("cudaDeviceSynchronize", cudaDeviceSynchronize());
+  return Status::OK();
+}
+
+// A device flag raised by kernels on invalid input
+class ErrorFlag {
+ public:
+  ~ErrorFlag() {
+    if (flag_ != nullptr) {
+      cudaFree(flag_);
+    }
+  }
+
+  Status Init() {
+    CUDA_RT_RETURN_NOT_OK("cudaMalloc", cudaMalloc(&flag_, sizeof(int)));
+    CUDA_RT_RETURN_NOT_OK("cudaMemset", cudaMemset(flag_, 0, sizeof(int)));
+    return Status::OK();
+  }
+
+  int* device_flag() const { return flag_; }
+
+  Status IsRaised(bool* out) const {
+    int flag = 0;
+    CUDA_RT_RETURN_NOT_OK("cudaMemcpy",
+                          cudaMemcpy(&flag, flag_, sizeof(int), cudaMemcpyDeviceToHost));
+    *out = flag != 0;
+    return Status::OK();
+  }
+
+ private:
+  int* flag_ = nullptr;
+};
+
+#define GRID_STRIDE_LOOP(INDEX, COUNT)                                         \
+  for (int64_t INDEX = static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x; \
+       INDEX < (COUNT); INDEX += static_cast<int64_t>(blockDim.x) * gridDim.x)
+
+__device__ inline bool GetBit(const uint8_t* bits, int64_t i) {
+  return (bits[i >> 3] >> (i & 7)) & 1;
+}
+
+__device__ inline bool IsValid(const uint8_t* validity, int64_t offset, int64_t i) {
+  return validity == nullptr || GetBit(validity, offset + i);
+}
+
+// Read the values of an argument, broadcasting scalars
+template <typename T>
+struct ValueReader {
+  const T* values;
+  T scalar;
+  bool is_scalar;
+
+  __device__ T operator[](int64_t i) const { return is_scalar ? scalar : values[i]; }
+};
+
+template <typename T>
+ValueReader<T> MakeValueReader(const DeviceValues& arg) {
+  ValueReader<T> reader;
+  reader.is_scalar = arg.is_scalar;
+  reader.scalar = T();
+  reader.values = nullptr;
+  if (arg.is_scalar) {
+    std::memcpy(&reader.scalar, &arg.scalar_bits, sizeof(T));
+  } else {
+    reader.values = reinterpret_cast<const T*>(arg.values) + arg.offset;
+  }
+  return reader;
+}
+
+// ----------------------------------------------------------------------
+// Bitmaps
+
+__global__ void BitmapAndKernel(const uint8_t* left, int64_t left_offset,
+                                const uint8_t* right, int64_t right_offset,
+                                int64_t length, uint8_t* out) {
+  const int64_t num_bytes = (length + 7) / 8;
+  GRID_STRIDE_LOOP(byte_index, num_bytes) {
+    uint8_t byte = 0;
+    for (int bit = 0; bit < 8; ++bit) {
+      const int64_t i = byte_index * 8 + bit;
+      if (i < length && IsValid(left, left_offset, i) &&
+          IsValid(right, right_offset, i)) {
+        byte |= static_cast<uint8_t>(1 << bit);
+      }
+    }
+    out[byte_index] = byte;
+  }
+}
+
+struct BitValue {
+  const uint8_t* bitmap;
+  int64_t offset;
+
+  __device__ int64_t operator()(int64_t i) const { return GetBit(bitmap, offset + i); }
+};
+
+// ----------------------------------------------------------------------
+// Arithmetic
+
+// Integer arithmetic is done on unsigned values to wrap around on overflow
+template <typename T, typename Enable = void>
+struct WrappingType {
+  using type = T;
+};
+
+template <typename T>
+struct WrappingType<T, typename std::enable_if<std::is_integral<T>::value>::type> {
+  using type = typename std::make_unsigned<T>::type;
+};
+
+struct AddOp {
+  template <typename T>
+  __device__ static T Call(T left, T right, bool*) {
+    using U = typename WrappingType<T>::type;
+    return static_cast<T>(static_cast<U>(left) + static_cast<U>(right));
+  }
+};
+
+struct SubtractOp {
+  template <typename T>
+  __device__ static T Call(T left, T right, bool*) {
+    using U = typename WrappingType<T>::type;
+    return static_cast<T>(static_cast<U>(left) - static_cast<U>(right));
+  }
+};
+
+struct MultiplyOp {
+  template <typename T>
+  __device__ static T Call(T left, T right, bool*) {
+    using U = typename WrappingType<T>::type;
+    return static_cast<T>(static_cast<U>(left) * static_cast<U>(right));
+  }
+};
+
+struct DivideOp {
+  template <typename T>
+  __device__ static typename std::enable_if<std::is_integral<T>::value, T>::type Call(
+      T left, T right, bool* divide_by_zero) {
+    if (right == 0) {
+      *divide_by_zero = true;
+      return 0;
+    }
+    if (std::is_signed<T>::value && right == static_cast<T>(-1)) {
+      // Avoid the overflow trap of dividing the minimum value by -1
+      using U = typename WrappingType<T>::type;
+      return static_cast<T>(U(0) - static_cast<U>(left));
+    }
+    return left / right;
+  }
+
+  template <typename T>
+  __device__ static typename std::enable_if<!std::is_integral<T>::value, T>::type Call(
+      T left, T right, bool*) {
+    return left / right;
+  }
+};
+
+template <typename T, typename Op>
+__global__ void ArithmeticKernel(ValueReader<T> left, ValueReader<T> right,
+                                 const uint8_t* validity, int64_t length, T* out,
+                                 int* error) {
+  GRID_STRIDE_LOOP(i, length) {
+    if (!IsValid(validity, 0, i)) {
+      out[i] = T();
+      continue;
+    }
+    bool failed = false;
+    out[i] = Op::Call(left[i], right[i], &failed);
+    if (failed) {
+      *error = 1;
+    }
+  }
+}
+
+template <typename T, typename Op>
+Status LaunchArithmetic(const DeviceValues& left, const DeviceValues& right,
+                        const uint8_t* out_validity, int64_t length, uint8_t* out) {
+  ErrorFlag error;
+  RETURN_NOT_OK(error.Init());
+  ArithmeticKernel<T, Op><<<NumBlocks(length), kThreadsPerBlock>>>(
+      MakeValueReader<T>(left), MakeValueReader<T>(right), out_validity, length,
+      reinterpret_cast<T*>(out), error.device_flag());
+  RETURN_NOT_OK(WaitForKernel("ArithmeticKernel"));
+  bool failed = false;
+  RETURN_NOT_OK(error.IsRaised(&failed));
+  if (failed) {
+    return Status::Invalid("divide by zero");
+  }
+  return Status::OK();
+}
+
+template <typename T>
+Status LaunchArithmetic(ArithmeticOp op, const DeviceValues& left,
+                        const DeviceValues& right, const uint8_t* out_validity,
+                        int64_t length, uint8_t* out) {
+  switch (op) {
+    case ArithmeticOp::ADD:
+      return LaunchArithmetic<T, AddOp>(left, right, out_validity, length, out);
+    case ArithmeticOp::SUBTRACT:
+      return LaunchArithmetic<T, SubtractOp>(left, right, out_validity, length, out);
+    case ArithmeticOp::MULTIPLY:
+      return LaunchArithmetic<T, MultiplyOp>(left, right, out_validity, length, out);
+    case ArithmeticOp::DIVIDE:
+      return LaunchArithmetic<T, DivideOp>(left, right, out_validity, length, out);
+  }
+  return Status::NotImplemented("Unknown arithmetic operation");
+}
+
+// ----------------------------------------------------------------------
+// Comparison
+
+struct EqualOp {
+  template <typename T>
+  __device__ static bool Call(T left, T right) {
+    return left == right;
+  }
+};
+
+struct NotEqualOp {
+  template <typename T>
+  __device__ static bool Call(T left, T right) {
+    return left != right;
+  }
+};
+
+struct LessOp {
+  template <typename T>
+  __device__ static bool Call(T left, T right) {
+    return left < right;
+  }
+};
+
+struct LessEqualOp {
+  template <typename T>
+  __device__ static bool Call(T left, T right) {
+    return left <= right;
+  }
+};
+
+struct GreaterOp {
+  template <typename T>
+  __device__ static bool Call(T left, T right) {
+    return left > right;
+  }
+};
+
+struct GreaterEqualOp {
+  template <typename T>
+  __device__ static bool Call(T left, T right) {
+    return left >= right;
+  }
+};
+
+// Each thread writes whole bytes of the output bitmap
+template <typename T, typename Op>
+__global__ void CompareKernel(ValueReader<T> left, ValueReader<T> right, int64_t length,
+                              uint8_t* out) {
+  const int64_t num_bytes = (length + 7) / 8;
+  GRID_STRIDE_LOOP(byte_index, num_bytes) {
+    uint8_t byte = 0;
+    for (int bit = 0; bit < 8; ++bit) {
+      const int64_t i = byte_index * 8 + bit;
+      if (i < length && Op::Call(left[i], right[i])) {
+        byte |= static_cast<uint8_t>(1 << bit);
+      }
+    }
+    out[byte_index] = byte;
+  }
+}
+
+template <typename T, typename Op>
+Status LaunchCompare(const DeviceValues& left, const DeviceValues& right,
+                     int64_t length, uint8_t* out) {
+  CompareKernel<T, Op><<<NumBlocks((length + 7) / 8), kThreadsPerBlock>>>(
+      MakeValueReader<T>(left), MakeValueReader<T>(right), length, out);
+  return WaitForKernel("CompareKernel");
+}
+
+template <typename T>
+Status LaunchCompare(CompareOp op, const DeviceValues& left, const DeviceValues& right,
+                     int64_t length, uint8_t* out) {
+  switch (op) {
+    case CompareOp::EQUAL:
+      return LaunchCompare<T, EqualOp>(left, right, length, out);
+    case CompareOp::NOT_EQUAL:
+      return LaunchCompare<T, NotEqualOp>(left, right, length, out);
+    case CompareOp::LESS:
+      return LaunchCompare<T, LessOp>(left, right, length, out);
+    case CompareOp::LESS_EQUAL:
+      return LaunchCompare<T, LessEqualOp>(left, right, length, out);
+    case CompareOp::GREATER:
+      return LaunchCompare<T, GreaterOp>(left, right, length, out);
+    case CompareOp::GREATER_EQUAL:
+      return LaunchCompare<T, GreaterEqualOp>(left, right, length, out);
+  }
+  return Status::NotImplemented("Unknown comparison operation");
+}
+
+// ----------------------------------------------------------------------
+// Sum
+
+// Signed integers are summed as unsigned values, to wrap around on overflow
+template <typename T, typename Enable = void>
+struct SumTypes {
+  using Accumulator = double;
+  using Output = double;
+};
+
+template <typename T>
+struct SumTypes<T, typename std::enable_if<std::is_integral<T>::value>::type> {
+  using Accumulator = uint64_t;
+  using Output =
+      typename std::conditional<std::is_signed<T>::value, int64_t, uint64_t>::type;
+};
+
+template <typename T, typename Accumulator>
+struct SumValue {
+  const T* values;
+  const uint8_t* validity;
+  int64_t offset;
+
+  __device__ Accumulator operator()(int64_t i) const {
+    if (!IsValid(validity, offset, i)) {
+      return Accumulator(0);
+    }
+    using Output = typename SumTypes<T>::Output;
+    return static_cast<Accumulator>(static_cast<Output>(values[i]));
+  }
+};
+
+template <typename T>
+Status LaunchSum(const DeviceValues& values, int64_t length, void* out) {
+  using Accumulator = typename SumTypes<T>::Accumulator;
+  using Output = typename SumTypes<T>::Output;
+  const T* raw_values = reinterpret_cast<const T*>(values.values) + values.offset;
+  SumValue<T, Accumulator> value{raw_values, values.validity, values.offset};
+  const Accumulator sum = thrust::transform_reduce(
+      thrust::device, thrust::counting_iterator<int64_t>(0),
+      thrust::counting_iterator<int64_t>(length), value, Accumulator(0),
+      thrust::plus<Accumulator>());
+  RETURN_NOT_OK(WaitForKernel("Sum"));
+  *reinterpret_cast<Output*>(out) = static_cast<Output>(sum);
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Take and filter
+
+// Each thread gathers the values of a whole byte of the output bitmap
+template <typename T, typename IndexType>
+__global__ void TakeKernel(const T* values, const uint8_t* values_validity,
+                           int64_t values_offset, int64_t values_length,
+                           const IndexType* indices, const uint8_t* indices_validity,
+                           int64_t indices_offset, int64_t length, bool boundscheck,
+                           bool negative_is_null, T* out, uint8_t* out_validity,
+                           int* error) {
+  const int64_t num_bytes = (length + 7) / 8;
+  GRID_STRIDE_LOOP(byte_index, num_bytes) {
+    uint8_t byte = 0;
+    for (int bit = 0; bit < 8; ++bit) {
+      const int64_t i = byte_index * 8 + bit;
+      if (i >= length) {
+        break;
+      }
+      bool valid = IsValid(indices_validity, indices_offset, i);
+      const int64_t index = valid ? static_cast<int64_t>(indices[i]) : 0;
+      if (valid && index < 0 && negative_is_null) {
+        valid = false;
+      } else if (valid && (index < 0 || index >= values_length)) {
+        if (boundscheck) {
+          *error = 1;
+        }
+        valid = false;
+      }
+      valid = valid && IsValid(values_validity, values_offset, index);
+      out[i] = valid ? values[index] : T();
+      if (valid) {
+        byte |= static_cast<uint8_t>(1 << bit);
+      }
+    }
+    if (out_validity != nullptr) {
+      out_validity[byte_index] = byte;
+    }
+  }
+}
+
+template <typename T, typename IndexType>
+Status LaunchTake(const DeviceValues& values, int64_t values_length,
+                  const DeviceValues& indices, int64_t length, bool boundscheck,
+                  bool negative_is_null, uint8_t* out_values, uint8_t* out_validity) {
+  ErrorFlag error;
+  RETURN_NOT_OK(error.Init());
+  TakeKernel<T, IndexType><<<NumBlocks((length + 7) / 8), kThreadsPerBlock>>>(
+      reinterpret_cast<const T*>(values.values) + values.offset, values.validity,
+      values.offset, values_length,
+      reinterpret_cast<const IndexType*>(indices.values) + indices.offset,
+      indices.validity, indices.offset, length, boundscheck, negative_is_null,
+      reinterpret_cast<T*>(out_values), out_validity, error.device_flag());
+  RETURN_NOT_OK(WaitForKernel("TakeKernel"));
+  bool failed = false;
+  RETURN_NOT_OK(error.IsRaised(&failed));
+  if (failed) {
+    return Status::IndexError("Index out of bounds");
+  }
+  return Status::OK();
+}
+
+template <typename T>
+Status LaunchTake(const DeviceValues& values, int64_t values_length,
+                  Type::type index_type, const DeviceValues& indices, int64_t length,
+                  bool boundscheck, bool negative_is_null, uint8_t* out_values,
+                  uint8_t* out_validity) {
+  switch (index_type) {
+#define TAKE_INDEX_CASE(TYPE_ID, INDEX_TYPE)                                    \
+  case Type::TYPE_ID:                                                           \
+    return LaunchTake<T, INDEX_TYPE>(values, values_length, indices, length,    \
+                                     boundscheck, negative_is_null, out_values, \
+                                     out_validity);
+    TAKE_INDEX_CASE(INT8, int8_t)
+    TAKE_INDEX_CASE(INT16, int16_t)
+    TAKE_INDEX_CASE(INT32, int32_t)
+    TAKE_INDEX_CASE(INT64, int64_t)
+    TAKE_INDEX_CASE(UINT8, uint8_t)
+    TAKE_INDEX_CASE(UINT16, uint16_t)
+    TAKE_INDEX_CASE(UINT32, uint32_t)
+    TAKE_INDEX_CASE(UINT64, uint64_t)
+#undef TAKE_INDEX_CASE
+    default:
+      return Status::NotImplemented("Take on the device with non-integer indices");
+  }
+}
+
+// Whether a filter slot emits an output value
+__device__ inline bool FilterEmits(const DeviceValues& filter, int64_t i,
+                                   bool emit_null) {
+  if (!IsValid(filter.validity, filter.offset, i)) {
+    return emit_null;
+  }
+  return GetBit(filter.values, filter.offset + i);
+}
+
+__global__ void FilterFlagsKernel(DeviceValues filter, int64_t length, bool emit_null,
+                                  int64_t* out) {
+  GRID_STRIDE_LOOP(i, length) { out[i] = FilterEmits(filter, i, emit_null) ? 1 : 0; }
+}
+
+__global__ void FilterScatterKernel(DeviceValues filter, int64_t length, bool emit_null,
+                                    const int64_t* positions, int64_t* out) {
+  GRID_STRIDE_LOOP(i, length) {
+    if (FilterEmits(filter, i, emit_null)) {
+      out[positions[i]] = IsValid(filter.validity, filter.offset, i) ? i : -1;
+    }
+  }
+}
+
+}  // namespace
+
+#define NUMERIC_TYPE_CASES(ACTION) \
+  ACTION(INT8, int8_t)             \
+  ACTION(INT16, int16_t)           \
+  ACTION(INT32, int32_t)           \
+  ACTION(INT64, int64_t)           \
+  ACTION(UINT8, uint8_t)           \
+  ACTION(UINT16, uint16_t)         \
+  ACTION(UINT32, uint32_t)         \
+  ACTION(UINT64, uint64_t)         \
+  ACTION(FLOAT, float)             \
+  ACTION(DOUBLE, double)
+
+Status BitmapAnd(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+                 int64_t right_offset, int64_t length, uint8_t* out) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  BitmapAndKernel<<<NumBlocks((length + 7) / 8), kThreadsPerBlock>>>(
+      left, left_offset, right, right_offset, length, out);
+  return WaitForKernel("BitmapAndKernel");
+}
+
+Status CountSetBits(const uint8_t* bitmap, int64_t offset, int64_t length,
+                    int64_t* out) {
+  *out = thrust::transform_reduce(thrust::device, thrust::counting_iterator<int64_t>(0),
+                                  thrust::counting_iterator<int64_t>(length),
+                                  BitValue{bitmap, offset}, int64_t(0),
+                                  thrust::plus<int64_t>());
+  return WaitForKernel("CountSetBits");
+}
+
+Status Arithmetic(ArithmeticOp op, Type::type type, const DeviceValues& left,
+                  const DeviceValues& right, const uint8_t* out_validity,
+                  int64_t length, uint8_t* out) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  switch (type) {
+#define ARITHMETIC_CASE(TYPE_ID, CTYPE) \
+  case Type::TYPE_ID:                   \
+    return LaunchArithmetic<CTYPE>(op, left, right, out_validity, length, out);
+    NUMERIC_TYPE_CASES(ARITHMETIC_CASE)
+#undef ARITHMETIC_CASE
+    default:
+      return Status::NotImplemented("Arithmetic on the device with non-numeric type");
+  }
+}
+
+Status Compare(CompareOp op, Type::type type, const DeviceValues& left,
+               const DeviceValues& right, int64_t length, uint8_t* out) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  switch (type) {
+#define COMPARE_CASE(TYPE_ID, CTYPE) \
+  case Type::TYPE_ID:                \
+    return LaunchCompare<CTYPE>(op, left, right, length, out);
+    NUMERIC_TYPE_CASES(COMPARE_CASE)
+#undef COMPARE_CASE
+    default:
+      return Status::NotImplemented("Comparison on the device with non-numeric type");
+  }
+}
+
+Status Sum(Type::type type, const DeviceValues& values, int64_t length, void* out) {
+  switch (type) {
+#define SUM_CASE(TYPE_ID, CTYPE) \
+  case Type::TYPE_ID:            \
+    return LaunchSum<CTYPE>(values, length, out);
+    NUMERIC_TYPE_CASES(SUM_CASE)
+#undef SUM_CASE
+    default:
+      return Status::NotImplemented("Sum on the device with non-numeric type");
+  }
+}
+
+#undef NUMERIC_TYPE_CASES
+
+Status Take(int byte_width, const DeviceValues& values, int64_t values_length,
+            Type::type index_type, const DeviceValues& indices, int64_t length,
+            bool boundscheck, bool negative_is_null, uint8_t* out_values,
+            uint8_t* out_validity) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  switch (byte_width) {
+    case 1:
+      return LaunchTake<uint8_t>(values, values_length, index_type, indices, length,
+                                 boundscheck, negative_is_null, out_values,
+                                 out_validity);
+    case 2:
+      return LaunchTake<uint16_t>(values, values_length, index_type, indices, length,
+                                  boundscheck, negative_is_null, out_values,
+                                  out_validity);
+    case 4:
+      return LaunchTake<uint32_t>(values, values_length, index_type, indices, length,
+                                  boundscheck, negative_is_null, out_values,
+                                  out_validity);
+    case 8:
+      return LaunchTake<uint64_t>(values, values_length, index_type, indices, length,
+                                  boundscheck, negative_is_null, out_values,
+                                  out_validity);
+    default:
+      return Status::NotImplemented("Take on the device with values of byte width ",
+                                    byte_width);
+  }
+}
+
+Status FilterIndices(const DeviceValues& filter, int64_t length, bool emit_null,
+                     int64_t* out_indices, int64_t* out_length) {
+  *out_length = 0;
+  if (length == 0) {
+    return Status::OK();
+  }
+  int64_t* positions = nullptr;
+  CUDA_RT_RETURN_NOT_OK("cudaMalloc",
+                        cudaMalloc(&positions, static_cast<size_t>(length) * 8));
+  auto status = [&]() -> Status {
+    FilterFlagsKernel<<<NumBlocks(length), kThreadsPerBlock>>>(filter, length,
+                                                               emit_null, positions);
+    RETURN_NOT_OK(WaitForKernel("FilterFlagsKernel"));
+
+    // The output length is the last position plus the last flag
+    int64_t last_flag = 0;
+    CUDA_RT_RETURN_NOT_OK("cudaMemcpy",
+                          cudaMemcpy(&last_flag, positions + length - 1, sizeof(int64_t),
+                                     cudaMemcpyDeviceToHost));
+    thrust::exclusive_scan(thrust::device, positions, positions + length, positions);
+    RETURN_NOT_OK(WaitForKernel("FilterScan"));
+    int64_t last_position = 0;
+    CUDA_RT_RETURN_NOT_OK("cudaMemcpy",
+                          cudaMemcpy(&last_position, positions + length - 1,
+                                     sizeof(int64_t), cudaMemcpyDeviceToHost));
+    *out_length = last_position + last_flag;
+
+    FilterScatterKernel<<<NumBlocks(length), kThreadsPerBlock>>>(
+        filter, length, emit_null, positions, out_indices);
+    return WaitForKernel("FilterScatterKernel");
+  }();
+  cudaFree(positions);
+  return status;
+}
+
+}  // namespace internal
+}  // namespace cuda
+}  // namespace arrow
@@ -0,0 +1,174 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "arrow/array.h"
+#include "arrow/compute/api.h"
+#include "arrow/compute/registry.h"
+#include "arrow/gpu/cuda_api.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace cuda {
+
+using compute::CallFunction;
+
+constexpr int kGpuNumber = 0;
+
+class TestCudaCompute : public ::testing::Test {
+ public:
+  static void SetUpTestCase() { ASSERT_OK(RegisterComputeFunctions()); }
+
+  void SetUp() {
+    ASSERT_OK_AND_ASSIGN(auto manager, CudaDeviceManager::Instance());
+    ASSERT_OK_AND_ASSIGN(device_, manager->GetDevice(kGpuNumber));
+    mm_ = device_->default_memory_manager();
+  }
+
+  // Copy the buffers of an array to the device
+  std::shared_ptr<Array> ToDevice(const std::shared_ptr<DataType>& type,
+                                  const std::string& json) {
+    auto array = ArrayFromJSON(type, json);
+    auto data = array->data()->Copy();
+    for (auto& buffer : data->buffers) {
+      if (buffer != nullptr) {
+        EXPECT_OK_AND_ASSIGN(buffer, Buffer::Copy(buffer, mm_));
+      }
+    }
+    return MakeArray(data);
+  }
+
+  // Copy the buffers of a device array back to the host
+  std::shared_ptr<Array> ToHost(const Datum& datum) {
+    EXPECT_TRUE(datum.is_array());
+    auto data = datum.array()->Copy();
+    for (auto& buffer : data->buffers) {
+      if (buffer != nullptr) {
+        EXPECT_TRUE(IsCudaDevice(*buffer->device()));
+        EXPECT_OK_AND_ASSIGN(buffer,
+                             Buffer::Copy(buffer, default_cpu_memory_manager()));
+      }
+    }
+    return MakeArray(data);
+  }
+
+  void AssertDeviceArray(const Datum& actual, const std::shared_ptr<DataType>& type,
+                         const std::string& expected_json) {
+    auto actual_host = ToHost(actual);
+    ASSERT_OK(actual_host->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(type, expected_json), *actual_host,
+                      /*verbose=*/true);
+  }
+
+ protected:
+  std::shared_ptr<Device> device_;
+  std::shared_ptr<MemoryManager> mm_;
+};
+
+TEST_F(TestCudaCompute, Arithmetic) {
+  auto left = ToDevice(int32(), "[1, 2, null, 4, 2147483647]");
+  auto right = ToDevice(int32(), "[10, null, 30, 40, 1]");
+
+  ASSERT_OK_AND_ASSIGN(Datum out, CallFunction("add", {left, right}));
+  AssertDeviceArray(out, int32(), "[11, null, null, 44, -2147483648]");
+  ASSERT_OK_AND_ASSIGN(out, CallFunction("multiply", {left, Datum(int32_t(3))}));
+  AssertDeviceArray(out, int32(), "[3, 6, null, 12, 2147483645]");
+  ASSERT_OK_AND_ASSIGN(out, CallFunction("subtract", {left, MakeNullScalar(int32())}));
+  AssertDeviceArray(out, int32(), "[null, null, null, null, null]");
+
+  auto dividend = ToDevice(float64(), "[1.5, 3, null]");
+  auto divisor = ToDevice(float64(), "[0.5, 2, 1]");
+  ASSERT_OK_AND_ASSIGN(out, CallFunction("divide", {dividend, divisor}));
+  AssertDeviceArray(out, float64(), "[3, 1.5, null]");
+
+  auto zero_divisor = ToDevice(int32(), "[1, 1, 1, 0, 1]");
+  ASSERT_RAISES(Invalid, CallFunction("divide", {left, zero_divisor}));
+  // Overflow checking is not supported
+  compute::ArithmeticOptions options;
+  options.check_overflow = true;
+  ASSERT_RAISES(NotImplemented, CallFunction("add", {left, right}, &options));
+  // Arguments on different devices
+  auto host_array = ArrayFromJSON(int32(), "[1, 2, 3, 4, 5]");
+  ASSERT_RAISES(Invalid, CallFunction("add", {left, host_array}));
+}
+
+TEST_F(TestCudaCompute, Compare) {
+  auto left = ToDevice(int64(), "[1, 2, null, 4]");
+  auto right = ToDevice(int64(), "[1, 3, 3, 3]");
+
+  ASSERT_OK_AND_ASSIGN(Datum out, CallFunction("equal", {left, right}));
+  AssertDeviceArray(out, boolean(), "[true, false, null, false]");
+  ASSERT_OK_AND_ASSIGN(out, CallFunction("greater", {left, right}));
+  AssertDeviceArray(out, boolean(), "[false, false, null, true]");
+  ASSERT_OK_AND_ASSIGN(out, CallFunction("less_equal", {left, Datum(int64_t(2))}));
+  AssertDeviceArray(out, boolean(), "[true, true, null, false]");
+}
+
+TEST_F(TestCudaCompute, Sum) {
+  ASSERT_OK_AND_ASSIGN(Datum out,
+                       CallFunction("sum", {ToDevice(int8(), "[1, null, 100, 100]")}));
+  AssertScalarsEqual(Int64Scalar(201), *out.scalar(), /*verbose=*/true);
+  ASSERT_OK_AND_ASSIGN(out, CallFunction("sum", {ToDevice(float32(), "[1.5, 2.5]")}));
+  AssertScalarsEqual(DoubleScalar(4.0), *out.scalar(), /*verbose=*/true);
+  ASSERT_OK_AND_ASSIGN(out, CallFunction("sum", {ToDevice(uint16(), "[null, null]")}));
+  AssertScalarsEqual(*MakeNullScalar(uint64()), *out.scalar(), /*verbose=*/true);
+}
+
+TEST_F(TestCudaCompute, Take) {
+  auto values = ToDevice(int16(), "[10, 20, null, 40]");
+
+  auto indices = ToDevice(int32(), "[3, 0, null, 2]");
+  ASSERT_OK_AND_ASSIGN(Datum out, CallFunction("take", {values, indices}));
+  AssertDeviceArray(out, int16(), "[40, 10, null, null]");
+  ASSERT_RAISES(IndexError, CallFunction("take", {values, ToDevice(int8(), "[4]")}));
+}
+
+TEST_F(TestCudaCompute, Filter) {
+  auto values = ToDevice(float64(), "[1, 2, null, 4, 5]");
+  auto filter = ToDevice(boolean(), "[true, false, true, null, true]");
+
+  ASSERT_OK_AND_ASSIGN(Datum out, CallFunction("filter", {values, filter}));
+  AssertDeviceArray(out, float64(), "[1, null, 5]");
+  compute::FilterOptions options(compute::FilterOptions::EMIT_NULL);
+  ASSERT_OK_AND_ASSIGN(out, CallFunction("filter", {values, filter}, &options));
+  AssertDeviceArray(out, float64(), "[1, null, null, 5]");
+}
+
+TEST_F(TestCudaCompute, Pipeline) {
+  // Intermediate results stay on the device
+  auto values = ToDevice(int32(), "[5, 1, 4, null, 2]");
+  ASSERT_OK_AND_ASSIGN(Datum mask, CallFunction("greater", {values, Datum(int32_t(1))}));
+  ASSERT_OK_AND_ASSIGN(Datum selected, CallFunction("filter", {values, mask}));
+  ASSERT_OK_AND_ASSIGN(Datum sum, CallFunction("sum", {selected}));
+  AssertScalarsEqual(Int64Scalar(11), *sum.scalar(), /*verbose=*/true);
+}
+
+TEST_F(TestCudaCompute, Unsupported) {
+  auto values = ToDevice(utf8(), R"(["a", "b"])");
+  ASSERT_RAISES(NotImplemented, CallFunction("take", {values, ToDevice(int32(), "[0]")}));
+  ASSERT_RAISES(NotImplemented, CallFunction("unique", {ToDevice(int32(), "[1, 1]")}));
+}
+
+}  // namespace cuda
+}  // namespace arrow
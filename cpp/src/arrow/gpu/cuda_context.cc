@@ -63,9 +63,15 @@ struct DeviceProperties {
   }
 };
 
+}  // namespace
+
+namespace internal {
+
 const char kCudaDeviceTypeName[] = "arrow::cuda::CudaDevice";
 
-}  // namespace
+}  // namespace internal
+
+using internal::kCudaDeviceTypeName;
 
 struct CudaDevice::Impl {
   DeviceProperties props;
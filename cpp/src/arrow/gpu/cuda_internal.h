@@ -31,6 +31,9 @@ namespace arrow {
 namespace cuda {
 namespace internal {
 
+/// The type name of CUDA devices, as returned by Device::type_name()
+extern const char kCudaDeviceTypeName[];
+
 std::string CudaErrorDescription(CUresult err);
 
 Status StatusFromCuda(CUresult res, const char* function_name = nullptr);
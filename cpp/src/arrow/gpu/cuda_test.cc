@@ -620,5 +620,56 @@ TEST_F(TestCudaArrowIpc, DictionaryWriteRead) {
   CompareBatch(*batch, *cpu_batch);
 }
 
+// ------------------------------------------------------------------------
+// Test pipelined record batch transfers
+
+class TestCudaRecordBatchTransfer : public TestCudaBase {
+ public:
+  void AssertOnDevice(const RecordBatch& batch, bool on_device) {
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      for (const auto& buffer : batch.column_data(i)->buffers) {
+        if (buffer != nullptr) {
+          ASSERT_EQ(on_device, !buffer->is_cpu());
+        }
+      }
+    }
+  }
+};
+
+TEST_F(TestCudaRecordBatchTransfer, RoundTrip) {
+  std::vector<std::shared_ptr<RecordBatch>> batches(3);
+  ASSERT_OK(ipc::test::MakeIntRecordBatch(&batches[0]));
+  ASSERT_OK(ipc::test::MakeListRecordBatch(&batches[1]));
+  ASSERT_OK(ipc::test::MakeStringTypesRecordBatch(&batches[2]));
+
+  CudaTransferOptions options;
+  options.staging_size = 64;
+  ASSERT_OK_AND_ASSIGN(auto to_device, CudaRecordBatchTransfer::Make(context_, options));
+  ASSERT_OK_AND_ASSIGN(auto to_host, CudaRecordBatchTransfer::Make(context_, options));
+
+  // Submit more batches than the pipeline depth
+  for (const auto& batch : batches) {
+    ASSERT_OK(to_device->Submit(batch));
+  }
+  ASSERT_EQ(to_device->num_pending(), 3);
+  for (const auto& batch : batches) {
+    ASSERT_OK_AND_ASSIGN(auto device_batch, to_device->Next());
+    ASSERT_NE(device_batch, nullptr);
+    AssertOnDevice(*device_batch, true);
+    ASSERT_OK(to_host->Submit(device_batch));
+    ASSERT_OK_AND_ASSIGN(auto host_batch, to_host->Next());
+    AssertOnDevice(*host_batch, false);
+    CompareBatch(*batch, *host_batch);
+  }
+  ASSERT_OK_AND_ASSIGN(auto end, to_device->Next());
+  ASSERT_EQ(end, nullptr);
+}
+
+TEST_F(TestCudaRecordBatchTransfer, Errors) {
+  CudaTransferOptions options;
+  options.pipeline_depth = 0;
+  ASSERT_RAISES(Invalid, CudaRecordBatchTransfer::Make(context_, options));
+}
+
 }  // namespace cuda
 }  // namespace arrow
@@ -0,0 +1,301 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/gpu/cuda_transfer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <cuda.h>
+
+#include "arrow/array/data.h"
+#include "arrow/buffer.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+
+#include "arrow/gpu/cuda_context.h"
+#include "arrow/gpu/cuda_internal.h"
+#include "arrow/gpu/cuda_memory.h"
+
+namespace arrow {
+namespace cuda {
+
+using internal::ContextSaver;
+
+namespace {
+
+// Collect the non-null buffers of an array, depth-first
+void CollectBuffers(const ArrayData& data, std::vector<std::shared_ptr<Buffer>>* out) {
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      out->push_back(buffer);
+    }
+  }
+  for (const auto& child : data.child_data) {
+    CollectBuffers(*child, out);
+  }
+  if (data.dictionary != nullptr) {
+    CollectBuffers(*data.dictionary, out);
+  }
+}
+
+// The inverse of CollectBuffers: substitute the buffers of an array, in order
+std::shared_ptr<ArrayData> ReplaceBuffers(
+    const ArrayData& data, const std::vector<std::shared_ptr<Buffer>>& buffers,
+    size_t* next) {
+  auto out = data.Copy();
+  for (auto& buffer : out->buffers) {
+    if (buffer != nullptr) {
+      buffer = buffers[(*next)++];
+    }
+  }
+  for (auto& child : out->child_data) {
+    child = ReplaceBuffers(*child, buffers, next);
+  }
+  if (out->dictionary != nullptr) {
+    out->dictionary = ReplaceBuffers(*out->dictionary, buffers, next);
+  }
+  return out;
+}
+
+}  // namespace
+
+class CudaRecordBatchTransfer::Impl {
+ public:
+  ~Impl() {
+    if (context_ == nullptr) {
+      return;
+    }
+    ContextSaver set_temporary(*context_);
+    for (auto& slot : slots_) {
+      if (slot.stream != nullptr) {
+        // Staging buffers must outlive the copies in flight
+        ARROW_UNUSED(cuStreamSynchronize(slot.stream));
+        ARROW_UNUSED(cuStreamDestroy(slot.stream));
+      }
+    }
+  }
+
+  Status Init(std::shared_ptr<CudaContext> context, const CudaTransferOptions& options) {
+    if (options.pipeline_depth < 1) {
+      return Status::Invalid("Transfer pipeline depth must be at least 1");
+    }
+    context_ = std::move(context);
+    options_ = options;
+    ContextSaver set_temporary(*context_);
+    slots_.resize(options_.pipeline_depth);
+    for (auto& slot : slots_) {
+      CU_RETURN_NOT_OK("cuStreamCreate",
+                       cuStreamCreate(&slot.stream, CU_STREAM_NON_BLOCKING));
+    }
+    return Status::OK();
+  }
+
+  Status Submit(std::shared_ptr<RecordBatch> batch) {
+    Pending pending;
+    pending.slot = next_slot_;
+    next_slot_ = (next_slot_ + 1) % options_.pipeline_depth;
+    RETURN_NOT_OK(ReleaseSlot(pending.slot));
+    Slot& slot = slots_[pending.slot];
+
+    for (int i = 0; i < batch->num_columns(); ++i) {
+      CollectBuffers(*batch->column_data(i), &pending.buffers);
+    }
+    int64_t num_device_buffers = 0;
+    int64_t staging_size = 0;
+    for (const auto& buffer : pending.buffers) {
+      num_device_buffers += !buffer->is_cpu();
+      pending.offsets.push_back(staging_size);
+      staging_size += BitUtil::RoundUpToMultipleOf64(buffer->size());
+    }
+    if (num_device_buffers != 0 &&
+        num_device_buffers != static_cast<int64_t>(pending.buffers.size())) {
+      return Status::Invalid(
+          "Cannot transfer a record batch residing both on the CPU and a device");
+    }
+    pending.to_device = num_device_buffers == 0;
+    pending.size = staging_size;
+    RETURN_NOT_OK(ReserveStaging(&slot, staging_size));
+
+    ContextSaver set_temporary(*context_);
+    if (pending.to_device) {
+      // Coalesce the buffers so that small buffers don't pay for a copy each
+      for (size_t i = 0; i < pending.buffers.size(); ++i) {
+        const Buffer& buffer = *pending.buffers[i];
+        if (buffer.size() > 0) {
+          std::memcpy(slot.staging->mutable_data() + pending.offsets[i], buffer.data(),
+                      static_cast<size_t>(buffer.size()));
+        }
+      }
+      ARROW_ASSIGN_OR_RAISE(pending.device_data, context_->Allocate(staging_size));
+      if (staging_size > 0) {
+        CU_RETURN_NOT_OK("cuMemcpyHtoDAsync",
+                         cuMemcpyHtoDAsync(pending.device_data->address(),
+                                           slot.staging->data(),
+                                           static_cast<size_t>(staging_size),
+                                           slot.stream));
+      }
+    } else {
+      for (size_t i = 0; i < pending.buffers.size(); ++i) {
+        const Buffer& buffer = *pending.buffers[i];
+        if (buffer.size() > 0) {
+          uint8_t* dest = slot.staging->mutable_data() + pending.offsets[i];
+          CU_RETURN_NOT_OK("cuMemcpyDtoHAsync",
+                           cuMemcpyDtoHAsync(dest, buffer.address(),
+                                             static_cast<size_t>(buffer.size()),
+                                             slot.stream));
+        }
+      }
+    }
+    pending.batch = std::move(batch);
+    pending_.push_back(std::move(pending));
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    if (pending_.empty()) {
+      return nullptr;
+    }
+    RETURN_NOT_OK(Finish(&pending_.front()));
+    auto out = std::move(pending_.front().batch);
+    pending_.pop_front();
+    return out;
+  }
+
+  int64_t num_pending() const { return static_cast<int64_t>(pending_.size()); }
+
+ private:
+  struct Slot {
+    CUstream stream = nullptr;
+    std::shared_ptr<CudaHostBuffer> staging;
+  };
+
+  struct Pending {
+    int slot = 0;
+    bool to_device = true;
+    bool done = false;
+    // The source batch until done, then its copy
+    std::shared_ptr<RecordBatch> batch;
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    // Offsets of the buffers in the staging buffer and device copy
+    std::vector<int64_t> offsets;
+    int64_t size = 0;
+    std::shared_ptr<CudaBuffer> device_data;
+  };
+
+  // Wait for the batch in flight on the slot, if any, so that its staging
+  // buffer can be reused
+  Status ReleaseSlot(int slot) {
+    for (auto& pending : pending_) {
+      if (pending.slot == slot && !pending.done) {
+        RETURN_NOT_OK(Finish(&pending));
+      }
+    }
+    return Status::OK();
+  }
+
+  Status ReserveStaging(Slot* slot, int64_t size) {
+    const int64_t capacity = slot->staging == nullptr ? 0 : slot->staging->size();
+    if (size == 0 || size <= capacity) {
+      return Status::OK();
+    }
+    slot->staging.reset();
+    const int64_t new_capacity = std::max({size, 2 * capacity, options_.staging_size});
+    return AllocateCudaHostBuffer(context_->device_number(), new_capacity)
+        .Value(&slot->staging);
+  }
+
+  Status Finish(Pending* pending) {
+    if (pending->done) {
+      return Status::OK();
+    }
+    {
+      ContextSaver set_temporary(*context_);
+      CU_RETURN_NOT_OK("cuStreamSynchronize",
+                       cuStreamSynchronize(slots_[pending->slot].stream));
+    }
+    std::vector<std::shared_ptr<Buffer>> copies;
+    if (pending->to_device) {
+      for (size_t i = 0; i < pending->buffers.size(); ++i) {
+        copies.push_back(std::make_shared<CudaBuffer>(
+            pending->device_data, pending->offsets[i], pending->buffers[i]->size()));
+      }
+    } else {
+      // Copy out of the staging buffer, which is reused by the next batches
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> host_data,
+                            AllocateBuffer(pending->size, options_.pool));
+      if (pending->size > 0) {
+        std::memcpy(host_data->mutable_data(), slots_[pending->slot].staging->data(),
+                    static_cast<size_t>(pending->size));
+      }
+      for (size_t i = 0; i < pending->buffers.size(); ++i) {
+        copies.push_back(
+            SliceBuffer(host_data, pending->offsets[i], pending->buffers[i]->size()));
+      }
+    }
+
+    const RecordBatch& source = *pending->batch;
+    ArrayDataVector columns;
+    size_t next = 0;
+    for (int i = 0; i < source.num_columns(); ++i) {
+      columns.push_back(ReplaceBuffers(*source.column_data(i), copies, &next));
+    }
+    DCHECK_EQ(next, copies.size());
+    pending->batch =
+        RecordBatch::Make(source.schema(), source.num_rows(), std::move(columns));
+    pending->buffers.clear();
+    pending->device_data.reset();
+    pending->done = true;
+    return Status::OK();
+  }
+
+  std::shared_ptr<CudaContext> context_;
+  CudaTransferOptions options_;
+  std::vector<Slot> slots_;
+  int next_slot_ = 0;
+  std::deque<Pending> pending_;
+};
+
+CudaRecordBatchTransfer::CudaRecordBatchTransfer() : impl_(new Impl()) {}
+
+CudaRecordBatchTransfer::~CudaRecordBatchTransfer() {}
+
+Result<std::unique_ptr<CudaRecordBatchTransfer>> CudaRecordBatchTransfer::Make(
+    std::shared_ptr<CudaContext> context, const CudaTransferOptions& options) {
+  std::unique_ptr<CudaRecordBatchTransfer> transfer(new CudaRecordBatchTransfer());
+  RETURN_NOT_OK(transfer->impl_->Init(std::move(context), options));
+  return std::move(transfer);
+}
+
+Status CudaRecordBatchTransfer::Submit(std::shared_ptr<RecordBatch> batch) {
+  return impl_->Submit(std::move(batch));
+}
+
+Result<std::shared_ptr<RecordBatch>> CudaRecordBatchTransfer::Next() {
+  return impl_->Next();
+}
+
+int64_t CudaRecordBatchTransfer::num_pending() const { return impl_->num_pending(); }
+
+}  // namespace cuda
+}  // namespace arrow
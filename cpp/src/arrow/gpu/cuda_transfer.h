@@ -0,0 +1,104 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace cuda {
+
+class CudaContext;
+
+/// \brief Options for CudaRecordBatchTransfer
+struct ARROW_EXPORT CudaTransferOptions {
+  /// The maximum number of batches in flight, each one with its own stream
+  /// and pinned staging buffer
+  int pipeline_depth = 2;
+  /// The initial size of the pinned staging buffers, grown as needed
+  int64_t staging_size = 1 << 20;
+  /// The pool allocating the buffers of the batches copied to the host
+  MemoryPool* pool = default_memory_pool();
+
+  static CudaTransferOptions Defaults() { return CudaTransferOptions(); }
+};
+
+/// \class CudaRecordBatchTransfer
+/// \brief Pipelined copies of record batches between the host and a device
+///
+/// Batches are copied asynchronously, on streams dedicated to the transfer,
+/// through page-locked staging buffers that are reused from batch to batch.
+/// The buffers of a host batch are coalesced in a staging buffer and sent to
+/// the device in a single copy; the buffers of a device batch are all copied
+/// to a staging buffer before the transfer waits for any of them.
+///
+/// The caller can thus prepare (e.g. read or decode) the next batch, or run
+/// device work, while the previous batches are in flight:
+///
+/// \code
+/// ARROW_ASSIGN_OR_RAISE(auto transfer, CudaRecordBatchTransfer::Make(context));
+/// while (...) {
+///   ARROW_ASSIGN_OR_RAISE(auto host_batch, reader->Next());
+///   RETURN_NOT_OK(transfer->Submit(host_batch));
+///   if (transfer->num_pending() == 2) {
+///     ARROW_ASSIGN_OR_RAISE(auto device_batch, transfer->Next());
+///     ...
+///   }
+/// }
+/// \endcode
+///
+/// This class is not thread-safe.
+class ARROW_EXPORT CudaRecordBatchTransfer {
+ public:
+  ~CudaRecordBatchTransfer();
+
+  /// \brief Create a transfer between the host and the device of a context
+  static Result<std::unique_ptr<CudaRecordBatchTransfer>> Make(
+      std::shared_ptr<CudaContext> context,
+      const CudaTransferOptions& options = CudaTransferOptions::Defaults());
+
+  /// \brief Start copying a batch
+  ///
+  /// A batch residing on the CPU is copied to the device, and a batch residing
+  /// on the device is copied to the host.  The batch must not be modified
+  /// until the copy is returned by Next().  If pipeline_depth batches are
+  /// already in flight, this waits for the oldest one to complete.
+  Status Submit(std::shared_ptr<RecordBatch> batch);
+
+  /// \brief Wait for the oldest batch in flight and return its copy
+  ///
+  /// Returns null if no batch is in flight.
+  Result<std::shared_ptr<RecordBatch>> Next();
+
+  /// \brief The number of batches submitted and not yet returned by Next()
+  int64_t num_pending() const;
+
+ private:
+  CudaRecordBatchTransfer();
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace cuda
+}  // namespace arrow
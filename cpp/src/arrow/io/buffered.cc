@@ -18,10 +18,13 @@
 #include "arrow/io/buffered.h"
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/io/util_internal.h"
@@ -29,6 +32,7 @@
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace io {
@@ -476,5 +480,344 @@ Result<std::shared_ptr<Buffer>> BufferedInputStream::DoRead(int64_t nbytes) {
   return impl_->Read(nbytes);
 }
 
+// ----------------------------------------------------------------------
+// ReadaheadInputStream implementation
+
+class ReadaheadInputStream::Impl : public std::enable_shared_from_this<Impl> {
+ public:
+  Impl(int64_t buffer_size, int32_t num_buffers, MemoryPool* pool,
+       std::shared_ptr<InputStream> raw, AsyncContext ctx)
+      : buffer_size_(buffer_size),
+        num_buffers_(num_buffers),
+        pool_(pool),
+        raw_(std::move(raw)),
+        ctx_(std::move(ctx)),
+        is_open_(true),
+        fill_running_(false),
+        eof_(false),
+        current_pos_(0),
+        current_recyclable_(false),
+        total_pos_(0) {}
+
+  Status Close() { return DoClose(/*abort=*/false); }
+
+  Status Abort() { return DoClose(/*abort=*/true); }
+
+  bool closed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !is_open_;
+  }
+
+  Status CheckClosed() const {
+    if (closed()) {
+      return Status::Invalid("Operation on closed stream");
+    }
+    return Status::OK();
+  }
+
+  Result<int64_t> Tell() const {
+    RETURN_NOT_OK(CheckClosed());
+    return total_pos_;
+  }
+
+  int64_t bytes_buffered() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    int64_t nbytes = current_ ? current_->size() - current_pos_ : 0;
+    for (const auto& buf : ready_) {
+      nbytes += buf->size();
+    }
+    return nbytes;
+  }
+
+  std::shared_ptr<InputStream> raw() const { return raw_; }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) {
+    if (ARROW_PREDICT_FALSE(nbytes < 0)) {
+      return Status::Invalid("Bytes to read must be positive. Received:", nbytes);
+    }
+    RETURN_NOT_OK(CheckClosed());
+    auto out_data = reinterpret_cast<uint8_t*>(out);
+    int64_t bytes_read = 0;
+    while (bytes_read < nbytes) {
+      ARROW_ASSIGN_OR_RAISE(bool has_data, EnsureCurrent());
+      if (!has_data) {
+        break;
+      }
+      const int64_t chunk = std::min(nbytes - bytes_read, current_available());
+      memcpy(out_data + bytes_read, current_->data() + current_pos_, chunk);
+      bytes_read += chunk;
+      Consume(chunk);
+    }
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) {
+    if (ARROW_PREDICT_FALSE(nbytes < 0)) {
+      return Status::Invalid("Bytes to read must be positive. Received:", nbytes);
+    }
+    RETURN_NOT_OK(CheckClosed());
+    ARROW_ASSIGN_OR_RAISE(bool has_data, EnsureCurrent());
+    if (!has_data || nbytes == 0) {
+      return std::make_shared<Buffer>(nullptr, 0);
+    }
+    if (nbytes <= current_available()) {
+      // Zero-copy
+      auto out = SliceBuffer(current_, current_pos_, nbytes);
+      Consume(nbytes);
+      return std::move(out);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, Read(nbytes, buffer->mutable_data()));
+    if (bytes_read < nbytes) {
+      RETURN_NOT_OK(buffer->Resize(bytes_read, false /* shrink_to_fit */));
+      buffer->ZeroPadding();
+    }
+    return std::move(buffer);
+  }
+
+  Result<util::string_view> Peek(int64_t nbytes) {
+    RETURN_NOT_OK(CheckClosed());
+    ARROW_ASSIGN_OR_RAISE(bool has_data, EnsureCurrent());
+    if (!has_data) {
+      return util::string_view();
+    }
+    if (nbytes > current_available()) {
+      // Coalesce the next buffers with the current one
+      std::vector<std::shared_ptr<ResizableBuffer>> next_buffers;
+      int64_t available = current_available();
+      while (available < nbytes) {
+        ARROW_ASSIGN_OR_RAISE(auto next, WaitNextBuffer());
+        if (!next) {
+          break;
+        }
+        available += next->size();
+        next_buffers.push_back(std::move(next));
+      }
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ResizableBuffer> combined,
+                            AllocateResizableBuffer(available, pool_));
+      uint8_t* dest = combined->mutable_data();
+      memcpy(dest, current_->data() + current_pos_, current_available());
+      dest += current_available();
+      for (auto& next : next_buffers) {
+        memcpy(dest, next->data(), next->size());
+        dest += next->size();
+        Recycle(std::move(next));
+      }
+      ReleaseCurrent();
+      current_ = std::move(combined);
+      current_pos_ = 0;
+      current_recyclable_ = false;
+    }
+    nbytes = std::min(nbytes, current_available());
+    const auto data = current_->data() + current_pos_;
+    return util::string_view(reinterpret_cast<const char*>(data),
+                             static_cast<size_t>(nbytes));
+  }
+
+ private:
+  int64_t current_available() const {
+    return current_ ? current_->size() - current_pos_ : 0;
+  }
+
+  void Consume(int64_t nbytes) {
+    current_pos_ += nbytes;
+    total_pos_ += nbytes;
+    if (current_pos_ == current_->size()) {
+      ReleaseCurrent();
+    }
+  }
+
+  void ReleaseCurrent() {
+    if (current_recyclable_) {
+      Recycle(std::move(current_));
+    }
+    current_.reset();
+    current_pos_ = 0;
+  }
+
+  // Make a buffer available for refilling, if no slices reference it anymore
+  void Recycle(std::shared_ptr<ResizableBuffer> buf) {
+    if (buf.use_count() == 1) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (static_cast<int32_t>(free_.size()) < num_buffers_) {
+        free_.push_back(std::move(buf));
+      }
+    }
+  }
+
+  // Ensure the current buffer has data available, return false at end of stream
+  Result<bool> EnsureCurrent() {
+    if (current_available() > 0) {
+      return true;
+    }
+    ReleaseCurrent();
+    ARROW_ASSIGN_OR_RAISE(current_, WaitNextBuffer());
+    current_recyclable_ = true;
+    return current_ != nullptr;
+  }
+
+  // Wait for the next prefetched buffer, return nullptr at end of stream
+  Result<std::shared_ptr<ResizableBuffer>> WaitNextBuffer() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    ScheduleFill();
+    cv_.wait(lock, [&] { return !ready_.empty() || eof_ || !error_.ok(); });
+    if (!ready_.empty()) {
+      auto buf = std::move(ready_.front());
+      ready_.pop_front();
+      // Refill the slot we just freed
+      ScheduleFill();
+      return buf;
+    }
+    if (!error_.ok()) {
+      return error_;
+    }
+    return nullptr;
+  }
+
+  // Start a background fill if needed.  The mutex must be held.
+  void ScheduleFill() {
+    if (fill_running_ || eof_ || !error_.ok() || !is_open_ ||
+        static_cast<int32_t>(ready_.size()) >= num_buffers_) {
+      return;
+    }
+    fill_running_ = true;
+    auto self = shared_from_this();
+    ::arrow::internal::TaskHints hints;
+    hints.priority = ctx_.priority;
+    hints.io_size = buffer_size_;
+    hints.external_id = ctx_.external_id;
+    auto st = ctx_.executor->Spawn(std::move(hints), [self]() { self->FillLoop(); });
+    if (!st.ok()) {
+      fill_running_ = false;
+      error_ = st;
+    }
+  }
+
+  // Fill buffers until enough are ready.  Raw reads are done without holding
+  // the mutex, but a single FillLoop() runs at any time.
+  void FillLoop() {
+    while (true) {
+      std::shared_ptr<ResizableBuffer> buf;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!is_open_ || static_cast<int32_t>(ready_.size()) >= num_buffers_) {
+          fill_running_ = false;
+          cv_.notify_all();
+          return;
+        }
+        if (!free_.empty()) {
+          buf = std::move(free_.back());
+          free_.pop_back();
+        }
+      }
+      auto st = FillBuffer(&buf);
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!st.ok()) {
+        error_ = std::move(st);
+      } else if (buf->size() == 0) {
+        eof_ = true;
+      } else {
+        ready_.push_back(std::move(buf));
+      }
+      if (!error_.ok() || eof_) {
+        fill_running_ = false;
+        cv_.notify_all();
+        return;
+      }
+      cv_.notify_all();
+    }
+  }
+
+  Status FillBuffer(std::shared_ptr<ResizableBuffer>* buf) {
+    if (*buf) {
+      RETURN_NOT_OK((*buf)->Resize(buffer_size_, false /* shrink_to_fit */));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(*buf, AllocateResizableBuffer(buffer_size_, pool_));
+    }
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                          raw_->Read(buffer_size_, (*buf)->mutable_data()));
+    return (*buf)->Resize(bytes_read, false /* shrink_to_fit */);
+  }
+
+  Status DoClose(bool abort) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (!is_open_) {
+        return Status::OK();
+      }
+      is_open_ = false;
+      // Wait for any pending raw read
+      cv_.wait(lock, [&] { return !fill_running_; });
+      ready_.clear();
+      free_.clear();
+    }
+    current_.reset();
+    return abort ? raw_->Abort() : raw_->Close();
+  }
+
+  const int64_t buffer_size_;
+  const int32_t num_buffers_;
+  MemoryPool* pool_;
+  std::shared_ptr<InputStream> raw_;
+  AsyncContext ctx_;
+
+  // Shared with the background fill, protected by mutex_
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  bool is_open_;
+  bool fill_running_;
+  bool eof_;
+  Status error_;
+  std::deque<std::shared_ptr<ResizableBuffer>> ready_;
+  std::vector<std::shared_ptr<ResizableBuffer>> free_;
+
+  // Consumer state
+  std::shared_ptr<ResizableBuffer> current_;
+  int64_t current_pos_;
+  bool current_recyclable_;
+  int64_t total_pos_;
+};
+
+ReadaheadInputStream::~ReadaheadInputStream() { internal::CloseFromDestructor(this); }
+
+Result<std::shared_ptr<ReadaheadInputStream>> ReadaheadInputStream::Create(
+    int64_t buffer_size, int32_t num_buffers, MemoryPool* pool,
+    std::shared_ptr<InputStream> raw, AsyncContext ctx) {
+  if (buffer_size <= 0) {
+    return Status::Invalid("Buffer size should be positive");
+  }
+  if (num_buffers <= 0) {
+    return Status::Invalid("Number of readahead buffers should be positive");
+  }
+  auto result = std::shared_ptr<ReadaheadInputStream>(new ReadaheadInputStream());
+  result->impl_ = std::make_shared<Impl>(buffer_size, num_buffers, pool, std::move(raw),
+                                         std::move(ctx));
+  return result;
+}
+
+Status ReadaheadInputStream::DoClose() { return impl_->Close(); }
+
+Status ReadaheadInputStream::DoAbort() { return impl_->Abort(); }
+
+bool ReadaheadInputStream::closed() const { return impl_->closed(); }
+
+std::shared_ptr<InputStream> ReadaheadInputStream::raw() const { return impl_->raw(); }
+
+int64_t ReadaheadInputStream::bytes_buffered() const { return impl_->bytes_buffered(); }
+
+Result<int64_t> ReadaheadInputStream::DoTell() const { return impl_->Tell(); }
+
+Result<util::string_view> ReadaheadInputStream::DoPeek(int64_t nbytes) {
+  return impl_->Peek(nbytes);
+}
+
+Result<int64_t> ReadaheadInputStream::DoRead(int64_t nbytes, void* out) {
+  return impl_->Read(nbytes, out);
+}
+
+Result<std::shared_ptr<Buffer>> ReadaheadInputStream::DoRead(int64_t nbytes) {
+  return impl_->Read(nbytes);
+}
+
 }  // namespace io
 }  // namespace arrow
@@ -160,5 +160,62 @@ class ARROW_EXPORT BufferedInputStream
   std::unique_ptr<Impl> impl_;
 };
 
+/// \class ReadaheadInputStream
+/// \brief An InputStream that reads ahead from another InputStream in the
+/// background
+///
+/// Up to `num_buffers` buffers of `buffer_size` bytes are kept filled by
+/// reading from the raw stream on the context's executor (the I/O thread
+/// pool by default), so that the latency of a slow source (remote
+/// filesystem, pipe...) is overlapped with the consumer's processing.
+/// Read(nbytes) returns zero-copy slices of the prefetched buffers whenever
+/// the requested data doesn't straddle two buffers.  Buffers are recycled
+/// once all slices referencing them are released.
+///
+/// The raw stream must not be accessed directly while this stream is open.
+class ARROW_EXPORT ReadaheadInputStream
+    : public internal::InputStreamConcurrencyWrapper<ReadaheadInputStream> {
+ public:
+  ~ReadaheadInputStream() override;
+
+  /// \brief Create a ReadaheadInputStream from a raw InputStream
+  /// \param[in] buffer_size the size of each readahead buffer
+  /// \param[in] num_buffers the maximum number of buffers read ahead
+  /// \param[in] pool a MemoryPool to use for allocations
+  /// \param[in] raw a raw InputStream
+  /// \param[in] ctx the context whose executor runs the raw reads
+  /// \return the created ReadaheadInputStream
+  static Result<std::shared_ptr<ReadaheadInputStream>> Create(
+      int64_t buffer_size, int32_t num_buffers, MemoryPool* pool,
+      std::shared_ptr<InputStream> raw, AsyncContext ctx = AsyncContext());
+
+  /// \brief Return the number of bytes read ahead and not consumed yet
+  int64_t bytes_buffered() const;
+
+  /// \brief Return the underlying InputStream
+  std::shared_ptr<InputStream> raw() const;
+
+  // InputStream APIs
+
+  bool closed() const override;
+
+ private:
+  friend InputStreamConcurrencyWrapper<ReadaheadInputStream>;
+
+  ReadaheadInputStream() = default;
+
+  /// \brief Close the stream, after waiting for any pending raw read.  This
+  /// implicitly closes the underlying raw input stream.
+  Status DoClose();
+  Status DoAbort() override;
+  Result<int64_t> DoTell() const;
+  Result<int64_t> DoRead(int64_t nbytes, void* out);
+  Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes);
+  Result<util::string_view> DoPeek(int64_t nbytes) override;
+
+  class ARROW_NO_EXPORT Impl;
+  std::shared_ptr<Impl> impl_;
+};
+
 }  // namespace io
 }  // namespace arrow
@@ -38,6 +38,7 @@
 #include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/io/slow.h"
 #include "arrow/io/test_common.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
@@ -663,5 +664,183 @@ TEST_F(TestBufferedInputStreamBound, BufferExactlyExhausted) {
   }
 }
 
+// ----------------------------------------------------------------------
+// ReadaheadInputStream tests
+
+// An InputStream failing after a given number of bytes
+class FailingInputStream : public InputStream {
+ public:
+  FailingInputStream(std::shared_ptr<InputStream> raw, int64_t fail_after)
+      : raw_(std::move(raw)), fail_after_(fail_after) {}
+
+  Status Close() override { return raw_->Close(); }
+  bool closed() const override { return raw_->closed(); }
+  Result<int64_t> Tell() const override { return raw_->Tell(); }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto pos, raw_->Tell());
+    if (pos + nbytes > fail_after_) {
+      return Status::IOError("Read failed");
+    }
+    return raw_->Read(nbytes, out);
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(auto pos, raw_->Tell());
+    if (pos + nbytes > fail_after_) {
+      return Status::IOError("Read failed");
+    }
+    return raw_->Read(nbytes);
+  }
+
+ private:
+  std::shared_ptr<InputStream> raw_;
+  int64_t fail_after_;
+};
+
+class TestReadaheadInputStream : public ::testing::Test {
+ public:
+  void SetUp() override {
+    data_ = GenerateRandomData(1000);
+    raw_ = std::make_shared<BufferReader>(Buffer::FromString(data_));
+  }
+
+  void MakeStream(int64_t buffer_size, int32_t num_buffers) {
+    ASSERT_OK_AND_ASSIGN(stream_, ReadaheadInputStream::Create(
+                                      buffer_size, num_buffers, default_memory_pool(),
+                                      raw_));
+  }
+
+  void AssertRead(int64_t nbytes, int64_t expected_pos) {
+    ASSERT_OK_AND_ASSIGN(auto buf, stream_->Read(nbytes));
+    const auto expected_size =
+        std::min<int64_t>(nbytes, static_cast<int64_t>(data_.size()) - expected_pos);
+    ASSERT_EQ(buf->ToString(), data_.substr(expected_pos, expected_size));
+    ASSERT_OK_AND_EQ(expected_pos + expected_size, stream_->Tell());
+  }
+
+ protected:
+  std::string data_;
+  std::shared_ptr<InputStream> raw_;
+  std::shared_ptr<ReadaheadInputStream> stream_;
+};
+
+TEST_F(TestReadaheadInputStream, InvalidArguments) {
+  ASSERT_RAISES(Invalid,
+                ReadaheadInputStream::Create(0, 2, default_memory_pool(), raw_));
+  ASSERT_RAISES(Invalid,
+                ReadaheadInputStream::Create(64, 0, default_memory_pool(), raw_));
+  MakeStream(64, 2);
+  ASSERT_RAISES(Invalid, stream_->Read(-1));
+}
+
+TEST_F(TestReadaheadInputStream, Reads) {
+  for (int32_t num_buffers : {1, 3}) {
+    ASSERT_OK(raw_->Close());
+    SetUp();
+    MakeStream(64, num_buffers);
+    ASSERT_OK_AND_EQ(0, stream_->Tell());
+
+    int64_t pos = 0;
+    // Within a buffer (zero-copy), across buffers, several buffers
+    for (int64_t nbytes : {10, 54, 1, 100, 0, 200, 63, 1}) {
+      AssertRead(nbytes, pos);
+      pos += nbytes;
+    }
+    // Copying reads
+    std::string out(150, 'x');
+    ASSERT_OK_AND_EQ(150, stream_->Read(150, &out[0]));
+    ASSERT_EQ(out, data_.substr(pos, 150));
+    pos += 150;
+    // Up to end of stream
+    AssertRead(10000, pos);
+    AssertRead(10, 1000);
+    ASSERT_OK_AND_EQ(0, stream_->Read(10, &out[0]));
+    ASSERT_EQ(stream_->bytes_buffered(), 0);
+  }
+}
+
+TEST_F(TestReadaheadInputStream, ZeroCopyBuffersOutliveRecycling) {
+  MakeStream(16, 2);
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  for (int i = 0; i < 1000 / 8; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto buf, stream_->Read(8));
+    buffers.push_back(std::move(buf));
+  }
+  // Buffers referenced by slices were not refilled
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    ASSERT_EQ(buffers[i]->ToString(), data_.substr(i * 8, 8));
+  }
+}
+
+TEST_F(TestReadaheadInputStream, Peek) {
+  MakeStream(64, 2);
+  ASSERT_OK_AND_ASSIGN(auto view, stream_->Peek(10));
+  ASSERT_EQ(view.to_string(), data_.substr(0, 10));
+  AssertRead(60, 0);
+  // Spanning several buffers
+  ASSERT_OK_AND_ASSIGN(view, stream_->Peek(200));
+  ASSERT_EQ(view.to_string(), data_.substr(60, 200));
+  ASSERT_OK_AND_EQ(60, stream_->Tell());
+  AssertRead(100, 60);
+  ASSERT_OK_AND_ASSIGN(view, stream_->Peek(5));
+  ASSERT_EQ(view.to_string(), data_.substr(160, 5));
+  AssertRead(300, 160);
+  // Past end of stream
+  ASSERT_OK_AND_ASSIGN(view, stream_->Peek(10000));
+  ASSERT_EQ(view.to_string(), data_.substr(460));
+  AssertRead(10000, 460);
+  ASSERT_OK_AND_ASSIGN(view, stream_->Peek(10));
+  ASSERT_EQ(view.size(), 0);
+}
+
+TEST_F(TestReadaheadInputStream, RawError) {
+  raw_ = std::make_shared<FailingInputStream>(raw_, 200);
+  MakeStream(64, 4);
+  // Data read before the error is delivered first
+  AssertRead(150, 0);
+  ASSERT_RAISES(IOError, stream_->Read(100));
+  ASSERT_OK(stream_->Close());
+}
+
+TEST_F(TestReadaheadInputStream, Close) {
+  MakeStream(64, 4);
+  AssertRead(10, 0);
+  ASSERT_FALSE(stream_->closed());
+  ASSERT_OK(stream_->Close());
+  ASSERT_TRUE(stream_->closed());
+  ASSERT_TRUE(raw_->closed());
+  ASSERT_RAISES(Invalid, stream_->Read(10));
+  ASSERT_RAISES(Invalid, stream_->Peek(10));
+  ASSERT_RAISES(Invalid, stream_->Tell());
+  ASSERT_OK(stream_->Close());
+
+  // Abort
+  SetUp();
+  MakeStream(64, 4);
+  AssertRead(10, 0);
+  ASSERT_OK(stream_->Abort());
+  ASSERT_TRUE(stream_->closed());
+  ASSERT_TRUE(raw_->closed());
+
+  // Destructor closes the raw stream
+  SetUp();
+  MakeStream(64, 4);
+  AssertRead(10, 0);
+  stream_.reset();
+  ASSERT_TRUE(raw_->closed());
+}
+
+TEST_F(TestReadaheadInputStream, SlowSource) {
+  // Prefetching happens while the consumer is busy
+  raw_ = std::make_shared<SlowInputStream>(raw_, /*average_latency=*/0.001);
+  MakeStream(100, 4);
+  int64_t pos = 0;
+  while (pos < 1000) {
+    AssertRead(37, pos);
+    pos += 37;
+  }
+}
+
 }  // namespace io
 }  // namespace arrow
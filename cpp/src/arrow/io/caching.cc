@@ -16,15 +16,21 @@
 // under the License.
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstring>
+#include <mutex>
 #include <utility>
 
 #include "arrow/buffer.h"
 #include "arrow/io/caching.h"
+#include "arrow/io/instrumented.h"
 #include "arrow/io/util_internal.h"
 #include "arrow/result.h"
 #include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace io {
@@ -91,10 +97,6 @@ CacheOptions CacheOptions::MakeFromNetworkMetrics(int64_t time_to_first_byte_mil
   //
   DCHECK_GT(time_to_first_byte_millis, 0) << "TTFB must be > 0";
   DCHECK_GT(transfer_bandwidth_mib_per_sec, 0) << "Transfer bandwidth must be > 0";
-  DCHECK_GT(ideal_bandwidth_utilization_frac, 0)
-      << "Ideal bandwidth utilization fraction must be > 0";
-  DCHECK_LT(ideal_bandwidth_utilization_frac, 1.0)
-      << "Ideal bandwidth utilization fraction must be < 1";
   DCHECK_GT(max_ideal_request_size_mib, 0) << "Max Ideal request size must be > 0";
 
   const double time_to_first_byte_sec = time_to_first_byte_millis / 1000.0;
@@ -102,10 +104,27 @@ CacheOptions CacheOptions::MakeFromNetworkMetrics(int64_t time_to_first_byte_mil
       transfer_bandwidth_mib_per_sec * 1024 * 1024;
   const int64_t max_ideal_request_size_bytes = max_ideal_request_size_mib * 1024 * 1024;
 
+  auto options = MakeFromMeasuredMetrics(
+      time_to_first_byte_sec, static_cast<double>(transfer_bandwidth_bytes_per_sec),
+      ideal_bandwidth_utilization_frac, max_ideal_request_size_bytes);
+  DCHECK_GT(options.hole_size_limit, 0) << "Computed hole_size_limit must be > 0";
+  DCHECK_GT(options.range_size_limit, 0) << "Computed range_size_limit must be > 0";
+  return options;
+}
+
+CacheOptions CacheOptions::MakeFromMeasuredMetrics(
+    double time_to_first_byte_sec, double transfer_bandwidth_bytes_per_sec,
+    double ideal_bandwidth_utilization_frac, int64_t max_ideal_request_size_bytes) {
+  DCHECK_GT(ideal_bandwidth_utilization_frac, 0)
+      << "Ideal bandwidth utilization fraction must be > 0";
+  DCHECK_LT(ideal_bandwidth_utilization_frac, 1.0)
+      << "Ideal bandwidth utilization fraction must be < 1";
+
+  // See MakeFromNetworkMetrics() above for the derivation.
+
   // hole_size_limit = TTFB * BW
   const auto hole_size_limit = static_cast<int64_t>(
       std::round(time_to_first_byte_sec * transfer_bandwidth_bytes_per_sec));
-  DCHECK_GT(hole_size_limit, 0) << "Computed hole_size_limit must be > 0";
 
   // range_size_limit = min(MAX_IDEAL_REQUEST_SIZE,
   //                        hole_size_limit * BW_util_frac / (1 - BW_util_frac))
@@ -113,11 +132,102 @@ CacheOptions CacheOptions::MakeFromNetworkMetrics(int64_t time_to_first_byte_mil
       max_ideal_request_size_bytes,
       static_cast<int64_t>(std::round(hole_size_limit * ideal_bandwidth_utilization_frac /
                                       (1 - ideal_bandwidth_utilization_frac))));
-  DCHECK_GT(range_size_limit, 0) << "Computed range_size_limit must be > 0";
 
   return {hole_size_limit, range_size_limit};
 }
 
+//////////////////////////////////////////////////////////////////////////
+// ReadMetricsEstimator implementation
+
+struct ReadMetricsEstimator::Impl {
+  Impl(double ideal_bandwidth_utilization_frac, int64_t max_ideal_request_size_bytes,
+       double decay)
+      : ideal_bandwidth_utilization_frac(ideal_bandwidth_utilization_frac),
+        max_ideal_request_size_bytes(max_ideal_request_size_bytes),
+        decay(decay) {}
+
+  const double ideal_bandwidth_utilization_frac;
+  const int64_t max_ideal_request_size_bytes;
+  const double decay;
+
+  mutable std::mutex mutex;
+  int64_t num_samples = 0;
+  // Exponentially weighted sums for the least squares fit of
+  // duration (y) against request size (x)
+  double sum_weights = 0;
+  double sum_x = 0;
+  double sum_y = 0;
+  double sum_xx = 0;
+  double sum_xy = 0;
+};
+
+ReadMetricsEstimator::ReadMetricsEstimator(double ideal_bandwidth_utilization_frac,
+                                           int64_t max_ideal_request_size_mib,
+                                           double decay)
+    : impl_(new Impl(ideal_bandwidth_utilization_frac,
+                     max_ideal_request_size_mib * 1024 * 1024, decay)) {
+  DCHECK_GT(decay, 0);
+  DCHECK_LE(decay, 1);
+}
+
+ReadMetricsEstimator::~ReadMetricsEstimator() {}
+
+void ReadMetricsEstimator::Record(int64_t nbytes, double seconds) {
+  const auto x = static_cast<double>(nbytes);
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  const double decay = impl_->decay;
+  impl_->sum_weights = impl_->sum_weights * decay + 1;
+  impl_->sum_x = impl_->sum_x * decay + x;
+  impl_->sum_y = impl_->sum_y * decay + seconds;
+  impl_->sum_xx = impl_->sum_xx * decay + x * x;
+  impl_->sum_xy = impl_->sum_xy * decay + x * seconds;
+  ++impl_->num_samples;
+}
+
+int64_t ReadMetricsEstimator::num_samples() const {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  return impl_->num_samples;
+}
+
+bool ReadMetricsEstimator::Estimate(double* latency, double* bandwidth) const {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  if (impl_->num_samples < kMinSamples) {
+    return false;
+  }
+  const double w = impl_->sum_weights;
+  const double variance = w * impl_->sum_xx - impl_->sum_x * impl_->sum_x;
+  // Request sizes must vary enough for the fit to be meaningful
+  if (!(variance > 1e-6 * w * impl_->sum_xx)) {
+    return false;
+  }
+  const double slope = (w * impl_->sum_xy - impl_->sum_x * impl_->sum_y) / variance;
+  if (!(slope > 0)) {
+    return false;
+  }
+  const double intercept = (impl_->sum_y - slope * impl_->sum_x) / w;
+  *latency = std::max(intercept, 0.0);
+  *bandwidth = 1 / slope;
+  return true;
+}
+
+CacheOptions ReadMetricsEstimator::AdjustCacheOptions(const CacheOptions& options) const {
+  double latency, bandwidth;
+  if (!Estimate(&latency, &bandwidth)) {
+    return options;
+  }
+  auto adjusted = CacheOptions::MakeFromMeasuredMetrics(
+      latency, bandwidth, impl_->ideal_bandwidth_utilization_frac,
+      impl_->max_ideal_request_size_bytes);
+  // Keep the limits usable by CoalesceReadRanges() even for extreme estimates
+  adjusted.range_size_limit = std::max<int64_t>(adjusted.range_size_limit, 2);
+  adjusted.hole_size_limit = std::max<int64_t>(
+      1, std::min(adjusted.hole_size_limit, adjusted.range_size_limit - 1));
+  adjusted.split_large_ranges = options.split_large_ranges;
+  adjusted.metrics_estimator = options.metrics_estimator;
+  adjusted.statistics = options.statistics;
+  return adjusted;
+}
+
 namespace internal {
 
 struct RangeCacheEntry {
@@ -148,6 +258,98 @@ struct ReadRangeCache::Impl {
       entries = std::move(new_entries);
     }
   }
+
+  // Split ranges larger than `part_size` into equal parts
+  std::vector<ReadRange> SplitRanges(std::vector<ReadRange> ranges, int64_t part_size) {
+    std::vector<ReadRange> split;
+    split.reserve(ranges.size());
+    for (const auto& range : ranges) {
+      if (range.length <= part_size) {
+        split.push_back(range);
+        continue;
+      }
+      const int64_t num_parts = (range.length + part_size - 1) / part_size;
+      int64_t offset = range.offset;
+      for (int64_t i = 0; i < num_parts; ++i) {
+        const int64_t end = range.offset + range.length * (i + 1) / num_parts;
+        split.push_back({offset, end - offset});
+        offset = end;
+      }
+    }
+    return split;
+  }
+
+  // Issue reads on the executor, recording their timings
+  std::vector<Future<std::shared_ptr<Buffer>>> TimedReads(
+      const std::vector<ReadRange>& ranges,
+      std::shared_ptr<ReadMetricsEstimator> estimator) {
+    std::vector<Future<std::shared_ptr<Buffer>>> futures;
+    futures.reserve(ranges.size());
+    auto self = file;
+    for (const auto& range : ranges) {
+      ::arrow::internal::TaskHints hints;
+      hints.priority = ctx.priority;
+      hints.io_size = range.length;
+      hints.external_id = ctx.external_id;
+      auto maybe_fut = ctx.executor->Submit(
+          std::move(hints),
+          [self, range, estimator]() -> Result<std::shared_ptr<Buffer>> {
+            ARROW_TRACE_SPAN("io", "ReadRangeCache::Fetch");
+            const auto start = std::chrono::steady_clock::now();
+            ARROW_ASSIGN_OR_RAISE(auto buf, self->ReadAt(range.offset, range.length));
+            const std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - start;
+            estimator->Record(buf->size(), elapsed.count());
+            return buf;
+          });
+      if (maybe_fut.ok()) {
+        futures.push_back(*std::move(maybe_fut));
+      } else {
+        futures.push_back(
+            Future<std::shared_ptr<Buffer>>::MakeFinished(maybe_fut.status()));
+      }
+    }
+    return futures;
+  }
+
+  // Find the entry containing the given offset
+  std::vector<RangeCacheEntry>::iterator FindEntry(int64_t offset) {
+    auto it = std::upper_bound(entries.begin(), entries.end(), offset,
+                               [](int64_t offset, const RangeCacheEntry& entry) {
+                                 return offset < entry.range.offset;
+                               });
+    if (it == entries.begin()) {
+      return entries.end();
+    }
+    --it;
+    if (offset >= it->range.offset + it->range.length) {
+      return entries.end();
+    }
+    return it;
+  }
+
+  // Read a range spanning several contiguous entries (e.g. split ranges)
+  Result<std::shared_ptr<Buffer>> ReadSpanning(std::vector<RangeCacheEntry>::iterator it,
+                                               ReadRange range) {
+    ARROW_ASSIGN_OR_RAISE(auto out, AllocateBuffer(range.length));
+    int64_t position = range.offset;
+    const int64_t end = range.offset + range.length;
+    while (position < end) {
+      if (it == entries.end() || it->range.offset != position) {
+        return Status::Invalid("ReadRangeCache did not find matching cache entry");
+      }
+      ARROW_ASSIGN_OR_RAISE(auto buf, it->future.result());
+      const int64_t nbytes =
+          std::min(end, it->range.offset + it->range.length) - position;
+      if (buf->size() < nbytes) {
+        return Status::IOError("Cached read was truncated");
+      }
+      std::memcpy(out->mutable_data() + (position - range.offset), buf->data(), nbytes);
+      position += nbytes;
+      ++it;
+    }
+    return std::move(out);
+  }
 };
 
 ReadRangeCache::ReadRangeCache(std::shared_ptr<RandomAccessFile> file, AsyncContext ctx,
@@ -161,13 +363,34 @@ ReadRangeCache::ReadRangeCache(std::shared_ptr<RandomAccessFile> file, AsyncCont
 ReadRangeCache::~ReadRangeCache() {}
 
 Status ReadRangeCache::Cache(std::vector<ReadRange> ranges) {
-  ranges = internal::CoalesceReadRanges(std::move(ranges), impl_->options.hole_size_limit,
-                                        impl_->options.range_size_limit);
+  ARROW_TRACE_SPAN("io", "ReadRangeCache::Cache");
+  auto options = impl_->options;
+  if (options.metrics_estimator) {
+    options = options.metrics_estimator->AdjustCacheOptions(options);
+  }
+  std::vector<ReadRange> original_ranges;
+  if (options.statistics) {
+    original_ranges = ranges;
+  }
+  ranges = internal::CoalesceReadRanges(std::move(ranges), options.hole_size_limit,
+                                        options.range_size_limit);
+  if (options.split_large_ranges) {
+    ranges = impl_->SplitRanges(std::move(ranges), options.range_size_limit);
+  }
+  if (options.statistics) {
+    options.statistics->RecordCoalescing(original_ranges, ranges);
+  }
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  if (options.metrics_estimator) {
+    futures = impl_->TimedReads(ranges, options.metrics_estimator);
+  } else {
+    // Submit all reads at once, so that the file implementation can batch them
+    futures = impl_->file->ReadManyAsync(impl_->ctx, ranges);
+  }
   std::vector<RangeCacheEntry> entries;
   entries.reserve(ranges.size());
-  for (const auto& range : ranges) {
-    auto fut = impl_->file->ReadAsync(impl_->ctx, range.offset, range.length);
-    entries.push_back({range, std::move(fut)});
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    entries.push_back({ranges[i], std::move(futures[i])});
   }
 
   impl_->AddEntries(std::move(entries));
@@ -181,16 +404,36 @@ Result<std::shared_ptr<Buffer>> ReadRangeCache::Read(ReadRange range) {
     return std::make_shared<Buffer>(&byte, 0);
   }
 
-  const auto it = std::lower_bound(
-      impl_->entries.begin(), impl_->entries.end(), range,
-      [](const RangeCacheEntry& entry, const ReadRange& range) {
-        return entry.range.offset + entry.range.length < range.offset + range.length;
-      });
-  if (it != impl_->entries.end() && it->range.Contains(range)) {
+  // Includes waiting for the fetch to complete
+  ARROW_TRACE_SPAN("io", "ReadRangeCache::Read");
+  const auto it = impl_->FindEntry(range.offset);
+  if (it == impl_->entries.end()) {
+    return Status::Invalid("ReadRangeCache did not find matching cache entry");
+  }
+  if (it->range.Contains(range)) {
     ARROW_ASSIGN_OR_RAISE(auto buf, it->future.result());
     return SliceBuffer(std::move(buf), range.offset - it->range.offset, range.length);
   }
-  return Status::Invalid("ReadRangeCache did not find matching cache entry");
+  // The range was split into several requests
+  const auto next = it + 1;
+  if (next == impl_->entries.end() ||
+      next->range.offset != it->range.offset + it->range.length) {
+    return Status::Invalid("ReadRangeCache did not find matching cache entry");
+  }
+  // Start from the partial first entry
+  ARROW_ASSIGN_OR_RAISE(auto first_buf, it->future.result());
+  const int64_t first_offset = range.offset - it->range.offset;
+  const int64_t first_length = it->range.length - first_offset;
+  if (first_buf->size() < it->range.length) {
+    return Status::IOError("Cached read was truncated");
+  }
+  ARROW_ASSIGN_OR_RAISE(
+      auto rest, impl_->ReadSpanning(next, {range.offset + first_length,
+                                            range.length - first_length}));
+  ARROW_ASSIGN_OR_RAISE(auto out, AllocateBuffer(range.length));
+  std::memcpy(out->mutable_data(), first_buf->data() + first_offset, first_length);
+  std::memcpy(out->mutable_data() + first_length, rest->data(), rest->size());
+  return std::move(out);
 }
 
 }  // namespace internal
@@ -24,11 +24,15 @@
 #include <vector>
 
 #include "arrow/io/interfaces.h"
+#include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
 namespace io {
 
+class IOStatistics;
+class ReadMetricsEstimator;
+
 struct ARROW_EXPORT CacheOptions {
   static constexpr double kDefaultIdealBandwidthUtilizationFrac = 0.9;
   static constexpr int64_t kDefaultMaxIdealRequestSizeMib = 64;
@@ -40,10 +44,26 @@ struct ARROW_EXPORT CacheOptions {
   ///   combining two consecutive ranges would produce a range of a
   ///   size greater than this, they are not combined
   int64_t range_size_limit;
+  /// \brief Whether to split ranges larger than range_size_limit
+  ///   (e.g. a single large column chunk) into several requests of at most
+  ///   range_size_limit bytes, issued in parallel
+  bool split_large_ranges;
+  /// \brief If non-null, reads are timed and the measurements fed to this
+  ///   estimator.  Once it has enough measurements, hole_size_limit and
+  ///   range_size_limit are derived from its estimates for each Cache()
+  ///   call, instead of being taken from this struct.
+  std::shared_ptr<ReadMetricsEstimator> metrics_estimator;
+  /// \brief If non-null, the number and size of the ranges passed to each
+  ///   Cache() call, and of the requests they are coalesced into, are
+  ///   recorded into these statistics.
+  std::shared_ptr<IOStatistics> statistics;
 
   bool operator==(const CacheOptions& other) const {
     return hole_size_limit == other.hole_size_limit &&
-           range_size_limit == other.range_size_limit;
+           range_size_limit == other.range_size_limit &&
+           split_large_ranges == other.split_large_ranges &&
+           metrics_estimator == other.metrics_estimator &&
+           statistics == other.statistics;
   }
 
   /// \brief Construct CacheOptions from network storage metrics (e.g. S3).
@@ -65,9 +85,70 @@ struct ARROW_EXPORT CacheOptions {
       double ideal_bandwidth_utilization_frac = kDefaultIdealBandwidthUtilizationFrac,
       int64_t max_ideal_request_size_mib = kDefaultMaxIdealRequestSizeMib);
 
+  /// \brief Construct CacheOptions from measured network storage metrics.
+  ///
+  /// Same as MakeFromNetworkMetrics(), with finer-grained parameters.
+  ///
+  /// \param[in] time_to_first_byte_sec Time-To-First-Byte (TTFB) in seconds.
+  /// \param[in] transfer_bandwidth_bytes_per_sec Data transfer bandwidth in bytes/sec.
+  /// \param[in] ideal_bandwidth_utilization_frac See MakeFromNetworkMetrics().
+  /// \param[in] max_ideal_request_size_bytes The maximum single data request size
+  ///   in bytes.
+  static CacheOptions MakeFromMeasuredMetrics(double time_to_first_byte_sec,
+                                              double transfer_bandwidth_bytes_per_sec,
+                                              double ideal_bandwidth_utilization_frac,
+                                              int64_t max_ideal_request_size_bytes);
+
   static CacheOptions Defaults();
 };
 
+/// \brief Online estimator of a storage's request latency and bandwidth
+///
+/// Each measurement is the size and duration of a completed read request.
+/// Durations are modeled as `latency + size / bandwidth`, and the model is
+/// fitted by exponentially weighted least squares, so that estimates follow
+/// changing conditions.  Measurements of different request sizes are
+/// needed to tell latency and bandwidth apart.
+///
+/// This class is thread-safe, and can be shared by several ReadRangeCache
+/// instances reading from the same storage.
+class ARROW_EXPORT ReadMetricsEstimator {
+ public:
+  /// The weight retained by past measurements when a new one is recorded
+  static constexpr double kDefaultDecay = 0.98;
+  /// The minimum number of measurements before estimates are available
+  static constexpr int64_t kMinSamples = 4;
+
+  explicit ReadMetricsEstimator(
+      double ideal_bandwidth_utilization_frac =
+          CacheOptions::kDefaultIdealBandwidthUtilizationFrac,
+      int64_t max_ideal_request_size_mib = CacheOptions::kDefaultMaxIdealRequestSizeMib,
+      double decay = kDefaultDecay);
+  ~ReadMetricsEstimator();
+
+  /// \brief Record a completed request of `nbytes` bytes that took `seconds`
+  void Record(int64_t nbytes, double seconds);
+
+  /// The number of recorded measurements
+  int64_t num_samples() const;
+
+  /// \brief Return the estimated latency (seconds) and bandwidth (bytes/sec)
+  ///
+  /// Return false if there are not enough measurements, or if they don't
+  /// allow separating latency from bandwidth.
+  bool Estimate(double* latency, double* bandwidth) const;
+
+  /// \brief Return `options` with coalescing limits derived from the
+  ///   current estimates, or unchanged if no estimates are available
+  CacheOptions AdjustCacheOptions(const CacheOptions& options) const;
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ReadMetricsEstimator);
+};
+
 namespace internal {
 
 /// \brief A read cache designed to hide IO latencies when reading.
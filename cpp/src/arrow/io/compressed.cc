@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -29,7 +30,9 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -45,7 +48,12 @@ namespace io {
 class CompressedOutputStream::Impl {
  public:
   Impl(MemoryPool* pool, const std::shared_ptr<OutputStream>& raw)
-      : pool_(pool), raw_(raw), is_open_(false), compressed_pos_(0), total_pos_(0) {}
+      : pool_(pool),
+        raw_(raw),
+        is_open_(false),
+        compressed_pos_(0),
+        total_pos_(0),
+        parallel_(false) {}
 
   Status Init(Codec* codec) {
     ARROW_ASSIGN_OR_RAISE(compressor_, codec->MakeCompressor());
@@ -55,6 +63,35 @@ class CompressedOutputStream::Impl {
     return Status::OK();
   }
 
+  Status InitParallel(Codec* codec, const ParallelCompressionOptions& options) {
+    switch (codec->compression_type()) {
+      // Concatenated streams of these formats are valid streams
+      case Compression::GZIP:
+      case Compression::ZSTD:
+      case Compression::LZ4_FRAME:
+      case Compression::BZ2:
+        break;
+      default:
+        return Status::NotImplemented("Parallel compression not supported for codec '",
+                                      codec->name(), "'");
+    }
+    if (options.block_size <= 0) {
+      return Status::Invalid("Parallel compression block size must be > 0");
+    }
+    codec_ = codec;
+    block_size_ = options.block_size;
+    executor_ = options.executor != nullptr ? options.executor
+                                            : ::arrow::internal::GetCpuThreadPool();
+    max_pending_blocks_ = options.max_pending_blocks > 0
+                              ? options.max_pending_blocks
+                              : std::max(1, 2 * executor_->GetCapacity());
+    block_pos_ = 0;
+    num_blocks_ = 0;
+    parallel_ = true;
+    is_open_ = true;
+    return Status::OK();
+  }
+
   Result<int64_t> Tell() const {
     std::lock_guard<std::mutex> guard(lock_);
     return total_pos_;
@@ -74,6 +111,9 @@ class CompressedOutputStream::Impl {
     std::lock_guard<std::mutex> guard(lock_);
 
     auto input = reinterpret_cast<const uint8_t*>(data);
+    if (parallel_) {
+      return WriteParallel(input, nbytes);
+    }
     while (nbytes > 0) {
       int64_t input_len = nbytes;
       int64_t output_len = compressed_->size() - compressed_pos_;
@@ -111,6 +151,12 @@ class CompressedOutputStream::Impl {
   Status Flush() {
     std::lock_guard<std::mutex> guard(lock_);
 
+    if (parallel_) {
+      if (block_pos_ > 0) {
+        RETURN_NOT_OK(SubmitBlock());
+      }
+      return WritePendingBlocks(/*min_pending=*/0, /*wait=*/true);
+    }
     while (true) {
       // Flush compressor
       int64_t output_len = compressed_->size() - compressed_pos_;
@@ -132,6 +178,13 @@ class CompressedOutputStream::Impl {
   }
 
   Status FinalizeCompression() {
+    if (parallel_) {
+      // An empty stream still produces a valid (empty) compressed stream
+      if (block_pos_ > 0 || num_blocks_ == 0) {
+        RETURN_NOT_OK(SubmitBlock());
+      }
+      return WritePendingBlocks(/*min_pending=*/0, /*wait=*/true);
+    }
     while (true) {
       // Try to end compressor
       int64_t output_len = compressed_->size() - compressed_pos_;
@@ -170,6 +223,11 @@ class CompressedOutputStream::Impl {
 
     if (is_open_) {
       is_open_ = false;
+      // Don't leave tasks running behind our back
+      for (auto& fut : pending_) {
+        fut.Wait();
+      }
+      pending_.clear();
       return raw_->Abort();
     } else {
       return Status::OK();
@@ -185,6 +243,100 @@ class CompressedOutputStream::Impl {
   // Write 64 KB compressed data at a time
   static const int64_t kChunkSize = 64 * 1024;
 
+  Status WriteParallel(const uint8_t* input, int64_t nbytes) {
+    while (nbytes > 0) {
+      if (!block_) {
+        ARROW_ASSIGN_OR_RAISE(block_, AllocateResizableBuffer(block_size_, pool_));
+        block_pos_ = 0;
+      }
+      const int64_t chunk = std::min(nbytes, block_size_ - block_pos_);
+      memcpy(block_->mutable_data() + block_pos_, input, chunk);
+      block_pos_ += chunk;
+      input += chunk;
+      nbytes -= chunk;
+      total_pos_ += chunk;
+      if (block_pos_ == block_size_) {
+        RETURN_NOT_OK(SubmitBlock());
+      }
+    }
+    return Status::OK();
+  }
+
+  // Compress the current block as an independent stream on the executor
+  Status SubmitBlock() {
+    ARROW_ASSIGN_OR_RAISE(auto compressor, codec_->MakeCompressor());
+    std::shared_ptr<Buffer> input;
+    if (block_) {
+      input = SliceBuffer(std::move(block_), 0, block_pos_);
+    } else {
+      input = std::make_shared<Buffer>(nullptr, 0);
+    }
+    block_pos_ = 0;
+    // Leave room for the stream header and trailer
+    const int64_t output_size =
+        codec_->MaxCompressedLen(input->size(), input->data()) + kChunkSize;
+    MemoryPool* pool = pool_;
+    pending_.push_back(executor_->SubmitAsFuture(
+        [compressor, input, output_size, pool]() -> Result<std::shared_ptr<Buffer>> {
+          return CompressBlock(compressor.get(), *input, output_size, pool);
+        }));
+    ++num_blocks_;
+    // Write out the blocks already compressed, and wait for the oldest ones
+    // if too many are pending
+    RETURN_NOT_OK(WritePendingBlocks(max_pending_blocks_, /*wait=*/true));
+    return WritePendingBlocks(0, /*wait=*/false);
+  }
+
+  // Write out compressed blocks in order, until at most `min_pending` remain.
+  // If `wait` is false, stop at the first block not compressed yet.
+  Status WritePendingBlocks(size_t min_pending, bool wait) {
+    while (pending_.size() > min_pending) {
+      if (!wait && pending_.front().state() == FutureState::PENDING) {
+        break;
+      }
+      auto fut = std::move(pending_.front());
+      pending_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(auto compressed, fut.result());
+      RETURN_NOT_OK(raw_->Write(compressed));
+    }
+    return Status::OK();
+  }
+
+  static Result<std::shared_ptr<Buffer>> CompressBlock(Compressor* compressor,
+                                                       const Buffer& input,
+                                                       int64_t output_size,
+                                                       MemoryPool* pool) {
+    ARROW_ASSIGN_OR_RAISE(auto output, AllocateResizableBuffer(output_size, pool));
+    int64_t input_pos = 0;
+    int64_t output_pos = 0;
+    while (input_pos < input.size()) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto result, compressor->Compress(input.size() - input_pos,
+                                            input.data() + input_pos,
+                                            output->size() - output_pos,
+                                            output->mutable_data() + output_pos));
+      input_pos += result.bytes_read;
+      output_pos += result.bytes_written;
+      if (result.bytes_read == 0) {
+        // Need to enlarge output buffer
+        RETURN_NOT_OK(output->Resize(output->size() * 2));
+      }
+    }
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(auto result,
+                            compressor->End(output->size() - output_pos,
+                                            output->mutable_data() + output_pos));
+      output_pos += result.bytes_written;
+      if (!result.should_retry) {
+        break;
+      }
+      // Need to enlarge output buffer
+      RETURN_NOT_OK(output->Resize(output->size() * 2));
+    }
+    RETURN_NOT_OK(output->Resize(output_pos));
+    return std::move(output);
+  }
+
   MemoryPool* pool_;
   std::shared_ptr<OutputStream> raw_;
   bool is_open_;
@@ -194,9 +346,26 @@ class CompressedOutputStream::Impl {
   // Total number of bytes compressed
   int64_t total_pos_;
 
+  // Parallel compression state
+  bool parallel_;
+  Codec* codec_;
+  ::arrow::internal::Executor* executor_;
+  int64_t block_size_;
+  size_t max_pending_blocks_;
+  // The block being filled
+  std::shared_ptr<ResizableBuffer> block_;
+  int64_t block_pos_;
+  int64_t num_blocks_;
+  // Blocks being compressed, in output order
+  std::deque<Future<std::shared_ptr<Buffer>>> pending_;
+
   mutable std::mutex lock_;
 };
 
+ParallelCompressionOptions ParallelCompressionOptions::Defaults() {
+  return ParallelCompressionOptions();
+}
+
 Result<std::shared_ptr<CompressedOutputStream>> CompressedOutputStream::Make(
     util::Codec* codec, const std::shared_ptr<OutputStream>& raw, MemoryPool* pool) {
   // CAUTION: codec is not owned
@@ -206,6 +375,16 @@ Result<std::shared_ptr<CompressedOutputStream>> CompressedOutputStream::Make(
   return res;
 }
 
+Result<std::shared_ptr<CompressedOutputStream>> CompressedOutputStream::MakeParallel(
+    util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
+    const ParallelCompressionOptions& options, MemoryPool* pool) {
+  // CAUTION: codec is not owned, and must outlive the stream
+  std::shared_ptr<CompressedOutputStream> res(new CompressedOutputStream);
+  res->impl_.reset(new Impl(pool, std::move(raw)));
+  RETURN_NOT_OK(res->impl_->InitParallel(codec, options));
+  return res;
+}
+
 CompressedOutputStream::~CompressedOutputStream() { internal::CloseFromDestructor(this); }
 
 Status CompressedOutputStream::Close() { return impl_->Close(); }
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -31,6 +32,12 @@ namespace arrow {
 class MemoryPool;
 class Status;
 
+namespace internal {
+
+class Executor;
+
+}  // namespace internal
+
 namespace util {
 
 class Codec;
@@ -39,6 +46,19 @@ class Codec;
 
 namespace io {
 
+/// \brief Options for CompressedOutputStream::MakeParallel()
+struct ARROW_EXPORT ParallelCompressionOptions {
+  /// The size of the uncompressed blocks that are compressed independently
+  int64_t block_size = 4 * 1024 * 1024;
+  /// The maximum number of blocks being compressed at once, bounding memory
+  /// usage (0 means twice the executor's capacity)
+  int max_pending_blocks = 0;
+  /// The executor blocks are compressed on (nullptr means the CPU thread pool)
+  ::arrow::internal::Executor* executor = NULLPTR;
+
+  static ParallelCompressionOptions Defaults();
+};
+
 class ARROW_EXPORT CompressedOutputStream : public OutputStream {
  public:
   ~CompressedOutputStream() override;
@@ -48,6 +68,23 @@ class ARROW_EXPORT CompressedOutputStream : public OutputStream {
       util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
       MemoryPool* pool = default_memory_pool());
 
+  /// \brief Create a compressed output stream compressing blocks in parallel.
+  ///
+  /// The input is split into blocks of `options.block_size` bytes, which are
+  /// compressed as independent streams on the executor and written out in
+  /// order.  The output is therefore a concatenation of compressed streams
+  /// (gzip members, zstd or lz4 frames, bzip2 streams), which standard tools
+  /// and CompressedInputStream decode transparently.  The compression ratio is
+  /// slightly worse than with a single stream.
+  ///
+  /// Flush() waits for all pending blocks to be compressed and written.
+  /// Only codecs supporting concatenated streams are allowed (GZIP, ZSTD,
+  /// LZ4_FRAME and BZ2).
+  static Result<std::shared_ptr<CompressedOutputStream>> MakeParallel(
+      util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
+      const ParallelCompressionOptions& options = ParallelCompressionOptions::Defaults(),
+      MemoryPool* pool = default_memory_pool());
+
   // OutputStream interface
 
   /// \brief Close the compressed output stream.  This implicitly closes the
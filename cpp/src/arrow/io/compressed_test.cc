@@ -153,6 +153,41 @@ void CheckCompressedOutputStream(Codec* codec, const std::vector<uint8_t>& data,
   ASSERT_EQ(decompressed, data);
 }
 
+void CheckParallelCompressedOutputStream(Codec* codec,
+                                         const std::vector<uint8_t>& data, bool do_flush,
+                                         int64_t block_size) {
+  ASSERT_OK_AND_ASSIGN(auto buffer_writer, BufferOutputStream::Create());
+  auto options = ParallelCompressionOptions::Defaults();
+  options.block_size = block_size;
+  options.max_pending_blocks = 3;
+  ASSERT_OK_AND_ASSIGN(
+      auto stream, CompressedOutputStream::MakeParallel(codec, buffer_writer, options));
+  ASSERT_OK_AND_EQ(0, stream->Tell());
+
+  const uint8_t* input = data.data();
+  int64_t input_len = data.size();
+  const int64_t chunk_size = 11111;
+  while (input_len > 0) {
+    int64_t nbytes = std::min(chunk_size, input_len);
+    ASSERT_OK(stream->Write(input, nbytes));
+    input += nbytes;
+    input_len -= nbytes;
+    if (do_flush) {
+      ASSERT_OK(stream->Flush());
+    }
+  }
+  ASSERT_OK_AND_EQ(static_cast<int64_t>(data.size()), stream->Tell());
+  ASSERT_OK(stream->Close());
+  ASSERT_TRUE(stream->closed());
+
+  // The output is a concatenation of compressed streams
+  ASSERT_OK_AND_ASSIGN(auto compressed, buffer_writer->Finish());
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunCompressedInputStream(codec, compressed, &decompressed));
+  ASSERT_EQ(decompressed.size(), data.size());
+  ASSERT_EQ(decompressed, data);
+}
+
 class CompressedInputStreamTest : public ::testing::TestWithParam<Compression::type> {
  protected:
   Compression::type GetCompression() { return GetParam(); }
@@ -237,6 +272,50 @@ TEST_P(CompressedOutputStreamTest, RandomData) {
   CheckCompressedOutputStream(codec.get(), data, true /* do_flush */);
 }
 
+TEST_P(CompressedOutputStreamTest, ParallelCompression) {
+  auto codec = MakeCodec();
+  if (GetCompression() == Compression::BROTLI) {
+    // Concatenated Brotli streams aren't valid
+    std::shared_ptr<OutputStream> stream = std::make_shared<MockOutputStream>();
+    ASSERT_RAISES(NotImplemented,
+                  CompressedOutputStream::MakeParallel(codec.get(), stream));
+    return;
+  }
+  auto compressible = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+  auto random = MakeRandomData(RANDOM_DATA_SIZE);
+
+  for (int64_t block_size : {1000, 65536, 1 << 24}) {
+    SCOPED_TRACE("block_size = " + std::to_string(block_size));
+    CheckParallelCompressedOutputStream(codec.get(), compressible, false, block_size);
+    CheckParallelCompressedOutputStream(codec.get(), random, false, block_size);
+  }
+  CheckParallelCompressedOutputStream(codec.get(), compressible, true /* do_flush */,
+                                      65536);
+  // Empty input
+  CheckParallelCompressedOutputStream(codec.get(), {}, false, 65536);
+}
+
+TEST_P(CompressedOutputStreamTest, ParallelCompressionAbort) {
+  auto codec = MakeCodec();
+  if (GetCompression() == Compression::BROTLI) {
+    return;
+  }
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+  auto options = ParallelCompressionOptions::Defaults();
+  options.block_size = 1000;
+  ASSERT_OK_AND_ASSIGN(auto buffer_writer, BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto stream, CompressedOutputStream::MakeParallel(
+                                        codec.get(), buffer_writer, options));
+  ASSERT_OK(stream->Write(data.data(), data.size()));
+  ASSERT_OK(stream->Abort());
+  ASSERT_TRUE(stream->closed());
+  ASSERT_TRUE(buffer_writer->closed());
+
+  options.block_size = 0;
+  ASSERT_RAISES(Invalid, CompressedOutputStream::MakeParallel(codec.get(),
+                                                              buffer_writer, options));
+}
+
 // NOTES:
 // - Snappy doesn't support streaming decompression
 // - BZ2 doesn't support one-shot compression
@@ -41,12 +41,14 @@
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 // ----------------------------------------------------------------------
 // Other Arrow includes
 
 #include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/io/util_internal.h"
 
 #include "arrow/buffer.h"
@@ -243,6 +245,21 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   Status Open(const std::string& path) { return OpenReadable(path); }
   Status Open(int fd) { return OpenReadable(fd); }
 
+  Status Close() {
+    // The file descriptor must not be closed (and possibly reused) while
+    // asynchronous reads are still pending on it
+    std::vector<Future<std::shared_ptr<Buffer>>> pending_reads;
+    {
+      std::lock_guard<std::mutex> lock(pending_reads_mutex_);
+      pending_reads = std::move(pending_reads_);
+      pending_reads_.clear();
+    }
+    for (const auto& fut : pending_reads) {
+      fut.Wait();
+    }
+    return OSFile::Close();
+  }
+
   Result<std::shared_ptr<Buffer>> ReadBuffer(int64_t nbytes) {
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
 
@@ -266,6 +283,33 @@ class ReadableFile::ReadableFileImpl : public OSFile {
     return std::move(buffer);
   }
 
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      internal::IOUring* uring, const std::vector<ReadRange>& ranges) {
+    Status st = CheckClosed();
+    for (const auto& range : ranges) {
+      if (!st.ok()) {
+        break;
+      }
+      st = internal::ValidateRange(range.offset, range.length);
+    }
+    if (!st.ok()) {
+      return std::vector<Future<std::shared_ptr<Buffer>>>(
+          ranges.size(), Future<std::shared_ptr<Buffer>>::MakeFinished(st));
+    }
+
+    auto futures = uring->ReadAt(fd_, ranges, pool_);
+    std::lock_guard<std::mutex> lock(pending_reads_mutex_);
+    // Forget about finished reads
+    pending_reads_.erase(
+        std::remove_if(pending_reads_.begin(), pending_reads_.end(),
+                       [](const Future<std::shared_ptr<Buffer>>& fut) {
+                         return IsFutureFinished(fut.state());
+                       }),
+        pending_reads_.end());
+    pending_reads_.insert(pending_reads_.end(), futures.begin(), futures.end());
+    return futures;
+  }
+
   Status WillNeed(const std::vector<ReadRange>& ranges) {
     RETURN_NOT_OK(CheckClosed());
     for (const auto& range : ranges) {
@@ -289,6 +333,8 @@ class ReadableFile::ReadableFileImpl : public OSFile {
 
  private:
   MemoryPool* pool_;
+  std::mutex pending_reads_mutex_;
+  std::vector<Future<std::shared_ptr<Buffer>>> pending_reads_;
 };
 
 ReadableFile::ReadableFile(MemoryPool* pool) { impl_.reset(new ReadableFileImpl(pool)); }
@@ -312,6 +358,27 @@ Status ReadableFile::DoClose() { return impl_->Close(); }
 
 bool ReadableFile::closed() const { return !impl_->is_open(); }
 
+Future<std::shared_ptr<Buffer>> ReadableFile::ReadAsync(const AsyncContext& ctx,
+                                                        int64_t position,
+                                                        int64_t nbytes) {
+  auto futures = ReadManyAsync(ctx, {{position, nbytes}});
+  return std::move(futures[0]);
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> ReadableFile::ReadManyAsync(
+    const AsyncContext& ctx, const std::vector<ReadRange>& ranges) {
+  auto uring = internal::IOUring::GetInstance();
+  if (uring == nullptr) {
+    std::vector<Future<std::shared_ptr<Buffer>>> futures;
+    futures.reserve(ranges.size());
+    for (const auto& range : ranges) {
+      futures.push_back(RandomAccessFile::ReadAsync(ctx, range.offset, range.length));
+    }
+    return futures;
+  }
+  return impl_->ReadManyAsync(uring, ranges);
+}
+
 Status ReadableFile::WillNeed(const std::vector<ReadRange>& ranges) {
   return impl_->WillNeed(ranges);
 }
@@ -439,8 +506,10 @@ class MemoryMappedFile::MemoryMap
   }
 
   Status Open(const std::string& path, FileMode::type mode, const int64_t offset = 0,
-              const int64_t length = -1) {
+              const int64_t length = -1,
+              const MemoryMapOptions& options = MemoryMapOptions::Defaults()) {
     file_.reset(new OSFile());
+    options_ = options;
 
     if (mode != FileMode::READ) {
       // Memory mapping has permission failures if PROT_READ not set
@@ -507,6 +576,8 @@ class MemoryMappedFile::MemoryMap
       if (position_ > map_len_) {
         position_ = map_len_;
       }
+      // The new mapping may have a different address
+      RETURN_NOT_OK(ApplyAdvice());
     } else {
       DCHECK_EQ(position_, 0);
       // the mmap is not yet initialized, resize the underlying
@@ -556,7 +627,34 @@ class MemoryMappedFile::MemoryMap
 
   std::mutex& resize_lock() { return resize_lock_; }
 
+  Status Advise(MemoryMapOptions::AccessPattern access_pattern) {
+    options_.access_pattern = access_pattern;
+    return ApplyAdvice();
+  }
+
  private:
+  // Apply the access pattern and huge page options to the current mapping
+  Status ApplyAdvice() {
+    using ::arrow::internal::MemoryAdvice;
+
+    if (map_len_ == 0) {
+      return Status::OK();
+    }
+    const std::vector<::arrow::internal::MemoryRegion> regions = {
+        {data(), static_cast<size_t>(map_len_)}};
+    if (options_.huge_pages) {
+      RETURN_NOT_OK(::arrow::internal::MemoryAdvise(regions, MemoryAdvice::HugePage));
+    }
+    switch (options_.access_pattern) {
+      case MemoryMapOptions::SEQUENTIAL:
+        return ::arrow::internal::MemoryAdvise(regions, MemoryAdvice::Sequential);
+      case MemoryMapOptions::RANDOM:
+        return ::arrow::internal::MemoryAdvise(regions, MemoryAdvice::Random);
+      default:
+        return ::arrow::internal::MemoryAdvise(regions, MemoryAdvice::Normal);
+    }
+  }
+
   // Initialize the mmap and set size, capacity and the data pointers
   Status InitMMap(int64_t initial_size, bool resize_file = false,
                   const int64_t offset = 0, const int64_t length = -1) {
@@ -575,7 +673,13 @@ class MemoryMappedFile::MemoryMap
       mmap_length = static_cast<size_t>(length);
     }
 
-    void* result = mmap(nullptr, mmap_length, prot_flags_, map_mode_, file_->fd(),
+    int map_flags = map_mode_;
+#ifdef MAP_POPULATE
+    if (options_.populate) {
+      map_flags |= MAP_POPULATE;
+    }
+#endif
+    void* result = mmap(nullptr, mmap_length, prot_flags_, map_flags, file_->fd(),
                         static_cast<off_t>(offset));
     if (result == MAP_FAILED) {
       return Status::IOError("Memory mapping file failed: ",
@@ -587,10 +691,18 @@ class MemoryMappedFile::MemoryMap
                                        map_len_);
     file_size_ = initial_size;
 
+    RETURN_NOT_OK(ApplyAdvice());
+#ifndef MAP_POPULATE
+    if (options_.populate) {
+      RETURN_NOT_OK(::arrow::internal::MemoryAdviseWillNeed(
+          {{data(), static_cast<size_t>(map_len_)}}));
+    }
+#endif
     return Status::OK();
   }
 
   std::unique_ptr<OSFile> file_;
+  MemoryMapOptions options_;
   int prot_flags_;
   int map_mode_;
 
@@ -602,6 +714,8 @@ class MemoryMappedFile::MemoryMap
   std::mutex resize_lock_;
 };
 
+MemoryMapOptions MemoryMapOptions::Defaults() { return MemoryMapOptions(); }
+
 MemoryMappedFile::MemoryMappedFile() {}
 
 MemoryMappedFile::~MemoryMappedFile() { internal::CloseFromDestructor(this); }
@@ -623,14 +737,22 @@ Result<std::shared_ptr<MemoryMappedFile>> MemoryMappedFile::Open(const std::stri
   return result;
 }
 
-Result<std::shared_ptr<MemoryMappedFile>> MemoryMappedFile::Open(const std::string& path,
-                                                                 FileMode::type mode,
-                                                                 const int64_t offset,
-                                                                 const int64_t length) {
+Result<std::shared_ptr<MemoryMappedFile>> MemoryMappedFile::Open(
+    const std::string& path, FileMode::type mode, const MemoryMapOptions& options) {
   std::shared_ptr<MemoryMappedFile> result(new MemoryMappedFile());
 
   result->memory_map_.reset(new MemoryMap());
-  RETURN_NOT_OK(result->memory_map_->Open(path, mode, offset, length));
+  RETURN_NOT_OK(result->memory_map_->Open(path, mode, 0, -1, options));
+  return result;
+}
+
+Result<std::shared_ptr<MemoryMappedFile>> MemoryMappedFile::Open(
+    const std::string& path, FileMode::type mode, const int64_t offset,
+    const int64_t length, const MemoryMapOptions& options) {
+  std::shared_ptr<MemoryMappedFile> result(new MemoryMappedFile());
+
+  result->memory_map_.reset(new MemoryMap());
+  RETURN_NOT_OK(result->memory_map_->Open(path, mode, offset, length, options));
   return result;
 }
 
@@ -726,6 +848,14 @@ Status MemoryMappedFile::WillNeed(const std::vector<ReadRange>& ranges) {
   return ::arrow::internal::MemoryAdviseWillNeed(regions);
 }
 
+Status MemoryMappedFile::Advise(MemoryMapOptions::AccessPattern access_pattern) {
+  RETURN_NOT_OK(memory_map_->CheckClosed());
+  auto guard_resize = memory_map_->writable()
+                          ? std::unique_lock<std::mutex>(memory_map_->resize_lock())
+                          : std::unique_lock<std::mutex>();
+  return memory_map_->Advise(access_pattern);
+}
+
 bool MemoryMappedFile::supports_zero_copy() const { return true; }
 
 Status MemoryMappedFile::WriteAt(int64_t position, const void* data, int64_t nbytes) {
@@ -111,6 +111,14 @@ class ARROW_EXPORT ReadableFile
 
   int file_descriptor() const;
 
+  // Reads are submitted directly to the kernel using io_uring on Linux
+  // (unless disabled by setting the ARROW_IO_URING environment variable to "0"),
+  // otherwise they are issued on the context's executor
+  Future<std::shared_ptr<Buffer>> ReadAsync(const AsyncContext&, int64_t position,
+                                            int64_t nbytes) override;
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const AsyncContext&, const std::vector<ReadRange>& ranges) override;
+
   Status WillNeed(const std::vector<ReadRange>& ranges) override;
 
  private:
@@ -143,6 +151,27 @@ class ARROW_EXPORT ReadableFile
 ///
 /// If opening a file in a writable mode, it is not truncated first as with
 /// FileOutputStream.
+/// \brief Options for memory-mapping a file
+struct ARROW_EXPORT MemoryMapOptions {
+  /// Expected access pattern, forwarded to the OS as a hint
+  enum AccessPattern { NORMAL, SEQUENTIAL, RANDOM };
+
+  AccessPattern access_pattern = NORMAL;
+  /// Read the whole mapping in memory when opening the file
+  ///
+  /// This avoids page faults on later accesses, at the cost of a longer
+  /// Open() call.  MAP_POPULATE is used where available.
+  bool populate = false;
+  /// Ask for the mapping to be backed by transparent huge pages
+  ///
+  /// This is only effective for files on a filesystem supporting them,
+  /// such as tmpfs with huge pages enabled.  Files on hugetlbfs are always
+  /// backed by huge pages, provided the mapping offset is suitably aligned.
+  bool huge_pages = false;
+
+  static MemoryMapOptions Defaults();
+};
+
 class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
  public:
   ~MemoryMappedFile() override;
@@ -155,11 +184,15 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
   static Result<std::shared_ptr<MemoryMappedFile>> Open(const std::string& path,
                                                         FileMode::type mode);
 
+  // mmap() with whole file, with the given options
+  static Result<std::shared_ptr<MemoryMappedFile>> Open(
+      const std::string& path, FileMode::type mode, const MemoryMapOptions& options);
+
   // mmap() with a region of file, the offset must be a multiple of the page size
-  static Result<std::shared_ptr<MemoryMappedFile>> Open(const std::string& path,
-                                                        FileMode::type mode,
-                                                        const int64_t offset,
-                                                        const int64_t length);
+  static Result<std::shared_ptr<MemoryMappedFile>> Open(
+      const std::string& path, FileMode::type mode, const int64_t offset,
+      const int64_t length,
+      const MemoryMapOptions& options = MemoryMapOptions::Defaults());
 
   Status Close() override;
 
@@ -188,8 +221,12 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
   Future<std::shared_ptr<Buffer>> ReadAsync(const AsyncContext&, int64_t position,
                                             int64_t nbytes) override;
 
+  // Hint the OS to read the given ranges in memory (madvise(MADV_WILLNEED))
   Status WillNeed(const std::vector<ReadRange>& ranges) override;
 
+  /// Change the expected access pattern for the whole mapping
+  Status Advise(MemoryMapOptions::AccessPattern access_pattern);
+
   bool supports_zero_copy() const override;
 
   /// Write data at the current position in the file. Thread-safe
@@ -19,8 +19,10 @@
 #include "arrow/io/buffered.h"
 #include "arrow/io/file.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/windows_compatibility.h"
 
 #include "benchmark/benchmark.h"
@@ -31,6 +33,7 @@
 #include <iostream>
 #include <thread>
 #include <valarray>
+#include <vector>
 
 #ifdef _WIN32
 
@@ -291,6 +294,75 @@ static void BufferedOutputStreamLargeWritesToPipe(
 // We use real time as we don't want to count CPU time spent in the
 // BackgroundReader thread
 
+// Benchmark many concurrent reads of a local file (likely in the page cache)
+
+constexpr int64_t kAsyncReadFileSize = 64 * 1024 * 1024;
+
+static std::shared_ptr<io::ReadableFile> OpenAsyncReadFile(
+    std::unique_ptr<internal::TemporaryDir>* temp_dir) {
+  *temp_dir = *internal::TemporaryDir::Make("file-benchmark-");
+  auto path = (*temp_dir)->path().ToString() + "data";
+  auto out = *io::FileOutputStream::Open(path);
+  const std::string datastr(1024 * 1024, 'x');
+  for (int64_t i = 0; i < kAsyncReadFileSize; i += datastr.size()) {
+    ABORT_NOT_OK(out->Write(datastr.data(), datastr.size()));
+  }
+  ABORT_NOT_OK(out->Close());
+  return *io::ReadableFile::Open(path);
+}
+
+static std::vector<io::ReadRange> AsyncReadRanges(int64_t read_size) {
+  std::vector<io::ReadRange> ranges;
+  for (int64_t offset = 0; offset < kAsyncReadFileSize; offset += read_size) {
+    ranges.push_back({offset, read_size});
+  }
+  return ranges;
+}
+
+// Reads submitted together (using io_uring where available)
+static void ReadableFileReadManyAsync(benchmark::State& state) {
+  std::unique_ptr<internal::TemporaryDir> temp_dir;
+  auto file = OpenAsyncReadFile(&temp_dir);
+  const auto ranges = AsyncReadRanges(state.range(0));
+
+  for (auto _ : state) {
+    auto futures = file->ReadManyAsync({}, ranges);
+    for (const auto& fut : futures) {
+      ABORT_NOT_OK(fut.status());
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * kAsyncReadFileSize);
+}
+
+// Blocking reads issued on the IO thread pool, for comparison
+static void ReadableFileReadAtOnThreadPool(benchmark::State& state) {
+  std::unique_ptr<internal::TemporaryDir> temp_dir;
+  auto file = OpenAsyncReadFile(&temp_dir);
+  const auto ranges = AsyncReadRanges(state.range(0));
+  auto executor = io::AsyncContext().executor;
+
+  for (auto _ : state) {
+    std::vector<Future<std::shared_ptr<Buffer>>> futures;
+    for (const auto& range : ranges) {
+      futures.push_back(*executor->Submit(
+          [file, range] { return file->ReadAt(range.offset, range.length); }));
+    }
+    for (const auto& fut : futures) {
+      ABORT_NOT_OK(fut.status());
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * kAsyncReadFileSize);
+}
+
+BENCHMARK(ReadableFileReadManyAsync)
+    ->RangeMultiplier(16)
+    ->Range(4096, 1 << 20)
+    ->UseRealTime();
+BENCHMARK(ReadableFileReadAtOnThreadPool)
+    ->RangeMultiplier(16)
+    ->Range(4096, 1 << 20)
+    ->UseRealTime();
+
 BENCHMARK(FileOutputStreamSmallWritesToNull)->UseRealTime();
 BENCHMARK(FileOutputStreamSmallWritesToPipe)->UseRealTime();
 BENCHMARK(FileOutputStreamLargeWritesToPipe)->UseRealTime();
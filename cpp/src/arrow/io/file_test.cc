@@ -384,6 +384,75 @@ TEST_F(TestReadableFile, ReadAsync) {
   AssertBufferEqual(*buf2, "test");
 }
 
+TEST_F(TestReadableFile, ReadManyAsync) {
+  MakeTestFile();
+  OpenFile();
+
+  auto futures = file_->ReadManyAsync({}, {{1, 3}, {6, 10}, {0, 0}, {20, 4}});
+  ASSERT_EQ(futures.size(), 4);
+  ASSERT_OK_AND_ASSIGN(auto buf, futures[0].result());
+  AssertBufferEqual(*buf, "est");
+  ASSERT_OK_AND_ASSIGN(buf, futures[1].result());
+  AssertBufferEqual(*buf, "ta");
+  ASSERT_OK_AND_ASSIGN(buf, futures[2].result());
+  AssertBufferEqual(*buf, "");
+  ASSERT_OK_AND_ASSIGN(buf, futures[3].result());
+  AssertBufferEqual(*buf, "");
+
+  futures = file_->ReadManyAsync({}, {{0, 4}, {-1, 1}});
+  ASSERT_EQ(futures.size(), 2);
+  ASSERT_RAISES(Invalid, futures[1].result());
+
+  ASSERT_OK(file_->Close());
+  ASSERT_RAISES(Invalid, file_->ReadAsync({}, 0, 4).result());
+  futures = file_->ReadManyAsync({}, {{0, 4}});
+  ASSERT_RAISES(Invalid, futures[0].result());
+}
+
+TEST_F(TestReadableFile, ManyConcurrentReadAsync) {
+  // More reads than the io_uring queues can hold at once
+  const int64_t kNumRanges = 3000;
+  const int64_t kRangeSize = 1000;
+  std::string data(kNumRanges * kRangeSize, 'x');
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<char>('a' + (i * 7) % 26);
+  }
+  {
+    std::ofstream stream;
+    stream.open(path_.c_str(), std::ios::binary);
+    stream << data;
+  }
+  OpenFile();
+
+  std::vector<ReadRange> ranges;
+  for (int64_t i = kNumRanges - 1; i >= 0; --i) {
+    ranges.push_back({i * kRangeSize, kRangeSize});
+  }
+  auto futures = file_->ReadManyAsync({}, ranges);
+  // Reads from another thread concurrently
+  std::thread thread([&]() {
+    for (int64_t i = 0; i < kNumRanges; i += 10) {
+      ASSERT_OK_AND_ASSIGN(auto buf,
+                           file_->ReadAsync({}, i * kRangeSize, kRangeSize).result());
+      AssertBufferEqual(*buf, data.substr(i * kRangeSize, kRangeSize));
+    }
+  });
+  thread.join();
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto buf, futures[i].result());
+    AssertBufferEqual(*buf, data.substr(ranges[i].offset, kRangeSize));
+  }
+
+  // Closing waits for pending reads
+  futures = file_->ReadManyAsync({}, ranges);
+  ASSERT_OK(file_->Close());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    ASSERT_TRUE(IsFutureFinished(futures[i].state()));
+    ASSERT_OK_AND_ASSIGN(auto buf, futures[i].result());
+    AssertBufferEqual(*buf, data.substr(ranges[i].offset, kRangeSize));
+  }
+}
+
 TEST_F(TestReadableFile, SeekingRequired) {
   MakeTestFile();
   OpenFile();
@@ -689,6 +758,60 @@ TEST_F(TestMemoryMappedFile, WillNeed) {
   ASSERT_RAISES(IOError, mmap->WillNeed({{1025, 1}}));  // Out of bounds
 }
 
+TEST_F(TestMemoryMappedFile, OpenWithOptions) {
+  const int64_t buffer_size = 1024;
+  const int reps = 5;
+  std::vector<uint8_t> buffer(buffer_size);
+  random_bytes(buffer_size, 0, buffer.data());
+
+  std::string path = TempFile("io-memory-map-options-test");
+  ASSERT_OK_AND_ASSIGN(auto rwmmap, InitMemoryMap(reps * buffer_size, path));
+  for (int i = 0; i < reps; ++i) {
+    ASSERT_OK(rwmmap->Write(buffer.data(), buffer_size));
+  }
+  ASSERT_OK(rwmmap->Close());
+
+  auto check_contents = [&](MemoryMappedFile* mmap) {
+    for (int i = 0; i < reps; ++i) {
+      ASSERT_OK_AND_ASSIGN(auto out_buffer, mmap->ReadAt(i * buffer_size, buffer_size));
+      ASSERT_EQ(0, memcmp(out_buffer->data(), buffer.data(), buffer_size));
+    }
+  };
+
+  for (auto access_pattern : {MemoryMapOptions::NORMAL, MemoryMapOptions::SEQUENTIAL,
+                              MemoryMapOptions::RANDOM}) {
+    for (bool populate : {false, true}) {
+      for (bool huge_pages : {false, true}) {
+        auto options = MemoryMapOptions::Defaults();
+        options.access_pattern = access_pattern;
+        options.populate = populate;
+        options.huge_pages = huge_pages;
+        ASSERT_OK_AND_ASSIGN(auto mmap,
+                             MemoryMappedFile::Open(path, FileMode::READ, options));
+        check_contents(mmap.get());
+        ASSERT_OK(mmap->Close());
+      }
+    }
+  }
+
+  // Partial mapping
+  auto options = MemoryMapOptions::Defaults();
+  options.access_pattern = MemoryMapOptions::SEQUENTIAL;
+  options.populate = true;
+  ASSERT_OK_AND_ASSIGN(auto mmap,
+                       MemoryMappedFile::Open(path, FileMode::READ, 0, 2048, options));
+  ASSERT_OK_AND_EQ(2048, mmap->GetSize());
+
+  // Changing the access pattern after opening
+  ASSERT_OK_AND_ASSIGN(mmap, MemoryMappedFile::Open(path, FileMode::READWRITE, options));
+  ASSERT_OK(mmap->Advise(MemoryMapOptions::RANDOM));
+  check_contents(mmap.get());
+  ASSERT_OK(mmap->Resize(2 * reps * buffer_size));
+  check_contents(mmap.get());
+  ASSERT_OK(mmap->Close());
+  ASSERT_RAISES(Invalid, mmap->Advise(MemoryMapOptions::NORMAL));
+}
+
 TEST_F(TestMemoryMappedFile, InvalidReads) {
   std::string path = TempFile("io-memory-map-invalid-reads-test");
   ASSERT_OK_AND_ASSIGN(auto result, InitMemoryMap(4096, path));
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cerrno>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
 #include <memory>
@@ -34,6 +35,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 
 using std::size_t;
@@ -129,8 +131,10 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
       // the error doesn't get propagated properly and the second close
       // initiated by the destructor raises a segfault
       is_open_ = false;
+      Status st = CloseReadHandles();
       int ret = driver_->CloseFile(fs_, file_);
       CHECK_FAILURE(ret, "CloseFile");
+      return st;
     }
     return Status::OK();
   }
@@ -138,16 +142,18 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
   bool closed() const { return !is_open_; }
 
   Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* buffer) {
+    if (max_read_handles_ > 1) {
+      ARROW_ASSIGN_OR_RAISE(hdfsFile handle, AcquireReadHandle());
+      auto result = ReadAt(handle, position, nbytes, buffer);
+      ReleaseReadHandle(handle);
+      return result;
+    }
     if (!driver_->HasPread()) {
       std::lock_guard<std::mutex> guard(lock_);
       RETURN_NOT_OK(Seek(position));
       return Read(nbytes, buffer);
     }
-    tSize ret =
-        driver_->Pread(fs_, file_, static_cast<tOffset>(position),
-                       reinterpret_cast<void*>(buffer), static_cast<tSize>(nbytes));
-    CHECK_FAILURE(ret, "read");
-    return ret;
+    return ReadAt(file_, position, nbytes, buffer);
   }
 
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) {
@@ -164,10 +170,14 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
   }
 
   Result<int64_t> Read(int64_t nbytes, void* buffer) {
+    return Read(file_, nbytes, buffer);
+  }
+
+  Result<int64_t> Read(hdfsFile handle, int64_t nbytes, void* buffer) {
     int64_t total_bytes = 0;
     while (total_bytes < nbytes) {
       tSize ret = driver_->Read(
-          fs_, file_, reinterpret_cast<uint8_t*>(buffer) + total_bytes,
+          fs_, handle, reinterpret_cast<uint8_t*>(buffer) + total_bytes,
           static_cast<tSize>(std::min<int64_t>(buffer_size_, nbytes - total_bytes)));
       CHECK_FAILURE(ret, "read");
       total_bytes += ret;
@@ -203,9 +213,84 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
 
   void set_buffer_size(int32_t buffer_size) { buffer_size_ = buffer_size; }
 
+  void set_max_read_handles(int32_t max_read_handles) {
+    max_read_handles_ = max_read_handles;
+  }
+
  private:
+  Result<int64_t> ReadAt(hdfsFile handle, int64_t position, int64_t nbytes,
+                         void* buffer) {
+    if (!driver_->HasPread()) {
+      // The handle is not shared, its position can be moved
+      int ret = driver_->Seek(fs_, handle, position);
+      CHECK_FAILURE(ret, "seek");
+      return Read(handle, nbytes, buffer);
+    }
+    tSize ret =
+        driver_->Pread(fs_, handle, static_cast<tOffset>(position),
+                       reinterpret_cast<void*>(buffer), static_cast<tSize>(nbytes));
+    CHECK_FAILURE(ret, "read");
+    return ret;
+  }
+
+  // Take a handle used by no other positional read, opening another one on the
+  // file if all are in use, or waiting for one if max_read_handles_ are open
+  Result<hdfsFile> AcquireReadHandle() {
+    {
+      std::unique_lock<std::mutex> guard(read_handles_lock_);
+      read_handle_released_.wait(guard, [this] {
+        return !idle_read_handles_.empty() || num_read_handles_ < max_read_handles_;
+      });
+      if (!idle_read_handles_.empty()) {
+        hdfsFile handle = idle_read_handles_.back();
+        idle_read_handles_.pop_back();
+        return handle;
+      }
+      ++num_read_handles_;
+    }
+    hdfsFile handle = driver_->OpenFile(fs_, path_.c_str(), O_RDONLY, buffer_size_, 0, 0);
+    if (handle == nullptr) {
+      {
+        std::lock_guard<std::mutex> guard(read_handles_lock_);
+        --num_read_handles_;
+      }
+      read_handle_released_.notify_one();
+      return Status::IOError("HDFS OpenFile failed for ", path_,
+                             ", errno: ", TranslateErrno(errno));
+    }
+    return handle;
+  }
+
+  void ReleaseReadHandle(hdfsFile handle) {
+    {
+      std::lock_guard<std::mutex> guard(read_handles_lock_);
+      idle_read_handles_.push_back(handle);
+    }
+    read_handle_released_.notify_one();
+  }
+
+  Status CloseReadHandles() {
+    std::lock_guard<std::mutex> guard(read_handles_lock_);
+    Status st;
+    for (hdfsFile handle : idle_read_handles_) {
+      if (driver_->CloseFile(fs_, handle) == -1) {
+        st &= Status::IOError("HDFS CloseFile failed, errno: ", TranslateErrno(errno));
+      }
+    }
+    num_read_handles_ -= static_cast<int32_t>(idle_read_handles_.size());
+    idle_read_handles_.clear();
+    return st;
+  }
+
   MemoryPool* pool_;
   int32_t buffer_size_;
+
+  // The handles opened for positional reads, besides file_
+  int32_t max_read_handles_ = 1;
+  std::mutex read_handles_lock_;
+  std::condition_variable read_handle_released_;
+  std::vector<hdfsFile> idle_read_handles_;
+  int32_t num_read_handles_ = 0;
 };
 
 HdfsReadableFile::HdfsReadableFile(MemoryPool* pool) {
@@ -326,6 +411,22 @@ static void SetPathInfo(const hdfsFileInfo* input, HdfsPathInfo* out) {
   out->permissions = input->mPermissions;
 }
 
+// Short-circuit reads are only possible when the DataNode's domain socket is
+// on this host.  A "_PORT" pattern in the path is substituted by the DataNode
+// with its port, check the directory in that case.
+static bool DomainSocketExists(const std::string& path) {
+  std::string local_path = path;
+  if (local_path.find("_PORT") != std::string::npos) {
+    local_path = local_path.substr(0, local_path.find_last_of('/') + 1);
+  }
+  auto maybe_filename = ::arrow::internal::PlatformFilename::FromString(local_path);
+  if (!maybe_filename.ok()) {
+    return false;
+  }
+  auto maybe_exists = ::arrow::internal::FileExists(*maybe_filename);
+  return maybe_exists.ok() && *maybe_exists;
+}
+
 // Private implementation
 class HadoopFileSystem::HadoopFileSystemImpl {
  public:
@@ -347,7 +448,21 @@ class HadoopFileSystem::HadoopFileSystemImpl {
       driver_->BuilderSetKerbTicketCachePath(builder, config->kerb_ticket.c_str());
     }
 
-    for (const auto& kv : config->extra_conf) {
+    // Settings given explicitly in extra_conf take precedence
+    std::unordered_map<std::string, std::string> conf = config->extra_conf;
+    if (config->hedged_read_threads > 0) {
+      conf.emplace("dfs.client.hedged.read.threadpool.size",
+                   std::to_string(config->hedged_read_threads));
+      conf.emplace("dfs.client.hedged.read.threshold.millis",
+                   std::to_string(config->hedged_read_threshold_ms));
+    }
+    if (!config->domain_socket_path.empty() &&
+        DomainSocketExists(config->domain_socket_path)) {
+      conf.emplace("dfs.client.read.shortcircuit", "true");
+      conf.emplace("dfs.domain.socket.path", config->domain_socket_path);
+    }
+
+    for (const auto& kv : conf) {
       int ret = driver_->BuilderConfSetStr(builder, kv.first.c_str(), kv.second.c_str());
       CHECK_FAILURE(ret, "confsetstr");
     }
@@ -362,6 +477,7 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     port_ = config->port;
     user_ = config->user;
     kerb_ticket_ = config->kerb_ticket;
+    max_read_handles_ = std::max(config->max_read_handles, 1);
 
     return Status::OK();
   }
@@ -496,6 +612,7 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     *file = std::shared_ptr<HdfsReadableFile>(new HdfsReadableFile());
     (*file)->impl_->set_members(path, driver_, fs_, handle);
     (*file)->impl_->set_buffer_size(buffer_size);
+    (*file)->impl_->set_max_read_handles(max_read_handles_);
 
     return Status::OK();
   }
@@ -546,6 +663,7 @@ class HadoopFileSystem::HadoopFileSystemImpl {
   std::string user_;
   int port_;
   std::string kerb_ticket_;
+  int32_t max_read_handles_ = 1;
 
   hdfsFS fs_;
 };
@@ -90,6 +90,22 @@ struct HdfsConnectionConfig {
   std::string user;
   std::string kerb_ticket;
   std::unordered_map<std::string, std::string> extra_conf;
+
+  // The number of threads of the HDFS client issuing hedged reads, i.e. reading
+  // a block from another DataNode when the first one is slow to answer, or 0 to
+  // disable hedged reads
+  int32_t hedged_read_threads = 0;
+  // The latency in milliseconds after which a read is hedged
+  int32_t hedged_read_threshold_ms = 500;
+
+  // The path of the UNIX domain socket shared with the DataNodes. If it is
+  // found on this host, short-circuit local reads are enabled: the blocks
+  // stored by the local DataNode are read directly from its disks
+  std::string domain_socket_path;
+
+  // The maximum number of handles opened on a readable file, so that
+  // concurrent positional reads don't wait for each other
+  int32_t max_read_handles = 1;
 };
 
 class ARROW_EXPORT HadoopFileSystem : public FileSystem {
@@ -218,7 +234,9 @@ class ARROW_EXPORT HdfsReadableFile : public RandomAccessFile {
   bool closed() const override;
 
   // NOTE: If you wish to read a particular range of a file in a multithreaded
-  // context, you may prefer to use ReadAt to avoid locking issues
+  // context, you may prefer to use ReadAt to avoid locking issues. Concurrent
+  // ReadAt calls, including those issued by ReadAsync, each use their own
+  // handle on the file, up to HdfsConnectionConfig::max_read_handles
   Result<int64_t> Read(int64_t nbytes, void* out) override;
   Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override;
   Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override;
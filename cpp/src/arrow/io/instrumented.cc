@@ -0,0 +1,280 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/instrumented.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/future.h"
+
+namespace arrow {
+namespace io {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+int64_t NanosSince(Clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start)
+      .count();
+}
+
+int64_t TotalLength(const std::vector<ReadRange>& ranges) {
+  int64_t total = 0;
+  for (const auto& range : ranges) {
+    total += range.length;
+  }
+  return total;
+}
+
+// Record the read when the future completes
+void RecordAsyncRead(std::shared_ptr<IOStatistics> statistics,
+                     const Future<std::shared_ptr<Buffer>>& future,
+                     Clock::time_point start) {
+  future.AddCallback(
+      [statistics, start](const Result<std::shared_ptr<Buffer>>& maybe_buffer) {
+        if (maybe_buffer.ok()) {
+          statistics->RecordRead((*maybe_buffer)->size(), NanosSince(start));
+        }
+      });
+}
+
+}  // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// IOStatistics implementation
+
+int64_t IOStatisticsSnapshot::LatencyQuantileMicros(
+    const std::vector<int64_t>& histogram, double quantile) {
+  int64_t total = 0;
+  for (const auto count : histogram) {
+    total += count;
+  }
+  if (total == 0) {
+    return 0;
+  }
+  const auto rank = static_cast<int64_t>(std::ceil(quantile * total));
+  int64_t seen = 0;
+  for (size_t i = 0; i < histogram.size(); ++i) {
+    seen += histogram[i];
+    if (seen >= std::max<int64_t>(rank, 1)) {
+      return BucketUpperBoundMicros(static_cast<int>(i));
+    }
+  }
+  return BucketUpperBoundMicros(static_cast<int>(histogram.size()) - 1);
+}
+
+constexpr int IOStatistics::kNumLatencyBuckets;
+
+IOStatistics::IOStatistics() { Reset(); }
+
+void IOStatistics::RecordLatency(int64_t latency_nanos, Histogram* histogram) {
+  const auto micros = static_cast<uint64_t>(std::max<int64_t>(latency_nanos / 1000, 0));
+  // Bucket i > 0 holds latencies in [2^(i-1), 2^i) microseconds
+  const int bucket = micros == 0 ? 0 : 64 - BitUtil::CountLeadingZeros(micros);
+  (*histogram)[std::min(bucket, kNumLatencyBuckets - 1)].fetch_add(
+      1, std::memory_order_relaxed);
+}
+
+void IOStatistics::RecordRead(int64_t nbytes, int64_t latency_nanos) {
+  read_requests_.fetch_add(1, std::memory_order_relaxed);
+  bytes_read_.fetch_add(nbytes, std::memory_order_relaxed);
+  RecordLatency(latency_nanos, &read_latencies_);
+}
+
+void IOStatistics::RecordOpen() { files_opened_.fetch_add(1, std::memory_order_relaxed); }
+
+void IOStatistics::RecordMetadata(int64_t latency_nanos) {
+  metadata_requests_.fetch_add(1, std::memory_order_relaxed);
+  RecordLatency(latency_nanos, &metadata_latencies_);
+}
+
+void IOStatistics::RecordCoalescing(const std::vector<ReadRange>& ranges,
+                                    const std::vector<ReadRange>& coalesced) {
+  cached_ranges_.fetch_add(static_cast<int64_t>(ranges.size()),
+                           std::memory_order_relaxed);
+  cached_range_bytes_.fetch_add(TotalLength(ranges), std::memory_order_relaxed);
+  coalesced_ranges_.fetch_add(static_cast<int64_t>(coalesced.size()),
+                              std::memory_order_relaxed);
+  coalesced_range_bytes_.fetch_add(TotalLength(coalesced), std::memory_order_relaxed);
+}
+
+IOStatisticsSnapshot IOStatistics::Snapshot() const {
+  IOStatisticsSnapshot snapshot;
+  snapshot.read_requests = read_requests_.load();
+  snapshot.bytes_read = bytes_read_.load();
+  snapshot.files_opened = files_opened_.load();
+  snapshot.metadata_requests = metadata_requests_.load();
+  snapshot.cached_ranges = cached_ranges_.load();
+  snapshot.cached_range_bytes = cached_range_bytes_.load();
+  snapshot.coalesced_ranges = coalesced_ranges_.load();
+  snapshot.coalesced_range_bytes = coalesced_range_bytes_.load();
+  for (int i = 0; i < kNumLatencyBuckets; ++i) {
+    snapshot.read_latency_histogram.push_back(read_latencies_[i].load());
+    snapshot.metadata_latency_histogram.push_back(metadata_latencies_[i].load());
+  }
+  return snapshot;
+}
+
+void IOStatistics::Reset() {
+  read_requests_.store(0);
+  bytes_read_.store(0);
+  files_opened_.store(0);
+  metadata_requests_.store(0);
+  cached_ranges_.store(0);
+  cached_range_bytes_.store(0);
+  coalesced_ranges_.store(0);
+  coalesced_range_bytes_.store(0);
+  for (int i = 0; i < kNumLatencyBuckets; ++i) {
+    read_latencies_[i].store(0);
+    metadata_latencies_[i].store(0);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// InstrumentedInputStream implementation
+
+InstrumentedInputStream::~InstrumentedInputStream() {
+  internal::CloseFromDestructor(this);
+}
+
+Status InstrumentedInputStream::Close() { return stream_->Close(); }
+
+Status InstrumentedInputStream::Abort() { return stream_->Abort(); }
+
+bool InstrumentedInputStream::closed() const { return stream_->closed(); }
+
+Result<int64_t> InstrumentedInputStream::Tell() const { return stream_->Tell(); }
+
+Result<int64_t> InstrumentedInputStream::Read(int64_t nbytes, void* out) {
+  const auto start = Clock::now();
+  ARROW_ASSIGN_OR_RAISE(auto bytes_read, stream_->Read(nbytes, out));
+  statistics_->RecordRead(bytes_read, NanosSince(start));
+  return bytes_read;
+}
+
+Result<std::shared_ptr<Buffer>> InstrumentedInputStream::Read(int64_t nbytes) {
+  const auto start = Clock::now();
+  ARROW_ASSIGN_OR_RAISE(auto buffer, stream_->Read(nbytes));
+  statistics_->RecordRead(buffer->size(), NanosSince(start));
+  return buffer;
+}
+
+Result<util::string_view> InstrumentedInputStream::Peek(int64_t nbytes) {
+  return stream_->Peek(nbytes);
+}
+
+bool InstrumentedInputStream::supports_zero_copy() const {
+  return stream_->supports_zero_copy();
+}
+
+//////////////////////////////////////////////////////////////////////////
+// InstrumentedRandomAccessFile implementation
+
+InstrumentedRandomAccessFile::~InstrumentedRandomAccessFile() {
+  internal::CloseFromDestructor(this);
+}
+
+Status InstrumentedRandomAccessFile::Close() { return stream_->Close(); }
+
+Status InstrumentedRandomAccessFile::Abort() { return stream_->Abort(); }
+
+bool InstrumentedRandomAccessFile::closed() const { return stream_->closed(); }
+
+Result<int64_t> InstrumentedRandomAccessFile::GetSize() {
+  const auto start = Clock::now();
+  ARROW_ASSIGN_OR_RAISE(auto size, stream_->GetSize());
+  statistics_->RecordMetadata(NanosSince(start));
+  return size;
+}
+
+Status InstrumentedRandomAccessFile::Seek(int64_t position) {
+  return stream_->Seek(position);
+}
+
+Result<int64_t> InstrumentedRandomAccessFile::Tell() const { return stream_->Tell(); }
+
+Result<int64_t> InstrumentedRandomAccessFile::Read(int64_t nbytes, void* out) {
+  const auto start = Clock::now();
+  ARROW_ASSIGN_OR_RAISE(auto bytes_read, stream_->Read(nbytes, out));
+  statistics_->RecordRead(bytes_read, NanosSince(start));
+  return bytes_read;
+}
+
+Result<std::shared_ptr<Buffer>> InstrumentedRandomAccessFile::Read(int64_t nbytes) {
+  const auto start = Clock::now();
+  ARROW_ASSIGN_OR_RAISE(auto buffer, stream_->Read(nbytes));
+  statistics_->RecordRead(buffer->size(), NanosSince(start));
+  return buffer;
+}
+
+Result<int64_t> InstrumentedRandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
+                                                     void* out) {
+  const auto start = Clock::now();
+  ARROW_ASSIGN_OR_RAISE(auto bytes_read, stream_->ReadAt(position, nbytes, out));
+  statistics_->RecordRead(bytes_read, NanosSince(start));
+  return bytes_read;
+}
+
+Result<std::shared_ptr<Buffer>> InstrumentedRandomAccessFile::ReadAt(int64_t position,
+                                                                     int64_t nbytes) {
+  const auto start = Clock::now();
+  ARROW_ASSIGN_OR_RAISE(auto buffer, stream_->ReadAt(position, nbytes));
+  statistics_->RecordRead(buffer->size(), NanosSince(start));
+  return buffer;
+}
+
+Future<std::shared_ptr<Buffer>> InstrumentedRandomAccessFile::ReadAsync(
+    const AsyncContext& ctx, int64_t position, int64_t nbytes) {
+  const auto start = Clock::now();
+  auto future = stream_->ReadAsync(ctx, position, nbytes);
+  RecordAsyncRead(statistics_, future, start);
+  return future;
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> InstrumentedRandomAccessFile::ReadManyAsync(
+    const AsyncContext& ctx, const std::vector<ReadRange>& ranges) {
+  const auto start = Clock::now();
+  auto futures = stream_->ReadManyAsync(ctx, ranges);
+  for (const auto& future : futures) {
+    RecordAsyncRead(statistics_, future, start);
+  }
+  return futures;
+}
+
+Status InstrumentedRandomAccessFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  return stream_->WillNeed(ranges);
+}
+
+Result<util::string_view> InstrumentedRandomAccessFile::Peek(int64_t nbytes) {
+  return stream_->Peek(nbytes);
+}
+
+bool InstrumentedRandomAccessFile::supports_zero_copy() const {
+  return stream_->supports_zero_copy();
+}
+
+}  // namespace io
+}  // namespace arrow
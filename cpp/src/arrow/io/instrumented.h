@@ -0,0 +1,186 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Stream implementations collecting I/O statistics
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class Status;
+
+namespace io {
+
+/// \brief A point-in-time copy of the counters of an IOStatistics
+struct ARROW_EXPORT IOStatisticsSnapshot {
+  /// The number of read requests issued to the underlying files
+  int64_t read_requests = 0;
+  /// The number of bytes returned by those requests
+  int64_t bytes_read = 0;
+  /// The number of files and streams opened for reading
+  int64_t files_opened = 0;
+  /// The number of metadata requests (file info, listings, file sizes)
+  int64_t metadata_requests = 0;
+
+  /// The number of ranges requested from a ReadRangeCache, and their size
+  int64_t cached_ranges = 0;
+  int64_t cached_range_bytes = 0;
+  /// The number of requests those ranges were coalesced into, and their size
+  int64_t coalesced_ranges = 0;
+  int64_t coalesced_range_bytes = 0;
+
+  /// \brief Latency histograms
+  ///
+  /// Bucket 0 counts the requests which took less than 1 microsecond, and
+  /// bucket i > 0 those which took [2^(i-1), 2^i) microseconds.  The last
+  /// bucket also counts all longer requests.
+  std::vector<int64_t> read_latency_histogram;
+  std::vector<int64_t> metadata_latency_histogram;
+
+  /// \brief The upper bound in microseconds of a latency histogram bucket
+  static int64_t BucketUpperBoundMicros(int bucket) { return int64_t(1) << bucket; }
+
+  /// \brief An estimate of the given latency quantile in microseconds
+  ///
+  /// The upper bound of the bucket containing the quantile, or 0 if the
+  /// histogram is empty.
+  static int64_t LatencyQuantileMicros(const std::vector<int64_t>& histogram,
+                                       double quantile);
+};
+
+/// \brief Counters of the I/O performed through instrumented files
+///
+/// An IOStatistics can be shared by any number of InstrumentedInputStream,
+/// InstrumentedRandomAccessFile and fs::InstrumentedFileSystem instances, and
+/// by ReadRangeCache through CacheOptions::statistics.  It is thread-safe.
+class ARROW_EXPORT IOStatistics {
+ public:
+  static constexpr int kNumLatencyBuckets = 32;
+
+  IOStatistics();
+
+  void RecordRead(int64_t nbytes, int64_t latency_nanos);
+  void RecordOpen();
+  void RecordMetadata(int64_t latency_nanos);
+  /// \brief Record a ReadRangeCache::Cache() call
+  void RecordCoalescing(const std::vector<ReadRange>& ranges,
+                        const std::vector<ReadRange>& coalesced);
+
+  IOStatisticsSnapshot Snapshot() const;
+
+  /// \brief Reset all counters to zero
+  void Reset();
+
+ private:
+  using Histogram = std::array<std::atomic<int64_t>, kNumLatencyBuckets>;
+
+  static void RecordLatency(int64_t latency_nanos, Histogram* histogram);
+
+  std::atomic<int64_t> read_requests_;
+  std::atomic<int64_t> bytes_read_;
+  std::atomic<int64_t> files_opened_;
+  std::atomic<int64_t> metadata_requests_;
+  std::atomic<int64_t> cached_ranges_;
+  std::atomic<int64_t> cached_range_bytes_;
+  std::atomic<int64_t> coalesced_ranges_;
+  std::atomic<int64_t> coalesced_range_bytes_;
+  Histogram read_latencies_;
+  Histogram metadata_latencies_;
+};
+
+template <class StreamType>
+class ARROW_EXPORT InstrumentedInputStreamBase : public StreamType {
+ public:
+  InstrumentedInputStreamBase(std::shared_ptr<StreamType> stream,
+                              std::shared_ptr<IOStatistics> statistics)
+      : stream_(std::move(stream)), statistics_(std::move(statistics)) {}
+
+  const std::shared_ptr<IOStatistics>& statistics() const { return statistics_; }
+
+ protected:
+  std::shared_ptr<StreamType> stream_;
+  std::shared_ptr<IOStatistics> statistics_;
+};
+
+/// \brief An InputStream wrapper that records its reads into an IOStatistics.
+///
+/// Other calls are forwarded directly.
+class ARROW_EXPORT InstrumentedInputStream
+    : public InstrumentedInputStreamBase<InputStream> {
+ public:
+  ~InstrumentedInputStream() override;
+
+  using InstrumentedInputStreamBase<InputStream>::InstrumentedInputStreamBase;
+
+  Status Close() override;
+  Status Abort() override;
+  bool closed() const override;
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override;
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override;
+  Result<util::string_view> Peek(int64_t nbytes) override;
+  bool supports_zero_copy() const override;
+
+  Result<int64_t> Tell() const override;
+};
+
+/// \brief A RandomAccessFile wrapper that records its reads into an IOStatistics.
+///
+/// Similar to InstrumentedInputStream.  Each range of a ReadManyAsync() call
+/// counts as a request, and asynchronous reads are timed until completion.
+/// GetSize() counts as a metadata request.
+class ARROW_EXPORT InstrumentedRandomAccessFile
+    : public InstrumentedInputStreamBase<RandomAccessFile> {
+ public:
+  ~InstrumentedRandomAccessFile() override;
+
+  using InstrumentedInputStreamBase<RandomAccessFile>::InstrumentedInputStreamBase;
+
+  Status Close() override;
+  Status Abort() override;
+  bool closed() const override;
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override;
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override;
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override;
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override;
+  Future<std::shared_ptr<Buffer>> ReadAsync(const AsyncContext& ctx, int64_t position,
+                                            int64_t nbytes) override;
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const AsyncContext& ctx, const std::vector<ReadRange>& ranges) override;
+  Status WillNeed(const std::vector<ReadRange>& ranges) override;
+  Result<util::string_view> Peek(int64_t nbytes) override;
+  bool supports_zero_copy() const override;
+
+  Result<int64_t> GetSize() override;
+  Status Seek(int64_t position) override;
+  Result<int64_t> Tell() const override;
+};
+
+}  // namespace io
+}  // namespace arrow
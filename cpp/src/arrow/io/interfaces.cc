@@ -24,6 +24,7 @@
 #include <memory>
 #include <mutex>
 #include <sstream>
+#include <string>
 #include <typeinfo>
 #include <utility>
 
@@ -33,6 +34,7 @@
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/future.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
@@ -126,6 +128,7 @@ Future<std::shared_ptr<Buffer>> RandomAccessFile::ReadAsync(const AsyncContext&
                                                             int64_t nbytes) {
   auto self = shared_from_this();
   TaskHints hints;
+  hints.priority = ctx.priority;
   hints.io_size = nbytes;
   hints.external_id = ctx.external_id;
   auto maybe_fut = ctx.executor->Submit(std::move(hints), [self, position, nbytes] {
@@ -137,6 +140,16 @@ Future<std::shared_ptr<Buffer>> RandomAccessFile::ReadAsync(const AsyncContext&
   return *std::move(maybe_fut);
 }
 
+std::vector<Future<std::shared_ptr<Buffer>>> RandomAccessFile::ReadManyAsync(
+    const AsyncContext& ctx, const std::vector<ReadRange>& ranges) {
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  futures.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    futures.push_back(ReadAsync(ctx, range.offset, range.length));
+  }
+  return futures;
+}
+
 // Default WillNeed() implementation: no-op
 Status RandomAccessFile::WillNeed(const std::vector<ReadRange>& ranges) {
   return Status::OK();
@@ -150,6 +163,13 @@ Status Writable::Write(const std::shared_ptr<Buffer>& data) {
   return Write(data->data(), data->size());
 }
 
+Status Writable::WriteBuffers(const std::vector<std::shared_ptr<Buffer>>& data) {
+  for (const auto& buffer : data) {
+    RETURN_NOT_OK(Write(buffer));
+  }
+  return Status::OK();
+}
+
 Status Writable::Flush() { return Status::OK(); }
 
 // An InputStream that reads from a delimited range of a RandomAccessFile
@@ -322,8 +342,25 @@ void SharedExclusiveChecker::UnlockExclusive() {}
 
 #endif
 
+static int DefaultIOThreadPoolCapacity() {
+  auto maybe_env = ::arrow::internal::GetEnvVar("ARROW_IO_THREADS");
+  if (maybe_env.ok()) {
+    const std::string& str = *maybe_env;
+    auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
+    if (!str.empty() && str.size() <= 6 &&
+        std::all_of(str.begin(), str.end(), is_digit)) {
+      const int threads = std::stoi(str);
+      if (threads > 0) {
+        return threads;
+      }
+    }
+    ARROW_LOG(WARNING) << "ARROW_IO_THREADS does not contain a valid number of threads";
+  }
+  return 8;
+}
+
 static std::shared_ptr<ThreadPool> MakeIOThreadPool() {
-  auto maybe_pool = ThreadPool::MakeEternal(/*threads=*/8);
+  auto maybe_pool = ThreadPool::MakeEternal(DefaultIOThreadPoolCapacity());
   if (!maybe_pool.ok()) {
     maybe_pool.status().Abort("Failed to create global IO thread pool");
   }
@@ -429,5 +466,12 @@ std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
 }
 
 }  // namespace internal
+
+int GetIOThreadPoolCapacity() { return internal::GetIOThreadPool()->GetCapacity(); }
+
+Status SetIOThreadPoolCapacity(int threads) {
+  return internal::GetIOThreadPool()->SetCapacity(threads);
+}
+
 }  // namespace io
 }  // namespace arrow
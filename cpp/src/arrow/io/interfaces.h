@@ -53,6 +53,10 @@ struct ARROW_EXPORT AsyncContext {
   ::arrow::internal::Executor* executor;
   // An application-specific ID, forwarded to executor task submissions
   int64_t external_id = -1;
+  // The priority of the tasks submitted on behalf of this context, the lower the
+  // more urgent: e.g. foreground reads can preempt background prefetching by
+  // using a lower priority
+  int32_t priority = 0;
 
   // Set `executor` to a global IO-specific thread pool.
   AsyncContext();
@@ -124,6 +128,14 @@ class ARROW_EXPORT Writable {
   /// buffering is required.  See Write(const void*, int64_t) for details.
   virtual Status Write(const std::shared_ptr<Buffer>& data);
 
+  /// \brief Write a sequence of buffers to the stream, in order
+  ///
+  /// This is equivalent to writing each buffer in turn, which is what the
+  /// default implementation does.  Streams that can hand buffers to their
+  /// destination without copying them (e.g. with writev(), or by retaining
+  /// references to the buffers) may override this to do so.
+  virtual Status WriteBuffers(const std::vector<std::shared_ptr<Buffer>>& data);
+
   /// \brief Flush buffered bytes, if any
   virtual Status Flush();
 
@@ -237,6 +249,14 @@ class ARROW_EXPORT RandomAccessFile
   virtual Future<std::shared_ptr<Buffer>> ReadAsync(const AsyncContext&, int64_t position,
                                                     int64_t nbytes);
 
+  /// EXPERIMENTAL: Read several ranges of data asynchronously.
+  ///
+  /// One future is returned per range, in the same order.  The default
+  /// implementation calls ReadAsync() for each range, but subclasses may
+  /// submit all the reads at once.
+  virtual std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const AsyncContext&, const std::vector<ReadRange>& ranges);
+
   /// EXPERIMENTAL: Inform that the given ranges may be read soon.
   ///
   /// Some implementations might arrange to prefetch some of the data.
@@ -275,5 +295,23 @@ ARROW_EXPORT
 Result<Iterator<std::shared_ptr<Buffer>>> MakeInputStreamIterator(
     std::shared_ptr<InputStream> stream, int64_t block_size);
 
+/// \brief Get the capacity of the global I/O thread pool
+///
+/// Return the number of worker threads in the thread pool to which
+/// Arrow dispatches various I/O-bound tasks.  This is an ideal number,
+/// not necessarily the exact number of threads at a given point in time.
+///
+/// You can change this number using SetIOThreadPoolCapacity(), or with the
+/// ARROW_IO_THREADS environment variable before the pool is first used.
+ARROW_EXPORT int GetIOThreadPoolCapacity();
+
+/// \brief Set the capacity of the global I/O thread pool
+///
+/// Set the number of worker threads in the thread pool to which
+/// Arrow dispatches various I/O-bound tasks.
+///
+/// The current number is returned by GetIOThreadPoolCapacity().
+ARROW_EXPORT Status SetIOThreadPoolCapacity(int threads);
+
 }  // namespace io
 }  // namespace arrow
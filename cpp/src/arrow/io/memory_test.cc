@@ -31,6 +31,7 @@
 
 #include "arrow/buffer.h"
 #include "arrow/io/caching.h"
+#include "arrow/io/instrumented.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/io/slow.h"
@@ -102,6 +103,16 @@ TEST_F(TestBufferOutputStream, WriteAfterFinish) {
   ASSERT_RAISES(IOError, stream_->Write(data));
 }
 
+TEST_F(TestBufferOutputStream, WriteBuffers) {
+  std::vector<std::shared_ptr<Buffer>> buffers = {
+      Buffer::FromString("data"), std::make_shared<Buffer>(""),
+      Buffer::FromString("123456")};
+  ASSERT_OK(stream_->WriteBuffers(buffers));
+  ASSERT_OK(stream_->WriteBuffers({}));
+  ASSERT_OK(stream_->Close());
+  AssertBufferEqual(*buffer_, "data123456");
+}
+
 TEST_F(TestBufferOutputStream, Reset) {
   std::string data = "data123456";
 
@@ -400,6 +411,105 @@ TEST(TestSlowInputStream, Basics) { TestSlowInputStream<SlowInputStream>(); }
 
 TEST(TestSlowRandomAccessFile, Basics) { TestSlowInputStream<SlowRandomAccessFile>(); }
 
+// -----------------------------------------------------------------------
+// Test instrumented streams
+
+int64_t HistogramTotal(const std::vector<int64_t>& histogram) {
+  int64_t total = 0;
+  for (const auto count : histogram) {
+    total += count;
+  }
+  return total;
+}
+
+TEST(TestIOStatistics, LatencyHistogram) {
+  IOStatistics stats;
+  stats.RecordRead(10, /*latency_nanos=*/500);
+  stats.RecordRead(10, /*latency_nanos=*/1500);
+  stats.RecordRead(10, /*latency_nanos=*/3000);
+  stats.RecordRead(10, /*latency_nanos=*/3999);
+  stats.RecordRead(10, /*latency_nanos=*/int64_t(1) << 60);
+  stats.RecordMetadata(/*latency_nanos=*/1000);
+
+  auto snapshot = stats.Snapshot();
+  ASSERT_EQ(snapshot.read_requests, 5);
+  ASSERT_EQ(snapshot.bytes_read, 50);
+  ASSERT_EQ(snapshot.metadata_requests, 1);
+  const auto& histogram = snapshot.read_latency_histogram;
+  ASSERT_EQ(histogram.size(), IOStatistics::kNumLatencyBuckets);
+  ASSERT_EQ(histogram[0], 1);
+  ASSERT_EQ(histogram[1], 1);
+  ASSERT_EQ(histogram[2], 2);
+  ASSERT_EQ(histogram.back(), 1);
+  ASSERT_EQ(HistogramTotal(histogram), 5);
+  ASSERT_EQ(snapshot.metadata_latency_histogram[1], 1);
+
+  ASSERT_EQ(IOStatisticsSnapshot::LatencyQuantileMicros(histogram, 0.0), 1);
+  ASSERT_EQ(IOStatisticsSnapshot::LatencyQuantileMicros(histogram, 0.5), 4);
+  ASSERT_EQ(IOStatisticsSnapshot::LatencyQuantileMicros(histogram, 0.8), 4);
+  ASSERT_EQ(IOStatisticsSnapshot::LatencyQuantileMicros(histogram, 1.0),
+            IOStatisticsSnapshot::BucketUpperBoundMicros(
+                IOStatistics::kNumLatencyBuckets - 1));
+  ASSERT_EQ(IOStatisticsSnapshot::LatencyQuantileMicros({}, 0.5), 0);
+
+  stats.Reset();
+  snapshot = stats.Snapshot();
+  ASSERT_EQ(snapshot.read_requests, 0);
+  ASSERT_EQ(snapshot.bytes_read, 0);
+  ASSERT_EQ(HistogramTotal(snapshot.read_latency_histogram), 0);
+}
+
+TEST(TestInstrumentedInputStream, Basics) {
+  auto stats = std::make_shared<IOStatistics>();
+  auto stream = std::make_shared<BufferReader>(util::string_view("abcdefghijkl"));
+  auto instrumented = std::make_shared<InstrumentedInputStream>(stream, stats);
+
+  ASSERT_OK_AND_ASSIGN(auto buf, instrumented->Read(6));
+  AssertBufferEqual(*buf, "abcdef");
+  char out[8];
+  ASSERT_OK_AND_ASSIGN(auto nbytes, instrumented->Read(8, out));
+  ASSERT_EQ(nbytes, 6);
+  // Peeking doesn't count
+  ASSERT_OK(instrumented->Peek(4));
+
+  auto snapshot = stats->Snapshot();
+  ASSERT_EQ(snapshot.read_requests, 2);
+  ASSERT_EQ(snapshot.bytes_read, 12);
+  ASSERT_EQ(HistogramTotal(snapshot.read_latency_histogram), 2);
+
+  ASSERT_OK(instrumented->Close());
+  ASSERT_TRUE(stream->closed());
+}
+
+TEST(TestInstrumentedRandomAccessFile, Basics) {
+  auto stats = std::make_shared<IOStatistics>();
+  auto file = std::make_shared<BufferReader>(util::string_view("abcdefghijkl"));
+  auto instrumented = std::make_shared<InstrumentedRandomAccessFile>(file, stats);
+
+  ASSERT_OK_AND_ASSIGN(auto size, instrumented->GetSize());
+  ASSERT_EQ(size, 12);
+  ASSERT_OK_AND_ASSIGN(auto buf, instrumented->ReadAt(2, 3));
+  AssertBufferEqual(*buf, "cde");
+  ASSERT_OK_AND_ASSIGN(buf, instrumented->Read(4));
+  AssertBufferEqual(*buf, "abcd");
+  ASSERT_OK_AND_ASSIGN(buf, instrumented->ReadAsync({}, 10, 5).result());
+  AssertBufferEqual(*buf, "kl");
+  auto futures = instrumented->ReadManyAsync({}, {{0, 1}, {6, 2}});
+  ASSERT_EQ(futures.size(), 2);
+  ASSERT_OK_AND_ASSIGN(buf, futures[0].result());
+  AssertBufferEqual(*buf, "a");
+  ASSERT_OK_AND_ASSIGN(buf, futures[1].result());
+  AssertBufferEqual(*buf, "gh");
+
+  auto snapshot = stats->Snapshot();
+  ASSERT_EQ(snapshot.read_requests, 5);
+  ASSERT_EQ(snapshot.bytes_read, 3 + 4 + 2 + 1 + 2);
+  ASSERT_EQ(snapshot.metadata_requests, 1);
+  ASSERT_EQ(HistogramTotal(snapshot.read_latency_histogram), 5);
+  ASSERT_EQ(HistogramTotal(snapshot.metadata_latency_histogram), 1);
+  ASSERT_TRUE(instrumented->supports_zero_copy());
+}
+
 // -----------------------------------------------------------------------
 // Test transform streams
 
@@ -729,6 +839,142 @@ TEST(RangeReadCache, Basics) {
   ASSERT_RAISES(Invalid, cache.Read({25, 2}));
 }
 
+TEST(RangeReadCache, SplitLargeRanges) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  auto file = std::make_shared<BufferReader>(Buffer(data));
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 2;
+  options.range_size_limit = 4;
+  options.split_large_ranges = true;
+  internal::ReadRangeCache cache(file, {}, options);
+
+  // Split into [1, 4), [4, 7), [7, 11)
+  ASSERT_OK(cache.Cache({{1, 10}, {20, 2}}));
+
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({1, 10}));
+  ASSERT_EQ(buf->ToString(), "bcdefghijk");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({2, 2}));
+  ASSERT_EQ(buf->ToString(), "cd");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({3, 2}));
+  ASSERT_EQ(buf->ToString(), "de");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({5, 5}));
+  ASSERT_EQ(buf->ToString(), "fghij");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({20, 2}));
+  ASSERT_EQ(buf->ToString(), "uv");
+
+  // Non-cached ranges
+  ASSERT_RAISES(Invalid, cache.Read({0, 3}));
+  ASSERT_RAISES(Invalid, cache.Read({9, 3}));
+  ASSERT_RAISES(Invalid, cache.Read({19, 2}));
+}
+
+TEST(RangeReadCache, MetricsEstimator) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  auto file = std::make_shared<BufferReader>(Buffer(data));
+  auto estimator = std::make_shared<ReadMetricsEstimator>();
+  CacheOptions options = CacheOptions::Defaults();
+  options.metrics_estimator = estimator;
+  internal::ReadRangeCache cache(file, {}, options);
+
+  ASSERT_OK(cache.Cache({{1, 2}, {20, 2}}));
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({1, 2}));
+  ASSERT_EQ(buf->ToString(), "bc");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({20, 2}));
+  ASSERT_EQ(buf->ToString(), "uv");
+  // Default limits coalesce both ranges into a single read
+  ASSERT_EQ(estimator->num_samples(), 1);
+}
+
+TEST(RangeReadCache, Statistics) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  auto stats = std::make_shared<IOStatistics>();
+  auto file = std::make_shared<InstrumentedRandomAccessFile>(
+      std::make_shared<BufferReader>(Buffer(data)), stats);
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 2;
+  options.range_size_limit = 10;
+  options.statistics = stats;
+  internal::ReadRangeCache cache(file, {}, options);
+
+  // Coalesced into [1, 5), [8, 10) and [20, 22)
+  ASSERT_OK(cache.Cache({{1, 2}, {3, 2}, {8, 2}, {20, 2}}));
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({3, 2}));
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({8, 2}));
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({20, 2}));
+
+  auto snapshot = stats->Snapshot();
+  ASSERT_EQ(snapshot.cached_ranges, 4);
+  ASSERT_EQ(snapshot.cached_range_bytes, 8);
+  ASSERT_EQ(snapshot.coalesced_ranges, 3);
+  ASSERT_EQ(snapshot.coalesced_range_bytes, 8);
+  ASSERT_EQ(snapshot.read_requests, 3);
+  ASSERT_EQ(snapshot.bytes_read, 8);
+}
+
+TEST(ReadMetricsEstimator, Estimate) {
+  const double latency = 0.01;
+  const double bandwidth = 1e8;
+  ReadMetricsEstimator estimator;
+  double actual_latency, actual_bandwidth;
+
+  for (int64_t i = 1; i < ReadMetricsEstimator::kMinSamples; ++i) {
+    estimator.Record(i * 1000000, latency + i * 1000000 / bandwidth);
+    ASSERT_FALSE(estimator.Estimate(&actual_latency, &actual_bandwidth));
+  }
+  for (int64_t i = ReadMetricsEstimator::kMinSamples; i <= 20; ++i) {
+    estimator.Record(i * 1000000, latency + i * 1000000 / bandwidth);
+  }
+  ASSERT_EQ(estimator.num_samples(), 20);
+  ASSERT_TRUE(estimator.Estimate(&actual_latency, &actual_bandwidth));
+  ASSERT_NEAR(actual_latency, latency, 1e-6);
+  ASSERT_NEAR(actual_bandwidth, bandwidth, 1e2);
+
+  CacheOptions options = CacheOptions::Defaults();
+  options.split_large_ranges = true;
+  auto adjusted = estimator.AdjustCacheOptions(options);
+  auto expected = CacheOptions::MakeFromMeasuredMetrics(
+      actual_latency, actual_bandwidth,
+      CacheOptions::kDefaultIdealBandwidthUtilizationFrac,
+      CacheOptions::kDefaultMaxIdealRequestSizeMib * 1024 * 1024);
+  expected.split_large_ranges = true;
+  ASSERT_EQ(adjusted, expected);
+  // 10 ms at 10^8 bytes/s
+  ASSERT_EQ(adjusted.hole_size_limit, 1000000);
+}
+
+TEST(ReadMetricsEstimator, Degenerate) {
+  CacheOptions options = CacheOptions::Defaults();
+  double latency, bandwidth;
+
+  // Requests of identical sizes don't allow separating latency and bandwidth
+  ReadMetricsEstimator estimator;
+  for (int i = 0; i < 10; ++i) {
+    estimator.Record(1000, 0.01 + i * 1e-4);
+  }
+  ASSERT_FALSE(estimator.Estimate(&latency, &bandwidth));
+  ASSERT_EQ(estimator.AdjustCacheOptions(options), options);
+
+  // Larger requests completing faster
+  ReadMetricsEstimator other;
+  for (int i = 1; i <= 10; ++i) {
+    other.Record(i * 1000, 1.0 / i);
+  }
+  ASSERT_FALSE(other.Estimate(&latency, &bandwidth));
+  ASSERT_EQ(other.AdjustCacheOptions(options), options);
+
+  // Zero latency still yields usable limits
+  ReadMetricsEstimator fast;
+  for (int i = 1; i <= 10; ++i) {
+    fast.Record(i * 1000, i * 1e-6);
+  }
+  auto adjusted = fast.AdjustCacheOptions(options);
+  ASSERT_GE(adjusted.hole_size_limit, 1);
+  ASSERT_GT(adjusted.range_size_limit, adjusted.hole_size_limit);
+}
+
 TEST(CacheOptions, Basics) {
   auto check = [](const CacheOptions actual, const double expected_hole_size_limit_MiB,
                   const double expected_range_size_limit_MiB) -> void {
@@ -750,6 +996,10 @@ TEST(CacheOptions, Basics) {
   // TTFB = 5 ms, BW = 500 MiB/s, BW_utilization = 75%, max_ideal_request_size = 5 MiB,
   // we expect the range_size_limit to be capped at 5 MiB.
   check(CacheOptions::MakeFromNetworkMetrics(5, 500, .75, 5), 2.5, 5);
+  // Test: measured metrics in seconds and bytes per second.
+  check(CacheOptions::MakeFromMeasuredMetrics(0.005, 500 * 1024 * 1024, .75,
+                                              5 * 1024 * 1024),
+        2.5, 5);
 }
 
 }  // namespace io
@@ -37,6 +37,7 @@ class MemoryMappedFile;
 class WritableFile;
 class ReadWriteFileInterface;
 
+class IOStatistics;
 class LatencyGenerator;
 
 class BufferReader;
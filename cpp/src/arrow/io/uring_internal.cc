@@ -0,0 +1,424 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/uring_internal.h"
+
+#if defined(__linux__) && defined(ARROW_HAVE_LINUX_IO_URING)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define ARROW_USE_IO_URING
+#endif
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::IOErrorFromErrno;
+
+namespace io {
+namespace internal {
+
+#ifdef ARROW_USE_IO_URING
+
+namespace {
+
+// Number of submission queue entries (the completion queue is twice as large)
+constexpr unsigned kQueueDepth = 256;
+
+// Linux never transfers more than this in a single read
+constexpr int64_t kMaxReadSize = 0x7ffff000;
+
+struct ReadRequest {
+  int fd;
+  int64_t position;
+  int64_t nbytes;
+  int64_t bytes_read;
+  std::shared_ptr<ResizableBuffer> buffer;
+  Future<std::shared_ptr<Buffer>> future;
+  Status status;
+  // Must stay alive until the kernel has consumed it
+  struct iovec iov;
+};
+
+void FinishRequest(ReadRequest* raw_request) {
+  std::unique_ptr<ReadRequest> request(raw_request);
+  if (!request->status.ok()) {
+    request->future.MarkFinished(std::move(request->status));
+    return;
+  }
+  if (request->bytes_read < request->nbytes) {
+    Status st = request->buffer->Resize(request->bytes_read);
+    if (!st.ok()) {
+      request->future.MarkFinished(std::move(st));
+      return;
+    }
+    request->buffer->ZeroPadding();
+  }
+  request->future.MarkFinished(std::shared_ptr<Buffer>(std::move(request->buffer)));
+}
+
+}  // namespace
+
+class IOUring::Impl {
+ public:
+  ~Impl() {
+    if (reaper_.joinable()) {
+      {
+        // Post a sentinel so that the reaper thread exits once all reads are done
+        std::lock_guard<std::mutex> lock(mutex_);
+        const unsigned tail = *sq_tail_;
+        io_uring_sqe* sqe = PrepareEntry(tail);
+        sqe->opcode = IORING_OP_NOP;
+        __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+        ARROW_UNUSED(Enter(1, 0, 0));
+      }
+      reaper_.join();
+    }
+    if (sqes_ != nullptr) {
+      munmap(sqes_, sqes_size_);
+    }
+    if (cq_ptr_ != nullptr && cq_ptr_ != sq_ptr_) {
+      munmap(cq_ptr_, cq_size_);
+    }
+    if (sq_ptr_ != nullptr) {
+      munmap(sq_ptr_, sq_size_);
+    }
+    if (ring_fd_ != -1) {
+      close(ring_fd_);
+    }
+  }
+
+  Status Init() {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    ring_fd_ = static_cast<int>(syscall(__NR_io_uring_setup, kQueueDepth, &params));
+    if (ring_fd_ < 0) {
+      return IOErrorFromErrno(errno, "io_uring_setup failed");
+    }
+
+    sq_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_size_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+      sq_size_ = cq_size_ = std::max(sq_size_, cq_size_);
+    }
+    ARROW_ASSIGN_OR_RAISE(sq_ptr_, MapRing(sq_size_, IORING_OFF_SQ_RING));
+    if (single_mmap) {
+      cq_ptr_ = sq_ptr_;
+    } else {
+      ARROW_ASSIGN_OR_RAISE(cq_ptr_, MapRing(cq_size_, IORING_OFF_CQ_RING));
+    }
+    sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+    ARROW_ASSIGN_OR_RAISE(void* sqes, MapRing(sqes_size_, IORING_OFF_SQES));
+    sqes_ = reinterpret_cast<struct io_uring_sqe*>(sqes);
+
+    auto sq_base = reinterpret_cast<uint8_t*>(sq_ptr_);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq_base + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned*>(sq_base + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq_base + params.sq_off.array);
+    sq_entries_ = params.sq_entries;
+
+    auto cq_base = reinterpret_cast<uint8_t*>(cq_ptr_);
+    cq_head_ = reinterpret_cast<unsigned*>(cq_base + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq_base + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned*>(cq_base + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<struct io_uring_cqe*>(cq_base + params.cq_off.cqes);
+    // Keep one completion slot for the shutdown sentinel, so that the
+    // completion queue can never overflow
+    max_in_flight_ = params.cq_entries - 1;
+
+    reaper_ = std::thread([this] { ReapCompletions(); });
+    return Status::OK();
+  }
+
+  void Submit(std::vector<ReadRequest*> requests) {
+    std::vector<ReadRequest*> failed;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      backlog_.insert(backlog_.end(), requests.begin(), requests.end());
+      SubmitBacklog(&failed);
+    }
+    for (auto request : failed) {
+      FinishRequest(request);
+    }
+  }
+
+ protected:
+  Result<void*> MapRing(size_t size, off_t offset) {
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                     ring_fd_, offset);
+    if (ptr == MAP_FAILED) {
+      return IOErrorFromErrno(errno, "mmap of io_uring queue failed");
+    }
+    return ptr;
+  }
+
+  int Enter(unsigned to_submit, unsigned min_complete, unsigned flags) {
+    int ret;
+    do {
+      ret = static_cast<int>(syscall(__NR_io_uring_enter, ring_fd_, to_submit,
+                                     min_complete, flags, nullptr, 0));
+    } while (ret < 0 && errno == EINTR);
+    return ret;
+  }
+
+  // Must be called with the lock held
+  io_uring_sqe* PrepareEntry(unsigned tail) {
+    const unsigned index = tail & sq_mask_;
+    io_uring_sqe* sqe = &sqes_[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sq_array_[index] = index;
+    return sqe;
+  }
+
+  // Submit as many backlogged reads as the completion queue allows.
+  // Must be called with the lock held.
+  void SubmitBacklog(std::vector<ReadRequest*>* failed) {
+    std::vector<ReadRequest*> batch;
+    while (!backlog_.empty() && in_flight_ < max_in_flight_) {
+      // Without SQPOLL, the kernel consumes all entries during io_uring_enter(),
+      // so the submission queue is empty at this point
+      const unsigned tail = *sq_tail_;
+      batch.clear();
+      while (batch.size() < sq_entries_ && !backlog_.empty() &&
+             in_flight_ + batch.size() < max_in_flight_) {
+        ReadRequest* request = backlog_.front();
+        backlog_.pop_front();
+        io_uring_sqe* sqe = PrepareEntry(tail + static_cast<unsigned>(batch.size()));
+        const int64_t offset = request->position + request->bytes_read;
+        request->iov.iov_base = request->buffer->mutable_data() + request->bytes_read;
+        const int64_t length =
+            std::min(kMaxReadSize, request->nbytes - request->bytes_read);
+        request->iov.iov_len = static_cast<size_t>(length);
+        sqe->opcode = IORING_OP_READV;
+        sqe->fd = request->fd;
+        sqe->off = static_cast<uint64_t>(offset);
+        sqe->addr = reinterpret_cast<uint64_t>(&request->iov);
+        sqe->len = 1;
+        sqe->user_data = reinterpret_cast<uint64_t>(request);
+        batch.push_back(request);
+      }
+      const auto num_entries = static_cast<unsigned>(batch.size());
+      __atomic_store_n(sq_tail_, tail + num_entries, __ATOMIC_RELEASE);
+
+      unsigned submitted = 0;
+      while (submitted < num_entries) {
+        const int ret = Enter(num_entries - submitted, 0, 0);
+        if (ret <= 0) {
+          // The remaining entries were not consumed: retract and fail them
+          const Status st = IOErrorFromErrno(ret < 0 ? errno : EAGAIN,
+                                             "io_uring_enter failed");
+          __atomic_store_n(sq_tail_, tail + submitted, __ATOMIC_RELEASE);
+          for (unsigned i = submitted; i < num_entries; ++i) {
+            batch[i]->status = st;
+            failed->push_back(batch[i]);
+          }
+          break;
+        }
+        submitted += static_cast<unsigned>(ret);
+      }
+      in_flight_ += submitted;
+      if (submitted < num_entries) {
+        break;
+      }
+    }
+  }
+
+  // Return whether the request is finished, otherwise it must be resubmitted
+  bool OnCompletion(ReadRequest* request, int res) {
+    if (res < 0) {
+      if (res == -EINTR || res == -EAGAIN) {
+        return false;
+      }
+      request->status = IOErrorFromErrno(-res, "io_uring read failed");
+      return true;
+    }
+    request->bytes_read += res;
+    return res == 0 || request->bytes_read == request->nbytes;
+  }
+
+  void ReapCompletions() {
+    bool shutting_down = false;
+    std::vector<ReadRequest*> finished, resubmit;
+    while (true) {
+      if (Enter(0, 1, IORING_ENTER_GETEVENTS) < 0) {
+        ARROW_LOG(WARNING) << IOErrorFromErrno(errno, "io_uring_enter failed").ToString();
+      }
+      unsigned head = *cq_head_;
+      const unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+      unsigned num_completed = 0;
+      for (; head != tail; ++head) {
+        const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+        auto request = reinterpret_cast<ReadRequest*>(cqe.user_data);
+        if (request == nullptr) {
+          shutting_down = true;
+          continue;
+        }
+        ++num_completed;
+        if (OnCompletion(request, cqe.res)) {
+          finished.push_back(request);
+        } else {
+          resubmit.push_back(request);
+        }
+      }
+      __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+
+      bool done;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        in_flight_ -= num_completed;
+        // Short reads are continued before newer requests
+        backlog_.insert(backlog_.begin(), resubmit.begin(), resubmit.end());
+        SubmitBacklog(&finished);
+        done = shutting_down && in_flight_ == 0 && backlog_.empty();
+      }
+      // Mark futures finished outside of the lock
+      for (auto request : finished) {
+        FinishRequest(request);
+      }
+      finished.clear();
+      resubmit.clear();
+      if (done) {
+        break;
+      }
+    }
+  }
+
+  int ring_fd_ = -1;
+  void* sq_ptr_ = nullptr;
+  void* cq_ptr_ = nullptr;
+  size_t sq_size_ = 0;
+  size_t cq_size_ = 0;
+  size_t sqes_size_ = 0;
+
+  // Submission queue (written by the submitting threads, under the lock)
+  unsigned* sq_tail_ = nullptr;
+  unsigned* sq_array_ = nullptr;
+  unsigned sq_mask_ = 0;
+  unsigned sq_entries_ = 0;
+  struct io_uring_sqe* sqes_ = nullptr;
+
+  // Completion queue (read by the reaper thread only)
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned cq_mask_ = 0;
+  struct io_uring_cqe* cqes_ = nullptr;
+
+  std::mutex mutex_;
+  // Reads waiting for room in the completion queue
+  std::deque<ReadRequest*> backlog_;
+  unsigned in_flight_ = 0;
+  unsigned max_in_flight_ = 0;
+  std::thread reaper_;
+};
+
+IOUring::IOUring() : impl_(new Impl()) {}
+
+IOUring::~IOUring() {}
+
+IOUring* IOUring::GetInstance() {
+  static std::unique_ptr<IOUring> instance = []() -> std::unique_ptr<IOUring> {
+    auto maybe_env = ::arrow::internal::GetEnvVar("ARROW_IO_URING");
+    if (maybe_env.ok() && *maybe_env == "0") {
+      return nullptr;
+    }
+    std::unique_ptr<IOUring> uring(new IOUring());
+    Status st = uring->impl_->Init();
+    if (!st.ok()) {
+      ARROW_LOG(DEBUG) << "io_uring not available: " << st.ToString();
+      return nullptr;
+    }
+    return uring;
+  }();
+  return instance.get();
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> IOUring::ReadAt(
+    int fd, const std::vector<ReadRange>& ranges, MemoryPool* pool) {
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  std::vector<ReadRequest*> requests;
+  futures.reserve(ranges.size());
+  requests.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    auto fut = Future<std::shared_ptr<Buffer>>::Make();
+    futures.push_back(fut);
+    auto maybe_buffer = AllocateResizableBuffer(range.length, pool);
+    if (!maybe_buffer.ok()) {
+      fut.MarkFinished(maybe_buffer.status());
+      continue;
+    }
+    std::shared_ptr<ResizableBuffer> buffer = *std::move(maybe_buffer);
+    if (range.length == 0) {
+      fut.MarkFinished(std::shared_ptr<Buffer>(std::move(buffer)));
+      continue;
+    }
+    requests.push_back(new ReadRequest{fd, range.offset, range.length, 0,
+                                       std::move(buffer), std::move(fut), Status::OK(),
+                                       {}});
+  }
+  if (!requests.empty()) {
+    impl_->Submit(std::move(requests));
+  }
+  return futures;
+}
+
+#else  // !ARROW_USE_IO_URING
+
+class IOUring::Impl {};
+
+IOUring::IOUring() : impl_(new Impl()) {}
+
+IOUring::~IOUring() {}
+
+IOUring* IOUring::GetInstance() { return nullptr; }
+
+std::vector<Future<std::shared_ptr<Buffer>>> IOUring::ReadAt(
+    int fd, const std::vector<ReadRange>& ranges, MemoryPool* pool) {
+  ARROW_UNUSED(fd);
+  ARROW_UNUSED(pool);
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    futures.push_back(Future<std::shared_ptr<Buffer>>::MakeFinished(
+        Status::NotImplemented("io_uring is not available")));
+  }
+  return futures;
+}
+
+#endif  // ARROW_USE_IO_URING
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/future.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+namespace internal {
+
+/// \brief Asynchronous positional file reads using Linux io_uring
+///
+/// Reads are submitted to the kernel from the calling thread, several at a
+/// time if desired, without going through a thread pool.  A single
+/// dedicated thread reaps completions and marks the corresponding futures
+/// finished.
+///
+/// The caller must keep the file descriptor open until all futures
+/// returned for it are finished.
+class ARROW_EXPORT IOUring {
+ public:
+  ~IOUring();
+
+  /// \brief Return the process-wide instance
+  ///
+  /// nullptr is returned if io_uring is not available (non-Linux platform,
+  /// kernel too old, forbidden by a seccomp policy...), or if it was
+  /// disabled by setting the ARROW_IO_URING environment variable to "0".
+  static IOUring* GetInstance();
+
+  /// \brief Read the given ranges of `fd` asynchronously
+  ///
+  /// One future is returned per range, in the same order.  As with ReadAt(),
+  /// a buffer can be shorter than requested only if end of file is reached.
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadAt(
+      int fd, const std::vector<ReadRange>& ranges, MemoryPool* pool);
+
+ private:
+  IOUring();
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -21,13 +21,17 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/device.h"
+#include "arrow/io/concurrency.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/memory.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/ipc/metadata_internal.h"
 #include "arrow/ipc/options.h"
 #include "arrow/ipc/util.h"
@@ -44,11 +48,141 @@ class MemoryPool;
 
 namespace ipc {
 
+namespace {
+
+// Random access reader over a message body held as consecutive CPU buffers.
+// A read lying within one chunk is a zero-copy slice of it; only reads that
+// straddle a chunk boundary are copied into a new buffer.
+class ChunkedBodyReader
+    : public io::internal::RandomAccessFileConcurrencyWrapper<ChunkedBodyReader> {
+ public:
+  explicit ChunkedBodyReader(const std::vector<std::shared_ptr<Buffer>>& chunks)
+      : size_(0), position_(0), is_open_(true) {
+    for (const auto& chunk : chunks) {
+      if (chunk->size() > 0) {
+        chunks_.push_back(chunk);
+        chunk_offsets_.push_back(size_);
+        size_ += chunk->size();
+      }
+    }
+  }
+
+  bool closed() const override { return !is_open_; }
+
+  bool supports_zero_copy() const override { return true; }
+
+ protected:
+  friend RandomAccessFileConcurrencyWrapper<ChunkedBodyReader>;
+
+  Status DoClose() {
+    is_open_ = false;
+    return Status::OK();
+  }
+
+  Result<int64_t> DoReadAt(int64_t position, int64_t nbytes, void* out) {
+    RETURN_NOT_OK(CheckClosed());
+    ARROW_ASSIGN_OR_RAISE(nbytes,
+                          io::internal::ValidateReadRange(position, nbytes, size_));
+    CopyRange(position, nbytes, static_cast<uint8_t*>(out));
+    return nbytes;
+  }
+
+  Result<std::shared_ptr<Buffer>> DoReadAt(int64_t position, int64_t nbytes) {
+    RETURN_NOT_OK(CheckClosed());
+    ARROW_ASSIGN_OR_RAISE(nbytes,
+                          io::internal::ValidateReadRange(position, nbytes, size_));
+    if (nbytes == 0) {
+      return std::make_shared<Buffer>(nullptr, 0);
+    }
+    const size_t i = FindChunk(position);
+    const int64_t chunk_position = position - chunk_offsets_[i];
+    if (chunk_position + nbytes <= chunks_[i]->size()) {
+      return SliceBuffer(chunks_[i], chunk_position, nbytes);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateBuffer(nbytes));
+    CopyRange(position, nbytes, buffer->mutable_data());
+    return std::shared_ptr<Buffer>(std::move(buffer));
+  }
+
+  Result<int64_t> DoRead(int64_t nbytes, void* out) {
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, DoReadAt(position_, nbytes, out));
+    position_ += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, DoReadAt(position_, nbytes));
+    position_ += buffer->size();
+    return buffer;
+  }
+
+  Result<int64_t> DoTell() const {
+    RETURN_NOT_OK(CheckClosed());
+    return position_;
+  }
+
+  Status DoSeek(int64_t position) {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0 || position > size_) {
+      return Status::IOError("Seek out of bounds");
+    }
+    position_ = position;
+    return Status::OK();
+  }
+
+  Result<int64_t> DoGetSize() {
+    RETURN_NOT_OK(CheckClosed());
+    return size_;
+  }
+
+ private:
+  Status CheckClosed() const {
+    if (!is_open_) {
+      return Status::Invalid("Operation forbidden on closed ChunkedBodyReader");
+    }
+    return Status::OK();
+  }
+
+  // Index of the chunk containing the given (in-bounds) position
+  size_t FindChunk(int64_t position) const {
+    auto it = std::upper_bound(chunk_offsets_.begin(), chunk_offsets_.end(), position);
+    return static_cast<size_t>(it - chunk_offsets_.begin()) - 1;
+  }
+
+  void CopyRange(int64_t position, int64_t nbytes, uint8_t* out) const {
+    if (nbytes == 0) {
+      return;
+    }
+    for (size_t i = FindChunk(position); nbytes > 0; ++i) {
+      const int64_t chunk_position = position - chunk_offsets_[i];
+      const int64_t copy_size = std::min(nbytes, chunks_[i]->size() - chunk_position);
+      memcpy(out, chunks_[i]->data() + chunk_position, static_cast<size_t>(copy_size));
+      out += copy_size;
+      position += copy_size;
+      nbytes -= copy_size;
+    }
+  }
+
+  std::vector<std::shared_ptr<Buffer>> chunks_;
+  std::vector<int64_t> chunk_offsets_;
+  int64_t size_;
+  int64_t position_;
+  bool is_open_;
+};
+
+}  // namespace
+
 class Message::MessageImpl {
  public:
   explicit MessageImpl(std::shared_ptr<Buffer> metadata, std::shared_ptr<Buffer> body)
       : metadata_(std::move(metadata)), message_(nullptr), body_(std::move(body)) {}
 
+  MessageImpl(std::shared_ptr<Buffer> metadata,
+              std::vector<std::shared_ptr<Buffer>> body_chunks)
+      : metadata_(std::move(metadata)),
+        message_(nullptr),
+        body_chunks_(std::move(body_chunks)) {}
+
   Status Open() {
     RETURN_NOT_OK(
         internal::VerifyMessage(metadata_->data(), metadata_->size(), &message_));
@@ -98,7 +232,31 @@ class Message::MessageImpl {
 
   int64_t body_length() const { return message_->bodyLength(); }
 
-  std::shared_ptr<Buffer> body() const { return body_; }
+  std::shared_ptr<Buffer> body() const {
+    if (!body_chunks_.empty()) {
+      // Concatenate a chunked body once, on first request
+      std::call_once(body_concatenated_, [this]() {
+        auto maybe_body = ConcatenateBuffers(body_chunks_);
+        if (maybe_body.ok()) {
+          body_ = std::move(maybe_body).ValueOrDie();
+        } else {
+          ARROW_LOG(WARNING) << "Failed to concatenate IPC message body: "
+                             << maybe_body.status().ToString();
+        }
+      });
+    }
+    return body_;
+  }
+
+  Result<std::shared_ptr<io::RandomAccessFile>> GetBodyReader() const {
+    if (!body_chunks_.empty()) {
+      return std::make_shared<ChunkedBodyReader>(body_chunks_);
+    }
+    if (body_ == nullptr) {
+      return nullptr;
+    }
+    return Buffer::GetReader(body_);
+  }
 
   std::shared_ptr<Buffer> metadata() const { return metadata_; }
 
@@ -115,7 +273,12 @@ class Message::MessageImpl {
   std::shared_ptr<const KeyValueMetadata> custom_metadata_;
 
   // The message body, if any
-  std::shared_ptr<Buffer> body_;
+  mutable std::shared_ptr<Buffer> body_;
+
+  // The message body as received in several chunks, if so; body_ is then only
+  // filled in when contiguous memory is requested
+  std::vector<std::shared_ptr<Buffer>> body_chunks_;
+  mutable std::once_flag body_concatenated_;
 };
 
 Message::Message(std::shared_ptr<Buffer> metadata, std::shared_ptr<Buffer> body) {
@@ -129,10 +292,25 @@ Result<std::unique_ptr<Message>> Message::Open(std::shared_ptr<Buffer> metadata,
   return std::move(result);
 }
 
+Result<std::unique_ptr<Message>> Message::Open(
+    std::shared_ptr<Buffer> metadata, std::vector<std::shared_ptr<Buffer>> body_chunks) {
+  if (body_chunks.size() == 1) {
+    return Open(std::move(metadata), std::move(body_chunks[0]));
+  }
+  std::unique_ptr<Message> result(new Message(nullptr, nullptr));
+  result->impl_.reset(new MessageImpl(std::move(metadata), std::move(body_chunks)));
+  RETURN_NOT_OK(result->impl_->Open());
+  return std::move(result);
+}
+
 Message::~Message() {}
 
 std::shared_ptr<Buffer> Message::body() const { return impl_->body(); }
 
+Result<std::shared_ptr<io::RandomAccessFile>> Message::GetBodyReader() const {
+  return impl_->GetBodyReader();
+}
+
 int64_t Message::body_length() const { return impl_->body_length(); }
 
 std::shared_ptr<Buffer> Message::metadata() const { return impl_->metadata(); }
@@ -726,17 +904,24 @@ class MessageDecoder::MessageDecoderImpl {
       buffered_size_ -= used_size;
       return Status::OK();
     } else {
-      ARROW_ASSIGN_OR_RAISE(auto body, AllocateBuffer(next_required_size_, pool_));
-      RETURN_NOT_OK(ConsumeDataChunks(next_required_size_, body->mutable_data()));
-      std::shared_ptr<Buffer> shared_body(body.release());
-      return ConsumeBody(&shared_body);
+      // The body spans several chunks: hand them over as is rather than
+      // reassembling them, so that only Arrow buffers straddling chunk
+      // boundaries get copied when the body is read
+      std::vector<std::shared_ptr<Buffer>> body_chunks;
+      RETURN_NOT_OK(TakeDataChunks(next_required_size_, &body_chunks));
+      ARROW_ASSIGN_OR_RAISE(std::unique_ptr<Message> message,
+                            Message::Open(metadata_, std::move(body_chunks)));
+      return ConsumeMessage(std::move(message));
     }
   }
 
   Status ConsumeBody(std::shared_ptr<Buffer>* buffer) {
     ARROW_ASSIGN_OR_RAISE(std::unique_ptr<Message> message,
                           Message::Open(metadata_, *buffer));
+    return ConsumeMessage(std::move(message));
+  }
 
+  Status ConsumeMessage(std::unique_ptr<Message> message) {
     RETURN_NOT_OK(listener_->OnMessageDecoded(std::move(message)));
     state_ = State::INITIAL;
     next_required_size_ = kMessageDecoderNextRequiredSizeInitial;
@@ -786,6 +971,39 @@ class MessageDecoder::MessageDecoderImpl {
     return Status::OK();
   }
 
+  // Like ConsumeDataChunks, but take (slices of) the buffered chunks instead of
+  // copying them out. Non-CPU chunks are viewed or copied to the CPU.
+  Status TakeDataChunks(int64_t nbytes, std::vector<std::shared_ptr<Buffer>>* out) {
+    int64_t required_size = nbytes;
+    size_t n_used_chunks = 0;
+    std::shared_ptr<Buffer> last_chunk;
+    for (auto& chunk : chunks_) {
+      if (!chunk->is_cpu()) {
+        ARROW_ASSIGN_OR_RAISE(
+            chunk, Buffer::ViewOrCopy(chunk, CPUDevice::memory_manager(pool_)));
+      }
+      const int64_t data_size = chunk->size();
+      const int64_t take_size = std::min(required_size, data_size);
+      n_used_chunks++;
+      required_size -= take_size;
+      if (take_size == data_size) {
+        out->push_back(chunk);
+      } else {
+        out->push_back(SliceBuffer(chunk, 0, take_size));
+        last_chunk = SliceBuffer(chunk, take_size);
+      }
+      if (required_size == 0) {
+        break;
+      }
+    }
+    chunks_.erase(chunks_.begin(), chunks_.begin() + n_used_chunks);
+    if (last_chunk.get() != nullptr) {
+      chunks_.insert(chunks_.begin(), std::move(last_chunk));
+    }
+    buffered_size_ -= nbytes - required_size;
+    return Status::OK();
+  }
+
   std::shared_ptr<MessageDecoderListener> listener_;
   MemoryPool* pool_;
   State state_;
@@ -23,6 +23,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/io/type_fwd.h"
 #include "arrow/ipc/type_fwd.h"
@@ -60,6 +61,19 @@ class ARROW_EXPORT Message {
   static Result<std::unique_ptr<Message>> Open(std::shared_ptr<Buffer> metadata,
                                                std::shared_ptr<Buffer> body);
 
+  /// \brief Create and validate a Message instance whose body is split
+  /// across several buffers
+  ///
+  /// The body chunks are not concatenated up front: GetBodyReader() serves
+  /// reads lying within a single chunk without copying, and body()
+  /// concatenates the chunks on first call only.
+  ///
+  /// \param[in] metadata a buffer containing the Flatbuffer metadata
+  /// \param[in] body_chunks CPU buffers forming the message body, in order
+  /// \return the created message
+  static Result<std::unique_ptr<Message>> Open(
+      std::shared_ptr<Buffer> metadata, std::vector<std::shared_ptr<Buffer>> body_chunks);
+
   /// \brief Read message body and create Message given Flatbuffer metadata
   /// \param[in] metadata containing a serialized Message flatbuffer
   /// \param[in] stream an InputStream
@@ -101,6 +115,14 @@ class ARROW_EXPORT Message {
   /// \return buffer is null if no body
   std::shared_ptr<Buffer> body() const;
 
+  /// \brief Return a reader over the Message body, if any
+  ///
+  /// Prefer this to body() when the message may have been decoded from
+  /// non-contiguous chunks, as it avoids materializing the whole body.
+  ///
+  /// \return reader is null if no body
+  Result<std::shared_ptr<io::RandomAccessFile>> GetBodyReader() const;
+
   /// \brief The expected body length according to the metadata, for
   /// verification purposes
   int64_t body_length() const;
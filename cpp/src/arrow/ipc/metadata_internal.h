@@ -59,6 +59,14 @@ using KVVector = flatbuffers::Vector<KeyValueOffset>;
 // This 0xFFFFFFFF value is the first 4 bytes of a valid IPC message
 constexpr int32_t kIpcContinuationToken = -1;
 
+// Footer custom metadata key holding the comma-separated row counts of the
+// record batches in an IPC file, see IpcWriteOptions::write_record_batch_lengths
+static constexpr const char* kRecordBatchLengthsKey = "ARROW:record_batch_lengths";
+
+// Footer custom metadata key holding the body buffer alignment of an IPC file,
+// when larger than 8, see IpcWriteOptions::body_alignment
+static constexpr const char* kBodyAlignmentKey = "ARROW:body_alignment";
+
 static constexpr flatbuf::MetadataVersion kCurrentMetadataVersion =
     flatbuf::MetadataVersion::V5;
 
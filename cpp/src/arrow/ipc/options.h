@@ -49,6 +49,18 @@ struct ARROW_EXPORT IpcWriteOptions {
   // bytes. Generally 8 or 64
   int32_t alignment = 8;
 
+  /// \brief Alignment, in bytes, of body buffers in record batch and dictionary
+  /// messages
+  ///
+  /// Every body buffer is padded to a multiple of this value, so buffer offsets
+  /// and sizes within a message body are multiples of it. If larger than
+  /// `alignment`, message metadata is padded to it as well, so that message
+  /// bodies start at aligned stream positions, and the IPC file writer records
+  /// the value in the file footer (see RecordBatchFileReader::body_alignment()).
+  /// A page size such as 4096 lets readers load bodies with O_DIRECT or GPUDirect
+  /// Storage. Must be a power of two between 8 and 65536.
+  int32_t body_alignment = 8;
+
   /// \brief Write the pre-0.15.0 encapsulated IPC message format
   /// consisting of a 4-byte prefix instead of 8 byte
   bool write_legacy_ipc_format = false;
@@ -65,6 +77,22 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// like compression
   bool use_threads = true;
 
+  /// \brief Whether to emit dictionary deltas in the IPC stream format
+  ///
+  /// If true, a dictionary that extends the one previously written for the
+  /// same field (i.e. the previous dictionary is a prefix of it) is written as
+  /// a delta batch holding only the new entries, instead of a replacement.
+  /// Readers before 0.15.0 may not support deltas. Ignored for the IPC file
+  /// format, which doesn't allow dictionaries to change.
+  bool emit_dictionary_deltas = false;
+
+  /// \brief Whether the IPC file writer records the row count of every record batch
+  ///
+  /// If true, the lengths are stored in the file footer's custom metadata, so that
+  /// RecordBatchFileReader::ReadRows() can locate a row range without reading the
+  /// metadata of each record batch. Ignored by the IPC stream format.
+  bool write_record_batch_lengths = false;
+
   /// \brief Format version to use for IPC messages and their metadata.
   ///
   /// Presently using V5 version (readable by 1.0.0 and later).
@@ -17,9 +17,11 @@
 
 #include "benchmark/benchmark.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "arrow/api.h"
 #include "arrow/io/memory.h"
@@ -187,10 +189,118 @@ static void DecodeStream(benchmark::State& state) {  // NOLINT non-const referen
   state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
 }
 
+static void DecodeStreamChunked(benchmark::State& state) {  // NOLINT non-const reference
+  // 1MB, arriving as separately allocated 64KB chunks (e.g. network reads)
+  constexpr int64_t kTotalSize = 1 << 20;
+  constexpr int64_t kChunkSize = 1 << 16;
+  auto options = ipc::IpcWriteOptions::Defaults();
+
+  std::shared_ptr<ResizableBuffer> buffer = *AllocateResizableBuffer(1024);
+  auto record_batch = MakeRecordBatch(kTotalSize, state.range(0));
+
+  io::BufferOutputStream stream(buffer);
+
+  auto writer_result = ipc::MakeStreamWriter(&stream, record_batch->schema(), options);
+  ABORT_NOT_OK(writer_result);
+  auto writer = *writer_result;
+  ABORT_NOT_OK(writer->WriteRecordBatch(*record_batch));
+  ABORT_NOT_OK(writer->Close());
+
+  std::vector<std::shared_ptr<Buffer>> chunks;
+  for (int64_t offset = 0; offset < buffer->size(); offset += kChunkSize) {
+    chunks.push_back(
+        *buffer->CopySlice(offset, std::min(kChunkSize, buffer->size() - offset)));
+  }
+
+  while (state.KeepRunning()) {
+    class NullListener : public ipc::Listener {
+      Status OnRecordBatchDecoded(std::shared_ptr<RecordBatch> batch) override {
+        return Status::OK();
+      }
+    } listener;
+    ipc::StreamDecoder decoder(std::shared_ptr<NullListener>(&listener, [](void*) {}),
+                               ipc::IpcReadOptions::Defaults());
+    for (const auto& chunk : chunks) {
+      ABORT_NOT_OK(decoder.Consume(chunk));
+    }
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
+}
+
+// Write a large array as a sequence of sliced batches of state.range(0) rows,
+// as when paginating over a table
+static void WriteSlicedRecordBatches(benchmark::State& state,  // NOLINT non-const ref
+                                     const std::shared_ptr<Array>& array) {
+  const int64_t slice_length = state.range(0);
+  auto options = ipc::IpcWriteOptions::Defaults();
+  auto batch = RecordBatch::Make(schema({field("f0", array->type())}), array->length(),
+                                 {array});
+
+  std::shared_ptr<ResizableBuffer> buffer = *AllocateResizableBuffer(1024);
+  while (state.KeepRunning()) {
+    for (int64_t offset = 0; offset < batch->num_rows(); offset += slice_length) {
+      io::BufferOutputStream stream(buffer);
+      int32_t metadata_length;
+      int64_t body_length;
+      ABORT_NOT_OK(ipc::WriteRecordBatch(*batch->Slice(offset, slice_length), 0, &stream,
+                                         &metadata_length, &body_length, options));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * batch->num_rows());
+}
+
+constexpr int64_t kSlicedLength = 1 << 17;
+
+static void WriteSlicedInt64(benchmark::State& state) {  // NOLINT non-const reference
+  random::RandomArrayGenerator rand(0x4f32a908);
+  WriteSlicedRecordBatches(state, rand.Int64(kSlicedLength, 0, 100, 0.1));
+}
+
+static void WriteSlicedString(benchmark::State& state) {  // NOLINT non-const reference
+  random::RandomArrayGenerator rand(0x4f32a908);
+  WriteSlicedRecordBatches(state, rand.String(kSlicedLength, 0, 16, 0.1));
+}
+
+static void WriteSlicedList(benchmark::State& state) {  // NOLINT non-const reference
+  random::RandomArrayGenerator rand(0x4f32a908);
+  auto values = rand.Int64(kSlicedLength * 4, 0, 100, 0.1);
+  WriteSlicedRecordBatches(state, rand.List(*values, kSlicedLength + 1, 0.1));
+}
+
+static void WriteSlicedStruct(benchmark::State& state) {  // NOLINT non-const reference
+  random::RandomArrayGenerator rand(0x4f32a908);
+  auto array = *StructArray::Make({rand.Int64(kSlicedLength, 0, 100, 0.1),
+                                   rand.String(kSlicedLength, 0, 16, 0.1)},
+                                  std::vector<std::string>{"a", "b"});
+  WriteSlicedRecordBatches(state, array);
+}
+
+static void WriteSlicedDenseUnion(benchmark::State& state) {  // NOLINT non-const ref
+  random::RandomArrayGenerator rand(0x4f32a908);
+  const int64_t length = kSlicedLength;
+  std::vector<int8_t> type_codes(length);
+  std::vector<int32_t> value_offsets(length);
+  for (int64_t i = 0; i < length; ++i) {
+    type_codes[i] = static_cast<int8_t>(i % 2);
+    value_offsets[i] = static_cast<int32_t>(i / 2);
+  }
+  auto array = *DenseUnionArray::Make(
+      Int8Array(length, Buffer::Wrap(type_codes)),
+      Int32Array(length, Buffer::Wrap(value_offsets)),
+      {rand.Int64(length / 2, 0, 100, 0.1), rand.String(length / 2, 0, 16, 0.1)});
+  WriteSlicedRecordBatches(state, array);
+}
+
 BENCHMARK(WriteRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadFile)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadStream)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(DecodeStream)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
+BENCHMARK(DecodeStreamChunked)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
+BENCHMARK(WriteSlicedInt64)->RangeMultiplier(16)->Range(64, 1 << 14);
+BENCHMARK(WriteSlicedString)->RangeMultiplier(16)->Range(64, 1 << 14);
+BENCHMARK(WriteSlicedList)->RangeMultiplier(16)->Range(64, 1 << 14);
+BENCHMARK(WriteSlicedStruct)->RangeMultiplier(16)->Range(64, 1 << 14);
+BENCHMARK(WriteSlicedDenseUnion)->RangeMultiplier(16)->Range(64, 1 << 14);
 
 }  // namespace arrow
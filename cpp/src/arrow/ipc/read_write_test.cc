@@ -19,6 +19,7 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <string>
 #include <unordered_set>
@@ -40,6 +41,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/testing/extension_type.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -210,6 +212,81 @@ TEST_P(TestMessage, LegacyIpcBackwardsCompatibility) {
   ASSERT_TRUE(legacy_message->body()->Equals(*message->body()));
 }
 
+TEST_P(TestMessage, PayloadSegments) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntBatchSized(36, &batch));
+
+  for (bool legacy : {false, true}) {
+    options_.write_legacy_ipc_format = legacy;
+    IpcPayload payload;
+    ASSERT_OK(GetRecordBatchPayload(*batch, options_, &payload));
+
+    ASSERT_OK_AND_ASSIGN(auto stream, io::BufferOutputStream::Create(1 << 20));
+    int32_t metadata_length = -1;
+    ASSERT_OK(WriteIpcPayload(payload, options_, stream.get(), &metadata_length));
+    ASSERT_OK_AND_ASSIGN(auto serialized, stream->Finish());
+
+    std::vector<std::shared_ptr<Buffer>> segments;
+    int32_t segments_metadata_length = -1;
+    ASSERT_OK(GetIpcPayloadSegments(payload, options_, &segments,
+                                    &segments_metadata_length));
+    ASSERT_EQ(metadata_length, segments_metadata_length);
+    ASSERT_OK_AND_ASSIGN(auto concatenated, ConcatenateBuffers(segments));
+    AssertBufferEqual(*serialized, *concatenated);
+
+    // Body buffers are referenced, not copied
+    for (const auto& buffer : payload.body_buffers) {
+      if (buffer == nullptr || buffer->size() == 0) continue;
+      ASSERT_NE(std::find(segments.begin(), segments.end(), buffer), segments.end());
+    }
+  }
+}
+
+TEST(TestMessage, ChunkedBody) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntBatchSized(100, &batch));
+  ASSERT_OK_AND_ASSIGN(auto serialized,
+                       SerializeRecordBatch(*batch, IpcWriteOptions::Defaults()));
+  io::BufferReader stream(serialized);
+  ASSERT_OK_AND_ASSIGN(auto message, ReadMessage(&stream));
+  auto body = message->body();
+  ASSERT_GT(body->size(), 200);
+
+  // Split the body into separately allocated chunks
+  BufferVector chunks;
+  const std::vector<int64_t> boundaries = {0, 100, 101, 200, body->size()};
+  for (size_t i = 0; i + 1 < boundaries.size(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto chunk, body->CopySlice(boundaries[i],
+                                                     boundaries[i + 1] - boundaries[i]));
+    chunks.push_back(std::move(chunk));
+  }
+  ASSERT_OK_AND_ASSIGN(auto chunked, Message::Open(message->metadata(), chunks));
+  ASSERT_EQ(message->body_length(), chunked->body_length());
+
+  ASSERT_OK_AND_ASSIGN(auto reader, chunked->GetBodyReader());
+  ASSERT_OK_AND_EQ(body->size(), reader->GetSize());
+
+  // A range within a chunk is zero-copy
+  ASSERT_OK_AND_ASSIGN(auto slice, reader->ReadAt(110, 50));
+  ASSERT_EQ(chunks[2]->data() + 9, slice->data());
+  AssertBufferEqual(*SliceBuffer(body, 110, 50), *slice);
+
+  // A range straddling chunks is copied
+  ASSERT_OK_AND_ASSIGN(slice, reader->ReadAt(50, 200));
+  AssertBufferEqual(*SliceBuffer(body, 50, 200), *slice);
+  ASSERT_OK_AND_ASSIGN(slice, reader->ReadAt(body->size() - 10, 100));
+  AssertBufferEqual(*SliceBuffer(body, body->size() - 10), *slice);
+  ASSERT_RAISES(IOError, reader->ReadAt(body->size() + 1, 1));
+
+  // Contiguous body is materialized on request
+  ASSERT_TRUE(chunked->Equals(*message));
+  AssertBufferEqual(*body, *chunked->body());
+
+  ASSERT_OK_AND_ASSIGN(auto result, ReadRecordBatch(*chunked, batch->schema(), nullptr,
+                                                    IpcReadOptions::Defaults()));
+  AssertBatchesEqual(*batch, *result);
+}
+
 TEST(TestMessage, Verify) {
   std::string metadata = "invalid";
   std::string body = "abcdef";
@@ -557,8 +634,14 @@ TEST_P(TestIpcRoundTrip, SliceRoundTrip) {
     return;
   }
 
-  auto sliced_batch = batch->Slice(2, 10);
-  CheckRoundtrip(*sliced_batch);
+  // Both a byte-aligned and a non-aligned slice offset
+  for (int64_t offset : {2, 8}) {
+    if (batch->num_rows() <= offset) {
+      continue;
+    }
+    auto sliced_batch = batch->Slice(offset, 10);
+    CheckRoundtrip(*sliced_batch);
+  }
 }
 
 TEST_P(TestIpcRoundTrip, ZeroLengthArrays) {
@@ -731,6 +814,91 @@ TEST_F(TestWriteRecordBatch, SliceTruncatesBuffers) {
   CheckArray(a1);
 }
 
+TEST_F(TestWriteRecordBatch, SliceAtOffsetWritesMinimalBuffers) {
+  auto CheckArray = [this](const std::shared_ptr<Array>& array) {
+    auto f0 = field("f0", array->type());
+    auto schema = ::arrow::schema({f0});
+    auto batch = RecordBatch::Make(schema, array->length(), {array});
+
+    int64_t full_size;
+    ASSERT_OK(GetRecordBatchSize(*batch, &full_size));
+    for (int64_t offset : {8, 101}) {
+      auto sliced_batch = batch->Slice(offset, 5);
+      int64_t sliced_size;
+      ASSERT_OK(GetRecordBatchSize(*sliced_batch, &sliced_size));
+      ASSERT_LT(sliced_size * 10, full_size) << offset << " " << *array->type();
+      this->CheckRoundtrip(*sliced_batch);
+    }
+  };
+
+  std::shared_ptr<Array> a0, a1;
+  auto pool = default_memory_pool();
+
+  ASSERT_OK(MakeRandomInt32Array(5000, true, pool, &a0));
+  CheckArray(a0);
+
+  ASSERT_OK(MakeRandomStringArray(5000, true, pool, &a1));
+  CheckArray(a1);
+
+  ASSERT_OK(MakeRandomBooleanArray(100000, true, &a1));
+  CheckArray(a1);
+
+  ASSERT_OK(MakeRandomListArray(a0, 2000, true, pool, &a1));
+  CheckArray(a1);
+
+  std::vector<std::shared_ptr<Array>> struct_children = {a0};
+  a1 = std::make_shared<StructArray>(struct_({field("f0", a0->type())}), a0->length(),
+                                     struct_children);
+  CheckArray(a1);
+
+  // Dense union referencing its child in order
+  std::vector<int8_t> type_ids(a0->length());
+  std::vector<int32_t> type_offsets(a0->length());
+  std::iota(type_offsets.begin(), type_offsets.end(), 0);
+  std::shared_ptr<Buffer> ids_buffer, offsets_buffer;
+  ASSERT_OK(CopyBufferFromVector(type_ids, pool, &ids_buffer));
+  ASSERT_OK(CopyBufferFromVector(type_offsets, pool, &offsets_buffer));
+  a1 = std::make_shared<DenseUnionArray>(dense_union({field("f0", a0->type())}, {0}),
+                                         a0->length(), struct_children, ids_buffer,
+                                         offsets_buffer);
+  CheckArray(a1);
+}
+
+TEST_F(TestWriteRecordBatch, UnslicedWritesMinimalBuffers) {
+  // Arrays with a zero offset may still reference only part of their
+  // children or value data
+  auto pool = default_memory_pool();
+  std::shared_ptr<Array> values;
+  ASSERT_OK(MakeRandomInt32Array(500, false, pool, &values));
+
+  // Value offsets starting after zero need rebasing
+  std::vector<int32_t> offsets = {300, 302, 302, 310};
+  std::shared_ptr<Buffer> offsets_buffer;
+  ASSERT_OK(CopyBufferFromVector(offsets, pool, &offsets_buffer));
+  auto list_array = std::make_shared<ListArray>(list(int32()), 3, offsets_buffer, values);
+  ASSERT_OK(list_array->ValidateFull());
+
+  // A dense union referencing a single value of its child
+  std::vector<int8_t> type_ids = {0, 0};
+  std::vector<int32_t> type_offsets = {400, 400};
+  std::shared_ptr<Buffer> ids_buffer, type_offsets_buffer;
+  ASSERT_OK(CopyBufferFromVector(type_ids, pool, &ids_buffer));
+  ASSERT_OK(CopyBufferFromVector(type_offsets, pool, &type_offsets_buffer));
+  auto union_array = std::make_shared<DenseUnionArray>(
+      dense_union({field("f0", int32())}, {0}), 2, ArrayVector{values}, ids_buffer,
+      type_offsets_buffer);
+  ASSERT_OK(union_array->ValidateFull());
+
+  for (const auto& array : ArrayVector{list_array, union_array}) {
+    auto batch = RecordBatch::Make(::arrow::schema({field("f0", array->type())}),
+                                   array->length(), {array});
+    int64_t size;
+    ASSERT_OK(GetRecordBatchSize(*batch, &size));
+    ASSERT_LT(size, 300) << *array->type();
+    CheckRoundtrip(*batch);
+  }
+}
+
 TEST_F(TestWriteRecordBatch, RoundtripPreservesBufferSizes) {
   // ARROW-7975
   random::RandomArrayGenerator rg(/*seed=*/0);
@@ -1632,6 +1800,221 @@ TEST(TestRecordBatchStreamReader, EmptyStreamWithDictionaries) {
   ASSERT_EQ(nullptr, batch);
 }
 
+TEST(TestRecordBatchFileReader, ReadFieldSubsetPerBatch) {
+  auto a0 = ArrayFromJSON(int32(), "[1, 2, null]");
+  auto a1 = ArrayFromJSON(utf8(), "[\"a\", null, \"c\"]");
+  auto a2 = ArrayFromJSON(float64(), "[null, 0.5, 1.5]");
+  auto my_schema = schema({field("a0", int32()), field("a1", utf8()),
+                           field("a2", float64())},
+                          key_value_metadata({"key1"}, {"value1"}));
+  auto batch = RecordBatch::Make(my_schema, a0->length(), {a0, a1, a2});
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink, my_schema));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  // The selection passed to ReadRecordBatch is independent of included_fields
+  auto options = IpcReadOptions::Defaults();
+  options.included_fields = {0};
+  auto source = std::make_shared<io::BufferReader>(buffer);
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(source, options));
+  ASSERT_EQ(2, reader->num_record_batches());
+
+  ASSERT_OK_AND_ASSIGN(auto out, reader->ReadRecordBatch(1, {2, 0}));
+  auto ex_schema = schema({field("a0", int32()), field("a2", float64())},
+                          key_value_metadata({"key1"}, {"value1"}));
+  AssertBatchesEqual(*RecordBatch::Make(ex_schema, a0->length(), {a0, a2}), *out,
+                     /*check_metadata=*/true);
+  const int64_t num_messages = reader->stats().num_messages;
+
+  // Metadata of a batch already read is not read again from a zero-copy source
+  ASSERT_OK_AND_ASSIGN(out, reader->ReadRecordBatch(1, {1}));
+  AssertBatchesEqual(*RecordBatch::Make(schema({my_schema->field(1)}), 3, {a1}), *out);
+  ASSERT_OK_AND_ASSIGN(out, reader->ReadRecordBatch(1));
+  AssertBatchesEqual(*RecordBatch::Make(schema({my_schema->field(0)}), 3, {a0}), *out);
+  ASSERT_OK_AND_ASSIGN(out, reader->ReadRecordBatch(1, {}));
+  AssertBatchesEqual(*batch, *out);
+  ASSERT_EQ(num_messages, reader->stats().num_messages);
+  ASSERT_EQ(4, reader->stats().num_record_batches);
+
+  ASSERT_OK_AND_ASSIGN(out, reader->ReadRecordBatch(0, {1, 2}));
+  ASSERT_EQ(num_messages + 1, reader->stats().num_messages);
+
+  ASSERT_RAISES(Invalid, reader->ReadRecordBatch(0, {3}));
+}
+
+TEST(TestRecordBatchFileReader, WideBatchParallelLoad) {
+  // Enough fields of various layouts for the fields to be loaded in parallel
+  constexpr int kNumColumns = 200;
+  constexpr int64_t kLength = 50;
+  random::RandomArrayGenerator rng(42);
+  FieldVector fields;
+  ArrayVector columns;
+  for (int i = 0; i < kNumColumns; ++i) {
+    std::shared_ptr<Array> column;
+    switch (i % 4) {
+      case 0:
+        column = rng.Int32(kLength, 0, 100, /*null_probability=*/0.1);
+        break;
+      case 1:
+        column = rng.String(kLength, 0, 10, /*null_probability=*/0.1);
+        break;
+      case 2:
+        // The size is that of the offsets buffer
+        column = rng.List(*rng.Int32(kLength * 3, 0, 100), kLength + 1,
+                          /*null_probability=*/0.1);
+        break;
+      default: {
+        ArrayVector children = {rng.Int32(kLength, 0, 100), rng.String(kLength, 0, 5)};
+        ASSERT_OK_AND_ASSIGN(
+            column, StructArray::Make(children, std::vector<std::string>{"a", "b"}));
+      } break;
+    }
+    fields.push_back(field("f" + std::to_string(i), column->type()));
+    columns.push_back(std::move(column));
+  }
+  auto batch = RecordBatch::Make(schema(fields), kLength, columns);
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink, batch->schema()));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  std::vector<int> even_fields;
+  FieldVector subset_fields;
+  ArrayVector subset_columns;
+  for (int i = 0; i < kNumColumns; i += 2) {
+    even_fields.push_back(i);
+    subset_fields.push_back(fields[i]);
+    subset_columns.push_back(columns[i]);
+  }
+  auto expected_subset =
+      RecordBatch::Make(schema(subset_fields), kLength, subset_columns);
+
+  for (bool use_threads : {false, true}) {
+    auto options = IpcReadOptions::Defaults();
+    options.use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(auto reader,
+                         RecordBatchFileReader::Open(
+                             std::make_shared<io::BufferReader>(buffer), options));
+    ASSERT_OK_AND_ASSIGN(auto read_batch, reader->ReadRecordBatch(0));
+    ASSERT_OK(read_batch->ValidateFull());
+    AssertBatchesEqual(*batch, *read_batch);
+
+    ASSERT_OK_AND_ASSIGN(read_batch, reader->ReadRecordBatch(0, even_fields));
+    ASSERT_OK(read_batch->ValidateFull());
+    AssertBatchesEqual(*expected_subset, *read_batch);
+  }
+}
+
+TEST(TestRecordBatchFileReader, BodyAlignment) {
+  constexpr int32_t kAlignment = 4096;
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeStringTypesRecordBatch(&batch));
+  batch = batch->ReplaceSchemaMetadata(nullptr);
+
+  auto options = IpcWriteOptions::Defaults();
+  options.body_alignment = kAlignment;
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink, batch->schema(), options));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  auto source = std::make_shared<io::BufferReader>(buffer);
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(source));
+  ASSERT_EQ(kAlignment, reader->body_alignment());
+  // The alignment is not exposed as user metadata
+  ASSERT_EQ(nullptr, reader->metadata());
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto read_batch, reader->ReadRecordBatch(i));
+    ASSERT_OK(read_batch->ValidateFull());
+    AssertBatchesEqual(*batch, *read_batch);
+  }
+
+  // The messages following the file magic start, and have their bodies start, at
+  // aligned offsets
+  io::BufferReader stream(SliceBuffer(buffer, kAlignment));
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto message, ReadMessage(&stream));
+    ASSERT_OK_AND_ASSIGN(int64_t position, stream.Tell());
+    ASSERT_EQ(0, position % kAlignment);
+    ASSERT_EQ(0, message->body_length() % kAlignment);
+  }
+
+  // Files written with the default alignment report it
+  ASSERT_OK_AND_ASSIGN(sink, io::BufferOutputStream::Create(0));
+  ASSERT_OK_AND_ASSIGN(writer, MakeFileWriter(sink, batch->schema()));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(buffer, sink->Finish());
+  ASSERT_OK_AND_ASSIGN(reader, RecordBatchFileReader::Open(
+                                   std::make_shared<io::BufferReader>(buffer)));
+  ASSERT_EQ(8, reader->body_alignment());
+
+  options.body_alignment = 12;
+  ASSERT_RAISES(Invalid, MakeFileWriter(sink, batch->schema(), options));
+  ASSERT_RAISES(Invalid, SerializeRecordBatch(*batch, options));
+}
+
+TEST(TestRecordBatchFileReader, ReadRows) {
+  BatchVector batches(4);
+  ASSERT_OK(MakeIntBatchSized(10, &batches[0]));
+  ASSERT_OK(MakeIntBatchSized(0, &batches[1]));
+  ASSERT_OK(MakeIntBatchSized(5, &batches[2]));
+  ASSERT_OK(MakeIntBatchSized(7, &batches[3]));
+  for (auto& batch : batches) {
+    batch = batch->ReplaceSchemaMetadata(nullptr);
+  }
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches(batches));
+  ASSERT_OK_AND_ASSIGN(expected, expected->CombineChunks());
+  auto footer_metadata = key_value_metadata({"key"}, {"value"});
+
+  for (bool write_lengths : {false, true}) {
+    auto options = IpcWriteOptions::Defaults();
+    options.write_record_batch_lengths = write_lengths;
+    ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+    ASSERT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink, batches[0]->schema(),
+                                                     options, footer_metadata));
+    for (const auto& batch : batches) {
+      ASSERT_OK(writer->WriteRecordBatch(*batch));
+    }
+    ASSERT_OK(writer->Close());
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    auto source = std::make_shared<io::BufferReader>(buffer);
+    ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(source));
+    // The lengths are not exposed as user metadata
+    ASSERT_TRUE(reader->metadata()->Equals(*footer_metadata));
+
+    for (const auto& range : std::vector<std::pair<int64_t, int64_t>>{
+             {0, 22}, {0, 10}, {3, 4}, {8, 5}, {10, 5}, {12, 10}, {21, 1}, {22, 0}}) {
+      ASSERT_OK_AND_ASSIGN(auto table, reader->ReadRows(range.first, range.second));
+      ASSERT_OK(table->ValidateFull());
+      AssertTablesEqual(*expected->Slice(range.first, range.second), *table,
+                        /*same_chunk_layout=*/false);
+    }
+    // Only the batches overlapping each range are read
+    ASSERT_EQ(reader->stats().num_record_batches, 11);
+    if (write_lengths) {
+      // Schema plus the non-empty batches (whose messages are then cached)
+      ASSERT_EQ(reader->stats().num_messages, 4);
+    } else {
+      // The metadata of all batches is read once to find their lengths
+      ASSERT_EQ(reader->stats().num_messages, 8);
+    }
+
+    ASSERT_RAISES(IndexError, reader->ReadRows(-1, 2));
+    ASSERT_RAISES(IndexError, reader->ReadRows(20, 3));
+    ASSERT_RAISES(IndexError, reader->ReadRows(0, -1));
+  }
+}
+
 // Delimit IPC stream messages and reassemble with the indicated messages
 // included. This way we can remove messages from an IPC stream to test
 // different failure modes or other difficult-to-test behaviors
@@ -1732,6 +2115,36 @@ TEST(TestStreamDecoder, NextRequiredSize) {
   ASSERT_EQ(next_required_size - 1, decoder.next_required_size());
 }
 
+TEST(TestStreamDecoder, NonContiguousChunks) {
+  // Feed the stream as separately allocated chunks that don't line up with
+  // message or Arrow buffer boundaries
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeStringTypesRecordBatch(&batch));
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeStreamWriter(sink.get(), batch->schema()));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto stream, sink->Finish());
+
+  for (int64_t chunk_size : {7, 100, 1000}) {
+    auto listener = std::make_shared<CollectListener>();
+    StreamDecoder decoder(listener);
+    for (int64_t offset = 0; offset < stream->size(); offset += chunk_size) {
+      ASSERT_OK_AND_ASSIGN(
+          auto chunk,
+          stream->CopySlice(offset, std::min(chunk_size, stream->size() - offset)));
+      ASSERT_OK(decoder.Consume(std::move(chunk)));
+    }
+    auto batches = listener->record_batches();
+    ASSERT_EQ(2, batches.size());
+    for (const auto& decoded : batches) {
+      ASSERT_OK(decoded->ValidateFull());
+      AssertBatchesEqual(*batch, *decoded);
+    }
+  }
+}
+
 template <typename WriterHelperType>
 class TestDictionaryReplacement : public ::testing::Test {
  public:
@@ -1823,6 +2236,36 @@ class TestDictionaryReplacement : public ::testing::Test {
     EXPECT_EQ(read_stats_.num_dictionary_deltas, 0);
   }
 
+  void TestDictionaryDeltas() {
+    auto type = dictionary(int8(), utf8());
+    auto batch1 = MakeBatch(type, ArrayFromJSON(int8(), "[0, 1, null]"),
+                            ArrayFromJSON(utf8(), R"(["foo", "bar"])"));
+    auto batch2 = MakeBatch(type, ArrayFromJSON(int8(), "[2, 0, 3]"),
+                            ArrayFromJSON(utf8(), R"(["foo", "bar", "quux", "zzz"])"));
+    auto batch3 =
+        MakeBatch(type, ArrayFromJSON(int8(), "[1, 4, 4]"),
+                  ArrayFromJSON(utf8(), R"(["foo", "bar", "quux", "zzz", "xyz"])"));
+    write_options_.emit_dictionary_deltas = true;
+    if (WriterHelper::kIsFileFormat) {
+      CheckWritingFails({batch1, batch2}, 1);
+      return;
+    }
+    CheckRoundtrip({batch1, batch2, batch3});
+
+    EXPECT_EQ(read_stats_.num_messages, 7);  // including schema message
+    EXPECT_EQ(read_stats_.num_record_batches, 3);
+    EXPECT_EQ(read_stats_.num_dictionary_batches, 3);
+    EXPECT_EQ(read_stats_.num_replaced_dictionaries, 0);
+    EXPECT_EQ(read_stats_.num_dictionary_deltas, 2);
+
+    // Dictionaries not extending the previous one are still replaced
+    CheckRoundtrip(DifferentValuesDictBatches());
+
+    EXPECT_EQ(read_stats_.num_dictionary_batches, 2);
+    EXPECT_EQ(read_stats_.num_replaced_dictionaries, 1);
+    EXPECT_EQ(read_stats_.num_dictionary_deltas, 0);
+  }
+
   Status RoundTrip(const BatchVector& in_batches, BatchVector* out_batches) {
     WriterHelper writer_helper;
     RETURN_NOT_OK(writer_helper.Init(in_batches[0]->schema(), write_options_));
@@ -1942,9 +2385,13 @@ TYPED_TEST_P(TestDictionaryReplacement, DifferentDictValuesNested) {
   this->TestDifferentDictValuesNested();
 }
 
+TYPED_TEST_P(TestDictionaryReplacement, DictionaryDeltas) {
+  this->TestDictionaryDeltas();
+}
+
 REGISTER_TYPED_TEST_SUITE_P(TestDictionaryReplacement, SameDictPointer, SameDictValues,
                             SameDictValuesNested, DifferentDictValues,
-                            DifferentDictValuesNested);
+                            DifferentDictValuesNested, DictionaryDeltas);
 
 using DictionaryReplacementTestTypes =
     ::testing::Types<StreamWriterHelper, FileWriterHelper>;
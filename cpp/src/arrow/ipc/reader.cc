@@ -40,6 +40,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
@@ -49,7 +50,9 @@
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/ubsan.h"
+#include "arrow/util/value_parsing.h"
 #include "arrow/visitor_inline.h"
 
 #include "generated/File_generated.h"  // IWYU pragma: export
@@ -94,6 +97,18 @@ Status InvalidMessageType(MessageType expected, MessageType actual) {
     }                                                                 \
   } while (0)
 
+// Return a reader over the body of a message that must have one. Unlike
+// Buffer::GetReader(message.body()), this doesn't concatenate a body that was
+// decoded from non-contiguous chunks.
+Result<std::shared_ptr<io::RandomAccessFile>> GetBodyReader(const Message& message) {
+  ARROW_ASSIGN_OR_RAISE(auto reader, message.GetBodyReader());
+  if (reader == nullptr) {
+    return Status::IOError("Expected body in IPC message of type ",
+                           FormatMessageType(message.type()));
+  }
+  return reader;
+}
+
 #define CHECK_HAS_NO_BODY(message)                                      \
   do {                                                                  \
     if ((message).body_length() != 0) {                                 \
@@ -158,6 +173,17 @@ class ArrayLoader {
     return status;
   }
 
+  // The field node and buffer the next Load() or SkipField() starts from
+  int field_index() const { return field_index_; }
+  int buffer_index() const { return buffer_index_; }
+
+  // Move to a field found by an earlier walk of the metadata, so that
+  // top-level fields can be loaded independently of the ones preceding them
+  void SetPosition(int field_index, int buffer_index) {
+    field_index_ = field_index;
+    buffer_index_ = buffer_index;
+  }
+
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
     auto buffers = metadata_->buffers();
     CHECK_FLATBUFFERS_NOT_NULL(buffers, "RecordBatch.buffers");
@@ -424,6 +450,17 @@ Status DecompressBuffers(Compression::type compression, const IpcReadOptions& op
 
   // Flatten all buffers
   auto buffers = BufferAccumulator{}.Get(*fields);
+  if (options.use_threads) {
+    // Schedule the largest buffers first so that a few big columns don't end up
+    // decompressing serially after all the small buffers are done
+    using BufferPtr = std::shared_ptr<Buffer>*;
+    auto buffer_size = [](BufferPtr buffer) -> int64_t {
+      return *buffer ? (*buffer)->size() : 0;
+    };
+    std::stable_sort(buffers.begin(), buffers.end(), [&](BufferPtr l, BufferPtr r) {
+      return buffer_size(l) > buffer_size(r);
+    });
+  }
 
   std::unique_ptr<util::Codec> codec;
   ARROW_ASSIGN_OR_RAISE(codec, util::Codec::Create(compression));
@@ -436,36 +473,98 @@ Status DecompressBuffers(Compression::type compression, const IpcReadOptions& op
       });
 }
 
+// Zero-copy loading of a top-level field is cheap, so only batches with at
+// least this many fields to load are worth loading on several threads
+constexpr int kMinFieldsForParallelLoad = 64;
+
+// Load the given top-level fields, one task per contiguous group of fields
+Status LoadFieldsInParallel(const flatbuf::RecordBatch* metadata,
+                            const std::shared_ptr<Schema>& schema,
+                            const std::vector<int>& field_indices,
+                            const IpcReadOptions& options,
+                            MetadataVersion metadata_version, io::RandomAccessFile* file,
+                            ArrayDataVector* columns) {
+  // Walk the metadata once, without I/O, to find the field node and buffer
+  // each field to load starts from
+  ArrayLoader loader(metadata, metadata_version, options, file);
+  std::vector<std::pair<int, int>> positions;
+  positions.reserve(field_indices.size());
+  for (int i = 0, j = 0; i < schema->num_fields(); ++i) {
+    if (j < static_cast<int>(field_indices.size()) && field_indices[j] == i) {
+      positions.emplace_back(loader.field_index(), loader.buffer_index());
+      ++j;
+    }
+    RETURN_NOT_OK(loader.SkipField(schema->field(i).get()));
+  }
+
+  const int num_fields = static_cast<int>(field_indices.size());
+  const int num_tasks = std::min(num_fields, 4 * GetCpuThreadPoolCapacity());
+  return ::arrow::internal::ParallelFor(num_tasks, [&](int task) {
+    ArrayLoader task_loader(metadata, metadata_version, options, file);
+    const int begin =
+        static_cast<int>(static_cast<int64_t>(num_fields) * task / num_tasks);
+    const int end =
+        static_cast<int>(static_cast<int64_t>(num_fields) * (task + 1) / num_tasks);
+    for (int j = begin; j < end; ++j) {
+      const int i = field_indices[j];
+      auto column = std::make_shared<ArrayData>();
+      task_loader.SetPosition(positions[j].first, positions[j].second);
+      RETURN_NOT_OK(task_loader.Load(schema->field(i).get(), column.get()));
+      if (metadata->length() != column->length) {
+        return Status::IOError("Array length did not match record batch length");
+      }
+      (*columns)[i] = std::move(column);
+    }
+    return Status::OK();
+  });
+}
+
 Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
     const flatbuf::RecordBatch* metadata, const std::shared_ptr<Schema>& schema,
     const std::vector<bool>* inclusion_mask, const DictionaryMemo* dictionary_memo,
     const IpcReadOptions& options, MetadataVersion metadata_version,
     Compression::type compression, io::RandomAccessFile* file) {
-  ArrayLoader loader(metadata, metadata_version, options, file);
-
   ArrayDataVector columns(schema->num_fields());
   ArrayDataVector filtered_columns;
   FieldVector filtered_fields;
   std::shared_ptr<Schema> filtered_schema;
 
+  std::vector<int> field_indices;
   for (int i = 0; i < schema->num_fields(); ++i) {
-    const Field& field = *schema->field(i);
     if (!inclusion_mask || (*inclusion_mask)[i]) {
-      // Read field
-      auto column = std::make_shared<ArrayData>();
-      RETURN_NOT_OK(loader.Load(&field, column.get()));
-      if (metadata->length() != column->length) {
-        return Status::IOError("Array length did not match record batch length");
-      }
-      columns[i] = std::move(column);
-      if (inclusion_mask) {
-        filtered_columns.push_back(columns[i]);
-        filtered_fields.push_back(schema->field(i));
+      field_indices.push_back(i);
+    }
+  }
+
+  const int num_fields = static_cast<int>(field_indices.size());
+  if (options.use_threads && num_fields > 1 &&
+      (num_fields >= kMinFieldsForParallelLoad || !file->supports_zero_copy())) {
+    RETURN_NOT_OK(LoadFieldsInParallel(metadata, schema, field_indices, options,
+                                       metadata_version, file, &columns));
+  } else {
+    ArrayLoader loader(metadata, metadata_version, options, file);
+    for (int i = 0; i < schema->num_fields(); ++i) {
+      const Field& field = *schema->field(i);
+      if (!inclusion_mask || (*inclusion_mask)[i]) {
+        // Read field
+        auto column = std::make_shared<ArrayData>();
+        RETURN_NOT_OK(loader.Load(&field, column.get()));
+        if (metadata->length() != column->length) {
+          return Status::IOError("Array length did not match record batch length");
+        }
+        columns[i] = std::move(column);
+      } else {
+        // Skip field. This logic must be executed to advance the state of the
+        // loader to the next field
+        RETURN_NOT_OK(loader.SkipField(&field));
       }
-    } else {
-      // Skip field. This logic must be executed to advance the state of the
-      // loader to the next field
-      RETURN_NOT_OK(loader.SkipField(&field));
+    }
+  }
+
+  if (inclusion_mask) {
+    for (int i : field_indices) {
+      filtered_columns.push_back(columns[i]);
+      filtered_fields.push_back(schema->field(i));
     }
   }
 
@@ -557,8 +656,7 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
     const IpcReadOptions& options, io::InputStream* file) {
   std::unique_ptr<Message> message;
   RETURN_NOT_OK(ReadContiguousPayload(file, &message));
-  CHECK_HAS_BODY(*message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, GetBodyReader(*message));
   return ReadRecordBatch(*message->metadata(), schema, dictionary_memo, options,
                          reader.get());
 }
@@ -567,18 +665,17 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
     const Message& message, const std::shared_ptr<Schema>& schema,
     const DictionaryMemo* dictionary_memo, const IpcReadOptions& options) {
   CHECK_MESSAGE_TYPE(MessageType::RECORD_BATCH, message.type());
-  CHECK_HAS_BODY(message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message.body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, GetBodyReader(message));
   return ReadRecordBatch(*message.metadata(), schema, dictionary_memo, options,
                          reader.get());
 }
 
-Result<std::shared_ptr<RecordBatch>> ReadRecordBatchInternal(
-    const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+// Load a record batch from flatbuffer-encoded Message metadata that has already
+// been verified
+Result<std::shared_ptr<RecordBatch>> LoadRecordBatchFromMessage(
+    const flatbuf::Message* message, const std::shared_ptr<Schema>& schema,
     const std::vector<bool>& inclusion_mask, const DictionaryMemo* dictionary_memo,
     const IpcReadOptions& options, io::RandomAccessFile* file) {
-  const flatbuf::Message* message = nullptr;
-  RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
   auto batch = message->header_as_RecordBatch();
   if (batch == nullptr) {
     return Status::IOError(
@@ -598,6 +695,16 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatchInternal(
                          file);
 }
 
+Result<std::shared_ptr<RecordBatch>> ReadRecordBatchInternal(
+    const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+    const std::vector<bool>& inclusion_mask, const DictionaryMemo* dictionary_memo,
+    const IpcReadOptions& options, io::RandomAccessFile* file) {
+  const flatbuf::Message* message = nullptr;
+  RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
+  return LoadRecordBatchFromMessage(message, schema, inclusion_mask, dictionary_memo,
+                                    options, file);
+}
+
 // If we are selecting only certain fields, populate an inclusion mask for fast lookups.
 // Additionally, drop deselected fields from the reader's schema.
 Status GetInclusionMaskAndOutSchema(const std::shared_ptr<Schema>& full_schema,
@@ -731,8 +838,7 @@ Status ReadDictionary(const Message& message, DictionaryMemo* dictionary_memo,
                       const IpcReadOptions& options, DictionaryKind* kind) {
   // Only invoke this method if we already know we have a dictionary message
   DCHECK_EQ(message.type(), MessageType::DICTIONARY_BATCH);
-  CHECK_HAS_BODY(message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message.body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, GetBodyReader(message));
   return ReadDictionary(*message.metadata(), dictionary_memo, options, kind,
                         reader.get());
 }
@@ -784,8 +890,7 @@ class RecordBatchStreamReaderImpl : public RecordBatchStreamReader {
       return Status::OK();
     }
 
-    CHECK_HAS_BODY(*message);
-    ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+    ARROW_ASSIGN_OR_RAISE(auto reader, GetBodyReader(*message));
     return ReadRecordBatchInternal(*message->metadata(), schema_, field_inclusion_mask_,
                                    &dictionary_memo_, options_, reader.get())
         .Value(batch);
@@ -927,24 +1032,50 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   }
 
   Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(int i) override {
-    DCHECK_GE(i, 0);
-    DCHECK_LT(i, num_record_batches());
+    return ReadRecordBatchWithMask(i, field_inclusion_mask_);
+  }
 
-    if (!read_dictionaries_) {
-      RETURN_NOT_OK(ReadDictionaries());
-      read_dictionaries_ = true;
-    }
+  Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
+      int i, const std::vector<int>& field_indices) override {
+    std::vector<bool> inclusion_mask;
+    std::shared_ptr<Schema> out_schema;
+    RETURN_NOT_OK(GetInclusionMaskAndOutSchema(schema_, field_indices, &inclusion_mask,
+                                               &out_schema));
+    return ReadRecordBatchWithMask(i, inclusion_mask);
+  }
 
-    ARROW_ASSIGN_OR_RAISE(auto message, ReadMessageFromBlock(GetRecordBatchBlock(i)));
+  Result<std::shared_ptr<Table>> ReadRows(int64_t offset, int64_t length) override {
+    RETURN_NOT_OK(EnsureRowOffsets());
+    const int64_t num_rows = row_offsets_.back();
+    if (offset < 0 || length < 0 || offset > num_rows - length) {
+      return Status::IndexError("Row range [", offset, ", ", offset + length,
+                                ") out of bounds for IPC file with ", num_rows,
+                                " rows");
+    }
 
-    CHECK_HAS_BODY(*message);
-    ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
-    ARROW_ASSIGN_OR_RAISE(
-        auto batch,
-        ReadRecordBatchInternal(*message->metadata(), schema_, field_inclusion_mask_,
-                                &dictionary_memo_, options_, reader.get()));
-    ++stats_.num_record_batches;
-    return batch;
+    // Last batch starting at or before `offset`, i.e. the one containing it
+    int i = static_cast<int>(
+        std::upper_bound(row_offsets_.begin(), row_offsets_.end(), offset) -
+        row_offsets_.begin() - 1);
+    const int64_t end = offset + length;
+    RecordBatchVector batches;
+    for (; i < num_record_batches() && row_offsets_[i] < end; ++i) {
+      const int64_t batch_length = row_offsets_[i + 1] - row_offsets_[i];
+      if (batch_length == 0) continue;
+
+      ARROW_ASSIGN_OR_RAISE(auto batch, ReadRecordBatch(i));
+      if (batch->num_rows() != batch_length) {
+        return Status::IOError("Record batch ", i, " has ", batch->num_rows(),
+                               " rows but the file footer indicates ", batch_length);
+      }
+      const int64_t start = std::max(offset, row_offsets_[i]) - row_offsets_[i];
+      const int64_t stop = std::min(end, row_offsets_[i + 1]) - row_offsets_[i];
+      if (start > 0 || stop < batch_length) {
+        batch = batch->Slice(start, stop - start);
+      }
+      batches.push_back(std::move(batch));
+    }
+    return Table::FromRecordBatches(out_schema_, std::move(batches));
   }
 
   Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset,
@@ -971,6 +1102,8 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
 
   std::shared_ptr<const KeyValueMetadata> metadata() const override { return metadata_; }
 
+  int32_t body_alignment() const override { return body_alignment_; }
+
   ReadStats stats() const override { return stats_; }
 
  private:
@@ -982,6 +1115,165 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return FileBlockFromFlatbuffer(footer_->dictionaries()->Get(i));
   }
 
+  // A parsed and verified record batch message. When the file supports
+  // zero-copy, the body only references the file's memory, so these are kept
+  // around to make repeated random access to a batch cheap.
+  struct RecordBatchMessage {
+    std::shared_ptr<Message> message;
+    const flatbuf::Message* metadata;
+  };
+
+  Result<std::shared_ptr<RecordBatch>> ReadRecordBatchWithMask(
+      int i, const std::vector<bool>& inclusion_mask) {
+    DCHECK_GE(i, 0);
+    DCHECK_LT(i, num_record_batches());
+
+    if (!read_dictionaries_) {
+      RETURN_NOT_OK(ReadDictionaries());
+      read_dictionaries_ = true;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(RecordBatchMessage batch_message, GetRecordBatchMessage(i));
+    ARROW_ASSIGN_OR_RAISE(auto reader,
+                          Buffer::GetReader(batch_message.message->body()));
+    ARROW_ASSIGN_OR_RAISE(
+        auto batch,
+        LoadRecordBatchFromMessage(batch_message.metadata, schema_, inclusion_mask,
+                                   &dictionary_memo_, options_, reader.get()));
+    ++stats_.num_record_batches;
+    return batch;
+  }
+
+  Result<RecordBatchMessage> GetRecordBatchMessage(int i) {
+    if (!record_batch_messages_.empty() && record_batch_messages_[i].message) {
+      return record_batch_messages_[i];
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto message, ReadMessageFromBlock(GetRecordBatchBlock(i)));
+    CHECK_HAS_BODY(*message);
+
+    RecordBatchMessage batch_message;
+    const Buffer& metadata = *message->metadata();
+    RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(),
+                                          &batch_message.metadata));
+    batch_message.message = std::move(message);
+
+    if (file_->supports_zero_copy()) {
+      if (record_batch_messages_.empty()) {
+        record_batch_messages_.resize(num_record_batches());
+      }
+      record_batch_messages_[i] = batch_message;
+    }
+    return batch_message;
+  }
+
+  // Compute the first row of each record batch (plus the total row count)
+  Status EnsureRowOffsets() {
+    if (!row_offsets_.empty()) {
+      return Status::OK();
+    }
+    std::vector<int64_t> row_offsets(1, 0);
+    row_offsets.reserve(num_record_batches() + 1);
+    for (int i = 0; i < num_record_batches(); ++i) {
+      int64_t length;
+      if (footer_batch_lengths_.empty()) {
+        ARROW_ASSIGN_OR_RAISE(length, ReadRecordBatchLength(GetRecordBatchBlock(i)));
+      } else {
+        length = footer_batch_lengths_[i];
+      }
+      row_offsets.push_back(row_offsets.back() + length);
+    }
+    row_offsets_ = std::move(row_offsets);
+    return Status::OK();
+  }
+
+  // Read the row count of a record batch from its metadata, leaving the body alone
+  Result<int64_t> ReadRecordBatchLength(const FileBlock& block) {
+    if (block.metadata_length < 8) {
+      return Status::Invalid("Invalid record batch metadata length in IPC file: ",
+                             block.metadata_length);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto metadata,
+                          file_->ReadAt(block.offset, block.metadata_length));
+    if (metadata->size() < block.metadata_length) {
+      return Status::IOError("Expected to read ", block.metadata_length,
+                             " metadata bytes but got ", metadata->size());
+    }
+    // Skip the continuation token (if any) and the flatbuffer size prefix
+    int64_t prefix_size = sizeof(int32_t);
+    if (util::SafeLoadAs<int32_t>(metadata->data()) == internal::kIpcContinuationToken) {
+      prefix_size += sizeof(int32_t);
+    }
+    const flatbuf::Message* message = nullptr;
+    RETURN_NOT_OK(internal::VerifyMessage(metadata->data() + prefix_size,
+                                          metadata->size() - prefix_size, &message));
+    auto batch = message->header_as_RecordBatch();
+    if (batch == nullptr) {
+      return Status::IOError(
+          "Header-type of flatbuffer-encoded Message is not RecordBatch.");
+    }
+    ++stats_.num_messages;
+    return batch->length();
+  }
+
+  // Parse the record batch lengths stored by the writer in the footer metadata,
+  // removing them from the metadata exposed to users
+  Status ParseFooterBatchLengths(std::shared_ptr<KeyValueMetadata>* metadata) {
+    const int index = (*metadata)->FindKey(internal::kRecordBatchLengthsKey);
+    if (index == -1) {
+      return Status::OK();
+    }
+    const std::string value = (*metadata)->value(index);
+    std::vector<int64_t> lengths;
+    for (size_t start = 0; start < value.size();) {
+      size_t stop = value.find(',', start);
+      if (stop == std::string::npos) stop = value.size();
+      int64_t length;
+      if (!::arrow::internal::ParseValue<Int64Type>(value.data() + start, stop - start,
+                                                    &length) ||
+          length < 0) {
+        return Status::IOError("Invalid record batch lengths in IPC file footer");
+      }
+      lengths.push_back(length);
+      start = stop + 1;
+    }
+    if (static_cast<int>(lengths.size()) != num_record_batches()) {
+      return Status::IOError("IPC file footer has ", lengths.size(),
+                             " record batch lengths for ", num_record_batches(),
+                             " record batches");
+    }
+    footer_batch_lengths_ = std::move(lengths);
+    return RemoveFooterKey(index, metadata);
+  }
+
+  // Parse the body alignment stored by the writer in the footer metadata,
+  // removing it from the metadata exposed to users
+  Status ParseFooterBodyAlignment(std::shared_ptr<KeyValueMetadata>* metadata) {
+    const int index = (*metadata)->FindKey(internal::kBodyAlignmentKey);
+    if (index == -1) {
+      return Status::OK();
+    }
+    const std::string value = (*metadata)->value(index);
+    int32_t alignment;
+    if (!::arrow::internal::ParseValue<Int32Type>(value.data(), value.size(),
+                                                  &alignment) ||
+        alignment < kArrowIpcAlignment ||
+        !BitUtil::IsPowerOf2(static_cast<int64_t>(alignment))) {
+      return Status::IOError("Invalid body alignment in IPC file footer");
+    }
+    body_alignment_ = alignment;
+    return RemoveFooterKey(index, metadata);
+  }
+
+  static Status RemoveFooterKey(int index, std::shared_ptr<KeyValueMetadata>* metadata) {
+    *metadata = (*metadata)->Copy();
+    RETURN_NOT_OK((*metadata)->Delete(index));
+    if ((*metadata)->size() == 0) {
+      metadata->reset();
+    }
+    return Status::OK();
+  }
+
   Result<std::unique_ptr<Message>> ReadMessageFromBlock(const FileBlock& block) {
     if (!BitUtil::IsMultipleOf8(block.offset) ||
         !BitUtil::IsMultipleOf8(block.metadata_length) ||
@@ -1003,8 +1295,7 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     for (int i = 0; i < num_dictionaries(); ++i) {
       ARROW_ASSIGN_OR_RAISE(auto message, ReadMessageFromBlock(GetDictionaryBlock(i)));
 
-      CHECK_HAS_BODY(*message);
-      ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+      ARROW_ASSIGN_OR_RAISE(auto reader, GetBodyReader(*message));
       DictionaryKind kind;
       RETURN_NOT_OK(ReadDictionary(*message->metadata(), &dictionary_memo_, options_,
                                    &kind, reader.get()));
@@ -1061,6 +1352,10 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     if (fb_metadata != nullptr) {
       std::shared_ptr<KeyValueMetadata> md;
       RETURN_NOT_OK(internal::GetKeyValueMetadata(fb_metadata, &md));
+      RETURN_NOT_OK(ParseFooterBatchLengths(&md));
+      if (md != nullptr) {
+        RETURN_NOT_OK(ParseFooterBodyAlignment(&md));
+      }
       metadata_ = std::move(md);  // const-ify
     }
 
@@ -1085,10 +1380,20 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   std::shared_ptr<Buffer> footer_buffer_;
   const flatbuf::Footer* footer_;
   std::shared_ptr<const KeyValueMetadata> metadata_;
+  int32_t body_alignment_ = kArrowIpcAlignment;
 
   bool read_dictionaries_ = false;
   DictionaryMemo dictionary_memo_;
 
+  // Record batch messages already read, indexed by batch (zero-copy files only)
+  std::vector<RecordBatchMessage> record_batch_messages_;
+
+  // Row counts of the record batches, if recorded in the footer
+  std::vector<int64_t> footer_batch_lengths_;
+  // First row of each record batch followed by the total row count, computed
+  // on demand by ReadRows()
+  std::vector<int64_t> row_offsets_;
+
   // Reconstructed schema, including any read dictionaries
   std::shared_ptr<Schema> schema_;
   // Schema with deselected fields dropped
@@ -1223,8 +1528,7 @@ class StreamDecoder::StreamDecoderImpl : public MessageDecoderListener {
     if (message->type() == MessageType::DICTIONARY_BATCH) {
       return ReadDictionary(*message);
     } else {
-      CHECK_HAS_BODY(*message);
-      ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+      ARROW_ASSIGN_OR_RAISE(auto reader, GetBodyReader(*message));
       ARROW_ASSIGN_OR_RAISE(
           auto batch,
           ReadRecordBatchInternal(*message->metadata(), schema_, field_inclusion_mask_,
@@ -1679,8 +1983,7 @@ Result<std::shared_ptr<SparseTensor>> ReadSparseTensor(const Buffer& metadata,
 }
 
 Result<std::shared_ptr<SparseTensor>> ReadSparseTensor(const Message& message) {
-  CHECK_HAS_BODY(message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message.body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, GetBodyReader(message));
   return ReadSparseTensor(*message.metadata(), reader.get());
 }
 
@@ -1688,8 +1991,7 @@ Result<std::shared_ptr<SparseTensor>> ReadSparseTensor(io::InputStream* file) {
   std::unique_ptr<Message> message;
   RETURN_NOT_OK(ReadContiguousPayload(file, &message));
   CHECK_MESSAGE_TYPE(MessageType::SPARSE_TENSOR, message->type());
-  CHECK_HAS_BODY(*message);
-  ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+  ARROW_ASSIGN_OR_RAISE(auto reader, GetBodyReader(*message));
   return ReadSparseTensor(*message->metadata(), reader.get());
 }
 
@@ -173,6 +173,14 @@ class ARROW_EXPORT RecordBatchFileReader {
   /// Footer
   virtual std::shared_ptr<const KeyValueMetadata> metadata() const = 0;
 
+  /// \brief Return the alignment of message bodies and body buffers in the file
+  ///
+  /// This is 8 unless the file was written with a larger
+  /// IpcWriteOptions::body_alignment. In that case the offset and length of
+  /// each record batch and dictionary message, and of its body, are multiples
+  /// of it, so that messages can be loaded with direct (e.g. O_DIRECT) reads.
+  virtual int32_t body_alignment() const = 0;
+
   /// \brief Read a particular record batch from the file. Does not copy memory
   /// if the input source supports zero-copy.
   ///
@@ -180,6 +188,33 @@ class ARROW_EXPORT RecordBatchFileReader {
   /// \return the read batch
   virtual Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(int i) = 0;
 
+  /// \brief Read a subset of the columns of a particular record batch from
+  /// the file, ignoring IpcReadOptions::included_fields.
+  ///
+  /// Only the buffers of the selected fields are referenced, so on a memory-mapped
+  /// file the pages of the other columns are never touched. The batch metadata is
+  /// parsed once and cached for sources supporting zero-copy, so repeated calls
+  /// with different selections are cheap.
+  ///
+  /// \param[in] i the index of the record batch to return
+  /// \param[in] field_indices indices of the top-level fields of the file schema
+  /// to read; an empty vector reads all fields
+  /// \return the read batch
+  virtual Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
+      int i, const std::vector<int>& field_indices) = 0;
+
+  /// \brief Read a range of rows, spanning one or more record batches
+  ///
+  /// Record batches are located from the row counts recorded in the footer
+  /// (see IpcWriteOptions::write_record_batch_lengths). For files written
+  /// without them, the metadata of every record batch is read once, on the
+  /// first call.
+  ///
+  /// \param[in] offset the index of the first row to read
+  /// \param[in] length the number of rows to read
+  /// \return a table with the rows, sliced from the file's record batches
+  virtual Result<std::shared_ptr<Table>> ReadRows(int64_t offset, int64_t length) = 0;
+
   /// \brief Return current read statistics
   virtual ReadStats stats() const = 0;
 };
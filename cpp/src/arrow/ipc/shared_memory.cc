@@ -0,0 +1,504 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/ipc/shared_memory.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/metadata_internal.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::IOErrorFromErrno;
+
+namespace ipc {
+
+namespace {
+
+constexpr int64_t kAlignment = 64;
+
+alignas(kAlignment) static uint8_t zero_size_area[1];
+
+// A buffer keeping the segment it points into mapped
+class SegmentBuffer : public MutableBuffer {
+ public:
+  explicit SegmentBuffer(std::shared_ptr<SharedMemorySegment> segment)
+      : MutableBuffer(segment->data(), segment->size()), segment_(std::move(segment)) {}
+
+ private:
+  std::shared_ptr<SharedMemorySegment> segment_;
+};
+
+#ifndef _WIN32
+std::atomic<int64_t> next_segment_id(0);
+
+Result<int> CreateAnonymousFile() {
+#if defined(__linux__) && defined(SYS_memfd_create)
+  // 1 is MFD_CLOEXEC, which older kernel headers may lack
+  const int memfd = static_cast<int>(syscall(SYS_memfd_create, "arrow", 1U));
+  if (memfd >= 0) {
+    return memfd;
+  }
+  if (errno != ENOSYS) {
+    return IOErrorFromErrno(errno, "Failed to create memfd");
+  }
+#endif
+  // Fall back on a shared memory object which is only reachable from its descriptor
+  const std::string name = "/arrow-" + std::to_string(getpid()) + "-" +
+                           std::to_string(next_segment_id++);
+  const int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd < 0) {
+    return IOErrorFromErrno(errno, "Failed to create shared memory object");
+  }
+  shm_unlink(name.c_str());
+  return fd;
+}
+
+Status ResizeFile(int fd, int64_t size) {
+  if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+    const int errnum = errno;
+    close(fd);
+    return IOErrorFromErrno(errnum, "Failed to resize shared memory segment");
+  }
+  return Status::OK();
+}
+
+Status CheckSegmentSize(int64_t size) {
+  if (size <= 0) {
+    return Status::Invalid("Shared memory segments must have a positive size, got ",
+                           size);
+  }
+  return Status::OK();
+}
+#endif
+
+Status CheckNoDictionary(const DataType& type) {
+  if (type.id() == Type::DICTIONARY) {
+    return Status::NotImplemented(
+        "Exporting dictionary-encoded columns to shared memory");
+  }
+  for (const auto& field : type.fields()) {
+    RETURN_NOT_OK(CheckNoDictionary(*field->type()));
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// SharedMemorySegment
+
+SharedMemorySegment::SharedMemorySegment(int fd, std::string name, bool owns_name,
+                                         uint8_t* data, int64_t size)
+    : fd_(fd), name_(std::move(name)), owns_name_(owns_name), data_(data), size_(size) {}
+
+SharedMemorySegment::~SharedMemorySegment() {
+#ifndef _WIN32
+  if (munmap(data_, static_cast<size_t>(size_)) != 0) {
+    ARROW_LOG(WARNING) << "Failed to unmap shared memory segment";
+  }
+  close(fd_);
+  if (owns_name_) {
+    shm_unlink(name_.c_str());
+  }
+#endif
+}
+
+Result<std::shared_ptr<SharedMemorySegment>> SharedMemorySegment::Map(int fd,
+                                                                      std::string name,
+                                                                      bool owns_name) {
+#ifdef _WIN32
+  return Status::NotImplemented("Shared memory segments on Windows");
+#else
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    const int errnum = errno;
+    close(fd);
+    return IOErrorFromErrno(errnum, "Failed to stat shared memory segment");
+  }
+  const int64_t size = static_cast<int64_t>(st.st_size);
+  Status st_size = CheckSegmentSize(size);
+  void* data = MAP_FAILED;
+  if (st_size.ok()) {
+    data = mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE, MAP_SHARED,
+                fd, 0);
+    if (data == MAP_FAILED) {
+      st_size = IOErrorFromErrno(errno, "Failed to map shared memory segment");
+    }
+  }
+  if (!st_size.ok()) {
+    close(fd);
+    if (owns_name) {
+      shm_unlink(name.c_str());
+    }
+    return st_size;
+  }
+  return std::shared_ptr<SharedMemorySegment>(new SharedMemorySegment(
+      fd, std::move(name), owns_name, reinterpret_cast<uint8_t*>(data), size));
+#endif
+}
+
+Result<std::shared_ptr<SharedMemorySegment>> SharedMemorySegment::Create(int64_t size) {
+#ifdef _WIN32
+  return Status::NotImplemented("Shared memory segments on Windows");
+#else
+  RETURN_NOT_OK(CheckSegmentSize(size));
+  ARROW_ASSIGN_OR_RAISE(int fd, CreateAnonymousFile());
+  RETURN_NOT_OK(ResizeFile(fd, size));
+  return Map(fd, "", /*owns_name=*/false);
+#endif
+}
+
+Result<std::shared_ptr<SharedMemorySegment>> SharedMemorySegment::Create(
+    const std::string& name, int64_t size) {
+#ifdef _WIN32
+  return Status::NotImplemented("Shared memory segments on Windows");
+#else
+  RETURN_NOT_OK(CheckSegmentSize(size));
+  const int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd < 0) {
+    return IOErrorFromErrno(errno, "Failed to create shared memory object '", name,
+                            "'");
+  }
+  Status st = ResizeFile(fd, size);
+  if (!st.ok()) {
+    shm_unlink(name.c_str());
+    return st;
+  }
+  return Map(fd, name, /*owns_name=*/true);
+#endif
+}
+
+Result<std::shared_ptr<SharedMemorySegment>> SharedMemorySegment::Open(int fd) {
+#ifdef _WIN32
+  return Status::NotImplemented("Shared memory segments on Windows");
+#else
+  const int dup_fd = dup(fd);
+  if (dup_fd < 0) {
+    return IOErrorFromErrno(errno, "Failed to duplicate shared memory descriptor");
+  }
+  return Map(dup_fd, "", /*owns_name=*/false);
+#endif
+}
+
+Result<std::shared_ptr<SharedMemorySegment>> SharedMemorySegment::Open(
+    const std::string& name) {
+#ifdef _WIN32
+  return Status::NotImplemented("Shared memory segments on Windows");
+#else
+  const int fd = shm_open(name.c_str(), O_RDWR, 0);
+  if (fd < 0) {
+    return IOErrorFromErrno(errno, "Failed to open shared memory object '", name, "'");
+  }
+  return Map(fd, name, /*owns_name=*/false);
+#endif
+}
+
+std::shared_ptr<Buffer> SharedMemorySegment::buffer() {
+  return std::make_shared<SegmentBuffer>(shared_from_this());
+}
+
+// ----------------------------------------------------------------------
+// SharedMemoryPool
+
+// A first-fit allocator over the segment, keeping the free blocks ordered by
+// offset so that adjacent blocks are coalesced when freeing
+class SharedMemoryPool::SharedMemoryPoolImpl {
+ public:
+  explicit SharedMemoryPoolImpl(std::shared_ptr<SharedMemorySegment> segment)
+      : segment_(std::move(segment)) {
+    // The segment is mapped at a page boundary
+    const int64_t capacity = segment_->size() / kAlignment * kAlignment;
+    if (capacity > 0) {
+      free_blocks_.emplace(0, capacity);
+    }
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (size == 0) {
+      *out = zero_size_area;
+      return Status::OK();
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      RETURN_NOT_OK(AllocateBlock(BlockSize(size), out));
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (new_size < 0) {
+      return Status::Invalid("negative realloc size");
+    }
+    if (old_size == 0 || new_size == 0) {
+      uint8_t* data;
+      RETURN_NOT_OK(Allocate(new_size, &data));
+      Free(*ptr, old_size);
+      *ptr = data;
+      return Status::OK();
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const int64_t offset = *ptr - segment_->data();
+      const int64_t old_block = BlockSize(old_size);
+      const int64_t new_block = BlockSize(new_size);
+      if (new_block < old_block) {
+        FreeBlock(offset + new_block, old_block - new_block);
+      } else if (new_block > old_block) {
+        // Grow in place if the next block is free and large enough
+        auto next = free_blocks_.find(offset + old_block);
+        if (next != free_blocks_.end() && next->second >= new_block - old_block) {
+          const int64_t remaining = next->second - (new_block - old_block);
+          free_blocks_.erase(next);
+          if (remaining > 0) {
+            free_blocks_.emplace(offset + new_block, remaining);
+          }
+        } else {
+          uint8_t* data;
+          RETURN_NOT_OK(AllocateBlock(new_block, &data));
+          std::memcpy(data, *ptr, static_cast<size_t>(old_size));
+          FreeBlock(offset, old_block);
+          *ptr = data;
+        }
+      }
+    }
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (size == 0) {
+      return;
+    }
+    DCHECK(buffer >= segment_->data() && buffer + size <= segment_->data() + capacity());
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      FreeBlock(buffer - segment_->data(), BlockSize(size));
+    }
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  const std::shared_ptr<SharedMemorySegment>& segment() const { return segment_; }
+
+  Result<int64_t> GetOffset(const Buffer& buffer) const {
+    const uint8_t* data = buffer.data();
+    if (!buffer.is_cpu() || data < segment_->data() ||
+        data + buffer.size() > segment_->data() + segment_->size()) {
+      return Status::KeyError("Buffer does not lie in the shared memory segment");
+    }
+    return data - segment_->data();
+  }
+
+ private:
+  static int64_t BlockSize(int64_t size) { return BitUtil::RoundUpToMultipleOf64(size); }
+
+  int64_t capacity() const { return segment_->size() / kAlignment * kAlignment; }
+
+  Status AllocateBlock(int64_t block_size, uint8_t** out) {
+    for (auto it = free_blocks_.begin(); it != free_blocks_.end(); ++it) {
+      if (it->second >= block_size) {
+        const int64_t offset = it->first;
+        const int64_t remaining = it->second - block_size;
+        free_blocks_.erase(it);
+        if (remaining > 0) {
+          free_blocks_.emplace(offset + block_size, remaining);
+        }
+        *out = segment_->data() + offset;
+        return Status::OK();
+      }
+    }
+    return Status::OutOfMemory("Shared memory pool of capacity ", capacity(),
+                               " failed to allocate ", block_size, " bytes");
+  }
+
+  void FreeBlock(int64_t offset, int64_t block_size) {
+    auto next = free_blocks_.lower_bound(offset);
+    if (next != free_blocks_.end() && offset + block_size == next->first) {
+      block_size += next->second;
+      next = free_blocks_.erase(next);
+    }
+    if (next != free_blocks_.begin()) {
+      auto prev = std::prev(next);
+      if (prev->first + prev->second == offset) {
+        prev->second += block_size;
+        return;
+      }
+    }
+    free_blocks_.emplace_hint(next, offset, block_size);
+  }
+
+  std::shared_ptr<SharedMemorySegment> segment_;
+  std::mutex mutex_;
+  // Offset -> size of the free blocks
+  std::map<int64_t, int64_t> free_blocks_;
+  ::arrow::internal::MemoryPoolStats stats_;
+};
+
+SharedMemoryPool::SharedMemoryPool(std::shared_ptr<SharedMemorySegment> segment)
+    : impl_(new SharedMemoryPoolImpl(std::move(segment))) {}
+
+SharedMemoryPool::~SharedMemoryPool() = default;
+
+Result<std::shared_ptr<SharedMemoryPool>> SharedMemoryPool::Make(int64_t capacity) {
+  ARROW_ASSIGN_OR_RAISE(auto segment, SharedMemorySegment::Create(capacity));
+  return Make(std::move(segment));
+}
+
+Result<std::shared_ptr<SharedMemoryPool>> SharedMemoryPool::Make(
+    std::shared_ptr<SharedMemorySegment> segment) {
+  if (segment == nullptr) {
+    return Status::Invalid("Shared memory pool needs a segment");
+  }
+  return std::shared_ptr<SharedMemoryPool>(new SharedMemoryPool(std::move(segment)));
+}
+
+Status SharedMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status SharedMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void SharedMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t SharedMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t SharedMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string SharedMemoryPool::backend_name() const { return "shared_memory"; }
+
+const std::shared_ptr<SharedMemorySegment>& SharedMemoryPool::segment() const {
+  return impl_->segment();
+}
+
+Result<int64_t> SharedMemoryPool::GetOffset(const Buffer& buffer) const {
+  return impl_->GetOffset(buffer);
+}
+
+// ----------------------------------------------------------------------
+// Record batch handoff
+
+Result<SharedRecordBatch> ExportRecordBatch(const RecordBatch& batch,
+                                            SharedMemoryPool* pool,
+                                            const IpcWriteOptions& options) {
+  if (options.codec != nullptr) {
+    return Status::Invalid(
+        "Record batches exported to shared memory can't be compressed");
+  }
+  for (const auto& field : batch.schema()->fields()) {
+    RETURN_NOT_OK(CheckNoDictionary(*field->type()));
+  }
+
+  // The buffers the serializer has to rewrite are allocated in the segment as well
+  IpcWriteOptions write_options = options;
+  write_options.memory_pool = pool;
+  IpcPayload payload;
+  RETURN_NOT_OK(GetRecordBatchPayload(batch, write_options, &payload));
+
+  SharedRecordBatch out;
+  std::vector<internal::BufferMetadata> buffers;
+  buffers.reserve(payload.body_buffers.size());
+  for (const auto& buffer : payload.body_buffers) {
+    if (buffer == nullptr || buffer->size() == 0) {
+      buffers.push_back({0, 0});
+      continue;
+    }
+    if (!buffer->is_cpu()) {
+      return Status::NotImplemented("Exporting non-CPU buffers to shared memory");
+    }
+    auto maybe_offset = pool->GetOffset(*buffer);
+    if (maybe_offset.ok() && BitUtil::IsMultipleOf8(*maybe_offset)) {
+      out.buffers.push_back(buffer);
+    } else {
+      // The IPC reader requires buffers to start at 8-byte aligned offsets
+      ARROW_ASSIGN_OR_RAISE(auto copy, buffer->CopySlice(0, buffer->size(), pool));
+      ARROW_ASSIGN_OR_RAISE(maybe_offset, pool->GetOffset(*copy));
+      out.buffers.push_back(std::move(copy));
+    }
+    buffers.push_back({*maybe_offset, buffer->size()});
+  }
+
+  // Rewrite the message with the buffers located by their offsets in the segment
+  const flatbuf::Message* message = nullptr;
+  RETURN_NOT_OK(internal::VerifyMessage(payload.metadata->data(),
+                                        payload.metadata->size(), &message));
+  const flatbuf::RecordBatch* batch_meta = message->header_as_RecordBatch();
+  if (batch_meta == nullptr) {
+    return Status::IOError(
+        "Header-type of flatbuffer-encoded Message is not RecordBatch.");
+  }
+  std::vector<internal::FieldMetadata> nodes;
+  if (batch_meta->nodes() != nullptr) {
+    nodes.reserve(batch_meta->nodes()->size());
+    for (const flatbuf::FieldNode* node : *batch_meta->nodes()) {
+      nodes.push_back({node->length(), node->null_count(), 0});
+    }
+  }
+  RETURN_NOT_OK(internal::WriteRecordBatchMessage(
+      batch.num_rows(), pool->segment()->size(), /*custom_metadata=*/nullptr, nodes,
+      buffers, write_options, &out.metadata));
+  return out;
+}
+
+Result<std::shared_ptr<RecordBatch>> ImportRecordBatch(
+    const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+    const std::shared_ptr<SharedMemorySegment>& segment, const IpcReadOptions& options) {
+  io::BufferReader reader(segment->buffer());
+  return ReadRecordBatch(metadata, schema, /*dictionary_memo=*/nullptr, options,
+                         &reader);
+}
+
+}  // namespace ipc
+}  // namespace arrow
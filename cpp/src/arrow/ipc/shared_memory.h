@@ -0,0 +1,194 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Zero-copy handoff of record batches between processes of the same host
+// through shared memory segments
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/ipc/options.h"
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class RecordBatch;
+class Schema;
+
+namespace ipc {
+
+/// \brief A memory segment which can be mapped by several processes
+///
+/// A segment is either anonymous, in which case other processes map it
+/// through its file descriptor (e.g. passed over a Unix domain socket with
+/// SCM_RIGHTS, or inherited on fork), or named, in which case they can also
+/// open it by name.  Anonymous segments are backed by memfd_create() where
+/// available, and by an immediately unlinked POSIX shared memory object
+/// otherwise.
+///
+/// The segment is unmapped and its descriptor closed on destruction.
+class ARROW_EXPORT SharedMemorySegment
+    : public std::enable_shared_from_this<SharedMemorySegment> {
+ public:
+  ~SharedMemorySegment();
+
+  /// \brief Create a new anonymous segment of the given size
+  static Result<std::shared_ptr<SharedMemorySegment>> Create(int64_t size);
+
+  /// \brief Create a new POSIX shared memory object of the given name and size
+  ///
+  /// The object is unlinked when the segment is destroyed.
+  static Result<std::shared_ptr<SharedMemorySegment>> Create(const std::string& name,
+                                                             int64_t size);
+
+  /// \brief Map the segment referred to by a file descriptor
+  ///
+  /// The descriptor is duplicated, the caller keeps ownership of fd.
+  static Result<std::shared_ptr<SharedMemorySegment>> Open(int fd);
+
+  /// \brief Map the named POSIX shared memory object created by another process
+  static Result<std::shared_ptr<SharedMemorySegment>> Open(const std::string& name);
+
+  /// The file descriptor of the segment, to be handed to other processes
+  int fd() const { return fd_; }
+
+  /// The name of the segment, empty if it is anonymous
+  const std::string& name() const { return name_; }
+
+  int64_t size() const { return size_; }
+
+  uint8_t* data() const { return data_; }
+
+  /// \brief A buffer spanning the whole segment
+  ///
+  /// The buffer and its slices keep the segment mapped.
+  std::shared_ptr<Buffer> buffer();
+
+ private:
+  SharedMemorySegment(int fd, std::string name, bool owns_name, uint8_t* data,
+                      int64_t size);
+
+  static Result<std::shared_ptr<SharedMemorySegment>> Map(int fd, std::string name,
+                                                          bool owns_name);
+
+  int fd_;
+  std::string name_;
+  bool owns_name_;
+  uint8_t* data_;
+  int64_t size_;
+};
+
+/// \brief A memory pool allocating from a shared memory segment
+///
+/// Arrays built with this pool live entirely in the segment, so that they can
+/// be handed to another process mapping the same segment without copying, see
+/// ExportRecordBatch().  The segment has a fixed capacity; allocations beyond
+/// it fail with an OutOfMemory error.
+class ARROW_EXPORT SharedMemoryPool : public MemoryPool {
+ public:
+  ~SharedMemoryPool() override;
+
+  /// \brief Create a pool over a new anonymous segment of the given capacity
+  static Result<std::shared_ptr<SharedMemoryPool>> Make(int64_t capacity);
+
+  /// \brief Create a pool over an existing segment
+  ///
+  /// The pool assumes it is the only allocator of the segment.
+  static Result<std::shared_ptr<SharedMemoryPool>> Make(
+      std::shared_ptr<SharedMemorySegment> segment);
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  const std::shared_ptr<SharedMemorySegment>& segment() const;
+
+  /// \brief The offset of the data of a buffer in the segment
+  ///
+  /// Together with the descriptor or the name of the segment, the offset is
+  /// a handle another process can use to find the buffer's data.  Returns
+  /// KeyError if the buffer doesn't lie in the segment.
+  Result<int64_t> GetOffset(const Buffer& buffer) const;
+
+ private:
+  explicit SharedMemoryPool(std::shared_ptr<SharedMemorySegment> segment);
+
+  class SharedMemoryPoolImpl;
+  std::unique_ptr<SharedMemoryPoolImpl> impl_;
+};
+
+/// \brief A record batch exported to a shared memory segment
+struct ARROW_EXPORT SharedRecordBatch {
+  /// \brief Flatbuffer-encoded RecordBatch message locating the buffers of
+  /// the batch by their offsets in the segment
+  std::shared_ptr<Buffer> metadata;
+
+  /// \brief The buffers of the batch
+  ///
+  /// The producer must keep them alive, so that the pool doesn't reuse their
+  /// memory, until the consumer has released the imported batch.
+  std::vector<std::shared_ptr<Buffer>> buffers;
+};
+
+/// \brief Export a record batch whose data lives in a shared memory pool
+///
+/// Only the metadata is serialized: it refers to the buffers of the batch by
+/// their offsets in the pool's segment.  Buffers outside of the segment, and
+/// buffers the IPC format needs rewritten (e.g. sliced offsets or bitmaps),
+/// are copied into the pool.  Dictionary-encoded columns and compression are
+/// not supported.
+///
+/// \param[in] batch the record batch to export
+/// \param[in] pool the pool the batch's data was allocated from
+/// \param[in] options options for serialization
+/// \return the metadata to hand to the consumer along with the segment handle
+ARROW_EXPORT
+Result<SharedRecordBatch> ExportRecordBatch(
+    const RecordBatch& batch, SharedMemoryPool* pool,
+    const IpcWriteOptions& options = IpcWriteOptions::Defaults());
+
+/// \brief Import a record batch exported by ExportRecordBatch()
+///
+/// The returned batch points into the mapped segment without copying.
+///
+/// \param[in] metadata the metadata returned by ExportRecordBatch()
+/// \param[in] schema the schema of the batch
+/// \param[in] segment the segment of the producer's pool, mapped in this process
+/// \param[in] options options for deserialization
+/// \return the record batch
+ARROW_EXPORT
+Result<std::shared_ptr<RecordBatch>> ImportRecordBatch(
+    const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+    const std::shared_ptr<SharedMemorySegment>& segment,
+    const IpcReadOptions& options = IpcReadOptions::Defaults());
+
+}  // namespace ipc
+}  // namespace arrow
@@ -0,0 +1,188 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/buffer.h"
+#include "arrow/ipc/shared_memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace ipc {
+
+#ifndef _WIN32
+
+TEST(SharedMemoryPool, Allocate) {
+  ASSERT_OK_AND_ASSIGN(auto pool, SharedMemoryPool::Make(4096));
+  ASSERT_EQ(pool->segment()->size(), 4096);
+  ASSERT_EQ(pool->backend_name(), "shared_memory");
+
+  uint8_t *a, *b, *c;
+  ASSERT_OK(pool->Allocate(100, &a));
+  ASSERT_OK(pool->Allocate(64, &b));
+  ASSERT_OK(pool->Allocate(1000, &c));
+  ASSERT_EQ(pool->bytes_allocated(), 1164);
+  for (uint8_t* data : {a, b, c}) {
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(data) % 64, 0);
+  }
+  ASSERT_OK_AND_ASSIGN(auto offset, pool->GetOffset(Buffer(b, 64)));
+  ASSERT_EQ(offset, 128);
+  ASSERT_RAISES(KeyError, pool->GetOffset(Buffer(reinterpret_cast<uint8_t*>(&offset),
+                                                 sizeof(offset))));
+
+  ASSERT_RAISES(OutOfMemory, pool->Allocate(4096, &b));
+  // Freed blocks are coalesced with their free neighbours
+  pool->Free(a, 100);
+  pool->Free(b, 64);
+  ASSERT_OK(pool->Allocate(192, &b));
+  ASSERT_EQ(b, a);
+
+  // Growing in place, then moving when the next block is taken
+  ASSERT_OK(pool->Reallocate(1000, 2000, &c));
+  ASSERT_EQ(c, a + 192);
+  c[1999] = 42;
+  ASSERT_OK(pool->Reallocate(192, 300, &b));
+  ASSERT_EQ(b, a + 192 + 2048);
+  ASSERT_EQ(c[1999], 42);
+  ASSERT_EQ(pool->bytes_allocated(), 2300);
+  ASSERT_EQ(pool->max_memory(), 2300);
+
+  pool->Free(b, 300);
+  pool->Free(c, 2000);
+  ASSERT_EQ(pool->bytes_allocated(), 0);
+  ASSERT_OK(pool->Allocate(4096, &a));
+  pool->Free(a, 4096);
+}
+
+class TestSharedRecordBatch : public ::testing::Test {
+ public:
+  void SetUp() override { ASSERT_OK_AND_ASSIGN(pool_, SharedMemoryPool::Make(1 << 16)); }
+
+  // Import the batch from a separate mapping of the segment, as another process would
+  void CheckRoundtrip(const RecordBatch& batch,
+                      std::shared_ptr<RecordBatch>* imported = nullptr) {
+    ASSERT_OK_AND_ASSIGN(auto exported, ExportRecordBatch(batch, pool_.get()));
+    for (const auto& buffer : exported.buffers) {
+      ASSERT_OK(pool_->GetOffset(*buffer));
+    }
+    ASSERT_OK_AND_ASSIGN(auto segment, SharedMemorySegment::Open(pool_->segment()->fd()));
+    ASSERT_NE(segment->data(), pool_->segment()->data());
+    ASSERT_OK_AND_ASSIGN(auto result,
+                         ImportRecordBatch(*exported.metadata, batch.schema(), segment));
+    ASSERT_OK(result->ValidateFull());
+    AssertBatchesEqual(batch, *result);
+
+    for (const auto& column : result->columns()) {
+      for (const auto& buffer : column->data()->buffers) {
+        if (buffer != nullptr && buffer->size() > 0) {
+          ASSERT_GE(buffer->data(), segment->data());
+          ASSERT_LE(buffer->data() + buffer->size(), segment->data() + segment->size());
+        }
+      }
+    }
+    if (imported != nullptr) {
+      *imported = result;
+    }
+  }
+
+ protected:
+  std::shared_ptr<SharedMemoryPool> pool_;
+};
+
+TEST_F(TestSharedRecordBatch, ZeroCopy) {
+  Int32Builder ints(pool_.get());
+  StringBuilder strings(pool_.get());
+  ASSERT_OK(ints.AppendValues({1, 2, 3}));
+  ASSERT_OK(ints.AppendNull());
+  ASSERT_OK(strings.AppendValues({"a", "bc", "", "def"}));
+  std::shared_ptr<Array> int_array, string_array;
+  ASSERT_OK(ints.Finish(&int_array));
+  ASSERT_OK(strings.Finish(&string_array));
+  auto batch = RecordBatch::Make(schema({field("i", int32()), field("s", utf8())}), 4,
+                                 {int_array, string_array});
+  const int64_t bytes_allocated = pool_->bytes_allocated();
+
+  std::shared_ptr<RecordBatch> imported;
+  ASSERT_NO_FATAL_FAILURE(CheckRoundtrip(*batch, &imported));
+  // Nothing was copied, and both mappings see the same pages
+  ASSERT_EQ(pool_->bytes_allocated(), bytes_allocated);
+  int_array->data()->buffers[1]->mutable_data()[0] = 7;
+  const auto& imported_ints =
+      ::arrow::internal::checked_cast<const Int32Array&>(*imported->column(0));
+  ASSERT_EQ(imported_ints.Value(0), 7);
+
+  ASSERT_NO_FATAL_FAILURE(CheckRoundtrip(*batch->Slice(1, 2)));
+  ASSERT_NO_FATAL_FAILURE(CheckRoundtrip(*batch->Slice(4)));
+}
+
+TEST_F(TestSharedRecordBatch, CopyForeignBuffers) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("f", float64()), field("l", list(int8()))}),
+      R"([{"f": 1.5, "l": [1, 2]}, {"f": null, "l": null}, {"f": -2, "l": []}])");
+  ASSERT_NO_FATAL_FAILURE(CheckRoundtrip(*batch));
+  ASSERT_NO_FATAL_FAILURE(CheckRoundtrip(*batch->Slice(1)));
+
+  // The copies are owned by the exported batch
+  ASSERT_OK_AND_ASSIGN(auto exported, ExportRecordBatch(*batch, pool_.get()));
+  ASSERT_GT(pool_->bytes_allocated(), 0);
+  exported.buffers.clear();
+  ASSERT_EQ(pool_->bytes_allocated(), 0);
+}
+
+TEST_F(TestSharedRecordBatch, Errors) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("d", dictionary(int8(), utf8()))}), R"([{"d": "a"}])");
+  ASSERT_RAISES(NotImplemented, ExportRecordBatch(*batch, pool_.get()));
+  ASSERT_RAISES(Invalid, SharedMemorySegment::Create(0));
+}
+
+TEST(SharedMemorySegment, Named) {
+  const std::string name = "/arrow-shared-memory-test-" + std::to_string(getpid());
+  ASSERT_OK_AND_ASSIGN(auto segment, SharedMemorySegment::Create(name, 100));
+  ASSERT_EQ(segment->name(), name);
+  ASSERT_RAISES(IOError, SharedMemorySegment::Create(name, 100));
+
+  ASSERT_OK_AND_ASSIGN(auto opened, SharedMemorySegment::Open(name));
+  ASSERT_EQ(opened->size(), 100);
+  segment->data()[99] = 42;
+  ASSERT_EQ(opened->data()[99], 42);
+
+  // The buffer keeps the segment mapped
+  auto buffer = opened->buffer();
+  opened.reset();
+  segment.reset();
+  ASSERT_EQ(buffer->data()[99], 42);
+  ASSERT_RAISES(IOError, SharedMemorySegment::Open(name));
+}
+
+#endif
+
+}  // namespace ipc
+}  // namespace arrow
@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <cstring>
 #include <limits>
+#include <numeric>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -69,6 +70,38 @@ using internal::kArrowMagicBytes;
 
 namespace {
 
+// Largest supported IpcWriteOptions::body_alignment
+constexpr int32_t kMaxBodyAlignment = 1 << 16;
+
+Status CheckBodyAlignment(const IpcWriteOptions& options) {
+  if (options.body_alignment < kArrowIpcAlignment ||
+      options.body_alignment > kMaxBodyAlignment ||
+      !BitUtil::IsPowerOf2(static_cast<int64_t>(options.body_alignment))) {
+    return Status::Invalid("IPC body alignment must be a power of two between ",
+                           kArrowIpcAlignment, " and ", kMaxBodyAlignment, ", got ",
+                           options.body_alignment);
+  }
+  return Status::OK();
+}
+
+// Metadata is padded so that message bodies start at aligned positions too
+int32_t MessageAlignment(const IpcWriteOptions& options) {
+  return std::max(options.alignment, options.body_alignment);
+}
+
+// A slice of zeros, to pad messages and body buffers with
+std::shared_ptr<Buffer> PaddingSegment(int64_t nbytes) {
+  static const auto padding = std::make_shared<Buffer>(kPaddingBytes, kArrowAlignment);
+  if (nbytes <= kArrowAlignment) {
+    return SliceBuffer(padding, /*offset=*/0, nbytes);
+  }
+  static const std::vector<uint8_t> large_padding_bytes(kMaxBodyAlignment, 0);
+  static const auto large_padding =
+      std::make_shared<Buffer>(large_padding_bytes.data(), kMaxBodyAlignment);
+  DCHECK_LE(nbytes, kMaxBodyAlignment);
+  return SliceBuffer(large_padding, /*offset=*/0, nbytes);
+}
+
 Status GetTruncatedBitmap(int64_t offset, int64_t length,
                           const std::shared_ptr<Buffer> input, MemoryPool* pool,
                           std::shared_ptr<Buffer>* buffer) {
@@ -77,8 +110,13 @@ Status GetTruncatedBitmap(int64_t offset, int64_t length,
     return Status::OK();
   }
   int64_t min_length = PaddedLength(BitUtil::BytesForBits(length));
-  if (offset != 0 || min_length < input->size()) {
-    // With a sliced array / non-zero offset, we must copy the bitmap
+  if (offset % 8 == 0 && (offset != 0 || min_length < input->size())) {
+    // A byte-aligned slice can be sent as is: the trailing bits are ignored
+    const int64_t byte_offset = offset / 8;
+    *buffer = SliceBuffer(input, byte_offset,
+                          std::min(min_length, input->size() - byte_offset));
+  } else if (offset != 0) {
+    // Otherwise, with a non-zero offset, we must copy the bitmap
     ARROW_ASSIGN_OR_RAISE(*buffer, CopyBitmap(pool, input->data(), offset, length));
   } else {
     *buffer = input;
@@ -188,19 +226,30 @@ class RecordBatchSerializer {
     RETURN_NOT_OK(
         internal::CheckCompressionSupported(options_.codec->compression_type()));
 
+    std::vector<int> order(out_->body_buffers.size());
+    std::iota(order.begin(), order.end(), 0);
+    if (options_.use_threads) {
+      // Schedule the largest buffers first so that a few big columns don't end up
+      // compressing serially after all the small buffers are done
+      std::stable_sort(order.begin(), order.end(), [&](int l, int r) {
+        return out_->body_buffers[l]->size() > out_->body_buffers[r]->size();
+      });
+    }
+
     auto CompressOne = [&](size_t i) {
-      if (out_->body_buffers[i]->size() > 0) {
-        RETURN_NOT_OK(CompressBuffer(*out_->body_buffers[i], options_.codec.get(),
-                                     &out_->body_buffers[i]));
+      auto& buffer = out_->body_buffers[order[i]];
+      if (buffer->size() > 0) {
+        RETURN_NOT_OK(CompressBuffer(*buffer, options_.codec.get(), &buffer));
       }
       return Status::OK();
     };
 
     return ::arrow::internal::OptionalParallelFor(
-        options_.use_threads, static_cast<int>(out_->body_buffers.size()), CompressOne);
+        options_.use_threads, static_cast<int>(order.size()), CompressOne);
   }
 
   Status Assemble(const RecordBatch& batch) {
+    RETURN_NOT_OK(CheckBodyAlignment(options_));
     if (field_nodes_.size() > 0) {
       field_nodes_.clear();
       buffer_meta_.clear();
@@ -230,7 +279,7 @@ class RecordBatchSerializer {
       // The buffer might be null if we are handling zero row lengths.
       if (buffer) {
         size = buffer->size();
-        padding = BitUtil::RoundUpToMultipleOf8(size) - size;
+        padding = PaddedLength(size, options_.body_alignment) - size;
       }
 
       buffer_meta_.push_back({offset, size});
@@ -255,32 +304,33 @@ class RecordBatchSerializer {
     using offset_type = typename ArrayType::offset_type;
 
     auto offsets = array.value_offsets();
+    if (offsets == nullptr) {
+      *value_offsets = std::move(offsets);
+      return Status::OK();
+    }
 
     int64_t required_bytes = sizeof(offset_type) * (array.length() + 1);
-    if (array.offset() != 0) {
-      // If we have a non-zero offset, then the value offsets do not start at
-      // zero. We must a) create a new offsets array with shifted offsets and
+    const offset_type start_offset = array.value_offset(0);
+    if (start_offset != 0) {
+      // If the value offsets do not start at zero, e.g. with a non-zero array
+      // offset, we must a) create a new offsets array with shifted offsets and
       // b) slice the values array accordingly
 
       ARROW_ASSIGN_OR_RAISE(auto shifted_offsets,
                             AllocateBuffer(required_bytes, options_.memory_pool));
 
+      const offset_type* src_offsets = array.raw_value_offsets();
       offset_type* dest_offsets =
           reinterpret_cast<offset_type*>(shifted_offsets->mutable_data());
-      const offset_type start_offset = array.value_offset(0);
-
-      for (int i = 0; i < array.length(); ++i) {
-        dest_offsets[i] = array.value_offset(i) - start_offset;
+      for (int64_t i = 0; i <= array.length(); ++i) {
+        dest_offsets[i] = src_offsets[i] - start_offset;
       }
-      // Final offset
-      dest_offsets[array.length()] = array.value_offset(array.length()) - start_offset;
       offsets = std::move(shifted_offsets);
-    } else {
+    } else if (array.offset() != 0 || offsets->size() > required_bytes) {
       // ARROW-6046: Slice offsets to used extent, in case we have a truncated
-      // slice
-      if (offsets != nullptr && offsets->size() > required_bytes) {
-        offsets = SliceBuffer(offsets, 0, required_bytes);
-      }
+      // slice.  Offsets already starting at zero need no rebasing.
+      offsets =
+          SliceBuffer(offsets, array.offset() * sizeof(offset_type), required_bytes);
     }
     *value_offsets = std::move(offsets);
     return Status::OK();
@@ -327,13 +377,14 @@ class RecordBatchSerializer {
     RETURN_NOT_OK(GetZeroBasedValueOffsets<T>(array, &value_offsets));
     auto data = array.value_data();
 
+    int64_t start_offset = 0;
     int64_t total_data_bytes = 0;
     if (value_offsets) {
-      total_data_bytes = array.value_offset(array.length()) - array.value_offset(0);
+      start_offset = array.value_offset(0);
+      total_data_bytes = array.value_offset(array.length()) - start_offset;
     }
-    if (NeedTruncate(array.offset(), data.get(), total_data_bytes)) {
+    if (NeedTruncate(start_offset, data.get(), total_data_bytes)) {
       // Slice the data buffer to include only the range we need now
-      const int64_t start_offset = array.value_offset(0);
       const int64_t slice_length =
           std::min(PaddedLength(total_data_bytes), data->size() - start_offset);
       data = SliceBuffer(data, start_offset, slice_length);
@@ -362,7 +413,7 @@ class RecordBatchSerializer {
       values_length = array.value_offset(array.length()) - values_offset;
     }
 
-    if (array.offset() != 0 || values_length < values->length()) {
+    if (values_offset != 0 || values_length < values->length()) {
       // Must also slice the values
       values = values->Slice(values_offset, values_length);
     }
@@ -441,62 +492,52 @@ class RecordBatchSerializer {
     std::vector<int32_t> child_offsets(max_code + 1, -1);
     std::vector<int32_t> child_lengths(max_code + 1, 0);
 
-    if (offset != 0) {
+    // Offsets may not be ascending, so we need to find out the extent of the
+    // range of each child referenced by the union, sliced or not
+    const int32_t* unshifted_offsets = array.raw_value_offsets();
+    const int8_t* type_codes_data = array.raw_type_codes();
+    for (int64_t i = 0; i < length; ++i) {
+      const int8_t code = type_codes_data[i];
+      const int32_t value_offset = unshifted_offsets[i];
+      if (child_offsets[code] == -1 || value_offset < child_offsets[code]) {
+        child_offsets[code] = value_offset;
+      }
+      child_lengths[code] = std::max(child_lengths[code], value_offset + 1);
+    }
+    for (int8_t code : type.type_codes()) {
+      if (child_offsets[code] > 0) {
+        // child_lengths holds the end of the range until here
+        child_lengths[code] -= child_offsets[code];
+      } else {
+        child_offsets[code] = 0;
+      }
+    }
+    if (std::any_of(child_offsets.begin(), child_offsets.end(),
+                    [](int32_t offset) { return offset > 0; })) {
       // This is an unpleasant case. Because the offsets are different for
-      // each child array, when we have a sliced array, we need to "rebase"
-      // the value_offsets for each array
-
-      const int32_t* unshifted_offsets = array.raw_value_offsets();
-      const int8_t* type_codes = array.raw_type_codes();
-
-      // Allocate the shifted offsets
+      // each child array, when a child is referenced from a non-zero offset,
+      // we need to "rebase" the value_offsets for each array
       ARROW_ASSIGN_OR_RAISE(
           auto shifted_offsets_buffer,
           AllocateBuffer(length * sizeof(int32_t), options_.memory_pool));
       int32_t* shifted_offsets =
           reinterpret_cast<int32_t*>(shifted_offsets_buffer->mutable_data());
-
-      // Offsets may not be ascending, so we need to find out the start offset
-      // for each child
       for (int64_t i = 0; i < length; ++i) {
-        const uint8_t code = type_codes[i];
-        if (child_offsets[code] == -1) {
-          child_offsets[code] = unshifted_offsets[i];
-        } else {
-          child_offsets[code] = std::min(child_offsets[code], unshifted_offsets[i]);
-        }
-      }
-
-      // Now compute shifted offsets by subtracting child offset
-      for (int64_t i = 0; i < length; ++i) {
-        const int8_t code = type_codes[i];
-        shifted_offsets[i] = unshifted_offsets[i] - child_offsets[code];
-        // Update the child length to account for observed value
-        child_lengths[code] = std::max(child_lengths[code], shifted_offsets[i] + 1);
+        shifted_offsets[i] = unshifted_offsets[i] - child_offsets[type_codes_data[i]];
       }
-
       value_offsets = std::move(shifted_offsets_buffer);
     }
     out_->body_buffers.emplace_back(value_offsets);
 
-    // Visit children and slice accordingly
+    // Visit children, truncated to the range referenced by the union
     for (int i = 0; i < type.num_fields(); ++i) {
       std::shared_ptr<Array> child = array.field(i);
-
-      // TODO: ARROW-809, for sliced unions, tricky to know how much to
-      // truncate the children. For now, we are truncating the children to be
-      // no longer than the parent union.
-      if (offset != 0) {
-        const int8_t code = type.type_codes()[i];
-        const int64_t child_offset = child_offsets[code];
-        const int64_t child_length = child_lengths[code];
-
-        if (child_offset > 0) {
-          child = child->Slice(child_offset, child_length);
-        } else if (child_length < child->length()) {
-          // This case includes when child is not encountered at all
-          child = child->Slice(0, child_length);
-        }
+      const int8_t code = type.type_codes()[i];
+      const int64_t child_offset = child_offsets[code];
+      const int64_t child_length = child_lengths[code];
+      if (child_offset > 0 || child_length < child->length()) {
+        // This includes when child is not encountered at all
+        child = child->Slice(child_offset, child_length);
       }
       RETURN_NOT_OK(VisitArray(*child));
     }
@@ -555,34 +596,58 @@ class DictionarySerializer : public RecordBatchSerializer {
 
 }  // namespace
 
-Status WriteIpcPayload(const IpcPayload& payload, const IpcWriteOptions& options,
-                       io::OutputStream* dst, int32_t* metadata_length) {
-  RETURN_NOT_OK(WriteMessage(*payload.metadata, options, dst, metadata_length));
+Status GetIpcPayloadSegments(const IpcPayload& payload, const IpcWriteOptions& options,
+                             std::vector<std::shared_ptr<Buffer>>* segments,
+                             int32_t* metadata_length) {
+  segments->clear();
+  segments->reserve(3 + 2 * payload.body_buffers.size());
 
-#ifndef NDEBUG
-  RETURN_NOT_OK(CheckAligned(dst));
-#endif
+  // Encapsulated message prefix, see WriteMessage()
+  const int32_t prefix_size = options.write_legacy_ipc_format ? 4 : 8;
+  const int32_t flatbuffer_size = static_cast<int32_t>(payload.metadata->size());
+  const int32_t padded_message_length = static_cast<int32_t>(
+      PaddedLength(flatbuffer_size + prefix_size, MessageAlignment(options)));
+  *metadata_length = padded_message_length;
 
-  // Now write the buffers
-  for (size_t i = 0; i < payload.body_buffers.size(); ++i) {
-    const std::shared_ptr<Buffer>& buffer = payload.body_buffers[i];
-    int64_t size = 0;
-    int64_t padding = 0;
+  std::string prefix;
+  if (!options.write_legacy_ipc_format) {
+    prefix.append(reinterpret_cast<const char*>(&internal::kIpcContinuationToken),
+                  sizeof(int32_t));
+  }
+  const int32_t padded_flatbuffer_size =
+      BitUtil::ToLittleEndian(padded_message_length - prefix_size);
+  prefix.append(reinterpret_cast<const char*>(&padded_flatbuffer_size), sizeof(int32_t));
+  segments->push_back(Buffer::FromString(std::move(prefix)));
+
+  segments->push_back(payload.metadata);
+  const int32_t metadata_padding = padded_message_length - flatbuffer_size - prefix_size;
+  if (metadata_padding > 0) {
+    segments->push_back(PaddingSegment(metadata_padding));
+  }
 
+  for (const auto& buffer : payload.body_buffers) {
     // The buffer might be null if we are handling zero row lengths.
-    if (buffer) {
-      size = buffer->size();
-      padding = BitUtil::RoundUpToMultipleOf8(size) - size;
-    }
-
-    if (size > 0) {
-      RETURN_NOT_OK(dst->Write(buffer));
-    }
+    if (buffer == nullptr || buffer->size() == 0) continue;
 
+    const int64_t size = buffer->size();
+    const int64_t padding = PaddedLength(size, options.body_alignment) - size;
+    segments->push_back(buffer);
     if (padding > 0) {
-      RETURN_NOT_OK(dst->Write(kPaddingBytes, padding));
+      segments->push_back(PaddingSegment(padding));
     }
   }
+  return Status::OK();
+}
+
+Status WriteIpcPayload(const IpcPayload& payload, const IpcWriteOptions& options,
+                       io::OutputStream* dst, int32_t* metadata_length) {
+#ifndef NDEBUG
+  RETURN_NOT_OK(CheckAligned(dst));
+#endif
+
+  std::vector<std::shared_ptr<Buffer>> segments;
+  RETURN_NOT_OK(GetIpcPayloadSegments(payload, options, &segments, metadata_length));
+  RETURN_NOT_OK(dst->WriteBuffers(segments));
 
 #ifndef NDEBUG
   RETURN_NOT_OK(CheckAligned(dst));
@@ -888,7 +953,7 @@ int64_t GetPayloadSize(const IpcPayload& payload, const IpcWriteOptions& options
   const int32_t prefix_size = options.write_legacy_ipc_format ? 4 : 8;
   const int32_t flatbuffer_size = static_cast<int32_t>(payload.metadata->size());
   const int32_t padded_message_length = static_cast<int32_t>(
-      PaddedLength(flatbuffer_size + prefix_size, options.alignment));
+      PaddedLength(flatbuffer_size + prefix_size, MessageAlignment(options)));
   // body_length already accounts for padding
   return payload.body_length + padded_message_length;
 }
@@ -1020,6 +1085,7 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
       // If a dictionary with this id was already emitted, check if it was the same.
       auto* last_dictionary = &last_dictionaries_[dictionary_id];
       const bool dictionary_exists = (*last_dictionary != nullptr);
+      bool is_delta = false;
       if (dictionary_exists) {
         if ((*last_dictionary)->data() == dictionary->data()) {
           // Fast shortcut for a common case.
@@ -1032,7 +1098,9 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
           //  for the IPC file format)
           continue;
         }
-        // TODO check for possible delta?
+        if (options_.emit_dictionary_deltas && !is_file_format_) {
+          is_delta = IsDictionaryDelta(**last_dictionary, *dictionary);
+        }
       }
 
       if (is_file_format_ && dictionary_exists) {
@@ -1042,7 +1110,15 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
             "accross all batches.");
       }
 
-      RETURN_NOT_OK(GetDictionaryPayload(dictionary_id, dictionary, options_, &payload));
+      if (is_delta) {
+        // Only the entries appended since the last dictionary are sent
+        RETURN_NOT_OK(GetDictionaryPayload(
+            dictionary_id, /*is_delta=*/true,
+            dictionary->Slice((*last_dictionary)->length()), options_, &payload));
+      } else {
+        RETURN_NOT_OK(
+            GetDictionaryPayload(dictionary_id, dictionary, options_, &payload));
+      }
       RETURN_NOT_OK(payload_writer_->WritePayload(payload));
 
       // Remember dictionary for next batches
@@ -1051,6 +1127,13 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
     return Status::OK();
   }
 
+  // Whether `dictionary` only appends entries to `last_dictionary`
+  static bool IsDictionaryDelta(const Array& last_dictionary, const Array& dictionary) {
+    return dictionary.length() > last_dictionary.length() &&
+           dictionary.type()->Equals(*last_dictionary.type()) &&
+           dictionary.RangeEquals(0, last_dictionary.length(), 0, last_dictionary);
+  }
+
   std::unique_ptr<IpcPayloadWriter> payload_writer_;
   std::shared_ptr<Schema> shared_schema_;
   const Schema& schema_;
@@ -1091,7 +1174,7 @@ class StreamBookKeeper {
     // 8-byte (or other alignment) boundaries.
     int64_t remainder = PaddedLength(position_, alignment) - position_;
     if (remainder > 0) {
-      return Write(kPaddingBytes, remainder);
+      return Write(PaddingSegment(remainder)->data(), remainder);
     }
     return Status::OK();
   }
@@ -1182,6 +1265,11 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
         break;
       case MessageType::RECORD_BATCH:
         record_batches_.push_back(block);
+        if (options_.write_record_batch_lengths) {
+          // The metadata was serialized by us, no need to verify it
+          const auto message = flatbuf::GetMessage(payload.metadata->data());
+          record_batch_lengths_.push_back(message->header_as_RecordBatch()->length());
+        }
         break;
       default:
         break;
@@ -1196,9 +1284,10 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
     // written to new files.
     RETURN_NOT_OK(UpdatePosition());
 
-    // It is only necessary to align to 8-byte boundary at the start of the file
+    // It is only necessary to align to 8-byte boundary at the start of the file,
+    // unless message bodies must be aligned further
     RETURN_NOT_OK(Write(kArrowMagicBytes, strlen(kArrowMagicBytes)));
-    RETURN_NOT_OK(Align());
+    RETURN_NOT_OK(Align(std::max(kArrowIpcAlignment, options_.body_alignment)));
 
     return Status::OK();
   }
@@ -1210,8 +1299,27 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
     // Write file footer
     RETURN_NOT_OK(UpdatePosition());
     int64_t initial_position = position_;
+    auto metadata = metadata_;
+    const bool write_body_alignment = options_.body_alignment > kArrowIpcAlignment;
+    if (options_.write_record_batch_lengths || write_body_alignment) {
+      auto footer_metadata =
+          metadata_ ? metadata_->Copy() : std::make_shared<KeyValueMetadata>();
+      if (options_.write_record_batch_lengths) {
+        std::stringstream ss;
+        for (size_t i = 0; i < record_batch_lengths_.size(); ++i) {
+          if (i > 0) ss << ",";
+          ss << record_batch_lengths_[i];
+        }
+        footer_metadata->Append(internal::kRecordBatchLengthsKey, ss.str());
+      }
+      if (write_body_alignment) {
+        footer_metadata->Append(internal::kBodyAlignmentKey,
+                                std::to_string(options_.body_alignment));
+      }
+      metadata = std::move(footer_metadata);
+    }
     RETURN_NOT_OK(
-        WriteFileFooter(*schema_, dictionaries_, record_batches_, metadata_, sink_));
+        WriteFileFooter(*schema_, dictionaries_, record_batches_, metadata, sink_));
 
     // Write footer length
     RETURN_NOT_OK(UpdatePosition());
@@ -1233,6 +1341,7 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
   std::shared_ptr<const KeyValueMetadata> metadata_;
   std::vector<FileBlock> dictionaries_;
   std::vector<FileBlock> record_batches_;
+  std::vector<int64_t> record_batch_lengths_;
 };
 
 }  // namespace internal
@@ -1240,6 +1349,7 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
 Result<std::shared_ptr<RecordBatchWriter>> MakeStreamWriter(
     io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options) {
+  RETURN_NOT_OK(CheckBodyAlignment(options));
   return std::make_shared<internal::IpcFormatWriter>(
       ::arrow::internal::make_unique<internal::PayloadStreamWriter>(sink, options),
       schema, options, /*is_file_format=*/false);
@@ -1248,6 +1358,7 @@ Result<std::shared_ptr<RecordBatchWriter>> MakeStreamWriter(
 Result<std::shared_ptr<RecordBatchWriter>> MakeStreamWriter(
     std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options) {
+  RETURN_NOT_OK(CheckBodyAlignment(options));
   return std::make_shared<internal::IpcFormatWriter>(
       ::arrow::internal::make_unique<internal::PayloadStreamWriter>(std::move(sink),
                                                                     options),
@@ -1264,6 +1375,7 @@ Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options,
     const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  RETURN_NOT_OK(CheckBodyAlignment(options));
   return std::make_shared<internal::IpcFormatWriter>(
       ::arrow::internal::make_unique<internal::PayloadFileWriter>(options, schema,
                                                                   metadata, sink),
@@ -1274,6 +1386,7 @@ Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options,
     const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  RETURN_NOT_OK(CheckBodyAlignment(options));
   return std::make_shared<internal::IpcFormatWriter>(
       ::arrow::internal::make_unique<internal::PayloadFileWriter>(
           options, schema, metadata, std::move(sink)),
@@ -1292,6 +1405,7 @@ namespace internal {
 Result<std::unique_ptr<RecordBatchWriter>> OpenRecordBatchWriter(
     std::unique_ptr<IpcPayloadWriter> sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options) {
+  RETURN_NOT_OK(CheckBodyAlignment(options));
   // XXX should we call Start()?
   return ::arrow::internal::make_unique<internal::IpcFormatWriter>(
       std::move(sink), schema, options, /*is_file_format=*/false);
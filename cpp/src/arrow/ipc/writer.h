@@ -354,7 +354,29 @@ ARROW_EXPORT
 Status GetRecordBatchPayload(const RecordBatch& batch, const IpcWriteOptions& options,
                              IpcPayload* out);
 
+/// \brief Split the encapsulated IPC message for a payload into the buffers
+/// that make it up, without copying any of the payload's buffers.
+///
+/// The segments are the message prefix, the metadata, the body buffers and the
+/// padding between them; writing them out in order produces the same bytes as
+/// WriteIpcPayload(). This lets transports send the body buffers directly,
+/// e.g. with writev() or as gRPC slices.
+///
+/// \param[in] payload the payload to split
+/// \param[in] options options for serialization
+/// \param[out] segments the buffers to write, in order
+/// \param[out] metadata_length the length of the serialized metadata
+/// \return Status
+ARROW_EXPORT
+Status GetIpcPayloadSegments(const IpcPayload& payload, const IpcWriteOptions& options,
+                             std::vector<std::shared_ptr<Buffer>>* segments,
+                             int32_t* metadata_length);
+
 /// \brief Write an IPC payload to the given stream.
+///
+/// The payload is handed to the stream as a single OutputStream::WriteBuffers()
+/// call, so streams able to avoid copying buffers can do so.
+///
 /// \param[in] payload the payload to write
 /// \param[in] options options for serialization
 /// \param[in] dst The stream to write the payload to.
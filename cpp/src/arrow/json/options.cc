@@ -24,5 +24,7 @@ ParseOptions ParseOptions::Defaults() { return ParseOptions(); }
 
 ReadOptions ReadOptions::Defaults() { return ReadOptions(); }
 
+WriteOptions WriteOptions::Defaults() { return WriteOptions(); }
+
 }  // namespace json
 }  // namespace arrow
@@ -69,5 +69,19 @@ struct ARROW_EXPORT ReadOptions {
   static ReadOptions Defaults();
 };
 
+struct ARROW_EXPORT WriteOptions {
+  /// Maximum number of rows formatted at a time
+  ///
+  /// Within each batch of rows, columns are formatted in parallel if
+  /// use_threads is true.
+  int32_t batch_size = 1024;
+
+  /// Whether to use the global CPU thread pool
+  bool use_threads = true;
+
+  /// Create write options with default values
+  static WriteOptions Defaults();
+};
+
 }  // namespace json
 }  // namespace arrow
@@ -17,6 +17,7 @@
 
 #include "arrow/json/parser.h"
 
+#include <algorithm>
 #include <functional>
 #include <limits>
 #include <tuple>
@@ -34,6 +35,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/type.h"
 #include "arrow/util/bitset_stack.h"
+#include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
 #include "arrow/util/string_view.h"
@@ -318,33 +320,47 @@ class RawArrayBuilder<Kind::kObject> {
  public:
   explicit RawArrayBuilder(MemoryPool* pool) : null_bitmap_builder_(pool) {}
 
-  Status Append() { return null_bitmap_builder_.Append(true); }
+  Status Append() {
+    next_field_index_ = 0;
+    return null_bitmap_builder_.Append(true);
+  }
 
   Status AppendNull() { return null_bitmap_builder_.Append(false); }
 
   Status AppendNull(int64_t count) { return null_bitmap_builder_.Append(count, false); }
 
   std::string FieldName(int i) const {
-    for (const auto& name_index : name_to_index_) {
-      if (name_index.second == i) {
-        return name_index.first;
-      }
-    }
-    return "";
+    return (i >= 0 && i < num_fields()) ? field_names_[i] : "";
   }
 
-  int GetFieldIndex(const std::string& name) const {
-    auto it = name_to_index_.find(name);
-    if (it == name_to_index_.end()) {
+  /// \brief Return the index of the named field, or -1 if there is none
+  ///
+  /// Fields usually appear in the same order in every object, so the field
+  /// following the last one found is tried before any hash lookup.
+  int GetFieldIndex(string_view name) {
+    if (next_field_index_ < num_fields() && field_names_[next_field_index_] == name) {
+      return next_field_index_++;
+    }
+    if (!MayHaveFieldNameOfLength(name.size())) {
+      // Fast path for unexpected fields
       return -1;
     }
-    return it->second;
+    auto range = hash_to_index_.equal_range(HashName(name));
+    for (auto it = range.first; it != range.second; ++it) {
+      if (field_names_[it->second] == name) {
+        next_field_index_ = it->second + 1;
+        return it->second;
+      }
+    }
+    return -1;
   }
 
   int AddField(std::string name, BuilderPtr builder) {
     auto index = num_fields();
     field_builders_.push_back(builder);
-    name_to_index_.emplace(std::move(name), index);
+    name_lengths_mask_ |= NameLengthBit(name.size());
+    hash_to_index_.emplace(HashName(name), index);
+    field_names_.push_back(std::move(name));
     return index;
   }
 
@@ -361,18 +377,13 @@ class RawArrayBuilder<Kind::kObject> {
     std::shared_ptr<Buffer> null_bitmap;
     RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
 
-    std::vector<string_view> field_names(num_fields());
-    for (const auto& name_index : name_to_index_) {
-      field_names[name_index.second] = name_index.first;
-    }
-
     std::vector<std::shared_ptr<Field>> fields(num_fields());
     std::vector<std::shared_ptr<ArrayData>> child_data(num_fields());
     for (int i = 0; i < num_fields(); ++i) {
       std::shared_ptr<Array> field_values;
       RETURN_NOT_OK(finish_child(field_builders_[i], &field_values));
       child_data[i] = field_values->data();
-      fields[i] = field(std::string(field_names[i]), field_values->type(),
+      fields[i] = field(field_names_[i], field_values->type(),
                         field_builders_[i].nullable, Kind::Tag(field_builders_[i].kind));
     }
 
@@ -384,8 +395,27 @@ class RawArrayBuilder<Kind::kObject> {
   int64_t length() { return null_bitmap_builder_.length(); }
 
  private:
+  static internal::hash_t HashName(string_view name) {
+    return internal::ScalarHelper<string_view>::ComputeHash(name);
+  }
+
+  // Lengths of 63 and more share the last bit
+  static uint64_t NameLengthBit(size_t length) {
+    return uint64_t(1) << std::min<size_t>(length, 63);
+  }
+
+  bool MayHaveFieldNameOfLength(size_t length) const {
+    return (name_lengths_mask_ & NameLengthBit(length)) != 0;
+  }
+
   std::vector<BuilderPtr> field_builders_;
-  std::unordered_map<std::string, int> name_to_index_;
+  std::vector<std::string> field_names_;
+  // Hashing a string_view avoids allocating a std::string for each key looked up
+  std::unordered_multimap<internal::hash_t, int> hash_to_index_;
+  // A bit is set for each length of field names
+  uint64_t name_lengths_mask_ = 0;
+  // The index of the field expected to come next in the current object
+  int next_field_index_ = 0;
   TypedBufferBuilder<bool> null_bitmap_builder_;
 };
 
@@ -745,7 +775,7 @@ class HandlerBase : public BlockParser,
   /// there is no field with that name
   bool SetFieldBuilder(string_view key, bool* duplicate_keys) {
     auto parent = Cast<Kind::kObject>(builder_stack_.back());
-    field_index_ = parent->GetFieldIndex(std::string(key));
+    field_index_ = parent->GetFieldIndex(key);
     if (ARROW_PREDICT_FALSE(field_index_ == -1)) {
       return false;
     }
@@ -18,6 +18,7 @@
 #include "benchmark/benchmark.h"
 
 #include <string>
+#include <vector>
 
 #include "arrow/json/chunker.h"
 #include "arrow/json/options.h"
@@ -50,6 +51,26 @@ std::string TestJsonData(int num_rows, bool pretty = false) {
   return json;
 }
 
+// Rows with many fields, only a few of which are in TestSchema()
+std::string WideTestJsonData(int num_rows, int num_fields) {
+  std::vector<std::shared_ptr<Field>> fields = TestSchema()->fields();
+  for (int i = static_cast<int>(fields.size()); i < num_fields; ++i) {
+    fields.push_back(field("field" + std::to_string(i), i % 2 ? int32() : utf8()));
+  }
+  auto wide_schema = schema(std::move(fields));
+
+  std::default_random_engine engine(seed);
+  std::string json;
+  for (int i = 0; i < num_rows; ++i) {
+    StringBuffer sb;
+    Writer writer(sb);
+    ABORT_NOT_OK(Generate(wide_schema, engine, &writer));
+    json += sb.GetString();
+    json += "\n";
+  }
+  return json;
+}
+
 static void BenchmarkJSONChunking(benchmark::State& state,
                                   const std::shared_ptr<Buffer>& json,
                                   ParseOptions options) {  // NOLINT non-const reference
@@ -113,6 +134,17 @@ static void ParseJSONBlockWithSchema(
   BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
 }
 
+static void ParseJSONBlockIgnoringFields(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int32_t num_rows = 1000;
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  options.explicit_schema = TestSchema();
+
+  auto json = WideTestJsonData(num_rows, /*num_fields=*/100);
+  BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
+}
+
 static void BenchmarkJSONReading(benchmark::State& state,  // NOLINT non-const reference
                                  const std::string& json, int32_t num_rows,
                                  ReadOptions read_options, ParseOptions parse_options) {
@@ -156,6 +188,7 @@ static void ReadJSONBlockWithSchemaMultiThread(
 BENCHMARK(ChunkJSONPrettyPrinted);
 BENCHMARK(ChunkJSONLineDelimited);
 BENCHMARK(ParseJSONBlockWithSchema);
+BENCHMARK(ParseJSONBlockIgnoringFields);
 
 BENCHMARK(ReadJSONBlockWithSchemaSingleThread);
 BENCHMARK(ReadJSONBlockWithSchemaMultiThread)->UseRealTime();
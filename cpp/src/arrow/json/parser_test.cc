@@ -130,6 +130,19 @@ TEST(BlockParserWithSchema, SkipFieldsOutsideSchema) {
                       "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
 }
 
+TEST(BlockParserWithSchema, FieldsInVaryingOrder) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema = schema({field("a", int32()), field("bb", utf8())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  AssertParseColumns(options, R"({"a": 1, "x": 0, "bb": "one", "yy": {"a": 5}}
+{"bb": "two", "zzz": [1], "a": 2}
+{"yy": null, "a": 3}
+{"a": 4, "bb": "four"}
+)",
+                     {field("a", utf8()), field("bb", utf8())},
+                     {R"(["1", "2", "3", "4"])", R"(["one", "two", null, "four"])"});
+}
+
 class BlockParserTypeError : public ::testing::TestWithParam<UnexpectedFieldBehavior> {
  public:
   ParseOptions Options(std::shared_ptr<Schema> explicit_schema) {
@@ -17,6 +17,8 @@
 
 #include "arrow/json/reader.h"
 
+#include <algorithm>
+#include <deque>
 #include <utility>
 #include <vector>
 
@@ -29,8 +31,10 @@
 #include "arrow/json/parser.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
+#include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/string_view.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
@@ -45,6 +49,75 @@ using internal::ThreadPool;
 
 namespace json {
 
+namespace {
+
+std::shared_ptr<DataType> TargetType(const ParseOptions& options) {
+  return options.explicit_schema ? struct_(options.explicit_schema->fields())
+                                 : struct_({});
+}
+
+const PromotionGraph* TargetPromotionGraph(const ParseOptions& options) {
+  return options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
+             ? GetPromotionGraph()
+             : nullptr;
+}
+
+// Parse the object straddling the previous block (partial + completion)
+// followed by the whole objects of the current block
+Result<std::shared_ptr<Array>> ParseBlock(MemoryPool* pool, const ParseOptions& options,
+                                          const std::shared_ptr<Buffer>& partial,
+                                          const std::shared_ptr<Buffer>& completion,
+                                          const std::shared_ptr<Buffer>& whole) {
+  std::unique_ptr<BlockParser> parser;
+  RETURN_NOT_OK(BlockParser::Make(pool, options, &parser));
+  RETURN_NOT_OK(
+      parser->ReserveScalarStorage(partial->size() + completion->size() + whole->size()));
+
+  if (partial->size() != 0 || completion->size() != 0) {
+    std::shared_ptr<Buffer> straddling;
+    if (partial->size() == 0) {
+      straddling = completion;
+    } else if (completion->size() == 0) {
+      straddling = partial;
+    } else {
+      ARROW_ASSIGN_OR_RAISE(straddling, ConcatenateBuffers({partial, completion}, pool));
+    }
+    RETURN_NOT_OK(parser->Parse(straddling));
+  }
+
+  if (whole->size() != 0) {
+    RETURN_NOT_OK(parser->Parse(whole));
+  }
+
+  std::shared_ptr<Array> parsed;
+  RETURN_NOT_OK(parser->Finish(&parsed));
+  return parsed;
+}
+
+// Convert a single parsed block to a RecordBatch
+Result<std::shared_ptr<RecordBatch>> ConvertBlock(MemoryPool* pool,
+                                                  const ParseOptions& options,
+                                                  const std::shared_ptr<Array>& parsed) {
+  std::shared_ptr<ChunkedArrayBuilder> builder;
+  RETURN_NOT_OK(MakeChunkedArrayBuilder(internal::TaskGroup::MakeSerial(), pool,
+                                        TargetPromotionGraph(options),
+                                        TargetType(options), &builder));
+
+  builder->Insert(0, field("", parsed->type()), parsed);
+  std::shared_ptr<ChunkedArray> converted_chunked;
+  RETURN_NOT_OK(builder->Finish(&converted_chunked));
+  auto converted = static_cast<const StructArray*>(converted_chunked->chunk(0).get());
+
+  std::vector<std::shared_ptr<Array>> columns(converted->num_fields());
+  for (int i = 0; i < converted->num_fields(); ++i) {
+    columns[i] = converted->field(i);
+  }
+  return RecordBatch::Make(schema(converted->type()->fields()), converted->length(),
+                           std::move(columns));
+}
+
+}  // namespace
+
 class TableReaderImpl : public TableReader,
                         public std::enable_shared_from_this<TableReaderImpl> {
  public:
@@ -113,45 +186,16 @@ class TableReaderImpl : public TableReader,
 
  private:
   Status MakeBuilder() {
-    auto type = parse_options_.explicit_schema
-                    ? struct_(parse_options_.explicit_schema->fields())
-                    : struct_({});
-
-    auto promotion_graph =
-        parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
-            ? GetPromotionGraph()
-            : nullptr;
-
-    return MakeChunkedArrayBuilder(task_group_, pool_, promotion_graph, type, &builder_);
+    return MakeChunkedArrayBuilder(task_group_, pool_,
+                                   TargetPromotionGraph(parse_options_),
+                                   TargetType(parse_options_), &builder_);
   }
 
   Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
                         const std::shared_ptr<Buffer>& completion,
                         const std::shared_ptr<Buffer>& whole, int64_t block_index) {
-    std::unique_ptr<BlockParser> parser;
-    RETURN_NOT_OK(BlockParser::Make(pool_, parse_options_, &parser));
-    RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
-                                               whole->size()));
-
-    if (partial->size() != 0 || completion->size() != 0) {
-      std::shared_ptr<Buffer> straddling;
-      if (partial->size() == 0) {
-        straddling = completion;
-      } else if (completion->size() == 0) {
-        straddling = partial;
-      } else {
-        ARROW_ASSIGN_OR_RAISE(straddling,
-                              ConcatenateBuffers({partial, completion}, pool_));
-      }
-      RETURN_NOT_OK(parser->Parse(straddling));
-    }
-
-    if (whole->size() != 0) {
-      RETURN_NOT_OK(parser->Parse(whole));
-    }
-
-    std::shared_ptr<Array> parsed;
-    RETURN_NOT_OK(parser->Finish(&parsed));
+    ARROW_ASSIGN_OR_RAISE(auto parsed,
+                          ParseBlock(pool_, parse_options_, partial, completion, whole));
     builder_->Insert(block_index, field("", parsed->type()), parsed);
     return Status::OK();
   }
@@ -189,6 +233,176 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
   return TableReader::Make(pool, input, read_options, parse_options).Value(out);
 }
 
+class StreamingReaderImpl : public StreamingReader {
+ public:
+  StreamingReaderImpl(MemoryPool* pool, const ReadOptions& read_options,
+                      const ParseOptions& parse_options, ThreadPool* thread_pool)
+      : pool_(pool),
+        read_options_(read_options),
+        parse_options_(parse_options),
+        chunker_(MakeChunker(parse_options_)),
+        thread_pool_(thread_pool),
+        max_blocks_in_flight_(
+            thread_pool == nullptr ? 1 : std::max(thread_pool->GetCapacity(), 1)) {}
+
+  ~StreamingReaderImpl() override {
+    // Make sure pending tasks are finished before destroying members
+    for (auto& converted : converting_) {
+      converted.Wait();
+    }
+  }
+
+  Status Init(std::shared_ptr<io::InputStream> input) {
+    ARROW_ASSIGN_OR_RAISE(auto it,
+                          io::MakeInputStreamIterator(input, read_options_.block_size));
+    ARROW_ASSIGN_OR_RAISE(block_iterator_,
+                          MakeReadaheadIterator(std::move(it), max_blocks_in_flight_));
+
+    ARROW_ASSIGN_OR_RAISE(block_, block_iterator_.Next());
+    if (block_ == nullptr) {
+      return Status::Invalid("Empty JSON file");
+    }
+    partial_ = std::make_shared<Buffer>("");
+
+    // The first block is converted eagerly, as it determines the schema
+    ARROW_ASSIGN_OR_RAISE(auto first, NextBlock());
+    DCHECK(first.has_value());
+    ARROW_ASSIGN_OR_RAISE(pending_batch_, ParseAndConvert(parse_options_, *first));
+    schema_ = pending_batch_->schema();
+
+    // Subsequent blocks are converted to the same schema
+    block_options_ = parse_options_;
+    block_options_.explicit_schema = schema_;
+    if (block_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType) {
+      block_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    // Blocks without any object (e.g. trailing whitespace) are skipped
+    do {
+      RETURN_NOT_OK(ReadNextBlock().Value(out));
+    } while (*out != nullptr && (*out)->num_rows() == 0);
+    return Status::OK();
+  }
+
+ private:
+  struct JSONBlock {
+    // The beginning of the object straddling the previous block, and its end
+    // at the beginning of this block
+    std::shared_ptr<Buffer> partial, completion;
+    // The whole objects in this block
+    std::shared_ptr<Buffer> whole;
+  };
+
+  // Split the current block with the chunker, reading the next one
+  // to find out whether it is the last.  Chunking is cheap compared to
+  // parsing and is done on the calling thread.
+  Result<util::optional<JSONBlock>> NextBlock() {
+    if (block_ == nullptr) {
+      return util::nullopt;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto next_block, block_iterator_.Next());
+
+    JSONBlock out;
+    out.partial = partial_;
+    std::shared_ptr<Buffer> next_partial;
+    if (next_block == nullptr) {
+      // End of file reached => compute completion from penultimate block
+      RETURN_NOT_OK(
+          chunker_->ProcessFinal(partial_, block_, &out.completion, &out.whole));
+    } else {
+      std::shared_ptr<Buffer> starts_with_whole;
+      RETURN_NOT_OK(chunker_->ProcessWithPartial(partial_, block_, &out.completion,
+                                                 &starts_with_whole));
+      RETURN_NOT_OK(chunker_->Process(starts_with_whole, &out.whole, &next_partial));
+    }
+    partial_ = std::move(next_partial);
+    block_ = std::move(next_block);
+    return out;
+  }
+
+  Result<std::shared_ptr<RecordBatch>> ParseAndConvert(const ParseOptions& options,
+                                                       const JSONBlock& block) {
+    ARROW_ASSIGN_OR_RAISE(auto parsed, ParseBlock(pool_, options, block.partial,
+                                                  block.completion, block.whole));
+    return ConvertBlock(pool_, options, parsed);
+  }
+
+  Result<std::shared_ptr<RecordBatch>> ReadNextBlock() {
+    if (pending_batch_ != nullptr) {
+      return std::move(pending_batch_);
+    }
+    if (thread_pool_ == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(auto block, NextBlock());
+      if (!block.has_value()) {
+        return nullptr;
+      }
+      return ParseAndConvert(block_options_, *block);
+    }
+
+    // Keep a bounded number of blocks being converted ahead of the consumer
+    while (source_status_.ok() &&
+           static_cast<int32_t>(converting_.size()) < max_blocks_in_flight_) {
+      auto maybe_block = NextBlock();
+      if (!maybe_block.ok()) {
+        // Report the error once all previous blocks have been yielded
+        source_status_ = maybe_block.status();
+        break;
+      }
+      auto block = maybe_block.MoveValueUnsafe();
+      if (!block.has_value()) {
+        break;
+      }
+      ARROW_ASSIGN_OR_RAISE(auto converted, thread_pool_->Submit([this, block]() {
+        return ParseAndConvert(block_options_, *block);
+      }));
+      converting_.push_back(std::move(converted));
+    }
+
+    if (converting_.empty()) {
+      auto st = std::move(source_status_);
+      source_status_ = Status::OK();
+      RETURN_NOT_OK(st);
+      return nullptr;
+    }
+    auto converted = std::move(converting_.front());
+    converting_.pop_front();
+    return converted.result();
+  }
+
+  MemoryPool* pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  // Options for blocks after the first, with the schema fixed
+  ParseOptions block_options_;
+  std::unique_ptr<Chunker> chunker_;
+  ThreadPool* thread_pool_;
+  // Maximum number of blocks read or converted but not yet yielded
+  const int32_t max_blocks_in_flight_;
+
+  Iterator<std::shared_ptr<Buffer>> block_iterator_;
+  std::shared_ptr<Buffer> block_, partial_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RecordBatch> pending_batch_;
+  // Blocks being parsed and converted, in file order
+  std::deque<Future<std::shared_ptr<RecordBatch>>> converting_;
+  Status source_status_;
+};
+
+Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
+    MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+    const ReadOptions& read_options, const ParseOptions& parse_options) {
+  auto ptr = std::make_shared<StreamingReaderImpl>(
+      pool, read_options, parse_options,
+      read_options.use_threads ? GetCpuThreadPool() : nullptr);
+  RETURN_NOT_OK(ptr->Init(std::move(input)));
+  return ptr;
+}
+
 Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
                                               std::shared_ptr<Buffer> json) {
   std::unique_ptr<BlockParser> parser;
@@ -196,29 +410,7 @@ Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
   RETURN_NOT_OK(parser->Parse(json));
   std::shared_ptr<Array> parsed;
   RETURN_NOT_OK(parser->Finish(&parsed));
-
-  auto type =
-      options.explicit_schema ? struct_(options.explicit_schema->fields()) : struct_({});
-  auto promotion_graph =
-      options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
-          ? GetPromotionGraph()
-          : nullptr;
-  std::shared_ptr<ChunkedArrayBuilder> builder;
-  RETURN_NOT_OK(MakeChunkedArrayBuilder(internal::TaskGroup::MakeSerial(),
-                                        default_memory_pool(), promotion_graph, type,
-                                        &builder));
-
-  builder->Insert(0, field("", type), parsed);
-  std::shared_ptr<ChunkedArray> converted_chunked;
-  RETURN_NOT_OK(builder->Finish(&converted_chunked));
-  auto converted = static_cast<const StructArray*>(converted_chunked->chunk(0).get());
-
-  std::vector<std::shared_ptr<Array>> columns(converted->num_fields());
-  for (int i = 0; i < converted->num_fields(); ++i) {
-    columns[i] = converted->field(i);
-  }
-  return RecordBatch::Make(schema(converted->type()->fields()), converted->length(),
-                           std::move(columns));
+  return ConvertBlock(default_memory_pool(), options, parsed);
 }
 
 }  // namespace json
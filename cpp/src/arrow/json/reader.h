@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "arrow/json/options.h"
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
@@ -65,6 +66,27 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// \brief A class that reads line-separated JSON objects as a stream of RecordBatches
+///
+/// Experimental.  Each block of the input (see ReadOptions::block_size) yields
+/// one RecordBatch.  The schema is inferred from the first block; subsequent
+/// blocks are converted to that schema and any field not present in it is
+/// ignored (unless ParseOptions::unexpected_field_behavior is Error).
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  virtual ~StreamingReader() = default;
+
+  /// Create a StreamingReader instance
+  ///
+  /// The first block is read and converted before returning.  If
+  /// ReadOptions::use_threads is true, a bounded number of upcoming blocks
+  /// are parsed and converted on the global CPU thread pool.  Batches are
+  /// always yielded in file order.
+  static Result<std::shared_ptr<StreamingReader>> Make(
+      MemoryPool* pool, std::shared_ptr<io::InputStream> input, const ReadOptions&,
+      const ParseOptions&);
+};
+
 ARROW_EXPORT Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
                                                            std::shared_ptr<Buffer> json);
 
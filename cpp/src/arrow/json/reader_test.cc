@@ -284,5 +284,138 @@ TEST(ReaderTest, ListArrayWithFewValues) {
   AssertTablesEqual(*actual_table, *expected_table);
 }
 
+class StreamingReaderTest : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUpReader(util::string_view input) {
+    read_options_.use_threads = GetParam();
+    ASSERT_OK(MakeStream(input, &input_));
+    ASSERT_OK_AND_ASSIGN(reader_, StreamingReader::Make(default_memory_pool(), input_,
+                                                        read_options_, parse_options_));
+  }
+
+  ParseOptions parse_options_ = ParseOptions::Defaults();
+  ReadOptions read_options_ = ReadOptions::Defaults();
+  std::shared_ptr<io::InputStream> input_;
+  std::shared_ptr<StreamingReader> reader_;
+};
+
+INSTANTIATE_TEST_SUITE_P(StreamingReaderTest, StreamingReaderTest,
+                         ::testing::Values(false, true));
+
+TEST_P(StreamingReaderTest, Empty) {
+  read_options_.use_threads = GetParam();
+  ASSERT_OK(MakeStream("", &input_));
+  ASSERT_RAISES(Invalid, StreamingReader::Make(default_memory_pool(), input_,
+                                               read_options_, parse_options_));
+}
+
+TEST_P(StreamingReaderTest, MultipleBlocks) {
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+
+  auto src = scalars_only_src();
+  read_options_.block_size = static_cast<int>(src.length() / 3);
+  SetUpReader(src);
+
+  auto schema = ::arrow::schema(
+      {field("hello", float64()), field("world", boolean()), field("yo", utf8())});
+  AssertSchemaEqual(*schema, *reader_->schema());
+
+  // the trailing whitespace block does not produce an empty batch
+  std::vector<std::string> expected = {
+      R"([{"hello": 3.5, "world": false, "yo": "thing"}])",
+      R"([{"hello": 3.25, "world": null, "yo": null}])",
+      "[{\"hello\": 3.125, \"world\": null, \"yo\": \"\xe5\xbf\x8d\"},"
+      " {\"hello\": 0.0, \"world\": true, \"yo\": null}]",
+  };
+  std::shared_ptr<RecordBatch> batch;
+  for (const auto& json : expected) {
+    ASSERT_OK(reader_->ReadNext(&batch));
+    ASSERT_NE(batch, nullptr);
+    AssertBatchesEqual(*RecordBatchFromJSON(schema, json), *batch);
+  }
+  ASSERT_OK(reader_->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
+TEST_P(StreamingReaderTest, SchemaFromFirstBlock) {
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  // The second block has a field missing from the first one, which is ignored,
+  // and an integer that is converted to the inferred floating-point type.
+  std::string first = R"({"a": 1.5, "b": "x"})"
+                      "\n";
+  std::string second = R"({"a": 2, "c": true})"
+                       "\n";
+  read_options_.block_size = static_cast<int>(first.length());
+  SetUpReader(first + second);
+
+  auto schema = ::arrow::schema({field("a", float64()), field("b", utf8())});
+  AssertSchemaEqual(*schema, *reader_->schema());
+
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatchReader(reader_.get()));
+  ASSERT_OK_AND_ASSIGN(auto expected,
+                       Table::FromRecordBatches(
+                           {RecordBatchFromJSON(schema, R"([{"a": 1.5, "b": "x"}])"),
+                            RecordBatchFromJSON(schema, R"([{"a": 2.0, "b": null}])")}));
+  AssertTablesEqual(*expected, *table);
+}
+
+TEST_P(StreamingReaderTest, ConversionError) {
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  std::string first = R"({"a": 1})"
+                      "\n";
+  std::string second = R"({"a": "x"})"
+                       "\n";
+  read_options_.block_size = static_cast<int>(first.length());
+  SetUpReader(first + second);
+
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader_->ReadNext(&batch));
+  ASSERT_EQ(batch->num_rows(), 1);
+  ASSERT_RAISES(Invalid, reader_->ReadNext(&batch));
+}
+
+TEST(StreamingReaderTest, MultipleBlocksParallel) {
+  int64_t count = 1 << 10;
+
+  ParseOptions parse_options;
+  parse_options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  ReadOptions read_options;
+  read_options.block_size =
+      static_cast<int>(count / 2);  // there will be about two dozen blocks
+
+  std::string json;
+  for (int i = 0; i < count; ++i) {
+    json += "{\"a\":" + std::to_string(i) + "}\n";
+  }
+  std::shared_ptr<io::InputStream> input;
+  std::shared_ptr<StreamingReader> reader;
+
+  read_options.use_threads = true;
+  ASSERT_OK(MakeStream(json, &input));
+  ASSERT_OK_AND_ASSIGN(reader, StreamingReader::Make(default_memory_pool(), input,
+                                                     read_options, parse_options));
+  ASSERT_OK_AND_ASSIGN(auto threaded, Table::FromRecordBatchReader(reader.get()));
+
+  read_options.use_threads = false;
+  ASSERT_OK(MakeStream(json, &input));
+  ASSERT_OK_AND_ASSIGN(reader, StreamingReader::Make(default_memory_pool(), input,
+                                                     read_options, parse_options));
+  ASSERT_OK_AND_ASSIGN(auto serial, Table::FromRecordBatchReader(reader.get()));
+
+  ASSERT_GT(serial->column(0)->num_chunks(), 1);
+  ASSERT_EQ(serial->column(0)->type()->id(), Type::INT64);
+  int expected = 0;
+  for (auto chunk : serial->column(0)->chunks()) {
+    for (int64_t i = 0; i < chunk->length(); ++i) {
+      ASSERT_EQ(checked_cast<const Int64Array*>(chunk.get())->GetView(i), expected)
+          << " at index " << i;
+      ++expected;
+    }
+  }
+  ASSERT_EQ(expected, count);
+
+  AssertTablesEqual(*serial, *threaded);
+}
+
 }  // namespace json
 }  // namespace arrow
@@ -0,0 +1,594 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/writer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/formatting.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/string_view.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::StringFormatter;
+
+namespace json {
+
+namespace {
+
+constexpr char kNull[] = "null";
+
+constexpr char kHexDigits[] = "0123456789abcdef";
+
+inline bool NeedsEscaping(uint8_t c) { return c < 0x20 || c == '"' || c == '\\'; }
+
+// Append `value` as a JSON string literal
+Status AppendEscaped(util::string_view value, BufferBuilder* out) {
+  // Worst case: every character is escaped as \u00XX
+  RETURN_NOT_OK(out->Reserve(6 * static_cast<int64_t>(value.size()) + 2));
+  out->UnsafeAppend(1, '"');
+  auto data = reinterpret_cast<const uint8_t*>(value.data());
+  const auto end = data + value.size();
+  while (data < end) {
+    auto run_end = data;
+    while (run_end < end && !NeedsEscaping(*run_end)) {
+      ++run_end;
+    }
+    out->UnsafeAppend(data, run_end - data);
+    if (run_end == end) {
+      break;
+    }
+    const uint8_t c = *run_end;
+    char escaped[6] = {'\\', 0, 0, 0, 0, 0};
+    int64_t escaped_length = 2;
+    switch (c) {
+      case '"':
+      case '\\':
+        escaped[1] = static_cast<char>(c);
+        break;
+      case '\b':
+        escaped[1] = 'b';
+        break;
+      case '\f':
+        escaped[1] = 'f';
+        break;
+      case '\n':
+        escaped[1] = 'n';
+        break;
+      case '\r':
+        escaped[1] = 'r';
+        break;
+      case '\t':
+        escaped[1] = 't';
+        break;
+      default:
+        escaped[1] = 'u';
+        escaped[2] = '0';
+        escaped[3] = '0';
+        escaped[4] = kHexDigits[c >> 4];
+        escaped[5] = kHexDigits[c & 0xf];
+        escaped_length = 6;
+    }
+    out->UnsafeAppend(escaped, escaped_length);
+    data = run_end + 1;
+  }
+  out->UnsafeAppend(1, '"');
+  return Status::OK();
+}
+
+/////////////////////////////////////////////////////////////////////////
+// Value formatters: format all values of an array into contiguous JSON values
+
+class ValueFormatter {
+ public:
+  explicit ValueFormatter(MemoryPool* pool) : data_(pool) {}
+  virtual ~ValueFormatter() = default;
+
+  // Format the values of `array`, replacing any previously formatted values
+  Status Format(const Array& array) {
+    data_.Rewind(0);
+    offsets_.clear();
+    offsets_.reserve(array.length() + 1);
+    offsets_.push_back(0);
+    RETURN_NOT_OK(FormatValues(array));
+    DCHECK_EQ(static_cast<int64_t>(offsets_.size()), array.length() + 1);
+    return Status::OK();
+  }
+
+  util::string_view value(int64_t i) const {
+    return util::string_view(reinterpret_cast<const char*>(data_.data()) + offsets_[i],
+                             offsets_[i + 1] - offsets_[i]);
+  }
+
+  // The total size of the formatted values in [start, stop)
+  int64_t data_size(int64_t start, int64_t stop) const {
+    return offsets_[stop] - offsets_[start];
+  }
+
+ protected:
+  virtual Status FormatValues(const Array& array) = 0;
+
+  void FinishValue() { offsets_.push_back(data_.length()); }
+
+  Status AppendValue(util::string_view value) {
+    RETURN_NOT_OK(data_.Append(value.data(), static_cast<int64_t>(value.size())));
+    FinishValue();
+    return Status::OK();
+  }
+
+  Status AppendNull() { return AppendValue(kNull); }
+
+  BufferBuilder data_;
+  // The end offsets of values in data_, preceded by 0
+  std::vector<int64_t> offsets_;
+};
+
+class NullValueFormatter : public ValueFormatter {
+ public:
+  using ValueFormatter::ValueFormatter;
+
+ protected:
+  Status FormatValues(const Array& array) override {
+    for (int64_t i = 0; i < array.length(); ++i) {
+      RETURN_NOT_OK(AppendNull());
+    }
+    return Status::OK();
+  }
+};
+
+// Numbers, booleans and temporal values, using the fast formatters in
+// arrow/util/formatting.h.  Dates, times and timestamps are quoted.
+template <typename T>
+class PrimitiveValueFormatter : public ValueFormatter {
+ public:
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+  using value_type = typename StringFormatter<T>::value_type;
+
+  static constexpr bool kQuoted = is_date_type<T>::value || is_time_type<T>::value ||
+                                  is_timestamp_type<T>::value;
+
+  PrimitiveValueFormatter(MemoryPool* pool, const std::shared_ptr<DataType>& type)
+      : ValueFormatter(pool), formatter_(type) {}
+
+ protected:
+  Status FormatValues(const Array& array) override {
+    const auto& typed_array = checked_cast<const ArrayType&>(array);
+    auto append = [this](util::string_view formatted) {
+      if (kQuoted) {
+        RETURN_NOT_OK(data_.Reserve(static_cast<int64_t>(formatted.size()) + 2));
+        data_.UnsafeAppend(1, '"');
+        data_.UnsafeAppend(formatted.data(), static_cast<int64_t>(formatted.size()));
+        data_.UnsafeAppend(1, '"');
+        return Status::OK();
+      }
+      return data_.Append(formatted.data(), static_cast<int64_t>(formatted.size()));
+    };
+    for (int64_t i = 0; i < typed_array.length(); ++i) {
+      if (typed_array.IsNull(i) || !IsFinite(typed_array.Value(i))) {
+        RETURN_NOT_OK(AppendNull());
+        continue;
+      }
+      RETURN_NOT_OK(formatter_(typed_array.Value(i), append));
+      FinishValue();
+    }
+    return Status::OK();
+  }
+
+  // JSON has no representation for NaN or infinities
+  template <typename V>
+  static enable_if_t<std::is_floating_point<V>::value, bool> IsFinite(V value) {
+    return std::isfinite(value);
+  }
+
+  template <typename V>
+  static enable_if_t<!std::is_floating_point<V>::value, bool> IsFinite(V) {
+    return true;
+  }
+
+  StringFormatter<T> formatter_;
+};
+
+template <typename T>
+class StringValueFormatter : public ValueFormatter {
+ public:
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+  using ValueFormatter::ValueFormatter;
+
+ protected:
+  Status FormatValues(const Array& array) override {
+    const auto& typed_array = checked_cast<const ArrayType&>(array);
+    for (int64_t i = 0; i < typed_array.length(); ++i) {
+      if (typed_array.IsValid(i)) {
+        RETURN_NOT_OK(AppendEscaped(typed_array.GetView(i), &data_));
+        FinishValue();
+      } else {
+        RETURN_NOT_OK(AppendNull());
+      }
+    }
+    return Status::OK();
+  }
+};
+
+class Decimal128ValueFormatter : public ValueFormatter {
+ public:
+  using ValueFormatter::ValueFormatter;
+
+ protected:
+  Status FormatValues(const Array& array) override {
+    const auto& typed_array = checked_cast<const Decimal128Array&>(array);
+    for (int64_t i = 0; i < typed_array.length(); ++i) {
+      if (typed_array.IsValid(i)) {
+        RETURN_NOT_OK(AppendValue(typed_array.FormatValue(i)));
+      } else {
+        RETURN_NOT_OK(AppendNull());
+      }
+    }
+    return Status::OK();
+  }
+};
+
+Result<std::unique_ptr<ValueFormatter>> MakeValueFormatter(
+    const std::shared_ptr<DataType>& type, MemoryPool* pool);
+
+// Dictionary values are formatted once per dictionary, then copied for
+// each index
+class DictionaryValueFormatter : public ValueFormatter {
+ public:
+  DictionaryValueFormatter(MemoryPool* pool,
+                           std::unique_ptr<ValueFormatter> dictionary_formatter)
+      : ValueFormatter(pool), dictionary_formatter_(std::move(dictionary_formatter)) {}
+
+ protected:
+  Status FormatValues(const Array& array) override {
+    const auto& dict_array = checked_cast<const DictionaryArray&>(array);
+    if (dict_array.dictionary().get() != last_dictionary_) {
+      RETURN_NOT_OK(dictionary_formatter_->Format(*dict_array.dictionary()));
+      last_dictionary_ = dict_array.dictionary().get();
+    }
+    for (int64_t i = 0; i < dict_array.length(); ++i) {
+      if (dict_array.IsValid(i)) {
+        const int64_t index = dict_array.GetValueIndex(i);
+        RETURN_NOT_OK(AppendValue(dictionary_formatter_->value(index)));
+      } else {
+        RETURN_NOT_OK(AppendNull());
+      }
+    }
+    return Status::OK();
+  }
+
+  std::unique_ptr<ValueFormatter> dictionary_formatter_;
+  // The dictionary whose values are in dictionary_formatter_
+  const Array* last_dictionary_ = nullptr;
+};
+
+// List values are formatted together, then joined into JSON arrays
+template <typename T>
+class ListValueFormatter : public ValueFormatter {
+ public:
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+
+  ListValueFormatter(MemoryPool* pool, std::unique_ptr<ValueFormatter> values_formatter)
+      : ValueFormatter(pool), values_formatter_(std::move(values_formatter)) {}
+
+ protected:
+  Status FormatValues(const Array& array) override {
+    const auto& list_array = checked_cast<const ArrayType&>(array);
+    const int64_t length = list_array.length();
+    const int64_t values_start = length > 0 ? list_array.value_offset(0) : 0;
+    const int64_t values_stop = length > 0 ? list_array.value_offset(length) : 0;
+    RETURN_NOT_OK(values_formatter_->Format(
+        *list_array.values()->Slice(values_start, values_stop - values_start)));
+
+    for (int64_t i = 0; i < length; ++i) {
+      if (list_array.IsNull(i)) {
+        RETURN_NOT_OK(AppendNull());
+        continue;
+      }
+      const int64_t start = list_array.value_offset(i) - values_start;
+      const int64_t stop = start + list_array.value_length(i);
+      // Brackets and separators
+      const int64_t size = values_formatter_->data_size(start, stop) + stop - start + 2;
+      RETURN_NOT_OK(data_.Reserve(size));
+      data_.UnsafeAppend(1, '[');
+      for (int64_t j = start; j < stop; ++j) {
+        if (j != start) {
+          data_.UnsafeAppend(1, ',');
+        }
+        const auto value = values_formatter_->value(j);
+        data_.UnsafeAppend(value.data(), static_cast<int64_t>(value.size()));
+      }
+      data_.UnsafeAppend(1, ']');
+      FinishValue();
+    }
+    return Status::OK();
+  }
+
+  std::unique_ptr<ValueFormatter> values_formatter_;
+};
+
+// Formats fields as JSON object members, optionally in parallel
+class FieldsFormatter {
+ public:
+  static Result<std::unique_ptr<FieldsFormatter>> Make(const FieldVector& fields,
+                                                       MemoryPool* pool) {
+    std::unique_ptr<FieldsFormatter> formatter(new FieldsFormatter);
+    for (const auto& field : fields) {
+      BufferBuilder key(pool);
+      RETURN_NOT_OK(AppendEscaped(field->name(), &key));
+      RETURN_NOT_OK(key.Append(1, ':'));
+      formatter->keys_.emplace_back(reinterpret_cast<const char*>(key.data()),
+                                    key.length());
+      ARROW_ASSIGN_OR_RAISE(auto field_formatter,
+                            MakeValueFormatter(field->type(), pool));
+      formatter->formatters_.push_back(std::move(field_formatter));
+    }
+    return std::move(formatter);
+  }
+
+  // Format the field values of each object
+  Status Format(const ArrayVector& fields, bool use_threads) {
+    DCHECK_EQ(fields.size(), formatters_.size());
+    const int num_fields = static_cast<int>(fields.size());
+    return internal::OptionalParallelFor(
+        use_threads && num_fields > 1, num_fields,
+        [&](int i) -> Status { return formatters_[i]->Format(*fields[i]); });
+  }
+
+  // The size of the i-th object, including braces
+  int64_t object_size(int64_t i) const {
+    // Separators between members, and braces
+    int64_t size = std::max<int64_t>(static_cast<int64_t>(keys_.size()) - 1, 0) + 2;
+    for (size_t field_index = 0; field_index < keys_.size(); ++field_index) {
+      size += static_cast<int64_t>(keys_[field_index].size()) +
+              formatters_[field_index]->data_size(i, i + 1);
+    }
+    return size;
+  }
+
+  // Append the i-th object, after reserving object_size(i) bytes
+  void UnsafeAppendObject(int64_t i, BufferBuilder* out) const {
+    out->UnsafeAppend(1, '{');
+    for (size_t field_index = 0; field_index < keys_.size(); ++field_index) {
+      if (field_index != 0) {
+        out->UnsafeAppend(1, ',');
+      }
+      const auto& key = keys_[field_index];
+      out->UnsafeAppend(key.data(), static_cast<int64_t>(key.size()));
+      const auto value = formatters_[field_index]->value(i);
+      out->UnsafeAppend(value.data(), static_cast<int64_t>(value.size()));
+    }
+    out->UnsafeAppend(1, '}');
+  }
+
+ protected:
+  FieldsFormatter() = default;
+
+  // The escaped field names, followed by a colon
+  std::vector<std::string> keys_;
+  std::vector<std::unique_ptr<ValueFormatter>> formatters_;
+};
+
+class StructValueFormatter : public ValueFormatter {
+ public:
+  StructValueFormatter(MemoryPool* pool, std::unique_ptr<FieldsFormatter> fields)
+      : ValueFormatter(pool), fields_(std::move(fields)) {}
+
+ protected:
+  Status FormatValues(const Array& array) override {
+    const auto& struct_array = checked_cast<const StructArray&>(array);
+    ArrayVector fields;
+    for (int i = 0; i < struct_array.num_fields(); ++i) {
+      fields.push_back(struct_array.field(i));
+    }
+    RETURN_NOT_OK(fields_->Format(fields, /*use_threads=*/false));
+
+    for (int64_t i = 0; i < struct_array.length(); ++i) {
+      if (struct_array.IsNull(i)) {
+        RETURN_NOT_OK(AppendNull());
+        continue;
+      }
+      RETURN_NOT_OK(data_.Reserve(fields_->object_size(i)));
+      fields_->UnsafeAppendObject(i, &data_);
+      FinishValue();
+    }
+    return Status::OK();
+  }
+
+  std::unique_ptr<FieldsFormatter> fields_;
+};
+
+struct ValueFormatterFactory {
+  template <typename T>
+  enable_if_t<internal::is_formattable<T>::value, Status> Visit(const T&) {
+    out.reset(new PrimitiveValueFormatter<T>(pool, type));
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_string_like<T, Status> Visit(const T&) {
+    out.reset(new StringValueFormatter<T>(pool));
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_list_type<T, Status> Visit(const T& list_type) {
+    ARROW_ASSIGN_OR_RAISE(auto values_formatter,
+                          MakeValueFormatter(list_type.value_type(), pool));
+    out.reset(new ListValueFormatter<T>(pool, std::move(values_formatter)));
+    return Status::OK();
+  }
+
+  Status Visit(const NullType&) {
+    out.reset(new NullValueFormatter(pool));
+    return Status::OK();
+  }
+
+  Status Visit(const Decimal128Type&) {
+    out.reset(new Decimal128ValueFormatter(pool));
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryType& dict_type) {
+    ARROW_ASSIGN_OR_RAISE(auto dictionary_formatter,
+                          MakeValueFormatter(dict_type.value_type(), pool));
+    out.reset(new DictionaryValueFormatter(pool, std::move(dictionary_formatter)));
+    return Status::OK();
+  }
+
+  Status Visit(const StructType& struct_type) {
+    ARROW_ASSIGN_OR_RAISE(auto fields, FieldsFormatter::Make(struct_type.fields(), pool));
+    out.reset(new StructValueFormatter(pool, std::move(fields)));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType&) {
+    return Status::NotImplemented("Writing values of type ", *type, " as JSON");
+  }
+
+  const std::shared_ptr<DataType>& type;
+  MemoryPool* pool;
+  std::unique_ptr<ValueFormatter> out;
+};
+
+Result<std::unique_ptr<ValueFormatter>> MakeValueFormatter(
+    const std::shared_ptr<DataType>& type, MemoryPool* pool) {
+  ValueFormatterFactory factory{type, pool, nullptr};
+  RETURN_NOT_OK(VisitTypeInline(*type, &factory));
+  return std::move(factory.out);
+}
+
+/////////////////////////////////////////////////////////////////////////
+// Writer implementation
+
+class JSONWriterImpl : public JSONWriter {
+ public:
+  JSONWriterImpl(MemoryPool* pool, io::OutputStream* output,
+                 std::shared_ptr<Schema> schema, const WriteOptions& options)
+      : output_(output), schema_(std::move(schema)), options_(options), rows_(pool) {}
+
+  Status Init(MemoryPool* pool) {
+    if (options_.batch_size <= 0) {
+      return Status::Invalid("JSON WriteOptions::batch_size must be > 0");
+    }
+    ARROW_ASSIGN_OR_RAISE(fields_, FieldsFormatter::Make(schema_->fields(), pool));
+    return Status::OK();
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    if (!batch.schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Record batch schema does not match JSON writer schema");
+    }
+    for (int64_t offset = 0; offset < batch.num_rows(); offset += options_.batch_size) {
+      const int64_t length =
+          std::min<int64_t>(options_.batch_size, batch.num_rows() - offset);
+      RETURN_NOT_OK(WriteRows(batch, offset, length));
+    }
+    return Status::OK();
+  }
+
+ protected:
+  Status WriteRows(const RecordBatch& batch, int64_t offset, int64_t length) {
+    ArrayVector columns;
+    for (const auto& column : batch.columns()) {
+      columns.push_back(column->Slice(offset, length));
+    }
+    RETURN_NOT_OK(fields_->Format(columns, options_.use_threads));
+
+    // Each object is followed by a line separator
+    int64_t rows_size = length;
+    for (int64_t row = 0; row < length; ++row) {
+      rows_size += fields_->object_size(row);
+    }
+    rows_.Rewind(0);
+    RETURN_NOT_OK(rows_.Reserve(rows_size));
+    for (int64_t row = 0; row < length; ++row) {
+      fields_->UnsafeAppendObject(row, &rows_);
+      rows_.UnsafeAppend(1, '\n');
+    }
+    DCHECK_EQ(rows_.length(), rows_size);
+    return output_->Write(rows_.data(), rows_.length());
+  }
+
+  io::OutputStream* output_;
+  std::shared_ptr<Schema> schema_;
+  const WriteOptions options_;
+  std::unique_ptr<FieldsFormatter> fields_;
+  // Scratch buffer for the rows being written
+  BufferBuilder rows_;
+};
+
+}  // namespace
+
+Status JSONWriter::WriteTable(const Table& table) {
+  TableBatchReader reader(table);
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    RETURN_NOT_OK(WriteRecordBatch(*batch));
+  }
+  return Status::OK();
+}
+
+Result<std::shared_ptr<JSONWriter>> JSONWriter::Make(MemoryPool* pool,
+                                                     io::OutputStream* output,
+                                                     std::shared_ptr<Schema> schema,
+                                                     const WriteOptions& options) {
+  auto writer =
+      std::make_shared<JSONWriterImpl>(pool, output, std::move(schema), options);
+  RETURN_NOT_OK(writer->Init(pool));
+  return writer;
+}
+
+Status WriteJSON(const Table& table, const WriteOptions& options, MemoryPool* pool,
+                 io::OutputStream* output) {
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        JSONWriter::Make(pool, output, table.schema(), options));
+  return writer->WriteTable(table);
+}
+
+Status WriteJSON(const RecordBatch& batch, const WriteOptions& options, MemoryPool* pool,
+                 io::OutputStream* output) {
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        JSONWriter::Make(pool, output, batch.schema(), options));
+  return writer->WriteRecordBatch(batch);
+}
+
+}  // namespace json
+}  // namespace arrow
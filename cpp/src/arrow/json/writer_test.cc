@@ -0,0 +1,152 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+#include "arrow/json/options.h"
+#include "arrow/json/reader.h"
+#include "arrow/json/writer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace json {
+
+std::string WriteToString(const Table& table, const WriteOptions& options) {
+  auto out = *io::BufferOutputStream::Create(1024, default_memory_pool());
+  ABORT_NOT_OK(WriteJSON(table, options, default_memory_pool(), out.get()));
+  return (*out->Finish())->ToString();
+}
+
+void AssertWritten(const Table& table, const std::string& expected) {
+  auto options = WriteOptions::Defaults();
+  for (bool use_threads : {false, true}) {
+    for (int32_t batch_size : {1, 2, 1024}) {
+      options.use_threads = use_threads;
+      options.batch_size = batch_size;
+      ASSERT_EQ(WriteToString(table, options), expected)
+          << "use_threads = " << use_threads << ", batch_size = " << batch_size;
+    }
+  }
+}
+
+TEST(JSONWriter, Basics) {
+  auto schema = arrow::schema({field("i", int32()), field("f", float64()),
+                               field("b", boolean()), field("s", utf8()),
+                               field("n", null())});
+  auto table = TableFromJSON(schema, {R"([[1, 1.5, true, "ab", null],
+                                          [null, null, null, null, null]])",
+                                      R"([[-3, 0.25, false, "c\"\\\n\u0001", null]])"});
+  AssertWritten(*table, R"({"i":1,"f":1.5,"b":true,"s":"ab","n":null}
+{"i":null,"f":null,"b":null,"s":null,"n":null}
+{"i":-3,"f":0.25,"b":false,"s":"c\"\\\n\u0001","n":null}
+)");
+}
+
+TEST(JSONWriter, NonFiniteFloats) {
+  DoubleBuilder builder;
+  ASSERT_OK(builder.AppendValues({NAN, INFINITY, -INFINITY, 2.0}));
+  ASSERT_OK_AND_ASSIGN(auto array, builder.Finish());
+  auto table = Table::Make(arrow::schema({field("x", float64())}), {array});
+  AssertWritten(*table, "{\"x\":null}\n{\"x\":null}\n{\"x\":null}\n{\"x\":2}\n");
+}
+
+TEST(JSONWriter, Temporal) {
+  auto schema =
+      arrow::schema({field("d", date32()), field("ts", timestamp(TimeUnit::SECOND)),
+                     field("dur", duration(TimeUnit::SECOND))});
+  auto table = TableFromJSON(schema, {R"([[18000, 86401, 5], [null, null, null]])"});
+  AssertWritten(*table, R"({"d":"2019-04-14","ts":"1970-01-02 00:00:01","dur":5}
+{"d":null,"ts":null,"dur":null}
+)");
+}
+
+TEST(JSONWriter, Nested) {
+  auto schema = arrow::schema(
+      {field("l", list(int32())),
+       field("st", struct_({field("a", utf8()), field("b", list(float64()))}))});
+  auto table = TableFromJSON(schema, {R"([[[1, null, 2], {"a": "x", "b": [0.5]}],
+                                          [null, null],
+                                          [[], {"a": null, "b": null}]])"});
+  AssertWritten(*table, R"({"l":[1,null,2],"st":{"a":"x","b":[0.5]}}
+{"l":null,"st":null}
+{"l":[],"st":{"a":null,"b":null}}
+)");
+}
+
+TEST(JSONWriter, Dictionary) {
+  auto type = dictionary(int8(), utf8());
+  auto dict = ArrayFromJSON(utf8(), R"(["foo", "bar"])");
+  auto indices = ArrayFromJSON(int8(), "[1, null, 0]");
+  auto array = *DictionaryArray::FromArrays(type, indices, dict);
+  auto table = Table::Make(arrow::schema({field("x", type)}), {array});
+  AssertWritten(*table, "{\"x\":\"bar\"}\n{\"x\":null}\n{\"x\":\"foo\"}\n");
+}
+
+TEST(JSONWriter, RoundTrip) {
+  auto schema = arrow::schema({field("i", int64()), field("f", float64()),
+                               field("s", utf8()), field("b", boolean()),
+                               field("l", list(int64())),
+                               field("st", struct_({field("x", utf8())}))});
+  auto table = TableFromJSON(schema, {R"([[1, 2.5, "x\ny\"", true, [1, 2], {"x": "a"}],
+                                          [null, -1e+30, "", false, [], null],
+                                          [3, null, null, null, null, {"x": null}]])"});
+
+  auto out = *io::BufferOutputStream::Create(1024, default_memory_pool());
+  ASSERT_OK(
+      WriteJSON(*table, WriteOptions::Defaults(), default_memory_pool(), out.get()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, out->Finish());
+
+  auto parse_options = ParseOptions::Defaults();
+  parse_options.explicit_schema = schema;
+  ASSERT_OK_AND_ASSIGN(
+      auto reader,
+      TableReader::Make(default_memory_pool(), std::make_shared<io::BufferReader>(buffer),
+                        ReadOptions::Defaults(), parse_options));
+  ASSERT_OK_AND_ASSIGN(auto read_table, reader->Read());
+  AssertTablesEqual(*table, *read_table);
+}
+
+TEST(JSONWriter, UnsupportedType) {
+  auto schema = arrow::schema({field("b", binary())});
+  auto out = *io::BufferOutputStream::Create(1024, default_memory_pool());
+  ASSERT_RAISES(NotImplemented, JSONWriter::Make(default_memory_pool(), out.get(), schema,
+                                                WriteOptions::Defaults()));
+}
+
+TEST(JSONWriter, SchemaMismatch) {
+  auto out = *io::BufferOutputStream::Create(1024, default_memory_pool());
+  ASSERT_OK_AND_ASSIGN(
+      auto writer, JSONWriter::Make(default_memory_pool(), out.get(),
+                                    arrow::schema({field("a", int32())}),
+                                    WriteOptions::Defaults()));
+  auto batch = RecordBatchFromJSON(arrow::schema({field("a", int64())}), "[[1]]");
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*batch));
+}
+
+}  // namespace json
+}  // namespace arrow
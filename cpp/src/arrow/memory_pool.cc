@@ -23,9 +23,26 @@
 #include <iostream>   // IWYU pragma: keep
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <sstream>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"  // IWYU pragma: keep
+#include "arrow/util/numa.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+#ifndef _WIN32
+#include <unistd.h>
+#endif
 
 #ifdef ARROW_JEMALLOC
 // Needed to support jemalloc 3 and 4
@@ -262,8 +279,142 @@ class MimallocAllocator {
 
 #endif  // defined(ARROW_MIMALLOC)
 
+///////////////////////////////////////////////////////////////////////
+// Preparation of large allocations
+
+// The smallest enabled threshold, so that allocating only reads one atomic
+// in the common case
+std::atomic<int64_t> min_large_allocation(std::numeric_limits<int64_t>::max());
+std::atomic<int64_t> huge_page_threshold(-1);
+std::atomic<int64_t> prefault_threshold(-1);
+std::atomic<int> prefault_threads(4);
+std::mutex large_allocation_options_mutex;
+
+// Don't start threads to fault in less than this
+constexpr int64_t kMinPrefaultPerThread = 16 * 1024 * 1024;
+
+int64_t PageSize() {
+#ifdef _WIN32
+  return 4096;
+#else
+  static const int64_t page_size = static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+  return page_size;
+#endif
+}
+
+// Return the pages entirely within [data, data + size)
+std::pair<uint8_t*, uint8_t*> InnerPages(uint8_t* data, int64_t size) {
+  const auto page_size = static_cast<uintptr_t>(PageSize());
+  const auto begin = reinterpret_cast<uintptr_t>(data);
+  const auto end = begin + static_cast<uintptr_t>(size);
+  const uintptr_t page_begin = (begin + page_size - 1) & ~(page_size - 1);
+  const uintptr_t page_end = end & ~(page_size - 1);
+  if (page_begin >= page_end) {
+    return {data, data};
+  }
+  return {reinterpret_cast<uint8_t*>(page_begin), reinterpret_cast<uint8_t*>(page_end)};
+}
+
+void AdviseHugePages(uint8_t* data, int64_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  auto pages = InnerPages(data, size);
+  // Huge pages are an optimization, e.g. they may be disabled on the host
+  if (pages.first != pages.second) {
+    ARROW_UNUSED(madvise(pages.first, pages.second - pages.first, MADV_HUGEPAGE));
+  }
+#endif
+}
+
+// The contents of the range are undefined, so it can be written to
+void PrefaultPages(uint8_t* data, int64_t size) {
+  if (size == 0) {
+    return;
+  }
+  // The outer pages, which may be shared with another range
+  data[0] = 0;
+  data[size - 1] = 0;
+  auto pages = InnerPages(data, size);
+#if defined(__linux__) && defined(MADV_POPULATE_WRITE)
+  if (pages.first == pages.second ||
+      madvise(pages.first, pages.second - pages.first, MADV_POPULATE_WRITE) == 0) {
+    return;
+  }
+  // Older kernels don't support MADV_POPULATE_WRITE
+#endif
+  const int64_t page_size = PageSize();
+  for (uint8_t* page = pages.first; page < pages.second; page += page_size) {
+    *page = 0;
+  }
+}
+
+void Prefault(uint8_t* data, int64_t size) {
+  const int64_t num_parts = std::max<int64_t>(
+      1, std::min<int64_t>(prefault_threads.load(), size / kMinPrefaultPerThread));
+  const int64_t part_size = BitUtil::CeilDiv(size, num_parts);
+  std::vector<std::thread> threads;
+  for (int64_t offset = part_size; offset < size; offset += part_size) {
+    const int64_t length = std::min(part_size, size - offset);
+    try {
+      threads.emplace_back(PrefaultPages, data + offset, length);
+    } catch (const std::system_error&) {
+      PrefaultPages(data + offset, length);
+    }
+  }
+  PrefaultPages(data, std::min(part_size, size));
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+// Called for allocations at least min_large_allocation large, before they are
+// used.  The bytes from `old_size` are newly allocated.
+void PrepareLargeAllocation(uint8_t* data, int64_t size, int64_t old_size = 0) {
+  const int64_t huge_pages = huge_page_threshold.load();
+  if (huge_pages >= 0 && size >= huge_pages) {
+    AdviseHugePages(data, size);
+  }
+  const int64_t prefault = prefault_threshold.load();
+  if (prefault >= 0 && size >= prefault) {
+    Prefault(data + old_size, size - old_size);
+  }
+}
+
 }  // namespace
 
+Status set_large_allocation_options(const LargeAllocationOptions& options) {
+  if (options.prefault_threads < 1) {
+    return Status::Invalid("Need at least one thread to fault in pages");
+  }
+#if !(defined(__linux__) && defined(MADV_HUGEPAGE))
+  if (options.huge_page_threshold >= 0) {
+    return Status::NotImplemented("Huge pages are not supported on this platform");
+  }
+#endif
+  std::lock_guard<std::mutex> lock(large_allocation_options_mutex);
+  // Disable the preparation while the thresholds change
+  min_large_allocation = std::numeric_limits<int64_t>::max();
+  huge_page_threshold = options.huge_page_threshold;
+  prefault_threshold = options.prefault_threshold;
+  prefault_threads = options.prefault_threads;
+  int64_t min_size = std::numeric_limits<int64_t>::max();
+  for (int64_t threshold : {options.huge_page_threshold, options.prefault_threshold}) {
+    if (threshold >= 0) {
+      min_size = std::min(min_size, std::max<int64_t>(threshold, 1));
+    }
+  }
+  min_large_allocation = min_size;
+  return Status::OK();
+}
+
+LargeAllocationOptions get_large_allocation_options() {
+  std::lock_guard<std::mutex> lock(large_allocation_options_mutex);
+  LargeAllocationOptions options;
+  options.huge_page_threshold = huge_page_threshold.load();
+  options.prefault_threshold = prefault_threshold.load();
+  options.prefault_threads = prefault_threads.load();
+  return options;
+}
+
 MemoryPool::MemoryPool() {}
 
 MemoryPool::~MemoryPool() {}
@@ -293,6 +444,9 @@ class BaseMemoryPoolImpl : public MemoryPool {
       return Status::CapacityError("malloc size overflows size_t");
     }
     RETURN_NOT_OK(Allocator::AllocateAligned(size, out));
+    if (size >= min_large_allocation.load(std::memory_order_relaxed)) {
+      PrepareLargeAllocation(*out, size);
+    }
 #ifndef NDEBUG
     // Poison data
     if (size > 0) {
@@ -314,6 +468,10 @@ class BaseMemoryPoolImpl : public MemoryPool {
       return Status::CapacityError("realloc overflows size_t");
     }
     RETURN_NOT_OK(Allocator::ReallocateAligned(old_size, new_size, ptr));
+    if (new_size > old_size &&
+        new_size >= min_large_allocation.load(std::memory_order_relaxed)) {
+      PrepareLargeAllocation(*ptr, new_size, old_size);
+    }
 #ifndef NDEBUG
     // Poison data
     if (new_size > old_size) {
@@ -479,6 +637,98 @@ int64_t LoggingMemoryPool::max_memory() const {
 
 std::string LoggingMemoryPool::backend_name() const { return pool_->backend_name(); }
 
+///////////////////////////////////////////////////////////////////////
+// NumaMemoryPool implementation
+
+constexpr int NumaMemoryPool::kLocalNode;
+constexpr int64_t NumaMemoryPool::kMinNumaAllocation;
+
+NumaMemoryPool::NumaMemoryPool(MemoryPool* pool, int node) : pool_(pool), node_(node) {}
+
+bool NumaMemoryPool::IsMapped(int64_t size) const {
+#ifdef __linux__
+  return size >= kMinNumaAllocation;
+#else
+  return false;
+#endif
+}
+
+Status NumaMemoryPool::Map(int64_t size, uint8_t** out) {
+#ifdef __linux__
+  void* data = mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (data == MAP_FAILED) {
+    return Status::OutOfMemory("mmap of size ", size, " failed");
+  }
+  const int node = node_ == kLocalNode ? internal::GetCurrentNumaNode() : node_;
+  // The placement is an optimization, the memory is usable if it fails
+  ARROW_UNUSED(internal::PreferNumaNode(data, size, node));
+  *out = reinterpret_cast<uint8_t*>(data);
+  return Status::OK();
+#else
+  return Status::NotImplemented("NUMA allocations are not supported on this platform");
+#endif
+}
+
+Status NumaMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  if (IsMapped(size)) {
+    RETURN_NOT_OK(Map(size, out));
+  } else {
+    RETURN_NOT_OK(pool_->Allocate(size, out));
+  }
+  stats_.UpdateAllocatedBytes(size);
+  return Status::OK();
+}
+
+Status NumaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  if (!IsMapped(old_size) && !IsMapped(new_size)) {
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+#ifdef __linux__
+  } else if (IsMapped(old_size) && IsMapped(new_size)) {
+    // The remapped pages keep the placement policy
+    void* data = mremap(*ptr, static_cast<size_t>(old_size),
+                        static_cast<size_t>(new_size), MREMAP_MAYMOVE);
+    if (data == MAP_FAILED) {
+      return Status::OutOfMemory("mremap of size ", new_size, " failed");
+    }
+    *ptr = reinterpret_cast<uint8_t*>(data);
+#endif
+  } else {
+    uint8_t* data;
+    if (IsMapped(new_size)) {
+      RETURN_NOT_OK(Map(new_size, &data));
+    } else {
+      RETURN_NOT_OK(pool_->Allocate(new_size, &data));
+    }
+    std::memcpy(data, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Release(*ptr, old_size);
+    *ptr = data;
+  }
+  stats_.UpdateAllocatedBytes(new_size - old_size);
+  return Status::OK();
+}
+
+void NumaMemoryPool::Release(uint8_t* buffer, int64_t size) {
+  if (IsMapped(size)) {
+#ifdef __linux__
+    munmap(buffer, static_cast<size_t>(size));
+#endif
+  } else {
+    pool_->Free(buffer, size);
+  }
+}
+
+void NumaMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  Release(buffer, size);
+  stats_.UpdateAllocatedBytes(-size);
+}
+
+int64_t NumaMemoryPool::bytes_allocated() const { return stats_.bytes_allocated(); }
+
+int64_t NumaMemoryPool::max_memory() const { return stats_.max_memory(); }
+
+std::string NumaMemoryPool::backend_name() const { return pool_->backend_name(); }
+
 ///////////////////////////////////////////////////////////////////////
 // ProxyMemoryPool implementation
 
@@ -538,4 +788,519 @@ int64_t ProxyMemoryPool::max_memory() const { return impl_->max_memory(); }
 
 std::string ProxyMemoryPool::backend_name() const { return impl_->backend_name(); }
 
+///////////////////////////////////////////////////////////////////////
+// ArenaMemoryPool implementation
+
+namespace {
+
+std::atomic<int64_t> next_arena_pool_id(0);
+
+}  // namespace
+
+class ArenaMemoryPool::ArenaMemoryPoolImpl {
+ public:
+  ArenaMemoryPoolImpl(MemoryPool* parent, int64_t chunk_size)
+      : parent_(parent),
+        id_(next_arena_pool_id++),
+        chunk_size_(BitUtil::RoundUpToMultipleOf64(std::max<int64_t>(chunk_size, 64))),
+        max_arena_allocation_(std::max<int64_t>(chunk_size_ / 4, 64)),
+        bytes_reserved_(0) {}
+
+  ~ArenaMemoryPoolImpl() {
+    for (auto& entry : arenas_) {
+      ReleaseChunks(entry.second.get(), 0);
+    }
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(AllocateUntracked(size, out));
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (!IsArena(old_size) && !IsArena(new_size)) {
+      RETURN_NOT_OK(parent_->Reallocate(old_size, new_size, ptr));
+    } else if (!(IsArena(old_size) && IsArena(new_size) &&
+                 ResizeLatest(*ptr, old_size, new_size))) {
+      uint8_t* data;
+      RETURN_NOT_OK(AllocateUntracked(new_size, &data));
+      std::memcpy(data, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      FreeUntracked(*ptr, old_size);
+      *ptr = data;
+    }
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    FreeUntracked(buffer, size);
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  void Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& entry : arenas_) {
+      ThreadArena* arena = entry.second.get();
+      ReleaseChunks(arena, 1);
+      if (!arena->chunks.empty()) {
+        arena->position = arena->chunks[0];
+        arena->end = arena->position + chunk_size_;
+      }
+    }
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  std::string backend_name() const { return parent_->backend_name(); }
+
+  int64_t max_arena_allocation() const { return max_arena_allocation_; }
+
+  int64_t bytes_reserved() const { return bytes_reserved_.load(); }
+
+ private:
+  // The chunks of a thread, the last one being the current one
+  struct ThreadArena {
+    std::vector<uint8_t*> chunks;
+    uint8_t* position = nullptr;
+    uint8_t* end = nullptr;
+  };
+
+  // The arena of the pool last used by the current thread, to avoid locking
+  // in the common case of a single arena pool.  Pool ids are never reused.
+  struct ThreadArenaCache {
+    int64_t pool_id;
+    ThreadArena* arena;
+  };
+  static thread_local ThreadArenaCache thread_arena_cache_;
+
+  bool IsArena(int64_t size) const { return size > 0 && size <= max_arena_allocation_; }
+
+  ThreadArena* CurrentArena() {
+    ThreadArenaCache& cache = thread_arena_cache_;
+    if (cache.pool_id == id_) {
+      return cache.arena;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Threads with the id of an exited thread inherit its arena
+    auto& arena = arenas_[std::this_thread::get_id()];
+    if (arena == nullptr) {
+      arena.reset(new ThreadArena());
+    }
+    cache.pool_id = id_;
+    cache.arena = arena.get();
+    return cache.arena;
+  }
+
+  Status AllocateUntracked(int64_t size, uint8_t** out) {
+    if (!IsArena(size)) {
+      return parent_->Allocate(size, out);
+    }
+    ThreadArena* arena = CurrentArena();
+    const int64_t aligned_size = BitUtil::RoundUpToMultipleOf64(size);
+    if (arena->end - arena->position < aligned_size) {
+      uint8_t* chunk;
+      RETURN_NOT_OK(parent_->Allocate(chunk_size_, &chunk));
+      bytes_reserved_ += chunk_size_;
+      arena->chunks.push_back(chunk);
+      arena->position = chunk;
+      arena->end = chunk + chunk_size_;
+    }
+    *out = arena->position;
+    arena->position += aligned_size;
+    return Status::OK();
+  }
+
+  void FreeUntracked(uint8_t* buffer, int64_t size) {
+    if (!IsArena(size)) {
+      parent_->Free(buffer, size);
+      return;
+    }
+    // Reclaim the latest allocation of the thread, if this is it
+    ThreadArenaCache& cache = thread_arena_cache_;
+    if (cache.pool_id == id_ &&
+        buffer + BitUtil::RoundUpToMultipleOf64(size) == cache.arena->position) {
+      cache.arena->position = buffer;
+    }
+  }
+
+  // Resize in place the latest allocation of the thread, if this is it and
+  // the current chunk is large enough
+  bool ResizeLatest(uint8_t* buffer, int64_t old_size, int64_t new_size) {
+    ThreadArena* arena = CurrentArena();
+    if (buffer + BitUtil::RoundUpToMultipleOf64(old_size) != arena->position ||
+        arena->end - buffer < BitUtil::RoundUpToMultipleOf64(new_size)) {
+      return false;
+    }
+    arena->position = buffer + BitUtil::RoundUpToMultipleOf64(new_size);
+    return true;
+  }
+
+  void ReleaseChunks(ThreadArena* arena, size_t num_kept) {
+    for (size_t i = num_kept; i < arena->chunks.size(); ++i) {
+      parent_->Free(arena->chunks[i], chunk_size_);
+      bytes_reserved_ -= chunk_size_;
+    }
+    arena->chunks.resize(std::min(num_kept, arena->chunks.size()));
+  }
+
+  MemoryPool* parent_;
+  const int64_t id_;
+  const int64_t chunk_size_;
+  const int64_t max_arena_allocation_;
+  std::atomic<int64_t> bytes_reserved_;
+  internal::MemoryPoolStats stats_;
+  std::mutex mutex_;
+  std::unordered_map<std::thread::id, std::unique_ptr<ThreadArena>> arenas_;
+};
+
+thread_local ArenaMemoryPool::ArenaMemoryPoolImpl::ThreadArenaCache
+    ArenaMemoryPool::ArenaMemoryPoolImpl::thread_arena_cache_ = {-1, nullptr};
+
+constexpr int64_t ArenaMemoryPool::kDefaultChunkSize;
+
+ArenaMemoryPool::ArenaMemoryPool(MemoryPool* parent, int64_t chunk_size)
+    : impl_(new ArenaMemoryPoolImpl(parent, chunk_size)) {}
+
+ArenaMemoryPool::~ArenaMemoryPool() {}
+
+Status ArenaMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ArenaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ArenaMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t ArenaMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ArenaMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::string ArenaMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+void ArenaMemoryPool::Reset() { impl_->Reset(); }
+
+int64_t ArenaMemoryPool::max_arena_allocation() const {
+  return impl_->max_arena_allocation();
+}
+
+int64_t ArenaMemoryPool::bytes_reserved() const { return impl_->bytes_reserved(); }
+
+///////////////////////////////////////////////////////////////////////
+// TrackingMemoryPool implementation
+
+constexpr int64_t TrackingMemoryPool::kNoLimit;
+
+TrackingMemoryPool::TrackingMemoryPool(std::string name, MemoryPool* pool,
+                                       int64_t limit, LimitCallback on_limit)
+    : TrackingMemoryPool(std::move(name), NULLPTR, pool, limit, std::move(on_limit)) {}
+
+TrackingMemoryPool::TrackingMemoryPool(std::string name, TrackingMemoryPool* parent,
+                                       MemoryPool* pool, int64_t limit,
+                                       LimitCallback on_limit)
+    : name_(std::move(name)),
+      parent_(parent),
+      pool_(pool),
+      limit_(limit),
+      on_limit_(std::move(on_limit)),
+      bytes_allocated_(0),
+      max_memory_(0) {}
+
+TrackingMemoryPool::~TrackingMemoryPool() {
+  if (bytes_allocated_.load() != 0) {
+    ARROW_LOG(WARNING) << "Memory tracker '" << name_ << "' destroyed with "
+                       << bytes_allocated_.load() << " bytes still allocated";
+  }
+}
+
+std::unique_ptr<TrackingMemoryPool> TrackingMemoryPool::MakeChild(
+    std::string name, int64_t limit, LimitCallback on_limit) {
+  return std::unique_ptr<TrackingMemoryPool>(
+      new TrackingMemoryPool(std::move(name), this, pool_, limit, std::move(on_limit)));
+}
+
+Status TrackingMemoryPool::Reserve(int64_t size) {
+  for (auto tracker = this; tracker != NULLPTR; tracker = tracker->parent_) {
+    const int64_t allocated = tracker->bytes_allocated_.fetch_add(size) + size;
+    if (tracker->limit_ != kNoLimit && allocated > tracker->limit_) {
+      // Undo the reservation in the descendants of the tracker, and in itself
+      for (auto undone = this; undone != tracker->parent_; undone = undone->parent_) {
+        undone->bytes_allocated_ -= size;
+      }
+      if (tracker->on_limit_) {
+        tracker->on_limit_(*tracker, size);
+      }
+      return Status::OutOfMemory("Allocation of ", size,
+                                 " bytes exceeds the memory limit of '", tracker->name_,
+                                 "' (", tracker->limit_, " bytes, ", allocated - size,
+                                 " allocated)");
+    }
+  }
+  // "peak" is ill-defined in multi-threaded code, don't try to be too rigorous
+  for (auto tracker = this; tracker != NULLPTR; tracker = tracker->parent_) {
+    const int64_t allocated = tracker->bytes_allocated_.load();
+    int64_t peak = tracker->max_memory_.load();
+    while (allocated > peak &&
+           !tracker->max_memory_.compare_exchange_weak(peak, allocated)) {
+    }
+  }
+  return Status::OK();
+}
+
+void TrackingMemoryPool::Release(int64_t size) {
+  for (auto tracker = this; tracker != NULLPTR; tracker = tracker->parent_) {
+    tracker->bytes_allocated_ -= size;
+  }
+}
+
+Status TrackingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  RETURN_NOT_OK(Reserve(size));
+  Status st = pool_->Allocate(size, out);
+  if (!st.ok()) {
+    Release(size);
+  }
+  return st;
+}
+
+Status TrackingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  const int64_t diff = new_size - old_size;
+  if (diff > 0) {
+    RETURN_NOT_OK(Reserve(diff));
+  }
+  Status st = pool_->Reallocate(old_size, new_size, ptr);
+  if (st.ok() && diff < 0) {
+    Release(-diff);
+  } else if (!st.ok() && diff > 0) {
+    Release(diff);
+  }
+  return st;
+}
+
+void TrackingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  pool_->Free(buffer, size);
+  Release(size);
+}
+
+int64_t TrackingMemoryPool::bytes_allocated() const { return bytes_allocated_.load(); }
+
+int64_t TrackingMemoryPool::max_memory() const { return max_memory_.load(); }
+
+std::string TrackingMemoryPool::backend_name() const { return pool_->backend_name(); }
+
+///////////////////////////////////////////////////////////////////////
+// ProfilingMemoryPool implementation
+
+namespace {
+
+thread_local const ScopedAllocationLabel* current_allocation_label = NULLPTR;
+
+const std::string& EmptyLabel() {
+  static const std::string empty;
+  return empty;
+}
+
+}  // namespace
+
+ScopedAllocationLabel::ScopedAllocationLabel(std::string label)
+    : label_(std::move(label)), previous_(current_allocation_label) {
+  current_allocation_label = this;
+}
+
+ScopedAllocationLabel::~ScopedAllocationLabel() { current_allocation_label = previous_; }
+
+const std::string& ScopedAllocationLabel::current() {
+  return current_allocation_label == NULLPTR ? EmptyLabel()
+                                             : current_allocation_label->label_;
+}
+
+class ProfilingMemoryPool::ProfilingMemoryPoolImpl {
+ public:
+  struct Sample {
+    LabelStats* stats;
+    int64_t size;
+  };
+
+  explicit ProfilingMemoryPoolImpl(int64_t sampling_interval)
+      : sampling_interval_(sampling_interval), num_live_samples_(0) {}
+
+  void RecordAllocation(uint8_t* ptr, int64_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = labels_.find(ScopedAllocationLabel::current());
+    if (it == labels_.end()) {
+      it = labels_.emplace(ScopedAllocationLabel::current(), LabelStats{}).first;
+      it->second.label = it->first;
+    }
+    ++it->second.sampled_allocations;
+    it->second.allocated_bytes += size * sampling_interval_;
+    samples_[ptr] = Sample{&it->second, size};
+    ++num_live_samples_;
+    UpdateLiveBytes(&it->second, size);
+  }
+
+  // Detach the sample of an allocation being reallocated, if any, as its
+  // address may be reused by another allocation as soon as it is released.
+  // Return a sample with null stats if the allocation wasn't sampled.
+  Sample TakeSample(uint8_t* ptr) {
+    if (num_live_samples_.load() == 0) {
+      return Sample{NULLPTR, 0};
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = samples_.find(ptr);
+    if (it == samples_.end()) {
+      return Sample{NULLPTR, 0};
+    }
+    const Sample sample = it->second;
+    samples_.erase(it);
+    return sample;
+  }
+
+  // Reattach a sample detached by TakeSample(), with the new allocation
+  void RestoreSample(const Sample& sample, uint8_t* ptr, int64_t size) {
+    if (sample.stats == NULLPTR) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    samples_[ptr] = Sample{sample.stats, size};
+    const int64_t diff = size - sample.size;
+    if (diff > 0) {
+      sample.stats->allocated_bytes += diff * sampling_interval_;
+    }
+    UpdateLiveBytes(sample.stats, diff);
+  }
+
+  void RecordFree(uint8_t* ptr) {
+    // Cheap check for the common case of a pool without live samples
+    if (num_live_samples_.load() == 0) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = samples_.find(ptr);
+    if (it == samples_.end()) {
+      return;
+    }
+    const Sample sample = it->second;
+    samples_.erase(it);
+    --num_live_samples_;
+    UpdateLiveBytes(sample.stats, -sample.size);
+  }
+
+  std::vector<LabelStats> GetLabels() const {
+    std::vector<LabelStats> labels;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto& entry : labels_) {
+        labels.push_back(entry.second);
+      }
+    }
+    std::sort(labels.begin(), labels.end(),
+              [](const LabelStats& left, const LabelStats& right) {
+                // Decreasing statistics, then increasing labels
+                return std::tie(right.live_bytes_at_peak, right.peak_live_bytes,
+                                left.label) < std::tie(left.live_bytes_at_peak,
+                                                       left.peak_live_bytes,
+                                                       right.label);
+              });
+    return labels;
+  }
+
+ private:
+  // Must be called with the mutex held
+  void UpdateLiveBytes(LabelStats* stats, int64_t diff) {
+    stats->live_bytes += diff * sampling_interval_;
+    stats->peak_live_bytes = std::max(stats->peak_live_bytes, stats->live_bytes);
+    live_bytes_ += diff * sampling_interval_;
+    if (diff > 0 && live_bytes_ > peak_live_bytes_) {
+      // A new peak: remember what each label contributed to it
+      peak_live_bytes_ = live_bytes_;
+      for (auto& entry : labels_) {
+        entry.second.live_bytes_at_peak = entry.second.live_bytes;
+      }
+    }
+  }
+
+  const int64_t sampling_interval_;
+  std::atomic<int64_t> num_live_samples_;
+  mutable std::mutex mutex_;
+  // The addresses of the values are stable, as required by Sample::stats
+  std::unordered_map<std::string, LabelStats> labels_;
+  std::unordered_map<uint8_t*, Sample> samples_;
+  int64_t live_bytes_ = 0;
+  int64_t peak_live_bytes_ = 0;
+};
+
+ProfilingMemoryPool::ProfilingMemoryPool(MemoryPool* pool, int64_t sampling_interval)
+    : pool_(pool),
+      sampling_interval_(std::max<int64_t>(sampling_interval, 1)),
+      num_allocations_(0),
+      impl_(new ProfilingMemoryPoolImpl(sampling_interval_)) {}
+
+ProfilingMemoryPool::~ProfilingMemoryPool() {}
+
+Status ProfilingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  RETURN_NOT_OK(pool_->Allocate(size, out));
+  stats_.UpdateAllocatedBytes(size);
+  if (num_allocations_.fetch_add(1) % sampling_interval_ == 0) {
+    impl_->RecordAllocation(*out, size);
+  }
+  return Status::OK();
+}
+
+Status ProfilingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       uint8_t** ptr) {
+  const auto sample = impl_->TakeSample(*ptr);
+  Status st = pool_->Reallocate(old_size, new_size, ptr);
+  if (!st.ok()) {
+    // The allocation is unchanged
+    impl_->RestoreSample(sample, *ptr, old_size);
+    return st;
+  }
+  stats_.UpdateAllocatedBytes(new_size - old_size);
+  impl_->RestoreSample(sample, *ptr, new_size);
+  return Status::OK();
+}
+
+void ProfilingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  // Forget the sample before the address can be reused by another allocation
+  impl_->RecordFree(buffer);
+  pool_->Free(buffer, size);
+  stats_.UpdateAllocatedBytes(-size);
+}
+
+int64_t ProfilingMemoryPool::bytes_allocated() const { return stats_.bytes_allocated(); }
+
+int64_t ProfilingMemoryPool::max_memory() const { return stats_.max_memory(); }
+
+std::string ProfilingMemoryPool::backend_name() const { return pool_->backend_name(); }
+
+ProfilingMemoryPool::Report ProfilingMemoryPool::GetReport() const {
+  Report report;
+  report.bytes_allocated = bytes_allocated();
+  report.max_memory = max_memory();
+  report.sampling_interval = sampling_interval_;
+  report.labels = impl_->GetLabels();
+  return report;
+}
+
+std::string ProfilingMemoryPool::Report::ToString() const {
+  std::stringstream ss;
+  ss << "bytes allocated: " << bytes_allocated << ", max memory: " << max_memory
+     << ", sampling interval: " << sampling_interval << "\n";
+  ss << "label\tlive bytes at peak\tpeak live bytes\tlive bytes\tallocated bytes"
+     << "\tsampled allocations\n";
+  for (const auto& stats : labels) {
+    ss << (stats.label.empty() ? "(unlabeled)" : stats.label) << "\t"
+       << stats.live_bytes_at_peak << "\t" << stats.peak_live_bytes << "\t"
+       << stats.live_bytes << "\t" << stats.allocated_bytes << "\t"
+       << stats.sampled_allocations << "\n";
+  }
+  return ss.str();
+}
+
 }  // namespace arrow
@@ -19,11 +19,14 @@
 
 #include <atomic>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -149,6 +152,209 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// \brief A memory pool serving small, short-lived allocations from
+/// thread-local chunks.
+///
+/// Each thread allocating from the pool carves its allocations out of chunks
+/// of its own, obtained from a parent pool, so that allocating takes no lock
+/// and doesn't call the parent allocator.  Freeing an allocation only makes
+/// its memory reusable if it is the latest allocation of the thread; the
+/// chunks are recycled in bulk by Reset(), e.g. after each batch.
+///
+/// Allocations larger than max_arena_allocation() are delegated to the parent
+/// pool.  Buffers which must outlive the next Reset() should be allocated
+/// from the parent pool directly.
+class ARROW_EXPORT ArenaMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultChunkSize = 1 << 20;
+
+  explicit ArenaMemoryPool(MemoryPool* parent, int64_t chunk_size = kDefaultChunkSize);
+  ~ArenaMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /// \brief Make the memory of the chunks available again for allocations.
+  ///
+  /// The buffers allocated from the chunks must not be used anymore, and the
+  /// pool must not be used concurrently.  One chunk is kept per thread, the
+  /// others are returned to the parent pool.
+  void Reset();
+
+  /// The size of the largest allocation served from the chunks
+  int64_t max_arena_allocation() const;
+
+  /// The number of bytes of the chunks currently obtained from the parent pool
+  int64_t bytes_reserved() const;
+
+ private:
+  class ArenaMemoryPoolImpl;
+  std::unique_ptr<ArenaMemoryPoolImpl> impl_;
+};
+
+/// \brief A memory pool accounting for, and optionally limiting, the memory
+/// of a component.
+///
+/// Trackers form a hierarchy, e.g. one per query with children for its scan,
+/// its hash tables, etc.  Allocations through a tracker are accounted for in
+/// the tracker and all its ancestors, and fail with OutOfMemory if they would
+/// exceed the limit of any of them; the root tracker delegates them to an
+/// underlying pool.  As all readers and kernels take a MemoryPool, a tracker
+/// can be passed wherever the memory of a component should be tracked.
+class ARROW_EXPORT TrackingMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kNoLimit = -1;
+
+  /// A function called when an allocation fails because of the limit of a
+  /// tracker, with the tracker and the number of bytes requested.  It may
+  /// e.g. cancel the work of the component, or log its allocations.
+  using LimitCallback = std::function<void(const TrackingMemoryPool&, int64_t)>;
+
+  /// \brief Make a root tracker, allocating from the given pool
+  TrackingMemoryPool(std::string name, MemoryPool* pool, int64_t limit = kNoLimit,
+                     LimitCallback on_limit = NULLPTR);
+  ~TrackingMemoryPool() override;
+
+  /// \brief Make a tracker for a part of the allocations of this tracker
+  ///
+  /// The child must be destroyed before this tracker.
+  std::unique_ptr<TrackingMemoryPool> MakeChild(std::string name,
+                                                int64_t limit = kNoLimit,
+                                                LimitCallback on_limit = NULLPTR);
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  /// The number of bytes allocated through this tracker and its descendants
+  int64_t bytes_allocated() const override;
+
+  /// The peak of bytes_allocated()
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  const std::string& name() const { return name_; }
+
+  /// The limit of bytes_allocated(), or kNoLimit
+  int64_t limit() const { return limit_; }
+
+  /// The parent tracker, or null for a root tracker
+  TrackingMemoryPool* parent() const { return parent_; }
+
+ private:
+  TrackingMemoryPool(std::string name, TrackingMemoryPool* parent, MemoryPool* pool,
+                     int64_t limit, LimitCallback on_limit);
+
+  // Account for an allocation in this tracker and its ancestors
+  Status Reserve(int64_t size);
+  void Release(int64_t size);
+
+  std::string name_;
+  TrackingMemoryPool* parent_;
+  MemoryPool* pool_;
+  int64_t limit_;
+  LimitCallback on_limit_;
+  std::atomic<int64_t> bytes_allocated_;
+  std::atomic<int64_t> max_memory_;
+};
+
+/// \brief Attribute the allocations of the current thread to a label
+///
+/// Labels nest: the allocations made while several labels are in scope are
+/// attributed to the innermost one.  Only ProfilingMemoryPool looks at them.
+class ARROW_EXPORT ScopedAllocationLabel {
+ public:
+  explicit ScopedAllocationLabel(std::string label);
+  ~ScopedAllocationLabel();
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ScopedAllocationLabel);
+
+  /// The label of the current thread, or an empty string outside of any label
+  static const std::string& current();
+
+ private:
+  std::string label_;
+  const ScopedAllocationLabel* previous_;
+};
+
+/// \brief A memory pool sampling its allocations to find out which
+/// components drive the memory usage.
+///
+/// One in sampling_interval allocations is sampled, and attributed to the
+/// label of the allocating thread (see ScopedAllocationLabel).  Each sample
+/// stands for sampling_interval allocations of its size, so the statistics
+/// by label are estimates unless sampling_interval is 1.  Reallocating or
+/// freeing a sampled allocation updates the label it was sampled with, even
+/// from another thread or label.
+///
+/// Unsampled allocations are delegated without locking, but freeing takes a
+/// lock while sampled allocations are alive.
+class ARROW_EXPORT ProfilingMemoryPool : public MemoryPool {
+ public:
+  /// \brief The estimated statistics of the allocations of a label
+  struct LabelStats {
+    std::string label;
+    int64_t sampled_allocations = 0;
+    /// The bytes allocated in total
+    int64_t allocated_bytes = 0;
+    /// The bytes currently allocated
+    int64_t live_bytes = 0;
+    /// The peak of live_bytes
+    int64_t peak_live_bytes = 0;
+    /// live_bytes when the sampled allocations of all labels peaked
+    int64_t live_bytes_at_peak = 0;
+  };
+
+  struct Report {
+    int64_t bytes_allocated = 0;
+    int64_t max_memory = 0;
+    int64_t sampling_interval = 1;
+    /// Sorted by decreasing live_bytes_at_peak, then peak_live_bytes
+    std::vector<LabelStats> labels;
+
+    /// A human-readable table of the statistics
+    std::string ToString() const;
+  };
+
+  explicit ProfilingMemoryPool(MemoryPool* pool, int64_t sampling_interval = 1);
+  ~ProfilingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  int64_t sampling_interval() const { return sampling_interval_; }
+
+  /// \brief Return the statistics collected so far
+  Report GetReport() const;
+
+ private:
+  class ProfilingMemoryPoolImpl;
+
+  MemoryPool* pool_;
+  int64_t sampling_interval_;
+  std::atomic<int64_t> num_allocations_;
+  internal::MemoryPoolStats stats_;
+  std::unique_ptr<ProfilingMemoryPoolImpl> impl_;
+};
+
 /// Return a process-wide memory pool based on the system allocator.
 ARROW_EXPORT MemoryPool* system_memory_pool();
 
@@ -168,9 +374,84 @@ ARROW_EXPORT Status jemalloc_memory_pool(MemoryPool** out);
 ARROW_EXPORT
 Status jemalloc_set_decay_ms(int ms);
 
+/// \brief Options for the large allocations of the system, jemalloc and
+/// mimalloc memory pools
+struct ARROW_EXPORT LargeAllocationOptions {
+  /// Ask for allocations of at least this many bytes to be backed by
+  /// (transparent) huge pages, to reduce the TLB misses when accessing them.
+  /// Negative to disable.
+  int64_t huge_page_threshold = -1;
+  /// Fault in the pages of allocations of at least this many bytes when they
+  /// are made, with several threads, rather than on first touch.
+  /// Negative to disable.
+  int64_t prefault_threshold = -1;
+  /// The maximum number of threads faulting in the pages of an allocation
+  int prefault_threads = 4;
+};
+
+/// \brief Set the options for the large allocations of the system, jemalloc
+/// and mimalloc memory pools.  By default, large allocations are treated like
+/// the others.
+///
+/// Return NotImplemented if huge pages are requested and the platform doesn't
+/// support them.  Whether they are used in the end depends on the
+/// configuration of the operating system (e.g.
+/// /sys/kernel/mm/transparent_hugepage/enabled on Linux).
+ARROW_EXPORT
+Status set_large_allocation_options(const LargeAllocationOptions& options);
+
+/// \brief Return the options set by set_large_allocation_options()
+ARROW_EXPORT
+LargeAllocationOptions get_large_allocation_options();
+
 /// Return a process-wide memory pool based on mimalloc.
 ///
 /// May return NotImplemented if mimalloc is not available.
 ARROW_EXPORT Status mimalloc_memory_pool(MemoryPool** out);
 
+/// \brief A memory pool placing its large allocations on a NUMA node.
+///
+/// Allocations of at least kMinNumaAllocation bytes are mapped directly from
+/// the operating system, and their pages are placed on the node.  Smaller
+/// allocations are delegated to another pool, and follow the placement policy
+/// of the operating system (usually the node of the thread touching them first).
+///
+/// By default, each allocation is placed on the node of the allocating thread.
+/// Together with a ThreadPool pinning its workers to NUMA nodes, this keeps
+/// the batches allocated and processed by a task on the same node.
+///
+/// Without NUMA support, all allocations are delegated.
+class ARROW_EXPORT NumaMemoryPool : public MemoryPool {
+ public:
+  /// Place each allocation on the node of the allocating thread
+  static constexpr int kLocalNode = -1;
+  static constexpr int64_t kMinNumaAllocation = 256 * 1024;
+
+  explicit NumaMemoryPool(MemoryPool* pool, int node = kLocalNode);
+  ~NumaMemoryPool() override = default;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  int node() const { return node_; }
+
+ private:
+  bool IsMapped(int64_t size) const;
+  Status Map(int64_t size, uint8_t** out);
+  // Free without updating the statistics
+  void Release(uint8_t* buffer, int64_t size);
+
+  MemoryPool* pool_;
+  int node_;
+  internal::MemoryPoolStats stats_;
+};
+
 }  // namespace arrow
@@ -27,6 +27,14 @@ struct SystemAlloc {
   static Result<MemoryPool*> GetAllocator() { return system_memory_pool(); }
 };
 
+// Allocations up to a quarter of the chunk size are served from the arena
+struct ArenaAlloc {
+  static Result<MemoryPool*> GetAllocator() {
+    static ArenaMemoryPool pool(default_memory_pool());
+    return &pool;
+  }
+};
+
 #ifdef ARROW_JEMALLOC
 struct Jemalloc {
   static Result<MemoryPool*> GetAllocator() {
@@ -105,6 +113,52 @@ static void AllocateTouchDeallocate(
   }
 }
 
+// Benchmark the options for large allocations, with a first touch of their
+// pages as e.g. when decoding into them.
+template <typename Alloc>
+static void AllocateTouchLarge(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t nbytes = state.range(0);
+  LargeAllocationOptions options;
+  if (state.range(1) & 1) {
+    options.huge_page_threshold = 0;
+  }
+  if (state.range(1) & 2) {
+    options.prefault_threshold = 0;
+  }
+  MemoryPool* pool = *Alloc::GetAllocator();
+  auto st = set_large_allocation_options(options);
+  if (!st.ok()) {
+    state.SkipWithError(st.ToString().c_str());
+    return;
+  }
+
+  for (auto _ : state) {
+    uint8_t* data;
+    ARROW_CHECK_OK(pool->Allocate(nbytes, &data));
+    for (int64_t i = 0; i < nbytes; i += 4096) {
+      data[i] = 1;
+    }
+    benchmark::ClobberMemory();
+    pool->Free(data, nbytes);
+  }
+  state.SetBytesProcessed(state.iterations() * nbytes);
+  ARROW_CHECK_OK(set_large_allocation_options(LargeAllocationOptions{}));
+}
+
+// The second argument is 0 for the defaults, 1 for huge pages, 2 for
+// prefaulting and 3 for both
+static void LargeAllocationArguments(benchmark::internal::Benchmark* b) {
+  for (const int64_t size : {64 * 1024 * 1024, 256 * 1024 * 1024}) {
+    for (const int64_t options : {0, 1, 2, 3}) {
+      b->Args({size, options});
+    }
+  }
+  b->ArgNames({"size", "options"})->UseRealTime();
+}
+
+#define BENCHMARK_ALLOCATE_LARGE(template_param) \
+  BENCHMARK_TEMPLATE(AllocateTouchLarge, template_param)->Apply(LargeAllocationArguments)
+
 #define BENCHMARK_ALLOCATE_ARGS \
   ->RangeMultiplier(16)->Range(4096, 16 * 1024 * 1024)->ArgName("size")->UseRealTime()
 
@@ -116,14 +170,21 @@ BENCHMARK(TouchArea) BENCHMARK_ALLOCATE_ARGS;
 BENCHMARK_ALLOCATE(AllocateDeallocate, SystemAlloc);
 BENCHMARK_ALLOCATE(AllocateTouchDeallocate, SystemAlloc);
 
+BENCHMARK_ALLOCATE_LARGE(SystemAlloc);
+
+BENCHMARK_ALLOCATE(AllocateDeallocate, ArenaAlloc);
+BENCHMARK_ALLOCATE(AllocateTouchDeallocate, ArenaAlloc);
+
 #ifdef ARROW_JEMALLOC
 BENCHMARK_ALLOCATE(AllocateDeallocate, Jemalloc);
 BENCHMARK_ALLOCATE(AllocateTouchDeallocate, Jemalloc);
+BENCHMARK_ALLOCATE_LARGE(Jemalloc);
 #endif
 
 #ifdef ARROW_MIMALLOC
 BENCHMARK_ALLOCATE(AllocateDeallocate, Mimalloc);
 BENCHMARK_ALLOCATE(AllocateTouchDeallocate, Mimalloc);
+BENCHMARK_ALLOCATE_LARGE(Mimalloc);
 #endif
 
 }  // namespace arrow
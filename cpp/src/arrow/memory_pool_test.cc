@@ -15,7 +15,13 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -44,6 +50,28 @@ struct JemallocMemoryPoolFactory {
 };
 #endif
 
+struct NumaMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    static NumaMemoryPool pool(default_memory_pool());
+    return &pool;
+  }
+};
+
+struct ArenaMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    static ArenaMemoryPool pool(default_memory_pool());
+    return &pool;
+  }
+};
+
+struct TrackingMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    static TrackingMemoryPool root("root", default_memory_pool());
+    static auto child = root.MakeChild("child", /*limit=*/1 << 20);
+    return child.get();
+  }
+};
+
 #ifdef ARROW_MIMALLOC
 struct MimallocMemoryPoolFactory {
   static MemoryPool* memory_pool() {
@@ -76,6 +104,9 @@ REGISTER_TYPED_TEST_SUITE_P(TestMemoryPool, MemoryTracking, OOM, Reallocate);
 
 INSTANTIATE_TYPED_TEST_SUITE_P(Default, TestMemoryPool, DefaultMemoryPoolFactory);
 INSTANTIATE_TYPED_TEST_SUITE_P(System, TestMemoryPool, SystemMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_SUITE_P(Numa, TestMemoryPool, NumaMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_SUITE_P(Arena, TestMemoryPool, ArenaMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_SUITE_P(Tracking, TestMemoryPool, TrackingMemoryPoolFactory);
 
 #ifdef ARROW_JEMALLOC
 INSTANTIATE_TYPED_TEST_SUITE_P(Jemalloc, TestMemoryPool, JemallocMemoryPoolFactory);
@@ -145,6 +176,333 @@ TEST(ProxyMemoryPool, Logging) {
   ASSERT_EQ(0, pp.bytes_allocated());
 }
 
+TEST(NumaMemoryPool, LargeAllocations) {
+  MemoryPool* delegate = default_memory_pool();
+  const int64_t delegated = delegate->bytes_allocated();
+  NumaMemoryPool pool(delegate, /*node=*/0);
+  const int64_t large = NumaMemoryPool::kMinNumaAllocation;
+
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(large, &data));
+  ASSERT_EQ(large, pool.bytes_allocated());
+  ASSERT_EQ(delegated, delegate->bytes_allocated());
+  data[0] = 35;
+  data[large - 1] = 12;
+
+  // Grow a large allocation
+  ASSERT_OK(pool.Reallocate(large, 4 * large, &data));
+  ASSERT_EQ(4 * large, pool.bytes_allocated());
+  ASSERT_EQ(35, data[0]);
+  ASSERT_EQ(12, data[large - 1]);
+
+  // Shrink to a small allocation
+  ASSERT_OK(pool.Reallocate(4 * large, 100, &data));
+  ASSERT_EQ(100, pool.bytes_allocated());
+  ASSERT_EQ(delegated + 100, delegate->bytes_allocated());
+  ASSERT_EQ(35, data[0]);
+  data[99] = 7;
+
+  // Grow back to a large allocation
+  ASSERT_OK(pool.Reallocate(100, large, &data));
+  ASSERT_EQ(large, pool.bytes_allocated());
+  ASSERT_EQ(delegated, delegate->bytes_allocated());
+  ASSERT_EQ(35, data[0]);
+  ASSERT_EQ(7, data[99]);
+
+  pool.Free(data, large);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(4 * large, pool.max_memory());
+  ASSERT_EQ(delegate->backend_name(), pool.backend_name());
+}
+
+TEST(LargeAllocationOptions, Allocations) {
+  const auto defaults = get_large_allocation_options();
+  ASSERT_EQ(-1, defaults.huge_page_threshold);
+  ASSERT_EQ(-1, defaults.prefault_threshold);
+
+  LargeAllocationOptions options;
+  options.prefault_threads = 0;
+  ASSERT_RAISES(Invalid, set_large_allocation_options(options));
+
+  options.huge_page_threshold = 1 << 20;
+  options.prefault_threshold = 1 << 20;
+  options.prefault_threads = 3;
+  Status st = set_large_allocation_options(options);
+  if (st.IsNotImplemented()) {
+    options.huge_page_threshold = -1;
+    st = set_large_allocation_options(options);
+  }
+  ASSERT_OK(st);
+  ASSERT_EQ(options.huge_page_threshold,
+            get_large_allocation_options().huge_page_threshold);
+  ASSERT_EQ(3, get_large_allocation_options().prefault_threads);
+
+  MemoryPool* pool = system_memory_pool();
+  const int64_t size = 40 << 20;
+  uint8_t* data;
+  ASSERT_OK(pool->Allocate(size, &data));
+  std::memset(data, 1, size);
+  ASSERT_OK(pool->Reallocate(size, 2 * size, &data));
+  ASSERT_EQ(1, data[0]);
+  ASSERT_EQ(1, data[size - 1]);
+  data[2 * size - 1] = 2;
+  ASSERT_OK(pool->Reallocate(2 * size, 100, &data));
+  ASSERT_EQ(1, data[99]);
+  pool->Free(data, 100);
+
+  ASSERT_OK(set_large_allocation_options(defaults));
+}
+
+TEST(ArenaMemoryPool, Chunks) {
+  MemoryPool* parent = default_memory_pool();
+  const int64_t parent_allocated = parent->bytes_allocated();
+  const int64_t chunk_size = 4096;
+  ArenaMemoryPool pool(parent, chunk_size);
+  ASSERT_EQ(1024, pool.max_arena_allocation());
+
+  uint8_t *data1, *data2;
+  ASSERT_OK(pool.Allocate(100, &data1));
+  ASSERT_OK(pool.Allocate(1000, &data2));
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data2) % 64);
+  ASSERT_EQ(data1 + 128, data2);
+  ASSERT_EQ(1100, pool.bytes_allocated());
+  ASSERT_EQ(chunk_size, pool.bytes_reserved());
+  ASSERT_EQ(parent_allocated + chunk_size, parent->bytes_allocated());
+
+  // The latest allocation is resized in place, and reclaimed when freed
+  uint8_t* data = data2;
+  ASSERT_OK(pool.Reallocate(1000, 10, &data));
+  ASSERT_EQ(data2, data);
+  pool.Free(data, 10);
+  ASSERT_OK(pool.Allocate(10, &data2));
+  ASSERT_EQ(data, data2);
+
+  // Other allocations are moved, their memory is kept until Reset()
+  uint8_t* first = data1;
+  data1[0] = 42;
+  ASSERT_OK(pool.Reallocate(100, 200, &data1));
+  ASSERT_EQ(data2 + 64, data1);
+  ASSERT_EQ(42, data1[0]);
+  ASSERT_EQ(210, pool.bytes_allocated());
+
+  // Large allocations are delegated
+  uint8_t* large;
+  ASSERT_OK(pool.Allocate(2000, &large));
+  ASSERT_EQ(parent_allocated + chunk_size + 2000, parent->bytes_allocated());
+  ASSERT_OK(pool.Reallocate(2000, 500, &large));
+  ASSERT_EQ(parent_allocated + chunk_size, parent->bytes_allocated());
+
+  // Fill more chunks, then recycle them
+  std::vector<uint8_t*> buffers(10);
+  for (auto& buffer : buffers) {
+    ASSERT_OK(pool.Allocate(1024, &buffer));
+  }
+  ASSERT_EQ(3 * chunk_size, pool.bytes_reserved());
+  for (auto buffer : buffers) {
+    pool.Free(buffer, 1024);
+  }
+  pool.Free(large, 500);
+  pool.Free(data1, 200);
+  pool.Free(data2, 10);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(710 + 10 * 1024, pool.max_memory());
+
+  pool.Reset();
+  ASSERT_EQ(chunk_size, pool.bytes_reserved());
+  ASSERT_EQ(parent_allocated + chunk_size, parent->bytes_allocated());
+  ASSERT_OK(pool.Allocate(64, &data));
+  ASSERT_EQ(first, data);
+  pool.Free(data, 64);
+}
+
+TEST(ArenaMemoryPool, Threads) {
+  ArenaMemoryPool pool(default_memory_pool(), 4096);
+  std::vector<uint8_t*> buffers(4);
+  std::vector<std::thread> threads;
+  for (auto& buffer : buffers) {
+    threads.emplace_back([&] {
+      ASSERT_OK(pool.Allocate(100, &buffer));
+      std::memset(buffer, 1, 100);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  // Each thread has a chunk of its own (thread ids may be reused)
+  std::sort(buffers.begin(), buffers.end());
+  ASSERT_EQ(buffers.end(), std::unique(buffers.begin(), buffers.end()));
+  ASSERT_GE(pool.bytes_reserved(), 4096);
+  ASSERT_EQ(400, pool.bytes_allocated());
+  for (auto buffer : buffers) {
+    pool.Free(buffer, 100);
+  }
+  ASSERT_EQ(0, pool.bytes_allocated());
+}
+
+TEST(TrackingMemoryPool, Hierarchy) {
+  MemoryPool* pool = default_memory_pool();
+  const int64_t pool_allocated = pool->bytes_allocated();
+  TrackingMemoryPool query("query", pool);
+  auto scan = query.MakeChild("scan");
+  auto hash_table = query.MakeChild("hash table");
+  ASSERT_EQ("scan", scan->name());
+  ASSERT_EQ(&query, scan->parent());
+  ASSERT_EQ(nullptr, query.parent());
+  ASSERT_EQ(TrackingMemoryPool::kNoLimit, query.limit());
+  ASSERT_EQ(pool->backend_name(), scan->backend_name());
+
+  uint8_t *data1, *data2;
+  ASSERT_OK(scan->Allocate(100, &data1));
+  ASSERT_OK(hash_table->Allocate(200, &data2));
+  ASSERT_EQ(100, scan->bytes_allocated());
+  ASSERT_EQ(200, hash_table->bytes_allocated());
+  ASSERT_EQ(300, query.bytes_allocated());
+  ASSERT_EQ(pool_allocated + 300, pool->bytes_allocated());
+
+  ASSERT_OK(scan->Reallocate(100, 1000, &data1));
+  ASSERT_EQ(1000, scan->bytes_allocated());
+  ASSERT_EQ(1200, query.bytes_allocated());
+  ASSERT_OK(hash_table->Reallocate(200, 50, &data2));
+  ASSERT_EQ(1050, query.bytes_allocated());
+
+  scan->Free(data1, 1000);
+  hash_table->Free(data2, 50);
+  ASSERT_EQ(0, query.bytes_allocated());
+  ASSERT_EQ(1000, scan->max_memory());
+  ASSERT_EQ(200, hash_table->max_memory());
+  ASSERT_EQ(1200, query.max_memory());
+  ASSERT_EQ(pool_allocated, pool->bytes_allocated());
+}
+
+TEST(TrackingMemoryPool, Limits) {
+  std::vector<std::pair<std::string, int64_t>> limit_calls;
+  auto on_limit = [&](const TrackingMemoryPool& tracker, int64_t size) {
+    limit_calls.emplace_back(tracker.name(), size);
+  };
+  TrackingMemoryPool query("query", default_memory_pool(), 1000, on_limit);
+  auto scan = query.MakeChild("scan", 600, on_limit);
+  auto hash_table = query.MakeChild("hash table");
+
+  uint8_t *data1, *data2, *data3;
+  ASSERT_OK(scan->Allocate(500, &data1));
+  // The limit of the child
+  ASSERT_RAISES(OutOfMemory, scan->Allocate(200, &data2));
+  ASSERT_RAISES(OutOfMemory, scan->Reallocate(500, 700, &data1));
+  ASSERT_EQ(500, scan->bytes_allocated());
+  ASSERT_EQ(500, query.bytes_allocated());
+
+  // The limit of the parent
+  ASSERT_OK(hash_table->Allocate(400, &data2));
+  ASSERT_RAISES(OutOfMemory, hash_table->Allocate(200, &data3));
+  ASSERT_RAISES(OutOfMemory, scan->Allocate(200, &data3));
+  ASSERT_EQ(400, hash_table->bytes_allocated());
+  ASSERT_EQ(500, scan->bytes_allocated());
+  ASSERT_EQ(900, query.bytes_allocated());
+
+  using Call = std::pair<std::string, int64_t>;
+  ASSERT_EQ(limit_calls, std::vector<Call>({{"scan", 200},
+                                            {"scan", 200},
+                                            {"query", 200},
+                                            {"scan", 200}}));
+
+  // Freeing makes room again
+  scan->Free(data1, 500);
+  ASSERT_OK(hash_table->Allocate(200, &data3));
+  ASSERT_EQ(600, query.bytes_allocated());
+  hash_table->Free(data2, 400);
+  hash_table->Free(data3, 200);
+  ASSERT_EQ(0, query.bytes_allocated());
+  ASSERT_EQ(900, query.max_memory());
+}
+
+TEST(ProfilingMemoryPool, Labels) {
+  ProfilingMemoryPool pool(default_memory_pool());
+  ASSERT_EQ(1, pool.sampling_interval());
+  ASSERT_EQ(default_memory_pool()->backend_name(), pool.backend_name());
+  ASSERT_EQ("", ScopedAllocationLabel::current());
+
+  uint8_t *data1, *data2, *data3;
+  {
+    ScopedAllocationLabel scan("scan");
+    ASSERT_EQ("scan", ScopedAllocationLabel::current());
+    ASSERT_OK(pool.Allocate(100, &data1));
+    {
+      ScopedAllocationLabel filter("filter");
+      ASSERT_OK(pool.Allocate(300, &data2));
+    }
+    ASSERT_OK(pool.Reallocate(100, 1000, &data1));
+  }
+  ASSERT_EQ("", ScopedAllocationLabel::current());
+  ASSERT_OK(pool.Allocate(50, &data3));
+  // The peak is reached here
+  pool.Free(data2, 300);
+  // Freed by another label than the one it was allocated with
+  ScopedAllocationLabel other("other");
+  ASSERT_OK(pool.Reallocate(1000, 200, &data1));
+  ASSERT_EQ(250, pool.bytes_allocated());
+  ASSERT_EQ(1350, pool.max_memory());
+
+  auto report = pool.GetReport();
+  ASSERT_EQ(250, report.bytes_allocated);
+  ASSERT_EQ(1350, report.max_memory);
+  ASSERT_EQ(1, report.sampling_interval);
+  ASSERT_EQ(3, report.labels.size());
+  const auto& scan = report.labels[0];
+  ASSERT_EQ("scan", scan.label);
+  ASSERT_EQ(1, scan.sampled_allocations);
+  ASSERT_EQ(1000, scan.allocated_bytes);
+  ASSERT_EQ(200, scan.live_bytes);
+  ASSERT_EQ(1000, scan.peak_live_bytes);
+  ASSERT_EQ(1000, scan.live_bytes_at_peak);
+  const auto& filter = report.labels[1];
+  ASSERT_EQ("filter", filter.label);
+  ASSERT_EQ(300, filter.allocated_bytes);
+  ASSERT_EQ(0, filter.live_bytes);
+  ASSERT_EQ(300, filter.peak_live_bytes);
+  ASSERT_EQ(300, filter.live_bytes_at_peak);
+  const auto& unlabeled = report.labels[2];
+  ASSERT_EQ("", unlabeled.label);
+  ASSERT_EQ(50, unlabeled.live_bytes);
+  ASSERT_EQ(50, unlabeled.live_bytes_at_peak);
+
+  auto table = report.ToString();
+  ASSERT_NE(std::string::npos, table.find("max memory: 1350"));
+  ASSERT_NE(std::string::npos, table.find("scan\t1000\t1000\t200\t1000\t1\n"));
+  ASSERT_NE(std::string::npos, table.find("(unlabeled)\t50\t50\t50\t50\t1\n"));
+
+  pool.Free(data1, 200);
+  pool.Free(data3, 50);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  for (const auto& stats : pool.GetReport().labels) {
+    ASSERT_EQ(0, stats.live_bytes);
+  }
+}
+
+TEST(ProfilingMemoryPool, Sampling) {
+  ProfilingMemoryPool pool(default_memory_pool(), /*sampling_interval=*/4);
+  ScopedAllocationLabel label("label");
+
+  std::vector<uint8_t*> buffers(10);
+  for (auto& buffer : buffers) {
+    ASSERT_OK(pool.Allocate(64, &buffer));
+  }
+  ASSERT_EQ(640, pool.bytes_allocated());
+  // Allocations 0, 4 and 8 are sampled, each standing for 4 allocations
+  auto report = pool.GetReport();
+  ASSERT_EQ(1, report.labels.size());
+  ASSERT_EQ(3, report.labels[0].sampled_allocations);
+  ASSERT_EQ(768, report.labels[0].allocated_bytes);
+  ASSERT_EQ(768, report.labels[0].live_bytes);
+
+  for (auto buffer : buffers) {
+    pool.Free(buffer, 64);
+  }
+  report = pool.GetReport();
+  ASSERT_EQ(0, report.bytes_allocated);
+  ASSERT_EQ(0, report.labels[0].live_bytes);
+  ASSERT_EQ(768, report.labels[0].peak_live_bytes);
+}
+
 TEST(Jemalloc, SetDirtyPageDecayMillis) {
   // ARROW-6910
 #ifdef ARROW_JEMALLOC
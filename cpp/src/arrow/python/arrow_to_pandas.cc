@@ -20,6 +20,7 @@
 #include "arrow/python/arrow_to_pandas.h"
 #include "arrow/python/numpy_interop.h"  // IWYU pragma: expand
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <iostream>
@@ -44,6 +45,7 @@
 #include "arrow/util/macros.h"
 #include "arrow/util/parallel.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 #include "arrow/compute/api.h"
@@ -77,6 +79,8 @@ PandasOptions MakeInnerOptions(PandasOptions options) {
   options.decode_dictionaries = true;
   options.categorical_columns.clear();
   options.strings_to_categorical = false;
+  // Inner arrays are converted under the GIL, which the threads would need
+  options.use_threads = false;
 
   // In ARROW-7723, we found as a result of ARROW-3789 that second
   // through microsecond resolution tz-aware timestamps were being promoted to
@@ -359,8 +363,14 @@ class PandasWriter {
   /// copy if possible (or error if not possible and zero_copy_only=True)
   virtual Status TransferSingle(std::shared_ptr<ChunkedArray> data, PyObject* py_ref) = 0;
 
-  /// \brief Copy ChunkedArray into a multi-column block
-  virtual Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement) = 0;
+  /// \brief Copy ChunkedArray into a multi-column block, from row_offset in
+  /// its column
+  virtual Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement,
+                          int64_t row_offset) = 0;
+
+  /// \brief Whether CopyInto doesn't need the GIL, so that the rows of a
+  /// column can be copied by several threads
+  virtual bool CanCopyRowsInParallel() const { return false; }
 
   Status EnsurePlacementAllocated() {
     std::lock_guard<std::mutex> guard(allocation_lock_);
@@ -399,12 +409,29 @@ class PandasWriter {
           CheckNoZeroCopy("Cannot do zero copy conversion into "
                           "multi-column DataFrame block"));
       RETURN_NOT_OK(EnsureAllocated());
-      RETURN_NOT_OK(CopyInto(data, rel_placement));
+      RETURN_NOT_OK(CopyInto(data, rel_placement, /*row_offset=*/0));
     }
     placement_data_[rel_placement] = abs_placement;
     return Status::OK();
   }
 
+  /// \brief Copy the rows of a column starting at row_offset into a
+  /// multi-column block
+  Status WriteRows(std::shared_ptr<ChunkedArray> data, int64_t abs_placement,
+                   int64_t rel_placement, int64_t row_offset) {
+    DCHECK(CanCopyRowsInParallel());
+    RETURN_NOT_OK(EnsurePlacementAllocated());
+    RETURN_NOT_OK(
+        CheckNoZeroCopy("Cannot do zero copy conversion into "
+                        "multi-column DataFrame block"));
+    RETURN_NOT_OK(EnsureAllocated());
+    RETURN_NOT_OK(CopyInto(std::move(data), rel_placement, row_offset));
+    if (row_offset == 0) {
+      placement_data_[rel_placement] = abs_placement;
+    }
+    return Status::OK();
+  }
+
   virtual Status GetDataFrameResult(PyObject** out) {
     PyObject* result = PyDict_New();
     RETURN_IF_PYERROR();
@@ -946,7 +973,7 @@ class TypedPandasWriter : public PandasWriter {
     } else {
       RETURN_NOT_OK(CheckNotZeroCopyOnly(*data));
       RETURN_NOT_OK(EnsureAllocated());
-      return CopyInto(data, /*rel_placement=*/0);
+      return CopyInto(data, /*rel_placement=*/0, /*row_offset=*/0);
     }
   }
 
@@ -958,8 +985,8 @@ class TypedPandasWriter : public PandasWriter {
     return Status::OK();
   }
 
-  T* GetBlockColumnStart(int64_t rel_placement) {
-    return reinterpret_cast<T*>(block_data_) + rel_placement * num_rows_;
+  T* GetBlockColumnStart(int64_t rel_placement, int64_t row_offset) {
+    return reinterpret_cast<T*>(block_data_) + rel_placement * num_rows_ + row_offset;
   }
 
  protected:
@@ -1154,10 +1181,11 @@ struct ObjectWriterVisitor {
 class ObjectWriter : public TypedPandasWriter<NPY_OBJECT> {
  public:
   using TypedPandasWriter<NPY_OBJECT>::TypedPandasWriter;
-  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement) override {
+  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement,
+                  int64_t row_offset) override {
     PyAcquireGIL lock;
     ObjectWriterVisitor visitor{this->options_, *data,
-                                this->GetBlockColumnStart(rel_placement)};
+                                this->GetBlockColumnStart(rel_placement, row_offset)};
     return VisitTypeInline(*data->type(), &visitor);
   }
 };
@@ -1176,10 +1204,13 @@ class IntWriter : public TypedPandasWriter<NPY_TYPE> {
     return IsNonNullContiguous(data);
   }
 
-  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement) override {
+  bool CanCopyRowsInParallel() const override { return true; }
+
+  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement,
+                  int64_t row_offset) override {
     RETURN_NOT_OK(this->CheckTypeExact(*data->type(), ArrowType::type_id));
     ConvertIntegerNoNullsSameType<typename ArrowType::c_type>(
-        this->options_, *data, this->GetBlockColumnStart(rel_placement));
+        this->options_, *data, this->GetBlockColumnStart(rel_placement, row_offset));
     return Status::OK();
   }
 };
@@ -1195,9 +1226,12 @@ class FloatWriter : public TypedPandasWriter<NPY_TYPE> {
     return IsNonNullContiguous(data) && data.type()->id() == ArrowType::type_id;
   }
 
-  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement) override {
+  bool CanCopyRowsInParallel() const override { return true; }
+
+  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement,
+                  int64_t row_offset) override {
     Type::type in_type = data->type()->id();
-    auto out_values = this->GetBlockColumnStart(rel_placement);
+    auto out_values = this->GetBlockColumnStart(rel_placement, row_offset);
 
 #define INTEGER_CASE(IN_TYPE)                                             \
   ConvertIntegerWithNulls<IN_TYPE, T>(this->options_, *data, out_values); \
@@ -1261,12 +1295,15 @@ class BoolWriter : public TypedPandasWriter<NPY_BOOL> {
         CheckNoZeroCopy("Zero copy conversions not possible with "
                         "boolean types"));
     RETURN_NOT_OK(EnsureAllocated());
-    return CopyInto(data, /*rel_placement=*/0);
+    return CopyInto(data, /*rel_placement=*/0, /*row_offset=*/0);
   }
 
-  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement) override {
+  bool CanCopyRowsInParallel() const override { return true; }
+
+  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement,
+                  int64_t row_offset) override {
     RETURN_NOT_OK(this->CheckTypeExact(*data->type(), Type::BOOL));
-    auto out_values = this->GetBlockColumnStart(rel_placement);
+    auto out_values = this->GetBlockColumnStart(rel_placement, row_offset);
     for (int c = 0; c < data->num_chunks(); c++) {
       const auto& arr = checked_cast<const BooleanArray&>(*data->chunk(c));
       for (int64_t i = 0; i < arr.length(); ++i) {
@@ -1309,8 +1346,11 @@ class DatetimeDayWriter : public TypedPandasWriter<NPY_DATETIME> {
  public:
   using TypedPandasWriter<NPY_DATETIME>::TypedPandasWriter;
 
-  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement) override {
-    int64_t* out_values = this->GetBlockColumnStart(rel_placement);
+  bool CanCopyRowsInParallel() const override { return true; }
+
+  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement,
+                  int64_t row_offset) override {
+    int64_t* out_values = this->GetBlockColumnStart(rel_placement, row_offset);
     const auto& type = checked_cast<const DateType&>(*data->type());
     switch (type.unit()) {
       case DateUnit::DAY:
@@ -1345,12 +1385,15 @@ class DatetimeWriter : public TypedPandasWriter<NPY_DATETIME> {
     }
   }
 
-  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement) override {
+  bool CanCopyRowsInParallel() const override { return true; }
+
+  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement,
+                  int64_t row_offset) override {
     const auto& ts_type = checked_cast<const TimestampType&>(*data->type());
     DCHECK_EQ(UNIT, ts_type.unit()) << "Should only call instances of this writer "
                                     << "with arrays of the correct unit";
     ConvertNumericNullable<int64_t>(*data, kPandasTimestampNull,
-                                    this->GetBlockColumnStart(rel_placement));
+                                    this->GetBlockColumnStart(rel_placement, row_offset));
     return Status::OK();
   }
 
@@ -1370,9 +1413,10 @@ class DatetimeNanoWriter : public DatetimeWriter<TimeUnit::NANO> {
  public:
   using DatetimeWriter<TimeUnit::NANO>::DatetimeWriter;
 
-  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement) override {
+  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement,
+                  int64_t row_offset) override {
     Type::type type = data->type()->id();
-    int64_t* out_values = this->GetBlockColumnStart(rel_placement);
+    int64_t* out_values = this->GetBlockColumnStart(rel_placement, row_offset);
     compute::ExecContext ctx(options_.pool);
     compute::CastOptions options;
     if (options_.safe_cast) {
@@ -1454,12 +1498,15 @@ class TimedeltaWriter : public TypedPandasWriter<NPY_TIMEDELTA> {
     return IsNonNullContiguous(data) && type.unit() == UNIT;
   }
 
-  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement) override {
+  bool CanCopyRowsInParallel() const override { return true; }
+
+  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement,
+                  int64_t row_offset) override {
     const auto& type = checked_cast<const DurationType&>(*data->type());
     DCHECK_EQ(UNIT, type.unit()) << "Should only call instances of this writer "
                                  << "with arrays of the correct unit";
     ConvertNumericNullable<int64_t>(*data, kPandasTimestampNull,
-                                    this->GetBlockColumnStart(rel_placement));
+                                    this->GetBlockColumnStart(rel_placement, row_offset));
     return Status::OK();
   }
 
@@ -1475,9 +1522,10 @@ class TimedeltaNanoWriter : public TimedeltaWriter<TimeUnit::NANO> {
  public:
   using TimedeltaWriter<TimeUnit::NANO>::TimedeltaWriter;
 
-  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement) override {
+  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement,
+                  int64_t row_offset) override {
     Type::type type = data->type()->id();
-    int64_t* out_values = this->GetBlockColumnStart(rel_placement);
+    int64_t* out_values = this->GetBlockColumnStart(rel_placement, row_offset);
     if (type == Type::DURATION) {
       const auto& ts_type = checked_cast<const DurationType&>(*data->type());
       if (ts_type.unit() == TimeUnit::NANO) {
@@ -1535,7 +1583,8 @@ class CategoricalWriter
         ordered_(false),
         needs_copy_(false) {}
 
-  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement) override {
+  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement,
+                  int64_t row_offset) override {
     return Status::NotImplemented("categorical type");
   }
 
@@ -1701,7 +1750,8 @@ class ExtensionWriter : public PandasWriter {
     return Status::OK();
   }
 
-  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement) override {
+  Status CopyInto(std::shared_ptr<ChunkedArray> data, int64_t rel_placement,
+                  int64_t row_offset) override {
     return TransferSingle(data, nullptr);
   }
 
@@ -1979,6 +2029,9 @@ class PandasBlockCreator {
   std::vector<int> column_block_placement_;
 };
 
+// The minimum number of rows of a column written by a single task
+constexpr int64_t kMinRowsPerWriteTask = 1 << 16;
+
 class ConsolidatedBlockCreator : public PandasBlockCreator {
  public:
   using PandasBlockCreator::PandasBlockCreator;
@@ -2072,14 +2125,52 @@ class ConsolidatedBlockCreator : public PandasBlockCreator {
   }
 
   Status WriteTableToBlocks() {
-    auto WriteColumn = [this](int i) {
+    // Each task writes a column, or a range of rows of a column: when there are
+    // fewer columns than threads, the rows of the columns which are copied
+    // without the GIL are split so that all threads get work
+    struct WriteTask {
+      int column;
+      int64_t row_offset;
+      // -1 to write the whole column
+      int64_t length;
+    };
+    std::vector<WriteTask> tasks;
+
+    int64_t num_row_ranges = 1;
+    if (options_.use_threads && !options_.self_destruct &&
+        !options_.allow_zero_copy_blocks && num_columns_ > 0) {
+      const int64_t capacity = ::arrow::internal::GetCpuThreadPool()->GetCapacity();
+      num_row_ranges = std::min((capacity + num_columns_ - 1) / num_columns_,
+                                num_rows_ / kMinRowsPerWriteTask);
+    }
+    for (int i = 0; i < num_columns_; ++i) {
       std::shared_ptr<PandasWriter> block;
       RETURN_NOT_OK(this->GetWriter(i, &block));
+      if (num_row_ranges > 1 && block->CanCopyRowsInParallel()) {
+        const int64_t range_length = (num_rows_ + num_row_ranges - 1) / num_row_ranges;
+        for (int64_t offset = 0; offset < num_rows_; offset += range_length) {
+          tasks.push_back({i, offset, std::min(range_length, num_rows_ - offset)});
+        }
+      } else {
+        tasks.push_back({i, 0, -1});
+      }
+    }
+
+    auto WriteColumn = [this, &tasks](int task_index) {
+      const WriteTask& task = tasks[task_index];
+      const int i = task.column;
+      std::shared_ptr<PandasWriter> block;
+      RETURN_NOT_OK(this->GetWriter(i, &block));
+      if (task.length >= 0) {
+        return block->WriteRows(arrays_[i]->Slice(task.row_offset, task.length), i,
+                                this->column_block_placement_[i], task.row_offset);
+      }
       // ARROW-3789 Use std::move on the array to permit self-destructing
       return block->Write(std::move(arrays_[i]), i, this->column_block_placement_[i]);
     };
 
-    return OptionalParallelFor(options_.use_threads, num_columns_, WriteColumn);
+    return OptionalParallelFor(options_.use_threads, static_cast<int>(tasks.size()),
+                               WriteColumn);
   }
 
  private:
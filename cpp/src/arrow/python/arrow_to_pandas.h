@@ -51,7 +51,10 @@ struct PandasOptions {
   bool integer_object_nulls = false;
   bool date_as_object = false;
   bool timestamp_as_object = false;
-  bool use_threads = false;
+
+  /// If true, write the columns of a Table, and ranges of rows of its long
+  /// columns, on the CPU thread pool. The caller must not hold the GIL.
+  bool use_threads = true;
 
   /// Coerce all date and timestamp to datetime64[ns]
   bool coerce_temporal_nanoseconds = false;
@@ -64,7 +67,7 @@ struct PandasOptions {
   /// \brief If true, do not create duplicate PyObject versions of equal
   /// objects. This only applies to immutable objects like strings or datetime
   /// objects
-  bool deduplicate_objects = false;
+  bool deduplicate_objects = true;
 
   /// \brief For certain data types, a cast is needed in order to store the
   /// data in a pandas DataFrame or Series (e.g. timestamps are always stored
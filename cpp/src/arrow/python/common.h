@@ -231,9 +231,16 @@ struct PyBytesView {
 
   // View the given Python object as unicode string
   Status ParseUnicode(PyObject* obj) {
-    // The utf-8 representation is cached on the unicode object
-    bytes = PyUnicode_AsUTF8AndSize(obj, &size);
-    RETURN_IF_PYERROR();
+    if (PyUnicode_IS_READY(obj) && PyUnicode_IS_COMPACT_ASCII(obj)) {
+      // The data of a compact ASCII string is also its utf-8 representation,
+      // read it without going through the CPython API
+      bytes = reinterpret_cast<const char*>(PyUnicode_DATA(obj));
+      size = PyUnicode_GET_LENGTH(obj);
+    } else {
+      // The utf-8 representation is cached on the unicode object
+      bytes = PyUnicode_AsUTF8AndSize(obj, &size);
+      RETURN_IF_PYERROR();
+    }
     is_utf8 = true;
     return Status::OK();
   }
@@ -30,6 +30,7 @@
 #include "arrow/util/decimal.h"
 
 #include "arrow/python/arrow_to_pandas.h"
+#include "arrow/python/common.h"
 #include "arrow/python/decimal.h"
 #include "arrow/python/helpers.h"
 #include "arrow/python/python_to_arrow.h"
@@ -186,6 +187,17 @@ TEST(PyBuffer, InvalidInputObject) {
   ASSERT_EQ(old_refcnt, Py_REFCNT(input));
 }
 
+TEST(PyBytesView, Unicode) {
+  PyAcquireGIL lock;
+  for (const std::string& value : {"", "ascii", "caf\xc3\xa9", "\xf0\x9f\x98\x80!"}) {
+    OwnedRef unicode(PyUnicode_FromStringAndSize(value.data(), value.size()));
+    ASSERT_NE(unicode.obj(), nullptr);
+    ASSERT_OK_AND_ASSIGN(auto view, PyBytesView::FromUnicode(unicode.obj()));
+    ASSERT_TRUE(view.is_utf8);
+    ASSERT_EQ(value, std::string(view.bytes, view.size));
+  }
+}
+
 class DecimalTest : public ::testing::Test {
  public:
   DecimalTest() : lock_(), decimal_constructor_() {
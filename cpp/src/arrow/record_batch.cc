@@ -19,6 +19,8 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -29,10 +31,14 @@
 #include "arrow/pretty_print.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/util/atomic_shared_ptr.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
@@ -184,6 +190,256 @@ Result<std::shared_ptr<StructArray>> RecordBatch::ToStructArray() const {
                                        /*offset=*/0);
 }
 
+// ----------------------------------------------------------------------
+// Conversion to and from tensors
+
+namespace {
+
+// Below this number of values, a tensor conversion copies on the calling thread
+constexpr int64_t kMinParallelTensorCopySize = 1 << 16;
+
+bool UseThreadsForTensorCopy(int num_columns, int64_t num_rows) {
+  auto pool = internal::GetCpuThreadPool();
+  return num_columns > 1 && num_rows * num_columns >= kMinParallelTensorCopySize &&
+         pool->GetCapacity() > 1 && !pool->OwnsThisThread();
+}
+
+template <typename T>
+void CopyStridedValues(const uint8_t* src, int64_t src_stride, uint8_t* dest,
+                       int64_t dest_stride, int64_t length) {
+  for (int64_t i = 0; i < length; ++i) {
+    std::memcpy(dest + i * dest_stride, src + i * src_stride, sizeof(T));
+  }
+}
+
+// Copy values between strided locations, strides being in bytes
+void CopyStrided(int byte_width, const uint8_t* src, int64_t src_stride, uint8_t* dest,
+                 int64_t dest_stride, int64_t length) {
+  if (length == 0) {
+    return;
+  }
+  if (src_stride == byte_width && dest_stride == byte_width) {
+    std::memcpy(dest, src, static_cast<size_t>(length * byte_width));
+    return;
+  }
+  switch (byte_width) {
+    case 1:
+      return CopyStridedValues<uint8_t>(src, src_stride, dest, dest_stride, length);
+    case 2:
+      return CopyStridedValues<uint16_t>(src, src_stride, dest, dest_stride, length);
+    case 4:
+      return CopyStridedValues<uint32_t>(src, src_stride, dest, dest_stride, length);
+    default:
+      DCHECK_EQ(byte_width, 8);
+      return CopyStridedValues<uint64_t>(src, src_stride, dest, dest_stride, length);
+  }
+}
+
+// Overwrite the values of the null slots of a floating-point column with NaN
+void FillNullsWithNaN(const ArrayData& column, uint8_t* dest, int64_t dest_stride) {
+  uint8_t nan[sizeof(double)];
+  int byte_width;
+  switch (column.type->id()) {
+    case Type::HALF_FLOAT: {
+      const uint16_t value = 0x7e00;
+      byte_width = sizeof(value);
+      std::memcpy(nan, &value, sizeof(value));
+    } break;
+    case Type::FLOAT: {
+      const float value = std::numeric_limits<float>::quiet_NaN();
+      byte_width = sizeof(value);
+      std::memcpy(nan, &value, sizeof(value));
+    } break;
+    default: {
+      DCHECK_EQ(column.type->id(), Type::DOUBLE);
+      const double value = std::numeric_limits<double>::quiet_NaN();
+      byte_width = sizeof(value);
+      std::memcpy(nan, &value, sizeof(value));
+    } break;
+  }
+  internal::BitRunReader reader(column.buffers[0]->data(), column.offset, column.length);
+  int64_t position = 0;
+  for (internal::BitRun run = reader.NextRun(); run.length != 0;
+       run = reader.NextRun()) {
+    if (!run.set) {
+      for (int64_t i = position; i < position + run.length; ++i) {
+        std::memcpy(dest + i * dest_stride, nan, byte_width);
+      }
+    }
+    position += run.length;
+  }
+}
+
+// Return a tensor viewing the columns of a record batch if they are equally
+// spaced slices of a common buffer, otherwise null
+std::shared_ptr<Tensor> MakeTensorView(const RecordBatch& batch, int byte_width,
+                                       bool row_major) {
+  const int num_columns = batch.num_columns();
+  const int64_t num_rows = batch.num_rows();
+  if (num_rows == 0) {
+    return nullptr;
+  }
+  const int64_t column_size = num_rows * byte_width;
+  std::shared_ptr<Buffer> base;
+  uintptr_t first = 0;
+  int64_t column_stride = column_size;
+  for (int i = 0; i < num_columns; ++i) {
+    const ArrayData& column = *batch.column_data(i);
+    const std::shared_ptr<Buffer>& values = column.buffers[1];
+    if (values == nullptr) {
+      return nullptr;
+    }
+    // Slices of a buffer share its parent
+    const std::shared_ptr<Buffer>& parent =
+        values->parent() != nullptr ? values->parent() : values;
+    const uintptr_t address = values->address() + column.offset * byte_width;
+    if (i == 0) {
+      base = parent;
+      first = address;
+      continue;
+    }
+    if (parent != base || address < first) {
+      return nullptr;
+    }
+    if (i == 1) {
+      column_stride = static_cast<int64_t>(address - first);
+      if (column_stride < column_size || column_stride % byte_width != 0) {
+        return nullptr;
+      }
+    } else if (address != first + i * column_stride) {
+      return nullptr;
+    }
+  }
+  const int64_t offset = static_cast<int64_t>(first - base->address());
+  const int64_t size = (num_columns - 1) * column_stride + column_size;
+  if (first < base->address() || offset + size > base->size()) {
+    return nullptr;
+  }
+  if (row_major) {
+    // Only a single column can be viewed as a row-major tensor
+    DCHECK_EQ(num_columns, 1);
+    column_stride = byte_width;
+  }
+  return std::make_shared<Tensor>(batch.column(0)->type(),
+                                  SliceBuffer(base, offset, size),
+                                  std::vector<int64_t>{num_rows, num_columns},
+                                  std::vector<int64_t>{byte_width, column_stride});
+}
+
+}  // namespace
+
+Result<std::shared_ptr<Tensor>> RecordBatch::ToTensor(bool null_to_nan, bool row_major,
+                                                      MemoryPool* pool) const {
+  const int num_columns = this->num_columns();
+  if (num_columns == 0) {
+    return Status::Invalid("Cannot convert a record batch without columns to a tensor");
+  }
+  const auto& type = column(0)->type();
+  if (!is_tensor_supported(type->id())) {
+    return Status::TypeError("Cannot convert column of type ", *type, " to a tensor");
+  }
+  bool has_nulls = false;
+  for (int i = 0; i < num_columns; ++i) {
+    const ArrayData& column = *column_data(i);
+    if (!column.type->Equals(*type)) {
+      return Status::TypeError(
+          "Cannot convert a record batch with columns of different types to a "
+          "tensor: ",
+          *type, " vs ", *column.type);
+    }
+    if (column.buffers[1] != nullptr && !column.buffers[1]->is_cpu()) {
+      return Status::Invalid("Cannot convert a record batch residing on a device");
+    }
+    if (column.GetNullCount() != 0) {
+      if (!null_to_nan) {
+        return Status::Invalid("Cannot convert a record batch with nulls to a tensor");
+      }
+      if (!is_floating(type->id())) {
+        return Status::TypeError("Cannot convert nulls of type ", *type, " to NaN");
+      }
+      has_nulls = true;
+    }
+  }
+  const int byte_width = internal::GetByteWidth(*type);
+
+  // Zero-copy when the columns are already laid out as a column-major tensor
+  // (or the only column is laid out as any tensor)
+  if (!has_nulls && (!row_major || num_columns == 1)) {
+    auto view = MakeTensorView(*this, byte_width, row_major);
+    if (view != nullptr) {
+      return view;
+    }
+  }
+
+  const int64_t num_rows = this->num_rows();
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> data,
+                        AllocateBuffer(num_rows * num_columns * byte_width, pool));
+  // The offset of the columns and rows in the tensor data
+  const int64_t column_stride = row_major ? byte_width : num_rows * byte_width;
+  const int64_t row_stride = row_major ? num_columns * byte_width : byte_width;
+  RETURN_NOT_OK(internal::OptionalParallelFor(
+      UseThreadsForTensorCopy(num_columns, num_rows), num_columns, [&](int i) {
+        const ArrayData& column = *column_data(i);
+        uint8_t* dest = data->mutable_data() + i * column_stride;
+        CopyStrided(byte_width, column.GetValues<uint8_t>(1, column.offset * byte_width),
+                    byte_width, dest, row_stride, num_rows);
+        if (column.GetNullCount() != 0) {
+          FillNullsWithNaN(column, dest, row_stride);
+        }
+        return Status::OK();
+      }));
+  return Tensor::Make(type, std::move(data), {num_rows, num_columns},
+                      {row_stride, column_stride});
+}
+
+Result<std::shared_ptr<RecordBatch>> RecordBatch::FromTensor(
+    const std::shared_ptr<Tensor>& tensor, const std::vector<std::string>& field_names,
+    MemoryPool* pool) {
+  if (tensor->ndim() != 1 && tensor->ndim() != 2) {
+    return Status::Invalid("Cannot construct record batch from a tensor of ",
+                           tensor->ndim(), " dimensions");
+  }
+  const int64_t num_rows = tensor->shape()[0];
+  const int64_t row_stride = tensor->strides()[0];
+  const int64_t num_columns = tensor->ndim() == 2 ? tensor->shape()[1] : 1;
+  const int64_t column_stride = tensor->ndim() == 2 ? tensor->strides()[1] : 0;
+  if (num_columns > std::numeric_limits<int>::max()) {
+    return Status::Invalid("Cannot construct record batch with ", num_columns,
+                           " columns");
+  }
+  if (!field_names.empty() && static_cast<int64_t>(field_names.size()) != num_columns) {
+    return Status::Invalid("Expected ", num_columns, " field names, got ",
+                           field_names.size());
+  }
+  const auto& type = tensor->type();
+  const int byte_width = internal::GetByteWidth(*type);
+  // The columns of a column-major tensor are contiguous
+  const bool zero_copy = row_stride == byte_width || num_rows <= 1;
+  if (!zero_copy && !tensor->data()->is_cpu()) {
+    return Status::Invalid("Cannot copy a tensor residing on a device");
+  }
+
+  FieldVector fields(num_columns);
+  ArrayDataVector columns(num_columns);
+  RETURN_NOT_OK(internal::OptionalParallelFor(
+      !zero_copy && UseThreadsForTensorCopy(static_cast<int>(num_columns), num_rows),
+      static_cast<int>(num_columns), [&](int i) {
+        std::shared_ptr<Buffer> values;
+        if (zero_copy) {
+          values = SliceBuffer(tensor->data(), i * column_stride, num_rows * byte_width);
+        } else {
+          ARROW_ASSIGN_OR_RAISE(values, AllocateBuffer(num_rows * byte_width, pool));
+          CopyStrided(byte_width, tensor->raw_data() + i * column_stride, row_stride,
+                      values->mutable_data(), byte_width, num_rows);
+        }
+        fields[i] = field(field_names.empty() ? std::to_string(i) : field_names[i], type);
+        columns[i] = ArrayData::Make(type, num_rows, {nullptr, std::move(values)},
+                                     /*null_count=*/0);
+        return Status::OK();
+      }));
+  return Make(arrow::schema(std::move(fields)), num_rows, std::move(columns));
+}
+
 std::vector<std::shared_ptr<Array>> RecordBatch::columns() const {
   std::vector<std::shared_ptr<Array>> children(num_columns());
   for (int i = 0; i < num_columns(); ++i) {
@@ -260,11 +516,15 @@ Status RecordBatch::Validate() const {
 
 Status RecordBatch::ValidateFull() const {
   RETURN_NOT_OK(Validate());
-  for (int i = 0; i < num_columns(); ++i) {
-    const auto& array = *this->column(i);
-    RETURN_NOT_OK(internal::ValidateArrayData(array));
-  }
-  return Status::OK();
+  // Columns are validated in parallel, unless called from the CPU thread
+  // pool, whose tasks shouldn't wait on each other.  The error reported is
+  // that of the first invalid column either way.
+  auto pool = internal::GetCpuThreadPool();
+  const bool use_threads = num_columns() > 1 && pool->GetCapacity() > 1 &&
+                           !pool->OwnsThisThread();
+  return internal::OptionalParallelFor(use_threads, num_columns(), [&](int i) {
+    return internal::ValidateArrayData(*this->column(i));
+  });
 }
 
 // ----------------------------------------------------------------------
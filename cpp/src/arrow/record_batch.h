@@ -75,6 +75,37 @@ class ARROW_EXPORT RecordBatch {
   static Result<std::shared_ptr<RecordBatch>> FromStructArray(
       const std::shared_ptr<Array>& array);
 
+  /// \brief Convert record batch to a two-dimensional tensor
+  ///
+  /// The columns must all have the same numeric type; the tensor has shape
+  /// {num_rows, num_columns}.  A column-major tensor is a zero-copy view over
+  /// the columns when they have no nulls and are equally spaced in a common
+  /// buffer, e.g. when the record batch was made by FromTensor.  Otherwise the
+  /// values are copied, one column per task on the CPU thread pool.
+  ///
+  /// \param[in] null_to_nan if true, nulls of floating-point columns are
+  /// converted to NaN, otherwise nulls are an error
+  /// \param[in] row_major whether to return a row-major or column-major tensor
+  /// \param[in] pool the pool for the tensor data, if copied
+  Result<std::shared_ptr<Tensor>> ToTensor(
+      bool null_to_nan = false, bool row_major = true,
+      MemoryPool* pool = default_memory_pool()) const;
+
+  /// \brief Construct record batch from the columns of a two-dimensional tensor
+  ///
+  /// The columns of a column-major tensor are zero-copy slices of the tensor
+  /// data, while the columns of other tensors are copied.  A one-dimensional
+  /// tensor is converted to a single column.
+  ///
+  /// \param[in] tensor the tensor of shape {num_rows, num_columns}
+  /// \param[in] field_names the names of the columns, by default their
+  /// indices
+  /// \param[in] pool the pool for the column data, if copied
+  static Result<std::shared_ptr<RecordBatch>> FromTensor(
+      const std::shared_ptr<Tensor>& tensor,
+      const std::vector<std::string>& field_names = {},
+      MemoryPool* pool = default_memory_pool());
+
   /// \brief Determine if two record batches are exactly equal
   ///
   /// \param[in] other the RecordBatch to compare with
@@ -173,6 +204,7 @@ class ARROW_EXPORT RecordBatch {
   /// within the record batch's schema and internal data.
   ///
   /// This is potentially O(k*n) where n is the number of rows.
+  /// Columns are validated in parallel on the CPU thread pool.
   ///
   /// \return Status
   virtual Status ValidateFull() const;
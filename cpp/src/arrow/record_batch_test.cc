@@ -16,7 +16,9 @@
 // under the License.
 
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <gmock/gmock.h>
@@ -29,6 +31,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/tensor.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
@@ -249,4 +252,143 @@ TEST_F(TestRecordBatch, FromStructArrayInvalidNullCount) {
   ASSERT_RAISES(Invalid, RecordBatch::FromStructArray(struct_array));
 }
 
+class TestRecordBatchToTensor : public TestRecordBatch {
+ public:
+  std::shared_ptr<RecordBatch> MakeBatch(const std::shared_ptr<DataType>& type,
+                                         const std::vector<std::string>& columns_json) {
+    FieldVector fields;
+    ArrayVector columns;
+    for (const auto& json : columns_json) {
+      fields.push_back(field("f" + std::to_string(fields.size()), type));
+      columns.push_back(ArrayFromJSON(type, json));
+    }
+    return RecordBatch::Make(schema(fields), columns[0]->length(), columns);
+  }
+
+  void AssertTensorEquals(const Tensor& tensor, const std::vector<double>& row_major,
+                          const std::vector<int64_t>& shape) {
+    Tensor expected(float64(), Buffer::Wrap(row_major), shape);
+    ASSERT_EQ(tensor.shape(), shape);
+    ASSERT_TRUE(tensor.Equals(expected, EqualOptions::Defaults().nans_equal(true)));
+  }
+};
+
+TEST_F(TestRecordBatchToTensor, RowMajor) {
+  auto batch = MakeBatch(float64(), {"[1, 2, 3]", "[4, 5, 6]"});
+  ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor());
+  ASSERT_TRUE(tensor->is_row_major());
+  AssertTensorEquals(*tensor, {1, 4, 2, 5, 3, 6}, {3, 2});
+
+  // Sliced columns
+  ASSERT_OK_AND_ASSIGN(tensor, batch->Slice(1)->ToTensor());
+  AssertTensorEquals(*tensor, {2, 5, 3, 6}, {2, 2});
+}
+
+TEST_F(TestRecordBatchToTensor, ColumnMajor) {
+  auto batch = MakeBatch(float64(), {"[1, 2, 3]", "[4, 5, 6]"});
+  ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor(/*null_to_nan=*/false,
+                                                    /*row_major=*/false));
+  ASSERT_TRUE(tensor->is_column_major());
+  AssertTensorEquals(*tensor, {1, 4, 2, 5, 3, 6}, {3, 2});
+}
+
+TEST_F(TestRecordBatchToTensor, NullToNaN) {
+  auto batch = MakeBatch(float64(), {"[1, null, 3]", "[null, 5, 6]"});
+  ASSERT_RAISES(Invalid, batch->ToTensor());
+  ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor(/*null_to_nan=*/true));
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  AssertTensorEquals(*tensor, {1, nan, nan, 5, 3, 6}, {3, 2});
+
+  auto int_batch = MakeBatch(int32(), {"[1, null]"});
+  ASSERT_RAISES(TypeError, int_batch->ToTensor(/*null_to_nan=*/true));
+}
+
+TEST_F(TestRecordBatchToTensor, Invalid) {
+  ASSERT_RAISES(TypeError, MakeBatch(utf8(), {R"(["a", "b"])"})->ToTensor());
+  auto batch = RecordBatch::Make(
+      schema({field("f0", int32()), field("f1", int64())}), 1,
+      {ArrayFromJSON(int32(), "[1]"), ArrayFromJSON(int64(), "[1]")});
+  ASSERT_RAISES(TypeError, batch->ToTensor());
+  batch = RecordBatch::Make(schema({}), 1, ArrayVector{});
+  ASSERT_RAISES(Invalid, batch->ToTensor());
+}
+
+TEST_F(TestRecordBatchToTensor, ManyRows) {
+  // Large enough to be copied in parallel
+  const int64_t length = 1 << 15;
+  std::vector<double> values(length * 3);
+  for (int64_t i = 0; i < length * 3; ++i) {
+    values[i] = static_cast<double>(i);
+  }
+  // Columns 0, 1 and 2 of the first, second and third thirds of the values
+  Tensor expected(float64(), Buffer::Wrap(values), {length, 3},
+                  {sizeof(double), length * static_cast<int64_t>(sizeof(double))});
+  ArrayVector columns;
+  for (int i = 0; i < 3; ++i) {
+    auto data = Buffer::Wrap(values.data() + i * length, length);
+    columns.push_back(std::make_shared<DoubleArray>(length, data));
+  }
+  auto batch = RecordBatch::Make(
+      schema({field("a", float64()), field("b", float64()), field("c", float64())}),
+      length, columns);
+
+  for (bool row_major : {true, false}) {
+    ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor(/*null_to_nan=*/false, row_major));
+    ASSERT_EQ(tensor->is_row_major(), row_major);
+    ASSERT_TRUE(tensor->Equals(expected));
+  }
+}
+
+TEST_F(TestRecordBatchToTensor, FromTensor) {
+  std::vector<int32_t> values = {1, 2, 3, 4, 5, 6};
+  auto row_major = std::make_shared<Tensor>(int32(), Buffer::Wrap(values),
+                                            std::vector<int64_t>{3, 2});
+  ASSERT_OK_AND_ASSIGN(auto batch, RecordBatch::FromTensor(row_major));
+  auto expected = RecordBatch::Make(
+      schema({field("0", int32()), field("1", int32())}), 3,
+      {ArrayFromJSON(int32(), "[1, 3, 5]"), ArrayFromJSON(int32(), "[2, 4, 6]")});
+  AssertBatchesEqual(*expected, *batch);
+
+  auto vector = std::make_shared<Tensor>(int32(), Buffer::Wrap(values),
+                                         std::vector<int64_t>{6});
+  ASSERT_OK_AND_ASSIGN(batch, RecordBatch::FromTensor(vector, {"x"}));
+  expected = RecordBatch::Make(schema({field("x", int32())}), 6,
+                               {ArrayFromJSON(int32(), "[1, 2, 3, 4, 5, 6]")});
+  AssertBatchesEqual(*expected, *batch);
+
+  ASSERT_RAISES(Invalid, RecordBatch::FromTensor(row_major, {"x"}));
+  auto cube = std::make_shared<Tensor>(int32(), Buffer::Wrap(values),
+                                       std::vector<int64_t>{1, 3, 2});
+  ASSERT_RAISES(Invalid, RecordBatch::FromTensor(cube));
+}
+
+TEST_F(TestRecordBatchToTensor, ZeroCopyRoundtrip) {
+  std::vector<int64_t> values = {1, 2, 3, 4, 5, 6};
+  const int64_t elsize = sizeof(int64_t);
+  auto column_major = std::make_shared<Tensor>(int64(), Buffer::Wrap(values),
+                                               std::vector<int64_t>{3, 2},
+                                               std::vector<int64_t>{elsize, 3 * elsize});
+  ASSERT_OK_AND_ASSIGN(auto batch, RecordBatch::FromTensor(column_major, {"a", "b"}));
+  ASSERT_EQ(batch->column_data(0)->buffers[1]->data(), column_major->raw_data());
+  ASSERT_ARRAYS_EQUAL(*ArrayFromJSON(int64(), "[4, 5, 6]"), *batch->column(1));
+
+  ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor(/*null_to_nan=*/false,
+                                                    /*row_major=*/false));
+  ASSERT_EQ(tensor->raw_data(), column_major->raw_data());
+  ASSERT_TRUE(tensor->Equals(*column_major));
+
+  // A row-major tensor is copied
+  ASSERT_OK_AND_ASSIGN(tensor, batch->ToTensor());
+  ASSERT_NE(tensor->raw_data(), column_major->raw_data());
+  ASSERT_TRUE(tensor->is_row_major());
+  ASSERT_TRUE(tensor->Equals(*column_major));
+
+  // Columns that aren't equally spaced are copied
+  ASSERT_OK_AND_ASSIGN(batch, batch->AddColumn(2, field("c", int64()), batch->column(0)));
+  ASSERT_OK_AND_ASSIGN(tensor, batch->ToTensor(/*null_to_nan=*/false,
+                                               /*row_major=*/false));
+  ASSERT_NE(tensor->raw_data(), column_major->raw_data());
+  ASSERT_EQ(tensor->shape(), std::vector<int64_t>({3, 3}));
+}
+
 }  // namespace arrow
@@ -19,7 +19,9 @@
 
 #include <cmath>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -33,6 +35,7 @@
 #include "arrow/type.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/sort.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -1675,4 +1678,80 @@ TEST(TestSparseCSFMatrixForUInt64Index, Make) {
   ASSERT_RAISES(Invalid, SparseCSFTensor::Make(dense_tensor, uint64()));
 }
 
+//-----------------------------------------------------------------------------
+// Conversion of tensors large enough to be split across threads
+
+class TestParallelSparseTensorConversion : public ::testing::Test {
+ public:
+  void SetUp() {
+    original_capacity_ = GetCpuThreadPoolCapacity();
+    ASSERT_OK(SetCpuThreadPoolCapacity(4));
+  }
+
+  void TearDown() { ASSERT_OK(SetCpuThreadPoolCapacity(original_capacity_)); }
+
+  std::shared_ptr<Tensor> MakeSparseTensor(const std::vector<int64_t>& shape,
+                                           const std::vector<int64_t>& strides = {}) {
+    const int64_t size = std::accumulate(shape.begin(), shape.end(), int64_t(1),
+                                         std::multiplies<int64_t>());
+    // Make room for strided tensors
+    values_.assign(size * 2, 0);
+    for (int64_t i = 0; i < size * 2; i += 97) {
+      values_[i] = static_cast<double>(i % 13) - 6.5;
+    }
+    // Include runs of nonzero values
+    std::fill(values_.begin() + 1000, values_.begin() + 1100, 1.5);
+    auto tensor =
+        std::make_shared<Tensor>(float64(), Buffer::Wrap(values_), shape, strides);
+    return tensor;
+  }
+
+  // Check a conversion against the one made on a single thread
+  template <typename SparseTensorType>
+  void CheckConversion(const Tensor& tensor) {
+    ASSERT_OK_AND_ASSIGN(auto parallel, SparseTensorType::Make(tensor, int32()));
+    ASSERT_OK(SetCpuThreadPoolCapacity(1));
+    ASSERT_OK_AND_ASSIGN(auto serial, SparseTensorType::Make(tensor, int32()));
+    ASSERT_OK(SetCpuThreadPoolCapacity(4));
+
+    ASSERT_GT(parallel->non_zero_length(), 0);
+    ASSERT_TRUE(parallel->Equals(*serial));
+    ASSERT_OK_AND_ASSIGN(auto dense, parallel->ToTensor());
+    ASSERT_TRUE(dense->Equals(tensor));
+  }
+
+ protected:
+  int original_capacity_;
+  std::vector<double> values_;
+};
+
+TEST_F(TestParallelSparseTensorConversion, SparseCOOTensor) {
+  auto row_major = MakeSparseTensor({64, 83, 61});
+  CheckConversion<SparseCOOTensor>(*row_major);
+  // Strides of a column-major tensor
+  auto column_major = MakeSparseTensor({64, 83, 61}, {8, 8 * 64, 8 * 64 * 83});
+  CheckConversion<SparseCOOTensor>(*column_major);
+}
+
+TEST_F(TestParallelSparseTensorConversion, SparseCSRMatrix) {
+  auto row_major = MakeSparseTensor({601, 503});
+  CheckConversion<SparseCSRMatrix>(*row_major);
+  auto column_major = MakeSparseTensor({601, 503}, {8, 8 * 601});
+  CheckConversion<SparseCSRMatrix>(*column_major);
+}
+
+TEST_F(TestParallelSparseTensorConversion, SparseCSCMatrix) {
+  auto row_major = MakeSparseTensor({601, 503});
+  CheckConversion<SparseCSCMatrix>(*row_major);
+  auto strided = MakeSparseTensor({601, 503}, {16 * 503, 16});
+  CheckConversion<SparseCSCMatrix>(*strided);
+}
+
+TEST_F(TestParallelSparseTensorConversion, SparseCSFTensor) {
+  auto row_major = MakeSparseTensor({83, 64, 61});
+  CheckConversion<SparseCSFTensor>(*row_major);
+  auto strided = MakeSparseTensor({83, 64, 61}, {16 * 64 * 61, 16 * 61, 16});
+  CheckConversion<SparseCSFTensor>(*strided);
+}
+
 }  // namespace arrow
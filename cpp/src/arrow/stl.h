@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -32,6 +33,8 @@
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api.h"
 #include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
@@ -460,5 +463,406 @@ Status TupleRangeFromTable(const Table& table, const compute::CastOptions& cast_
   return Status::OK();
 }
 
+/// \brief Describe a data member of a struct as a column of a row adapter.
+///
+/// Use ARROW_STL_ROW_MEMBER() to declare one.
+template <typename Struct, typename Member, Member Struct::*Ptr>
+struct RowMember {
+  using StructType = Struct;
+  using MemberType = Member;
+
+  static const Member& Get(const Struct& row) { return row.*Ptr; }
+  static Member& Get(Struct& row) { return row.*Ptr; }
+};
+
+#define ARROW_STL_ROW_MEMBER(Struct, member) \
+  ::arrow::stl::RowMember<Struct, decltype(Struct::member), &Struct::member>
+
+/// \brief Traits meta class mapping a struct type to the columns of a RecordBatch.
+///
+/// This class must be specialized by users, listing the members of the struct
+/// mapped to columns, in order, and their column names.  Members are converted
+/// using ConversionTraits, like tuple elements are.  Since the whole mapping is
+/// known at compile-time, appending rows and reading them back involves no
+/// virtual call per value.
+///
+/// \code{.cpp}
+/// struct Point {
+///   int64_t x;
+///   double y;
+///   util::optional<std::string> label;
+/// };
+///
+/// namespace arrow {
+/// namespace stl {
+///
+/// template <>
+/// struct RowTraits<Point> {
+///   using Members = std::tuple<ARROW_STL_ROW_MEMBER(Point, x),
+///                              ARROW_STL_ROW_MEMBER(Point, y),
+///                              ARROW_STL_ROW_MEMBER(Point, label)>;
+///   static std::vector<std::string> names() { return {"x", "y", "label"}; }
+/// };
+///
+/// }  // namespace stl
+/// }  // namespace arrow
+/// \endcode
+template <typename Row>
+struct RowTraits {};
+
+namespace internal {
+
+template <typename Row, std::size_t I>
+using RowMemberAt =
+    typename std::tuple_element<I, typename RowTraits<Row>::Members>::type;
+
+template <typename Row, std::size_t I>
+using RowMemberType = typename std::decay<typename RowMemberAt<Row, I>::MemberType>::type;
+
+template <typename Row, std::size_t I>
+using RowArrayType = typename TypeTraits<
+    typename ConversionTraits<RowMemberType<Row, I>>::ArrowType>::ArrayType;
+
+template <typename Row>
+using RowNumMembers = std::tuple_size<typename RowTraits<Row>::Members>;
+
+/// Append one member of a range of rows to its column builder.
+///
+/// This generic version appends each value through ConversionTraits::AppendRow;
+/// specializations below write directly into builders reserved up front.
+template <typename MemberType, typename Enable = void>
+struct ColumnAppender {
+  template <typename Member, typename Iterator>
+  static Status Append(CBuilderType<MemberType>& builder, Iterator first, Iterator last,
+                       int64_t length) {
+    ARROW_RETURN_NOT_OK(builder.Reserve(length));
+    for (; first != last; ++first) {
+      ARROW_RETURN_NOT_OK(
+          ConversionTraits<MemberType>::AppendRow(builder, Member::Get(*first)));
+    }
+    return Status::OK();
+  }
+};
+
+template <typename MemberType>
+struct ColumnAppender<
+    MemberType, typename std::enable_if<std::is_arithmetic<MemberType>::value>::type> {
+  template <typename Member, typename Iterator>
+  static Status Append(CBuilderType<MemberType>& builder, Iterator first, Iterator last,
+                       int64_t length) {
+    ARROW_RETURN_NOT_OK(builder.Reserve(length));
+    for (; first != last; ++first) {
+      builder.UnsafeAppend(Member::Get(*first));
+    }
+    return Status::OK();
+  }
+};
+
+template <typename MemberType>
+struct ColumnAppender<
+    MemberType, typename std::enable_if<
+                    is_optional_like<MemberType>::value &&
+                    std::is_arithmetic<typename std::decay<
+                        decltype(*std::declval<MemberType>())>::type>::value>::type> {
+  template <typename Member, typename Iterator>
+  static Status Append(CBuilderType<MemberType>& builder, Iterator first, Iterator last,
+                       int64_t length) {
+    ARROW_RETURN_NOT_OK(builder.Reserve(length));
+    for (; first != last; ++first) {
+      const auto& cell = Member::Get(*first);
+      if (cell) {
+        builder.UnsafeAppend(*cell);
+      } else {
+        builder.UnsafeAppendNull();
+      }
+    }
+    return Status::OK();
+  }
+};
+
+template <>
+struct ColumnAppender<std::string> {
+  template <typename Member, typename Iterator>
+  static Status Append(StringBuilder& builder, Iterator first, Iterator last,
+                       int64_t length) {
+    int64_t data_length = 0;
+    for (auto it = first; it != last; ++it) {
+      data_length += static_cast<int64_t>(Member::Get(*it).size());
+    }
+    ARROW_RETURN_NOT_OK(builder.Reserve(length));
+    ARROW_RETURN_NOT_OK(builder.ReserveData(data_length));
+    for (; first != last; ++first) {
+      builder.UnsafeAppend(Member::Get(*first));
+    }
+    return Status::OK();
+  }
+};
+
+/// Read one value of a column into a row member.
+///
+/// Optional-like members are read as empty when the value is null.
+template <typename MemberType, typename Enable = void>
+struct EntryReader {
+  template <typename ArrayType>
+  static MemberType Read(const ArrayType& array, int64_t i) {
+    return ConversionTraits<MemberType>::GetEntry(array, i);
+  }
+};
+
+template <typename MemberType>
+struct EntryReader<MemberType, enable_if_optional_like<MemberType>> {
+  using InnerType = typename std::decay<decltype(*std::declval<MemberType>())>::type;
+
+  template <typename ArrayType>
+  static MemberType Read(const ArrayType& array, int64_t i) {
+    if (array.IsNull(i)) {
+      return MemberType{};
+    }
+    return MemberType(ConversionTraits<InnerType>::GetEntry(array, i));
+  }
+};
+
+template <typename Row, std::size_t N = RowNumMembers<Row>::value>
+struct RowColumnsRecursive {
+  using Next = RowColumnsRecursive<Row, N - 1>;
+  using Member = RowMemberAt<Row, N - 1>;
+  using MemberType = RowMemberType<Row, N - 1>;
+
+  static void MakeFields(const std::vector<std::string>& names,
+                         std::vector<std::shared_ptr<Field>>* fields) {
+    Next::MakeFields(names, fields);
+    fields->push_back(field(names[N - 1], ConversionTraits<MemberType>::type_singleton(),
+                            is_optional_like<MemberType>::value));
+  }
+
+  template <typename Iterator>
+  static Status Append(const std::vector<std::unique_ptr<ArrayBuilder>>& builders,
+                       Iterator first, Iterator last, int64_t length) {
+    ARROW_RETURN_NOT_OK(Next::Append(builders, first, last, length));
+    auto& builder =
+        ::arrow::internal::checked_cast<CBuilderType<MemberType>&>(*builders[N - 1]);
+    return ColumnAppender<MemberType>::template Append<Member>(builder, first, last,
+                                                               length);
+  }
+
+  static Status CheckTypes(const RecordBatch& batch) {
+    ARROW_RETURN_NOT_OK(Next::CheckTypes(batch));
+    std::shared_ptr<DataType> expected_type =
+        ConversionTraits<MemberType>::type_singleton();
+    const auto& actual_type = batch.column(N - 1)->type();
+    if (!actual_type->Equals(*expected_type)) {
+      return Status::TypeError("Column '", batch.schema()->field(N - 1)->name(),
+                               "' has type ", *actual_type, ", but the row member ",
+                               "expects ", *expected_type);
+    }
+    return Status::OK();
+  }
+
+  template <typename Iterator>
+  static void Fill(const RecordBatch& batch, Iterator first, Iterator last) {
+    Next::Fill(batch, first, last);
+    const auto& array =
+        ::arrow::internal::checked_cast<const RowArrayType<Row, N - 1>&>(
+            *batch.column(N - 1));
+    int64_t j = 0;
+    for (; first != last; ++first) {
+      Member::Get(*first) = EntryReader<MemberType>::Read(array, j++);
+    }
+  }
+
+  static void FillRow(const std::vector<const Array*>& arrays, int64_t i, Row* row) {
+    Next::FillRow(arrays, i, row);
+    const auto& array =
+        ::arrow::internal::checked_cast<const RowArrayType<Row, N - 1>&>(
+            *arrays[N - 1]);
+    Member::Get(*row) = EntryReader<MemberType>::Read(array, i);
+  }
+};
+
+template <typename Row>
+struct RowColumnsRecursive<Row, 0> {
+  static void MakeFields(const std::vector<std::string>& names,
+                         std::vector<std::shared_ptr<Field>>* fields) {
+    fields->reserve(names.size());
+  }
+
+  template <typename Iterator>
+  static Status Append(const std::vector<std::unique_ptr<ArrayBuilder>>&, Iterator,
+                       Iterator, int64_t) {
+    return Status::OK();
+  }
+
+  static Status CheckTypes(const RecordBatch&) { return Status::OK(); }
+
+  template <typename Iterator>
+  static void Fill(const RecordBatch&, Iterator, Iterator) {}
+
+  static void FillRow(const std::vector<const Array*>&, int64_t, Row*) {}
+};
+
+template <typename Row>
+Status CheckRowBatch(const RecordBatch& batch) {
+  constexpr std::size_t n_columns = RowNumMembers<Row>::value;
+  if (static_cast<std::size_t>(batch.num_columns()) != n_columns) {
+    return Status::Invalid(
+        "Number of columns in the record batch does not match the row members: ",
+        batch.num_columns(), " != ", n_columns);
+  }
+  return RowColumnsRecursive<Row>::CheckTypes(batch);
+}
+
+}  // namespace internal
+
+/// Build an arrow::Schema from the columns described by RowTraits<Row>.
+template <typename Row>
+std::shared_ptr<Schema> SchemaFromRow() {
+  std::vector<std::shared_ptr<Field>> fields;
+  internal::RowColumnsRecursive<Row>::MakeFields(RowTraits<Row>::names(), &fields);
+  return ::arrow::schema(std::move(fields));
+}
+
+/// \brief Convert a range of structs described by RowTraits into a RecordBatch.
+///
+/// Rows are converted one column at a time: each column builder is reserved
+/// once, then fixed-width and string members are written by a tight loop over
+/// the rows.  The range must therefore be traversable several times.
+template <typename Range>
+Result<std::shared_ptr<RecordBatch>> RecordBatchFromRowRange(MemoryPool* pool,
+                                                             Range&& rows) {
+  using row_type = typename std::decay<decltype(*std::begin(rows))>::type;
+  constexpr std::size_t n_columns = internal::RowNumMembers<row_type>::value;
+
+  std::shared_ptr<Schema> schema = SchemaFromRow<row_type>();
+  std::vector<std::unique_ptr<ArrayBuilder>> builders(n_columns);
+  for (std::size_t i = 0; i < n_columns; ++i) {
+    ARROW_RETURN_NOT_OK(MakeBuilder(pool, schema->field(static_cast<int>(i))->type(),
+                                    &builders[i]));
+  }
+
+  const auto first = std::begin(rows);
+  const auto last = std::end(rows);
+  const int64_t num_rows = static_cast<int64_t>(std::distance(first, last));
+  ARROW_RETURN_NOT_OK(
+      internal::RowColumnsRecursive<row_type>::Append(builders, first, last, num_rows));
+
+  std::vector<std::shared_ptr<Array>> arrays(n_columns);
+  for (std::size_t i = 0; i < n_columns; ++i) {
+    ARROW_RETURN_NOT_OK(builders[i]->Finish(&arrays[i]));
+  }
+  return RecordBatch::Make(std::move(schema), num_rows, std::move(arrays));
+}
+
+/// \brief Convert a RecordBatch into a range of structs described by RowTraits.
+///
+/// The columns must have the types of the row members: no cast is done.  The
+/// range must already have as many elements as the batch has rows; it is filled
+/// one column at a time.  Null values are read as empty optional-like members,
+/// other members get the value stored in the null slot.
+template <typename Range>
+Status RowRangeFromRecordBatch(const RecordBatch& batch, Range* rows) {
+  using row_type = typename std::decay<decltype(*std::begin(*rows))>::type;
+
+  ARROW_RETURN_NOT_OK(internal::CheckRowBatch<row_type>(batch));
+  const auto first = std::begin(*rows);
+  const auto last = std::end(*rows);
+  const int64_t num_rows = static_cast<int64_t>(std::distance(first, last));
+  if (num_rows != batch.num_rows()) {
+    return Status::Invalid(
+        "Number of rows in the record batch does not match the size of the target: ",
+        batch.num_rows(), " != ", num_rows);
+  }
+  internal::RowColumnsRecursive<row_type>::Fill(batch, first, last);
+  return Status::OK();
+}
+
+/// \brief Row-wise access to a RecordBatch through a struct described by RowTraits.
+///
+/// The column types are checked once when the accessor is made, so that
+/// accessing values downcasts the columns statically.
+template <typename Row>
+class RowAccessor {
+ public:
+  class Iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = Row;
+    using difference_type = int64_t;
+    using pointer = const Row*;
+    using reference = Row;
+
+    Iterator(const RowAccessor* accessor, int64_t index)
+        : accessor_(accessor), index_(index) {}
+
+    Row operator*() const { return accessor_->GetRow(index_); }
+
+    Iterator& operator++() {
+      ++index_;
+      return *this;
+    }
+
+    bool operator==(const Iterator& other) const { return index_ == other.index_; }
+    bool operator!=(const Iterator& other) const { return index_ != other.index_; }
+
+   private:
+    const RowAccessor* accessor_;
+    int64_t index_;
+  };
+
+  /// \brief Make an accessor over the rows of a batch, checking its column types
+  static Result<RowAccessor> Make(std::shared_ptr<RecordBatch> batch) {
+    ARROW_RETURN_NOT_OK(internal::CheckRowBatch<Row>(*batch));
+    return RowAccessor(std::move(batch));
+  }
+
+  const std::shared_ptr<RecordBatch>& batch() const { return batch_; }
+  int64_t num_rows() const { return batch_->num_rows(); }
+
+  /// \brief Return the array of the I-th row member, downcast to its type
+  template <std::size_t I>
+  const internal::RowArrayType<Row, I>& column() const {
+    return ::arrow::internal::checked_cast<const internal::RowArrayType<Row, I>&>(
+        *arrays_[I]);
+  }
+
+  /// \brief Return the value of the I-th row member at the given row
+  template <std::size_t I>
+  internal::RowMemberType<Row, I> Get(int64_t i) const {
+    return internal::EntryReader<internal::RowMemberType<Row, I>>::Read(column<I>(), i);
+  }
+
+  /// \brief Return whether the I-th row member is null at the given row
+  template <std::size_t I>
+  bool IsNull(int64_t i) const {
+    return arrays_[I]->IsNull(i);
+  }
+
+  /// \brief Read all members of the given row
+  void ReadRow(int64_t i, Row* row) const {
+    internal::RowColumnsRecursive<Row>::FillRow(arrays_, i, row);
+  }
+
+  Row GetRow(int64_t i) const {
+    Row row;
+    ReadRow(i, &row);
+    return row;
+  }
+
+  Iterator begin() const { return Iterator(this, 0); }
+  Iterator end() const { return Iterator(this, num_rows()); }
+
+ private:
+  explicit RowAccessor(std::shared_ptr<RecordBatch> batch)
+      : batch_(std::move(batch)), columns_(batch_->columns()) {
+    for (const auto& column : columns_) {
+      arrays_.push_back(column.get());
+    }
+  }
+
+  std::shared_ptr<RecordBatch> batch_;
+  // Keep the boxed columns alive, RecordBatch::column() may box on the fly
+  std::vector<std::shared_ptr<Array>> columns_;
+  std::vector<const Array*> arrays_;
+};
+
 }  // namespace stl
 }  // namespace arrow
@@ -98,6 +98,16 @@ struct TestInt32Type {
   int32_t value;
 };
 
+// This is for testing struct row adapters
+struct TestRow {
+  int64_t id;
+  double score;
+  bool flag;
+  std::string name;
+  arrow::util::optional<int32_t> maybe_int;
+  std::vector<int16_t> values;
+};
+
 namespace arrow {
 
 using optional_types_tuple =
@@ -147,6 +157,17 @@ Status AppendListValues<TestInt32Type, const std::vector<TestInt32Type>&>(
                                     cell_range.size());
 }
 
+template <>
+struct RowTraits<TestRow> {
+  using Members = std::tuple<
+      ARROW_STL_ROW_MEMBER(TestRow, id), ARROW_STL_ROW_MEMBER(TestRow, score),
+      ARROW_STL_ROW_MEMBER(TestRow, flag), ARROW_STL_ROW_MEMBER(TestRow, name),
+      ARROW_STL_ROW_MEMBER(TestRow, maybe_int), ARROW_STL_ROW_MEMBER(TestRow, values)>;
+  static std::vector<std::string> names() {
+    return {"id", "score", "flag", "name", "maybe_int", "values"};
+  }
+};
+
 TEST(TestSchemaFromTuple, PrimitiveTypesVector) {
   Schema expected_schema(
       {field("column1", int8(), false), field("column2", int16(), false),
@@ -498,6 +519,75 @@ TEST(TestTupleVectorFromTable, CastingNeeded) {
   ASSERT_EQ(rows, expected_rows);
 }
 
+TEST(TestRecordBatchFromRowRange, Basics) {
+  std::vector<TestRow> rows{{1, 0.5, true, "a", 4, {1, 2}},
+                            {2, 1.5, false, "bcd", util::nullopt, {}},
+                            {3, -2.0, true, "", -7, {3}}};
+
+  auto expected_schema = schema({field("id", int64(), false),
+                                 field("score", float64(), false),
+                                 field("flag", boolean(), false),
+                                 field("name", utf8(), false),
+                                 field("maybe_int", int32(), true),
+                                 field("values", list(int16()), false)});
+  AssertSchemaEqual(*expected_schema, *SchemaFromRow<TestRow>());
+
+  ASSERT_OK_AND_ASSIGN(auto batch, RecordBatchFromRowRange(default_memory_pool(), rows));
+  ASSERT_OK(batch->ValidateFull());
+  auto expected_batch = RecordBatchFromJSON(expected_schema, R"([
+    {"id": 1, "score": 0.5, "flag": true, "name": "a", "maybe_int": 4,
+     "values": [1, 2]},
+    {"id": 2, "score": 1.5, "flag": false, "name": "bcd", "maybe_int": null,
+     "values": []},
+    {"id": 3, "score": -2.0, "flag": true, "name": "", "maybe_int": -7,
+     "values": [3]}
+  ])");
+  AssertBatchesEqual(*expected_batch, *batch);
+}
+
+TEST(TestRowAccessor, Basics) {
+  std::vector<TestRow> rows{{1, 0.5, true, "a", 4, {1, 2}},
+                            {2, 1.5, false, "bcd", util::nullopt, {}}};
+  ASSERT_OK_AND_ASSIGN(auto batch, RecordBatchFromRowRange(default_memory_pool(), rows));
+
+  ASSERT_OK_AND_ASSIGN(auto accessor, RowAccessor<TestRow>::Make(batch));
+  ASSERT_EQ(2, accessor.num_rows());
+  ASSERT_EQ(2, accessor.Get<0>(1));
+  ASSERT_EQ("bcd", accessor.Get<3>(1));
+  ASSERT_EQ(std::vector<int16_t>({1, 2}), accessor.Get<5>(0));
+  ASSERT_TRUE(accessor.IsNull<4>(1));
+  ASSERT_EQ(util::nullopt, accessor.Get<4>(1));
+  ASSERT_EQ(1.5, accessor.column<1>().Value(1));
+
+  std::vector<int64_t> ids;
+  for (const auto& row : accessor) {
+    ids.push_back(row.id);
+  }
+  ASSERT_EQ(std::vector<int64_t>({1, 2}), ids);
+
+  std::vector<TestRow> read_rows(2);
+  ASSERT_OK(RowRangeFromRecordBatch(*batch, &read_rows));
+  for (size_t i = 0; i < rows.size(); ++i) {
+    ASSERT_EQ(rows[i].id, read_rows[i].id);
+    ASSERT_EQ(rows[i].score, read_rows[i].score);
+    ASSERT_EQ(rows[i].flag, read_rows[i].flag);
+    ASSERT_EQ(rows[i].name, read_rows[i].name);
+    ASSERT_EQ(rows[i].maybe_int, read_rows[i].maybe_int);
+    ASSERT_EQ(rows[i].values, read_rows[i].values);
+  }
+  std::vector<TestRow> too_few_rows(1);
+  ASSERT_RAISES(Invalid, RowRangeFromRecordBatch(*batch, &too_few_rows));
+
+  // Mismatching column types are rejected
+  auto other_batch = RecordBatchFromJSON(
+      schema({field("id", int64()), field("score", float32()), field("flag", boolean()),
+              field("name", utf8()), field("maybe_int", int32()),
+              field("values", list(int16()))}),
+      "[]");
+  ASSERT_RAISES(TypeError, RowAccessor<TestRow>::Make(other_batch));
+  ASSERT_RAISES(Invalid, RowAccessor<TestRow>::Make(batch->RemoveColumn(0).ValueOrDie()));
+}
+
 TEST(STLMemoryPool, Base) {
   std::allocator<uint8_t> allocator;
   STLMemoryPool<std::allocator<uint8_t>> pool(allocator);
@@ -34,11 +34,14 @@
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
@@ -189,7 +192,11 @@ class SimpleTable : public Table {
 
   Status ValidateFull() const override {
     RETURN_NOT_OK(ValidateMeta());
-    for (int i = 0; i < num_columns(); ++i) {
+    // Columns are validated in parallel, as in RecordBatch::ValidateFull
+    auto pool = internal::GetCpuThreadPool();
+    const bool use_threads = num_columns() > 1 && pool->GetCapacity() > 1 &&
+                             !pool->OwnsThisThread();
+    return internal::OptionalParallelFor(use_threads, num_columns(), [&](int i) {
       const ChunkedArray* col = columns_[i].get();
       Status st = col->ValidateFull();
       if (!st.ok()) {
@@ -197,8 +204,8 @@ class SimpleTable : public Table {
         ss << "Column " << i << ": " << st.message();
         return st.WithMessage(ss.str());
       }
-    }
-    return Status::OK();
+      return Status::OK();
+    });
   }
 
  protected:
@@ -572,6 +579,30 @@ Result<std::shared_ptr<Table>> Table::CombineChunks(MemoryPool* pool) const {
   return Table::Make(schema(), std::move(compacted_columns));
 }
 
+Result<std::shared_ptr<Tensor>> Table::ToTensor(bool null_to_nan, bool row_major,
+                                                MemoryPool* pool) const {
+  const int ncolumns = num_columns();
+  for (int i = 0; i < ncolumns; ++i) {
+    // Don't combine the chunks of columns that can't be converted anyway
+    const auto& type = column(i)->type();
+    if (!is_tensor_supported(type->id())) {
+      return Status::TypeError("Cannot convert column of type ", *type, " to a tensor");
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(auto combined, CombineChunks(pool));
+  std::vector<std::shared_ptr<Array>> columns(ncolumns);
+  for (int i = 0; i < ncolumns; ++i) {
+    const auto& col = combined->column(i);
+    if (col->num_chunks() == 0) {
+      ARROW_ASSIGN_OR_RAISE(columns[i], MakeArrayOfNull(col->type(), 0, pool));
+    } else {
+      columns[i] = col->chunk(0);
+    }
+  }
+  return RecordBatch::Make(schema(), num_rows(), std::move(columns))
+      ->ToTensor(null_to_nan, row_major, pool);
+}
+
 // ----------------------------------------------------------------------
 // Convert a table to a sequence of record batches
 
@@ -183,6 +183,7 @@ class ARROW_EXPORT Table {
   ///
   /// This is O(k*n) where k is the total number of field descendents,
   /// and n is the number of rows.
+  /// Columns are validated in parallel on the CPU thread pool.
   ///
   /// \return Status
   virtual Status ValidateFull() const = 0;
@@ -208,6 +209,14 @@ class ARROW_EXPORT Table {
   Result<std::shared_ptr<Table>> CombineChunks(
       MemoryPool* pool = default_memory_pool()) const;
 
+  /// \brief Convert table to a two-dimensional tensor
+  ///
+  /// The chunks of the columns are first combined, if need be.  See
+  /// RecordBatch::ToTensor.
+  Result<std::shared_ptr<Tensor>> ToTensor(
+      bool null_to_nan = false, bool row_major = true,
+      MemoryPool* pool = default_memory_pool()) const;
+
  protected:
   Table();
 
@@ -17,14 +17,19 @@
 
 #include "arrow/table_builder.h"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "arrow/array/array_base.h"
 #include "arrow/builder.h"
+#include "arrow/chunked_array.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -110,4 +115,95 @@ Status RecordBatchBuilder::InitBuilders() {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// ConcurrentTableBuilder
+
+struct ConcurrentTableBuilder::Slot {
+  int64_t sequence_number;
+  std::shared_ptr<RecordBatch> batch;
+};
+
+constexpr int ConcurrentTableBuilder::kFirstSegmentBits;
+constexpr int64_t ConcurrentTableBuilder::kFirstSegmentSize;
+constexpr int ConcurrentTableBuilder::kNumSegments;
+
+ConcurrentTableBuilder::ConcurrentTableBuilder(std::shared_ptr<Schema> schema)
+    : schema_(std::move(schema)), num_slots_(0), num_rows_(0) {
+  for (auto& segment : segments_) {
+    segment.store(nullptr);
+  }
+}
+
+ConcurrentTableBuilder::~ConcurrentTableBuilder() {
+  for (auto& segment : segments_) {
+    delete[] segment.load();
+  }
+}
+
+ConcurrentTableBuilder::Slot* ConcurrentTableBuilder::GetSlot(int64_t index) {
+  // Segment i starts at index (kFirstSegmentSize << i) - kFirstSegmentSize
+  const uint64_t position = static_cast<uint64_t>(index + kFirstSegmentSize);
+  const int segment_index = 63 - BitUtil::CountLeadingZeros(position) - kFirstSegmentBits;
+  DCHECK_LT(segment_index, kNumSegments);
+  const int64_t segment_size = kFirstSegmentSize << segment_index;
+
+  auto& segment = segments_[segment_index];
+  Slot* slots = segment.load(std::memory_order_acquire);
+  if (ARROW_PREDICT_FALSE(slots == nullptr)) {
+    // Racing threads allocate the segment, the first one to publish it wins
+    Slot* new_slots = new Slot[segment_size];
+    if (segment.compare_exchange_strong(slots, new_slots, std::memory_order_acq_rel)) {
+      slots = new_slots;
+    } else {
+      delete[] new_slots;
+    }
+  }
+  return slots + (static_cast<int64_t>(position) - segment_size);
+}
+
+Status ConcurrentTableBuilder::Append(int64_t sequence_number,
+                                      std::shared_ptr<RecordBatch> batch) {
+  if (!batch->schema()->Equals(*schema_, /*check_metadata=*/false)) {
+    return Status::Invalid("Schema of appended batch ", batch->schema()->ToString(),
+                           " does not match builder schema ", schema_->ToString());
+  }
+  num_rows_.fetch_add(batch->num_rows(), std::memory_order_relaxed);
+  Slot* slot = GetSlot(num_slots_.fetch_add(1, std::memory_order_relaxed));
+  slot->sequence_number = sequence_number;
+  slot->batch = std::move(batch);
+  return Status::OK();
+}
+
+Result<std::shared_ptr<Table>> ConcurrentTableBuilder::Finish() {
+  const int64_t num_slots = num_slots_.load();
+  std::vector<Slot*> slots(static_cast<size_t>(num_slots));
+  for (int64_t i = 0; i < num_slots; ++i) {
+    slots[i] = GetSlot(i);
+  }
+  // Slots are claimed in the order each thread appends, so a stable sort keeps
+  // the order of the batches a thread appended with equal sequence numbers
+  std::stable_sort(slots.begin(), slots.end(), [](const Slot* left, const Slot* right) {
+    return left->sequence_number < right->sequence_number;
+  });
+
+  const int num_fields = schema_->num_fields();
+  ChunkedArrayVector columns(num_fields);
+  for (int i = 0; i < num_fields; ++i) {
+    ArrayVector chunks(slots.size());
+    for (size_t j = 0; j < slots.size(); ++j) {
+      chunks[j] = slots[j]->batch->column(i);
+    }
+    columns[i] =
+        std::make_shared<ChunkedArray>(std::move(chunks), schema_->field(i)->type());
+  }
+  auto table = Table::Make(schema_, std::move(columns), num_rows_.load());
+
+  for (Slot* slot : slots) {
+    slot->batch.reset();
+  }
+  num_slots_.store(0);
+  num_rows_.store(0);
+  return table;
+}
+
 }  // namespace arrow
@@ -17,11 +17,14 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <vector>
 
 #include "arrow/array/builder_base.h"
+#include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
@@ -32,6 +35,7 @@ namespace arrow {
 
 class MemoryPool;
 class RecordBatch;
+class Table;
 
 /// \class RecordBatchBuilder
 /// \brief Helper class for creating record batches iteratively given a known
@@ -107,4 +111,59 @@ class ARROW_EXPORT RecordBatchBuilder {
   std::vector<ArrayBuilder*> raw_field_builders_;
 };
 
+/// \class ConcurrentTableBuilder
+/// \brief Helper class for collecting record batches produced by concurrent
+/// threads into a Table, in a given order
+///
+/// Append() may be called from several threads at once and doesn't take any
+/// lock: each batch is stored in a slot claimed with an atomic increment, in
+/// a segmented array which never moves the slots already claimed.  The
+/// batches are ordered by their sequence number in the resulting Table.
+/// Sequence numbers need not be appended in order nor be contiguous; batches
+/// appended by the same thread with equal sequence numbers keep the order in
+/// which they were appended.
+class ARROW_EXPORT ConcurrentTableBuilder {
+ public:
+  /// \brief Create a ConcurrentTableBuilder
+  /// \param[in] schema The schema of the batches appended and of the table
+  explicit ConcurrentTableBuilder(std::shared_ptr<Schema> schema);
+  ~ConcurrentTableBuilder();
+
+  /// \brief Append a record batch, thread-safe
+  /// \param[in] sequence_number The position of the batch in the table,
+  /// relative to the other batches
+  /// \param[in] batch The batch, which must have the builder's schema
+  /// \return Status
+  Status Append(int64_t sequence_number, std::shared_ptr<RecordBatch> batch);
+
+  /// \brief Make a Table of the batches appended, and reset the builder
+  ///
+  /// All calls to Append() must have returned before Finish() is called.
+  /// The columns of the table have one chunk per batch.
+  Result<std::shared_ptr<Table>> Finish();
+
+  /// \brief The number of rows appended so far
+  int64_t num_rows() const { return num_rows_.load(); }
+
+  /// \brief The schema of the batches and of the table
+  const std::shared_ptr<Schema>& schema() const { return schema_; }
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ConcurrentTableBuilder);
+
+  struct Slot;
+
+  // Segment i holds kFirstSegmentSize << i slots and is allocated on first use
+  static constexpr int kFirstSegmentBits = 6;
+  static constexpr int64_t kFirstSegmentSize = int64_t(1) << kFirstSegmentBits;
+  static constexpr int kNumSegments = 48;
+
+  Slot* GetSlot(int64_t index);
+
+  std::shared_ptr<Schema> schema_;
+  std::atomic<int64_t> num_slots_;
+  std::atomic<int64_t> num_rows_;
+  std::array<std::atomic<Slot*>, kNumSegments> segments_;
+};
+
 }  // namespace arrow
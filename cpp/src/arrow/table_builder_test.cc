@@ -19,6 +19,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -29,6 +30,7 @@
 #include "arrow/array/builder_primitive.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/table_builder.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
@@ -178,4 +180,79 @@ TEST_F(TestRecordBatchBuilder, DictionaryTypes) {
   AssertTypeEqual(batch->column(0)->type(), batch->schema()->field(0)->type());
 }
 
+// A batch of `length` rows of `value`
+std::shared_ptr<RecordBatch> ConstantBatch(const std::shared_ptr<Schema>& schema,
+                                           int32_t value, int64_t length) {
+  Int32Builder builder;
+  ARROW_EXPECT_OK(builder.AppendValues(std::vector<int32_t>(length, value)));
+  std::shared_ptr<Array> array;
+  ARROW_EXPECT_OK(builder.Finish(&array));
+  return RecordBatch::Make(schema, length, {array});
+}
+
+TEST(ConcurrentTableBuilder, OrderedBySequenceNumber) {
+  auto schema = ::arrow::schema({field("f0", int32())});
+  ConcurrentTableBuilder builder(schema);
+
+  ASSERT_OK(builder.Append(20, ConstantBatch(schema, 2, 3)));
+  ASSERT_OK(builder.Append(-5, ConstantBatch(schema, 0, 1)));
+  ASSERT_OK(builder.Append(7, ConstantBatch(schema, 1, 0)));
+  // Equal sequence numbers keep the order of appending
+  ASSERT_OK(builder.Append(20, ConstantBatch(schema, 3, 2)));
+  ASSERT_EQ(builder.num_rows(), 6);
+
+  ASSERT_OK_AND_ASSIGN(auto table, builder.Finish());
+  ASSERT_OK(table->ValidateFull());
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches(
+                                          schema, {ConstantBatch(schema, 0, 1),
+                                                   ConstantBatch(schema, 1, 0),
+                                                   ConstantBatch(schema, 2, 3),
+                                                   ConstantBatch(schema, 3, 2)}));
+  AssertTablesEqual(*expected, *table, /*same_chunk_layout=*/true);
+
+  // The builder is reset
+  ASSERT_EQ(builder.num_rows(), 0);
+  ASSERT_OK_AND_ASSIGN(table, builder.Finish());
+  ASSERT_EQ(table->num_rows(), 0);
+  ASSERT_EQ(table->num_columns(), 1);
+  ASSERT_EQ(table->column(0)->num_chunks(), 0);
+  AssertSchemaEqual(*schema, *table->schema());
+}
+
+TEST(ConcurrentTableBuilder, SchemaMismatch) {
+  auto schema = ::arrow::schema({field("f0", int32())});
+  ConcurrentTableBuilder builder(::arrow::schema({field("f1", int32())}));
+  ASSERT_RAISES(Invalid, builder.Append(0, ConstantBatch(schema, 0, 1)));
+}
+
+TEST(ConcurrentTableBuilder, ConcurrentAppends) {
+  auto schema = ::arrow::schema({field("f0", int32())});
+  ConcurrentTableBuilder builder(schema);
+
+  // Enough batches to span several segments of slots, interleaved across
+  // threads
+  constexpr int kNumThreads = 8;
+  constexpr int32_t kNumBatches = 5000;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&, i] {
+      for (int32_t j = kNumBatches - 1 - i; j >= 0; j -= kNumThreads) {
+        ASSERT_OK(builder.Append(j, ConstantBatch(schema, j, j % 3)));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  RecordBatchVector batches;
+  for (int32_t j = 0; j < kNumBatches; ++j) {
+    batches.push_back(ConstantBatch(schema, j, j % 3));
+  }
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches(schema, batches));
+  ASSERT_OK_AND_ASSIGN(auto table, builder.Finish());
+  ASSERT_OK(table->ValidateFull());
+  AssertTablesEqual(*expected, *table, /*same_chunk_layout=*/true);
+}
+
 }  // namespace arrow
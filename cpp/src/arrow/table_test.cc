@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -29,6 +30,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/tensor.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
@@ -278,6 +280,25 @@ TEST_F(TestTable, LARGE_MEMORY_TEST(CombineChunksStringColumn)) {
   ASSERT_EQ(compacted->column(0)->num_chunks(), 2);
 }
 
+TEST_F(TestTable, ToTensor) {
+  auto sch = schema({field("f0", float32()), field("f1", float32())});
+  auto table = Table::Make(sch, {ChunkedArrayFromJSON(float32(), {"[1, 2]", "[3]"}),
+                                 ChunkedArrayFromJSON(float32(), {"[4]", "[5, null]"})});
+  ASSERT_OK_AND_ASSIGN(auto tensor, table->ToTensor(/*null_to_nan=*/true));
+  std::vector<float> values = {1, 4, 2, 5, 3, std::numeric_limits<float>::quiet_NaN()};
+  Tensor expected(float32(), Buffer::Wrap(values), {3, 2});
+  ASSERT_TRUE(tensor->Equals(expected, EqualOptions::Defaults().nans_equal(true)));
+
+  auto no_chunks = std::make_shared<ChunkedArray>(ArrayVector{}, float32());
+  auto empty = Table::Make(sch, {no_chunks, no_chunks});
+  ASSERT_OK_AND_ASSIGN(tensor, empty->ToTensor());
+  ASSERT_EQ(tensor->shape(), std::vector<int64_t>({0, 2}));
+
+  auto strings = Table::Make(schema({field("f0", utf8())}),
+                             {ChunkedArrayFromJSON(utf8(), {R"(["a"])", R"(["b"])"})});
+  ASSERT_RAISES(TypeError, strings->ToTensor());
+}
+
 TEST_F(TestTable, ConcatenateTables) {
   const int64_t length = 10;
 
@@ -17,7 +17,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
 #include "arrow/tensor/converter.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 #define DISPATCH(ACTION, index_elsize, value_elsize, ...) \
   switch (index_elsize) {                                 \
@@ -86,3 +95,135 @@
       }                                                   \
       break;                                              \
   }
+
+#define DISPATCH_VALUE(ACTION, value_elsize, ...) \
+  switch (value_elsize) {                         \
+    case 1:                                       \
+      ACTION(uint8_t, __VA_ARGS__);               \
+      break;                                      \
+    case 2:                                       \
+      ACTION(uint16_t, __VA_ARGS__);              \
+      break;                                      \
+    case 4:                                       \
+      ACTION(uint32_t, __VA_ARGS__);              \
+      break;                                      \
+    case 8:                                       \
+      ACTION(uint64_t, __VA_ARGS__);              \
+      break;                                      \
+  }
+
+namespace arrow {
+namespace internal {
+
+// Values are compared to zero as unsigned integers of the same width, so that
+// e.g. a negative floating-point zero is kept in the sparse tensor.
+
+// The minimum number of dense tensor elements handled by a conversion task
+constexpr int64_t kMinConversionTaskSize = 1 << 16;
+
+// The number of values OR-reduced at once when skipping runs of zeros: the
+// reduction is vectorized by the compiler
+constexpr int64_t kZeroScanBlockSize = 32;
+
+// Return the number of parallel tasks converting `size` dense tensor elements
+inline int GetConversionTaskCount(int64_t size) {
+  const int64_t max_tasks = std::max(1, GetCpuThreadPoolCapacity());
+  return static_cast<int>(
+      std::min(max_tasks, std::max<int64_t>(1, size / kMinConversionTaskSize)));
+}
+
+// Return the number of parallel tasks converting `num_lines` lines (or slabs) of
+// `line_length` dense tensor elements each
+inline int GetConversionTaskCount(int64_t num_lines, int64_t line_length) {
+  return static_cast<int>(std::max<int64_t>(
+      1, std::min<int64_t>(GetConversionTaskCount(num_lines * line_length), num_lines)));
+}
+
+// Call `func(task, start, stop)` for `num_tasks` contiguous ranges splitting
+// [0, length), in parallel if there are several tasks
+template <typename Function>
+Status ParallelForRanges(int64_t length, int num_tasks, Function&& func) {
+  return OptionalParallelFor(num_tasks > 1, num_tasks, [&](int task) {
+    const int64_t start = length * task / num_tasks;
+    const int64_t stop = length * (task + 1) / num_tasks;
+    func(task, start, stop);
+    return Status::OK();
+  });
+}
+
+template <typename c_value_type>
+int64_t CountNonZeroValues(const c_value_type* data, int64_t length) {
+  int64_t count = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    count += data[i] != 0;
+  }
+  return count;
+}
+
+// Call `visit(i)` for the position of each nonzero value, skipping blocks of
+// zeros at once
+template <typename c_value_type, typename Visitor>
+void VisitNonZeroValues(const c_value_type* data, int64_t length, Visitor&& visit) {
+  int64_t i = 0;
+  for (; i + kZeroScanBlockSize <= length; i += kZeroScanBlockSize) {
+    c_value_type any = 0;
+    for (int64_t j = 0; j < kZeroScanBlockSize; ++j) {
+      any |= data[i + j];
+    }
+    if (ARROW_PREDICT_TRUE(any == 0)) {
+      continue;
+    }
+    for (int64_t j = 0; j < kZeroScanBlockSize; ++j) {
+      if (data[i + j] != 0) {
+        visit(i + j);
+      }
+    }
+  }
+  for (; i < length; ++i) {
+    if (data[i] != 0) {
+      visit(i);
+    }
+  }
+}
+
+// Count the nonzero values of a line of `length` values `stride` bytes apart
+template <typename c_value_type>
+int64_t CountNonZeroLine(const uint8_t* data, int64_t length, int64_t stride) {
+  if (stride == sizeof(c_value_type)) {
+    return CountNonZeroValues(reinterpret_cast<const c_value_type*>(data), length);
+  }
+  int64_t count = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    count += *reinterpret_cast<const c_value_type*>(data + i * stride) != 0;
+  }
+  return count;
+}
+
+// Call `visit(i)` for the position of each nonzero value of a line of `length`
+// values `stride` bytes apart
+template <typename c_value_type, typename Visitor>
+void VisitNonZeroLine(const uint8_t* data, int64_t length, int64_t stride,
+                      Visitor&& visit) {
+  if (stride == sizeof(c_value_type)) {
+    VisitNonZeroValues(reinterpret_cast<const c_value_type*>(data), length,
+                       std::forward<Visitor>(visit));
+    return;
+  }
+  for (int64_t i = 0; i < length; ++i) {
+    if (*reinterpret_cast<const c_value_type*>(data + i * stride) != 0) {
+      visit(i);
+    }
+  }
+}
+
+// Count the nonzero values of each of the GetConversionTaskCount(length) ranges
+// of contiguous values splitting [0, length), as in ParallelForRanges.  The
+// output holds the exclusive prefix sums of the counts, followed by the total.
+Status CountNonZeroRanges(const uint8_t* data, int value_elsize, int64_t length,
+                          std::vector<int64_t>* offsets);
+
+// Zero the data of a dense tensor, in parallel for large tensors
+Status ZeroTensorData(uint8_t* data, int64_t size, int value_elsize);
+
+}  // namespace internal
+}  // namespace arrow
@@ -52,45 +52,56 @@ inline void IncrementRowMajorIndex(std::vector<c_index_type>& coord,
   }
 }
 
+// Convert the nonzero values of each range of the tensor data, as split by
+// CountNonZeroRanges, in parallel.  The coordinates are unravelled from the
+// position in the data along the row-major or column-major layout.
 template <typename c_index_type, typename c_value_type>
-void ConvertRowMajorTensor(const Tensor& tensor, c_index_type* indices,
-                           c_value_type* values, const int64_t size) {
-  const auto ndim = tensor.ndim();
+Status ConvertContiguousTensor(const Tensor& tensor, bool column_major,
+                               c_index_type* indices, c_value_type* values,
+                               const std::vector<int64_t>& range_offsets) {
+  const int ndim = tensor.ndim();
   const auto& shape = tensor.shape();
   const c_value_type* tensor_data =
       reinterpret_cast<const c_value_type*>(tensor.raw_data());
+  const int num_tasks = static_cast<int>(range_offsets.size()) - 1;
+
+  return ParallelForRanges(
+      tensor.size(), num_tasks, [&](int task, int64_t start, int64_t stop) {
+        c_index_type* out_indices = indices + range_offsets[task] * ndim;
+        c_value_type* out_values = values + range_offsets[task];
+        VisitNonZeroValues(tensor_data + start, stop - start, [&](int64_t i) {
+          *out_values++ = tensor_data[start + i];
+          int64_t position = start + i;
+          for (int j = 0; j < ndim; ++j) {
+            const int d = column_major ? j : ndim - j - 1;
+            out_indices[d] = static_cast<c_index_type>(position % shape[d]);
+            position /= shape[d];
+          }
+          out_indices += ndim;
+        });
+      });
+}
 
-  constexpr c_value_type zero = 0;
-  std::vector<c_index_type> coord(ndim, 0);
-  for (int64_t n = tensor.size(); n > 0; --n) {
-    const c_value_type x = *tensor_data;
-    if (ARROW_PREDICT_FALSE(x != zero)) {
-      std::copy(coord.begin(), coord.end(), indices);
-      *values++ = x;
-      indices += ndim;
-    }
-
-    IncrementRowMajorIndex(coord, shape);
-    ++tensor_data;
-  }
+template <typename c_index_type, typename c_value_type>
+Status ConvertRowMajorTensor(const Tensor& tensor, c_index_type* indices,
+                             c_value_type* values,
+                             const std::vector<int64_t>& range_offsets) {
+  return ConvertContiguousTensor(tensor, /*column_major=*/false, indices, values,
+                                 range_offsets);
 }
 
 template <typename c_index_type, typename c_value_type>
-void ConvertColumnMajorTensor(const Tensor& tensor, c_index_type* out_indices,
-                              c_value_type* out_values, const int64_t size) {
+Status ConvertColumnMajorTensor(const Tensor& tensor, c_index_type* out_indices,
+                                c_value_type* out_values,
+                                const std::vector<int64_t>& range_offsets) {
   const auto ndim = tensor.ndim();
+  const int64_t size = range_offsets.back();
   std::vector<c_index_type> indices(ndim * size);
   std::vector<c_value_type> values(size);
-  ConvertRowMajorTensor(tensor, indices.data(), values.data(), size);
+  RETURN_NOT_OK(ConvertContiguousTensor(tensor, /*column_major=*/true, indices.data(),
+                                        values.data(), range_offsets));
 
-  // transpose indices
-  for (int64_t i = 0; i < size; ++i) {
-    for (int j = 0; j < ndim / 2; ++j) {
-      std::swap(indices[i * ndim + j], indices[i * ndim + ndim - j - 1]);
-    }
-  }
-
-  // sort indices
+  // sort indices in row-major order
   std::vector<int64_t> order(size);
   std::iota(order.begin(), order.end(), 0);
   std::sort(order.begin(), order.end(), [&](const int64_t xi, const int64_t yi) {
@@ -106,19 +117,18 @@ void ConvertColumnMajorTensor(const Tensor& tensor, c_index_type* out_indices,
   });
 
   // transfer result
-  const auto* indices_data = indices.data();
   for (int64_t i = 0; i < size; ++i) {
-    out_values[i] = values[i];
+    out_values[i] = values[order[i]];
 
-    std::copy_n(indices_data, ndim, out_indices);
-    indices_data += ndim;
+    std::copy_n(indices.data() + order[i] * ndim, ndim, out_indices);
     out_indices += ndim;
   }
+  return Status::OK();
 }
 
 template <typename c_index_type, typename c_value_type>
-void ConvertStridedTensor(const Tensor& tensor, c_index_type* indices,
-                          c_value_type* values, const int64_t size) {
+Status ConvertStridedTensor(const Tensor& tensor, c_index_type* indices,
+                            c_value_type* values, const int64_t size) {
   using ValueType = typename CTypeTraits<c_value_type>::ArrowType;
   const auto& shape = tensor.shape();
   const auto ndim = tensor.ndim();
@@ -138,11 +148,14 @@ void ConvertStridedTensor(const Tensor& tensor, c_index_type* indices,
 
     IncrementRowMajorIndex(coord, shape);
   }
+  return Status::OK();
 }
 
-#define CONVERT_TENSOR(func, index_type, value_type, indices, values, size)     \
-  func<index_type, value_type>(tensor_, reinterpret_cast<index_type*>(indices), \
-                               reinterpret_cast<value_type*>(values), size)
+// Parenthesized, as the template arguments would split the RETURN_NOT_OK argument
+#define CONVERT_TENSOR(func, index_type, value_type, indices, values, size) \
+  RETURN_NOT_OK((func<index_type, value_type>(                              \
+      tensor_, reinterpret_cast<index_type*>(indices),                      \
+      reinterpret_cast<value_type*>(values), size)))
 
 // Using ARROW_EXPAND is necessary to expand __VA_ARGS__ correctly on VC++.
 #define CONVERT_ROW_MAJOR_TENSOR(index_type, value_type, ...) \
@@ -176,7 +189,18 @@ class SparseCOOTensorConverter : private SparseTensorConverterMixin {
     const int value_elsize = GetByteWidth(*tensor_.type());
 
     const int64_t ndim = tensor_.ndim();
-    ARROW_ASSIGN_OR_RAISE(int64_t nonzero_count, tensor_.CountNonZero());
+    // Contiguous tensors are counted and converted by ranges, in parallel
+    const bool is_contiguous =
+        ndim > 1 && (tensor_.is_row_major() || tensor_.is_column_major());
+    std::vector<int64_t> range_offsets;
+    int64_t nonzero_count;
+    if (is_contiguous) {
+      RETURN_NOT_OK(CountNonZeroRanges(tensor_.raw_data(), value_elsize, tensor_.size(),
+                                       &range_offsets));
+      nonzero_count = range_offsets.back();
+    } else {
+      ARROW_ASSIGN_OR_RAISE(nonzero_count, tensor_.CountNonZero());
+    }
 
     ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
                           AllocateBuffer(index_elsize * ndim * nonzero_count, pool_));
@@ -201,10 +225,10 @@ class SparseCOOTensorConverter : private SparseTensorConverterMixin {
       }
     } else if (tensor_.is_row_major()) {
       DISPATCH(CONVERT_ROW_MAJOR_TENSOR, index_elsize, value_elsize, indices, values,
-               nonzero_count);
+               range_offsets);
     } else if (tensor_.is_column_major()) {
       DISPATCH(CONVERT_COLUMN_MAJOR_TENSOR, index_elsize, value_elsize, indices, values,
-               nonzero_count);
+               range_offsets);
     } else {
       DISPATCH(CONVERT_STRIDED_TENSOR, index_elsize, value_elsize, indices, values,
                nonzero_count);
@@ -233,8 +257,39 @@ class SparseCOOTensorConverter : private SparseTensorConverterMixin {
   MemoryPool* pool_;
 };
 
+#define COUNT_NONZERO_RANGES(value_type, data, length, offsets)                   \
+  RETURN_NOT_OK(CountNonZeroRangesImpl(reinterpret_cast<const value_type*>(data), \
+                                       length, offsets))
+
+template <typename c_value_type>
+Status CountNonZeroRangesImpl(const c_value_type* data, int64_t length,
+                              std::vector<int64_t>* offsets) {
+  const int num_tasks = GetConversionTaskCount(length);
+  offsets->assign(num_tasks + 1, 0);
+  RETURN_NOT_OK(
+      ParallelForRanges(length, num_tasks, [&](int task, int64_t start, int64_t stop) {
+        (*offsets)[task + 1] = CountNonZeroValues(data + start, stop - start);
+      }));
+  std::partial_sum(offsets->begin(), offsets->end(), offsets->begin());
+  return Status::OK();
+}
+
 }  // namespace
 
+Status CountNonZeroRanges(const uint8_t* data, int value_elsize, int64_t length,
+                          std::vector<int64_t>* offsets) {
+  DISPATCH_VALUE(COUNT_NONZERO_RANGES, value_elsize, data, length, offsets);
+  return Status::OK();
+}
+
+Status ZeroTensorData(uint8_t* data, int64_t size, int value_elsize) {
+  return ParallelForRanges(size, GetConversionTaskCount(size),
+                           [&](int, int64_t start, int64_t stop) {
+                             std::fill(data + start * value_elsize,
+                                       data + stop * value_elsize, 0);
+                           });
+}
+
 void SparseTensorConverterMixin::AssignIndex(uint8_t* indices, int64_t val,
                                              const int elsize) {
   switch (elsize) {
@@ -302,27 +357,34 @@ Result<std::shared_ptr<Tensor>> MakeTensorFromSparseCOOTensor(
   ARROW_ASSIGN_OR_RAISE(auto values_buffer,
                         AllocateBuffer(value_elsize * sparse_tensor->size(), pool));
   auto values = values_buffer->mutable_data();
-  std::fill_n(values, value_elsize * sparse_tensor->size(), 0);
+  RETURN_NOT_OK(ZeroTensorData(values, sparse_tensor->size(), value_elsize));
 
   std::vector<int64_t> strides;
   ComputeRowMajorStrides(value_type, sparse_tensor->shape(), &strides);
 
-  const auto* raw_data = sparse_tensor->raw_data();
   const int ndim = sparse_tensor->ndim();
-
-  for (int64_t i = 0; i < sparse_tensor->non_zero_length(); ++i) {
-    int64_t offset = 0;
-
-    for (int j = 0; j < ndim; ++j) {
-      auto index = static_cast<int64_t>(
-          SparseTensorConverterMixin::GetIndexValue(coords_data, index_elsize));
-      offset += index * strides[j];
-      coords_data += index_elsize;
-    }
-
-    std::copy_n(raw_data, value_elsize, values + offset);
-    raw_data += value_elsize;
-  }
+  const int64_t non_zero_length = sparse_tensor->non_zero_length();
+
+  // Coordinates are unique, so that the values can be scattered in parallel
+  RETURN_NOT_OK(ParallelForRanges(
+      non_zero_length, GetConversionTaskCount(non_zero_length),
+      [&](int, int64_t start, int64_t stop) {
+        const auto* coords = coords_data + start * ndim * index_elsize;
+        const auto* raw_data = sparse_tensor->raw_data() + start * value_elsize;
+        for (int64_t i = start; i < stop; ++i) {
+          int64_t offset = 0;
+
+          for (int j = 0; j < ndim; ++j) {
+            auto index = static_cast<int64_t>(
+                SparseTensorConverterMixin::GetIndexValue(coords, index_elsize));
+            offset += index * strides[j];
+            coords += index_elsize;
+          }
+
+          std::copy_n(raw_data, value_elsize, values + offset);
+          raw_data += value_elsize;
+        }
+      }));
 
   return std::make_shared<Tensor>(sparse_tensor->type(), std::move(values_buffer),
                                   sparse_tensor->shape(), strides,
@@ -15,7 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
-#include "arrow/tensor/converter.h"
+#include "arrow/tensor/converter_internal.h"
 
 #include <algorithm>
 #include <cstdint>
@@ -24,7 +24,6 @@
 #include <vector>
 
 #include "arrow/buffer.h"
-#include "arrow/buffer_builder.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
@@ -39,27 +38,89 @@ class MemoryPool;
 namespace internal {
 namespace {
 
-inline void IncrementIndex(std::vector<int64_t>& coord, const std::vector<int64_t>& shape,
-                           const std::vector<int64_t>& axis_order) {
-  const int64_t ndim = shape.size();
+// ----------------------------------------------------------------------
+// SparseTensorConverter for SparseCSFIndex
+
+// The CSF tree of the nonzero values whose coordinate along the first axis (in
+// axis order) lies in a range.  As the ranges partition that axis, the trees of
+// consecutive slabs concatenate level by level into the tree of the tensor.
+struct CSFSlab {
+  // Per level, the position of the first child of each node within the slab
+  std::vector<std::vector<int64_t>> indptr;
+  // Per level, the coordinate of each node
+  std::vector<std::vector<int64_t>> indices;
+  std::vector<uint8_t> values;
+};
+
+// Build the CSF tree of a slab, scanning lines along the last axis (in axis order)
+template <typename c_value_type>
+void ConvertCSFSlab(const Tensor& tensor, const std::vector<int64_t>& axis_order,
+                    int64_t start, int64_t stop, CSFSlab* slab) {
+  const int ndim = tensor.ndim();
+  const auto& shape = tensor.shape();
+  const auto& strides = tensor.strides();
+  const uint8_t* tensor_data = tensor.raw_data();
+  slab->indptr.resize(ndim - 1);
+  slab->indices.resize(ndim);
+  if (start >= stop) {
+    return;
+  }
+
   const int64_t last_axis = axis_order[ndim - 1];
-  ++coord[last_axis];
-  if (coord[last_axis] == shape[last_axis]) {
-    int64_t d = ndim - 1;
-    while (d > 0 && coord[axis_order[d]] == shape[axis_order[d]]) {
-      coord[axis_order[d]] = 0;
-      ++coord[axis_order[d - 1]];
-      --d;
+  const int64_t line_length = shape[last_axis];
+  const int64_t value_stride = strides[last_axis];
+  std::vector<int64_t> coord(ndim, 0);
+  std::vector<int64_t> previous_coord(ndim, -1);
+  coord[axis_order[0]] = start;
+
+  while (true) {
+    int64_t line_offset = 0;
+    for (int d = 0; d < ndim; ++d) {
+      if (d != last_axis) {
+        line_offset += coord[d] * strides[d];
+      }
+    }
+    const uint8_t* line = tensor_data + line_offset;
+    VisitNonZeroLine<c_value_type>(line, line_length, value_stride, [&](int64_t j) {
+      coord[last_axis] = j;
+      bool tree_split = false;
+      for (int i = 0; i < ndim; ++i) {
+        const int64_t dimension = axis_order[i];
+        tree_split = tree_split || (coord[dimension] != previous_coord[dimension]);
+        if (tree_split) {
+          if (i < ndim - 1) {
+            slab->indptr[i].push_back(
+                static_cast<int64_t>(slab->indices[i + 1].size()));
+          }
+          slab->indices[i].push_back(coord[dimension]);
+        }
+      }
+      previous_coord = coord;
+
+      const uint8_t* value = line + j * value_stride;
+      slab->values.insert(slab->values.end(), value, value + sizeof(c_value_type));
+    });
+
+    // Move on to the next line, in axis order
+    int level = ndim - 2;
+    for (; level >= 0; --level) {
+      const int64_t axis = axis_order[level];
+      if (++coord[axis] < (level == 0 ? stop : shape[axis])) {
+        break;
+      }
+      coord[axis] = 0;
+    }
+    if (level < 0) {
+      return;
     }
   }
 }
 
-// ----------------------------------------------------------------------
-// SparseTensorConverter for SparseCSFIndex
+#define CONVERT_CSF_SLAB(value_type, tensor, axis_order, start, stop, slab) \
+  ConvertCSFSlab<value_type>(tensor, axis_order, start, stop, slab)
 
 class SparseCSFTensorConverter : private SparseTensorConverterMixin {
   using SparseTensorConverterMixin::AssignIndex;
-  using SparseTensorConverterMixin::IsNonZero;
 
  public:
   SparseCSFTensorConverter(const Tensor& tensor,
@@ -74,88 +135,77 @@ class SparseCSFTensorConverter : private SparseTensorConverterMixin {
     const int index_elsize = GetByteWidth(*index_value_type_);
     const int value_elsize = GetByteWidth(*tensor_.type());
 
-    const int64_t ndim = tensor_.ndim();
+    const int ndim = tensor_.ndim();
+    if (ndim <= 1) {
+      return Status::NotImplemented("TODO for ndim <= 1");
+    }
     // Axis order as ascending order of dimension size is a good heuristic but is not
     // necessarily optimal.
     std::vector<int64_t> axis_order = internal::ArgSort(tensor_.shape());
-    ARROW_ASSIGN_OR_RAISE(int64_t nonzero_count, tensor_.CountNonZero());
-
-    ARROW_ASSIGN_OR_RAISE(auto values_buffer,
-                          AllocateBuffer(value_elsize * nonzero_count, pool_));
-    auto* values = values_buffer->mutable_data();
 
+    // Build the trees of slabs along the first axis in parallel
+    const int64_t n_first = tensor_.size() == 0 ? 0 : tensor_.shape()[axis_order[0]];
+    const int num_tasks = GetConversionTaskCount(
+        n_first, tensor_.size() / std::max<int64_t>(n_first, 1));
+    std::vector<CSFSlab> slabs(num_tasks);
+    RETURN_NOT_OK(ParallelForRanges(
+        n_first, num_tasks, [&](int task, int64_t start, int64_t stop) {
+          DISPATCH_VALUE(CONVERT_CSF_SLAB, value_elsize, tensor_, axis_order, start,
+                         stop, &slabs[task]);
+        }));
+
+    // Locate each slab's nodes in the tree of the tensor
     std::vector<int64_t> counts(ndim, 0);
-    std::vector<int64_t> coord(ndim, 0);
-    std::vector<int64_t> previous_coord(ndim, -1);
-    std::vector<BufferBuilder> indptr_buffer_builders(ndim - 1);
-    std::vector<BufferBuilder> indices_buffer_builders(ndim);
+    std::vector<std::vector<int64_t>> slab_bases(num_tasks);
+    for (int task = 0; task < num_tasks; ++task) {
+      slab_bases[task] = counts;
+      for (int i = 0; i < ndim; ++i) {
+        counts[i] += static_cast<int64_t>(slabs[task].indices[i].size());
+      }
+    }
+    const int64_t nonzero_count = counts[ndim - 1];
 
-    const auto* tensor_data = tensor_.raw_data();
-    uint8_t index_buffer[sizeof(int64_t)];
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> values_buffer,
+                          AllocateBuffer(value_elsize * nonzero_count, pool_));
+    std::vector<std::shared_ptr<Buffer>> indptr_buffers(ndim - 1);
+    std::vector<std::shared_ptr<Buffer>> indices_buffers(ndim);
+    for (int i = 0; i < ndim; ++i) {
+      ARROW_ASSIGN_OR_RAISE(indices_buffers[i],
+                            AllocateBuffer(index_elsize * counts[i], pool_));
+      if (i < ndim - 1) {
+        ARROW_ASSIGN_OR_RAISE(indptr_buffers[i],
+                              AllocateBuffer(index_elsize * (counts[i] + 1), pool_));
+        AssignIndex(indptr_buffers[i]->mutable_data() + counts[i] * index_elsize,
+                    counts[i + 1], index_elsize);
+      }
+    }
 
-    if (ndim <= 1) {
-      return Status::NotImplemented("TODO for ndim <= 1");
-    } else {
-      const auto& shape = tensor_.shape();
-      for (int64_t n = tensor_.size(); n > 0; n--) {
-        const auto offset = tensor_.CalculateValueOffset(coord);
-        const auto xp = tensor_data + offset;
-
-        if (std::any_of(xp, xp + value_elsize, IsNonZero)) {
-          bool tree_split = false;
-
-          std::copy_n(xp, value_elsize, values);
-          values += value_elsize;
-
-          for (int64_t i = 0; i < ndim; ++i) {
-            int64_t dimension = axis_order[i];
-
-            tree_split = tree_split || (coord[dimension] != previous_coord[dimension]);
-            if (tree_split) {
-              if (i < ndim - 1) {
-                AssignIndex(index_buffer, counts[i + 1], index_elsize);
-                RETURN_NOT_OK(
-                    indptr_buffer_builders[i].Append(index_buffer, index_elsize));
-              }
-
-              AssignIndex(index_buffer, coord[dimension], index_elsize);
-              RETURN_NOT_OK(
-                  indices_buffer_builders[i].Append(index_buffer, index_elsize));
-
-              ++counts[i];
-            }
+    RETURN_NOT_OK(ParallelForRanges(num_tasks, num_tasks, [&](int task, int64_t,
+                                                              int64_t) {
+      const CSFSlab& slab = slabs[task];
+      const std::vector<int64_t>& bases = slab_bases[task];
+      for (int i = 0; i < ndim; ++i) {
+        uint8_t* indices = indices_buffers[i]->mutable_data() + bases[i] * index_elsize;
+        for (int64_t index : slab.indices[i]) {
+          AssignIndex(indices, index, index_elsize);
+          indices += index_elsize;
+        }
+        if (i < ndim - 1) {
+          uint8_t* indptr = indptr_buffers[i]->mutable_data() + bases[i] * index_elsize;
+          for (int64_t position : slab.indptr[i]) {
+            AssignIndex(indptr, bases[i + 1] + position, index_elsize);
+            indptr += index_elsize;
           }
-
-          previous_coord = coord;
         }
-
-        IncrementIndex(coord, shape, axis_order);
       }
-    }
-
-    for (int64_t column = 0; column < ndim - 1; ++column) {
-      AssignIndex(index_buffer, counts[column + 1], index_elsize);
-      RETURN_NOT_OK(indptr_buffer_builders[column].Append(index_buffer, index_elsize));
-    }
+      std::copy(slab.values.begin(), slab.values.end(),
+                values_buffer->mutable_data() + bases[ndim - 1] * value_elsize);
+    }));
 
     // make results
     data = std::move(values_buffer);
-
-    std::vector<std::shared_ptr<Buffer>> indptr_buffers(ndim - 1);
-    std::vector<std::shared_ptr<Buffer>> indices_buffers(ndim);
-    std::vector<int64_t> indptr_shapes(counts.begin(), counts.end() - 1);
-    std::vector<int64_t> indices_shapes = counts;
-
-    for (int64_t column = 0; column < ndim; ++column) {
-      RETURN_NOT_OK(
-          indices_buffer_builders[column].Finish(&indices_buffers[column], true));
-    }
-    for (int64_t column = 0; column < ndim - 1; ++column) {
-      RETURN_NOT_OK(indptr_buffer_builders[column].Finish(&indptr_buffers[column], true));
-    }
-
     ARROW_ASSIGN_OR_RAISE(
-        sparse_index, SparseCSFIndex::Make(index_value_type_, indices_shapes, axis_order,
+        sparse_index, SparseCSFIndex::Make(index_value_type_, counts, axis_order,
                                            indptr_buffers, indices_buffers));
     return Status::OK();
   }
@@ -216,11 +266,15 @@ class TensorBuilderFromSparseCSFTensor : private SparseTensorConverterMixin {
     ARROW_ASSIGN_OR_RAISE(values_buffer_,
                           AllocateBuffer(value_elsize_ * tensor_size_, pool_));
     values_ = values_buffer_->mutable_data();
-    std::fill_n(values_, value_elsize_ * tensor_size_, 0);
-
-    const int64_t start = 0;
-    const int64_t stop = indptr_[0]->size() - 1;
-    ExpandValues(0, 0, start, stop);
+    RETURN_NOT_OK(ZeroTensorData(values_, tensor_size_, value_elsize_));
+
+    // The subtrees of the root nodes are expanded in parallel
+    const int64_t num_roots = indptr_[0]->size() - 1;
+    const int num_tasks = GetConversionTaskCount(
+        num_roots, non_zero_length_ / std::max<int64_t>(num_roots, 1));
+    RETURN_NOT_OK(ParallelForRanges(
+        num_roots, num_tasks,
+        [&](int, int64_t start, int64_t stop) { ExpandValues(0, 0, start, stop); }));
 
     return std::make_shared<Tensor>(sparse_tensor_->type(), std::move(values_buffer_),
                                     shape_, strides_, sparse_tensor_->dim_names());
@@ -15,11 +15,13 @@
 // specific language governing permissions and limitations
 // under the License.
 
-#include "arrow/tensor/converter.h"
+#include "arrow/tensor/converter_internal.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <vector>
 
 #include "arrow/buffer.h"
@@ -38,10 +40,67 @@ namespace {
 // ----------------------------------------------------------------------
 // SparseTensorConverter for SparseCSRIndex
 
-class SparseCSXMatrixConverter : private SparseTensorConverterMixin {
-  using SparseTensorConverterMixin::AssignIndex;
-  using SparseTensorConverterMixin::IsNonZero;
+// The dense matrix is scanned by lines along the minor axis, split in ranges
+// of lines converted in parallel: a first pass counts the nonzero values of
+// each line, giving indptr, and a second pass fills indices and values.
+struct MatrixLines {
+  const uint8_t* data;
+  int64_t num_lines;
+  int64_t line_length;
+  // Byte strides between lines and between values of a line
+  int64_t line_stride;
+  int64_t value_stride;
+
+  const uint8_t* line(int64_t i) const { return data + i * line_stride; }
+
+  int num_tasks() const { return GetConversionTaskCount(num_lines, line_length); }
+};
+
+template <typename c_value_type>
+Status CountNonZeroLines(const MatrixLines& lines, std::vector<int64_t>* offsets) {
+  offsets->assign(lines.num_lines + 1, 0);
+  RETURN_NOT_OK(ParallelForRanges(
+      lines.num_lines, lines.num_tasks(), [&](int, int64_t start, int64_t stop) {
+        for (int64_t i = start; i < stop; ++i) {
+          (*offsets)[i + 1] = CountNonZeroLine<c_value_type>(
+              lines.line(i), lines.line_length, lines.value_stride);
+        }
+      }));
+  std::partial_sum(offsets->begin(), offsets->end(), offsets->begin());
+  return Status::OK();
+}
+
+template <typename c_index_type, typename c_value_type>
+Status ConvertLines(const MatrixLines& lines, const std::vector<int64_t>& offsets,
+                    c_index_type* indptr, c_index_type* indices, c_value_type* values) {
+  std::transform(offsets.begin(), offsets.end(), indptr,
+                 [](int64_t offset) { return static_cast<c_index_type>(offset); });
+  return ParallelForRanges(
+      lines.num_lines, lines.num_tasks(), [&](int, int64_t start, int64_t stop) {
+        c_index_type* out_indices = indices + offsets[start];
+        c_value_type* out_values = values + offsets[start];
+        for (int64_t i = start; i < stop; ++i) {
+          const uint8_t* line = lines.line(i);
+          VisitNonZeroLine<c_value_type>(
+              line, lines.line_length, lines.value_stride, [&](int64_t j) {
+                *out_indices++ = static_cast<c_index_type>(j);
+                *out_values++ = *reinterpret_cast<const c_value_type*>(
+                    line + j * lines.value_stride);
+              });
+        }
+      });
+}
+
+#define COUNT_NONZERO_LINES(value_type, lines, offsets) \
+  RETURN_NOT_OK(CountNonZeroLines<value_type>(lines, offsets))
 
+// Parenthesized, as the template arguments would split the RETURN_NOT_OK argument
+#define CONVERT_LINES(index_type, value_type, lines, offsets, indptr, indices, values) \
+  RETURN_NOT_OK((ConvertLines<index_type, value_type>(                                \
+      lines, offsets, reinterpret_cast<index_type*>(indptr),                           \
+      reinterpret_cast<index_type*>(indices), reinterpret_cast<value_type*>(values))))
+
+class SparseCSXMatrixConverter : private SparseTensorConverterMixin {
  public:
   SparseCSXMatrixConverter(SparseMatrixCompressedAxis axis, const Tensor& tensor,
                            const std::shared_ptr<DataType>& index_value_type,
@@ -59,59 +118,31 @@ class SparseCSXMatrixConverter : private SparseTensorConverterMixin {
     if (ndim > 2) {
       return Status::Invalid("Invalid tensor dimension");
     }
+    if (ndim <= 1) {
+      return Status::NotImplemented("TODO for ndim <= 1");
+    }
 
     const int major_axis = static_cast<int>(axis_);
     const int64_t n_major = tensor_.shape()[major_axis];
     const int64_t n_minor = tensor_.shape()[1 - major_axis];
-    ARROW_ASSIGN_OR_RAISE(int64_t nonzero_count, tensor_.CountNonZero());
-
-    std::shared_ptr<Buffer> indptr_buffer;
-    std::shared_ptr<Buffer> indices_buffer;
-
+    const MatrixLines lines{tensor_.raw_data(), n_major, n_minor,
+                            tensor_.strides()[major_axis],
+                            tensor_.strides()[1 - major_axis]};
+
+    std::vector<int64_t> line_offsets;
+    DISPATCH_VALUE(COUNT_NONZERO_LINES, value_elsize, lines, &line_offsets);
+    const int64_t nonzero_count = line_offsets.back();
+
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indptr_buffer,
+                          AllocateBuffer(index_elsize * (n_major + 1), pool_));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indices_buffer,
+                          AllocateBuffer(index_elsize * nonzero_count, pool_));
     ARROW_ASSIGN_OR_RAISE(auto values_buffer,
                           AllocateBuffer(value_elsize * nonzero_count, pool_));
-    auto* values = values_buffer->mutable_data();
 
-    const auto* tensor_data = tensor_.raw_data();
-
-    if (ndim <= 1) {
-      return Status::NotImplemented("TODO for ndim <= 1");
-    } else {
-      ARROW_ASSIGN_OR_RAISE(indptr_buffer,
-                            AllocateBuffer(index_elsize * (n_major + 1), pool_));
-      auto* indptr = indptr_buffer->mutable_data();
-
-      ARROW_ASSIGN_OR_RAISE(indices_buffer,
-                            AllocateBuffer(index_elsize * nonzero_count, pool_));
-      auto* indices = indices_buffer->mutable_data();
-
-      std::vector<int64_t> coords(2);
-      int64_t k = 0;
-      std::fill_n(indptr, index_elsize, 0);
-      indptr += index_elsize;
-      for (int64_t i = 0; i < n_major; ++i) {
-        for (int64_t j = 0; j < n_minor; ++j) {
-          if (axis_ == SparseMatrixCompressedAxis::ROW) {
-            coords = {i, j};
-          } else {
-            coords = {j, i};
-          }
-          const int64_t offset = tensor_.CalculateValueOffset(coords);
-          if (std::any_of(tensor_data + offset, tensor_data + offset + value_elsize,
-                          IsNonZero)) {
-            std::copy_n(tensor_data + offset, value_elsize, values);
-            values += value_elsize;
-
-            AssignIndex(indices, j, index_elsize);
-            indices += index_elsize;
-
-            k++;
-          }
-        }
-        AssignIndex(indptr, k, index_elsize);
-        indptr += index_elsize;
-      }
-    }
+    DISPATCH(CONVERT_LINES, index_elsize, value_elsize, lines, line_offsets,
+             indptr_buffer->mutable_data(), indices_buffer->mutable_data(),
+             values_buffer->mutable_data());
 
     std::vector<int64_t> indptr_shape({n_major + 1});
     std::shared_ptr<Tensor> indptr_tensor =
@@ -174,38 +205,42 @@ Result<std::shared_ptr<Tensor>> MakeTensorFromSparseCSXMatrix(
   ARROW_ASSIGN_OR_RAISE(auto values_buffer,
                         AllocateBuffer(value_elsize * tensor_size, pool));
   auto values = values_buffer->mutable_data();
-  std::fill_n(values, value_elsize * tensor_size, 0);
+  RETURN_NOT_OK(ZeroTensorData(values, tensor_size, value_elsize));
 
   std::vector<int64_t> strides;
   ComputeRowMajorStrides(fw_value_type, shape, &strides);
 
   const auto nc = shape[1];
-
-  int64_t offset = 0;
-  for (int64_t i = 0; i < indptr->size() - 1; ++i) {
-    const auto start =
-        SparseTensorConverterMixin::GetIndexValue(indptr_data, indptr_elsize);
-    const auto stop = SparseTensorConverterMixin::GetIndexValue(
-        indptr_data + indptr_elsize, indptr_elsize);
-
-    for (int64_t j = start; j < stop; ++j) {
-      const auto index = SparseTensorConverterMixin::GetIndexValue(
-          indices_data + j * indices_elsize, indices_elsize);
-      switch (axis) {
-        case SparseMatrixCompressedAxis::ROW:
-          offset = (index + i * nc) * value_elsize;
-          break;
-        case SparseMatrixCompressedAxis::COLUMN:
-          offset = (i + index * nc) * value_elsize;
-          break;
-      }
-
-      std::copy_n(raw_data, value_elsize, values + offset);
-      raw_data += value_elsize;
-    }
-
-    indptr_data += indptr_elsize;
-  }
+  const int64_t n_major = indptr->size() - 1;
+  const int num_tasks =
+      GetConversionTaskCount(n_major, tensor_size / std::max<int64_t>(n_major, 1));
+
+  // Lines are independent, so that they can be expanded in parallel
+  RETURN_NOT_OK(ParallelForRanges(
+      n_major, num_tasks, [&](int, int64_t first_line, int64_t last_line) {
+        int64_t offset = 0;
+        for (int64_t i = first_line; i < last_line; ++i) {
+          const auto start = SparseTensorConverterMixin::GetIndexValue(
+              indptr_data + i * indptr_elsize, indptr_elsize);
+          const auto stop = SparseTensorConverterMixin::GetIndexValue(
+              indptr_data + (i + 1) * indptr_elsize, indptr_elsize);
+
+          for (int64_t j = start; j < stop; ++j) {
+            const auto index = SparseTensorConverterMixin::GetIndexValue(
+                indices_data + j * indices_elsize, indices_elsize);
+            switch (axis) {
+              case SparseMatrixCompressedAxis::ROW:
+                offset = (index + i * nc) * value_elsize;
+                break;
+              case SparseMatrixCompressedAxis::COLUMN:
+                offset = (i + index * nc) * value_elsize;
+                break;
+            }
+
+            std::copy_n(raw_data + j * value_elsize, value_elsize, values + offset);
+          }
+        }
+      }));
 
   return std::make_shared<Tensor>(value_type, std::move(values_buffer), shape, strides,
                                   dim_names);
@@ -267,4 +267,57 @@ BENCHMARK_CONVERT_TENSOR(Tensor, CSF, Double, Int16);
 BENCHMARK_CONVERT_TENSOR(Tensor, CSF, Double, Int32);
 BENCHMARK_CONVERT_TENSOR(Tensor, CSF, Double, Int64);
 
+// A large row-major matrix at 1% density, as found in feature matrices, whose
+// conversion is split across threads
+
+class LargeSparseMatrixFixture : public benchmark::Fixture {
+ protected:
+  std::vector<double> values_;
+  std::shared_ptr<Tensor> tensor_;
+
+ public:
+  void SetUp(const ::benchmark::State& state) {
+    const std::vector<int64_t> shape = {4096, 2048};
+    values_.assign(shape[0] * shape[1], 0);
+    std::default_random_engine rng(42);
+    std::uniform_real_distribution<double> density(0, 1);
+    for (auto& value : values_) {
+      if (density(rng) < 0.01) {
+        value = 1.0 + density(rng);
+      }
+    }
+    ABORT_NOT_OK(Tensor::Make(float64(), Buffer::Wrap(values_), shape).Value(&tensor_));
+  }
+
+  void TearDown(const ::benchmark::State& state) {
+    values_.clear();
+    tensor_.reset();
+  }
+};
+
+#define BENCHMARK_CONVERT_LARGE_MATRIX(format)                                           \
+  BENCHMARK_F(LargeSparseMatrixFixture, ConvertToSparse##format)                         \
+  (benchmark::State & state) { /* NOLINT non-const reference */                          \
+    std::shared_ptr<Sparse##format> sparse_tensor;                                       \
+    for (auto _ : state) {                                                               \
+      ABORT_NOT_OK(Sparse##format::Make(*this->tensor_, int64()).Value(&sparse_tensor)); \
+    }                                                                                    \
+    state.SetItemsProcessed(state.iterations() * this->tensor_->size());                 \
+  }                                                                                      \
+  BENCHMARK_F(LargeSparseMatrixFixture, ConvertFromSparse##format)                       \
+  (benchmark::State & state) { /* NOLINT non-const reference */                          \
+    std::shared_ptr<Sparse##format> sparse_tensor;                                       \
+    ABORT_NOT_OK(Sparse##format::Make(*this->tensor_, int64()).Value(&sparse_tensor));   \
+    std::shared_ptr<Tensor> dense;                                                       \
+    for (auto _ : state) {                                                               \
+      ABORT_NOT_OK(sparse_tensor->ToTensor().Value(&dense));                             \
+    }                                                                                    \
+    state.SetItemsProcessed(state.iterations() * this->tensor_->size());                 \
+  }
+
+BENCHMARK_CONVERT_LARGE_MATRIX(COOTensor);
+BENCHMARK_CONVERT_LARGE_MATRIX(CSRMatrix);
+BENCHMARK_CONVERT_LARGE_MATRIX(CSCMatrix);
+BENCHMARK_CONVERT_LARGE_MATRIX(CSFTensor);
+
 }  // namespace arrow
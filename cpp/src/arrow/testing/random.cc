@@ -18,8 +18,10 @@
 #include "arrow/testing/random.h"
 
 #include <algorithm>
+#include <cmath>
 #include <memory>
 #include <random>
+#include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -31,6 +33,7 @@
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/bitmap_reader.h"
 #include "arrow/util/logging.h"
 
@@ -323,6 +326,218 @@ std::shared_ptr<Array> RandomArrayGenerator::List(const Array& values, int64_t s
 
 namespace {
 
+// Draws integers in [0, n) with a probability proportional to 1 / (k + 1)^exponent
+class ZipfDistribution {
+ public:
+  ZipfDistribution(int64_t n, double exponent) : cdf_(static_cast<size_t>(n)) {
+    double total = 0;
+    for (int64_t k = 0; k < n; ++k) {
+      total += std::pow(static_cast<double>(k + 1), -exponent);
+      cdf_[k] = total;
+    }
+    for (auto& value : cdf_) {
+      value /= total;
+    }
+  }
+
+  template <typename Generator>
+  int64_t operator()(Generator& rng) {
+    const double u = std::uniform_real_distribution<double>(0, 1)(rng);
+    const auto k = std::lower_bound(cdf_.begin(), cdf_.end(), u) - cdf_.begin();
+    return std::min<int64_t>(k, static_cast<int64_t>(cdf_.size()) - 1);
+  }
+
+ private:
+  std::vector<double> cdf_;
+};
+
+std::shared_ptr<Array> MakeInt64Array(const std::vector<int64_t>& values,
+                                      std::shared_ptr<Buffer> null_bitmap) {
+  const auto size = static_cast<int64_t>(values.size());
+  std::shared_ptr<Buffer> data = *AllocateBuffer(sizeof(int64_t) * size);
+  std::copy(values.begin(), values.end(),
+            reinterpret_cast<int64_t*>(data->mutable_data()));
+  const int64_t null_count =
+      size - internal::CountSetBits(null_bitmap->data(), /*bit_offset=*/0, size);
+  return std::make_shared<Int64Array>(size, std::move(data), std::move(null_bitmap),
+                                      null_count);
+}
+
+// Generate `unique` strings made of one of num_prefixes prefixes and a suffix
+std::shared_ptr<Array> GeneratePrefixedStrings(RandomArrayGenerator* gen, int64_t unique,
+                                               int64_t num_prefixes,
+                                               int32_t prefix_length,
+                                               int32_t min_suffix_length,
+                                               int32_t max_suffix_length) {
+  auto prefixes = std::static_pointer_cast<StringArray>(
+      gen->String(num_prefixes, prefix_length, prefix_length));
+  auto suffixes = std::static_pointer_cast<StringArray>(
+      gen->String(unique, min_suffix_length, max_suffix_length));
+  auto prefix_indices = std::static_pointer_cast<Int64Array>(
+      gen->Int64(unique, 0, num_prefixes - 1));
+
+  StringBuilder builder;
+  for (int64_t i = 0; i < unique; ++i) {
+    const auto prefix = prefixes->GetView(prefix_indices->Value(i));
+    const auto suffix = suffixes->GetView(i);
+    std::string value;
+    value.reserve(prefix.size() + suffix.size());
+    value.append(prefix.data(), prefix.size());
+    value.append(suffix.data(), suffix.size());
+    ABORT_NOT_OK(builder.Append(value));
+  }
+  std::shared_ptr<Array> result;
+  ABORT_NOT_OK(builder.Finish(&result));
+  return result;
+}
+
+}  // namespace
+
+std::shared_ptr<Array> RandomArrayGenerator::ZipfInt64(int64_t size, int64_t num_unique,
+                                                       double exponent,
+                                                       double null_probability) {
+  std::default_random_engine rng(seed());
+  ZipfDistribution dist(num_unique, exponent);
+  std::vector<int64_t> values(static_cast<size_t>(size));
+  std::generate(values.begin(), values.end(), [&] { return dist(rng); });
+  return MakeInt64Array(values, NullBitmap(size, null_probability));
+}
+
+std::shared_ptr<Array> RandomArrayGenerator::SortedRunsInt64(int64_t size, int64_t min,
+                                                             int64_t max,
+                                                             int64_t num_runs,
+                                                             double disorder,
+                                                             double null_probability) {
+  std::default_random_engine rng(seed());
+  std::uniform_int_distribution<int64_t> value_dist(min, max);
+  std::vector<int64_t> values(static_cast<size_t>(size));
+  std::generate(values.begin(), values.end(), [&] { return value_dist(rng); });
+
+  for (int64_t run = 0; run < num_runs; ++run) {
+    std::sort(values.begin() + size * run / num_runs,
+              values.begin() + size * (run + 1) / num_runs);
+  }
+  if (disorder > 0 && size > 0) {
+    std::bernoulli_distribution swap_dist(disorder);
+    std::uniform_int_distribution<int64_t> index_dist(0, size - 1);
+    for (auto& value : values) {
+      if (swap_dist(rng)) {
+        std::swap(value, values[index_dist(rng)]);
+      }
+    }
+  }
+  return MakeInt64Array(values, NullBitmap(size, null_probability));
+}
+
+std::shared_ptr<Buffer> RandomArrayGenerator::ClusteredNullBitmap(
+    int64_t size, double null_probability, double mean_null_run_length,
+    int64_t* null_count) {
+  std::shared_ptr<Buffer> bitmap = *AllocateEmptyBitmap(size);
+  int64_t count = 0;
+  if (null_probability >= 1) {
+    count = size;
+  } else if (null_probability <= 0) {
+    BitUtil::SetBitsTo(bitmap->mutable_data(), 0, size, true);
+  } else {
+    // Alternate geometrically distributed runs of nulls and valid values, with
+    // mean lengths such that the expected proportion of nulls is null_probability
+    const double mean_null_run = std::max(mean_null_run_length, 1.0);
+    const double mean_valid_run =
+        std::max(mean_null_run * (1 - null_probability) / null_probability, 1.0);
+    std::default_random_engine rng(seed());
+    std::geometric_distribution<int64_t> null_run_dist(1 / mean_null_run);
+    std::geometric_distribution<int64_t> valid_run_dist(1 / mean_valid_run);
+    bool is_null = std::bernoulli_distribution(null_probability)(rng);
+    int64_t i = 0;
+    while (i < size) {
+      const int64_t run_length =
+          std::min(1 + (is_null ? null_run_dist(rng) : valid_run_dist(rng)), size - i);
+      if (is_null) {
+        count += run_length;
+      } else {
+        BitUtil::SetBitsTo(bitmap->mutable_data(), i, run_length, true);
+      }
+      i += run_length;
+      is_null = !is_null;
+    }
+  }
+  if (null_count != nullptr) {
+    *null_count = count;
+  }
+  return bitmap;
+}
+
+std::shared_ptr<Array> RandomArrayGenerator::WithClusteredNulls(
+    const Array& array, double null_probability, double mean_null_run_length) {
+  DCHECK(internal::HasValidityBitmap(array.type_id()));
+  auto data = array.data()->Copy();
+  // The bitmap covers the array's offset, the null count is computed lazily
+  data->buffers[0] = ClusteredNullBitmap(array.offset() + array.length(),
+                                         null_probability, mean_null_run_length);
+  data->null_count = kUnknownNullCount;
+  return MakeArray(data);
+}
+
+std::shared_ptr<Array> RandomArrayGenerator::StringWithPrefixes(
+    int64_t size, int64_t unique, int64_t num_prefixes, int32_t prefix_length,
+    int32_t min_suffix_length, int32_t max_suffix_length, double null_probability) {
+  auto dictionary = std::static_pointer_cast<StringArray>(
+      GeneratePrefixedStrings(this, unique, num_prefixes, prefix_length,
+                              min_suffix_length, max_suffix_length));
+  auto indices =
+      std::static_pointer_cast<Int64Array>(Int64(size, 0, unique - 1, null_probability));
+
+  StringBuilder builder;
+  for (int64_t i = 0; i < size; ++i) {
+    if (indices->IsValid(i)) {
+      ABORT_NOT_OK(builder.Append(dictionary->GetView(indices->Value(i))));
+    } else {
+      ABORT_NOT_OK(builder.AppendNull());
+    }
+  }
+  std::shared_ptr<Array> result;
+  ABORT_NOT_OK(builder.Finish(&result));
+  return result;
+}
+
+std::shared_ptr<Array> RandomArrayGenerator::DictionaryStringWithPrefixes(
+    int64_t size, int64_t unique, int64_t num_prefixes, int32_t prefix_length,
+    int32_t min_suffix_length, int32_t max_suffix_length, double null_probability) {
+  auto dictionary = GeneratePrefixedStrings(this, unique, num_prefixes, prefix_length,
+                                            min_suffix_length, max_suffix_length);
+  auto indices = Int32(size, 0, static_cast<int32_t>(unique - 1), null_probability);
+  return *DictionaryArray::FromArrays(indices, dictionary);
+}
+
+std::shared_ptr<Array> RandomArrayGenerator::SkewedList(
+    std::shared_ptr<DataType> value_type, int64_t size, int32_t max_length,
+    double exponent, double null_probability) {
+  int64_t null_count = 0;
+  auto null_bitmap = NullBitmap(size, null_probability);
+  std::shared_ptr<Buffer> offsets = *AllocateBuffer(sizeof(int32_t) * (size + 1));
+  auto raw_offsets = reinterpret_cast<int32_t*>(offsets->mutable_data());
+
+  std::default_random_engine rng(seed());
+  ZipfDistribution length_dist(max_length + 1, exponent);
+  raw_offsets[0] = 0;
+  for (int64_t i = 0; i < size; ++i) {
+    int32_t length = 0;
+    if (BitUtil::GetBit(null_bitmap->data(), i)) {
+      length = static_cast<int32_t>(length_dist(rng));
+    } else {
+      ++null_count;
+    }
+    raw_offsets[i + 1] = raw_offsets[i] + length;
+  }
+
+  auto values = ArrayOf(value_type, raw_offsets[size], null_probability);
+  return std::make_shared<ListArray>(list(std::move(value_type)), size,
+                                     std::move(offsets), std::move(values),
+                                     std::move(null_bitmap), null_count);
+}
+
+namespace {
+
 struct RandomArrayGeneratorOfImpl {
   Status Visit(const NullType&) {
     out_ = std::make_shared<NullArray>(size_);
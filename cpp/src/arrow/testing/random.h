@@ -294,6 +294,102 @@ class ARROW_TESTING_EXPORT RandomArrayGenerator {
   std::shared_ptr<Array> List(const Array& values, int64_t size, double null_probability,
                               bool force_empty_nulls = false);
 
+  /// \brief Generate a random Int64Array of Zipf-distributed keys
+  ///
+  /// Keys are drawn from [0, num_unique), key k with a probability proportional
+  /// to 1 / (k + 1)^exponent: a few keys are very frequent, most are rare.
+  ///
+  /// \param[in] size the size of the array to generate
+  /// \param[in] num_unique the number of distinct keys
+  /// \param[in] exponent the skew of the distribution (0 is uniform)
+  /// \param[in] null_probability the probability of a row being null
+  ///
+  /// \return a generated Array
+  std::shared_ptr<Array> ZipfInt64(int64_t size, int64_t num_unique, double exponent,
+                                   double null_probability = 0);
+
+  /// \brief Generate a random Int64Array made of sorted runs
+  ///
+  /// The array is split into num_runs runs of nearly equal length, each sorted in
+  /// ascending order.  Each value is then swapped with a random other one with
+  /// probability disorder, so that the runs are only nearly sorted.
+  ///
+  /// \param[in] size the size of the array to generate
+  /// \param[in] min the lower bound of the values
+  /// \param[in] max the upper bound of the values
+  /// \param[in] num_runs the number of sorted runs (1 for a sorted array)
+  /// \param[in] disorder the probability of a value being swapped
+  /// \param[in] null_probability the probability of a row being null
+  ///
+  /// \return a generated Array
+  std::shared_ptr<Array> SortedRunsInt64(int64_t size, int64_t min, int64_t max,
+                                         int64_t num_runs, double disorder = 0,
+                                         double null_probability = 0);
+
+  /// \brief Generate a null bitmap where the nulls come in runs
+  ///
+  /// Runs of nulls and of valid values alternate, with geometrically distributed
+  /// lengths, like the missing values of a sensor which goes offline.
+  ///
+  /// \param[in] size the size of the bitmap to generate
+  /// \param[in] null_probability the expected proportion of zero bits
+  /// \param[in] mean_null_run_length the mean length of a run of zero bits
+  /// \param[out] null_count the number of zero bits, if not null
+  ///
+  /// \return a generated Buffer
+  std::shared_ptr<Buffer> ClusteredNullBitmap(int64_t size, double null_probability,
+                                              double mean_null_run_length,
+                                              int64_t* null_count = NULLPTR);
+
+  /// \brief Return a copy of an array with nulls replaced by clustered nulls
+  ///
+  /// The array must have a validity bitmap in its layout (e.g. not a union).
+  /// See ClusteredNullBitmap() for the parameters.
+  std::shared_ptr<Array> WithClusteredNulls(const Array& array, double null_probability,
+                                            double mean_null_run_length);
+
+  /// \brief Generate a random StringArray of values sharing prefixes
+  ///
+  /// The values are drawn from `unique` strings, each made of one of
+  /// num_prefixes prefixes followed by a random suffix, like URLs or file paths.
+  ///
+  /// \param[in] size the size of the array to generate
+  /// \param[in] unique the number of unique string values
+  /// \param[in] num_prefixes the number of distinct prefixes
+  /// \param[in] prefix_length the length of the prefixes
+  /// \param[in] min_suffix_length the lower bound of the suffix length
+  /// \param[in] max_suffix_length the upper bound of the suffix length
+  /// \param[in] null_probability the probability of a row being null
+  ///
+  /// \return a generated Array
+  std::shared_ptr<Array> StringWithPrefixes(int64_t size, int64_t unique,
+                                            int64_t num_prefixes, int32_t prefix_length,
+                                            int32_t min_suffix_length,
+                                            int32_t max_suffix_length,
+                                            double null_probability = 0);
+
+  /// \brief Like StringWithPrefixes, but dictionary-encoded with int32 indices
+  std::shared_ptr<Array> DictionaryStringWithPrefixes(
+      int64_t size, int64_t unique, int64_t num_prefixes, int32_t prefix_length,
+      int32_t min_suffix_length, int32_t max_suffix_length, double null_probability = 0);
+
+  /// \brief Generate a random ListArray with skewed list lengths
+  ///
+  /// The list lengths follow a Zipf distribution over [0, max_length] (see
+  /// ZipfInt64), so that most lists are short and a few are very long.  The
+  /// child values are generated by ArrayOf().
+  ///
+  /// \param[in] value_type the type of the list values
+  /// \param[in] size the size of the array to generate
+  /// \param[in] max_length the upper bound of the list lengths
+  /// \param[in] exponent the skew of the lengths
+  /// \param[in] null_probability the probability of a list or a value being null
+  ///
+  /// \return a generated Array
+  std::shared_ptr<Array> SkewedList(std::shared_ptr<DataType> value_type, int64_t size,
+                                    int32_t max_length, double exponent,
+                                    double null_probability = 0);
+
   /// \brief Generate a random Array of the specified type, size, and null_probability.
   ///
   /// Generation parameters other than size and null_probability are determined based on
@@ -0,0 +1,147 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/aho_corasick.h"
+
+#include <algorithm>
+#include <deque>
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+uint8_t FoldAsciiCase(uint8_t byte) {
+  return (byte >= 'A' && byte <= 'Z') ? static_cast<uint8_t>(byte + 32) : byte;
+}
+
+}  // namespace
+
+AhoCorasick::AhoCorasick(const std::vector<std::string>& patterns,
+                         bool ascii_case_insensitive)
+    : num_patterns_(static_cast<int>(patterns.size())) {
+  auto fold = [&](uint8_t byte) {
+    return ascii_case_insensitive ? FoldAsciiCase(byte) : byte;
+  };
+
+  // Assign a class to each distinct (folded) byte of the patterns. Class 0 is
+  // shared by all other bytes.
+  uint16_t folded_classes[256] = {};
+  num_classes_ = 1;
+  for (const auto& pattern : patterns) {
+    for (char c : pattern) {
+      const uint8_t folded = fold(static_cast<uint8_t>(c));
+      if (folded_classes[folded] == 0) {
+        folded_classes[folded] = static_cast<uint16_t>(num_classes_++);
+      }
+    }
+  }
+  for (int byte = 0; byte < 256; ++byte) {
+    byte_classes_[byte] = folded_classes[fold(static_cast<uint8_t>(byte))];
+  }
+
+  // Build the trie of the patterns, with -1 for missing transitions
+  std::vector<int32_t> next(num_classes_, -1);
+  std::vector<std::vector<int>> state_patterns(1);
+  for (int i = 0; i < num_patterns_; ++i) {
+    int32_t state = 0;
+    for (char c : patterns[i]) {
+      const int32_t index = state * num_classes_ + byte_classes_[static_cast<uint8_t>(c)];
+      if (next[index] < 0) {
+        next[index] = static_cast<int32_t>(state_patterns.size());
+        state_patterns.emplace_back();
+        next.resize(next.size() + num_classes_, -1);
+      }
+      state = next[index];
+    }
+    state_patterns[state].push_back(i);
+  }
+  const auto num_states = static_cast<int32_t>(state_patterns.size());
+
+  // Complete the transitions in breadth-first order, following the failure
+  // link (the state of the longest proper suffix in the trie) of each state.
+  // A state also matches the patterns of its failure link.
+  std::vector<int32_t> failure(num_states, 0);
+  std::deque<int32_t> queue;
+  for (int32_t cls = 0; cls < num_classes_; ++cls) {
+    if (next[cls] < 0) {
+      next[cls] = 0;
+    } else {
+      queue.push_back(next[cls]);
+    }
+  }
+  while (!queue.empty()) {
+    const int32_t state = queue.front();
+    queue.pop_front();
+    const int32_t fail = failure[state];
+    auto& matches = state_patterns[state];
+    matches.insert(matches.end(), state_patterns[fail].begin(),
+                   state_patterns[fail].end());
+    for (int32_t cls = 0; cls < num_classes_; ++cls) {
+      const int32_t index = state * num_classes_ + cls;
+      const int32_t fail_next = next[fail * num_classes_ + cls];
+      if (next[index] < 0) {
+        next[index] = fail_next;
+      } else {
+        failure[next[index]] = fail_next;
+        queue.push_back(next[index]);
+      }
+    }
+  }
+
+  root_matches_ = !state_patterns[0].empty();
+  match_offsets_.resize(num_states + 1);
+  for (int32_t state = 0; state < num_states; ++state) {
+    auto& matches = state_patterns[state];
+    std::sort(matches.begin(), matches.end());
+    match_offsets_[state] = static_cast<int32_t>(match_patterns_.size());
+    match_patterns_.insert(match_patterns_.end(), matches.begin(), matches.end());
+  }
+  match_offsets_[num_states] = static_cast<int32_t>(match_patterns_.size());
+
+  transitions_.resize(next.size());
+  for (size_t i = 0; i < next.size(); ++i) {
+    const int32_t row = next[i] * num_classes_;
+    transitions_[i] = state_patterns[next[i]].empty() ? row : -row - 1;
+  }
+}
+
+void AhoCorasick::FindAll(util::string_view text, std::vector<int>* out) const {
+  const auto out_start = static_cast<std::ptrdiff_t>(out->size());
+  auto add_matches = [&](int32_t row) {
+    const int32_t state = row / num_classes_;
+    out->insert(out->end(), match_patterns_.begin() + match_offsets_[state],
+                match_patterns_.begin() + match_offsets_[state + 1]);
+  };
+
+  if (root_matches_) {
+    add_matches(0);
+  }
+  int32_t row = 0;
+  for (char c : text) {
+    const int32_t transition = transitions_[row + byte_classes_[static_cast<uint8_t>(c)]];
+    row = RowOf(transition);
+    if (transition < 0) {
+      add_matches(row);
+    }
+  }
+  std::sort(out->begin() + out_start, out->end());
+  out->erase(std::unique(out->begin() + out_start, out->end()), out->end());
+}
+
+}  // namespace internal
+}  // namespace arrow
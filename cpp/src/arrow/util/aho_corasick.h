@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "arrow/util/macros.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief An Aho-Corasick automaton searching for a set of literal patterns
+///
+/// The automaton is compiled to a deterministic transition table over byte
+/// classes (the bytes not occurring in any pattern share a class), so that
+/// searching does a single table lookup per input byte regardless of the
+/// number of patterns.
+class ARROW_EXPORT AhoCorasick {
+ public:
+  /// \brief Compile an automaton for the given patterns
+  ///
+  /// If ascii_case_insensitive is true, ASCII letters match regardless of
+  /// their case.
+  explicit AhoCorasick(const std::vector<std::string>& patterns,
+                       bool ascii_case_insensitive = false);
+
+  /// \brief Whether the text contains any of the patterns
+  bool Contains(const uint8_t* data, int64_t length) const {
+    if (root_matches_) {
+      return true;
+    }
+    int32_t row = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      row = transitions_[row + byte_classes_[data[i]]];
+      if (ARROW_PREDICT_FALSE(row < 0)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool Contains(util::string_view text) const {
+    return Contains(reinterpret_cast<const uint8_t*>(text.data()),
+                    static_cast<int64_t>(text.size()));
+  }
+
+  /// \brief Find the patterns occurring in the text
+  ///
+  /// The indices of the patterns found are appended to `out` in increasing
+  /// order, each at most once.
+  void FindAll(util::string_view text, std::vector<int>* out) const;
+
+  int num_patterns() const { return num_patterns_; }
+
+  int num_states() const { return static_cast<int>(transitions_.size() / num_classes_); }
+
+ private:
+  // Transitions are stored as the row offset of the next state in
+  // transitions_, negated minus one if the next state matches a pattern.
+  static int32_t RowOf(int32_t transition) {
+    return transition < 0 ? -transition - 1 : transition;
+  }
+
+  int num_patterns_;
+  int32_t num_classes_;
+  bool root_matches_;
+  uint16_t byte_classes_[256];
+  std::vector<int32_t> transitions_;
+  // The patterns matched in each state, as ranges of match_patterns_
+  std::vector<int32_t> match_offsets_;
+  std::vector<int> match_patterns_;
+};
+
+}  // namespace internal
+}  // namespace arrow
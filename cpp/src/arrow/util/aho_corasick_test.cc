@@ -0,0 +1,135 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cctype>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/util/aho_corasick.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+std::string Lower(std::string s) {
+  std::transform(s.begin(), s.end(), s.begin(),
+                 [](char c) { return static_cast<char>(std::tolower(c)); });
+  return s;
+}
+
+std::vector<int> NaiveFindAll(const std::vector<std::string>& patterns,
+                              const std::string& text, bool ignore_case) {
+  std::vector<int> found;
+  for (size_t i = 0; i < patterns.size(); ++i) {
+    if (ignore_case ? Lower(text).find(Lower(patterns[i])) != std::string::npos
+                    : text.find(patterns[i]) != std::string::npos) {
+      found.push_back(static_cast<int>(i));
+    }
+  }
+  return found;
+}
+
+void CheckMatches(const std::vector<std::string>& patterns,
+                  const std::vector<std::string>& texts, bool ignore_case = false) {
+  AhoCorasick matcher(patterns, ignore_case);
+  ASSERT_EQ(static_cast<int>(patterns.size()), matcher.num_patterns());
+  for (const auto& text : texts) {
+    SCOPED_TRACE(text);
+    auto expected = NaiveFindAll(patterns, text, ignore_case);
+    std::vector<int> actual;
+    matcher.FindAll(text, &actual);
+    ASSERT_EQ(expected, actual);
+    ASSERT_EQ(!expected.empty(), matcher.Contains(text));
+  }
+}
+
+}  // namespace
+
+TEST(AhoCorasick, Basics) {
+  CheckMatches({"he", "she", "his", "hers"},
+               {"", "h", "he", "ushers", "his", "hi", "sh", "shis", "xhersx", "HE"});
+  CheckMatches({"abc"}, {"ab", "abc", "aabc", "ababc", "abababcab", "xyz"});
+  CheckMatches({"aaa", "aa", "a"}, {"", "b", "a", "ba", "aab", "aaaa"});
+}
+
+TEST(AhoCorasick, OverlappingPatterns) {
+  CheckMatches({"abcd", "bc", "cde", "e"}, {"abcx", "abce", "xbcx", "abcde", "d"});
+  CheckMatches({"ab", "ab"}, {"ab", "xaby", "ba"});
+}
+
+TEST(AhoCorasick, NoPatterns) {
+  AhoCorasick matcher({});
+  ASSERT_FALSE(matcher.Contains(""));
+  ASSERT_FALSE(matcher.Contains("abc"));
+  std::vector<int> found;
+  matcher.FindAll("abc", &found);
+  ASSERT_TRUE(found.empty());
+}
+
+TEST(AhoCorasick, EmptyPattern) {
+  CheckMatches({"", "b"}, {"", "a", "b", "ab"});
+}
+
+TEST(AhoCorasick, CaseInsensitive) {
+  CheckMatches({"Error", "WARN", "fail"},
+               {"error", "ERROR", "warning", "Failed", "ok", "WaRnInG", "eRrOr"},
+               /*ignore_case=*/true);
+  AhoCorasick matcher({"Error"});
+  ASSERT_FALSE(matcher.Contains("error"));
+  ASSERT_TRUE(matcher.Contains("an Error"));
+}
+
+TEST(AhoCorasick, BinaryData) {
+  std::string zero(1, '\0');
+  std::string high(1, '\xff');
+  CheckMatches({zero + "a", high, "b" + high + zero},
+               {zero, zero + "a", "x" + high, "b" + high + zero, "ab", ""});
+}
+
+TEST(AhoCorasick, Random) {
+  std::default_random_engine rng(42);
+  std::uniform_int_distribution<int> length_dist(1, 6);
+  // A small alphabet makes for many partial and overlapping matches
+  std::uniform_int_distribution<int> char_dist('a', 'd');
+  auto random_string = [&](int length) {
+    std::string s;
+    for (int i = 0; i < length; ++i) {
+      s.push_back(static_cast<char>(char_dist(rng)));
+    }
+    return s;
+  };
+
+  for (int iteration = 0; iteration < 20; ++iteration) {
+    std::vector<std::string> patterns;
+    for (int i = 0; i < 30; ++i) {
+      patterns.push_back(random_string(length_dist(rng)));
+    }
+    std::vector<std::string> texts;
+    for (int i = 0; i < 50; ++i) {
+      texts.push_back(random_string(length_dist(rng) * 3));
+    }
+    CheckMatches(patterns, texts);
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,163 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/functional.h"
+#include "arrow/util/future.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+/// \brief EXPERIMENTAL The asynchronous counterpart of an Iterator.
+///
+/// Each call returns a Future for the next element of the sequence, which is
+/// IterationTraits<T>::End() once the sequence is exhausted.  A generator
+/// should not be called again before the Future of the previous call is
+/// finished.
+template <typename T>
+using AsyncGenerator = std::function<Future<T>()>;
+
+/// \brief Return a generator yielding the elements of a vector, then End().
+template <typename T>
+AsyncGenerator<T> MakeVectorGenerator(std::vector<T> vec) {
+  auto state = std::make_shared<std::pair<std::vector<T>, size_t>>(std::move(vec), 0);
+  return [state]() {
+    if (state->second == state->first.size()) {
+      return Future<T>::MakeFinished(IterationTraits<T>::End());
+    }
+    return Future<T>::MakeFinished(state->first[state->second++]);
+  };
+}
+
+/// \brief Return a generator applying a function to each element of another.
+///
+/// The function can return a `To` or a `Result<To>`.  It is run by the thread
+/// finishing the source Future, so it should be quick; transfer the source to
+/// an executor otherwise.
+template <typename Fn,
+          typename From = typename std::decay<
+              internal::call_traits::argument_type<0, Fn>>::type,
+          typename To = typename detail::ContinuedFuture<
+              internal::call_traits::return_type<Fn>>::type::ValueType>
+AsyncGenerator<To> MakeMappedGenerator(AsyncGenerator<From> source, Fn map) {
+  return [source, map]() {
+    return source().Then([map](const From& value) -> Result<To> {
+      if (value == IterationTraits<From>::End()) {
+        return IterationTraits<To>::End();
+      }
+      return map(value);
+    });
+  };
+}
+
+/// \brief Return a generator whose Futures are finished from tasks of an
+/// executor, so that the consumer's continuations run on the executor.
+template <typename T>
+AsyncGenerator<T> MakeTransferredGenerator(AsyncGenerator<T> source,
+                                           internal::Executor* executor) {
+  return [source, executor]() { return executor->Transfer(source()); };
+}
+
+namespace detail {
+
+template <typename T, typename Visitor>
+struct VisitAsyncGeneratorLoop {
+  struct State {
+    State(AsyncGenerator<T> generator, Visitor visitor)
+        : generator(std::move(generator)), visitor(std::move(visitor)) {}
+
+    AsyncGenerator<T> generator;
+    Visitor visitor;
+    Future<Status> done = Future<Status>::Make();
+  };
+
+  // Visit the elements that are already available in a loop, rather than in
+  // nested callbacks, so that the stack doesn't grow with the sequence.
+  static void Run(const std::shared_ptr<State>& state) {
+    while (true) {
+      Future<T> next = state->generator();
+      if (!IsFutureFinished(next.state())) {
+        next.AddCallback([state](const Result<T>& result) {
+          if (Visit(state.get(), result)) {
+            Run(state);
+          }
+        });
+        return;
+      }
+      if (!Visit(state.get(), next.result())) {
+        return;
+      }
+    }
+  }
+
+  // Return whether more elements should be visited
+  static bool Visit(State* state, const Result<T>& result) {
+    if (!result.ok()) {
+      state->done.MarkFinished(result.status());
+      return false;
+    }
+    if (*result == IterationTraits<T>::End()) {
+      state->done.MarkFinished(Status::OK());
+      return false;
+    }
+    Status st = state->visitor(*result);
+    if (!st.ok()) {
+      state->done.MarkFinished(std::move(st));
+      return false;
+    }
+    return true;
+  }
+};
+
+}  // namespace detail
+
+/// \brief Pass each element of a generator to a visitor.
+///
+/// The returned Future is finished once the generator is exhausted, or with
+/// the first error of the generator or the visitor.
+template <typename T, typename Visitor>
+Future<Status> VisitAsyncGenerator(AsyncGenerator<T> generator, Visitor visitor) {
+  using Loop = detail::VisitAsyncGeneratorLoop<T, Visitor>;
+  auto state =
+      std::make_shared<typename Loop::State>(std::move(generator), std::move(visitor));
+  Future<Status> done = state->done;
+  Loop::Run(state);
+  return done;
+}
+
+/// \brief Return a Future finished with all the elements of a generator.
+template <typename T>
+Future<std::vector<T>> CollectAsyncGenerator(AsyncGenerator<T> generator) {
+  auto elements = std::make_shared<std::vector<T>>();
+  auto visited = VisitAsyncGenerator(std::move(generator), [elements](const T& value) {
+    elements->push_back(value);
+    return Status::OK();
+  });
+  return visited.Then([elements]() { return std::move(*elements); });
+}
+
+}  // namespace arrow
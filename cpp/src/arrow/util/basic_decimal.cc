@@ -121,7 +121,16 @@ static const BasicDecimal128 ScaleMultipliersHalf[] = {
     BasicDecimal128(2710505431213761085LL, 343699775700336640ULL)};
 
 #ifdef ARROW_USE_NATIVE_INT128
-static constexpr uint64_t kInt64Mask = 0xFFFFFFFFFFFFFFFF;
+// The two's complement bits of a value as a native 128-bit integer
+static inline __uint128_t ToUint128(const BasicDecimal128& value) {
+  return (static_cast<__uint128_t>(static_cast<uint64_t>(value.high_bits())) << 64) |
+         value.low_bits();
+}
+
+static inline BasicDecimal128 FromUint128(__uint128_t value) {
+  return BasicDecimal128(static_cast<int64_t>(static_cast<uint64_t>(value >> 64)),
+                         static_cast<uint64_t>(value));
+}
 #else
 static constexpr uint64_t kIntMask = 0xFFFFFFFF;
 #endif
@@ -252,18 +261,12 @@ BasicDecimal128& BasicDecimal128::operator>>=(uint32_t bits) {
   return *this;
 }
 
+#ifndef ARROW_USE_NATIVE_INT128
 namespace {
 
-// TODO: Remove this guard once it's used by BasicDecimal256
-#ifndef ARROW_USE_NATIVE_INT128
 // This method losslessly multiplies x and y into a 128 bit unsigned integer
 // whose high bits will be stored in hi and low bits in lo.
 void ExtendAndMultiplyUint64(uint64_t x, uint64_t y, uint64_t* hi, uint64_t* lo) {
-#ifdef ARROW_USE_NATIVE_INT128
-  const __uint128_t r = static_cast<__uint128_t>(x) * y;
-  *lo = r & kInt64Mask;
-  *hi = r >> 64;
-#else
   // If we can't use a native fallback, perform multiplication
   // by splitting up x and y into 32 bit high/low bit components,
   // allowing us to represent the multiplication as
@@ -294,19 +297,10 @@ void ExtendAndMultiplyUint64(uint64_t x, uint64_t y, uint64_t* hi, uint64_t* lo)
 
   *hi = x_hi * y_hi + u_hi + v_hi;
   *lo = (v << 32) | t_lo;
-#endif
 }
-#endif
 
 void MultiplyUint128(uint64_t x_hi, uint64_t x_lo, uint64_t y_hi, uint64_t y_lo,
                      uint64_t* hi, uint64_t* lo) {
-#ifdef ARROW_USE_NATIVE_INT128
-  const __uint128_t x = (static_cast<__uint128_t>(x_hi) << 64) | x_lo;
-  const __uint128_t y = (static_cast<__uint128_t>(y_hi) << 64) | y_lo;
-  const __uint128_t r = x * y;
-  *lo = r & kInt64Mask;
-  *hi = r >> 64;
-#else
   // To perform 128 bit multiplication without a native fallback
   // we first perform lossless 64 bit multiplication of the low
   // bits, and then add x_hi * y_lo and x_lo * y_hi to the high
@@ -314,12 +308,17 @@ void MultiplyUint128(uint64_t x_hi, uint64_t x_lo, uint64_t y_hi, uint64_t y_lo,
   // always will be over 128 bits.
   ExtendAndMultiplyUint64(x_lo, y_lo, hi, lo);
   *hi += (x_hi * y_lo) + (x_lo * y_hi);
-#endif
 }
 
 }  // namespace
+#endif
 
 BasicDecimal128& BasicDecimal128::operator*=(const BasicDecimal128& right) {
+#ifdef ARROW_USE_NATIVE_INT128
+  // Two's complement multiplication modulo 2^128 gives the same bits as
+  // multiplying the absolute values then fixing the sign
+  *this = FromUint128(ToUint128(*this) * ToUint128(right));
+#else
   // Since the max value of BasicDecimal128 is supposed to be 1e38 - 1 and the
   // min the negation taking the absolute values here should always be safe.
   const bool negate = Sign() != right.Sign();
@@ -332,9 +331,24 @@ BasicDecimal128& BasicDecimal128::operator*=(const BasicDecimal128& right) {
   if (negate) {
     Negate();
   }
+#endif
   return *this;
 }
 
+/// \brief Fix the signs of the result and remainder at the end of the division based on
+/// the signs of the dividend and divisor.
+static void FixDivisionSigns(BasicDecimal128* result, BasicDecimal128* remainder,
+                             bool dividend_was_negative, bool divisor_was_negative) {
+  if (dividend_was_negative != divisor_was_negative) {
+    result->Negate();
+  }
+
+  if (dividend_was_negative) {
+    remainder->Negate();
+  }
+}
+
+#ifndef ARROW_USE_NATIVE_INT128
 /// Expands the given value into an array of ints so that we can work on
 /// it. The array will be converted to an absolute value and the wasNegative
 /// flag will be set appropriately. The array will remove leading zeros from
@@ -417,19 +431,6 @@ static void ShiftArrayRight(uint32_t* array, int64_t length, int64_t bits) {
   }
 }
 
-/// \brief Fix the signs of the result and remainder at the end of the division based on
-/// the signs of the dividend and divisor.
-static void FixDivisionSigns(BasicDecimal128* result, BasicDecimal128* remainder,
-                             bool dividend_was_negative, bool divisor_was_negative) {
-  if (dividend_was_negative != divisor_was_negative) {
-    result->Negate();
-  }
-
-  if (dividend_was_negative) {
-    remainder->Negate();
-  }
-}
-
 /// \brief Build a BasicDecimal128 from a list of ints.
 static DecimalStatus BuildFromArray(BasicDecimal128* value, uint32_t* array,
                                     int64_t length) {
@@ -488,10 +489,29 @@ static DecimalStatus SingleDivide(const uint32_t* dividend, int64_t dividend_len
   FixDivisionSigns(result, remainder, dividend_was_negative, divisor_was_negative);
   return DecimalStatus::kSuccess;
 }
+#endif
 
 DecimalStatus BasicDecimal128::Divide(const BasicDecimal128& divisor,
                                       BasicDecimal128* result,
                                       BasicDecimal128* remainder) const {
+#ifdef ARROW_USE_NATIVE_INT128
+  if (divisor.high_bits() == 0 && divisor.low_bits() == 0) {
+    return DecimalStatus::kDivideByZero;
+  }
+  // Divide the absolute values, so that the quotient truncates towards zero
+  // like the portable long division below
+  const bool dividend_was_negative = high_bits_ < 0;
+  const bool divisor_was_negative = divisor.high_bits() < 0;
+  __uint128_t abs_dividend = ToUint128(*this);
+  __uint128_t abs_divisor = ToUint128(divisor);
+  if (dividend_was_negative) abs_dividend = -abs_dividend;
+  if (divisor_was_negative) abs_divisor = -abs_divisor;
+
+  *result = FromUint128(abs_dividend / abs_divisor);
+  *remainder = FromUint128(abs_dividend % abs_divisor);
+  FixDivisionSigns(result, remainder, dividend_was_negative, divisor_was_negative);
+  return DecimalStatus::kSuccess;
+#else
   // Split the dividend and divisor into integer pieces so that we can
   // work on them.
   uint32_t dividend_array[5];
@@ -599,6 +619,7 @@ DecimalStatus BasicDecimal128::Divide(const BasicDecimal128& divisor,
 
   FixDivisionSigns(result, remainder, dividend_was_negative, divisor_was_negative);
   return DecimalStatus::kSuccess;
+#endif
 }
 
 bool operator==(const BasicDecimal128& left, const BasicDecimal128& right) {
@@ -676,6 +697,13 @@ static bool RescaleWouldCauseDataLoss(const BasicDecimal128& value, int32_t delt
 
   if (delta_scale < 0) {
     DCHECK_NE(multiplier, 0);
+    const auto low_bits = static_cast<int64_t>(value.low_bits());
+    if (abs_delta_scale <= 18 && value.high_bits() == (low_bits < 0 ? -1 : 0)) {
+      // The value fits in 64 bits, a machine division is enough
+      const auto divisor = static_cast<int64_t>(multiplier.low_bits());
+      *result = BasicDecimal128(low_bits / divisor);
+      return low_bits % divisor != 0;
+    }
     BasicDecimal128 remainder;
     auto status = value.Divide(multiplier, result, &remainder);
     DCHECK_EQ(status, DecimalStatus::kSuccess);
@@ -0,0 +1,121 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/string_view.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief A 16-byte view of a binary or string value
+///
+/// The view holds the size of the value and its first 4 bytes; values of at
+/// most 12 bytes are stored inline, longer values are referenced by pointer.
+/// Comparing two views mostly resolves on their prefixes, without touching
+/// the character data, which makes sorting and comparing binary values much
+/// more cache friendly than chasing offsets then bytes.
+///
+/// The view doesn't own the data it points to.
+class BinaryView {
+ public:
+  static constexpr uint32_t kInlineSize = 12;
+  static constexpr uint32_t kPrefixSize = 4;
+
+  BinaryView() : BinaryView(util::string_view()) {}
+
+  explicit BinaryView(util::string_view value)
+      : size_(static_cast<uint32_t>(value.size())) {
+    std::memset(bytes_, 0, sizeof(bytes_));
+    if (is_inline()) {
+      if (size_ > 0) {
+        std::memcpy(bytes_, value.data(), size_);
+      }
+    } else {
+      const char* data = value.data();
+      std::memcpy(bytes_, data, kPrefixSize);
+      std::memcpy(bytes_ + kPrefixSize, &data, sizeof(data));
+    }
+  }
+
+  uint32_t size() const { return size_; }
+
+  bool is_inline() const { return size_ <= kInlineSize; }
+
+  const char* data() const {
+    if (is_inline()) {
+      return bytes_;
+    }
+    const char* data;
+    std::memcpy(&data, bytes_ + kPrefixSize, sizeof(data));
+    return data;
+  }
+
+  util::string_view value() const { return util::string_view(data(), size_); }
+
+  /// \brief Three-way lexicographic comparison of the bytes of two views
+  int Compare(const BinaryView& other) const {
+    const uint32_t left = PrefixKey(), right = other.PrefixKey();
+    if (left != right) {
+      return left < right ? -1 : 1;
+    }
+    // Equal prefixes: compare the remaining bytes.  The zero padding of
+    // prefixes shorter than 4 bytes is harmless as sizes break ties.
+    const uint32_t min_size = std::min(size_, other.size_);
+    if (min_size > kPrefixSize) {
+      const int compared = std::memcmp(data() + kPrefixSize, other.data() + kPrefixSize,
+                                       min_size - kPrefixSize);
+      if (compared != 0) {
+        return compared;
+      }
+    }
+    return size_ == other.size_ ? 0 : (size_ < other.size_ ? -1 : 1);
+  }
+
+  bool operator==(const BinaryView& other) const {
+    if (size_ != other.size_ || std::memcmp(bytes_, other.bytes_, kPrefixSize) != 0) {
+      return false;
+    }
+    return size_ <= kPrefixSize ||
+           std::memcmp(data() + kPrefixSize, other.data() + kPrefixSize,
+                       size_ - kPrefixSize) == 0;
+  }
+  bool operator!=(const BinaryView& other) const { return !(*this == other); }
+  bool operator<(const BinaryView& other) const { return Compare(other) < 0; }
+
+ private:
+  // The prefix as an integer ordered like its bytes
+  uint32_t PrefixKey() const {
+    uint32_t key;
+    std::memcpy(&key, bytes_, sizeof(key));
+    return BitUtil::FromBigEndian(key);
+  }
+
+  uint32_t size_;
+  // The inline value, or the prefix followed by the (unaligned) data pointer
+  char bytes_[kInlineSize];
+};
+
+static_assert(sizeof(BinaryView) == 16, "BinaryView should be 16 bytes");
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/util/binary_view.h"
+#include "arrow/util/string_view.h"
+
+namespace arrow {
+namespace internal {
+
+TEST(BinaryView, Basics) {
+  for (const std::string value :
+       {std::string(), std::string("abc"), std::string("abcdefghijkl"),
+        std::string("abcdefghijklm"), std::string("\0\0\0\0xyz", 7)}) {
+    SCOPED_TRACE(value);
+    BinaryView view(value);
+    ASSERT_EQ(view.size(), value.size());
+    ASSERT_EQ(view.is_inline(), value.size() <= BinaryView::kInlineSize);
+    ASSERT_EQ(view.value(), value);
+    if (!view.is_inline()) {
+      // Long values are referenced, not copied
+      ASSERT_EQ(view.data(), value.data());
+    }
+  }
+  ASSERT_EQ(BinaryView().size(), 0);
+}
+
+TEST(BinaryView, Compare) {
+  // Pairwise comparisons agree with those of the values
+  const std::vector<std::string> values = {
+      "",      "a",     "ab",           "abc",           "abd",
+      "abcd",  "abce",  "abcdefghijkl", "abcdefghijklm", "abcdefghijklmn",
+      "abcdz", "\xff",  "a\xff",        "abcd\xff",      "abcdefghijklm\xff",
+      "b",     "\x01",  std::string("a\0", 2),           std::string("abcd\0", 5)};
+  for (const auto& left : values) {
+    for (const auto& right : values) {
+      SCOPED_TRACE(left + " vs " + right);
+      const BinaryView left_view(left), right_view(right);
+      const int expected = util::string_view(left).compare(util::string_view(right));
+      const int actual = left_view.Compare(right_view);
+      ASSERT_EQ(actual < 0, expected < 0);
+      ASSERT_EQ(actual == 0, expected == 0);
+      ASSERT_EQ(left_view == right_view, left == right);
+      ASSERT_EQ(left_view != right_view, left != right);
+      ASSERT_EQ(left_view < right_view, left < right);
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -23,6 +23,7 @@
 #include <limits>
 #include <memory>
 #include <ostream>
+#include <random>
 #include <string>
 #include <utility>
 #include <vector>
@@ -1115,6 +1116,33 @@ TEST(BitUtilTests, TestCountSetBits) {
   }
 }
 
+TEST(BitUtilTests, TestCountAndSetBits) {
+  const int kBufferSize = 1000;
+  alignas(8) uint8_t left[kBufferSize] = {0};
+  alignas(8) uint8_t right[kBufferSize] = {0};
+  const int buffer_bits = kBufferSize * 8;
+
+  random_bytes(kBufferSize, 0, left);
+  random_bytes(kBufferSize, 1, right);
+
+  const int64_t num_bits = buffer_bits - 101;
+  const std::vector<int64_t> offsets = {0, 3, 12, 63, 64, 128, num_bits - 30};
+  for (const int64_t left_offset : offsets) {
+    for (const int64_t right_offset : offsets) {
+      const int64_t length = num_bits - std::max(left_offset, right_offset);
+      int64_t expected = 0;
+      for (int64_t i = 0; i < length; ++i) {
+        if (BitUtil::GetBit(left, left_offset + i) &&
+            BitUtil::GetBit(right, right_offset + i)) {
+          ++expected;
+        }
+      }
+      ASSERT_EQ(expected, internal::CountAndSetBits(left, left_offset, right,
+                                                    right_offset, length));
+    }
+  }
+}
+
 TEST(BitUtilTests, TestSetBitsTo) {
   using BitUtil::SetBitsTo;
   for (const auto fill_byte_int : {0x00, 0xff}) {
@@ -1528,6 +1556,74 @@ TEST(BitStreamUtil, ZigZag) {
   TestZigZag(-std::numeric_limits<int32_t>::max());
 }
 
+static void TestZigZag64(int64_t v) {
+  uint8_t buffer[BitUtil::BitReader::kMaxVlqByteLengthForInt64] = {};
+  BitUtil::BitWriter writer(buffer, sizeof(buffer));
+  BitUtil::BitReader reader(buffer, sizeof(buffer));
+  writer.PutZigZagVlqInt(v);
+  int64_t result;
+  EXPECT_TRUE(reader.GetZigZagVlqInt(&result));
+  EXPECT_EQ(v, result);
+}
+
+TEST(BitStreamUtil, ZigZag64) {
+  TestZigZag64(0);
+  TestZigZag64(1);
+  TestZigZag64(1234);
+  TestZigZag64(-1);
+  TestZigZag64(-1234);
+  TestZigZag64(std::numeric_limits<int64_t>::max());
+  TestZigZag64(std::numeric_limits<int64_t>::min());
+}
+
+TEST(BitStreamUtil, WideValues) {
+  // Values of up to 64 bits, which straddle the 64-bit buffered word
+  const std::vector<int> bit_widths = {64, 33, 63, 1, 64, 40, 64};
+  uint8_t buffer[64] = {};
+  BitUtil::BitWriter writer(buffer, sizeof(buffer));
+  for (int num_bits : bit_widths) {
+    ASSERT_TRUE(writer.PutValue(BitUtil::TrailingBits(0xF0E1D2C3B4A59687ULL, num_bits),
+                                num_bits));
+  }
+  writer.Flush();
+
+  BitUtil::BitReader reader(buffer, sizeof(buffer));
+  for (int num_bits : bit_widths) {
+    uint64_t value;
+    ASSERT_TRUE(reader.GetValue(num_bits, &value));
+    EXPECT_EQ(BitUtil::TrailingBits(0xF0E1D2C3B4A59687ULL, num_bits), value);
+  }
+}
+
+TEST(BitStreamUtil, GetBatch64) {
+  // Batches of 32 values go through unpack64, from an aligned or unaligned start
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<uint64_t> dist;
+  const int num_values = 100;
+  std::vector<uint8_t> buffer(num_values * 8 + 8);
+  for (int num_bits = 0; num_bits <= 64; ++num_bits) {
+    for (int offset : {0, 1}) {
+      SCOPED_TRACE("num_bits = " + std::to_string(num_bits) +
+                   ", offset = " + std::to_string(offset));
+      std::vector<uint64_t> values(num_values);
+      BitUtil::BitWriter writer(buffer.data(), static_cast<int>(buffer.size()));
+      if (offset > 0) ASSERT_TRUE(writer.PutValue(1, offset));
+      for (auto& value : values) {
+        value = BitUtil::TrailingBits(dist(gen), num_bits);
+        ASSERT_TRUE(writer.PutValue(value, num_bits));
+      }
+      writer.Flush();
+
+      BitUtil::BitReader reader(buffer.data(), writer.bytes_written());
+      uint64_t skipped;
+      if (offset > 0) ASSERT_TRUE(reader.GetValue(offset, &skipped));
+      std::vector<uint64_t> decoded(num_values);
+      ASSERT_EQ(num_values, reader.GetBatch(num_bits, decoded.data(), num_values));
+      ASSERT_EQ(values, decoded);
+    }
+  }
+}
+
 TEST(BitUtil, RoundTripLittleEndianTest) {
   uint64_t value = 0xFF;
 
@@ -16,6 +16,7 @@
 // under the License.
 
 #include "arrow/util/bpacking.h"
+#include "arrow/util/bpacking64_default.h"
 #include "arrow/util/bpacking_default.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/dispatch.h"
@@ -144,6 +145,213 @@ int unpack32_default(const uint32_t* in, uint32_t* out, int batch_size, int num_
   return batch_size;
 }
 
+int unpack64_default(const uint8_t* in, uint64_t* out, int batch_size, int num_bits) {
+  batch_size = batch_size / 32 * 32;
+  int num_loops = batch_size / 32;
+
+  switch (num_bits) {
+    case 0:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<0>(in, out + i * 32);
+      break;
+    case 1:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<1>(in, out + i * 32);
+      break;
+    case 2:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<2>(in, out + i * 32);
+      break;
+    case 3:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<3>(in, out + i * 32);
+      break;
+    case 4:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<4>(in, out + i * 32);
+      break;
+    case 5:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<5>(in, out + i * 32);
+      break;
+    case 6:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<6>(in, out + i * 32);
+      break;
+    case 7:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<7>(in, out + i * 32);
+      break;
+    case 8:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<8>(in, out + i * 32);
+      break;
+    case 9:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<9>(in, out + i * 32);
+      break;
+    case 10:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<10>(in, out + i * 32);
+      break;
+    case 11:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<11>(in, out + i * 32);
+      break;
+    case 12:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<12>(in, out + i * 32);
+      break;
+    case 13:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<13>(in, out + i * 32);
+      break;
+    case 14:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<14>(in, out + i * 32);
+      break;
+    case 15:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<15>(in, out + i * 32);
+      break;
+    case 16:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<16>(in, out + i * 32);
+      break;
+    case 17:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<17>(in, out + i * 32);
+      break;
+    case 18:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<18>(in, out + i * 32);
+      break;
+    case 19:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<19>(in, out + i * 32);
+      break;
+    case 20:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<20>(in, out + i * 32);
+      break;
+    case 21:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<21>(in, out + i * 32);
+      break;
+    case 22:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<22>(in, out + i * 32);
+      break;
+    case 23:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<23>(in, out + i * 32);
+      break;
+    case 24:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<24>(in, out + i * 32);
+      break;
+    case 25:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<25>(in, out + i * 32);
+      break;
+    case 26:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<26>(in, out + i * 32);
+      break;
+    case 27:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<27>(in, out + i * 32);
+      break;
+    case 28:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<28>(in, out + i * 32);
+      break;
+    case 29:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<29>(in, out + i * 32);
+      break;
+    case 30:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<30>(in, out + i * 32);
+      break;
+    case 31:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<31>(in, out + i * 32);
+      break;
+    case 32:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<32>(in, out + i * 32);
+      break;
+    case 33:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<33>(in, out + i * 32);
+      break;
+    case 34:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<34>(in, out + i * 32);
+      break;
+    case 35:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<35>(in, out + i * 32);
+      break;
+    case 36:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<36>(in, out + i * 32);
+      break;
+    case 37:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<37>(in, out + i * 32);
+      break;
+    case 38:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<38>(in, out + i * 32);
+      break;
+    case 39:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<39>(in, out + i * 32);
+      break;
+    case 40:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<40>(in, out + i * 32);
+      break;
+    case 41:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<41>(in, out + i * 32);
+      break;
+    case 42:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<42>(in, out + i * 32);
+      break;
+    case 43:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<43>(in, out + i * 32);
+      break;
+    case 44:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<44>(in, out + i * 32);
+      break;
+    case 45:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<45>(in, out + i * 32);
+      break;
+    case 46:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<46>(in, out + i * 32);
+      break;
+    case 47:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<47>(in, out + i * 32);
+      break;
+    case 48:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<48>(in, out + i * 32);
+      break;
+    case 49:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<49>(in, out + i * 32);
+      break;
+    case 50:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<50>(in, out + i * 32);
+      break;
+    case 51:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<51>(in, out + i * 32);
+      break;
+    case 52:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<52>(in, out + i * 32);
+      break;
+    case 53:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<53>(in, out + i * 32);
+      break;
+    case 54:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<54>(in, out + i * 32);
+      break;
+    case 55:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<55>(in, out + i * 32);
+      break;
+    case 56:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<56>(in, out + i * 32);
+      break;
+    case 57:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<57>(in, out + i * 32);
+      break;
+    case 58:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<58>(in, out + i * 32);
+      break;
+    case 59:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<59>(in, out + i * 32);
+      break;
+    case 60:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<60>(in, out + i * 32);
+      break;
+    case 61:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<61>(in, out + i * 32);
+      break;
+    case 62:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<62>(in, out + i * 32);
+      break;
+    case 63:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<63>(in, out + i * 32);
+      break;
+    case 64:
+      for (int i = 0; i < num_loops; ++i) in = unpack64_32values<64>(in, out + i * 32);
+      break;
+    default:
+      DCHECK(false) << "Unsupported num_bits";
+  }
+
+  return batch_size;
+}
+
 struct Unpack32DynamicFunction {
   using FunctionType = decltype(&unpack32_default);
 
@@ -167,5 +375,10 @@ int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
   return dispatch.func(in, out, batch_size, num_bits);
 }
 
+int unpack64(const uint8_t* in, uint64_t* out, int batch_size, int num_bits) {
+  // There are no SIMD implementations of 64-bit unpacking yet
+  return unpack64_default(in, out, batch_size, num_bits);
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -27,5 +27,9 @@ namespace internal {
 ARROW_EXPORT
 int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits);
 
+/// \brief Like unpack32, for values of up to 64 bits
+ARROW_EXPORT
+int unpack64(const uint8_t* in, uint64_t* out, int batch_size, int num_bits);
+
 }  // namespace internal
 }  // namespace arrow
@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/util/bit_util.h"
+
+namespace arrow {
+namespace internal {
+
+// Unpack 32 values of kNumBits bits each, which take kNumBits 32-bit little-endian
+// words, and return the input past them. The bit positions of the values are known
+// at compile time, so that each value is extracted with a few shifts of at most
+// three words.
+template <int kNumBits>
+inline const uint8_t* unpack64_32values(const uint8_t* in, uint64_t* out) {
+  static_assert(kNumBits >= 0 && kNumBits <= 64, "num_bits must be in [0, 64]");
+  constexpr uint64_t kMask = kNumBits == 64 ? ~static_cast<uint64_t>(0)
+                                            : (static_cast<uint64_t>(1) << kNumBits) - 1;
+
+  // Two zero words past the end let every value read three words
+  uint64_t words[kNumBits + 2];
+  for (int i = 0; i < kNumBits; ++i) {
+    uint32_t word;
+    std::memcpy(&word, in + i * 4, 4);
+    words[i] = arrow::BitUtil::FromLittleEndian(word);
+  }
+  words[kNumBits] = words[kNumBits + 1] = 0;
+
+  for (int i = 0; i < 32; ++i) {
+    const int bit_offset = i * kNumBits;
+    const int word_index = bit_offset / 32;
+    const int shift = bit_offset % 32;
+    uint64_t value = (words[word_index] | (words[word_index + 1] << 32)) >> shift;
+    if (shift + kNumBits > 64) {
+      value |= words[word_index + 2] << ((64 - shift) & 63);
+    }
+    out[i] = value & kMask;
+  }
+  return in + kNumBits * 4;
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,123 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/byte_stream_split.h"
+
+#include <utility>
+#include <vector>
+
+#include "arrow/util/dispatch.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+namespace {
+
+using ::arrow::internal::DispatchLevel;
+using ::arrow::internal::DynamicDispatch;
+
+template <typename T>
+void ByteStreamSplitEncodeDefault(const uint8_t* raw_values, const size_t num_values,
+                                  uint8_t* output_buffer_raw) {
+#if defined(ARROW_HAVE_SIMD_SPLIT)
+  return ByteStreamSplitEncodeSimd<T>(raw_values, num_values, output_buffer_raw);
+#else
+  return ByteStreamSplitEncodeScalar<T>(raw_values, num_values, output_buffer_raw);
+#endif
+}
+
+template <typename T>
+void ByteStreamSplitDecodeDefault(const uint8_t* data, int64_t num_values,
+                                  int64_t stride, T* out) {
+#if defined(ARROW_HAVE_SIMD_SPLIT)
+  return ByteStreamSplitDecodeSimd(data, num_values, stride, out);
+#else
+  return ByteStreamSplitDecodeScalar(data, num_values, stride, out);
+#endif
+}
+
+void ByteStreamSplitEncodeDefault(const uint8_t* raw_values, int width,
+                                  const size_t num_values, uint8_t* output_buffer_raw) {
+  DCHECK(width == 4 || width == 8);
+  if (width == 4) {
+    return ByteStreamSplitEncodeDefault<float>(raw_values, num_values, output_buffer_raw);
+  }
+  return ByteStreamSplitEncodeDefault<double>(raw_values, num_values, output_buffer_raw);
+}
+
+void ByteStreamSplitDecodeDefault(const uint8_t* data, int width, int64_t num_values,
+                                  int64_t stride, uint8_t* out) {
+  DCHECK(width == 4 || width == 8);
+  if (width == 4) {
+    return ByteStreamSplitDecodeDefault(data, num_values, stride,
+                                        reinterpret_cast<float*>(out));
+  }
+  return ByteStreamSplitDecodeDefault(data, num_values, stride,
+                                      reinterpret_cast<double*>(out));
+}
+
+struct ByteStreamSplitEncodeDynamicFunction {
+  using FunctionType = decltype(&ByteStreamSplitEncodeDynamic);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      { DispatchLevel::NONE, ByteStreamSplitEncodeDefault }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , { DispatchLevel::AVX2, avx2::ByteStreamSplitEncode }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      , { DispatchLevel::AVX512, avx512::ByteStreamSplitEncode }
+#endif
+    };
+  }
+};
+
+struct ByteStreamSplitDecodeDynamicFunction {
+  using FunctionType = decltype(&ByteStreamSplitDecodeDynamic);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {
+      { DispatchLevel::NONE, ByteStreamSplitDecodeDefault }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , { DispatchLevel::AVX2, avx2::ByteStreamSplitDecode }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+      , { DispatchLevel::AVX512, avx512::ByteStreamSplitDecode }
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+void ByteStreamSplitEncodeDynamic(const uint8_t* raw_values, int width,
+                                  const size_t num_values, uint8_t* output_buffer_raw) {
+  static DynamicDispatch<ByteStreamSplitEncodeDynamicFunction> dispatch;
+  return dispatch.func(raw_values, width, num_values, output_buffer_raw);
+}
+
+void ByteStreamSplitDecodeDynamic(const uint8_t* data, int width, int64_t num_values,
+                                  int64_t stride, uint8_t* out) {
+  static DynamicDispatch<ByteStreamSplitDecodeDynamicFunction> dispatch;
+  return dispatch.func(data, width, num_values, stride, out);
+}
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
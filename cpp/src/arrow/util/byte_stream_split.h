@@ -19,6 +19,7 @@
 
 #include "arrow/util/simd.h"
 #include "arrow/util/ubsan.h"
+#include "arrow/util/visibility.h"
 
 #include <stdint.h>
 #include <algorithm>
@@ -32,10 +33,14 @@ namespace arrow {
 namespace util {
 namespace internal {
 
+// The SSE and AVX2 implementations have internal linkage: they are also compiled
+// into the translation units targeting higher instruction sets for runtime
+// dispatch, whose instantiations must not replace the ones of lower levels.
+
 #if defined(ARROW_HAVE_SSE4_2)
 template <typename T>
-void ByteStreamSplitDecodeSse2(const uint8_t* data, int64_t num_values, int64_t stride,
-                               T* out) {
+static void ByteStreamSplitDecodeSse2(const uint8_t* data, int64_t num_values,
+                                      int64_t stride, T* out) {
   constexpr size_t kNumStreams = sizeof(T);
   static_assert(kNumStreams == 4U || kNumStreams == 8U, "Invalid number of streams.");
   constexpr size_t kNumStreamsLog2 = (kNumStreams == 8U ? 3U : 2U);
@@ -88,8 +93,9 @@ void ByteStreamSplitDecodeSse2(const uint8_t* data, int64_t num_values, int64_t
 }
 
 template <typename T>
-void ByteStreamSplitEncodeSse2(const uint8_t* raw_values, const size_t num_values,
-                               uint8_t* output_buffer_raw) {
+static void ByteStreamSplitEncodeSse2(const uint8_t* raw_values,
+                                      const size_t num_values,
+                                      uint8_t* output_buffer_raw) {
   constexpr size_t kNumStreams = sizeof(T);
   static_assert(kNumStreams == 4U || kNumStreams == 8U, "Invalid number of streams.");
   __m128i stage[3][kNumStreams];
@@ -176,8 +182,8 @@ void ByteStreamSplitEncodeSse2(const uint8_t* raw_values, const size_t num_value
 
 #if defined(ARROW_HAVE_AVX2)
 template <typename T>
-void ByteStreamSplitDecodeAvx2(const uint8_t* data, int64_t num_values, int64_t stride,
-                               T* out) {
+static void ByteStreamSplitDecodeAvx2(const uint8_t* data, int64_t num_values,
+                                      int64_t stride, T* out) {
   constexpr size_t kNumStreams = sizeof(T);
   static_assert(kNumStreams == 4U || kNumStreams == 8U, "Invalid number of streams.");
   constexpr size_t kNumStreamsLog2 = (kNumStreams == 8U ? 3U : 2U);
@@ -262,13 +268,11 @@ void ByteStreamSplitDecodeAvx2(const uint8_t* data, int64_t num_values, int64_t
 }
 
 template <typename T>
-void ByteStreamSplitEncodeAvx2(const uint8_t* raw_values, const size_t num_values,
-                               uint8_t* output_buffer_raw) {
+static void ByteStreamSplitEncodeAvx2(const uint8_t* raw_values,
+                                      const size_t num_values,
+                                      uint8_t* output_buffer_raw) {
   constexpr size_t kNumStreams = sizeof(T);
   static_assert(kNumStreams == 4U || kNumStreams == 8U, "Invalid number of streams.");
-  if (kNumStreams == 8U)  // Back to SSE, currently no path for double.
-    return ByteStreamSplitEncodeSse2<T>(raw_values, num_values, output_buffer_raw);
-
   const size_t size = num_values * sizeof(T);
   constexpr size_t kBlockSize = sizeof(__m256i) * kNumStreams;
   if (size < kBlockSize)  // Back to SSE for small size
@@ -291,6 +295,51 @@ void ByteStreamSplitEncodeAvx2(const uint8_t* raw_values, const size_t num_value
     }
   }
 
+  if (kNumStreams == 8U) {
+    // Path for double.
+    // 1. Gather the first 16 values of the block in the lower 128i lanes and the
+    //    next 16 values in the upper 128i lanes with _mm256_permute2x128_si256.
+    // 2. Shuffle both lanes as the SSE path does, the unpack intrinsics work
+    //    on each lane independently.  The lower lane of the result for each
+    //    stream then holds the bytes of the first 16 values, followed by the
+    //    bytes of the next 16 values in the upper lane.
+    __m256i stage[3][kNumStreams];
+    __m256i tmp[kNumStreams];
+    __m256i final_result[kNumStreams];
+
+    for (size_t block_index = 0; block_index < num_blocks; ++block_index) {
+      const __m256i* block = &raw_values_simd[block_index * kNumStreams];
+      for (size_t i = 0; i < kNumStreams / 2U; ++i) {
+        const __m256i lower = _mm256_loadu_si256(&block[i]);
+        const __m256i upper = _mm256_loadu_si256(&block[i + kNumStreams / 2U]);
+        stage[0][i * 2] = _mm256_permute2x128_si256(lower, upper, 0b00100000);
+        stage[0][i * 2 + 1] = _mm256_permute2x128_si256(lower, upper, 0b00110001);
+      }
+
+      for (size_t stage_lvl = 0; stage_lvl < 2U; ++stage_lvl) {
+        for (size_t i = 0; i < kNumStreams / 2U; ++i) {
+          stage[stage_lvl + 1][i * 2] =
+              _mm256_unpacklo_epi8(stage[stage_lvl][i * 2], stage[stage_lvl][i * 2 + 1]);
+          stage[stage_lvl + 1][i * 2 + 1] =
+              _mm256_unpackhi_epi8(stage[stage_lvl][i * 2], stage[stage_lvl][i * 2 + 1]);
+        }
+      }
+      for (size_t i = 0; i < 4; ++i) {
+        tmp[i * 2] = _mm256_unpacklo_epi32(stage[2][i], stage[2][i + 4]);
+        tmp[i * 2 + 1] = _mm256_unpackhi_epi32(stage[2][i], stage[2][i + 4]);
+      }
+      for (size_t i = 0; i < 4; ++i) {
+        final_result[i * 2] = _mm256_unpacklo_epi32(tmp[i], tmp[i + 4]);
+        final_result[i * 2 + 1] = _mm256_unpackhi_epi32(tmp[i], tmp[i + 4]);
+      }
+
+      for (size_t i = 0; i < kNumStreams; ++i) {
+        _mm256_storeu_si256(&output_buffer_streams[i][block_index], final_result[i]);
+      }
+    }
+    return;
+  }
+
   // Path for float.
   // 1. Processed hierahically to 32i blcok using the unpack intrinsics.
   // 2. Pack 128i block using _mm256_permutevar8x32_epi32.
@@ -601,24 +650,53 @@ void ByteStreamSplitDecodeScalar(const uint8_t* data, int64_t num_values, int64_
   }
 }
 
+// Implementations for values of 4 or 8 bytes using the best instruction set
+// available at runtime, defined in byte_stream_split.cc
+ARROW_EXPORT
+void ByteStreamSplitEncodeDynamic(const uint8_t* raw_values, int width,
+                                  const size_t num_values, uint8_t* output_buffer_raw);
+ARROW_EXPORT
+void ByteStreamSplitDecodeDynamic(const uint8_t* data, int width, int64_t num_values,
+                                  int64_t stride, uint8_t* out);
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+namespace avx2 {
+// defined in byte_stream_split_avx2.cc
+ARROW_EXPORT
+void ByteStreamSplitEncode(const uint8_t* raw_values, int width, const size_t num_values,
+                           uint8_t* output_buffer_raw);
+ARROW_EXPORT
+void ByteStreamSplitDecode(const uint8_t* data, int width, int64_t num_values,
+                           int64_t stride, uint8_t* out);
+}  // namespace avx2
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+namespace avx512 {
+// defined in byte_stream_split_avx512.cc
+ARROW_EXPORT
+void ByteStreamSplitEncode(const uint8_t* raw_values, int width, const size_t num_values,
+                           uint8_t* output_buffer_raw);
+ARROW_EXPORT
+void ByteStreamSplitDecode(const uint8_t* data, int width, int64_t num_values,
+                           int64_t stride, uint8_t* out);
+}  // namespace avx512
+#endif
+
 template <typename T>
 void inline ByteStreamSplitEncode(const uint8_t* raw_values, const size_t num_values,
                                   uint8_t* output_buffer_raw) {
-#if defined(ARROW_HAVE_SIMD_SPLIT)
-  return ByteStreamSplitEncodeSimd<T>(raw_values, num_values, output_buffer_raw);
-#else
-  return ByteStreamSplitEncodeScalar<T>(raw_values, num_values, output_buffer_raw);
-#endif
+  static_assert(sizeof(T) == 4U || sizeof(T) == 8U, "Invalid number of streams.");
+  return ByteStreamSplitEncodeDynamic(raw_values, static_cast<int>(sizeof(T)),
+                                      num_values, output_buffer_raw);
 }
 
 template <typename T>
 void inline ByteStreamSplitDecode(const uint8_t* data, int64_t num_values, int64_t stride,
                                   T* out) {
-#if defined(ARROW_HAVE_SIMD_SPLIT)
-  return ByteStreamSplitDecodeSimd(data, num_values, stride, out);
-#else
-  return ByteStreamSplitDecodeScalar(data, num_values, stride, out);
-#endif
+  static_assert(sizeof(T) == 4U || sizeof(T) == 8U, "Invalid number of streams.");
+  return ByteStreamSplitDecodeDynamic(data, static_cast<int>(sizeof(T)), num_values,
+                                      stride, reinterpret_cast<uint8_t*>(out));
 }
 
 }  // namespace internal
@@ -0,0 +1,49 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/byte_stream_split.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace util {
+namespace internal {
+namespace avx2 {
+
+void ByteStreamSplitEncode(const uint8_t* raw_values, int width, const size_t num_values,
+                           uint8_t* output_buffer_raw) {
+  DCHECK(width == 4 || width == 8);
+  if (width == 4) {
+    return ByteStreamSplitEncodeAvx2<float>(raw_values, num_values, output_buffer_raw);
+  }
+  return ByteStreamSplitEncodeAvx2<double>(raw_values, num_values, output_buffer_raw);
+}
+
+void ByteStreamSplitDecode(const uint8_t* data, int width, int64_t num_values,
+                           int64_t stride, uint8_t* out) {
+  DCHECK(width == 4 || width == 8);
+  if (width == 4) {
+    return ByteStreamSplitDecodeAvx2(data, num_values, stride,
+                                     reinterpret_cast<float*>(out));
+  }
+  return ByteStreamSplitDecodeAvx2(data, num_values, stride,
+                                   reinterpret_cast<double*>(out));
+}
+
+}  // namespace avx2
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
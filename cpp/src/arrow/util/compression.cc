@@ -25,10 +25,56 @@
 #include "arrow/status.h"
 #include "arrow/util/compression_internal.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace util {
 
+#ifdef ARROW_WITH_TRACING
+namespace {
+
+// Records a span around each one-shot compression and decompression
+class TracedCodec : public Codec {
+ public:
+  explicit TracedCodec(std::unique_ptr<Codec> codec) : codec_(std::move(codec)) {}
+
+  Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
+                             int64_t output_buffer_len, uint8_t* output_buffer) override {
+    ARROW_TRACE_SPAN("codec", "Decompress", name());
+    return codec_->Decompress(input_len, input, output_buffer_len, output_buffer);
+  }
+
+  Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
+                           int64_t output_buffer_len, uint8_t* output_buffer) override {
+    ARROW_TRACE_SPAN("codec", "Compress", name());
+    return codec_->Compress(input_len, input, output_buffer_len, output_buffer);
+  }
+
+  int64_t MaxCompressedLen(int64_t input_len, const uint8_t* input) override {
+    return codec_->MaxCompressedLen(input_len, input);
+  }
+
+  Result<std::shared_ptr<Compressor>> MakeCompressor() override {
+    return codec_->MakeCompressor();
+  }
+
+  Result<std::shared_ptr<Decompressor>> MakeDecompressor() override {
+    return codec_->MakeDecompressor();
+  }
+
+  Compression::type compression_type() const override {
+    return codec_->compression_type();
+  }
+
+  int compression_level() const override { return codec_->compression_level(); }
+
+ private:
+  std::unique_ptr<Codec> codec_;
+};
+
+}  // namespace
+#endif
+
 int Codec::UseDefaultCompressionLevel() { return kUseDefaultCompressionLevel; }
 
 Status Codec::Init() { return Status::OK(); }
@@ -175,7 +221,47 @@ Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
 
   DCHECK_NE(codec, nullptr);
   RETURN_NOT_OK(codec->Init());
+#ifdef ARROW_WITH_TRACING
+  codec.reset(new TracedCodec(std::move(codec)));
+#endif
+  return std::move(codec);
+}
+
+Result<std::unique_ptr<Codec>> Codec::CreateWithDictionary(
+    Compression::type codec_type, std::shared_ptr<Buffer> dictionary,
+    int compression_level) {
+  if (codec_type != Compression::ZSTD) {
+    return Status::NotImplemented("Codec '", GetCodecAsString(codec_type),
+                                  "' doesn't support dictionaries");
+  }
+  if (dictionary == nullptr) {
+    return Create(codec_type, compression_level);
+  }
+#ifdef ARROW_WITH_ZSTD
+  std::unique_ptr<Codec> codec =
+      internal::MakeZSTDCodec(compression_level, std::move(dictionary));
+  RETURN_NOT_OK(codec->Init());
+#ifdef ARROW_WITH_TRACING
+  codec.reset(new TracedCodec(std::move(codec)));
+#endif
   return std::move(codec);
+#else
+  return Status::NotImplemented("Support for codec 'zstd' not built");
+#endif
+}
+
+Result<std::shared_ptr<Buffer>> Codec::TrainDictionary(
+    Compression::type codec_type, const std::vector<std::shared_ptr<Buffer>>& samples,
+    int64_t max_dictionary_size) {
+  if (codec_type != Compression::ZSTD) {
+    return Status::NotImplemented("Codec '", GetCodecAsString(codec_type),
+                                  "' doesn't support dictionaries");
+  }
+#ifdef ARROW_WITH_ZSTD
+  return internal::TrainZSTDDictionary(samples, max_dictionary_size);
+#else
+  return Status::NotImplemented("Support for codec 'zstd' not built");
+#endif
 }
 
 bool Codec::IsAvailable(Compression::type codec_type) {
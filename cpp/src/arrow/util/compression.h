@@ -21,6 +21,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -28,6 +29,8 @@
 
 namespace arrow {
 
+class Buffer;
+
 struct Compression {
   /// \brief Compression algorithm
   enum type {
@@ -144,6 +147,24 @@ class ARROW_EXPORT Codec {
   static Result<std::unique_ptr<Codec>> Create(
       Compression::type codec, int compression_level = kUseDefaultCompressionLevel);
 
+  /// \brief Create a codec (de)compressing with a pre-trained dictionary
+  ///
+  /// A dictionary trained on samples of the data makes compression of small
+  /// buffers (e.g. Parquet pages) both faster and more effective.  Data must be
+  /// decompressed with the dictionary it was compressed with.  Only supported
+  /// for ZSTD.
+  static Result<std::unique_ptr<Codec>> CreateWithDictionary(
+      Compression::type codec, std::shared_ptr<Buffer> dictionary,
+      int compression_level = kUseDefaultCompressionLevel);
+
+  /// \brief Train a dictionary for CreateWithDictionary() from sample buffers
+  ///
+  /// The samples should be representative of the buffers to compress, and
+  /// there should be at least a few hundreds of them.
+  static Result<std::shared_ptr<Buffer>> TrainDictionary(
+      Compression::type codec, const std::vector<std::shared_ptr<Buffer>>& samples,
+      int64_t max_dictionary_size = 112640);
+
   /// \brief Return true if support for indicated codec has been enabled
   static bool IsAvailable(Compression::type codec);
 
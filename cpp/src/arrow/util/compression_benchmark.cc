@@ -25,6 +25,9 @@
 #include <string>
 #include <vector>
 
+#include "arrow/buffer.h"
+#include "arrow/io/compressed.h"
+#include "arrow/io/memory.h"
 #include "arrow/result.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
@@ -175,9 +178,149 @@ static void ReferenceStreamingDecompression(
   StreamingDecompression(COMPRESSION, data, state);
 }
 
+// Compress through a CompressedOutputStream, parallel if state.range(0) (the
+// block size) is non-zero
+template <Compression::type COMPRESSION>
+static void ReferenceCompressedOutputStream(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto data = MakeCompressibleData(64 * 1024 * 1024);  // 64 MB
+  auto codec = *Codec::Create(COMPRESSION);
+  const int64_t block_size = state.range(0);
+
+  while (state.KeepRunning()) {
+    auto sink = *io::BufferOutputStream::Create(data.size());
+    std::shared_ptr<io::CompressedOutputStream> stream;
+    if (block_size > 0) {
+      auto options = io::ParallelCompressionOptions::Defaults();
+      options.block_size = block_size;
+      stream = *io::CompressedOutputStream::MakeParallel(codec.get(), sink, options);
+    } else {
+      stream = *io::CompressedOutputStream::Make(codec.get(), sink);
+    }
+    // Write in 64 KB chunks, like a CSV writer would
+    const int64_t chunk_size = 64 * 1024;
+    for (int64_t pos = 0; pos < static_cast<int64_t>(data.size()); pos += chunk_size) {
+      const auto nbytes = std::min<int64_t>(chunk_size, data.size() - pos);
+      ARROW_CHECK_OK(stream->Write(data.data() + pos, nbytes));
+    }
+    ARROW_CHECK_OK(stream->Close());
+    state.counters["ratio"] = static_cast<double>(data.size()) /
+                              static_cast<double>((*sink->Finish())->size());
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+// One-shot (de)compression of 8 KB buffers, the size of small Parquet pages,
+// where the per-call setup costs of the codec show.  If state.range(0) is
+// non-zero, ZSTD uses a dictionary trained on other pages.
+constexpr int64_t kPageSize = 8 * 1024;
+constexpr int64_t kNumPages = 512;
+
+std::vector<std::shared_ptr<Buffer>> MakePages() {
+  auto data = MakeCompressibleData(static_cast<int>(kPageSize * kNumPages));
+  std::vector<std::shared_ptr<Buffer>> pages;
+  for (int64_t i = 0; i < kNumPages; ++i) {
+    pages.push_back(Buffer::FromString(std::string(
+        reinterpret_cast<const char*>(data.data()) + i * kPageSize, kPageSize)));
+  }
+  return pages;
+}
+
+std::unique_ptr<Codec> MakePageCodec(Compression::type compression,
+                                     benchmark::State& state) {  // NOLINT
+  if (state.range(0) == 0) {
+    return *Codec::Create(compression);
+  }
+  // Train on the first half of the pages, the benchmark uses the other half
+  auto pages = MakePages();
+  pages.resize(kNumPages / 2);
+  auto dictionary = *Codec::TrainDictionary(compression, pages);
+  return *Codec::CreateWithDictionary(compression, dictionary);
+}
+
+template <Compression::type COMPRESSION>
+static void ReferencePageCompression(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto pages = MakePages();
+  pages.erase(pages.begin(), pages.begin() + kNumPages / 2);
+  auto codec = MakePageCodec(COMPRESSION, state);
+  std::vector<uint8_t> output(codec->MaxCompressedLen(kPageSize, nullptr));
+
+  int64_t compressed_size = 0;
+  for (auto _ : state) {
+    compressed_size = 0;
+    for (const auto& page : pages) {
+      compressed_size += *codec->Compress(page->size(), page->data(), output.size(),
+                                          output.data());
+    }
+  }
+  state.counters["ratio"] = static_cast<double>(pages.size() * kPageSize) /
+                            static_cast<double>(compressed_size);
+  state.SetBytesProcessed(state.iterations() * pages.size() * kPageSize);
+}
+
+template <Compression::type COMPRESSION>
+static void ReferencePageDecompression(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto pages = MakePages();
+  pages.erase(pages.begin(), pages.begin() + kNumPages / 2);
+  auto codec = MakePageCodec(COMPRESSION, state);
+
+  std::vector<std::vector<uint8_t>> compressed_pages;
+  for (const auto& page : pages) {
+    std::vector<uint8_t> compressed(codec->MaxCompressedLen(kPageSize, nullptr));
+    compressed.resize(*codec->Compress(page->size(), page->data(), compressed.size(),
+                                       compressed.data()));
+    compressed_pages.push_back(std::move(compressed));
+  }
+  std::vector<uint8_t> output(kPageSize);
+
+  for (auto _ : state) {
+    for (const auto& compressed : compressed_pages) {
+      ARROW_CHECK_OK(codec->Decompress(compressed.size(), compressed.data(),
+                                       output.size(), output.data())
+                         .status());
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * pages.size() * kPageSize);
+}
+
+#ifdef ARROW_WITH_ZLIB
+BENCHMARK_TEMPLATE(ReferencePageCompression, Compression::GZIP)->Arg(0);
+BENCHMARK_TEMPLATE(ReferencePageDecompression, Compression::GZIP)->Arg(0);
+#endif
+
+#ifdef ARROW_WITH_SNAPPY
+BENCHMARK_TEMPLATE(ReferencePageCompression, Compression::SNAPPY)->Arg(0);
+BENCHMARK_TEMPLATE(ReferencePageDecompression, Compression::SNAPPY)->Arg(0);
+#endif
+
+#ifdef ARROW_WITH_ZSTD
+BENCHMARK_TEMPLATE(ReferencePageCompression, Compression::ZSTD)
+    ->ArgName("dictionary")
+    ->Arg(0)
+    ->Arg(1);
+BENCHMARK_TEMPLATE(ReferencePageDecompression, Compression::ZSTD)
+    ->ArgName("dictionary")
+    ->Arg(0)
+    ->Arg(1);
+#endif
+
+#ifdef ARROW_WITH_LZ4
+BENCHMARK_TEMPLATE(ReferencePageCompression, Compression::LZ4)->Arg(0);
+BENCHMARK_TEMPLATE(ReferencePageDecompression, Compression::LZ4)->Arg(0);
+BENCHMARK_TEMPLATE(ReferencePageCompression, Compression::LZ4_FRAME)->Arg(0);
+BENCHMARK_TEMPLATE(ReferencePageDecompression, Compression::LZ4_FRAME)->Arg(0);
+#endif
+
 #ifdef ARROW_WITH_ZLIB
 BENCHMARK_TEMPLATE(ReferenceStreamingCompression, Compression::GZIP);
 BENCHMARK_TEMPLATE(ReferenceStreamingDecompression, Compression::GZIP);
+BENCHMARK_TEMPLATE(ReferenceCompressedOutputStream, Compression::GZIP)
+    ->Arg(0)
+    ->Arg(1 << 20)
+    ->Arg(4 << 20)
+    ->UseRealTime();
 #endif
 
 #ifdef ARROW_WITH_BROTLI
@@ -188,6 +331,11 @@ BENCHMARK_TEMPLATE(ReferenceStreamingDecompression, Compression::BROTLI);
 #ifdef ARROW_WITH_ZSTD
 BENCHMARK_TEMPLATE(ReferenceStreamingCompression, Compression::ZSTD);
 BENCHMARK_TEMPLATE(ReferenceStreamingDecompression, Compression::ZSTD);
+BENCHMARK_TEMPLATE(ReferenceCompressedOutputStream, Compression::ZSTD)
+    ->Arg(0)
+    ->Arg(1 << 20)
+    ->Arg(4 << 20)
+    ->UseRealTime();
 #endif
 
 #ifdef ARROW_WITH_LZ4
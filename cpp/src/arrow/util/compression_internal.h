@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "arrow/util/compression.h"  // IWYU pragma: export
 
@@ -73,7 +74,11 @@ std::unique_ptr<Codec> MakeLz4FrameCodec();
 constexpr int kZSTDDefaultCompressionLevel = 1;
 
 std::unique_ptr<Codec> MakeZSTDCodec(
-    int compression_level = kZSTDDefaultCompressionLevel);
+    int compression_level = kZSTDDefaultCompressionLevel,
+    std::shared_ptr<Buffer> dictionary = nullptr);
+
+Result<std::shared_ptr<Buffer>> TrainZSTDDictionary(
+    const std::vector<std::shared_ptr<Buffer>>& samples, int64_t max_dictionary_size);
 
 }  // namespace internal
 }  // namespace util
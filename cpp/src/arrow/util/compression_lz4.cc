@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <utility>
 
 #include <lz4.h>
 #include <lz4frame.h>
@@ -261,7 +262,17 @@ class Lz4FrameCodec : public Codec {
 
   Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output_buffer) override {
-    ARROW_ASSIGN_OR_RAISE(auto decomp, MakeDecompressor());
+    // Creating a decompression context allocates, so each thread keeps one
+    // around for one-shot decompression of small buffers (e.g. IPC bodies)
+    static thread_local std::shared_ptr<LZ4Decompressor> thread_decompressor;
+    if (thread_decompressor == nullptr) {
+      auto ptr = std::make_shared<LZ4Decompressor>();
+      RETURN_NOT_OK(ptr->Init());
+      thread_decompressor = std::move(ptr);
+    } else {
+      RETURN_NOT_OK(thread_decompressor->Reset());
+    }
+    LZ4Decompressor* decomp = thread_decompressor.get();
 
     int64_t total_bytes_written = 0;
     while (!decomp->IsFinished() && input_len != 0) {
@@ -26,6 +26,7 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
@@ -561,6 +562,77 @@ INSTANTIATE_TEST_SUITE_P(TestBZ2, CodecTest, ::testing::Values(Compression::BZ2)
 INSTANTIATE_TEST_SUITE_P(TestZSTD, CodecTest, ::testing::Values(Compression::ZSTD));
 #endif
 
+TEST(TestCodecMisc, DictionaryNotSupported) {
+  auto dictionary = Buffer::FromString("dictionary");
+  ASSERT_RAISES(NotImplemented,
+                Codec::CreateWithDictionary(Compression::SNAPPY, dictionary));
+  ASSERT_RAISES(NotImplemented, Codec::TrainDictionary(Compression::GZIP, {}));
+}
+
+#ifdef ARROW_WITH_ZSTD
+// Small records with a shared structure, like the values of a Parquet page
+std::vector<std::shared_ptr<Buffer>> MakeDictionarySamples(int num_samples) {
+  std::mt19937 engine(42);
+  std::uniform_int_distribution<int> ids(0, 1000000);
+  std::vector<std::shared_ptr<Buffer>> samples;
+  for (int i = 0; i < num_samples; ++i) {
+    std::string sample;
+    for (int j = 0; j < 8; ++j) {
+      sample += "{\"event_id\": " + std::to_string(ids(engine)) +
+                ", \"source\": \"arrow-dataset-scanner\", \"status\": \"" +
+                (ids(engine) % 2 ? "succeeded" : "failed") + "\"}\n";
+    }
+    samples.push_back(Buffer::FromString(std::move(sample)));
+  }
+  return samples;
+}
+
+TEST(TestCodecZSTD, Dictionary) {
+  auto samples = MakeDictionarySamples(1000);
+  ASSERT_OK_AND_ASSIGN(auto dictionary,
+                       Codec::TrainDictionary(Compression::ZSTD, samples, 4096));
+  ASSERT_GT(dictionary->size(), 0);
+  ASSERT_LE(dictionary->size(), 4096);
+
+  ASSERT_OK_AND_ASSIGN(auto c1,
+                       Codec::CreateWithDictionary(Compression::ZSTD, dictionary));
+  ASSERT_OK_AND_ASSIGN(auto c2,
+                       Codec::CreateWithDictionary(Compression::ZSTD, dictionary, 5));
+  ASSERT_OK_AND_ASSIGN(auto plain, Codec::Create(Compression::ZSTD));
+
+  const auto& sample = *MakeDictionarySamples(1001).back();
+  std::vector<uint8_t> data(sample.data(), sample.data() + sample.size());
+  CheckCodecRoundtrip(c1, c2, data, /*check_reverse=*/false);
+  CheckStreamingRoundtrip(c1.get(), data);
+  CheckStreamingCompressor(c1.get(), data);
+  CheckStreamingDecompressor(c1.get(), data);
+
+  // Small buffers compress better with the dictionary
+  auto compress = [&](Codec* codec, std::vector<uint8_t>* out) {
+    out->resize(codec->MaxCompressedLen(data.size(), data.data()));
+    ASSERT_OK_AND_ASSIGN(auto size, codec->Compress(data.size(), data.data(),
+                                                    out->size(), out->data()));
+    out->resize(size);
+  };
+  std::vector<uint8_t> with_dictionary, without_dictionary;
+  compress(c1.get(), &with_dictionary);
+  compress(plain.get(), &without_dictionary);
+  ASSERT_LT(with_dictionary.size(), without_dictionary.size());
+
+  // Data compressed with a dictionary can't be decompressed without it
+  std::vector<uint8_t> decompressed(data.size());
+  ASSERT_RAISES(IOError,
+                plain->Decompress(with_dictionary.size(), with_dictionary.data(),
+                                  decompressed.size(), decompressed.data()));
+  // ... but interleaving both kinds of decompression in a thread works
+  ASSERT_OK(c1->Decompress(with_dictionary.size(), with_dictionary.data(),
+                           decompressed.size(), decompressed.data()));
+  ASSERT_OK(plain->Decompress(without_dictionary.size(), without_dictionary.data(),
+                              decompressed.size(), decompressed.data()));
+  ASSERT_EQ(data, decompressed);
+}
+#endif
+
 #ifdef ARROW_WITH_LZ4
 TEST(TestCodecLZ4Hadoop, Compatibility) {
   // LZ4 Hadoop codec should be able to read back LZ4 raw blocks
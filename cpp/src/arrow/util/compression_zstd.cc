@@ -20,9 +20,13 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <utility>
+#include <vector>
 
+#include <zdict.h>
 #include <zstd.h>
 
+#include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
@@ -40,18 +44,62 @@ Status ZSTDError(size_t ret, const char* prefix_msg) {
   return Status::IOError(prefix_msg, ZSTD_getErrorName(ret));
 }
 
+// Contexts for one-shot (de)compression. Creating a compression context allocates
+// and initializes several hundred kilobytes of state, so instead of paying that on
+// every Codec call (e.g. once per IPC body buffer), each thread keeps its own.
+class ThreadLocalContexts {
+ public:
+  ~ThreadLocalContexts() {
+    ZSTD_freeCCtx(cctx_);
+    ZSTD_freeDCtx(dctx_);
+  }
+
+  static ThreadLocalContexts* Get() {
+    static thread_local ThreadLocalContexts contexts;
+    return &contexts;
+  }
+
+  Result<ZSTD_CCtx*> compression_context() {
+    if (cctx_ == nullptr) {
+      cctx_ = ZSTD_createCCtx();
+      if (cctx_ == nullptr) {
+        return Status::OutOfMemory("ZSTD compression context creation failed");
+      }
+    }
+    return cctx_;
+  }
+
+  Result<ZSTD_DCtx*> decompression_context() {
+    if (dctx_ == nullptr) {
+      dctx_ = ZSTD_createDCtx();
+      if (dctx_ == nullptr) {
+        return Status::OutOfMemory("ZSTD decompression context creation failed");
+      }
+    }
+    return dctx_;
+  }
+
+ private:
+  ZSTD_CCtx* cctx_ = nullptr;
+  ZSTD_DCtx* dctx_ = nullptr;
+};
+
 // ----------------------------------------------------------------------
 // ZSTD decompressor implementation
 
 class ZSTDDecompressor : public Decompressor {
  public:
-  ZSTDDecompressor() : stream_(ZSTD_createDStream()) {}
+  explicit ZSTDDecompressor(std::shared_ptr<ZSTD_DDict> ddict = nullptr)
+      : stream_(ZSTD_createDStream()), ddict_(std::move(ddict)) {}
 
   ~ZSTDDecompressor() override { ZSTD_freeDStream(stream_); }
 
   Status Init() {
     finished_ = false;
     size_t ret = ZSTD_initDStream(stream_);
+    if (!ZSTD_isError(ret) && ddict_) {
+      ret = ZSTD_DCtx_refDDict(stream_, ddict_.get());
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
     } else {
@@ -88,6 +136,7 @@ class ZSTDDecompressor : public Decompressor {
 
  protected:
   ZSTD_DStream* stream_;
+  std::shared_ptr<ZSTD_DDict> ddict_;
   bool finished_;
 };
 
@@ -96,13 +145,20 @@ class ZSTDDecompressor : public Decompressor {
 
 class ZSTDCompressor : public Compressor {
  public:
-  explicit ZSTDCompressor(int compression_level)
-      : stream_(ZSTD_createCStream()), compression_level_(compression_level) {}
+  explicit ZSTDCompressor(int compression_level,
+                          std::shared_ptr<ZSTD_CDict> cdict = nullptr)
+      : stream_(ZSTD_createCStream()),
+        cdict_(std::move(cdict)),
+        compression_level_(compression_level) {}
 
   ~ZSTDCompressor() override { ZSTD_freeCStream(stream_); }
 
   Status Init() {
     size_t ret = ZSTD_initCStream(stream_, compression_level_);
+    if (!ZSTD_isError(ret) && cdict_) {
+      // The dictionary's compression level takes precedence
+      ret = ZSTD_CCtx_refCDict(stream_, cdict_.get());
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
     } else {
@@ -165,6 +221,7 @@ class ZSTDCompressor : public Compressor {
   ZSTD_CStream* stream_;
 
  private:
+  std::shared_ptr<ZSTD_CDict> cdict_;
   int compression_level_;
 };
 
@@ -173,10 +230,11 @@ class ZSTDCompressor : public Compressor {
 
 class ZSTDCodec : public Codec {
  public:
-  explicit ZSTDCodec(int compression_level)
+  explicit ZSTDCodec(int compression_level, std::shared_ptr<Buffer> dictionary)
       : compression_level_(compression_level == kUseDefaultCompressionLevel
                                ? kZSTDDefaultCompressionLevel
-                               : compression_level) {}
+                               : compression_level),
+        dictionary_(std::move(dictionary)) {}
 
   Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output_buffer) override {
@@ -188,8 +246,18 @@ class ZSTDCodec : public Codec {
       output_buffer = &empty_buffer;
     }
 
-    size_t ret = ZSTD_decompress(output_buffer, static_cast<size_t>(output_buffer_len),
-                                 input, static_cast<size_t>(input_len));
+    ARROW_ASSIGN_OR_RAISE(ZSTD_DCtx * dctx,
+                          ThreadLocalContexts::Get()->decompression_context());
+    size_t ret;
+    if (ddict_) {
+      ret = ZSTD_decompress_usingDDict(dctx, output_buffer,
+                                       static_cast<size_t>(output_buffer_len), input,
+                                       static_cast<size_t>(input_len), ddict_.get());
+    } else {
+      ret = ZSTD_decompressDCtx(dctx, output_buffer,
+                                static_cast<size_t>(output_buffer_len), input,
+                                static_cast<size_t>(input_len));
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD decompression failed: ");
     }
@@ -207,8 +275,17 @@ class ZSTDCodec : public Codec {
 
   Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
                            int64_t output_buffer_len, uint8_t* output_buffer) override {
-    size_t ret = ZSTD_compress(output_buffer, static_cast<size_t>(output_buffer_len),
-                               input, static_cast<size_t>(input_len), compression_level_);
+    ARROW_ASSIGN_OR_RAISE(ZSTD_CCtx * cctx,
+                          ThreadLocalContexts::Get()->compression_context());
+    size_t ret;
+    if (cdict_) {
+      ret = ZSTD_compress_usingCDict(cctx, output_buffer,
+                                     static_cast<size_t>(output_buffer_len), input,
+                                     static_cast<size_t>(input_len), cdict_.get());
+    } else {
+      ret = ZSTD_compressCCtx(cctx, output_buffer, static_cast<size_t>(output_buffer_len),
+                              input, static_cast<size_t>(input_len), compression_level_);
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD compression failed: ");
     }
@@ -216,13 +293,13 @@ class ZSTDCodec : public Codec {
   }
 
   Result<std::shared_ptr<Compressor>> MakeCompressor() override {
-    auto ptr = std::make_shared<ZSTDCompressor>(compression_level_);
+    auto ptr = std::make_shared<ZSTDCompressor>(compression_level_, cdict_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
 
   Result<std::shared_ptr<Decompressor>> MakeDecompressor() override {
-    auto ptr = std::make_shared<ZSTDDecompressor>();
+    auto ptr = std::make_shared<ZSTDDecompressor>(ddict_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -232,13 +309,57 @@ class ZSTDCodec : public Codec {
   int compression_level() const override { return compression_level_; }
 
  private:
+  // Digest the dictionary once, the digested forms are then shared by all
+  // (de)compressions and streams
+  Status Init() override {
+    if (dictionary_ == nullptr) {
+      return Status::OK();
+    }
+    cdict_.reset(ZSTD_createCDict(dictionary_->data(),
+                                  static_cast<size_t>(dictionary_->size()),
+                                  compression_level_),
+                 ZSTD_freeCDict);
+    ddict_.reset(ZSTD_createDDict(dictionary_->data(),
+                                  static_cast<size_t>(dictionary_->size())),
+                 ZSTD_freeDDict);
+    if (cdict_ == nullptr || ddict_ == nullptr) {
+      return Status::OutOfMemory("ZSTD dictionary creation failed");
+    }
+    return Status::OK();
+  }
+
   const int compression_level_;
+  std::shared_ptr<Buffer> dictionary_;
+  std::shared_ptr<ZSTD_CDict> cdict_;
+  std::shared_ptr<ZSTD_DDict> ddict_;
 };
 
 }  // namespace
 
-std::unique_ptr<Codec> MakeZSTDCodec(int compression_level) {
-  return std::unique_ptr<Codec>(new ZSTDCodec(compression_level));
+std::unique_ptr<Codec> MakeZSTDCodec(int compression_level,
+                                     std::shared_ptr<Buffer> dictionary) {
+  return std::unique_ptr<Codec>(new ZSTDCodec(compression_level, std::move(dictionary)));
+}
+
+Result<std::shared_ptr<Buffer>> TrainZSTDDictionary(
+    const std::vector<std::shared_ptr<Buffer>>& samples, int64_t max_dictionary_size) {
+  std::vector<uint8_t> concatenated;
+  std::vector<size_t> sample_sizes;
+  for (const auto& sample : samples) {
+    concatenated.insert(concatenated.end(), sample->data(),
+                        sample->data() + sample->size());
+    sample_sizes.push_back(static_cast<size_t>(sample->size()));
+  }
+  ARROW_ASSIGN_OR_RAISE(auto dictionary, AllocateResizableBuffer(max_dictionary_size));
+  size_t ret = ZDICT_trainFromBuffer(
+      dictionary->mutable_data(), static_cast<size_t>(max_dictionary_size),
+      concatenated.data(), sample_sizes.data(), static_cast<unsigned>(samples.size()));
+  if (ZDICT_isError(ret)) {
+    return Status::Invalid("ZSTD dictionary training failed: ",
+                           ZDICT_getErrorName(ret));
+  }
+  RETURN_NOT_OK(dictionary->Resize(static_cast<int64_t>(ret)));
+  return std::shared_ptr<Buffer>(std::move(dictionary));
 }
 
 }  // namespace internal
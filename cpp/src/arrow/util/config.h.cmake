@@ -35,5 +35,6 @@
 #define ARROW_PACKAGE_KIND "@ARROW_PACKAGE_KIND@"
 
 #cmakedefine ARROW_S3
+#cmakedefine ARROW_WITH_TRACING
 
 #cmakedefine GRPCPP_PP_INCLUDE
@@ -261,8 +261,48 @@ static void AppendLittleEndianArrayToString(const std::array<uint64_t, n>& array
   result->resize(output - result->data());
 }
 
+#ifdef ARROW_USE_NATIVE_INT128
+// Format in chunks of kInt64DecimalDigits digits, each peeled off with a single
+// native division
+static void AppendUint128ToString(__uint128_t value, std::string* result) {
+  constexpr uint64_t kChunkDivisor = kUInt64PowersOfTen[kInt64DecimalDigits];
+  internal::StringFormatter<UInt64Type> format;
+  // 2^128 has 39 decimal digits, hence at most two full chunks
+  uint64_t chunks[2];
+  int num_chunks = 0;
+  while (value >= kChunkDivisor) {
+    chunks[num_chunks++] = static_cast<uint64_t>(value % kChunkDivisor);
+    value /= kChunkDivisor;
+  }
+  // Most significant chunk is formatted as-is.
+  format(static_cast<uint64_t>(value), [result](util::string_view formatted) {
+    result->append(formatted.data(), formatted.size());
+  });
+  while (num_chunks > 0) {
+    // Right-pad formatted chunk such that e.g. 123 is formatted as
+    // "000000000000000123".
+    result->resize(result->size() + kInt64DecimalDigits, '0');
+    char* output = &result->back() + 1;
+    format(chunks[--num_chunks], [output](util::string_view formatted) {
+      memcpy(output - formatted.size(), formatted.data(), formatted.size());
+    });
+  }
+}
+#endif
+
 std::string Decimal128::ToIntegerString() const {
   std::string result;
+#ifdef ARROW_USE_NATIVE_INT128
+  const __uint128_t bits =
+      (static_cast<__uint128_t>(static_cast<uint64_t>(high_bits())) << 64) | low_bits();
+  if (high_bits() < 0) {
+    result.push_back('-');
+    AppendUint128ToString(-bits, &result);
+  } else {
+    AppendUint128ToString(bits, &result);
+  }
+  return result;
+#else
   if (high_bits() < 0) {
     result.push_back('-');
     Decimal128 abs = *this;
@@ -274,6 +314,7 @@ std::string Decimal128::ToIntegerString() const {
                                        &result);
   }
   return result;
+#endif
 }
 
 Decimal128::operator int64_t() const {
@@ -350,6 +391,20 @@ std::string Decimal128::ToString(int32_t scale) const {
   return str;
 }
 
+#ifdef ARROW_USE_NATIVE_INT128
+// Iterates over input and for each group of kInt64DecimalDigits multiplies out by
+// the appropriate power of 10, then adds the group parsed as uint64.
+static inline void ShiftAndAdd(const util::string_view& input, __uint128_t* out) {
+  for (size_t posn = 0; posn < input.size();) {
+    const size_t group_size = std::min(kInt64DecimalDigits, input.size() - posn);
+    uint64_t chunk = 0;
+    ARROW_CHECK(
+        internal::ParseValue<UInt64Type>(input.data() + posn, group_size, &chunk));
+    *out = *out * kUInt64PowersOfTen[group_size] + chunk;
+    posn += group_size;
+  }
+}
+#else
 // Iterates over input and for each group of kInt64DecimalDigits multiple out by
 // the appropriate power of 10 necessary to add source parsed as uint64 and
 // then adds the parsed value of source.
@@ -372,6 +427,7 @@ static inline void ShiftAndAdd(const util::string_view& input, uint64_t out[],
     posn += group_size;
   }
 }
+#endif
 
 namespace {
 
@@ -476,12 +532,20 @@ Status Decimal128::FromString(const util::string_view& s, Decimal128* out,
   }
 
   if (out != nullptr) {
+#ifdef ARROW_USE_NATIVE_INT128
+    __uint128_t value = 0;
+    ShiftAndAdd(dec.whole_digits, &value);
+    ShiftAndAdd(dec.fractional_digits, &value);
+    *out = Decimal128(static_cast<int64_t>(static_cast<uint64_t>(value >> 64)),
+                      static_cast<uint64_t>(value));
+#else
     std::array<uint64_t, 2> little_endian_array = {0, 0};
     ShiftAndAdd(dec.whole_digits, little_endian_array.data(), little_endian_array.size());
     ShiftAndAdd(dec.fractional_digits, little_endian_array.data(),
                 little_endian_array.size());
     *out =
         Decimal128(static_cast<int64_t>(little_endian_array[1]), little_endian_array[0]);
+#endif
     if (parsed_scale < 0) {
       *out *= GetScaleMultiplier(-parsed_scale);
     }
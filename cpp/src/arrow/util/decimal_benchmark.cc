@@ -33,7 +33,8 @@ static const std::vector<std::string>& GetValuesAsString() {
                                                    "12.345e6",
                                                    "-12.345e-6",
                                                    "123456789.123456789",
-                                                   "1231234567890.451234567890"};
+                                                   "1231234567890.451234567890",
+                                                   "-12345678901234567890.123456789"};
   return kValues;
 }
 
@@ -148,6 +149,54 @@ static void BinaryMathOp(benchmark::State& state) {  // NOLINT non-const referen
   state.SetItemsProcessed(state.iterations() * kValueSize);
 }
 
+static void Multiply(benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<BasicDecimal128> v1, v2;
+  for (int x = 0; x < kValueSize; x++) {
+    v1.emplace_back(-100 - x, 100 + x);
+    v2.emplace_back(0, 200 + x);
+  }
+
+  for (auto _ : state) {
+    for (int x = 0; x < kValueSize; x++) {
+      benchmark::DoNotOptimize(v1[x] * v2[x]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kValueSize);
+}
+
+static void Divide(benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<BasicDecimal128> v1, v2;
+  for (int x = 0; x < kValueSize; x++) {
+    v1.emplace_back(100 + x, 100 + x);
+    // Alternate divisors of 64 and 128 bits
+    v2.emplace_back(x % 2 == 0 ? 0 : -x, 200 + x);
+  }
+
+  for (auto _ : state) {
+    for (int x = 0; x < kValueSize; x++) {
+      benchmark::DoNotOptimize(v1[x] / v2[x]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kValueSize);
+}
+
+static void Rescale(benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<BasicDecimal128> v;
+  for (int x = 0; x < kValueSize; x++) {
+    // Alternate values of 64 and 128 bits
+    v.emplace_back(x % 2 == 0 ? 0 : x, 100000 * x);
+  }
+
+  for (auto _ : state) {
+    for (int x = 0; x < kValueSize; x += 2) {
+      BasicDecimal128 out;
+      benchmark::DoNotOptimize(v[x].Rescale(5, 10, &out));
+      benchmark::DoNotOptimize(v[x + 1].Rescale(5, 2, &out));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kValueSize);
+}
+
 static void UnaryOp(benchmark::State& state) {  // NOLINT non-const reference
   std::vector<BasicDecimal128> v;
   for (int x = 0; x < kValueSize; x++) {
@@ -192,6 +241,9 @@ BENCHMARK(FromString);
 BENCHMARK(ToString);
 BENCHMARK(BinaryMathOp);
 BENCHMARK(BinaryMathOpAggregate);
+BENCHMARK(Multiply);
+BENCHMARK(Divide);
+BENCHMARK(Rescale);
 BENCHMARK(BinaryCompareOp);
 BENCHMARK(BinaryCompareOpConstant);
 BENCHMARK(UnaryOp);
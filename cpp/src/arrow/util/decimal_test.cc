@@ -978,6 +978,23 @@ TEST(Decimal128Test, Divide) {
           << " x: " << decimal_x << " y: " << decimal_y;
     }
   }
+
+  // Test dividends and divisors beyond 64 bits
+  const int128_t kTenTo19 = static_cast<int128_t>(10000000000000000000ULL);
+  const int128_t kMax = kTenTo19 * kTenTo19 * 1000000000000000000LL - 1;
+  for (auto x : std::vector<int128_t>{-kMax, -kTenTo19 * kTenTo19 - 7, kTenTo19 * 3,
+                                      kTenTo19 * kTenTo19 + 5, kMax}) {
+    for (auto y : std::vector<int128_t>{-kTenTo19 * kTenTo19, -kTenTo19 - 1, -3, 7,
+                                        kTenTo19, kTenTo19 * 1000000000 + 11}) {
+      Decimal128 decimal_x = Decimal128FromInt128(x);
+      Decimal128 decimal_y = Decimal128FromInt128(y);
+      EXPECT_EQ(Decimal128FromInt128(x / y), decimal_x / decimal_y)
+          << " x: " << decimal_x << " y: " << decimal_y;
+      EXPECT_EQ(Decimal128FromInt128(x % y), decimal_x % decimal_y)
+          << " x: " << decimal_x << " y: " << decimal_y;
+    }
+  }
+  ASSERT_RAISES(Invalid, Decimal128(5).Divide(Decimal128(0)));
 }
 
 TEST(Decimal128Test, Mod) {
@@ -1132,6 +1149,24 @@ TEST(Decimal128Test, ReduceScaleAndRound) {
   ASSERT_EQ(-1238, out);
 }
 
+TEST(Decimal128Test, Rescale) {
+  ASSERT_OK_AND_EQ(Decimal128(1230), Decimal128(123).Rescale(2, 3));
+  ASSERT_OK_AND_EQ(Decimal128(-123), Decimal128(-12300).Rescale(4, 2));
+  ASSERT_OK_AND_EQ(Decimal128(-12300), Decimal128(-123).Rescale(-1, 1));
+  ASSERT_OK_AND_EQ(Decimal128(0), Decimal128(0).Rescale(0, 38));
+  ASSERT_RAISES(Invalid, Decimal128(-12345).Rescale(3, 1));
+  ASSERT_RAISES(Invalid, Decimal128(1).Rescale(0, -18));
+
+  // Values beyond 64 bits, and scale changes beyond 18 digits
+  ASSERT_OK_AND_EQ(Decimal128("-12345678901234567890123"),
+                   Decimal128("-123456789012345678901230000000000000").Rescale(25, 12));
+  ASSERT_OK_AND_EQ(Decimal128("123456789012345678900000000000000000"),
+                   Decimal128("1234567890123456789").Rescale(0, 17));
+  ASSERT_OK_AND_EQ(Decimal128(12), Decimal128("1200000000000000000000").Rescale(20, 0));
+  ASSERT_RAISES(Invalid, Decimal128("1200000000000000000001").Rescale(20, 0));
+  ASSERT_RAISES(Invalid, Decimal128("-1234567890123456789012345").Rescale(0, 20));
+}
+
 TEST(Decimal128Test, FitsInPrecision) {
   ASSERT_TRUE(Decimal128("0").FitsInPrecision(1));
   ASSERT_TRUE(Decimal128("9").FitsInPrecision(1));
@@ -23,6 +23,7 @@
 #include <condition_variable>
 #include <mutex>
 #include <numeric>
+#include <utility>
 
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
@@ -230,6 +231,7 @@ class ConcreteFutureImpl : public FutureImpl {
   void DoMarkFailed() { DoMarkFinishedOrFailed(FutureState::FAILURE); }
 
   void DoMarkFinishedOrFailed(FutureState state) {
+    std::vector<Callback> callbacks;
     {
       // Lock the hypothetical waiter first, and the future after.
       // This matches the locking order done in FutureWaiter constructor.
@@ -241,8 +243,24 @@ class ConcreteFutureImpl : public FutureImpl {
       if (waiter_ != nullptr) {
         waiter_->MarkFutureFinishedUnlocked(waiter_arg_, state);
       }
+      callbacks.swap(callbacks_);
     }
     cv_.notify_all();
+    // Run callbacks outside of the lock, as they may add other callbacks
+    for (const auto& callback : callbacks) {
+      callback();
+    }
+  }
+
+  void DoAddCallback(Callback callback) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (!IsFutureFinished(state_)) {
+        callbacks_.push_back(std::move(callback));
+        return;
+      }
+    }
+    callback();
   }
 
   void DoWait() {
@@ -263,6 +281,7 @@ class ConcreteFutureImpl : public FutureImpl {
   std::condition_variable cv_;
   FutureWaiter* waiter_ = nullptr;
   int waiter_arg_ = -1;
+  std::vector<Callback> callbacks_;
 };
 
 namespace {
@@ -291,6 +310,10 @@ void FutureImpl::Wait() { GetConcreteFuture(this)->DoWait(); }
 
 bool FutureImpl::Wait(double seconds) { return GetConcreteFuture(this)->DoWait(seconds); }
 
+void FutureImpl::AddCallback(Callback callback) {
+  GetConcreteFuture(this)->DoAddCallback(std::move(callback));
+}
+
 void FutureImpl::MarkFinished() { GetConcreteFuture(this)->DoMarkFinished(); }
 
 void FutureImpl::MarkFailed() { GetConcreteFuture(this)->DoMarkFailed(); }
@@ -19,6 +19,7 @@
 
 #include <atomic>
 #include <cmath>
+#include <functional>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -46,6 +47,7 @@ class Future;
 class ARROW_EXPORT FutureImpl {
  public:
   static constexpr double kInfinity = HUGE_VAL;
+  using Callback = std::function<void()>;
 
   virtual ~FutureImpl() = default;
 
@@ -62,6 +64,7 @@ class ARROW_EXPORT FutureImpl {
   void MarkFailed();
   void Wait();
   bool Wait(double seconds);
+  void AddCallback(Callback callback);
 
   // Waiter API
   inline FutureState SetWaiter(FutureWaiter* w, int future_num);
@@ -153,6 +156,7 @@ class FutureStorage : public FutureStorageBase {
   static constexpr bool HasValue = true;
 
   Status status() const { return result_.status(); }
+  const Result<T>& outcome() const { return result_; }
 
   void MarkFinished(Result<T> result) {
     result_ = std::move(result);
@@ -181,6 +185,7 @@ class FutureStorage<void> : public FutureStorageBase {
   static constexpr bool HasValue = false;
 
   Status status() const { return status_; }
+  const Status& outcome() const { return status_; }
 
   void MarkFinished(Status st = Status::OK()) {
     status_ = std::move(st);
@@ -204,6 +209,7 @@ class FutureStorage<Status> : public FutureStorageBase {
   static constexpr bool HasValue = false;
 
   Status status() const { return status_; }
+  const Status& outcome() const { return status_; }
 
   void MarkFinished(Status st) {
     status_ = std::move(st);
@@ -223,6 +229,92 @@ class FutureStorage<Status> : public FutureStorageBase {
   Status status_;
 };
 
+// ---------------------------------------------------------------------
+// Helpers for continuations
+
+namespace detail {
+
+// What a Future<T> holds once finished: a Result<T>, or a Status for
+// Future<void> and Future<Status>
+template <typename T>
+using FutureOutcome =
+    typename std::decay<decltype(std::declval<FutureStorage<T>&>().outcome())>::type;
+
+// The Future returned by Future::Then() for a continuation returning R
+template <typename R>
+struct ContinuedFuture {
+  using type = Future<R>;
+};
+
+template <>
+struct ContinuedFuture<void> {
+  using type = Future<Status>;
+};
+
+template <typename U>
+struct ContinuedFuture<Result<U>> {
+  using type = Future<U>;
+};
+
+template <typename U>
+struct ContinuedFuture<Future<U>> {
+  using type = Future<U>;
+};
+
+// The return type of a continuation for a Future<T>
+template <typename T, typename OnSuccess, bool HasValue = FutureStorage<T>::HasValue>
+struct ContinuationResult {
+  using type = typename std::result_of<OnSuccess && (const T&)>::type;
+};
+
+template <typename T, typename OnSuccess>
+struct ContinuationResult<T, OnSuccess, false> {
+  using type = typename std::result_of<OnSuccess && ()>::type;
+};
+
+template <typename T, typename OnSuccess>
+using ContinuedFutureFor =
+    typename ContinuedFuture<typename ContinuationResult<T, OnSuccess>::type>::type;
+
+// Run a continuation and mark the next Future finished with its outcome
+struct Continue {
+  template <typename NextFuture, typename ContinueFunc, typename... Args>
+  static void Run(NextFuture* next, ContinueFunc&& f, Args&&... args) {
+    using R = typename std::result_of<ContinueFunc && (Args && ...)>::type;
+    RunFor<R>(next, std::forward<ContinueFunc>(f), std::forward<Args>(args)...);
+  }
+
+ private:
+  template <typename R, typename NextFuture, typename ContinueFunc, typename... Args>
+  static typename std::enable_if<std::is_void<R>::value>::type RunFor(
+      NextFuture* next, ContinueFunc&& f, Args&&... args) {
+    std::forward<ContinueFunc>(f)(std::forward<Args>(args)...);
+    next->MarkFinished(Status::OK());
+  }
+
+  template <typename R, typename NextFuture, typename ContinueFunc, typename... Args>
+  static typename std::enable_if<!std::is_void<R>::value &&
+                                 !std::is_same<NextFuture, R>::value>::type
+  RunFor(NextFuture* next, ContinueFunc&& f, Args&&... args) {
+    next->MarkFinished(std::forward<ContinueFunc>(f)(std::forward<Args>(args)...));
+  }
+
+  // A continuation returning a Future finishes the next Future when its own
+  // Future finishes
+  template <typename R, typename NextFuture, typename ContinueFunc, typename... Args>
+  static typename std::enable_if<std::is_same<NextFuture, R>::value>::type RunFor(
+      NextFuture* next, ContinueFunc&& f, Args&&... args) {
+    R inner = std::forward<ContinueFunc>(f)(std::forward<Args>(args)...);
+    NextFuture next_copy = *next;
+    inner.AddCallback(
+        [next_copy](const FutureOutcome<typename R::ValueType>& outcome) mutable {
+          next_copy.MarkFinished(outcome);
+        });
+  }
+};
+
+}  // namespace detail
+
 // ---------------------------------------------------------------------
 // Public API
 
@@ -244,6 +336,8 @@ class Future {
   using EnableResult = typename std::enable_if<HasValue, Result<U>>::type;
 
  public:
+  using ValueType = T;
+
   static constexpr double kInfinity = FutureImpl::kInfinity;
 
   // The default constructor creates an invalid Future.  Use Future::Make()
@@ -310,6 +404,64 @@ class Future {
     return impl_->Wait(seconds);
   }
 
+  /// \brief Run a callback when the Future completes
+  ///
+  /// The callback is passed the Future's Result (or Status, for Future<void>
+  /// and Future<Status>) by const reference.  It is run immediately, in the
+  /// calling thread, if the Future is already finished; otherwise it is run
+  /// by the thread marking the Future finished, after waiters are woken up.
+  /// The callback should be quick and must not block on other Futures.
+  template <typename OnComplete>
+  void AddCallback(OnComplete on_complete) const {
+    CheckValid();
+    // The storage is kept alive by the Future that runs the callback
+    FutureStorage<T>* storage = storage_.get();
+    impl_->AddCallback(
+        [storage, on_complete]() mutable { on_complete(storage->outcome()); });
+  }
+
+  /// \brief The default failure continuation of Then(): pass the error on
+  template <typename OnSuccess>
+  struct PassthruOnFailure {
+    using ContinuedFuture = detail::ContinuedFutureFor<T, OnSuccess>;
+
+    ContinuedFuture operator()(const Status& status) {
+      return ContinuedFuture::MakeFinished(status);
+    }
+  };
+
+  /// \brief Consumer API: chain a continuation to the Future
+  ///
+  /// Return a Future finished with the outcome of `on_success` if the Future
+  /// succeeds, or of `on_failure` if it fails.  `on_success` is passed the
+  /// Future's value by const reference (or nothing, for Future<void> and
+  /// Future<Status>), and `on_failure` is passed its Status.  By default, the
+  /// error is passed on to the returned Future.
+  ///
+  /// The continuations can have the following return types:
+  /// - `void` or `Status`, for a returned `Future<Status>`
+  /// - `U` or `Result<U>`, for a returned `Future<U>`
+  /// - `Future<U>`, for a returned `Future<U>` finished along with it
+  ///
+  /// Like callbacks, continuations are run by the thread marking the Future
+  /// finished, or immediately if it is already finished.  Use
+  /// Executor::Transfer() to run them on an executor instead.
+  template <typename OnSuccess, typename OnFailure = PassthruOnFailure<OnSuccess>,
+            typename ContinuedFuture = detail::ContinuedFutureFor<T, OnSuccess>>
+  ContinuedFuture Then(OnSuccess on_success, OnFailure on_failure = {}) const {
+    static_assert(
+        std::is_same<typename detail::ContinuedFuture<typename std::result_of<
+                         OnFailure && (const Status&)>::type>::type,
+                     ContinuedFuture>::value,
+        "OnSuccess and OnFailure must continue with the same Future type");
+    auto next = ContinuedFuture::Make();
+    AddCallback([next, on_success, on_failure](
+                    const detail::FutureOutcome<T>& outcome) mutable {
+      RunContinuation(&next, std::move(on_success), std::move(on_failure), outcome);
+    });
+    return next;
+  }
+
   /// If a Result<Future> holds an error instead of a Future, construct a finished Future
   /// holding that error.
   static Future DeferNotOk(Result<Future> maybe_future) {
@@ -367,6 +519,26 @@ class Future {
   }
 
  protected:
+  template <typename NextFuture, typename OnSuccess, typename OnFailure, typename U>
+  static void RunContinuation(NextFuture* next, OnSuccess&& on_success,
+                              OnFailure&& on_failure, const Result<U>& result) {
+    if (ARROW_PREDICT_TRUE(result.ok())) {
+      detail::Continue::Run(next, std::forward<OnSuccess>(on_success), *result);
+    } else {
+      detail::Continue::Run(next, std::forward<OnFailure>(on_failure), result.status());
+    }
+  }
+
+  template <typename NextFuture, typename OnSuccess, typename OnFailure>
+  static void RunContinuation(NextFuture* next, OnSuccess&& on_success,
+                              OnFailure&& on_failure, const Status& status) {
+    if (ARROW_PREDICT_TRUE(status.ok())) {
+      detail::Continue::Run(next, std::forward<OnSuccess>(on_success));
+    } else {
+      detail::Continue::Run(next, std::forward<OnFailure>(on_failure), status);
+    }
+  }
+
   void CheckValid() const {
 #ifndef NDEBUG
     if (!is_valid()) {
@@ -427,4 +599,80 @@ inline std::vector<int> WaitForAny(const std::vector<Future<T>*>& futures,
   return waiter->MoveFinishedFutures();
 }
 
+/// \brief Return a Future finished once all the futures are finished.
+///
+/// The returned Future holds the Results of the futures, in order, and
+/// doesn't fail itself.  It is only available for futures with values.
+template <typename T>
+Future<std::vector<Result<T>>> All(std::vector<Future<T>> futures) {
+  struct State {
+    explicit State(std::vector<Future<T>> f)
+        : futures(std::move(f)), num_remaining(futures.size()) {}
+
+    std::vector<Future<T>> futures;
+    std::atomic<size_t> num_remaining;
+  };
+
+  auto out = Future<std::vector<Result<T>>>::Make();
+  if (futures.empty()) {
+    out.MarkFinished(std::vector<Result<T>>{});
+    return out;
+  }
+  auto state = std::make_shared<State>(std::move(futures));
+  for (const auto& future : state->futures) {
+    // The callbacks are released once run, which breaks the reference cycle
+    // between the state and the futures
+    future.AddCallback([state, out](const Result<T>&) mutable {
+      if (state->num_remaining.fetch_sub(1) != 1) {
+        return;
+      }
+      std::vector<Result<T>> results;
+      results.reserve(state->futures.size());
+      for (const auto& finished : state->futures) {
+        results.push_back(finished.result());
+      }
+      out.MarkFinished(std::move(results));
+    });
+  }
+  return out;
+}
+
+/// \brief Return a Future finished once all the futures are finished.
+///
+/// The returned Future fails with the error of the first failed future,
+/// in order.  Unlike WaitForAll(), no thread is blocked while waiting.
+template <typename T>
+Future<Status> AllComplete(const std::vector<Future<T>>& futures) {
+  struct State {
+    explicit State(const std::vector<Future<T>>& f)
+        : futures(f), num_remaining(futures.size()) {}
+
+    std::vector<Future<T>> futures;
+    std::atomic<size_t> num_remaining;
+  };
+
+  auto out = Future<Status>::Make();
+  if (futures.empty()) {
+    out.MarkFinished(Status::OK());
+    return out;
+  }
+  auto state = std::make_shared<State>(futures);
+  for (const auto& future : state->futures) {
+    future.AddCallback([state, out](const detail::FutureOutcome<T>&) mutable {
+      if (state->num_remaining.fetch_sub(1) != 1) {
+        return;
+      }
+      for (const auto& finished : state->futures) {
+        Status st = finished.status();
+        if (!st.ok()) {
+          out.MarkFinished(std::move(st));
+          return;
+        }
+      }
+      out.MarkFinished(Status::OK());
+    });
+  }
+  return out;
+}
+
 }  // namespace arrow
@@ -19,6 +19,7 @@
 #include "arrow/util/future_iterator.h"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <ostream>
@@ -31,6 +32,7 @@
 #include <gtest/gtest.h>
 
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/thread_pool.h"
 
@@ -358,6 +360,209 @@ TEST(FutureSyncTest, Status) {
   }
 }
 
+TEST(FutureSyncTest, AddCallback) {
+  {
+    // Callbacks added before completion
+    auto fut = Future<int>::Make();
+    std::vector<int> values;
+    fut.AddCallback([&](const Result<int>& res) { values.push_back(*res); });
+    fut.AddCallback([&](const Result<int>& res) { values.push_back(*res + 1); });
+    ASSERT_EQ(values.size(), 0);
+    fut.MarkFinished(42);
+    ASSERT_EQ(values, std::vector<int>({42, 43}));
+    // Callback added after completion
+    fut.AddCallback([&](const Result<int>& res) { values.push_back(*res + 2); });
+    ASSERT_EQ(values, std::vector<int>({42, 43, 44}));
+  }
+  {
+    auto fut = Future<MoveOnlyDataType>::Make();
+    Status st;
+    fut.AddCallback([&](const Result<MoveOnlyDataType>& res) { st = res.status(); });
+    fut.MarkFinished(Status::IOError("xxx"));
+    ASSERT_RAISES(IOError, st);
+  }
+  {
+    auto fut = Future<void>::Make();
+    bool called = false;
+    fut.AddCallback([&](const Status& st) { called = st.ok(); });
+    fut.MarkFinished();
+    ASSERT_TRUE(called);
+  }
+  {
+    auto fut = Future<Status>::Make();
+    Status st;
+    fut.AddCallback([&](const Status& res) { st = res; });
+    fut.MarkFinished(Status::IOError("xxx"));
+    ASSERT_RAISES(IOError, st);
+  }
+  {
+    // A callback can chain another future
+    auto fut = Future<int>::Make();
+    auto chained = Future<int>::Make();
+    fut.AddCallback([chained](const Result<int>& res) mutable {
+      chained.MarkFinished(*res * 2);
+    });
+    fut.MarkFinished(21);
+    AssertSuccessful(chained);
+    ASSERT_EQ(*chained.result(), 42);
+  }
+}
+
+TEST(FutureSyncTest, AddCallbackConcurrently) {
+  for (int i = 0; i < 100; ++i) {
+    auto fut = Future<int>::Make();
+    std::atomic<int> calls{0};
+    std::thread producer([&] { fut.MarkFinished(i); });
+    for (int j = 0; j < 10; ++j) {
+      fut.AddCallback([&](const Result<int>& res) { ++calls; });
+    }
+    producer.join();
+    ASSERT_EQ(calls.load(), 10);
+  }
+}
+
+TEST(FutureSyncTest, Then) {
+  {
+    // Continuations returning a value
+    auto fut = Future<int>::Make();
+    Future<std::string> next = fut.Then([](const int& x) { return std::to_string(x); });
+    AssertNotFinished(next);
+    fut.MarkFinished(42);
+    AssertSuccessful(next);
+    ASSERT_EQ(*next.result(), "42");
+  }
+  {
+    // Continuations returning a Result
+    auto fut = Future<int>::MakeFinished(-1);
+    Future<int> next = fut.Then([](const int& x) -> Result<int> {
+      if (x < 0) {
+        return Status::Invalid("negative");
+      }
+      return x;
+    });
+    AssertFailed(next);
+    ASSERT_RAISES(Invalid, next.status());
+  }
+  {
+    // Continuations returning void or Status
+    auto fut = Future<int>::Make();
+    int seen = 0;
+    Future<Status> next = fut.Then([&](const int& x) { seen = x; });
+    Future<Status> failed =
+        fut.Then([](const int&) { return Status::IOError("xxx"); });
+    fut.MarkFinished(42);
+    ASSERT_OK(next.status());
+    ASSERT_EQ(seen, 42);
+    ASSERT_RAISES(IOError, failed.status());
+  }
+  {
+    // Continuations of a Future<Status> take no argument
+    auto fut = Future<Status>::Make();
+    Future<int> next = fut.Then([]() { return 1; });
+    fut.MarkFinished(Status::OK());
+    ASSERT_EQ(*next.result(), 1);
+  }
+  {
+    // Errors are passed on by default
+    auto fut = Future<int>::Make();
+    bool called = false;
+    Future<int> next = fut.Then([&](const int& x) {
+      called = true;
+      return x;
+    });
+    fut.MarkFinished(Status::IOError("xxx"));
+    ASSERT_RAISES(IOError, next.status());
+    ASSERT_FALSE(called);
+  }
+  {
+    // Or handled by a failure continuation
+    auto fut = Future<int>::MakeFinished(Status::IOError("xxx"));
+    Future<int> next = fut.Then([](const int& x) { return x; },
+                                [](const Status& st) { return st.IsIOError() ? 0 : 1; });
+    ASSERT_EQ(*next.result(), 0);
+  }
+}
+
+TEST(FutureSyncTest, ThenFlattensFutures) {
+  auto fut = Future<int>::Make();
+  auto inner = Future<std::string>::Make();
+  Future<std::string> next = fut.Then([inner](const int&) { return inner; });
+  fut.MarkFinished(1);
+  AssertNotFinished(next);
+  inner.MarkFinished("xxx");
+  AssertSuccessful(next);
+  ASSERT_EQ(*next.result(), "xxx");
+
+  // Chains of continuations
+  auto first = Future<int>::Make();
+  auto last = first.Then([](const int& x) { return Future<int>::MakeFinished(x + 1); })
+                  .Then([](const int& x) { return x * 2; });
+  first.MarkFinished(2);
+  ASSERT_EQ(*last.result(), 6);
+}
+
+TEST(FutureSyncTest, All) {
+  std::vector<Future<int>> futures{Future<int>::Make(), Future<int>::Make(),
+                                   Future<int>::Make()};
+  auto all = All(futures);
+  auto all_complete = AllComplete(futures);
+  futures[2].MarkFinished(2);
+  futures[0].MarkFinished(Status::IOError("xxx"));
+  AssertNotFinished(all);
+  AssertNotFinished(all_complete);
+  futures[1].MarkFinished(1);
+
+  AssertSuccessful(all);
+  const auto& results = *all.result();
+  ASSERT_EQ(results.size(), 3);
+  ASSERT_RAISES(IOError, results[0].status());
+  ASSERT_EQ(*results[1], 1);
+  ASSERT_EQ(*results[2], 2);
+  ASSERT_RAISES(IOError, all_complete.status());
+
+  AssertSuccessful(All(std::vector<Future<int>>{}));
+  ASSERT_OK(AllComplete(std::vector<Future<void>>{}).status());
+}
+
+TEST(FutureSyncTest, AsyncGenerator) {
+  auto generator = MakeVectorGenerator<std::shared_ptr<int>>(
+      {std::make_shared<int>(1), std::make_shared<int>(2), std::make_shared<int>(3)});
+  auto mapped = MakeMappedGenerator(generator, [](const std::shared_ptr<int>& x) {
+    return std::make_shared<std::string>(std::to_string(*x));
+  });
+  auto collected = CollectAsyncGenerator(mapped);
+  AssertSuccessful(collected);
+  const auto& strings = *collected.result();
+  ASSERT_EQ(strings.size(), 3);
+  ASSERT_EQ(*strings[0], "1");
+  ASSERT_EQ(*strings[2], "3");
+
+  // Errors of the visitor end the visit
+  int visited = 0;
+  auto visit = VisitAsyncGenerator(
+      MakeVectorGenerator<std::shared_ptr<int>>(
+          {std::make_shared<int>(1), std::make_shared<int>(2)}),
+      [&](const std::shared_ptr<int>&) {
+        ++visited;
+        return Status::Invalid("xxx");
+      });
+  ASSERT_RAISES(Invalid, visit.status());
+  ASSERT_EQ(visited, 1);
+}
+
+TEST(FutureSyncTest, VisitLongAsyncGenerator) {
+  // Finished futures are visited without growing the stack
+  std::vector<std::shared_ptr<int>> values(100000, std::make_shared<int>(1));
+  int64_t sum = 0;
+  auto visit = VisitAsyncGenerator(MakeVectorGenerator(std::move(values)),
+                                   [&](const std::shared_ptr<int>& x) {
+                                     sum += *x;
+                                     return Status::OK();
+                                   });
+  ASSERT_OK(visit.status());
+  ASSERT_EQ(sum, 100000);
+}
+
 // --------------------------------------------------------------------
 // Tests with an executor
 
@@ -711,4 +916,26 @@ TYPED_TEST(FutureIteratorTest, ErrorsAsCompleted) { this->TestErrorsAsCompleted(
 
 TYPED_TEST(FutureIteratorTest, StressAsCompleted) { this->TestStressAsCompleted(); }
 
+TEST(FutureTransferTest, ContinuationsRunOnExecutor) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(/*threads=*/1));
+  ASSERT_OK_AND_ASSIGN(auto pool_thread_id, pool->Submit([] {
+    return std::this_thread::get_id();
+  }).ValueOrDie().result());
+
+  auto fut = Future<int>::Make();
+  auto next = pool->Transfer(fut).Then([](const int& x) {
+    return std::make_pair(x, std::this_thread::get_id());
+  });
+  fut.MarkFinished(42);
+  ASSERT_OK_AND_ASSIGN(auto pair, next.result());
+  ASSERT_EQ(pair.first, 42);
+  ASSERT_EQ(pair.second, pool_thread_id);
+
+  // Errors are transferred too
+  auto failed = Future<Status>::Make();
+  auto transferred = pool->Transfer(failed);
+  failed.MarkFinished(Status::IOError("xxx"));
+  ASSERT_RAISES(IOError, transferred.status());
+}
+
 }  // namespace arrow
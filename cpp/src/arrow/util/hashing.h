@@ -41,6 +41,7 @@
 #include "arrow/util/bitmap_builders.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/simd.h"
 #include "arrow/util/ubsan.h"
 
 #define XXH_INLINE_ALL
@@ -363,6 +364,265 @@ class HashTable {
   TypedBufferBuilder<Entry> entries_builder_;
 };
 
+// ----------------------------------------------------------------------
+// An open-addressing insert-only hash table (no deletes) with a Swiss table
+// layout
+//
+// Each slot has a control byte, which is either kEmpty or 7 bits of the hash
+// of its entry.  A lookup compares the control bytes of a whole group of
+// slots at once (with SIMD instructions if available), so that entries are
+// only read for likely matches, and an empty slot in the group ends it.
+// The control bytes of the first group are cloned after the last slot, so
+// that groups can start at any slot.
+//
+// The interface is the same as HashTable's.
+
+namespace detail {
+
+#if defined(ARROW_HAVE_SSE4_2)
+
+// A group of control bytes, compared with SSE2
+struct SwissControlGroup {
+  static constexpr int kWidth = 16;
+  // The number of bits per slot in the masks, as a shift
+  static constexpr int kMaskShift = 0;
+
+  explicit SwissControlGroup(const uint8_t* control)
+      : control_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control))) {}
+
+  // A mask of the slots whose control byte may be `h2`
+  uint64_t Match(uint8_t h2) const {
+    const auto match = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(h2)), control_);
+    return static_cast<uint32_t>(_mm_movemask_epi8(match));
+  }
+
+  // A mask of the empty slots
+  uint64_t MatchEmpty() const {
+    return static_cast<uint32_t>(_mm_movemask_epi8(control_));
+  }
+
+  __m128i control_;
+};
+
+#else
+
+// A group of control bytes, compared with 64-bit integer arithmetic
+struct SwissControlGroup {
+  static constexpr int kWidth = 8;
+  static constexpr int kMaskShift = 3;
+  static constexpr uint64_t kLsbs = 0x0101010101010101ULL;
+  static constexpr uint64_t kMsbs = 0x8080808080808080ULL;
+
+  explicit SwissControlGroup(const uint8_t* control)
+      : control_(BitUtil::FromLittleEndian(util::SafeLoadAs<uint64_t>(control))) {}
+
+  // This may have false positives (but no false negatives), which are
+  // eliminated by comparing the hashes of the entries.
+  uint64_t Match(uint8_t h2) const {
+    const uint64_t x = control_ ^ (kLsbs * h2);
+    return (x - kLsbs) & ~x & kMsbs;
+  }
+
+  // Only empty slots have the high bit of their control byte set
+  uint64_t MatchEmpty() const { return control_ & kMsbs; }
+
+  uint64_t control_;
+};
+
+#endif
+
+}  // namespace detail
+
+template <typename Payload>
+class SwissHashTable {
+ public:
+  static constexpr hash_t kSentinel = 0ULL;
+  static constexpr uint8_t kEmpty = 0x80;
+
+  struct Entry {
+    hash_t h;
+    Payload payload;
+
+    // An entry is valid if the hash is different from the sentinel value
+    operator bool() const { return h != kSentinel; }
+  };
+
+  SwissHashTable(MemoryPool* pool, uint64_t capacity)
+      : entries_builder_(pool), control_builder_(pool) {
+    DCHECK_NE(pool, nullptr);
+    // Minimum of 32 elements
+    capacity = std::max<uint64_t>(capacity, 32UL);
+    capacity_ = BitUtil::NextPower2(capacity);
+    capacity_mask_ = capacity_ - 1;
+    size_ = 0;
+
+    DCHECK_OK(UpsizeBuffers(capacity_));
+  }
+
+  // Lookup with group probing
+  // cmp_func should have signature bool(const Payload*).
+  // Return a (Entry*, found) pair.
+  template <typename CmpFunc>
+  std::pair<Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) {
+    auto p = Lookup<DoCompare, CmpFunc>(h, control_, entries_, capacity_mask_,
+                                        std::forward<CmpFunc>(cmp_func));
+    return {&entries_[p.first], p.second};
+  }
+
+  template <typename CmpFunc>
+  std::pair<const Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) const {
+    auto p = Lookup<DoCompare, CmpFunc>(h, control_, entries_, capacity_mask_,
+                                        std::forward<CmpFunc>(cmp_func));
+    return {&entries_[p.first], p.second};
+  }
+
+  Status Insert(Entry* entry, hash_t h, const Payload& payload) {
+    const uint64_t index = static_cast<uint64_t>(entry - entries_);
+    // Ensure entry is empty before inserting
+    assert(control_[index] == kEmpty);
+    entry->h = FixHash(h);
+    entry->payload = payload;
+    SetControl(control_, capacity_, index, entry->h);
+    ++size_;
+
+    if (ARROW_PREDICT_FALSE(NeedUpsizing())) {
+      return Upsize(capacity_ * 2);
+    }
+    return Status::OK();
+  }
+
+  uint64_t size() const { return size_; }
+
+  // Visit all non-empty entries in the table
+  // The visit_func should have signature void(const Entry*)
+  template <typename VisitFunc>
+  void VisitEntries(VisitFunc&& visit_func) const {
+    for (uint64_t i = 0; i < capacity_; i++) {
+      if (control_[i] != kEmpty) {
+        visit_func(&entries_[i]);
+      }
+    }
+  }
+
+ protected:
+  using Group = detail::SwissControlGroup;
+
+  // NoCompare is for when the value is known not to exist in the table
+  enum CompareKind { DoCompare, NoCompare };
+
+  // The high bits of the hash choose the first group, the low bits are
+  // stored in the control bytes
+  static uint64_t H1(hash_t h) { return h >> 7; }
+  static uint8_t H2(hash_t h) { return static_cast<uint8_t>(h & 0x7f); }
+
+  static uint64_t NextSlot(uint64_t* mask) {
+    const uint64_t slot = BitUtil::CountTrailingZeros(*mask) >> Group::kMaskShift;
+    *mask &= *mask - 1;
+    return slot;
+  }
+
+  // The workhorse lookup function
+  template <CompareKind CKind, typename CmpFunc>
+  std::pair<uint64_t, bool> Lookup(hash_t h, const uint8_t* control,
+                                   const Entry* entries, uint64_t size_mask,
+                                   CmpFunc&& cmp_func) const {
+    h = FixHash(h);
+    const uint8_t h2 = H2(h);
+    uint64_t position = H1(h) & size_mask;
+    uint64_t stride = 0;
+
+    while (true) {
+      const Group group(control + position);
+      if (CKind == DoCompare) {
+        uint64_t match = group.Match(h2);
+        while (match != 0) {
+          const uint64_t index = (position + NextSlot(&match)) & size_mask;
+          const Entry* entry = &entries[index];
+          if (entry->h == h && cmp_func(&entry->payload)) {
+            return {index, true};
+          }
+        }
+      }
+      uint64_t empty = group.MatchEmpty();
+      if (empty != 0) {
+        return {(position + NextSlot(&empty)) & size_mask, false};
+      }
+      // Triangular probing over groups, which visits all of them as the
+      // capacity is a power of two
+      stride += Group::kWidth;
+      position = (position + stride) & size_mask;
+    }
+  }
+
+  static void SetControl(uint8_t* control, uint64_t capacity, uint64_t index,
+                         hash_t h) {
+    control[index] = H2(h);
+    if (index < static_cast<uint64_t>(Group::kWidth)) {
+      control[capacity + index] = H2(h);
+    }
+  }
+
+  bool NeedUpsizing() const {
+    // Keep the load factor <= 7/8
+    return size_ * 8 >= capacity_ * 7;
+  }
+
+  Status UpsizeBuffers(uint64_t capacity) {
+    // Entries are only read once their control byte is set
+    RETURN_NOT_OK(entries_builder_.Resize(capacity));
+    entries_ = entries_builder_.mutable_data();
+    RETURN_NOT_OK(control_builder_.Resize(capacity + Group::kWidth));
+    control_ = control_builder_.mutable_data();
+    memset(control_, kEmpty, capacity + Group::kWidth);
+
+    return Status::OK();
+  }
+
+  Status Upsize(uint64_t new_capacity) {
+    assert(new_capacity > capacity_);
+    uint64_t new_mask = new_capacity - 1;
+    assert((new_capacity & new_mask) == 0);  // it's a power of two
+
+    // Stash old entries and seal builders, effectively resetting the Buffers
+    const Entry* old_entries = entries_;
+    const uint8_t* old_control = control_;
+    std::shared_ptr<Buffer> previous_entries, previous_control;
+    RETURN_NOT_OK(entries_builder_.Finish(&previous_entries));
+    RETURN_NOT_OK(control_builder_.Finish(&previous_control));
+    // Allocate new buffers
+    RETURN_NOT_OK(UpsizeBuffers(new_capacity));
+
+    for (uint64_t i = 0; i < capacity_; i++) {
+      if (old_control[i] != kEmpty) {
+        const auto& entry = old_entries[i];
+        // Dummy compare function will not be called
+        auto p = Lookup<NoCompare>(entry.h, control_, entries_, new_mask,
+                                   [](const Payload*) { return false; });
+        assert(!p.second);
+        entries_[p.first] = entry;
+        SetControl(control_, new_capacity, p.first, entry.h);
+      }
+    }
+    capacity_ = new_capacity;
+    capacity_mask_ = new_mask;
+
+    return Status::OK();
+  }
+
+  hash_t FixHash(hash_t h) const { return (h == kSentinel) ? 42U : h; }
+
+  // The number of slots available in the hash table array.
+  uint64_t capacity_;
+  uint64_t capacity_mask_;
+  // The number of used slots in the hash table array.
+  uint64_t size_;
+
+  Entry* entries_;
+  uint8_t* control_;
+  TypedBufferBuilder<Entry> entries_builder_;
+  TypedBufferBuilder<uint8_t> control_builder_;
+};
+
 // XXX typedef memo_index_t int32_t ?
 
 constexpr int32_t kKeyNotFound = -1;
@@ -383,7 +643,8 @@ class MemoTable {
 // The memoization table remembers and allows to look up the insertion
 // index for each key.
 
-template <typename Scalar, template <class> class HashTableTemplateType = HashTable>
+template <typename Scalar,
+          template <class> class HashTableTemplateType = SwissHashTable>
 class ScalarMemoTable : public MemoTable {
  public:
   explicit ScalarMemoTable(MemoryPool* pool, int64_t entries = 0)
@@ -502,7 +763,8 @@ struct SmallScalarTraits<Scalar, enable_if_t<std::is_integral<Scalar>::value>> {
   static uint32_t AsIndex(Scalar value) { return static_cast<Unsigned>(value); }
 };
 
-template <typename Scalar, template <class> class HashTableTemplateType = HashTable>
+template <typename Scalar,
+          template <class> class HashTableTemplateType = SwissHashTable>
 class SmallScalarMemoTable : public MemoTable {
  public:
   explicit SmallScalarMemoTable(MemoryPool* pool, int64_t entries = 0) {
@@ -589,7 +851,8 @@ class SmallScalarMemoTable : public MemoTable {
 // ----------------------------------------------------------------------
 // A memoization table for variable-sized binary data.
 
-template <typename BinaryBuilderT>
+template <typename BinaryBuilderT,
+          template <class> class HashTableTemplateType = SwissHashTable>
 class BinaryMemoTable : public MemoTable {
  public:
   using builder_offset_type = typename BinaryBuilderT::offset_type;
@@ -603,7 +866,7 @@ class BinaryMemoTable : public MemoTable {
 
   int32_t Get(const void* data, builder_offset_type length) const {
     hash_t h = ComputeStringHash<0>(data, length);
-    auto p = Lookup(h, data, length);
+    auto p = Lookup(h, data, length, Prefix(data, length));
     if (p.second) {
       return p.first->payload.memo_index;
     } else {
@@ -619,7 +882,8 @@ class BinaryMemoTable : public MemoTable {
   Status GetOrInsert(const void* data, builder_offset_type length, Func1&& on_found,
                      Func2&& on_not_found, int32_t* out_memo_index) {
     hash_t h = ComputeStringHash<0>(data, length);
-    auto p = Lookup(h, data, length);
+    const uint64_t prefix = Prefix(data, length);
+    auto p = Lookup(h, data, length, prefix);
     int32_t memo_index;
     if (p.second) {
       memo_index = p.first->payload.memo_index;
@@ -629,8 +893,8 @@ class BinaryMemoTable : public MemoTable {
       // Insert string value
       RETURN_NOT_OK(binary_builder_.Append(static_cast<const char*>(data), length));
       // Insert hash entry
-      RETURN_NOT_OK(
-          hash_table_.Insert(const_cast<HashTableEntry*>(p.first), h, {memo_index}));
+      RETURN_NOT_OK(hash_table_.Insert(const_cast<HashTableEntry*>(p.first), h,
+                                       {memo_index, length, prefix}));
 
       on_not_found(memo_index);
     }
@@ -794,23 +1058,46 @@ class BinaryMemoTable : public MemoTable {
   }
 
  protected:
+  // The first bytes of values are stored inline, so that short values are
+  // compared without reading the binary builder
+  static constexpr builder_offset_type kPrefixSize = 8;
+
   struct Payload {
     int32_t memo_index;
+    builder_offset_type length;
+    uint64_t prefix;
   };
 
-  using HashTableType = HashTable<Payload>;
-  using HashTableEntry = typename HashTable<Payload>::Entry;
+  using HashTableType = HashTableTemplateType<Payload>;
+  using HashTableEntry = typename HashTableType::Entry;
   HashTableType hash_table_;
   BinaryBuilderT binary_builder_;
 
   int32_t null_index_ = kKeyNotFound;
 
+  static uint64_t Prefix(const void* data, builder_offset_type length) {
+    uint64_t prefix = 0;
+    if (length > 0) {
+      memcpy(&prefix, data,
+             static_cast<size_t>(length < kPrefixSize ? length : kPrefixSize));
+    }
+    return prefix;
+  }
+
   std::pair<const HashTableEntry*, bool> Lookup(hash_t h, const void* data,
-                                                builder_offset_type length) const {
+                                                builder_offset_type length,
+                                                uint64_t prefix) const {
     auto cmp_func = [=](const Payload* payload) {
-      util::string_view lhs = binary_builder_.GetView(payload->memo_index);
-      util::string_view rhs(static_cast<const char*>(data), length);
-      return lhs == rhs;
+      if (payload->length != length || payload->prefix != prefix) {
+        return false;
+      }
+      if (length <= kPrefixSize) {
+        return true;
+      }
+      const uint8_t* lhs =
+          binary_builder_.value_data() + binary_builder_.offset(payload->memo_index);
+      return memcmp(lhs + kPrefixSize, static_cast<const uint8_t*>(data) + kPrefixSize,
+                    static_cast<size_t>(length - kPrefixSize)) == 0;
     };
     return hash_table_.Lookup(h, cmp_func);
   }
@@ -833,7 +1120,7 @@ struct HashTraits<T, enable_if_8bit_int<T>> {
 template <typename T>
 struct HashTraits<T, enable_if_t<has_c_type<T>::value && !is_8bit_int<T>::value>> {
   using c_type = typename T::c_type;
-  using MemoTableType = ScalarMemoTable<c_type, HashTable>;
+  using MemoTableType = ScalarMemoTable<c_type>;
 };
 
 template <typename T>
@@ -24,6 +24,8 @@
 
 #include "benchmark/benchmark.h"
 
+#include "arrow/array/builder_binary.h"
+#include "arrow/memory_pool.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/hashing.h"
 
@@ -111,6 +113,58 @@ static void HashLargeStrings(benchmark::State& state) {  // NOLINT non-const ref
   BenchmarkStringHashing(state, values);
 }
 
+// ----------------------------------------------------------------------
+// Memo table benchmarks, comparing the linear probing and Swiss table layouts
+
+template <template <class> class HashTableTemplateType>
+static void BenchmarkIntegerMemoTable(benchmark::State& state) {  // NOLINT
+  // Mostly distinct values, so that the table doesn't fit in cache
+  const auto n_values = static_cast<int32_t>(state.range(0));
+  const std::vector<int64_t> values = MakeIntegers<int64_t>(n_values);
+
+  while (state.KeepRunning()) {
+    ScalarMemoTable<int64_t, HashTableTemplateType> table(default_memory_pool());
+    for (const int64_t v : values) {
+      int32_t memo_index;
+      ABORT_NOT_OK(table.GetOrInsert(v, &memo_index));
+      benchmark::DoNotOptimize(memo_index);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <template <class> class HashTableTemplateType>
+static void BenchmarkStringMemoTable(benchmark::State& state) {  // NOLINT
+  const auto n_values = static_cast<int32_t>(state.range(0));
+  const std::vector<std::string> values = MakeStrings(n_values, 2, 20);
+
+  while (state.KeepRunning()) {
+    BinaryMemoTable<BinaryBuilder, HashTableTemplateType> table(default_memory_pool());
+    for (const std::string& v : values) {
+      int32_t memo_index;
+      ABORT_NOT_OK(table.GetOrInsert(v, &memo_index));
+      benchmark::DoNotOptimize(memo_index);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void IntegerMemoTableLinear(benchmark::State& state) {  // NOLINT
+  BenchmarkIntegerMemoTable<HashTable>(state);
+}
+
+static void IntegerMemoTableSwiss(benchmark::State& state) {  // NOLINT
+  BenchmarkIntegerMemoTable<SwissHashTable>(state);
+}
+
+static void StringMemoTableLinear(benchmark::State& state) {  // NOLINT
+  BenchmarkStringMemoTable<HashTable>(state);
+}
+
+static void StringMemoTableSwiss(benchmark::State& state) {  // NOLINT
+  BenchmarkStringMemoTable<SwissHashTable>(state);
+}
+
 // ----------------------------------------------------------------------
 // Benchmark declarations
 
@@ -119,5 +173,10 @@ BENCHMARK(HashSmallStrings);
 BENCHMARK(HashMediumStrings);
 BENCHMARK(HashLargeStrings);
 
+BENCHMARK(IntegerMemoTableLinear)->Range(1 << 10, 1 << 22);
+BENCHMARK(IntegerMemoTableSwiss)->Range(1 << 10, 1 << 22);
+BENCHMARK(StringMemoTableLinear)->Range(1 << 10, 1 << 20);
+BENCHMARK(StringMemoTableSwiss)->Range(1 << 10, 1 << 20);
+
 }  // namespace internal
 }  // namespace arrow
@@ -374,6 +374,33 @@ TEST(ScalarMemoTable, StressInt64) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+template <template <class> class HashTableTemplateType>
+void CheckDistinctInt64(int32_t n_values) {
+  // Enough values to upsize the hash table a number of times
+  const auto values = MakeDistinctIntegers<int64_t>(n_values);
+  ScalarMemoTable<int64_t, HashTableTemplateType> table(default_memory_pool(), 0);
+  int32_t expected = 0;
+  for (const auto value : values) {
+    AssertGetOrInsert(table, value, expected++);
+  }
+  expected = 0;
+  for (const auto value : values) {
+    AssertGet(table, value, expected++);
+  }
+  AssertGet(table, std::numeric_limits<int64_t>::min(), kKeyNotFound);
+  ASSERT_EQ(table.size(), n_values);
+}
+
+TEST(ScalarMemoTable, DistinctInt64) {
+#ifdef ARROW_VALGRIND
+  const int32_t n_values = 1000;
+#else
+  const int32_t n_values = 100000;
+#endif
+  CheckDistinctInt64<HashTable>(n_values);
+  CheckDistinctInt64<SwissHashTable>(n_values);
+}
+
 TEST(BinaryMemoTable, Basics) {
   std::string A = "", B = "a", C = "foo", D = "bar", E, F;
   E += '\0';
@@ -478,5 +505,30 @@ TEST(BinaryMemoTable, Stress) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+TEST(BinaryMemoTable, CommonPrefixes) {
+  // Values only differing after their inline prefix, or by their length
+  const std::string prefix = "common prefix";
+  std::vector<std::string> values;
+  for (int32_t length = 0; length <= static_cast<int32_t>(prefix.size()); ++length) {
+    values.push_back(prefix.substr(0, length));
+  }
+  for (char c = 'a'; c <= 'z'; ++c) {
+    values.push_back(prefix + c);
+    values.push_back(prefix + '\0' + c);
+  }
+
+  BinaryMemoTable<BinaryBuilder> table(default_memory_pool(), 0);
+  int32_t expected = 0;
+  for (const auto& value : values) {
+    AssertGetOrInsert(table, value, expected++);
+  }
+  expected = 0;
+  for (const auto& value : values) {
+    AssertGet(table, value, expected++);
+  }
+  AssertGet(table, prefix + '\0', kKeyNotFound);
+  ASSERT_EQ(table.size(), static_cast<int32_t>(values.size()));
+}
+
 }  // namespace internal
 }  // namespace arrow
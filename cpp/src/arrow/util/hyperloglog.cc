@@ -0,0 +1,120 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/hyperloglog.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// Serialized layout: a format version byte, the precision byte, then one
+// byte per register
+constexpr uint8_t kSerializationVersion = 1;
+
+}  // namespace
+
+constexpr int HyperLogLog::kMinPrecision;
+constexpr int HyperLogLog::kMaxPrecision;
+constexpr int HyperLogLog::kDefaultPrecision;
+
+HyperLogLog::HyperLogLog(int precision)
+    : precision_(precision), registers_(size_t(1) << precision, 0) {}
+
+Result<HyperLogLog> HyperLogLog::Make(int precision) {
+  if (precision < kMinPrecision || precision > kMaxPrecision) {
+    return Status::Invalid("HyperLogLog precision must be between ", kMinPrecision,
+                           " and ", kMaxPrecision, ", got ", precision);
+  }
+  return HyperLogLog(precision);
+}
+
+Status HyperLogLog::Merge(const HyperLogLog& other) {
+  if (other.precision_ != precision_) {
+    return Status::Invalid("Cannot merge HyperLogLog sketches of precision ",
+                           precision_, " and ", other.precision_);
+  }
+  for (size_t i = 0; i < registers_.size(); ++i) {
+    registers_[i] = std::max(registers_[i], other.registers_[i]);
+  }
+  return Status::OK();
+}
+
+double HyperLogLog::Estimate() const {
+  const double m = static_cast<double>(registers_.size());
+  double alpha;
+  switch (precision_) {
+    case 4:
+      alpha = 0.673;
+      break;
+    case 5:
+      alpha = 0.697;
+      break;
+    case 6:
+      alpha = 0.709;
+      break;
+    default:
+      alpha = 0.7213 / (1.0 + 1.079 / m);
+      break;
+  }
+
+  double sum = 0;
+  int64_t num_zeros = 0;
+  for (uint8_t reg : registers_) {
+    sum += std::ldexp(1.0, -static_cast<int>(reg));
+    num_zeros += reg == 0;
+  }
+  const double estimate = alpha * m * m / sum;
+  if (estimate <= 2.5 * m && num_zeros > 0) {
+    // Small range correction: linear counting
+    return m * std::log(m / static_cast<double>(num_zeros));
+  }
+  // With 64-bit hashes, no large range correction is needed
+  return estimate;
+}
+
+std::string HyperLogLog::Serialize() const {
+  std::string out;
+  out.reserve(2 + registers_.size());
+  out.push_back(static_cast<char>(kSerializationVersion));
+  out.push_back(static_cast<char>(precision_));
+  out.append(reinterpret_cast<const char*>(registers_.data()), registers_.size());
+  return out;
+}
+
+Result<HyperLogLog> HyperLogLog::Deserialize(util::string_view bytes) {
+  if (bytes.size() < 2) {
+    return Status::Invalid("Serialized HyperLogLog is truncated");
+  }
+  if (static_cast<uint8_t>(bytes[0]) != kSerializationVersion) {
+    return Status::Invalid("Unsupported serialized HyperLogLog version ",
+                           static_cast<int>(static_cast<uint8_t>(bytes[0])));
+  }
+  ARROW_ASSIGN_OR_RAISE(auto sketch, Make(static_cast<uint8_t>(bytes[1])));
+  if (bytes.size() != 2 + sketch.registers_.size()) {
+    return Status::Invalid("Serialized HyperLogLog has ", bytes.size(),
+                           " bytes, expected ", 2 + sketch.registers_.size());
+  }
+  std::copy(bytes.begin() + 2, bytes.end(), sketch.registers_.begin());
+  return sketch;
+}
+
+}  // namespace internal
+}  // namespace arrow
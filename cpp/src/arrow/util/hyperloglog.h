@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief A HyperLogLog sketch estimating the number of distinct values seen
+///
+/// Values are added by their 64-bit hash. The sketch uses 2^precision bytes
+/// and has a relative standard error of about 1.04 / sqrt(2^precision).
+/// Sketches of the same precision can be merged, and serialized to bytes to
+/// be shipped to another process.
+class ARROW_EXPORT HyperLogLog {
+ public:
+  static constexpr int kMinPrecision = 4;
+  static constexpr int kMaxPrecision = 18;
+  static constexpr int kDefaultPrecision = 11;
+
+  /// \brief Construct an empty sketch. The precision must be between
+  /// kMinPrecision and kMaxPrecision (checked by Make()).
+  explicit HyperLogLog(int precision = kDefaultPrecision);
+
+  /// \brief Construct an empty sketch, validating the precision
+  static Result<HyperLogLog> Make(int precision);
+
+  /// \brief Add a value by its hash (e.g. from ScalarHelper::ComputeHash)
+  void Update(uint64_t hash) {
+    // Finalize the hash so that its top bits are well distributed even if the
+    // input hash only mixes well in the low bits
+    hash = Mix(hash);
+    const uint64_t index = hash >> (64 - precision_);
+    // Guard bit, so that the rank is at most 64 - precision + 1
+    const uint64_t rest = (hash << precision_) | (uint64_t(1) << (precision_ - 1));
+    const auto rank = static_cast<uint8_t>(BitUtil::CountLeadingZeros(rest) + 1);
+    if (rank > registers_[index]) {
+      registers_[index] = rank;
+    }
+  }
+
+  /// \brief Merge another sketch of the same precision into this one
+  Status Merge(const HyperLogLog& other);
+
+  /// \brief Estimate the number of distinct values added
+  double Estimate() const;
+
+  int precision() const { return precision_; }
+
+  /// \brief Serialize the sketch to bytes
+  std::string Serialize() const;
+
+  /// \brief Reconstruct a sketch from the output of Serialize()
+  static Result<HyperLogLog> Deserialize(util::string_view bytes);
+
+ private:
+  static uint64_t Mix(uint64_t h) {
+    // The MurmurHash3 64-bit finalizer
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+  }
+
+  int precision_;
+  std::vector<uint8_t> registers_;
+};
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/hyperloglog.h"
+
+namespace arrow {
+namespace internal {
+
+uint64_t HashOf(int64_t value) { return ScalarHelper<int64_t, 0>::ComputeHash(value); }
+
+// The relative standard error is about 1.04 / sqrt(2^precision); allow
+// four of them
+void AssertEstimateNear(const HyperLogLog& sketch, double expected) {
+  const double tolerance = 4 * 1.04 / std::sqrt(double(1 << sketch.precision()));
+  ASSERT_NEAR(sketch.Estimate(), expected, expected * tolerance);
+}
+
+TEST(HyperLogLog, Empty) {
+  HyperLogLog sketch;
+  ASSERT_EQ(sketch.Estimate(), 0);
+}
+
+TEST(HyperLogLog, SmallCardinality) {
+  HyperLogLog sketch;
+  for (int repeat = 0; repeat < 10; ++repeat) {
+    for (int64_t i = 0; i < 100; ++i) {
+      sketch.Update(HashOf(i));
+    }
+  }
+  // Linear counting is nearly exact for few values
+  ASSERT_NEAR(sketch.Estimate(), 100, 3);
+}
+
+TEST(HyperLogLog, LargeCardinality) {
+  for (int precision : {HyperLogLog::kMinPrecision, 11, HyperLogLog::kMaxPrecision}) {
+    SCOPED_TRACE("precision = " + std::to_string(precision));
+    ASSERT_OK_AND_ASSIGN(auto sketch, HyperLogLog::Make(precision));
+    // Multiples of a power of two used to share the top hash bits
+    for (int64_t i = 0; i < 500000; ++i) {
+      sketch.Update(HashOf(i << 16));
+    }
+    AssertEstimateNear(sketch, 500000);
+  }
+}
+
+TEST(HyperLogLog, Merge) {
+  HyperLogLog left, right, all;
+  std::mt19937_64 rng(42);
+  for (int i = 0; i < 200000; ++i) {
+    const auto hash = HashOf(static_cast<int64_t>(rng() % 100000));
+    (i % 2 ? left : right).Update(hash);
+    all.Update(hash);
+  }
+  ASSERT_OK(left.Merge(right));
+  ASSERT_EQ(left.Estimate(), all.Estimate());
+  AssertEstimateNear(left, 100000 * (1 - std::exp(-2.0)));
+
+  HyperLogLog other_precision(12);
+  ASSERT_RAISES(Invalid, left.Merge(other_precision));
+}
+
+TEST(HyperLogLog, Serialization) {
+  HyperLogLog sketch(8);
+  for (int64_t i = 0; i < 1000; ++i) {
+    sketch.Update(HashOf(i));
+  }
+  const std::string bytes = sketch.Serialize();
+  ASSERT_EQ(bytes.size(), 2 + 256);
+  ASSERT_OK_AND_ASSIGN(auto roundtripped, HyperLogLog::Deserialize(bytes));
+  ASSERT_EQ(roundtripped.precision(), 8);
+  ASSERT_EQ(roundtripped.Estimate(), sketch.Estimate());
+
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(""));
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(bytes.substr(0, 100)));
+  std::string bad_version = bytes;
+  bad_version[0] = 42;
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(bad_version));
+}
+
+TEST(HyperLogLog, InvalidPrecision) {
+  ASSERT_RAISES(Invalid, HyperLogLog::Make(HyperLogLog::kMinPrecision - 1));
+  ASSERT_RAISES(Invalid, HyperLogLog::Make(HyperLogLog::kMaxPrecision + 1));
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -1063,20 +1063,25 @@ Status MemoryMapRemap(void* addr, size_t old_size, size_t new_size, int fildes,
 #endif
 }
 
-Status MemoryAdviseWillNeed(const std::vector<MemoryRegion>& regions) {
+namespace {
+
+// Extend the region downwards to a page boundary
+MemoryRegion AlignMemoryRegion(const MemoryRegion& region) {
   const auto page_size = static_cast<size_t>(GetPageSize());
   DCHECK_GT(page_size, 0);
   const size_t page_mask = ~(page_size - 1);
   DCHECK_EQ(page_mask & page_size, page_size);
 
-  auto align_region = [=](const MemoryRegion& region) -> MemoryRegion {
-    const auto addr = reinterpret_cast<uintptr_t>(region.addr);
-    const auto aligned_addr = addr & page_mask;
-    DCHECK_LT(addr - aligned_addr, page_size);
-    return {reinterpret_cast<void*>(aligned_addr),
-            region.size + static_cast<size_t>(addr - aligned_addr)};
-  };
+  const auto addr = reinterpret_cast<uintptr_t>(region.addr);
+  const auto aligned_addr = addr & page_mask;
+  DCHECK_LT(addr - aligned_addr, page_size);
+  return {reinterpret_cast<void*>(aligned_addr),
+          region.size + static_cast<size_t>(addr - aligned_addr)};
+}
+
+}  // namespace
 
+Status MemoryAdviseWillNeed(const std::vector<MemoryRegion>& regions) {
 #ifdef _WIN32
   // PrefetchVirtualMemory() is available on Windows 8 or later
   struct PrefetchEntry {  // Like WIN32_MEMORY_RANGE_ENTRY
@@ -1094,7 +1099,7 @@ Status MemoryAdviseWillNeed(const std::vector<MemoryRegion>& regions) {
     entries.reserve(regions.size());
     for (const auto& region : regions) {
       if (region.size != 0) {
-        entries.emplace_back(align_region(region));
+        entries.emplace_back(AlignMemoryRegion(region));
       }
     }
     if (!entries.empty() &&
@@ -1108,7 +1113,7 @@ Status MemoryAdviseWillNeed(const std::vector<MemoryRegion>& regions) {
 #else
   for (const auto& region : regions) {
     if (region.size != 0) {
-      const auto aligned = align_region(region);
+      const auto aligned = AlignMemoryRegion(region);
       int err = posix_madvise(aligned.addr, aligned.size, POSIX_MADV_WILLNEED);
       // EBADF can be returned on Linux in the following cases:
       // - the kernel version is older than 3.9
@@ -1122,6 +1127,54 @@ Status MemoryAdviseWillNeed(const std::vector<MemoryRegion>& regions) {
 #endif
 }
 
+Status MemoryAdvise(const std::vector<MemoryRegion>& regions, MemoryAdvice advice) {
+  if (advice == MemoryAdvice::WillNeed) {
+    return MemoryAdviseWillNeed(regions);
+  }
+#ifdef _WIN32
+  // Access pattern hints have no equivalent
+  return Status::OK();
+#else
+  for (const auto& region : regions) {
+    if (region.size == 0) {
+      continue;
+    }
+    const auto aligned = AlignMemoryRegion(region);
+    int err = 0;
+    switch (advice) {
+      case MemoryAdvice::Normal:
+        err = posix_madvise(aligned.addr, aligned.size, POSIX_MADV_NORMAL);
+        break;
+      case MemoryAdvice::Sequential:
+        err = posix_madvise(aligned.addr, aligned.size, POSIX_MADV_SEQUENTIAL);
+        break;
+      case MemoryAdvice::Random:
+        err = posix_madvise(aligned.addr, aligned.size, POSIX_MADV_RANDOM);
+        break;
+      case MemoryAdvice::HugePage:
+#ifdef MADV_HUGEPAGE
+        if (madvise(aligned.addr, aligned.size, MADV_HUGEPAGE) != 0) {
+          err = errno;
+          // EINVAL is returned if the kernel or the mapping doesn't support
+          // transparent huge pages (e.g. a regular file on a disk filesystem)
+          if (err == EINVAL) {
+            err = 0;
+          }
+        }
+#endif
+        break;
+      default:
+        break;
+    }
+    // See MemoryAdviseWillNeed() for EBADF
+    if (err != 0 && err != EBADF) {
+      return IOErrorFromErrno(err, "madvise failed");
+    }
+  }
+  return Status::OK();
+#endif
+}
+
 //
 // Closing files
 //
@@ -1509,6 +1562,23 @@ Result<std::unique_ptr<TemporaryDir>> TemporaryDir::Make(const std::string& pref
   return st;
 }
 
+Result<std::unique_ptr<TemporaryDir>> TemporaryDir::Make(const std::string& prefix,
+                                                         const std::string& parent) {
+  NativePathString base_name, parent_name;
+  ARROW_ASSIGN_OR_RAISE(base_name, StringToNative(prefix + MakeRandomName(8)));
+  ARROW_ASSIGN_OR_RAISE(parent_name, StringToNative(parent));
+  if (parent_name.empty() || parent_name.back() != kNativeSep) {
+    parent_name += kNativeSep;
+  }
+
+  PlatformFilename fn(parent_name + base_name + kNativeSep);
+  ARROW_ASSIGN_OR_RAISE(bool created, CreateDir(fn));
+  if (!created) {
+    return Status::IOError("Path already exists: '", fn.ToString(), "'");
+  }
+  return std::unique_ptr<TemporaryDir>(new TemporaryDir(std::move(fn)));
+}
+
 TemporaryDir::TemporaryDir(PlatformFilename&& path) : path_(std::move(path)) {}
 
 TemporaryDir::~TemporaryDir() {
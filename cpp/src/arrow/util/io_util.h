@@ -239,6 +239,25 @@ Status MemoryMapRemap(void* addr, size_t old_size, size_t new_size, int fildes,
 ARROW_EXPORT
 Status MemoryAdviseWillNeed(const std::vector<MemoryRegion>& regions);
 
+enum class MemoryAdvice : int8_t {
+  // No special treatment
+  Normal,
+  // Expect sequential accesses (more aggressive readahead)
+  Sequential,
+  // Expect random accesses (no readahead)
+  Random,
+  // Expect accesses in the near future (same as MemoryAdviseWillNeed)
+  WillNeed,
+  // Back the regions with transparent huge pages if possible
+  HugePage
+};
+
+/// rief Advise the OS about the expected usage of memory-mapped regions
+///
+/// Advice that is not supported by the platform or kernel is ignored.
+ARROW_EXPORT
+Status MemoryAdvise(const std::vector<MemoryRegion>& regions, MemoryAdvice advice);
+
 ARROW_EXPORT
 Result<std::string> GetEnvVar(const char* name);
 ARROW_EXPORT
@@ -313,6 +332,11 @@ class ARROW_EXPORT TemporaryDir {
   /// named starting with `prefix`.
   static Result<std::unique_ptr<TemporaryDir>> Make(const std::string& prefix);
 
+  /// Create a temporary subdirectory in the `parent` dir, named starting
+  /// with `prefix`.
+  static Result<std::unique_ptr<TemporaryDir>> Make(const std::string& prefix,
+                                                    const std::string& parent);
+
  private:
   PlatformFilename path_;
 
@@ -91,6 +91,20 @@ TEST(MemoryAdviseWillNeed, Basics) {
 #endif
 }
 
+TEST(MemoryAdvise, Basics) {
+  ASSERT_OK_AND_ASSIGN(auto buf, AllocateBuffer(1024 * 1024));
+  const auto addr = buf->mutable_data();
+  const auto size = static_cast<size_t>(buf->size());
+
+  for (auto advice : {MemoryAdvice::Sequential, MemoryAdvice::Random,
+                      MemoryAdvice::WillNeed, MemoryAdvice::HugePage,
+                      MemoryAdvice::Normal}) {
+    ASSERT_OK(MemoryAdvise({}, advice));
+    ASSERT_OK(MemoryAdvise({{addr, size}}, advice));
+    ASSERT_OK(MemoryAdvise({{addr + 1, 13}, {addr + 4095, 0}}, advice));
+  }
+}
+
 #if _WIN32
 TEST(WinErrorFromStatus, Basics) {
   Status st;
@@ -470,6 +484,26 @@ TEST(TemporaryDir, Basics) {
   AssertNotExists(child);
 }
 
+TEST(TemporaryDir, InParent) {
+  std::unique_ptr<TemporaryDir> parent, temp_dir;
+  ASSERT_OK_AND_ASSIGN(parent, TemporaryDir::Make("parent-"));
+  ASSERT_OK_AND_ASSIGN(temp_dir,
+                       TemporaryDir::Make("some-prefix-", parent->path().ToString()));
+  PlatformFilename fn = temp_dir->path();
+  ASSERT_EQ(fn.ToString().back(), '/');
+  AssertExists(fn);
+  ASSERT_EQ(fn.ToString().find(parent->path().ToString()), 0);
+  ASSERT_NE(fn.ToString().find("some-prefix-"), std::string::npos);
+
+  temp_dir.reset();
+  AssertNotExists(fn);
+  AssertExists(parent->path());
+
+  // The parent must exist
+  ASSERT_RAISES(IOError, TemporaryDir::Make("some-prefix-",
+                                            parent->path().ToString() + "missing"));
+}
+
 TEST(CreateDirTree, Basics) {
   std::unique_ptr<TemporaryDir> temp_dir;
   PlatformFilename fn;
@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/numa.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+#ifdef __linux__
+
+// From <numaif.h>, which is only shipped with libnuma
+constexpr int kMpolPreferred = 1;
+
+bool ReadFirstLine(const std::string& path, std::string* line) {
+  std::ifstream file(path, std::ios::in);
+  return file.good() && std::getline(file, *line);
+}
+
+std::string NodePath(int node) {
+  return "/sys/devices/system/node/node" + std::to_string(node) + "/cpulist";
+}
+
+#endif
+
+std::vector<int> AllCpus() {
+  std::vector<int> cpus(std::max(1u, std::thread::hardware_concurrency()));
+  for (size_t i = 0; i < cpus.size(); ++i) {
+    cpus[i] = static_cast<int>(i);
+  }
+  return cpus;
+}
+
+}  // namespace
+
+Result<std::vector<int>> ParseCpuList(const std::string& list) {
+  std::vector<int> cpus;
+  std::stringstream stream(list);
+  std::string range;
+  while (std::getline(stream, range, ',')) {
+    if (range.empty() || range == "\n") {
+      continue;
+    }
+    try {
+      size_t end;
+      const int first = std::stoi(range, &end);
+      int last = first;
+      if (end < range.size() && range[end] == '-') {
+        last = std::stoi(range.substr(end + 1));
+      }
+      if (first < 0 || last < first) {
+        return Status::Invalid("Invalid CPU range '", range, "'");
+      }
+      for (int cpu = first; cpu <= last; ++cpu) {
+        cpus.push_back(cpu);
+      }
+    } catch (const std::exception&) {
+      return Status::Invalid("Invalid CPU range '", range, "'");
+    }
+  }
+  return cpus;
+}
+
+int GetNumaNodeCount() {
+  static const int count = [] {
+#ifdef __linux__
+    // e.g. "0-3", nodes are numbered consecutively
+    std::string online;
+    if (ReadFirstLine("/sys/devices/system/node/online", &online)) {
+      auto nodes = ParseCpuList(online);
+      if (nodes.ok() && !(*nodes).empty()) {
+        return (*nodes).back() + 1;
+      }
+    }
+#endif
+    return 1;
+  }();
+  return count;
+}
+
+Result<std::vector<int>> GetNumaNodeCpus(int node) {
+  if (node < 0 || node >= GetNumaNodeCount()) {
+    return Status::Invalid("Invalid NUMA node ", node, ", the host has ",
+                           GetNumaNodeCount());
+  }
+#ifdef __linux__
+  std::string list;
+  if (ReadFirstLine(NodePath(node), &list)) {
+    return ParseCpuList(list);
+  }
+#endif
+  return AllCpus();
+}
+
+int GetCurrentNumaNode() {
+#if defined(__linux__) && defined(SYS_getcpu)
+  unsigned cpu, node;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+    return static_cast<int>(node);
+  }
+#endif
+  return 0;
+}
+
+Status PinCurrentThread(const std::vector<int>& cpus) {
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (int cpu : cpus) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+      return Status::Invalid("Invalid CPU ", cpu);
+    }
+    CPU_SET(cpu, &set);
+  }
+  int err = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+  if (err != 0) {
+    return Status::IOError("Could not set the CPU affinity of the thread: ",
+                           std::strerror(err));
+  }
+  return Status::OK();
+#else
+  return Status::NotImplemented("Thread affinity is not supported on this platform");
+#endif
+}
+
+Status PreferNumaNode(void* data, int64_t size, int node) {
+  if (node < 0 || node >= GetNumaNodeCount()) {
+    return Status::Invalid("Invalid NUMA node ", node);
+  }
+#if defined(__linux__) && defined(SYS_mbind)
+  constexpr int kBitsPerWord = 8 * sizeof(unsigned long);  // NOLINT
+  std::vector<unsigned long> mask(node / kBitsPerWord + 1, 0);  // NOLINT
+  mask[node / kBitsPerWord] |= 1UL << (node % kBitsPerWord);
+  // The kernel expects the number of bits of the mask, plus one
+  const unsigned long max_node = mask.size() * kBitsPerWord + 1;  // NOLINT
+  if (syscall(SYS_mbind, data, static_cast<unsigned long>(size),  // NOLINT
+              kMpolPreferred, mask.data(), max_node, 0) != 0) {
+    return Status::IOError("Could not set the NUMA node of memory: ",
+                           std::strerror(errno));
+  }
+#endif
+  return Status::OK();
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,62 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Helpers for NUMA (non-uniform memory access) hosts.  They use the Linux
+// system interfaces directly, so that no NUMA library is needed.  On other
+// platforms, the host is seen as a single node.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief Return the number of NUMA nodes of the host, at least 1.
+ARROW_EXPORT int GetNumaNodeCount();
+
+/// \brief Return the CPUs of a NUMA node.
+ARROW_EXPORT Result<std::vector<int>> GetNumaNodeCpus(int node);
+
+/// \brief Return the NUMA node of the CPU running the current thread, or 0 if
+/// it is unknown.
+ARROW_EXPORT int GetCurrentNumaNode();
+
+/// \brief Restrict the current thread to run on the given CPUs.
+///
+/// Return NotImplemented on platforms without thread affinity.
+ARROW_EXPORT Status PinCurrentThread(const std::vector<int>& cpus);
+
+/// \brief Ask the operating system to place the pages of a memory range on a
+/// NUMA node, when they are first touched.
+///
+/// The range must start on a page boundary.  The node is only preferred, so
+/// that allocations don't fail when it is out of memory.  Return an error if
+/// the policy can't be set, e.g. because of the permissions of the process.
+ARROW_EXPORT Status PreferNumaNode(void* data, int64_t size, int node);
+
+/// \brief Parse a list of CPUs in the Linux format, e.g. "0-3,8,10-11".
+ARROW_EXPORT Result<std::vector<int>> ParseCpuList(const std::string& list);
+
+}  // namespace internal
+}  // namespace arrow
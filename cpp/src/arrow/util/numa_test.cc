@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/numa.h"
+
+namespace arrow {
+namespace internal {
+
+TEST(ParseCpuList, Basics) {
+  ASSERT_OK_AND_ASSIGN(auto cpus, ParseCpuList(""));
+  ASSERT_EQ(cpus, std::vector<int>{});
+  ASSERT_OK_AND_ASSIGN(cpus, ParseCpuList("0"));
+  ASSERT_EQ(cpus, std::vector<int>{0});
+  ASSERT_OK_AND_ASSIGN(cpus, ParseCpuList("0-3,8,10-11\n"));
+  ASSERT_EQ(cpus, std::vector<int>({0, 1, 2, 3, 8, 10, 11}));
+
+  ASSERT_RAISES(Invalid, ParseCpuList("a"));
+  ASSERT_RAISES(Invalid, ParseCpuList("0,x-3"));
+  ASSERT_RAISES(Invalid, ParseCpuList("3-1"));
+  ASSERT_RAISES(Invalid, ParseCpuList("-1"));
+}
+
+TEST(Numa, Nodes) {
+  const int count = GetNumaNodeCount();
+  ASSERT_GE(count, 1);
+  ASSERT_OK_AND_ASSIGN(auto cpus, GetNumaNodeCpus(0));
+  ASSERT_FALSE(cpus.empty());
+  ASSERT_RAISES(Invalid, GetNumaNodeCpus(-1));
+  ASSERT_RAISES(Invalid, GetNumaNodeCpus(count));
+
+  const int node = GetCurrentNumaNode();
+  ASSERT_GE(node, 0);
+  ASSERT_LT(node, count);
+}
+
+TEST(Numa, PinCurrentThread) {
+  ASSERT_OK_AND_ASSIGN(auto cpus, GetNumaNodeCpus(0));
+  std::thread thread([&] {
+    Status st = PinCurrentThread(cpus);
+    if (st.IsNotImplemented()) {
+      return;
+    }
+    ASSERT_OK(st);
+    ASSERT_EQ(GetCurrentNumaNode(), 0);
+  });
+  thread.join();
+  ASSERT_RAISES(Invalid, PinCurrentThread({-1}));
+}
+
+TEST(Numa, PreferNumaNode) {
+  ASSERT_RAISES(Invalid, PreferNumaNode(nullptr, 0, -1));
+  ASSERT_RAISES(Invalid, PreferNumaNode(nullptr, 0, GetNumaNodeCount()));
+}
+
+}  // namespace internal
+}  // namespace arrow
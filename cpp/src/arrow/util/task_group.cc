@@ -18,6 +18,7 @@
 #include "arrow/util/task_group.h"
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <mutex>
@@ -113,7 +114,23 @@ class ThreadedTaskGroup : public TaskGroup {
   Status Finish() override {
     std::unique_lock<std::mutex> lock(mutex_);
     if (!finished_) {
-      cv_.wait(lock, [&]() { return nremaining_.load() == 0; });
+      const auto all_done = [&]() { return nremaining_.load() == 0; };
+      if (executor_->OwnsThisThread()) {
+        // Help executing the tasks of the executor rather than blocking one
+        // of its workers, so that nested groups neither deadlock nor need
+        // more threads.
+        while (!all_done()) {
+          lock.unlock();
+          const bool ran_task = executor_->RunPendingTask();
+          lock.lock();
+          if (!ran_task) {
+            // Our tasks are running on other workers, and may spawn more
+            cv_.wait_for(lock, std::chrono::milliseconds(1), all_done);
+          }
+        }
+      } else {
+        cv_.wait(lock, all_done);
+      }
       // Current tasks may start other tasks, so only set this when done
       finished_ = true;
       if (parent_) {
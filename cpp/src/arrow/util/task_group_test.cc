@@ -207,6 +207,31 @@ void TestTasksSpawnTasks(std::shared_ptr<TaskGroup> task_group) {
   ASSERT_EQ(count.load(), (1 << (N + 1)) - 1);
 }
 
+// Check TaskGroup behaviour with tasks waiting for nested groups, as when
+// a parallel reader decodes columns in parallel
+void TestNestedTaskGroups(std::function<std::shared_ptr<TaskGroup>()> factory) {
+  const int NOUTER = 8;
+  const int NINNER = 20;
+
+  std::atomic<int> count(0);
+  auto outer_group = factory();
+  for (int i = 0; i < NOUTER; ++i) {
+    outer_group->Append([&]() {
+      auto inner_group = factory();
+      for (int j = 0; j < NINNER; ++j) {
+        inner_group->Append([&]() {
+          SleepFor(1e-4);
+          count++;
+          return Status::OK();
+        });
+      }
+      return inner_group->Finish();
+    });
+  }
+  ASSERT_OK(outer_group->Finish());
+  ASSERT_EQ(count.load(), NOUTER * NINNER);
+}
+
 // A task that keeps recursing until a barrier is set.
 // Using a lambda for this doesn't play well with Thread Sanitizer.
 struct BarrierTask {
@@ -286,6 +311,8 @@ TEST(SerialTaskGroup, SubGroupsSuccess) {
   TestTaskSubGroupsSuccess(TaskGroup::MakeSerial());
 }
 
+TEST(SerialTaskGroup, NestedGroups) { TestNestedTaskGroups(TaskGroup::MakeSerial); }
+
 TEST(SerialTaskGroup, SubGroupsErrors) {
   TestTaskSubGroupsErrors(TaskGroup::MakeSerial());
 }
@@ -323,6 +350,16 @@ TEST(ThreadedTaskGroup, SubGroupsErrors) {
   TestTaskSubGroupsErrors(TaskGroup::MakeThreaded(thread_pool.get()));
 }
 
+TEST(ThreadedTaskGroup, NestedGroups) {
+  // Workers waiting for inner groups execute their tasks, so that even a
+  // single worker doesn't deadlock
+  for (int threads : {1, 4}) {
+    std::shared_ptr<ThreadPool> thread_pool;
+    ASSERT_OK_AND_ASSIGN(thread_pool, ThreadPool::Make(threads));
+    TestNestedTaskGroups([&] { return TaskGroup::MakeThreaded(thread_pool.get()); });
+  }
+}
+
 TEST(ThreadedTaskGroup, StressTaskGroupLifetime) {
   std::shared_ptr<ThreadPool> thread_pool;
   ASSERT_OK_AND_ASSIGN(thread_pool, ThreadPool::Make(16));
@@ -0,0 +1,251 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/tdigest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "arrow/util/bit_util.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// Serialized layout: a format version byte, then delta and the number of
+// centroids as little-endian uint32, then min, max and the (mean, weight)
+// centroid pairs as little-endian doubles
+constexpr uint8_t kSerializationVersion = 1;
+
+void AppendUInt32(std::string* out, uint32_t value) {
+  value = BitUtil::ToLittleEndian(value);
+  out->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void AppendDouble(std::string* out, double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  bits = BitUtil::ToLittleEndian(bits);
+  out->append(reinterpret_cast<const char*>(&bits), sizeof(bits));
+}
+
+uint32_t ReadUInt32(const char** data) {
+  uint32_t value;
+  std::memcpy(&value, *data, sizeof(value));
+  *data += sizeof(value);
+  return BitUtil::FromLittleEndian(value);
+}
+
+double ReadDouble(const char** data) {
+  uint64_t bits;
+  std::memcpy(&bits, *data, sizeof(bits));
+  *data += sizeof(bits);
+  bits = BitUtil::FromLittleEndian(bits);
+  double value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+}  // namespace
+
+TDigest::TDigest(uint32_t delta, uint32_t buffer_size)
+    : delta_(std::max<uint32_t>(delta, 10)),
+      buffer_size_(std::max<uint32_t>(buffer_size, 1)),
+      min_(std::numeric_limits<double>::infinity()),
+      max_(-std::numeric_limits<double>::infinity()) {}
+
+double TDigest::total_weight() const {
+  double weight = static_cast<double>(buffer_.size());
+  for (const auto& centroid : centroids_) {
+    weight += centroid.weight;
+  }
+  return weight;
+}
+
+void TDigest::MergeBuffer() {
+  if (buffer_.empty()) {
+    return;
+  }
+  std::vector<Centroid> sorted;
+  sorted.reserve(centroids_.size() + buffer_.size());
+  for (double value : buffer_) {
+    sorted.push_back({value, 1.0});
+  }
+  buffer_.clear();
+  std::sort(sorted.begin(), sorted.end(),
+            [](const Centroid& left, const Centroid& right) {
+              return left.mean < right.mean;
+            });
+  const size_t num_buffered = sorted.size();
+  sorted.insert(sorted.end(), centroids_.begin(), centroids_.end());
+  std::inplace_merge(sorted.begin(), sorted.begin() + num_buffered, sorted.end(),
+                     [](const Centroid& left, const Centroid& right) {
+                       return left.mean < right.mean;
+                     });
+  Compress(sorted);
+}
+
+void TDigest::Compress(const std::vector<Centroid>& sorted) {
+  centroids_.clear();
+  if (sorted.empty()) {
+    return;
+  }
+  min_ = std::min(min_, sorted.front().mean);
+  max_ = std::max(max_, sorted.back().mean);
+
+  double total_weight = 0;
+  for (const auto& centroid : sorted) {
+    total_weight += centroid.weight;
+  }
+
+  // Scale function k(q) = delta / (2 pi) * asin(2q - 1): a centroid may span
+  // at most one unit of k, so centroids are smaller close to q = 0 and q = 1
+  const double delta = static_cast<double>(delta_);
+  auto k_of_q = [delta](double q) { return delta / (2 * kPi) * std::asin(2 * q - 1); };
+  auto q_of_k = [delta](double k) {
+    return k >= delta / 4 ? 1.0 : (std::sin(k * 2 * kPi / delta) + 1) / 2;
+  };
+
+  double weight_so_far = 0;
+  double q_limit = q_of_k(k_of_q(0) + 1);
+  Centroid current = sorted[0];
+  for (size_t i = 1; i < sorted.size(); ++i) {
+    const Centroid& next = sorted[i];
+    const double q = (weight_so_far + current.weight + next.weight) / total_weight;
+    if (q <= q_limit) {
+      const double weight = current.weight + next.weight;
+      current.mean += (next.mean - current.mean) * next.weight / weight;
+      current.weight = weight;
+    } else {
+      weight_so_far += current.weight;
+      centroids_.push_back(current);
+      q_limit = q_of_k(k_of_q(weight_so_far / total_weight) + 1);
+      current = next;
+    }
+  }
+  centroids_.push_back(current);
+}
+
+void TDigest::Merge(const TDigest& other) {
+  MergeBuffer();
+  std::vector<Centroid> sorted;
+  sorted.reserve(centroids_.size() + other.centroids_.size() + other.buffer_.size());
+  sorted.insert(sorted.end(), centroids_.begin(), centroids_.end());
+  sorted.insert(sorted.end(), other.centroids_.begin(), other.centroids_.end());
+  for (double value : other.buffer_) {
+    sorted.push_back({value, 1.0});
+  }
+  std::sort(sorted.begin(), sorted.end(),
+            [](const Centroid& left, const Centroid& right) {
+              return left.mean < right.mean;
+            });
+  min_ = std::min(min_, other.min_);
+  max_ = std::max(max_, other.max_);
+  Compress(sorted);
+}
+
+double TDigest::Quantile(double q) {
+  MergeBuffer();
+  if (centroids_.empty() || std::isnan(q)) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  q = std::min(1.0, std::max(0.0, q));
+  if (centroids_.size() == 1) {
+    return centroids_[0].mean;
+  }
+
+  double total_weight = 0;
+  for (const auto& centroid : centroids_) {
+    total_weight += centroid.weight;
+  }
+  const double target = q * total_weight;
+
+  // Interpolate linearly between the centers of adjacent centroids, and
+  // between the extreme centroids and the min / max values
+  double center = centroids_[0].weight / 2;
+  if (target <= center) {
+    return min_ + (centroids_[0].mean - min_) * (target / center);
+  }
+  double weight_so_far = 0;
+  for (size_t i = 0; i + 1 < centroids_.size(); ++i) {
+    const Centroid& left = centroids_[i];
+    const Centroid& right = centroids_[i + 1];
+    const double left_center = weight_so_far + left.weight / 2;
+    const double right_center = weight_so_far + left.weight + right.weight / 2;
+    if (target <= right_center) {
+      const double fraction = (target - left_center) / (right_center - left_center);
+      return left.mean + (right.mean - left.mean) * fraction;
+    }
+    weight_so_far += left.weight;
+  }
+  const Centroid& last = centroids_.back();
+  const double last_center = total_weight - last.weight / 2;
+  const double fraction = (target - last_center) / (total_weight - last_center);
+  return last.mean + (max_ - last.mean) * fraction;
+}
+
+std::string TDigest::Serialize() {
+  MergeBuffer();
+  std::string out;
+  out.push_back(static_cast<char>(kSerializationVersion));
+  AppendUInt32(&out, delta_);
+  AppendUInt32(&out, static_cast<uint32_t>(centroids_.size()));
+  AppendDouble(&out, min_);
+  AppendDouble(&out, max_);
+  for (const auto& centroid : centroids_) {
+    AppendDouble(&out, centroid.mean);
+    AppendDouble(&out, centroid.weight);
+  }
+  return out;
+}
+
+Result<TDigest> TDigest::Deserialize(util::string_view bytes) {
+  constexpr size_t kHeaderSize = 1 + 2 * sizeof(uint32_t) + 2 * sizeof(double);
+  if (bytes.size() < kHeaderSize) {
+    return Status::Invalid("Serialized TDigest is truncated");
+  }
+  const char* data = bytes.data();
+  const auto version = static_cast<uint8_t>(*data++);
+  if (version != kSerializationVersion) {
+    return Status::Invalid("Unsupported serialized TDigest version ",
+                           static_cast<int>(version));
+  }
+  const auto delta = ReadUInt32(&data);
+  const auto num_centroids = ReadUInt32(&data);
+  if (bytes.size() != kHeaderSize + num_centroids * 2 * sizeof(double)) {
+    return Status::Invalid("Serialized TDigest has ", bytes.size(),
+                           " bytes, expected ",
+                           kHeaderSize + num_centroids * 2 * sizeof(double));
+  }
+  TDigest digest(delta);
+  digest.min_ = ReadDouble(&data);
+  digest.max_ = ReadDouble(&data);
+  digest.centroids_.resize(num_centroids);
+  for (auto& centroid : digest.centroids_) {
+    centroid.mean = ReadDouble(&data);
+    centroid.weight = ReadDouble(&data);
+  }
+  return digest;
+}
+
+}  // namespace internal
+}  // namespace arrow
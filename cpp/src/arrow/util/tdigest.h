@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief A merging t-digest, estimating quantiles of the values seen
+///
+/// The digest summarizes its input as a bounded number of centroids (weighted
+/// means), which are small near the extreme quantiles and larger around the
+/// median, so that tail quantiles are estimated most accurately. `delta`
+/// bounds the number of centroids (to about delta / 2); added values are
+/// buffered and merged into the centroids `buffer_size` at a time.
+///
+/// Digests can be merged, and serialized to bytes to be shipped to another
+/// process.
+class ARROW_EXPORT TDigest {
+ public:
+  explicit TDigest(uint32_t delta = 100, uint32_t buffer_size = 500);
+
+  /// \brief Add a value. NaN values must not be added.
+  void Add(double value) {
+    buffer_.push_back(value);
+    if (buffer_.size() >= buffer_size_) {
+      MergeBuffer();
+    }
+  }
+
+  /// \brief Merge another digest into this one
+  void Merge(const TDigest& other);
+
+  /// \brief Estimate the q'th quantile (0 <= q <= 1) of the added values,
+  /// NaN if there are none
+  double Quantile(double q);
+
+  /// \brief Whether no value was added
+  bool is_empty() const { return centroids_.empty() && buffer_.empty(); }
+
+  /// \brief The total weight of the values added
+  double total_weight() const;
+
+  /// \brief Serialize the digest to bytes
+  std::string Serialize();
+
+  /// \brief Reconstruct a digest from the output of Serialize()
+  static Result<TDigest> Deserialize(util::string_view bytes);
+
+ private:
+  struct Centroid {
+    double mean;
+    double weight;
+  };
+
+  // Merge the buffered values into the centroids
+  void MergeBuffer();
+  // Compress a list of centroids sorted by mean into the centroids
+  void Compress(const std::vector<Centroid>& sorted);
+
+  uint32_t delta_;
+  uint32_t buffer_size_;
+  double min_;
+  double max_;
+  std::vector<Centroid> centroids_;
+  std::vector<double> buffer_;
+};
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/tdigest.h"
+
+namespace arrow {
+namespace internal {
+
+// Check the estimated quantiles of `digest` against the exact quantiles of
+// `sorted`, as a rank error
+void AssertQuantilesNear(TDigest* digest, const std::vector<double>& sorted,
+                         double rank_tolerance) {
+  for (double q : {0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999}) {
+    SCOPED_TRACE("q = " + std::to_string(q));
+    const double estimate = digest->Quantile(q);
+    const auto rank =
+        std::lower_bound(sorted.begin(), sorted.end(), estimate) - sorted.begin();
+    ASSERT_NEAR(static_cast<double>(rank) / sorted.size(), q, rank_tolerance);
+  }
+}
+
+std::vector<double> RandomNormal(int64_t n, uint64_t seed) {
+  std::mt19937_64 rng(seed);
+  std::normal_distribution<double> dist(10, 3);
+  std::vector<double> values(n);
+  for (auto& value : values) {
+    value = dist(rng);
+  }
+  return values;
+}
+
+TEST(TDigest, Empty) {
+  TDigest digest;
+  ASSERT_TRUE(digest.is_empty());
+  ASSERT_TRUE(std::isnan(digest.Quantile(0.5)));
+}
+
+TEST(TDigest, FewValues) {
+  TDigest digest;
+  digest.Add(3);
+  ASSERT_EQ(digest.Quantile(0.5), 3);
+  digest.Add(1);
+  digest.Add(2);
+  ASSERT_EQ(digest.Quantile(0), 1);
+  ASSERT_EQ(digest.Quantile(0.5), 2);
+  ASSERT_EQ(digest.Quantile(1), 3);
+  ASSERT_EQ(digest.total_weight(), 3);
+}
+
+TEST(TDigest, Accuracy) {
+  auto values = RandomNormal(100000, 42);
+  TDigest digest;
+  for (double value : values) {
+    digest.Add(value);
+  }
+  std::sort(values.begin(), values.end());
+  AssertQuantilesNear(&digest, values, 0.005);
+  ASSERT_EQ(digest.Quantile(0), values.front());
+  ASSERT_EQ(digest.Quantile(1), values.back());
+  ASSERT_EQ(digest.total_weight(), values.size());
+}
+
+TEST(TDigest, Merge) {
+  auto values = RandomNormal(100000, 43);
+  std::vector<TDigest> digests(7);
+  for (size_t i = 0; i < values.size(); ++i) {
+    digests[i % digests.size()].Add(values[i]);
+  }
+  for (size_t i = 1; i < digests.size(); ++i) {
+    digests[0].Merge(digests[i]);
+  }
+  std::sort(values.begin(), values.end());
+  AssertQuantilesNear(&digests[0], values, 0.005);
+  ASSERT_EQ(digests[0].total_weight(), values.size());
+}
+
+TEST(TDigest, Serialization) {
+  auto values = RandomNormal(10000, 44);
+  TDigest digest(50);
+  for (double value : values) {
+    digest.Add(value);
+  }
+  const std::string bytes = digest.Serialize();
+  ASSERT_OK_AND_ASSIGN(auto roundtripped, TDigest::Deserialize(bytes));
+  for (double q : {0.0, 0.01, 0.5, 0.99, 1.0}) {
+    ASSERT_EQ(roundtripped.Quantile(q), digest.Quantile(q));
+  }
+
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(""));
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(bytes.substr(0, bytes.size() - 1)));
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -18,9 +18,12 @@
 #include "arrow/util/thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
+#include <limits>
 #include <list>
+#include <map>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -28,18 +31,138 @@
 
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/numa.h"
 
 namespace arrow {
 namespace internal {
 
 Executor::~Executor() {}
 
+namespace {
+
+// A queue of tasks ordered by priority, the most urgent (lowest) first.
+// Tasks of the same priority can be taken in either order.
+class TaskQueue {
+ public:
+  TaskQueue() : size_(0) {}
+
+  void Push(int32_t priority, std::function<void()> task) {
+    levels_[priority].push_back(std::move(task));
+    ++size_;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  // May be called without holding the lock protecting the queue
+  size_t size() const { return size_.load(); }
+
+  // The priority of the most urgent task, if any
+  int32_t top_priority() const {
+    return empty() ? std::numeric_limits<int32_t>::max() : Top()->first;
+  }
+
+  // Take the most urgent task spawned last
+  std::function<void()> PopNewest() {
+    auto level = Top();
+    auto task = std::move(level->second.back());
+    level->second.pop_back();
+    Popped(level);
+    return task;
+  }
+
+  // Take the most urgent task spawned first
+  std::function<void()> PopOldest() {
+    auto level = Top();
+    auto task = std::move(level->second.front());
+    level->second.pop_front();
+    Popped(level);
+    return task;
+  }
+
+  void MoveTo(TaskQueue* other) {
+    for (auto& level : levels_) {
+      for (auto& task : level.second) {
+        other->Push(level.first, std::move(task));
+      }
+    }
+    Clear();
+  }
+
+  void Clear() {
+    levels_.clear();
+    size_ = 0;
+  }
+
+ private:
+  using Levels = std::map<int32_t, std::deque<std::function<void()>>>;
+
+  Levels::iterator Top() {
+    auto it = levels_.begin();
+    while (it->second.empty()) {
+      ++it;
+    }
+    return it;
+  }
+
+  Levels::const_iterator Top() const {
+    auto it = levels_.begin();
+    while (it->second.empty()) {
+      ++it;
+    }
+    return it;
+  }
+
+  void Popped(Levels::iterator level) {
+    // The level of the default priority is kept, so that the common case
+    // doesn't allocate
+    if (level->second.empty() && level->first != 0) {
+      levels_.erase(level);
+    }
+    --size_;
+  }
+
+  Levels levels_;
+  std::atomic<size_t> size_;
+};
+
+// The tasks spawned by a worker thread.  The worker runs them without taking
+// the lock of the pool, idle workers steal them with it.
+struct LocalTaskQueue {
+  std::mutex mutex_;
+  TaskQueue tasks_;
+};
+
+}  // namespace
+
 struct ThreadPool::State {
-  State() : desired_capacity_(0), please_shutdown_(false), quick_shutdown_(false) {}
+  State()
+      : desired_capacity_(0),
+        num_idle_(0),
+        pending_priority_(std::numeric_limits<int32_t>::max()),
+        please_shutdown_(false),
+        quick_shutdown_(false),
+        pin_to_numa_nodes_(false),
+        num_launched_workers_(0) {}
+
+  void UpdatePendingPriorityUnlocked() {
+    pending_priority_ = pending_tasks_.top_priority();
+  }
 
-  // NOTE: in case locking becomes too expensive, we can investigate lock-free FIFOs
-  // such as https://github.com/cameron314/concurrentqueue
+  // Whether there are tasks to run, for a worker about to sleep
+  bool HasTasksUnlocked() const {
+    if (!pending_tasks_.empty()) {
+      return true;
+    }
+    for (const auto& queue : local_tasks_) {
+      if (!queue.tasks_.empty()) {
+        return true;
+      }
+    }
+    return false;
+  }
 
+  // Protects everything but the local task queues, which have their own lock.
+  // It is always taken before the lock of a local task queue.
   std::mutex mutex_;
   std::condition_variable cv_;
   std::condition_variable cv_shutdown_;
@@ -47,15 +170,77 @@ struct ThreadPool::State {
   std::list<std::thread> workers_;
   // Trashcan for finished threads
   std::vector<std::thread> finished_workers_;
-  std::deque<std::function<void()>> pending_tasks_;
+  // Tasks spawned from outside the pool
+  TaskQueue pending_tasks_;
+  // Tasks spawned by each worker thread.  A worker runs the most urgent of its
+  // own tasks and of the tasks spawned from outside, its own tasks last in,
+  // first out and the others first in, first out.  Once both are exhausted, it
+  // steals the oldest most urgent task of the worker with the most tasks.
+  std::list<LocalTaskQueue> local_tasks_;
 
   // Desired number of threads
   int desired_capacity_;
+  // Number of workers waiting for tasks, so that workers spawning local tasks
+  // only take the lock of the pool to wake them up
+  std::atomic<int> num_idle_;
+  // The top priority of pending_tasks_, for workers to check without the lock
+  std::atomic<int32_t> pending_priority_;
   // Are we shutting down?
-  bool please_shutdown_;
-  bool quick_shutdown_;
+  std::atomic<bool> please_shutdown_;
+  std::atomic<bool> quick_shutdown_;
+  // Should workers be pinned to the NUMA nodes, in turn?
+  bool pin_to_numa_nodes_;
+  int64_t num_launched_workers_;
 };
 
+// The pool and local task queue of the current worker thread, if any
+static thread_local ThreadPool::State* current_state = nullptr;
+static thread_local LocalTaskQueue* current_local_tasks = nullptr;
+
+// Take the next task of the worker owning `local_tasks`, if it is more urgent
+// than the tasks spawned from outside.  The lock of the pool need not be held.
+static bool TakeLocalTask(ThreadPool::State* state, LocalTaskQueue* local_tasks,
+                          std::function<void()>* out) {
+  if (local_tasks->tasks_.empty()) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(local_tasks->mutex_);
+  if (local_tasks->tasks_.empty() ||
+      local_tasks->tasks_.top_priority() > state->pending_priority_.load()) {
+    return false;
+  }
+  *out = local_tasks->tasks_.PopNewest();
+  return true;
+}
+
+// Take the next task to be run by the worker owning `local_tasks`.
+static bool TakeTaskUnlocked(ThreadPool::State* state, LocalTaskQueue* local_tasks,
+                             std::function<void()>* out) {
+  if (TakeLocalTask(state, local_tasks, out)) {
+    return true;
+  }
+  if (!state->pending_tasks_.empty()) {
+    *out = state->pending_tasks_.PopOldest();
+    state->UpdatePendingPriorityUnlocked();
+    return true;
+  }
+  LocalTaskQueue* victim = nullptr;
+  for (auto& queue : state->local_tasks_) {
+    if (victim == nullptr || queue.tasks_.size() > victim->tasks_.size()) {
+      victim = &queue;
+    }
+  }
+  if (victim == nullptr) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(victim->mutex_);
+  if (victim->tasks_.empty()) {
+    return false;
+  }
+  *out = victim->tasks_.PopOldest();
+  return true;
+}
+
 // The worker loop is an independent function so that it can keep running
 // after the ThreadPool is destroyed.
 static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
@@ -66,6 +251,20 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
   // (LaunchWorkersUnlocked has exited)
   DCHECK_EQ(std::this_thread::get_id(), it->get_id());
 
+  state->local_tasks_.emplace_back();
+  auto local_tasks = --state->local_tasks_.end();
+  current_state = state.get();
+  current_local_tasks = &*local_tasks;
+  if (state->pin_to_numa_nodes_) {
+    const int node =
+        static_cast<int>(state->num_launched_workers_++ % GetNumaNodeCount());
+    auto cpus = GetNumaNodeCpus(node);
+    // Pinning is an optimization, the worker can run anywhere if it fails
+    if (cpus.ok()) {
+      ARROW_UNUSED(PinCurrentThread(*cpus));
+    }
+  }
+
   // If too many threads, we should secede from the pool
   const auto should_secede = [&]() -> bool {
     return state->workers_.size() > static_cast<size_t>(state->desired_capacity_);
@@ -77,26 +276,38 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
     // condition variable at the end of the loop.
 
     // Execute pending tasks if any
-    while (!state->pending_tasks_.empty() && !state->quick_shutdown_) {
+    while (!state->quick_shutdown_) {
       // We check this opportunistically at each loop iteration since
       // it releases the lock below.
       if (should_secede()) {
         break;
       }
       {
-        std::function<void()> task = std::move(state->pending_tasks_.front());
-        state->pending_tasks_.pop_front();
+        std::function<void()> task;
+        if (!TakeTaskUnlocked(state.get(), &*local_tasks, &task)) {
+          break;
+        }
         lock.unlock();
         task();
+        // Run the tasks spawned by this worker without the lock of the pool
+        while (!state->quick_shutdown_ &&
+               TakeLocalTask(state.get(), &*local_tasks, &task)) {
+          task();
+        }
       }
       lock.lock();
     }
-    // Now either the queue is empty *or* a quick shutdown was requested
+    // Now either the queues are empty *or* a quick shutdown was requested
     if (state->please_shutdown_ || should_secede()) {
       break;
     }
-    // Wait for next wakeup
-    state->cv_.wait(lock);
+    // Wait for next wakeup.  Workers spawning local tasks check `num_idle_`
+    // after pushing them, so they are seen either here or there.
+    ++state->num_idle_;
+    if (!state->HasTasksUnlocked()) {
+      state->cv_.wait(lock);
+    }
+    --state->num_idle_;
   }
 
   // We're done.  Move our thread object to the trashcan of finished
@@ -107,6 +318,18 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
   //    are exited before the ThreadPool is destroyed.  Otherwise subtle
   //    timing conditions can lead to false positives with Valgrind.
   DCHECK_EQ(std::this_thread::get_id(), it->get_id());
+  current_state = nullptr;
+  current_local_tasks = nullptr;
+  {
+    std::lock_guard<std::mutex> local_lock(local_tasks->mutex_);
+    if (!local_tasks->tasks_.empty() && !state->quick_shutdown_) {
+      // Hand our remaining tasks over to the other workers
+      local_tasks->tasks_.MoveTo(&state->pending_tasks_);
+      state->UpdatePendingPriorityUnlocked();
+      state->cv_.notify_all();
+    }
+  }
+  state->local_tasks_.erase(local_tasks);
   state->finished_workers_.push_back(std::move(*it));
   state->workers_.erase(it);
   if (state->please_shutdown_) {
@@ -141,8 +364,9 @@ void ThreadPool::ProtectAgainstFork() {
     int capacity = state_->desired_capacity_;
 
     auto new_state = std::make_shared<ThreadPool::State>();
-    new_state->please_shutdown_ = state_->please_shutdown_;
-    new_state->quick_shutdown_ = state_->quick_shutdown_;
+    new_state->please_shutdown_ = state_->please_shutdown_.load();
+    new_state->quick_shutdown_ = state_->quick_shutdown_.load();
+    new_state->pin_to_numa_nodes_ = state_->pin_to_numa_nodes_;
 
     pid_ = current_pid;
     sp_state_ = new_state;
@@ -156,6 +380,23 @@ void ThreadPool::ProtectAgainstFork() {
 #endif
 }
 
+bool ThreadPool::OwnsThisThread() { return current_state == state_; }
+
+bool ThreadPool::RunPendingTask() {
+  if (current_state != state_ || state_->quick_shutdown_) {
+    return false;
+  }
+  std::function<void()> task;
+  if (!TakeLocalTask(state_, current_local_tasks, &task)) {
+    std::lock_guard<std::mutex> lock(state_->mutex_);
+    if (!TakeTaskUnlocked(state_, current_local_tasks, &task)) {
+      return false;
+    }
+  }
+  task();
+  return true;
+}
+
 Status ThreadPool::SetCapacity(int threads) {
   ProtectAgainstFork();
   std::unique_lock<std::mutex> lock(state_->mutex_);
@@ -203,8 +444,10 @@ Status ThreadPool::Shutdown(bool wait) {
   state_->cv_shutdown_.wait(lock, [this] { return state_->workers_.empty(); });
   if (!state_->quick_shutdown_) {
     DCHECK_EQ(state_->pending_tasks_.size(), 0);
+    DCHECK_EQ(state_->local_tasks_.size(), 0);
   } else {
-    state_->pending_tasks_.clear();
+    state_->pending_tasks_.Clear();
+    state_->UpdatePendingPriorityUnlocked();
   }
   CollectFinishedWorkersUnlocked();
   return Status::OK();
@@ -229,14 +472,32 @@ void ThreadPool::LaunchWorkersUnlocked(int threads) {
 }
 
 Status ThreadPool::SpawnReal(TaskHints hints, std::function<void()> task) {
+  ProtectAgainstFork();
+  if (current_state == state_) {
+    // Spawned from one of our workers: keep the task local to it, which
+    // doesn't need the lock of the pool
+    if (state_->please_shutdown_) {
+      return Status::Invalid("operation forbidden during or after shutdown");
+    }
+    {
+      std::lock_guard<std::mutex> local_lock(current_local_tasks->mutex_);
+      current_local_tasks->tasks_.Push(hints.priority, std::move(task));
+    }
+    if (state_->num_idle_.load() > 0) {
+      // Let an idle worker steal the task
+      std::lock_guard<std::mutex> lock(state_->mutex_);
+      state_->cv_.notify_one();
+    }
+    return Status::OK();
+  }
   {
-    ProtectAgainstFork();
     std::lock_guard<std::mutex> lock(state_->mutex_);
     if (state_->please_shutdown_) {
       return Status::Invalid("operation forbidden during or after shutdown");
     }
     CollectFinishedWorkersUnlocked();
-    state_->pending_tasks_.push_back(std::move(task));
+    state_->pending_tasks_.Push(hints.priority, std::move(task));
+    state_->UpdatePendingPriorityUnlocked();
   }
   state_->cv_.notify_one();
   return Status::OK();
@@ -259,6 +520,13 @@ Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeEternal(int threads) {
   return pool;
 }
 
+Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeNumaPinned(int threads) {
+  auto pool = std::shared_ptr<ThreadPool>(new ThreadPool());
+  pool->state_->pin_to_numa_nodes_ = true;
+  RETURN_NOT_OK(pool->SetCapacity(threads));
+  return pool;
+}
+
 // ----------------------------------------------------------------------
 // Global thread pool
 
@@ -308,6 +576,107 @@ std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
   return *std::move(maybe_pool);
 }
 
+// ----------------------------------------------------------------------
+// ThrottledExecutor
+
+struct ThrottledExecutor::State {
+  struct QueuedTask {
+    TaskHints hints;
+    std::function<void()> task;
+  };
+
+  State(Executor* executor, int max_in_flight)
+      : executor(executor), max_in_flight(max_in_flight) {}
+
+  Executor* const executor;
+  const int max_in_flight;
+
+  std::mutex mutex;
+  int in_flight = 0;
+  // The tasks over the limit, by priority
+  std::map<int32_t, std::deque<QueuedTask>> queued;
+};
+
+namespace {
+
+void FinishThrottledTask(const std::shared_ptr<ThrottledExecutor::State>& state);
+
+Status SpawnThrottledTask(const std::shared_ptr<ThrottledExecutor::State>& state,
+                          TaskHints hints, std::function<void()> task) {
+  return state->executor->Spawn(std::move(hints), [state, task] {
+    task();
+    FinishThrottledTask(state);
+  });
+}
+
+// Hand the slot of a finished task over to the most urgent queued task, if any
+void FinishThrottledTask(const std::shared_ptr<ThrottledExecutor::State>& state) {
+  while (true) {
+    ThrottledExecutor::State::QueuedTask next;
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      auto level = state->queued.begin();
+      if (level == state->queued.end()) {
+        --state->in_flight;
+        return;
+      }
+      next = std::move(level->second.front());
+      level->second.pop_front();
+      if (level->second.empty()) {
+        state->queued.erase(level);
+      }
+    }
+    if (SpawnThrottledTask(state, next.hints, next.task).ok()) {
+      return;
+    }
+    // The underlying executor refused the task (e.g. it is shutting down): run it
+    // here rather than leave it pending forever
+    next.task();
+  }
+}
+
+}  // namespace
+
+ThrottledExecutor::ThrottledExecutor(std::shared_ptr<State> state)
+    : state_(std::move(state)) {}
+
+ThrottledExecutor::~ThrottledExecutor() = default;
+
+Result<std::shared_ptr<ThrottledExecutor>> ThrottledExecutor::Make(Executor* executor,
+                                                                   int max_in_flight) {
+  if (executor == nullptr) {
+    return Status::Invalid("ThrottledExecutor needs an underlying executor");
+  }
+  if (max_in_flight <= 0) {
+    return Status::Invalid("ThrottledExecutor limit should be > 0, got ", max_in_flight);
+  }
+  return std::shared_ptr<ThrottledExecutor>(
+      new ThrottledExecutor(std::make_shared<State>(executor, max_in_flight)));
+}
+
+int ThrottledExecutor::GetCapacity() {
+  return std::min(state_->max_in_flight, state_->executor->GetCapacity());
+}
+
+int ThrottledExecutor::max_in_flight() const { return state_->max_in_flight; }
+
+Status ThrottledExecutor::SpawnReal(TaskHints hints, std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    if (state_->in_flight >= state_->max_in_flight) {
+      const int32_t priority = hints.priority;
+      state_->queued[priority].push_back({std::move(hints), std::move(task)});
+      return Status::OK();
+    }
+    ++state_->in_flight;
+  }
+  Status st = SpawnThrottledTask(state_, std::move(hints), std::move(task));
+  if (!st.ok()) {
+    FinishThrottledTask(state_);
+  }
+  return st;
+}
+
 ThreadPool* GetCpuThreadPool() {
   static std::shared_ptr<ThreadPool> singleton = ThreadPool::MakeCpuThreadPool();
   return singleton.get();
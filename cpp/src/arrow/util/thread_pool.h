@@ -76,7 +76,7 @@ struct ExecutorResultTraits<Result<T>> {
 }  // namespace detail
 
 // Hints about a task that may be used by an Executor.
-// They are ignored by the provided ThreadPool implementation.
+// The provided ThreadPool implementation only uses the priority.
 struct TaskHints {
   // The lower, the more urgent
   int32_t priority = 0;
@@ -147,10 +147,39 @@ class ARROW_EXPORT Executor {
         Submit(std::forward<Function>(func), std::forward<Args>(args)...));
   }
 
+  // Return a future finished like the given future, but from a task of this
+  // executor, so that its callbacks and continuations added before then run
+  // on this executor rather than on the thread finishing the given future.
+  // If the task can't be spawned, the returned future is finished inline.
+  // The executor must outlive the given future.
+  template <typename T>
+  Future<T> Transfer(Future<T> future) {
+    using Outcome = ::arrow::detail::FutureOutcome<T>;
+    auto transferred = Future<T>::Make();
+    future.AddCallback([this, transferred](const Outcome& outcome) mutable {
+      auto spawn_status = Spawn([transferred, outcome]() mutable {
+        transferred.MarkFinished(std::move(outcome));
+      });
+      if (!spawn_status.ok()) {
+        transferred.MarkFinished(outcome);
+      }
+    });
+    return transferred;
+  }
+
   // Return the level of parallelism (the number of tasks that may be executed
   // concurrently).  This may be an approximate number.
   virtual int GetCapacity() = 0;
 
+  // Return whether the current thread is a worker of this executor.
+  virtual bool OwnsThisThread() { return false; }
+
+  // Run a task waiting to be executed, on the current thread, which must be a
+  // worker of this executor.  Return false if no task is waiting.  This lets
+  // a worker waiting for other tasks help execute them, rather than block
+  // (and possibly wait for itself).
+  virtual bool RunPendingTask() { return false; }
+
  protected:
   ARROW_DISALLOW_COPY_AND_ASSIGN(Executor);
 
@@ -160,8 +189,11 @@ class ARROW_EXPORT Executor {
   virtual Status SpawnReal(TaskHints hints, std::function<void()> task) = 0;
 };
 
-// An Executor implementation spawning tasks in FIFO manner on a fixed-size
-// pool of worker threads.
+// An Executor implementation spawning tasks on a fixed-size pool of worker threads.
+// Tasks spawned from outside the pool are run in FIFO manner.  Tasks spawned by a
+// worker are queued locally to that worker, which runs them in LIFO manner without
+// taking the lock of the pool; idle workers steal the oldest of them.  In all
+// cases, more urgent tasks (see TaskHints::priority) are run first.
 class ARROW_EXPORT ThreadPool : public Executor {
  public:
   // Construct a thread pool with the given number of worker threads
@@ -171,6 +203,11 @@ class ARROW_EXPORT ThreadPool : public Executor {
   // with destruction late at process exit.
   static Result<std::shared_ptr<ThreadPool>> MakeEternal(int threads);
 
+  // Like Make(), but the worker threads are spread evenly over the NUMA nodes
+  // of the host, and pinned to the CPUs of their node.  Use with a
+  // NumaMemoryPool to keep the memory of tasks on the node running them.
+  static Result<std::shared_ptr<ThreadPool>> MakeNumaPinned(int threads);
+
   // Destroy thread pool; the pool will first be shut down
   ~ThreadPool();
 
@@ -179,6 +216,10 @@ class ARROW_EXPORT ThreadPool : public Executor {
   // match this value.
   int GetCapacity() override;
 
+  bool OwnsThisThread() override;
+
+  bool RunPendingTask() override;
+
   // Dynamically change the number of worker threads.
   // This function returns quickly, but it may take more time before the
   // thread count is fully adjusted.
@@ -225,6 +266,34 @@ class ARROW_EXPORT ThreadPool : public Executor {
 #endif
 };
 
+// An Executor running the tasks on another executor, with at most a given number
+// of them in flight at any time.  Tasks over the limit are queued until a running
+// task finishes, the most urgent (see TaskHints::priority) first.  This lets
+// several throttled executors share a thread pool, e.g. one per filesystem, each
+// with its own cap on concurrent requests.
+class ARROW_EXPORT ThrottledExecutor : public Executor {
+ public:
+  // The underlying executor must outlive the tasks spawned on the returned one
+  static Result<std::shared_ptr<ThrottledExecutor>> Make(Executor* executor,
+                                                         int max_in_flight);
+
+  ~ThrottledExecutor() override;
+
+  // The smaller of max_in_flight() and the capacity of the underlying executor
+  int GetCapacity() override;
+
+  int max_in_flight() const;
+
+  struct State;
+
+ protected:
+  explicit ThrottledExecutor(std::shared_ptr<State> state);
+
+  Status SpawnReal(TaskHints hints, std::function<void()> task) override;
+
+  std::shared_ptr<State> state_;
+};
+
 // Return the process-global thread pool for CPU-bound tasks.
 ARROW_EXPORT ThreadPool* GetCpuThreadPool();
 
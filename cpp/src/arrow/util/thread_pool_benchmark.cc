@@ -25,6 +25,7 @@
 #include <limits>
 #include <memory>
 #include <random>
+#include <thread>
 #include <vector>
 
 #include "arrow/status.h"
@@ -103,6 +104,41 @@ static void ThreadPoolSpawn(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * nspawns);
 }
 
+// Benchmark ThreadPool::Spawn from the worker threads, as with nested tasks
+static void ThreadPoolNestedSpawn(benchmark::State& state) {
+  const auto nthreads = static_cast<int>(state.range(0));
+  const auto workload_size = static_cast<int32_t>(state.range(1));
+
+  Workload workload(workload_size);
+
+  // Each worker spawns its share of the tasks
+  const int32_t nspawns_per_thread = (200000000 / workload_size + 1) / nthreads + 1;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::shared_ptr<ThreadPool> pool;
+    pool = *ThreadPool::Make(nthreads);
+    state.ResumeTiming();
+
+    std::vector<Future<void>> spawners;
+    for (int i = 0; i < nthreads; ++i) {
+      spawners.push_back(pool->SubmitAsFuture([&] {
+        for (int32_t j = 0; j < nspawns_per_thread; ++j) {
+          ABORT_NOT_OK(pool->Spawn(std::ref(workload)));
+        }
+      }));
+    }
+
+    // Wait for all tasks to finish, once they are all spawned
+    WaitForAll(spawners);
+    ABORT_NOT_OK(pool->Shutdown(true /* wait */));
+    state.PauseTiming();
+    pool.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * nspawns_per_thread * nthreads);
+}
+
 // Benchmark serial TaskGroup
 static void SerialTaskGroup(benchmark::State& state) {
   const auto workload_size = static_cast<int32_t>(state.range(0));
@@ -157,9 +193,20 @@ static void WorkloadCost_Customize(benchmark::internal::Benchmark* b) {
   b->UseRealTime();
 }
 
+// Powers of two up to the number of cores, to show contention on large machines
+static std::vector<int> ThreadCounts() {
+  const int max_threads =
+      std::max(8, static_cast<int>(std::thread::hardware_concurrency()));
+  std::vector<int> counts;
+  for (int nthreads = 1; nthreads <= max_threads; nthreads *= 2) {
+    counts.push_back(nthreads);
+  }
+  return counts;
+}
+
 static void ThreadPoolSpawn_Customize(benchmark::internal::Benchmark* b) {
   for (const int32_t w : kWorkloadSizes) {
-    for (const int nthreads : {1, 2, 4, 8}) {
+    for (const int nthreads : ThreadCounts()) {
       b->Args({nthreads, w});
     }
   }
@@ -189,6 +236,7 @@ BENCHMARK(ReferenceWorkloadCost)->Apply(WorkloadCost_Customize);
 
 BENCHMARK(SerialTaskGroup)->Apply(WorkloadCost_Customize);
 BENCHMARK(ThreadPoolSpawn)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK(ThreadPoolNestedSpawn)->Apply(ThreadPoolSpawn_Customize);
 BENCHMARK(ThreadedTaskGroup)->Apply(ThreadPoolSpawn_Customize);
 
 }  // namespace internal
@@ -21,10 +21,12 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
@@ -35,6 +37,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/numa.h"
 #include "arrow/util/thread_pool.h"
 
 namespace arrow {
@@ -211,6 +214,200 @@ TEST_F(TestThreadPool, StressSpawnSlowThreaded) {
   });
 }
 
+TEST_F(TestThreadPool, NestedSpawn) {
+  // Tasks spawned by a worker which then blocks must be stolen by the others
+  auto pool = this->MakeThreadPool(3);
+  std::atomic<int> done(0);
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK(pool->Spawn([&] {
+      for (int j = 0; j < 50; ++j) {
+        ASSERT_OK(pool->Spawn([&] {
+          SleepFor(0.001);
+          ++done;
+        }));
+      }
+      busy_wait(5.0, [&] { return done.load() == 100; });
+    }));
+  }
+  busy_wait(5.0, [&] { return done.load() == 100; });
+  ASSERT_EQ(done.load(), 100);
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST_F(TestThreadPool, RunPendingTask) {
+  auto pool = this->MakeThreadPool(1);
+  ASSERT_FALSE(pool->OwnsThisThread());
+  ASSERT_FALSE(pool->RunPendingTask());
+
+  // The single worker runs the tasks it spawned while waiting for them
+  std::atomic<int> done(0);
+  std::atomic<bool> owned(false);
+  ASSERT_OK(pool->Spawn([&] {
+    owned = pool->OwnsThisThread();
+    for (int i = 0; i < 10; ++i) {
+      ASSERT_OK(pool->Spawn([&] { ++done; }));
+    }
+    while (pool->RunPendingTask()) {
+    }
+  }));
+  busy_wait(5.0, [&] { return done.load() == 10; });
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_TRUE(owned.load());
+  ASSERT_EQ(done.load(), 10);
+}
+
+TEST_F(TestThreadPool, StressNestedSpawn) {
+  auto pool = this->MakeThreadPool(8);
+  std::atomic<int> done(0);
+  std::function<void(int)> spawn_tree = [&](int depth) {
+    ++done;
+    if (depth == 0) return;
+    for (int i = 0; i < 3; ++i) {
+      ASSERT_OK(pool->Spawn([&spawn_tree, depth] { spawn_tree(depth - 1); }));
+    }
+  };
+  ASSERT_OK(pool->Spawn([&] { spawn_tree(6); }));
+  // Shutdown() waits for tasks queued locally to workers
+  busy_wait(5.0, [&] { return done.load() == 1093; });
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(done.load(), 1093);
+}
+
+TEST_F(TestThreadPool, Priorities) {
+  auto pool = this->MakeThreadPool(1);
+  std::mutex mutex;
+  std::vector<int> order;
+  auto record = [&](int value) {
+    return [&, value] {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(value);
+    };
+  };
+  auto num_recorded = [&] {
+    std::lock_guard<std::mutex> lock(mutex);
+    return order.size();
+  };
+  TaskHints urgent;
+  urgent.priority = -1;
+  TaskHints lazy;
+  lazy.priority = 1;
+
+  // Block the only worker so that the tasks spawned from outside queue up
+  std::atomic<bool> started(false), release(false);
+  ASSERT_OK(pool->Spawn([&] {
+    started = true;
+    busy_wait(5.0, [&] { return release.load(); });
+  }));
+  busy_wait(5.0, [&] { return started.load(); });
+  ASSERT_OK(pool->Spawn(lazy, record(1)));
+  ASSERT_OK(pool->Spawn(record(2)));
+  ASSERT_OK(pool->Spawn(urgent, record(3)));
+  ASSERT_OK(pool->Spawn(record(4)));
+  release = true;
+  busy_wait(5.0, [&] { return num_recorded() == 4; });
+  // The most urgent first, then first in, first out
+  ASSERT_EQ(order, std::vector<int>({3, 2, 4, 1}));
+
+  // Tasks spawned by the worker
+  order.clear();
+  ASSERT_OK(pool->Spawn([&] {
+    ASSERT_OK(pool->Spawn(lazy, record(1)));
+    ASSERT_OK(pool->Spawn(record(2)));
+    ASSERT_OK(pool->Spawn(urgent, record(3)));
+    ASSERT_OK(pool->Spawn(record(4)));
+  }));
+  busy_wait(5.0, [&] { return num_recorded() == 4; });
+  ASSERT_OK(pool->Shutdown());
+  // The most urgent first, then last in, first out
+  ASSERT_EQ(order, std::vector<int>({3, 4, 2, 1}));
+}
+
+TEST_F(TestThreadPool, Throttled) {
+  auto pool = this->MakeThreadPool(4);
+  ASSERT_RAISES(Invalid, ThrottledExecutor::Make(pool.get(), 0));
+  ASSERT_RAISES(Invalid, ThrottledExecutor::Make(nullptr, 1));
+  ASSERT_OK_AND_ASSIGN(auto throttled, ThrottledExecutor::Make(pool.get(), 2));
+  ASSERT_EQ(throttled->max_in_flight(), 2);
+  ASSERT_EQ(throttled->GetCapacity(), 2);
+
+  std::atomic<int> running(0), max_running(0), finished(0);
+  for (int i = 0; i < 50; ++i) {
+    ASSERT_OK(throttled->Spawn([&] {
+      const int now = ++running;
+      int previous = max_running.load();
+      while (now > previous && !max_running.compare_exchange_weak(previous, now)) {
+      }
+      SleepFor(0.001);
+      --running;
+      ++finished;
+    }));
+  }
+  busy_wait(5.0, [&] { return finished.load() == 50; });
+  ASSERT_EQ(finished.load(), 50);
+  ASSERT_GE(max_running.load(), 1);
+  ASSERT_LE(max_running.load(), 2);
+
+  // Futures of submitted tasks complete
+  ASSERT_OK_AND_ASSIGN(auto fut, throttled->Submit(add<int>, 4, 5));
+  ASSERT_OK_AND_EQ(9, fut.result());
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST_F(TestThreadPool, ThrottledPriorities) {
+  auto pool = this->MakeThreadPool(4);
+  ASSERT_OK_AND_ASSIGN(auto throttled, ThrottledExecutor::Make(pool.get(), 1));
+  std::mutex mutex;
+  std::vector<int> order;
+  auto record = [&](int value) {
+    return [&, value] {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(value);
+    };
+  };
+  auto num_recorded = [&] {
+    std::lock_guard<std::mutex> lock(mutex);
+    return order.size();
+  };
+  TaskHints urgent;
+  urgent.priority = -1;
+  TaskHints lazy;
+  lazy.priority = 1;
+
+  // Take the only slot so that the other tasks queue up
+  std::atomic<bool> started(false), release(false);
+  ASSERT_OK(throttled->Spawn([&] {
+    started = true;
+    busy_wait(5.0, [&] { return release.load(); });
+  }));
+  busy_wait(5.0, [&] { return started.load(); });
+  ASSERT_OK(throttled->Spawn(lazy, record(1)));
+  ASSERT_OK(throttled->Spawn(record(2)));
+  ASSERT_OK(throttled->Spawn(urgent, record(3)));
+  ASSERT_OK(throttled->Spawn(record(4)));
+  release = true;
+  busy_wait(5.0, [&] { return num_recorded() == 4; });
+  // The most urgent first, then first in, first out
+  ASSERT_EQ(order, std::vector<int>({3, 2, 4, 1}));
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST_F(TestThreadPool, NumaPinned) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::MakeNumaPinned(4));
+  ASSERT_EQ(pool->GetCapacity(), 4);
+
+  std::atomic<int> bad_nodes(0);
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_OK(pool->Spawn([&] {
+      const int node = GetCurrentNumaNode();
+      if (node < 0 || node >= GetNumaNodeCount()) {
+        ++bad_nodes;
+      }
+    }));
+  }
+  SpawnAdds(pool.get(), 100, task_add<int>);
+  ASSERT_EQ(bad_nodes.load(), 0);
+}
+
 TEST_F(TestThreadPool, QuickShutdown) {
   AddTester add_tester(100);
   {
@@ -0,0 +1,152 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/tracing.h"
+
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <utility>
+
+namespace arrow {
+namespace util {
+namespace tracing {
+
+namespace detail {
+
+std::atomic<bool> g_enabled{false};
+
+}  // namespace detail
+
+namespace {
+
+std::mutex g_exporter_mutex;
+std::shared_ptr<SpanExporter> g_exporter;
+
+int64_t NowNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+uint64_t CurrentThreadId() {
+  static std::atomic<uint64_t> next_id{0};
+  thread_local uint64_t id = next_id++;
+  return id;
+}
+
+void AppendJsonString(const std::string& s, std::ostream* out) {
+  *out << '"';
+  for (const char c : s) {
+    switch (c) {
+      case '"':
+        *out << "\\\"";
+        break;
+      case '\\':
+        *out << "\\\\";
+        break;
+      case '\n':
+        *out << "\\n";
+        break;
+      case '\t':
+        *out << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char escaped[7];
+          snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+          *out << escaped;
+        } else {
+          *out << c;
+        }
+    }
+  }
+  *out << '"';
+}
+
+}  // namespace
+
+void SetExporter(std::shared_ptr<SpanExporter> exporter) {
+  std::lock_guard<std::mutex> lock(g_exporter_mutex);
+  detail::g_enabled.store(exporter != nullptr);
+  g_exporter = std::move(exporter);
+}
+
+std::shared_ptr<SpanExporter> GetExporter() {
+  std::lock_guard<std::mutex> lock(g_exporter_mutex);
+  return g_exporter;
+}
+
+void Span::Start() { start_ns_ = NowNanos(); }
+
+void Span::End() {
+  const int64_t end_ns = NowNanos();
+  // The exporter may have been removed while the span was open
+  auto exporter = GetExporter();
+  if (exporter == nullptr) {
+    return;
+  }
+  exporter->Export(SpanRecord{category_, name_, std::move(detail_), start_ns_,
+                              end_ns - start_ns_, CurrentThreadId()});
+}
+
+void ChromeTraceExporter::Export(SpanRecord span) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  spans_.push_back(std::move(span));
+}
+
+std::vector<SpanRecord> ChromeTraceExporter::spans() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return spans_;
+}
+
+void ChromeTraceExporter::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  spans_.clear();
+}
+
+std::string ChromeTraceExporter::ToJson() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::stringstream ss;
+  ss << "{\"traceEvents\":[";
+  for (size_t i = 0; i < spans_.size(); ++i) {
+    const SpanRecord& span = spans_[i];
+    if (i > 0) {
+      ss << ",";
+    }
+    // Complete ("X") events, with timestamps in microseconds
+    ss << "{\"name\":";
+    AppendJsonString(span.name, &ss);
+    ss << ",\"cat\":";
+    AppendJsonString(span.category, &ss);
+    ss << ",\"ph\":\"X\",\"ts\":" << span.start_ns / 1000 << "."
+       << (span.start_ns % 1000) / 100 << ",\"dur\":" << span.duration_ns / 1000 << "."
+       << (span.duration_ns % 1000) / 100 << ",\"pid\":0,\"tid\":" << span.thread_id;
+    if (!span.detail.empty()) {
+      ss << ",\"args\":{\"detail\":";
+      AppendJsonString(span.detail, &ss);
+      ss << "}";
+    }
+    ss << "}";
+  }
+  ss << "]}";
+  return ss.str();
+}
+
+}  // namespace tracing
+}  // namespace util
+}  // namespace arrow
@@ -0,0 +1,155 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "arrow/util/config.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace util {
+namespace tracing {
+
+/// \brief A completed span, as handed to a SpanExporter
+struct ARROW_EXPORT SpanRecord {
+  /// The subsystem the span belongs to, e.g. "io" or "compute"
+  const char* category;
+  std::string name;
+  /// Free-form detail, e.g. a file path or a function name (may be empty)
+  std::string detail;
+  /// Start time in nanoseconds, on a monotonic clock
+  int64_t start_ns;
+  int64_t duration_ns;
+  /// A small process-unique identifier of the thread the span ran on
+  uint64_t thread_id;
+};
+
+/// \brief Receives completed spans
+///
+/// Implement this to bridge spans to a tracing backend such as OpenTelemetry.
+/// Export() is called concurrently from any thread and must be thread-safe.
+class ARROW_EXPORT SpanExporter {
+ public:
+  virtual ~SpanExporter() = default;
+
+  virtual void Export(SpanRecord span) = 0;
+};
+
+/// \brief Install the process-wide span exporter
+///
+/// Spans are only recorded while an exporter is installed; pass nullptr to stop
+/// recording.
+ARROW_EXPORT void SetExporter(std::shared_ptr<SpanExporter> exporter);
+
+/// \brief Return the process-wide span exporter, or nullptr
+ARROW_EXPORT std::shared_ptr<SpanExporter> GetExporter();
+
+namespace detail {
+
+ARROW_EXPORT extern std::atomic<bool> g_enabled;
+
+}  // namespace detail
+
+/// \brief Whether an exporter is installed
+inline bool IsEnabled() { return detail::g_enabled.load(std::memory_order_relaxed); }
+
+/// \brief Record the lifetime of a scope as a span
+///
+/// Nothing is recorded, and only a relaxed atomic load is paid, unless an
+/// exporter is installed when the span is created.  Prefer the ARROW_TRACE_SPAN
+/// macro, which compiles out entirely unless Arrow is built with
+/// ARROW_WITH_TRACING.
+class ARROW_EXPORT Span {
+ public:
+  Span(const char* category, const char* name) : category_(category), name_(name) {
+    if (IsEnabled()) {
+      Start();
+    }
+  }
+
+  Span(const char* category, const char* name, const std::string& detail)
+      : category_(category), name_(name) {
+    if (IsEnabled()) {
+      detail_ = detail;
+      Start();
+    }
+  }
+
+  ~Span() {
+    if (start_ns_ >= 0) {
+      End();
+    }
+  }
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(Span);
+
+  void Start();
+  void End();
+
+  const char* category_;
+  const char* name_;
+  std::string detail_;
+  int64_t start_ns_ = -1;
+};
+
+/// \brief A SpanExporter buffering spans for the Chrome trace event format
+///
+/// The output of ToJson() can be loaded in chrome://tracing or Perfetto.
+class ARROW_EXPORT ChromeTraceExporter : public SpanExporter {
+ public:
+  void Export(SpanRecord span) override;
+
+  /// \brief Return the spans recorded so far as a JSON trace
+  std::string ToJson() const;
+
+  /// \brief Return the spans recorded so far
+  std::vector<SpanRecord> spans() const;
+
+  /// \brief Discard the spans recorded so far
+  void Clear();
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<SpanRecord> spans_;
+};
+
+}  // namespace tracing
+}  // namespace util
+}  // namespace arrow
+
+#define ARROW_TRACE_SPAN_NAME(LINE) ARROW_CONCAT(_arrow_trace_span_, LINE)
+
+/// \brief Trace the enclosing scope
+///
+/// Takes a category and a name, both string literals, and optionally a
+/// std::string detail.  Expands to nothing unless Arrow is built with
+/// ARROW_WITH_TRACING.
+#ifdef ARROW_WITH_TRACING
+#define ARROW_TRACE_SPAN(...) \
+  ::arrow::util::tracing::Span ARROW_TRACE_SPAN_NAME(__LINE__)(__VA_ARGS__)
+#else
+#define ARROW_TRACE_SPAN(...)
+#endif
@@ -0,0 +1,123 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "arrow/util/tracing.h"
+
+namespace arrow {
+namespace util {
+namespace tracing {
+
+class TestTracing : public ::testing::Test {
+ public:
+  void SetUp() override {
+    exporter_ = std::make_shared<ChromeTraceExporter>();
+    SetExporter(exporter_);
+  }
+
+  void TearDown() override { SetExporter(nullptr); }
+
+ protected:
+  std::shared_ptr<ChromeTraceExporter> exporter_;
+};
+
+TEST_F(TestTracing, Disabled) {
+  SetExporter(nullptr);
+  ASSERT_FALSE(IsEnabled());
+  { Span span("test", "disabled"); }
+  ASSERT_TRUE(exporter_->spans().empty());
+}
+
+TEST_F(TestTracing, Span) {
+  ASSERT_TRUE(IsEnabled());
+  ASSERT_EQ(GetExporter(), exporter_);
+  {
+    Span outer("test", "outer", "some detail");
+    { Span inner("test", "inner"); }
+  }
+  auto spans = exporter_->spans();
+  ASSERT_EQ(spans.size(), 2);
+  // Spans are exported when they end
+  ASSERT_EQ(spans[0].name, "inner");
+  ASSERT_EQ(spans[0].detail, "");
+  ASSERT_EQ(spans[1].name, "outer");
+  ASSERT_EQ(spans[1].detail, "some detail");
+  ASSERT_EQ(std::string(spans[1].category), "test");
+  ASSERT_LE(spans[1].start_ns, spans[0].start_ns);
+  ASSERT_GE(spans[1].duration_ns, spans[0].duration_ns);
+  ASSERT_EQ(spans[0].thread_id, spans[1].thread_id);
+
+  exporter_->Clear();
+  ASSERT_TRUE(exporter_->spans().empty());
+}
+
+TEST_F(TestTracing, Threads) {
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([] {
+      for (int j = 0; j < 100; ++j) {
+        Span span("test", "thread");
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  auto spans = exporter_->spans();
+  ASSERT_EQ(spans.size(), 400);
+  std::vector<uint64_t> thread_ids;
+  for (const auto& span : spans) {
+    thread_ids.push_back(span.thread_id);
+  }
+  std::sort(thread_ids.begin(), thread_ids.end());
+  thread_ids.erase(std::unique(thread_ids.begin(), thread_ids.end()), thread_ids.end());
+  ASSERT_EQ(thread_ids.size(), 4);
+}
+
+TEST_F(TestTracing, ChromeTraceJson) {
+  ASSERT_EQ(exporter_->ToJson(), "{\"traceEvents\":[]}");
+  exporter_->Export(SpanRecord{"io", "Read", "path/with \"quotes\"", 1234567, 2500, 3});
+  exporter_->Export(SpanRecord{"compute", "add", "", 2000000, 999, 4});
+  ASSERT_EQ(exporter_->ToJson(),
+            "{\"traceEvents\":["
+            "{\"name\":\"Read\",\"cat\":\"io\",\"ph\":\"X\",\"ts\":1234.5,"
+            "\"dur\":2.5,\"pid\":0,\"tid\":3,"
+            "\"args\":{\"detail\":\"path/with \\\"quotes\\\"\"}},"
+            "{\"name\":\"add\",\"cat\":\"compute\",\"ph\":\"X\",\"ts\":2000.0,"
+            "\"dur\":0.9,\"pid\":0,\"tid\":4}]}");
+}
+
+TEST_F(TestTracing, Macro) {
+  { ARROW_TRACE_SPAN("test", "macro"); }
+#ifdef ARROW_WITH_TRACING
+  ASSERT_EQ(exporter_->spans().size(), 1);
+#else
+  ASSERT_TRUE(exporter_->spans().empty());
+#endif
+}
+
+}  // namespace tracing
+}  // namespace util
+}  // namespace arrow
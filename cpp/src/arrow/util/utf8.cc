@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <mutex>
 #include <stdexcept>
@@ -80,6 +81,234 @@ ARROW_EXPORT void CheckUTF8Initialized() {
       << "InitializeUTF8() must be called before calling UTF8 routines";
 }
 
+#if defined(ARROW_HAVE_SSE4_2) || defined(ARROW_HAVE_NEON)
+
+// Vectorized UTF8 validation using the "lookup" algorithm from
+// John Keiser, Daniel Lemire, "Validating UTF-8 In Less Than One Instruction
+// Per Byte", Software: Practice and Experience 51 (5), 2021.
+//
+// Each byte is checked together with its predecessor using three 16-entry
+// lookup tables (indexed by the high and low nibble of the previous byte and
+// the high nibble of the current byte).  Each table entry is a bitmask of
+// the error classes below, and an error is detected if any bit survives the
+// AND of the three lookups.  Multi-byte sequence lengths are checked
+// separately by requiring continuation bytes after 3- and 4-byte leads.
+
+// Lead byte (or ASCII) followed by a lead byte or ASCII
+static constexpr uint8_t kTooShort = 1 << 0;
+// ASCII followed by a continuation byte
+static constexpr uint8_t kTooLong = 1 << 1;
+// 3-byte overlong encoding (E0 80..9F)
+static constexpr uint8_t kOverlong3 = 1 << 2;
+// Code point above U+10FFFF (F4 90..BF, F5..FF)
+static constexpr uint8_t kTooLarge = 1 << 3;
+// Surrogate code point (ED A0..BF)
+static constexpr uint8_t kSurrogate = 1 << 4;
+// 2-byte overlong encoding (C0..C1)
+static constexpr uint8_t kOverlong2 = 1 << 5;
+// F5..FF followed by 80..8F
+static constexpr uint8_t kTooLarge1000 = 1 << 6;
+// 4-byte overlong encoding (F0 80..8F)
+static constexpr uint8_t kOverlong4 = 1 << 6;
+// Two continuation bytes in a row (checked against sequence lengths)
+static constexpr uint8_t kTwoConts = 1 << 7;
+static constexpr uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+// clang-format off
+static const uint8_t kUTF8Byte1High[16] = {
+  // 0_______ <ASCII in byte 1>
+  kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+  // 10______ <continuation in byte 1>
+  kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+  // 1100____ <two byte lead in byte 1>
+  kTooShort | kOverlong2,
+  // 1101____ <two byte lead in byte 1>
+  kTooShort,
+  // 1110____ <three byte lead in byte 1>
+  kTooShort | kOverlong3 | kSurrogate,
+  // 1111____ <four+ byte lead in byte 1>
+  kTooShort | kTooLarge | kTooLarge1000 | kOverlong4,
+};
+
+static const uint8_t kUTF8Byte1Low[16] = {
+  // ____0000
+  kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+  // ____0001
+  kCarry | kOverlong2,
+  // ____001_
+  kCarry,
+  kCarry,
+  // ____0100
+  kCarry | kTooLarge,
+  // ____0101
+  kCarry | kTooLarge | kTooLarge1000,
+  // ____011_
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  // ____1___
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  // ____1101
+  kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+  kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+};
+
+static const uint8_t kUTF8Byte2High[16] = {
+  // 0_______ <ASCII in byte 2>
+  kTooShort, kTooShort, kTooShort, kTooShort,
+  kTooShort, kTooShort, kTooShort, kTooShort,
+  // 1000____
+  kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+  // 1001____
+  kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+  // 101_____
+  kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+  kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+  // 11______ <lead byte in byte 2>
+  kTooShort, kTooShort, kTooShort, kTooShort,
+};
+
+// A block is incomplete if it ends with the lead byte of a sequence
+// extending past it (a lead byte greater than these values)
+static const uint8_t kUTF8IncompleteMax[16] = {
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0 - 1, 0xe0 - 1, 0xc0 - 1,
+};
+// clang-format on
+
+#if defined(ARROW_HAVE_SSE4_2)
+
+namespace {
+
+__m128i LoadBlock(const uint8_t* data) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+}
+
+struct UTF8SimdValidator {
+  const __m128i byte_1_high = LoadBlock(kUTF8Byte1High);
+  const __m128i byte_1_low = LoadBlock(kUTF8Byte1Low);
+  const __m128i byte_2_high = LoadBlock(kUTF8Byte2High);
+  const __m128i incomplete_max = LoadBlock(kUTF8IncompleteMax);
+  const __m128i low_nibble_mask = _mm_set1_epi8(0x0f);
+
+  __m128i error = _mm_setzero_si128();
+  __m128i prev_input = _mm_setzero_si128();
+  __m128i prev_incomplete = _mm_setzero_si128();
+
+  __m128i HighNibbles(__m128i v) const {
+    return _mm_and_si128(_mm_srli_epi16(v, 4), low_nibble_mask);
+  }
+
+  void Consume(__m128i input) {
+    if (_mm_movemask_epi8(input) == 0) {
+      // Pure ASCII block: only a sequence left open by the previous block
+      // can be an error
+      error = _mm_or_si128(error, prev_incomplete);
+    } else {
+      const __m128i prev1 = _mm_alignr_epi8(input, prev_input, 16 - 1);
+      const __m128i byte_1_high_class = _mm_shuffle_epi8(byte_1_high, HighNibbles(prev1));
+      const __m128i byte_1_low_class =
+          _mm_shuffle_epi8(byte_1_low, _mm_and_si128(prev1, low_nibble_mask));
+      const __m128i byte_2_high_class = _mm_shuffle_epi8(byte_2_high, HighNibbles(input));
+      const __m128i special_cases = _mm_and_si128(
+          _mm_and_si128(byte_1_high_class, byte_1_low_class), byte_2_high_class);
+      // Bytes 2 or 3 after a 3- or 4-byte lead must be continuations
+      const __m128i prev2 = _mm_alignr_epi8(input, prev_input, 16 - 2);
+      const __m128i prev3 = _mm_alignr_epi8(input, prev_input, 16 - 3);
+      const __m128i is_third_byte = _mm_subs_epu8(prev2, _mm_set1_epi8(0xe0u - 0x80));
+      const __m128i is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8(0xf0u - 0x80));
+      const __m128i must_be_cont = _mm_and_si128(
+          _mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8(-128));
+      error = _mm_or_si128(error, _mm_xor_si128(must_be_cont, special_cases));
+      prev_incomplete = _mm_subs_epu8(input, incomplete_max);
+    }
+    prev_input = input;
+  }
+
+  bool Finish() {
+    error = _mm_or_si128(error, prev_incomplete);
+    return _mm_testz_si128(error, error) != 0;
+  }
+};
+
+}  // namespace
+
+#elif defined(ARROW_HAVE_NEON)
+
+namespace {
+
+uint8x16_t LoadBlock(const uint8_t* data) { return vld1q_u8(data); }
+
+struct UTF8SimdValidator {
+  const uint8x16_t byte_1_high = vld1q_u8(kUTF8Byte1High);
+  const uint8x16_t byte_1_low = vld1q_u8(kUTF8Byte1Low);
+  const uint8x16_t byte_2_high = vld1q_u8(kUTF8Byte2High);
+  const uint8x16_t incomplete_max = vld1q_u8(kUTF8IncompleteMax);
+  const uint8x16_t low_nibble_mask = vdupq_n_u8(0x0f);
+
+  uint8x16_t error = vdupq_n_u8(0);
+  uint8x16_t prev_input = vdupq_n_u8(0);
+  uint8x16_t prev_incomplete = vdupq_n_u8(0);
+
+  void Consume(uint8x16_t input) {
+    if (vmaxvq_u8(input) < 0x80) {
+      // Pure ASCII block: only a sequence left open by the previous block
+      // can be an error
+      error = vorrq_u8(error, prev_incomplete);
+    } else {
+      const uint8x16_t prev1 = vextq_u8(prev_input, input, 16 - 1);
+      const uint8x16_t byte_1_high_class = vqtbl1q_u8(byte_1_high, vshrq_n_u8(prev1, 4));
+      const uint8x16_t byte_1_low_class =
+          vqtbl1q_u8(byte_1_low, vandq_u8(prev1, low_nibble_mask));
+      const uint8x16_t byte_2_high_class = vqtbl1q_u8(byte_2_high, vshrq_n_u8(input, 4));
+      const uint8x16_t special_cases =
+          vandq_u8(vandq_u8(byte_1_high_class, byte_1_low_class), byte_2_high_class);
+      // Bytes 2 or 3 after a 3- or 4-byte lead must be continuations
+      const uint8x16_t prev2 = vextq_u8(prev_input, input, 16 - 2);
+      const uint8x16_t prev3 = vextq_u8(prev_input, input, 16 - 3);
+      const uint8x16_t is_third_byte = vqsubq_u8(prev2, vdupq_n_u8(0xe0u - 0x80));
+      const uint8x16_t is_fourth_byte = vqsubq_u8(prev3, vdupq_n_u8(0xf0u - 0x80));
+      const uint8x16_t must_be_cont =
+          vandq_u8(vorrq_u8(is_third_byte, is_fourth_byte), vdupq_n_u8(0x80));
+      error = vorrq_u8(error, veorq_u8(must_be_cont, special_cases));
+      prev_incomplete = vqsubq_u8(input, incomplete_max);
+    }
+    prev_input = input;
+  }
+
+  bool Finish() {
+    error = vorrq_u8(error, prev_incomplete);
+    return vmaxvq_u8(error) == 0;
+  }
+};
+
+}  // namespace
+
+#endif
+
+bool ValidateUTF8Simd(const uint8_t* data, int64_t size) {
+  UTF8SimdValidator validator;
+  while (size >= 16) {
+    validator.Consume(LoadBlock(data));
+    data += 16;
+    size -= 16;
+  }
+  if (size > 0) {
+    // Pad the tail with ASCII zeros, so that a truncated sequence at the end
+    // of the input is detected as such
+    uint8_t tail[16] = {0};
+    std::memcpy(tail, data, static_cast<size_t>(size));
+    validator.Consume(LoadBlock(tail));
+  }
+  return validator.Finish();
+}
+
+#endif  // defined(ARROW_HAVE_SSE4_2) || defined(ARROW_HAVE_NEON)
+
 }  // namespace internal
 
 static std::once_flag utf8_initialized;
@@ -81,12 +81,24 @@ static inline uint16_t ValidateOneUTF8Byte(uint8_t byte, uint16_t state) {
 
 ARROW_EXPORT void CheckUTF8Initialized();
 
+#if defined(ARROW_HAVE_SSE4_2) || defined(ARROW_HAVE_NEON)
+#define ARROW_HAVE_UTF8_SIMD
+
+// Vectorized UTF8 validation, checking 16 bytes at a time.  It doesn't
+// need InitializeUTF8().
+ARROW_EXPORT bool ValidateUTF8Simd(const uint8_t* data, int64_t size);
+
+// Shorter inputs are faster to validate inline
+static constexpr int64_t kUTF8SimdMinSize = 32;
+#endif
+
 }  // namespace internal
 
 // This function needs to be called before doing UTF8 validation.
 ARROW_EXPORT void InitializeUTF8();
 
-inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
+// Validate UTF8 with the scalar state machine, after an ASCII fast path
+inline bool ValidateUTF8Inline(const uint8_t* data, int64_t size) {
   static constexpr uint64_t high_bits_64 = 0x8080808080808080ULL;
   static constexpr uint32_t high_bits_32 = 0x80808080UL;
   static constexpr uint16_t high_bits_16 = 0x8080U;
@@ -204,6 +216,15 @@ inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
   return ARROW_PREDICT_TRUE(state == internal::kUTF8ValidateAccept);
 }
 
+inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
+#ifdef ARROW_HAVE_UTF8_SIMD
+  if (size >= internal::kUTF8SimdMinSize) {
+    return internal::ValidateUTF8Simd(data, size);
+  }
+#endif
+  return ValidateUTF8Inline(data, size);
+}
+
 inline bool ValidateUTF8(const util::string_view& str) {
   const uint8_t* data = reinterpret_cast<const uint8_t*>(str.data());
   const size_t length = str.size();
@@ -211,6 +232,30 @@ inline bool ValidateUTF8(const util::string_view& str) {
   return ValidateUTF8(data, length);
 }
 
+// Validate the concatenated UTF8 data of `length` strings delimited by `offsets`
+//
+// This returns true if data[offsets[0], offsets[length]) is valid UTF8 and every
+// offset falls on a character boundary, which implies that each string is valid.
+// It is much faster than validating short strings one by one, but a false
+// result doesn't tell which string is invalid (nor whether it is a null slot
+// with arbitrary data), so callers should then fall back on validating
+// strings individually.
+template <typename OffsetType>
+bool ValidateUTF8Offsets(const uint8_t* data, const OffsetType* offsets, int64_t length) {
+  const OffsetType data_start = offsets[0];
+  const OffsetType data_end = offsets[length];
+  if (!ValidateUTF8(data + data_start, data_end - data_start)) {
+    return false;
+  }
+  for (int64_t i = 1; i < length; ++i) {
+    // A continuation byte cannot start a string
+    if (offsets[i] < data_end && (data[offsets[i]] & 0xc0) == 0x80) {
+      return false;
+    }
+  }
+  return true;
+}
+
 inline bool ValidateAsciiSw(const uint8_t* data, int64_t len) {
   uint8_t orall = 0;
 
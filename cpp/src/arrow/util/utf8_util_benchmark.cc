@@ -50,21 +50,23 @@ static std::string MakeLargeString(const std::string& base, int64_t nbytes) {
   return s;
 }
 
+using ValidateFunc = bool (*)(const uint8_t*, int64_t);
+
 static void BenchmarkUTF8Validation(
     benchmark::State& state,  // NOLINT non-const reference
-    const std::string& s, bool expected) {
+    const std::string& s, bool expected, ValidateFunc validate = ValidateUTF8) {
   auto data = reinterpret_cast<const uint8_t*>(s.data());
   auto data_size = static_cast<int64_t>(s.size());
 
   InitializeUTF8();
-  bool b = ValidateUTF8(data, data_size);
+  bool b = validate(data, data_size);
   if (b != expected) {
     std::cerr << "Unexpected validation result" << std::endl;
     std::abort();
   }
 
   while (state.KeepRunning()) {
-    bool b = ValidateUTF8(data, data_size);
+    bool b = validate(data, data_size);
     benchmark::DoNotOptimize(b);
   }
   state.SetBytesProcessed(state.iterations() * s.size());
@@ -112,6 +114,18 @@ static void ValidateSmallNonAscii(
   BenchmarkUTF8Validation(state, valid_non_ascii, true);
 }
 
+// The scalar implementation, for comparison with the vectorized one
+
+static void ValidateSmallAlmostAsciiInline(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUTF8Validation(state, valid_almost_ascii, true, ValidateUTF8Inline);
+}
+
+static void ValidateSmallNonAsciiInline(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUTF8Validation(state, valid_non_ascii, true, ValidateUTF8Inline);
+}
+
 static void ValidateLargeAscii(benchmark::State& state) {  // NOLINT non-const reference
   auto s = MakeLargeString(valid_ascii, 100000);
   BenchmarkASCIIValidation(state, s, true);
@@ -129,6 +143,18 @@ static void ValidateLargeNonAscii(
   BenchmarkUTF8Validation(state, s, true);
 }
 
+static void ValidateLargeAlmostAsciiInline(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto s = MakeLargeString(valid_almost_ascii, 100000);
+  BenchmarkUTF8Validation(state, s, true, ValidateUTF8Inline);
+}
+
+static void ValidateLargeNonAsciiInline(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto s = MakeLargeString(valid_non_ascii, 100000);
+  BenchmarkUTF8Validation(state, s, true, ValidateUTF8Inline);
+}
+
 BENCHMARK(ValidateTinyAscii);
 BENCHMARK(ValidateTinyNonAscii);
 BENCHMARK(ValidateSmallAscii);
@@ -137,6 +163,10 @@ BENCHMARK(ValidateSmallNonAscii);
 BENCHMARK(ValidateLargeAscii);
 BENCHMARK(ValidateLargeAlmostAscii);
 BENCHMARK(ValidateLargeNonAscii);
+BENCHMARK(ValidateSmallAlmostAsciiInline);
+BENCHMARK(ValidateSmallNonAsciiInline);
+BENCHMARK(ValidateLargeAlmostAsciiInline);
+BENCHMARK(ValidateLargeNonAsciiInline);
 
 }  // namespace util
 }  // namespace arrow
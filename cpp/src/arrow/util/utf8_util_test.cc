@@ -297,6 +297,73 @@ TEST_F(UTF8ValidationTest, RandomTruncated) {
   }
 }
 
+TEST_F(UTF8ValidationTest, SequenceAtEveryOffset) {
+  // Exercise block boundaries of the vectorized implementation, if any
+  const std::string padding(48, 'x');
+  for (size_t offset = 0; offset < padding.size(); ++offset) {
+    const std::string prefix = padding.substr(0, offset);
+    const std::string suffix = padding.substr(offset);
+    for (const auto& v : all_valid_sequences) {
+      AssertValidUTF8(prefix + v + suffix);
+      AssertValidUTF8(padding + prefix + v);
+      if (v.size() > 1) {
+        AssertInvalidUTF8(padding + prefix + v.substr(0, v.size() - 1));
+        AssertInvalidUTF8(prefix + v.substr(0, v.size() - 1) + suffix);
+      }
+    }
+    for (const auto& v : all_invalid_sequences) {
+      AssertInvalidUTF8(prefix + v + suffix);
+      AssertInvalidUTF8(padding + prefix + v);
+    }
+  }
+}
+
+TEST_F(UTF8ValidationTest, RandomBytesMatchInline) {
+#ifdef ARROW_VALGRIND
+  const int niters = 500;
+#else
+  const int niters = 20000;
+#endif
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int> length_dist(0, 100);
+  std::uniform_int_distribution<size_t> valid_dist(0, all_valid_sequences.size() - 1);
+  std::uniform_int_distribution<int> byte_dist(0, 255);
+
+  for (int i = 0; i < niters; ++i) {
+    // Mostly valid data with a few random bytes
+    std::string s;
+    const int nchars = length_dist(gen);
+    for (int j = 0; j < nchars; ++j) {
+      if (byte_dist(gen) < 4) {
+        s += static_cast<char>(byte_dist(gen));
+      } else {
+        s += all_valid_sequences[valid_dist(gen)];
+      }
+    }
+    auto data = reinterpret_cast<const uint8_t*>(s.data());
+    ASSERT_EQ(ValidateUTF8Inline(data, s.size()), ValidateUTF8(data, s.size()))
+        << "for string '" << HexEncode(data, static_cast<int32_t>(s.size())) << "'";
+  }
+}
+
+TEST(ValidateUTF8Offsets, Basics) {
+  InitializeUTF8();
+  auto check = [](const std::string& data, const std::vector<int32_t>& offsets) {
+    return ValidateUTF8Offsets(reinterpret_cast<const uint8_t*>(data.data()),
+                               offsets.data(), static_cast<int64_t>(offsets.size()) - 1);
+  };
+  ASSERT_TRUE(check("", {0}));
+  ASSERT_TRUE(check("", {0, 0, 0}));
+  ASSERT_TRUE(check("ab\xc3\xa9", {0, 1, 4, 4}));
+  ASSERT_TRUE(check("xab\xc3\xa9", {1, 3, 5}));
+  // Each string is invalid although the concatenation is valid
+  ASSERT_FALSE(check("ab\xc3\xa9", {0, 3, 4}));
+  ASSERT_FALSE(check("\xe2\x82\xac", {0, 2, 3}));
+  ASSERT_FALSE(check("ab\xc3", {0, 1, 3}));
+  // Only the data between the first and last offsets is validated
+  ASSERT_TRUE(check("\xff" "ab" "\xff", {1, 2, 3}));
+}
+
 TEST(SkipUTF8BOM, Basics) {
   auto CheckOk = [](const std::string& s, size_t expected_offset) -> void {
     const uint8_t* data = reinterpret_cast<const uint8_t*>(s.data());
@@ -17,6 +17,7 @@
 
 #include "arrow/util/value_parsing.h"
 
+#include <cstdlib>
 #include <string>
 #include <utility>
 
@@ -51,9 +52,102 @@ static const StringToFloatConverterImpl g_string_to_float;
 constexpr double StringToFloatConverterImpl::main_junk_value_;
 constexpr double StringToFloatConverterImpl::fallback_junk_value_;
 
+// Fast path for plain decimal numbers (e.g. "-123.456" or "1.5e8") whose
+// significand and power of ten are both exactly representable: a single
+// multiplication or division then yields the correctly rounded result
+// (this is Clinger's fast path, as used by e.g. fast_float).
+// Other inputs, including invalid ones, are left to double-conversion.
+
+template <typename Float>
+struct FloatFastPathTraits;
+
+template <>
+struct FloatFastPathTraits<float> {
+  static constexpr uint64_t kMaxSignificand = uint64_t(1) << 24;
+  static constexpr int kMaxExponent = 10;
+};
+
+template <>
+struct FloatFastPathTraits<double> {
+  static constexpr uint64_t kMaxSignificand = uint64_t(1) << 53;
+  static constexpr int kMaxExponent = 22;
+};
+
+static const double kExactPowersOfTen[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                           1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                           1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                           1e18, 1e19, 1e20, 1e21, 1e22};
+
+inline bool IsDigit(char c) { return static_cast<uint8_t>(c - '0') < 10; }
+
+// Consume decimal digits, returning their number.  Digits beyond what fits
+// in `*value` make the result meaningless, the caller must check the count.
+inline int ConsumeDigits(const char** p, const char* end, uint64_t* value) {
+  const char* start = *p;
+  while (*p != end && IsDigit(**p)) {
+    *value = *value * 10 + static_cast<uint64_t>(**p - '0');
+    ++*p;
+  }
+  return static_cast<int>(*p - start);
+}
+
+template <typename Float>
+bool StringToFloatFastPath(const char* s, size_t length, Float* out) {
+  using Traits = FloatFastPathTraits<Float>;
+  const char* p = s;
+  const char* const end = s + length;
+
+  const bool negative = (p != end && *p == '-');
+  p += negative;
+
+  uint64_t significand = 0;
+  const int int_digits = ConsumeDigits(&p, end, &significand);
+  if (int_digits == 0) {
+    return false;
+  }
+  int num_digits = int_digits;
+  int exponent = 0;
+  if (p != end && *p == '.') {
+    ++p;
+    const int frac_digits = ConsumeDigits(&p, end, &significand);
+    if (frac_digits == 0) {
+      return false;
+    }
+    num_digits += frac_digits;
+    exponent = -frac_digits;
+  }
+  if (p != end && (*p == 'e' || *p == 'E')) {
+    ++p;
+    const bool negative_exponent = (p != end && *p == '-');
+    if (p != end && (*p == '-' || *p == '+')) {
+      ++p;
+    }
+    uint64_t exponent_value = 0;
+    const int exponent_digits = ConsumeDigits(&p, end, &exponent_value);
+    if (exponent_digits == 0 || exponent_digits > 3) {
+      return false;
+    }
+    exponent += negative_exponent ? -static_cast<int>(exponent_value)
+                                  : static_cast<int>(exponent_value);
+  }
+  if (p != end || num_digits > 19 || significand > Traits::kMaxSignificand ||
+      exponent < -Traits::kMaxExponent || exponent > Traits::kMaxExponent) {
+    return false;
+  }
+
+  Float value = static_cast<Float>(significand);
+  const auto power_of_ten = static_cast<Float>(kExactPowersOfTen[std::abs(exponent)]);
+  value = (exponent < 0) ? value / power_of_ten : value * power_of_ten;
+  *out = negative ? -value : value;
+  return true;
+}
+
 }  // namespace
 
 bool StringToFloat(const char* s, size_t length, float* out) {
+  if (StringToFloatFastPath(s, length, out)) {
+    return true;
+  }
   int processed_length;
   float v;
   v = g_string_to_float.main_converter_.StringToFloat(s, static_cast<int>(length),
@@ -71,6 +165,9 @@ bool StringToFloat(const char* s, size_t length, float* out) {
 }
 
 bool StringToFloat(const char* s, size_t length, double* out) {
+  if (StringToFloatFastPath(s, length, out)) {
+    return true;
+  }
   int processed_length;
   double v;
   v = g_string_to_float.main_converter_.StringToDouble(s, static_cast<int>(length),
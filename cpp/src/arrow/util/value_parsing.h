@@ -23,6 +23,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <string>
@@ -30,6 +31,7 @@
 
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/time.h"
@@ -155,6 +157,37 @@ struct StringConverter<DoubleType> {
 
 inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0'); }
 
+// SWAR ("SIMD within a register") helpers, to validate and parse eight
+// ASCII characters at once.  The first character is in the lowest byte.
+
+inline uint64_t LoadEightChars(const char* s) {
+  uint64_t chars;
+  std::memcpy(&chars, s, sizeof(chars));
+  return BitUtil::FromLittleEndian(chars);
+}
+
+// Whether all bytes of `chars` selected by `mask` are decimal digits.
+// The other bytes must not be larger than 0xF9.
+inline bool AreEightDigits(uint64_t chars, uint64_t mask = ~uint64_t(0)) {
+  // A byte is a digit iff its high nibble is 3, and it stays 3 after adding 6
+  const uint64_t high_nibbles = 0xF0F0F0F0F0F0F0F0ULL & mask;
+  const uint64_t expected = 0x3030303030303030ULL & mask;
+  return ((chars & high_nibbles) == expected) &&
+         (((chars + 0x0606060606060606ULL) & high_nibbles) == expected);
+}
+
+// Given eight digit values (0 to 9), return eight bytes where byte i is
+// the two-digit number formed by digits i and i + 1
+inline uint64_t CombineDigitPairs(uint64_t digits) { return digits * 10 + (digits >> 8); }
+
+// Parse eight decimal digits already validated by AreEightDigits()
+inline uint32_t ParseEightDigits(uint64_t chars) {
+  uint64_t v = CombineDigitPairs(chars - 0x3030303030303030ULL) & 0x00FF00FF00FF00FFULL;
+  v = (v * 100 + (v >> 16)) & 0x0000FFFF0000FFFFULL;
+  v = (v * 10000 + (v >> 32)) & 0x00000000FFFFFFFFULL;
+  return static_cast<uint32_t>(v);
+}
+
 #define PARSE_UNSIGNED_ITERATION(C_TYPE)          \
   if (length > 0) {                               \
     uint8_t digit = ParseDecimalDigit(*s++);      \
@@ -169,6 +202,18 @@ inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0');
     break;                                        \
   }
 
+#define PARSE_UNSIGNED_EIGHT_DIGITS(C_TYPE)                                   \
+  {                                                                           \
+    const uint64_t chars = LoadEightChars(s);                                 \
+    if (ARROW_PREDICT_FALSE(!AreEightDigits(chars))) {                        \
+      /* Non-digit */                                                         \
+      return false;                                                           \
+    }                                                                         \
+    result = static_cast<C_TYPE>(result * 100000000U + ParseEightDigits(chars)); \
+    s += 8;                                                                   \
+    length -= 8;                                                              \
+  }
+
 #define PARSE_UNSIGNED_ITERATION_LAST(C_TYPE)                                     \
   if (length > 0) {                                                               \
     if (ARROW_PREDICT_FALSE(result > std::numeric_limits<C_TYPE>::max() / 10U)) { \
@@ -221,6 +266,13 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
   uint32_t result = 0;
   do {
+    if (length >= 8) {
+      // Fast path: parse eight digits at once, then at most two more
+      PARSE_UNSIGNED_EIGHT_DIGITS(uint32_t);
+      PARSE_UNSIGNED_ITERATION(uint32_t);
+      PARSE_UNSIGNED_ITERATION_LAST(uint32_t);
+      break;
+    }
     PARSE_UNSIGNED_ITERATION(uint32_t);
     PARSE_UNSIGNED_ITERATION(uint32_t);
     PARSE_UNSIGNED_ITERATION(uint32_t);
@@ -241,6 +293,28 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
   uint64_t result = 0;
   do {
+    if (length >= 16) {
+      // Fast path: parse sixteen digits at once, then at most four more
+      PARSE_UNSIGNED_EIGHT_DIGITS(uint64_t);
+      PARSE_UNSIGNED_EIGHT_DIGITS(uint64_t);
+      PARSE_UNSIGNED_ITERATION(uint64_t);
+      PARSE_UNSIGNED_ITERATION(uint64_t);
+      PARSE_UNSIGNED_ITERATION(uint64_t);
+      PARSE_UNSIGNED_ITERATION_LAST(uint64_t);
+      break;
+    }
+    if (length >= 8) {
+      // Fast path: parse eight digits at once, then at most seven more
+      PARSE_UNSIGNED_EIGHT_DIGITS(uint64_t);
+      PARSE_UNSIGNED_ITERATION(uint64_t);
+      PARSE_UNSIGNED_ITERATION(uint64_t);
+      PARSE_UNSIGNED_ITERATION(uint64_t);
+      PARSE_UNSIGNED_ITERATION(uint64_t);
+      PARSE_UNSIGNED_ITERATION(uint64_t);
+      PARSE_UNSIGNED_ITERATION(uint64_t);
+      PARSE_UNSIGNED_ITERATION(uint64_t);
+      break;
+    }
     PARSE_UNSIGNED_ITERATION(uint64_t);
     PARSE_UNSIGNED_ITERATION(uint64_t);
     PARSE_UNSIGNED_ITERATION(uint64_t);
@@ -270,6 +344,7 @@ inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
   return true;
 }
 
+#undef PARSE_UNSIGNED_EIGHT_DIGITS
 #undef PARSE_UNSIGNED_ITERATION
 #undef PARSE_UNSIGNED_ITERATION_LAST
 
@@ -390,18 +465,20 @@ using ts_type = TimestampType::c_type;
 
 template <typename Duration>
 static inline bool ParseYYYY_MM_DD(const char* s, Duration* since_epoch) {
-  uint16_t year = 0;
-  uint8_t month = 0;
-  uint8_t day = 0;
-  if (ARROW_PREDICT_FALSE(s[4] != '-') || ARROW_PREDICT_FALSE(s[7] != '-')) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 4, &year))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 5, 2, &month))) {
+  // Validate and parse "YYYY-MM-" at once
+  constexpr uint64_t kSeparatorMask = (0xFFULL << 56) | (0xFFULL << 32);
+  constexpr uint64_t kSeparators = (uint64_t{'-'} << 56) | (uint64_t{'-'} << 32);
+  constexpr uint64_t kZeros = 0x3030303030303030ULL;
+  const uint64_t chars = LoadEightChars(s);
+  if (ARROW_PREDICT_FALSE((chars & kSeparatorMask) != kSeparators) ||
+      ARROW_PREDICT_FALSE(!AreEightDigits(chars, ~kSeparatorMask))) {
     return false;
   }
+  const uint64_t pairs =
+      CombineDigitPairs((chars & ~kSeparatorMask) - (kZeros & ~kSeparatorMask));
+  const auto year = static_cast<uint16_t>((pairs & 0xFF) * 100 + ((pairs >> 16) & 0xFF));
+  const auto month = static_cast<uint8_t>(pairs >> 40);
+  uint8_t day = 0;
   if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 8, 2, &day))) {
     return false;
   }
@@ -454,21 +531,20 @@ static inline bool ParseHH_MM(const char* s, Duration* out) {
 
 template <typename Duration>
 static inline bool ParseHH_MM_SS(const char* s, Duration* out) {
-  uint8_t hours = 0;
-  uint8_t minutes = 0;
-  uint8_t seconds = 0;
-  if (ARROW_PREDICT_FALSE(s[2] != ':') || ARROW_PREDICT_FALSE(s[5] != ':')) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 2, &hours))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 3, 2, &minutes))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 6, 2, &seconds))) {
+  // Validate and parse "hh:mm:ss" at once
+  constexpr uint64_t kSeparatorMask = (0xFFULL << 40) | (0xFFULL << 16);
+  constexpr uint64_t kSeparators = (uint64_t{':'} << 40) | (uint64_t{':'} << 16);
+  constexpr uint64_t kZeros = 0x3030303030303030ULL;
+  const uint64_t chars = LoadEightChars(s);
+  if (ARROW_PREDICT_FALSE((chars & kSeparatorMask) != kSeparators) ||
+      ARROW_PREDICT_FALSE(!AreEightDigits(chars, ~kSeparatorMask))) {
     return false;
   }
+  const uint64_t pairs =
+      CombineDigitPairs((chars & ~kSeparatorMask) - (kZeros & ~kSeparatorMask));
+  const auto hours = static_cast<uint8_t>(pairs);
+  const auto minutes = static_cast<uint8_t>(pairs >> 24);
+  const auto seconds = static_cast<uint8_t>(pairs >> 48);
   if (ARROW_PREDICT_FALSE(hours >= 24)) {
     return false;
   }
@@ -15,6 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstdlib>
+#include <limits>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -87,6 +90,44 @@ TEST(StringConversion, ToDouble) {
   AssertConversionFails<DoubleType>("e");
 }
 
+TEST(StringConversion, ToDoubleFastPath) {
+  // Plain decimal numbers with exactly representable significand and
+  // power of ten must be parsed identically to the generic path
+  AssertConversion<DoubleType>("123.456", 123.456);
+  AssertConversion<DoubleType>("-0.0012345", -0.0012345);
+  AssertConversion<DoubleType>("9007199254740992", 9007199254740992.0);
+  AssertConversion<DoubleType>("9007199254740993", 9007199254740992.0);
+  AssertConversion<DoubleType>("1.5e22", 1.5e22);
+  AssertConversion<DoubleType>("1.5E-22", 1.5e-22);
+  AssertConversion<DoubleType>("1e+23", 1e23);
+  AssertConversion<DoubleType>("0.1234567890123456789", 0.1234567890123456789);
+  AssertConversion<FloatType>("-3456.789", -3456.789f);
+  AssertConversion<FloatType>("16777217", 16777216.0f);
+  AssertConversion<FloatType>("2.5e-10", 2.5e-10f);
+
+  AssertConversionFails<DoubleType>("-");
+  AssertConversionFails<DoubleType>("1.5e");
+  AssertConversionFails<DoubleType>("1.5e+");
+  AssertConversionFails<DoubleType>("1.5x");
+  AssertConversionFails<DoubleType>("1-5");
+
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> significands(0, 99999999999LL);
+  std::uniform_int_distribution<int> exponents(-30, 30);
+  for (int i = 0; i < 1000; ++i) {
+    auto s = std::to_string(significands(gen));
+    auto pos = std::uniform_int_distribution<size_t>(1, s.size())(gen);
+    if (pos < s.size()) {
+      s.insert(pos, ".");
+    }
+    if (i % 2) {
+      s += "e" + std::to_string(exponents(gen));
+    }
+    AssertConversion<DoubleType>(s, std::strtod(s.c_str(), nullptr));
+    AssertConversion<FloatType>(s, std::strtof(s.c_str(), nullptr));
+  }
+}
+
 #if !defined(_WIN32) || defined(NDEBUG)
 
 TEST(StringConversion, ToFloatLocale) {
@@ -239,6 +280,35 @@ TEST(StringConversion, ToUInt64) {
   AssertConversionFails<UInt64Type>("e");
 }
 
+TEST(StringConversion, ToIntegerSWAR) {
+  // Exercise all combinations of 8-digit blocks and remaining digits
+  std::string digits = "12345678901234567890";
+  for (size_t length = 1; length <= digits.size(); ++length) {
+    const auto s = digits.substr(0, length);
+    const uint64_t expected = std::stoull(s);
+    AssertConversion<UInt64Type>(s, expected);
+    AssertConversion<UInt64Type>("000" + s, expected);
+    if (length <= 10 && expected <= std::numeric_limits<uint32_t>::max()) {
+      AssertConversion<UInt32Type>(s, static_cast<uint32_t>(expected));
+    } else {
+      AssertConversionFails<UInt32Type>(s);
+    }
+    // A non-digit anywhere must be detected
+    for (size_t i = 0; i < length; ++i) {
+      for (char c : {'/', ':', 'a', ' ', '\xfa', '\xff'}) {
+        auto invalid = s;
+        invalid[i] = c;
+        AssertConversionFails<UInt64Type>(invalid);
+        AssertConversionFails<UInt32Type>(invalid);
+      }
+    }
+  }
+  AssertConversionFails<UInt64Type>("123456789012345678901");
+  AssertConversionFails<UInt64Type>("99999999999999999999");
+  AssertConversion<Int64Type>("-1234567890123456", -1234567890123456LL);
+  AssertConversion<Int32Type>("-12345678", -12345678);
+}
+
 TEST(StringConversion, ToDate32) {
   AssertConversion<Date32Type>("1970-01-01", 0);
   AssertConversion<Date32Type>("1970-01-02", 1);
@@ -347,6 +417,15 @@ TEST(StringConversion, ToTimestampDateTime_ISO8601) {
     AssertConversionFails(type, "1970-01-01 00:00:60");
     AssertConversionFails(type, "1970-01-01 00:00,00");
     AssertConversionFails(type, "1970-01-01 00,00:00");
+    // A wrong character anywhere must be detected
+    const std::string valid = "2018-11-13 17:11:10";
+    for (size_t i = 0; i < valid.size(); ++i) {
+      for (char c : {'x', '/', '.', '\xfa', '\xff'}) {
+        auto invalid = valid;
+        invalid[i] = c;
+        AssertConversionFails(type, invalid);
+      }
+    }
   }
   {
     TimestampType type{TimeUnit::MILLI};
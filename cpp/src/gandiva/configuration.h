@@ -35,8 +35,9 @@ class GANDIVA_EXPORT Configuration {
  public:
   friend class ConfigurationBuilder;
 
-  Configuration() : optimize_(true) {}
-  explicit Configuration(bool optimize) : optimize_(optimize) {}
+  Configuration() : optimize_(true), background_compile_(false) {}
+  explicit Configuration(bool optimize)
+      : optimize_(optimize), background_compile_(false) {}
 
   std::size_t Hash() const;
   bool operator==(const Configuration& other) const;
@@ -45,8 +46,18 @@ class GANDIVA_EXPORT Configuration {
   bool optimize() const { return optimize_; }
   void set_optimize(bool optimize) { optimize_ = optimize; }
 
+  /// If set, projectors and filters are first built without optimizations,
+  /// and switch to the optimized code once it is compiled in the background.
+  /// This reduces the latency of Make() when the optimizations take longer
+  /// than the evaluation of the first batches.
+  bool background_compile() const { return background_compile_; }
+  void set_background_compile(bool background_compile) {
+    background_compile_ = background_compile;
+  }
+
  private:
   bool optimize_;
+  bool background_compile_;
 };
 
 /// \brief configuration builder for gandiva
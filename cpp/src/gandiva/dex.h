@@ -285,7 +285,7 @@ class InExprDexBase : public Dex {
   InExprDexBase(const ValueValidityPairVector& args,
                 const std::unordered_set<Type>& values)
       : args_(args) {
-    in_holder_.reset(new InHolder<Type>(values));
+    in_holder_ = InHolder<Type>::Make(values);
   }
 
   const ValueValidityPairVector& args() const { return args_; }
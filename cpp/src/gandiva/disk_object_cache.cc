@@ -0,0 +1,178 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/disk_object_cache.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <utility>
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4141)
+#pragma warning(disable : 4146)
+#pragma warning(disable : 4244)
+#pragma warning(disable : 4267)
+#pragma warning(disable : 4624)
+#endif
+
+#include <llvm/Support/CachePruning.h>
+#include <llvm/Support/Chrono.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Process.h>
+#include <llvm/Support/raw_ostream.h>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace gandiva {
+
+namespace {
+
+// pruneCache() only removes files with this prefix
+const char kFilePrefix[] = "llvmcache-";
+
+}  // namespace
+
+constexpr int64_t DiskObjectCache::kDefaultCapacity;
+
+DiskObjectCache::DiskObjectCache(std::string directory, int64_t capacity)
+    : directory_(std::move(directory)),
+      capacity_(capacity),
+      num_hits_(0),
+      num_misses_(0) {}
+
+Status DiskObjectCache::Make(const std::string& directory, int64_t capacity,
+                             std::shared_ptr<DiskObjectCache>* cache) {
+  ARROW_RETURN_IF(directory.empty(),
+                  Status::Invalid("Object cache directory cannot be empty"));
+  ARROW_RETURN_IF(capacity <= 0, Status::Invalid("Object cache capacity must be > 0"));
+  std::error_code error = llvm::sys::fs::create_directories(directory);
+  ARROW_RETURN_IF(error, Status::IOError("Could not create object cache directory '",
+                                         directory, "': ", error.message()));
+  cache->reset(new DiskObjectCache(directory, capacity));
+  return Status::OK();
+}
+
+std::shared_ptr<DiskObjectCache> DiskObjectCache::Default() {
+  static std::shared_ptr<DiskObjectCache> cache = [] {
+    std::shared_ptr<DiskObjectCache> result;
+    auto maybe_directory = arrow::internal::GetEnvVar("GANDIVA_OBJECT_CACHE_DIR");
+    if (!maybe_directory.ok() || maybe_directory.ValueOrDie().empty()) {
+      return result;
+    }
+    int64_t capacity = kDefaultCapacity;
+    auto maybe_capacity = arrow::internal::GetEnvVar("GANDIVA_OBJECT_CACHE_SIZE");
+    if (maybe_capacity.ok()) {
+      const std::string& capacity_string = maybe_capacity.ValueOrDie();
+      char* end = nullptr;
+      const int64_t value = std::strtoll(capacity_string.c_str(), &end, 10);
+      if (end != capacity_string.c_str() && *end == '\0' && value > 0) {
+        capacity = value;
+      } else {
+        ARROW_LOG(WARNING) << "Invalid GANDIVA_OBJECT_CACHE_SIZE '" << capacity_string
+                           << "', using " << capacity << " bytes";
+      }
+    }
+    auto status = Make(maybe_directory.ValueOrDie(), capacity, &result);
+    if (!status.ok()) {
+      ARROW_LOG(WARNING) << "Gandiva object cache disabled: " << status.ToString();
+    }
+    return result;
+  }();
+  return cache;
+}
+
+std::string DiskObjectCache::Path(const std::string& key) const {
+  return directory_ + "/" + kFilePrefix + key;
+}
+
+std::unique_ptr<llvm::MemoryBuffer> DiskObjectCache::Get(const std::string& key) {
+  const std::string path = Path(key);
+  int fd;
+  if (llvm::sys::fs::openFileForRead(path, fd)) {
+    ++num_misses_;
+    return nullptr;
+  }
+  auto maybe_buffer = llvm::MemoryBuffer::getOpenFile(fd, path, /*FileSize=*/-1,
+                                                      /*RequiresNullTerminator=*/false);
+  if (maybe_buffer) {
+    // Mark the file as recently used for pruneCache(). Access times alone are
+    // not reliable, since file systems are often mounted with relatime.
+    const auto now = std::chrono::system_clock::now();
+#if LLVM_VERSION_MAJOR >= 8
+    llvm::sys::fs::setLastAccessAndModificationTime(fd, now);
+#else
+    llvm::sys::fs::setLastModificationAndAccessTime(fd, now);
+#endif
+  }
+  llvm::sys::Process::SafelyCloseFileDescriptor(fd);
+  if (!maybe_buffer) {
+    ++num_misses_;
+    return nullptr;
+  }
+  ++num_hits_;
+  return std::move(maybe_buffer.get());
+}
+
+void DiskObjectCache::Put(const std::string& key, const llvm::MemoryBufferRef& object) {
+  // Write to a temporary file and rename it, so that other processes never
+  // see a partial file. Temporary files left by crashes are pruned like the
+  // others.
+  int fd;
+  llvm::SmallString<128> temp_path;
+  std::error_code error = llvm::sys::fs::createUniqueFile(
+      directory_ + "/" + kFilePrefix + "tmp-%%%%%%%%%%%%", fd, temp_path);
+  if (error) {
+    ARROW_LOG(WARNING) << "Could not create file in Gandiva object cache '"
+                       << directory_ << "': " << error.message();
+    return;
+  }
+  {
+    llvm::raw_fd_ostream stream(fd, /*shouldClose=*/true);
+    stream << object.getBuffer();
+    stream.close();
+    if (stream.has_error()) {
+      error = stream.error();
+      stream.clear_error();
+    }
+  }
+  if (!error) {
+    error = llvm::sys::fs::rename(temp_path, Path(key));
+  }
+  if (error) {
+    ARROW_LOG(WARNING) << "Could not write to Gandiva object cache '" << directory_
+                       << "': " << error.message();
+    llvm::sys::fs::remove(temp_path);
+    return;
+  }
+
+  llvm::CachePruningPolicy policy;
+  // Scan the directory after each write, which is cheap compared to a
+  // compilation
+  policy.Interval = std::chrono::seconds(0);
+  policy.Expiration = std::chrono::seconds(0);
+  policy.MaxSizeBytes = static_cast<uint64_t>(capacity_);
+  llvm::pruneCache(directory_, policy);
+}
+
+}  // namespace gandiva
@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "gandiva/arrow.h"
+#include "gandiva/visibility.h"
+
+namespace llvm {
+class MemoryBuffer;
+class MemoryBufferRef;
+}  // namespace llvm
+
+namespace gandiva {
+
+/// \brief A cache of the object code of compiled modules, in a directory
+///
+/// Processes using the same directory share the cache, so that each module is
+/// compiled once. The least recently used files are removed when the directory
+/// grows over the capacity of the cache.
+///
+/// The cache is enabled for all projectors and filters with the environment
+/// variable GANDIVA_OBJECT_CACHE_DIR, and GANDIVA_OBJECT_CACHE_SIZE sets its
+/// capacity in bytes.
+class GANDIVA_EXPORT DiskObjectCache {
+ public:
+  static constexpr int64_t kDefaultCapacity = 256 << 20;
+
+  /// \brief Create a cache in a directory, which is created if needed.
+  ///
+  /// \param[in] directory the directory of the cache files
+  /// \param[in] capacity the maximum total size of the cache files, in bytes
+  /// \param[out] cache the created cache
+  static Status Make(const std::string& directory, int64_t capacity,
+                     std::shared_ptr<DiskObjectCache>* cache);
+
+  /// \brief Return the cache configured by the environment, or null if the
+  /// cache is disabled.
+  static std::shared_ptr<DiskObjectCache> Default();
+
+  /// \brief Return the object code saved with the key, or null.
+  std::unique_ptr<llvm::MemoryBuffer> Get(const std::string& key);
+
+  /// \brief Save the object code of a module, and remove the least recently
+  /// used files if the cache is over capacity.
+  ///
+  /// Errors are logged but not returned, since they only cost a compilation.
+  void Put(const std::string& key, const llvm::MemoryBufferRef& object);
+
+  const std::string& directory() const { return directory_; }
+  int64_t capacity() const { return capacity_; }
+
+  /// \brief The number of lookups that found object code.
+  int64_t num_hits() const { return num_hits_.load(); }
+  /// \brief The number of lookups that didn't find object code.
+  int64_t num_misses() const { return num_misses_.load(); }
+
+ private:
+  DiskObjectCache(std::string directory, int64_t capacity);
+
+  std::string Path(const std::string& key) const;
+
+  const std::string directory_;
+  const int64_t capacity_;
+  std::atomic<int64_t> num_hits_;
+  std::atomic<int64_t> num_misses_;
+};
+
+}  // namespace gandiva
@@ -53,6 +53,7 @@
 #include <llvm/Linker/Linker.h>
 #include <llvm/MC/SubtargetFeature.h>
 #include <llvm/Support/DynamicLibrary.h>
+#include <llvm/Support/Host.h>
 #include <llvm/Support/TargetRegistry.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/raw_ostream.h>
@@ -72,6 +73,8 @@
 #include "gandiva/decimal_ir.h"
 #include "gandiva/exported_funcs_registry.h"
 
+#include "arrow/util/config.h"
+#include "arrow/util/hashing.h"
 #include "arrow/util/make_unique.h"
 
 namespace gandiva {
@@ -94,7 +97,35 @@ void Engine::InitOnce() {
   llvm_init = true;
 }
 
+namespace {
+
+// Hands the object code of the module to MCJIT if it was in the cache, or
+// saves the object code after compilation otherwise.
+class ModuleObjectCache : public llvm::ObjectCache {
+ public:
+  ModuleObjectCache(std::shared_ptr<DiskObjectCache> cache, std::string key,
+                    std::unique_ptr<llvm::MemoryBuffer> object)
+      : cache_(std::move(cache)), key_(std::move(key)), object_(std::move(object)) {}
+
+  void notifyObjectCompiled(const llvm::Module* module,
+                            llvm::MemoryBufferRef object) override {
+    cache_->Put(key_, object);
+  }
+
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override {
+    return std::move(object_);
+  }
+
+ private:
+  std::shared_ptr<DiskObjectCache> cache_;
+  const std::string key_;
+  std::unique_ptr<llvm::MemoryBuffer> object_;
+};
+
+}  // namespace
+
 Engine::Engine(const std::shared_ptr<Configuration>& conf,
+               std::shared_ptr<DiskObjectCache> object_cache,
                std::unique_ptr<llvm::LLVMContext> ctx,
                std::unique_ptr<llvm::ExecutionEngine> engine, llvm::Module* module)
     : context_(std::move(ctx)),
@@ -102,6 +133,7 @@ Engine::Engine(const std::shared_ptr<Configuration>& conf,
       ir_builder_(arrow::internal::make_unique<llvm::IRBuilder<>>(*context_)),
       module_(module),
       types_(*context_),
+      object_cache_(std::move(object_cache)),
       optimize_(conf->optimize()) {}
 
 Status Engine::Init() {
@@ -117,6 +149,12 @@ Status Engine::Init() {
 /// factory method to construct the engine.
 Status Engine::Make(const std::shared_ptr<Configuration>& conf,
                     std::unique_ptr<Engine>* out) {
+  return Make(conf, DiskObjectCache::Default(), out);
+}
+
+Status Engine::Make(const std::shared_ptr<Configuration>& conf,
+                    std::shared_ptr<DiskObjectCache> object_cache,
+                    std::unique_ptr<Engine>* out) {
   std::call_once(llvm_init_once_flag, InitOnce);
 
   auto ctx = arrow::internal::make_unique<llvm::LLVMContext>();
@@ -145,8 +183,8 @@ Status Engine::Make(const std::shared_ptr<Configuration>& conf,
                                 builder_error);
   }
 
-  std::unique_ptr<Engine> engine{
-      new Engine(conf, std::move(ctx), std::move(exec_engine), module_ptr)};
+  std::unique_ptr<Engine> engine{new Engine(conf, std::move(object_cache), std::move(ctx),
+                                            std::move(exec_engine), module_ptr)};
   ARROW_RETURN_NOT_OK(engine->Init());
   *out = std::move(engine);
   return Status::OK();
@@ -249,11 +287,47 @@ Status Engine::RemoveUnusedFunctions() {
   return Status::OK();
 }
 
+// The IR before optimization determines the object code, along with the
+// optimization level and the target. The key also changes with the versions
+// of LLVM and Gandiva, whose passes differ.
+std::string Engine::ObjectCacheKey() {
+  std::string key_data = DumpIR();
+  key_data += "\noptimize=" + std::to_string(optimize_);
+  key_data += "\ntriple=" + llvm::sys::getProcessTriple();
+  key_data += "\ncpu=" + llvm::sys::getHostCPUName().str();
+  key_data += "\nllvm=" LLVM_VERSION_STRING;
+  key_data += "\ngandiva=" ARROW_VERSION_STRING;
+
+  const auto length = static_cast<int64_t>(key_data.size());
+  const uint64_t hashes[] = {
+      arrow::internal::ComputeStringHash<0>(key_data.data(), length),
+      arrow::internal::ComputeStringHash<1>(key_data.data(), length)};
+  std::stringstream ss;
+  ss << std::hex;
+  for (uint64_t hash : hashes) {
+    ss.width(16);
+    ss.fill('0');
+    ss << hash;
+  }
+  return ss.str();
+}
+
 // Optimise and compile the module.
 Status Engine::FinalizeModule() {
   ARROW_RETURN_NOT_OK(RemoveUnusedFunctions());
 
-  if (optimize_) {
+  // MCJIT loads the cached object code, if any, instead of compiling the module
+  bool compile = true;
+  if (object_cache_ != nullptr) {
+    auto key = ObjectCacheKey();
+    auto cached_object = object_cache_->Get(key);
+    compile = cached_object == nullptr;
+    module_object_cache_ = arrow::internal::make_unique<ModuleObjectCache>(
+        object_cache_, std::move(key), std::move(cached_object));
+    execution_engine_->setObjectCache(module_object_cache_.get());
+  }
+
+  if (optimize_ && compile) {
     // misc passes to allow for inlining, vectorization, ..
     std::unique_ptr<llvm::legacy::PassManager> pass_manager(
         new llvm::legacy::PassManager());
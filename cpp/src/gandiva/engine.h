@@ -26,6 +26,7 @@
 
 #include "arrow/util/logging.h"
 #include "gandiva/configuration.h"
+#include "gandiva/disk_object_cache.h"
 #include "gandiva/llvm_includes.h"
 #include "gandiva/llvm_types.h"
 #include "gandiva/visibility.h"
@@ -47,6 +48,15 @@ class GANDIVA_EXPORT Engine {
   static Status Make(const std::shared_ptr<Configuration>& config,
                      std::unique_ptr<Engine>* engine);
 
+  /// Factory method to create and initialize the engine object.
+  ///
+  /// \param[in] config the engine configuration
+  /// \param[in] object_cache the cache of compiled modules, or null
+  /// \param[out] engine the created engine
+  static Status Make(const std::shared_ptr<Configuration>& config,
+                     std::shared_ptr<DiskObjectCache> object_cache,
+                     std::unique_ptr<Engine>* engine);
+
   /// Add the function to the list of IR functions that need to be compiled.
   /// Compiling only the functions that are used by the module saves time.
   void AddFunctionToCompile(const std::string& fname) {
@@ -54,7 +64,11 @@ class GANDIVA_EXPORT Engine {
     functions_to_compile_.push_back(fname);
   }
 
-  /// Optimise and compile the module.
+  /// Don't use the object cache for the module, because the generated code
+  /// refers to state of this process.
+  void DisableObjectCache() { object_cache_ = nullptr; }
+
+  /// Optimise and compile the module, or load it from the object cache.
   Status FinalizeModule();
 
   /// Get the compiled function corresponding to the irfunction.
@@ -69,6 +83,7 @@ class GANDIVA_EXPORT Engine {
 
  private:
   Engine(const std::shared_ptr<Configuration>& conf,
+         std::shared_ptr<DiskObjectCache> object_cache,
          std::unique_ptr<llvm::LLVMContext> ctx,
          std::unique_ptr<llvm::ExecutionEngine> engine, llvm::Module* module);
 
@@ -89,6 +104,9 @@ class GANDIVA_EXPORT Engine {
   // Remove unused functions to reduce compile time.
   Status RemoveUnusedFunctions();
 
+  // Return the key of the module in the object cache.
+  std::string ObjectCacheKey();
+
   std::unique_ptr<llvm::LLVMContext> context_;
   std::unique_ptr<llvm::ExecutionEngine> execution_engine_;
   std::unique_ptr<llvm::IRBuilder<>> ir_builder_;
@@ -97,6 +115,10 @@ class GANDIVA_EXPORT Engine {
 
   std::vector<std::string> functions_to_compile_;
 
+  std::shared_ptr<DiskObjectCache> object_cache_;
+  // Passes the object code between MCJIT and object_cache_.
+  std::unique_ptr<llvm::ObjectCache> module_object_cache_;
+
   bool optimize_ = true;
   bool module_finalized_ = false;
 };
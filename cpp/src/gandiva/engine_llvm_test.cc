@@ -19,6 +19,7 @@
 
 #include <gtest/gtest.h>
 #include <functional>
+#include "arrow/util/io_util.h"
 #include "gandiva/llvm_types.h"
 #include "gandiva/tests/test_util.h"
 
@@ -100,6 +101,10 @@ class TestEngine : public ::testing::Test {
 
   void BuildEngine() { ASSERT_OK(Engine::Make(TestConfiguration(), &engine)); }
 
+  void BuildEngine(std::shared_ptr<DiskObjectCache> object_cache) {
+    ASSERT_OK(Engine::Make(TestConfiguration(), std::move(object_cache), &engine));
+  }
+
   std::unique_ptr<Engine> engine;
   std::shared_ptr<Configuration> configuration = TestConfiguration();
 };
@@ -128,4 +133,25 @@ TEST_F(TestEngine, TestAddOptimised) {
   EXPECT_EQ(add_func(my_array, 5), 17);
 }
 
+TEST_F(TestEngine, TestAddFromObjectCache) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir,
+                       arrow::internal::TemporaryDir::Make("gandiva-engine-test-"));
+  std::shared_ptr<DiskObjectCache> object_cache;
+  ASSERT_OK(DiskObjectCache::Make(temp_dir->path().ToString(),
+                                  DiskObjectCache::kDefaultCapacity, &object_cache));
+
+  int64_t my_array[] = {1, 3, -5, 8, 10};
+  for (int i = 0; i < 2; ++i) {
+    BuildEngine(object_cache);
+    llvm::Function* ir_func = BuildVecAdd(engine.get());
+    ASSERT_OK(engine->FinalizeModule());
+    auto add_func =
+        reinterpret_cast<add_vector_func_t>(engine->CompiledFunction(ir_func));
+    EXPECT_EQ(add_func(my_array, 5), 17);
+  }
+  // The second engine loads the object code of the first one
+  EXPECT_EQ(object_cache->num_misses(), 1);
+  EXPECT_EQ(object_cache->num_hits(), 1);
+}
+
 }  // namespace gandiva
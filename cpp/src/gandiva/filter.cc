@@ -22,7 +22,11 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/table.h"
 #include "arrow/util/hash_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 #include "gandiva/bitmap_accumulator.h"
 #include "gandiva/cache.h"
@@ -86,6 +90,23 @@ void FilterCacheKey::UpdateUniqifier(const std::string& expr) {
   }
 }
 
+namespace {
+
+// Build the LLVM generator, and generate code for the specified condition
+Status BuildLLVMGenerator(SchemaPtr schema, ConditionPtr condition,
+                          std::shared_ptr<Configuration> configuration,
+                          std::unique_ptr<LLVMGenerator>* llvm_gen) {
+  ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, llvm_gen));
+
+  // Run the validation on the expression.
+  // Return if the expression is invalid since we will not be able to process further.
+  ExprValidator expr_validator((*llvm_gen)->types(), schema);
+  ARROW_RETURN_NOT_OK(expr_validator.Validate(condition));
+  return (*llvm_gen)->Build({condition}, SelectionVector::Mode::MODE_NONE);
+}
+
+}  // namespace
+
 Filter::Filter(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
                std::shared_ptr<Configuration> configuration)
     : llvm_generator_(std::move(llvm_generator)),
@@ -110,23 +131,62 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
     return Status::OK();
   }
 
-  // Build LLVM generator, and generate code for the specified expression
+  // With background compilation, start with unoptimized code, which compiles
+  // much faster.
+  const bool background_compile =
+      configuration->background_compile() && configuration->optimize();
+  auto build_configuration = configuration;
+  if (background_compile) {
+    build_configuration = std::make_shared<Configuration>(*configuration);
+    build_configuration->set_optimize(false);
+  }
   std::unique_ptr<LLVMGenerator> llvm_gen;
-  ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
-
-  // Run the validation on the expression.
-  // Return if the expression is invalid since we will not be able to process further.
-  ExprValidator expr_validator(llvm_gen->types(), schema);
-  ARROW_RETURN_NOT_OK(expr_validator.Validate(condition));
-  ARROW_RETURN_NOT_OK(llvm_gen->Build({condition}, SelectionVector::Mode::MODE_NONE));
+  ARROW_RETURN_NOT_OK(
+      BuildLLVMGenerator(schema, condition, build_configuration, &llvm_gen));
 
   // Instantiate the filter with the completely built llvm generator
   *filter = std::make_shared<Filter>(std::move(llvm_gen), schema, configuration);
+  if (background_compile) {
+    (*filter)->CompileInBackground(condition);
+  }
   cache.PutModule(cache_key, *filter);
 
   return Status::OK();
 }
 
+void Filter::CompileInBackground(ConditionPtr condition) {
+  // The task doesn't keep the filter alive, its result is dropped if the
+  // filter is destroyed first.
+  std::weak_ptr<Filter> weak_filter = shared_from_this();
+  auto schema = schema_;
+  auto configuration = configuration_;
+  compilation_ = arrow::internal::GetCpuThreadPool()->SubmitAsFuture(
+      [weak_filter, schema, condition, configuration]() -> Status {
+        std::unique_ptr<LLVMGenerator> llvm_gen;
+        ARROW_RETURN_NOT_OK(
+            BuildLLVMGenerator(schema, condition, configuration, &llvm_gen));
+        auto filter = weak_filter.lock();
+        if (filter != nullptr) {
+          std::shared_ptr<LLVMGenerator> optimized(std::move(llvm_gen));
+          std::atomic_store(&filter->llvm_generator_, optimized);
+        }
+        return Status::OK();
+      });
+  compilation_.AddCallback([](const Status& status) {
+    if (!status.ok()) {
+      ARROW_LOG(WARNING) << "Background compilation failed, evaluating unoptimized "
+                         << "code: " << status.ToString();
+    }
+  });
+}
+
+Status Filter::WaitForCompilation() {
+  if (!compilation_.is_valid()) {
+    return Status::OK();
+  }
+  return compilation_.status();
+}
+
 Status Filter::Evaluate(const arrow::RecordBatch& batch,
                         std::shared_ptr<SelectionVector> out_selection) {
   const auto num_rows = batch.num_rows();
@@ -148,7 +208,7 @@ Status Filter::Evaluate(const arrow::RecordBatch& batch,
   auto array_data = arrow::ArrayData::Make(arrow::boolean(), num_rows, {validity, value});
 
   // Execute the expression(s).
-  ARROW_RETURN_NOT_OK(llvm_generator_->Execute(batch, {array_data}));
+  ARROW_RETURN_NOT_OK(std::atomic_load(&llvm_generator_)->Execute(batch, {array_data}));
 
   // Compute the intersection of the value and validity.
   auto result = bitmaps.GetLocalBitMap(2);
@@ -158,6 +218,59 @@ Status Filter::Evaluate(const arrow::RecordBatch& batch,
   return out_selection->PopulateFromBitMap(result, bitmap_size, num_rows - 1);
 }
 
-std::string Filter::DumpIR() { return llvm_generator_->DumpIR(); }
+Status Filter::Evaluate(const arrow::Table& table, int64_t batch_size,
+                        SelectionVector::Mode mode, arrow::MemoryPool* pool,
+                        arrow::RecordBatchVector* batches,
+                        std::vector<std::shared_ptr<SelectionVector>>* selections) {
+  ARROW_RETURN_IF(!table.schema()->Equals(*schema_),
+                  Status::Invalid("Table schema must match filter schema"));
+  ARROW_RETURN_IF(batch_size <= 0, Status::Invalid("Batch size must be positive."));
+  ARROW_RETURN_IF(mode == SelectionVector::MODE_NONE,
+                  Status::Invalid("Selection vector mode cannot be MODE_NONE"));
+  ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
+  ARROW_RETURN_IF(batches == nullptr || selections == nullptr,
+                  Status::Invalid("Outputs must be non-null."));
+
+  // Split the table into zero-copy batches, which don't span chunks
+  batches->clear();
+  arrow::TableBatchReader reader(table);
+  reader.set_chunksize(batch_size);
+  std::shared_ptr<arrow::RecordBatch> batch;
+  while (true) {
+    ARROW_RETURN_NOT_OK(reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    if (batch->num_rows() > 0) {
+      batches->push_back(std::move(batch));
+    }
+  }
+
+  // Each evaluation has its own execution context and arena, and only reads the
+  // compiled module, so the batches are evaluated independently.
+  selections->assign(batches->size(), nullptr);
+  return arrow::internal::ParallelFor(
+      static_cast<int>(batches->size()), [&](int i) -> Status {
+        const auto& record_batch = *(*batches)[i];
+        auto selection = &(*selections)[i];
+        switch (mode) {
+          case SelectionVector::MODE_UINT16:
+            ARROW_RETURN_NOT_OK(
+                SelectionVector::MakeInt16(record_batch.num_rows(), pool, selection));
+            break;
+          case SelectionVector::MODE_UINT32:
+            ARROW_RETURN_NOT_OK(
+                SelectionVector::MakeInt32(record_batch.num_rows(), pool, selection));
+            break;
+          default:
+            ARROW_RETURN_NOT_OK(
+                SelectionVector::MakeInt64(record_batch.num_rows(), pool, selection));
+            break;
+        }
+        return Evaluate(record_batch, *selection);
+      });
+}
+
+std::string Filter::DumpIR() { return std::atomic_load(&llvm_generator_)->DumpIR(); }
 
 }  // namespace gandiva
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 
 #include "gandiva/arrow.h"
 #include "gandiva/condition.h"
@@ -63,7 +64,7 @@ class FilterCacheKey {
 ///
 /// A filter is built for a specific schema and condition. Once the filter is built, it
 /// can be used to evaluate many row batches.
-class GANDIVA_EXPORT Filter {
+class GANDIVA_EXPORT Filter : public std::enable_shared_from_this<Filter> {
  public:
   Filter(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
          std::shared_ptr<Configuration> config);
@@ -101,12 +102,39 @@ class GANDIVA_EXPORT Filter {
   Status Evaluate(const arrow::RecordBatch& batch,
                   std::shared_ptr<SelectionVector> out_selection);
 
+  /// Evaluate the specified table in parallel. The table is split into batches of at
+  /// most 'batch_size' records, which are evaluated concurrently on the CPU thread
+  /// pool. Return the batches with the selection vector of each.
+  ///
+  /// \param[in] table the table. schema should be the same as the one in 'Make'
+  /// \param[in] batch_size the maximum number of records of each batch.
+  /// \param[in] mode mode of the selection vectors.
+  /// \param[in] pool memory pool used to allocate the selection vectors.
+  /// \param[out] batches the zero-copy batches of the table.
+  /// \param[out] selections the selection vector of each batch.
+  Status Evaluate(const arrow::Table& table, int64_t batch_size,
+                  SelectionVector::Mode mode, arrow::MemoryPool* pool,
+                  arrow::RecordBatchVector* batches,
+                  std::vector<std::shared_ptr<SelectionVector>>* selections);
+
+  /// Wait for the optimized code that is compiled in the background, if the
+  /// configuration enables background compilation, and return the status of
+  /// the compilation. The evaluation uses unoptimized code until then.
+  Status WaitForCompilation();
+
   std::string DumpIR();
 
  private:
-  std::unique_ptr<LLVMGenerator> llvm_generator_;
+  /// Start compiling the optimized code of the condition in the background.
+  void CompileInBackground(ConditionPtr condition);
+
+  // Replaced by the optimized generator when the background compilation
+  // completes, so always accessed with std::atomic_load() and
+  // std::atomic_store().
+  std::shared_ptr<LLVMGenerator> llvm_generator_;
   SchemaPtr schema_;
   std::shared_ptr<Configuration> configuration_;
+  arrow::Future<Status> compilation_;
 };
 
 }  // namespace gandiva
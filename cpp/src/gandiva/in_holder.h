@@ -17,29 +17,278 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/string_view.h"
 
 #include "gandiva/arrow.h"
 #include "gandiva/gandiva_aliases.h"
 
 namespace gandiva {
 
+/// \brief A bloom filter in front of the hash table of a large IN set.
+///
+/// The filter has about 8 bits per value, so it stays in the CPU caches when the
+/// hash table doesn't, and rejects most missing values with a single load.
+class InBloomFilter {
+ public:
+  /// Sets with fewer values fit in the caches, and aren't filtered.
+  static constexpr int64_t kMinValues = 16 * 1024;
+
+  explicit InBloomFilter(int64_t num_values) : shift_(64) {
+    if (num_values >= kMinValues) {
+      // One 64-bit word per 8 values, rounded up to a power of two
+      const int64_t num_words = arrow::BitUtil::NextPower2(num_values / 8);
+      words_.assign(num_words, 0);
+      shift_ = 64 - arrow::BitUtil::Log2(num_words);
+    }
+  }
+
+  void Insert(uint64_t hash) {
+    if (!words_.empty()) {
+      words_[WordIndex(hash)] |= Mask(hash);
+    }
+  }
+
+  bool MayContain(uint64_t hash) const {
+    return words_.empty() || (words_[WordIndex(hash)] & Mask(hash)) == Mask(hash);
+  }
+
+ private:
+  // Remix the hash, whose low bits already select the hash table slot
+  static uint64_t Remix(uint64_t hash) { return hash * 0x9E3779B97F4A7C15ULL; }
+
+  uint64_t WordIndex(uint64_t hash) const { return Remix(hash) >> shift_; }
+
+  // Two bits in the same word, so that a lookup touches one cache line
+  static uint64_t Mask(uint64_t hash) {
+    const uint64_t remixed = Remix(hash);
+    return (1ULL << ((remixed >> 20) & 63)) | (1ULL << ((remixed >> 26) & 63));
+  }
+
+  std::vector<uint64_t> words_;
+  int shift_;
+};
+
+/// \brief Share the holders of the same large IN set between modules.
+///
+/// A holder is shared as long as a module uses it, so that the projectors of many
+/// expressions with the same IN list don't each build their own copy.
+template <typename Holder, typename Type>
+class InHolderCache {
+ public:
+  /// Sets with fewer values are cheap to build, and aren't shared.
+  static constexpr size_t kMinValues = 1024;
+
+  static std::shared_ptr<Holder> GetOrMake(const std::unordered_set<Type>& values) {
+    if (values.size() < kMinValues) {
+      return std::make_shared<Holder>(values);
+    }
+    // The hash doesn't depend on the iteration order of the set
+    uint64_t key = values.size();
+    for (const auto& value : values) {
+      key += Holder::Hash(value);
+    }
+
+    static std::mutex mutex;
+    static std::unordered_multimap<uint64_t, std::weak_ptr<Holder>> holders;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto range = holders.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+      auto holder = it->second.lock();
+      if (holder != nullptr && holder->Equals(values)) {
+        return holder;
+      }
+    }
+    auto holder = std::make_shared<Holder>(values);
+    // Few large sets are live at once, so drop the expired ones on each insert
+    for (auto it = holders.begin(); it != holders.end();) {
+      it = it->second.expired() ? holders.erase(it) : std::next(it);
+    }
+    holders.emplace(key, holder);
+    return holder;
+  }
+};
+
 /// Function Holder for IN Expressions
+///
+/// The values are kept in an open-addressing hash table with linear probing,
+/// which needs a single cache miss for most lookups.
 template <typename Type>
 class InHolder {
  public:
-  explicit InHolder(const std::unordered_set<Type>& values) {
-    values_.max_load_factor(0.25f);
-    for (auto& value : values) {
-      values_.insert(value);
+  explicit InHolder(const std::unordered_set<Type>& values)
+      : bloom_filter_(static_cast<int64_t>(values.size())),
+        has_empty_value_(false),
+        size_(values.size()) {
+    // A load factor of at most 0.5 keeps the probe sequences short
+    const int64_t capacity =
+        arrow::BitUtil::NextPower2(std::max<int64_t>(16, 2 * values.size()));
+    slots_.assign(capacity, kEmptyValue);
+    mask_ = capacity - 1;
+    for (const auto& value : values) {
+      if (value == kEmptyValue) {
+        has_empty_value_ = true;
+        continue;
+      }
+      const uint64_t hash = Hash(value);
+      bloom_filter_.Insert(hash);
+      uint64_t slot = hash & mask_;
+      while (slots_[slot] != kEmptyValue) {
+        slot = (slot + 1) & mask_;
+      }
+      slots_[slot] = value;
+    }
+  }
+
+  /// Return a holder for the values, shared with other modules for large sets.
+  static std::shared_ptr<InHolder> Make(const std::unordered_set<Type>& values) {
+    return InHolderCache<InHolder, Type>::GetOrMake(values);
+  }
+
+  static uint64_t Hash(Type value) {
+    return arrow::internal::ScalarHelper<Type, 0>::ComputeHash(value);
+  }
+
+  bool HasValue(Type value) const {
+    if (value == kEmptyValue) {
+      return has_empty_value_;
+    }
+    const uint64_t hash = Hash(value);
+    if (!bloom_filter_.MayContain(hash)) {
+      return false;
+    }
+    for (uint64_t slot = hash & mask_; slots_[slot] != kEmptyValue;
+         slot = (slot + 1) & mask_) {
+      if (slots_[slot] == value) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool Equals(const std::unordered_set<Type>& values) const {
+    if (values.size() != size_) {
+      return false;
+    }
+    for (const auto& value : values) {
+      if (!HasValue(value)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+ private:
+  // Marks the empty slots, the value itself is tracked separately
+  static constexpr Type kEmptyValue = 0;
+
+  InBloomFilter bloom_filter_;
+  std::vector<Type> slots_;
+  uint64_t mask_;
+  bool has_empty_value_;
+  size_t size_;
+};
+
+template <typename Type>
+constexpr Type InHolder<Type>::kEmptyValue;
+
+/// Function Holder for IN Expressions on strings
+///
+/// The strings are stored back to back in one buffer, and the open-addressing hash
+/// table only holds their hashes and positions, so that lookups don't allocate.
+template <>
+class InHolder<std::string> {
+ public:
+  explicit InHolder(const std::unordered_set<std::string>& values)
+      : bloom_filter_(static_cast<int64_t>(values.size())), size_(values.size()) {
+    const int64_t capacity =
+        arrow::BitUtil::NextPower2(std::max<int64_t>(16, 2 * values.size()));
+    slots_.assign(capacity, Slot{0, kEmptyIndex});
+    mask_ = capacity - 1;
+    offsets_.reserve(values.size() + 1);
+    offsets_.push_back(0);
+    for (const auto& value : values) {
+      const uint64_t hash = Hash(value);
+      bloom_filter_.Insert(hash);
+      uint64_t slot = hash & mask_;
+      while (slots_[slot].index != kEmptyIndex) {
+        slot = (slot + 1) & mask_;
+      }
+      slots_[slot] = Slot{static_cast<uint32_t>(hash >> 32),
+                          static_cast<int32_t>(offsets_.size() - 1)};
+      data_.append(value);
+      offsets_.push_back(static_cast<int64_t>(data_.size()));
+    }
+  }
+
+  /// Return a holder for the values, shared with other modules for large sets.
+  static std::shared_ptr<InHolder> Make(const std::unordered_set<std::string>& values) {
+    return InHolderCache<InHolder, std::string>::GetOrMake(values);
+  }
+
+  static uint64_t Hash(arrow::util::string_view value) {
+    return arrow::internal::ComputeStringHash<0>(value.data(),
+                                                 static_cast<int64_t>(value.size()));
+  }
+
+  bool HasValue(arrow::util::string_view value) const {
+    const uint64_t hash = Hash(value);
+    if (!bloom_filter_.MayContain(hash)) {
+      return false;
     }
+    const auto tag = static_cast<uint32_t>(hash >> 32);
+    for (uint64_t slot = hash & mask_; slots_[slot].index != kEmptyIndex;
+         slot = (slot + 1) & mask_) {
+      if (slots_[slot].tag == tag) {
+        const int32_t index = slots_[slot].index;
+        const int64_t length = offsets_[index + 1] - offsets_[index];
+        if (length == static_cast<int64_t>(value.size()) &&
+            std::memcmp(data_.data() + offsets_[index], value.data(), length) == 0) {
+          return true;
+        }
+      }
+    }
+    return false;
   }
 
-  bool HasValue(Type value) const { return values_.count(value) == 1; }
+  bool Equals(const std::unordered_set<std::string>& values) const {
+    if (values.size() != size_) {
+      return false;
+    }
+    for (const auto& value : values) {
+      if (!HasValue(value)) {
+        return false;
+      }
+    }
+    return true;
+  }
 
  private:
-  std::unordered_set<Type> values_;
+  static constexpr int32_t kEmptyIndex = -1;
+
+  struct Slot {
+    // High bits of the hash, to skip most string comparisons
+    uint32_t tag;
+    int32_t index;
+  };
+
+  InBloomFilter bloom_filter_;
+  std::vector<Slot> slots_;
+  uint64_t mask_;
+  std::string data_;
+  std::vector<int64_t> offsets_;
+  size_t size_;
 };
 
 }  // namespace gandiva
@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/in_holder.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <unordered_set>
+
+namespace gandiva {
+
+class TestInHolder : public ::testing::Test {};
+
+TEST_F(TestInHolder, TestInt32) {
+  InHolder<int32_t> holder({1, -7, 0, 1 << 20});
+
+  EXPECT_TRUE(holder.HasValue(1));
+  EXPECT_TRUE(holder.HasValue(-7));
+  EXPECT_TRUE(holder.HasValue(0));
+  EXPECT_TRUE(holder.HasValue(1 << 20));
+  EXPECT_FALSE(holder.HasValue(2));
+  EXPECT_FALSE(holder.HasValue(-1));
+
+  // zero marks the empty slots
+  InHolder<int32_t> holder_without_zero({3, 4});
+  EXPECT_FALSE(holder_without_zero.HasValue(0));
+}
+
+TEST_F(TestInHolder, TestInt64Large) {
+  // Large enough for the bloom filter
+  std::unordered_set<int64_t> values;
+  for (int64_t i = 0; i < 3 * InBloomFilter::kMinValues; ++i) {
+    values.insert(i * 3);
+  }
+  InHolder<int64_t> holder(values);
+
+  for (int64_t i = 0; i < 9 * InBloomFilter::kMinValues; ++i) {
+    EXPECT_EQ(holder.HasValue(i), i % 3 == 0) << i;
+  }
+  EXPECT_TRUE(holder.Equals(values));
+  values.erase(3);
+  EXPECT_FALSE(holder.Equals(values));
+}
+
+TEST_F(TestInHolder, TestString) {
+  InHolder<std::string> holder({"", "a", "abc", std::string("a\0b", 3)});
+
+  EXPECT_TRUE(holder.HasValue(""));
+  EXPECT_TRUE(holder.HasValue("a"));
+  EXPECT_TRUE(holder.HasValue("abc"));
+  EXPECT_TRUE(holder.HasValue(arrow::util::string_view("a\0b", 3)));
+  EXPECT_FALSE(holder.HasValue("ab"));
+  EXPECT_FALSE(holder.HasValue("abcd"));
+  EXPECT_FALSE(holder.HasValue(arrow::util::string_view("a\0c", 3)));
+}
+
+TEST_F(TestInHolder, TestShareLargeSets) {
+  std::unordered_set<std::string> values;
+  for (size_t i = 0; i < InHolderCache<InHolder<std::string>, std::string>::kMinValues;
+       ++i) {
+    values.insert("value" + std::to_string(i));
+  }
+  auto holder = InHolder<std::string>::Make(values);
+  EXPECT_EQ(InHolder<std::string>::Make(values), holder);
+  EXPECT_TRUE(holder->HasValue("value0"));
+
+  // Different sets don't share holders
+  values.insert("other");
+  auto other_holder = InHolder<std::string>::Make(values);
+  EXPECT_NE(other_holder, holder);
+  EXPECT_TRUE(other_holder->HasValue("other"));
+  EXPECT_FALSE(holder->HasValue("other"));
+
+  // Nor do small sets
+  std::unordered_set<std::string> small_values({"a", "b"});
+  EXPECT_NE(InHolder<std::string>::Make(small_values),
+            InHolder<std::string>::Make(small_values));
+}
+
+}  // namespace gandiva
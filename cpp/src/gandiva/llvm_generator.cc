@@ -38,6 +38,54 @@ namespace gandiva {
     AddTrace(__VA_ARGS__); \
   }
 
+namespace {
+
+/// Return true if the selected positions are the contiguous range starting
+/// at the first one.
+template <typename C_TYPE>
+bool IsContiguousSelection(const uint8_t* buffer, int64_t num_slots) {
+  auto positions = reinterpret_cast<const C_TYPE*>(buffer);
+  // Check the bounds first, to exit early for the most common sparse selections
+  if (static_cast<int64_t>(positions[num_slots - 1] - positions[0]) != num_slots - 1) {
+    return false;
+  }
+  for (int64_t i = 1; i < num_slots; ++i) {
+    if (positions[i] != positions[0] + i) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool IsContiguousSelection(const SelectionVector& selection_vector) {
+  const uint8_t* buffer = selection_vector.GetBuffer().data();
+  const int64_t num_slots = selection_vector.GetNumSlots();
+  switch (selection_vector.GetMode()) {
+    case SelectionVector::MODE_UINT16:
+      return IsContiguousSelection<uint16_t>(buffer, num_slots);
+    case SelectionVector::MODE_UINT32:
+      return IsContiguousSelection<uint32_t>(buffer, num_slots);
+    case SelectionVector::MODE_UINT64:
+      return IsContiguousSelection<uint64_t>(buffer, num_slots);
+    default:
+      return false;
+  }
+}
+
+/// Copy the bits of the selected positions to the start of 'dst_bitmap'.
+template <typename C_TYPE>
+void GatherSelectedBits(const uint8_t* src_bitmap, const uint8_t* buffer,
+                        int64_t num_slots, uint8_t* dst_bitmap) {
+  auto positions = reinterpret_cast<const C_TYPE*>(buffer);
+  for (int64_t i = 0; i < num_slots; ++i) {
+    if (arrow::BitUtil::GetBit(src_bitmap, positions[i])) {
+      arrow::BitUtil::SetBit(dst_bitmap, i);
+    }
+  }
+}
+
+}  // namespace
+
 LLVMGenerator::LLVMGenerator() : enable_ir_traces_(false) {}
 
 Status LLVMGenerator::Make(std::shared_ptr<Configuration> config,
@@ -63,6 +111,14 @@ Status LLVMGenerator::Add(const ExpressionPtr expr, const FieldDescriptorPtr out
                                        annotator_.buffer_count(), output, idx,
                                        &ir_function, selection_vector_mode_));
   compiled_expr->SetIRFunction(selection_vector_mode_, ir_function);
+  if (selection_vector_mode_ != SelectionVector::MODE_NONE) {
+    // Also generate the function without selection vector, which is used for
+    // selection vectors of contiguous records.
+    ARROW_RETURN_NOT_OK(CodeGenExprValue(value_validity->value_expr(),
+                                         annotator_.buffer_count(), output, idx,
+                                         &ir_function, SelectionVector::MODE_NONE));
+    compiled_expr->SetIRFunction(SelectionVector::MODE_NONE, ir_function);
+  }
 
   compiled_exprs_.push_back(std::move(compiled_expr));
   return Status::OK();
@@ -80,10 +136,16 @@ Status LLVMGenerator::Build(const ExpressionVector& exprs, SelectionVector::Mode
   ARROW_RETURN_NOT_OK(engine_->FinalizeModule());
 
   // setup the jit functions for each expression.
+  std::vector<SelectionVector::Mode> modes = {mode};
+  if (mode != SelectionVector::MODE_NONE) {
+    modes.push_back(SelectionVector::MODE_NONE);
+  }
   for (auto& compiled_expr : compiled_exprs_) {
-    auto ir_fn = compiled_expr->GetIRFunction(mode);
-    auto jit_fn = reinterpret_cast<EvalFunc>(engine_->CompiledFunction(ir_fn));
-    compiled_expr->SetJITFunction(selection_vector_mode_, jit_fn);
+    for (auto fn_mode : modes) {
+      auto ir_fn = compiled_expr->GetIRFunction(fn_mode);
+      auto jit_fn = reinterpret_cast<EvalFunc>(engine_->CompiledFunction(ir_fn));
+      compiled_expr->SetJITFunction(fn_mode, jit_fn);
+    }
   }
 
   return Status::OK();
@@ -102,9 +164,6 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
                               const ArrayDataVector& output_vector) {
   DCHECK_GT(record_batch.num_rows(), 0);
 
-  auto eval_batch = annotator_.PrepareEvalBatch(record_batch, output_vector);
-  DCHECK_GT(eval_batch->GetNumBuffers(), 0);
-
   auto mode = SelectionVector::MODE_NONE;
   if (selection_vector != nullptr) {
     mode = selection_vector->GetMode();
@@ -114,6 +173,27 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
                            selection_vector_mode_, " received vector with mode ", mode);
   }
 
+  // A selection vector of contiguous records, e.g. from a filter that most
+  // records pass, is evaluated on a slice of the batch instead. This avoids the
+  // indirect loads, which prevent the vectorization of the loops, and the
+  // computation of the validity bit by bit. Other selections are never
+  // densified, since evaluating unselected records could raise errors.
+  if (selection_vector != nullptr && selection_vector->GetNumSlots() > 0 &&
+      IsContiguousSelection(*selection_vector)) {
+    auto slice = record_batch.Slice(selection_vector->GetIndex(0),
+                                    selection_vector->GetNumSlots());
+    return ExecuteWithMode(*slice, nullptr, SelectionVector::MODE_NONE, output_vector);
+  }
+  return ExecuteWithMode(record_batch, selection_vector, mode, output_vector);
+}
+
+Status LLVMGenerator::ExecuteWithMode(const arrow::RecordBatch& record_batch,
+                                      const SelectionVector* selection_vector,
+                                      SelectionVector::Mode mode,
+                                      const ArrayDataVector& output_vector) {
+  auto eval_batch = annotator_.PrepareEvalBatch(record_batch, output_vector);
+  DCHECK_GT(eval_batch->GetNumBuffers(), 0);
+
   for (auto& compiled_expr : compiled_exprs_) {
     // generate data/offset vectors.
     const uint8_t* selection_buffer = nullptr;
@@ -467,11 +547,18 @@ void LLVMGenerator::ComputeBitMapsForExpr(const CompiledExpr& compiled_expr,
     accumulator.ComputeResult(temp_bitmap);
 
     auto num_out_records = selection_vector->GetNumSlots();
-    // the memset isn't required, doing it just for valgrind.
+    const uint8_t* buffer = selection_vector->GetBuffer().data();
     memset(dst_bitmap, 0, arrow::BitUtil::BytesForBits(num_out_records));
-    for (auto i = 0; i < num_out_records; ++i) {
-      auto bit = arrow::BitUtil::GetBit(temp_bitmap, selection_vector->GetIndex(i));
-      arrow::BitUtil::SetBitTo(dst_bitmap, i, bit);
+    switch (selection_vector->GetMode()) {
+      case SelectionVector::MODE_UINT16:
+        GatherSelectedBits<uint16_t>(temp_bitmap, buffer, num_out_records, dst_bitmap);
+        break;
+      case SelectionVector::MODE_UINT32:
+        GatherSelectedBits<uint32_t>(temp_bitmap, buffer, num_out_records, dst_bitmap);
+        break;
+      default:
+        GatherSelectedBits<uint64_t>(temp_bitmap, buffer, num_out_records, dst_bitmap);
+        break;
     }
   }
 }
@@ -677,8 +764,9 @@ void LLVMGenerator::Visitor::Visit(const LiteralDex& dex) {
     case arrow::Type::BINARY: {
       const std::string& str = arrow::util::get<std::string>(dex.holder());
 
-      llvm::Constant* str_int_cast = types->i64_constant((int64_t)str.c_str());
-      value = llvm::ConstantExpr::getIntToPtr(str_int_cast, types->i8_ptr_type());
+      // A constant of the module rather than a pointer to the string, so that
+      // the object code can be cached across processes.
+      value = ir_builder()->CreateGlobalStringPtr(str);
       len = types->i32_constant(static_cast<int32_t>(str.length()));
       break;
     }
@@ -1017,6 +1105,7 @@ void LLVMGenerator::Visitor::VisitInExpression(const InExprDexBase<Type>& dex) {
 
   const InExprDex<Type>& dex_instance = dynamic_cast<const InExprDex<Type>&>(dex);
   /* add the holder at the beginning */
+  generator_->engine_->DisableObjectCache();
   llvm::Constant* ptr_int_cast =
       types->i64_constant((int64_t)(dex_instance.in_holder().get()));
   params.push_back(ptr_int_cast);
@@ -1184,6 +1273,7 @@ std::vector<llvm::Value*> LLVMGenerator::Visitor::BuildParams(
 
   // if the function has holder, add the holder pointer.
   if (holder != nullptr) {
+    generator_->engine_->DisableObjectCache();
     auto ptr = types->i64_constant((int64_t)holder);
     params.push_back(ptr);
   }
@@ -1329,6 +1419,7 @@ void LLVMGenerator::AddTrace(const std::string& msg, llvm::Value* value) {
   trace_strings_.push_back(dmsg);
 
   // cast this to an llvm pointer.
+  engine_->DisableObjectCache();
   const char* str = trace_strings_.back().c_str();
   llvm::Constant* str_int_cast = types()->i64_constant((int64_t)str);
   llvm::Constant* str_ptr_cast =
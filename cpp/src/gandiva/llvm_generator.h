@@ -218,6 +218,12 @@ class GANDIVA_EXPORT LLVMGenerator {
   llvm::Value* AddFunctionCall(const std::string& full_name, llvm::Type* ret_type,
                                const std::vector<llvm::Value*>& args);
 
+  /// Execute the functions generated for 'mode' against the provided arguments.
+  Status ExecuteWithMode(const arrow::RecordBatch& record_batch,
+                         const SelectionVector* selection_vector,
+                         SelectionVector::Mode mode,
+                         const ArrayDataVector& output_vector);
+
   /// Compute the result bitmap for the expression.
   ///
   /// \param[in] compiled_expr the compiled expression (includes the bitmap indices to be
@@ -22,8 +22,11 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/table.h"
 #include "arrow/util/hash_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 #include "gandiva/cache.h"
 #include "gandiva/expr_validator.h"
@@ -121,6 +124,28 @@ class ProjectorCacheKey {
   uint32_t uniqifier_;
 };
 
+namespace {
+
+// Build the LLVM generator, and generate code for the specified expressions
+Status BuildLLVMGenerator(SchemaPtr schema, const ExpressionVector& exprs,
+                          SelectionVector::Mode selection_vector_mode,
+                          std::shared_ptr<Configuration> configuration,
+                          std::unique_ptr<LLVMGenerator>* llvm_gen) {
+  ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, llvm_gen));
+
+  // Run the validation on the expressions.
+  // Return if any of the expression is invalid since
+  // we will not be able to process further.
+  ExprValidator expr_validator((*llvm_gen)->types(), schema);
+  for (auto& expr : exprs) {
+    ARROW_RETURN_NOT_OK(expr_validator.Validate(expr));
+  }
+
+  return (*llvm_gen)->Build(exprs, selection_vector_mode);
+}
+
+}  // namespace
+
 Projector::Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
                      const FieldVector& output_fields,
                      std::shared_ptr<Configuration> configuration)
@@ -162,19 +187,18 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
     return Status::OK();
   }
 
-  // Build LLVM generator, and generate code for the specified expressions
-  std::unique_ptr<LLVMGenerator> llvm_gen;
-  ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
-
-  // Run the validation on the expressions.
-  // Return if any of the expression is invalid since
-  // we will not be able to process further.
-  ExprValidator expr_validator(llvm_gen->types(), schema);
-  for (auto& expr : exprs) {
-    ARROW_RETURN_NOT_OK(expr_validator.Validate(expr));
+  // With background compilation, start with unoptimized code, which compiles
+  // much faster.
+  const bool background_compile =
+      configuration->background_compile() && configuration->optimize();
+  auto build_configuration = configuration;
+  if (background_compile) {
+    build_configuration = std::make_shared<Configuration>(*configuration);
+    build_configuration->set_optimize(false);
   }
-
-  ARROW_RETURN_NOT_OK(llvm_gen->Build(exprs, selection_vector_mode));
+  std::unique_ptr<LLVMGenerator> llvm_gen;
+  ARROW_RETURN_NOT_OK(BuildLLVMGenerator(schema, exprs, selection_vector_mode,
+                                         build_configuration, &llvm_gen));
 
   // save the output field types. Used for validation at Evaluate() time.
   std::vector<FieldPtr> output_fields;
@@ -186,11 +210,48 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
   // Instantiate the projector with the completely built llvm generator
   *projector = std::shared_ptr<Projector>(
       new Projector(std::move(llvm_gen), schema, output_fields, configuration));
+  if (background_compile) {
+    (*projector)->CompileInBackground(exprs, selection_vector_mode);
+  }
   cache.PutModule(cache_key, *projector);
 
   return Status::OK();
 }
 
+void Projector::CompileInBackground(const ExpressionVector& exprs,
+                                    SelectionVector::Mode selection_vector_mode) {
+  // The task doesn't keep the projector alive, its result is dropped if the
+  // projector is destroyed first.
+  std::weak_ptr<Projector> weak_projector = shared_from_this();
+  auto schema = schema_;
+  auto configuration = configuration_;
+  compilation_ = arrow::internal::GetCpuThreadPool()->SubmitAsFuture(
+      [weak_projector, schema, exprs, selection_vector_mode, configuration]() -> Status {
+        std::unique_ptr<LLVMGenerator> llvm_gen;
+        ARROW_RETURN_NOT_OK(BuildLLVMGenerator(schema, exprs, selection_vector_mode,
+                                               configuration, &llvm_gen));
+        auto projector = weak_projector.lock();
+        if (projector != nullptr) {
+          std::shared_ptr<LLVMGenerator> optimized(std::move(llvm_gen));
+          std::atomic_store(&projector->llvm_generator_, optimized);
+        }
+        return Status::OK();
+      });
+  compilation_.AddCallback([](const Status& status) {
+    if (!status.ok()) {
+      ARROW_LOG(WARNING) << "Background compilation failed, evaluating unoptimized "
+                         << "code: " << status.ToString();
+    }
+  });
+}
+
+Status Projector::WaitForCompilation() {
+  if (!compilation_.is_valid()) {
+    return Status::OK();
+  }
+  return compilation_.status();
+}
+
 Status Projector::Evaluate(const arrow::RecordBatch& batch,
                            const ArrayDataVector& output_data_vecs) {
   return Evaluate(batch, nullptr, output_data_vecs);
@@ -223,7 +284,8 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
         ValidateArrayDataCapacity(*array_data, *(output_fields_[idx]), num_rows));
     ++idx;
   }
-  return llvm_generator_->Execute(batch, selection_vector, output_data_vecs);
+  return std::atomic_load(&llvm_generator_)
+      ->Execute(batch, selection_vector, output_data_vecs);
 }
 
 Status Projector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
@@ -250,8 +312,8 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
   }
 
   // Execute the expression(s).
-  ARROW_RETURN_NOT_OK(
-      llvm_generator_->Execute(batch, selection_vector, output_data_vecs));
+  ARROW_RETURN_NOT_OK(std::atomic_load(&llvm_generator_)
+                          ->Execute(batch, selection_vector, output_data_vecs));
 
   // Create and return array arrays.
   output->clear();
@@ -261,6 +323,50 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
   return Status::OK();
 }
 
+Status Projector::Evaluate(const arrow::Table& table, int64_t batch_size,
+                           arrow::MemoryPool* pool, arrow::ChunkedArrayVector* output) {
+  ARROW_RETURN_IF(!table.schema()->Equals(*schema_),
+                  Status::Invalid("Schema in Table must match schema in Make()"));
+  ARROW_RETURN_IF(batch_size <= 0, Status::Invalid("Batch size must be positive."));
+  ARROW_RETURN_IF(output == nullptr, Status::Invalid("Output must be non-null."));
+  ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
+
+  // Split the table into zero-copy batches, which don't span chunks
+  std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+  arrow::TableBatchReader reader(table);
+  reader.set_chunksize(batch_size);
+  std::shared_ptr<arrow::RecordBatch> batch;
+  while (true) {
+    ARROW_RETURN_NOT_OK(reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    if (batch->num_rows() > 0) {
+      batches.push_back(std::move(batch));
+    }
+  }
+
+  // Each evaluation has its own execution context and arena, and only reads the
+  // compiled module, so the batches are evaluated independently.
+  std::vector<arrow::ArrayVector> batch_outputs(batches.size());
+  ARROW_RETURN_NOT_OK(arrow::internal::ParallelFor(
+      static_cast<int>(batches.size()), [&](int i) -> Status {
+        return Evaluate(*batches[i], pool, &batch_outputs[i]);
+      }));
+
+  output->clear();
+  for (size_t field_idx = 0; field_idx < output_fields_.size(); ++field_idx) {
+    arrow::ArrayVector chunks;
+    chunks.reserve(batch_outputs.size());
+    for (auto& arrays : batch_outputs) {
+      chunks.push_back(std::move(arrays[field_idx]));
+    }
+    output->push_back(std::make_shared<arrow::ChunkedArray>(
+        std::move(chunks), output_fields_[field_idx]->type()));
+  }
+  return Status::OK();
+}
+
 // TODO : handle complex vectors (list/map/..)
 Status Projector::AllocArrayData(const DataTypePtr& type, int64_t num_records,
                                  arrow::MemoryPool* pool, ArrayDataPtr* array_data) {
@@ -357,6 +463,6 @@ Status Projector::ValidateArrayDataCapacity(const arrow::ArrayData& array_data,
   return Status::OK();
 }
 
-std::string Projector::DumpIR() { return llvm_generator_->DumpIR(); }
+std::string Projector::DumpIR() { return std::atomic_load(&llvm_generator_)->DumpIR(); }
 
 }  // namespace gandiva
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 
 #include "gandiva/arrow.h"
 #include "gandiva/configuration.h"
@@ -38,7 +39,7 @@ class LLVMGenerator;
 ///
 /// A projector is built for a specific schema and vector of expressions.
 /// Once the projector is built, it can be used to evaluate many row batches.
-class GANDIVA_EXPORT Projector {
+class GANDIVA_EXPORT Projector : public std::enable_shared_from_this<Projector> {
  public:
   // Inline dtor will attempt to resolve the destructor for
   // LLVMGenerator on MSVC, so we compile the dtor in the object code
@@ -117,6 +118,23 @@ class GANDIVA_EXPORT Projector {
   Status Evaluate(const arrow::RecordBatch& batch,
                   const SelectionVector* selection_vector, const ArrayDataVector& output);
 
+  /// Evaluate the specified table in parallel, and return the allocated and populated
+  /// output chunked arrays. The table is split into batches of at most 'batch_size'
+  /// records, which are evaluated concurrently on the CPU thread pool. The output
+  /// chunked arrays have one chunk per batch, allocated from the memory pool 'pool'.
+  ///
+  /// \param[in] table the table. schema should be the same as the one in 'Make'
+  /// \param[in] batch_size the maximum number of records of each batch.
+  /// \param[in] pool memory pool used to allocate output arrays.
+  /// \param[out] output the vector of allocated/populated chunked arrays.
+  Status Evaluate(const arrow::Table& table, int64_t batch_size, arrow::MemoryPool* pool,
+                  arrow::ChunkedArrayVector* output);
+
+  /// Wait for the optimized code that is compiled in the background, if the
+  /// configuration enables background compilation, and return the status of
+  /// the compilation. The evaluation uses unoptimized code until then.
+  Status WaitForCompilation();
+
   std::string DumpIR();
 
  private:
@@ -134,10 +152,18 @@ class GANDIVA_EXPORT Projector {
   /// Validate the common args for Evaluate() APIs.
   Status ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch);
 
-  std::unique_ptr<LLVMGenerator> llvm_generator_;
+  /// Start compiling the optimized code of the expressions in the background.
+  void CompileInBackground(const ExpressionVector& exprs,
+                           SelectionVector::Mode selection_vector_mode);
+
+  // Replaced by the optimized generator when the background compilation
+  // completes, so always accessed with std::atomic_load() and
+  // std::atomic_store().
+  std::shared_ptr<LLVMGenerator> llvm_generator_;
   SchemaPtr schema_;
   FieldVector output_fields_;
   std::shared_ptr<Configuration> configuration_;
+  arrow::Future<Status> compilation_;
 };
 
 }  // namespace gandiva
@@ -273,4 +273,68 @@ TEST_F(TestFilterProject, TestSimpleIf) {
   // Validate results
   EXPECT_ARROW_ARRAY_EQUALS(exp, outputs.at(0));
 }
+
+TEST_F(TestFilterProject, TestContiguousSelection) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto field2 = field("f2", int32());
+  auto field_str = field("s", arrow::utf8());
+  auto schema = arrow::schema({field0, field1, field2, field_str});
+
+  // output fields
+  auto field_sum = field("sum", int32());
+  auto field_upper = field("upper", arrow::utf8());
+
+  // Build condition f0 < f1, and expressions f1 + f2 and upper(s)
+  auto condition = TreeExprBuilder::MakeCondition("less_than", {field0, field1});
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field1, field2}, field_sum);
+  auto upper_expr = TreeExprBuilder::MakeExpression("upper", {field_str}, field_upper);
+
+  auto configuration = TestConfiguration();
+
+  std::shared_ptr<Filter> filter;
+  ASSERT_OK(Filter::Make(schema, condition, configuration, &filter));
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr, upper_expr}, SelectionVector::MODE_UINT16,
+                            configuration, &projector));
+
+  // Create a row-batch with some sample data, where the filter selects the
+  // records 1 to 3
+  int num_records = 5;
+  auto array0 = MakeArrowArrayInt32({9, 1, 2, 3, 9}, {true, true, true, true, true});
+  auto array1 = MakeArrowArrayInt32({1, 5, 6, 7, 1}, {true, true, true, true, true});
+  auto array2 = MakeArrowArrayInt32({1, 1, 1, 1, 1}, {true, true, false, true, true});
+  auto array_str = MakeArrowArrayUtf8({"a", "bb", "cc", "dd", "e"},
+                                      {true, true, true, false, true});
+  auto in_batch =
+      arrow::RecordBatch::Make(schema, num_records, {array0, array1, array2, array_str});
+
+  // expected output
+  auto exp_sum = MakeArrowArrayInt32({6, 0, 8}, {true, false, true});
+  auto exp_upper = MakeArrowArrayUtf8({"BB", "CC", ""}, {true, true, false});
+
+  std::shared_ptr<SelectionVector> selection_vector;
+  ASSERT_OK(SelectionVector::MakeInt16(num_records, pool_, &selection_vector));
+  ASSERT_OK(filter->Evaluate(*in_batch, selection_vector));
+  ASSERT_EQ(selection_vector->GetNumSlots(), 3);
+
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*in_batch, selection_vector.get(), pool_, &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_upper, outputs.at(1));
+
+  // Same on a slice of the batch, whose arrays have an offset
+  auto sliced_batch = in_batch->Slice(1);
+  auto exp_sliced_sum = MakeArrowArrayInt32({0, 8}, {false, true});
+  auto exp_sliced_upper = MakeArrowArrayUtf8({"CC", ""}, {true, false});
+  selection_vector->SetIndex(0, 1);
+  selection_vector->SetIndex(1, 2);
+  selection_vector->SetNumSlots(2);
+  ASSERT_OK(
+      projector->Evaluate(*sliced_batch, selection_vector.get(), pool_, &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sliced_sum, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sliced_upper, outputs.at(1));
+}
 }  // namespace gandiva
@@ -18,6 +18,7 @@
 #include "gandiva/filter.h"
 #include <gtest/gtest.h>
 #include "arrow/memory_pool.h"
+#include "arrow/table.h"
 #include "gandiva/tests/test_util.h"
 #include "gandiva/tree_expr_builder.h"
 
@@ -161,6 +162,78 @@ TEST_F(TestFilter, TestSimpleCustomConfig) {
   EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
 }
 
+TEST_F(TestFilter, TestBackgroundCompile) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // Build condition f0 != f1
+  auto condition = TreeExprBuilder::MakeCondition("not_equal", {field0, field1});
+
+  auto config = ConfigurationBuilder().build();
+  config->set_background_compile(true);
+
+  std::shared_ptr<Filter> filter;
+  ASSERT_OK(Filter::Make(schema, condition, config, &filter));
+
+  // Create a row-batch with some sample data
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({11, 2, 3, 17}, {true, true, false, true});
+  // expected output
+  auto exp = MakeArrowArrayUint16({0});
+
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  std::shared_ptr<SelectionVector> selection_vector;
+  ASSERT_OK(SelectionVector::MakeInt16(num_records, pool_, &selection_vector));
+
+  // Evaluate expression, before and after the optimized code is ready
+  ASSERT_OK(filter->Evaluate(*in_batch, selection_vector));
+  EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
+
+  ASSERT_OK(filter->WaitForCompilation());
+  ASSERT_OK(filter->Evaluate(*in_batch, selection_vector));
+  EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
+}
+
+TEST_F(TestFilter, TestEvaluateTable) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // Build condition f0 != f1
+  auto condition = TreeExprBuilder::MakeCondition("not_equal", {field0, field1});
+
+  std::shared_ptr<Filter> filter;
+  ASSERT_OK(Filter::Make(schema, condition, TestConfiguration(), &filter));
+
+  // Create a table with chunks of 3 and 2 records
+  auto chunked0 = std::make_shared<arrow::ChunkedArray>(
+      arrow::ArrayVector{MakeArrowArrayInt32({1, 2, 3}, {true, true, true}),
+                         MakeArrowArrayInt32({4, 5}, {true, false})});
+  auto chunked1 = std::make_shared<arrow::ChunkedArray>(
+      arrow::ArrayVector{MakeArrowArrayInt32({1, 12, 3}, {true, true, true}),
+                         MakeArrowArrayInt32({14, 15}, {true, true})});
+  auto table = arrow::Table::Make(schema, {chunked0, chunked1});
+
+  arrow::RecordBatchVector batches;
+  std::vector<std::shared_ptr<SelectionVector>> selections;
+  ASSERT_OK(filter->Evaluate(*table, 2, SelectionVector::MODE_UINT16, pool_, &batches,
+                             &selections));
+  ASSERT_EQ(batches.size(), 3);
+  ASSERT_EQ(selections.size(), 3);
+  EXPECT_EQ(batches[0]->num_rows(), 2);
+  EXPECT_EQ(batches[1]->num_rows(), 1);
+  EXPECT_EQ(batches[2]->num_rows(), 2);
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayUint16({1}), selections[0]->ToArray());
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayUint16({}), selections[1]->ToArray());
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayUint16({0}), selections[2]->ToArray());
+}
+
 TEST_F(TestFilter, TestZeroCopy) {
   // schema for input fields
   auto field0 = field("f0", int32());
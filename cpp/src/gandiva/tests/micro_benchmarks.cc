@@ -156,6 +156,59 @@ static void TimedTestFilterAdd2(benchmark::State& state) {
   ASSERT_TRUE(status.ok());
 }
 
+// Project the records that pass a filter, which selects a fraction of them
+// given in percent
+static void DoFilterProjectAdd3(benchmark::State& state, int32_t selected_percent) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto field2 = field("f2", int32());
+  auto schema = arrow::schema({field0, field1, field2});
+  auto pool_ = arrow::default_memory_pool();
+
+  // output field
+  auto field_sum = field("add", int32());
+
+  // Build filter f0 < selected_percent, with values in [0, 100)
+  auto threshold = TreeExprBuilder::MakeLiteral(selected_percent);
+  auto less_than = TreeExprBuilder::MakeFunction(
+      "less_than", {TreeExprBuilder::MakeField(field0), threshold}, boolean());
+  auto condition = TreeExprBuilder::MakeCondition(less_than);
+
+  // Build expression f0 + f1 + f2
+  auto part_sum = TreeExprBuilder::MakeFunction(
+      "add", {TreeExprBuilder::MakeField(field1), TreeExprBuilder::MakeField(field2)},
+      int32());
+  auto sum = TreeExprBuilder::MakeFunction(
+      "add", {TreeExprBuilder::MakeField(field0), part_sum}, int32());
+  auto sum_expr = TreeExprBuilder::MakeExpression(sum, field_sum);
+
+  std::shared_ptr<Filter> filter;
+  ASSERT_OK(Filter::Make(schema, condition, TestConfiguration(), &filter));
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr}, SelectionVector::MODE_UINT16,
+                            TestConfiguration(), &projector));
+
+  BoundedInt32DataGenerator data_generator(100);
+  FilterProjectEvaluator evaluator(filter, projector);
+
+  Status status = TimedEvaluate<arrow::Int32Type, int32_t>(
+      schema, evaluator, data_generator, pool_, MILLION, 16 * THOUSAND, state);
+  ASSERT_OK(status);
+}
+
+static void FilterProjectAdd3AllSelected(benchmark::State& state) {
+  DoFilterProjectAdd3(state, 100);
+}
+
+static void FilterProjectAdd3MostSelected(benchmark::State& state) {
+  DoFilterProjectAdd3(state, 90);
+}
+
+static void FilterProjectAdd3FewSelected(benchmark::State& state) {
+  DoFilterProjectAdd3(state, 10);
+}
+
 static void TimedTestFilterLike(benchmark::State& state) {
   // schema for input fields
   auto fielda = field("a", utf8());
@@ -439,6 +492,9 @@ BENCHMARK(TimedTestBigNested)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(TimedTestExtractYear)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(TimedTestFilterAdd2)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(TimedTestFilterLike)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+BENCHMARK(FilterProjectAdd3AllSelected)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+BENCHMARK(FilterProjectAdd3MostSelected)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+BENCHMARK(FilterProjectAdd3FewSelected)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(TimedTestCastFloatFromString)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(TimedTestCastIntFromString)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(TimedTestAllocs)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
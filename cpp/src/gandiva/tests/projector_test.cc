@@ -22,6 +22,7 @@
 #include <cmath>
 
 #include "arrow/memory_pool.h"
+#include "arrow/table.h"
 #include "gandiva/literal_holder.h"
 #include "gandiva/node.h"
 #include "gandiva/tests/test_util.h"
@@ -250,6 +251,88 @@ TEST_F(TestProjector, TestIntSumSub) {
   EXPECT_ARROW_ARRAY_EQUALS(exp_sub, outputs.at(1));
 }
 
+TEST_F(TestProjector, TestBackgroundCompile) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_sum = field("add", int32());
+
+  // Build expression
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+
+  auto configuration = ConfigurationBuilder().build();
+  configuration->set_background_compile(true);
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr}, configuration, &projector));
+
+  // Create a row-batch with some sample data
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({11, 13, 15, 17}, {true, true, false, true});
+  // expected output
+  auto exp_sum = MakeArrowArrayInt32({12, 15, 0, 0}, {true, true, false, false});
+
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // Evaluate expression, before and after the optimized code is ready
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+
+  ASSERT_OK(projector->WaitForCompilation());
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+
+  // A configuration without background compilation builds another projector
+  std::shared_ptr<Projector> sync_projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr}, ConfigurationBuilder().build(),
+                            &sync_projector));
+  EXPECT_NE(sync_projector, projector);
+  ASSERT_OK(sync_projector->WaitForCompilation());
+}
+
+TEST_F(TestProjector, TestEvaluateTable) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_sum = field("add", int32());
+
+  // Build expression
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr}, TestConfiguration(), &projector));
+
+  // Create a table with chunks of 3 and 4 records
+  auto chunked0 = std::make_shared<arrow::ChunkedArray>(arrow::ArrayVector{
+      MakeArrowArrayInt32({1, 2, 3}, {true, true, true}),
+      MakeArrowArrayInt32({4, 5, 6, 7}, {true, false, true, true})});
+  auto chunked1 = std::make_shared<arrow::ChunkedArray>(arrow::ArrayVector{
+      MakeArrowArrayInt32({10, 20, 30}, {true, true, false}),
+      MakeArrowArrayInt32({40, 50, 60, 70}, {true, true, true, true})});
+  auto table = arrow::Table::Make(schema, {chunked0, chunked1});
+
+  // Evaluate the table in batches of at most 2 records, which don't span chunks
+  arrow::ChunkedArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*table, 2, pool_, &outputs));
+  ASSERT_EQ(outputs.size(), 1);
+  EXPECT_EQ(outputs[0]->num_chunks(), 4);
+  auto exp_sum = std::make_shared<arrow::ChunkedArray>(arrow::ArrayVector{
+      MakeArrowArrayInt32({11, 22, 0, 44, 0, 66, 77},
+                          {true, true, false, true, false, true, true})});
+  EXPECT_TRUE(outputs[0]->Equals(*exp_sum));
+
+  ASSERT_RAISES(Invalid, projector->Evaluate(*table, 0, pool_, &outputs));
+}
+
 template <typename TYPE, typename C_TYPE>
 static void TestArithmeticOpsForType(arrow::MemoryPool* pool) {
   auto atype = arrow::TypeTraits<TYPE>::type_singleton();
@@ -22,6 +22,7 @@
 #include <arrow/adapters/orc/adapter.h>
 #include <arrow/array.h>
 #include <arrow/buffer.h>
+#include <arrow/c/bridge.h>
 #include <arrow/io/api.h>
 #include <arrow/ipc/api.h>
 #include <arrow/util/checked_cast.h>
@@ -105,6 +106,25 @@ std::shared_ptr<RecordBatchReader> GetStripeReader(JNIEnv* env, jlong id) {
   return reader;
 }
 
+// The C data interface structs are allocated by the JVM, which passes their
+// addresses
+template <typename T>
+T* StructFromAddress(JNIEnv* env, jlong address) {
+  auto out = reinterpret_cast<T*>(address);
+  if (out == nullptr) {
+    env->ThrowNew(illegal_argument_exception_class, "null C data interface struct");
+  }
+  return out;
+}
+
+bool ThrowIfError(JNIEnv* env, const arrow::Status& status) {
+  if (status.ok()) {
+    return false;
+  }
+  env->ThrowNew(io_exception_class, status.ToString().c_str());
+  return true;
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -218,6 +238,26 @@ Java_org_apache_arrow_adapter_orc_OrcReaderJniWrapper_nextStripeReader(JNIEnv* e
   return orc_stripe_reader_holder_.Insert(stripe_reader);
 }
 
+JNIEXPORT jboolean JNICALL
+Java_org_apache_arrow_adapter_orc_OrcReaderJniWrapper_exportNextStripe(
+    JNIEnv* env, jobject this_obj, jlong id, jlong batch_size, jlong stream_address) {
+  auto reader = GetFileReader(env, id);
+  auto out = StructFromAddress<struct ArrowArrayStream>(env, stream_address);
+  if (!reader || !out) {
+    return false;
+  }
+
+  std::shared_ptr<RecordBatchReader> stripe_reader;
+  if (ThrowIfError(env, reader->NextStripeReader(batch_size, &stripe_reader))) {
+    return false;
+  }
+  if (!stripe_reader) {
+    return false;
+  }
+  // The stream owns the stripe reader, which is released along with it
+  return !ThrowIfError(env, arrow::ExportRecordBatchReader(stripe_reader, out));
+}
+
 JNIEXPORT jbyteArray JNICALL
 Java_org_apache_arrow_adapter_orc_OrcStripeReaderJniWrapper_getSchema(JNIEnv* env,
                                                                       jclass this_cls,
@@ -296,6 +336,38 @@ Java_org_apache_arrow_adapter_orc_OrcStripeReaderJniWrapper_next(JNIEnv* env,
   return ret;
 }
 
+JNIEXPORT void JNICALL
+Java_org_apache_arrow_adapter_orc_OrcStripeReaderJniWrapper_exportSchema(
+    JNIEnv* env, jclass this_cls, jlong id, jlong schema_address) {
+  auto stripe_reader = GetStripeReader(env, id);
+  auto out = StructFromAddress<struct ArrowSchema>(env, schema_address);
+  if (!stripe_reader || !out) {
+    return;
+  }
+  ThrowIfError(env, arrow::ExportSchema(*stripe_reader->schema(), out));
+}
+
+JNIEXPORT jboolean JNICALL
+Java_org_apache_arrow_adapter_orc_OrcStripeReaderJniWrapper_exportNext(
+    JNIEnv* env, jclass this_cls, jlong id, jlong array_address) {
+  auto stripe_reader = GetStripeReader(env, id);
+  auto out = StructFromAddress<struct ArrowArray>(env, array_address);
+  if (!stripe_reader || !out) {
+    return false;
+  }
+
+  std::shared_ptr<arrow::RecordBatch> record_batch;
+  if (ThrowIfError(env, stripe_reader->ReadNext(&record_batch))) {
+    return false;
+  }
+  if (!record_batch) {
+    return false;
+  }
+  // The buffers are handed over as is; the exported array keeps them alive
+  // until the JVM calls its release callback
+  return !ThrowIfError(env, arrow::ExportRecordBatch(*record_batch, out));
+}
+
 JNIEXPORT void JNICALL Java_org_apache_arrow_adapter_orc_OrcStripeReaderJniWrapper_close(
     JNIEnv* env, jclass this_cls, jlong id) {
   orc_stripe_reader_holder_.Erase(id);
@@ -52,6 +52,7 @@
 #include "parquet/arrow/writer.h"
 #include "parquet/column_writer.h"
 #include "parquet/file_writer.h"
+#include "parquet/page_index.h"
 #include "parquet/test_util.h"
 
 using arrow::Array;
@@ -1912,6 +1913,84 @@ TEST(TestArrowReadWrite, MultithreadedRead) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
 }
 
+TEST(TestArrowReadWrite, MultithreadedWrite) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 3, &table));
+
+  auto arrow_properties = ArrowWriterProperties::Builder().set_use_threads(true)->build();
+  // Several row groups, the last of which is smaller
+  ASSERT_NO_FATAL_FAILURE(CheckSimpleRoundtrip(table, 300, arrow_properties));
+  ASSERT_NO_FATAL_FAILURE(
+      CheckSimpleRoundtrip(table->Slice(0, 0), num_rows, arrow_properties));
+}
+
+void WriteRecordBatches(const Table& table, int64_t batch_size,
+                        const std::shared_ptr<WriterProperties>& properties,
+                        const std::shared_ptr<ArrowWriterProperties>& arrow_properties,
+                        std::shared_ptr<Buffer>* out) {
+  auto sink = CreateOutputStream();
+  std::unique_ptr<FileWriter> writer;
+  ASSERT_OK_NO_THROW(FileWriter::Open(*table.schema(), ::arrow::default_memory_pool(),
+                                      sink, properties, arrow_properties, &writer));
+  ::arrow::TableBatchReader batch_reader(table);
+  batch_reader.set_chunksize(batch_size);
+  std::shared_ptr<::arrow::RecordBatch> batch;
+  while (true) {
+    ASSERT_OK(batch_reader.ReadNext(&batch));
+    if (batch == nullptr) break;
+    ASSERT_OK_NO_THROW(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK_NO_THROW(writer->Close());
+  ASSERT_OK_AND_ASSIGN(*out, sink->Finish());
+}
+
+TEST(TestArrowReadWrite, WriteRecordBatches) {
+  const int num_columns = 5;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 3, &table));
+
+  auto check_row_groups = [&](const std::shared_ptr<WriterProperties>& properties,
+                              const std::shared_ptr<ArrowWriterProperties>&
+                                  arrow_properties,
+                              const std::vector<int64_t>& expected_row_group_sizes) {
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_NO_FATAL_FAILURE(
+        WriteRecordBatches(*table, 100, properties, arrow_properties, &buffer));
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                ::arrow::default_memory_pool(), &reader));
+    auto metadata = reader->parquet_reader()->metadata();
+    std::vector<int64_t> row_group_sizes;
+    for (int i = 0; i < metadata->num_row_groups(); i++) {
+      row_group_sizes.push_back(metadata->RowGroup(i)->num_rows());
+    }
+    ASSERT_EQ(expected_row_group_sizes, row_group_sizes);
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ::arrow::AssertTablesEqual(*table, *result, false);
+  };
+
+  // Row groups split batches to stay within max_row_group_length
+  auto properties = WriterProperties::Builder().max_row_group_length(250)->build();
+  ASSERT_NO_FATAL_FAILURE(check_row_groups(properties, default_arrow_writer_properties(),
+                                           {250, 250, 250, 250}));
+  ASSERT_NO_FATAL_FAILURE(check_row_groups(
+      properties, ArrowWriterProperties::Builder().set_use_threads(true)->build(),
+      {250, 250, 250, 250}));
+
+  // Each batch goes over the size limit
+  ASSERT_NO_FATAL_FAILURE(check_row_groups(
+      default_writer_properties(),
+      ArrowWriterProperties::Builder().set_max_row_group_bytes(1)->build(),
+      std::vector<int64_t>(10, 100)));
+}
+
 TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   const int num_columns = 10;
   const int num_rows = 100;
@@ -1948,6 +2027,68 @@ TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   AssertTablesEqual(*table, *concatenated, /*same_chunk_layout=*/false);
 }
 
+TEST(TestArrowReadWrite, ReadRowRanges) {
+  const int num_columns = 3;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> doubles;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &doubles));
+  std::shared_ptr<DataType> list_type;
+  std::shared_ptr<Array> list_values;
+  ASSERT_NO_FATAL_FAILURE(
+      MakeSimpleListArray(num_rows, 20, "item", &list_type, &list_values));
+  ASSERT_OK_AND_ASSIGN(auto table,
+                       doubles->AddColumn(num_columns, ::arrow::field("list", list_type),
+                                          std::make_shared<ChunkedArray>(list_values)));
+
+  const std::vector<RowRange> ranges = {{5, 10}, {390, 20}, {420, 1}, {950, 50}};
+  std::vector<std::shared_ptr<Table>> slices;
+  for (const auto& range : ranges) {
+    slices.push_back(table->Slice(range.offset, range.length));
+  }
+  ASSERT_OK_AND_ASSIGN(auto expected, ::arrow::ConcatenateTables(slices));
+
+  for (bool page_index : {false, true}) {
+    // Small pages, so that each column chunk has pages without a selected row
+    WriterProperties::Builder builder;
+    builder.data_pagesize(256)->write_batch_size(10);
+    if (page_index) {
+      builder.enable_write_page_index();
+    }
+    auto sink = CreateOutputStream();
+    ASSERT_OK_NO_THROW(WriteTable(*table, default_memory_pool(), sink,
+                                  /*row_group_size=*/400, builder.build()));
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                ::arrow::default_memory_pool(), &reader));
+    auto offset_index = reader->parquet_reader()->RowGroup(0)->GetOffsetIndex(0);
+    ASSERT_EQ(page_index, offset_index != nullptr);
+    if (page_index) {
+      ASSERT_GT(offset_index->num_pages(), 2);
+    }
+
+    std::shared_ptr<Table> result;
+    for (bool use_threads : {false, true}) {
+      reader->set_use_threads(use_threads);
+      ASSERT_OK_NO_THROW(reader->ReadRowRanges(ranges, &result));
+      AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false);
+    }
+
+    ASSERT_OK_NO_THROW(reader->ReadRowRanges(ranges, {1, 3}, &result));
+    ASSERT_OK_AND_ASSIGN(auto expected_subset, expected->SelectColumns({1, 3}));
+    AssertTablesEqual(*expected_subset, *result, /*same_chunk_layout=*/false);
+
+    ASSERT_OK_NO_THROW(reader->ReadRowRanges({}, &result));
+    ASSERT_EQ(0, result->num_rows());
+    ASSERT_TRUE(result->schema()->Equals(*table->schema(), /*check_metadata=*/false));
+
+    ASSERT_RAISES(Invalid, reader->ReadRowRanges({{10, 5}, {12, 1}}, &result));
+    ASSERT_RAISES(Invalid, reader->ReadRowRanges({{990, 20}}, &result));
+  }
+}
+
 //  Exercise reading table manually with nested RowGroup and Column loops, i.e.
 //
 //  for (int i = 0; i < n_row_groups; i++)
@@ -2057,6 +2198,54 @@ TEST(TestArrowReadWrite, CoalescedReads) {
   TestGetRecordBatchReader(arrow_properties);
 }
 
+// Same as the test above, but buffering one row group at a time.
+TEST(TestArrowReadWrite, CoalescedReadsWithinBudget) {
+  ArrowReaderProperties arrow_properties = default_arrow_reader_properties();
+  arrow_properties.set_pre_buffer(true);
+  arrow_properties.set_pre_buffer_max_bytes(1);
+  TestGetRecordBatchReader(arrow_properties);
+}
+
+TEST(TestArrowReadWrite, ZeroCopyPages) {
+  const int64_t num_rows = 10000;
+  ::arrow::random::RandomArrayGenerator rag(0);
+  auto schema = ::arrow::schema({::arrow::field("i32", ::arrow::int32(), false),
+                                 ::arrow::field("f64", ::arrow::float64(), false),
+                                 ::arrow::field("opt", ::arrow::int64())});
+  auto table =
+      Table::Make(schema, {rag.Int32(num_rows, -100, 100, /*null_probability=*/0),
+                           rag.Float64(num_rows, -1, 1, /*null_probability=*/0),
+                           rag.Int64(num_rows, -100, 100)});
+
+  for (bool pre_buffer : {false, true}) {
+    SCOPED_TRACE(pre_buffer ? "pre-buffered" : "not pre-buffered");
+    auto sink = CreateOutputStream();
+    auto write_props = WriterProperties::Builder()
+                           .disable_dictionary()
+                           ->data_pagesize(4096)
+                           ->compression(Compression::UNCOMPRESSED)
+                           ->build();
+    ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                  num_rows / 2, write_props));
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_zero_copy_pages(true);
+    properties.set_pre_buffer(pre_buffer);
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ASSERT_OK(result->ValidateFull());
+    ::arrow::AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false);
+    // The optional column is decoded
+    ASSERT_EQ(result->column(2)->num_chunks(), 1);
+  }
+}
+
 TEST(TestArrowReadWrite, GetRecordBatchReaderNoColumns) {
   ArrowReaderProperties properties = default_arrow_reader_properties();
   const int num_rows = 10;
@@ -2433,6 +2622,9 @@ TEST(TestArrowReadWrite, CanonicalNestedRoundTrip) {
   auto expected =
       ::arrow::Table::Make(schema, {doc_id_array, links_id_array, name_array});
   CheckSimpleRoundtrip(expected, 2);
+  // Columns with several leaves are encoded concurrently as well
+  CheckSimpleRoundtrip(expected, 1,
+                       ArrowWriterProperties::Builder().set_use_threads(true)->build());
 }
 
 TEST(ArrowReadWrite, ListOfStruct) {
@@ -3460,10 +3652,61 @@ TEST_P(TestArrowReadDictionary, ReadWholeFileDense) {
   CheckReadWholeFile(*expected_dense_);
 }
 
+TEST_P(TestArrowReadDictionary, ReadWholeFileUnifiedDict) {
+  properties_.set_read_dictionary(0, true);
+  properties_.set_unify_dictionaries(true);
+  WriteSimple();
+
+  ASSERT_OK_AND_ASSIGN(auto reader, GetReader());
+  std::shared_ptr<Table> actual;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+  const auto& column = *actual->column(0);
+  const auto& dictionary = column.chunk(0)->data()->dictionary;
+  for (const auto& chunk : column.chunks()) {
+    ASSERT_EQ(dictionary, chunk->data()->dictionary);
+  }
+  ASSERT_LE(dictionary->length, options.num_uniques);
+
+  ASSERT_OK_AND_ASSIGN(Datum dense,
+                       ::arrow::compute::Cast(actual->column(0), ::arrow::utf8()));
+  ::arrow::AssertChunkedEqual(*expected_dense_->column(0), *dense.chunked_array());
+}
+
 INSTANTIATE_TEST_SUITE_P(
     ReadDictionary, TestArrowReadDictionary,
     ::testing::ValuesIn(TestArrowReadDictionary::null_probabilities()));
 
+TEST(TestArrowReadDictionary, NestedDictionaryFromSeveralRowGroups) {
+  auto values = ::arrow::ArrayFromJSON(::arrow::list(::arrow::utf8()),
+                                       R"([["a", "b"], null, ["c"], [], ["b", "a"]])");
+  auto table = MakeSimpleTable(values, /*nullable=*/true);
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(
+      WriteTableToBuffer(table, 2, default_arrow_writer_properties(), &buffer));
+
+  auto read_properties = default_arrow_reader_properties();
+  read_properties.set_read_dictionary(0, true);
+  auto ReadTable = [&](std::shared_ptr<Table>* out) {
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    RETURN_NOT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    RETURN_NOT_OK(builder.properties(read_properties)->Build(&reader));
+    return reader->ReadTable(out);
+  };
+
+  // The chunks of the row groups have different dictionaries
+  std::shared_ptr<Table> actual;
+  ASSERT_RAISES(NotImplemented, ReadTable(&actual));
+
+  read_properties.set_unify_dictionaries(true);
+  ASSERT_OK_NO_THROW(ReadTable(&actual));
+  auto dict_type = ::arrow::dictionary(::arrow::int32(), ::arrow::utf8());
+  ASSERT_TRUE(actual->column(0)->type()->Equals(::arrow::list(dict_type)));
+  ASSERT_OK_AND_ASSIGN(Datum dense, ::arrow::compute::Cast(actual->column(0),
+                                                           table->column(0)->type()));
+  ::arrow::AssertChunkedEqual(*table->column(0), *dense.chunked_array());
+}
+
 TEST(TestArrowWriteDictionaries, ChangingDictionaries) {
   constexpr int num_unique = 50;
   constexpr int repeat = 10000;
@@ -3489,6 +3732,57 @@ TEST(TestArrowWriteDictionaries, ChangingDictionaries) {
   ::arrow::AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
 }
 
+TEST(TestArrowWriteDictionaries, MergedDictionaries) {
+  // Each chunk has a dictionary of its own, overlapping the previous ones
+  constexpr int num_chunks = 10;
+  constexpr int64_t chunk_size = 1000;
+  ::arrow::random::RandomArrayGenerator rag(0);
+  std::vector<std::shared_ptr<Array>> chunks, dense_chunks;
+  for (int i = 0; i < num_chunks; ++i) {
+    ::arrow::Int32Builder dict_builder, dense_builder;
+    for (int32_t value = 0; value < 10; ++value) {
+      ASSERT_OK(dict_builder.Append(i + value));
+    }
+    ASSERT_OK_AND_ASSIGN(auto dict, dict_builder.Finish());
+    auto indices = rag.Int8(chunk_size, 0, 9, /*null_probability=*/0.1);
+    ASSERT_OK_AND_ASSIGN(auto chunk, ::arrow::DictionaryArray::FromArrays(
+                                         ::arrow::dictionary(::arrow::int8(),
+                                                             ::arrow::int32()),
+                                         indices, dict));
+    const auto& typed_indices =
+        ::arrow::internal::checked_cast<const ::arrow::Int8Array&>(*indices);
+    for (int64_t j = 0; j < chunk_size; ++j) {
+      if (typed_indices.IsNull(j)) {
+        ASSERT_OK(dense_builder.AppendNull());
+      } else {
+        ASSERT_OK(dense_builder.Append(i + typed_indices.Value(j)));
+      }
+    }
+    chunks.push_back(std::move(chunk));
+    ASSERT_OK_AND_ASSIGN(auto dense_chunk, dense_builder.Finish());
+    dense_chunks.push_back(std::move(dense_chunk));
+  }
+  auto dict_table = MakeSimpleTable(std::make_shared<ChunkedArray>(chunks),
+                                    /*nullable=*/true);
+  auto expected = MakeSimpleTable(std::make_shared<ChunkedArray>(dense_chunks),
+                                  /*nullable=*/true);
+
+  std::shared_ptr<Table> actual;
+  DoRoundtrip(dict_table, /*row_group_size=*/num_chunks * chunk_size, &actual);
+  ::arrow::AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+  // The dictionaries are merged, rather than falling back to plain encoding
+  std::shared_ptr<Buffer> buffer;
+  WriteTableToBuffer(dict_table, num_chunks * chunk_size,
+                     default_arrow_writer_properties(), &buffer);
+  auto reader = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer));
+  auto column_chunk = reader->metadata()->RowGroup(0)->ColumnChunk(0);
+  ASSERT_TRUE(column_chunk->has_dictionary_page());
+  for (auto encoding : column_chunk->encodings()) {
+    ASSERT_NE(encoding, Encoding::PLAIN);
+  }
+}
+
 TEST(TestArrowWriteDictionaries, AutoReadAsDictionary) {
   constexpr int num_unique = 50;
   constexpr int repeat = 100;
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
 #include "arrow/extension_type.h"
 #include "arrow/io/memory.h"
@@ -35,11 +36,13 @@
 #include "arrow/util/make_unique.h"
 #include "arrow/util/parallel.h"
 #include "arrow/util/range.h"
+#include "arrow/util/tracing.h"
 #include "parquet/arrow/reader_internal.h"
 #include "parquet/column_reader.h"
 #include "parquet/exception.h"
 #include "parquet/file_reader.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
 
@@ -73,6 +76,14 @@ namespace parquet {
 namespace arrow {
 namespace {
 
+bool HaveSameDictionary(const ChunkedArray& chunked) {
+  const auto& dictionary = chunked.chunk(0)->data()->dictionary;
+  for (const auto& chunk : chunked.chunks()) {
+    if (chunk->data()->dictionary != dictionary) return false;
+  }
+  return true;
+}
+
 ::arrow::Result<std::shared_ptr<ArrayData>> ChunksToSingle(const ChunkedArray& chunked) {
   switch (chunked.num_chunks()) {
     case 0: {
@@ -83,6 +94,13 @@ namespace {
     case 1:
       return chunked.chunk(0)->data();
     default:
+      if (chunked.type()->id() == ::arrow::Type::DICTIONARY &&
+          HaveSameDictionary(chunked)) {
+        // Chunks of unified dictionaries only need their indices concatenated
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> array,
+                              ::arrow::Concatenate(chunked.chunks()));
+        return array->data();
+      }
       // ARROW-3762(wesm): If item reader yields a chunked array, we reject as
       // this is not yet implemented
       return Status::NotImplemented(
@@ -124,6 +142,81 @@ std::shared_ptr<std::unordered_set<int>> VectorToSharedSet(
   return result;
 }
 
+// Yields the single column chunk of a row group, skipping the data pages not marked
+// in `selected_pages`, which are indexed by page ordinal
+class SelectedPagesColumnIterator : public FileColumnIterator {
+ public:
+  SelectedPagesColumnIterator(int column_index, ParquetFileReader* reader,
+                              int row_group, std::vector<bool> selected_pages)
+      : FileColumnIterator(column_index, reader, {row_group}),
+        selected_pages_(std::move(selected_pages)) {}
+
+  std::unique_ptr<::parquet::PageReader> NextChunk() override {
+    auto page_reader = FileColumnIterator::NextChunk();
+    if (page_reader != nullptr && !selected_pages_.empty()) {
+      auto selected_pages = selected_pages_;
+      page_reader->set_data_page_filter([selected_pages](const DataPageStats& stats) {
+        return stats.page_ordinal < static_cast<int32_t>(selected_pages.size()) &&
+               !selected_pages[stats.page_ordinal];
+      });
+    }
+    return page_reader;
+  }
+
+ private:
+  std::vector<bool> selected_pages_;
+};
+
+// Find the data pages of a column chunk which hold any of the given (sorted,
+// row group-relative) rows, and move each range back by the number of rows of the
+// unselected pages before it, so that it indexes the values of the selected pages.
+// Returns an empty vector, leaving the ranges alone, if the OffsetIndex doesn't
+// describe pages covering [0, num_rows) in order.
+std::vector<bool> SelectPages(const OffsetIndex& offset_index, int64_t num_rows,
+                              std::vector<RowRange>* ranges) {
+  const auto& locations = offset_index.page_locations();
+  const size_t num_pages = locations.size();
+  if (num_pages == 0 || locations[0].first_row_index != 0) {
+    return {};
+  }
+  std::vector<int64_t> page_ends(num_pages);
+  for (size_t page = 0; page < num_pages; ++page) {
+    page_ends[page] =
+        page + 1 < num_pages ? locations[page + 1].first_row_index : num_rows;
+    if (page_ends[page] <= locations[page].first_row_index) {
+      return {};
+    }
+  }
+  if (page_ends.back() != num_rows) {
+    return {};
+  }
+
+  std::vector<bool> selected(num_pages, false);
+  auto range = ranges->begin();
+  for (size_t page = 0; page < num_pages; ++page) {
+    while (range != ranges->end() &&
+           range->offset + range->length <= locations[page].first_row_index) {
+      ++range;
+    }
+    selected[page] = range != ranges->end() && range->offset < page_ends[page];
+  }
+
+  // A range starts in a selected page, so every unselected page before it ends
+  // at or before its first row
+  size_t page = 0;
+  int64_t skipped_rows = 0;
+  for (auto& range : *ranges) {
+    while (page < num_pages && page_ends[page] <= range.offset) {
+      if (!selected[page]) {
+        skipped_rows += page_ends[page] - locations[page].first_row_index;
+      }
+      ++page;
+    }
+    range.offset -= skipped_rows;
+  }
+  return selected;
+}
+
 // Forward declaration
 Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>& context,
                  std::unique_ptr<ColumnReaderImpl>* out);
@@ -197,12 +290,21 @@ class FileReaderImpl : public FileReader {
                         const std::shared_ptr<std::unordered_set<int>>& included_leaves,
                         const std::vector<int>& row_groups,
                         std::unique_ptr<ColumnReaderImpl>* out) {
+    return GetFieldReader(i, included_leaves, SomeRowGroupsFactory(row_groups), out);
+  }
+
+  Status GetFieldReader(int i,
+                        const std::shared_ptr<std::unordered_set<int>>& included_leaves,
+                        FileColumnIteratorFactory iterator_factory,
+                        std::unique_ptr<ColumnReaderImpl>* out) {
     auto ctx = std::make_shared<ReaderContext>();
     ctx->reader = reader_.get();
     ctx->pool = pool_;
-    ctx->iterator_factory = SomeRowGroupsFactory(row_groups);
+    ctx->iterator_factory = std::move(iterator_factory);
     ctx->filter_leaves = true;
     ctx->included_leaves = included_leaves;
+    ctx->unify_dictionaries = reader_properties_.unify_dictionaries();
+    ctx->zero_copy_pages = reader_properties_.zero_copy_pages();
     return GetReader(manifest_.schema_fields[i], ctx, out);
   }
 
@@ -256,6 +358,7 @@ class FileReaderImpl : public FileReader {
 
   Status ReadColumn(int i, const std::vector<int>& row_groups, ColumnReader* reader,
                     std::shared_ptr<ChunkedArray>* out) {
+    ARROW_TRACE_SPAN("parquet", "ReadColumn");
     BEGIN_PARQUET_CATCH_EXCEPTIONS
     // TODO(wesm): This calculation doesn't make much sense when we have repeated
     // schema nodes
@@ -293,6 +396,21 @@ class FileReaderImpl : public FileReader {
     return ReadRowGroups(row_groups, Iota(reader_->metadata()->num_columns()), table);
   }
 
+  Status ReadRowRanges(const std::vector<RowRange>& ranges,
+                       const std::vector<int>& column_indices,
+                       std::shared_ptr<Table>* out) override;
+
+  Status ReadRowRanges(const std::vector<RowRange>& ranges,
+                       std::shared_ptr<Table>* out) override {
+    return ReadRowRanges(ranges, Iota(reader_->metadata()->num_columns()), out);
+  }
+
+  // Read the given row group-relative rows of a top-level field from one row group
+  Status ReadFieldRowRanges(
+      int field_index, int row_group, std::vector<RowRange> ranges,
+      const std::shared_ptr<std::unordered_set<int>>& included_leaves,
+      ::arrow::ArrayVector* out);
+
   Status ReadRowGroup(int row_group_index, const std::vector<int>& column_indices,
                       std::shared_ptr<Table>* out) override {
     return ReadRowGroups({row_group_index}, column_indices, out);
@@ -414,6 +532,11 @@ class LeafReader : public ColumnReaderImpl {
         descr_(input_->descr()) {
     record_reader_ = RecordReader::Make(
         descr_, leaf_info, ctx_->pool, field_->type()->id() == ::arrow::Type::DICTIONARY);
+    // Only top-level columns may have several chunks per batch, the readers of nested
+    // data requiring a single one
+    const bool top_level = descr_->schema_node()->parent()->parent() == nullptr;
+    record_reader_->set_zero_copy_pages(ctx_->zero_copy_pages && top_level &&
+                                        TransfersValuesZeroCopy(*field_->type()));
     NextRowGroup();
   }
 
@@ -449,6 +572,9 @@ class LeafReader : public ColumnReaderImpl {
     }
     RETURN_NOT_OK(TransferColumnData(record_reader_.get(), field_->type(), descr_,
                                      ctx_->pool, &out_));
+    if (ctx_->unify_dictionaries && out_->type()->id() == ::arrow::Type::DICTIONARY) {
+      ARROW_ASSIGN_OR_RAISE(out_, UnifyDictionaries(*out_, ctx_->pool));
+    }
     return Status::OK();
     END_PARQUET_CATCH_EXCEPTIONS
   }
@@ -884,7 +1010,8 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_groups,
     // PARQUET-1698/PARQUET-1820: pre-buffer row groups/column chunks if enabled
     BEGIN_PARQUET_CATCH_EXCEPTIONS
     reader_->PreBuffer(row_groups, column_indices, reader_properties_.async_context(),
-                       reader_properties_.cache_options());
+                       reader_properties_.cache_options(),
+                       reader_properties_.pre_buffer_max_bytes());
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
@@ -968,6 +1095,8 @@ Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_facto
   ctx->pool = pool_;
   ctx->iterator_factory = iterator_factory;
   ctx->filter_leaves = false;
+  ctx->unify_dictionaries = reader_properties_.unify_dictionaries();
+  ctx->zero_copy_pages = reader_properties_.zero_copy_pages();
   std::unique_ptr<ColumnReaderImpl> result;
   RETURN_NOT_OK(GetReader(manifest_.schema_fields[i], ctx, &result));
   out->reset(result.release());
@@ -1011,6 +1140,122 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
   return (*out)->Validate();
 }
 
+Status FileReaderImpl::ReadFieldRowRanges(
+    int field_index, int row_group, std::vector<RowRange> ranges,
+    const std::shared_ptr<std::unordered_set<int>>& included_leaves,
+    ::arrow::ArrayVector* out) {
+  const SchemaField& field = manifest_.schema_fields[field_index];
+  const int64_t num_rows = reader_->metadata()->RowGroup(row_group)->num_rows();
+
+  // Only the pages of flat columns can be skipped independently of other leaves
+  std::vector<bool> selected_pages;
+  if (field.is_leaf()) {
+    std::unique_ptr<OffsetIndex> offset_index;
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    offset_index = reader_->RowGroup(row_group)->GetOffsetIndex(field.column_index);
+    END_PARQUET_CATCH_EXCEPTIONS
+    if (offset_index != nullptr) {
+      selected_pages = SelectPages(*offset_index, num_rows, &ranges);
+    }
+  }
+
+  auto factory = [row_group, selected_pages](int i, ParquetFileReader* reader) {
+    return new SelectedPagesColumnIterator(i, reader, row_group, selected_pages);
+  };
+  std::unique_ptr<ColumnReaderImpl> reader;
+  RETURN_NOT_OK(GetFieldReader(field_index, included_leaves, factory, &reader));
+
+  std::shared_ptr<ChunkedArray> values;
+  RETURN_NOT_OK(reader->NextBatch(num_rows, &values));
+  for (const auto& range : ranges) {
+    if (range.offset + range.length > values->length()) {
+      return Status::Invalid("Column '", field.field->name(), "' of row group ",
+                             row_group, " has fewer rows than its metadata");
+    }
+    const auto slice = values->Slice(range.offset, range.length);
+    out->insert(out->end(), slice->chunks().begin(), slice->chunks().end());
+  }
+  return Status::OK();
+}
+
+Status FileReaderImpl::ReadRowRanges(const std::vector<RowRange>& ranges,
+                                     const std::vector<int>& column_indices,
+                                     std::shared_ptr<Table>* out) {
+  RETURN_NOT_OK(BoundsCheck({}, column_indices));
+  const auto& metadata = reader_->metadata();
+
+  int64_t num_rows = 0;
+  int64_t previous_end = 0;
+  for (const auto& range : ranges) {
+    if (range.offset < previous_end || range.length < 0 ||
+        range.offset + range.length > metadata->num_rows()) {
+      return Status::Invalid("Row ranges must be sorted, must not overlap and must be ",
+                             "within the file's ", metadata->num_rows(), " rows");
+    }
+    previous_end = range.offset + range.length;
+    num_rows += range.length;
+  }
+
+  // Split the ranges among the row groups
+  std::vector<int> row_groups;
+  std::vector<std::vector<RowRange>> row_group_ranges;
+  auto range = ranges.begin();
+  int64_t row_group_begin = 0;
+  for (int i = 0; i < metadata->num_row_groups() && range != ranges.end(); ++i) {
+    const int64_t row_group_end = row_group_begin + metadata->RowGroup(i)->num_rows();
+    std::vector<RowRange> local_ranges;
+    for (auto it = range; it != ranges.end() && it->offset < row_group_end; ++it) {
+      const int64_t begin = std::max(it->offset, row_group_begin);
+      const int64_t end = std::min(it->offset + it->length, row_group_end);
+      if (begin < end) {
+        local_ranges.push_back({begin - row_group_begin, end - begin});
+      }
+    }
+    while (range != ranges.end() && range->offset + range->length <= row_group_end) {
+      ++range;
+    }
+    if (!local_ranges.empty()) {
+      row_groups.push_back(i);
+      row_group_ranges.push_back(std::move(local_ranges));
+    }
+    row_group_begin = row_group_end;
+  }
+
+  if (reader_properties_.pre_buffer() && !row_groups.empty()) {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    parquet_reader()->PreBuffer(row_groups, column_indices,
+                                reader_properties_.async_context(),
+                                reader_properties_.cache_options());
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  // Only used for the schema
+  std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
+  std::shared_ptr<::arrow::Schema> result_schema;
+  RETURN_NOT_OK(GetFieldReaders(column_indices, {}, &readers, &result_schema));
+  ARROW_ASSIGN_OR_RAISE(std::vector<int> field_indices,
+                        manifest_.GetFieldIndices(column_indices));
+  auto included_leaves = VectorToSharedSet(column_indices);
+
+  ::arrow::ChunkedArrayVector columns(field_indices.size());
+  RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+      reader_properties_.use_threads(), static_cast<int>(field_indices.size()),
+      [&](int i) {
+        ::arrow::ArrayVector chunks;
+        for (size_t j = 0; j < row_groups.size(); ++j) {
+          RETURN_NOT_OK(ReadFieldRowRanges(field_indices[i], row_groups[j],
+                                           row_group_ranges[j], included_leaves,
+                                           &chunks));
+        }
+        columns[i] = std::make_shared<ChunkedArray>(std::move(chunks),
+                                                    result_schema->field(i)->type());
+        return Status::OK();
+      }));
+
+  *out = Table::Make(std::move(result_schema), std::move(columns), num_rows);
+  return (*out)->Validate();
+}
+
 std::shared_ptr<RowGroupReader> FileReaderImpl::RowGroup(int row_group_index) {
   return std::make_shared<RowGroupReaderImpl>(this, row_group_index);
 }
@@ -49,6 +49,14 @@ class ColumnReader;
 struct SchemaManifest;
 class RowGroupReader;
 
+/// \brief A range of rows of a file, numbered consecutively across its row groups
+struct PARQUET_EXPORT RowRange {
+  /// The index of the first row of the range
+  int64_t offset;
+  /// The number of rows of the range
+  int64_t length;
+};
+
 /// \brief Arrow read adapter class for deserializing Parquet files as Arrow row batches.
 ///
 /// This interfaces caters for different use cases and thus provides different
@@ -200,6 +208,26 @@ class PARQUET_EXPORT FileReader {
   virtual ::arrow::Status ReadRowGroups(const std::vector<int>& row_groups,
                                         std::shared_ptr<::arrow::Table>* out) = 0;
 
+  /// \brief Read the given rows of the given columns into a Table
+  ///
+  /// The ranges must be sorted and must not overlap. Row groups without a
+  /// selected row are not read. In the others, the data pages of a flat column
+  /// which hold none of the selected rows are skipped without being
+  /// decompressed or decoded, if the column chunk has an OffsetIndex (see
+  /// WriterProperties::Builder::enable_write_page_index). Other columns are
+  /// decoded a whole column chunk at a time.
+  ///
+  /// \param[in] ranges the rows to read
+  /// \param[in] column_indices the leaf columns to read, relative to the schema
+  /// \param[out] out a table whose chunks are slices of the decoded pages
+  virtual ::arrow::Status ReadRowRanges(const std::vector<RowRange>& ranges,
+                                        const std::vector<int>& column_indices,
+                                        std::shared_ptr<::arrow::Table>* out) = 0;
+
+  /// \brief Read the given rows of all columns into a Table
+  virtual ::arrow::Status ReadRowRanges(const std::vector<RowRange>& ranges,
+                                        std::shared_ptr<::arrow::Table>* out) = 0;
+
   /// \brief Scan file contents with one thread, return number of rows
   virtual ::arrow::Status ScanContents(std::vector<int> columns,
                                        const int32_t column_batch_size,
@@ -258,13 +258,29 @@ Status TransferInt(RecordReader* reader, MemoryPool* pool,
   return Status::OK();
 }
 
-std::shared_ptr<Array> TransferZeroCopy(RecordReader* reader,
-                                        const std::shared_ptr<DataType>& type) {
-  std::vector<std::shared_ptr<Buffer>> buffers = {reader->ReleaseIsValid(),
-                                                  reader->ReleaseValues()};
-  auto data = std::make_shared<::arrow::ArrayData>(type, reader->values_written(),
-                                                   buffers, reader->null_count());
-  return ::arrow::MakeArray(data);
+std::shared_ptr<ChunkedArray> TransferZeroCopy(RecordReader* reader,
+                                               const std::shared_ptr<DataType>& type) {
+  std::shared_ptr<Buffer> is_valid = reader->ReleaseIsValid();
+  std::vector<std::shared_ptr<Buffer>> values = reader->ReleaseValueChunks();
+  if (values.size() == 1) {
+    std::vector<std::shared_ptr<Buffer>> buffers = {std::move(is_valid),
+                                                    std::move(values[0])};
+    auto data = std::make_shared<::arrow::ArrayData>(type, reader->values_written(),
+                                                     buffers, reader->null_count());
+    return std::make_shared<ChunkedArray>(::arrow::MakeArray(data));
+  }
+
+  // The values were sliced from the data pages of a required column
+  DCHECK_EQ(reader->null_count(), 0);
+  const int64_t byte_width =
+      checked_cast<const ::arrow::FixedWidthType&>(*type).bit_width() / 8;
+  ::arrow::ArrayVector chunks;
+  for (auto& buffer : values) {
+    const int64_t length = buffer->size() / byte_width;
+    chunks.push_back(::arrow::MakeArray(
+        ::arrow::ArrayData::Make(type, length, {nullptr, std::move(buffer)}, 0)));
+  }
+  return std::make_shared<ChunkedArray>(std::move(chunks), type);
 }
 
 Status TransferBool(RecordReader* reader, MemoryPool* pool, Datum* out) {
@@ -673,6 +689,21 @@ Status TransferDecimal(RecordReader* reader, MemoryPool* pool,
     RETURN_NOT_OK(s);                                                                \
   } break;
 
+bool TransfersValuesZeroCopy(const DataType& value_type) {
+  switch (value_type.id()) {
+    case ::arrow::Type::INT32:
+    case ::arrow::Type::INT64:
+    case ::arrow::Type::FLOAT:
+    case ::arrow::Type::DOUBLE:
+    // Timestamps read from INT96 columns are converted, but the values of INT96
+    // columns are never sliced
+    case ::arrow::Type::TIMESTAMP:
+      return true;
+    default:
+      return false;
+  }
+}
+
 Status TransferColumnData(RecordReader* reader, std::shared_ptr<DataType> value_type,
                           const ColumnDescriptor* descr, MemoryPool* pool,
                           std::shared_ptr<ChunkedArray>* out) {
@@ -772,5 +803,34 @@ Status TransferColumnData(RecordReader* reader, std::shared_ptr<DataType> value_
   return Status::OK();
 }
 
+::arrow::Result<std::shared_ptr<ChunkedArray>> UnifyDictionaries(
+    const ChunkedArray& chunked, MemoryPool* pool) {
+  if (chunked.num_chunks() <= 1) {
+    return std::make_shared<ChunkedArray>(chunked.chunks(), chunked.type());
+  }
+  const auto& dict_type = checked_cast<const ::arrow::DictionaryType&>(*chunked.type());
+  ARROW_ASSIGN_OR_RAISE(auto unifier,
+                        ::arrow::DictionaryUnifier::Make(dict_type.value_type(), pool));
+  std::vector<std::shared_ptr<Buffer>> transpose_maps(chunked.num_chunks());
+  for (int i = 0; i < chunked.num_chunks(); ++i) {
+    const auto& chunk = checked_cast<const ::arrow::DictionaryArray&>(*chunked.chunk(i));
+    RETURN_NOT_OK(unifier->Unify(*chunk.dictionary(), &transpose_maps[i]));
+  }
+  std::shared_ptr<DataType> unified_type;
+  std::shared_ptr<Array> unified_dictionary;
+  RETURN_NOT_OK(unifier->GetResult(&unified_type, &unified_dictionary));
+
+  // Keep the index type of the column rather than the smallest one which fits
+  ::arrow::ArrayVector chunks(chunked.num_chunks());
+  for (int i = 0; i < chunked.num_chunks(); ++i) {
+    const auto& chunk = checked_cast<const ::arrow::DictionaryArray&>(*chunked.chunk(i));
+    const auto* transpose_map =
+        reinterpret_cast<const int32_t*>(transpose_maps[i]->data());
+    ARROW_ASSIGN_OR_RAISE(chunks[i], chunk.Transpose(chunked.type(), unified_dictionary,
+                                                     transpose_map, pool));
+  }
+  return std::make_shared<ChunkedArray>(std::move(chunks), chunked.type());
+}
+
 }  // namespace arrow
 }  // namespace parquet
@@ -71,7 +71,7 @@ class FileColumnIterator {
 
   virtual ~FileColumnIterator() {}
 
-  std::unique_ptr<::parquet::PageReader> NextChunk() {
+  virtual std::unique_ptr<::parquet::PageReader> NextChunk() {
     if (row_groups_.empty()) {
       return nullptr;
     }
@@ -104,12 +104,23 @@ Status TransferColumnData(::parquet::internal::RecordReader* reader,
                           const ColumnDescriptor* descr, ::arrow::MemoryPool* pool,
                           std::shared_ptr<::arrow::ChunkedArray>* out);
 
+/// \brief Whether TransferColumnData takes the values of a column read as the given
+/// type from its record reader as they are, so that they may slice its data pages
+bool TransfersValuesZeroCopy(const ::arrow::DataType& value_type);
+
+/// \brief Give the chunks of a dictionary-encoded column the same dictionary, by
+/// unifying their dictionaries and transposing their indices
+::arrow::Result<std::shared_ptr<::arrow::ChunkedArray>> UnifyDictionaries(
+    const ::arrow::ChunkedArray& chunked, ::arrow::MemoryPool* pool);
+
 struct ReaderContext {
   ParquetFileReader* reader;
   ::arrow::MemoryPool* pool;
   FileColumnIteratorFactory iterator_factory;
   bool filter_leaves;
   std::shared_ptr<std::unordered_set<int>> included_leaves;
+  bool unify_dictionaries;
+  bool zero_copy_pages;
 
   bool IncludesLeaf(int leaf_index) const {
     if (this->filter_leaves) {
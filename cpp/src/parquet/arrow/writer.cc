@@ -34,6 +34,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 
 #include "parquet/arrow/path_internal.h"
@@ -61,6 +62,7 @@ using arrow::ListArray;
 using arrow::MemoryPool;
 using arrow::NumericArray;
 using arrow::PrimitiveArray;
+using arrow::RecordBatch;
 using arrow::ResizableBuffer;
 using arrow::Status;
 using arrow::Table;
@@ -114,21 +116,34 @@ class ArrowColumnWriterV2 {
   // A ChunkedArray).
   // level_builders should contain one MultipathLevelBuilder per chunk of the
   // Arrow-column to write.
+  // A non-negative |buffered_column_index| is the index of the first leaf column
+  // in a buffered RowGroupWriter, otherwise leaf columns are obtained with
+  // RowGroupWriter::NextColumn.
   ArrowColumnWriterV2(std::vector<std::unique_ptr<MultipathLevelBuilder>> level_builders,
-                      int leaf_count, RowGroupWriter* row_group_writer)
+                      int leaf_count, RowGroupWriter* row_group_writer,
+                      int buffered_column_index)
       : level_builders_(std::move(level_builders)),
         leaf_count_(leaf_count),
-        row_group_writer_(row_group_writer) {}
+        row_group_writer_(row_group_writer),
+        buffered_column_index_(buffered_column_index) {}
 
   // Writes out all leaf parquet columns to the RowGroupWriter that this
   // object was constructed with.  Each leaf column is written fully before
-  // the next column is written (i.e. no buffering is assumed).
+  // the next column is written.  Columns of a buffered RowGroupWriter are
+  // left open, to be closed (and written to the sink in order) along with the
+  // row group, which allows writing different columns concurrently.
   //
   // Columns are written in DFS order.
   Status Write(ArrowWriteContext* ctx) {
+    const bool buffered = buffered_column_index_ >= 0;
     for (int leaf_idx = 0; leaf_idx < leaf_count_; leaf_idx++) {
       ColumnWriter* column_writer;
-      PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->NextColumn());
+      if (buffered) {
+        PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->column(
+                                 buffered_column_index_ + leaf_idx));
+      } else {
+        PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->NextColumn());
+      }
       for (auto& level_builder : level_builders_) {
         RETURN_NOT_OK(level_builder->Write(
             leaf_idx, ctx, [&](const MultipathLevelBuilderResult& result) {
@@ -148,7 +163,9 @@ class ArrowColumnWriterV2 {
             }));
       }
 
-      PARQUET_CATCH_NOT_OK(column_writer->Close());
+      if (!buffered) {
+        PARQUET_CATCH_NOT_OK(column_writer->Close());
+      }
     }
     return Status::OK();
   }
@@ -161,16 +178,21 @@ class ArrowColumnWriterV2 {
   // chunks are created which need to be tracked across each leaf column-write.
   // This decision could potentially be revisited if we wanted to use "buffered"
   // RowGroupWriters (we could construct each builder on demand in that case).
+  //
+  // |buffered_column_index| is the index of the first leaf column of |data| when
+  // |row_group_writer| is buffered, and -1 otherwise.
   static ::arrow::Result<std::unique_ptr<ArrowColumnWriterV2>> Make(
       const ChunkedArray& data, int64_t offset, const int64_t size,
-      const SchemaManifest& schema_manifest, RowGroupWriter* row_group_writer) {
+      const SchemaManifest& schema_manifest, RowGroupWriter* row_group_writer,
+      int buffered_column_index = -1) {
     int64_t absolute_position = 0;
     int chunk_index = 0;
     int64_t chunk_offset = 0;
     if (data.length() == 0) {
       return ::arrow::internal::make_unique<ArrowColumnWriterV2>(
           std::vector<std::unique_ptr<MultipathLevelBuilder>>{},
-          CalculateLeafCount(data.type().get()), row_group_writer);
+          CalculateLeafCount(data.type().get()), row_group_writer,
+          buffered_column_index);
     }
     while (chunk_index < data.num_chunks() && absolute_position < offset) {
       const int64_t chunk_length = data.chunk(chunk_index)->length();
@@ -195,7 +217,9 @@ class ArrowColumnWriterV2 {
     bool is_nullable = false;
     // The row_group_writer hasn't been advanced yet so add 1 to the current
     // which is the one this instance will start writing for.
-    int column_index = row_group_writer->current_column() + 1;
+    int column_index = buffered_column_index >= 0
+                           ? buffered_column_index
+                           : row_group_writer->current_column() + 1;
     for (int leaf_offset = 0; leaf_offset < leaf_count; ++leaf_offset) {
       const SchemaField* schema_field = nullptr;
       RETURN_NOT_OK(
@@ -242,7 +266,7 @@ class ArrowColumnWriterV2 {
       values_written += chunk_write_size;
     }
     return ::arrow::internal::make_unique<ArrowColumnWriterV2>(
-        std::move(builders), leaf_count, row_group_writer);
+        std::move(builders), leaf_count, row_group_writer, buffered_column_index);
   }
 
  private:
@@ -250,6 +274,7 @@ class ArrowColumnWriterV2 {
   std::vector<std::unique_ptr<MultipathLevelBuilder>> level_builders_;
   int leaf_count_;
   RowGroupWriter* row_group_writer_;
+  int buffered_column_index_;
 };
 
 }  // namespace
@@ -279,6 +304,16 @@ class FileWriterImpl : public FileWriter {
       PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
     }
     PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendRowGroup());
+    batch_row_group_open_ = false;
+    return Status::OK();
+  }
+
+  Status NewBufferedRowGroup() override {
+    if (row_group_writer_ != nullptr) {
+      PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+    }
+    PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+    batch_row_group_open_ = true;
     return Status::OK();
   }
 
@@ -334,6 +369,9 @@ class FileWriterImpl : public FileWriter {
     }
 
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
+      if (arrow_properties_->use_threads()) {
+        return WriteRowGroupInParallel(table, offset, size);
+      }
       RETURN_NOT_OK(NewRowGroup(size));
       for (int i = 0; i < table.num_columns(); i++) {
         RETURN_NOT_OK(WriteColumnChunk(table.column(i), offset, size));
@@ -356,8 +394,104 @@ class FileWriterImpl : public FileWriter {
     return Status::OK();
   }
 
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    if (!batch.schema()->Equals(*schema_, false)) {
+      return Status::Invalid("record batch schema does not match this writer's. batch:'",
+                             batch.schema()->ToString(), "' this:'", schema_->ToString(),
+                             "'");
+    }
+    if (batch.num_rows() == 0) {
+      return Status::OK();
+    }
+
+    std::vector<std::shared_ptr<ChunkedArray>> columns;
+    for (const auto& column : batch.columns()) {
+      columns.push_back(std::make_shared<ChunkedArray>(column));
+    }
+    const int64_t max_row_group_length = properties().max_row_group_length();
+    int64_t offset = 0;
+    while (offset < batch.num_rows()) {
+      if (!batch_row_group_open_) {
+        RETURN_NOT_OK(NewBufferedRowGroup());
+      }
+      int64_t num_rows;
+      PARQUET_CATCH_NOT_OK(num_rows = row_group_writer_->num_rows());
+      const int64_t size =
+          std::min(max_row_group_length - num_rows, batch.num_rows() - offset);
+      RETURN_NOT_OK(
+          WriteBufferedColumns(columns, offset, size, arrow_properties_->use_threads()));
+      offset += size;
+
+      int64_t num_bytes;
+      PARQUET_CATCH_NOT_OK(num_bytes = BufferedRowGroupBytes());
+      if (num_rows + size >= max_row_group_length ||
+          num_bytes >= arrow_properties_->max_row_group_bytes()) {
+        PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+        batch_row_group_open_ = false;
+      }
+    }
+    return Status::OK();
+  }
+
+  // The size of the pages buffered by the open buffered row group, and of the values
+  // which are not written to a page yet
+  int64_t BufferedRowGroupBytes() {
+    int64_t num_bytes = row_group_writer_->total_bytes_written() +
+                        row_group_writer_->total_compressed_bytes();
+    for (int i = 0; i < row_group_writer_->num_columns(); i++) {
+      num_bytes += row_group_writer_->column(i)->EstimatedBufferedValueBytes();
+    }
+    return num_bytes;
+  }
+
   const WriterProperties& properties() const { return *writer_->properties(); }
 
+  // Encode and compress the columns of a row group concurrently, each into its own
+  // buffer, then write them to the sink in order when the row group is closed.
+  Status WriteRowGroupInParallel(const Table& table, int64_t offset, int64_t size) {
+    if (row_group_writer_ != nullptr) {
+      PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+    }
+    PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+    batch_row_group_open_ = false;
+    return WriteBufferedColumns(table.columns(), offset, size, /*use_threads=*/true);
+  }
+
+  // Write a slice of |columns| to the buffered row group being written, one column
+  // per thread if |use_threads|.
+  Status WriteBufferedColumns(const std::vector<std::shared_ptr<ChunkedArray>>& columns,
+                              int64_t offset, int64_t size, bool use_threads) {
+    if (arrow_properties_->engine_version() != ArrowWriterProperties::V2 &&
+        arrow_properties_->engine_version() != ArrowWriterProperties::V1) {
+      return Status::NotImplemented("Unknown engine version.");
+    }
+    std::vector<std::unique_ptr<ArrowColumnWriterV2>> writers(columns.size());
+    int leaf_column_index = 0;
+    for (size_t i = 0; i < columns.size(); i++) {
+      ARROW_ASSIGN_OR_RAISE(
+          writers[i], ArrowColumnWriterV2::Make(*columns[i], offset, size,
+                                                schema_manifest_, row_group_writer_,
+                                                leaf_column_index));
+      leaf_column_index += CalculateLeafCount(columns[i]->type().get());
+    }
+
+    if (!use_threads) {
+      for (auto& writer : writers) {
+        RETURN_NOT_OK(writer->Write(&column_write_context_));
+      }
+      return Status::OK();
+    }
+    // The scratch buffers of a context can't be shared between threads
+    while (parallel_column_write_contexts_.size() < writers.size()) {
+      parallel_column_write_contexts_.emplace_back(
+          new ArrowWriteContext(memory_pool(), arrow_properties_.get()));
+    }
+    return ::arrow::internal::ParallelFor(
+        static_cast<int>(writers.size()), [&](int i) {
+          return writers[i]->Write(parallel_column_write_contexts_[i].get());
+        });
+  }
+
   ::arrow::MemoryPool* memory_pool() const override {
     return column_write_context_.memory_pool;
   }
@@ -375,7 +509,11 @@ class FileWriterImpl : public FileWriter {
 
   std::unique_ptr<ParquetFileWriter> writer_;
   RowGroupWriter* row_group_writer_;
+  // Whether row_group_writer_ is a buffered row group open to WriteRecordBatch
+  bool batch_row_group_open_ = false;
   ArrowWriteContext column_write_context_;
+  // One context per column for WriteRowGroupInParallel
+  std::vector<std::unique_ptr<ArrowWriteContext>> parallel_column_write_contexts_;
   std::shared_ptr<ArrowWriterProperties> arrow_properties_;
   bool closed_;
 };
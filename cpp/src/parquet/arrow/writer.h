@@ -27,6 +27,7 @@ namespace arrow {
 
 class Array;
 class ChunkedArray;
+class RecordBatch;
 class Schema;
 class Table;
 
@@ -43,6 +44,9 @@ namespace arrow {
 ///
 /// Start a new RowGroup or Chunk with NewRowGroup.
 /// Write column-by-column the whole column chunk.
+///
+/// Alternatively, write RecordBatches with WriteRecordBatch, which buffers them
+/// in row groups closed once they reach a given size.
 class PARQUET_EXPORT FileWriter {
  public:
   static ::arrow::Status Make(MemoryPool* pool, std::unique_ptr<ParquetFileWriter> writer,
@@ -76,6 +80,22 @@ class PARQUET_EXPORT FileWriter {
 
   virtual ::arrow::Status WriteColumnChunk(
       const std::shared_ptr<::arrow::ChunkedArray>& data) = 0;
+
+  /// \brief Start a new buffered row group, to be filled by WriteRecordBatch.
+  ///
+  /// Closes the current row group, if any.
+  virtual ::arrow::Status NewBufferedRowGroup() = 0;
+
+  /// \brief Append a RecordBatch to the buffered row group, starting one if needed.
+  ///
+  /// The batch is encoded and compressed right away (a column per thread if
+  /// ArrowWriterProperties::use_threads), so that only the encoded pages are kept
+  /// until the row group is written out. The row group is closed once it reaches
+  /// WriterProperties::max_row_group_length rows or
+  /// ArrowWriterProperties::max_row_group_bytes, the following batches then going to
+  /// a new one.
+  virtual ::arrow::Status WriteRecordBatch(const ::arrow::RecordBatch& batch) = 0;
+
   virtual ::arrow::Status Close() = 0;
   virtual ~FileWriter();
 
@@ -24,11 +24,13 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/buffer.h"
 #include "arrow/builder.h"
 #include "arrow/chunked_array.h"
 #include "arrow/type.h"
@@ -229,6 +231,11 @@ class SerializedPageReader : public PageReader {
 
   void set_max_page_header_size(uint32_t size) override { max_page_header_size_ = size; }
 
+  // Pages are read from the stream as they are unless decompressed or decrypted
+  bool stable_page_buffers() const override {
+    return decompressor_ == nullptr && crypto_ctx_.data_decryptor == nullptr;
+  }
+
  private:
   void UpdateDecryption(const std::shared_ptr<Decryptor>& decryptor, int8_t module_type,
                         const std::string& page_aad);
@@ -239,6 +246,10 @@ class SerializedPageReader : public PageReader {
                                              int compressed_len, int uncompressed_len,
                                              int levels_byte_len = 0);
 
+  // Skip the contents of the current page if it is a data page rejected by the data
+  // page filter
+  bool SkipFilteredDataPage();
+
   std::shared_ptr<ArrowInputStream> stream_;
 
   format::PageHeader current_page_header_;
@@ -310,6 +321,34 @@ void SerializedPageReader::UpdateDecryption(const std::shared_ptr<Decryptor>& de
   }
 }
 
+bool SerializedPageReader::SkipFilteredDataPage() {
+  EncodedStatistics page_statistics;
+  int32_t num_values;
+  const PageType::type page_type = LoadEnumSafe(&current_page_header_.type);
+  if (page_type == PageType::DATA_PAGE) {
+    page_statistics = ExtractStatsFromHeader(current_page_header_.data_page_header);
+    num_values = current_page_header_.data_page_header.num_values;
+  } else if (page_type == PageType::DATA_PAGE_V2) {
+    page_statistics = ExtractStatsFromHeader(current_page_header_.data_page_header_v2);
+    num_values = current_page_header_.data_page_header_v2.num_values;
+  } else {
+    return false;
+  }
+  if (num_values < 0) {
+    throw ParquetException("Invalid page header (negative number of values)");
+  }
+
+  DataPageStats data_page_stats(page_statistics.is_set() ? &page_statistics : nullptr,
+                                num_values, page_ordinal_);
+  if (!data_page_filter_(data_page_stats)) {
+    return false;
+  }
+  PARQUET_THROW_NOT_OK(stream_->Advance(current_page_header_.compressed_page_size));
+  seen_num_rows_ += num_values;
+  ++page_ordinal_;
+  return true;
+}
+
 std::shared_ptr<Page> SerializedPageReader::NextPage() {
   // Loop here because there may be unhandled page types that we skip until
   // finding a page that we do know what to do with
@@ -357,6 +396,10 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
       throw ParquetException("Invalid page header");
     }
 
+    if (data_page_filter_ && SkipFilteredDataPage()) {
+      continue;
+    }
+
     if (crypto_ctx_.data_decryptor != nullptr) {
       UpdateDecryption(crypto_ctx_.data_decryptor, encryption::kDictionaryPage,
                        data_page_aad_);
@@ -516,6 +559,7 @@ class ColumnReaderImplBase {
         max_rep_level_(descr->max_repetition_level()),
         num_buffered_values_(0),
         num_decoded_values_(0),
+        values_byte_offset_(0),
         pool_(pool),
         current_decoder_(nullptr),
         current_encoding_(Encoding::UNKNOWN) {}
@@ -744,14 +788,12 @@ class ColumnReaderImplBase {
       current_decoder_ = it->second.get();
     } else {
       switch (encoding) {
-        case Encoding::PLAIN: {
-          auto decoder = MakeTypedDecoder<DType>(Encoding::PLAIN, descr_);
-          current_decoder_ = decoder.get();
-          decoders_[static_cast<int>(encoding)] = std::move(decoder);
-          break;
-        }
-        case Encoding::BYTE_STREAM_SPLIT: {
-          auto decoder = MakeTypedDecoder<DType>(Encoding::BYTE_STREAM_SPLIT, descr_);
+        case Encoding::PLAIN:
+        case Encoding::BYTE_STREAM_SPLIT:
+        case Encoding::DELTA_BINARY_PACKED:
+        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+        case Encoding::DELTA_BYTE_ARRAY: {
+          auto decoder = MakeTypedDecoder<DType>(encoding, descr_);
           current_decoder_ = decoder.get();
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
@@ -759,16 +801,12 @@ class ColumnReaderImplBase {
         case Encoding::RLE_DICTIONARY:
           throw ParquetException("Dictionary page must be before data page.");
 
-        case Encoding::DELTA_BINARY_PACKED:
-        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
-        case Encoding::DELTA_BYTE_ARRAY:
-          ParquetException::NYI("Unsupported encoding");
-
         default:
           throw ParquetException("Unknown encoding type.");
       }
     }
     current_encoding_ = encoding;
+    values_byte_offset_ = levels_byte_size;
     current_decoder_->SetData(static_cast<int>(num_buffered_values_), buffer,
                               static_cast<int>(data_size));
   }
@@ -798,6 +836,9 @@ class ColumnReaderImplBase {
   // into memory
   int64_t num_decoded_values_;
 
+  // The offset of the encoded values in the current data page, after the levels
+  int64_t values_byte_offset_;
+
   ::arrow::MemoryPool* pool_;
 
   using DecoderType = TypedDecoder<DType>;
@@ -1062,6 +1103,15 @@ namespace internal {
 // better vectorized performance when doing many smaller record reads
 constexpr int64_t kMinLevelBatchSize = 1024;
 
+// The physical types whose PLAIN encoding has the layout of the Arrow values they are
+// read as, so that data pages may be read zero-copy
+template <typename DType>
+struct IsZeroCopyType
+    : std::integral_constant<bool, std::is_same<DType, Int32Type>::value ||
+                                       std::is_same<DType, Int64Type>::value ||
+                                       std::is_same<DType, FloatType>::value ||
+                                       std::is_same<DType, DoubleType>::value> {};
+
 template <typename DType>
 class TypedRecordReader : public ColumnReaderImplBase<DType>,
                           virtual public RecordReader {
@@ -1076,6 +1126,7 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     records_read_ = 0;
     values_written_ = 0;
     values_capacity_ = 0;
+    values_in_chunks_ = 0;
     null_count_ = 0;
     levels_written_ = 0;
     levels_position_ = 0;
@@ -1181,7 +1232,8 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   std::shared_ptr<ResizableBuffer> ReleaseValues() override {
     if (uses_values_) {
       auto result = values_;
-      PARQUET_THROW_NOT_OK(result->Resize(bytes_for_values(values_written_), true));
+      PARQUET_THROW_NOT_OK(
+          result->Resize(bytes_for_values(values_written_ - values_in_chunks_), true));
       values_ = AllocateBuffer(this->pool_);
       return result;
     } else {
@@ -1189,6 +1241,16 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     }
   }
 
+  std::vector<std::shared_ptr<Buffer>> ReleaseValueChunks() override {
+    FlushDecodedValues();
+    std::vector<std::shared_ptr<Buffer>> result;
+    std::swap(result, value_chunks_);
+    if (result.empty()) {
+      result.push_back(ReleaseValues());
+    }
+    return result;
+  }
+
   std::shared_ptr<ResizableBuffer> ReleaseIsValid() override {
     if (leaf_info_.HasNullableValues()) {
       auto result = valid_bits_;
@@ -1249,7 +1311,10 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
 
   void Reserve(int64_t capacity) override {
     ReserveLevels(capacity);
-    ReserveValues(capacity);
+    // Values sliced from the data pages need no space
+    if (!MaySliceValues()) {
+      ReserveValues(capacity);
+    }
   }
 
   int64_t UpdateCapacity(int64_t capacity, int64_t size, int64_t extra_size) {
@@ -1289,8 +1354,8 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   }
 
   void ReserveValues(int64_t extra_values) {
-    const int64_t new_values_capacity =
-        UpdateCapacity(values_capacity_, values_written_, extra_values);
+    const int64_t new_values_capacity = UpdateCapacity(
+        values_capacity_, values_written_ - values_in_chunks_, extra_values);
     if (new_values_capacity > values_capacity_) {
       // XXX(wesm): A hack to avoid memory allocation when reading directly
       // into builder classes
@@ -1370,12 +1435,62 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     DCHECK_EQ(num_decoded, values_to_read);
   }
 
+  // Whether the values of data pages may be sliced from the pages read by the pager
+  bool MaySliceValues() const {
+    return zero_copy_pages_ && IsZeroCopyType<DType>::value &&
+           this->max_def_level_ == 0 && this->pager_ != nullptr &&
+           this->pager_->stable_page_buffers();
+  }
+
+  // Whether the values of the current data page may be sliced from its buffer
+  bool CanSliceValues() const {
+    if (!MaySliceValues() || this->current_page_ == nullptr ||
+        this->current_encoding_ != Encoding::PLAIN) {
+      return false;
+    }
+    const uint8_t* values = this->current_page_->data() + this->values_byte_offset_;
+    return reinterpret_cast<uintptr_t>(values) % sizeof(T) == 0;
+  }
+
+  // Move the values decoded into values_ to the value chunks, so that the values
+  // sliced next follow them
+  void FlushDecodedValues() {
+    if (values_written_ > values_in_chunks_) {
+      value_chunks_.push_back(ReleaseValues());
+      values_capacity_ = 0;
+      values_in_chunks_ = values_written_;
+    }
+  }
+
+  // Slice the next values of the current data page from its buffer and skip them in
+  // the decoder
+  void SliceValues(int64_t values_to_read) {
+    FlushDecodedValues();
+    const Page& page = *this->current_page_;
+    const int64_t offset =
+        this->values_byte_offset_ + bytes_for_values(this->num_decoded_values_);
+    const int64_t length = bytes_for_values(values_to_read);
+    if (offset + length > page.size()) {
+      ParquetException::EofException();
+    }
+    value_chunks_.push_back(::arrow::SliceBuffer(page.buffer(), offset, length));
+    values_in_chunks_ += values_to_read;
+
+    const int64_t values_left = available_values_current_page() - values_to_read;
+    this->current_decoder_->SetData(static_cast<int>(values_left),
+                                    page.data() + offset + length,
+                                    static_cast<int>(page.size() - offset - length));
+  }
+
   // Return number of logical records read
   int64_t ReadRecordData(int64_t num_records) {
-    // Conservative upper bound
-    const int64_t possible_num_values =
-        std::max(num_records, levels_written_ - levels_position_);
-    ReserveValues(possible_num_values);
+    const bool slice_values = CanSliceValues();
+    if (!slice_values) {
+      // Conservative upper bound
+      const int64_t possible_num_values =
+          std::max(num_records, levels_written_ - levels_position_);
+      ReserveValues(possible_num_values);
+    }
 
     const int64_t start_levels_position = levels_position_;
 
@@ -1408,6 +1523,9 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
       null_count = validity_io.null_count;
       DCHECK_GE(values_to_read, 0);
       ReadValuesSpaced(validity_io.values_read, null_count);
+    } else if (slice_values) {
+      DCHECK_GE(values_to_read, 0);
+      SliceValues(values_to_read);
     } else {
       DCHECK_GE(values_to_read, 0);
       ReadValuesDense(values_to_read);
@@ -1462,15 +1580,24 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
       values_written_ = 0;
       values_capacity_ = 0;
       null_count_ = 0;
+      value_chunks_.clear();
+      values_in_chunks_ = 0;
     }
   }
 
  protected:
   template <typename T>
   T* ValuesHead() {
-    return reinterpret_cast<T*>(values_->mutable_data()) + values_written_;
+    return reinterpret_cast<T*>(values_->mutable_data()) + values_written_ -
+           values_in_chunks_;
   }
   LevelInfo leaf_info_;
+
+  // The values sliced from data pages or flushed from values_ before slicing, which
+  // precede the values of values_
+  std::vector<std::shared_ptr<Buffer>> value_chunks_;
+  // The number of values in value_chunks_
+  int64_t values_in_chunks_;
 };
 
 class FLBARecordReader : public TypedRecordReader<FLBAType>,
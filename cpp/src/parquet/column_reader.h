@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -46,6 +47,7 @@ class RleDecoder;
 namespace parquet {
 
 class Decryptor;
+class EncodedStatistics;
 class Page;
 
 // 16 MB is the default maximum page header size
@@ -96,10 +98,29 @@ struct CryptoContext {
   std::shared_ptr<Decryptor> data_decryptor;
 };
 
+// What the header of a data page tells about it, to decide whether to skip it
+struct PARQUET_EXPORT DataPageStats {
+  DataPageStats(const EncodedStatistics* encoded_statistics, int32_t num_values,
+                int32_t page_ordinal)
+      : encoded_statistics(encoded_statistics),
+        num_values(num_values),
+        page_ordinal(page_ordinal) {}
+
+  // The statistics of the page, or nullptr if its header has none
+  const EncodedStatistics* encoded_statistics;
+  // The number of values of the page, including nulls
+  int32_t num_values;
+  // The index of the page among the data pages of the column chunk, which is its index
+  // in the column chunk's OffsetIndex and ColumnIndex
+  int32_t page_ordinal;
+};
+
 // Abstract page iterator interface. This way, we can feed column pages to the
 // ColumnReader through whatever mechanism we choose
 class PARQUET_EXPORT PageReader {
  public:
+  using DataPageFilter = std::function<bool(const DataPageStats&)>;
+
   virtual ~PageReader() = default;
 
   static std::unique_ptr<PageReader> Open(
@@ -112,6 +133,21 @@ class PARQUET_EXPORT PageReader {
   virtual std::shared_ptr<Page> NextPage() = 0;
 
   virtual void set_max_page_header_size(uint32_t size) = 0;
+
+  // Skip the data pages for which `filter` returns true without reading their
+  // contents. The values of skipped pages are never returned, so a caller reading
+  // several columns must skip the same rows of each, as found in their OffsetIndexes.
+  void set_data_page_filter(DataPageFilter filter) {
+    data_page_filter_ = std::move(filter);
+  }
+
+  // Whether the buffers of the pages returned are left untouched by the reader once
+  // the next page is read, so that they may be retained by the caller. False if the
+  // pages are decompressed or decrypted into a buffer reused by the reader.
+  virtual bool stable_page_buffers() const { return false; }
+
+ protected:
+  DataPageFilter data_page_filter_;
 };
 
 class PARQUET_EXPORT ColumnReader {
@@ -231,6 +267,11 @@ class RecordReader {
   /// allocated in subsequent ReadRecords calls
   virtual std::shared_ptr<ResizableBuffer> ReleaseValues() = 0;
 
+  /// \brief Transfer the values read to the caller as a sequence of buffers of
+  /// contiguous values, which slice the data pages when reading them zero-copy (see
+  /// set_zero_copy_pages) and otherwise hold a single buffer as ReleaseValues().
+  virtual std::vector<std::shared_ptr<Buffer>> ReleaseValueChunks() = 0;
+
   /// \brief Transfer filled validity bitmap buffer to caller. A new one will
   /// be allocated in subsequent ReadRecords calls
   virtual std::shared_ptr<ResizableBuffer> ReleaseIsValid() = 0;
@@ -278,6 +319,19 @@ class RecordReader {
   /// \brief True if reading directly as Arrow dictionary-encoded
   bool read_dictionary() const { return read_dictionary_; }
 
+  /// \brief Slice the values of data pages from the page buffers rather than decoding
+  /// them, where possible.
+  ///
+  /// This applies to the PLAIN-encoded pages of INT32, INT64, FLOAT and DOUBLE columns
+  /// which are neither nested nor optional, when the page reader does not reuse its
+  /// page buffers (the pages are neither compressed nor encrypted) and the values of
+  /// the page are aligned to their size. The values read must then be released with
+  /// ReleaseValueChunks(), as values() only holds the decoded ones.
+  void set_zero_copy_pages(bool zero_copy_pages) { zero_copy_pages_ = zero_copy_pages; }
+
+  /// \brief True if data pages may be read zero-copy
+  bool zero_copy_pages() const { return zero_copy_pages_; }
+
  protected:
   bool nullable_values_;
 
@@ -302,6 +356,7 @@ class RecordReader {
   std::shared_ptr<::arrow::ResizableBuffer> rep_levels_;
 
   bool read_dictionary_ = false;
+  bool zero_copy_pages_ = false;
 };
 
 class BinaryRecordReader : virtual public RecordReader {
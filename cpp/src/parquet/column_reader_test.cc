@@ -22,6 +22,7 @@
 #include <cstdlib>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -382,5 +383,82 @@ TEST_F(TestPrimitiveReader, TestDictionaryEncodedPages) {
   pages_.clear();
 }
 
+// The values read from the chunks of a record reader reading data pages zero-copy
+static std::vector<int64_t> ChunkValues(
+    const std::vector<std::shared_ptr<Buffer>>& chunks) {
+  std::vector<int64_t> values;
+  for (const auto& chunk : chunks) {
+    auto data = reinterpret_cast<const int64_t*>(chunk->data());
+    values.insert(values.end(), data, data + chunk->size() / sizeof(int64_t));
+  }
+  return values;
+}
+
+TEST(TestRecordReader, ZeroCopyPages) {
+  const int values_per_page = 100;
+  NodePtr type = schema::Int64("a", Repetition::REQUIRED);
+  const ColumnDescriptor descr(type, 0, 0);
+
+  std::vector<int64_t> values(4 * values_per_page);
+  std::iota(values.begin(), values.end(), 0);
+  std::vector<std::shared_ptr<Page>> pages;
+  for (int i = 0; i < 4; ++i) {
+    std::vector<int64_t> page_values(values.begin() + i * values_per_page,
+                                     values.begin() + (i + 1) * values_per_page);
+    std::shared_ptr<DataPageV1> page =
+        MakeDataPage<Int64Type>(&descr, page_values, values_per_page, Encoding::PLAIN,
+                                {}, 0, {}, 0, {}, 0);
+    if (i == 2) {
+      // The values of a misaligned page are decoded
+      std::shared_ptr<ResizableBuffer> misaligned = AllocateBuffer(
+          ::arrow::default_memory_pool(), page->size() + 4);
+      std::memcpy(misaligned->mutable_data() + 4, page->data(), page->size());
+      page = std::make_shared<DataPageV1>(
+          ::arrow::SliceBuffer(misaligned, 4), page->num_values(), page->encoding(),
+          page->definition_level_encoding(), page->repetition_level_encoding(),
+          page->uncompressed_size());
+    }
+    pages.push_back(page);
+  }
+
+  auto reader = internal::RecordReader::Make(&descr, internal::LevelInfo());
+  reader->set_zero_copy_pages(true);
+  reader->SetPageReader(std::unique_ptr<PageReader>(
+      new MockPageReader(pages, /*stable_page_buffers=*/true)));
+
+  // The values of the first page and half the second one
+  reader->Reserve(150);
+  ASSERT_EQ(reader->ReadRecords(150), 150);
+  auto chunks = reader->ReleaseValueChunks();
+  ASSERT_EQ(chunks.size(), 2);
+  ASSERT_EQ(chunks[0]->data(), pages[0]->data());
+  ASSERT_EQ(chunks[1]->data(), pages[1]->data());
+  ASSERT_EQ(ChunkValues(chunks),
+            std::vector<int64_t>(values.begin(), values.begin() + 150));
+
+  // The rest of the second page, the decoded values of the third page and the values
+  // of the fourth page
+  reader->Reset();
+  reader->Reserve(1000);
+  ASSERT_EQ(reader->ReadRecords(1000), 250);
+  chunks = reader->ReleaseValueChunks();
+  ASSERT_EQ(chunks.size(), 3);
+  ASSERT_EQ(chunks[0]->data(), pages[1]->data() + 50 * sizeof(int64_t));
+  ASSERT_NE(chunks[1]->data(), pages[2]->data());
+  ASSERT_EQ(chunks[2]->data(), pages[3]->data());
+  ASSERT_EQ(ChunkValues(chunks),
+            std::vector<int64_t>(values.begin() + 150, values.end()));
+
+  // Pages whose buffers may be reused by the page reader are decoded
+  reader = internal::RecordReader::Make(&descr, internal::LevelInfo());
+  reader->set_zero_copy_pages(true);
+  reader->SetPageReader(std::unique_ptr<PageReader>(new MockPageReader(pages)));
+  reader->Reserve(1000);
+  ASSERT_EQ(reader->ReadRecords(1000), 400);
+  chunks = reader->ReleaseValueChunks();
+  ASSERT_EQ(chunks.size(), 1);
+  ASSERT_EQ(ChunkValues(chunks), values);
+}
+
 }  // namespace test
 }  // namespace parquet
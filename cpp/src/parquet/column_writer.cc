@@ -18,11 +18,16 @@
 #include "parquet/column_writer.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -33,16 +38,21 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_stream_utils.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "arrow/util/spaced.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption_internal.h"
 #include "parquet/internal_file_encryptor.h"
 #include "parquet/level_conversion.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -174,9 +184,11 @@ class SerializedPageWriter : public PageWriter {
                        int16_t row_group_ordinal, int16_t column_chunk_ordinal,
                        MemoryPool* pool = ::arrow::default_memory_pool(),
                        std::shared_ptr<Encryptor> meta_encryptor = nullptr,
-                       std::shared_ptr<Encryptor> data_encryptor = nullptr)
+                       std::shared_ptr<Encryptor> data_encryptor = nullptr,
+                       PageIndexBuilder* page_index_builder = nullptr)
       : sink_(std::move(sink)),
         metadata_(metadata),
+        page_index_builder_(page_index_builder),
         pool_(pool),
         num_values_(0),
         dictionary_page_offset_(0),
@@ -331,6 +343,12 @@ class SerializedPageWriter : public PageWriter {
 
     total_uncompressed_size_ += uncompressed_size + header_size;
     total_compressed_size_ += output_data_len + header_size;
+    if (page_index_builder_ != nullptr && page.first_row_index() >= 0) {
+      page_index_builder_->AddPage(start_pos,
+                                   static_cast<int32_t>(header_size + output_data_len),
+                                   page.first_row_index(), page.num_values(),
+                                   page.statistics());
+    }
     num_values_ += page.num_values();
     ++data_encoding_stats_[page.encoding()];
     ++page_ordinal_;
@@ -438,6 +456,8 @@ class SerializedPageWriter : public PageWriter {
 
   std::shared_ptr<ArrowOutputStream> sink_;
   ColumnChunkMetaDataBuilder* metadata_;
+  // Owned by the RowGroupWriter, which serializes it once the column is closed
+  PageIndexBuilder* page_index_builder_;
   MemoryPool* pool_;
   int64_t num_values_;
   int64_t dictionary_page_offset_;
@@ -473,13 +493,17 @@ class BufferedPageWriter : public PageWriter {
                      int16_t row_group_ordinal, int16_t current_column_ordinal,
                      MemoryPool* pool = ::arrow::default_memory_pool(),
                      std::shared_ptr<Encryptor> meta_encryptor = nullptr,
-                     std::shared_ptr<Encryptor> data_encryptor = nullptr)
-      : final_sink_(std::move(sink)), metadata_(metadata), has_dictionary_pages_(false) {
+                     std::shared_ptr<Encryptor> data_encryptor = nullptr,
+                     PageIndexBuilder* page_index_builder = nullptr)
+      : final_sink_(std::move(sink)),
+        metadata_(metadata),
+        page_index_builder_(page_index_builder),
+        has_dictionary_pages_(false) {
     in_memory_sink_ = CreateOutputStream(pool);
-    pager_ = std::unique_ptr<SerializedPageWriter>(
-        new SerializedPageWriter(in_memory_sink_, codec, compression_level, metadata,
-                                 row_group_ordinal, current_column_ordinal, pool,
-                                 std::move(meta_encryptor), std::move(data_encryptor)));
+    pager_ = std::unique_ptr<SerializedPageWriter>(new SerializedPageWriter(
+        in_memory_sink_, codec, compression_level, metadata, row_group_ordinal,
+        current_column_ordinal, pool, std::move(meta_encryptor),
+        std::move(data_encryptor), page_index_builder));
   }
 
   int64_t WriteDictionaryPage(const DictionaryPage& page) override {
@@ -501,6 +525,9 @@ class BufferedPageWriter : public PageWriter {
                       pager_->total_compressed_size(), pager_->total_uncompressed_size(),
                       has_dictionary, fallback, pager_->dict_encoding_stats_,
                       pager_->data_encoding_stats_, pager_->meta_encryptor_);
+    if (page_index_builder_ != nullptr) {
+      page_index_builder_->ShiftOffsets(final_position);
+    }
 
     // Write metadata at end of column chunk
     metadata_->WriteTo(in_memory_sink_.get());
@@ -524,6 +551,7 @@ class BufferedPageWriter : public PageWriter {
   std::shared_ptr<ArrowOutputStream> final_sink_;
   ColumnChunkMetaDataBuilder* metadata_;
   std::shared_ptr<::arrow::io::BufferOutputStream> in_memory_sink_;
+  PageIndexBuilder* page_index_builder_;
   std::unique_ptr<SerializedPageWriter> pager_;
   bool has_dictionary_pages_;
 };
@@ -533,17 +561,17 @@ std::unique_ptr<PageWriter> PageWriter::Open(
     int compression_level, ColumnChunkMetaDataBuilder* metadata,
     int16_t row_group_ordinal, int16_t column_chunk_ordinal, MemoryPool* pool,
     bool buffered_row_group, std::shared_ptr<Encryptor> meta_encryptor,
-    std::shared_ptr<Encryptor> data_encryptor) {
+    std::shared_ptr<Encryptor> data_encryptor, PageIndexBuilder* page_index_builder) {
   if (buffered_row_group) {
-    return std::unique_ptr<PageWriter>(
-        new BufferedPageWriter(std::move(sink), codec, compression_level, metadata,
-                               row_group_ordinal, column_chunk_ordinal, pool,
-                               std::move(meta_encryptor), std::move(data_encryptor)));
+    return std::unique_ptr<PageWriter>(new BufferedPageWriter(
+        std::move(sink), codec, compression_level, metadata, row_group_ordinal,
+        column_chunk_ordinal, pool, std::move(meta_encryptor), std::move(data_encryptor),
+        page_index_builder));
   } else {
-    return std::unique_ptr<PageWriter>(
-        new SerializedPageWriter(std::move(sink), codec, compression_level, metadata,
-                                 row_group_ordinal, column_chunk_ordinal, pool,
-                                 std::move(meta_encryptor), std::move(data_encryptor)));
+    return std::unique_ptr<PageWriter>(new SerializedPageWriter(
+        std::move(sink), codec, compression_level, metadata, row_group_ordinal,
+        column_chunk_ordinal, pool, std::move(meta_encryptor), std::move(data_encryptor),
+        page_index_builder));
   }
 }
 
@@ -572,6 +600,7 @@ class ColumnWriterImpl {
         num_buffered_values_(0),
         num_buffered_encoded_values_(0),
         rows_written_(0),
+        page_first_row_index_(0),
         total_bytes_written_(0),
         total_compressed_bytes_(0),
         closed_(false),
@@ -647,6 +676,11 @@ class ColumnWriterImpl {
   // Serialize the buffered Data Pages
   void FlushBufferedDataPages();
 
+  // Index of the first row of the page being built, or -1 if unknown
+  int64_t PageFirstRowIndex() const {
+    return descr_->max_repetition_level() == 0 ? page_first_row_index_ : -1;
+  }
+
   ColumnChunkMetaDataBuilder* metadata_;
   const ColumnDescriptor* descr_;
   // scratch buffer if validity bits need to be recalculated.
@@ -678,6 +712,10 @@ class ColumnWriterImpl {
   // Total number of rows written with this ColumnWriter
   int rows_written_;
 
+  // Index of the first row of the next data page. Rows are only counted per page for
+  // non-repeated columns, where each value starts a row.
+  int64_t page_first_row_index_;
+
   // Records the total number of bytes written by the serializer
   int64_t total_bytes_written_;
 
@@ -781,6 +819,7 @@ void ColumnWriterImpl::AddDataPage() {
 
   // Re-initialize the sinks for next Page.
   InitSinks();
+  page_first_row_index_ += num_buffered_values_;
   num_buffered_values_ = 0;
   num_buffered_encoded_values_ = 0;
 }
@@ -799,6 +838,7 @@ void ColumnWriterImpl::BuildDataPageV1(int64_t definition_levels_rle_size,
   page_stats.ApplyStatSizeLimits(properties_->max_statistics_size(descr_->path()));
   page_stats.set_is_signed(SortOrder::SIGNED == descr_->sort_order());
   ResetPageStatistics();
+  const int64_t first_row_index = PageFirstRowIndex();
 
   std::shared_ptr<Buffer> compressed_data;
   if (pager_->has_compressor()) {
@@ -816,14 +856,14 @@ void ColumnWriterImpl::BuildDataPageV1(int64_t definition_levels_rle_size,
         compressed_data->CopySlice(0, compressed_data->size(), allocator_));
     std::unique_ptr<DataPage> page_ptr(new DataPageV1(
         compressed_data_copy, static_cast<int32_t>(num_buffered_values_), encoding_,
-        Encoding::RLE, Encoding::RLE, uncompressed_size, page_stats));
+        Encoding::RLE, Encoding::RLE, uncompressed_size, page_stats, first_row_index));
     total_compressed_bytes_ += page_ptr->size() + sizeof(format::PageHeader);
 
     data_pages_.push_back(std::move(page_ptr));
   } else {  // Eagerly write pages
     DataPageV1 page(compressed_data, static_cast<int32_t>(num_buffered_values_),
                     encoding_, Encoding::RLE, Encoding::RLE, uncompressed_size,
-                    page_stats);
+                    page_stats, first_row_index);
     WriteDataPage(page);
   }
 }
@@ -855,6 +895,8 @@ void ColumnWriterImpl::BuildDataPageV2(int64_t definition_levels_rle_size,
   page_stats.set_is_signed(SortOrder::SIGNED == descr_->sort_order());
   ResetPageStatistics();
 
+  const int64_t first_row_index = PageFirstRowIndex();
+
   int32_t num_values = static_cast<int32_t>(num_buffered_values_);
   int32_t null_count = static_cast<int32_t>(page_stats.null_count);
   int32_t def_levels_byte_length = static_cast<int32_t>(definition_levels_rle_size);
@@ -867,12 +909,14 @@ void ColumnWriterImpl::BuildDataPageV2(int64_t definition_levels_rle_size,
                             combined->CopySlice(0, combined->size(), allocator_));
     std::unique_ptr<DataPage> page_ptr(new DataPageV2(
         combined, num_values, null_count, num_values, encoding_, def_levels_byte_length,
-        rep_levels_byte_length, uncompressed_size, pager_->has_compressor()));
+        rep_levels_byte_length, uncompressed_size, pager_->has_compressor(), page_stats,
+        first_row_index));
     total_compressed_bytes_ += page_ptr->size() + sizeof(format::PageHeader);
     data_pages_.push_back(std::move(page_ptr));
   } else {
     DataPageV2 page(combined, num_values, null_count, num_values, encoding_,
-                    def_levels_byte_length, rep_levels_byte_length, uncompressed_size);
+                    def_levels_byte_length, rep_levels_byte_length, uncompressed_size,
+                    pager_->has_compressor(), page_stats, first_row_index);
     WriteDataPage(page);
   }
 }
@@ -928,12 +972,62 @@ inline void DoInBatches(int64_t total, int64_t batch_size, Action&& action) {
   }
 }
 
-bool DictionaryDirectWriteSupported(const ::arrow::Array& array) {
+// Whether the dictionary of the array can be merged into the dictionary of a
+// column of the given physical type without converting its values
+bool DictionaryDirectWriteSupported(const ::arrow::Array& array,
+                                    Type::type physical_type) {
   DCHECK_EQ(array.type_id(), ::arrow::Type::DICTIONARY);
   const ::arrow::DictionaryType& dict_type =
       static_cast<const ::arrow::DictionaryType&>(*array.type());
-  auto id = dict_type.value_type()->id();
-  return id == ::arrow::Type::BINARY || id == ::arrow::Type::STRING;
+  switch (dict_type.value_type()->id()) {
+    case ::arrow::Type::BINARY:
+    case ::arrow::Type::STRING:
+      return physical_type == Type::BYTE_ARRAY;
+    case ::arrow::Type::INT32:
+      return physical_type == Type::INT32;
+    case ::arrow::Type::INT64:
+      return physical_type == Type::INT64;
+    case ::arrow::Type::FLOAT:
+      return physical_type == Type::FLOAT;
+    case ::arrow::Type::DOUBLE:
+      return physical_type == Type::DOUBLE;
+    default:
+      return false;
+  }
+}
+
+// Update statistics with the values of a dictionary supported by
+// DictionaryDirectWriteSupported
+template <typename DType>
+void UpdateStatisticsWithDictionary(const ::arrow::Array& dictionary,
+                                    TypedStatistics<DType>* statistics) {
+  using ArrayType = typename ::arrow::CTypeTraits<typename DType::c_type>::ArrayType;
+  statistics->Update(checked_cast<const ArrayType&>(dictionary).raw_values(),
+                     dictionary.length(), /*num_null=*/0);
+}
+
+template <>
+void UpdateStatisticsWithDictionary(const ::arrow::Array& dictionary,
+                                    TypedStatistics<ByteArrayType>* statistics) {
+  statistics->Update(dictionary);
+}
+
+template <>
+void UpdateStatisticsWithDictionary(const ::arrow::Array& dictionary,
+                                    TypedStatistics<BooleanType>* statistics) {
+  ParquetException::NYI("Direct dictionary write of " + dictionary.type()->ToString());
+}
+
+template <>
+void UpdateStatisticsWithDictionary(const ::arrow::Array& dictionary,
+                                    TypedStatistics<Int96Type>* statistics) {
+  ParquetException::NYI("Direct dictionary write of " + dictionary.type()->ToString());
+}
+
+template <>
+void UpdateStatisticsWithDictionary(const ::arrow::Array& dictionary,
+                                    TypedStatistics<FLBAType>* statistics) {
+  ParquetException::NYI("Direct dictionary write of " + dictionary.type()->ToString());
 }
 
 Status ConvertDictionaryToDense(const ::arrow::Array& array, MemoryPool* pool,
@@ -960,6 +1054,179 @@ static inline bool IsDictionaryEncoding(Encoding::type encoding) {
   return encoding == Encoding::PLAIN_DICTIONARY;
 }
 
+// Hash a value for a Bloom filter from its plain encoding
+static inline uint64_t BloomFilterHash(const BloomFilter& filter, bool value, int) {
+  return filter.Hash(static_cast<int32_t>(value));
+}
+
+static inline uint64_t BloomFilterHash(const BloomFilter& filter, int32_t value, int) {
+  return filter.Hash(value);
+}
+
+static inline uint64_t BloomFilterHash(const BloomFilter& filter, int64_t value, int) {
+  return filter.Hash(value);
+}
+
+static inline uint64_t BloomFilterHash(const BloomFilter& filter, float value, int) {
+  return filter.Hash(value);
+}
+
+static inline uint64_t BloomFilterHash(const BloomFilter& filter, double value, int) {
+  return filter.Hash(value);
+}
+
+static inline uint64_t BloomFilterHash(const BloomFilter& filter, const Int96& value,
+                                       int) {
+  return filter.Hash(&value);
+}
+
+static inline uint64_t BloomFilterHash(const BloomFilter& filter, const ByteArray& value,
+                                       int) {
+  return filter.Hash(&value);
+}
+
+static inline uint64_t BloomFilterHash(const BloomFilter& filter, const FLBA& value,
+                                       int type_length) {
+  return filter.Hash(&value, static_cast<uint32_t>(type_length));
+}
+
+// ----------------------------------------------------------------------
+// Adaptive encoding selection
+
+// Dictionary encoding is chosen if at most this fraction of the sampled values are
+// distinct
+constexpr double kAdaptiveMaxDistinctRatio = 0.5;
+// BYTE_STREAM_SPLIT is chosen if some byte stream of the sampled values has at most
+// this entropy, in bits per byte
+constexpr double kAdaptiveMaxByteStreamEntropy = 4.0;
+
+// Hash a value for estimating the number of distinct values from its plain encoding
+template <typename T>
+static inline uint64_t SampleHash(const T& value, int) {
+  return ::arrow::internal::ComputeStringHash<0>(&value, sizeof(T));
+}
+
+static inline uint64_t SampleHash(const ByteArray& value, int) {
+  return ::arrow::internal::ComputeStringHash<0>(value.ptr, value.len);
+}
+
+static inline uint64_t SampleHash(const FLBA& value, int type_length) {
+  return ::arrow::internal::ComputeStringHash<0>(value.ptr, type_length);
+}
+
+template <typename T>
+double SampleDistinctRatio(const T* values, int64_t num_values, int type_length) {
+  std::unordered_set<uint64_t> hashes;
+  for (int64_t i = 0; i < num_values; ++i) {
+    hashes.insert(SampleHash(values[i], type_length));
+  }
+  return static_cast<double>(hashes.size()) / static_cast<double>(num_values);
+}
+
+// The encoding other than dictionary and PLAIN encoding suiting the sampled values
+// best, or Encoding::UNKNOWN if none does
+template <typename DType>
+Encoding::type SampleValueEncoding(const typename DType::c_type*, int64_t, bool) {
+  return Encoding::UNKNOWN;
+}
+
+// DELTA_BINARY_PACKED stores the differences between consecutive values in the bit
+// width of their range, so it suits sorted or slowly varying integers whose deltas
+// fit in at most half the width of a value
+template <typename T>
+Encoding::type SampleIntegerEncoding(const T* values, int64_t num_values) {
+  using UnsignedT = typename std::make_unsigned<T>::type;
+  if (num_values < 2) return Encoding::UNKNOWN;
+  T min_delta = std::numeric_limits<T>::max();
+  T max_delta = std::numeric_limits<T>::min();
+  for (int64_t i = 1; i < num_values; ++i) {
+    // Deltas wrap around like in the encoder
+    const T delta = static_cast<T>(static_cast<UnsignedT>(values[i]) -
+                                   static_cast<UnsignedT>(values[i - 1]));
+    min_delta = std::min(min_delta, delta);
+    max_delta = std::max(max_delta, delta);
+  }
+  const int delta_bit_width = ::arrow::BitUtil::NumRequiredBits(
+      static_cast<UnsignedT>(static_cast<UnsignedT>(max_delta) -
+                             static_cast<UnsignedT>(min_delta)));
+  return delta_bit_width * 2 <= static_cast<int>(sizeof(T) * 8)
+             ? Encoding::DELTA_BINARY_PACKED
+             : Encoding::UNKNOWN;
+}
+
+template <>
+Encoding::type SampleValueEncoding<Int32Type>(const int32_t* values, int64_t num_values,
+                                              bool) {
+  return SampleIntegerEncoding(values, num_values);
+}
+
+template <>
+Encoding::type SampleValueEncoding<Int64Type>(const int64_t* values, int64_t num_values,
+                                              bool) {
+  return SampleIntegerEncoding(values, num_values);
+}
+
+// BYTE_STREAM_SPLIT only makes floating point values more compressible, by grouping
+// their bytes of same significance. It pays off when some byte stream, typically the
+// one holding the exponents, is repetitive.
+template <typename T>
+Encoding::type SampleFloatingPointEncoding(const T* values, int64_t num_values,
+                                           bool compressed) {
+  if (!compressed || num_values == 0) return Encoding::UNKNOWN;
+  const auto bytes = reinterpret_cast<const uint8_t*>(values);
+  for (size_t stream = 0; stream < sizeof(T); ++stream) {
+    std::array<int64_t, 256> counts{};
+    for (int64_t i = 0; i < num_values; ++i) {
+      ++counts[bytes[i * sizeof(T) + stream]];
+    }
+    double entropy = 0;
+    for (int64_t count : counts) {
+      if (count == 0) continue;
+      const double p = static_cast<double>(count) / static_cast<double>(num_values);
+      entropy -= p * std::log2(p);
+    }
+    if (entropy <= kAdaptiveMaxByteStreamEntropy) {
+      return Encoding::BYTE_STREAM_SPLIT;
+    }
+  }
+  return Encoding::UNKNOWN;
+}
+
+template <>
+Encoding::type SampleValueEncoding<FloatType>(const float* values, int64_t num_values,
+                                              bool compressed) {
+  return SampleFloatingPointEncoding(values, num_values, compressed);
+}
+
+template <>
+Encoding::type SampleValueEncoding<DoubleType>(const double* values, int64_t num_values,
+                                               bool compressed) {
+  return SampleFloatingPointEncoding(values, num_values, compressed);
+}
+
+// DELTA_BYTE_ARRAY stores the prefix each value shares with the previous one once, so
+// it suits sorted values such as paths or URLs where shared prefixes make up at least
+// half of the bytes
+template <>
+Encoding::type SampleValueEncoding<ByteArrayType>(const ByteArray* values,
+                                                  int64_t num_values, bool) {
+  int64_t total_length = 0;
+  int64_t prefix_length = 0;
+  for (int64_t i = 0; i < num_values; ++i) {
+    total_length += values[i].len;
+    if (i == 0) continue;
+    const uint32_t max_length = std::min(values[i].len, values[i - 1].len);
+    uint32_t length = 0;
+    while (length < max_length && values[i].ptr[length] == values[i - 1].ptr[length]) {
+      ++length;
+    }
+    prefix_length += length;
+  }
+  return total_length > 0 && prefix_length * 2 >= total_length
+             ? Encoding::DELTA_BYTE_ARRAY
+             : Encoding::UNKNOWN;
+}
+
 template <typename DType>
 class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<DType> {
  public:
@@ -967,9 +1234,12 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
 
   TypedColumnWriterImpl(ColumnChunkMetaDataBuilder* metadata,
                         std::unique_ptr<PageWriter> pager, const bool use_dictionary,
-                        Encoding::type encoding, const WriterProperties* properties)
+                        Encoding::type encoding, const WriterProperties* properties,
+                        BloomFilter* bloom_filter)
       : ColumnWriterImpl(metadata, std::move(pager), use_dictionary, encoding,
-                         properties) {
+                         properties),
+        bloom_filter_(bloom_filter),
+        choose_encoding_(properties->adaptive_encoding_enabled(descr_->path())) {
     current_encoder_ = MakeEncoder(DType::type_num, encoding, use_dictionary, descr_,
                                    properties->memory_pool());
 
@@ -1145,10 +1415,13 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   std::shared_ptr<TypedStats> chunk_statistics_;
 
   // If writing a sequence of ::arrow::DictionaryArray to the writer, we keep the
-  // dictionary passed to DictEncoder<T>::PutDictionary so we can check
-  // subsequent array chunks to see either if materialization is required (in
-  // which case we call back to the dense write path)
+  // last dictionary merged into the DictEncoder<T> so we can check whether
+  // subsequent array chunks share it, in which case their indices are written
+  // without hashing any value
   std::shared_ptr<::arrow::Array> preserved_dictionary_;
+  // The indices in the encoder's dictionary of the values of preserved_dictionary_,
+  // or empty if they are the same
+  std::vector<int32_t> preserved_transpose_map_;
 
   int64_t WriteLevels(int64_t num_values, const int16_t* def_levels,
                       const int16_t* rep_levels) {
@@ -1299,16 +1572,65 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     }
   }
 
+  // Choose the encoding of the chunk from a sample of its first values, which must
+  // not be encoded yet. The choice waits for a batch with some non-null values.
+  void MaybeChooseEncoding(const T* values, int64_t num_values) {
+    if (!choose_encoding_ || num_values == 0) return;
+    choose_encoding_ = false;
+
+    const bool dictionary_enabled = properties_->dictionary_enabled(descr_->path()) &&
+                                    descr_->physical_type() != Type::BOOLEAN;
+    Encoding::type encoding = Encoding::UNKNOWN;
+    if (dictionary_enabled && SampleDistinctRatio(values, num_values,
+                                                  descr_->type_length()) <=
+                                  kAdaptiveMaxDistinctRatio) {
+      encoding = properties_->dictionary_index_encoding();
+    } else if (properties_->version() != ParquetVersion::PARQUET_1_0) {
+      encoding =
+          SampleValueEncoding<DType>(values, num_values, pager_->has_compressor());
+    }
+    if (encoding == Encoding::UNKNOWN) {
+      encoding = properties_->encoding(descr_->path());
+    }
+    if (encoding == encoding_) return;
+
+    const bool use_dictionary = encoding == properties_->dictionary_index_encoding();
+    current_encoder_ = MakeEncoder(DType::type_num, encoding, use_dictionary, descr_,
+                                   properties_->memory_pool());
+    has_dictionary_ = use_dictionary;
+    encoding_ = encoding;
+  }
+
   void WriteValues(const T* values, int64_t num_values, int64_t num_nulls) {
+    MaybeChooseEncoding(values, num_values);
     dynamic_cast<ValueEncoderType*>(current_encoder_.get())
         ->Put(values, static_cast<int>(num_values));
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      for (int64_t i = 0; i < num_values; ++i) {
+        InsertIntoBloomFilter(values[i]);
+      }
+    }
   }
 
   void WriteValuesSpaced(const T* values, int64_t num_values, int64_t num_spaced_values,
                          const uint8_t* valid_bits, int64_t valid_bits_offset) {
+    if (choose_encoding_) {
+      if (num_values != num_spaced_values) {
+        PARQUET_ASSIGN_OR_THROW(auto buffer,
+                                ::arrow::AllocateBuffer(num_values * sizeof(T),
+                                                        properties_->memory_pool()));
+        T* valid_values = reinterpret_cast<T*>(buffer->mutable_data());
+        ::arrow::util::internal::SpacedCompress<T>(
+            values, static_cast<int>(num_spaced_values), valid_bits, valid_bits_offset,
+            valid_values);
+        MaybeChooseEncoding(valid_values, num_values);
+      } else {
+        MaybeChooseEncoding(values, num_values);
+      }
+    }
     if (num_values != num_spaced_values) {
       dynamic_cast<ValueEncoderType*>(current_encoder_.get())
           ->PutSpaced(values, static_cast<int>(num_spaced_values), valid_bits,
@@ -1322,28 +1644,45 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset, num_values,
                                      num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      for (int64_t i = 0; i < num_spaced_values; ++i) {
+        if (valid_bits == nullptr ||
+            ::arrow::BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+          InsertIntoBloomFilter(values[i]);
+        }
+      }
+    }
+  }
+
+  void InsertIntoBloomFilter(const T& value) {
+    bloom_filter_->InsertHash(
+        BloomFilterHash(*bloom_filter_, value, descr_->type_length()));
   }
+
+  // Owned by the RowGroupWriter, which serializes it once the column is closed
+  BloomFilter* bloom_filter_;
+  // Whether the encoding is still to be chosen from the first values written, see
+  // WriterProperties::Builder::enable_adaptive_encoding
+  bool choose_encoding_;
 };
 
 template <typename DType>
 Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(
     const int16_t* def_levels, const int16_t* rep_levels, int64_t num_levels,
     const ::arrow::Array& array, ArrowWriteContext* ctx, bool maybe_parent_nulls) {
-  // If this is the first time writing a DictionaryArray, then there's
-  // a few possible paths to take:
+  // There are a few possible paths to take:
   //
   // - If dictionary encoding is not enabled, convert to densely
   //   encoded and call WriteArrow
   // - Dictionary encoding enabled
-  //   - If this is the first time this is called, then we call
-  //     PutDictionary into the encoder and then PutIndices on each
-  //     chunk. We store the dictionary that was written in
-  //     preserved_dictionary_ so that subsequent calls to this method
-  //     can make sure the dictionary has not changed
-  //   - On subsequent calls, we have to check whether the dictionary
-  //     has changed. If it has, then we trigger the varying
-  //     dictionary path and materialize each chunk and then call
-  //     WriteArrow with that
+  //   - If the dictionary is the one of the previous call, then we call
+  //     PutIndices on each chunk, transposing them if needed
+  //   - Otherwise we merge the values of the dictionary into the encoder's
+  //     dictionary, which only hashes the dictionary values, then transpose the
+  //     indices of each chunk to the encoder's dictionary. We keep the dictionary
+  //     in preserved_dictionary_ so that subsequent calls can skip the merge
+  //   - If merging grows the encoder's dictionary past the dictionary page size
+  //     limit, we fall back to plain encoding and the dense write path
   auto WriteDense = [&] {
     std::shared_ptr<::arrow::Array> dense_array;
     RETURN_NOT_OK(
@@ -1352,8 +1691,11 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(
                            maybe_parent_nulls);
   };
 
+  // A Bloom filter must only contain the values which are written, which are found by
+  // writing densely
   if (!IsDictionaryEncoding(current_encoder_->encoding()) ||
-      !DictionaryDirectWriteSupported(array)) {
+      !DictionaryDirectWriteSupported(array, descr_->physical_type()) ||
+      bloom_filter_ != nullptr) {
     // No longer dictionary-encoding for whatever reason, maybe we never were
     // or we decided to stop. Note that WriteArrow can be invoked multiple
     // times with both dense and dictionary-encoded versions of the same data
@@ -1368,6 +1710,50 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(
   std::shared_ptr<::arrow::Array> dictionary = data.dictionary();
   std::shared_ptr<::arrow::Array> indices = data.indices();
 
+  if (dictionary->null_count() > 0) {
+    return WriteDense();
+  }
+  // The values come dictionary encoded already
+  choose_encoding_ = false;
+
+  const bool same_dictionary =
+      preserved_dictionary_ != nullptr &&
+      (dictionary->data() == preserved_dictionary_->data() ||
+       dictionary->Equals(*preserved_dictionary_));
+  if (!same_dictionary) {
+    const bool first_dictionary = dict_encoder->num_entries() == 0;
+    PARQUET_CATCH_NOT_OK(
+        dict_encoder->MergeDictionary(*dictionary, &preserved_transpose_map_));
+    preserved_dictionary_ = dictionary;
+
+    // The first dictionary is kept whole whatever its size, but merging more
+    // dictionaries is subject to the dictionary page size limit
+    if (!first_dictionary &&
+        dict_encoder->dict_encoded_size() >= properties_->dictionary_pagesize_limit()) {
+      PARQUET_CATCH_NOT_OK(FallbackToPlainEncoding());
+      return WriteDense();
+    }
+
+    // TODO(wesm): If some dictionary values are unobserved, then the
+    // statistics will be inaccurate. Do we care enough to fix it?
+    if (page_statistics_ != nullptr) {
+      PARQUET_CATCH_NOT_OK(
+          UpdateStatisticsWithDictionary(*dictionary, page_statistics_.get()));
+    }
+
+    // Indices are written as is if the encoder's dictionary starts with the
+    // dictionary's values
+    bool is_prefix = true;
+    for (size_t i = 0; is_prefix && i < preserved_transpose_map_.size(); ++i) {
+      is_prefix = preserved_transpose_map_[i] == static_cast<int32_t>(i);
+    }
+    if (is_prefix) {
+      preserved_transpose_map_.clear();
+    }
+  }
+  const int32_t* transpose_map =
+      preserved_transpose_map_.empty() ? nullptr : preserved_transpose_map_.data();
+
   int64_t value_offset = 0;
   auto WriteIndicesChunk = [&](int64_t offset, int64_t batch_size) {
     int64_t batch_num_values = 0;
@@ -1383,36 +1769,11 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(
     std::shared_ptr<Array> writeable_indices =
         indices->Slice(value_offset, batch_num_spaced_values);
     writeable_indices = MaybeReplaceValidity(writeable_indices, null_count);
-    dict_encoder->PutIndices(*writeable_indices);
+    dict_encoder->PutTransposedIndices(*writeable_indices, transpose_map);
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values);
     value_offset += batch_num_spaced_values;
   };
 
-  // Handle seeing dictionary for the first time
-  if (!preserved_dictionary_) {
-    // It's a new dictionary. Call PutDictionary and keep track of it
-    PARQUET_CATCH_NOT_OK(dict_encoder->PutDictionary(*dictionary));
-
-    // If there were duplicate value in the dictionary, the encoder's memo table
-    // will be out of sync with the indices in the Arrow array.
-    // The easiest solution for this uncommon case is to fallback to plain encoding.
-    if (dict_encoder->num_entries() != dictionary->length()) {
-      PARQUET_CATCH_NOT_OK(FallbackToPlainEncoding());
-      return WriteDense();
-    }
-
-    // TODO(wesm): If some dictionary values are unobserved, then the
-    // statistics will be inaccurate. Do we care enough to fix it?
-    if (page_statistics_ != nullptr) {
-      PARQUET_CATCH_NOT_OK(page_statistics_->Update(*dictionary));
-    }
-    preserved_dictionary_ = dictionary;
-  } else if (!dictionary->Equals(*preserved_dictionary_)) {
-    // Dictionary has changed
-    PARQUET_CATCH_NOT_OK(FallbackToPlainEncoding());
-    return WriteDense();
-  }
-
   PARQUET_CATCH_NOT_OK(
       DoInBatches(num_levels, properties_->write_batch_size(), WriteIndicesChunk));
   return Status::OK();
@@ -1811,10 +2172,29 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(
         array.Slice(value_offset, batch_num_spaced_values);
     data_slice = MaybeReplaceValidity(data_slice, null_count);
 
+    const auto& binary_array = checked_cast<const ::arrow::BinaryArray&>(*data_slice);
+    if (choose_encoding_) {
+      std::vector<ByteArray> valid_values;
+      valid_values.reserve(batch_num_values);
+      for (int64_t i = 0; i < binary_array.length(); ++i) {
+        if (binary_array.IsValid(i)) {
+          valid_values.emplace_back(binary_array.GetView(i));
+        }
+      }
+      MaybeChooseEncoding(valid_values.data(),
+                          static_cast<int64_t>(valid_values.size()));
+    }
     current_encoder_->Put(*data_slice);
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(*data_slice);
     }
+    if (bloom_filter_ != nullptr) {
+      for (int64_t i = 0; i < binary_array.length(); ++i) {
+        if (binary_array.IsValid(i)) {
+          InsertIntoBloomFilter(ByteArray(binary_array.GetView(i)));
+        }
+      }
+    }
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values);
     CheckDictionarySizeLimit();
     value_offset += batch_num_spaced_values;
@@ -1926,7 +2306,8 @@ Status TypedColumnWriterImpl<FLBAType>::WriteArrowDense(
 
 std::shared_ptr<ColumnWriter> ColumnWriter::Make(ColumnChunkMetaDataBuilder* metadata,
                                                  std::unique_ptr<PageWriter> pager,
-                                                 const WriterProperties* properties) {
+                                                 const WriterProperties* properties,
+                                                 BloomFilter* bloom_filter) {
   const ColumnDescriptor* descr = metadata->descr();
   const bool use_dictionary = properties->dictionary_enabled(descr->path()) &&
                               descr->physical_type() != Type::BOOLEAN;
@@ -1937,28 +2318,36 @@ std::shared_ptr<ColumnWriter> ColumnWriter::Make(ColumnChunkMetaDataBuilder* met
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
       return std::make_shared<TypedColumnWriterImpl<BooleanType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::INT32:
       return std::make_shared<TypedColumnWriterImpl<Int32Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::INT64:
       return std::make_shared<TypedColumnWriterImpl<Int64Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::INT96:
       return std::make_shared<TypedColumnWriterImpl<Int96Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::FLOAT:
       return std::make_shared<TypedColumnWriterImpl<FloatType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::DOUBLE:
       return std::make_shared<TypedColumnWriterImpl<DoubleType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::BYTE_ARRAY:
       return std::make_shared<TypedColumnWriterImpl<ByteArrayType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     case Type::FIXED_LEN_BYTE_ARRAY:
       return std::make_shared<TypedColumnWriterImpl<FLBAType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter);
     default:
       ParquetException::NYI("type reader not implemented");
   }
@@ -42,11 +42,13 @@ class RleEncoder;
 namespace parquet {
 
 struct ArrowWriteContext;
+class BloomFilter;
 class ColumnDescriptor;
 class DataPage;
 class DictionaryPage;
 class ColumnChunkMetaDataBuilder;
 class Encryptor;
+class PageIndexBuilder;
 class WriterProperties;
 
 class PARQUET_EXPORT LevelEncoder {
@@ -90,7 +92,8 @@ class PARQUET_EXPORT PageWriter {
       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
       bool buffered_row_group = false,
       std::shared_ptr<Encryptor> header_encryptor = NULLPTR,
-      std::shared_ptr<Encryptor> data_encryptor = NULLPTR);
+      std::shared_ptr<Encryptor> data_encryptor = NULLPTR,
+      PageIndexBuilder* page_index_builder = NULLPTR);
 
   // The Column Writer decides if dictionary encoding is used if set and
   // if the dictionary encoding has fallen back to default encoding on reaching dictionary
@@ -111,9 +114,12 @@ class PARQUET_EXPORT ColumnWriter {
  public:
   virtual ~ColumnWriter() = default;
 
+  /// \brief Make a writer for a column chunk. If `bloom_filter` is not null, the
+  /// hashes of the written values are inserted into it; it must outlive the writer.
   static std::shared_ptr<ColumnWriter> Make(ColumnChunkMetaDataBuilder*,
                                             std::unique_ptr<PageWriter>,
-                                            const WriterProperties* properties);
+                                            const WriterProperties* properties,
+                                            BloomFilter* bloom_filter = NULLPTR);
 
   /// \brief Closes the ColumnWriter, commits any buffered values to pages.
   /// \return Total size of the column in bytes
@@ -136,6 +142,9 @@ class PARQUET_EXPORT ColumnWriter {
   /// dictionary pages to the ColumnChunk so far
   virtual int64_t total_bytes_written() const = 0;
 
+  /// \brief Estimated size of the values that are not written to a page yet
+  virtual int64_t EstimatedBufferedValueBytes() const = 0;
+
   /// \brief The file-level writer properties
   virtual const WriterProperties* properties() = 0;
 
@@ -200,9 +209,6 @@ class TypedColumnWriter : public ColumnWriter {
   virtual void WriteBatchSpaced(int64_t num_values, const int16_t* def_levels,
                                 const int16_t* rep_levels, const uint8_t* valid_bits,
                                 int64_t valid_bits_offset, const T* values) = 0;
-
-  // Estimated size of the values that are not written to a page yet
-  virtual int64_t EstimatedBufferedValueBytes() const = 0;
 };
 
 using BoolWriter = TypedColumnWriter<BooleanType>;
@@ -15,13 +15,18 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <limits>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
 
+#include "arrow/array.h"
 #include "arrow/io/buffered.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/util/bitmap_builders.h"
 
 #include "parquet/column_reader.h"
@@ -762,6 +767,102 @@ TEST(TestColumnWriter, RepeatedListsUpdateSpacedBug) {
   writer->Close();
 }
 
+// Write the values to a required column with adaptive encoding, returning the
+// encodings of the column chunk metadata
+template <typename DType>
+std::vector<Encoding::type> WriteAdaptivelyEncoded(
+    const std::vector<typename DType::c_type>& values, ParquetVersion::type version,
+    Compression::type compression = Compression::UNCOMPRESSED) {
+  NodePtr node = PrimitiveNode::Make("column", Repetition::REQUIRED, DType::type_num);
+  SchemaDescriptor schema;
+  schema.Init(GroupNode::Make("schema", Repetition::REQUIRED, {node}));
+
+  auto sink = CreateOutputStream();
+  auto props = WriterProperties::Builder()
+                   .version(version)
+                   ->enable_adaptive_encoding()
+                   ->compression(compression)
+                   ->build();
+  auto metadata = ColumnChunkMetaDataBuilder::Make(props, schema.Column(0));
+  std::unique_ptr<PageWriter> pager = PageWriter::Open(
+      sink, compression, Codec::UseDefaultCompressionLevel(), metadata.get());
+  auto writer = std::static_pointer_cast<TypedColumnWriter<DType>>(
+      ColumnWriter::Make(metadata.get(), std::move(pager), props.get()));
+  writer->WriteBatch(static_cast<int64_t>(values.size()), nullptr, nullptr,
+                     values.data());
+  writer->Close();
+
+  auto metadata_accessor =
+      ColumnChunkMetaData::Make(metadata->contents(), schema.Column(0));
+  std::vector<Encoding::type> data_page_encodings;
+  for (const auto& encoding_stats : metadata_accessor->encoding_stats()) {
+    if (encoding_stats.page_type == PageType::DATA_PAGE) {
+      data_page_encodings.push_back(encoding_stats.encoding);
+    }
+  }
+  EXPECT_EQ(data_page_encodings.size(), 1);
+  return metadata_accessor->encodings();
+}
+
+TEST(TestColumnWriter, AdaptiveEncoding) {
+  const auto v1 = ParquetVersion::PARQUET_1_0;
+  const auto v2 = ParquetVersion::PARQUET_2_0;
+  using Encodings = std::vector<Encoding::type>;
+  const Encodings kPlain = {Encoding::PLAIN, Encoding::RLE};
+
+  std::vector<int64_t> few_distinct, sorted, random;
+  ::arrow::random::RandomArrayGenerator rng(42);
+  auto random_array = std::static_pointer_cast<::arrow::Int64Array>(
+      rng.Int64(1000, std::numeric_limits<int64_t>::min(),
+                std::numeric_limits<int64_t>::max()));
+  for (int64_t i = 0; i < 1000; ++i) {
+    few_distinct.push_back(i % 10);
+    sorted.push_back(1000000000000 + i * 7);
+    random.push_back(random_array->Value(i));
+  }
+  ASSERT_EQ(WriteAdaptivelyEncoded<Int64Type>(few_distinct, v1),
+            Encodings({Encoding::PLAIN_DICTIONARY, Encoding::PLAIN, Encoding::RLE}));
+  ASSERT_EQ(WriteAdaptivelyEncoded<Int64Type>(few_distinct, v2),
+            Encodings({Encoding::RLE_DICTIONARY, Encoding::PLAIN, Encoding::RLE}));
+  // Delta encodings are only chosen for PARQUET_2_0 files
+  ASSERT_EQ(WriteAdaptivelyEncoded<Int64Type>(sorted, v1), kPlain);
+  ASSERT_EQ(WriteAdaptivelyEncoded<Int64Type>(sorted, v2),
+            Encodings({Encoding::DELTA_BINARY_PACKED, Encoding::RLE}));
+  ASSERT_EQ(WriteAdaptivelyEncoded<Int64Type>(random, v2), kPlain);
+
+  std::vector<std::string> urls;
+  for (int i = 0; i < 1000; ++i) {
+    urls.push_back("https://arrow.apache.org/docs/cpp/page" + std::to_string(i));
+  }
+  std::vector<ByteArray> url_values;
+  for (const auto& url : urls) {
+    url_values.emplace_back(url);
+  }
+  ASSERT_EQ(WriteAdaptivelyEncoded<ByteArrayType>(url_values, v2),
+            Encodings({Encoding::DELTA_BYTE_ARRAY, Encoding::RLE}));
+  std::reverse(urls.begin(), urls.end());
+  for (auto& url : urls) {
+    std::reverse(url.begin(), url.end());
+  }
+  for (size_t i = 0; i < urls.size(); ++i) {
+    url_values[i] = ByteArray(urls[i]);
+  }
+  ASSERT_EQ(WriteAdaptivelyEncoded<ByteArrayType>(url_values, v2), kPlain);
+
+  std::vector<double> doubles;
+  auto doubles_array = std::static_pointer_cast<::arrow::DoubleArray>(
+      rng.Float64(1000, 0, 1));
+  for (int64_t i = 0; i < 1000; ++i) {
+    doubles.push_back(doubles_array->Value(i));
+  }
+  // BYTE_STREAM_SPLIT is only chosen for compressed columns
+  ASSERT_EQ(WriteAdaptivelyEncoded<DoubleType>(doubles, v2), kPlain);
+#ifdef ARROW_WITH_SNAPPY
+  ASSERT_EQ(WriteAdaptivelyEncoded<DoubleType>(doubles, v2, Compression::SNAPPY),
+            Encodings({Encoding::BYTE_STREAM_SPLIT, Encoding::RLE}));
+#endif
+}
+
 void GenerateLevels(int min_repeat_factor, int max_repeat_factor, int max_level,
                     std::vector<int16_t>& input_levels) {
   // for each repetition count up to max_repeat_factor
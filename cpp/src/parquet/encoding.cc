@@ -35,6 +35,7 @@
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "arrow/util/simd.h"
 #include "arrow/util/ubsan.h"
 #include "arrow/visitor_inline.h"
 
@@ -528,9 +529,17 @@ class DictEncoderImpl : public EncoderImpl, virtual public DictEncoder<DType> {
   void Put(const arrow::Array& values) override;
   void PutDictionary(const arrow::Array& values) override;
 
+  void MergeDictionary(const arrow::Array& values,
+                       std::vector<int32_t>* transpose_map) override;
+
+  // Append the indices, mapped through transpose_map unless it is null
   template <typename ArrowType, typename T = typename ArrowType::c_type>
-  void PutIndicesTyped(const arrow::Array& data) {
+  void PutIndicesTyped(const arrow::Array& data, const int32_t* transpose_map) {
     auto values = data.data()->GetValues<T>(1);
+    auto map_index = [transpose_map](T index) {
+      return transpose_map != nullptr ? transpose_map[index]
+                                      : static_cast<int32_t>(index);
+    };
     size_t buffer_position = buffered_indices_.size();
     buffered_indices_.resize(buffer_position +
                              static_cast<size_t>(data.length() - data.null_count()));
@@ -539,36 +548,41 @@ class DictEncoderImpl : public EncoderImpl, virtual public DictEncoder<DType> {
                                                       data.offset(), data.length());
       for (int64_t i = 0; i < data.length(); ++i) {
         if (valid_bits_reader.IsSet()) {
-          buffered_indices_[buffer_position++] = static_cast<int32_t>(values[i]);
+          buffered_indices_[buffer_position++] = map_index(values[i]);
         }
         valid_bits_reader.Next();
       }
     } else {
       for (int64_t i = 0; i < data.length(); ++i) {
-        buffered_indices_[buffer_position++] = static_cast<int32_t>(values[i]);
+        buffered_indices_[buffer_position++] = map_index(values[i]);
       }
     }
   }
 
-  void PutIndices(const arrow::Array& data) override {
+  void PutTransposedIndices(const arrow::Array& data,
+                            const int32_t* transpose_map) override {
     switch (data.type()->id()) {
       case arrow::Type::UINT8:
       case arrow::Type::INT8:
-        return PutIndicesTyped<arrow::UInt8Type>(data);
+        return PutIndicesTyped<arrow::UInt8Type>(data, transpose_map);
       case arrow::Type::UINT16:
       case arrow::Type::INT16:
-        return PutIndicesTyped<arrow::UInt16Type>(data);
+        return PutIndicesTyped<arrow::UInt16Type>(data, transpose_map);
       case arrow::Type::UINT32:
       case arrow::Type::INT32:
-        return PutIndicesTyped<arrow::UInt32Type>(data);
+        return PutIndicesTyped<arrow::UInt32Type>(data, transpose_map);
       case arrow::Type::UINT64:
       case arrow::Type::INT64:
-        return PutIndicesTyped<arrow::UInt64Type>(data);
+        return PutIndicesTyped<arrow::UInt64Type>(data, transpose_map);
       default:
         throw ParquetException("Passed non-integer array to PutIndices");
     }
   }
 
+  void PutIndices(const arrow::Array& data) override {
+    PutTransposedIndices(data, /*transpose_map=*/nullptr);
+  }
+
   std::shared_ptr<Buffer> FlushValues() override {
     std::shared_ptr<ResizableBuffer> buffer =
         AllocateBuffer(this->pool_, EstimatedDataEncodedSize());
@@ -692,6 +706,12 @@ void DictEncoderImpl<Int96Type>::PutDictionary(const arrow::Array& values) {
   ParquetException::NYI("Direct put to Int96");
 }
 
+template <>
+void DictEncoderImpl<Int96Type>::MergeDictionary(const arrow::Array& values,
+                                                 std::vector<int32_t>* transpose_map) {
+  ParquetException::NYI("Direct put to Int96");
+}
+
 template <typename DType>
 void DictEncoderImpl<DType>::Put(const arrow::Array& values) {
   using ArrayType = typename arrow::CTypeTraits<typename DType::c_type>::ArrayType;
@@ -805,6 +825,66 @@ void DictEncoderImpl<ByteArrayType>::PutDictionary(const arrow::Array& values) {
   }
 }
 
+template <typename DType>
+void DictEncoderImpl<DType>::MergeDictionary(const arrow::Array& values,
+                                             std::vector<int32_t>* transpose_map) {
+  if (values.null_count() > 0) {
+    throw ParquetException("Inserted dictionary cannot cannot contain nulls");
+  }
+  using ArrayType = typename arrow::CTypeTraits<typename DType::c_type>::ArrayType;
+  const auto& data = checked_cast<const ArrayType&>(values);
+
+  auto on_found = [](int32_t memo_index) {};
+  auto on_not_found = [this](int32_t memo_index) {
+    dict_encoded_size_ += static_cast<int>(sizeof(typename DType::c_type));
+  };
+  transpose_map->resize(static_cast<size_t>(data.length()));
+  for (int64_t i = 0; i < data.length(); i++) {
+    PARQUET_THROW_NOT_OK(memo_table_.GetOrInsert(data.Value(i), on_found, on_not_found,
+                                                 &(*transpose_map)[i]));
+  }
+}
+
+template <>
+void DictEncoderImpl<FLBAType>::MergeDictionary(const arrow::Array& values,
+                                                std::vector<int32_t>* transpose_map) {
+  AssertFixedSizeBinary(values, type_length_);
+  if (values.null_count() > 0) {
+    throw ParquetException("Inserted dictionary cannot cannot contain nulls");
+  }
+  const auto& data = checked_cast<const arrow::FixedSizeBinaryArray&>(values);
+
+  auto on_found = [](int32_t memo_index) {};
+  auto on_not_found = [this](int32_t memo_index) { dict_encoded_size_ += type_length_; };
+  transpose_map->resize(static_cast<size_t>(data.length()));
+  for (int64_t i = 0; i < data.length(); i++) {
+    PARQUET_THROW_NOT_OK(memo_table_.GetOrInsert(data.Value(i), type_length_, on_found,
+                                                 on_not_found, &(*transpose_map)[i]));
+  }
+}
+
+template <>
+void DictEncoderImpl<ByteArrayType>::MergeDictionary(
+    const arrow::Array& values, std::vector<int32_t>* transpose_map) {
+  AssertBinary(values);
+  if (values.null_count() > 0) {
+    throw ParquetException("Inserted dictionary cannot cannot contain nulls");
+  }
+  const auto& data = checked_cast<const arrow::BinaryArray&>(values);
+
+  transpose_map->resize(static_cast<size_t>(data.length()));
+  for (int64_t i = 0; i < data.length(); i++) {
+    auto v = data.GetView(i);
+    auto on_found = [](int32_t memo_index) {};
+    auto on_not_found = [&](int32_t memo_index) {
+      dict_encoded_size_ += static_cast<int>(v.size() + sizeof(uint32_t));
+    };
+    PARQUET_THROW_NOT_OK(memo_table_.GetOrInsert(v.data(), static_cast<int32_t>(v.size()),
+                                                 on_found, on_not_found,
+                                                 &(*transpose_map)[i]));
+  }
+}
+
 // ----------------------------------------------------------------------
 // ByteStreamSplitEncoder<T> implementations
 
@@ -890,6 +970,354 @@ void ByteStreamSplitEncoder<DType>::PutSpaced(const T* src, int num_values,
   Put(data, num_valid_values);
 }
 
+// ----------------------------------------------------------------------
+// DeltaBitPackEncoder
+
+/// DELTA_BINARY_PACKED: a header with the block size, the number of mini blocks per
+/// block, the total number of values and the first value, followed by blocks of the
+/// differences between consecutive values. Each block stores its smallest delta, the
+/// bit width of each of its mini blocks, then the bit-packed deltas less the smallest.
+template <typename DType>
+class DeltaBitPackEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+  using UT = typename std::make_unsigned<T>::type;
+  using TypedEncoder<DType>::Put;
+
+  static constexpr uint32_t kValuesPerBlock = 128;
+  static constexpr uint32_t kMiniBlocksPerBlock = 4;
+  static constexpr uint32_t kValuesPerMiniBlock = kValuesPerBlock / kMiniBlocksPerBlock;
+  // The smallest delta, the bit widths and the deltas of a full block
+  static constexpr int kMaxBlockBytes = arrow::BitUtil::BitReader::kMaxVlqByteLengthForInt64 +
+                                        kMiniBlocksPerBlock + kValuesPerBlock * sizeof(T);
+  // The block size, the number of mini blocks, the number of values and the first value
+  static constexpr int kMaxHeaderBytes =
+      3 * arrow::BitUtil::BitReader::kMaxVlqByteLength +
+      arrow::BitUtil::BitReader::kMaxVlqByteLengthForInt64;
+
+  explicit DeltaBitPackEncoder(const ColumnDescriptor* descr,
+                               MemoryPool* pool = arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BINARY_PACKED, pool),
+        sink_(pool),
+        deltas_(kValuesPerBlock, 0, ::arrow::stl::allocator<T>(pool)),
+        block_buffer_(AllocateBuffer(pool, kMaxBlockBytes)) {
+    if (DType::type_num != Type::INT32 && DType::type_num != Type::INT64) {
+      throw ParquetException("Delta bit pack encoding should only be for integer data.");
+    }
+  }
+
+  int64_t EstimatedDataEncodedSize() override {
+    return sink_.length() + values_current_block_ * sizeof(T);
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  void Put(const T* src, int num_values) override;
+
+  void Put(const ::arrow::Array& values) override;
+
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    PARQUET_ASSIGN_OR_THROW(
+        auto buffer, arrow::AllocateBuffer(num_values * sizeof(T), this->memory_pool()));
+    T* data = reinterpret_cast<T*>(buffer->mutable_data());
+    int num_valid_values = arrow::util::internal::SpacedCompress<T>(
+        src, num_values, valid_bits, valid_bits_offset, data);
+    Put(data, num_valid_values);
+  }
+
+ private:
+  void FlushBlock();
+
+  arrow::BufferBuilder sink_;
+  ArrowPoolVector<T> deltas_;
+  std::shared_ptr<ResizableBuffer> block_buffer_;
+  uint32_t values_current_block_ = 0;
+  uint32_t total_value_count_ = 0;
+  T first_value_ = 0;
+  T current_value_ = 0;
+};
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const T* src, int num_values) {
+  for (int i = 0; i < num_values; ++i) {
+    const T value = src[i];
+    if (ARROW_PREDICT_FALSE(total_value_count_ == 0)) {
+      first_value_ = value;
+    } else {
+      // Deltas wrap around on overflow, as does their sum when decoding
+      deltas_[values_current_block_++] =
+          static_cast<T>(static_cast<UT>(value) - static_cast<UT>(current_value_));
+      if (values_current_block_ == kValuesPerBlock) {
+        FlushBlock();
+      }
+    }
+    current_value_ = value;
+    ++total_value_count_;
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const ::arrow::Array& values) {
+  if (values.type_id() != EncodingTraits<DType>::ArrowType::type_id) {
+    throw ParquetException(std::string("Expected ") +
+                           EncodingTraits<DType>::ArrowType::type_name() +
+                           " array, got " + values.type()->ToString());
+  }
+  const ::arrow::ArrayData& data = *values.data();
+  if (values.null_count() == 0) {
+    Put(data.GetValues<T>(1), static_cast<int>(data.length));
+  } else {
+    PutSpaced(data.GetValues<T>(1), static_cast<int>(data.length),
+              data.GetValues<uint8_t>(0, 0), data.offset);
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::FlushBlock() {
+  const T min_delta =
+      *std::min_element(deltas_.begin(), deltas_.begin() + values_current_block_);
+  arrow::BitUtil::BitWriter writer(block_buffer_->mutable_data(), kMaxBlockBytes);
+  writer.PutZigZagVlqInt(min_delta);
+  uint8_t* bit_widths = writer.GetNextBytePtr(kMiniBlocksPerBlock);
+
+  for (uint32_t i = 0; i < kMiniBlocksPerBlock; ++i) {
+    const uint32_t start = i * kValuesPerMiniBlock;
+    if (start >= values_current_block_) {
+      // The bit widths of the mini blocks a partial block doesn't need are written,
+      // but not their (empty) bodies
+      bit_widths[i] = 0;
+      continue;
+    }
+    const uint32_t end = std::min(start + kValuesPerMiniBlock, values_current_block_);
+    UT max_delta = 0;
+    for (uint32_t j = start; j < end; ++j) {
+      max_delta = std::max(max_delta, static_cast<UT>(static_cast<UT>(deltas_[j]) -
+                                                      static_cast<UT>(min_delta)));
+    }
+    const int bit_width = arrow::BitUtil::NumRequiredBits(max_delta);
+    bit_widths[i] = static_cast<uint8_t>(bit_width);
+    if (bit_width == 0) continue;
+    for (uint32_t j = start; j < end; ++j) {
+      writer.PutValue(static_cast<UT>(deltas_[j]) - static_cast<UT>(min_delta),
+                      bit_width);
+    }
+    // A partial mini block is padded to its full size
+    for (uint32_t j = end; j < start + kValuesPerMiniBlock; ++j) {
+      writer.PutValue(0, bit_width);
+    }
+  }
+  writer.Flush();
+  PARQUET_THROW_NOT_OK(sink_.Append(block_buffer_->data(), writer.bytes_written()));
+  values_current_block_ = 0;
+}
+
+template <typename DType>
+std::shared_ptr<Buffer> DeltaBitPackEncoder<DType>::FlushValues() {
+  if (values_current_block_ > 0) {
+    FlushBlock();
+  }
+  uint8_t header[kMaxHeaderBytes];
+  arrow::BitUtil::BitWriter header_writer(header, kMaxHeaderBytes);
+  header_writer.PutVlqInt(kValuesPerBlock);
+  header_writer.PutVlqInt(kMiniBlocksPerBlock);
+  header_writer.PutVlqInt(total_value_count_);
+  header_writer.PutZigZagVlqInt(first_value_);
+  header_writer.Flush();
+
+  const int header_length = header_writer.bytes_written();
+  std::shared_ptr<ResizableBuffer> buffer =
+      AllocateBuffer(this->memory_pool(), header_length + sink_.length());
+  memcpy(buffer->mutable_data(), header, header_length);
+  if (sink_.length() > 0) {
+    memcpy(buffer->mutable_data() + header_length, sink_.data(), sink_.length());
+  }
+
+  sink_.Reset();
+  total_value_count_ = 0;
+  first_value_ = current_value_ = 0;
+  return std::move(buffer);
+}
+
+// ----------------------------------------------------------------------
+// DeltaLengthByteArrayEncoder
+
+/// DELTA_LENGTH_BYTE_ARRAY: the DELTA_BINARY_PACKED lengths of the values, followed by
+/// their concatenated bytes
+class DeltaLengthByteArrayEncoder : public EncoderImpl,
+                                    virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaLengthByteArrayEncoder(const ColumnDescriptor* descr,
+                                       MemoryPool* pool = arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY, pool),
+        sink_(pool),
+        length_encoder_(nullptr, pool),
+        lengths_(::arrow::stl::allocator<int32_t>(pool)) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return sink_.length() + length_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> encoded_lengths = length_encoder_.FlushValues();
+    std::shared_ptr<ResizableBuffer> buffer =
+        AllocateBuffer(this->memory_pool(), encoded_lengths->size() + sink_.length());
+    memcpy(buffer->mutable_data(), encoded_lengths->data(), encoded_lengths->size());
+    if (sink_.length() > 0) {
+      memcpy(buffer->mutable_data() + encoded_lengths->size(), sink_.data(),
+             sink_.length());
+    }
+    sink_.Reset();
+    return std::move(buffer);
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    lengths_.resize(num_values);
+    int64_t total_length = 0;
+    for (int i = 0; i < num_values; ++i) {
+      lengths_[i] = static_cast<int32_t>(src[i].len);
+      total_length += src[i].len;
+    }
+    length_encoder_.Put(lengths_.data(), num_values);
+    PARQUET_THROW_NOT_OK(sink_.Reserve(total_length));
+    for (int i = 0; i < num_values; ++i) {
+      sink_.UnsafeAppend(src[i].ptr, src[i].len);
+    }
+  }
+
+  void Put(const ::arrow::Array& values) override {
+    AssertBinary(values);
+    const auto& data = checked_cast<const arrow::BinaryArray&>(values);
+    lengths_.clear();
+    for (int64_t i = 0; i < data.length(); i++) {
+      if (data.IsValid(i)) {
+        lengths_.push_back(data.value_length(i));
+      }
+    }
+    length_encoder_.Put(lengths_.data(), static_cast<int>(lengths_.size()));
+    PARQUET_THROW_NOT_OK(
+        sink_.Reserve(data.value_offset(data.length()) - data.value_offset(0)));
+    for (int64_t i = 0; i < data.length(); i++) {
+      if (data.IsValid(i)) {
+        auto view = data.GetView(i);
+        sink_.UnsafeAppend(view.data(), static_cast<int64_t>(view.size()));
+      }
+    }
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    PARQUET_ASSIGN_OR_THROW(auto buffer, arrow::AllocateBuffer(num_values * sizeof(ByteArray),
+                                                               this->memory_pool()));
+    ByteArray* data = reinterpret_cast<ByteArray*>(buffer->mutable_data());
+    int num_valid_values = arrow::util::internal::SpacedCompress<ByteArray>(
+        src, num_values, valid_bits, valid_bits_offset, data);
+    Put(data, num_valid_values);
+  }
+
+ private:
+  arrow::BufferBuilder sink_;
+  DeltaBitPackEncoder<Int32Type> length_encoder_;
+  // Scratch space for the lengths of a batch of values
+  ArrowPoolVector<int32_t> lengths_;
+};
+
+// ----------------------------------------------------------------------
+// DeltaByteArrayEncoder
+
+/// DELTA_BYTE_ARRAY: the DELTA_BINARY_PACKED lengths of the prefixes each value shares
+/// with the previous one, followed by the DELTA_LENGTH_BYTE_ARRAY remaining suffixes
+class DeltaByteArrayEncoder : public EncoderImpl,
+                              virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaByteArrayEncoder(const ColumnDescriptor* descr,
+                                 MemoryPool* pool = arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BYTE_ARRAY, pool),
+        prefix_length_encoder_(nullptr, pool),
+        suffix_encoder_(nullptr, pool),
+        prefix_lengths_(::arrow::stl::allocator<int32_t>(pool)),
+        suffixes_(::arrow::stl::allocator<ByteArray>(pool)) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return prefix_length_encoder_.EstimatedDataEncodedSize() +
+           suffix_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> prefix_lengths = prefix_length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> suffixes = suffix_encoder_.FlushValues();
+    std::shared_ptr<ResizableBuffer> buffer =
+        AllocateBuffer(this->memory_pool(), prefix_lengths->size() + suffixes->size());
+    memcpy(buffer->mutable_data(), prefix_lengths->data(), prefix_lengths->size());
+    memcpy(buffer->mutable_data() + prefix_lengths->size(), suffixes->data(),
+           suffixes->size());
+    // Each page is decoded on its own
+    last_value_.clear();
+    return std::move(buffer);
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    if (num_values == 0) return;
+    prefix_lengths_.resize(num_values);
+    suffixes_.resize(num_values);
+    ByteArray previous(static_cast<uint32_t>(last_value_.size()),
+                       reinterpret_cast<const uint8_t*>(last_value_.data()));
+    for (int i = 0; i < num_values; ++i) {
+      const uint32_t max_prefix_length = std::min(src[i].len, previous.len);
+      uint32_t prefix_length = 0;
+      while (prefix_length < max_prefix_length &&
+             previous.ptr[prefix_length] == src[i].ptr[prefix_length]) {
+        ++prefix_length;
+      }
+      prefix_lengths_[i] = static_cast<int32_t>(prefix_length);
+      suffixes_[i] = ByteArray(src[i].len - prefix_length, src[i].ptr + prefix_length);
+      previous = src[i];
+    }
+    prefix_length_encoder_.Put(prefix_lengths_.data(), num_values);
+    suffix_encoder_.Put(suffixes_.data(), num_values);
+    last_value_.assign(reinterpret_cast<const char*>(previous.ptr), previous.len);
+  }
+
+  void Put(const ::arrow::Array& values) override {
+    AssertBinary(values);
+    const auto& data = checked_cast<const arrow::BinaryArray&>(values);
+    ArrowPoolVector<ByteArray> valid_values(
+        ::arrow::stl::allocator<ByteArray>(this->memory_pool()));
+    valid_values.reserve(data.length() - data.null_count());
+    for (int64_t i = 0; i < data.length(); i++) {
+      if (data.IsValid(i)) {
+        auto view = data.GetView(i);
+        valid_values.emplace_back(static_cast<uint32_t>(view.size()),
+                                  reinterpret_cast<const uint8_t*>(view.data()));
+      }
+    }
+    Put(valid_values.data(), static_cast<int>(valid_values.size()));
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    PARQUET_ASSIGN_OR_THROW(auto buffer, arrow::AllocateBuffer(num_values * sizeof(ByteArray),
+                                                               this->memory_pool()));
+    ByteArray* data = reinterpret_cast<ByteArray*>(buffer->mutable_data());
+    int num_valid_values = arrow::util::internal::SpacedCompress<ByteArray>(
+        src, num_values, valid_bits, valid_bits_offset, data);
+    Put(data, num_valid_values);
+  }
+
+ private:
+  DeltaBitPackEncoder<Int32Type> prefix_length_encoder_;
+  DeltaLengthByteArrayEncoder suffix_encoder_;
+  // Copy of the last value written, which may not outlive the call
+  std::string last_value_;
+  // Scratch space for a batch of values
+  ArrowPoolVector<int32_t> prefix_lengths_;
+  ArrowPoolVector<ByteArray> suffixes_;
+};
+
 class DecoderImpl : virtual public Decoder {
  public:
   void SetData(int num_values, const uint8_t* data, int len) override {
@@ -1996,26 +2424,86 @@ class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
 // ----------------------------------------------------------------------
 // DeltaBitPackDecoder
 
+// Turn the deltas of a mini block, relative to min_delta, into the values following
+// last_value. The sums wrap around on overflow, like the deltas did when encoding.
+inline void DeltaPrefixSum(uint32_t min_delta, uint32_t last_value, uint32_t* values,
+                           int num_values) {
+  int i = 0;
+#if defined(ARROW_HAVE_SSE4_2)
+  // Scan 4 values at a time in a register, then add the last value of the previous 4
+  const __m128i min_deltas = _mm_set1_epi32(static_cast<int32_t>(min_delta));
+  __m128i last_values = _mm_set1_epi32(static_cast<int32_t>(last_value));
+  for (; i + 4 <= num_values; i += 4) {
+    auto out = reinterpret_cast<__m128i*>(values + i);
+    __m128i sums = _mm_add_epi32(_mm_loadu_si128(out), min_deltas);
+    sums = _mm_add_epi32(sums, _mm_slli_si128(sums, 4));
+    sums = _mm_add_epi32(sums, _mm_slli_si128(sums, 8));
+    sums = _mm_add_epi32(sums, last_values);
+    _mm_storeu_si128(out, sums);
+    last_values = _mm_shuffle_epi32(sums, 0xFF);
+  }
+  if (i > 0) last_value = values[i - 1];
+#endif
+  for (; i < num_values; ++i) {
+    last_value += min_delta + values[i];
+    values[i] = last_value;
+  }
+}
+
+inline void DeltaPrefixSum(uint64_t min_delta, uint64_t last_value, uint64_t* values,
+                           int num_values) {
+  int i = 0;
+#if defined(ARROW_HAVE_SSE4_2)
+  const __m128i min_deltas = _mm_set1_epi64x(static_cast<int64_t>(min_delta));
+  __m128i last_values = _mm_set1_epi64x(static_cast<int64_t>(last_value));
+  for (; i + 2 <= num_values; i += 2) {
+    auto out = reinterpret_cast<__m128i*>(values + i);
+    __m128i sums = _mm_add_epi64(_mm_loadu_si128(out), min_deltas);
+    sums = _mm_add_epi64(sums, _mm_slli_si128(sums, 8));
+    sums = _mm_add_epi64(sums, last_values);
+    _mm_storeu_si128(out, sums);
+    last_values = _mm_unpackhi_epi64(sums, sums);
+  }
+  if (i > 0) last_value = values[i - 1];
+#endif
+  for (; i < num_values; ++i) {
+    last_value += min_delta + values[i];
+    values[i] = last_value;
+  }
+}
+
 template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
  public:
   typedef typename DType::c_type T;
+  using UT = typename std::make_unsigned<T>::type;
 
   explicit DeltaBitPackDecoder(const ColumnDescriptor* descr,
                                MemoryPool* pool = arrow::default_memory_pool())
-      : DecoderImpl(descr, Encoding::DELTA_BINARY_PACKED), pool_(pool) {
+      : DecoderImpl(descr, Encoding::DELTA_BINARY_PACKED),
+        pool_(pool),
+        delta_bit_widths_(AllocateBuffer(pool, 0)) {
     if (DType::type_num != Type::INT32 && DType::type_num != Type::INT64) {
       throw ParquetException("Delta bit pack encoding should only be for integer data.");
     }
   }
 
   void SetData(int num_values, const uint8_t* data, int len) override {
-    this->num_values_ = num_values;
     decoder_ = arrow::BitUtil::BitReader(data, len);
-    values_current_block_ = 0;
-    values_current_mini_block_ = 0;
+    total_values_remaining_ = 0;
+    if (len > 0) {
+      InitHeader();
+    }
+    // The number of encoded values is given by the header, without the nulls
+    this->num_values_ = static_cast<int>(total_values_remaining_);
   }
 
+  /// \brief The number of values which remain to be decoded
+  int ValidValuesCount() const { return static_cast<int>(total_values_remaining_); }
+
+  /// \brief The number of bytes after the encoded values, once they were all decoded
+  int bytes_left() { return decoder_.bytes_left(); }
+
   int Decode(T* buffer, int max_values) override {
     return GetInternal(buffer, max_values);
   }
@@ -2023,100 +2511,208 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::Accumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
+    const int values_decoded = num_values - null_count;
+    std::vector<T> values(values_decoded);
+    if (GetInternal(values.data(), values_decoded) != values_decoded) {
+      ParquetException::EofException();
     }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
-    PARQUET_THROW_NOT_OK(out->AppendValues(values));
-    return num_values;
+    PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+    auto value = values.begin();
+    VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count,
+        [&]() { out->UnsafeAppend(*value++); }, [&]() { out->UnsafeAppendNull(); });
+    return values_decoded;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::DictAccumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
+    const int values_decoded = num_values - null_count;
+    std::vector<T> values(values_decoded);
+    if (GetInternal(values.data(), values_decoded) != values_decoded) {
+      ParquetException::EofException();
     }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
     PARQUET_THROW_NOT_OK(out->Reserve(num_values));
-    for (T value : values) {
-      PARQUET_THROW_NOT_OK(out->Append(value));
-    }
-    return num_values;
+    auto value = values.begin();
+    VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count,
+        [&]() { PARQUET_THROW_NOT_OK(out->Append(*value++)); },
+        [&]() { PARQUET_THROW_NOT_OK(out->AppendNull()); });
+    return values_decoded;
   }
 
  private:
-  void InitBlock() {
-    // The number of values per block.
-    uint32_t block_size;
-    if (!decoder_.GetVlqInt(&block_size)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&num_mini_blocks_)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&values_current_block_)) {
+  void InitHeader() {
+    if (!decoder_.GetVlqInt(&values_per_block_) ||
+        !decoder_.GetVlqInt(&mini_blocks_per_block_) ||
+        !decoder_.GetVlqInt(&total_values_remaining_) ||
+        !decoder_.GetZigZagVlqInt(&last_value_)) {
       ParquetException::EofException();
     }
-    if (!decoder_.GetZigZagVlqInt(&last_value_)) ParquetException::EofException();
-
-    delta_bit_widths_ = AllocateBuffer(pool_, num_mini_blocks_);
-    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+    if (values_per_block_ == 0 || values_per_block_ % 128 != 0) {
+      throw ParquetException("Delta bit pack block size must be a multiple of 128");
+    }
+    if (mini_blocks_per_block_ == 0 ||
+        values_per_block_ % mini_blocks_per_block_ != 0 ||
+        (values_per_block_ / mini_blocks_per_block_) % 32 != 0) {
+      throw ParquetException("Delta bit pack mini block size must be a multiple of 32");
+    }
+    values_per_mini_block_ = values_per_block_ / mini_blocks_per_block_;
+    PARQUET_THROW_NOT_OK(delta_bit_widths_->Resize(mini_blocks_per_block_, false));
+    first_value_read_ = false;
+    // The next delta starts a block
+    mini_block_idx_ = mini_blocks_per_block_;
+    values_current_mini_block_ = 0;
+  }
 
+  void InitBlock() {
     if (!decoder_.GetZigZagVlqInt(&min_delta_)) ParquetException::EofException();
-    for (uint32_t i = 0; i < num_mini_blocks_; ++i) {
+    // The bit widths of the mini blocks a partial last block doesn't need may be
+    // arbitrary, so they are only checked when their mini block is read
+    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+    for (uint32_t i = 0; i < mini_blocks_per_block_; ++i) {
       if (!decoder_.GetAligned<uint8_t>(1, bit_width_data + i)) {
         ParquetException::EofException();
       }
     }
-    values_per_mini_block_ = block_size / num_mini_blocks_;
     mini_block_idx_ = 0;
-    delta_bit_width_ = bit_width_data[0];
+  }
+
+  void InitMiniBlock() {
+    delta_bit_width_ = delta_bit_widths_->data()[mini_block_idx_];
+    if (ARROW_PREDICT_FALSE(delta_bit_width_ > static_cast<int>(sizeof(T) * 8))) {
+      throw ParquetException("Delta bit width larger than integer bit width");
+    }
     values_current_mini_block_ = values_per_mini_block_;
   }
 
-  template <typename T>
   int GetInternal(T* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    const uint8_t* bit_width_data = delta_bit_widths_->data();
-    for (int i = 0; i < max_values; ++i) {
+    max_values =
+        static_cast<int>(std::min<uint64_t>(max_values, total_values_remaining_));
+    if (max_values == 0) return 0;
+
+    int i = 0;
+    if (ARROW_PREDICT_FALSE(!first_value_read_)) {
+      // The first value is stored in the header
+      buffer[i++] = last_value_;
+      first_value_read_ = true;
+    }
+    while (i < max_values) {
       if (ARROW_PREDICT_FALSE(values_current_mini_block_ == 0)) {
-        ++mini_block_idx_;
-        if (mini_block_idx_ < static_cast<size_t>(delta_bit_widths_->size())) {
-          delta_bit_width_ = bit_width_data[mini_block_idx_];
-          values_current_mini_block_ = values_per_mini_block_;
-        } else {
+        if (ARROW_PREDICT_FALSE(mini_block_idx_ + 1 >= mini_blocks_per_block_)) {
           InitBlock();
-          buffer[i] = last_value_;
-          continue;
+        } else {
+          ++mini_block_idx_;
         }
+        InitMiniBlock();
       }
 
-      // TODO: the key to this algorithm is to decode the entire miniblock at once.
-      int64_t delta;
-      if (!decoder_.GetValue(delta_bit_width_, &delta)) ParquetException::EofException();
-      delta += min_delta_;
-      last_value_ += static_cast<int32_t>(delta);
-      buffer[i] = last_value_;
-      --values_current_mini_block_;
+      // Unpack the packed deltas of the mini block together, then add them up
+      const int values_decode =
+          static_cast<int>(std::min<uint64_t>(values_current_mini_block_, max_values - i));
+      if (decoder_.GetBatch(delta_bit_width_, buffer + i, values_decode) !=
+          values_decode) {
+        ParquetException::EofException();
+      }
+      DeltaPrefixSum(static_cast<UT>(min_delta_), static_cast<UT>(last_value_),
+                     reinterpret_cast<UT*>(buffer + i), values_decode);
+      last_value_ = buffer[i + values_decode - 1];
+      values_current_mini_block_ -= values_decode;
+      i += values_decode;
     }
+
+    total_values_remaining_ -= max_values;
     this->num_values_ -= max_values;
+    if (total_values_remaining_ == 0) {
+      // Skip the padding of the last mini block so that the data following the
+      // encoded values can be found
+      UT padding;
+      for (; values_current_mini_block_ > 0; --values_current_mini_block_) {
+        if (!decoder_.GetValue(delta_bit_width_, &padding)) break;
+      }
+    }
     return max_values;
   }
 
   MemoryPool* pool_;
   arrow::BitUtil::BitReader decoder_;
-  uint32_t values_current_block_;
-  uint32_t num_mini_blocks_;
-  uint64_t values_per_mini_block_;
-  uint64_t values_current_mini_block_;
-
-  int32_t min_delta_;
-  size_t mini_block_idx_;
+  uint32_t values_per_block_;
+  uint32_t mini_blocks_per_block_;
+  uint32_t values_per_mini_block_;
+  uint32_t values_current_mini_block_;
+  uint32_t total_values_remaining_ = 0;
+
+  T min_delta_;
+  uint32_t mini_block_idx_;
   std::shared_ptr<ResizableBuffer> delta_bit_widths_;
   int delta_bit_width_;
 
-  int32_t last_value_;
+  bool first_value_read_;
+  T last_value_;
 };
 
+// Decode the non-null values of a batch of BYTE_ARRAY values with `decoder`, then
+// append them to `out` along with the nulls
+int DecodeByteArraysToArrow(TypedDecoder<ByteArrayType>* decoder, MemoryPool* pool,
+                            int num_values, int null_count, const uint8_t* valid_bits,
+                            int64_t valid_bits_offset,
+                            typename EncodingTraits<ByteArrayType>::Accumulator* out) {
+  const int values_decoded = num_values - null_count;
+  ArrowPoolVector<ByteArray> values(values_decoded, ByteArray(),
+                                    ::arrow::stl::allocator<ByteArray>(pool));
+  if (decoder->Decode(values.data(), values_decoded) != values_decoded) {
+    ParquetException::EofException();
+  }
+
+  ArrowBinaryHelper helper(out);
+  PARQUET_THROW_NOT_OK(helper.builder->Reserve(num_values));
+  int i = 0;
+  auto value = values.begin();
+  PARQUET_THROW_NOT_OK(VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count,
+      [&]() {
+        if (ARROW_PREDICT_FALSE(!helper.CanFit(value->len))) {
+          // This element would exceed the capacity of a chunk
+          RETURN_NOT_OK(helper.PushChunk());
+          RETURN_NOT_OK(helper.builder->Reserve(num_values - i));
+        }
+        RETURN_NOT_OK(helper.Append(value->ptr, static_cast<int32_t>(value->len)));
+        ++value;
+        ++i;
+        return Status::OK();
+      },
+      [&]() {
+        helper.UnsafeAppendNull();
+        ++i;
+        return Status::OK();
+      }));
+  return values_decoded;
+}
+
+int DecodeByteArraysToArrow(TypedDecoder<ByteArrayType>* decoder, MemoryPool* pool,
+                            int num_values, int null_count, const uint8_t* valid_bits,
+                            int64_t valid_bits_offset,
+                            typename EncodingTraits<ByteArrayType>::DictAccumulator* out) {
+  const int values_decoded = num_values - null_count;
+  ArrowPoolVector<ByteArray> values(values_decoded, ByteArray(),
+                                    ::arrow::stl::allocator<ByteArray>(pool));
+  if (decoder->Decode(values.data(), values_decoded) != values_decoded) {
+    ParquetException::EofException();
+  }
+
+  PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+  auto value = values.begin();
+  PARQUET_THROW_NOT_OK(VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count,
+      [&]() {
+        RETURN_NOT_OK(out->Append(value->ptr, static_cast<int32_t>(value->len)));
+        ++value;
+        return Status::OK();
+      },
+      [&]() { return out->AppendNull(); }));
+  return values_decoded;
+}
+
 // ----------------------------------------------------------------------
 // DELTA_LENGTH_BYTE_ARRAY
 
@@ -2127,47 +2723,67 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
                                        MemoryPool* pool = arrow::default_memory_pool())
       : DecoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY),
         len_decoder_(nullptr, pool),
+        buffered_length_(AllocateBuffer(pool, 0)),
         pool_(pool) {}
 
   void SetData(int num_values, const uint8_t* data, int len) override {
-    num_values_ = num_values;
-    if (len == 0) return;
-    int total_lengths_len = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    this->len_decoder_.SetData(num_values, data, total_lengths_len);
-    data_ = data + total_lengths_len;
-    this->len_ = len - 4 - total_lengths_len;
+    // The encoded lengths are followed by the concatenated values
+    len_decoder_.SetData(num_values, data, len);
+    num_values_ = len_decoder_.ValidValuesCount();
+    PARQUET_THROW_NOT_OK(buffered_length_->Resize(num_values_ * sizeof(int32_t), false));
+    int32_t* lengths = reinterpret_cast<int32_t*>(buffered_length_->mutable_data());
+    if (len_decoder_.Decode(lengths, num_values_) != num_values_) {
+      ParquetException::EofException();
+    }
+    length_idx_ = 0;
+    len_ = len > 0 ? len_decoder_.bytes_left() : 0;
+    data_ = data + (len - len_);
   }
 
   int Decode(ByteArray* buffer, int max_values) override {
-    using VectorT = ArrowPoolVector<int>;
     max_values = std::min(max_values, num_values_);
-    VectorT lengths(max_values, 0, ::arrow::stl::allocator<int>(pool_));
-    len_decoder_.Decode(lengths.data(), max_values);
+    const int32_t* lengths =
+        reinterpret_cast<const int32_t*>(buffered_length_->data()) + length_idx_;
+    int64_t data_size = 0;
+    for (int i = 0; i < max_values; ++i) {
+      if (ARROW_PREDICT_FALSE(lengths[i] < 0)) {
+        throw ParquetException("Negative DELTA_LENGTH_BYTE_ARRAY length");
+      }
+      data_size += lengths[i];
+    }
+    if (ARROW_PREDICT_FALSE(data_size > len_)) {
+      ParquetException::EofException();
+    }
     for (int i = 0; i < max_values; ++i) {
       buffer[i].len = lengths[i];
       buffer[i].ptr = data_;
-      this->data_ += lengths[i];
-      this->len_ -= lengths[i];
+      data_ += lengths[i];
     }
-    this->num_values_ -= max_values;
+    len_ -= static_cast<int>(data_size);
+    length_idx_ += max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeByteArraysToArrow(this, pool_, num_values, null_count, valid_bits,
+                                   valid_bits_offset, out);
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeByteArraysToArrow(this, pool_, num_values, null_count, valid_bits,
+                                   valid_bits_offset, out);
   }
 
  private:
   DeltaBitPackDecoder<Int32Type> len_decoder_;
+  // The lengths of the values of the page
+  std::shared_ptr<ResizableBuffer> buffered_length_;
+  int length_idx_ = 0;
   ::arrow::MemoryPool* pool_;
 };
 
@@ -2182,46 +2798,100 @@ class DeltaByteArrayDecoder : public DecoderImpl,
       : DecoderImpl(descr, Encoding::DELTA_BYTE_ARRAY),
         prefix_len_decoder_(nullptr, pool),
         suffix_decoder_(nullptr, pool),
-        last_value_(0, nullptr) {}
+        buffered_prefix_length_(AllocateBuffer(pool, 0)),
+        buffered_data_(AllocateBuffer(pool, 0)),
+        pool_(pool) {}
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
-    num_values_ = num_values;
-    if (len == 0) return;
-    int prefix_len_length = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    len -= 4;
-    prefix_len_decoder_.SetData(num_values, data, prefix_len_length);
-    data += prefix_len_length;
-    len -= prefix_len_length;
-    suffix_decoder_.SetData(num_values, data, len);
-  }
-
-  // TODO: this doesn't work and requires memory management. We need to allocate
-  // new strings to store the results.
-  virtual int Decode(ByteArray* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    for (int i = 0; i < max_values; ++i) {
-      int prefix_len = 0;
-      prefix_len_decoder_.Decode(&prefix_len, 1);
-      ByteArray suffix = {0, nullptr};
-      suffix_decoder_.Decode(&suffix, 1);
-      buffer[i].len = prefix_len + suffix.len;
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    // The encoded prefix lengths are followed by the DELTA_LENGTH_BYTE_ARRAY suffixes
+    prefix_len_decoder_.SetData(num_values, data, len);
+    num_values_ = prefix_len_decoder_.ValidValuesCount();
+    PARQUET_THROW_NOT_OK(
+        buffered_prefix_length_->Resize(num_values_ * sizeof(int32_t), false));
+    int32_t* prefix_lengths =
+        reinterpret_cast<int32_t*>(buffered_prefix_length_->mutable_data());
+    if (prefix_len_decoder_.Decode(prefix_lengths, num_values_) != num_values_) {
+      ParquetException::EofException();
+    }
+    prefix_len_idx_ = 0;
+    const int suffixes_len = len > 0 ? prefix_len_decoder_.bytes_left() : 0;
+    suffix_decoder_.SetData(num_values_, data + (len - suffixes_len), suffixes_len);
+    last_value_.clear();
+  }
 
-      uint8_t* result = reinterpret_cast<uint8_t*>(malloc(buffer[i].len));
-      memcpy(result, last_value_.ptr, prefix_len);
-      memcpy(result + prefix_len, suffix.ptr, suffix.len);
+  /// The values returned remain valid until the next call to Decode
+  int Decode(ByteArray* buffer, int max_values) override {
+    max_values = std::min(max_values, num_values_);
+    if (suffix_decoder_.Decode(buffer, max_values) != max_values) {
+      ParquetException::EofException();
+    }
+    const int32_t* prefix_lengths =
+        reinterpret_cast<const int32_t*>(buffered_prefix_length_->data()) +
+        prefix_len_idx_;
+    int64_t data_size = 0;
+    for (int i = 0; i < max_values; ++i) {
+      if (ARROW_PREDICT_FALSE(prefix_lengths[i] < 0)) {
+        throw ParquetException("Negative DELTA_BYTE_ARRAY prefix length");
+      }
+      data_size += prefix_lengths[i] + buffer[i].len;
+    }
+    PARQUET_THROW_NOT_OK(buffered_data_->Resize(data_size, false));
 
-      buffer[i].ptr = result;
-      last_value_ = buffer[i];
+    // Each value starts with a prefix of the previous one
+    const uint8_t* previous = reinterpret_cast<const uint8_t*>(last_value_.data());
+    int64_t previous_len = static_cast<int64_t>(last_value_.size());
+    uint8_t* data = buffered_data_->mutable_data();
+    for (int i = 0; i < max_values; ++i) {
+      const int32_t prefix_length = prefix_lengths[i];
+      if (ARROW_PREDICT_FALSE(prefix_length > previous_len)) {
+        throw ParquetException("DELTA_BYTE_ARRAY prefix longer than the previous value");
+      }
+      if (prefix_length > 0) {
+        memcpy(data, previous, prefix_length);
+      }
+      if (buffer[i].len > 0) {
+        memcpy(data + prefix_length, buffer[i].ptr, buffer[i].len);
+      }
+      buffer[i].ptr = data;
+      buffer[i].len += prefix_length;
+      previous = data;
+      previous_len = buffer[i].len;
+      data += buffer[i].len;
     }
-    this->num_values_ -= max_values;
+    if (max_values > 0) {
+      last_value_.assign(reinterpret_cast<const char*>(previous),
+                         static_cast<size_t>(previous_len));
+    }
+    prefix_len_idx_ += max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
+    return DecodeByteArraysToArrow(this, pool_, num_values, null_count, valid_bits,
+                                   valid_bits_offset, out);
+  }
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
+    return DecodeByteArraysToArrow(this, pool_, num_values, null_count, valid_bits,
+                                   valid_bits_offset, out);
+  }
+
  private:
   DeltaBitPackDecoder<Int32Type> prefix_len_decoder_;
   DeltaLengthByteArrayDecoder suffix_decoder_;
-  ByteArray last_value_;
+  // The prefix lengths of the values of the page
+  std::shared_ptr<ResizableBuffer> buffered_prefix_length_;
+  int prefix_len_idx_ = 0;
+  // The values returned by the last call to Decode
+  std::shared_ptr<ResizableBuffer> buffered_data_;
+  // Copy of the last value decoded, the prefix source of the next call to Decode
+  std::string last_value_;
+  ::arrow::MemoryPool* pool_;
 };
 
 // ----------------------------------------------------------------------
@@ -2303,7 +2973,7 @@ int ByteStreamSplitDecoder<DType>::DecodeArrow(
   const uint8_t* data = data_ + num_decoded_previously;
   int offset = 0;
 
-#if defined(ARROW_HAVE_SIMD_SPLIT)
+#if defined(ARROW_HAVE_SIMD_SPLIT) || defined(ARROW_HAVE_RUNTIME_AVX2)
   // Use fast decoding into intermediate buffer.  This will also decode
   // some null values, but it's fast enough that we don't care.
   T* decode_out = EnsureDecodeBuffer(values_decoded);
@@ -2407,6 +3077,26 @@ std::unique_ptr<Encoder> MakeEncoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int32Type>(descr, pool));
+      case Type::INT64:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int64Type>(descr, pool));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaLengthByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -2447,6 +3137,26 @@ std::unique_ptr<Decoder> MakeDecoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int32Type>(descr));
+      case Type::INT64:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int64Type>(descr));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Decoder>(new DeltaLengthByteArrayDecoder(descr));
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Decoder>(new DeltaByteArrayDecoder(descr));
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -245,6 +245,22 @@ class DictEncoder : virtual public TypedEncoder<DType> {
   /// \param[in] values the dictionary values. Only valid for certain
   /// Parquet/Arrow type combinations, like BYTE_ARRAY/BinaryArray
   virtual void PutDictionary(const ::arrow::Array& values) = 0;
+
+  /// \brief EXPERIMENTAL: Append the values of a dictionary missing from the
+  /// encoder's dictionary to it. Unlike PutDictionary, the encoder's dictionary may
+  /// be non-empty and the values may have duplicates
+  /// \param[in] values the dictionary values, which must not be null. Only valid
+  /// for the Parquet/Arrow type combinations of PutDictionary
+  /// \param[out] transpose_map the index in the encoder's dictionary of each value,
+  /// to pass to PutTransposedIndices
+  virtual void MergeDictionary(const ::arrow::Array& values,
+                               std::vector<int32_t>* transpose_map) = 0;
+
+  /// \brief EXPERIMENTAL: Append dictionary indices into the encoder, as
+  /// PutIndices, after mapping them through a transpose map returned by
+  /// MergeDictionary
+  virtual void PutTransposedIndices(const ::arrow::Array& indices,
+                                    const int32_t* transpose_map) = 0;
 };
 
 // ----------------------------------------------------------------------
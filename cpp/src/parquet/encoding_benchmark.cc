@@ -25,6 +25,7 @@
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/util/byte_stream_split.h"
+#include "arrow/util/cpu_info.h"
 
 #include "parquet/encoding.h"
 #include "parquet/platform.h"
@@ -117,6 +118,70 @@ static void BM_PlainDecodingInt64(benchmark::State& state) {
 
 BENCHMARK(BM_PlainDecodingInt64)->Range(MIN_RANGE, MAX_RANGE);
 
+// Timestamp-like values: increasing with small, irregular deltas
+template <typename T>
+static std::vector<T> MakeDeltaBitPackValues(int64_t length) {
+  std::vector<T> values(length);
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int> d(0, 1000);
+  T value = 1000000;
+  for (auto& v : values) {
+    value += static_cast<T>(d(gen));
+    v = value;
+  }
+  return values;
+}
+
+template <typename ParquetType>
+static void BM_DeltaBitPackEncoding(benchmark::State& state) {
+  using T = typename ParquetType::c_type;
+  std::vector<T> values = MakeDeltaBitPackValues<T>(state.range(0));
+  auto encoder = MakeTypedEncoder<ParquetType>(Encoding::DELTA_BINARY_PACKED);
+  for (auto _ : state) {
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    encoder->FlushValues();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename ParquetType>
+static void BM_DeltaBitPackDecoding(benchmark::State& state) {
+  using T = typename ParquetType::c_type;
+  std::vector<T> values = MakeDeltaBitPackValues<T>(state.range(0));
+  auto encoder = MakeTypedEncoder<ParquetType>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> buf = encoder->FlushValues();
+
+  for (auto _ : state) {
+    auto decoder = MakeTypedDecoder<ParquetType>(Encoding::DELTA_BINARY_PACKED);
+    decoder->SetData(static_cast<int>(values.size()), buf->data(),
+                     static_cast<int>(buf->size()));
+    decoder->Decode(values.data(), static_cast<int>(values.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+static void BM_DeltaBitPackEncodingInt32(benchmark::State& state) {
+  BM_DeltaBitPackEncoding<Int32Type>(state);
+}
+
+static void BM_DeltaBitPackEncodingInt64(benchmark::State& state) {
+  BM_DeltaBitPackEncoding<Int64Type>(state);
+}
+
+static void BM_DeltaBitPackDecodingInt32(benchmark::State& state) {
+  BM_DeltaBitPackDecoding<Int32Type>(state);
+}
+
+static void BM_DeltaBitPackDecodingInt64(benchmark::State& state) {
+  BM_DeltaBitPackDecoding<Int64Type>(state);
+}
+
+BENCHMARK(BM_DeltaBitPackEncodingInt32)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackEncodingInt64)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackDecodingInt32)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackDecodingInt64)->Range(MIN_RANGE, MAX_RANGE);
+
 static void BM_PlainEncodingDouble(benchmark::State& state) {
   std::vector<double> values(state.range(0), 64.0);
   auto encoder = MakeTypedEncoder<DoubleType>(Encoding::PLAIN);
@@ -398,25 +463,89 @@ BENCHMARK(BM_ByteStreamSplitEncode_Float_Sse2)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_ByteStreamSplitEncode_Double_Sse2)->Range(MIN_RANGE, MAX_RANGE);
 #endif
 
-#if defined(ARROW_HAVE_AVX2)
+static void BM_ByteStreamSplitDecode_Float_Dynamic(benchmark::State& state) {
+  BM_ByteStreamSplitDecode<float>(state,
+                                  arrow::util::internal::ByteStreamSplitDecode<float>);
+}
+
+static void BM_ByteStreamSplitDecode_Double_Dynamic(benchmark::State& state) {
+  BM_ByteStreamSplitDecode<double>(state,
+                                   arrow::util::internal::ByteStreamSplitDecode<double>);
+}
+
+static void BM_ByteStreamSplitEncode_Float_Dynamic(benchmark::State& state) {
+  BM_ByteStreamSplitEncode<float>(state,
+                                  arrow::util::internal::ByteStreamSplitEncode<float>);
+}
+
+static void BM_ByteStreamSplitEncode_Double_Dynamic(benchmark::State& state) {
+  BM_ByteStreamSplitEncode<double>(state,
+                                   arrow::util::internal::ByteStreamSplitEncode<double>);
+}
+
+BENCHMARK(BM_ByteStreamSplitDecode_Float_Dynamic)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_ByteStreamSplitDecode_Double_Dynamic)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_ByteStreamSplitEncode_Float_Dynamic)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_ByteStreamSplitEncode_Double_Dynamic)->Range(MIN_RANGE, MAX_RANGE);
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2) || defined(ARROW_HAVE_RUNTIME_AVX512)
+// The implementations selected at runtime take the width of the values
+using ByteStreamSplitDecodeWidthFunc = void (*)(const uint8_t*, int, int64_t, int64_t,
+                                                uint8_t*);
+using ByteStreamSplitEncodeWidthFunc = void (*)(const uint8_t*, int, const size_t,
+                                                uint8_t*);
+
+template <typename T>
+static void BM_ByteStreamSplitDecodeRuntime(benchmark::State& state, int64_t cpu_flags,
+                                            ByteStreamSplitDecodeWidthFunc decode_func) {
+  if (!::arrow::internal::CpuInfo::GetInstance()->IsSupported(cpu_flags)) {
+    state.SkipWithError("Instruction set not supported by the CPU");
+    return;
+  }
+  BM_ByteStreamSplitDecode<T>(
+      state, [&](const uint8_t* data, int64_t num_values, int64_t stride, T* out) {
+        decode_func(data, static_cast<int>(sizeof(T)), num_values, stride,
+                    reinterpret_cast<uint8_t*>(out));
+      });
+}
+
+template <typename T>
+static void BM_ByteStreamSplitEncodeRuntime(benchmark::State& state, int64_t cpu_flags,
+                                            ByteStreamSplitEncodeWidthFunc encode_func) {
+  if (!::arrow::internal::CpuInfo::GetInstance()->IsSupported(cpu_flags)) {
+    state.SkipWithError("Instruction set not supported by the CPU");
+    return;
+  }
+  BM_ByteStreamSplitEncode<T>(
+      state, [&](const uint8_t* raw_values, const size_t num_values, uint8_t* out) {
+        encode_func(raw_values, static_cast<int>(sizeof(T)), num_values, out);
+      });
+}
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
 static void BM_ByteStreamSplitDecode_Float_Avx2(benchmark::State& state) {
-  BM_ByteStreamSplitDecode<float>(
-      state, arrow::util::internal::ByteStreamSplitDecodeAvx2<float>);
+  BM_ByteStreamSplitDecodeRuntime<float>(
+      state, ::arrow::internal::CpuInfo::AVX2,
+      arrow::util::internal::avx2::ByteStreamSplitDecode);
 }
 
 static void BM_ByteStreamSplitDecode_Double_Avx2(benchmark::State& state) {
-  BM_ByteStreamSplitDecode<double>(
-      state, arrow::util::internal::ByteStreamSplitDecodeAvx2<double>);
+  BM_ByteStreamSplitDecodeRuntime<double>(
+      state, ::arrow::internal::CpuInfo::AVX2,
+      arrow::util::internal::avx2::ByteStreamSplitDecode);
 }
 
 static void BM_ByteStreamSplitEncode_Float_Avx2(benchmark::State& state) {
-  BM_ByteStreamSplitEncode<float>(
-      state, arrow::util::internal::ByteStreamSplitEncodeAvx2<float>);
+  BM_ByteStreamSplitEncodeRuntime<float>(
+      state, ::arrow::internal::CpuInfo::AVX2,
+      arrow::util::internal::avx2::ByteStreamSplitEncode);
 }
 
 static void BM_ByteStreamSplitEncode_Double_Avx2(benchmark::State& state) {
-  BM_ByteStreamSplitEncode<double>(
-      state, arrow::util::internal::ByteStreamSplitEncodeAvx2<double>);
+  BM_ByteStreamSplitEncodeRuntime<double>(
+      state, ::arrow::internal::CpuInfo::AVX2,
+      arrow::util::internal::avx2::ByteStreamSplitEncode);
 }
 
 BENCHMARK(BM_ByteStreamSplitDecode_Float_Avx2)->Range(MIN_RANGE, MAX_RANGE);
@@ -425,25 +554,29 @@ BENCHMARK(BM_ByteStreamSplitEncode_Float_Avx2)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_ByteStreamSplitEncode_Double_Avx2)->Range(MIN_RANGE, MAX_RANGE);
 #endif
 
-#if defined(ARROW_HAVE_AVX512)
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
 static void BM_ByteStreamSplitDecode_Float_Avx512(benchmark::State& state) {
-  BM_ByteStreamSplitDecode<float>(
-      state, arrow::util::internal::ByteStreamSplitDecodeAvx512<float>);
+  BM_ByteStreamSplitDecodeRuntime<float>(
+      state, ::arrow::internal::CpuInfo::AVX512,
+      arrow::util::internal::avx512::ByteStreamSplitDecode);
 }
 
 static void BM_ByteStreamSplitDecode_Double_Avx512(benchmark::State& state) {
-  BM_ByteStreamSplitDecode<double>(
-      state, arrow::util::internal::ByteStreamSplitDecodeAvx512<double>);
+  BM_ByteStreamSplitDecodeRuntime<double>(
+      state, ::arrow::internal::CpuInfo::AVX512,
+      arrow::util::internal::avx512::ByteStreamSplitDecode);
 }
 
 static void BM_ByteStreamSplitEncode_Float_Avx512(benchmark::State& state) {
-  BM_ByteStreamSplitEncode<float>(
-      state, arrow::util::internal::ByteStreamSplitEncodeAvx512<float>);
+  BM_ByteStreamSplitEncodeRuntime<float>(
+      state, ::arrow::internal::CpuInfo::AVX512,
+      arrow::util::internal::avx512::ByteStreamSplitEncode);
 }
 
 static void BM_ByteStreamSplitEncode_Double_Avx512(benchmark::State& state) {
-  BM_ByteStreamSplitEncode<double>(
-      state, arrow::util::internal::ByteStreamSplitEncodeAvx512<double>);
+  BM_ByteStreamSplitEncodeRuntime<double>(
+      state, ::arrow::internal::CpuInfo::AVX512,
+      arrow::util::internal::avx512::ByteStreamSplitEncode);
 }
 
 BENCHMARK(BM_ByteStreamSplitDecode_Float_Avx512)->Range(MIN_RANGE, MAX_RANGE);
@@ -674,6 +807,53 @@ BENCHMARK_DEFINE_F(BM_ArrowBinaryPlain, DecodeArrowNonNull_Dict)
 BENCHMARK_REGISTER_F(BM_ArrowBinaryPlain, DecodeArrowNonNull_Dict)
     ->Range(MIN_RANGE, MAX_RANGE);
 
+// ----------------------------------------------------------------------
+// Benchmark Decoding from Delta Length and Delta Strings Encodings
+template <Encoding::type kEncoding>
+class BM_ArrowBinaryDelta : public BenchmarkDecodeArrow {
+ public:
+  void DoEncodeArrow() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(kEncoding);
+    encoder->Put(*input_array_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  void DoEncodeLowLevel() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(kEncoding);
+    encoder->Put(values_.data(), num_values_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  std::unique_ptr<ByteArrayDecoder> InitializeDecoder() override {
+    auto decoder = MakeTypedDecoder<ByteArrayType>(kEncoding);
+    decoder->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+    return decoder;
+  }
+};
+
+using BM_ArrowBinaryDeltaLength = BM_ArrowBinaryDelta<Encoding::DELTA_LENGTH_BYTE_ARRAY>;
+using BM_ArrowBinaryDeltaStrings = BM_ArrowBinaryDelta<Encoding::DELTA_BYTE_ARRAY>;
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaLength, EncodeLowLevel)
+(benchmark::State& state) { EncodeLowLevelBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaLength, EncodeLowLevel)
+    ->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaLength, DecodeArrow_Dense)
+(benchmark::State& state) { DecodeArrowDenseBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaLength, DecodeArrow_Dense)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaStrings, EncodeLowLevel)
+(benchmark::State& state) { EncodeLowLevelBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaStrings, EncodeLowLevel)
+    ->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaStrings, DecodeArrow_Dense)
+(benchmark::State& state) { DecodeArrowDenseBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaStrings, DecodeArrow_Dense)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
 // ----------------------------------------------------------------------
 // Benchmark Decoding from Dictionary Encoding
 class BM_ArrowBinaryDict : public BenchmarkDecodeArrow {
@@ -21,6 +21,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -780,6 +781,60 @@ class EncodingAdHocTyped : public ::testing::Test {
     arrow::AssertArraysEqual(*expected, *result);
   }
 
+  void DictMergeDictionary() {
+    if (std::is_same<ParquetType, BooleanType>::value) {
+      return;
+    }
+
+    const bool is_flba = std::is_same<ParquetType, FLBAType>::value;
+    auto dict_values = arrow::ArrayFromJSON(
+        arrow_type(), is_flba ? R"(["abcdefgh", "ijklmnop", "qrstuvwx"])"
+                              : "[120, -37, 47]");
+    // Overlapping the first dictionary, with a duplicate
+    auto other_dict_values = arrow::ArrayFromJSON(
+        arrow_type(), is_flba ? R"(["qrstuvwx", "zzzzzzzz", "abcdefgh", "zzzzzzzz"])"
+                              : "[47, 99, 120, 99]");
+    auto indices = arrow::ArrayFromJSON(arrow::int32(), "[0, 1, 2]");
+    auto other_indices = arrow::ArrayFromJSON(arrow::int8(), "[0, 1, null, 3, 2]");
+
+    auto expected = arrow::ArrayFromJSON(
+        arrow_type(), is_flba ? R"(["abcdefgh", "ijklmnop", "qrstuvwx",
+                                    "qrstuvwx", "zzzzzzzz", null, "zzzzzzzz",
+                                    "abcdefgh"])"
+                              : "[120, -37, 47, 47, 99, null, 99, 120]");
+
+    auto owned_encoder =
+        MakeTypedEncoder<ParquetType>(Encoding::PLAIN,
+                                      /*use_dictionary=*/true, column_descr());
+    auto encoder = dynamic_cast<DictEncoder<ParquetType>*>(owned_encoder.get());
+
+    std::vector<int32_t> transpose_map;
+    ASSERT_NO_THROW(encoder->MergeDictionary(*dict_values, &transpose_map));
+    ASSERT_EQ(transpose_map, std::vector<int32_t>({0, 1, 2}));
+    ASSERT_NO_THROW(encoder->PutIndices(*indices));
+    // Only the missing values are appended to the dictionary
+    ASSERT_NO_THROW(encoder->MergeDictionary(*other_dict_values, &transpose_map));
+    ASSERT_EQ(transpose_map, std::vector<int32_t>({2, 3, 0, 3}));
+    ASSERT_EQ(encoder->num_entries(), 4);
+    ASSERT_NO_THROW(encoder->PutTransposedIndices(*other_indices, transpose_map.data()));
+
+    std::shared_ptr<Buffer> buf, dict_buf;
+    int num_values = static_cast<int>(expected->length() - expected->null_count());
+
+    std::unique_ptr<TypedDecoder<ParquetType>> decoder;
+    GetDictDecoder(encoder, num_values, &buf, &dict_buf, column_descr(), &decoder);
+
+    BuilderType acc(arrow_type(), arrow::default_memory_pool());
+    ASSERT_EQ(num_values, decoder->DecodeArrow(static_cast<int>(expected->length()),
+                                               static_cast<int>(expected->null_count()),
+                                               expected->null_bitmap_data(),
+                                               expected->offset(), &acc));
+
+    std::shared_ptr<::arrow::Array> result;
+    ASSERT_OK(acc.Finish(&result));
+    arrow::AssertArraysEqual(*expected, *result);
+  }
+
  protected:
   const int64_t size_ = 50;
   const double null_probability_ = 0.25;
@@ -920,6 +975,8 @@ TEST(DictEncodingAdHoc, PutDictionaryPutIndices) {
 
 TYPED_TEST(EncodingAdHocTyped, DictArrowDirectPutIndices) { this->DictPutIndices(); }
 
+TYPED_TEST(EncodingAdHocTyped, DictArrowMergeDictionary) { this->DictMergeDictionary(); }
+
 class DictEncoding : public TestArrowBuilderDecoding {
  public:
   void SetupEncoderDecoder() override {
@@ -1235,5 +1292,282 @@ TEST(ByteStreamSplitEncodeDecode, InvalidDataTypes) {
   ASSERT_THROW(MakeTypedDecoder<FLBAType>(Encoding::BYTE_STREAM_SPLIT), ParquetException);
 }
 
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED encode/decode tests.
+
+template <typename Type>
+class TestDeltaBitPackEncoding : public TestEncodingBase<Type> {
+ public:
+  typedef typename Type::c_type T;
+  static constexpr int TYPE = Type::type_num;
+
+  void CheckRoundtrip() override {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    encoder->Put(draws_, num_values_);
+    encode_buffer_ = encoder->FlushValues();
+
+    {
+      decoder->SetData(num_values_, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+      int values_decoded = decoder->Decode(decode_buf_, num_values_);
+      ASSERT_EQ(num_values_, values_decoded);
+      ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, draws_, num_values_));
+      ASSERT_EQ(0, decoder->values_left());
+    }
+
+    {
+      // Try again but with a small step, which splits mini blocks between calls
+      decoder->SetData(num_values_, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+      int step = 13;
+      int remaining = num_values_;
+      for (int i = 0; i < num_values_; i += step) {
+        int num_decoded = decoder->Decode(decode_buf_, step);
+        ASSERT_EQ(num_decoded, std::min(step, remaining));
+        ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, &draws_[i], num_decoded));
+        remaining -= num_decoded;
+      }
+    }
+  }
+
+  void CheckRoundtripSpaced(const uint8_t* valid_bits,
+                            int64_t valid_bits_offset) override {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    int null_count = 0;
+    for (auto i = 0; i < num_values_; i++) {
+      if (!BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+        null_count++;
+      }
+    }
+
+    encoder->PutSpaced(draws_, num_values_, valid_bits, valid_bits_offset);
+    encode_buffer_ = encoder->FlushValues();
+    decoder->SetData(num_values_ - null_count, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    auto values_decoded = decoder->DecodeSpaced(decode_buf_, num_values_, null_count,
+                                                valid_bits, valid_bits_offset);
+    ASSERT_EQ(num_values_, values_decoded);
+    ASSERT_NO_FATAL_FAILURE(VerifyResultsSpaced<T>(decode_buf_, draws_, num_values_,
+                                                   valid_bits, valid_bits_offset));
+  }
+
+  void ExecuteSorted(int nvalues) {
+    this->InitData(nvalues, 1);
+    std::sort(draws_, draws_ + num_values_);
+    CheckRoundtrip();
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+};
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBitPackTypes;
+TYPED_TEST_SUITE(TestDeltaBitPackEncoding, DeltaBitPackTypes);
+
+TYPED_TEST(TestDeltaBitPackEncoding, BasicRoundTrip) {
+  // Partial and full mini blocks and blocks. Random values of the whole range of the
+  // type give deltas which overflow, and mini blocks of the full bit width.
+  for (int values : {0, 1, 2, 31, 32, 33, 127, 128, 129, 130, 1000, 10000}) {
+    ASSERT_NO_FATAL_FAILURE(this->Execute(values, 1));
+  }
+  ASSERT_NO_FATAL_FAILURE(this->Execute(1000, 10));
+  for (int values : {1, 33, 129, 10000}) {
+    ASSERT_NO_FATAL_FAILURE(this->ExecuteSorted(values));
+  }
+  for (auto null_prob : {0.001, 0.1, 0.5, 0.9, 0.999}) {
+    ASSERT_NO_FATAL_FAILURE(this->ExecuteSpaced(1000, 1, 0, null_prob));
+    ASSERT_NO_FATAL_FAILURE(this->ExecuteSpaced(1000, 1, 7, null_prob));
+  }
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, ArrowDirectPut) {
+  using ArrowType = typename EncodingTraits<TypeParam>::ArrowType;
+  auto values = ::arrow::ArrayFromJSON(::arrow::TypeTraits<ArrowType>::type_singleton(),
+                                       "[1, 5, null, 3, 1000, -2, null, 4]");
+  auto encoder = MakeTypedEncoder<TypeParam>(Encoding::DELTA_BINARY_PACKED);
+  auto decoder = MakeTypedDecoder<TypeParam>(Encoding::DELTA_BINARY_PACKED);
+
+  ASSERT_NO_THROW(encoder->Put(*values));
+  auto buf = encoder->FlushValues();
+
+  int num_values = static_cast<int>(values->length() - values->null_count());
+  decoder->SetData(num_values, buf->data(), static_cast<int>(buf->size()));
+
+  typename EncodingTraits<TypeParam>::Accumulator acc(values->type(),
+                                                      default_memory_pool());
+  ASSERT_EQ(num_values,
+            decoder->DecodeArrow(static_cast<int>(values->length()),
+                                 static_cast<int>(values->null_count()),
+                                 values->null_bitmap_data(), values->offset(), &acc));
+  std::shared_ptr<::arrow::Array> result;
+  ASSERT_OK(acc.Finish(&result));
+  ::arrow::AssertArraysEqual(*values, *result);
+}
+
+TEST(DeltaBitPackEncoding, DecodeOtherBlockLayout) {
+  // Written by another writer: blocks of 128 values in 2 mini blocks of 64, with
+  // first value 7 and two deltas of 1, which need zero bits each
+  const uint8_t data[] = {0x80, 0x01, 0x02, 0x03, 0x0E, 0x02, 0x00, 0x00};
+  auto decoder = MakeTypedDecoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  decoder->SetData(3, data, static_cast<int>(sizeof(data)));
+  int32_t values[3];
+  ASSERT_EQ(3, decoder->Decode(values, 3));
+  ASSERT_EQ(7, values[0]);
+  ASSERT_EQ(8, values[1]);
+  ASSERT_EQ(9, values[2]);
+  ASSERT_EQ(0, decoder->Decode(values, 3));
+}
+
+TEST(DeltaBitPackEncoding, InvalidDataTypes) {
+  ASSERT_THROW(MakeTypedEncoder<FloatType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<BooleanType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<DoubleType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+}
+
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY encode/decode tests.
+
+class TestDeltaByteArrayEncoding : public TestEncodingBase<ByteArrayType>,
+                                   public ::testing::WithParamInterface<Encoding::type> {
+ public:
+  using Type = ByteArrayType;
+
+  void CheckRoundtrip() override {
+    auto encoder = MakeTypedEncoder<Type>(GetParam(), false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(GetParam(), descr_.get());
+    encoder->Put(draws_, num_values_);
+    encode_buffer_ = encoder->FlushValues();
+
+    decoder->SetData(num_values_, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    int step = 7;
+    int remaining = num_values_;
+    for (int i = 0; i < num_values_; i += step) {
+      int num_decoded = decoder->Decode(decode_buf_, step);
+      ASSERT_EQ(num_decoded, std::min(step, remaining));
+      ASSERT_NO_FATAL_FAILURE(
+          VerifyResults<ByteArray>(decode_buf_, &draws_[i], num_decoded));
+      remaining -= num_decoded;
+    }
+    ASSERT_EQ(0, decoder->values_left());
+  }
+
+  void CheckRoundtripSpaced(const uint8_t* valid_bits,
+                            int64_t valid_bits_offset) override {
+    auto encoder = MakeTypedEncoder<Type>(GetParam(), false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(GetParam(), descr_.get());
+    int null_count = 0;
+    for (auto i = 0; i < num_values_; i++) {
+      if (!BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+        null_count++;
+      }
+    }
+
+    encoder->PutSpaced(draws_, num_values_, valid_bits, valid_bits_offset);
+    encode_buffer_ = encoder->FlushValues();
+    decoder->SetData(num_values_ - null_count, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    auto values_decoded = decoder->DecodeSpaced(decode_buf_, num_values_, null_count,
+                                                valid_bits, valid_bits_offset);
+    ASSERT_EQ(num_values_, values_decoded);
+    ASSERT_NO_FATAL_FAILURE(VerifyResultsSpaced<ByteArray>(
+        decode_buf_, draws_, num_values_, valid_bits, valid_bits_offset));
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+};
+
+TEST_P(TestDeltaByteArrayEncoding, BasicRoundTrip) {
+  for (int values : {0, 1, 2, 33, 129, 1000}) {
+    ASSERT_NO_FATAL_FAILURE(this->Execute(values, 1));
+  }
+  // Repeated values share their whole prefix
+  ASSERT_NO_FATAL_FAILURE(this->Execute(100, 5));
+  for (auto null_prob : {0.1, 0.5, 0.9}) {
+    ASSERT_NO_FATAL_FAILURE(this->ExecuteSpaced(1000, 1, 3, null_prob));
+  }
+}
+
+TEST_P(TestDeltaByteArrayEncoding, ArrowDirectPut) {
+  auto CheckSeed = [&](int seed) {
+    arrow::random::RandomArrayGenerator rag(seed);
+    auto values = rag.String(50, 0, 10, 0.25);
+
+    auto encoder = MakeTypedEncoder<ByteArrayType>(GetParam());
+    auto decoder = MakeTypedDecoder<ByteArrayType>(GetParam());
+
+    ASSERT_NO_THROW(encoder->Put(*values));
+    auto buf = encoder->FlushValues();
+
+    int num_values = static_cast<int>(values->length() - values->null_count());
+    decoder->SetData(num_values, buf->data(), static_cast<int>(buf->size()));
+
+    typename EncodingTraits<ByteArrayType>::Accumulator acc;
+    acc.builder.reset(new arrow::StringBuilder);
+    ASSERT_EQ(num_values,
+              decoder->DecodeArrow(static_cast<int>(values->length()),
+                                   static_cast<int>(values->null_count()),
+                                   values->null_bitmap_data(), values->offset(), &acc));
+
+    std::shared_ptr<::arrow::Array> result;
+    ASSERT_OK(acc.builder->Finish(&result));
+    arrow::AssertArraysEqual(*values, *result);
+  };
+
+  for (auto seed : {0, 1, 2}) {
+    CheckSeed(seed);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(DeltaEncodings, TestDeltaByteArrayEncoding,
+                         ::testing::Values(Encoding::DELTA_LENGTH_BYTE_ARRAY,
+                                           Encoding::DELTA_BYTE_ARRAY));
+
+TEST(DeltaByteArrayEncoding, SharedPrefixes) {
+  std::vector<std::string> strings;
+  for (int i = 0; i < 1000; ++i) {
+    strings.push_back("https://example.com/catalog/item/" + std::to_string(i));
+  }
+  std::vector<ByteArray> values(strings.begin(), strings.end());
+
+  auto plain_encoder = MakeTypedEncoder<ByteArrayType>(Encoding::PLAIN);
+  plain_encoder->Put(values.data(), static_cast<int>(values.size()));
+  auto plain_buffer = plain_encoder->FlushValues();
+
+  auto encoder = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  auto buffer = encoder->FlushValues();
+  ASSERT_LT(buffer->size() * 4, plain_buffer->size());
+
+  auto decoder = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+  decoder->SetData(static_cast<int>(values.size()), buffer->data(),
+                   static_cast<int>(buffer->size()));
+  std::vector<ByteArray> decoded(values.size());
+  ASSERT_EQ(static_cast<int>(values.size()),
+            decoder->Decode(decoded.data(), static_cast<int>(values.size())));
+  for (size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(values[i], decoded[i]) << i;
+  }
+}
+
+TEST(DeltaByteArrayEncoding, InvalidDataTypes) {
+  for (auto encoding : {Encoding::DELTA_LENGTH_BYTE_ARRAY, Encoding::DELTA_BYTE_ARRAY}) {
+    ASSERT_THROW(MakeTypedEncoder<Int32Type>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedEncoder<FLBAType>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedDecoder<Int64Type>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedDecoder<FLBAType>(encoding), ParquetException);
+  }
+}
+
 }  // namespace test
 }  // namespace parquet
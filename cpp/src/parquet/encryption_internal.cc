@@ -17,14 +17,18 @@
 
 #include "parquet/encryption_internal.h"
 #include <openssl/aes.h>
+#include <openssl/crypto.h>
 #include <openssl/evp.h>
 #include <openssl/rand.h>
 
 #include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "parquet/exception.h"
@@ -39,44 +43,144 @@ constexpr int kCtrMode = 1;
 constexpr int kCtrIvLength = 16;
 constexpr int kBufferSizeLength = 4;
 
-#define ENCRYPT_INIT(CTX, ALG)                                        \
-  if (1 != EVP_EncryptInit_ex(CTX, ALG, nullptr, nullptr, nullptr)) { \
-    throw ParquetException("Couldn't init ALG encryption");           \
+namespace {
+
+const EVP_CIPHER* GetCipher(int aes_mode, int key_len) {
+  if (kGcmMode == aes_mode) {
+    // AES-GCM with specified key length
+    if (16 == key_len) return EVP_aes_128_gcm();
+    if (24 == key_len) return EVP_aes_192_gcm();
+    return EVP_aes_256_gcm();
   }
+  // AES-CTR with specified key length
+  if (16 == key_len) return EVP_aes_128_ctr();
+  if (24 == key_len) return EVP_aes_192_ctr();
+  return EVP_aes_256_ctr();
+}
 
-#define DECRYPT_INIT(CTX, ALG)                                        \
-  if (1 != EVP_DecryptInit_ex(CTX, ALG, nullptr, nullptr, nullptr)) { \
-    throw ParquetException("Couldn't init ALG decryption");           \
+// A cipher context, with the key last set in it: the key schedule is only
+// computed again when the key changes, not for every page.
+struct CipherContext {
+  ~CipherContext() {
+    WipeKey();
+    EVP_CIPHER_CTX_free(ctx);
   }
 
-class AesEncryptor::AesEncryptorImpl {
+  void WipeKey() {
+    if (!key.empty()) {
+      OPENSSL_cleanse(&key[0], key.size());
+      key.clear();
+    }
+  }
+
+  // Set the key (unless unchanged) and the IV, for a new message
+  void SetKeyAndIv(bool encrypt, const uint8_t* new_key, int key_len, const uint8_t* iv,
+                   const char* error_message) {
+    const bool same_key = static_cast<int>(key.size()) == key_len &&
+                          0 == std::memcmp(key.data(), new_key, key_len);
+    if (!same_key) {
+      WipeKey();
+    }
+    const uint8_t* init_key = same_key ? nullptr : new_key;
+    const int ret = encrypt ? EVP_EncryptInit_ex(ctx, nullptr, nullptr, init_key, iv)
+                            : EVP_DecryptInit_ex(ctx, nullptr, nullptr, init_key, iv);
+    if (1 != ret) {
+      throw ParquetException(error_message);
+    }
+    if (!same_key) {
+      key.assign(reinterpret_cast<const char*>(new_key), key_len);
+    }
+  }
+
+  EVP_CIPHER_CTX* ctx = nullptr;
+  std::string key;
+};
+
+// The cipher contexts of an encryptor or decryptor.  A single encryptor or
+// decryptor serves all the columns of a file, so that it may be used by
+// several threads at once (e.g. when columns are read in parallel); each
+// call takes a context from the pool, and gives it back when done.
+class CipherContextPool {
  public:
-  explicit AesEncryptorImpl(ParquetCipher::type alg_id, int key_len, bool metadata);
+  CipherContextPool(const EVP_CIPHER* cipher, bool encrypt)
+      : cipher_(cipher), encrypt_(encrypt) {}
+
+  // Takes a context out of the pool, and gives it back on destruction
+  class Lease {
+   public:
+    explicit Lease(CipherContextPool* pool) : pool_(pool), context_(pool->Take()) {}
+    ~Lease() { pool_->Release(std::move(context_)); }
+
+    CipherContext* operator->() const { return context_.get(); }
+    EVP_CIPHER_CTX* ctx() const { return context_->ctx; }
 
-  ~AesEncryptorImpl() {
-    if (nullptr != ctx_) {
-      EVP_CIPHER_CTX_free(ctx_);
-      ctx_ = nullptr;
+   private:
+    CipherContextPool* pool_;
+    std::unique_ptr<CipherContext> context_;
+  };
+
+  // Free all contexts, wiping out the keys
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    contexts_.clear();
+  }
+
+ private:
+  std::unique_ptr<CipherContext> Take() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!contexts_.empty()) {
+        auto context = std::move(contexts_.back());
+        contexts_.pop_back();
+        return context;
+      }
     }
+    std::unique_ptr<CipherContext> context(new CipherContext);
+    context->ctx = EVP_CIPHER_CTX_new();
+    if (nullptr == context->ctx) {
+      throw ParquetException("Couldn't init cipher context");
+    }
+    if (encrypt_) {
+      if (1 != EVP_EncryptInit_ex(context->ctx, cipher_, nullptr, nullptr, nullptr)) {
+        throw ParquetException("Couldn't init ALG encryption");
+      }
+    } else {
+      if (1 != EVP_DecryptInit_ex(context->ctx, cipher_, nullptr, nullptr, nullptr)) {
+        throw ParquetException("Couldn't init ALG decryption");
+      }
+    }
+    return context;
+  }
+
+  void Release(std::unique_ptr<CipherContext> context) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    contexts_.push_back(std::move(context));
   }
 
+  const EVP_CIPHER* cipher_;
+  const bool encrypt_;
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<CipherContext>> contexts_;
+};
+
+}  // namespace
+
+class AesEncryptor::AesEncryptorImpl {
+ public:
+  explicit AesEncryptorImpl(ParquetCipher::type alg_id, int key_len, bool metadata);
+
   int Encrypt(const uint8_t* plaintext, int plaintext_len, const uint8_t* key,
               int key_len, const uint8_t* aad, int aad_len, uint8_t* ciphertext);
 
   int SignedFooterEncrypt(const uint8_t* footer, int footer_len, const uint8_t* key,
                           int key_len, const uint8_t* aad, int aad_len,
                           const uint8_t* nonce, uint8_t* encrypted_footer);
-  void WipeOut() {
-    if (nullptr != ctx_) {
-      EVP_CIPHER_CTX_free(ctx_);
-      ctx_ = nullptr;
-    }
-  }
+  void WipeOut() { contexts_->Clear(); }
 
   int ciphertext_size_delta() { return ciphertext_size_delta_; }
 
  private:
-  EVP_CIPHER_CTX* ctx_;
+  std::unique_ptr<CipherContextPool> contexts_;
   int aes_mode_;
   int key_length_;
   int ciphertext_size_delta_;
@@ -91,8 +195,6 @@ class AesEncryptor::AesEncryptorImpl {
 
 AesEncryptor::AesEncryptorImpl::AesEncryptorImpl(ParquetCipher::type alg_id, int key_len,
                                                  bool metadata) {
-  ctx_ = nullptr;
-
   ciphertext_size_delta_ = kBufferSizeLength + kNonceLength;
   if (metadata || (ParquetCipher::AES_GCM_V1 == alg_id)) {
     aes_mode_ = kGcmMode;
@@ -108,31 +210,7 @@ AesEncryptor::AesEncryptorImpl::AesEncryptorImpl(ParquetCipher::type alg_id, int
   }
 
   key_length_ = key_len;
-
-  ctx_ = EVP_CIPHER_CTX_new();
-  if (nullptr == ctx_) {
-    throw ParquetException("Couldn't init cipher context");
-  }
-
-  if (kGcmMode == aes_mode_) {
-    // Init AES-GCM with specified key length
-    if (16 == key_len) {
-      ENCRYPT_INIT(ctx_, EVP_aes_128_gcm());
-    } else if (24 == key_len) {
-      ENCRYPT_INIT(ctx_, EVP_aes_192_gcm());
-    } else if (32 == key_len) {
-      ENCRYPT_INIT(ctx_, EVP_aes_256_gcm());
-    }
-  } else {
-    // Init AES-CTR with specified key length
-    if (16 == key_len) {
-      ENCRYPT_INIT(ctx_, EVP_aes_128_ctr());
-    } else if (24 == key_len) {
-      ENCRYPT_INIT(ctx_, EVP_aes_192_ctr());
-    } else if (32 == key_len) {
-      ENCRYPT_INIT(ctx_, EVP_aes_256_ctr());
-    }
-  }
+  contexts_.reset(new CipherContextPool(GetCipher(aes_mode_, key_len), /*encrypt=*/true));
 }
 
 int AesEncryptor::AesEncryptorImpl::SignedFooterEncrypt(
@@ -186,18 +264,20 @@ int AesEncryptor::AesEncryptorImpl::GcmEncrypt(const uint8_t* plaintext,
   uint8_t tag[kGcmTagLength];
   memset(tag, 0, kGcmTagLength);
 
+  CipherContextPool::Lease context(contexts_.get());
+  EVP_CIPHER_CTX* ctx = context.ctx();
+
   // Setting key and IV (nonce)
-  if (1 != EVP_EncryptInit_ex(ctx_, nullptr, nullptr, key, nonce)) {
-    throw ParquetException("Couldn't set key and nonce");
-  }
+  context->SetKeyAndIv(/*encrypt=*/true, key, key_len, nonce,
+                       "Couldn't set key and nonce");
 
   // Setting additional authenticated data
-  if ((nullptr != aad) && (1 != EVP_EncryptUpdate(ctx_, nullptr, &len, aad, aad_len))) {
+  if ((nullptr != aad) && (1 != EVP_EncryptUpdate(ctx, nullptr, &len, aad, aad_len))) {
     throw ParquetException("Couldn't set AAD");
   }
 
   // Encryption
-  if (1 != EVP_EncryptUpdate(ctx_, ciphertext + kBufferSizeLength + kNonceLength, &len,
+  if (1 != EVP_EncryptUpdate(ctx, ciphertext + kBufferSizeLength + kNonceLength, &len,
                              plaintext, plaintext_len)) {
     throw ParquetException("Failed encryption update");
   }
@@ -205,7 +285,7 @@ int AesEncryptor::AesEncryptorImpl::GcmEncrypt(const uint8_t* plaintext,
   ciphertext_len = len;
 
   // Finalization
-  if (1 != EVP_EncryptFinal_ex(ctx_, ciphertext + kBufferSizeLength + kNonceLength + len,
+  if (1 != EVP_EncryptFinal_ex(ctx, ciphertext + kBufferSizeLength + kNonceLength + len,
                                &len)) {
     throw ParquetException("Failed encryption finalization");
   }
@@ -213,7 +293,7 @@ int AesEncryptor::AesEncryptorImpl::GcmEncrypt(const uint8_t* plaintext,
   ciphertext_len += len;
 
   // Getting the tag
-  if (1 != EVP_CIPHER_CTX_ctrl(ctx_, EVP_CTRL_GCM_GET_TAG, kGcmTagLength, tag)) {
+  if (1 != EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, kGcmTagLength, tag)) {
     throw ParquetException("Couldn't get AES-GCM tag");
   }
 
@@ -246,13 +326,14 @@ int AesEncryptor::AesEncryptorImpl::CtrEncrypt(const uint8_t* plaintext,
   std::copy(nonce, nonce + kNonceLength, iv);
   iv[kCtrIvLength - 1] = 1;
 
+  CipherContextPool::Lease context(contexts_.get());
+  EVP_CIPHER_CTX* ctx = context.ctx();
+
   // Setting key and IV
-  if (1 != EVP_EncryptInit_ex(ctx_, nullptr, nullptr, key, iv)) {
-    throw ParquetException("Couldn't set key and IV");
-  }
+  context->SetKeyAndIv(/*encrypt=*/true, key, key_len, iv, "Couldn't set key and IV");
 
   // Encryption
-  if (1 != EVP_EncryptUpdate(ctx_, ciphertext + kBufferSizeLength + kNonceLength, &len,
+  if (1 != EVP_EncryptUpdate(ctx, ciphertext + kBufferSizeLength + kNonceLength, &len,
                              plaintext, plaintext_len)) {
     throw ParquetException("Failed encryption update");
   }
@@ -260,7 +341,7 @@ int AesEncryptor::AesEncryptorImpl::CtrEncrypt(const uint8_t* plaintext,
   ciphertext_len = len;
 
   // Finalization
-  if (1 != EVP_EncryptFinal_ex(ctx_, ciphertext + kBufferSizeLength + kNonceLength + len,
+  if (1 != EVP_EncryptFinal_ex(ctx, ciphertext + kBufferSizeLength + kNonceLength + len,
                                &len)) {
     throw ParquetException("Failed encryption finalization");
   }
@@ -306,27 +387,15 @@ class AesDecryptor::AesDecryptorImpl {
  public:
   explicit AesDecryptorImpl(ParquetCipher::type alg_id, int key_len, bool metadata);
 
-  ~AesDecryptorImpl() {
-    if (nullptr != ctx_) {
-      EVP_CIPHER_CTX_free(ctx_);
-      ctx_ = nullptr;
-    }
-  }
-
   int Decrypt(const uint8_t* ciphertext, int ciphertext_len, const uint8_t* key,
               int key_len, const uint8_t* aad, int aad_len, uint8_t* plaintext);
 
-  void WipeOut() {
-    if (nullptr != ctx_) {
-      EVP_CIPHER_CTX_free(ctx_);
-      ctx_ = nullptr;
-    }
-  }
+  void WipeOut() { contexts_->Clear(); }
 
   int ciphertext_size_delta() { return ciphertext_size_delta_; }
 
  private:
-  EVP_CIPHER_CTX* ctx_;
+  std::unique_ptr<CipherContextPool> contexts_;
   int aes_mode_;
   int key_length_;
   int ciphertext_size_delta_;
@@ -349,8 +418,6 @@ AesDecryptor::~AesDecryptor() {}
 
 AesDecryptor::AesDecryptorImpl::AesDecryptorImpl(ParquetCipher::type alg_id, int key_len,
                                                  bool metadata) {
-  ctx_ = nullptr;
-
   ciphertext_size_delta_ = kBufferSizeLength + kNonceLength;
   if (metadata || (ParquetCipher::AES_GCM_V1 == alg_id)) {
     aes_mode_ = kGcmMode;
@@ -366,31 +433,8 @@ AesDecryptor::AesDecryptorImpl::AesDecryptorImpl(ParquetCipher::type alg_id, int
   }
 
   key_length_ = key_len;
-
-  ctx_ = EVP_CIPHER_CTX_new();
-  if (nullptr == ctx_) {
-    throw ParquetException("Couldn't init cipher context");
-  }
-
-  if (kGcmMode == aes_mode_) {
-    // Init AES-GCM with specified key length
-    if (16 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_128_gcm());
-    } else if (24 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_192_gcm());
-    } else if (32 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_256_gcm());
-    }
-  } else {
-    // Init AES-CTR with specified key length
-    if (16 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_128_ctr());
-    } else if (24 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_192_ctr());
-    } else if (32 == key_len) {
-      DECRYPT_INIT(ctx_, EVP_aes_256_ctr());
-    }
-  }
+  contexts_.reset(
+      new CipherContextPool(GetCipher(aes_mode_, key_len), /*encrypt=*/false));
 }
 
 AesEncryptor* AesEncryptor::Make(ParquetCipher::type alg_id, int key_len, bool metadata,
@@ -456,19 +500,21 @@ int AesDecryptor::AesDecryptorImpl::GcmDecrypt(const uint8_t* ciphertext,
   std::copy(ciphertext + ciphertext_len - kGcmTagLength, ciphertext + ciphertext_len,
             tag);
 
+  CipherContextPool::Lease context(contexts_.get());
+  EVP_CIPHER_CTX* ctx = context.ctx();
+
   // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key, nonce)) {
-    throw ParquetException("Couldn't set key and IV");
-  }
+  context->SetKeyAndIv(/*encrypt=*/false, key, key_len, nonce,
+                       "Couldn't set key and IV");
 
   // Setting additional authenticated data
-  if ((nullptr != aad) && (1 != EVP_DecryptUpdate(ctx_, nullptr, &len, aad, aad_len))) {
+  if ((nullptr != aad) && (1 != EVP_DecryptUpdate(ctx, nullptr, &len, aad, aad_len))) {
     throw ParquetException("Couldn't set AAD");
   }
 
   // Decryption
   if (!EVP_DecryptUpdate(
-          ctx_, plaintext, &len, ciphertext + kBufferSizeLength + kNonceLength,
+          ctx, plaintext, &len, ciphertext + kBufferSizeLength + kNonceLength,
           ciphertext_len - kBufferSizeLength - kNonceLength - kGcmTagLength)) {
     throw ParquetException("Failed decryption update");
   }
@@ -476,12 +522,12 @@ int AesDecryptor::AesDecryptorImpl::GcmDecrypt(const uint8_t* ciphertext,
   plaintext_len = len;
 
   // Checking the tag (authentication)
-  if (!EVP_CIPHER_CTX_ctrl(ctx_, EVP_CTRL_GCM_SET_TAG, kGcmTagLength, tag)) {
+  if (!EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_TAG, kGcmTagLength, tag)) {
     throw ParquetException("Failed authentication");
   }
 
   // Finalization
-  if (1 != EVP_DecryptFinal_ex(ctx_, plaintext + len, &len)) {
+  if (1 != EVP_DecryptFinal_ex(ctx, plaintext + len, &len)) {
     throw ParquetException("Failed decryption finalization");
   }
 
@@ -518,13 +564,14 @@ int AesDecryptor::AesDecryptorImpl::CtrDecrypt(const uint8_t* ciphertext,
   // is set to 1.
   iv[kCtrIvLength - 1] = 1;
 
+  CipherContextPool::Lease context(contexts_.get());
+  EVP_CIPHER_CTX* ctx = context.ctx();
+
   // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key, iv)) {
-    throw ParquetException("Couldn't set key and IV");
-  }
+  context->SetKeyAndIv(/*encrypt=*/false, key, key_len, iv, "Couldn't set key and IV");
 
   // Decryption
-  if (!EVP_DecryptUpdate(ctx_, plaintext, &len,
+  if (!EVP_DecryptUpdate(ctx, plaintext, &len,
                          ciphertext + kBufferSizeLength + kNonceLength,
                          ciphertext_len - kNonceLength)) {
     throw ParquetException("Failed decryption update");
@@ -533,7 +580,7 @@ int AesDecryptor::AesDecryptorImpl::CtrDecrypt(const uint8_t* ciphertext,
   plaintext_len = len;
 
   // Finalization
-  if (1 != EVP_DecryptFinal_ex(ctx_, plaintext + len, &len)) {
+  if (1 != EVP_DecryptFinal_ex(ctx, plaintext + len, &len)) {
     throw ParquetException("Failed decryption finalization");
   }
 
@@ -0,0 +1,154 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "parquet/encryption_internal.h"
+#include "parquet/exception.h"
+
+namespace parquet {
+namespace encryption {
+namespace test {
+
+const std::string kKey1 = "0123456789012345";  // NOLINT
+const std::string kKey2 = "1234567890123450";  // NOLINT
+const std::string kAad = "module aad";         // NOLINT
+
+const uint8_t* Bytes(const std::string& s) {
+  return reinterpret_cast<const uint8_t*>(s.data());
+}
+
+std::string MakePlaintext(int length, int seed) {
+  std::string plaintext(length, 0);
+  for (int i = 0; i < length; ++i) {
+    plaintext[i] = static_cast<char>((i * 31 + seed) % 251);
+  }
+  return plaintext;
+}
+
+class TestAesCipher : public ::testing::TestWithParam<ParquetCipher::type> {
+ public:
+  void SetUp() override {
+    encryptor_.reset(AesEncryptor::Make(GetParam(), 16, /*metadata=*/false, nullptr));
+    decryptor_.reset(AesDecryptor::Make(GetParam(), 16, /*metadata=*/false, nullptr));
+  }
+
+  std::vector<uint8_t> Encrypt(const std::string& plaintext, const std::string& key) {
+    std::vector<uint8_t> ciphertext(plaintext.size() + encryptor_->CiphertextSizeDelta());
+    const int length = encryptor_->Encrypt(
+        Bytes(plaintext), static_cast<int>(plaintext.size()), Bytes(key),
+        static_cast<int>(key.size()), Bytes(kAad), static_cast<int>(kAad.size()),
+        ciphertext.data());
+    EXPECT_EQ(static_cast<int>(ciphertext.size()), length);
+    return ciphertext;
+  }
+
+  std::string Decrypt(const std::vector<uint8_t>& ciphertext, const std::string& key) {
+    std::string plaintext(ciphertext.size() - decryptor_->CiphertextSizeDelta(), 0);
+    const int length = decryptor_->Decrypt(
+        ciphertext.data(), static_cast<int>(ciphertext.size()), Bytes(key),
+        static_cast<int>(key.size()), Bytes(kAad), static_cast<int>(kAad.size()),
+        reinterpret_cast<uint8_t*>(&plaintext[0]));
+    plaintext.resize(length);
+    return plaintext;
+  }
+
+ protected:
+  std::unique_ptr<AesEncryptor> encryptor_;
+  std::unique_ptr<AesDecryptor> decryptor_;
+};
+
+TEST_P(TestAesCipher, Roundtrip) {
+  for (int length : {0, 1, 100, 8192}) {
+    const auto plaintext = MakePlaintext(length, length);
+    const auto ciphertext = Encrypt(plaintext, kKey1);
+    ASSERT_EQ(plaintext, Decrypt(ciphertext, kKey1));
+    // The key is only set in the first call to a cipher context
+    decryptor_.reset(AesDecryptor::Make(GetParam(), 16, /*metadata=*/false, nullptr));
+    ASSERT_EQ(plaintext, Decrypt(ciphertext, kKey1));
+  }
+}
+
+TEST_P(TestAesCipher, SwitchKeys) {
+  // Encryptors and decryptors serve all columns of a file, which may have
+  // different keys
+  const auto plaintext = MakePlaintext(1000, 1);
+  const auto ciphertext1 = Encrypt(plaintext, kKey1);
+  const auto ciphertext2 = Encrypt(plaintext, kKey2);
+  const auto ciphertext3 = Encrypt(plaintext, kKey1);
+  ASSERT_NE(ciphertext1, ciphertext2);
+
+  ASSERT_EQ(plaintext, Decrypt(ciphertext2, kKey2));
+  ASSERT_EQ(plaintext, Decrypt(ciphertext1, kKey1));
+  ASSERT_EQ(plaintext, Decrypt(ciphertext3, kKey1));
+  ASSERT_EQ(plaintext, Decrypt(ciphertext2, kKey2));
+  if (GetParam() == ParquetCipher::AES_GCM_V1) {
+    ASSERT_THROW(Decrypt(ciphertext1, kKey2), ParquetException);
+    // A failed decryption doesn't affect the following ones
+    ASSERT_EQ(plaintext, Decrypt(ciphertext1, kKey1));
+  } else {
+    ASSERT_NE(plaintext, Decrypt(ciphertext1, kKey2));
+  }
+}
+
+TEST_P(TestAesCipher, WipeOut) {
+  const auto plaintext = MakePlaintext(1000, 2);
+  const auto ciphertext = Encrypt(plaintext, kKey1);
+  decryptor_->WipeOut();
+  ASSERT_EQ(plaintext, Decrypt(ciphertext, kKey1));
+}
+
+TEST_P(TestAesCipher, Concurrent) {
+  // Column chunks may be encrypted and decrypted in parallel
+  const int kNumThreads = 8;
+  const int kNumPages = 200;
+  std::vector<std::string> plaintexts;
+  for (int i = 0; i < kNumPages; ++i) {
+    plaintexts.push_back(MakePlaintext(1000 + i, i));
+  }
+
+  std::vector<std::thread> threads;
+  std::vector<int> num_errors(kNumThreads, 0);
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      const auto& key = t % 2 ? kKey1 : kKey2;
+      for (const auto& plaintext : plaintexts) {
+        if (Decrypt(Encrypt(plaintext, key), key) != plaintext) {
+          ++num_errors[t];
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(std::vector<int>(kNumThreads, 0), num_errors);
+}
+
+INSTANTIATE_TEST_SUITE_P(AesCiphers, TestAesCipher,
+                         ::testing::Values(ParquetCipher::AES_GCM_V1,
+                                           ParquetCipher::AES_GCM_CTR_V1));
+
+}  // namespace test
+}  // namespace encryption
+}  // namespace parquet
@@ -18,18 +18,24 @@
 #include "parquet/file_reader.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "arrow/filesystem/localfs.h"
 #include "arrow/io/caching.h"
 #include "arrow/io/file.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_scanner.h"
 #include "parquet/deprecated_io.h"
@@ -38,6 +44,7 @@
 #include "parquet/file_writer.h"
 #include "parquet/internal_file_decryptor.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -58,6 +65,18 @@ static constexpr int64_t kMaxDictHeaderSize = 100;
 RowGroupReader::RowGroupReader(std::unique_ptr<Contents> contents)
     : contents_(std::move(contents)) {}
 
+std::unique_ptr<BloomFilter> RowGroupReader::Contents::GetColumnBloomFilter(int i) {
+  return NULLPTR;
+}
+
+std::unique_ptr<ColumnIndex> RowGroupReader::Contents::GetColumnIndex(int i) {
+  return NULLPTR;
+}
+
+std::unique_ptr<OffsetIndex> RowGroupReader::Contents::GetOffsetIndex(int i) {
+  return NULLPTR;
+}
+
 std::shared_ptr<ColumnReader> RowGroupReader::Column(int i) {
   if (i >= metadata()->num_columns()) {
     std::stringstream ss;
@@ -83,6 +102,36 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::unique_ptr<BloomFilter> RowGroupReader::GetColumnBloomFilter(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetColumnBloomFilter(i);
+}
+
+std::unique_ptr<ColumnIndex> RowGroupReader::GetColumnIndex(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetColumnIndex(i);
+}
+
+std::unique_ptr<OffsetIndex> RowGroupReader::GetOffsetIndex(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetOffsetIndex(i);
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
@@ -199,7 +248,65 @@ class SerializedRowGroup : public RowGroupReader::Contents {
                             properties_.memory_pool(), &ctx);
   }
 
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_bloom_filter()) {
+      return nullptr;
+    }
+    // The filter is serialized as its length in bytes, hash strategy and
+    // algorithm followed by the bitset
+    constexpr int64_t kHeaderLength = 3 * sizeof(uint32_t);
+    const int64_t offset = col->bloom_filter_offset();
+    if (offset < 0 || offset + kHeaderLength > source_size_) {
+      throw ParquetException("Bloom filter offset is out of bounds");
+    }
+    PARQUET_ASSIGN_OR_THROW(auto header, source_->ReadAt(offset, kHeaderLength));
+    if (header->size() != kHeaderLength) {
+      throw ParquetException("Failed to read Bloom filter header");
+    }
+    const auto length = ::arrow::util::SafeLoadAs<uint32_t>(header->data());
+    if (length > BloomFilter::kMaximumBloomFilterBytes ||
+        offset + kHeaderLength + length > source_size_) {
+      throw ParquetException("Bloom filter length is out of bounds");
+    }
+    PARQUET_ASSIGN_OR_THROW(auto buffer,
+                            source_->ReadAt(offset, kHeaderLength + length));
+    ::arrow::io::BufferReader stream(buffer);
+    return std::unique_ptr<BloomFilter>(
+        new BlockSplitBloomFilter(BlockSplitBloomFilter::Deserialize(&stream)));
+  }
+
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_column_index()) {
+      return nullptr;
+    }
+    auto buffer = ReadPageIndex(col->column_index_offset(), col->column_index_length());
+    return ColumnIndex::Make(file_metadata_->schema()->Column(i), buffer->data(),
+                             static_cast<uint32_t>(buffer->size()));
+  }
+
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_offset_index()) {
+      return nullptr;
+    }
+    auto buffer = ReadPageIndex(col->offset_index_offset(), col->offset_index_length());
+    return OffsetIndex::Make(buffer->data(), static_cast<uint32_t>(buffer->size()));
+  }
+
  private:
+  std::shared_ptr<Buffer> ReadPageIndex(int64_t offset, int32_t length) {
+    if (offset < 0 || length < 0 || offset + length > source_size_) {
+      throw ParquetException("Page index location is out of bounds");
+    }
+    PARQUET_ASSIGN_OR_THROW(auto buffer, source_->ReadAt(offset, length));
+    if (buffer->size() != length) {
+      throw ParquetException("Failed to read page index");
+    }
+    return buffer;
+  }
+
   std::shared_ptr<ArrowInputFile> source_;
   // Will be nullptr if PreBuffer() is not called.
   std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source_;
@@ -237,9 +344,9 @@ class SerializedFile : public ParquetFileReader::Contents {
   }
 
   std::shared_ptr<RowGroupReader> GetRowGroup(int i) override {
-    std::unique_ptr<SerializedRowGroup> contents(
-        new SerializedRowGroup(source_, cached_source_, source_size_,
-                               file_metadata_.get(), i, properties_, file_decryptor_));
+    std::unique_ptr<SerializedRowGroup> contents(new SerializedRowGroup(
+        source_, GetCachedSource(i), source_size_, file_metadata_.get(), i, properties_,
+        file_decryptor_));
     return std::make_shared<RowGroupReader>(std::move(contents));
   }
 
@@ -252,17 +359,94 @@ class SerializedFile : public ParquetFileReader::Contents {
   void PreBuffer(const std::vector<int>& row_groups,
                  const std::vector<int>& column_indices,
                  const ::arrow::io::AsyncContext& ctx,
-                 const ::arrow::io::CacheOptions& options) {
-    cached_source_ =
-        std::make_shared<arrow::io::internal::ReadRangeCache>(source_, ctx, options);
-    std::vector<arrow::io::ReadRange> ranges;
-    for (int row : row_groups) {
-      for (int col : column_indices) {
+                 const ::arrow::io::CacheOptions& options, int64_t max_buffered_bytes) {
+    std::lock_guard<std::mutex> lock(prefetch_mutex_);
+    cached_source_.reset();
+    prefetch_row_groups_.clear();
+    prefetched_row_groups_.clear();
+    if (max_buffered_bytes <= 0) {
+      cached_source_ =
+          std::make_shared<arrow::io::internal::ReadRangeCache>(source_, ctx, options);
+      std::vector<arrow::io::ReadRange> ranges;
+      for (int row : row_groups) {
+        for (int col : column_indices) {
+          ranges.push_back(
+              ComputeColumnChunkRange(file_metadata_.get(), source_size_, row, col));
+        }
+      }
+      PARQUET_THROW_NOT_OK(cached_source_->Cache(ranges));
+      return;
+    }
+
+    // Buffer the first row groups now, and the following ones as they are read
+    prefetch_row_groups_ = row_groups;
+    prefetch_column_indices_ = column_indices;
+    prefetch_context_ = ctx;
+    prefetch_options_ = options;
+    max_buffered_bytes_ = max_buffered_bytes;
+    buffered_bytes_ = 0;
+    read_position_ = 0;
+    next_prefetch_position_ = 0;
+    PrefetchRowGroups();
+  }
+
+  // The pre-buffered column chunks of row group i, or nullptr to read them from the
+  // source
+  std::shared_ptr<arrow::io::internal::ReadRangeCache> GetCachedSource(int i) {
+    std::lock_guard<std::mutex> lock(prefetch_mutex_);
+    if (prefetch_row_groups_.empty()) return cached_source_;
+
+    auto position = static_cast<size_t>(
+        std::find(prefetch_row_groups_.begin() + read_position_,
+                  prefetch_row_groups_.end(), i) -
+        prefetch_row_groups_.begin());
+    if (position == prefetch_row_groups_.size()) {
+      // A row group which was already released, or is not part of the selection
+      auto it = prefetched_row_groups_.find(i);
+      return it == prefetched_row_groups_.end() ? nullptr : it->second.cache;
+    }
+    if (position > read_position_) {
+      // The readers have moved on: release the previous row groups (the readers of
+      // their columns keep the buffers they use) and buffer the following ones
+      for (; read_position_ < position; ++read_position_) {
+        auto it = prefetched_row_groups_.find(prefetch_row_groups_[read_position_]);
+        if (it != prefetched_row_groups_.end()) {
+          buffered_bytes_ -= it->second.num_bytes;
+          prefetched_row_groups_.erase(it);
+        }
+      }
+      PrefetchRowGroups();
+    }
+    auto it = prefetched_row_groups_.find(i);
+    return it == prefetched_row_groups_.end() ? nullptr : it->second.cache;
+  }
+
+  // Start buffering the row groups following the one being read while they fit in
+  // max_buffered_bytes_, and at least the one being read
+  void PrefetchRowGroups() {
+    if (next_prefetch_position_ < read_position_) {
+      next_prefetch_position_ = read_position_;
+    }
+    while (next_prefetch_position_ < prefetch_row_groups_.size()) {
+      const int row_group = prefetch_row_groups_[next_prefetch_position_];
+      std::vector<arrow::io::ReadRange> ranges;
+      int64_t num_bytes = 0;
+      for (int col : prefetch_column_indices_) {
         ranges.push_back(
-            ComputeColumnChunkRange(file_metadata_.get(), source_size_, row, col));
+            ComputeColumnChunkRange(file_metadata_.get(), source_size_, row_group, col));
+        num_bytes += ranges.back().length;
+      }
+      if (next_prefetch_position_ > read_position_ &&
+          buffered_bytes_ + num_bytes > max_buffered_bytes_) {
+        break;
       }
+      auto cache = std::make_shared<arrow::io::internal::ReadRangeCache>(
+          source_, prefetch_context_, prefetch_options_);
+      PARQUET_THROW_NOT_OK(cache->Cache(std::move(ranges)));
+      prefetched_row_groups_[row_group] = {std::move(cache), num_bytes};
+      buffered_bytes_ += num_bytes;
+      ++next_prefetch_position_;
     }
-    PARQUET_THROW_NOT_OK(cached_source_->Cache(ranges));
   }
 
   void ParseMetaData() {
@@ -321,6 +505,23 @@ class SerializedFile : public ParquetFileReader::Contents {
   std::shared_ptr<FileMetaData> file_metadata_;
   ReaderProperties properties_;
 
+  // When pre-buffering is limited in size, the selected row groups in the order they
+  // are read, and the buffered ones starting at read_position_
+  struct PrefetchedRowGroup {
+    std::shared_ptr<arrow::io::internal::ReadRangeCache> cache;
+    int64_t num_bytes;
+  };
+  std::mutex prefetch_mutex_;
+  std::vector<int> prefetch_row_groups_;
+  std::vector<int> prefetch_column_indices_;
+  ::arrow::io::AsyncContext prefetch_context_;
+  ::arrow::io::CacheOptions prefetch_options_;
+  int64_t max_buffered_bytes_ = 0;
+  int64_t buffered_bytes_ = 0;
+  size_t read_position_ = 0;
+  size_t next_prefetch_position_ = 0;
+  std::map<int, PrefetchedRowGroup> prefetched_row_groups_;
+
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
 
   void ParseUnencryptedFileMetadata(const std::shared_ptr<Buffer>& footer_buffer,
@@ -565,7 +766,24 @@ std::unique_ptr<ParquetFileReader> ParquetFileReader::OpenFile(
                             ::arrow::io::ReadableFile::Open(path, props.memory_pool()));
   }
 
-  return Open(std::move(source), props, std::move(metadata));
+  const std::shared_ptr<FileMetaDataCache>& cache = props.metadata_cache();
+  if (metadata != nullptr || cache == nullptr ||
+      props.file_decryption_properties() != nullptr) {
+    return Open(std::move(source), props, std::move(metadata));
+  }
+
+  ::arrow::fs::LocalFileSystem fs;
+  PARQUET_ASSIGN_OR_THROW(auto info, fs.GetFileInfo(path));
+  const int64_t mtime_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               info.mtime().time_since_epoch())
+                               .count();
+  metadata = cache->Get(path, info.size(), mtime_ns);
+  if (metadata != nullptr) {
+    return Open(std::move(source), props, std::move(metadata));
+  }
+  auto reader = Open(std::move(source), props);
+  cache->Put(path, info.size(), mtime_ns, reader->metadata());
+  return reader;
 }
 
 void ParquetFileReader::Open(std::unique_ptr<ParquetFileReader::Contents> contents) {
@@ -595,11 +813,12 @@ std::shared_ptr<RowGroupReader> ParquetFileReader::RowGroup(int i) {
 void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
                                   const std::vector<int>& column_indices,
                                   const ::arrow::io::AsyncContext& ctx,
-                                  const ::arrow::io::CacheOptions& options) {
+                                  const ::arrow::io::CacheOptions& options,
+                                  int64_t max_buffered_bytes) {
   // Access private methods here
   SerializedFile* file =
       ::arrow::internal::checked_cast<SerializedFile*>(contents_.get());
-  file->PreBuffer(row_groups, column_indices, ctx, options);
+  file->PreBuffer(row_groups, column_indices, ctx, options, max_buffered_bytes);
 }
 
 // ----------------------------------------------------------------------
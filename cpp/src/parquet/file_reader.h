@@ -29,8 +29,11 @@
 
 namespace parquet {
 
+class BloomFilter;
+class ColumnIndex;
 class ColumnReader;
 class FileMetaData;
+class OffsetIndex;
 class PageReader;
 class RandomAccessSource;
 class RowGroupMetaData;
@@ -45,6 +48,10 @@ class PARQUET_EXPORT RowGroupReader {
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
+    // The defaults return nullptr, as if the columns had no Bloom filter or page index
+    virtual std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i);
+    virtual std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+    virtual std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
   };
 
   explicit RowGroupReader(std::unique_ptr<Contents> contents);
@@ -58,6 +65,15 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  // Read the Bloom filter of the indicated row group-relative column, or
+  // return nullptr if the column chunk has none
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i);
+
+  // Read the ColumnIndex or OffsetIndex of the indicated row group-relative column,
+  // or return nullptr if the column chunk has none
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -103,7 +119,8 @@ class PARQUET_EXPORT ParquetFileReader {
       std::shared_ptr<FileMetaData> metadata = NULLPTR);
 
   // API Convenience to open a serialized Parquet file on disk, using Arrow IO
-  // interfaces.
+  // interfaces. The metadata is looked up in and added to props.metadata_cache()
+  // if any.
   static std::unique_ptr<ParquetFileReader> OpenFile(
       const std::string& path, bool memory_map = true,
       const ReaderProperties& props = default_reader_properties(),
@@ -136,10 +153,19 @@ class PARQUET_EXPORT ParquetFileReader {
   /// buffered in memory until either \a PreBuffer() is called again,
   /// or the reader itself is destructed. Reading - and buffering -
   /// only one row group at a time may be useful.
+  ///
+  /// Alternatively, a positive \a max_buffered_bytes limits the
+  /// buffered data to the row group being read and the following ones
+  /// which fit in that many bytes. They are buffered in the background
+  /// while the previous ones are decoded, and released once a later
+  /// row group is read, so that the row groups should be read in the
+  /// order of \a row_groups. Row groups which were already released
+  /// are read directly from the source.
   void PreBuffer(const std::vector<int>& row_groups,
                  const std::vector<int>& column_indices,
                  const ::arrow::io::AsyncContext& ctx,
-                 const ::arrow::io::CacheOptions& options);
+                 const ::arrow::io::CacheOptions& options,
+                 int64_t max_buffered_bytes = 0);
 
  private:
   // Holds a pointer to an instance of Contents implementation
@@ -20,11 +20,14 @@
 
 #include "arrow/testing/gtest_compat.h"
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_writer.h"
 #include "parquet/file_reader.h"
 #include "parquet/file_writer.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
+#include "parquet/statistics.h"
 #include "parquet/test_util.h"
 #include "parquet/types.h"
 
@@ -451,6 +454,172 @@ TEST(ParquetRoundtrip, AllNulls) {
   EXPECT_THAT(def_levels, ElementsAre(0, 0, 0));
 }
 
+TEST(ParquetRoundtrip, BloomFilter) {
+  schema::NodeVector fields;
+  fields.push_back(PrimitiveNode::Make("filtered", Repetition::OPTIONAL, Type::INT64));
+  fields.push_back(PrimitiveNode::Make("plain", Repetition::REQUIRED, Type::INT64));
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+
+  BloomFilterOptions options;
+  options.ndv = 100;
+  auto writer_props =
+      WriterProperties::Builder().enable_bloom_filter("filtered", options)->build();
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema, writer_props);
+
+  std::vector<int64_t> values = {1, 2, 3};
+  std::vector<int16_t> def_levels = {1, 0, 1, 1};
+  for (bool buffered : {false, true}) {
+    auto rg_writer =
+        buffered ? file_writer->AppendBufferedRowGroup() : file_writer->AppendRowGroup();
+    auto filtered = static_cast<Int64Writer*>(buffered ? rg_writer->column(0)
+                                                       : rg_writer->NextColumn());
+    filtered->WriteBatch(4, def_levels.data(), nullptr, values.data());
+    auto plain = static_cast<Int64Writer*>(buffered ? rg_writer->column(1)
+                                                    : rg_writer->NextColumn());
+    std::vector<int64_t> plain_values = {10, 20, 30, 40};
+    plain->WriteBatch(4, nullptr, nullptr, plain_values.data());
+    rg_writer->Close();
+    for (auto& value : values) value += 100;
+  }
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  ASSERT_EQ(2, file_reader->metadata()->num_row_groups());
+  for (int r = 0; r < 2; ++r) {
+    auto rg_reader = file_reader->RowGroup(r);
+    ASSERT_TRUE(rg_reader->metadata()->ColumnChunk(0)->has_bloom_filter());
+    ASSERT_FALSE(rg_reader->metadata()->ColumnChunk(1)->has_bloom_filter());
+    ASSERT_EQ(nullptr, rg_reader->GetColumnBloomFilter(1));
+
+    auto bloom_filter = rg_reader->GetColumnBloomFilter(0);
+    ASSERT_NE(nullptr, bloom_filter);
+    const int64_t base = r * 100;
+    for (int64_t value : {base + 1, base + 2, base + 3}) {
+      ASSERT_TRUE(bloom_filter->FindHash(bloom_filter->Hash(value)));
+    }
+
+    // the column chunks themselves are still readable
+    auto column_reader = std::static_pointer_cast<Int64Reader>(rg_reader->Column(1));
+    std::vector<int64_t> read(4);
+    int64_t values_read;
+    column_reader->ReadBatch(4, nullptr, nullptr, read.data(), &values_read);
+    ASSERT_EQ(read, (std::vector<int64_t>{10, 20, 30, 40}));
+  }
+}
+
+TEST(ParquetRoundtrip, PageIndex) {
+  schema::NodeVector fields;
+  fields.push_back(PrimitiveNode::Make("indexed", Repetition::OPTIONAL, Type::INT64));
+  fields.push_back(PrimitiveNode::Make("plain", Repetition::REQUIRED, Type::INT64));
+  fields.push_back(PrimitiveNode::Make("repeated", Repetition::REPEATED, Type::INT64));
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+
+  // cut a page after every batch of two levels, even when they are null
+  auto writer_props = WriterProperties::Builder()
+                          .enable_write_page_index()
+                          ->disable_write_page_index("plain")
+                          ->disable_dictionary()
+                          ->data_pagesize(0)
+                          ->write_batch_size(2)
+                          ->build();
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema, writer_props);
+
+  // the second page only contains nulls
+  std::vector<int64_t> values = {1, 2, 5, 6};
+  std::vector<int16_t> def_levels = {1, 1, 0, 0, 1, 1};
+  std::vector<int64_t> plain_values = {10, 20, 30, 40, 50, 60};
+  for (bool buffered : {false, true}) {
+    auto rg_writer =
+        buffered ? file_writer->AppendBufferedRowGroup() : file_writer->AppendRowGroup();
+    auto indexed = static_cast<Int64Writer*>(buffered ? rg_writer->column(0)
+                                                      : rg_writer->NextColumn());
+    indexed->WriteBatch(6, def_levels.data(), nullptr, values.data());
+    auto plain = static_cast<Int64Writer*>(buffered ? rg_writer->column(1)
+                                                    : rg_writer->NextColumn());
+    plain->WriteBatch(6, nullptr, nullptr, plain_values.data());
+    auto repeated = static_cast<Int64Writer*>(buffered ? rg_writer->column(2)
+                                                       : rg_writer->NextColumn());
+    std::vector<int16_t> levels(6, 1), rep_levels(6, 0);
+    repeated->WriteBatch(6, levels.data(), rep_levels.data(), plain_values.data());
+    rg_writer->Close();
+  }
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  ASSERT_EQ(2, file_reader->metadata()->num_row_groups());
+  for (int r = 0; r < 2; ++r) {
+    auto rg_reader = file_reader->RowGroup(r);
+    ASSERT_FALSE(rg_reader->metadata()->ColumnChunk(1)->has_column_index());
+    ASSERT_FALSE(rg_reader->metadata()->ColumnChunk(1)->has_offset_index());
+    ASSERT_EQ(nullptr, rg_reader->GetColumnIndex(1));
+    ASSERT_EQ(nullptr, rg_reader->GetOffsetIndex(1));
+    // repeated columns have no page index
+    ASSERT_EQ(nullptr, rg_reader->GetColumnIndex(2));
+    ASSERT_EQ(nullptr, rg_reader->GetOffsetIndex(2));
+
+    auto offset_index = rg_reader->GetOffsetIndex(0);
+    ASSERT_NE(nullptr, offset_index);
+    ASSERT_EQ(3, offset_index->num_pages());
+    for (int page = 0; page < 3; ++page) {
+      ASSERT_EQ(page * 2, offset_index->page_locations()[page].first_row_index);
+      ASSERT_EQ(2, offset_index->page_num_rows(page, 6));
+    }
+
+    auto column_index = rg_reader->GetColumnIndex(0);
+    ASSERT_NE(nullptr, column_index);
+    ASSERT_EQ(3, column_index->num_pages());
+    ASSERT_EQ(BoundaryOrder::ASCENDING, column_index->boundary_order());
+    ASSERT_THAT(column_index->null_pages(), ElementsAre(false, true, false));
+    ASSERT_TRUE(column_index->has_null_counts());
+    ASSERT_THAT(column_index->null_counts(), ElementsAre(0, 2, 0));
+    auto page_stats =
+        std::static_pointer_cast<Int64Statistics>(column_index->page_statistics(2));
+    ASSERT_TRUE(page_stats->HasMinMax());
+    ASSERT_EQ(5, page_stats->min());
+    ASSERT_EQ(6, page_stats->max());
+    ASSERT_FALSE(column_index->page_statistics(1)->HasMinMax());
+
+    // the first page is found at its recorded location
+    auto page_reader = rg_reader->GetColumnPageReader(0);
+    auto first_page = page_reader->NextPage();
+    ASSERT_NE(nullptr, first_page);
+    ASSERT_EQ(rg_reader->metadata()->ColumnChunk(0)->data_page_offset(),
+              offset_index->page_locations()[0].offset);
+
+    // skip the data pages which can't contain 5
+    page_reader = rg_reader->GetColumnPageReader(0);
+    std::vector<int32_t> filtered_pages;
+    page_reader->set_data_page_filter([&](const DataPageStats& stats) {
+      filtered_pages.push_back(stats.page_ordinal);
+      return column_index->null_pages()[stats.page_ordinal] ||
+             std::static_pointer_cast<Int64Statistics>(
+                 column_index->page_statistics(stats.page_ordinal))
+                     ->max() < 5;
+    });
+    auto column_reader =
+        std::static_pointer_cast<Int64Reader>(ColumnReader::Make(
+            file_reader->metadata()->schema()->Column(0), std::move(page_reader)));
+    std::vector<int64_t> read(6);
+    std::vector<int16_t> read_def_levels(6);
+    int64_t values_read;
+    int64_t levels_read = column_reader->ReadBatch(6, read_def_levels.data(), nullptr,
+                                                   read.data(), &values_read);
+    ASSERT_EQ(2, levels_read);
+    ASSERT_EQ(2, values_read);
+    ASSERT_EQ(5, read[0]);
+    ASSERT_EQ(6, read[1]);
+    ASSERT_THAT(filtered_pages, ElementsAre(0, 1, 2));
+  }
+}
+
 }  // namespace test
 
 }  // namespace parquet
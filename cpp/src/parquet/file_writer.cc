@@ -23,11 +23,13 @@
 #include <utility>
 #include <vector>
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_writer.h"
 #include "parquet/deprecated_io.h"
 #include "parquet/encryption_internal.h"
 #include "parquet/exception.h"
 #include "parquet/internal_file_encryptor.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 #include "parquet/types.h"
@@ -135,11 +137,15 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     auto data_encryptor =
         file_encryptor_ ? file_encryptor_->GetColumnDataEncryptor(path->ToDotString())
                         : nullptr;
+    auto bloom_filter = MakeBloomFilter(col_meta, data_encryptor != nullptr);
+    auto page_index_builder = MakePageIndexBuilder(col_meta, data_encryptor != nullptr);
     std::unique_ptr<PageWriter> pager = PageWriter::Open(
         sink_, properties_->compression(path), properties_->compression_level(path),
         col_meta, row_group_ordinal_, static_cast<int16_t>(next_column_index_ - 1),
-        properties_->memory_pool(), false, meta_encryptor, data_encryptor);
-    column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_);
+        properties_->memory_pool(), false, meta_encryptor, data_encryptor,
+        page_index_builder);
+    column_writers_[0] =
+        ColumnWriter::Make(col_meta, std::move(pager), properties_, bloom_filter);
     return column_writers_[0].get();
   }
 
@@ -190,6 +196,8 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
       }
 
       column_writers_.clear();
+      WriteBloomFilters();
+      WritePageIndexes();
 
       // Ensures all columns have been written
       metadata_->set_num_rows(num_rows_);
@@ -241,17 +249,71 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
       auto data_encryptor =
           file_encryptor_ ? file_encryptor_->GetColumnDataEncryptor(path->ToDotString())
                           : nullptr;
+      auto bloom_filter = MakeBloomFilter(col_meta, data_encryptor != nullptr);
+      auto page_index_builder =
+          MakePageIndexBuilder(col_meta, data_encryptor != nullptr);
       std::unique_ptr<PageWriter> pager = PageWriter::Open(
           sink_, properties_->compression(path), properties_->compression_level(path),
           col_meta, static_cast<int16_t>(row_group_ordinal_),
           static_cast<int16_t>(next_column_index_++), properties_->memory_pool(),
-          buffered_row_group_, meta_encryptor, data_encryptor);
+          buffered_row_group_, meta_encryptor, data_encryptor, page_index_builder);
       column_writers_.push_back(
-          ColumnWriter::Make(col_meta, std::move(pager), properties_));
+          ColumnWriter::Make(col_meta, std::move(pager), properties_, bloom_filter));
     }
   }
 
+  // Make the Bloom filter of a column chunk, or return nullptr if none is written
+  BloomFilter* MakeBloomFilter(ColumnChunkMetaDataBuilder* col_meta, bool encrypted) {
+    const auto* options = properties_->bloom_filter_options(col_meta->descr()->path());
+    if (options == nullptr || encrypted ||
+        col_meta->descr()->physical_type() == Type::BOOLEAN) {
+      return nullptr;
+    }
+    std::unique_ptr<BlockSplitBloomFilter> bloom_filter(new BlockSplitBloomFilter());
+    bloom_filter->Init(BlockSplitBloomFilter::OptimalNumOfBits(
+                           static_cast<uint32_t>(options->ndv), options->fpp) /
+                       8);
+    bloom_filters_.emplace_back(col_meta, std::move(bloom_filter));
+    return bloom_filters_.back().second.get();
+  }
+
+  // Write the Bloom filters of the closed column chunks after them
+  void WriteBloomFilters() {
+    for (const auto& item : bloom_filters_) {
+      PARQUET_ASSIGN_OR_THROW(int64_t offset, sink_->Tell());
+      item.second->WriteTo(sink_.get());
+      item.first->SetBloomFilterOffset(offset);
+    }
+    bloom_filters_.clear();
+  }
+
+  // Make the page index builder of a column chunk, or return nullptr if none is written
+  PageIndexBuilder* MakePageIndexBuilder(ColumnChunkMetaDataBuilder* col_meta,
+                                         bool encrypted) {
+    const ColumnDescriptor* descr = col_meta->descr();
+    if (!properties_->page_index_enabled(descr->path()) || encrypted ||
+        descr->max_repetition_level() > 0) {
+      return nullptr;
+    }
+    page_index_builders_.emplace_back(col_meta,
+                                      std::unique_ptr<PageIndexBuilder>(
+                                          new PageIndexBuilder(descr)));
+    return page_index_builders_.back().second.get();
+  }
+
+  // Write the ColumnIndexes and OffsetIndexes of the closed column chunks after them
+  void WritePageIndexes() {
+    for (const auto& item : page_index_builders_) {
+      item.second->WriteTo(sink_.get(), item.first);
+    }
+    page_index_builders_.clear();
+  }
+
   std::vector<std::shared_ptr<ColumnWriter>> column_writers_;
+  std::vector<std::pair<ColumnChunkMetaDataBuilder*, std::unique_ptr<BloomFilter>>>
+      bloom_filters_;
+  std::vector<std::pair<ColumnChunkMetaDataBuilder*, std::unique_ptr<PageIndexBuilder>>>
+      page_index_builders_;
 };
 
 // ----------------------------------------------------------------------
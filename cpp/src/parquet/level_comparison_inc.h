@@ -17,6 +17,7 @@
 #pragma once
 
 #include "arrow/util/bit_util.h"
+#include "arrow/util/simd.h"
 #include "parquet/level_comparison.h"
 
 // Used to make sure ODR rule isn't violated.
@@ -56,7 +57,40 @@ inline MinMax FindMinMaxImpl(const int16_t* levels, int64_t num_levels) {
 
 inline uint64_t GreaterThanBitmapImpl(const int16_t* levels, int64_t num_levels,
                                       int16_t rhs) {
-  return LevelsToBitmap(levels, num_levels, [rhs](int16_t value) { return value > rhs; });
+  // The compilers don't vectorize LevelsToBitmap for all the widths of the loop
+  // counter and shifts, so that the whole blocks of levels are compared explicitly
+  uint64_t mask = 0;
+  int64_t x = 0;
+#if defined(ARROW_HAVE_AVX2)
+  const __m256i rhs_vector = _mm256_set1_epi16(rhs);
+  for (; x + 32 <= num_levels; x += 32) {
+    const __m256i lower = _mm256_cmpgt_epi16(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(levels + x)), rhs_vector);
+    const __m256i upper = _mm256_cmpgt_epi16(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(levels + x + 16)),
+        rhs_vector);
+    // Packing interleaves the 128-bit lanes of its inputs
+    const __m256i packed =
+        _mm256_permute4x64_epi64(_mm256_packs_epi16(lower, upper), 0xD8);
+    mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(packed)))
+            << x;
+  }
+#elif defined(ARROW_HAVE_SSE4_2)
+  const __m128i rhs_vector = _mm_set1_epi16(rhs);
+  for (; x + 16 <= num_levels; x += 16) {
+    const __m128i lower = _mm_cmpgt_epi16(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(levels + x)), rhs_vector);
+    const __m128i upper = _mm_cmpgt_epi16(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(levels + x + 8)), rhs_vector);
+    mask |= static_cast<uint64_t>(static_cast<uint16_t>(
+                _mm_movemask_epi8(_mm_packs_epi16(lower, upper))))
+            << x;
+  }
+#endif
+  for (; x < num_levels; x++) {
+    mask |= static_cast<uint64_t>(levels[x] > rhs ? 1 : 0) << x;
+  }
+  return ::arrow::BitUtil::ToLittleEndian(mask);
 }
 
 }  // namespace PARQUET_IMPL_NAMESPACE
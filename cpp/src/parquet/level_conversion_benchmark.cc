@@ -78,3 +78,48 @@ void BM_DefinitionLevelsToBitmapRepeatedMostPresent(::benchmark::State& state) {
 }
 
 BENCHMARK(BM_DefinitionLevelsToBitmapRepeatedMostPresent);
+
+// list<struct<...>> levels: lists of list_length elements, every tenth list being
+// empty and every tenth element null.
+void RunDefRepLevelsToList(int list_length, ::benchmark::State* state) {
+  std::vector<int16_t> def_levels;
+  std::vector<int16_t> rep_levels;
+  for (int list = 0; def_levels.size() < kLevelCount; list++) {
+    if (list % 10 == 0) {
+      def_levels.push_back(/*empty list=*/1);
+      rep_levels.push_back(0);
+      continue;
+    }
+    for (int x = 0; x < list_length; x++) {
+      def_levels.push_back(x % 10 == 0 ? /*null element=*/2 : /*present=*/3);
+      rep_levels.push_back(x == 0 ? 0 : 1);
+    }
+  }
+  parquet::internal::LevelInfo info;
+  info.def_level = 2;
+  info.rep_level = 1;
+  std::vector<uint8_t> bitmap(def_levels.size() / 8 + 1, 0);
+  std::vector<int32_t> offsets(def_levels.size() + 1, 0);
+  for (auto _ : *state) {
+    parquet::internal::ValidityBitmapInputOutput validity_io;
+    validity_io.values_read_upper_bound = def_levels.size();
+    validity_io.valid_bits = bitmap.data();
+    parquet::internal::DefRepLevelsToList(def_levels.data(), rep_levels.data(),
+                                          def_levels.size(), info, &validity_io,
+                                          offsets.data());
+    ::benchmark::DoNotOptimize(offsets);
+  }
+  state->SetBytesProcessed(int64_t(state->iterations()) * def_levels.size());
+}
+
+void BM_DefRepLevelsToListShortLists(::benchmark::State& state) {
+  RunDefRepLevelsToList(/*list_length=*/3, &state);
+}
+
+BENCHMARK(BM_DefRepLevelsToListShortLists);
+
+void BM_DefRepLevelsToListLongLists(::benchmark::State& state) {
+  RunDefRepLevelsToList(/*list_length=*/50, &state);
+}
+
+BENCHMARK(BM_DefRepLevelsToListLongLists);
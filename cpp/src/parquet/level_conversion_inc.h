@@ -21,6 +21,8 @@
 #include <algorithm>
 #include <cstdint>
 #include <limits>
+#include <memory>
+#include <sstream>
 
 #include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
@@ -351,6 +353,117 @@ void DefLevelsToBitmapSimd(const int16_t* def_levels, int64_t num_def_levels,
   writer.Finish();
 }
 
+// Adds num_elements to the current list's offset
+template <typename OffsetType>
+inline void AddListElements(int64_t num_elements, OffsetType* offset) {
+  if (ARROW_PREDICT_FALSE(num_elements >
+                          std::numeric_limits<OffsetType>::max() - *offset)) {
+    throw ParquetException("List index overflow.");
+  }
+  *offset += static_cast<OffsetType>(num_elements);
+}
+
+// Converts up to kExtractBitsSize levels, comparing them a batch at a time rather
+// than branching on each of them, so that the cost is per list rather than per
+// level. Returns the number of lists started in the batch.
+template <typename OffsetType>
+int64_t DefRepLevelsBatchToList(const int16_t* def_levels, const int16_t* rep_levels,
+                                int64_t batch_size, int64_t upper_bound_remaining,
+                                LevelInfo level_info,
+                                ::arrow::internal::FirstTimeBitmapWriter* writer,
+                                int64_t* null_count, OffsetType** offsets) {
+  DCHECK_LE(batch_size, kExtractBitsSize);
+  // Items of empty or null ancestor lists and of further nested lists belong to no
+  // list at this level
+  auto nested_bitmap = static_cast<extract_bitmap_t>(
+      internal::GreaterThanBitmap(rep_levels, batch_size, level_info.rep_level));
+  auto ancestor_present_bitmap =
+      static_cast<extract_bitmap_t>(internal::GreaterThanBitmap(
+          def_levels, batch_size, level_info.repeated_ancestor_def_level - 1));
+  const extract_bitmap_t selected_bitmap = ancestor_present_bitmap & ~nested_bitmap;
+  // A repetition level below the list's starts a new list, one equal to it continues
+  // the current one
+  auto repeated_bitmap = static_cast<extract_bitmap_t>(
+      internal::GreaterThanBitmap(rep_levels, batch_size, level_info.rep_level - 1));
+  const extract_bitmap_t starts_bitmap = selected_bitmap & ~repeated_bitmap;
+  const int64_t num_starts = ::arrow::BitUtil::PopCount(starts_bitmap);
+  if (ARROW_PREDICT_FALSE((writer != nullptr || *offsets != nullptr) &&
+                          num_starts > upper_bound_remaining)) {
+    std::stringstream ss;
+    ss << "Definition levels exceeded upper bound: " << upper_bound_remaining;
+    throw ParquetException(ss.str());
+  }
+
+  if (*offsets != nullptr) {
+    // The level_info def level for lists reflects element present level
+    auto present_bitmap = static_cast<extract_bitmap_t>(
+        internal::GreaterThanBitmap(def_levels, batch_size, level_info.def_level - 1));
+    extract_bitmap_t elements_bitmap =
+        (selected_bitmap & repeated_bitmap) | (starts_bitmap & present_bitmap);
+    OffsetType* offset = *offsets;
+    extract_bitmap_t remaining_starts = starts_bitmap;
+    while (remaining_starts != 0) {
+      // The elements before the start belong to the previous list
+      const int start = ::arrow::BitUtil::CountTrailingZeros(remaining_starts);
+      const extract_bitmap_t before_start = (extract_bitmap_t{1} << start) - 1;
+      AddListElements(::arrow::BitUtil::PopCount(elements_bitmap & before_start),
+                      offset);
+      elements_bitmap &= ~before_start;
+      // Use cumulative offsets because variable size lists are more common then
+      // fixed size lists so it should be cheaper to make these cumulative and
+      // subtract when validating fixed size lists.
+      ++offset;
+      *offset = *(offset - 1);
+      remaining_starts &= remaining_starts - 1;
+    }
+    AddListElements(::arrow::BitUtil::PopCount(elements_bitmap), offset);
+    *offsets = offset;
+  }
+
+  if (writer != nullptr) {
+    // The prior level distinguishes between null and empty lists
+    auto defined_bitmap = static_cast<extract_bitmap_t>(
+        internal::GreaterThanBitmap(def_levels, batch_size, level_info.def_level - 2));
+    const extract_bitmap_t valid_bits = ExtractBits(defined_bitmap, starts_bitmap);
+    writer->AppendWord(valid_bits, num_starts);
+    *null_count += num_starts - ::arrow::BitUtil::PopCount(valid_bits);
+  }
+  return num_starts;
+}
+
+template <typename OffsetType>
+void DefRepLevelsToListSimd(const int16_t* def_levels, const int16_t* rep_levels,
+                            int64_t num_def_levels, LevelInfo level_info,
+                            ValidityBitmapInputOutput* output, OffsetType* offsets) {
+  std::unique_ptr<::arrow::internal::FirstTimeBitmapWriter> valid_bits_writer;
+  if (output->valid_bits) {
+    valid_bits_writer.reset(new ::arrow::internal::FirstTimeBitmapWriter(
+        output->valid_bits, output->valid_bits_offset, num_def_levels));
+  }
+  const bool has_output = offsets != nullptr || valid_bits_writer != nullptr;
+  int64_t num_lists = 0;
+  while (num_def_levels > 0) {
+    const int64_t batch_size = std::min(num_def_levels, kExtractBitsSize);
+    num_lists += DefRepLevelsBatchToList(
+        def_levels, rep_levels, batch_size, output->values_read_upper_bound - num_lists,
+        level_info, valid_bits_writer.get(), &output->null_count, &offsets);
+    def_levels += batch_size;
+    rep_levels += batch_size;
+    num_def_levels -= batch_size;
+  }
+  if (valid_bits_writer != nullptr) {
+    valid_bits_writer->Finish();
+  }
+  if (has_output) {
+    output->values_read = num_lists;
+  }
+  if (output->null_count > 0 && level_info.null_slot_usage > 1) {
+    throw ParquetException(
+        "Null values with null_slot_usage > 1 not supported."
+        "(i.e. FixedSizeLists with null values are not supported)");
+  }
+}
+
 }  // namespace PARQUET_IMPL_NAMESPACE
 }  // namespace internal
 }  // namespace parquet
@@ -23,6 +23,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -315,6 +316,36 @@ TYPED_TEST(NestedListTest, SimpleLongList) {
             "1");
 }
 
+TYPED_TEST(NestedListTest, NullAndEmptyListsAcrossBatches) {
+  LevelInfo level_info;
+  level_info.rep_level = 1;
+  level_info.def_level = 2;
+  level_info.repeated_ancestor_def_level = 0;
+
+  // 30 times: null, [], [1, 2]
+  MultiLevelTestData test_data;
+  std::vector<typename TypeParam::OffsetsType> expected_offsets = {0};
+  std::string expected_validity;
+  for (int x = 0; x < 30; x++) {
+    test_data.def_levels.insert(test_data.def_levels.end(), {0, 1, 2, 2});
+    test_data.rep_levels.insert(test_data.rep_levels.end(), {0, 0, 0, 1});
+    const auto offset = expected_offsets.back();
+    expected_offsets.insert(expected_offsets.end(), {offset, offset, offset + 2});
+    expected_validity += "011";
+  }
+  this->InitForLength(90);
+  typename TypeParam::OffsetsType* next_position = this->Run(test_data, level_info);
+
+  EXPECT_EQ(next_position, this->offsets_.data() + 90);
+  EXPECT_THAT(this->offsets_, testing::ElementsAreArray(expected_offsets));
+
+  EXPECT_EQ(this->validity_io_.values_read, 90);
+  EXPECT_EQ(this->validity_io_.null_count, 30);
+  std::string validity = BitmapToString(this->validity_io_.valid_bits, /*length=*/90);
+  validity.erase(std::remove(validity.begin(), validity.end(), ' '), validity.end());
+  EXPECT_EQ(validity, expected_validity);
+}
+
 TYPED_TEST(NestedListTest, TestOverflow) {
   LevelInfo level_info;
   level_info.rep_level = 1;
@@ -20,8 +20,11 @@
 #include <inttypes.h>
 
 #include <algorithm>
+#include <list>
+#include <mutex>
 #include <ostream>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -237,14 +240,6 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
         }
       }
     }
-    for (const auto& encoding : column_metadata_->encodings) {
-      encodings_.push_back(LoadEnumSafe(&encoding));
-    }
-    for (const auto& encoding_stats : column_metadata_->encoding_stats) {
-      encoding_stats_.push_back({LoadEnumSafe(&encoding_stats.page_type),
-                                 LoadEnumSafe(&encoding_stats.encoding),
-                                 encoding_stats.count});
-    }
     possible_stats_ = nullptr;
   }
   // column chunk
@@ -286,9 +281,29 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
     return LoadEnumSafe(&column_metadata_->codec);
   }
 
-  const std::vector<Encoding::type>& encodings() const { return encodings_; }
+  // The encodings are only converted when requested, as most readers of wide files
+  // only look at a few of the column chunks they create the metadata of
+  const std::vector<Encoding::type>& encodings() const {
+    if (encodings_.size() != column_metadata_->encodings.size()) {
+      encodings_.clear();
+      for (const auto& encoding : column_metadata_->encodings) {
+        encodings_.push_back(LoadEnumSafe(&encoding));
+      }
+    }
+    return encodings_;
+  }
 
-  const std::vector<PageEncodingStats>& encoding_stats() const { return encoding_stats_; }
+  const std::vector<PageEncodingStats>& encoding_stats() const {
+    if (encoding_stats_.size() != column_metadata_->encoding_stats.size()) {
+      encoding_stats_.clear();
+      for (const auto& encoding_stats : column_metadata_->encoding_stats) {
+        encoding_stats_.push_back({LoadEnumSafe(&encoding_stats.page_type),
+                                   LoadEnumSafe(&encoding_stats.encoding),
+                                   encoding_stats.count});
+      }
+    }
+    return encoding_stats_;
+  }
 
   inline bool has_dictionary_page() const {
     return column_metadata_->__isset.dictionary_page_offset;
@@ -306,6 +321,26 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
 
   inline int64_t index_page_offset() const { return column_metadata_->index_page_offset; }
 
+  inline bool has_bloom_filter() const {
+    return column_metadata_->__isset.bloom_filter_offset;
+  }
+
+  inline int64_t bloom_filter_offset() const {
+    return column_metadata_->bloom_filter_offset;
+  }
+
+  inline bool has_column_index() const { return column_->__isset.column_index_offset; }
+
+  inline int64_t column_index_offset() const { return column_->column_index_offset; }
+
+  inline int32_t column_index_length() const { return column_->column_index_length; }
+
+  inline bool has_offset_index() const { return column_->__isset.offset_index_offset; }
+
+  inline int64_t offset_index_offset() const { return column_->offset_index_offset; }
+
+  inline int32_t offset_index_length() const { return column_->offset_index_length; }
+
   inline int64_t total_compressed_size() const {
     return column_metadata_->total_compressed_size;
   }
@@ -325,8 +360,8 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
 
  private:
   mutable std::shared_ptr<Statistics> possible_stats_;
-  std::vector<Encoding::type> encodings_;
-  std::vector<PageEncodingStats> encoding_stats_;
+  mutable std::vector<Encoding::type> encodings_;
+  mutable std::vector<PageEncodingStats> encoding_stats_;
   const format::ColumnChunk* column_;
   const format::ColumnMetaData* column_metadata_;
   format::ColumnMetaData decrypted_metadata_;
@@ -389,6 +424,32 @@ int64_t ColumnChunkMetaData::index_page_offset() const {
   return impl_->index_page_offset();
 }
 
+bool ColumnChunkMetaData::has_bloom_filter() const { return impl_->has_bloom_filter(); }
+
+int64_t ColumnChunkMetaData::bloom_filter_offset() const {
+  return impl_->bloom_filter_offset();
+}
+
+bool ColumnChunkMetaData::has_column_index() const { return impl_->has_column_index(); }
+
+int64_t ColumnChunkMetaData::column_index_offset() const {
+  return impl_->column_index_offset();
+}
+
+int32_t ColumnChunkMetaData::column_index_length() const {
+  return impl_->column_index_length();
+}
+
+bool ColumnChunkMetaData::has_offset_index() const { return impl_->has_offset_index(); }
+
+int64_t ColumnChunkMetaData::offset_index_offset() const {
+  return impl_->offset_index_offset();
+}
+
+int32_t ColumnChunkMetaData::offset_index_length() const {
+  return impl_->offset_index_length();
+}
+
 Compression::type ColumnChunkMetaData::compression() const {
   return impl_->compression();
 }
@@ -816,6 +877,114 @@ void FileMetaData::WriteTo(::arrow::io::OutputStream* dst,
   return impl_->WriteTo(dst, encryptor);
 }
 
+class FileMetaDataCache::FileMetaDataCacheImpl {
+ public:
+  explicit FileMetaDataCacheImpl(int64_t capacity) : capacity_(capacity), size_(0) {}
+
+  std::shared_ptr<FileMetaData> Get(const std::string& path, int64_t file_size,
+                                    int64_t mtime_ns) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_by_path_.find(path);
+    if (it == entries_by_path_.end()) return nullptr;
+    if (it->second->file_size != file_size || it->second->mtime_ns != mtime_ns) {
+      // The file was rewritten
+      EraseLocked(it);
+      return nullptr;
+    }
+    lru_entries_.splice(lru_entries_.begin(), lru_entries_, it->second);
+    return it->second->metadata;
+  }
+
+  void Put(const std::string& path, int64_t file_size, int64_t mtime_ns,
+           std::shared_ptr<FileMetaData> metadata) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_by_path_.find(path);
+    if (it != entries_by_path_.end()) {
+      EraseLocked(it);
+    }
+    const int64_t entry_size = metadata->size();
+    if (entry_size > capacity_) return;
+    lru_entries_.push_front({path, file_size, mtime_ns, std::move(metadata)});
+    entries_by_path_[path] = lru_entries_.begin();
+    size_ += entry_size;
+    while (size_ > capacity_) {
+      EraseLocked(entries_by_path_.find(lru_entries_.back().path));
+    }
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_by_path_.clear();
+    lru_entries_.clear();
+    size_ = 0;
+  }
+
+  int64_t capacity() const { return capacity_; }
+
+  int64_t size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_;
+  }
+
+  int64_t num_entries() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int64_t>(lru_entries_.size());
+  }
+
+ private:
+  struct Entry {
+    std::string path;
+    int64_t file_size;
+    int64_t mtime_ns;
+    std::shared_ptr<FileMetaData> metadata;
+  };
+  using EntryList = std::list<Entry>;
+
+  void EraseLocked(std::unordered_map<std::string, EntryList::iterator>::iterator it) {
+    size_ -= it->second->metadata->size();
+    lru_entries_.erase(it->second);
+    entries_by_path_.erase(it);
+  }
+
+  const int64_t capacity_;
+  int64_t size_;
+  // Most recently used first
+  EntryList lru_entries_;
+  std::unordered_map<std::string, EntryList::iterator> entries_by_path_;
+  std::mutex mutex_;
+};
+
+constexpr int64_t FileMetaDataCache::kDefaultCapacity;
+
+FileMetaDataCache::FileMetaDataCache(int64_t capacity)
+    : impl_(new FileMetaDataCacheImpl(capacity)) {}
+
+FileMetaDataCache::~FileMetaDataCache() {}
+
+const std::shared_ptr<FileMetaDataCache>& FileMetaDataCache::Global() {
+  static std::shared_ptr<FileMetaDataCache> cache = std::make_shared<FileMetaDataCache>();
+  return cache;
+}
+
+std::shared_ptr<FileMetaData> FileMetaDataCache::Get(const std::string& path,
+                                                     int64_t file_size,
+                                                     int64_t mtime_ns) {
+  return impl_->Get(path, file_size, mtime_ns);
+}
+
+void FileMetaDataCache::Put(const std::string& path, int64_t file_size,
+                            int64_t mtime_ns, std::shared_ptr<FileMetaData> metadata) {
+  impl_->Put(path, file_size, mtime_ns, std::move(metadata));
+}
+
+void FileMetaDataCache::Clear() { impl_->Clear(); }
+
+int64_t FileMetaDataCache::capacity() const { return impl_->capacity(); }
+
+int64_t FileMetaDataCache::size() const { return impl_->size(); }
+
+int64_t FileMetaDataCache::num_entries() const { return impl_->num_entries(); }
+
 class FileCryptoMetaData::FileCryptoMetaDataImpl {
  public:
   FileCryptoMetaDataImpl() {}
@@ -1012,6 +1181,20 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
     column_chunk_->meta_data.__set_statistics(ToThrift(val));
   }
 
+  void SetBloomFilterOffset(int64_t offset) {
+    column_chunk_->meta_data.__set_bloom_filter_offset(offset);
+  }
+
+  void SetColumnIndexLocation(int64_t offset, int32_t length) {
+    column_chunk_->__set_column_index_offset(offset);
+    column_chunk_->__set_column_index_length(length);
+  }
+
+  void SetOffsetIndexLocation(int64_t offset, int32_t length) {
+    column_chunk_->__set_offset_index_offset(offset);
+    column_chunk_->__set_offset_index_length(length);
+  }
+
   void Finish(int64_t num_values, int64_t dictionary_page_offset,
               int64_t index_page_offset, int64_t data_page_offset,
               int64_t compressed_size, int64_t uncompressed_size, bool has_dictionary,
@@ -1042,8 +1225,15 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
       } else {
         thrift_encodings.push_back(ToThrift(properties_->dictionary_page_encoding()));
       }
-    } else {  // Dictionary not enabled
+    } else if (data_encoding_stats.empty()) {  // Dictionary not enabled
       thrift_encodings.push_back(ToThrift(properties_->encoding(column_->path())));
+    } else {
+      // The column writer may have chosen the encoding of the data pages itself
+      for (const auto& entry : data_encoding_stats) {
+        if (entry.first != Encoding::RLE) {
+          thrift_encodings.push_back(ToThrift(entry.first));
+        }
+      }
     }
     thrift_encodings.push_back(ToThrift(Encoding::RLE));
     // Only PLAIN encoding is supported for fallback in V1
@@ -1211,6 +1401,18 @@ void ColumnChunkMetaDataBuilder::SetStatistics(const EncodedStatistics& result)
   impl_->SetStatistics(result);
 }
 
+void ColumnChunkMetaDataBuilder::SetBloomFilterOffset(int64_t offset) {
+  impl_->SetBloomFilterOffset(offset);
+}
+
+void ColumnChunkMetaDataBuilder::SetColumnIndexLocation(int64_t offset, int32_t length) {
+  impl_->SetColumnIndexLocation(offset, length);
+}
+
+void ColumnChunkMetaDataBuilder::SetOffsetIndexLocation(int64_t offset, int32_t length) {
+  impl_->SetOffsetIndexLocation(offset, length);
+}
+
 int64_t ColumnChunkMetaDataBuilder::total_compressed_size() const {
   return impl_->total_compressed_size();
 }
@@ -165,6 +165,14 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   int64_t data_page_offset() const;
   bool has_index_page() const;
   int64_t index_page_offset() const;
+  bool has_bloom_filter() const;
+  int64_t bloom_filter_offset() const;
+  bool has_column_index() const;
+  int64_t column_index_offset() const;
+  int32_t column_index_length() const;
+  bool has_offset_index() const;
+  int64_t offset_index_offset() const;
+  int32_t offset_index_length() const;
   int64_t total_compressed_size() const;
   int64_t total_uncompressed_size() const;
   std::unique_ptr<ColumnCryptoMetaData> crypto_metadata() const;
@@ -349,6 +357,48 @@ class PARQUET_EXPORT FileMetaData {
   std::unique_ptr<FileMetaDataImpl> impl_;
 };
 
+/// \brief A size-bounded cache of decoded file footers.
+///
+/// Decoding the footer dominates the cost of opening files with many columns.
+/// Readers given a cache (see ReaderProperties::set_metadata_cache) reuse the
+/// FileMetaData decoded when the same file was last opened, as long as its size
+/// and modification time did not change. The least recently used footers are
+/// evicted once the total size of the cached footers (see FileMetaData::size)
+/// exceeds the capacity.
+///
+/// The cached FileMetaData are shared by all the readers of a file and must not
+/// be modified (e.g. with set_file_path or AppendRowGroups).
+class PARQUET_EXPORT FileMetaDataCache {
+ public:
+  static constexpr int64_t kDefaultCapacity = 64 << 20;
+
+  explicit FileMetaDataCache(int64_t capacity = kDefaultCapacity);
+  ~FileMetaDataCache();
+
+  /// \brief The cache shared by the whole process, with the default capacity.
+  static const std::shared_ptr<FileMetaDataCache>& Global();
+
+  /// \brief Return the metadata of the file at path, or null if it is not cached
+  /// or the file changed since.
+  std::shared_ptr<FileMetaData> Get(const std::string& path, int64_t file_size,
+                                    int64_t mtime_ns);
+
+  /// \brief Cache the metadata of a file, replacing any previous version.
+  void Put(const std::string& path, int64_t file_size, int64_t mtime_ns,
+           std::shared_ptr<FileMetaData> metadata);
+
+  void Clear();
+
+  int64_t capacity() const;
+  /// \brief The total size of the cached footers.
+  int64_t size() const;
+  int64_t num_entries() const;
+
+ private:
+  class FileMetaDataCacheImpl;
+  std::unique_ptr<FileMetaDataCacheImpl> impl_;
+};
+
 class PARQUET_EXPORT FileCryptoMetaData {
  public:
   // API convenience to get a MetaData accessor
@@ -389,6 +439,11 @@ class PARQUET_EXPORT ColumnChunkMetaDataBuilder {
   void set_file_path(const std::string& path);
   // column metadata
   void SetStatistics(const EncodedStatistics& stats);
+  // file offset of the column's Bloom filter, set after Finish
+  void SetBloomFilterOffset(int64_t offset);
+  // file location of the column's page index, set after Finish
+  void SetColumnIndexLocation(int64_t offset, int32_t length);
+  void SetOffsetIndexLocation(int64_t offset, int32_t length);
   // get the column descriptor
   const ColumnDescriptor* descr() const;
 
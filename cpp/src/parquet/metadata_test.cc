@@ -239,6 +239,56 @@ TEST(Metadata, TestV1Version) {
   ASSERT_EQ(ParquetVersion::PARQUET_1_0, f_accessor->version());
 }
 
+TEST(Metadata, FileMetaDataCache) {
+  parquet::schema::NodeVector fields;
+  fields.push_back(parquet::schema::Int32("int_col", Repetition::REQUIRED));
+  fields.push_back(parquet::schema::Float("float_col", Repetition::REQUIRED));
+  parquet::SchemaDescriptor schema;
+  schema.Init(parquet::schema::GroupNode::Make("schema", Repetition::REPEATED, fields));
+  auto props = WriterProperties::Builder().build();
+  // Round trip to get metadata of a known serialized size
+  std::string serialized = GenerateTableMetaData(schema, props, 1000, EncodedStatistics(),
+                                                 EncodedStatistics())
+                               ->SerializeToString();
+  auto make_metadata = [&]() {
+    uint32_t len = static_cast<uint32_t>(serialized.size());
+    return FileMetaData::Make(serialized.data(), &len);
+  };
+  const int64_t entry_size = static_cast<int64_t>(serialized.size());
+
+  FileMetaDataCache cache(2 * entry_size);
+  ASSERT_EQ(nullptr, cache.Get("a", 100, 1));
+  auto a = make_metadata();
+  auto b = make_metadata();
+  cache.Put("a", 100, 1, a);
+  cache.Put("b", 100, 1, b);
+  ASSERT_EQ(2, cache.num_entries());
+  ASSERT_EQ(2 * entry_size, cache.size());
+  ASSERT_EQ(a.get(), cache.Get("a", 100, 1).get());
+
+  // b is the least recently used
+  cache.Put("c", 100, 1, make_metadata());
+  ASSERT_EQ(2, cache.num_entries());
+  ASSERT_EQ(nullptr, cache.Get("b", 100, 1));
+  ASSERT_NE(nullptr, cache.Get("a", 100, 1));
+  ASSERT_NE(nullptr, cache.Get("c", 100, 1));
+
+  // A rewritten file is not served from the cache
+  ASSERT_EQ(nullptr, cache.Get("a", 100, 2));
+  ASSERT_EQ(nullptr, cache.Get("a", 100, 1));
+  ASSERT_EQ(1, cache.num_entries());
+  ASSERT_EQ(entry_size, cache.size());
+
+  // Neither is metadata larger than the cache
+  FileMetaDataCache small_cache(entry_size - 1);
+  small_cache.Put("a", 100, 1, a);
+  ASSERT_EQ(0, small_cache.num_entries());
+
+  cache.Clear();
+  ASSERT_EQ(0, cache.num_entries());
+  ASSERT_EQ(0, cache.size());
+}
+
 TEST(ApplicationVersion, Basics) {
   ApplicationVersion version("parquet-mr version 1.7.9");
   ApplicationVersion version1("parquet-mr version 1.8.0");
@@ -0,0 +1,228 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/page_index.h"
+
+#include <utility>
+
+#include "arrow/util/logging.h"
+#include "parquet/exception.h"
+#include "parquet/metadata.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+#include "parquet/thrift_internal.h"
+
+namespace parquet {
+
+// ----------------------------------------------------------------------
+// OffsetIndex
+
+std::unique_ptr<OffsetIndex> OffsetIndex::Make(const void* serialized_index,
+                                               uint32_t index_len) {
+  format::OffsetIndex offset_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &offset_index);
+  std::vector<PageLocation> page_locations;
+  page_locations.reserve(offset_index.page_locations.size());
+  int64_t previous_first_row_index = -1;
+  for (const auto& location : offset_index.page_locations) {
+    if (location.offset < 0 || location.compressed_page_size < 0 ||
+        location.first_row_index <= previous_first_row_index) {
+      throw ParquetException("Invalid page location in OffsetIndex");
+    }
+    previous_first_row_index = location.first_row_index;
+    page_locations.push_back(
+        {location.offset, location.compressed_page_size, location.first_row_index});
+  }
+  return std::unique_ptr<OffsetIndex>(new OffsetIndex(std::move(page_locations)));
+}
+
+int64_t OffsetIndex::page_num_rows(int i, int64_t row_group_num_rows) const {
+  DCHECK_LT(i, num_pages());
+  const int64_t end = i + 1 < num_pages() ? page_locations_[i + 1].first_row_index
+                                          : row_group_num_rows;
+  return end - page_locations_[i].first_row_index;
+}
+
+// ----------------------------------------------------------------------
+// ColumnIndex
+
+std::unique_ptr<ColumnIndex> ColumnIndex::Make(const ColumnDescriptor* descr,
+                                               const void* serialized_index,
+                                               uint32_t index_len) {
+  format::ColumnIndex column_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &column_index);
+  const size_t num_pages = column_index.null_pages.size();
+  if (column_index.min_values.size() != num_pages ||
+      column_index.max_values.size() != num_pages ||
+      (column_index.__isset.null_counts &&
+       column_index.null_counts.size() != num_pages)) {
+    throw ParquetException("Invalid ColumnIndex: lists have different lengths");
+  }
+
+  std::unique_ptr<ColumnIndex> out(new ColumnIndex(descr));
+  out->null_pages_ = std::move(column_index.null_pages);
+  out->min_values_ = std::move(column_index.min_values);
+  out->max_values_ = std::move(column_index.max_values);
+  // An unknown boundary order of a corrupt file is treated as unordered
+  const auto boundary_order = internal::LoadEnumRaw(&column_index.boundary_order);
+  if (boundary_order == format::BoundaryOrder::ASCENDING ||
+      boundary_order == format::BoundaryOrder::DESCENDING) {
+    out->boundary_order_ = static_cast<BoundaryOrder::type>(boundary_order);
+  }
+  out->has_null_counts_ = column_index.__isset.null_counts;
+  out->null_counts_ = std::move(column_index.null_counts);
+  return out;
+}
+
+std::shared_ptr<Statistics> ColumnIndex::page_statistics(int i) const {
+  DCHECK_LT(i, num_pages());
+  const int64_t null_count = has_null_counts_ ? null_counts_[i] : 0;
+  // The number of values of a page is not part of its ColumnIndex
+  return Statistics::Make(descr_, min_values_[i], max_values_[i], /*num_values=*/-1,
+                          null_count, /*distinct_count=*/0,
+                          /*has_min_max=*/!null_pages_[i]);
+}
+
+// ----------------------------------------------------------------------
+// PageIndexBuilder
+
+namespace {
+
+// Whether the pages' min and max values never decrease (or never increase)
+template <typename DType>
+BoundaryOrder::type ComputeBoundaryOrder(const ColumnDescriptor* descr,
+                                         const std::vector<bool>& null_pages,
+                                         const std::vector<std::string>& min_values,
+                                         const std::vector<std::string>& max_values) {
+  auto comparator = MakeComparator<DType>(descr);
+  bool ascending = true, descending = true;
+  std::shared_ptr<TypedStatistics<DType>> previous;
+  for (size_t i = 0; i < null_pages.size() && (ascending || descending); ++i) {
+    if (null_pages[i]) continue;
+    auto current = MakeStatistics<DType>(descr, min_values[i], max_values[i],
+                                         /*num_values=*/0, /*null_count=*/0,
+                                         /*distinct_count=*/0, /*has_min_max=*/true);
+    if (previous != nullptr) {
+      if (comparator->Compare(current->min(), previous->min()) ||
+          comparator->Compare(current->max(), previous->max())) {
+        ascending = false;
+      }
+      if (comparator->Compare(previous->min(), current->min()) ||
+          comparator->Compare(previous->max(), current->max())) {
+        descending = false;
+      }
+    }
+    previous = std::move(current);
+  }
+  // Fewer than two non-null pages are trivially ascending
+  return ascending ? BoundaryOrder::ASCENDING
+                   : descending ? BoundaryOrder::DESCENDING : BoundaryOrder::UNORDERED;
+}
+
+BoundaryOrder::type ComputeBoundaryOrder(const ColumnDescriptor* descr,
+                                         const std::vector<bool>& null_pages,
+                                         const std::vector<std::string>& min_values,
+                                         const std::vector<std::string>& max_values) {
+  switch (descr->physical_type()) {
+    case Type::BOOLEAN:
+      return ComputeBoundaryOrder<BooleanType>(descr, null_pages, min_values, max_values);
+    case Type::INT32:
+      return ComputeBoundaryOrder<Int32Type>(descr, null_pages, min_values, max_values);
+    case Type::INT64:
+      return ComputeBoundaryOrder<Int64Type>(descr, null_pages, min_values, max_values);
+    case Type::FLOAT:
+      return ComputeBoundaryOrder<FloatType>(descr, null_pages, min_values, max_values);
+    case Type::DOUBLE:
+      return ComputeBoundaryOrder<DoubleType>(descr, null_pages, min_values, max_values);
+    case Type::BYTE_ARRAY:
+      return ComputeBoundaryOrder<ByteArrayType>(descr, null_pages, min_values,
+                                                 max_values);
+    case Type::FIXED_LEN_BYTE_ARRAY:
+      return ComputeBoundaryOrder<FLBAType>(descr, null_pages, min_values, max_values);
+    default:
+      return BoundaryOrder::UNORDERED;
+  }
+}
+
+}  // namespace
+
+void PageIndexBuilder::AddPage(int64_t offset, int32_t compressed_page_size,
+                               int64_t first_row_index, int32_t num_values,
+                               const EncodedStatistics& statistics) {
+  page_locations_.push_back({offset, compressed_page_size, first_row_index});
+
+  const bool is_null_page =
+      statistics.has_null_count && statistics.null_count == num_values;
+  null_pages_.push_back(is_null_page);
+  if (is_null_page) {
+    min_values_.emplace_back();
+    max_values_.emplace_back();
+  } else if (statistics.has_min && statistics.has_max) {
+    min_values_.push_back(statistics.min());
+    max_values_.push_back(statistics.max());
+  } else {
+    has_incomplete_statistics_ = true;
+    min_values_.emplace_back();
+    max_values_.emplace_back();
+  }
+  if (!statistics.has_null_count) {
+    has_incomplete_statistics_ = true;
+  }
+  null_counts_.push_back(statistics.null_count);
+}
+
+void PageIndexBuilder::ShiftOffsets(int64_t delta) {
+  for (auto& location : page_locations_) {
+    location.offset += delta;
+  }
+}
+
+void PageIndexBuilder::WriteTo(ArrowOutputStream* sink,
+                               ColumnChunkMetaDataBuilder* metadata) const {
+  if (page_locations_.empty()) return;
+
+  ThriftSerializer serializer;
+  if (!has_incomplete_statistics_) {
+    format::ColumnIndex column_index;
+    column_index.__set_null_pages(null_pages_);
+    column_index.__set_min_values(min_values_);
+    column_index.__set_max_values(max_values_);
+    column_index.__set_boundary_order(static_cast<format::BoundaryOrder::type>(
+        ComputeBoundaryOrder(descr_, null_pages_, min_values_, max_values_)));
+    column_index.__set_null_counts(null_counts_);
+
+    PARQUET_ASSIGN_OR_THROW(int64_t offset, sink->Tell());
+    int64_t length = serializer.Serialize(&column_index, sink);
+    metadata->SetColumnIndexLocation(offset, static_cast<int32_t>(length));
+  }
+
+  format::OffsetIndex offset_index;
+  for (const auto& location : page_locations_) {
+    format::PageLocation page_location;
+    page_location.__set_offset(location.offset);
+    page_location.__set_compressed_page_size(location.compressed_page_size);
+    page_location.__set_first_row_index(location.first_row_index);
+    offset_index.page_locations.push_back(std::move(page_location));
+  }
+  PARQUET_ASSIGN_OR_THROW(int64_t offset, sink->Tell());
+  int64_t length = serializer.Serialize(&offset_index, sink);
+  metadata->SetOffsetIndexLocation(offset, static_cast<int32_t>(length));
+}
+
+}  // namespace parquet
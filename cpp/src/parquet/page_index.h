@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "parquet/platform.h"
+#include "parquet/types.h"
+
+namespace parquet {
+
+class ColumnChunkMetaDataBuilder;
+class ColumnDescriptor;
+class EncodedStatistics;
+class Statistics;
+
+struct BoundaryOrder {
+  enum type { UNORDERED = 0, ASCENDING = 1, DESCENDING = 2 };
+};
+
+/// \brief The location of a data page within a file
+struct PARQUET_EXPORT PageLocation {
+  /// Offset of the page header in the file
+  int64_t offset;
+  /// Size of the page, including its header
+  int32_t compressed_page_size;
+  /// Index of the first row of the page within its row group
+  int64_t first_row_index;
+};
+
+/// \brief The OffsetIndex of a column chunk: the location and first row of each of its
+/// data pages.
+class PARQUET_EXPORT OffsetIndex {
+ public:
+  /// \brief Deserialize an OffsetIndex read from a file
+  static std::unique_ptr<OffsetIndex> Make(const void* serialized_index,
+                                           uint32_t index_len);
+
+  const std::vector<PageLocation>& page_locations() const { return page_locations_; }
+
+  int num_pages() const { return static_cast<int>(page_locations_.size()); }
+
+  /// \brief The number of rows of page i, given the number of rows of the row group
+  int64_t page_num_rows(int i, int64_t row_group_num_rows) const;
+
+ private:
+  explicit OffsetIndex(std::vector<PageLocation> page_locations)
+      : page_locations_(std::move(page_locations)) {}
+
+  std::vector<PageLocation> page_locations_;
+};
+
+/// \brief The ColumnIndex of a column chunk: the plain-encoded min and max value and the
+/// number of nulls of each of its data pages.
+class PARQUET_EXPORT ColumnIndex {
+ public:
+  /// \brief Deserialize a ColumnIndex read from a file
+  static std::unique_ptr<ColumnIndex> Make(const ColumnDescriptor* descr,
+                                           const void* serialized_index,
+                                           uint32_t index_len);
+
+  int num_pages() const { return static_cast<int>(null_pages_.size()); }
+
+  /// \brief Whether page i only contains nulls, in which case it has no min and max
+  const std::vector<bool>& null_pages() const { return null_pages_; }
+
+  const std::vector<std::string>& encoded_min_values() const { return min_values_; }
+
+  const std::vector<std::string>& encoded_max_values() const { return max_values_; }
+
+  BoundaryOrder::type boundary_order() const { return boundary_order_; }
+
+  bool has_null_counts() const { return has_null_counts_; }
+
+  const std::vector<int64_t>& null_counts() const { return null_counts_; }
+
+  /// \brief The decoded statistics of page i, whose min and max are unset if the page
+  /// only contains nulls
+  std::shared_ptr<Statistics> page_statistics(int i) const;
+
+ private:
+  explicit ColumnIndex(const ColumnDescriptor* descr) : descr_(descr) {}
+
+  const ColumnDescriptor* descr_;
+  std::vector<bool> null_pages_;
+  std::vector<std::string> min_values_, max_values_;
+  BoundaryOrder::type boundary_order_ = BoundaryOrder::UNORDERED;
+  bool has_null_counts_ = false;
+  std::vector<int64_t> null_counts_;
+};
+
+/// \brief Collects the locations and statistics of the data pages of a column chunk as
+/// they are written, then serializes its ColumnIndex and OffsetIndex.
+class PARQUET_EXPORT PageIndexBuilder {
+ public:
+  explicit PageIndexBuilder(const ColumnDescriptor* descr) : descr_(descr) {}
+
+  /// \brief Record a data page written at `offset`
+  void AddPage(int64_t offset, int32_t compressed_page_size, int64_t first_row_index,
+               int32_t num_values, const EncodedStatistics& statistics);
+
+  /// \brief Move the locations of the recorded pages by `delta` bytes, for pages which
+  /// were written to a buffer before being copied to the file
+  void ShiftOffsets(int64_t delta);
+
+  /// \brief Write the ColumnIndex, if every page has statistics, then the OffsetIndex
+  /// and record their locations in the column chunk's metadata
+  void WriteTo(ArrowOutputStream* sink, ColumnChunkMetaDataBuilder* metadata) const;
+
+ private:
+  const ColumnDescriptor* descr_;
+  std::vector<PageLocation> page_locations_;
+  std::vector<bool> null_pages_;
+  std::vector<std::string> min_values_, max_values_;
+  std::vector<int64_t> null_counts_;
+  // Whether a page without min and max (or a null count) was added
+  bool has_incomplete_statistics_ = false;
+};
+
+}  // namespace parquet
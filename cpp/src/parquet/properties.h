@@ -35,6 +35,8 @@
 
 namespace parquet {
 
+class FileMetaDataCache;
+
 /// Determines use of Parquet Format version >= 2.0.0 logical types. For
 /// example, when writing from Arrow data structures, PARQUET_2_0 will enable
 /// use of INT_* and UINT_* converted types as well as nanosecond timestamps
@@ -94,11 +96,24 @@ class PARQUET_EXPORT ReaderProperties {
     return file_decryption_properties_;
   }
 
+  /// Reuse the metadata of the files opened by path (see ParquetFileReader::OpenFile)
+  /// which are in the cache, and cache the metadata of the other ones. Encrypted
+  /// files are not cached. FileMetaDataCache::Global() is shared by the whole
+  /// process.
+  void set_metadata_cache(std::shared_ptr<FileMetaDataCache> cache) {
+    metadata_cache_ = std::move(cache);
+  }
+
+  const std::shared_ptr<FileMetaDataCache>& metadata_cache() const {
+    return metadata_cache_;
+  }
+
  private:
   MemoryPool* pool_;
   int64_t buffer_size_ = kDefaultBufferSize;
   bool buffered_stream_enabled_ = false;
   std::shared_ptr<FileDecryptionProperties> file_decryption_properties_;
+  std::shared_ptr<FileMetaDataCache> metadata_cache_;
 };
 
 ReaderProperties PARQUET_EXPORT default_reader_properties();
@@ -108,12 +123,23 @@ static constexpr bool DEFAULT_IS_DICTIONARY_ENABLED = true;
 static constexpr int64_t DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT = kDefaultDataPageSize;
 static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
 static constexpr int64_t DEFAULT_MAX_ROW_GROUP_LENGTH = 64 * 1024 * 1024;
+static constexpr int64_t DEFAULT_MAX_ROW_GROUP_BYTES = 128 * 1024 * 1024;
 static constexpr bool DEFAULT_ARE_STATISTICS_ENABLED = true;
+static constexpr bool DEFAULT_IS_PAGE_INDEX_ENABLED = false;
+static constexpr bool DEFAULT_IS_ADAPTIVE_ENCODING_ENABLED = false;
 static constexpr int64_t DEFAULT_MAX_STATISTICS_SIZE = 4096;
 static constexpr Encoding::type DEFAULT_ENCODING = Encoding::PLAIN;
 static const char DEFAULT_CREATED_BY[] = CREATED_BY_VERSION;
 static constexpr Compression::type DEFAULT_COMPRESSION_TYPE = Compression::UNCOMPRESSED;
 
+/// \brief Sizing of the Bloom filters written for each chunk of a column.
+struct PARQUET_EXPORT BloomFilterOptions {
+  /// The expected number of distinct values in a column chunk.
+  int32_t ndv = 1 << 20;
+  /// The false positive probability of a lookup, in (0, 1).
+  double fpp = 0.05;
+};
+
 class PARQUET_EXPORT ColumnProperties {
  public:
   ColumnProperties(Encoding::type encoding = DEFAULT_ENCODING,
@@ -148,6 +174,22 @@ class PARQUET_EXPORT ColumnProperties {
     compression_level_ = compression_level;
   }
 
+  void set_bloom_filter_enabled(bool bloom_filter_enabled) {
+    bloom_filter_enabled_ = bloom_filter_enabled;
+  }
+
+  void set_bloom_filter_options(const BloomFilterOptions& bloom_filter_options) {
+    bloom_filter_options_ = bloom_filter_options;
+  }
+
+  void set_page_index_enabled(bool page_index_enabled) {
+    page_index_enabled_ = page_index_enabled;
+  }
+
+  void set_adaptive_encoding_enabled(bool adaptive_encoding_enabled) {
+    adaptive_encoding_enabled_ = adaptive_encoding_enabled;
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -160,6 +202,14 @@ class PARQUET_EXPORT ColumnProperties {
 
   int compression_level() const { return compression_level_; }
 
+  bool bloom_filter_enabled() const { return bloom_filter_enabled_; }
+
+  const BloomFilterOptions& bloom_filter_options() const { return bloom_filter_options_; }
+
+  bool page_index_enabled() const { return page_index_enabled_; }
+
+  bool adaptive_encoding_enabled() const { return adaptive_encoding_enabled_; }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -167,6 +217,10 @@ class PARQUET_EXPORT ColumnProperties {
   bool statistics_enabled_;
   size_t max_stats_size_;
   int compression_level_;
+  bool bloom_filter_enabled_ = false;
+  BloomFilterOptions bloom_filter_options_;
+  bool page_index_enabled_ = DEFAULT_IS_PAGE_INDEX_ENABLED;
+  bool adaptive_encoding_enabled_ = DEFAULT_IS_ADAPTIVE_ENCODING_ENABLED;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -398,6 +452,103 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_statistics(path->ToDotString());
     }
 
+    /**
+     * Write a page index (ColumnIndex and OffsetIndex) for each chunk of a column,
+     * which readers may consult to skip pages. Page indexes are not written for
+     * repeated or encrypted columns, and the ColumnIndex is omitted for a column chunk
+     * unless every page has statistics.
+     */
+    Builder* enable_write_page_index() {
+      default_column_properties_.set_page_index_enabled(true);
+      return this;
+    }
+
+    Builder* disable_write_page_index() {
+      default_column_properties_.set_page_index_enabled(false);
+      return this;
+    }
+
+    Builder* enable_write_page_index(const std::string& path) {
+      page_index_enabled_[path] = true;
+      return this;
+    }
+
+    Builder* enable_write_page_index(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->enable_write_page_index(path->ToDotString());
+    }
+
+    Builder* disable_write_page_index(const std::string& path) {
+      page_index_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_write_page_index(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_write_page_index(path->ToDotString());
+    }
+
+    /**
+     * Choose the encoding of each chunk of a column from a sample of its first values:
+     * dictionary encoding if dictionary encoding is enabled and few of them are
+     * distinct, otherwise DELTA_BINARY_PACKED for integers with small deltas,
+     * DELTA_BYTE_ARRAY for byte arrays sharing long prefixes and BYTE_STREAM_SPLIT for
+     * compressed floating point values with repetitive bytes, falling back to the
+     * column's encoding. The delta and BYTE_STREAM_SPLIT encodings are only chosen
+     * when writing PARQUET_2_0 files. The encodings chosen are recorded in the
+     * encodings and encoding stats of the column chunk metadata.
+     */
+    Builder* enable_adaptive_encoding() {
+      default_column_properties_.set_adaptive_encoding_enabled(true);
+      return this;
+    }
+
+    Builder* disable_adaptive_encoding() {
+      default_column_properties_.set_adaptive_encoding_enabled(false);
+      return this;
+    }
+
+    Builder* enable_adaptive_encoding(const std::string& path) {
+      adaptive_encoding_enabled_[path] = true;
+      return this;
+    }
+
+    Builder* enable_adaptive_encoding(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->enable_adaptive_encoding(path->ToDotString());
+    }
+
+    Builder* disable_adaptive_encoding(const std::string& path) {
+      adaptive_encoding_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_adaptive_encoding(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_adaptive_encoding(path->ToDotString());
+    }
+
+    /**
+     * Write a Bloom filter of the values of each chunk of a column, which readers
+     * may consult to skip row groups not containing a value. Bloom filters are not
+     * written for boolean or encrypted columns.
+     */
+    Builder* enable_bloom_filter(const std::string& path,
+                                 BloomFilterOptions options = BloomFilterOptions()) {
+      bloom_filter_options_[path] = options;
+      return this;
+    }
+
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path,
+                                 BloomFilterOptions options = BloomFilterOptions()) {
+      return this->enable_bloom_filter(path->ToDotString(), options);
+    }
+
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_options_.erase(path);
+      return this;
+    }
+
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
     std::shared_ptr<WriterProperties> build() {
       std::unordered_map<std::string, ColumnProperties> column_properties;
       auto get = [&](const std::string& key) -> ColumnProperties& {
@@ -416,6 +567,14 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_enabled(item.second);
       for (const auto& item : statistics_enabled_)
         get(item.first).set_statistics_enabled(item.second);
+      for (const auto& item : page_index_enabled_)
+        get(item.first).set_page_index_enabled(item.second);
+      for (const auto& item : adaptive_encoding_enabled_)
+        get(item.first).set_adaptive_encoding_enabled(item.second);
+      for (const auto& item : bloom_filter_options_) {
+        get(item.first).set_bloom_filter_enabled(true);
+        get(item.first).set_bloom_filter_options(item.second);
+      }
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
@@ -442,6 +601,9 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, int32_t> codecs_compression_level_;
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
+    std::unordered_map<std::string, bool> page_index_enabled_;
+    std::unordered_map<std::string, bool> adaptive_encoding_enabled_;
+    std::unordered_map<std::string, BloomFilterOptions> bloom_filter_options_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -509,6 +671,23 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).max_statistics_size();
   }
 
+  bool page_index_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).page_index_enabled();
+  }
+
+  bool adaptive_encoding_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).adaptive_encoding_enabled();
+  }
+
+  /// \brief Return the options of the column's Bloom filters, or nullptr if none are
+  /// written.
+  const BloomFilterOptions* bloom_filter_options(
+      const std::shared_ptr<schema::ColumnPath>& path) const {
+    const auto& properties = column_properties(path);
+    return properties.bloom_filter_enabled() ? &properties.bloom_filter_options()
+                                             : NULLPTR;
+  }
+
   inline FileEncryptionProperties* file_encryption_properties() const {
     return file_encryption_properties_.get();
   }
@@ -574,8 +753,11 @@ class PARQUET_EXPORT ArrowReaderProperties {
   explicit ArrowReaderProperties(bool use_threads = kArrowDefaultUseThreads)
       : use_threads_(use_threads),
         read_dict_indices_(),
+        unify_dictionaries_(false),
+        zero_copy_pages_(false),
         batch_size_(kArrowDefaultBatchSize),
         pre_buffer_(false),
+        pre_buffer_max_bytes_(0),
         cache_options_(::arrow::io::CacheOptions::Defaults()) {}
 
   void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
@@ -597,6 +779,30 @@ class PARQUET_EXPORT ArrowReaderProperties {
     }
   }
 
+  /// \brief Give all the chunks of a column read as dictionary (see
+  /// set_read_dictionary) the same dictionary.
+  ///
+  /// Each row group has its own dictionaries, so that the chunks read from different
+  /// row groups have different dictionaries by default. When enabled, the dictionaries
+  /// of a column are unified after it was read, by transposing the indices of the
+  /// chunks rather than decoding their values, which also allows reading dictionaries
+  /// nested in lists or structs from several row groups.
+  void set_unify_dictionaries(bool unify) { unify_dictionaries_ = unify; }
+
+  bool unify_dictionaries() const { return unify_dictionaries_; }
+
+  /// \brief Read the values of data pages zero-copy where possible.
+  ///
+  /// The INT32, INT64, FLOAT and DOUBLE columns which are neither nested nor optional
+  /// are then read as arrays slicing the buffers of their PLAIN-encoded data pages,
+  /// when these are neither compressed nor encrypted, rather than copying their
+  /// values. Such columns have one chunk per data page read, and their arrays keep
+  /// the buffers of the pages alive: slices of the file when it is memory-mapped or
+  /// pre-buffered (see set_pre_buffer).
+  void set_zero_copy_pages(bool zero_copy_pages) { zero_copy_pages_ = zero_copy_pages; }
+
+  bool zero_copy_pages() const { return zero_copy_pages_; }
+
   void set_batch_size(int64_t batch_size) { batch_size_ = batch_size; }
 
   int64_t batch_size() const { return batch_size_; }
@@ -610,6 +816,16 @@ class PARQUET_EXPORT ArrowReaderProperties {
 
   bool pre_buffer() const { return pre_buffer_; }
 
+  /// Limit the data pre-buffered by a RecordBatchReader (see set_pre_buffer).
+  ///
+  /// When positive, only the row group being read and the following ones which fit
+  /// in this many bytes are buffered, the next ones being fetched in the background
+  /// while the previous ones are decoded. By default, all the row groups to read are
+  /// buffered at once.
+  void set_pre_buffer_max_bytes(int64_t max_bytes) { pre_buffer_max_bytes_ = max_bytes; }
+
+  int64_t pre_buffer_max_bytes() const { return pre_buffer_max_bytes_; }
+
   /// Set options for read coalescing. This can be used to tune the
   /// implementation for characteristics of different filesystems.
   void set_cache_options(::arrow::io::CacheOptions options) { cache_options_ = options; }
@@ -624,8 +840,11 @@ class PARQUET_EXPORT ArrowReaderProperties {
  private:
   bool use_threads_;
   std::unordered_set<int> read_dict_indices_;
+  bool unify_dictionaries_;
+  bool zero_copy_pages_;
   int64_t batch_size_;
   bool pre_buffer_;
+  int64_t pre_buffer_max_bytes_;
   ::arrow::io::AsyncContext async_context_;
   ::arrow::io::CacheOptions cache_options_;
 };
@@ -650,7 +869,9 @@ class PARQUET_EXPORT ArrowWriterProperties {
           store_schema_(false),
           // TODO: At some point we should flip this.
           compliant_nested_types_(false),
-          engine_version_(V2) {}
+          engine_version_(V2),
+          use_threads_(false),
+          max_row_group_bytes_(DEFAULT_MAX_ROW_GROUP_BYTES) {}
     virtual ~Builder() = default;
 
     Builder* disable_deprecated_int96_timestamps() {
@@ -702,11 +923,31 @@ class PARQUET_EXPORT ArrowWriterProperties {
       return this;
     }
 
+    /// \brief Encode and compress the column chunks of a row group in parallel on the
+    /// CPU thread pool when writing a Table.
+    ///
+    /// The column chunks of each row group are then buffered in memory until all of
+    /// them were encoded, and written to the sink in column order.
+    Builder* set_use_threads(bool use_threads) {
+      use_threads_ = use_threads;
+      return this;
+    }
+
+    /// \brief The size at which FileWriter::WriteRecordBatch closes the row group
+    /// it buffers.
+    ///
+    /// The size is that of the encoded and compressed pages, plus the estimated
+    /// encoded size of the values not written to a page yet. Default 128 MiB.
+    Builder* set_max_row_group_bytes(int64_t max_row_group_bytes) {
+      max_row_group_bytes_ = max_row_group_bytes;
+      return this;
+    }
+
     std::shared_ptr<ArrowWriterProperties> build() {
       return std::shared_ptr<ArrowWriterProperties>(new ArrowWriterProperties(
           write_timestamps_as_int96_, coerce_timestamps_enabled_, coerce_timestamps_unit_,
           truncated_timestamps_allowed_, store_schema_, compliant_nested_types_,
-          engine_version_));
+          engine_version_, use_threads_, max_row_group_bytes_));
     }
 
    private:
@@ -719,6 +960,8 @@ class PARQUET_EXPORT ArrowWriterProperties {
     bool store_schema_;
     bool compliant_nested_types_;
     EngineVersion engine_version_;
+    bool use_threads_;
+    int64_t max_row_group_bytes_;
   };
 
   bool support_deprecated_int96_timestamps() const { return write_timestamps_as_int96_; }
@@ -745,20 +988,29 @@ class PARQUET_EXPORT ArrowWriterProperties {
   /// place in case there are bugs detected in V2.
   EngineVersion engine_version() const { return engine_version_; }
 
+  /// \brief Whether the column chunks of a row group are encoded in parallel.
+  bool use_threads() const { return use_threads_; }
+
+  /// \brief The size at which FileWriter::WriteRecordBatch closes a row group.
+  int64_t max_row_group_bytes() const { return max_row_group_bytes_; }
+
  private:
   explicit ArrowWriterProperties(bool write_nanos_as_int96,
                                  bool coerce_timestamps_enabled,
                                  ::arrow::TimeUnit::type coerce_timestamps_unit,
                                  bool truncated_timestamps_allowed, bool store_schema,
                                  bool compliant_nested_types,
-                                 EngineVersion engine_version)
+                                 EngineVersion engine_version, bool use_threads,
+                                 int64_t max_row_group_bytes)
       : write_timestamps_as_int96_(write_nanos_as_int96),
         coerce_timestamps_enabled_(coerce_timestamps_enabled),
         coerce_timestamps_unit_(coerce_timestamps_unit),
         truncated_timestamps_allowed_(truncated_timestamps_allowed),
         store_schema_(store_schema),
         compliant_nested_types_(compliant_nested_types),
-        engine_version_(engine_version) {}
+        engine_version_(engine_version),
+        use_threads_(use_threads),
+        max_row_group_bytes_(max_row_group_bytes) {}
 
   const bool write_timestamps_as_int96_;
   const bool coerce_timestamps_enabled_;
@@ -767,6 +1019,8 @@ class PARQUET_EXPORT ArrowWriterProperties {
   const bool store_schema_;
   const bool compliant_nested_types_;
   const EngineVersion engine_version_;
+  const bool use_threads_;
+  const int64_t max_row_group_bytes_;
 };
 
 /// \brief State object used for writing Arrow data directly to a Parquet
@@ -251,6 +251,23 @@ TEST_F(TestLocalFile, OpenWithMetadata) {
   ASSERT_EQ(metadata.get(), reader2->metadata().get());
 }
 
+TEST_F(TestLocalFile, OpenWithMetadataCache) {
+  auto cache = std::make_shared<FileMetaDataCache>();
+  ReaderProperties props = default_reader_properties();
+  props.set_metadata_cache(cache);
+
+  auto reader = ParquetFileReader::OpenFile(alltypes_plain(), false, props);
+  ASSERT_EQ(1, cache->num_entries());
+  ASSERT_EQ(reader->metadata()->size(), cache->size());
+
+  // The second reader reuses the metadata of the first one
+  auto reader2 = ParquetFileReader::OpenFile(alltypes_plain(), true, props);
+  ASSERT_EQ(reader->metadata().get(), reader2->metadata().get());
+  ASSERT_EQ(1, cache->num_entries());
+
+  ASSERT_EQ(8, ScanFileContents({}, 256, reader2.get()));
+}
+
 TEST(TestFileReaderAdHoc, NationDictTruncatedDataPage) {
   // PARQUET-816. Some files generated by older Parquet implementations may
   // contain malformed data page metadata, and we can successfully decode them
@@ -27,7 +27,7 @@
 #include "arrow/array.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
-#include "arrow/util/bitmap_reader.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/optional.h"
@@ -49,6 +49,8 @@ namespace parquet {
 template <typename DType, bool is_signed>
 struct CompareHelper {
   using T = typename DType::c_type;
+  // The type whose builtin operator< implements the sort order
+  using CompareType = T;
 
   constexpr static T DefaultMin() { return std::numeric_limits<T>::max(); }
   constexpr static T DefaultMax() { return std::numeric_limits<T>::lowest(); }
@@ -77,6 +79,7 @@ template <typename DType>
 struct UnsignedCompareHelperBase {
   using T = typename DType::c_type;
   using UCType = typename std::make_unsigned<T>::type;
+  using CompareType = UCType;
 
   constexpr static T DefaultMin() { return std::numeric_limits<UCType>::max(); }
   constexpr static T DefaultMax() { return std::numeric_limits<UCType>::lowest(); }
@@ -175,10 +178,18 @@ struct BinaryLikeCompareHelperBase {
   static int value_length(int type_length, const FLBA& value) { return type_length; }
 
   static inline bool Compare(int type_length, const T& a, const T& b) {
+    const int a_length = value_length(type_length, a);
+    const int b_length = value_length(type_length, b);
+    if (!is_signed) {
+      // Unsigned byte order is memcmp() order, which compares the common
+      // prefix several bytes at a time rather than byte by byte.
+      const int prefix_length = std::min(a_length, b_length);
+      const int cmp = prefix_length == 0 ? 0 : std::memcmp(a.ptr, b.ptr, prefix_length);
+      return cmp < 0 || (cmp == 0 && a_length < b_length);
+    }
     const auto* aptr = reinterpret_cast<const PtrType*>(a.ptr);
     const auto* bptr = reinterpret_cast<const PtrType*>(b.ptr);
-    return std::lexicographical_compare(aptr, aptr + value_length(type_length, a), bptr,
-                                        bptr + value_length(type_length, b));
+    return std::lexicographical_compare(aptr, aptr + a_length, bptr, bptr + b_length);
   }
 
   static T Min(int type_length, const T& a, const T& b) {
@@ -258,6 +269,46 @@ optional<std::pair<ByteArray, ByteArray>> CleanStatistic(
   return min_max;
 }
 
+// Number of independent accumulators in UpdateArithmeticMinMax
+constexpr int kMinMaxLanes = 8;
+
+// Fold a dense run of numeric values into [*out_min, *out_max].
+//
+// The loop keeps one accumulator per lane so that the compiler can turn it
+// into packed min/max instructions without having to reassociate a single
+// reduction, then combines the lanes at the end.  Both comparisons are false
+// for NaN, so NaNs are skipped without an explicit isnan() test.
+template <typename T>
+void UpdateArithmeticMinMax(const T* values, int64_t length, T* out_min, T* out_max) {
+  T min = *out_min;
+  T max = *out_max;
+  int64_t i = 0;
+  if (length >= kMinMaxLanes) {
+    T mins[kMinMaxLanes];
+    T maxs[kMinMaxLanes];
+    std::fill(mins, mins + kMinMaxLanes, min);
+    std::fill(maxs, maxs + kMinMaxLanes, max);
+    for (; i + kMinMaxLanes <= length; i += kMinMaxLanes) {
+      for (int j = 0; j < kMinMaxLanes; j++) {
+        const T val = values[i + j];
+        mins[j] = val < mins[j] ? val : mins[j];
+        maxs[j] = maxs[j] < val ? val : maxs[j];
+      }
+    }
+    for (int j = 0; j < kMinMaxLanes; j++) {
+      min = mins[j] < min ? mins[j] : min;
+      max = max < maxs[j] ? maxs[j] : max;
+    }
+  }
+  for (; i < length; i++) {
+    const T val = values[i];
+    min = val < min ? val : min;
+    max = max < val ? val : max;
+  }
+  *out_min = min;
+  *out_max = max;
+}
+
 template <bool is_signed, typename DType>
 class TypedComparatorImpl : virtual public TypedComparator<DType> {
  public:
@@ -277,13 +328,7 @@ class TypedComparatorImpl : virtual public TypedComparator<DType> {
 
     T min = Helper::DefaultMin();
     T max = Helper::DefaultMax();
-
-    for (int64_t i = 0; i < length; i++) {
-      auto val = values[i];
-      min = Helper::Min(type_length_, min, Helper::Coalesce(val, Helper::DefaultMin()));
-      max = Helper::Max(type_length_, max, Helper::Coalesce(val, Helper::DefaultMax()));
-    }
-
+    UpdateMinMax(values, length, &min, &max);
     return {min, max};
   }
 
@@ -295,13 +340,18 @@ class TypedComparatorImpl : virtual public TypedComparator<DType> {
     T min = Helper::DefaultMin();
     T max = Helper::DefaultMax();
 
-    ::arrow::internal::BitmapReader reader(valid_bits, valid_bits_offset, length);
-    for (int64_t i = 0; i < length; i++, reader.Next()) {
-      if (reader.IsSet()) {
-        auto val = values[i];
-        min = Helper::Min(type_length_, min, Helper::Coalesce(val, Helper::DefaultMin()));
-        max = Helper::Max(type_length_, max, Helper::Coalesce(val, Helper::DefaultMax()));
+    // Feed each run of valid values to the dense loop
+    ::arrow::internal::BitRunReader reader(valid_bits, valid_bits_offset, length);
+    int64_t position = 0;
+    while (true) {
+      const auto run = reader.NextRun();
+      if (run.length == 0) {
+        break;
+      }
+      if (run.set) {
+        UpdateMinMax(values + position, run.length, &min, &max);
       }
+      position += run.length;
     }
 
     return {min, max};
@@ -310,6 +360,27 @@ class TypedComparatorImpl : virtual public TypedComparator<DType> {
   std::pair<T, T> GetMinMax(const ::arrow::Array& values) override;
 
  private:
+  template <typename T1 = T>
+  ::arrow::enable_if_t<std::is_arithmetic<T1>::value> UpdateMinMax(const T* values,
+                                                                   int64_t length,
+                                                                   T* min, T* max) {
+    // Signed and unsigned variants of the same integer type may alias
+    using CType = typename Helper::CompareType;
+    UpdateArithmeticMinMax(reinterpret_cast<const CType*>(values), length,
+                           reinterpret_cast<CType*>(min), reinterpret_cast<CType*>(max));
+  }
+
+  template <typename T1 = T>
+  ::arrow::enable_if_t<!std::is_arithmetic<T1>::value> UpdateMinMax(const T* values,
+                                                                    int64_t length,
+                                                                    T* min, T* max) {
+    for (int64_t i = 0; i < length; i++) {
+      const T& val = values[i];
+      *min = Helper::Min(type_length_, *min, Helper::Coalesce(val, Helper::DefaultMin()));
+      *max = Helper::Max(type_length_, *max, Helper::Coalesce(val, Helper::DefaultMax()));
+    }
+  }
+
   int type_length_;
 };
 
@@ -319,6 +390,21 @@ TypedComparatorImpl<is_signed, DType>::GetMinMax(const ::arrow::Array& values) {
   ParquetException::NYI(values.type()->ToString());
 }
 
+template <bool is_signed>
+void UpdateBinaryMinMax(const TypedComparatorImpl<is_signed, ByteArrayType>& comparator,
+                        const ::arrow::BinaryArray& data, int64_t offset, int64_t length,
+                        ByteArray* min, ByteArray* max) {
+  for (int64_t i = offset; i < offset + length; i++) {
+    ByteArray val = data.GetView(i);
+    // Once seeded, min <= max, so a new minimum cannot also be a new maximum
+    if (comparator.CompareInline(val, *min)) {
+      *min = val;
+    } else if (comparator.CompareInline(*max, val)) {
+      *max = val;
+    }
+  }
+}
+
 template <bool is_signed>
 std::pair<ByteArray, ByteArray> GetMinMaxBinaryHelper(
     const TypedComparatorImpl<is_signed, ByteArrayType>& comparator,
@@ -326,32 +412,34 @@ std::pair<ByteArray, ByteArray> GetMinMaxBinaryHelper(
   const auto& data = checked_cast<const ::arrow::BinaryArray&>(values);
 
   ByteArray min, max;
-  if (data.null_count() > 0) {
-    ::arrow::internal::BitmapReader reader(data.null_bitmap_data(), data.offset(),
-                                           data.length());
-    int64_t i = 0;
-    while (!reader.IsSet()) {
-      ++i;
-      reader.Next();
-    }
+  if (data.null_count() == 0) {
+    min = max = data.GetView(0);
+    UpdateBinaryMinMax(comparator, data, 1, data.length() - 1, &min, &max);
+    return {min, max};
+  }
 
-    min = data.GetView(i);
-    max = data.GetView(i);
-    for (; i < data.length(); i++, reader.Next()) {
-      ByteArray val = data.GetView(i);
-      if (reader.IsSet()) {
-        min = comparator.CompareInline(val, min) ? val : min;
-        max = comparator.CompareInline(max, val) ? val : max;
-      }
+  // Leave min and max unset (null pointers) if every value is null
+  bool seeded = false;
+  ::arrow::internal::BitRunReader reader(data.null_bitmap_data(), data.offset(),
+                                         data.length());
+  int64_t position = 0;
+  while (true) {
+    const auto run = reader.NextRun();
+    if (run.length == 0) {
+      break;
     }
-  } else {
-    min = data.GetView(0);
-    max = data.GetView(0);
-    for (int64_t i = 0; i < data.length(); i++) {
-      ByteArray val = data.GetView(i);
-      min = comparator.CompareInline(val, min) ? val : min;
-      max = comparator.CompareInline(max, val) ? val : max;
+    if (run.set) {
+      int64_t run_offset = position;
+      int64_t run_length = run.length;
+      if (!seeded) {
+        min = max = data.GetView(run_offset);
+        seeded = true;
+        ++run_offset;
+        --run_length;
+      }
+      UpdateBinaryMinMax(comparator, data, run_offset, run_length, &min, &max);
     }
+    position += run.length;
   }
 
   return {min, max};
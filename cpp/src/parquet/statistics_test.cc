@@ -989,6 +989,69 @@ TEST(TestStatistic, NaNFloatValues) { CheckNaNs<FloatType>(); }
 
 TEST(TestStatistic, NaNDoubleValues) { CheckNaNs<DoubleType>(); }
 
+// The dense and spaced comparator paths must agree with a plain scalar loop,
+// including for lengths that are not a multiple of the unrolling width.
+template <typename ParquetType>
+void CheckMinMaxMatchesScalar(SortOrder::type sort_order, bool with_nans) {
+  using T = typename ParquetType::c_type;
+
+  auto comparator = MakeComparator<ParquetType>(ParquetType::type_num, sort_order);
+  for (int length : {1, 7, 8, 9, 63, 100, 1027}) {
+    std::vector<T> values(length);
+    random_numbers(length, length, static_cast<T>(-1000), static_cast<T>(1000),
+                   values.data());
+    if (with_nans) {
+      for (int i = 0; i < length; i += 3) {
+        values[i] = std::numeric_limits<T>::quiet_NaN();
+      }
+    }
+    std::vector<uint8_t> valid_bits(::arrow::BitUtil::BytesForBits(length) + 1, 0);
+    std::vector<uint8_t> valid_values;
+    random_bytes(length, length, &valid_values);
+    for (int i = 0; i < length; i++) {
+      if (valid_values[i] % 4 != 0) {
+        ::arrow::BitUtil::SetBit(valid_bits.data(), i + 1);
+      }
+    }
+
+    // Reference: seed with the first non-NaN value, then a pairwise Compare() loop
+    auto check_min_max = [&](const std::pair<T, T>& actual, bool spaced) {
+      bool seeded = false;
+      std::pair<T, T> expected;
+      for (int i = 0; i < length; i++) {
+        const T val = values[i];
+        if ((spaced && !::arrow::BitUtil::GetBit(valid_bits.data(), i + 1)) ||
+            val != val) {
+          continue;
+        }
+        if (!seeded) {
+          expected = {val, val};
+          seeded = true;
+        }
+        if (comparator->Compare(val, expected.first)) expected.first = val;
+        if (comparator->Compare(expected.second, val)) expected.second = val;
+      }
+      if (seeded) {
+        ASSERT_EQ(expected.first, actual.first) << "length=" << length;
+        ASSERT_EQ(expected.second, actual.second) << "length=" << length;
+      }
+    };
+
+    check_min_max(comparator->GetMinMax(values.data(), length), false);
+    check_min_max(
+        comparator->GetMinMaxSpaced(values.data(), length, valid_bits.data(), 1), true);
+  }
+}
+
+TEST(TestStatistic, MinMaxMatchesScalar) {
+  CheckMinMaxMatchesScalar<Int32Type>(SortOrder::SIGNED, false);
+  CheckMinMaxMatchesScalar<Int32Type>(SortOrder::UNSIGNED, false);
+  CheckMinMaxMatchesScalar<Int64Type>(SortOrder::SIGNED, false);
+  CheckMinMaxMatchesScalar<Int64Type>(SortOrder::UNSIGNED, false);
+  CheckMinMaxMatchesScalar<FloatType>(SortOrder::SIGNED, true);
+  CheckMinMaxMatchesScalar<DoubleType>(SortOrder::SIGNED, true);
+}
+
 // ARROW-7376
 TEST(TestStatisticsSortOrderFloatNaN, NaNAndNullsInfiniteLoop) {
   constexpr int kNumValues = 8;
@@ -181,8 +181,9 @@ static void InitDictValues(int num_values, int num_dicts, std::vector<T>& values
 
 class MockPageReader : public PageReader {
  public:
-  explicit MockPageReader(const std::vector<std::shared_ptr<Page>>& pages)
-      : pages_(pages), page_index_(0) {}
+  explicit MockPageReader(const std::vector<std::shared_ptr<Page>>& pages,
+                          bool stable_page_buffers = false)
+      : pages_(pages), page_index_(0), stable_page_buffers_(stable_page_buffers) {}
 
   std::shared_ptr<Page> NextPage() override {
     if (page_index_ == static_cast<int>(pages_.size())) {
@@ -195,9 +196,12 @@ class MockPageReader : public PageReader {
   // No-op
   void set_max_page_header_size(uint32_t size) override {}
 
+  bool stable_page_buffers() const override { return stable_page_buffers_; }
+
  private:
   std::vector<std::shared_ptr<Page>> pages_;
   int page_index_;
+  bool stable_page_buffers_;
 };
 
 // TODO(wesm): this is only used for testing for now. Refactor to form part of
@@ -37,8 +37,11 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <deque>
 #include <mutex>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -223,6 +226,8 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
   Status SetClientOptions(const std::string& client_name, int64_t output_memory_quota);
 
+  Status SetReleaseBatching(int64_t max_batch_size, int64_t flush_interval_ms);
+
   Status Create(const ObjectID& object_id, int64_t data_size, const uint8_t* metadata,
                 int64_t metadata_size, std::shared_ptr<Buffer>* data, int device_num = 0,
                 bool evict_if_full = true);
@@ -243,14 +248,22 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
   Status Release(const ObjectID& object_id);
 
+  Status FlushReleases();
+
   Status Contains(const ObjectID& object_id, bool* has_object);
 
+  Status Contains(const std::vector<ObjectID>& object_ids, std::vector<bool>* has_object);
+
+  Status Prefetch(const std::vector<ObjectID>& object_ids);
+
   Status List(ObjectTable* objects);
 
   Status Abort(const ObjectID& object_id);
 
   Status Seal(const ObjectID& object_id);
 
+  Status Seal(const std::vector<ObjectID>& object_ids);
+
   Status Delete(const std::vector<ObjectID>& object_ids);
 
   Status Evict(int64_t num_bytes, int64_t& num_bytes_evicted);
@@ -291,6 +304,20 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   /// \return The return status.
   Status MarkObjectUnused(const ObjectID& object_id);
 
+  /// Send the releases queued by release batching in a single message. This
+  /// must happen before any other request to the store, so that the store
+  /// handles the releases and a later Get of the same objects in order.
+  ///
+  /// \return The return status.
+  Status SendPendingReleases();
+
+  /// Body of the thread flushing the queued releases every interval.
+  void RunReleaseFlusher(std::chrono::milliseconds interval);
+
+  /// Stop and join the release flusher thread, if any. The client mutex must
+  /// not be held by the caller.
+  void StopReleaseFlusher();
+
   /// Common helper for Get() variants
   Status GetBuffers(const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
                     const std::function<std::shared_ptr<Buffer>(
@@ -333,15 +360,29 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   std::unordered_set<ObjectID> deletion_cache_;
   /// A queue of notification
   std::deque<std::tuple<ObjectID, int64_t, int64_t>> pending_notification_;
+  /// Once this many releases are queued they are sent to the store. Releases
+  /// are sent one by one if this is at most 1.
+  int64_t release_batch_size_;
+  /// The IDs of the objects released by this client that the store hasn't
+  /// been told about yet.
+  std::vector<ObjectID> pending_releases_;
+  /// Thread flushing pending_releases_ periodically, if a flush interval is set.
+  std::thread release_flusher_;
+  std::condition_variable_any release_flusher_cv_;
+  bool stop_release_flusher_;
   /// A mutex which protects this class.
   std::recursive_mutex client_mutex_;
 };
 
 PlasmaBuffer::~PlasmaBuffer() { ARROW_UNUSED(client_->Release(object_id_)); }
 
-PlasmaClient::Impl::Impl() : store_conn_(0), store_capacity_(0) {}
+PlasmaClient::Impl::Impl()
+    : store_conn_(0),
+      store_capacity_(0),
+      release_batch_size_(0),
+      stop_release_flusher_(false) {}
 
-PlasmaClient::Impl::~Impl() {}
+PlasmaClient::Impl::~Impl() { StopReleaseFlusher(); }
 
 // If the file descriptor fd has been mmapped in this client process before,
 // return the pointer that was returned by mmap, otherwise mmap it and store the
@@ -424,6 +465,7 @@ Status PlasmaClient::Impl::Create(const ObjectID& object_id, int64_t data_size,
 
   ARROW_LOG(DEBUG) << "called plasma_create on conn " << store_conn_ << " with size "
                    << data_size << " and metadata size " << metadata_size;
+  RETURN_NOT_OK(SendPendingReleases());
   RETURN_NOT_OK(SendCreateRequest(store_conn_, object_id, evict_if_full, data_size,
                                   metadata_size, device_num));
   std::vector<uint8_t> buffer;
@@ -499,6 +541,7 @@ Status PlasmaClient::Impl::CreateAndSeal(const ObjectID& object_id,
       reinterpret_cast<const uint8_t*>(metadata.data()), metadata.size());
   memcpy(&digest[0], &hash, sizeof(hash));
 
+  RETURN_NOT_OK(SendPendingReleases());
   RETURN_NOT_OK(SendCreateAndSealRequest(store_conn_, object_id, evict_if_full, data,
                                          metadata, digest));
   std::vector<uint8_t> buffer;
@@ -527,6 +570,7 @@ Status PlasmaClient::Impl::CreateAndSealBatch(const std::vector<ObjectID>& objec
     digests.push_back(digest);
   }
 
+  RETURN_NOT_OK(SendPendingReleases());
   RETURN_NOT_OK(SendCreateAndSealBatchRequest(store_conn_, object_ids, evict_if_full,
                                               data, metadata, digests));
   std::vector<uint8_t> buffer;
@@ -595,6 +639,7 @@ Status PlasmaClient::Impl::GetBuffers(
 
   // If we get here, then the objects aren't all currently in use by this
   // client, so we need to send a request to the plasma store.
+  RETURN_NOT_OK(SendPendingReleases());
   RETURN_NOT_OK(SendGetRequest(store_conn_, &object_ids[0], num_objects, timeout_ms));
   std::vector<uint8_t> buffer;
   RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaGetReply, &buffer));
@@ -732,7 +777,14 @@ Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
   if (object_entry->second->count == 0) {
     // Tell the store that the client no longer needs the object.
     RETURN_NOT_OK(MarkObjectUnused(object_id));
-    RETURN_NOT_OK(SendReleaseRequest(store_conn_, object_id));
+    if (release_batch_size_ > 1) {
+      pending_releases_.push_back(object_id);
+      if (static_cast<int64_t>(pending_releases_.size()) >= release_batch_size_) {
+        RETURN_NOT_OK(SendPendingReleases());
+      }
+    } else {
+      RETURN_NOT_OK(SendReleaseRequest(store_conn_, object_id));
+    }
     auto iter = deletion_cache_.find(object_id);
     if (iter != deletion_cache_.end()) {
       deletion_cache_.erase(object_id);
@@ -742,6 +794,62 @@ Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::SendPendingReleases() {
+  if (pending_releases_.empty() || store_conn_ < 0) {
+    return Status::OK();
+  }
+  std::vector<ObjectID> object_ids;
+  object_ids.swap(pending_releases_);
+  return SendReleaseBatchRequest(store_conn_, object_ids);
+}
+
+Status PlasmaClient::Impl::FlushReleases() {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+  return SendPendingReleases();
+}
+
+void PlasmaClient::Impl::RunReleaseFlusher(std::chrono::milliseconds interval) {
+  std::unique_lock<std::recursive_mutex> lock(client_mutex_);
+  while (!stop_release_flusher_) {
+    release_flusher_cv_.wait_for(lock, interval);
+    if (!stop_release_flusher_) {
+      ARROW_UNUSED(SendPendingReleases());
+    }
+  }
+}
+
+void PlasmaClient::Impl::StopReleaseFlusher() {
+  {
+    std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+    stop_release_flusher_ = true;
+  }
+  release_flusher_cv_.notify_all();
+  if (release_flusher_.joinable()) {
+    release_flusher_.join();
+  }
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+  stop_release_flusher_ = false;
+}
+
+Status PlasmaClient::Impl::SetReleaseBatching(int64_t max_batch_size,
+                                              int64_t flush_interval_ms) {
+  if (max_batch_size < 0 || flush_interval_ms < 0) {
+    return Status::Invalid("Release batch size and flush interval must be positive");
+  }
+  StopReleaseFlusher();
+
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+  release_batch_size_ = max_batch_size;
+  if (release_batch_size_ <= 1) {
+    return SendPendingReleases();
+  }
+  if (flush_interval_ms > 0) {
+    release_flusher_ = std::thread(&PlasmaClient::Impl::RunReleaseFlusher, this,
+                                   std::chrono::milliseconds(flush_interval_ms));
+  }
+  return Status::OK();
+}
+
 // This method is used to query whether the plasma store contains an object.
 Status PlasmaClient::Impl::Contains(const ObjectID& object_id, bool* has_object) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
@@ -752,6 +860,7 @@ Status PlasmaClient::Impl::Contains(const ObjectID& object_id, bool* has_object)
   } else {
     // If we don't already have a reference to the object, check with the store
     // to see if we have the object.
+    RETURN_NOT_OK(SendPendingReleases());
     RETURN_NOT_OK(SendContainsRequest(store_conn_, object_id));
     std::vector<uint8_t> buffer;
     RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaContainsReply, &buffer));
@@ -763,8 +872,52 @@ Status PlasmaClient::Impl::Contains(const ObjectID& object_id, bool* has_object)
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::Prefetch(const std::vector<ObjectID>& object_ids) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+  RETURN_NOT_OK(SendPendingReleases());
+  return SendPrefetchRequest(store_conn_, object_ids);
+}
+
+Status PlasmaClient::Impl::Contains(const std::vector<ObjectID>& object_ids,
+                                    std::vector<bool>* has_object) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  has_object->assign(object_ids.size(), false);
+  // Only ask the store about the objects we don't have a reference to.
+  std::vector<ObjectID> query_ids;
+  std::vector<size_t> query_indices;
+  for (size_t i = 0; i < object_ids.size(); ++i) {
+    if (objects_in_use_.count(object_ids[i]) > 0) {
+      (*has_object)[i] = true;
+    } else {
+      query_ids.push_back(object_ids[i]);
+      query_indices.push_back(i);
+    }
+  }
+  if (query_ids.empty()) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(SendPendingReleases());
+  RETURN_NOT_OK(SendContainsBatchRequest(store_conn_, query_ids));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(
+      PlasmaReceive(store_conn_, MessageType::PlasmaContainsBatchReply, &buffer));
+  std::vector<ObjectID> reply_ids;
+  std::vector<bool> reply_has_object;
+  RETURN_NOT_OK(ReadContainsBatchReply(buffer.data(), buffer.size(), &reply_ids,
+                                       &reply_has_object));
+  if (reply_has_object.size() != query_ids.size()) {
+    return Status::IOError("Unexpected number of objects in Contains reply");
+  }
+  for (size_t i = 0; i < query_indices.size(); ++i) {
+    (*has_object)[query_indices[i]] = reply_has_object[i];
+  }
+  return Status::OK();
+}
+
 Status PlasmaClient::Impl::List(ObjectTable* objects) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+  RETURN_NOT_OK(SendPendingReleases());
   RETURN_NOT_OK(SendListRequest(store_conn_));
   std::vector<uint8_t> buffer;
   RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaListReply, &buffer));
@@ -861,6 +1014,7 @@ Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
   /// Send the seal request to Plasma.
   std::vector<uint8_t> digest(kDigestSize);
   RETURN_NOT_OK(Hash(object_id, &digest[0]));
+  RETURN_NOT_OK(SendPendingReleases());
   RETURN_NOT_OK(
       SendSealRequest(store_conn_, object_id, std::string(digest.begin(), digest.end())));
   std::vector<uint8_t> buffer;
@@ -876,6 +1030,46 @@ Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
   return Release(object_id);
 }
 
+Status PlasmaClient::Impl::Seal(const std::vector<ObjectID>& object_ids) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+  if (object_ids.empty()) {
+    return Status::OK();
+  }
+
+  // Check all the objects before sealing any of them.
+  std::unordered_set<ObjectID> seen;
+  for (const auto& object_id : object_ids) {
+    auto object_entry = objects_in_use_.find(object_id);
+    if (object_entry == objects_in_use_.end()) {
+      return MakePlasmaError(PlasmaErrorCode::PlasmaObjectNotFound,
+                             "Seal() called on an object without a reference to it");
+    }
+    if (object_entry->second->is_sealed || !seen.insert(object_id).second) {
+      return MakePlasmaError(PlasmaErrorCode::PlasmaObjectAlreadySealed,
+                             "Seal() called on an already sealed object");
+    }
+  }
+
+  std::vector<std::string> digests;
+  digests.reserve(object_ids.size());
+  for (const auto& object_id : object_ids) {
+    objects_in_use_[object_id]->is_sealed = true;
+    std::string digest(kDigestSize, '\0');
+    RETURN_NOT_OK(Hash(object_id, reinterpret_cast<uint8_t*>(&digest[0])));
+    digests.push_back(std::move(digest));
+  }
+  RETURN_NOT_OK(SendPendingReleases());
+  RETURN_NOT_OK(SendSealBatchRequest(store_conn_, object_ids, digests));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaSealBatchReply, &buffer));
+  RETURN_NOT_OK(ReadSealBatchReply(buffer.data(), buffer.size()));
+  // Drop the references taken by Create(), as in Seal() above.
+  for (const auto& object_id : object_ids) {
+    RETURN_NOT_OK(Release(object_id));
+  }
+  return Status::OK();
+}
+
 Status PlasmaClient::Impl::Abort(const ObjectID& object_id) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
   auto object_entry = objects_in_use_.find(object_id);
@@ -903,6 +1097,7 @@ Status PlasmaClient::Impl::Abort(const ObjectID& object_id) {
 #endif
 
   // Send the abort request.
+  RETURN_NOT_OK(SendPendingReleases());
   RETURN_NOT_OK(SendAbortRequest(store_conn_, object_id));
   // Decrease the reference count to zero, then remove the object.
   object_entry->second->count--;
@@ -928,6 +1123,7 @@ Status PlasmaClient::Impl::Delete(const std::vector<ObjectID>& object_ids) {
     }
   }
   if (not_in_use_ids.size() > 0) {
+    RETURN_NOT_OK(SendPendingReleases());
     RETURN_NOT_OK(SendDeleteRequest(store_conn_, not_in_use_ids));
     std::vector<uint8_t> buffer;
     RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaDeleteReply, &buffer));
@@ -944,6 +1140,7 @@ Status PlasmaClient::Impl::Evict(int64_t num_bytes, int64_t& num_bytes_evicted)
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
   // Send a request to the store to evict objects.
+  RETURN_NOT_OK(SendPendingReleases());
   RETURN_NOT_OK(SendEvictRequest(store_conn_, num_bytes));
   // Wait for a response with the number of bytes actually evicted.
   std::vector<uint8_t> buffer;
@@ -955,6 +1152,7 @@ Status PlasmaClient::Impl::Evict(int64_t num_bytes, int64_t& num_bytes_evicted)
 Status PlasmaClient::Impl::Refresh(const std::vector<ObjectID>& object_ids) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
+  RETURN_NOT_OK(SendPendingReleases());
   RETURN_NOT_OK(SendRefreshLRURequest(store_conn_, object_ids));
   std::vector<uint8_t> buffer;
   MessageType type;
@@ -990,6 +1188,7 @@ Status PlasmaClient::Impl::Subscribe(int* fd) {
   int flags = fcntl(sock[1], F_GETFL, 0);
   ARROW_CHECK(fcntl(sock[1], F_SETFL, flags | O_NONBLOCK) == 0);
   // Tell the Plasma store about the subscription.
+  RETURN_NOT_OK(SendPendingReleases());
   RETURN_NOT_OK(SendSubscribeRequest(store_conn_));
   // Send the file descriptor that the Plasma store should use to push
   // notifications about sealed objects to this client.
@@ -1078,6 +1277,7 @@ Status PlasmaClient::Impl::Connect(const std::string& store_socket_name,
 Status PlasmaClient::Impl::SetClientOptions(const std::string& client_name,
                                             int64_t output_memory_quota) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+  RETURN_NOT_OK(SendPendingReleases());
   RETURN_NOT_OK(SendSetOptionsRequest(store_conn_, client_name, output_memory_quota));
   std::vector<uint8_t> buffer;
   RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaSetOptionsReply, &buffer));
@@ -1085,11 +1285,13 @@ Status PlasmaClient::Impl::SetClientOptions(const std::string& client_name,
 }
 
 Status PlasmaClient::Impl::Disconnect() {
+  StopReleaseFlusher();
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
   // NOTE: We purposefully do not finish sending release calls for objects in
   // use, so that we don't duplicate PlasmaClient::Release calls (when handling
-  // a SIGTERM, for example).
+  // a SIGTERM, for example). Queued releases are dropped for the same reason.
+  pending_releases_.clear();
 
   // Close the connections to Plasma. The Plasma store will release the objects
   // that were in use by us when handling the SIGPIPE.
@@ -1100,7 +1302,7 @@ Status PlasmaClient::Impl::Disconnect() {
 
 std::string PlasmaClient::Impl::DebugString() {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
-  if (!SendGetDebugStringRequest(store_conn_).ok()) {
+  if (!SendPendingReleases().ok() || !SendGetDebugStringRequest(store_conn_).ok()) {
     return "error sending request";
   }
   std::vector<uint8_t> buffer;
@@ -1133,6 +1335,11 @@ Status PlasmaClient::SetClientOptions(const std::string& client_name,
   return impl_->SetClientOptions(client_name, output_memory_quota);
 }
 
+Status PlasmaClient::SetReleaseBatching(int64_t max_batch_size,
+                                        int64_t flush_interval_ms) {
+  return impl_->SetReleaseBatching(max_batch_size, flush_interval_ms);
+}
+
 Status PlasmaClient::Create(const ObjectID& object_id, int64_t data_size,
                             const uint8_t* metadata, int64_t metadata_size,
                             std::shared_ptr<Buffer>* data, int device_num,
@@ -1167,16 +1374,31 @@ Status PlasmaClient::Release(const ObjectID& object_id) {
   return impl_->Release(object_id);
 }
 
+Status PlasmaClient::FlushReleases() { return impl_->FlushReleases(); }
+
 Status PlasmaClient::Contains(const ObjectID& object_id, bool* has_object) {
   return impl_->Contains(object_id, has_object);
 }
 
+Status PlasmaClient::Contains(const std::vector<ObjectID>& object_ids,
+                              std::vector<bool>* has_object) {
+  return impl_->Contains(object_ids, has_object);
+}
+
+Status PlasmaClient::Prefetch(const std::vector<ObjectID>& object_ids) {
+  return impl_->Prefetch(object_ids);
+}
+
 Status PlasmaClient::List(ObjectTable* objects) { return impl_->List(objects); }
 
 Status PlasmaClient::Abort(const ObjectID& object_id) { return impl_->Abort(object_id); }
 
 Status PlasmaClient::Seal(const ObjectID& object_id) { return impl_->Seal(object_id); }
 
+Status PlasmaClient::Seal(const std::vector<ObjectID>& object_ids) {
+  return impl_->Seal(object_ids);
+}
+
 Status PlasmaClient::Delete(const ObjectID& object_id) {
   return impl_->Delete(std::vector<ObjectID>{object_id});
 }
@@ -71,6 +71,20 @@ class ARROW_EXPORT PlasmaClient {
   ///        this client.
   Status SetClientOptions(const std::string& client_name, int64_t output_memory_quota);
 
+  /// Coalesce the release messages sent to the store.
+  ///
+  /// Objects this client is done with are queued and released with a single
+  /// message once max_batch_size of them are queued, every flush_interval_ms
+  /// milliseconds, or before the next request to the store, whichever comes
+  /// first. Until then the store still counts them as in use by this client.
+  ///
+  /// \param max_batch_size The number of releases to queue. If this is 0 or
+  ///        1, releases are not batched (the default).
+  /// \param flush_interval_ms The interval at which queued releases are sent
+  ///        by a background thread. If this is 0, no thread is started.
+  /// \return The return status.
+  Status SetReleaseBatching(int64_t max_batch_size, int64_t flush_interval_ms = 0);
+
   /// Create an object in the Plasma Store. Any metadata for this object must be
   /// be passed in when the object is created.
   ///
@@ -143,6 +157,14 @@ class ARROW_EXPORT PlasmaClient {
   Status Get(const std::vector<ObjectID>& object_ids, int64_t timeout_ms,
              std::vector<ObjectBuffer>* object_buffers);
 
+  /// Ask the store to restore evicted objects from its external store in the
+  /// background, so that a later Get() doesn't wait for them. Objects that
+  /// are not evicted are ignored.
+  ///
+  /// \param object_ids The IDs of the objects to restore.
+  /// \return The return status.
+  Status Prefetch(const std::vector<ObjectID>& object_ids);
+
   /// Deprecated variant of Get() that doesn't automatically release buffers
   /// when they get out of scope.
   ///
@@ -166,6 +188,11 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Release(const ObjectID& object_id);
 
+  /// Send the releases queued since SetReleaseBatching() to the store.
+  ///
+  /// \return The return status.
+  Status FlushReleases();
+
   /// Check if the object store contains a particular object and the object has
   /// been sealed. The result will be stored in has_object.
   ///
@@ -178,6 +205,15 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Contains(const ObjectID& object_id, bool* has_object);
 
+  /// Check if the object store contains each of a list of objects, with a
+  /// single request.
+  ///
+  /// \param object_ids The IDs of the objects whose presence we are checking.
+  /// \param[out] has_object Whether each object is present and sealed, in the
+  ///             same order as object_ids.
+  /// \return The return status.
+  Status Contains(const std::vector<ObjectID>& object_ids, std::vector<bool>* has_object);
+
   /// List all the objects in the object store.
   ///
   /// This API is experimental and might change in the future.
@@ -210,6 +246,14 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Seal(const ObjectID& object_id);
 
+  /// Seal a list of objects with a single request. Either all the objects are
+  /// sealed, or none of them if one isn't referenced by this client or is
+  /// already sealed.
+  ///
+  /// \param object_ids The IDs of the objects to seal.
+  /// \return The return status.
+  Status Seal(const std::vector<ObjectID>& object_ids);
+
   /// Delete an object from the object store. This currently assumes that the
   /// object is present, has been sealed and not used by another client. Otherwise,
   /// it is a no operation.
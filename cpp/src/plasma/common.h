@@ -88,6 +88,11 @@ enum class ObjectState : int {
   PLASMA_SEALED = 2,
   /// Object is evicted to external store.
   PLASMA_EVICTED = 3,
+  /// Object is sealed and being written to the external store. Its data stays
+  /// in the local Plasma Store until the write completes.
+  PLASMA_SPILLING = 4,
+  /// Object is evicted to external store and being read back from it.
+  PLASMA_RESTORING = 5,
 };
 
 namespace internal {
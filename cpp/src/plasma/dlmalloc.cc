@@ -163,4 +163,13 @@ int fake_munmap(void* addr, int64_t size) {
 
 void SetMallocGranularity(int value) { change_mparam(M_GRANULARITY, value); }
 
+void GetMallocStats(int64_t* footprint, int64_t* in_use, int64_t* free_bytes,
+                    int64_t* free_chunks) {
+  struct mallinfo info = dlmallinfo();
+  *footprint = static_cast<int64_t>(dlmalloc_footprint());
+  *in_use = static_cast<int64_t>(info.uordblks);
+  *free_bytes = static_cast<int64_t>(info.fordblks);
+  *free_chunks = static_cast<int64_t>(info.ordblks);
+}
+
 }  // namespace plasma
@@ -20,6 +20,8 @@
 #include <utility>
 
 #include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 extern "C" {
 #include "plasma/thirdparty/ae/ae.h"
@@ -45,7 +47,17 @@ int EventLoop::TimerEventCallback(aeEventLoop* loop, TimerID timer_id, void* con
 
 constexpr int kInitialEventLoopSize = 1024;
 
-EventLoop::EventLoop() { loop_ = aeCreateEventLoop(kInitialEventLoopSize); }
+EventLoop::EventLoop() {
+  loop_ = aeCreateEventLoop(kInitialEventLoopSize);
+  wakeup_fds_[0] = wakeup_fds_[1] = -1;
+  if (pipe(wakeup_fds_) == 0) {
+    for (int fd : wakeup_fds_) {
+      fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+      fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+    AddFileEvent(wakeup_fds_[0], kEventLoopRead, [this](int events) { RunPosted(); });
+  }
+}
 
 bool EventLoop::AddFileEvent(int fd, int events, const FileCallback& callback) {
   if (file_callbacks_.find(fd) != file_callbacks_.end()) {
@@ -76,15 +88,56 @@ void EventLoop::RemoveFileEvent(int fd) {
   file_callbacks_.erase(fd);
 }
 
+void EventLoop::Post(const PostedCallback& callback) {
+  {
+    std::lock_guard<std::mutex> lock(posted_mutex_);
+    posted_callbacks_.push_back(callback);
+  }
+  Wakeup();
+}
+
+void EventLoop::Wakeup() {
+  if (wakeup_fds_[1] != -1) {
+    // If the pipe is full, the event loop has not drained it yet and will run
+    // the posted handlers anyway.
+    char byte = 0;
+    ssize_t nbytes = write(wakeup_fds_[1], &byte, 1);
+    (void)nbytes;
+  }
+}
+
+void EventLoop::RunPosted() {
+  char buffer[64];
+  while (read(wakeup_fds_[0], buffer, sizeof(buffer)) > 0) {
+  }
+  std::vector<PostedCallback> callbacks;
+  {
+    std::lock_guard<std::mutex> lock(posted_mutex_);
+    callbacks.swap(posted_callbacks_);
+  }
+  for (const auto& callback : callbacks) {
+    callback();
+  }
+}
+
 void EventLoop::Start() { aeMain(loop_); }
 
-void EventLoop::Stop() { aeStop(loop_); }
+void EventLoop::Stop() {
+  aeStop(loop_);
+  Wakeup();
+}
 
 void EventLoop::Shutdown() {
   if (loop_ != nullptr) {
     aeDeleteEventLoop(loop_);
     loop_ = nullptr;
   }
+  for (int& fd : wakeup_fds_) {
+    if (fd != -1) {
+      close(fd);
+      fd = -1;
+    }
+  }
 }
 
 EventLoop::~EventLoop() { Shutdown(); }
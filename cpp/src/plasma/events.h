@@ -19,7 +19,9 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 struct aeEventLoop;
 
@@ -56,6 +58,10 @@ class EventLoop {
   // triggered again.
   using TimerCallback = std::function<int(int64_t)>;
 
+  // This handler will be called on the thread running the event loop after
+  // it was posted with Post().
+  using PostedCallback = std::function<void()>;
+
   EventLoop();
 
   ~EventLoop();
@@ -87,10 +93,17 @@ class EventLoop {
   /// \return The ae.c error code. TODO(pcm): needs to be standardized
   int RemoveTimer(int64_t timer_id);
 
+  /// Run a handler on the thread running the event loop. Unlike the other
+  /// methods, this can be called from any thread.
+  ///
+  /// \param callback The callback that will be called by the event loop.
+  void Post(const PostedCallback& callback);
+
   /// \brief Run the event loop.
   void Start();
 
-  /// \brief Stop the event loop
+  /// \brief Stop the event loop. This can be called from any thread, and
+  /// from signal handlers.
   void Stop();
 
   void Shutdown();
@@ -100,7 +113,17 @@ class EventLoop {
 
   static int TimerEventCallback(aeEventLoop* loop, TimerID timer_id, void* context);
 
+  /// Wake up the event loop if it is waiting for events.
+  void Wakeup();
+
+  /// Run the posted handlers.
+  void RunPosted();
+
   aeEventLoop* loop_;
+  /// The pipe used to wake up the event loop when a handler is posted.
+  int wakeup_fds_[2];
+  std::mutex posted_mutex_;
+  std::vector<PostedCallback> posted_callbacks_;
   std::unordered_map<int, std::unique_ptr<FileCallback>> file_callbacks_;
   std::unordered_map<int64_t, std::unique_ptr<TimerCallback>> timer_callbacks_;
 };
@@ -23,6 +23,52 @@
 
 namespace plasma {
 
+namespace {
+
+// The priority of an object in a GDSF cache.
+double GDSFPriority(double inflation, int64_t frequency, int64_t size) {
+  // Empty objects don't free space, so evict them after the others
+  return inflation + static_cast<double>(frequency) / std::max<int64_t>(size, 1);
+}
+
+}  // namespace
+
+arrow::Status ParseCachePolicy(const std::string& name, CachePolicy* out) {
+  if (name == "lru") {
+    *out = CachePolicy::LRU;
+  } else if (name == "gdsf") {
+    *out = CachePolicy::GDSF;
+  } else {
+    return arrow::Status::Invalid("Unknown cache policy '", name, "'");
+  }
+  return arrow::Status::OK();
+}
+
+void ObjectCache::AdjustCapacity(int64_t delta) {
+  ARROW_LOG(INFO) << "adjusting " << name_ << " capacity from " << Capacity() << " to "
+                  << (Capacity() + delta) << " (max " << OriginalCapacity() << ")";
+  capacity_ += delta;
+  ARROW_CHECK(used_capacity_ >= 0) << DebugString();
+}
+
+int64_t ObjectCache::Capacity() const { return capacity_; }
+
+int64_t ObjectCache::OriginalCapacity() const { return original_capacity_; }
+
+int64_t ObjectCache::RemainingCapacity() const { return capacity_ - used_capacity_; }
+
+std::string ObjectCache::DebugString() const {
+  std::stringstream result;
+  result << "\n(" << name_ << ") capacity: " << Capacity();
+  result << "\n(" << name_
+         << ") used: " << 100. * (1. - (RemainingCapacity() / (double)OriginalCapacity()))
+         << "%";
+  result << "\n(" << name_ << ") num objects: " << size();
+  result << "\n(" << name_ << ") num evictions: " << num_evictions_total_;
+  result << "\n(" << name_ << ") bytes evicted: " << bytes_evicted_total_;
+  return result.str();
+}
+
 void LRUCache::Add(const ObjectID& key, int64_t size) {
   auto it = item_map_.find(key);
   ARROW_CHECK(it == item_map_.end());
@@ -45,37 +91,12 @@ int64_t LRUCache::Remove(const ObjectID& key) {
   return size;
 }
 
-void LRUCache::AdjustCapacity(int64_t delta) {
-  ARROW_LOG(INFO) << "adjusting global lru capacity from " << Capacity() << " to "
-                  << (Capacity() + delta) << " (max " << OriginalCapacity() << ")";
-  capacity_ += delta;
-  ARROW_CHECK(used_capacity_ >= 0) << DebugString();
-}
-
-int64_t LRUCache::Capacity() const { return capacity_; }
-
-int64_t LRUCache::OriginalCapacity() const { return original_capacity_; }
-
-int64_t LRUCache::RemainingCapacity() const { return capacity_ - used_capacity_; }
-
 void LRUCache::Foreach(std::function<void(const ObjectID&)> f) {
   for (auto& pair : item_list_) {
     f(pair.first);
   }
 }
 
-std::string LRUCache::DebugString() const {
-  std::stringstream result;
-  result << "\n(" << name_ << ") capacity: " << Capacity();
-  result << "\n(" << name_
-         << ") used: " << 100. * (1. - (RemainingCapacity() / (double)OriginalCapacity()))
-         << "%";
-  result << "\n(" << name_ << ") num objects: " << item_map_.size();
-  result << "\n(" << name_ << ") num evictions: " << num_evictions_total_;
-  result << "\n(" << name_ << ") bytes evicted: " << bytes_evicted_total_;
-  return result.str();
-}
-
 int64_t LRUCache::ChooseObjectsToEvict(int64_t num_bytes_required,
                                        std::vector<ObjectID>* objects_to_evict) {
   int64_t bytes_evicted = 0;
@@ -84,29 +105,112 @@ int64_t LRUCache::ChooseObjectsToEvict(int64_t num_bytes_required,
     it--;
     objects_to_evict->push_back(it->first);
     bytes_evicted += it->second;
-    bytes_evicted_total_ += it->second;
-    num_evictions_total_ += 1;
+    RecordEviction(it->second);
+  }
+  return bytes_evicted;
+}
+
+void GDSFCache::Add(const ObjectID& key, int64_t size) {
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    it = entries_.emplace(key, Entry{size, 1, false, queue_.end()}).first;
+  }
+  Entry& entry = it->second;
+  ARROW_CHECK(!entry.queued);
+  entry.size = size;
+  entry.position = queue_.emplace(GDSFPriority(inflation_, entry.frequency, size), key);
+  entry.queued = true;
+  used_capacity_ += size;
+}
+
+int64_t GDSFCache::Remove(const ObjectID& key) {
+  auto it = entries_.find(key);
+  if (it == entries_.end() || !it->second.queued) {
+    return -1;
+  }
+  Entry& entry = it->second;
+  queue_.erase(entry.position);
+  entry.queued = false;
+  used_capacity_ -= entry.size;
+  ARROW_CHECK(used_capacity_ >= 0) << DebugString();
+  return entry.size;
+}
+
+void GDSFCache::Touch(const ObjectID& key) {
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    return;
+  }
+  Entry& entry = it->second;
+  entry.frequency += 1;
+  if (entry.queued) {
+    queue_.erase(entry.position);
+    entry.position =
+        queue_.emplace(GDSFPriority(inflation_, entry.frequency, entry.size), key);
+  }
+}
+
+void GDSFCache::Forget(const ObjectID& key) {
+  Remove(key);
+  entries_.erase(key);
+}
+
+int64_t GDSFCache::ChooseObjectsToEvict(int64_t num_bytes_required,
+                                        std::vector<ObjectID>* objects_to_evict) {
+  int64_t bytes_evicted = 0;
+  for (auto it = queue_.begin(); bytes_evicted < num_bytes_required && it != queue_.end();
+       ++it) {
+    const int64_t size = entries_.at(it->second).size;
+    objects_to_evict->push_back(it->second);
+    bytes_evicted += size;
+    RecordEviction(size);
+    // Age the objects that stay, so that objects which were hot once
+    // don't stay forever
+    inflation_ = it->first;
   }
   return bytes_evicted;
 }
 
-EvictionPolicy::EvictionPolicy(PlasmaStoreInfo* store_info, int64_t max_size)
-    : pinned_memory_bytes_(0), store_info_(store_info), cache_("global lru", max_size) {}
+void GDSFCache::Foreach(std::function<void(const ObjectID&)> f) {
+  for (auto& pair : queue_) {
+    f(pair.second);
+  }
+}
+
+std::string GDSFCache::DebugString() const {
+  std::stringstream result;
+  result << ObjectCache::DebugString();
+  result << "\n(" << name_ << ") base priority: " << inflation_;
+  return result.str();
+}
+
+EvictionPolicy::EvictionPolicy(PlasmaStoreInfo* store_info, int64_t max_size,
+                               CachePolicy cache_policy)
+    : pinned_memory_bytes_(0), num_hits_(0), num_misses_(0), store_info_(store_info) {
+  switch (cache_policy) {
+    case CachePolicy::GDSF:
+      cache_.reset(new GDSFCache("global gdsf", max_size));
+      break;
+    default:
+      cache_.reset(new LRUCache("global lru", max_size));
+      break;
+  }
+}
 
 int64_t EvictionPolicy::ChooseObjectsToEvict(int64_t num_bytes_required,
                                              std::vector<ObjectID>* objects_to_evict) {
   int64_t bytes_evicted =
-      cache_.ChooseObjectsToEvict(num_bytes_required, objects_to_evict);
-  // Update the LRU cache.
+      cache_->ChooseObjectsToEvict(num_bytes_required, objects_to_evict);
+  // Update the cache. The evicted objects leave the store.
   for (auto& object_id : *objects_to_evict) {
-    cache_.Remove(object_id);
+    cache_->Forget(object_id);
   }
   return bytes_evicted;
 }
 
 void EvictionPolicy::ObjectCreated(const ObjectID& object_id, Client* client,
                                    bool is_create) {
-  cache_.Add(object_id, GetObjectSize(object_id));
+  cache_->Add(object_id, GetObjectSize(object_id));
 }
 
 bool EvictionPolicy::SetClientQuota(Client* client, int64_t output_memory_quota) {
@@ -139,37 +243,55 @@ bool EvictionPolicy::RequireSpace(int64_t size, std::vector<ObjectID>* objects_t
 }
 
 void EvictionPolicy::BeginObjectAccess(const ObjectID& object_id) {
-  // If the object is in the LRU cache, remove it.
-  cache_.Remove(object_id);
+  // If the object is in the cache, remove it.
+  cache_->Remove(object_id);
   pinned_memory_bytes_ += GetObjectSize(object_id);
 }
 
 void EvictionPolicy::EndObjectAccess(const ObjectID& object_id) {
   auto size = GetObjectSize(object_id);
-  // Add the object to the LRU cache.
-  cache_.Add(object_id, size);
+  // Add the object to the cache.
+  cache_->Add(object_id, size);
   pinned_memory_bytes_ -= size;
 }
 
+void EvictionPolicy::ObjectsRequested(const std::vector<ObjectID>& present_ids,
+                                      int64_t num_missing) {
+  num_hits_ += static_cast<int64_t>(present_ids.size());
+  num_misses_ += num_missing;
+  for (const auto& object_id : present_ids) {
+    cache_->Touch(object_id);
+  }
+}
+
 void EvictionPolicy::RemoveObject(const ObjectID& object_id) {
-  // If the object is in the LRU cache, remove it.
-  cache_.Remove(object_id);
+  // If the object is in the cache, remove it.
+  cache_->Forget(object_id);
 }
 
 void EvictionPolicy::RefreshObjects(const std::vector<ObjectID>& object_ids) {
   for (const auto& object_id : object_ids) {
-    int64_t size = cache_.Remove(object_id);
+    int64_t size = cache_->Remove(object_id);
     if (size != -1) {
-      cache_.Add(object_id, size);
+      cache_->Add(object_id, size);
     }
   }
 }
 
 int64_t EvictionPolicy::GetObjectSize(const ObjectID& object_id) const {
-  auto entry = store_info_->objects[object_id].get();
+  auto entry = GetObjectTableEntry(store_info_, object_id);
   return entry->data_size + entry->metadata_size;
 }
 
-std::string EvictionPolicy::DebugString() const { return cache_.DebugString(); }
+std::string EvictionPolicy::HitsDebugString() const {
+  std::stringstream result;
+  result << "\nnum hits: " << num_hits_;
+  result << "\nnum misses: " << num_misses_;
+  return result.str();
+}
+
+std::string EvictionPolicy::DebugString() const {
+  return HitsDebugString() + cache_->DebugString();
+}
 
 }  // namespace plasma
@@ -19,6 +19,8 @@
 
 #include <functional>
 #include <list>
+#include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -37,9 +39,24 @@ namespace plasma {
 //
 // It does not implement memory quotas; see quota_aware_policy for that.
 
-class LRUCache {
+/// The order in which the evictable objects outside of client quotas are
+/// evicted, selected with the -p switch of the store.
+enum class CachePolicy {
+  /// Evict the least recently used object first.
+  LRU,
+  /// Greedy-Dual-Size-Frequency: evict the object with the fewest accesses per
+  /// byte first, aged so that formerly hot objects eventually go too. This
+  /// keeps small, hot objects in memory when large objects are only used once.
+  GDSF
+};
+
+/// Parse the name of a cache policy ("lru" or "gdsf").
+arrow::Status ParseCachePolicy(const std::string& name, CachePolicy* out);
+
+/// A set of evictable objects, and the order in which to evict them.
+class ObjectCache {
  public:
-  LRUCache(const std::string& name, int64_t size)
+  ObjectCache(const std::string& name, int64_t size)
       : name_(name),
         original_capacity_(size),
         capacity_(size),
@@ -47,12 +64,29 @@ class LRUCache {
         num_evictions_total_(0),
         bytes_evicted_total_(0) {}
 
-  void Add(const ObjectID& key, int64_t size);
+  virtual ~ObjectCache() {}
 
-  int64_t Remove(const ObjectID& key);
+  /// Add an object that may be evicted.
+  virtual void Add(const ObjectID& key, int64_t size) = 0;
 
-  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
-                               std::vector<ObjectID>* objects_to_evict);
+  /// Remove an object from the cache, for example because it is in use.
+  ///
+  /// \return The size of the object, or -1 if it wasn't in the cache.
+  virtual int64_t Remove(const ObjectID& key) = 0;
+
+  /// Record a use of an object that was added to the cache before. An object
+  /// is removed from the cache while it is used.
+  virtual void Touch(const ObjectID& key) {}
+
+  /// Remove an object from the cache, and any history of its use, because it
+  /// leaves the store.
+  virtual void Forget(const ObjectID& key) { Remove(key); }
+
+  /// Choose objects from the cache to evict, without removing them.
+  ///
+  /// \return The total size of the objects chosen.
+  virtual int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                                       std::vector<ObjectID>* objects_to_evict) = 0;
 
   int64_t OriginalCapacity() const;
 
@@ -62,18 +96,19 @@ class LRUCache {
 
   void AdjustCapacity(int64_t delta);
 
-  void Foreach(std::function<void(const ObjectID&)>);
+  virtual void Foreach(std::function<void(const ObjectID&)>) = 0;
 
-  std::string DebugString() const;
+  virtual std::string DebugString() const;
 
- private:
-  /// A doubly-linked list containing the items in the cache and
-  /// their sizes in LRU order.
-  typedef std::list<std::pair<ObjectID, int64_t>> ItemList;
-  ItemList item_list_;
-  /// A hash table mapping the object ID of an object in the cache to its
-  /// location in the doubly linked list item_list_.
-  std::unordered_map<ObjectID, ItemList::iterator> item_map_;
+ protected:
+  /// The number of objects in the cache.
+  virtual int64_t size() const = 0;
+
+  /// Record the eviction of an object.
+  void RecordEviction(int64_t size) {
+    bytes_evicted_total_ += size;
+    num_evictions_total_ += 1;
+  }
 
   /// The name of this cache, used for debugging purposes only.
   const std::string name_;
@@ -89,7 +124,80 @@ class LRUCache {
   int64_t bytes_evicted_total_;
 };
 
-/// The eviction policy.
+class LRUCache : public ObjectCache {
+ public:
+  LRUCache(const std::string& name, int64_t size) : ObjectCache(name, size) {}
+
+  void Add(const ObjectID& key, int64_t size) override;
+
+  int64_t Remove(const ObjectID& key) override;
+
+  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                               std::vector<ObjectID>* objects_to_evict) override;
+
+  void Foreach(std::function<void(const ObjectID&)>) override;
+
+ protected:
+  int64_t size() const override { return static_cast<int64_t>(item_map_.size()); }
+
+ private:
+  /// A doubly-linked list containing the items in the cache and
+  /// their sizes in LRU order.
+  typedef std::list<std::pair<ObjectID, int64_t>> ItemList;
+  ItemList item_list_;
+  /// A hash table mapping the object ID of an object in the cache to its
+  /// location in the doubly linked list item_list_.
+  std::unordered_map<ObjectID, ItemList::iterator> item_map_;
+};
+
+/// A Greedy-Dual-Size-Frequency cache. Each object has the priority
+/// L + frequency / size, where L is the priority of the last evicted object,
+/// and objects are evicted in order of increasing priority.
+class GDSFCache : public ObjectCache {
+ public:
+  GDSFCache(const std::string& name, int64_t size)
+      : ObjectCache(name, size), inflation_(0) {}
+
+  void Add(const ObjectID& key, int64_t size) override;
+
+  int64_t Remove(const ObjectID& key) override;
+
+  void Touch(const ObjectID& key) override;
+
+  void Forget(const ObjectID& key) override;
+
+  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                               std::vector<ObjectID>* objects_to_evict) override;
+
+  void Foreach(std::function<void(const ObjectID&)>) override;
+
+  std::string DebugString() const override;
+
+ protected:
+  int64_t size() const override { return static_cast<int64_t>(queue_.size()); }
+
+ private:
+  /// The objects in the cache by priority, lowest first. Objects of equal
+  /// priority are evicted in the order they were added.
+  typedef std::multimap<double, ObjectID> Queue;
+
+  struct Entry {
+    int64_t size;
+    int64_t frequency;
+    /// Whether the object is in queue_. Entries of objects in use are kept
+    /// to remember their access frequency.
+    bool queued;
+    Queue::iterator position;
+  };
+
+  Queue queue_;
+  /// The objects that were added to the cache and haven't left the store.
+  std::unordered_map<ObjectID, Entry> entries_;
+  /// The priority of the last evicted object, which is the base priority of
+  /// the objects added from now on.
+  double inflation_;
+};
+
 class EvictionPolicy {
  public:
   /// Construct an eviction policy.
@@ -97,7 +205,9 @@ class EvictionPolicy {
   /// \param store_info Information about the Plasma store that is exposed
   ///        to the eviction policy.
   /// \param max_size Max size in bytes total of objects to store.
-  explicit EvictionPolicy(PlasmaStoreInfo* store_info, int64_t max_size);
+  /// \param cache_policy The order in which to evict objects.
+  explicit EvictionPolicy(PlasmaStoreInfo* store_info, int64_t max_size,
+                          CachePolicy cache_policy = CachePolicy::LRU);
 
   /// Destroy an eviction policy.
   virtual ~EvictionPolicy() {}
@@ -161,6 +271,16 @@ class EvictionPolicy {
   /// \param object_id The ID of the object that is now being used.
   virtual void BeginObjectAccess(const ObjectID& object_id);
 
+  /// This method will be called whenever a client gets objects, after
+  /// BeginObjectAccess was called for those in the store.
+  ///
+  /// \param present_ids The IDs of the requested objects in the store. These
+  ///        count as hits.
+  /// \param num_missing The number of requested objects not in the store,
+  ///        which count as misses.
+  virtual void ObjectsRequested(const std::vector<ObjectID>& present_ids,
+                                int64_t num_missing);
+
   /// This method will be called whenever an object in the Plasma store that was
   /// being used is no longer being used. When this method is called, the
   /// eviction policy will assume that the objects chosen to be evicted will in
@@ -194,16 +314,24 @@ class EvictionPolicy {
   virtual std::string DebugString() const;
 
  protected:
+  /// Returns the hit and miss counts for DebugString.
+  std::string HitsDebugString() const;
+
   /// Returns the size of the object
   int64_t GetObjectSize(const ObjectID& object_id) const;
 
   /// The number of bytes pinned by applications.
   int64_t pinned_memory_bytes_;
 
+  /// The number of requested objects that were in the store.
+  int64_t num_hits_;
+  /// The number of requested objects that weren't in the store.
+  int64_t num_misses_;
+
   /// Pointer to the plasma store info.
   PlasmaStoreInfo* store_info_;
-  /// Datastructure for the LRU cache.
-  LRUCache cache_;
+  /// The evictable objects outside of client quotas.
+  std::unique_ptr<ObjectCache> cache_;
 };
 
 }  // namespace plasma
@@ -31,6 +31,10 @@ namespace plasma {
 // This file contains declaration for all functions that need to be implemented
 // for an external storage service so that objects evicted from Plasma store
 // can be written to it.
+//
+// Put() and Get() are called from a thread pool of the Plasma store, whose
+// size is set with the -x switch. With more than one thread, they may be
+// called concurrently.
 
 class ExternalStore {
  public:
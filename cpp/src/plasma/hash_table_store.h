@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -44,6 +45,7 @@ class HashTableStore : public ExternalStore {
  private:
   typedef std::unordered_map<ObjectID, std::string> HashTable;
 
+  std::mutex mutex_;
   HashTable table_;
 };
 
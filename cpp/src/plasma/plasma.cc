@@ -87,13 +87,38 @@ std::unique_ptr<uint8_t[]> CreatePlasmaNotificationBuffer(
   return notification;
 }
 
-ObjectTableEntry* GetObjectTableEntry(PlasmaStoreInfo* store_info,
-                                      const ObjectID& object_id) {
-  auto it = store_info->objects.find(object_id);
-  if (it == store_info->objects.end()) {
+constexpr size_t ShardedObjectTable::kDefaultNumShards;
+
+ShardedObjectTable::ShardedObjectTable(size_t num_shards) {
+  DCHECK_GT(num_shards, 0);
+  for (size_t i = 0; i < num_shards; ++i) {
+    shards_.emplace_back(new Shard());
+  }
+}
+
+ObjectTableEntry* ShardedObjectTable::Find(const ObjectID& object_id) const {
+  const auto& objects = shards_[ShardIndex(object_id)]->objects;
+  auto it = objects.find(object_id);
+  if (it == objects.end()) {
     return NULL;
   }
   return it->second.get();
 }
 
+ObjectTableEntry* ShardedObjectTable::Insert(const ObjectID& object_id,
+                                             std::unique_ptr<ObjectTableEntry> entry) {
+  auto& slot = shards_[ShardIndex(object_id)]->objects[object_id];
+  slot = std::move(entry);
+  return slot.get();
+}
+
+void ShardedObjectTable::Erase(const ObjectID& object_id) {
+  shards_[ShardIndex(object_id)]->objects.erase(object_id);
+}
+
+ObjectTableEntry* GetObjectTableEntry(PlasmaStoreInfo* store_info,
+                                      const ObjectID& object_id) {
+  return store_info->objects.Find(object_id);
+}
+
 }  // namespace plasma
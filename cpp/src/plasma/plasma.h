@@ -27,6 +27,7 @@
 #include <unistd.h>  // pid_t
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -69,6 +70,8 @@ struct ObjectInfoT;
 /// Allocation granularity used in plasma for object allocation.
 constexpr int64_t kBlockSize = 64;
 
+class EventLoop;
+
 /// Contains all information that is associated with a Plasma store client.
 struct Client {
   explicit Client(int fd);
@@ -76,6 +79,18 @@ struct Client {
   /// The file descriptor used to communicate with the client.
   int fd;
 
+  /// The event loop serving this client. Messages from the client and
+  /// replies to it are only handled on the thread running this loop.
+  EventLoop* loop;
+
+  /// Whether the client has been disconnected. Handlers that were posted to
+  /// the client's event loop before the disconnection check this.
+  bool disconnected;
+
+  /// Protects object_ids, which get requests completed on other threads
+  /// update.
+  std::mutex mutex;
+
   /// Object ids that are used by this client.
   std::unordered_set<ObjectID> object_ids;
 
@@ -128,10 +143,57 @@ enum class ObjectStatus : int {
   OBJECT_FOUND = 1
 };
 
+/// The object table, split into shards by object ID. Each shard has its own
+/// mutex, so that requests about objects in different shards can be served
+/// concurrently.
+class ShardedObjectTable {
+ public:
+  explicit ShardedObjectTable(size_t num_shards = kDefaultNumShards);
+
+  /// The default number of shards.
+  static constexpr size_t kDefaultNumShards = 64;
+
+  size_t num_shards() const { return shards_.size(); }
+
+  /// The index of the shard that holds an object.
+  size_t ShardIndex(const ObjectID& object_id) const {
+    return std::hash<ObjectID>()(object_id) % shards_.size();
+  }
+
+  /// The mutex protecting a shard and the entries in it.
+  std::mutex& mutex(size_t shard_index) { return shards_[shard_index]->mutex; }
+
+  /// The mutex protecting the shard that holds an object.
+  std::mutex& mutex(const ObjectID& object_id) { return mutex(ShardIndex(object_id)); }
+
+  /// The objects in a shard.
+  const ObjectTable& shard(size_t shard_index) const {
+    return shards_[shard_index]->objects;
+  }
+
+  /// Get an entry, or NULL if the object is not present.
+  ObjectTableEntry* Find(const ObjectID& object_id) const;
+
+  /// Add an entry, replacing any existing entry for the object.
+  ObjectTableEntry* Insert(const ObjectID& object_id,
+                           std::unique_ptr<ObjectTableEntry> entry);
+
+  /// Remove an entry.
+  void Erase(const ObjectID& object_id);
+
+ private:
+  struct Shard {
+    std::mutex mutex;
+    ObjectTable objects;
+  };
+
+  std::vector<std::unique_ptr<Shard>> shards_;
+};
+
 /// The plasma store information that is exposed to the eviction policy.
 struct PlasmaStoreInfo {
   /// Objects that are in the Plasma store.
-  ObjectTable objects;
+  ShardedObjectTable objects;
   /// Boolean flag indicating whether to start the object store with hugepages
   /// support enabled. Huge pages are substantially larger than normal memory
   /// pages (e.g. 2MB or 1GB instead of 4KB) and using them can reduce
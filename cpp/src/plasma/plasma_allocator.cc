@@ -15,11 +15,16 @@
 // specific language governing permissions and limitations
 // under the License.
 
-#include <arrow/util/logging.h>
-
-#include "plasma/malloc.h"
 #include "plasma/plasma_allocator.h"
 
+#include <map>
+#include <memory>
+#include <sstream>
+#include <unordered_map>
+
+#include <arrow/util/bit_util.h>
+#include <arrow/util/logging.h>
+
 namespace plasma {
 
 extern "C" {
@@ -27,21 +32,169 @@ void* dlmemalign(size_t alignment, size_t bytes);
 void dlfree(void* mem);
 }
 
+void GetMallocStats(int64_t* footprint, int64_t* in_use, int64_t* free_bytes,
+                    int64_t* free_chunks);
+
+constexpr int64_t PlasmaAllocator::kMaxSlabObjectSize;
+constexpr int64_t PlasmaAllocator::kSlabSize;
+constexpr int64_t PlasmaAllocator::kSlabAlignment;
+
 int64_t PlasmaAllocator::footprint_limit_ = 0;
 int64_t PlasmaAllocator::allocated_ = 0;
 
+namespace {
+
+// The size classes are the multiples of 64 bytes up to 512 bytes, then four
+// classes per power of two up to kMaxSlabObjectSize, which bounds the
+// internal fragmentation to 20%.
+constexpr int kNumLinearClasses = 8;
+constexpr int kLinearClassStep = 64;
+constexpr int kClassesPerPowerOfTwo = 4;
+constexpr int kFirstPowerOfTwo = 9;
+// 2^9 to 2^16, the largest object size
+constexpr int kNumSizeClasses = kNumLinearClasses + 7 * kClassesPerPowerOfTwo;
+
+int64_t SlotSize(int size_class) {
+  if (size_class < kNumLinearClasses) {
+    return kLinearClassStep * (size_class + 1);
+  }
+  const int index = size_class - kNumLinearClasses;
+  const int64_t power = int64_t(1) << (kFirstPowerOfTwo + index / kClassesPerPowerOfTwo);
+  return power + (index % kClassesPerPowerOfTwo + 1) * (power / kClassesPerPowerOfTwo);
+}
+
+int GetSizeClass(int64_t bytes) {
+  if (bytes <= kNumLinearClasses * kLinearClassStep) {
+    return bytes == 0 ? 0 : static_cast<int>((bytes - 1) / kLinearClassStep);
+  }
+  // 2^exponent < bytes <= 2^(exponent + 1)
+  const int exponent =
+      63 - arrow::BitUtil::CountLeadingZeros(static_cast<uint64_t>(bytes - 1));
+  const int64_t power = int64_t(1) << exponent;
+  const int64_t step = power / kClassesPerPowerOfTwo;
+  return kNumLinearClasses + (exponent - kFirstPowerOfTwo) * kClassesPerPowerOfTwo +
+         static_cast<int>((bytes - power + step - 1) / step) - 1;
+}
+
+struct Slab {
+  uint8_t* base;
+  int size_class;
+  int64_t slot_size;
+  // Stack of the free slots, lowest index on top
+  std::vector<int32_t> free_slots;
+};
+
+struct SizeClassState {
+  // The slabs with free slots, by address. Allocating from the lowest slab
+  // first lets the slabs at higher addresses drain and be returned.
+  std::map<uint8_t*, Slab*> available;
+  int64_t num_slabs = 0;
+  int64_t num_objects = 0;
+  int64_t object_bytes = 0;
+};
+
+// All slabs, by base address
+std::unordered_map<uint8_t*, std::unique_ptr<Slab>> slabs;
+SizeClassState size_classes[kNumSizeClasses];
+int64_t slab_object_bytes = 0;
+
+void* SlabAllocate(int64_t bytes) {
+  const int size_class = GetSizeClass(bytes);
+  SizeClassState& state = size_classes[size_class];
+  Slab* slab;
+  if (state.available.empty()) {
+    auto base = reinterpret_cast<uint8_t*>(dlmemalign(PlasmaAllocator::kSlabSize,
+                                                      PlasmaAllocator::kSlabSize));
+    if (base == nullptr) {
+      return nullptr;
+    }
+    std::unique_ptr<Slab> new_slab(new Slab());
+    new_slab->base = base;
+    new_slab->size_class = size_class;
+    new_slab->slot_size = SlotSize(size_class);
+    const auto num_slots =
+        static_cast<int32_t>(PlasmaAllocator::kSlabSize / new_slab->slot_size);
+    new_slab->free_slots.reserve(num_slots);
+    for (int32_t slot = num_slots - 1; slot >= 0; --slot) {
+      new_slab->free_slots.push_back(slot);
+    }
+    slab = new_slab.get();
+    slabs[base] = std::move(new_slab);
+    state.available[base] = slab;
+    ++state.num_slabs;
+  } else {
+    slab = state.available.begin()->second;
+  }
+
+  const int32_t slot = slab->free_slots.back();
+  slab->free_slots.pop_back();
+  if (slab->free_slots.empty()) {
+    state.available.erase(slab->base);
+  }
+  ++state.num_objects;
+  state.object_bytes += bytes;
+  slab_object_bytes += bytes;
+  return slab->base + slot * slab->slot_size;
+}
+
+// Return false if mem was not allocated from a slab.
+bool SlabFree(void* mem, int64_t bytes) {
+  auto address = reinterpret_cast<uintptr_t>(mem);
+  auto base = reinterpret_cast<uint8_t*>(
+      address & ~static_cast<uintptr_t>(PlasmaAllocator::kSlabSize - 1));
+  auto it = slabs.find(base);
+  if (it == slabs.end()) {
+    return false;
+  }
+  Slab* slab = it->second.get();
+  SizeClassState& state = size_classes[slab->size_class];
+  const auto slot = static_cast<int32_t>((static_cast<uint8_t*>(mem) - base) /
+                                         slab->slot_size);
+  DCHECK_EQ(static_cast<uint8_t*>(mem), base + slot * slab->slot_size);
+  if (slab->free_slots.empty()) {
+    state.available[base] = slab;
+  }
+  slab->free_slots.push_back(slot);
+  --state.num_objects;
+  state.object_bytes -= bytes;
+  slab_object_bytes -= bytes;
+
+  if (static_cast<int64_t>(slab->free_slots.size()) ==
+      PlasmaAllocator::kSlabSize / slab->slot_size) {
+    state.available.erase(base);
+    --state.num_slabs;
+    slabs.erase(it);
+    dlfree(base);
+  }
+  return true;
+}
+
+}  // namespace
+
 void* PlasmaAllocator::Memalign(size_t alignment, size_t bytes) {
   if (allocated_ + static_cast<int64_t>(bytes) > footprint_limit_) {
     return nullptr;
   }
-  void* mem = dlmemalign(alignment, bytes);
-  ARROW_CHECK(mem);
+  void* mem;
+  if (static_cast<int64_t>(bytes) <= kMaxSlabObjectSize &&
+      static_cast<int64_t>(alignment) <= kSlabAlignment) {
+    mem = SlabAllocate(static_cast<int64_t>(bytes));
+  } else {
+    mem = dlmemalign(alignment, bytes);
+  }
+  // dlmalloc fails when it can't map more memory, in which case the store
+  // may still evict objects to make room
+  if (mem == nullptr) {
+    return nullptr;
+  }
   allocated_ += bytes;
   return mem;
 }
 
 void PlasmaAllocator::Free(void* mem, size_t bytes) {
-  dlfree(mem);
+  if (!SlabFree(mem, static_cast<int64_t>(bytes))) {
+    dlfree(mem);
+  }
   allocated_ -= bytes;
 }
 
@@ -53,4 +206,47 @@ int64_t PlasmaAllocator::GetFootprintLimit() { return footprint_limit_; }
 
 int64_t PlasmaAllocator::Allocated() { return allocated_; }
 
+PlasmaAllocatorStats PlasmaAllocator::GetStats() {
+  PlasmaAllocatorStats stats;
+  stats.allocated = allocated_;
+  stats.slab_object_bytes = slab_object_bytes;
+  stats.slab_bytes = static_cast<int64_t>(slabs.size()) * kSlabSize;
+  GetMallocStats(&stats.dlmalloc_footprint, &stats.dlmalloc_in_use,
+                 &stats.dlmalloc_free, &stats.dlmalloc_free_chunks);
+  for (int size_class = 0; size_class < kNumSizeClasses; ++size_class) {
+    const SizeClassState& state = size_classes[size_class];
+    if (state.num_slabs > 0) {
+      stats.size_classes.push_back(
+          {SlotSize(size_class), state.num_slabs, state.num_objects, state.object_bytes});
+    }
+  }
+  return stats;
+}
+
+std::string PlasmaAllocator::DebugString() {
+  const PlasmaAllocatorStats stats = GetStats();
+  const auto percent = [](int64_t part, int64_t total) {
+    return total == 0 ? 0. : 100. * static_cast<double>(part) / total;
+  };
+  std::stringstream result;
+  result << "\n(allocator) object bytes: " << stats.allocated << " ("
+         << percent(stats.allocated, footprint_limit_) << "% of the limit)";
+  result << "\n(allocator) dlmalloc footprint: " << stats.dlmalloc_footprint;
+  result << "\n(allocator) dlmalloc in use: " << stats.dlmalloc_in_use;
+  result << "\n(allocator) dlmalloc free: " << stats.dlmalloc_free << " in "
+         << stats.dlmalloc_free_chunks << " chunks";
+  result << "\n(allocator) slab bytes: " << stats.slab_bytes << " ("
+         << percent(stats.slab_object_bytes, stats.slab_bytes) << "% occupied)";
+  for (const auto& size_class : stats.size_classes) {
+    const int64_t slot_bytes = size_class.num_objects * size_class.slot_size;
+    result << "\n(allocator) size class " << size_class.slot_size
+           << ": slabs: " << size_class.num_slabs
+           << ", objects: " << size_class.num_objects << ", slots used: "
+           << percent(slot_bytes, size_class.num_slabs * kSlabSize)
+           << "%, internal fragmentation: "
+           << percent(slot_bytes - size_class.object_bytes, slot_bytes) << "%";
+  }
+  return result.str();
+}
+
 }  // namespace plasma
@@ -19,9 +19,53 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <string>
+#include <vector>
 
 namespace plasma {
 
+/// Memory usage of the Plasma allocator.
+struct PlasmaAllocatorStats {
+  /// Usage of one slab size class.
+  struct SizeClass {
+    /// Size of the slots of the class in bytes.
+    int64_t slot_size;
+    /// Number of slabs of the class.
+    int64_t num_slabs;
+    /// Number of slots in use.
+    int64_t num_objects;
+    /// Number of bytes requested for the objects in the slots.
+    int64_t object_bytes;
+  };
+
+  /// Number of bytes requested for the objects, as reported by Allocated().
+  int64_t allocated;
+  /// Number of bytes requested for the objects allocated from slabs.
+  int64_t slab_object_bytes;
+  /// Number of bytes held by slabs, used or not.
+  int64_t slab_bytes;
+  /// Number of bytes mapped by dlmalloc, including the slabs.
+  int64_t dlmalloc_footprint;
+  /// Number of bytes in use in the dlmalloc chunks, including the slabs.
+  int64_t dlmalloc_in_use;
+  /// Number of free bytes in the dlmalloc chunks.
+  int64_t dlmalloc_free;
+  /// Number of free dlmalloc chunks.
+  int64_t dlmalloc_free_chunks;
+  /// Usage of the size classes with at least one slab.
+  std::vector<SizeClass> size_classes;
+};
+
+/// The allocator of the shared memory of the Plasma store.
+///
+/// Objects of up to kMaxSlabObjectSize bytes are carved out of slabs, each of
+/// which holds objects of a single size class, so that many small objects
+/// don't fragment the dlmalloc arena. Slabs themselves, and larger objects,
+/// are allocated with dlmalloc. A slab is returned to dlmalloc as soon as its
+/// last object is freed.
+///
+/// PlasmaAllocator is not thread-safe; the store serializes the calls with
+/// its memory mutex.
 class PlasmaAllocator {
  public:
   /// Allocates size bytes and returns a pointer to the allocated memory. The
@@ -53,6 +97,22 @@ class PlasmaAllocator {
   /// \return Number of bytes allocated by Plasma so far.
   static int64_t Allocated();
 
+  /// Get the memory usage of the allocator, to tell its occupancy and
+  /// fragmentation.
+  ///
+  /// This walks the dlmalloc chunks, so it is meant for debugging.
+  static PlasmaAllocatorStats GetStats();
+
+  /// Get a human-readable version of GetStats().
+  static std::string DebugString();
+
+  /// Largest object allocated from slabs.
+  static constexpr int64_t kMaxSlabObjectSize = 64 * 1024;
+  /// Size and alignment of the slabs.
+  static constexpr int64_t kSlabSize = 256 * 1024;
+  /// Largest alignment honored for objects allocated from slabs.
+  static constexpr int64_t kSlabAlignment = 64;
+
  private:
   static int64_t allocated_;
   static int64_t footprint_limit_;
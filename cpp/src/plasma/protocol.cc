@@ -425,6 +425,48 @@ Status ReadSealReply(const uint8_t* data, size_t size, ObjectID* object_id) {
   return PlasmaErrorStatus(message->error());
 }
 
+Status SendSealBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                            const std::vector<std::string>& digests) {
+  DCHECK(object_ids.size() == digests.size());
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaSealBatchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      ToFlatbuffer(&fbb, digests));
+  return PlasmaSend(sock, MessageType::PlasmaSealBatchRequest, &fbb, message);
+}
+
+Status ReadSealBatchRequest(const uint8_t* data, size_t size,
+                            std::vector<ObjectID>* object_ids,
+                            std::vector<std::string>* digests) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaSealBatchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  ConvertToVector(message->object_ids(), object_ids,
+                  [](const flatbuffers::String& element) {
+                    return ObjectID::from_binary(element.str());
+                  });
+  ConvertToVector(message->digests(), digests,
+                  [](const flatbuffers::String& element) { return element.str(); });
+  ARROW_CHECK_EQ(object_ids->size(), digests->size());
+  for (const auto& digest : *digests) {
+    ARROW_CHECK_EQ(digest.size(), kDigestSize);
+  }
+  return Status::OK();
+}
+
+Status SendSealBatchReply(int sock, PlasmaError error) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaSealBatchReply(fbb, error);
+  return PlasmaSend(sock, MessageType::PlasmaSealBatchReply, &fbb, message);
+}
+
+Status ReadSealBatchReply(const uint8_t* data, size_t size) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaSealBatchReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  return PlasmaErrorStatus(message->error());
+}
+
 // Release messages.
 
 Status SendReleaseRequest(int sock, ObjectID object_id) {
@@ -457,6 +499,25 @@ Status ReadReleaseReply(const uint8_t* data, size_t size, ObjectID* object_id) {
   return PlasmaErrorStatus(message->error());
 }
 
+Status SendReleaseBatchRequest(int sock, const std::vector<ObjectID>& object_ids) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaReleaseBatchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()));
+  return PlasmaSend(sock, MessageType::PlasmaReleaseBatchRequest, &fbb, message);
+}
+
+Status ReadReleaseBatchRequest(const uint8_t* data, size_t size,
+                               std::vector<ObjectID>* object_ids) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaReleaseBatchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  ConvertToVector(message->object_ids(), object_ids,
+                  [](const flatbuffers::String& element) {
+                    return ObjectID::from_binary(element.str());
+                  });
+  return Status::OK();
+}
+
 // Delete objects messages.
 
 Status SendDeleteRequest(int sock, const std::vector<ObjectID>& object_ids) {
@@ -547,6 +608,53 @@ Status ReadContainsReply(const uint8_t* data, size_t size, ObjectID* object_id,
   return Status::OK();
 }
 
+Status SendContainsBatchRequest(int sock, const std::vector<ObjectID>& object_ids) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaContainsBatchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()));
+  return PlasmaSend(sock, MessageType::PlasmaContainsBatchRequest, &fbb, message);
+}
+
+Status ReadContainsBatchRequest(const uint8_t* data, size_t size,
+                                std::vector<ObjectID>* object_ids) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaContainsBatchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  ConvertToVector(message->object_ids(), object_ids,
+                  [](const flatbuffers::String& element) {
+                    return ObjectID::from_binary(element.str());
+                  });
+  return Status::OK();
+}
+
+Status SendContainsBatchReply(int sock, const std::vector<ObjectID>& object_ids,
+                              const std::vector<bool>& has_object) {
+  DCHECK(object_ids.size() == has_object.size());
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<int32_t> flags(has_object.begin(), has_object.end());
+  auto message = fb::CreatePlasmaContainsBatchReply(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      fbb.CreateVector(arrow::util::MakeNonNull(flags.data()), flags.size()));
+  return PlasmaSend(sock, MessageType::PlasmaContainsBatchReply, &fbb, message);
+}
+
+Status ReadContainsBatchReply(const uint8_t* data, size_t size,
+                              std::vector<ObjectID>* object_ids,
+                              std::vector<bool>* has_object) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaContainsBatchReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  ConvertToVector(message->object_ids(), object_ids,
+                  [](const flatbuffers::String& element) {
+                    return ObjectID::from_binary(element.str());
+                  });
+  has_object->clear();
+  for (uoffset_t i = 0; i < message->has_object()->size(); ++i) {
+    has_object->push_back(message->has_object()->Get(i) != 0);
+  }
+  return Status::OK();
+}
+
 // List messages.
 
 Status SendListRequest(int sock) {
@@ -741,6 +849,25 @@ Status ReadGetReply(const uint8_t* data, size_t size, ObjectID object_ids[],
   return Status::OK();
 }
 
+Status SendPrefetchRequest(int sock, const std::vector<ObjectID>& object_ids) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaPrefetchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()));
+  return PlasmaSend(sock, MessageType::PlasmaPrefetchRequest, &fbb, message);
+}
+
+Status ReadPrefetchRequest(const uint8_t* data, size_t size,
+                           std::vector<ObjectID>* object_ids) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaPrefetchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  ConvertToVector(message->object_ids(), object_ids,
+                  [](const flatbuffers::String& element) {
+                    return ObjectID::from_binary(element.str());
+                  });
+  return Status::OK();
+}
+
 // Subscribe messages.
 
 Status SendSubscribeRequest(int sock) {
@@ -138,6 +138,17 @@ Status SendSealReply(int sock, ObjectID object_id, PlasmaError error);
 
 Status ReadSealReply(const uint8_t* data, size_t size, ObjectID* object_id);
 
+Status SendSealBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                            const std::vector<std::string>& digests);
+
+Status ReadSealBatchRequest(const uint8_t* data, size_t size,
+                            std::vector<ObjectID>* object_ids,
+                            std::vector<std::string>* digests);
+
+Status SendSealBatchReply(int sock, PlasmaError error);
+
+Status ReadSealBatchReply(const uint8_t* data, size_t size);
+
 /* Plasma Get message functions. */
 
 Status SendGetRequest(int sock, const ObjectID* object_ids, int64_t num_objects,
@@ -155,6 +166,11 @@ Status ReadGetReply(const uint8_t* data, size_t size, ObjectID object_ids[],
                     PlasmaObject plasma_objects[], int64_t num_objects,
                     std::vector<int>& store_fds, std::vector<int64_t>& mmap_sizes);
 
+Status SendPrefetchRequest(int sock, const std::vector<ObjectID>& object_ids);
+
+Status ReadPrefetchRequest(const uint8_t* data, size_t size,
+                           std::vector<ObjectID>* object_ids);
+
 /* Plasma Release message functions. */
 
 Status SendReleaseRequest(int sock, ObjectID object_id);
@@ -165,6 +181,11 @@ Status SendReleaseReply(int sock, ObjectID object_id, PlasmaError error);
 
 Status ReadReleaseReply(const uint8_t* data, size_t size, ObjectID* object_id);
 
+Status SendReleaseBatchRequest(int sock, const std::vector<ObjectID>& object_ids);
+
+Status ReadReleaseBatchRequest(const uint8_t* data, size_t size,
+                               std::vector<ObjectID>* object_ids);
+
 /* Plasma Delete objects message functions. */
 
 Status SendDeleteRequest(int sock, const std::vector<ObjectID>& object_ids);
@@ -190,6 +211,18 @@ Status SendContainsReply(int sock, ObjectID object_id, bool has_object);
 Status ReadContainsReply(const uint8_t* data, size_t size, ObjectID* object_id,
                          bool* has_object);
 
+Status SendContainsBatchRequest(int sock, const std::vector<ObjectID>& object_ids);
+
+Status ReadContainsBatchRequest(const uint8_t* data, size_t size,
+                                std::vector<ObjectID>* object_ids);
+
+Status SendContainsBatchReply(int sock, const std::vector<ObjectID>& object_ids,
+                              const std::vector<bool>& has_object);
+
+Status ReadContainsBatchReply(const uint8_t* data, size_t size,
+                              std::vector<ObjectID>* object_ids,
+                              std::vector<bool>* has_object);
+
 /* Plasma List message functions. */
 
 Status SendListRequest(int sock);
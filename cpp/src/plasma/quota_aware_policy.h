@@ -59,7 +59,9 @@ class QuotaAwarePolicy : public EvictionPolicy {
   /// \param store_info Information about the Plasma store that is exposed
   ///        to the eviction policy.
   /// \param max_size Max size in bytes total of objects to store.
-  explicit QuotaAwarePolicy(PlasmaStoreInfo* store_info, int64_t max_size);
+  /// \param cache_policy The order in which to evict objects outside of quotas.
+  explicit QuotaAwarePolicy(PlasmaStoreInfo* store_info, int64_t max_size,
+                            CachePolicy cache_policy = CachePolicy::LRU);
   void ObjectCreated(const ObjectID& object_id, Client* client, bool is_create) override;
   bool SetClientQuota(Client* client, int64_t output_memory_quota) override;
   bool EnforcePerClientQuota(Client* client, int64_t size, bool is_create,
@@ -18,8 +18,9 @@
 // PLASMA STORE: This is a simple object store server process
 //
 // It accepts incoming client connections on a unix domain socket
-// (name passed in via the -s option of the executable) and uses a
-// single thread to serve the clients. Each client establishes a
+// (name passed in via the -s option of the executable) and serves the
+// clients from one or more threads (-t option), while sealed object
+// notifications are sent by a separate thread. Each client establishes a
 // connection and can create objects, wait for objects and seal
 // objects through that connection.
 //
@@ -43,12 +44,15 @@
 #include <sys/un.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <ctime>
 #include <deque>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -58,6 +62,7 @@
 
 #include "arrow/status.h"
 #include "arrow/util/config.h"
+#include "arrow/util/thread_pool.h"
 
 #include "plasma/common.h"
 #include "plasma/common_generated.h"
@@ -101,6 +106,9 @@ struct GetRequest {
   /// The number of object requests in this wait request that are already
   /// satisfied.
   int64_t num_satisfied;
+  /// Whether the request has been satisfied or has timed out, and is no
+  /// longer in object_get_requests_.
+  bool completed;
 };
 
 GetRequest::GetRequest(Client* client, const std::vector<ObjectID>& object_ids)
@@ -108,32 +116,106 @@ GetRequest::GetRequest(Client* client, const std::vector<ObjectID>& object_ids)
       timer(-1),
       object_ids(object_ids.begin(), object_ids.end()),
       objects(object_ids.size()),
-      num_satisfied(0) {
+      num_satisfied(0),
+      completed(false) {
   std::unordered_set<ObjectID> unique_ids(object_ids.begin(), object_ids.end());
   num_objects_to_wait_for = unique_ids.size();
 }
 
-Client::Client(int fd) : fd(fd), notification_fd(-1) {}
+namespace {
+
+// Split objects into at most num_batches batches of similar total size.
+std::vector<std::pair<size_t, size_t>> SplitIntoBatches(
+    const std::vector<ObjectTableEntry*>& entries, int num_batches) {
+  int64_t total_size = 0;
+  for (auto entry : entries) {
+    total_size += entry->data_size + entry->metadata_size;
+  }
+  const int64_t batch_size = (total_size + num_batches - 1) / num_batches;
+  std::vector<std::pair<size_t, size_t>> batches;
+  size_t begin = 0;
+  int64_t size = 0;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    size += entries[i]->data_size + entries[i]->metadata_size;
+    if (size >= batch_size || i + 1 == entries.size()) {
+      batches.emplace_back(begin, i + 1);
+      begin = i + 1;
+      size = 0;
+    }
+  }
+  return batches;
+}
+
+}  // namespace
+
+Client::Client(int fd)
+    : fd(fd), loop(nullptr), disconnected(false), notification_fd(-1) {}
 
 PlasmaStore::PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_enabled,
                          const std::string& socket_name,
                          std::shared_ptr<ExternalStore> external_store)
+    : PlasmaStore(loop, {}, nullptr, directory, hugepages_enabled, socket_name,
+                  external_store) {}
+
+PlasmaStore::PlasmaStore(EventLoop* loop, std::vector<EventLoop*> io_loops,
+                         EventLoop* notification_loop, std::string directory,
+                         bool hugepages_enabled, const std::string& socket_name,
+                         std::shared_ptr<ExternalStore> external_store,
+                         int num_external_store_threads, CachePolicy cache_policy)
     : loop_(loop),
-      eviction_policy_(&store_info_, PlasmaAllocator::GetFootprintLimit()),
+      next_io_loop_(0),
+      notification_loop_(notification_loop ? notification_loop : loop),
+      spilling_bytes_(0),
+      eviction_policy_(&store_info_, PlasmaAllocator::GetFootprintLimit(),
+                       cache_policy),
+      notifications_scheduled_(false),
       external_store_(external_store) {
+  io_loops_.push_back(loop);
+  io_loops_.insert(io_loops_.end(), io_loops.begin(), io_loops.end());
   store_info_.directory = directory;
   store_info_.hugepages_enabled = hugepages_enabled;
+  if (external_store_) {
+    external_store_pool_ =
+        arrow::internal::ThreadPool::Make(num_external_store_threads).ValueOrDie();
+  }
 }
 
 // TODO(pcm): Get rid of this destructor by using RAII to clean up data.
-PlasmaStore::~PlasmaStore() {}
+PlasmaStore::~PlasmaStore() {
+  // Finish the accesses to the external store, which refer to the store
+  if (external_store_pool_) {
+    ARROW_CHECK_OK(external_store_pool_->Shutdown());
+  }
+}
 
 const PlasmaStoreInfo* PlasmaStore::GetPlasmaStoreInfo() { return &store_info_; }
 
+std::vector<std::unique_lock<std::mutex>> PlasmaStore::LockShards(
+    const std::vector<ObjectID>& object_ids) {
+  std::vector<size_t> shards;
+  for (const auto& object_id : object_ids) {
+    shards.push_back(store_info_.objects.ShardIndex(object_id));
+  }
+  std::sort(shards.begin(), shards.end());
+  shards.erase(std::unique(shards.begin(), shards.end()), shards.end());
+  std::vector<std::unique_lock<std::mutex>> locks;
+  for (size_t shard : shards) {
+    locks.emplace_back(store_info_.objects.mutex(shard));
+  }
+  return locks;
+}
+
+int64_t PlasmaStore::MmapSize(int fd) {
+  std::lock_guard<std::mutex> lock(memory_mutex_);
+  return GetMmapSize(fd);
+}
+
 // If this client is not already using the object, add the client to the
-// object's list of clients, otherwise do nothing.
+// object's list of clients, otherwise do nothing. The caller must hold the
+// shard mutex of the object.
 void PlasmaStore::AddToClientObjectIds(const ObjectID& object_id, ObjectTableEntry* entry,
                                        Client* client) {
+  std::lock_guard<std::mutex> client_lock(client->mutex);
   // Check if this client is already using the object.
   if (client->object_ids.find(object_id) != client->object_ids.end()) {
     return;
@@ -142,6 +224,7 @@ void PlasmaStore::AddToClientObjectIds(const ObjectID& object_id, ObjectTableEnt
   // that the object is being used.
   if (entry->ref_count == 0) {
     // Tell the eviction policy that this object is being used.
+    std::lock_guard<std::mutex> policy_lock(policy_mutex_);
     eviction_policy_.BeginObjectAccess(object_id);
   }
   // Increase reference count.
@@ -151,15 +234,19 @@ void PlasmaStore::AddToClientObjectIds(const ObjectID& object_id, ObjectTableEnt
   client->object_ids.insert(object_id);
 }
 
-// Allocate memory
+// Allocate memory. The caller must hold memory_mutex_.
 uint8_t* PlasmaStore::AllocateMemory(size_t size, bool evict_if_full, int* fd,
                                      int64_t* map_size, ptrdiff_t* offset, Client* client,
                                      bool is_create) {
   // First free up space from the client's LRU queue if quota enforcement is on.
   if (evict_if_full) {
     std::vector<ObjectID> client_objects_to_evict;
-    bool quota_ok = eviction_policy_.EnforcePerClientQuota(client, size, is_create,
-                                                           &client_objects_to_evict);
+    bool quota_ok;
+    {
+      std::lock_guard<std::mutex> lock(policy_mutex_);
+      quota_ok = eviction_policy_.EnforcePerClientQuota(client, size, is_create,
+                                                        &client_objects_to_evict);
+    }
     if (!quota_ok) {
       return nullptr;
     }
@@ -183,13 +270,23 @@ uint8_t* PlasmaStore::AllocateMemory(size_t size, bool evict_if_full, int* fd,
       // make more space, return an error to the client.
       break;
     }
+    if (spilling_bytes_ > 0) {
+      // Wait for the objects being spilled to be freed before evicting more.
+      // memory_mutex_ is released meanwhile.
+      spills_done_.wait(memory_mutex_);
+      continue;
+    }
     // Tell the eviction policy how much space we need to create this object.
     std::vector<ObjectID> objects_to_evict;
-    bool success = eviction_policy_.RequireSpace(size, &objects_to_evict);
+    bool success;
+    {
+      std::lock_guard<std::mutex> lock(policy_mutex_);
+      success = eviction_policy_.RequireSpace(size, &objects_to_evict);
+    }
     EvictObjects(objects_to_evict);
     // Return an error to the client if not enough space could be freed to
     // create the object.
-    if (!success) {
+    if (!success && spilling_bytes_ == 0) {
       break;
     }
   }
@@ -232,7 +329,15 @@ PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, bool evict_if_f
                                       PlasmaObject* result) {
   ARROW_LOG(DEBUG) << "creating object " << object_id.hex();
 
-  auto entry = GetObjectTableEntry(&store_info_, object_id);
+  // Creations are serialized, so the object can only be added by another
+  // client while memory is allocated for it if the allocation waits for
+  // spills.
+  std::lock_guard<std::mutex> memory_lock(memory_mutex_);
+  ObjectTableEntry* entry;
+  {
+    std::lock_guard<std::mutex> lock(store_info_.objects.mutex(object_id));
+    entry = GetObjectTableEntry(&store_info_, object_id);
+  }
   if (entry != nullptr) {
     // There is already an object with the same ID in the Plasma Store, so
     // ignore this request.
@@ -255,6 +360,11 @@ PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, bool evict_if_f
                        << ", will send a reply of PlasmaError::OutOfMemory";
       return PlasmaError::OutOfMemory;
     }
+    std::lock_guard<std::mutex> lock(store_info_.objects.mutex(object_id));
+    if (GetObjectTableEntry(&store_info_, object_id) != nullptr) {
+      PlasmaAllocator::Free(pointer, total_size);
+      return PlasmaError::ObjectExists;
+    }
   } else {
 #ifdef PLASMA_CUDA
     /// IPC GPU handle to share with clients.
@@ -271,8 +381,9 @@ PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, bool evict_if_f
 #endif
   }
 
+  std::lock_guard<std::mutex> lock(store_info_.objects.mutex(object_id));
   auto ptr = std::unique_ptr<ObjectTableEntry>(new ObjectTableEntry());
-  entry = store_info_.objects.emplace(object_id, std::move(ptr)).first->second.get();
+  entry = store_info_.objects.Insert(object_id, std::move(ptr));
   entry->data_size = data_size;
   entry->metadata_size = metadata_size;
   entry->pointer = pointer;
@@ -298,9 +409,12 @@ PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, bool evict_if_f
   // Notify the eviction policy that this object was created. This must be done
   // immediately before the call to AddToClientObjectIds so that the
   // eviction policy does not have an opportunity to evict the object.
-  eviction_policy_.ObjectCreated(object_id, client, true);
+  {
+    std::lock_guard<std::mutex> policy_lock(policy_mutex_);
+    eviction_policy_.ObjectCreated(object_id, client, true);
+  }
   // Record that this client is using this object.
-  AddToClientObjectIds(object_id, store_info_.objects[object_id].get(), client);
+  AddToClientObjectIds(object_id, entry, client);
   return PlasmaError::OK;
 }
 
@@ -321,7 +435,7 @@ void PlasmaObject_init(PlasmaObject* object, ObjectTableEntry* entry) {
   object->device_num = entry->device_num;
 }
 
-void PlasmaStore::RemoveGetRequest(GetRequest* get_request) {
+void PlasmaStore::CompleteGetRequest(GetRequest* get_request) {
   // Remove the get request from each of the relevant object_get_requests hash
   // tables if it is present there. It should only be present there if the get
   // request timed out or if it was issued by a client that has disconnected.
@@ -340,32 +454,51 @@ void PlasmaStore::RemoveGetRequest(GetRequest* get_request) {
       }
     }
   }
+  get_request->completed = true;
+}
+
+void PlasmaStore::RemoveGetRequest(GetRequest* get_request) {
   // Remove the get request.
   if (get_request->timer != -1) {
-    ARROW_CHECK(loop_->RemoveTimer(get_request->timer) == kEventLoopOk);
+    ARROW_CHECK(get_request->client->loop->RemoveTimer(get_request->timer) ==
+                kEventLoopOk);
   }
   delete get_request;
 }
 
 void PlasmaStore::RemoveGetRequestsForClient(Client* client) {
   std::unordered_set<GetRequest*> get_requests_to_remove;
-  for (auto const& pair : object_get_requests_) {
-    for (GetRequest* get_request : pair.second) {
-      if (get_request->client == client) {
-        get_requests_to_remove.insert(get_request);
+  {
+    std::lock_guard<std::mutex> lock(get_requests_mutex_);
+    for (auto const& pair : object_get_requests_) {
+      for (GetRequest* get_request : pair.second) {
+        if (get_request->client == client) {
+          get_requests_to_remove.insert(get_request);
+        }
       }
     }
-  }
 
-  // It shouldn't be possible for a given client to be in the middle of multiple get
-  // requests.
-  ARROW_CHECK(get_requests_to_remove.size() <= 1);
+    // It shouldn't be possible for a given client to be in the middle of multiple get
+    // requests.
+    ARROW_CHECK(get_requests_to_remove.size() <= 1);
+    for (GetRequest* get_request : get_requests_to_remove) {
+      CompleteGetRequest(get_request);
+    }
+  }
   for (GetRequest* get_request : get_requests_to_remove) {
     RemoveGetRequest(get_request);
   }
 }
 
 void PlasmaStore::ReturnFromGet(GetRequest* get_req) {
+  DCHECK(get_req->completed);
+  // The reply may have been posted before the client disconnected, in which
+  // case its file descriptor may have been reused already.
+  if (get_req->client->disconnected) {
+    RemoveGetRequest(get_req);
+    return;
+  }
+
   // Figure out how many file descriptors we need to send.
   std::unordered_set<int> fds_to_send;
   std::vector<int> store_fds;
@@ -376,7 +509,7 @@ void PlasmaStore::ReturnFromGet(GetRequest* get_req) {
     if (object.data_size != -1 && fds_to_send.count(fd) == 0 && fd != -1) {
       fds_to_send.insert(fd);
       store_fds.push_back(fd);
-      mmap_sizes.push_back(GetMmapSize(fd));
+      mmap_sizes.push_back(MmapSize(fd));
     }
   }
 
@@ -398,9 +531,6 @@ void PlasmaStore::ReturnFromGet(GetRequest* get_req) {
     }
   }
 
-  // Remove the get request from each of the relevant object_get_requests hash
-  // tables if it is present there. It should only be present there if the get
-  // request timed out.
   RemoveGetRequest(get_req);
 }
 
@@ -419,29 +549,33 @@ void PlasmaStore::UpdateObjectGetRequests(const ObjectID& object_id) {
   size_t num_requests = get_requests.size();
   for (size_t i = 0; i < num_requests; ++i) {
     auto get_req = get_requests[index];
-    auto entry = GetObjectTableEntry(&store_info_, object_id);
-    ARROW_CHECK(entry != nullptr);
+    {
+      std::lock_guard<std::mutex> lock(store_info_.objects.mutex(object_id));
+      auto entry = GetObjectTableEntry(&store_info_, object_id);
+      ARROW_CHECK(entry != nullptr);
 
-    PlasmaObject_init(&get_req->objects[object_id], entry);
-    get_req->num_satisfied += 1;
-    // Record the fact that this client will be using this object and will
-    // be responsible for releasing this object.
-    AddToClientObjectIds(object_id, entry, get_req->client);
+      PlasmaObject_init(&get_req->objects[object_id], entry);
+      get_req->num_satisfied += 1;
+      // Record the fact that this client will be using this object and will
+      // be responsible for releasing this object.
+      AddToClientObjectIds(object_id, entry, get_req->client);
+    }
 
-    // If this get request is done, reply to the client.
+    // If this get request is done, reply to the client from its own event loop.
     if (get_req->num_satisfied == get_req->num_objects_to_wait_for) {
-      ReturnFromGet(get_req);
+      CompleteGetRequest(get_req);
+      get_req->client->loop->Post([this, get_req]() { ReturnFromGet(get_req); });
     } else {
-      // The call to ReturnFromGet will remove the current element in the
+      // The call to CompleteGetRequest will remove the current element in the
       // array, so we only increment the counter in the else branch.
       index += 1;
     }
   }
 
   // No get requests should be waiting for this object anymore. The object ID
-  // may have been removed from the object_get_requests_ by ReturnFromGet, but
-  // if the get request has not returned yet, then remove the object ID from the
-  // map here.
+  // may have been removed from the object_get_requests_ by CompleteGetRequest,
+  // but if the get request has not returned yet, then remove the object ID from
+  // the map here.
   it = object_get_requests_.find(object_id);
   if (it != object_get_requests_.end()) {
     object_get_requests_.erase(object_id);
@@ -453,92 +587,185 @@ void PlasmaStore::ProcessGetRequest(Client* client,
                                     int64_t timeout_ms) {
   // Create a get request for this object.
   auto get_req = new GetRequest(client, object_ids);
+  std::vector<ObjectID> present_ids;
   std::vector<ObjectID> evicted_ids;
-  std::vector<ObjectTableEntry*> evicted_entries;
+  std::unique_lock<std::mutex> get_requests_lock(get_requests_mutex_);
   for (auto object_id : object_ids) {
     // Check if this object is already present locally. If so, record that the
     // object is being used and mark it as accounted for.
+    std::lock_guard<std::mutex> lock(store_info_.objects.mutex(object_id));
     auto entry = GetObjectTableEntry(&store_info_, object_id);
-    if (entry && entry->state == ObjectState::PLASMA_SEALED) {
+    // Objects being spilled are still in memory, and stay there if in use.
+    if (entry && (entry->state == ObjectState::PLASMA_SEALED ||
+                  entry->state == ObjectState::PLASMA_SPILLING)) {
       // Update the get request to take into account the present object.
       PlasmaObject_init(&get_req->objects[object_id], entry);
       get_req->num_satisfied += 1;
       // If necessary, record that this client is using this object. In the case
       // where entry == NULL, this will be called from SealObject.
       AddToClientObjectIds(object_id, entry, client);
-    } else if (entry && entry->state == ObjectState::PLASMA_EVICTED) {
-      // Make sure the object pointer is not already allocated
-      ARROW_CHECK(!entry->pointer);
-
-      entry->pointer =
-          AllocateMemory(entry->data_size + entry->metadata_size, /*evict=*/true,
-                         &entry->fd, &entry->map_size, &entry->offset, client, false);
-      if (entry->pointer) {
-        entry->state = ObjectState::PLASMA_CREATED;
-        entry->create_time = std::time(nullptr);
-        eviction_policy_.ObjectCreated(object_id, client, false);
-        AddToClientObjectIds(object_id, store_info_.objects[object_id].get(), client);
+      present_ids.push_back(object_id);
+    } else {
+      if (entry && entry->state == ObjectState::PLASMA_EVICTED) {
+        // Restore the object below, once get_requests_mutex_ is released.
         evicted_ids.push_back(object_id);
-        evicted_entries.push_back(entry);
-      } else {
-        // We are out of memory and cannot allocate memory for this object.
-        // Change the state of the object back to PLASMA_EVICTED so some
-        // other request can try again.
-        entry->state = ObjectState::PLASMA_EVICTED;
       }
-    } else {
       // Add a placeholder plasma object to the get request to indicate that the
       // object is not present. This will be parsed by the client. We set the
       // data size to -1 to indicate that the object is not present.
       get_req->objects[object_id].data_size = -1;
-      // Add the get request to the relevant data structures.
+      // Add the get request to the relevant data structures. Requests for
+      // evicted objects are satisfied once they are restored.
       object_get_requests_[object_id].push_back(get_req);
     }
   }
-
-  if (!evicted_ids.empty()) {
-    unsigned char digest[kDigestSize] = {};
-    std::vector<std::shared_ptr<Buffer>> buffers;
-    for (size_t i = 0; i < evicted_ids.size(); ++i) {
-      ARROW_CHECK(evicted_entries[i]->pointer != nullptr);
-      buffers.emplace_back(new arrow::MutableBuffer(evicted_entries[i]->pointer,
-                                                    evicted_entries[i]->data_size));
-    }
-    if (external_store_->Get(evicted_ids, buffers).ok()) {
-      for (size_t i = 0; i < evicted_ids.size(); ++i) {
-        evicted_entries[i]->state = ObjectState::PLASMA_SEALED;
-        std::memcpy(&evicted_entries[i]->digest[0], &digest[0], kDigestSize);
-        evicted_entries[i]->construct_duration =
-            std::time(nullptr) - evicted_entries[i]->create_time;
-        PlasmaObject_init(&get_req->objects[evicted_ids[i]], evicted_entries[i]);
-        get_req->num_satisfied += 1;
-      }
-    } else {
-      // We tried to get the objects from the external store, but could not get them.
-      // Set the state of these objects back to PLASMA_EVICTED so some other request
-      // can try again.
-      for (size_t i = 0; i < evicted_ids.size(); ++i) {
-        evicted_entries[i]->state = ObjectState::PLASMA_EVICTED;
-      }
-    }
+  {
+    std::lock_guard<std::mutex> policy_lock(policy_mutex_);
+    eviction_policy_.ObjectsRequested(
+        present_ids, static_cast<int64_t>(object_ids.size() - present_ids.size()));
   }
 
   // If all of the objects are present already or if the timeout is 0, return to
   // the client.
   if (get_req->num_satisfied == get_req->num_objects_to_wait_for || timeout_ms == 0) {
+    CompleteGetRequest(get_req);
+    get_requests_lock.unlock();
     ReturnFromGet(get_req);
   } else if (timeout_ms != -1) {
     // Set a timer that will cause the get request to return to the client. Note
     // that a timeout of -1 is used to indicate that no timer should be set.
-    get_req->timer = loop_->AddTimer(timeout_ms, [this, get_req](int64_t timer_id) {
+    auto timeout_callback = [this, get_req](int64_t timer_id) {
+      std::unique_lock<std::mutex> lock(get_requests_mutex_);
+      if (get_req->completed) {
+        // The request was satisfied concurrently, and the reply has been
+        // posted to this loop already.
+        get_req->timer = -1;
+        return kEventLoopTimerDone;
+      }
+      CompleteGetRequest(get_req);
+      lock.unlock();
       ReturnFromGet(get_req);
       return kEventLoopTimerDone;
-    });
+    };
+    get_req->timer = client->loop->AddTimer(timeout_ms, timeout_callback);
+  }
+
+  if (!evicted_ids.empty()) {
+    if (get_requests_lock.owns_lock()) {
+      get_requests_lock.unlock();
+    }
+    RestoreObjects(evicted_ids, client);
+  }
+}
+
+void PlasmaStore::RestoreObjects(const std::vector<ObjectID>& object_ids,
+                                 Client* client) {
+  std::vector<ObjectID> restored_ids;
+  std::vector<ObjectTableEntry*> restored_entries;
+  {
+    // Objects only leave the PLASMA_EVICTED state with memory_mutex_ held.
+    std::lock_guard<std::mutex> memory_lock(memory_mutex_);
+    for (const auto& object_id : object_ids) {
+      ObjectTableEntry* entry;
+      {
+        std::lock_guard<std::mutex> lock(store_info_.objects.mutex(object_id));
+        entry = GetObjectTableEntry(&store_info_, object_id);
+        if (entry == nullptr || entry->state != ObjectState::PLASMA_EVICTED) {
+          // The object is in memory, or already being restored.
+          continue;
+        }
+        // Concurrent requests wait for this restore, even if the allocation
+        // below waits for spills.
+        entry->state = ObjectState::PLASMA_RESTORING;
+      }
+      // Make sure the object pointer is not already allocated
+      ARROW_CHECK(!entry->pointer);
+
+      int fd = -1;
+      int64_t map_size = 0;
+      ptrdiff_t offset = 0;
+      uint8_t* pointer =
+          AllocateMemory(entry->data_size + entry->metadata_size, /*evict=*/true, &fd,
+                         &map_size, &offset, client, false);
+      std::lock_guard<std::mutex> lock(store_info_.objects.mutex(object_id));
+      if (pointer) {
+        entry->pointer = pointer;
+        entry->fd = fd;
+        entry->map_size = map_size;
+        entry->offset = offset;
+        entry->create_time = std::time(nullptr);
+        restored_ids.push_back(object_id);
+        restored_entries.push_back(entry);
+      } else {
+        // We are out of memory and cannot allocate memory for this object.
+        // Leave the object evicted so some other request can try again; the
+        // get requests wait for it like for an absent object.
+        entry->state = ObjectState::PLASMA_EVICTED;
+      }
+    }
+  }
+  if (restored_ids.empty()) {
+    return;
+  }
+
+  for (const auto& batch :
+       SplitIntoBatches(restored_entries, external_store_pool_->GetCapacity())) {
+    std::vector<ObjectID> ids(restored_ids.begin() + batch.first,
+                              restored_ids.begin() + batch.second);
+    std::vector<ObjectTableEntry*> entries(restored_entries.begin() + batch.first,
+                                           restored_entries.begin() + batch.second);
+    ARROW_CHECK_OK(external_store_pool_->Spawn([this, ids, entries]() {
+      std::vector<std::shared_ptr<Buffer>> buffers;
+      for (auto entry : entries) {
+        buffers.emplace_back(new arrow::MutableBuffer(
+            entry->pointer, entry->data_size + entry->metadata_size));
+      }
+      FinishRestore(ids, entries, external_store_->Get(ids, buffers));
+    }));
+  }
+}
+
+void PlasmaStore::FinishRestore(const std::vector<ObjectID>& object_ids,
+                                const std::vector<ObjectTableEntry*>& entries,
+                                const Status& status) {
+  // Waiters are registered with get_requests_mutex_ held, so none can be
+  // missed between sealing the objects and updating the get requests.
+  std::lock_guard<std::mutex> get_requests_lock(get_requests_mutex_);
+  if (!status.ok()) {
+    // Set the state of these objects back to PLASMA_EVICTED so some other
+    // request can try again.
+    ARROW_LOG(WARNING) << "Failed to restore " << object_ids.size()
+                       << " objects from the external store: " << status;
+    std::lock_guard<std::mutex> memory_lock(memory_mutex_);
+    auto locks = LockShards(object_ids);
+    for (auto entry : entries) {
+      PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
+      entry->pointer = nullptr;
+      entry->state = ObjectState::PLASMA_EVICTED;
+    }
+    return;
+  }
+
+  {
+    unsigned char digest[kDigestSize] = {};
+    auto locks = LockShards(object_ids);
+    std::lock_guard<std::mutex> policy_lock(policy_mutex_);
+    for (size_t i = 0; i < object_ids.size(); ++i) {
+      entries[i]->state = ObjectState::PLASMA_SEALED;
+      std::memcpy(&entries[i]->digest[0], &digest[0], kDigestSize);
+      entries[i]->construct_duration = std::time(nullptr) - entries[i]->create_time;
+      eviction_policy_.ObjectCreated(object_ids[i], nullptr, false);
+    }
+  }
+  for (const auto& object_id : object_ids) {
+    UpdateObjectGetRequests(object_id);
   }
 }
 
 int PlasmaStore::RemoveFromClientObjectIds(const ObjectID& object_id,
-                                           ObjectTableEntry* entry, Client* client) {
+                                           ObjectTableEntry* entry, Client* client,
+                                           bool* evict) {
+  std::lock_guard<std::mutex> client_lock(client->mutex);
   auto it = client->object_ids.find(object_id);
   if (it != client->object_ids.end()) {
     client->object_ids.erase(it);
@@ -548,14 +775,16 @@ int PlasmaStore::RemoveFromClientObjectIds(const ObjectID& object_id,
     // If no more clients are using this object, notify the eviction policy
     // that the object is no longer being used.
     if (entry->ref_count == 0) {
+      std::lock_guard<std::mutex> policy_lock(policy_mutex_);
       if (deletion_cache_.count(object_id) == 0) {
         // Tell the eviction policy that this object is no longer being used.
         eviction_policy_.EndObjectAccess(object_id);
       } else {
         // Above code does not really delete an object. Instead, it just put an
         // object to LRU cache which will be cleaned when the memory is not enough.
+        // The caller evicts the object once the shard is unlocked.
         deletion_cache_.erase(object_id);
-        EvictObjects({object_id});
+        *evict = true;
       }
     }
     // Return 1 to indicate that the client was removed.
@@ -566,8 +795,24 @@ int PlasmaStore::RemoveFromClientObjectIds(const ObjectID& object_id,
   }
 }
 
+int PlasmaStore::RemoveFromClientObjectIds(const ObjectID& object_id, Client* client) {
+  bool evict = false;
+  int removed;
+  {
+    std::lock_guard<std::mutex> lock(store_info_.objects.mutex(object_id));
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    ARROW_CHECK(entry != nullptr);
+    removed = RemoveFromClientObjectIds(object_id, entry, client, &evict);
+  }
+  if (evict) {
+    std::lock_guard<std::mutex> memory_lock(memory_mutex_);
+    EvictObjects({object_id});
+  }
+  return removed;
+}
+
 void PlasmaStore::EraseFromObjectTable(const ObjectID& object_id) {
-  auto& object = store_info_.objects[object_id];
+  auto object = GetObjectTableEntry(&store_info_, object_id);
   auto buff_size = object->data_size + object->metadata_size;
   if (object->device_num == 0) {
     PlasmaAllocator::Free(object->pointer, buff_size);
@@ -576,21 +821,19 @@ void PlasmaStore::EraseFromObjectTable(const ObjectID& object_id) {
     ARROW_CHECK_OK(FreeCudaMemory(object->device_num, buff_size, object->pointer));
 #endif
   }
-  store_info_.objects.erase(object_id);
+  store_info_.objects.Erase(object_id);
 }
 
 void PlasmaStore::ReleaseObject(const ObjectID& object_id, Client* client) {
-  auto entry = GetObjectTableEntry(&store_info_, object_id);
-  ARROW_CHECK(entry != nullptr);
   // Remove the client from the object's array of clients.
-  ARROW_CHECK(RemoveFromClientObjectIds(object_id, entry, client) == 1);
+  ARROW_CHECK(RemoveFromClientObjectIds(object_id, client) == 1);
 }
 
 // Check if an object is present.
 ObjectStatus PlasmaStore::ContainsObject(const ObjectID& object_id) {
+  std::lock_guard<std::mutex> lock(store_info_.objects.mutex(object_id));
   auto entry = GetObjectTableEntry(&store_info_, object_id);
-  return entry && (entry->state == ObjectState::PLASMA_SEALED ||
-                   entry->state == ObjectState::PLASMA_EVICTED)
+  return entry && entry->state != ObjectState::PLASMA_CREATED
              ? ObjectStatus::OBJECT_FOUND
              : ObjectStatus::OBJECT_NOT_FOUND;
 }
@@ -600,37 +843,46 @@ void PlasmaStore::SealObjects(const std::vector<ObjectID>& object_ids,
   std::vector<ObjectInfoT> infos;
 
   ARROW_LOG(DEBUG) << "sealing " << object_ids.size() << " objects";
-  for (size_t i = 0; i < object_ids.size(); ++i) {
-    ObjectInfoT object_info;
-    auto entry = GetObjectTableEntry(&store_info_, object_ids[i]);
-    ARROW_CHECK(entry != nullptr);
-    ARROW_CHECK(entry->state == ObjectState::PLASMA_CREATED);
-    // Set the state of object to SEALED.
-    entry->state = ObjectState::PLASMA_SEALED;
-    // Set the object digest.
-    std::memcpy(&entry->digest[0], digests[i].c_str(), kDigestSize);
-    // Set object construction duration.
-    entry->construct_duration = std::time(nullptr) - entry->create_time;
+  // Waiters are registered with get_requests_mutex_ held, so none can be
+  // missed between sealing the objects and updating the get requests.
+  std::lock_guard<std::mutex> get_requests_lock(get_requests_mutex_);
+  {
+    auto locks = LockShards(object_ids);
+    for (size_t i = 0; i < object_ids.size(); ++i) {
+      ObjectInfoT object_info;
+      auto entry = GetObjectTableEntry(&store_info_, object_ids[i]);
+      ARROW_CHECK(entry != nullptr);
+      ARROW_CHECK(entry->state == ObjectState::PLASMA_CREATED);
+      // Set the state of object to SEALED.
+      entry->state = ObjectState::PLASMA_SEALED;
+      // Set the object digest.
+      std::memcpy(&entry->digest[0], digests[i].c_str(), kDigestSize);
+      // Set object construction duration.
+      entry->construct_duration = std::time(nullptr) - entry->create_time;
+
+      object_info.object_id = object_ids[i].binary();
+      object_info.data_size = entry->data_size;
+      object_info.metadata_size = entry->metadata_size;
+      object_info.digest = digests[i];
+      infos.push_back(object_info);
+    }
 
-    object_info.object_id = object_ids[i].binary();
-    object_info.data_size = entry->data_size;
-    object_info.metadata_size = entry->metadata_size;
-    object_info.digest = digests[i];
-    infos.push_back(object_info);
+    PushNotifications(infos);
   }
 
-  PushNotifications(infos);
-
   for (size_t i = 0; i < object_ids.size(); ++i) {
     UpdateObjectGetRequests(object_ids[i]);
   }
 }
 
 int PlasmaStore::AbortObject(const ObjectID& object_id, Client* client) {
+  std::lock_guard<std::mutex> memory_lock(memory_mutex_);
+  std::lock_guard<std::mutex> lock(store_info_.objects.mutex(object_id));
   auto entry = GetObjectTableEntry(&store_info_, object_id);
   ARROW_CHECK(entry != nullptr) << "To abort an object it must be in the object table.";
   ARROW_CHECK(entry->state != ObjectState::PLASMA_SEALED)
       << "To abort an object it must not have been sealed.";
+  std::lock_guard<std::mutex> client_lock(client->mutex);
   auto it = client->object_ids.find(object_id);
   if (it == client->object_ids.end()) {
     // If the client requesting the abort is not the creator, do not
@@ -645,6 +897,8 @@ int PlasmaStore::AbortObject(const ObjectID& object_id, Client* client) {
 }
 
 PlasmaError PlasmaStore::DeleteObject(ObjectID& object_id) {
+  std::lock_guard<std::mutex> memory_lock(memory_mutex_);
+  std::lock_guard<std::mutex> lock(store_info_.objects.mutex(object_id));
   auto entry = GetObjectTableEntry(&store_info_, object_id);
   // TODO(rkn): This should probably not fail, but should instead throw an
   // error. Maybe we should also support deleting objects that have been
@@ -654,9 +908,18 @@ PlasmaError PlasmaStore::DeleteObject(ObjectID& object_id) {
     return PlasmaError::ObjectNotFound;
   }
 
+  if (entry->state == ObjectState::PLASMA_SPILLING) {
+    // The external store is writing the object. It will be evicted once it
+    // is written, unless it is in use again.
+    std::lock_guard<std::mutex> policy_lock(policy_mutex_);
+    deletion_cache_.emplace(object_id);
+    return PlasmaError::ObjectInUse;
+  }
+
   if (entry->state != ObjectState::PLASMA_SEALED) {
     // To delete an object it must have been sealed.
     // Put it into deletion cache, it will be deleted later.
+    std::lock_guard<std::mutex> policy_lock(policy_mutex_);
     deletion_cache_.emplace(object_id);
     return PlasmaError::ObjectNotSealed;
   }
@@ -664,11 +927,15 @@ PlasmaError PlasmaStore::DeleteObject(ObjectID& object_id) {
   if (entry->ref_count != 0) {
     // To delete an object, there must be no clients currently using it.
     // Put it into deletion cache, it will be deleted later.
+    std::lock_guard<std::mutex> policy_lock(policy_mutex_);
     deletion_cache_.emplace(object_id);
     return PlasmaError::ObjectInUse;
   }
 
-  eviction_policy_.RemoveObject(object_id);
+  {
+    std::lock_guard<std::mutex> policy_lock(policy_mutex_);
+    eviction_policy_.RemoveObject(object_id);
+  }
   EraseFromObjectTable(object_id);
   // Inform all subscribers that the object has been deleted.
   fb::ObjectInfoT notification;
@@ -684,7 +951,8 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
     return;
   }
 
-  std::vector<std::shared_ptr<arrow::Buffer>> evicted_object_data;
+  auto locks = LockShards(object_ids);
+  std::vector<ObjectID> evicted_ids;
   std::vector<ObjectTableEntry*> evicted_entries;
   for (const auto& object_id : object_ids) {
     ARROW_LOG(DEBUG) << "evicting object " << object_id.hex();
@@ -693,17 +961,27 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
     // error. Maybe we should also support deleting objects that have been
     // created but not sealed.
     ARROW_CHECK(entry != nullptr) << "To evict an object it must be in the object table.";
-    ARROW_CHECK(entry->state == ObjectState::PLASMA_SEALED)
+    ARROW_CHECK(entry->state == ObjectState::PLASMA_SEALED ||
+                entry->state == ObjectState::PLASMA_SPILLING)
         << "To evict an object it must have been sealed.";
-    ARROW_CHECK(entry->ref_count == 0)
-        << "To evict an object, there must be no clients currently using it.";
+    if (entry->ref_count != 0) {
+      // A client started using the object after the eviction policy chose it.
+      // The eviction policy tracks it again once it is released.
+      ARROW_LOG(DEBUG) << "not evicting object " << object_id.hex() << " in use";
+      continue;
+    }
+    if (entry->state == ObjectState::PLASMA_SPILLING) {
+      // A client used and released the object while it was being spilled. It
+      // is freed once it is written.
+      continue;
+    }
 
     // If there is a backing external store, then mark object for eviction to
     // external store, free the object data pointer and keep a placeholder
     // entry in ObjectTable
     if (external_store_) {
-      evicted_object_data.push_back(std::make_shared<arrow::Buffer>(
-          entry->pointer, entry->data_size + entry->metadata_size));
+      entry->state = ObjectState::PLASMA_SPILLING;
+      evicted_ids.push_back(object_id);
       evicted_entries.push_back(entry);
     } else {
       // If there is no backing external store, just erase the object entry
@@ -717,90 +995,181 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
     }
   }
 
-  if (external_store_ && !object_ids.empty()) {
-    ARROW_CHECK_OK(external_store_->Put(object_ids, evicted_object_data));
-    for (auto entry : evicted_entries) {
-      PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
-      entry->pointer = nullptr;
-      entry->state = ObjectState::PLASMA_EVICTED;
+  if (evicted_ids.empty()) {
+    return;
+  }
+  // Write the objects in the background, so that the clients that don't need
+  // memory aren't blocked meanwhile.
+  for (const auto& batch :
+       SplitIntoBatches(evicted_entries, external_store_pool_->GetCapacity())) {
+    std::vector<ObjectID> ids(evicted_ids.begin() + batch.first,
+                              evicted_ids.begin() + batch.second);
+    std::vector<ObjectTableEntry*> entries(evicted_entries.begin() + batch.first,
+                                           evicted_entries.begin() + batch.second);
+    std::vector<std::shared_ptr<arrow::Buffer>> data;
+    int64_t num_bytes = 0;
+    for (auto entry : entries) {
+      data.push_back(std::make_shared<arrow::Buffer>(
+          entry->pointer, entry->data_size + entry->metadata_size));
+      num_bytes += entry->data_size + entry->metadata_size;
+    }
+    spilling_bytes_ += num_bytes;
+    ARROW_CHECK_OK(external_store_pool_->Spawn([this, ids, entries, data, num_bytes]() {
+      FinishSpill(ids, entries, num_bytes, external_store_->Put(ids, data));
+    }));
+  }
+}
+
+void PlasmaStore::FinishSpill(const std::vector<ObjectID>& object_ids,
+                              const std::vector<ObjectTableEntry*>& entries,
+                              int64_t num_bytes, const Status& status) {
+  if (!status.ok()) {
+    ARROW_LOG(WARNING) << "Failed to spill " << object_ids.size()
+                       << " objects to the external store: " << status;
+  }
+  std::lock_guard<std::mutex> memory_lock(memory_mutex_);
+  {
+    auto locks = LockShards(object_ids);
+    std::lock_guard<std::mutex> policy_lock(policy_mutex_);
+    for (size_t i = 0; i < object_ids.size(); ++i) {
+      auto entry = entries[i];
+      ARROW_CHECK(entry->state == ObjectState::PLASMA_SPILLING);
+      if (status.ok() && entry->ref_count == 0) {
+        // A client may have used and released the object meanwhile, which the
+        // eviction policy tracks.
+        eviction_policy_.RemoveObject(object_ids[i]);
+        deletion_cache_.erase(object_ids[i]);
+        PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
+        entry->pointer = nullptr;
+        entry->state = ObjectState::PLASMA_EVICTED;
+      } else {
+        entry->state = ObjectState::PLASMA_SEALED;
+        if (entry->ref_count == 0) {
+          // The eviction policy tracks the objects in use again once they
+          // are released.
+          eviction_policy_.RemoveObject(object_ids[i]);
+          eviction_policy_.ObjectCreated(object_ids[i], nullptr, false);
+        }
+      }
     }
   }
+  spilling_bytes_ -= num_bytes;
+  spills_done_.notify_all();
 }
 
 void PlasmaStore::ConnectClient(int listener_sock) {
   int client_fd = AcceptClient(listener_sock);
 
   Client* client = new Client(client_fd);
-  connected_clients_[client_fd] = std::unique_ptr<Client>(client);
+  client->loop = io_loops_[next_io_loop_];
+  next_io_loop_ = (next_io_loop_ + 1) % io_loops_.size();
+  {
+    std::lock_guard<std::mutex> lock(clients_mutex_);
+    connected_clients_[client_fd] = std::unique_ptr<Client>(client);
+  }
 
-  // Add a callback to handle events on this socket.
+  // Add a callback to handle events on this socket, from the thread running
+  // the client's event loop.
   // TODO(pcm): Check return value.
-  loop_->AddFileEvent(client_fd, kEventLoopRead, [this, client](int events) {
-    Status s = ProcessMessage(client);
-    if (!s.ok()) {
-      ARROW_LOG(FATAL) << "Failed to process file event: " << s;
-    }
-  });
+  auto add_file_event = [this, client]() {
+    client->loop->AddFileEvent(client->fd, kEventLoopRead, [this, client](int events) {
+      Status s = ProcessMessage(client);
+      if (!s.ok()) {
+        ARROW_LOG(FATAL) << "Failed to process file event: " << s;
+      }
+    });
+  };
+  if (client->loop == loop_) {
+    add_file_event();
+  } else {
+    client->loop->Post(add_file_event);
+  }
   ARROW_LOG(DEBUG) << "New connection with fd " << client_fd;
 }
 
 void PlasmaStore::DisconnectClient(int client_fd) {
   ARROW_CHECK(client_fd > 0);
-  auto it = connected_clients_.find(client_fd);
-  ARROW_CHECK(it != connected_clients_.end());
-  loop_->RemoveFileEvent(client_fd);
+  Client* client;
+  {
+    std::lock_guard<std::mutex> lock(clients_mutex_);
+    auto it = connected_clients_.find(client_fd);
+    ARROW_CHECK(it != connected_clients_.end());
+    // Replies posted to the client's event loop still refer to the client, so
+    // it is deleted after them.
+    client = it->second.release();
+    connected_clients_.erase(it);
+  }
+  client->loop->RemoveFileEvent(client_fd);
   // Close the socket.
   close(client_fd);
+  client->disconnected = true;
   ARROW_LOG(INFO) << "Disconnecting client on fd " << client_fd;
+
+  /// Remove all of the client's GetRequests. Afterwards, no other thread
+  /// adds objects to the client.
+  RemoveGetRequestsForClient(client);
+
   // Release all the objects that the client was using.
-  auto client = it->second.get();
-  eviction_policy_.ClientDisconnected(client);
-  std::unordered_map<ObjectID, ObjectTableEntry*> sealed_objects;
-  for (const auto& object_id : client->object_ids) {
-    auto it = store_info_.objects.find(object_id);
-    if (it == store_info_.objects.end()) {
-      continue;
+  std::vector<ObjectID> sealed_objects;
+  {
+    std::lock_guard<std::mutex> memory_lock(memory_mutex_);
+    {
+      std::lock_guard<std::mutex> policy_lock(policy_mutex_);
+      eviction_policy_.ClientDisconnected(client);
+    }
+    std::unordered_set<ObjectID> object_ids;
+    {
+      std::lock_guard<std::mutex> client_lock(client->mutex);
+      object_ids = client->object_ids;
     }
+    for (const auto& object_id : object_ids) {
+      std::lock_guard<std::mutex> lock(store_info_.objects.mutex(object_id));
+      auto entry = GetObjectTableEntry(&store_info_, object_id);
+      if (entry == nullptr) {
+        continue;
+      }
 
-    if (it->second->state == ObjectState::PLASMA_SEALED) {
-      // Add sealed objects to a temporary list of object IDs. Do not perform
-      // the remove here, since it potentially modifies the object_ids table.
-      sealed_objects[it->first] = it->second.get();
-    } else {
-      // Abort unsealed object.
-      // Don't call AbortObject() because client->object_ids would be modified.
-      EraseFromObjectTable(object_id);
+      if (entry->state == ObjectState::PLASMA_SEALED ||
+          entry->state == ObjectState::PLASMA_SPILLING) {
+        // Add sealed objects to a temporary list of object IDs. Do not perform
+        // the remove here, since it potentially evicts objects.
+        sealed_objects.push_back(object_id);
+      } else {
+        // Abort unsealed object.
+        // Don't call AbortObject() because client->object_ids would be modified.
+        EraseFromObjectTable(object_id);
+      }
     }
   }
 
-  /// Remove all of the client's GetRequests.
-  RemoveGetRequestsForClient(client);
-
-  for (const auto& entry : sealed_objects) {
-    RemoveFromClientObjectIds(entry.first, entry.second, client);
+  for (const auto& object_id : sealed_objects) {
+    RemoveFromClientObjectIds(object_id, client);
   }
 
   if (client->notification_fd > 0) {
     // This client has subscribed for notifications.
     auto notify_fd = client->notification_fd;
-    loop_->RemoveFileEvent(notify_fd);
-    // Close socket.
-    close(notify_fd);
-    // Remove notification queue for this fd from global map.
-    pending_notifications_.erase(notify_fd);
+    notification_loop_->Post([this, notify_fd]() {
+      std::lock_guard<std::mutex> lock(notifications_mutex_);
+      notification_loop_->RemoveFileEvent(notify_fd);
+      // Close socket, unless sending a notification found it closed already.
+      if (pending_notifications_.erase(notify_fd) > 0) {
+        close(notify_fd);
+      }
+    });
     // Reset fd.
     client->notification_fd = -1;
   }
 
-  connected_clients_.erase(it);
+  client->loop->Post([client]() { delete client; });
 }
 
 /// Send notifications about sealed objects to the subscribers. This is called
-/// in SealObject. If the socket's send buffer is full, the notification will
-/// be buffered, and this will be called again when the send buffer has room.
-/// Since we call erase on pending_notifications_, all iterators get
-/// invalidated, which is why we return a valid iterator to the next client to
-/// be used in PushNotification.
+/// from the notification loop after notifications were queued in SealObject. If
+/// the socket's send buffer is full, the notification will stay buffered, and
+/// this will be called again when the send buffer has room. Since we call erase
+/// on pending_notifications_, all iterators get invalidated, which is why we
+/// return a valid iterator to the next client to be used in PushNotification.
 ///
 /// \param it Iterator that points to the client to send the notification to.
 /// \return Iterator pointing to the next client.
@@ -832,8 +1201,13 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
       // at the end of the method.
       // TODO(pcm): Introduce status codes and check in case the file descriptor
       // is added twice.
-      loop_->AddFileEvent(client_fd, kEventLoopWrite, [this, client_fd](int events) {
-        SendNotifications(pending_notifications_.find(client_fd));
+      notification_loop_->AddFileEvent(client_fd, kEventLoopWrite, [this, client_fd](
+                                                                       int events) {
+        std::lock_guard<std::mutex> lock(notifications_mutex_);
+        auto it = pending_notifications_.find(client_fd);
+        if (it != pending_notifications_.end()) {
+          SendNotifications(it);
+        }
       });
       break;
     } else {
@@ -850,11 +1224,12 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
 
   // If we have sent all notifications, remove the fd from the event loop.
   if (notifications.empty()) {
-    loop_->RemoveFileEvent(client_fd);
+    notification_loop_->RemoveFileEvent(client_fd);
   }
 
   // Stop sending notifications if the pipe was broken.
   if (closed) {
+    notification_loop_->RemoveFileEvent(client_fd);
     close(client_fd);
     return pending_notifications_.erase(it);
   } else {
@@ -862,34 +1237,56 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
   }
 }
 
+void PlasmaStore::ScheduleNotifications() {
+  if (notifications_scheduled_) {
+    return;
+  }
+  notifications_scheduled_ = true;
+  notification_loop_->Post([this]() {
+    std::lock_guard<std::mutex> lock(notifications_mutex_);
+    notifications_scheduled_ = false;
+    auto it = pending_notifications_.begin();
+    while (it != pending_notifications_.end()) {
+      it = SendNotifications(it);
+    }
+  });
+}
+
 void PlasmaStore::PushNotification(fb::ObjectInfoT* object_info) {
-  auto it = pending_notifications_.begin();
-  while (it != pending_notifications_.end()) {
+  std::lock_guard<std::mutex> lock(notifications_mutex_);
+  if (pending_notifications_.empty()) {
+    return;
+  }
+  for (auto& pending : pending_notifications_) {
     std::vector<fb::ObjectInfoT> info;
     info.push_back(*object_info);
     auto notification = CreatePlasmaNotificationBuffer(info);
-    it->second.object_notifications.emplace_back(std::move(notification));
-    it = SendNotifications(it);
+    pending.second.object_notifications.emplace_back(std::move(notification));
   }
+  ScheduleNotifications();
 }
 
 void PlasmaStore::PushNotifications(std::vector<fb::ObjectInfoT>& object_info) {
-  auto it = pending_notifications_.begin();
-  while (it != pending_notifications_.end()) {
+  std::lock_guard<std::mutex> lock(notifications_mutex_);
+  if (pending_notifications_.empty()) {
+    return;
+  }
+  for (auto& pending : pending_notifications_) {
     auto notifications = CreatePlasmaNotificationBuffer(object_info);
-    it->second.object_notifications.emplace_back(std::move(notifications));
-    it = SendNotifications(it);
+    pending.second.object_notifications.emplace_back(std::move(notifications));
   }
+  ScheduleNotifications();
 }
 
 void PlasmaStore::PushNotification(fb::ObjectInfoT* object_info, int client_fd) {
+  // The caller holds notifications_mutex_.
   auto it = pending_notifications_.find(client_fd);
   if (it != pending_notifications_.end()) {
     std::vector<fb::ObjectInfoT> info;
     info.push_back(*object_info);
     auto notification = CreatePlasmaNotificationBuffer(info);
     it->second.object_notifications.emplace_back(std::move(notification));
-    SendNotifications(it);
+    ScheduleNotifications();
   }
 }
 
@@ -911,31 +1308,45 @@ void PlasmaStore::SubscribeToUpdates(Client* client) {
     return;
   }
 
+  // Lock the whole object table, so that objects are sealed or deleted either
+  // before the subscriber is added, or after the existing objects are queued.
+  std::vector<std::unique_lock<std::mutex>> locks;
+  for (size_t i = 0; i < store_info_.objects.num_shards(); ++i) {
+    locks.emplace_back(store_info_.objects.mutex(i));
+  }
+  std::lock_guard<std::mutex> lock(notifications_mutex_);
+
   // Add this fd to global map, which is needed for this client to receive notifications.
   pending_notifications_[fd];
   client->notification_fd = fd;
 
   // Push notifications to the new subscriber about existing sealed objects.
-  for (const auto& entry : store_info_.objects) {
-    if (entry.second->state == ObjectState::PLASMA_SEALED) {
-      ObjectInfoT info;
-      info.object_id = entry.first.binary();
-      info.data_size = entry.second->data_size;
-      info.metadata_size = entry.second->metadata_size;
-      info.digest =
-          std::string(reinterpret_cast<char*>(&entry.second->digest[0]), kDigestSize);
-      PushNotification(&info, fd);
+  for (size_t i = 0; i < store_info_.objects.num_shards(); ++i) {
+    for (const auto& entry : store_info_.objects.shard(i)) {
+      if (entry.second->state == ObjectState::PLASMA_SEALED ||
+          entry.second->state == ObjectState::PLASMA_SPILLING) {
+        ObjectInfoT info;
+        info.object_id = entry.first.binary();
+        info.data_size = entry.second->data_size;
+        info.metadata_size = entry.second->metadata_size;
+        info.digest =
+            std::string(reinterpret_cast<char*>(&entry.second->digest[0]), kDigestSize);
+        PushNotification(&info, fd);
+      }
     }
   }
 }
 
 Status PlasmaStore::ProcessMessage(Client* client) {
+  // Input buffer. This is allocated only once per thread to avoid mallocs for
+  // every call to ProcessMessage.
+  static thread_local std::vector<uint8_t> input_buffer;
   fb::MessageType type;
-  Status s = ReadMessage(client->fd, &type, &input_buffer_);
+  Status s = ReadMessage(client->fd, &type, &input_buffer);
   ARROW_CHECK(s.ok() || s.IsIOError());
 
-  uint8_t* input = input_buffer_.data();
-  size_t input_size = input_buffer_.size();
+  uint8_t* input = input_buffer.data();
+  size_t input_size = input_buffer.size();
   ObjectID object_id;
   PlasmaObject object = {};
 
@@ -952,7 +1363,7 @@ Status PlasmaStore::ProcessMessage(Client* client) {
                                             metadata_size, device_num, client, &object);
       int64_t mmap_size = 0;
       if (error_code == PlasmaError::OK && device_num == 0) {
-        mmap_size = GetMmapSize(object.store_fd);
+        mmap_size = MmapSize(object.store_fd);
       }
       HANDLE_SIGPIPE(
           SendCreateReply(client->fd, object_id, &object, error_code, mmap_size),
@@ -981,7 +1392,11 @@ Status PlasmaStore::ProcessMessage(Client* client) {
 
       // If the object was successfully created, fill out the object data and seal it.
       if (error_code == PlasmaError::OK) {
-        auto entry = GetObjectTableEntry(&store_info_, object_id);
+        ObjectTableEntry* entry;
+        {
+          std::lock_guard<std::mutex> lock(store_info_.objects.mutex(object_id));
+          entry = GetObjectTableEntry(&store_info_, object_id);
+        }
         ARROW_CHECK(entry != nullptr);
         // Write the inlined data and metadata into the allocated object.
         std::memcpy(entry->pointer, data.data(), data.size());
@@ -991,7 +1406,7 @@ Status PlasmaStore::ProcessMessage(Client* client) {
         // object is not being used by any client. The client was added to the
         // object's array of clients in CreateObject. This is analogous to the
         // Release call that happens in the client's Seal method.
-        ARROW_CHECK(RemoveFromClientObjectIds(object_id, entry, client) == 1);
+        ARROW_CHECK(RemoveFromClientObjectIds(object_id, client) == 1);
       }
 
       // Reply to the client.
@@ -1024,7 +1439,11 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       // if error, abort the previous i objects immediately
       if (error_code == PlasmaError::OK) {
         for (i = 0; i < object_ids.size(); i++) {
-          auto entry = GetObjectTableEntry(&store_info_, object_ids[i]);
+          ObjectTableEntry* entry;
+          {
+            std::lock_guard<std::mutex> lock(store_info_.objects.mutex(object_ids[i]));
+            entry = GetObjectTableEntry(&store_info_, object_ids[i]);
+          }
           ARROW_CHECK(entry != nullptr);
           // Write the inlined data and metadata into the allocated object.
           std::memcpy(entry->pointer, data[i].data(), data[i].size());
@@ -1038,8 +1457,7 @@ Status PlasmaStore::ProcessMessage(Client* client) {
         // object's array of clients in CreateObject. This is analogous to the
         // Release call that happens in the client's Seal method.
         for (i = 0; i < object_ids.size(); i++) {
-          auto entry = GetObjectTableEntry(&store_info_, object_ids[i]);
-          ARROW_CHECK(RemoveFromClientObjectIds(object_ids[i], entry, client) == 1);
+          ARROW_CHECK(RemoveFromClientObjectIds(object_ids[i], client) == 1);
         }
       } else {
         for (size_t j = 0; j < i; j++) {
@@ -1062,10 +1480,22 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       RETURN_NOT_OK(ReadGetRequest(input, input_size, object_ids_to_get, &timeout_ms));
       ProcessGetRequest(client, object_ids_to_get, timeout_ms);
     } break;
+    case fb::MessageType::PlasmaPrefetchRequest: {
+      std::vector<ObjectID> object_ids;
+      RETURN_NOT_OK(ReadPrefetchRequest(input, input_size, &object_ids));
+      RestoreObjects(object_ids, client);
+    } break;
     case fb::MessageType::PlasmaReleaseRequest: {
       RETURN_NOT_OK(ReadReleaseRequest(input, input_size, &object_id));
       ReleaseObject(object_id, client);
     } break;
+    case fb::MessageType::PlasmaReleaseBatchRequest: {
+      std::vector<ObjectID> object_ids;
+      RETURN_NOT_OK(ReadReleaseBatchRequest(input, input_size, &object_ids));
+      for (const auto& object_id : object_ids) {
+        ReleaseObject(object_id, client);
+      }
+    } break;
     case fb::MessageType::PlasmaDeleteRequest: {
       std::vector<ObjectID> object_ids;
       std::vector<PlasmaError> error_codes;
@@ -1084,9 +1514,28 @@ Status PlasmaStore::ProcessMessage(Client* client) {
         HANDLE_SIGPIPE(SendContainsReply(client->fd, object_id, 0), client->fd);
       }
     } break;
+    case fb::MessageType::PlasmaContainsBatchRequest: {
+      std::vector<ObjectID> object_ids;
+      RETURN_NOT_OK(ReadContainsBatchRequest(input, input_size, &object_ids));
+      std::vector<bool> has_object;
+      has_object.reserve(object_ids.size());
+      for (const auto& object_id : object_ids) {
+        has_object.push_back(ContainsObject(object_id) == ObjectStatus::OBJECT_FOUND);
+      }
+      HANDLE_SIGPIPE(SendContainsBatchReply(client->fd, object_ids, has_object),
+                     client->fd);
+    } break;
     case fb::MessageType::PlasmaListRequest: {
       RETURN_NOT_OK(ReadListRequest(input, input_size));
-      HANDLE_SIGPIPE(SendListReply(client->fd, store_info_.objects), client->fd);
+      // Reply with a snapshot of the object table, taken one shard at a time.
+      ObjectTable objects;
+      for (size_t i = 0; i < store_info_.objects.num_shards(); ++i) {
+        std::lock_guard<std::mutex> lock(store_info_.objects.mutex(i));
+        for (const auto& entry : store_info_.objects.shard(i)) {
+          objects[entry.first].reset(new ObjectTableEntry(*entry.second));
+        }
+      }
+      HANDLE_SIGPIPE(SendListReply(client->fd, objects), client->fd);
     } break;
     case fb::MessageType::PlasmaSealRequest: {
       std::string digest;
@@ -1094,20 +1543,37 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       SealObjects({object_id}, {digest});
       HANDLE_SIGPIPE(SendSealReply(client->fd, object_id, PlasmaError::OK), client->fd);
     } break;
+    case fb::MessageType::PlasmaSealBatchRequest: {
+      std::vector<ObjectID> object_ids;
+      std::vector<std::string> digests;
+      RETURN_NOT_OK(ReadSealBatchRequest(input, input_size, &object_ids, &digests));
+      SealObjects(object_ids, digests);
+      HANDLE_SIGPIPE(SendSealBatchReply(client->fd, PlasmaError::OK), client->fd);
+    } break;
     case fb::MessageType::PlasmaEvictRequest: {
       // This code path should only be used for testing.
       int64_t num_bytes;
       RETURN_NOT_OK(ReadEvictRequest(input, input_size, &num_bytes));
       std::vector<ObjectID> objects_to_evict;
-      int64_t num_bytes_evicted =
-          eviction_policy_.ChooseObjectsToEvict(num_bytes, &objects_to_evict);
-      EvictObjects(objects_to_evict);
+      int64_t num_bytes_evicted;
+      {
+        std::lock_guard<std::mutex> memory_lock(memory_mutex_);
+        {
+          std::lock_guard<std::mutex> policy_lock(policy_mutex_);
+          num_bytes_evicted =
+              eviction_policy_.ChooseObjectsToEvict(num_bytes, &objects_to_evict);
+        }
+        EvictObjects(objects_to_evict);
+      }
       HANDLE_SIGPIPE(SendEvictReply(client->fd, num_bytes_evicted), client->fd);
     } break;
     case fb::MessageType::PlasmaRefreshLRURequest: {
       std::vector<ObjectID> object_ids;
       RETURN_NOT_OK(ReadRefreshLRURequest(input, input_size, &object_ids));
-      eviction_policy_.RefreshObjects(object_ids);
+      {
+        std::lock_guard<std::mutex> policy_lock(policy_mutex_);
+        eviction_policy_.RefreshObjects(object_ids);
+      }
       HANDLE_SIGPIPE(SendRefreshLRUReply(client->fd), client->fd);
     } break;
     case fb::MessageType::PlasmaSubscribeRequest:
@@ -1127,14 +1593,23 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       RETURN_NOT_OK(
           ReadSetOptionsRequest(input, input_size, &client_name, &output_memory_quota));
       client->name = client_name;
-      bool success = eviction_policy_.SetClientQuota(client, output_memory_quota);
+      bool success;
+      {
+        std::lock_guard<std::mutex> policy_lock(policy_mutex_);
+        success = eviction_policy_.SetClientQuota(client, output_memory_quota);
+      }
       HANDLE_SIGPIPE(SendSetOptionsReply(client->fd, success ? PlasmaError::OK
                                                              : PlasmaError::OutOfMemory),
                      client->fd);
     } break;
     case fb::MessageType::PlasmaGetDebugStringRequest: {
-      HANDLE_SIGPIPE(SendGetDebugStringReply(client->fd, eviction_policy_.DebugString()),
-                     client->fd);
+      std::string debug_string;
+      {
+        std::lock_guard<std::mutex> memory_lock(memory_mutex_);
+        std::lock_guard<std::mutex> policy_lock(policy_mutex_);
+        debug_string = eviction_policy_.DebugString() + PlasmaAllocator::DebugString();
+      }
+      HANDLE_SIGPIPE(SendGetDebugStringReply(client->fd, debug_string), client->fd);
     } break;
     default:
       // This code should be unreachable.
@@ -1148,11 +1623,21 @@ class PlasmaStoreRunner {
   PlasmaStoreRunner() {}
 
   void Start(char* socket_name, std::string directory, bool hugepages_enabled,
-             std::shared_ptr<ExternalStore> external_store) {
-    // Create the event loop.
+             std::shared_ptr<ExternalStore> external_store, int num_io_threads,
+             int num_external_store_threads, CachePolicy cache_policy) {
+    // Create the event loops. The main thread accepts connections and serves
+    // clients like the other I/O threads.
     loop_.reset(new EventLoop);
-    store_.reset(new PlasmaStore(loop_.get(), directory, hugepages_enabled, socket_name,
-                                 external_store));
+    notification_loop_.reset(new EventLoop);
+    std::vector<EventLoop*> io_loops;
+    for (int i = 1; i < num_io_threads; ++i) {
+      io_loops_.emplace_back(new EventLoop);
+      io_loops.push_back(io_loops_.back().get());
+    }
+    store_.reset(new PlasmaStore(loop_.get(), io_loops, notification_loop_.get(),
+                                 directory, hugepages_enabled, socket_name,
+                                 external_store, num_external_store_threads,
+                                 cache_policy));
     plasma_config = store_->GetPlasmaStoreInfo();
 
     // We are using a single memory-mapped file by mallocing and freeing a single
@@ -1174,19 +1659,42 @@ class PlasmaStoreRunner {
     loop_->AddFileEvent(socket, kEventLoopRead, [this, socket](int events) {
       this->store_->ConnectClient(socket);
     });
+    threads_.emplace_back([this]() { notification_loop_->Start(); });
+    for (auto& io_loop : io_loops_) {
+      EventLoop* loop = io_loop.get();
+      threads_.emplace_back([loop]() { loop->Start(); });
+    }
     loop_->Start();
   }
 
-  void Stop() { loop_->Stop(); }
+  void Stop() {
+    loop_->Stop();
+    notification_loop_->Stop();
+    for (auto& io_loop : io_loops_) {
+      io_loop->Stop();
+    }
+  }
 
   void Shutdown() {
+    // The loops may have been stopped by a signal handler, which can't join
+    // the threads.
+    Stop();
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+    threads_.clear();
     loop_->Shutdown();
-    loop_ = nullptr;
     store_ = nullptr;
+    loop_ = nullptr;
+    notification_loop_ = nullptr;
+    io_loops_.clear();
   }
 
  private:
   std::unique_ptr<EventLoop> loop_;
+  std::unique_ptr<EventLoop> notification_loop_;
+  std::vector<std::unique_ptr<EventLoop>> io_loops_;
+  std::vector<std::thread> threads_;
   std::unique_ptr<PlasmaStore> store_;
 };
 
@@ -1202,14 +1710,16 @@ void HandleSignal(int signal) {
 }
 
 void StartServer(char* socket_name, std::string plasma_directory, bool hugepages_enabled,
-                 std::shared_ptr<ExternalStore> external_store) {
+                 std::shared_ptr<ExternalStore> external_store, int num_io_threads,
+                 int num_external_store_threads, CachePolicy cache_policy) {
   // Ignore SIGPIPE signals. If we don't do this, then when we attempt to write
   // to a client that has already died, the store could die.
   signal(SIGPIPE, SIG_IGN);
 
   g_runner.reset(new PlasmaStoreRunner());
   signal(SIGTERM, HandleSignal);
-  g_runner->Start(socket_name, plasma_directory, hugepages_enabled, external_store);
+  g_runner->Start(socket_name, plasma_directory, hugepages_enabled, external_store,
+                  num_io_threads, num_external_store_threads, cache_policy);
 }
 
 // Function to use (instead of ARROW_LOG(FATAL)) for usage, etc. errors before
@@ -1237,6 +1747,12 @@ DEFINE_bool(h, false, "whether to enable hugepage support");
 DEFINE_string(s, "",
               "socket name where the Plasma store will listen for requests, required");
 DEFINE_string(m, "", "amount of memory in bytes to use for Plasma store, required");
+DEFINE_int32(t, 1, "number of threads serving client connections");
+DEFINE_int32(x, 1, "number of threads accessing the external store");
+DEFINE_string(p, "lru",
+              "order in which to evict objects outside of client quotas: "
+              "lru (least recently used first) or gdsf (least frequently used "
+              "per byte first)");
 
 int main(int argc, char* argv[]) {
   ArrowLog::StartArrowLog(argv[0], ArrowLogLevel::ARROW_INFO);
@@ -1293,6 +1809,16 @@ int main(int argc, char* argv[]) {
         "if you want to use hugepages, please specify path to huge pages "
         "filesystem with -d");
   }
+  if (FLAGS_t < 1) {
+    plasma::ExitWithUsageError("-t switch takes a positive number of threads");
+  }
+  if (FLAGS_x < 1) {
+    plasma::ExitWithUsageError("-x switch takes a positive number of threads");
+  }
+  plasma::CachePolicy cache_policy;
+  if (!plasma::ParseCachePolicy(FLAGS_p, &cache_policy).ok()) {
+    plasma::ExitWithUsageError("-p switch takes an eviction policy, lru or gdsf");
+  }
   ARROW_CHECK(!plasma_directory.empty());
   ARROW_LOG(INFO) << "Starting object store with directory " << plasma_directory
                   << " and huge page support "
@@ -1343,7 +1869,8 @@ int main(int argc, char* argv[]) {
   }
 
   ARROW_LOG(DEBUG) << "starting server listening on " << socket_name;
-  plasma::StartServer(socket_name, plasma_directory, hugepages_enabled, external_store);
+  plasma::StartServer(socket_name, plasma_directory, hugepages_enabled, external_store,
+                      FLAGS_t, FLAGS_x, cache_policy);
   plasma::g_runner->Shutdown();
   plasma::g_runner = nullptr;
 
@@ -17,8 +17,10 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -33,6 +35,9 @@
 
 namespace arrow {
 class Status;
+namespace internal {
+class ThreadPool;
+}  // namespace internal
 }  // namespace arrow
 
 namespace plasma {
@@ -53,6 +58,26 @@ struct NotificationQueue {
   std::deque<std::unique_ptr<uint8_t[]>> object_notifications;
 };
 
+/// The Plasma store can serve clients from several threads, each running
+/// its own event loop. The shared state is protected by the following
+/// mutexes, which must be acquired in this order:
+///
+///  1. get_requests_mutex_, protecting object_get_requests_.
+///  2. memory_mutex_, serializing allocations and evictions. Entries are only
+///     added to or removed from the object table with both this mutex and the
+///     shard mutex held, so that holding either one is enough to look entries
+///     up.
+///  3. The object table shard mutexes, protecting the entries in the shard.
+///     Several shards are locked in increasing shard index order.
+///  4. Client::mutex.
+///  5. policy_mutex_, protecting the eviction policy and deletion_cache_;
+///     notifications_mutex_, protecting pending_notifications_; and
+///     clients_mutex_, protecting connected_clients_. These are never held
+///     together.
+///
+/// Objects are written to and read back from the external store by a thread
+/// pool, without holding any of these mutexes. Meanwhile, the objects are in
+/// the PLASMA_SPILLING or PLASMA_RESTORING state.
 class PlasmaStore {
  public:
   using NotificationMap = std::unordered_map<int, NotificationQueue>;
@@ -62,6 +87,22 @@ class PlasmaStore {
               const std::string& socket_name,
               std::shared_ptr<ExternalStore> external_store);
 
+  /// \param loop The event loop accepting new connections. It also serves
+  ///        clients, and sends notifications if notification_loop is null.
+  /// \param io_loops Additional event loops serving clients, each run by its
+  ///        own thread. Clients are assigned to the loops in turn.
+  /// \param notification_loop The event loop sending notifications.
+  /// \param num_external_store_threads The number of threads writing objects
+  ///        to and reading them from the external store.
+  /// \param cache_policy The order in which to evict objects outside of
+  ///        client quotas.
+  PlasmaStore(EventLoop* loop, std::vector<EventLoop*> io_loops,
+              EventLoop* notification_loop, std::string directory,
+              bool hugepages_enabled, const std::string& socket_name,
+              std::shared_ptr<ExternalStore> external_store,
+              int num_external_store_threads = 1,
+              CachePolicy cache_policy = CachePolicy::LRU);
+
   ~PlasmaStore();
 
   /// Get a const pointer to the internal PlasmaStoreInfo object.
@@ -114,7 +155,10 @@ class PlasmaStore {
   ///  - PlasmaError::ObjectInUse, if the object is in use.
   PlasmaError DeleteObject(ObjectID& object_id);
 
-  /// Evict objects returned by the eviction policy.
+  /// Evict objects returned by the eviction policy. Objects that are in use
+  /// again by the time they are evicted are skipped. With an external store,
+  /// the objects are written to it in the background, and their memory is
+  /// freed once they are written. The caller must hold memory_mutex_.
   ///
   /// \param object_ids Object IDs of the objects to be evicted.
   void EvictObjects(const std::vector<ObjectID>& object_ids);
@@ -127,12 +171,24 @@ class PlasmaStore {
   /// For each object, the client must do a call to release_object to tell the
   /// store when it is done with the object.
   ///
+  /// Evicted objects are restored from the external store in the background,
+  /// and concurrent requests for them wait for the same restore. A request
+  /// with a timeout of 0 doesn't wait, but still starts the restores.
+  ///
   /// \param client The client making this request.
   /// \param object_ids Object IDs of the objects to be gotten.
   /// \param timeout_ms The timeout for the get request in milliseconds.
   void ProcessGetRequest(Client* client, const std::vector<ObjectID>& object_ids,
                          int64_t timeout_ms);
 
+  /// Start restoring evicted objects from the external store in the
+  /// background. Objects that aren't evicted are skipped. The caller must not
+  /// hold get_requests_mutex_ nor memory_mutex_.
+  ///
+  /// \param object_ids Object IDs of the objects to be restored.
+  /// \param client The client that needs the objects.
+  void RestoreObjects(const std::vector<ObjectID>& object_ids, Client* client);
+
   /// Seal a vector of objects. The objects are now immutable and can be accessed with
   /// get.
   ///
@@ -170,17 +226,32 @@ class PlasmaStore {
   /// \param client_fd The client file descriptor that is disconnected.
   void DisconnectClient(int client_fd);
 
+  /// Send the pending notifications of a subscriber. This must be called on
+  /// the notification loop with notifications_mutex_ held.
   NotificationMap::iterator SendNotifications(NotificationMap::iterator it);
 
   arrow::Status ProcessMessage(Client* client);
 
  private:
+  /// Queue notifications to all of the subscribers; they are sent by the
+  /// notification loop. The caller must hold the shard mutexes of the objects.
   void PushNotification(ObjectInfoT* object_notification);
 
   void PushNotifications(std::vector<ObjectInfoT>& object_notifications);
 
   void PushNotification(ObjectInfoT* object_notification, int client_fd);
 
+  /// Schedule sending the queued notifications on the notification loop.
+  /// The caller must hold notifications_mutex_.
+  void ScheduleNotifications();
+
+  /// Lock the shards holding some objects, in increasing shard index order.
+  std::vector<std::unique_lock<std::mutex>> LockShards(
+      const std::vector<ObjectID>& object_ids);
+
+  /// Get the size of a memory mapped file, with memory_mutex_ held.
+  int64_t MmapSize(int fd);
+
   void AddToClientObjectIds(const ObjectID& object_id, ObjectTableEntry* entry,
                             Client* client);
 
@@ -194,17 +265,43 @@ class PlasmaStore {
   /// \param client The client whose GetRequests should be removed.
   void RemoveGetRequestsForClient(Client* client);
 
+  /// Remove a satisfied or timed out GetRequest from object_get_requests_.
+  /// The caller must hold get_requests_mutex_.
+  void CompleteGetRequest(GetRequest* get_request);
+
+  /// Reply to a completed GetRequest and delete it. This must be called on
+  /// the client's event loop.
   void ReturnFromGet(GetRequest* get_req);
 
+  /// The caller must hold get_requests_mutex_.
   void UpdateObjectGetRequests(const ObjectID& object_id);
 
+  /// Remove an object from the objects a client is using. The caller must
+  /// hold the shard mutex of the object, and, if evict is set, evict the
+  /// object once the mutex is released.
   int RemoveFromClientObjectIds(const ObjectID& object_id, ObjectTableEntry* entry,
-                                Client* client);
+                                Client* client, bool* evict);
+
+  int RemoveFromClientObjectIds(const ObjectID& object_id, Client* client);
 
   void EraseFromObjectTable(const ObjectID& object_id);
 
   uint8_t* AllocateMemory(size_t size, bool evict_if_full, int* fd, int64_t* map_size,
                           ptrdiff_t* offset, Client* client, bool is_create);
+
+  /// Free the memory of spilled objects, once the external store wrote them.
+  /// Objects that failed to be written, or that are in use again, stay in
+  /// memory.
+  void FinishSpill(const std::vector<ObjectID>& object_ids,
+                   const std::vector<ObjectTableEntry*>& entries, int64_t num_bytes,
+                   const Status& status);
+
+  /// Seal restored objects, once the external store read them, and satisfy
+  /// the get requests waiting for them. Objects that failed to be read are
+  /// evicted again.
+  void FinishRestore(const std::vector<ObjectID>& object_ids,
+                     const std::vector<ObjectTableEntry*>& entries,
+                     const Status& status);
 #ifdef PLASMA_CUDA
   arrow::Result<std::shared_ptr<arrow::cuda::CudaContext>> GetCudaContext(int device_num);
   Status AllocateCudaMemory(int device_num, int64_t size, uint8_t** out_pointer,
@@ -213,19 +310,34 @@ class PlasmaStore {
   Status FreeCudaMemory(int device_num, int64_t size, uint8_t* out_pointer);
 #endif
 
-  /// Event loop of the plasma store.
+  /// Event loop of the plasma store, accepting new connections.
   EventLoop* loop_;
+  /// Event loops serving clients, including loop_.
+  std::vector<EventLoop*> io_loops_;
+  /// The index in io_loops_ of the loop serving the next client.
+  size_t next_io_loop_;
+  /// Event loop sending notifications.
+  EventLoop* notification_loop_;
   /// The plasma store information, including the object tables, that is exposed
   /// to the eviction policy.
   PlasmaStoreInfo store_info_;
+  std::mutex memory_mutex_;
+  /// Number of bytes of objects being spilled to the external store, which
+  /// will be freed once they are written. Protected by memory_mutex_.
+  int64_t spilling_bytes_;
+  /// Notified, with memory_mutex_ held, when spilled objects are freed.
+  std::condition_variable_any spills_done_;
+  std::mutex policy_mutex_;
   /// The state that is managed by the eviction policy.
   QuotaAwarePolicy eviction_policy_;
-  /// Input buffer. This is allocated only once to avoid mallocs for every
-  /// call to process_message.
-  std::vector<uint8_t> input_buffer_;
+  std::mutex get_requests_mutex_;
   /// A hash table mapping object IDs to a vector of the get requests that are
   /// waiting for the object to arrive.
   std::unordered_map<ObjectID, std::vector<GetRequest*>> object_get_requests_;
+  std::mutex notifications_mutex_;
+  /// Whether sending the queued notifications has been scheduled on the
+  /// notification loop.
+  bool notifications_scheduled_;
   /// The pending notifications that have not been sent to subscribers because
   /// the socket send buffers were full. This is a hash table from client file
   /// descriptor to an array of object_ids to send to that client.
@@ -233,13 +345,15 @@ class PlasmaStore {
   /// reorganize the code slightly.
   NotificationMap pending_notifications_;
 
+  std::mutex clients_mutex_;
   std::unordered_map<int, std::unique_ptr<Client>> connected_clients_;
 
   std::unordered_set<ObjectID> deletion_cache_;
 
+  std::shared_ptr<ExternalStore> external_store_;
   /// Manages worker threads for handling asynchronous/multi-threaded requests
   /// for reading/writing data to/from external store.
-  std::shared_ptr<ExternalStore> external_store_;
+  std::shared_ptr<arrow::internal::ThreadPool> external_store_pool_;
 };
 
 }  // namespace plasma
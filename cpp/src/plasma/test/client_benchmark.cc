@@ -0,0 +1,177 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Compare the one-message-per-object client protocol with the batched
+// Release, Contains and Seal messages.
+
+#include <stdlib.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/result.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+#include "plasma/client.h"
+#include "plasma/common.h"
+#include "plasma/test_util.h"
+
+namespace plasma {
+
+std::string store_socket_name;  // NOLINT
+
+namespace {
+
+std::vector<ObjectID> CreateObjects(PlasmaClient* client, int64_t num_objects) {
+  std::vector<ObjectID> object_ids;
+  for (int64_t i = 0; i < num_objects; ++i) {
+    object_ids.push_back(random_object_id());
+  }
+  std::vector<std::string> data(object_ids.size(), std::string(64, 'x'));
+  std::vector<std::string> metadata(object_ids.size());
+  ARROW_CHECK_OK(client->CreateAndSealBatch(object_ids, data, metadata));
+  return object_ids;
+}
+
+void GetRelease(benchmark::State& state, bool batched) {  // NOLINT non-const reference
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.Connect(store_socket_name));
+  const auto object_ids = CreateObjects(&client, state.range(0));
+  if (batched) {
+    ARROW_CHECK_OK(client.SetReleaseBatching(state.range(0)));
+  }
+
+  std::vector<ObjectBuffer> object_buffers;
+  for (auto _ : state) {
+    ARROW_CHECK_OK(client.Get(object_ids, -1, &object_buffers));
+    // Drop the buffers, which releases the objects
+    object_buffers.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  ARROW_CHECK_OK(client.Disconnect());
+}
+
+void Contains(benchmark::State& state, bool batched) {  // NOLINT non-const reference
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.Connect(store_socket_name));
+  // Query as many missing objects as present ones
+  auto object_ids = CreateObjects(&client, state.range(0) / 2);
+  while (static_cast<int64_t>(object_ids.size()) < state.range(0)) {
+    object_ids.push_back(random_object_id());
+  }
+
+  std::vector<bool> has_object;
+  for (auto _ : state) {
+    if (batched) {
+      ARROW_CHECK_OK(client.Contains(object_ids, &has_object));
+    } else {
+      for (const auto& object_id : object_ids) {
+        bool has;
+        ARROW_CHECK_OK(client.Contains(object_id, &has));
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  ARROW_CHECK_OK(client.Disconnect());
+}
+
+void CreateSeal(benchmark::State& state, bool batched) {  // NOLINT non-const reference
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.Connect(store_socket_name));
+
+  std::vector<ObjectID> object_ids(state.range(0));
+  for (auto _ : state) {
+    for (auto& object_id : object_ids) {
+      object_id = random_object_id();
+      std::shared_ptr<Buffer> data;
+      ARROW_CHECK_OK(client.Create(object_id, 64, nullptr, 0, &data));
+    }
+    if (batched) {
+      ARROW_CHECK_OK(client.Seal(object_ids));
+    } else {
+      for (const auto& object_id : object_ids) {
+        ARROW_CHECK_OK(client.Seal(object_id));
+      }
+    }
+    for (const auto& object_id : object_ids) {
+      ARROW_CHECK_OK(client.Release(object_id));
+    }
+    ARROW_CHECK_OK(client.Delete(object_ids));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  ARROW_CHECK_OK(client.Disconnect());
+}
+
+}  // namespace
+
+static void GetReleaseUnbatched(benchmark::State& state) {  // NOLINT
+  GetRelease(state, false);
+}
+
+static void GetReleaseBatched(benchmark::State& state) {  // NOLINT
+  GetRelease(state, true);
+}
+
+static void ContainsUnbatched(benchmark::State& state) {  // NOLINT
+  Contains(state, false);
+}
+
+static void ContainsBatched(benchmark::State& state) {  // NOLINT
+  Contains(state, true);
+}
+
+static void CreateSealUnbatched(benchmark::State& state) {  // NOLINT
+  CreateSeal(state, false);
+}
+
+static void CreateSealBatched(benchmark::State& state) {  // NOLINT
+  CreateSeal(state, true);
+}
+
+BENCHMARK(GetReleaseUnbatched)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(GetReleaseBatched)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(ContainsUnbatched)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(ContainsBatched)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(CreateSealUnbatched)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK(CreateSealBatched)->RangeMultiplier(8)->Range(8, 512);
+
+}  // namespace plasma
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+
+  // Start a store from the same directory as this executable
+  std::string executable(argv[0]);
+  std::string plasma_directory = executable.substr(0, executable.find_last_of("/"));
+  auto temp_dir = arrow::internal::TemporaryDir::Make("cli-bench-").ValueOrDie();
+  plasma::store_socket_name = temp_dir->path().ToString() + "store";
+  std::string pid_file = plasma::store_socket_name + ".pid";
+  std::string plasma_command =
+      plasma_directory + "/plasma-store-server -m 100000000 -s " +
+      plasma::store_socket_name + " 1> /dev/null 2> /dev/null & echo $! > " + pid_file;
+  ARROW_CHECK_EQ(system(plasma_command.c_str()), 0);
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  std::string plasma_kill_command = "kill -KILL `cat " + pid_file + "` || exit 0";
+  ARROW_CHECK_EQ(system(plasma_kill_command.c_str()), 0);
+  return 0;
+}
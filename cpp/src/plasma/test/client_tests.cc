@@ -23,7 +23,10 @@
 #include <unistd.h>
 
 #include <memory>
+#include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -51,6 +54,9 @@ void AssertObjectBufferEqual(const ObjectBuffer& object_buffer,
 
 class TestPlasmaStore : public ::testing::Test {
  public:
+  explicit TestPlasmaStore(std::string store_args = "")
+      : store_args_(std::move(store_args)) {}
+
   // TODO(pcm): At the moment, stdout of the test gets mixed up with
   // stdout of the object store. Consider changing that.
 
@@ -62,7 +68,8 @@ class TestPlasmaStore : public ::testing::Test {
         test_executable.substr(0, test_executable.find_last_of("/"));
     std::string plasma_command =
         plasma_directory + "/plasma-store-server -m 10000000 -s " + store_socket_name_ +
-        " 1> /dev/null 2> /dev/null & " + "echo $! > " + store_socket_name_ + ".pid";
+        store_args_ + " 1> /dev/null 2> /dev/null & " + "echo $! > " +
+        store_socket_name_ + ".pid";
     PLASMA_CHECK_SYSTEM(system(plasma_command.c_str()));
     ARROW_CHECK_OK(client_.Connect(store_socket_name_, ""));
     ARROW_CHECK_OK(client2_.Connect(store_socket_name_, ""));
@@ -101,12 +108,23 @@ class TestPlasmaStore : public ::testing::Test {
   }
 
  protected:
+  std::string store_args_;
   PlasmaClient client_;
   PlasmaClient client2_;
   std::unique_ptr<TemporaryDir> temp_dir_;
   std::string store_socket_name_;
 };
 
+class TestPlasmaStoreThreads : public TestPlasmaStore {
+ public:
+  TestPlasmaStoreThreads() : TestPlasmaStore(" -t 4") {}
+};
+
+class TestPlasmaStoreGDSF : public TestPlasmaStore {
+ public:
+  TestPlasmaStoreGDSF() : TestPlasmaStore(" -p gdsf") {}
+};
+
 TEST_F(TestPlasmaStore, NewSubscriberTest) {
   PlasmaClient local_client, local_client2;
 
@@ -500,6 +518,50 @@ TEST_F(TestPlasmaStore, RefreshLRUTest) {
   ASSERT_FALSE(has_object);
 }
 
+TEST_F(TestPlasmaStore, HitsAndMissesTest) {
+  ObjectID object_id = random_object_id();
+  CreateObject(client_, object_id, {}, {1, 2, 3}, true);
+
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client_.Get({object_id, random_object_id()}, 0, &object_buffers));
+  object_buffers.clear();
+  ARROW_CHECK_OK(client_.Get({object_id}, 0, &object_buffers));
+  object_buffers.clear();
+
+  const std::string debug_string = client_.DebugString();
+  ASSERT_NE(debug_string.find("num hits: 2"), std::string::npos) << debug_string;
+  ASSERT_NE(debug_string.find("num misses: 1"), std::string::npos) << debug_string;
+}
+
+TEST_F(TestPlasmaStoreGDSF, KeepsSmallHotObjectsTest) {
+  bool has_object = false;
+  ObjectID hot_id = random_object_id();
+  CreateObject(client_, hot_id, {}, std::vector<uint8_t>(1000, 1), true);
+  std::vector<ObjectBuffer> object_buffers;
+  for (int i = 0; i < 5; ++i) {
+    ARROW_CHECK_OK(client_.Get({hot_id}, -1, &object_buffers));
+    object_buffers.clear();
+  }
+
+  // Fill the store several times over with objects that are never read again.
+  // The least recently used object would be evicted first.
+  std::vector<uint8_t> large_data(1 * 1000 * 1000, 0);
+  std::vector<ObjectID> large_ids;
+  for (int i = 0; i < 30; ++i) {
+    large_ids.push_back(random_object_id());
+    CreateObject(client_, large_ids.back(), {}, large_data, true);
+  }
+  ARROW_CHECK_OK(client_.Contains(large_ids[0], &has_object));
+  ASSERT_FALSE(has_object);
+  ARROW_CHECK_OK(client_.Contains(hot_id, &has_object));
+  ASSERT_TRUE(has_object);
+
+  const std::string debug_string = client_.DebugString();
+  ASSERT_NE(debug_string.find("(global gdsf) num evictions: "), std::string::npos)
+      << debug_string;
+  ASSERT_NE(debug_string.find("num hits: 5"), std::string::npos) << debug_string;
+}
+
 TEST_F(TestPlasmaStore, DeleteTest) {
   ObjectID object_id = random_object_id();
 
@@ -591,6 +653,96 @@ TEST_F(TestPlasmaStore, ContainsTest) {
   ASSERT_TRUE(has_object);
 }
 
+TEST_F(TestPlasmaStore, ContainsBatchTest) {
+  ObjectID object_id1 = random_object_id();
+  ObjectID object_id2 = random_object_id();
+  ObjectID object_id3 = random_object_id();
+  std::vector<uint8_t> data(100, 0);
+  CreateObject(client_, object_id1, {42}, data);
+  CreateObject(client_, object_id3, {42}, data);
+  // Keep a reference to one of the objects.
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client_.Get({object_id3}, -1, &object_buffers));
+
+  std::vector<bool> has_object;
+  ARROW_CHECK_OK(client_.Contains({object_id1, object_id2, object_id3}, &has_object));
+  ASSERT_EQ(has_object, std::vector<bool>({true, false, true}));
+  ARROW_CHECK_OK(client2_.Contains({object_id2, object_id3}, &has_object));
+  ASSERT_EQ(has_object, std::vector<bool>({false, true}));
+}
+
+TEST_F(TestPlasmaStore, ReleaseBatchingTest) {
+  ARROW_CHECK_OK(client_.SetReleaseBatching(4));
+  std::vector<ObjectID> object_ids;
+  std::vector<uint8_t> data(100, 0);
+  for (int i = 0; i < 3; ++i) {
+    object_ids.push_back(random_object_id());
+    CreateObject(client_, object_ids.back(), {42}, data);
+  }
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client_.Get(object_ids, -1, &object_buffers));
+  object_buffers.clear();
+  // The releases are queued, so the store still counts the references.
+  ObjectTable objects;
+  ARROW_CHECK_OK(client2_.List(&objects));
+  for (const auto& object_id : object_ids) {
+    ASSERT_EQ(objects[object_id]->ref_count, 1);
+  }
+  // Requests on the same connection are handled after the releases.
+  ARROW_CHECK_OK(client_.FlushReleases());
+  ARROW_CHECK_OK(client_.List(&objects));
+  for (const auto& object_id : object_ids) {
+    ASSERT_EQ(objects[object_id]->ref_count, 0);
+  }
+
+  // Getting an object whose release is queued keeps a reference to it.
+  ARROW_CHECK_OK(client_.Get({object_ids[0]}, -1, &object_buffers));
+  object_buffers.clear();
+  ARROW_CHECK_OK(client_.Get({object_ids[0]}, -1, &object_buffers));
+  ARROW_CHECK_OK(client_.List(&objects));
+  ASSERT_EQ(objects[object_ids[0]]->ref_count, 1);
+  object_buffers.clear();
+
+  // A full batch is sent right away.
+  object_ids.push_back(random_object_id());
+  CreateObject(client_, object_ids.back(), {42}, data);
+  ARROW_CHECK_OK(client_.Get(object_ids, -1, &object_buffers));
+  object_buffers.clear();
+  for (int i = 0; i < 100; ++i) {
+    ARROW_CHECK_OK(client2_.List(&objects));
+    if (objects[object_ids.back()]->ref_count == 0) {
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  for (const auto& object_id : object_ids) {
+    ASSERT_EQ(objects[object_id]->ref_count, 0);
+  }
+}
+
+TEST_F(TestPlasmaStore, ReleaseFlushIntervalTest) {
+  ARROW_CHECK_OK(client_.SetReleaseBatching(1000, 10));
+  ObjectID object_id = random_object_id();
+  std::vector<uint8_t> data(100, 0);
+  CreateObject(client_, object_id, {42}, data);
+  ObjectTable objects;
+  for (int i = 0; i < 100; ++i) {
+    ARROW_CHECK_OK(client2_.List(&objects));
+    if (objects[object_id]->ref_count == 0) {
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_EQ(objects[object_id]->ref_count, 0);
+  // Disabling batching doesn't leave releases behind.
+  object_id = random_object_id();
+  ARROW_CHECK_OK(client_.SetReleaseBatching(1000));
+  CreateObject(client_, object_id, {42}, data);
+  ARROW_CHECK_OK(client_.SetReleaseBatching(0));
+  ARROW_CHECK_OK(client_.List(&objects));
+  ASSERT_EQ(objects[object_id]->ref_count, 0);
+}
+
 TEST_F(TestPlasmaStore, GetTest) {
   std::vector<ObjectBuffer> object_buffers;
 
@@ -699,6 +851,36 @@ TEST_F(TestPlasmaStore, BatchCreateTest) {
   ASSERT_STREQ(out2.c_str(), "world");
 }
 
+TEST_F(TestPlasmaStore, SealBatchTest) {
+  std::vector<ObjectID> object_ids = {random_object_id(), random_object_id()};
+  uint8_t metadata[] = {5};
+  std::shared_ptr<Buffer> data;
+  for (size_t i = 0; i < object_ids.size(); ++i) {
+    ARROW_CHECK_OK(client_.Create(object_ids[i], 4, metadata, sizeof(metadata), &data));
+    data->mutable_data()[0] = static_cast<uint8_t>(i + 1);
+  }
+  data.reset();
+  ARROW_CHECK_OK(client_.Seal(object_ids));
+
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client2_.Get(object_ids, -1, &object_buffers));
+  ASSERT_EQ(object_buffers[0].data->data()[0], 1);
+  ASSERT_EQ(object_buffers[1].data->data()[0], 2);
+
+  // Nothing is sealed if one of the objects can't be.
+  ObjectID object_id = random_object_id();
+  ARROW_CHECK_OK(client_.Create(object_id, 4, metadata, sizeof(metadata), &data));
+  data.reset();
+  Status result = client_.Seal({object_id, random_object_id()});
+  ASSERT_TRUE(IsPlasmaObjectNotFound(result));
+  result = client_.Seal({object_id, object_id});
+  ASSERT_TRUE(IsPlasmaObjectAlreadySealed(result));
+  ARROW_CHECK_OK(client_.Seal({object_id}));
+  result = client_.Seal({object_id});
+  ASSERT_TRUE(IsPlasmaObjectAlreadySealed(result));
+  ARROW_CHECK_OK(client_.Release(object_id));
+}
+
 TEST_F(TestPlasmaStore, AbortTest) {
   ObjectID object_id = random_object_id();
   std::vector<ObjectBuffer> object_buffers;
@@ -864,6 +1046,55 @@ TEST_F(TestPlasmaStore, ManyObjectTest) {
   }
 }
 
+TEST_F(TestPlasmaStoreThreads, ConcurrentClientsTest) {
+  // Each client is served by a different thread of the store. Each client
+  // gets the objects created by the next one, so that gets are satisfied by
+  // seals on other threads.
+  constexpr int kNumClients = 4;
+  constexpr int kNumObjects = 100;
+  std::vector<std::vector<ObjectID>> object_ids(kNumClients);
+  for (auto& ids : object_ids) {
+    for (int i = 0; i < kNumObjects; ++i) {
+      ids.push_back(random_object_id());
+    }
+  }
+  std::vector<std::thread> threads;
+  std::vector<int64_t> num_gotten(kNumClients, 0);
+  for (int c = 0; c < kNumClients; ++c) {
+    threads.emplace_back([&, c]() {
+      PlasmaClient client;
+      ARROW_CHECK_OK(client.Connect(store_socket_name_, ""));
+      const auto& to_get = object_ids[(c + 1) % kNumClients];
+      for (int i = 0; i < kNumObjects; ++i) {
+        std::vector<uint8_t> data(16, static_cast<uint8_t>(c));
+        CreateObject(client, object_ids[c][i], {}, data);
+        std::vector<ObjectBuffer> object_buffers;
+        ARROW_CHECK_OK(client.Get({to_get[i]}, -1, &object_buffers));
+        if (object_buffers[0].data &&
+            object_buffers[0].data->data()[0] == (c + 1) % kNumClients) {
+          ++num_gotten[c];
+        }
+      }
+      ARROW_CHECK_OK(client.Disconnect());
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (int c = 0; c < kNumClients; ++c) {
+    ASSERT_EQ(num_gotten[c], kNumObjects);
+  }
+
+  // All of the objects are still in the store.
+  for (const auto& ids : object_ids) {
+    for (const auto& object_id : ids) {
+      bool has_object;
+      ARROW_CHECK_OK(client_.Contains(object_id, &has_object));
+      ASSERT_TRUE(has_object);
+    }
+  }
+}
+
 #ifdef PLASMA_CUDA
 using arrow::cuda::CudaBuffer;
 using arrow::cuda::CudaBufferReader;
@@ -0,0 +1,144 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+
+#include "plasma/common.h"
+#include "plasma/eviction_policy.h"
+#include "plasma/test_util.h"
+
+namespace plasma {
+
+std::vector<ObjectID> RandomObjectIds(int num_objects) {
+  std::vector<ObjectID> object_ids;
+  for (int i = 0; i < num_objects; ++i) {
+    object_ids.push_back(random_object_id());
+  }
+  return object_ids;
+}
+
+TEST(TestCachePolicy, Parse) {
+  CachePolicy policy;
+  ASSERT_OK(ParseCachePolicy("lru", &policy));
+  ASSERT_EQ(policy, CachePolicy::LRU);
+  ASSERT_OK(ParseCachePolicy("gdsf", &policy));
+  ASSERT_EQ(policy, CachePolicy::GDSF);
+  ASSERT_RAISES(Invalid, ParseCachePolicy("arc", &policy));
+}
+
+TEST(TestLRUCache, EvictsLeastRecentlyAdded) {
+  LRUCache cache("test", 1000);
+  const auto object_ids = RandomObjectIds(3);
+  for (const auto& object_id : object_ids) {
+    cache.Add(object_id, 100);
+  }
+  ASSERT_EQ(cache.RemainingCapacity(), 700);
+  // Uses don't change the order
+  cache.Touch(object_ids[0]);
+
+  std::vector<ObjectID> objects_to_evict;
+  ASSERT_EQ(cache.ChooseObjectsToEvict(150, &objects_to_evict), 200);
+  ASSERT_EQ(objects_to_evict, std::vector<ObjectID>({object_ids[0], object_ids[1]}));
+  ASSERT_NE(cache.DebugString().find("(test) bytes evicted: 200"), std::string::npos);
+}
+
+TEST(TestGDSFCache, EvictsLargeObjectsFirst) {
+  GDSFCache cache("test", 10000);
+  const auto object_ids = RandomObjectIds(3);
+  cache.Add(object_ids[0], 100);
+  cache.Add(object_ids[1], 5000);
+  cache.Add(object_ids[2], 1000);
+
+  std::vector<ObjectID> objects_to_evict;
+  ASSERT_EQ(cache.ChooseObjectsToEvict(1, &objects_to_evict), 5000);
+  ASSERT_EQ(objects_to_evict, std::vector<ObjectID>({object_ids[1]}));
+}
+
+TEST(TestGDSFCache, EvictsFrequentlyUsedObjectsLast) {
+  GDSFCache cache("test", 10000);
+  const auto object_ids = RandomObjectIds(2);
+  cache.Add(object_ids[0], 100);
+  cache.Add(object_ids[1], 100);
+  // Use the first object while it is out of the cache, and the second one
+  // while it is in the cache
+  ASSERT_EQ(cache.Remove(object_ids[0]), 100);
+  cache.Touch(object_ids[0]);
+  cache.Add(object_ids[0], 100);
+  for (int i = 0; i < 2; ++i) {
+    cache.Touch(object_ids[1]);
+  }
+
+  std::vector<ObjectID> objects_to_evict;
+  ASSERT_EQ(cache.ChooseObjectsToEvict(200, &objects_to_evict), 200);
+  ASSERT_EQ(objects_to_evict, std::vector<ObjectID>({object_ids[0], object_ids[1]}));
+}
+
+TEST(TestGDSFCache, AgesObjects) {
+  GDSFCache cache("test", 10000);
+  const auto object_ids = RandomObjectIds(3);
+  cache.Add(object_ids[0], 100);
+  for (int i = 0; i < 3; ++i) {
+    cache.Touch(object_ids[0]);
+  }
+  cache.Add(object_ids[1], 100);
+
+  // Evicting the second object raises the priority of the objects added
+  // from now on above the priority of the first object
+  std::vector<ObjectID> objects_to_evict;
+  ASSERT_EQ(cache.ChooseObjectsToEvict(1, &objects_to_evict), 100);
+  ASSERT_EQ(objects_to_evict, std::vector<ObjectID>({object_ids[1]}));
+  cache.Forget(object_ids[1]);
+  for (int i = 0; i < 4; ++i) {
+    cache.Add(object_ids[2], 100);
+    objects_to_evict.clear();
+    ASSERT_EQ(cache.ChooseObjectsToEvict(1, &objects_to_evict), 100);
+    cache.Forget(objects_to_evict[0]);
+    if (objects_to_evict[0] == object_ids[0]) {
+      break;
+    }
+    ASSERT_EQ(objects_to_evict[0], object_ids[2]);
+  }
+  ASSERT_EQ(objects_to_evict, std::vector<ObjectID>({object_ids[0]}));
+}
+
+TEST(TestGDSFCache, ForgetDropsFrequency) {
+  GDSFCache cache("test", 10000);
+  const auto object_ids = RandomObjectIds(2);
+  cache.Add(object_ids[0], 100);
+  cache.Touch(object_ids[0]);
+  cache.Touch(object_ids[0]);
+  cache.Forget(object_ids[0]);
+  ASSERT_EQ(cache.Remove(object_ids[0]), -1);
+  ASSERT_EQ(cache.RemainingCapacity(), 10000);
+  // Uses of objects that were never added aren't recorded
+  cache.Touch(object_ids[1]);
+
+  cache.Add(object_ids[1], 100);
+  cache.Add(object_ids[0], 100);
+  std::vector<ObjectID> objects_to_evict;
+  ASSERT_EQ(cache.ChooseObjectsToEvict(1, &objects_to_evict), 100);
+  ASSERT_EQ(objects_to_evict, std::vector<ObjectID>({object_ids[1]}));
+  ASSERT_NE(cache.DebugString().find("(test) num objects: 2"), std::string::npos);
+}
+
+}  // namespace plasma
@@ -22,8 +22,11 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <chrono>
 #include <memory>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -51,6 +54,10 @@ void AssertObjectBufferEqual(const ObjectBuffer& object_buffer,
 
 class TestPlasmaStoreWithExternal : public ::testing::Test {
  public:
+  explicit TestPlasmaStoreWithExternal(std::string store_args = "")
+      : store_args_(store_args) {}
+
+
   // TODO(pcm): At the moment, stdout of the test gets mixed up with
   // stdout of the object store. Consider changing that.
   void SetUp() override {
@@ -62,7 +69,7 @@ class TestPlasmaStoreWithExternal : public ::testing::Test {
     std::string plasma_command = plasma_directory +
                                  "/plasma-store-server -m 1024000 -e " +
                                  "hashtable://test -s " + store_socket_name_ +
-                                 " 1> /tmp/log.stdout 2> /tmp/log.stderr & " +
+                                 store_args_ + " 1> /tmp/log.stdout 2> /tmp/log.stderr & " +
                                  "echo $! > " + store_socket_name_ + ".pid";
     PLASMA_CHECK_SYSTEM(system(plasma_command.c_str()));
     ARROW_CHECK_OK(client_.Connect(store_socket_name_, ""));
@@ -85,9 +92,27 @@ class TestPlasmaStoreWithExternal : public ::testing::Test {
   }
 
  protected:
+  // Create more objects than fit in the store, so that the first ones are
+  // evicted.
+  std::vector<ObjectID> CreateObjects(const std::string& data,
+                                      const std::string& metadata) {
+    std::vector<ObjectID> object_ids;
+    for (int i = 0; i < 20; i++) {
+      object_ids.push_back(random_object_id());
+      ARROW_CHECK_OK(client_.CreateAndSeal(object_ids.back(), data, metadata));
+    }
+    return object_ids;
+  }
+
   PlasmaClient client_;
   std::unique_ptr<TemporaryDir> temp_dir_;
   std::string store_socket_name_;
+  std::string store_args_;
+};
+
+class TestPlasmaStoreWithExternalThreads : public TestPlasmaStoreWithExternal {
+ public:
+  TestPlasmaStoreWithExternalThreads() : TestPlasmaStoreWithExternal(" -t 4 -x 4") {}
 };
 
 TEST_F(TestPlasmaStoreWithExternal, EvictionTest) {
@@ -134,6 +159,80 @@ TEST_F(TestPlasmaStoreWithExternal, EvictionTest) {
   ASSERT_EQ(object_buffers[0].metadata, nullptr);
 }
 
+TEST_F(TestPlasmaStoreWithExternal, GetWithMetadataTest) {
+  std::string data(100 * 1024, 'x');
+  std::string metadata(1024, 'm');
+  auto object_ids = CreateObjects(data, metadata);
+  for (const auto& object_id : object_ids) {
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(client_.Get({object_id}, -1, &object_buffers));
+    AssertObjectBufferEqual(object_buffers[0], metadata, data);
+  }
+}
+
+TEST_F(TestPlasmaStoreWithExternal, NonBlockingGetTest) {
+  std::string data(100 * 1024, 'x');
+  std::string metadata;
+  auto object_ids = CreateObjects(data, metadata);
+
+  // A get that doesn't wait still restores the object
+  std::vector<ObjectBuffer> object_buffers;
+  auto start = std::chrono::steady_clock::now();
+  do {
+    ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+    ARROW_CHECK_OK(client_.Get({object_ids[0]}, 0, &object_buffers));
+  } while (!object_buffers[0].data);
+  AssertObjectBufferEqual(object_buffers[0], metadata, data);
+}
+
+TEST_F(TestPlasmaStoreWithExternal, PrefetchTest) {
+  std::string data(100 * 1024, 'x');
+  std::string metadata = "metadata";
+  auto object_ids = CreateObjects(data, metadata);
+
+  // Objects that are not evicted are ignored
+  std::vector<ObjectID> prefetch_ids(object_ids.begin(), object_ids.begin() + 3);
+  prefetch_ids.push_back(object_ids.back());
+  prefetch_ids.push_back(random_object_id());
+  ARROW_CHECK_OK(client_.Prefetch(prefetch_ids));
+
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client_.Get(prefetch_ids, 100, &object_buffers));
+  ASSERT_EQ(object_buffers.size(), prefetch_ids.size());
+  for (size_t i = 0; i < 4; i++) {
+    AssertObjectBufferEqual(object_buffers[i], metadata, data);
+  }
+  ASSERT_EQ(object_buffers[4].data, nullptr);
+}
+
+TEST_F(TestPlasmaStoreWithExternalThreads, ConcurrentGetTest) {
+  std::string data(100 * 1024, 'x');
+  std::string metadata = "metadata";
+  auto object_ids = CreateObjects(data, metadata);
+
+  // Clients getting the same evicted objects concurrently share the restores,
+  // while being served by several threads
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([&, i]() {
+      PlasmaClient client;
+      ARROW_CHECK_OK(client.Connect(store_socket_name_, ""));
+      for (int j = 0; j < 3; j++) {
+        for (size_t k = 0; k < object_ids.size(); k++) {
+          std::vector<ObjectBuffer> object_buffers;
+          const auto& object_id = object_ids[(k + i) % object_ids.size()];
+          ARROW_CHECK_OK(client.Get({object_id}, -1, &object_buffers));
+          AssertObjectBufferEqual(object_buffers[0], metadata, data);
+        }
+      }
+      ARROW_CHECK_OK(client.Disconnect());
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
 }  // namespace plasma
 
 int main(int argc, char** argv) {
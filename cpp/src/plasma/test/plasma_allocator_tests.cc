@@ -0,0 +1,164 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+#include "plasma/common.h"
+#include "plasma/plasma.h"
+#include "plasma/plasma_allocator.h"
+
+namespace plasma {
+
+using arrow::internal::TemporaryDir;
+
+class TestPlasmaAllocator : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(temp_dir_, TemporaryDir::Make("plasma-allocator-"));
+    store_info_.hugepages_enabled = false;
+    store_info_.directory = temp_dir_->path().ToString();
+    plasma_config = &store_info_;
+    PlasmaAllocator::SetFootprintLimit(kFootprintLimit);
+  }
+
+  void TearDown() override {
+    ASSERT_EQ(PlasmaAllocator::Allocated(), 0);
+    ASSERT_EQ(PlasmaAllocator::GetStats().slab_bytes, 0);
+  }
+
+  void* Allocate(int64_t bytes) {
+    void* mem = PlasmaAllocator::Memalign(kBlockSize, bytes);
+    EXPECT_NE(mem, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(mem) % kBlockSize, 0);
+    return mem;
+  }
+
+ protected:
+  static constexpr int64_t kFootprintLimit = 64 * 1024 * 1024;
+
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  PlasmaStoreInfo store_info_;
+};
+
+constexpr int64_t TestPlasmaAllocator::kFootprintLimit;
+
+TEST_F(TestPlasmaAllocator, SmallObjectsShareSlabs) {
+  std::vector<void*> objects;
+  for (int i = 0; i < 100; ++i) {
+    objects.push_back(Allocate(100));
+  }
+  auto stats = PlasmaAllocator::GetStats();
+  ASSERT_EQ(stats.allocated, 100 * 100);
+  ASSERT_EQ(stats.slab_object_bytes, 100 * 100);
+  ASSERT_EQ(stats.slab_bytes, PlasmaAllocator::kSlabSize);
+  ASSERT_EQ(stats.size_classes.size(), 1);
+  ASSERT_EQ(stats.size_classes[0].slot_size, 128);
+  ASSERT_EQ(stats.size_classes[0].num_slabs, 1);
+  ASSERT_EQ(stats.size_classes[0].num_objects, 100);
+  ASSERT_EQ(stats.size_classes[0].object_bytes, 100 * 100);
+
+  // The slots are packed from the start of the slab
+  for (size_t i = 1; i < objects.size(); ++i) {
+    ASSERT_EQ(static_cast<uint8_t*>(objects[i]) - static_cast<uint8_t*>(objects[0]),
+              static_cast<int64_t>(i) * 128);
+  }
+
+  // Freed slots are reused
+  PlasmaAllocator::Free(objects[10], 100);
+  ASSERT_EQ(Allocate(90), objects[10]);
+  PlasmaAllocator::Free(objects[10], 90);
+  objects.erase(objects.begin() + 10);
+
+  for (void* mem : objects) {
+    PlasmaAllocator::Free(mem, 100);
+  }
+  // The empty slab went back to dlmalloc
+  stats = PlasmaAllocator::GetStats();
+  ASSERT_EQ(stats.slab_bytes, 0);
+  ASSERT_EQ(stats.slab_object_bytes, 0);
+  ASSERT_TRUE(stats.size_classes.empty());
+}
+
+TEST_F(TestPlasmaAllocator, SizeClasses) {
+  // Requested size and expected slot size
+  const std::vector<std::pair<int64_t, int64_t>> sizes = {
+      {0, 64},         {1, 64},         {64, 64},        {65, 128},
+      {512, 512},      {513, 640},      {1024, 1024},    {1025, 1280},
+      {5000, 5120},    {40000, 40960},  {65536, 65536}};
+  std::map<int64_t, void*> objects;
+  for (const auto& size : sizes) {
+    objects[size.first] = Allocate(size.first);
+    bool found = false;
+    for (const auto& size_class : PlasmaAllocator::GetStats().size_classes) {
+      if (size_class.slot_size == size.second && size_class.num_objects > 0) {
+        found = true;
+      }
+    }
+    ASSERT_TRUE(found) << "no slot of " << size.second << " bytes for " << size.first;
+    // Objects don't overlap
+    std::memset(objects[size.first], 0xff, size.first);
+  }
+  for (const auto& object : objects) {
+    PlasmaAllocator::Free(object.second, object.first);
+  }
+}
+
+TEST_F(TestPlasmaAllocator, LargeObjectsUseDlmalloc) {
+  const int64_t size = PlasmaAllocator::kMaxSlabObjectSize + 1;
+  void* mem = Allocate(size);
+  auto stats = PlasmaAllocator::GetStats();
+  ASSERT_EQ(stats.allocated, size);
+  ASSERT_EQ(stats.slab_bytes, 0);
+  ASSERT_GE(stats.dlmalloc_in_use, size);
+  PlasmaAllocator::Free(mem, size);
+}
+
+TEST_F(TestPlasmaAllocator, FootprintLimit) {
+  std::vector<void*> objects;
+  const int64_t size = 32 * 1024;
+  for (int64_t i = 0; i < kFootprintLimit / size; ++i) {
+    objects.push_back(Allocate(size));
+  }
+  ASSERT_EQ(PlasmaAllocator::Allocated(), kFootprintLimit);
+  ASSERT_EQ(PlasmaAllocator::Memalign(kBlockSize, 64), nullptr);
+  for (void* mem : objects) {
+    PlasmaAllocator::Free(mem, size);
+  }
+}
+
+TEST_F(TestPlasmaAllocator, DebugString) {
+  void* mem = Allocate(1000);
+  const std::string debug_string = PlasmaAllocator::DebugString();
+  const std::string slab_bytes = std::to_string(PlasmaAllocator::kSlabSize);
+  ASSERT_NE(debug_string.find("slab bytes: " + slab_bytes), std::string::npos);
+  ASSERT_NE(debug_string.find("size class 1024: slabs: 1, objects: 1"),
+            std::string::npos);
+  PlasmaAllocator::Free(mem, 1000);
+}
+
+}  // namespace plasma
@@ -162,6 +162,32 @@ TEST_F(TestPlasmaSerialization, SealReply) {
   close(fd);
 }
 
+TEST_F(TestPlasmaSerialization, SealBatchRequest) {
+  int fd = CreateTemporaryFile();
+  std::vector<ObjectID> object_ids1 = {random_object_id(), random_object_id()};
+  std::vector<std::string> digests1 = {std::string(kDigestSize, 7),
+                                       std::string(kDigestSize, 8)};
+  ASSERT_OK(SendSealBatchRequest(fd, object_ids1, digests1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaSealBatchRequest);
+  std::vector<ObjectID> object_ids2;
+  std::vector<std::string> digests2;
+  ASSERT_OK(ReadSealBatchRequest(data.data(), data.size(), &object_ids2, &digests2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  ASSERT_EQ(digests1, digests2);
+  close(fd);
+}
+
+TEST_F(TestPlasmaSerialization, SealBatchReply) {
+  int fd = CreateTemporaryFile();
+  ASSERT_OK(SendSealBatchReply(fd, PlasmaError::ObjectExists));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaSealBatchReply);
+  Status s = ReadSealBatchReply(data.data(), data.size());
+  ASSERT_TRUE(IsPlasmaObjectExists(s));
+  close(fd);
+}
+
 TEST_F(TestPlasmaSerialization, GetRequest) {
   int fd = CreateTemporaryFile();
   ObjectID object_ids[2];
@@ -216,6 +242,18 @@ TEST_F(TestPlasmaSerialization, GetReply) {
   close(fd);
 }
 
+TEST_F(TestPlasmaSerialization, PrefetchRequest) {
+  int fd = CreateTemporaryFile();
+  std::vector<ObjectID> object_ids1 = {random_object_id(), random_object_id()};
+  ASSERT_OK(SendPrefetchRequest(fd, object_ids1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaPrefetchRequest);
+  std::vector<ObjectID> object_ids2;
+  ASSERT_OK(ReadPrefetchRequest(data.data(), data.size(), &object_ids2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  close(fd);
+}
+
 TEST_F(TestPlasmaSerialization, ReleaseRequest) {
   int fd = CreateTemporaryFile();
   ObjectID object_id1 = random_object_id();
@@ -240,6 +278,19 @@ TEST_F(TestPlasmaSerialization, ReleaseReply) {
   close(fd);
 }
 
+TEST_F(TestPlasmaSerialization, ReleaseBatchRequest) {
+  int fd = CreateTemporaryFile();
+  std::vector<ObjectID> object_ids1 = {random_object_id(), random_object_id(),
+                                       random_object_id()};
+  ASSERT_OK(SendReleaseBatchRequest(fd, object_ids1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaReleaseBatchRequest);
+  std::vector<ObjectID> object_ids2;
+  ASSERT_OK(ReadReleaseBatchRequest(data.data(), data.size(), &object_ids2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  close(fd);
+}
+
 TEST_F(TestPlasmaSerialization, DeleteRequest) {
   int fd = CreateTemporaryFile();
   ObjectID object_id1 = random_object_id();
@@ -271,6 +322,35 @@ TEST_F(TestPlasmaSerialization, DeleteReply) {
   close(fd);
 }
 
+TEST_F(TestPlasmaSerialization, ContainsBatchRequest) {
+  int fd = CreateTemporaryFile();
+  std::vector<ObjectID> object_ids1 = {random_object_id(), random_object_id()};
+  ASSERT_OK(SendContainsBatchRequest(fd, object_ids1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaContainsBatchRequest);
+  std::vector<ObjectID> object_ids2;
+  ASSERT_OK(ReadContainsBatchRequest(data.data(), data.size(), &object_ids2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  close(fd);
+}
+
+TEST_F(TestPlasmaSerialization, ContainsBatchReply) {
+  int fd = CreateTemporaryFile();
+  std::vector<ObjectID> object_ids1 = {random_object_id(), random_object_id(),
+                                       random_object_id()};
+  std::vector<bool> has_object1 = {true, false, true};
+  ASSERT_OK(SendContainsBatchReply(fd, object_ids1, has_object1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaContainsBatchReply);
+  std::vector<ObjectID> object_ids2;
+  std::vector<bool> has_object2;
+  ASSERT_OK(
+      ReadContainsBatchReply(data.data(), data.size(), &object_ids2, &has_object2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  ASSERT_EQ(has_object1, has_object2);
+  close(fd);
+}
+
 TEST_F(TestPlasmaSerialization, EvictRequest) {
   int fd = CreateTemporaryFile();
   int64_t num_bytes = 111;
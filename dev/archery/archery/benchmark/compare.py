@@ -16,10 +16,58 @@
 # under the License.
 
 
+from statistics import mean, stdev
+
+
 # Define a global regression threshold as 5%. This is purely subjective and
 # flawed. This does not track cumulative regression.
 DEFAULT_THRESHOLD = 0.05
 
+# Two-sided 95% critical values of Student's t distribution, indexed by the
+# degrees of freedom.  Larger degrees of freedom use the normal value.
+T_CRITICAL_95 = [
+    None, 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262,
+    2.228, 2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093,
+    2.086, 2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045,
+    2.042,
+]
+
+
+def t_critical_95(dof):
+    dof = max(int(dof), 1)
+    return T_CRITICAL_95[dof] if dof < len(T_CRITICAL_95) else 1.960
+
+
+def change_confidence_interval(contender, baseline):
+    """ 95% confidence interval of the relative change of the means.
+
+    Uses Welch's t-interval on the difference of the means of the repetitions,
+    relative to the baseline mean. Returns None if either side has less than
+    two repetitions.
+    """
+    if len(contender) < 2 or len(baseline) < 2:
+        return None
+
+    mean_cont, mean_base = mean(contender), mean(baseline)
+    if mean_base == 0:
+        return None
+
+    var_cont = stdev(contender) ** 2 / len(contender)
+    var_base = stdev(baseline) ** 2 / len(baseline)
+    stderr = (var_cont + var_base) ** 0.5
+    if stderr == 0:
+        change = (mean_cont - mean_base) / abs(mean_base)
+        return (change, change)
+
+    # Welch-Satterthwaite degrees of freedom
+    dof = (var_cont + var_base) ** 2 / (
+        var_cont ** 2 / (len(contender) - 1) +
+        var_base ** 2 / (len(baseline) - 1))
+    margin = t_critical_95(dof) * stderr
+    diff = mean_cont - mean_base
+    return ((diff - margin) / abs(mean_base),
+            (diff + margin) / abs(mean_base))
+
 
 def items_per_seconds_fmt(value):
     if value < 1000:
@@ -96,10 +144,27 @@ class BenchmarkComparator:
 
         return float(new - old) / abs(old)
 
+    @property
+    def confidence_interval(self):
+        """ 95% confidence interval of the change, or None.
+
+        Requires at least two repetitions of both benchmarks.
+        """
+        return change_confidence_interval(self.contender.values,
+                                          self.baseline.values)
+
     @property
     def confidence(self):
-        """ Indicate if a comparison of benchmarks should be trusted. """
-        return True
+        """ Indicate if a comparison of benchmarks should be trusted.
+
+        With repetitions, the change is trusted if it is statistically
+        significant, i.e. its confidence interval excludes zero.
+        """
+        interval = self.confidence_interval
+        if interval is None:
+            return True
+        lower, upper = interval
+        return lower > 0 or upper < 0
 
     @property
     def regression(self):
@@ -116,11 +181,20 @@ class BenchmarkComparator:
             "regression": self.regression,
             "baseline": fmt(self.baseline.value),
             "contender": fmt(self.contender.value),
+            "change_ci": self._formatted_interval(),
+            "significant": self.confidence,
+            "repetitions": len(self.contender.values),
             "unit": self.unit,
             "less_is_better": self.less_is_better,
             "counters": str(self.baseline.counters)
         }
 
+    def _formatted_interval(self):
+        interval = self.confidence_interval
+        if interval is None:
+            return None
+        return "[{}, {}]".format(*map(change_fmt, interval))
+
     def compare(self, comparator=None):
         return {
             "benchmark": self.name,
@@ -128,6 +202,9 @@ class BenchmarkComparator:
             "regression": self.regression,
             "baseline": self.baseline.value,
             "contender": self.contender.value,
+            "change_ci": self.confidence_interval,
+            "significant": self.confidence,
+            "repetitions": len(self.contender.values),
             "unit": self.unit,
             "less_is_better": self.less_is_better,
             "counters": self.baseline.counters
@@ -27,11 +27,13 @@ def median(values):
 
 
 class Benchmark:
-    def __init__(self, name, unit, less_is_better, values, stats=None):
+    def __init__(self, name, unit, less_is_better, values, stats=None,
+                 counters=None):
         self.name = name
         self.unit = unit
         self.less_is_better = less_is_better
         self.values = sorted(values)
+        self.counters = counters or {}
         self.median = median(self.values)
 
     @property
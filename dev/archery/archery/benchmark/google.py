@@ -17,6 +17,7 @@
 
 from itertools import filterfalse, groupby, tee
 import json
+import os
 import subprocess
 from tempfile import NamedTemporaryFile
 
@@ -37,9 +38,18 @@ class GoogleBenchmarkCommand(Command):
     notably `--benchmark_filter`, `--benchmark_format`, etc...
     """
 
-    def __init__(self, benchmark_bin, benchmark_filter=None):
+    def __init__(self, benchmark_bin, benchmark_filter=None,
+                 cpu_affinity=None):
         self.bin = benchmark_bin
         self.benchmark_filter = benchmark_filter
+        self.cpu_affinity = cpu_affinity
+
+    def run(self, *argv, **kwargs):
+        if self.cpu_affinity:
+            # Pin the benchmark process to reduce scheduling noise
+            cpus = set(self.cpu_affinity)
+            kwargs["preexec_fn"] = lambda: os.sched_setaffinity(0, cpus)
+        return super().run(*argv, **kwargs)
 
     def list_benchmarks(self):
         argv = ["--benchmark_list_tests"]
@@ -159,8 +169,9 @@ class GoogleBenchmark(Benchmark):
         less_is_better = not unit.endswith("per_second")
         values = [b.value for b in self.runs]
         # Slight kludge to extract the UserCounters for each benchmark
-        self.counters = self.runs[0].counters
-        super().__init__(name, unit, less_is_better, values)
+        counters = self.runs[0].counters
+        super().__init__(name, unit, less_is_better, values,
+                         counters=counters)
 
     def __repr__(self):
         return "GoogleBenchmark[name={},runs={}]".format(self.names, self.runs)
@@ -39,10 +39,11 @@ DEFAULT_REPETITIONS = 1
 
 class BenchmarkRunner:
     def __init__(self, suite_filter=None, benchmark_filter=None,
-                 repetitions=DEFAULT_REPETITIONS):
+                 repetitions=DEFAULT_REPETITIONS, cpu_affinity=None):
         self.suite_filter = suite_filter
         self.benchmark_filter = benchmark_filter
         self.repetitions = repetitions
+        self.cpu_affinity = cpu_affinity
 
     @property
     def suites(self):
@@ -166,7 +167,8 @@ class CppBenchmarkRunner(BenchmarkRunner):
 
     def suite(self, name, suite_bin):
         """ Returns the resulting benchmarks for a given suite. """
-        suite_cmd = GoogleBenchmarkCommand(suite_bin, self.benchmark_filter)
+        suite_cmd = GoogleBenchmarkCommand(suite_bin, self.benchmark_filter,
+                                           cpu_affinity=self.cpu_affinity)
 
         # Ensure there will be data
         benchmark_names = suite_cmd.list_benchmarks()
@@ -388,6 +388,29 @@ def benchmark_filter_options(cmd):
     return _apply_options(cmd, options)
 
 
+def _parse_cpu_affinity(ctx, param, value):
+    if value is None:
+        return None
+    try:
+        return [int(cpu) for cpu in value.split(",")]
+    except ValueError:
+        raise click.BadParameter("expected a comma-separated list of CPUs")
+
+
+def benchmark_execution_options(cmd):
+    options = [
+        click.option("--repetitions", type=int, default=1, show_default=True,
+                     help=("Number of repetitions of each benchmark. At "
+                           "least two are required for confidence "
+                           "intervals.")),
+        click.option("--cpu-affinity", metavar="<cpus>", type=str,
+                     default=None, callback=_parse_cpu_affinity,
+                     help=("Comma-separated list of CPUs the benchmark "
+                           "processes are pinned to (Linux only).")),
+    ]
+    return _apply_options(cmd, options)
+
+
 @benchmark.command(name="list", short_help="List benchmark suite")
 @click.argument("rev_or_path", metavar="[<rev_or_path>]",
                 default="WORKSPACE", required=False)
@@ -415,9 +438,11 @@ def benchmark_list(ctx, rev_or_path, src, preserve, output, cmake_extras,
                 default="WORKSPACE", required=False)
 @benchmark_common_options
 @benchmark_filter_options
+@benchmark_execution_options
 @click.pass_context
 def benchmark_run(ctx, rev_or_path, src, preserve, output, cmake_extras,
-                  suite_filter, benchmark_filter, **kwargs):
+                  suite_filter, benchmark_filter, repetitions, cpu_affinity,
+                  **kwargs):
     """ Run benchmark suite.
 
     This command will run the benchmark suite for a single build. This is
@@ -449,6 +474,11 @@ def benchmark_run(ctx, rev_or_path, src, preserve, output, cmake_extras,
     # Run the benchmarks on current previous commit
     \b
     archery benchmark run --output=run.json
+
+    \b
+    # Run 10 repetitions of each benchmark pinned to the CPU 2
+    \b
+    archery benchmark run --repetitions=10 --cpu-affinity=2
     """
     with tmpdir(preserve=preserve) as root:
         logger.debug("Running benchmark {}".format(rev_or_path))
@@ -458,6 +488,7 @@ def benchmark_run(ctx, rev_or_path, src, preserve, output, cmake_extras,
 
         runner_base = BenchmarkRunner.from_rev_or_path(
             src, root, rev_or_path, conf,
+            repetitions=repetitions, cpu_affinity=cpu_affinity,
             suite_filter=suite_filter, benchmark_filter=benchmark_filter)
 
         json.dump(runner_base, output, cls=JsonEncoder)
@@ -466,12 +497,13 @@ def benchmark_run(ctx, rev_or_path, src, preserve, output, cmake_extras,
 @benchmark.command(name="diff", short_help="Compare benchmark suites")
 @benchmark_common_options
 @benchmark_filter_options
+@benchmark_execution_options
 @click.option("--threshold", type=float, default=DEFAULT_THRESHOLD,
               show_default=True,
               help="Regression failure threshold in percentage.")
-@click.option("--repetitions", type=int, default=1, show_default=True,
-              help=("Number of repetitions of each benchmark. Increasing "
-                    "may improve result precision."))
+@click.option("--fail-on-regression", type=BOOL, default=False,
+              is_flag=True,
+              help="Exit with a non-zero status if a regression is found.")
 @click.argument("contender", metavar="[<contender>",
                 default=ArrowSources.WORKSPACE, required=False)
 @click.argument("baseline", metavar="[<baseline>]]", default="origin/master",
@@ -479,7 +511,8 @@ def benchmark_run(ctx, rev_or_path, src, preserve, output, cmake_extras,
 @click.pass_context
 def benchmark_diff(ctx, src, preserve, output, cmake_extras,
                    suite_filter, benchmark_filter,
-                   repetitions, threshold, contender, baseline, **kwargs):
+                   repetitions, cpu_affinity, threshold, fail_on_regression,
+                   contender, baseline, **kwargs):
     """Compare (diff) benchmark runs.
 
     This command acts like git-diff but for benchmark results.
@@ -542,6 +575,12 @@ def benchmark_diff(ctx, src, preserve, output, cmake_extras,
     # Equivalently with no stdout clutter.
     archery --quiet benchmark diff > result.json
 
+    \b
+    # Gate on regressions which are significant over 10 pinned repetitions
+    \b
+    archery benchmark diff --repetitions=10 --cpu-affinity=2 \\
+            --fail-on-regression
+
     \b
     # Comparing with a cached results from `archery benchmark run`
     \b
@@ -559,23 +598,27 @@ def benchmark_diff(ctx, src, preserve, output, cmake_extras,
 
         runner_cont = BenchmarkRunner.from_rev_or_path(
             src, root, contender, conf,
-            repetitions=repetitions,
+            repetitions=repetitions, cpu_affinity=cpu_affinity,
             suite_filter=suite_filter,
             benchmark_filter=benchmark_filter)
         runner_base = BenchmarkRunner.from_rev_or_path(
             src, root, baseline, conf,
-            repetitions=repetitions,
+            repetitions=repetitions, cpu_affinity=cpu_affinity,
             suite_filter=suite_filter,
             benchmark_filter=benchmark_filter)
 
         runner_comp = RunnerComparator(runner_cont, runner_base, threshold)
 
         # TODO(kszucs): test that the output is properly formatted jsonlines
-        comparisons_json = _get_comparisons_as_json(runner_comp.comparisons)
+        comparisons = list(runner_comp.comparisons)
+        comparisons_json = _get_comparisons_as_json(comparisons)
         formatted = _format_comparisons_with_pandas(comparisons_json)
         output.write(formatted)
         output.write('\n')
 
+        if fail_on_regression and any(c.regression for c in comparisons):
+            sys.exit(1)
+
 
 def _get_comparisons_as_json(comparisons):
     buf = StringIO()
@@ -591,7 +634,8 @@ def _format_comparisons_with_pandas(comparisons_json):
     df = pd.read_json(StringIO(comparisons_json), lines=True)
     # parse change % so we can sort by it
     df['change %'] = df.pop('change').str[:-1].map(float)
-    df = df[['benchmark', 'baseline', 'contender', 'change %', 'counters']]
+    df = df[['benchmark', 'baseline', 'contender', 'change %', 'change_ci',
+             'counters']]
     df = df.sort_values(by='change %', ascending=False)
     return df.to_string()
 
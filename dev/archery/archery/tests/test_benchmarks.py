@@ -0,0 +1,72 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+
+from archery.benchmark.compare import (BenchmarkComparator,
+                                       change_confidence_interval)
+from archery.benchmark.core import Benchmark
+
+
+def make_benchmark(values, unit="items_per_second"):
+    return Benchmark("Bench", unit, not unit.endswith("per_second"), values)
+
+
+def test_confidence_interval_requires_repetitions():
+    assert change_confidence_interval([1.0], [1.0, 2.0]) is None
+    assert change_confidence_interval([1.0, 2.0], [1.0]) is None
+
+    comparator = BenchmarkComparator(make_benchmark([80.0]),
+                                     make_benchmark([100.0]))
+    assert comparator.confidence_interval is None
+    # Without repetitions, the comparison is trusted as is
+    assert comparator.confidence
+    assert comparator.regression
+
+
+def test_significant_regression():
+    baseline = make_benchmark([100.0, 101.0, 99.0, 100.5, 99.5])
+    contender = make_benchmark([80.0, 81.0, 79.0, 80.5, 79.5])
+    comparator = BenchmarkComparator(contender, baseline)
+
+    lower, upper = comparator.confidence_interval
+    assert lower < -0.2 < upper < 0
+    assert comparator.confidence
+    assert comparator.regression
+
+    result = comparator.compare()
+    assert result["significant"]
+    assert result["repetitions"] == 5
+    assert result["change_ci"] == (lower, upper)
+
+
+def test_noisy_change_is_not_significant():
+    baseline = make_benchmark([100.0, 60.0, 140.0, 90.0, 110.0])
+    contender = make_benchmark([85.0, 50.0, 120.0, 75.0, 95.0])
+    comparator = BenchmarkComparator(contender, baseline)
+
+    lower, upper = comparator.confidence_interval
+    assert lower < 0 < upper
+    assert not comparator.confidence
+    assert not comparator.regression
+
+
+def test_less_is_better():
+    baseline = make_benchmark([100.0, 101.0, 99.0], unit="ns")
+    contender = make_benchmark([120.0, 121.0, 119.0], unit="ns")
+    comparator = BenchmarkComparator(contender, baseline)
+
+    assert comparator.confidence
+    assert comparator.regression
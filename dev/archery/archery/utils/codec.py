@@ -48,6 +48,7 @@ class BenchmarkCodec:
             "unit": b.unit,
             "less_is_better": b.less_is_better,
             "values": b.values,
+            "counters": b.counters,
         }
 
     @staticmethod
@@ -76,4 +76,14 @@ class OrcReaderJniWrapper {
    * @return id of the stripe reader instance.
    */
   native long nextStripeReader(long readerId, long batchSize);
+
+  /**
+   * Export the next stripe as a C stream interface ArrowArrayStream, whose
+   * record batches are imported without copying their buffers.
+   * @param readerId id of the reader instance
+   * @param batchSize the number of rows loaded on each iteration
+   * @param streamAddress address of an ArrowArrayStream struct to fill
+   * @return false when there are no more stripes
+   */
+  native boolean exportNextStripe(long readerId, long batchSize, long streamAddress);
 }
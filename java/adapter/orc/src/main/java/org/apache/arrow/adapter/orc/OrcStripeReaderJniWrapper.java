@@ -37,6 +37,23 @@ class OrcStripeReaderJniWrapper {
    */
   static native OrcRecordBatch next(long readerId);
 
+  /**
+   * Export the schema of current stripe through the C data interface.
+   * @param readerId id of the stripe reader instance.
+   * @param schemaAddress address of an ArrowSchema struct to fill.
+   */
+  static native void exportSchema(long readerId, long schemaAddress);
+
+  /**
+   * Export next record batch through the C data interface, without copying
+   * its buffers. The buffers are released by the release callback of the
+   * exported struct.
+   * @param readerId id of the stripe reader instance.
+   * @param arrayAddress address of an ArrowArray struct to fill.
+   * @return false when reached the end of current stripe.
+   */
+  static native boolean exportNext(long readerId, long arrayAddress);
+
   /**
    * Release resources of underlying reader.
    * @param readerId id of the stripe reader instance.
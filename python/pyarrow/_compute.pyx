@@ -58,6 +58,17 @@ cdef wrap_scalar_aggregate_function(const shared_ptr[CFunction]& sp_func):
     return func
 
 
+cdef wrap_hash_aggregate_function(const shared_ptr[CFunction]& sp_func):
+    """
+    Wrap a C++ aggregate Function in a HashAggregateFunction object.
+    """
+    cdef HashAggregateFunction func = (
+        HashAggregateFunction.__new__(HashAggregateFunction)
+    )
+    func.init(sp_func)
+    return func
+
+
 cdef wrap_meta_function(const shared_ptr[CFunction]& sp_func):
     """
     Wrap a C++ meta Function in a MetaFunction object.
@@ -85,6 +96,8 @@ cdef wrap_function(const shared_ptr[CFunction]& sp_func):
         return wrap_vector_function(sp_func)
     elif c_kind == FunctionKind_SCALAR_AGGREGATE:
         return wrap_scalar_aggregate_function(sp_func)
+    elif c_kind == FunctionKind_HASH_AGGREGATE:
+        return wrap_hash_aggregate_function(sp_func)
     elif c_kind == FunctionKind_META:
         return wrap_meta_function(sp_func)
     else:
@@ -117,6 +130,16 @@ cdef wrap_scalar_aggregate_kernel(const CScalarAggregateKernel* c_kernel):
     return kernel
 
 
+cdef wrap_hash_aggregate_kernel(const CHashAggregateKernel* c_kernel):
+    if c_kernel == NULL:
+        raise ValueError('Kernel was NULL')
+    cdef HashAggregateKernel kernel = (
+        HashAggregateKernel.__new__(HashAggregateKernel)
+    )
+    kernel.init(c_kernel)
+    return kernel
+
+
 cdef class Kernel(_Weakrefable):
     """
     A kernel object.
@@ -165,6 +188,18 @@ cdef class ScalarAggregateKernel(Kernel):
                 .format(frombytes(self.kernel.signature.get().ToString())))
 
 
+cdef class HashAggregateKernel(Kernel):
+    cdef:
+        const CHashAggregateKernel* kernel
+
+    cdef void init(self, const CHashAggregateKernel* kernel) except *:
+        self.kernel = kernel
+
+    def __repr__(self):
+        return ("HashAggregateKernel<{}>"
+                .format(frombytes(self.kernel.signature.get().ToString())))
+
+
 FunctionDoc = namedtuple(
     "FunctionDoc",
     ("summary", "description", "arg_names", "options_class"))
@@ -249,6 +284,8 @@ cdef class Function(_Weakrefable):
             return 'vector'
         elif c_kind == FunctionKind_SCALAR_AGGREGATE:
             return 'scalar_aggregate'
+        elif c_kind == FunctionKind_HASH_AGGREGATE:
+            return 'hash_aggregate'
         elif c_kind == FunctionKind_META:
             return 'meta'
         else:
@@ -351,6 +388,25 @@ cdef class ScalarAggregateFunction(Function):
         return [wrap_scalar_aggregate_kernel(k) for k in kernels]
 
 
+cdef class HashAggregateFunction(Function):
+    cdef:
+        const CHashAggregateFunction* func
+
+    cdef void init(self, const shared_ptr[CFunction]& sp_func) except *:
+        Function.init(self, sp_func)
+        self.func = <const CHashAggregateFunction*> sp_func.get()
+
+    @property
+    def kernels(self):
+        """
+        The kernels implementing this function.
+        """
+        cdef vector[const CHashAggregateKernel*] kernels = (
+            self.func.kernels()
+        )
+        return [wrap_hash_aggregate_kernel(k) for k in kernels]
+
+
 cdef class MetaFunction(Function):
     cdef:
         const CMetaFunction* func
@@ -606,6 +662,26 @@ class MatchSubstringOptions(_MatchSubstringOptions):
         self._set_options(pattern)
 
 
+cdef class _MatchAnySubstringOptions(FunctionOptions):
+    cdef:
+        unique_ptr[CMatchAnySubstringOptions] match_any_substring_options
+
+    cdef const CFunctionOptions* get_options(self) except NULL:
+        return self.match_any_substring_options.get()
+
+    def _set_options(self, patterns, ignore_case):
+        cdef vector[c_string] c_patterns
+        for pattern in patterns:
+            c_patterns.push_back(tobytes(pattern))
+        self.match_any_substring_options.reset(
+            new CMatchAnySubstringOptions(c_patterns, ignore_case))
+
+
+class MatchAnySubstringOptions(_MatchAnySubstringOptions):
+    def __init__(self, patterns, ignore_case=False):
+        self._set_options(patterns, ignore_case)
+
+
 cdef class _FilterOptions(FunctionOptions):
     cdef:
         CFilterOptions filter_options
@@ -665,6 +741,184 @@ class PartitionNthOptions(_PartitionNthOptions):
         self._set_options(pivot)
 
 
+cdef CSortOrder _unwrap_sort_order(order) except *:
+    if order == 'ascending':
+        return CSortOrder_ASCENDING
+    elif order == 'descending':
+        return CSortOrder_DESCENDING
+    raise ValueError('{!r} is not a valid sort order'.format(order))
+
+
+cdef CNullPlacement _unwrap_null_placement(null_placement) except *:
+    if null_placement == 'at_start':
+        return CNullPlacement_AT_START
+    elif null_placement == 'at_end':
+        return CNullPlacement_AT_END
+    raise ValueError(
+        '{!r} is not a valid null_placement'.format(null_placement))
+
+
+cdef class _ArraySortOptions(FunctionOptions):
+    cdef:
+        unique_ptr[CArraySortOptions] array_sort_options
+
+    cdef const CFunctionOptions* get_options(self) except NULL:
+        return self.array_sort_options.get()
+
+    def _set_options(self, order, null_placement):
+        self.array_sort_options.reset(
+            new CArraySortOptions(_unwrap_sort_order(order),
+                                  _unwrap_null_placement(null_placement)))
+
+
+class ArraySortOptions(_ArraySortOptions):
+    def __init__(self, order='ascending', null_placement='at_end'):
+        self._set_options(order, null_placement)
+
+
+cdef class _SortOptions(FunctionOptions):
+    cdef:
+        unique_ptr[CSortOptions] sort_options
+
+    cdef const CFunctionOptions* get_options(self) except NULL:
+        return self.sort_options.get()
+
+    def _set_options(self, sort_keys, null_placement):
+        cdef vector[CSortKey] c_sort_keys
+        for name, order in sort_keys:
+            c_sort_keys.push_back(
+                CSortKey(tobytes(name), _unwrap_sort_order(order)))
+        self.sort_options.reset(
+            new CSortOptions(c_sort_keys,
+                             _unwrap_null_placement(null_placement)))
+
+
+class SortOptions(_SortOptions):
+    def __init__(self, sort_keys=None, null_placement='at_end'):
+        if sort_keys is None:
+            sort_keys = []
+        self._set_options(sort_keys, null_placement)
+
+
+cdef class _SelectKOptions(FunctionOptions):
+    cdef:
+        unique_ptr[CSelectKOptions] select_k_options
+
+    cdef const CFunctionOptions* get_options(self) except NULL:
+        return self.select_k_options.get()
+
+    def _set_options(self, int64_t k, sort_keys):
+        cdef vector[CSortKey] c_sort_keys
+        for name, order in sort_keys:
+            c_sort_keys.push_back(
+                CSortKey(tobytes(name), _unwrap_sort_order(order)))
+        self.select_k_options.reset(new CSelectKOptions(k, c_sort_keys))
+
+
+class SelectKOptions(_SelectKOptions):
+    def __init__(self, k, sort_keys):
+        self._set_options(k, sort_keys)
+
+
+cdef class _HashPartitionOptions(FunctionOptions):
+    cdef:
+        unique_ptr[CHashPartitionOptions] hash_partition_options
+
+    cdef const CFunctionOptions* get_options(self) except NULL:
+        return self.hash_partition_options.get()
+
+    def _set_options(self, int32_t num_partitions, key_names):
+        cdef vector[c_string] c_key_names
+        for name in key_names:
+            c_key_names.push_back(tobytes(name))
+        self.hash_partition_options.reset(
+            new CHashPartitionOptions(num_partitions, c_key_names))
+
+
+class HashPartitionOptions(_HashPartitionOptions):
+    def __init__(self, num_partitions, key_names=()):
+        self._set_options(num_partitions, key_names)
+
+
+cdef class _RollingWindowOptions(FunctionOptions):
+    cdef:
+        unique_ptr[CRollingWindowOptions] rolling_window_options
+
+    cdef const CFunctionOptions* get_options(self) except NULL:
+        return self.rolling_window_options.get()
+
+    def _set_options(self, window_size, min_periods):
+        if min_periods is None:
+            min_periods = window_size
+        self.rolling_window_options.reset(
+            new CRollingWindowOptions(window_size, min_periods))
+
+
+class RollingWindowOptions(_RollingWindowOptions):
+    def __init__(self, window_size, min_periods=None):
+        self._set_options(window_size, min_periods)
+
+
+cdef class _ShiftOptions(FunctionOptions):
+    cdef:
+        unique_ptr[CShiftOptions] shift_options
+
+    cdef const CFunctionOptions* get_options(self) except NULL:
+        return self.shift_options.get()
+
+    def _set_options(self, int64_t periods):
+        self.shift_options.reset(new CShiftOptions(periods))
+
+
+class ShiftOptions(_ShiftOptions):
+    def __init__(self, periods=1):
+        self._set_options(periods)
+
+
+cdef CFloorTemporalUnit _unwrap_floor_temporal_unit(unit) except *:
+    if unit == 'nanosecond':
+        return CFloorTemporalUnit_NANOSECOND
+    elif unit == 'microsecond':
+        return CFloorTemporalUnit_MICROSECOND
+    elif unit == 'millisecond':
+        return CFloorTemporalUnit_MILLISECOND
+    elif unit == 'second':
+        return CFloorTemporalUnit_SECOND
+    elif unit == 'minute':
+        return CFloorTemporalUnit_MINUTE
+    elif unit == 'hour':
+        return CFloorTemporalUnit_HOUR
+    elif unit == 'day':
+        return CFloorTemporalUnit_DAY
+    elif unit == 'week':
+        return CFloorTemporalUnit_WEEK
+    elif unit == 'month':
+        return CFloorTemporalUnit_MONTH
+    elif unit == 'quarter':
+        return CFloorTemporalUnit_QUARTER
+    elif unit == 'year':
+        return CFloorTemporalUnit_YEAR
+    raise ValueError('{!r} is not a valid unit'.format(unit))
+
+
+cdef class _FloorTemporalOptions(FunctionOptions):
+    cdef:
+        unique_ptr[CFloorTemporalOptions] floor_temporal_options
+
+    cdef const CFunctionOptions* get_options(self) except NULL:
+        return self.floor_temporal_options.get()
+
+    def _set_options(self, int64_t multiple, unit):
+        self.floor_temporal_options.reset(
+            new CFloorTemporalOptions(multiple,
+                                      _unwrap_floor_temporal_unit(unit)))
+
+
+class FloorTemporalOptions(_FloorTemporalOptions):
+    def __init__(self, multiple=1, unit='day'):
+        self._set_options(multiple, unit)
+
+
 cdef class _MinMaxOptions(FunctionOptions):
     cdef:
         CMinMaxOptions min_max_options
@@ -787,6 +1041,43 @@ class VarianceOptions(_VarianceOptions):
         self._set_options(ddof)
 
 
+cdef class _ApproxCountDistinctOptions(FunctionOptions):
+    cdef:
+        CApproxCountDistinctOptions approx_count_distinct_options
+
+    cdef const CFunctionOptions* get_options(self) except NULL:
+        return &self.approx_count_distinct_options
+
+    def _set_options(self, precision):
+        self.approx_count_distinct_options.precision = precision
+
+
+class ApproxCountDistinctOptions(_ApproxCountDistinctOptions):
+    def __init__(self, *, precision=11):
+        self._set_options(precision)
+
+
+cdef class _ApproxQuantileOptions(FunctionOptions):
+    cdef:
+        CApproxQuantileOptions approx_quantile_options
+
+    cdef const CFunctionOptions* get_options(self) except NULL:
+        return &self.approx_quantile_options
+
+    def _set_options(self, q, delta, buffer_size):
+        if isinstance(q, (list, tuple)):
+            self.approx_quantile_options.q = q
+        else:
+            self.approx_quantile_options.q = [q]
+        self.approx_quantile_options.delta = delta
+        self.approx_quantile_options.buffer_size = buffer_size
+
+
+class ApproxQuantileOptions(_ApproxQuantileOptions):
+    def __init__(self, *, q=0.5, delta=100, buffer_size=500):
+        self._set_options(q, delta, buffer_size)
+
+
 cdef class _SplitOptions(FunctionOptions):
     cdef:
         unique_ptr[CSplitOptions] split_options
@@ -721,7 +721,8 @@ def open_csv(input_file, read_options=None, parse_options=None,
     """
     Open a streaming reader of CSV data.
 
-    Reading using this function is always single-threaded.
+    If `read_options.use_threads` is true, upcoming blocks are read, parsed
+    and converted in the background while batches are being consumed.
 
     Parameters
     ----------
@@ -2234,22 +2234,41 @@ cdef class Scanner(_Weakrefable):
     def to_batches(self):
         """Consume a Scanner in record batches.
 
-        Sequentially executes the ScanTasks as the returned generator gets
-        consumed.
+        The batches are yielded in a deterministic order: fragment by
+        fragment, and in order within each fragment.  If the scanner uses
+        threads, fragments are read and decoded in parallel ahead of the
+        consumer, holding a bounded amount of data in memory.
 
         Returns
         -------
         record_batches : iterator of RecordBatch
         """
-        for task in self.scan():
-            for batch in task.execute():
-                yield batch
+        cdef shared_ptr[CRecordBatch] record_batch
+        with nogil:
+            for maybe_batch in GetResultValue(self.scanner.ScanBatches()):
+                record_batch = GetResultValue(move(maybe_batch))
+                with gil:
+                    yield pyarrow_wrap_batch(record_batch)
+
+    def to_reader(self):
+        """Consume this scanner as a RecordBatchReader.
+
+        The batches are read in the same order as with `to_batches`.
+
+        Returns
+        -------
+        reader : RecordBatchReader
+        """
+        cdef RecordBatchReader reader
+        reader = RecordBatchReader.__new__(RecordBatchReader)
+        reader.reader = GetResultValue(self.scanner.ToRecordBatchReader())
+        return reader
 
     def to_table(self):
         """Convert a Scanner into a Table.
 
-        Use this convenience utility with care. This will serially materialize
-        the Scan result in memory before creating the Table.
+        Use this convenience utility with care. This will materialize the
+        Scan result in memory before creating the Table.
 
         Returns
         -------
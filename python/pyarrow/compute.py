@@ -19,6 +19,8 @@ from pyarrow._compute import (  # noqa
     Function,
     FunctionOptions,
     FunctionRegistry,
+    HashAggregateFunction,
+    HashAggregateKernel,
     Kernel,
     ScalarAggregateFunction,
     ScalarAggregateKernel,
@@ -27,15 +29,25 @@ from pyarrow._compute import (  # noqa
     VectorFunction,
     VectorKernel,
     # Option classes
+    ApproxCountDistinctOptions,
+    ApproxQuantileOptions,
+    ArraySortOptions,
     CastOptions,
     CountOptions,
     FilterOptions,
+    FloorTemporalOptions,
+    HashPartitionOptions,
+    MatchAnySubstringOptions,
     MatchSubstringOptions,
     SplitOptions,
     SplitPatternOptions,
     MinMaxOptions,
     PartitionNthOptions,
+    RollingWindowOptions,
+    SelectKOptions,
     SetLookupOptions,
+    ShiftOptions,
+    SortOptions,
     StrptimeOptions,
     TakeOptions,
     VarianceOptions,
@@ -210,6 +222,10 @@ def _make_global_functions():
     for cpp_name in reg.list_functions():
         name = rewrites.get(cpp_name, cpp_name)
         func = reg.get_function(cpp_name)
+        if func.kind == "hash_aggregate":
+            # Hash aggregate functions are not callable,
+            # so let's not expose them at module level.
+            continue
         assert name not in g, name
         g[cpp_name] = g[name] = _wrap_function(name, func)
 
@@ -293,6 +309,45 @@ def match_substring(array, pattern):
                          MatchSubstringOptions(pattern))
 
 
+def match_any_substring(array, patterns, ignore_case=False):
+    """
+    Test if any of *patterns* is contained within a value of a string array.
+
+    Parameters
+    ----------
+    array : pyarrow.Array or pyarrow.ChunkedArray
+    patterns : list of str
+        patterns to search for exact matches
+    ignore_case : bool, default False
+        whether ASCII letters are matched regardless of their case
+
+    Returns
+    -------
+    result : pyarrow.Array or pyarrow.ChunkedArray
+    """
+    return call_function("match_any_substring", [array],
+                         MatchAnySubstringOptions(patterns, ignore_case))
+
+
+def match_regex(array, pattern):
+    """
+    Test if regular expression *pattern* matches within a value of a string
+    array.
+
+    Parameters
+    ----------
+    array : pyarrow.Array or pyarrow.ChunkedArray
+    pattern : str
+        regular expression in RE2 syntax
+
+    Returns
+    -------
+    result : pyarrow.Array or pyarrow.ChunkedArray
+    """
+    return call_function("match_regex", [array],
+                         MatchSubstringOptions(pattern))
+
+
 def sum(array):
     """
     Sum the values in a numerical (chunked) array.
@@ -1626,6 +1626,10 @@ cdef extern from "arrow/compute/api.h" namespace "arrow::compute" nogil:
             " arrow::compute::ScalarAggregateKernel"(CKernel):
         pass
 
+    cdef cppclass CHashAggregateKernel \
+            " arrow::compute::HashAggregateKernel"(CKernel):
+        pass
+
     cdef cppclass CArity" arrow::compute::Arity":
         int num_args
         c_bool is_varargs
@@ -1635,6 +1639,8 @@ cdef extern from "arrow/compute/api.h" namespace "arrow::compute" nogil:
         FunctionKind_VECTOR" arrow::compute::Function::VECTOR"
         FunctionKind_SCALAR_AGGREGATE \
             " arrow::compute::Function::SCALAR_AGGREGATE"
+        FunctionKind_HASH_AGGREGATE \
+            " arrow::compute::Function::HASH_AGGREGATE"
         FunctionKind_META \
             " arrow::compute::Function::META"
 
@@ -1668,6 +1674,11 @@ cdef extern from "arrow/compute/api.h" namespace "arrow::compute" nogil:
             (CFunction):
         vector[const CScalarAggregateKernel*] kernels() const
 
+    cdef cppclass CHashAggregateFunction\
+            " arrow::compute::HashAggregateFunction"\
+            (CFunction):
+        vector[const CHashAggregateKernel*] kernels() const
+
     cdef cppclass CMetaFunction" arrow::compute::MetaFunction"(CFunction):
         pass
 
@@ -1684,6 +1695,12 @@ cdef extern from "arrow/compute/api.h" namespace "arrow::compute" nogil:
         CMatchSubstringOptions(c_string pattern)
         c_string pattern
 
+    cdef cppclass CMatchAnySubstringOptions \
+            "arrow::compute::MatchAnySubstringOptions"(CFunctionOptions):
+        CMatchAnySubstringOptions(vector[c_string] patterns, c_bool ignore_case)
+        vector[c_string] patterns
+        c_bool ignore_case
+
     cdef cppclass CSplitOptions \
             "arrow::compute::SplitOptions"(CFunctionOptions):
         CSplitOptions(int64_t max_splits, c_bool reverse)
@@ -1737,6 +1754,16 @@ cdef extern from "arrow/compute/api.h" namespace "arrow::compute" nogil:
             "arrow::compute::VarianceOptions"(CFunctionOptions):
         int ddof
 
+    cdef cppclass CApproxCountDistinctOptions \
+            "arrow::compute::ApproxCountDistinctOptions"(CFunctionOptions):
+        int precision
+
+    cdef cppclass CApproxQuantileOptions \
+            "arrow::compute::ApproxQuantileOptions"(CFunctionOptions):
+        vector[double] q
+        uint32_t delta
+        uint32_t buffer_size
+
     enum CMinMaxMode \
             "arrow::compute::MinMaxOptions::Mode":
         CMinMaxMode_SKIP \
@@ -1764,6 +1791,90 @@ cdef extern from "arrow/compute/api.h" namespace "arrow::compute" nogil:
         CPartitionNthOptions(int64_t pivot)
         int64_t pivot
 
+    enum CSortOrder" arrow::compute::SortOrder":
+        CSortOrder_ASCENDING \
+            "arrow::compute::SortOrder::Ascending"
+        CSortOrder_DESCENDING \
+            "arrow::compute::SortOrder::Descending"
+
+    enum CNullPlacement" arrow::compute::NullPlacement":
+        CNullPlacement_AT_START \
+            "arrow::compute::NullPlacement::AtStart"
+        CNullPlacement_AT_END \
+            "arrow::compute::NullPlacement::AtEnd"
+
+    cdef cppclass CArraySortOptions \
+            "arrow::compute::ArraySortOptions"(CFunctionOptions):
+        CArraySortOptions(CSortOrder order, CNullPlacement null_placement)
+        CSortOrder order
+        CNullPlacement null_placement
+
+    cdef cppclass CSortKey" arrow::compute::SortKey":
+        CSortKey(c_string name, CSortOrder order)
+        c_string name
+        CSortOrder order
+
+    cdef cppclass CSortOptions \
+            "arrow::compute::SortOptions"(CFunctionOptions):
+        CSortOptions(vector[CSortKey] sort_keys, CNullPlacement null_placement)
+        vector[CSortKey] sort_keys
+        CNullPlacement null_placement
+
+    cdef cppclass CSelectKOptions \
+            "arrow::compute::SelectKOptions"(CFunctionOptions):
+        CSelectKOptions(int64_t k, vector[CSortKey] sort_keys)
+        int64_t k
+        vector[CSortKey] sort_keys
+
+    cdef cppclass CHashPartitionOptions \
+            "arrow::compute::HashPartitionOptions"(CFunctionOptions):
+        CHashPartitionOptions(int32_t num_partitions,
+                              vector[c_string] key_names)
+        int32_t num_partitions
+        vector[c_string] key_names
+
+    cdef cppclass CRollingWindowOptions \
+            "arrow::compute::RollingWindowOptions"(CFunctionOptions):
+        CRollingWindowOptions(int64_t window_size, int64_t min_periods)
+        int64_t window_size
+        int64_t min_periods
+
+    cdef cppclass CShiftOptions \
+            "arrow::compute::ShiftOptions"(CFunctionOptions):
+        CShiftOptions(int64_t periods)
+        int64_t periods
+
+    enum CFloorTemporalUnit \
+            "arrow::compute::FloorTemporalOptions::Unit":
+        CFloorTemporalUnit_NANOSECOND \
+            "arrow::compute::FloorTemporalOptions::NANOSECOND"
+        CFloorTemporalUnit_MICROSECOND \
+            "arrow::compute::FloorTemporalOptions::MICROSECOND"
+        CFloorTemporalUnit_MILLISECOND \
+            "arrow::compute::FloorTemporalOptions::MILLISECOND"
+        CFloorTemporalUnit_SECOND \
+            "arrow::compute::FloorTemporalOptions::SECOND"
+        CFloorTemporalUnit_MINUTE \
+            "arrow::compute::FloorTemporalOptions::MINUTE"
+        CFloorTemporalUnit_HOUR \
+            "arrow::compute::FloorTemporalOptions::HOUR"
+        CFloorTemporalUnit_DAY \
+            "arrow::compute::FloorTemporalOptions::DAY"
+        CFloorTemporalUnit_WEEK \
+            "arrow::compute::FloorTemporalOptions::WEEK"
+        CFloorTemporalUnit_MONTH \
+            "arrow::compute::FloorTemporalOptions::MONTH"
+        CFloorTemporalUnit_QUARTER \
+            "arrow::compute::FloorTemporalOptions::QUARTER"
+        CFloorTemporalUnit_YEAR \
+            "arrow::compute::FloorTemporalOptions::YEAR"
+
+    cdef cppclass CFloorTemporalOptions \
+            "arrow::compute::FloorTemporalOptions"(CFunctionOptions):
+        CFloorTemporalOptions(int64_t multiple, CFloorTemporalUnit unit)
+        int64_t multiple
+        CFloorTemporalUnit unit
+
     enum DatumType" arrow::Datum::type":
         DatumType_NONE" arrow::Datum::NONE"
         DatumType_SCALAR" arrow::Datum::SCALAR"
@@ -138,6 +138,8 @@ cdef extern from "arrow/dataset/api.h" namespace "arrow::dataset" nogil:
         CScanner(shared_ptr[CFragment], shared_ptr[CScanOptions],
                  shared_ptr[CScanContext])
         CResult[CScanTaskIterator] Scan()
+        CResult[CRecordBatchIterator] ScanBatches()
+        CResult[shared_ptr[CRecordBatchReader]] ToRecordBatchReader()
         CResult[shared_ptr[CTable]] ToTable()
         CFragmentIterator GetFragments()
         const shared_ptr[CScanOptions]& options()
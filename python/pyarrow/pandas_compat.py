@@ -547,11 +547,12 @@ def dataframe_to_arrays(df, schema, preserve_index, nthreads=1, columns=None,
                                                columns)
 
     # NOTE(wesm): If nthreads=None, then we use a heuristic to decide whether
-    # using a thread pool is worth it. Currently the heuristic is whether the
-    # nrows > 100 * ncols and ncols > 1.
+    # using a thread pool is worth it. Currently the heuristic is whether there
+    # are several columns, each long enough to amortize the cost of a task, and
+    # enough values overall. Wide frames are thus converted in parallel too.
     if nthreads is None:
         nrows, ncols = len(df), len(df.columns)
-        if nrows > ncols * 100 and ncols > 1:
+        if ncols > 1 and nrows > 100 and nrows * ncols > 100000:
             nthreads = pa.cpu_count()
         else:
             nthreads = 1
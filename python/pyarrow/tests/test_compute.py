@@ -259,6 +259,41 @@ def test_match_substring():
     assert expected.equals(result)
 
 
+def test_match_any_substring():
+    arr = pa.array(["ab", "abc", "ba", "CD", None])
+    result = pc.match_any_substring(arr, ["bc", "ba"])
+    expected = pa.array([False, True, True, False, None])
+    assert expected.equals(result)
+
+    result = pc.match_any_substring(arr, ["cd"], ignore_case=True)
+    expected = pa.array([False, False, False, True, None])
+    assert expected.equals(result)
+
+
+def test_match_regex():
+    arr = pa.array(["ab", "abc", "ba", None])
+    result = pc.match_regex(arr, "^ab")
+    expected = pa.array([True, True, False, None])
+    assert expected.equals(result)
+
+
+def test_window_functions():
+    arr = pa.chunked_array([[1, 2, None], [4, 5]])
+    result = pc.cumulative_sum(arr)
+    assert result.equals(pa.chunked_array([[1, 3, None], [7, 12]]))
+
+    result = pc.rolling_mean(arr, window_size=2, min_periods=1)
+    expected = pa.chunked_array([[1, 1.5, 2], [4, 4.5]])
+    assert result.equals(expected)
+
+    result = pc.lag(arr, periods=2)
+    expected = pa.chunked_array([[None, None, 1], [2, None]])
+    assert result.equals(expected)
+    result = pc.lead(arr)
+    expected = pa.chunked_array([[2, None, 4], [5, None]])
+    assert result.equals(expected)
+
+
 def test_split_pattern():
     arr = pa.array(["-foo---bar--", "---foo---b"])
     result = pc.split_pattern(arr, pattern="---")
@@ -948,6 +983,22 @@ def test_strptime():
     assert got == expected
 
 
+def test_temporal_components():
+    arr = pa.array([datetime(2000, 2, 29, 23, 23, 23), None,
+                    datetime(1899, 1, 1, 0, 59, 20)], type=pa.timestamp('ms'))
+    assert pc.year(arr) == pa.array([2000, None, 1899])
+    assert pc.day_of_week(arr) == pa.array([1, None, 6])
+    assert pc.minute(arr) == pa.array([23, None, 59])
+
+    got = pc.floor_temporal(arr, multiple=3, unit='month')
+    expected = pa.array([datetime(2000, 1, 1), None, datetime(1899, 1, 1)],
+                        type=pa.timestamp('ms'))
+    assert got == expected
+
+    with pytest.raises(ValueError, match="not a valid unit"):
+        pc.floor_temporal(arr, unit='fortnight')
+
+
 def test_count():
     arr = pa.array([1, 2, 3, None, None])
     assert pc.count(arr).as_py() == 3
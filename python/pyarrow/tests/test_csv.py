@@ -1186,6 +1186,15 @@ class TestSerialStreamingCSVRead(BaseTestStreamingCSVRead, unittest.TestCase):
         assert pa.total_allocated_bytes() == old_allocated
 
 
+class TestParallelStreamingCSVRead(BaseTestStreamingCSVRead,
+                                   unittest.TestCase):
+
+    def open_csv(self, *args, **kwargs):
+        read_options = kwargs.setdefault('read_options', ReadOptions())
+        read_options.use_threads = True
+        return open_csv(*args, **kwargs)
+
+
 class BaseTestCompressedCSVRead:
 
     def setUp(self):
@@ -356,6 +356,28 @@ def test_scanner(dataset):
             assert batch.num_columns == 1
 
 
+@pytest.mark.parametrize('use_threads', [False, True])
+def test_scanner_batches_in_order(tempdir, use_threads):
+    import pyarrow.feather as feather
+
+    for i in range(5):
+        table = pa.table({'i64': pa.array([i] * 10 + [None], pa.int64())})
+        feather.write_feather(table, str(tempdir / '{}.feather'.format(i)),
+                              compression='uncompressed', chunksize=4)
+
+    dataset = ds.dataset(str(tempdir), format='ipc')
+    scanner = ds.Scanner.from_dataset(dataset, use_threads=use_threads)
+    expected = [batch for task in scanner.scan() for batch in task.execute()]
+    assert len(expected) == 15
+
+    assert list(scanner.to_batches()) == expected
+
+    reader = scanner.to_reader()
+    assert isinstance(reader, pa.RecordBatchReader)
+    assert reader.schema == dataset.schema
+    assert reader.read_all() == pa.Table.from_batches(expected)
+
+
 def test_abstract_classes():
     classes = [
         ds.FileFormat,
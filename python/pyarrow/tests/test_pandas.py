@@ -2510,6 +2510,26 @@ class TestConvertMisc:
             pool.close()
             pool.join()
 
+    def test_threaded_conversion_row_ranges(self):
+        # With fewer columns than threads, the rows of long columns are
+        # written by several threads
+        n = 300000
+        ints = pa.chunked_array([pa.array(np.arange(n // 3)),
+                                 pa.array(np.arange(n // 3, n))])
+        floats = pa.array([None if i % 7 == 0 else i / 2 for i in range(n)])
+        bools = pa.array(np.arange(n) % 3 == 0)
+        table = pa.table({'ints': ints, 'floats': floats, 'bools': bools})
+
+        cpu_count = pa.cpu_count()
+        pa.set_cpu_count(8)
+        try:
+            result = table.to_pandas(use_threads=True)
+        finally:
+            pa.set_cpu_count(cpu_count)
+        expected = table.to_pandas(use_threads=False)
+        tm.assert_frame_equal(result, expected)
+        assert result['ints'].tolist() == list(range(n))
+
     def test_category(self):
         repeats = 5
         v1 = ['foo', None, 'bar', 'qux', np.nan]